@@ -42,8 +42,10 @@
 #  Shapes           - Shapes library
 #  Text             - Text library
 #  TextureTools     - TextureTools library
+#  BlockCompressionImageConverter - Block compression image converter plugin
 #  MagnumFont       - Magnum bitmap font plugin
 #  MagnumFontConverter - Magnum bitmap font converter plugin
+#  MeshCacheImporter - Binary mesh cache importer plugin
 #  ObjImporter      - OBJ importer plugin
 #  TgaImageConverter - TGA image converter plugin
 #  TgaImporter      - TGA importer plugin
@@ -54,6 +56,7 @@
 #  Sdl2Application  - SDL2 application
 #  XEglApplication  - X/EGL application
 #  WindowlessCglApplication - Windowless CGL application
+#  WindowlessEglApplication - Windowless EGL application
 #  WindowlessGlxApplication - Windowless GLX application
 #  WindowlessNaClApplication - Windowless NaCl application
 #  WindowlessWglApplication - Windowless WGL application
@@ -91,6 +94,10 @@
 #  MAGNUM_BUILD_DEPRECATED      - Defined if compiled with deprecated APIs
 #   included
 #  MAGNUM_BUILD_STATIC          - Defined if compiled as static libraries
+#  MAGNUM_BUILD_SIMD            - Defined if compiled with SIMD math
+#   specializations
+#  MAGNUM_BUILD_MULTITHREADED   - Defined if compiled with current context
+#   tracked separately for each thread
 #  MAGNUM_TARGET_GLES           - Defined if compiled for OpenGL ES
 #  MAGNUM_TARGET_GLES2          - Defined if compiled for OpenGL ES 2.0
 #  MAGNUM_TARGET_GLES3          - Defined if compiled for OpenGL ES 3.0
@@ -197,6 +204,8 @@ file(READ ${MAGNUM_INCLUDE_DIR}/Magnum/configure.h _magnumConfigure)
 set(_magnumFlags
     BUILD_DEPRECATED
     BUILD_STATIC
+    BUILD_SIMD
+    BUILD_MULTITHREADED
     TARGET_GLES
     TARGET_GLES2
     TARGET_GLES3
@@ -233,10 +242,14 @@ foreach(component ${Magnum_FIND_COMPONENTS})
     string(TOUPPER ${component} _COMPONENT)
 
     # The dependencies need to be sorted by their dependency order as well
-    if(component STREQUAL Shapes)
+    if(component STREQUAL Audio)
+        set(_MAGNUM_${_COMPONENT}_DEPENDENCIES SceneGraph)
+    elseif(component STREQUAL Shapes)
         set(_MAGNUM_${_COMPONENT}_DEPENDENCIES SceneGraph)
     elseif(component STREQUAL Text)
         set(_MAGNUM_${_COMPONENT}_DEPENDENCIES TextureTools)
+    elseif(component STREQUAL BlockCompressionImageConverter)
+        set(_MAGNUM_${_COMPONENT}_DEPENDENCIES TextureTools)
     elseif(component STREQUAL DebugTools)
         set(_MAGNUM_${_COMPONENT}_DEPENDENCIES MeshTools Primitives SceneGraph Shaders Shapes)
     elseif(component STREQUAL MagnumFont)
@@ -245,6 +258,8 @@ foreach(component ${Magnum_FIND_COMPONENTS})
         set(_MAGNUM_${_COMPONENT}_DEPENDENCIES TgaImageConverter) # and below
     elseif(component STREQUAL ObjImporter)
         set(_MAGNUM_${_COMPONENT}_DEPENDENCIES MeshTools)
+    elseif(component STREQUAL Primitives)
+        set(_MAGNUM_${_COMPONENT}_DEPENDENCIES MeshTools)
     endif()
 
     if(component MATCHES ".+AudioImporter")
@@ -418,6 +433,15 @@ foreach(component ${Magnum_FIND_COMPONENTS})
             else()
                 unset(MAGNUM_${_COMPONENT}_LIBRARY)
             endif()
+
+        # Windowless EGL application dependencies
+        elseif(${component} STREQUAL WindowlessEglApplication)
+            find_package(EGL)
+            if(EGL_FOUND)
+                set(_MAGNUM_${_COMPONENT}_LIBRARIES ${EGL_LIBRARY})
+            else()
+                unset(MAGNUM_${_COMPONENT}_LIBRARY)
+            endif()
         endif()
 
     # Context libraries
@@ -0,0 +1,285 @@
+#ifndef Magnum_AbstractAsyncResourceLoader_h
+#define Magnum_AbstractAsyncResourceLoader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::AbstractAsyncResourceLoader
+ */
+
+#include <deque>
+#include <utility>
+#include <vector>
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#include "Magnum/AbstractResourceLoader.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+namespace Magnum {
+
+/**
+@brief Base for asynchronous resource loaders
+
+Splits resource loading into two phases. The first phase, implemented in
+@ref doLoadData(), is executed on a pool of worker threads and is meant to do
+all the expensive work that doesn't need OpenGL context --- file IO, decoding,
+@ref MeshTools processing etc. --- and produces intermediate data of type
+@p U. The second phase, implemented in @ref doUpload(), is executed on the
+thread calling @ref update() (usually the thread with OpenGL context) and
+creates the final resource from the intermediate data, e.g. by uploading them
+to a @ref Buffer or @ref Texture.
+
+After @ref ResourceManager::get() requests a resource, its state is
+@ref ResourceState::Loading until @ref update() delivers it. The calling
+thread is never blocked by the loading, so calling @ref update() once per
+frame is enough:
+@code
+class MeshResourceLoader: public AbstractAsyncResourceLoader<Mesh, Trade::MeshData3D> {
+    public:
+        ~MeshResourceLoader() { stop(); }
+
+    private:
+        std::optional<Trade::MeshData3D> doLoadData(ResourceKey key) override {
+            // Open and decode the file, return std::nullopt if not found...
+        }
+
+        void doUpload(ResourceKey key, Trade::MeshData3D&& data) override {
+            Mesh* mesh = new Mesh;
+            // Upload the data...
+            set(key, mesh, ResourceDataState::Final, ResourcePolicy::Resident);
+        }
+};
+
+MyResourceManager manager;
+MeshResourceLoader loader;
+manager.setLoader(&loader);
+
+Resource<Mesh> mesh = manager.get<Mesh>("my-mesh");
+
+// In each frame
+loader.update();
+if(mesh) mesh->draw(shader);
+@endcode
+
+If @ref doLoadData() returns `std::nullopt`, the resource is marked as not
+found. Because @ref doLoadData() is called from worker threads, it must not
+access the @ref ResourceManager and it must be safe to call it from more
+threads at once if more than one worker thread is used. Subclasses need to
+call @ref stop() in their destructor so the workers don't call
+@ref doLoadData() on partially destroyed instance.
+
+On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" there are no threads and
+@ref doLoadData() is called directly from @ref ResourceManager::get(), the
+resource is however still delivered only in @ref update().
+*/
+template<class T, class U> class AbstractAsyncResourceLoader: public AbstractResourceLoader<T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param threadCount   Worker thread count
+         *
+         * Expects that @p threadCount is at least `1`. The threads are
+         * started lazily on first request.
+         */
+        explicit AbstractAsyncResourceLoader(UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Destructor
+         *
+         * Calls @ref stop().
+         */
+        ~AbstractAsyncResourceLoader();
+
+        /** @brief Worker thread count */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Count of pending resources
+         *
+         * Count of resources requested, but not yet delivered by
+         * @ref update().
+         */
+        std::size_t pendingCount() const { return _pendingCount; }
+
+        /**
+         * @brief Deliver loaded resources
+         * @param maxCount  Max count of resources to deliver
+         * @return Count of delivered resources
+         *
+         * Calls @ref doUpload() (or marks the resource as not found) for at
+         * most @p maxCount resources which finished the first loading phase.
+         * Doesn't wait for resources which are still being loaded.
+         */
+        std::size_t update(std::size_t maxCount = ~std::size_t{});
+
+        /**
+         * @brief Stop worker threads
+         *
+         * Waits for the resources currently being loaded, discards the
+         * remaining requests and joins the worker threads. Resources not yet
+         * delivered by @ref update() stay in @ref ResourceState::Loading
+         * state. Subsequent requests start the threads again.
+         */
+        void stop();
+
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    private:
+    #else
+    protected:
+    #endif
+        /**
+         * @brief Load resource data
+         *
+         * Called from worker thread, see class documentation for more
+         * information.
+         */
+        virtual std::optional<U> doLoadData(ResourceKey key) = 0;
+
+        /**
+         * @brief Upload resource data
+         *
+         * Called from @ref update(), the implementation is expected to call
+         * @ref set() with the final resource.
+         */
+        virtual void doUpload(ResourceKey key, U&& data) = 0;
+
+    private:
+        void doLoad(ResourceKey key) override final;
+
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        void work();
+        #endif
+
+        UnsignedInt _threadCount;
+        std::size_t _pendingCount;
+        std::deque<ResourceKey> _requested;
+        std::deque<std::pair<ResourceKey, std::optional<U>>> _loaded;
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        std::vector<std::thread> _threads;
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        bool _stopping;
+        #endif
+};
+
+template<class T, class U> AbstractAsyncResourceLoader<T, U>::AbstractAsyncResourceLoader(const UnsignedInt threadCount): _threadCount{threadCount}, _pendingCount{}
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    , _stopping{}
+    #endif
+{
+    CORRADE_ASSERT(threadCount, "AbstractAsyncResourceLoader: expected at least one thread", );
+}
+
+template<class T, class U> AbstractAsyncResourceLoader<T, U>::~AbstractAsyncResourceLoader() { stop(); }
+
+template<class T, class U> void AbstractAsyncResourceLoader<T, U>::doLoad(const ResourceKey key) {
+    ++_pendingCount;
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _requested.push_back(key);
+    }
+
+    if(_threads.empty()) {
+        _threads.reserve(_threadCount);
+        for(UnsignedInt i = 0; i != _threadCount; ++i)
+            _threads.emplace_back(&AbstractAsyncResourceLoader<T, U>::work, this);
+    }
+
+    _condition.notify_one();
+    #else
+    _loaded.emplace_back(key, doLoadData(key));
+    #endif
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+template<class T, class U> void AbstractAsyncResourceLoader<T, U>::work() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    for(;;) {
+        _condition.wait(lock, [this]() { return _stopping || !_requested.empty(); });
+        if(_stopping) return;
+
+        const ResourceKey key = _requested.front();
+        _requested.pop_front();
+
+        /* Load without holding the lock so other workers can proceed */
+        lock.unlock();
+        std::optional<U> data = doLoadData(key);
+        lock.lock();
+
+        _loaded.emplace_back(key, std::move(data));
+    }
+}
+#endif
+
+template<class T, class U> std::size_t AbstractAsyncResourceLoader<T, U>::update(const std::size_t maxCount) {
+    std::size_t count = 0;
+    while(count != maxCount) {
+        std::pair<ResourceKey, std::optional<U>> loaded;
+        {
+            #ifndef CORRADE_TARGET_EMSCRIPTEN
+            std::lock_guard<std::mutex> lock{_mutex};
+            #endif
+            if(_loaded.empty()) break;
+            loaded = std::move(_loaded.front());
+            _loaded.pop_front();
+        }
+
+        /* Upload outside of the lock, workers may meanwhile continue */
+        if(loaded.second) doUpload(loaded.first, std::move(*loaded.second));
+        else this->setNotFound(loaded.first);
+
+        --_pendingCount;
+        ++count;
+    }
+
+    return count;
+}
+
+template<class T, class U> void AbstractAsyncResourceLoader<T, U>::stop() {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _stopping = true;
+        _pendingCount -= _requested.size();
+        _requested.clear();
+    }
+    _condition.notify_all();
+
+    for(std::thread& thread: _threads) thread.join();
+    _threads.clear();
+    _stopping = false;
+    #endif
+}
+
+}
+
+#endif
@@ -31,6 +31,9 @@
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Image.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/Color.h"
+#endif
 
 #include "Implementation/FramebufferState.h"
 #include "Implementation/State.h"
@@ -102,27 +105,40 @@ void AbstractFramebuffer::bind(const FramebufferTarget target) {
 }
 
 void AbstractFramebuffer::bindInternal(FramebufferTarget target) {
-    Implementation::FramebufferState& state = *Context::current()->state().framebuffer;
+    Implementation::State& contextState = Context::current()->state();
+    Implementation::FramebufferState& state = *contextState.framebuffer;
 
     /* If already bound, done, otherwise update tracked state */
     if(target == FramebufferTarget::Read) {
-        if(state.readBinding == _id) return;
+        if(state.readBinding == _id) {
+            ++contextState.elidedStateChangeCount;
+            return;
+        }
         state.readBinding = _id;
     } else if(target == FramebufferTarget::Draw) {
-        if(state.drawBinding == _id) return;
+        if(state.drawBinding == _id) {
+            ++contextState.elidedStateChangeCount;
+            return;
+        }
         state.drawBinding = _id;
     } else if(target == FramebufferTarget::ReadDraw) {
-        if(state.readBinding == _id && state.drawBinding == _id) return;
+        if(state.readBinding == _id && state.drawBinding == _id) {
+            ++contextState.elidedStateChangeCount;
+            return;
+        }
         state.readBinding = state.drawBinding = _id;
     } else CORRADE_ASSERT_UNREACHABLE();
 
+    if(contextState.statisticsEnabled) ++contextState.statistics.framebufferBinds;
+
     /* Binding the framebuffer finally creates it */
     _created = true;
     glBindFramebuffer(GLenum(target), _id);
 }
 
 FramebufferTarget AbstractFramebuffer::bindInternal() {
-    Implementation::FramebufferState& state = *Context::current()->state().framebuffer;
+    Implementation::State& contextState = Context::current()->state();
+    Implementation::FramebufferState& state = *contextState.framebuffer;
 
     /* Return target to which the framebuffer is already bound */
     if(state.readBinding == _id && state.drawBinding == _id)
@@ -135,6 +151,8 @@ FramebufferTarget AbstractFramebuffer::bindInternal() {
     /* Or bind it, if not already */
     state.readBinding = _id;
 
+    if(contextState.statisticsEnabled) ++contextState.statistics.framebufferBinds;
+
     /* Binding the framebuffer finally creates it */
     _created = true;
     #ifndef MAGNUM_TARGET_GLES2
@@ -210,14 +228,17 @@ AbstractFramebuffer& AbstractFramebuffer::setViewport(const Range2Di& rectangle)
 }
 
 void AbstractFramebuffer::setViewportInternal() {
-    Implementation::FramebufferState& state = *Context::current()->state().framebuffer;
+    Implementation::State& contextState = Context::current()->state();
+    Implementation::FramebufferState& state = *contextState.framebuffer;
 
     CORRADE_INTERNAL_ASSERT(_viewport != Implementation::FramebufferState::DisengagedViewport);
     CORRADE_INTERNAL_ASSERT(state.drawBinding == _id);
 
     /* Already up-to-date, nothing to do */
-    if(state.viewport == _viewport)
+    if(state.viewport == _viewport) {
+        ++contextState.elidedStateChangeCount;
         return;
+    }
 
     /* Update the state and viewport */
     state.viewport = _viewport;
@@ -235,6 +256,26 @@ AbstractFramebuffer& AbstractFramebuffer::clear(const FramebufferClearMask mask)
     return *this;
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+AbstractFramebuffer& AbstractFramebuffer::clearColor(const Int drawBuffer, const Color4& color) {
+    bindInternal(FramebufferTarget::Draw);
+    glClearBufferfv(GL_COLOR, drawBuffer, color.data());
+    return *this;
+}
+
+AbstractFramebuffer& AbstractFramebuffer::clearColor(const Int drawBuffer, const Vector4ui& color) {
+    bindInternal(FramebufferTarget::Draw);
+    glClearBufferuiv(GL_COLOR, drawBuffer, color.data());
+    return *this;
+}
+
+AbstractFramebuffer& AbstractFramebuffer::clearColor(const Int drawBuffer, const Vector4i& color) {
+    bindInternal(FramebufferTarget::Draw);
+    glClearBufferiv(GL_COLOR, drawBuffer, color.data());
+    return *this;
+}
+#endif
+
 void AbstractFramebuffer::read(const Range2Di& rectangle, Image2D& image) {
     #ifndef MAGNUM_TARGET_GLES2
     bindInternal(FramebufferTarget::Read);
@@ -243,6 +284,10 @@ void AbstractFramebuffer::read(const Range2Di& rectangle, Image2D& image) {
     #endif
     const std::size_t dataSize = image.dataSize(rectangle.size());
     char* const data = new char[dataSize];
+    #ifndef MAGNUM_TARGET_GLES2
+    Buffer::unbindInternal(Buffer::TargetHint::PixelPack);
+    #endif
+    image.storage().applyPack();
     (Context::current()->state().framebuffer->readImplementation)(rectangle, image.format(), image.type(), dataSize, data);
     image.setData(image.format(), image.type(), rectangle.size(), data);
 }
@@ -258,9 +303,10 @@ void AbstractFramebuffer::read(const Range2Di& rectangle, BufferImage2D& image,
     /* If the buffer doesn't have sufficient size, resize it */
     /** @todo Explicitly reset also when buffer usage changes */
     if(image.size() != rectangle.size())
-        image.setData(image.format(), image.type(), rectangle.size(), nullptr, usage);
+        image.setData(image.storage(), image.format(), image.type(), rectangle.size(), nullptr, usage);
 
     image.buffer().bindInternal(Buffer::TargetHint::PixelPack);
+    image.storage().applyPack();
     (Context::current()->state().framebuffer->readImplementation)(rectangle, image.format(), image.type(), image.dataSize(rectangle.size()), nullptr);
 }
 
@@ -298,6 +298,45 @@ class MAGNUM_EXPORT AbstractFramebuffer {
          */
         AbstractFramebuffer& clear(FramebufferClearMask mask);
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Clear floating-point color buffer
+         * @param drawBuffer        Draw buffer index
+         * @param color             Clear value
+         * @return Reference to self (for method chaining)
+         *
+         * Unlike @ref clear() clears only given buffer and doesn't depend on
+         * the global clear color set by @ref Renderer::setClearColor(), so
+         * it's possible to clear each attachment to different value. The
+         * @p drawBuffer is an index into draw buffer list set via
+         * @ref Framebuffer::mapForDraw(), not an attachment index.
+         * @see @fn_gl{BindFramebuffer}, @fn_gl{ClearBuffer}
+         * @requires_gl30 Extension @extension{ARB,framebuffer_object}
+         * @requires_gles30 Not available in OpenGL ES 2.0.
+         */
+        AbstractFramebuffer& clearColor(Int drawBuffer, const Color4& color);
+
+        /**
+         * @brief Clear integer color buffer
+         * @param drawBuffer        Draw buffer index
+         * @param color             Clear value
+         * @return Reference to self (for method chaining)
+         *
+         * Result of @ref clear() is undefined for buffers with integral
+         * format, use this function for them instead. The @p drawBuffer is
+         * an index into draw buffer list set via
+         * @ref Framebuffer::mapForDraw(), not an attachment index.
+         * @see @fn_gl{BindFramebuffer}, @fn_gl{ClearBuffer}
+         * @requires_gl30 Extension @extension{EXT,texture_integer}
+         * @requires_gles30 Integer color buffers are not available in OpenGL
+         *      ES 2.0.
+         */
+        AbstractFramebuffer& clearColor(Int drawBuffer, const Vector4ui& color);
+
+        /** @overload */
+        AbstractFramebuffer& clearColor(Int drawBuffer, const Vector4i& color);
+        #endif
+
         /**
          * @brief Read block of pixels from framebuffer to image
          * @param rectangle         Framebuffer rectangle to read
@@ -138,13 +138,7 @@ std::size_t AbstractImage::pixelSize(ColorFormat format, ColorType type) {
 }
 
 template<UnsignedInt dimensions> std::size_t AbstractImage::dataSize(Math::Vector<dimensions, Int> size) const {
-    /** @todo Code this properly when all @fn_gl{PixelStore} parameters are implemented */
-    /* Row size, rounded to multiple of 4 bytes */
-    const std::size_t rowSize = ((size[0]*pixelSize() + 3)/4)*4;
-
-    /** @todo Can't this be done somewhat nicer? */
-    size[0] = 1;
-    return rowSize*size.product();
+    return _storage.dataSize(pixelSize(), Vector3i::pad(size, 1));
 }
 
 template MAGNUM_EXPORT std::size_t AbstractImage::dataSize<1>(Math::Vector<1, Int>) const;
@@ -32,19 +32,36 @@
 #include <cstddef>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/PixelStorage.h"
 #include "Magnum/visibility.h"
 
 namespace Magnum {
 
+/**
+@brief Image data deleter
+
+Function used to free image data owned by @ref Image or
+@ref Trade::ImageData. Receives pointer to the data and their size as
+returned by @ref Image::dataSize() for the image size. Allows the data to come
+from custom allocators such as memory pools, arenas or memory-mapped files.
+If `nullptr`, the data are deleted using `delete[]`. Example returning the
+data to a pool:
+@code
+void recycle(char* data, std::size_t size) {
+    pool.release(data, size);
+}
+
+Image2D image{ColorFormat::RGBA, ColorType::UnsignedByte, size, pool.allocate(size.product()*4), recycle};
+@endcode
+*/
+typedef void(*ImageDeleter)(char*, std::size_t);
+
 /**
 @brief Non-templated base for one-, two- or three-dimensional images
 
 See @ref Image, @ref ImageReference, @ref BufferImage, @ref Trade::ImageData
 documentation for more information.
-@todo Where to put glClampColor() and glPixelStore() encapsulation? It is
-    needed in AbstractFramebuffer::read(), Texture::setImage() etc (i.e. all
-    functions operating with images). It also possibly needs to be "stackable"
-    to easily revert the state back.
+@todo Where to put glClampColor() encapsulation?
 */
 class MAGNUM_EXPORT AbstractImage {
     public:
@@ -57,6 +74,14 @@ class MAGNUM_EXPORT AbstractImage {
          */
         static std::size_t pixelSize(ColorFormat format, ColorType type);
 
+        /**
+         * @brief Pixel storage parameters
+         *
+         * Images are by default tightly packed with rows aligned to four
+         * bytes, see @ref PixelStorage for more information.
+         */
+        constexpr PixelStorage storage() const { return _storage; }
+
         /** @brief Format of pixel data */
         constexpr ColorFormat format() const { return _format; }
 
@@ -79,6 +104,14 @@ class MAGNUM_EXPORT AbstractImage {
          */
         constexpr explicit AbstractImage(ColorFormat format, ColorType type): _format(format), _type(type) {}
 
+        /**
+         * @brief Constructor
+         * @param storage           Pixel storage parameters
+         * @param format            Format of pixel data
+         * @param type              Data type of pixel data
+         */
+        constexpr explicit AbstractImage(const PixelStorage& storage, ColorFormat format, ColorType type): _storage(storage), _format(format), _type(type) {}
+
         ~AbstractImage() = default;
 
         template<UnsignedInt dimensions> std::size_t dataSize(Math::Vector<dimensions, Int> size) const;
@@ -88,6 +121,7 @@ class MAGNUM_EXPORT AbstractImage {
     #else
     protected:
     #endif
+        PixelStorage _storage;
         ColorFormat _format;
         ColorType _type;
 };
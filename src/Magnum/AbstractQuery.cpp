@@ -29,6 +29,7 @@
 
 #include "Magnum/Context.h"
 #include "Magnum/Implementation/DebugState.h"
+#include "Magnum/Implementation/NamePoolState.h"
 #include "Magnum/Implementation/QueryState.h"
 #include "Magnum/Implementation/State.h"
 
@@ -58,10 +59,8 @@ AbstractQuery::~AbstractQuery() {
 }
 
 void AbstractQuery::createImplementationDefault() {
-    #ifndef MAGNUM_TARGET_GLES2
-    glGenQueries(1, &_id);
-    #elif !defined(CORRADE_TARGET_EMSCRIPTEN)
-    glGenQueriesEXT(1, &_id);
+    #if !defined(MAGNUM_TARGET_GLES2) || !defined(CORRADE_TARGET_EMSCRIPTEN)
+    _id = Context::current()->state().namePool->queries.take();
     #else
     CORRADE_ASSERT_UNREACHABLE();
     #endif
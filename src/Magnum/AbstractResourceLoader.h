@@ -169,6 +169,20 @@ template<class T> class AbstractResourceLoader {
             set(key, new typename std::decay<U>::type(std::forward<U>(data)), state, policy);
         }
 
+        /**
+         * @brief Set loaded resource with size and priority to resource manager
+         *
+         * Same as above, but additionally reports memory occupied by the
+         * resource and its eviction priority. See
+         * @ref ResourceManager::setMemoryBudget() for more information.
+         */
+        void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size, Int priority = 0);
+
+        /** @overload */
+        template<class U> void set(ResourceKey key, U&& data, ResourceDataState state, ResourcePolicy policy, std::size_t size, Int priority = 0) {
+            set(key, new typename std::decay<U>::type(std::forward<U>(data)), state, policy, size, priority);
+        }
+
         /**
          * @brief Set loaded resource to resource manager
          *
@@ -234,10 +248,14 @@ template<class T> void AbstractResourceLoader<T>::load(ResourceKey key) {
 }
 
 template<class T> void AbstractResourceLoader<T>::set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy) {
+    set(key, data, state, policy, 0);
+}
+
+template<class T> void AbstractResourceLoader<T>::set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size, Int priority) {
     CORRADE_ASSERT(state == ResourceDataState::Mutable || state == ResourceDataState::Final,
         "AbstractResourceLoader::set(): state must be either Mutable or Final", );
     ++_loadedCount;
-    manager->set(key, data, state, policy);
+    manager->set(key, data, state, policy, size, priority);
 }
 
 template<class T> inline void AbstractResourceLoader<T>::setNotFound(ResourceKey key) {
@@ -25,10 +25,18 @@
 
 #include "AbstractShaderProgram.h"
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/MurmurHash2.h>
+
+#include "Magnum/Buffer.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Shader.h"
 #include "Magnum/Math/RectangularMatrix.h"
+#include "Magnum/Math/Vector3.h"
 
 #include "Implementation/DebugState.h"
 #include "Implementation/ShaderProgramState.h"
@@ -38,8 +46,29 @@
 #include <sstream>
 #endif
 
+/* Not in the OpenGL headers yet */
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
 namespace Magnum {
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace {
+
+void appendKey(std::string& key, const char type, const UnsignedInt value) {
+    key += type;
+    key.append(reinterpret_cast<const char*>(&value), sizeof(UnsignedInt));
+}
+
+void appendKey(std::string& key, const Containers::ArrayReference<const char> value) {
+    key.append(value, value.size());
+    key += '\0';
+}
+
+}
+#endif
+
 Int AbstractShaderProgram::maxVertexAttributes() {
     GLint& value = Context::current()->state().shaderProgram->maxVertexAttributes;
 
@@ -99,6 +128,40 @@ Int AbstractShaderProgram::maxComputeWorkGroupInvocations() {
     return value;
 }
 
+Vector3i AbstractShaderProgram::maxComputeWorkGroupCount() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::compute_shader>())
+    #else
+    if(!Context::current()->isVersionSupported(Version::GLES310))
+    #endif
+        return {};
+
+    Vector3i& value = Context::current()->state().shaderProgram->maxComputeWorkGroupCount;
+
+    if(value.isZero())
+        for(UnsignedInt i = 0; i != 3; ++i)
+            glGetIntegeri_v(GL_MAX_COMPUTE_WORK_GROUP_COUNT, i, &value[i]);
+
+    return value;
+}
+
+Vector3i AbstractShaderProgram::maxComputeWorkGroupSize() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::compute_shader>())
+    #else
+    if(!Context::current()->isVersionSupported(Version::GLES310))
+    #endif
+        return {};
+
+    Vector3i& value = Context::current()->state().shaderProgram->maxComputeWorkGroupSize;
+
+    if(value.isZero())
+        for(UnsignedInt i = 0; i != 3; ++i)
+            glGetIntegeri_v(GL_MAX_COMPUTE_WORK_GROUP_SIZE, i, &value[i]);
+
+    return value;
+}
+
 Int AbstractShaderProgram::maxImageUnits() {
     #ifndef MAGNUM_TARGET_GLES
     if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::shader_image_load_store>())
@@ -228,11 +291,53 @@ Int AbstractShaderProgram::maxTexelOffset() {
 }
 #endif
 
-AbstractShaderProgram::AbstractShaderProgram(): _id(glCreateProgram()) {
+#ifndef MAGNUM_TARGET_GLES2
+std::string AbstractShaderProgram::binaryCacheDirectory() {
+    return Context::current()->state().shaderProgram->binaryCacheDirectory;
+}
+
+bool AbstractShaderProgram::setBinaryCacheDirectory(const std::string& directory) {
+    std::string& binaryCacheDirectory = Context::current()->state().shaderProgram->binaryCacheDirectory;
+    binaryCacheDirectory.clear();
+    if(directory.empty()) return true;
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::get_program_binary>())
+        return false;
+    #endif
+
+    GLint formatCount;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    if(!formatCount || !Utility::Directory::mkpath(directory))
+        return false;
+
+    binaryCacheDirectory = directory;
+    return true;
+    #else
+    return false;
+    #endif
+}
+#endif
+
+struct AbstractShaderProgram::UniformCache {
+    /* Indexed by uniform location, empty if the value is not known */
+    std::vector<std::vector<char>> values;
+};
+
+AbstractShaderProgram::AbstractShaderProgram(): _id(glCreateProgram())
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    , _binaryLoadedFromCache(false)
+    #endif
+{
     CORRADE_INTERNAL_ASSERT(_id != Implementation::State::DisengagedBinding);
 }
 
-AbstractShaderProgram::AbstractShaderProgram(AbstractShaderProgram&& other) noexcept: _id(other._id) {
+AbstractShaderProgram::AbstractShaderProgram(AbstractShaderProgram&& other) noexcept: _id(other._id), _uniformCache(std::move(other._uniformCache))
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    , _binaryCacheKey(std::move(other._binaryCacheKey)), _binaryLoadedFromCache(other._binaryLoadedFromCache)
+    #endif
+{
     other._id = 0;
 }
 
@@ -247,6 +352,11 @@ AbstractShaderProgram::~AbstractShaderProgram() {
 AbstractShaderProgram& AbstractShaderProgram::operator=(AbstractShaderProgram&& other) noexcept {
     using std::swap;
     swap(_id, other._id);
+    swap(_uniformCache, other._uniformCache);
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    swap(_binaryCacheKey, other._binaryCacheKey);
+    swap(_binaryLoadedFromCache, other._binaryLoadedFromCache);
+    #endif
     return *this;
 }
 
@@ -285,14 +395,72 @@ std::pair<bool, std::string> AbstractShaderProgram::validate() {
     return {success, std::move(message)};
 }
 
+AbstractShaderProgram& AbstractShaderProgram::setUniformCacheEnabled(const bool enabled) {
+    if(!enabled) _uniformCache = nullptr;
+    else if(!_uniformCache) _uniformCache.reset(new UniformCache);
+    return *this;
+}
+
+bool AbstractShaderProgram::updateUniformCache(const GLint location, const GLsizei count, const void* const data, const std::size_t size) {
+    /* Setting a value to location -1 is a no-op in GL, skip it early */
+    if(location < 0) return false;
+
+    std::vector<std::vector<char>>& values = _uniformCache->values;
+
+    /* Arrays are not cached, only forget values of all affected locations */
+    if(count != 1) {
+        for(std::size_t i = location, end = std::min(values.size(), std::size_t(location + count)); i < end; ++i)
+            values[i].clear();
+        return true;
+    }
+
+    if(std::size_t(location) >= values.size()) values.resize(location + 1);
+    std::vector<char>& cached = values[location];
+    if(cached.size() == size && std::memcmp(cached.data(), data, size) == 0) {
+        ++Context::current()->state().elidedStateChangeCount;
+        return false;
+    }
+
+    cached.assign(static_cast<const char*>(data), static_cast<const char*>(data) + size);
+    return true;
+}
+
 void AbstractShaderProgram::use() {
     /* Use only if the program isn't already in use */
-    GLuint& current = Context::current()->state().shaderProgram->current;
-    if(current != _id) glUseProgram(current = _id);
+    Implementation::State& state = Context::current()->state();
+    GLuint& current = state.shaderProgram->current;
+    if(current != _id) {
+        if(state.statisticsEnabled) ++state.statistics.programSwitches;
+        glUseProgram(current = _id);
+    } else ++state.elidedStateChangeCount;
+}
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+AbstractShaderProgram& AbstractShaderProgram::dispatchCompute(const Vector3ui& workgroupCount) {
+    use();
+    glDispatchCompute(workgroupCount.x(), workgroupCount.y(), workgroupCount.z());
+    return *this;
 }
 
+AbstractShaderProgram& AbstractShaderProgram::dispatchComputeIndirect(Buffer& buffer, const GLintptr offset) {
+    CORRADE_ASSERT(offset % 4 == 0,
+        "AbstractShaderProgram::dispatchComputeIndirect(): offset" << offset << "is not a multiple of four", *this);
+
+    use();
+    buffer.bindInternal(Buffer::TargetHint::DispatchIndirect);
+    glDispatchComputeIndirect(offset);
+    return *this;
+}
+#endif
+
 void AbstractShaderProgram::attachShader(Shader& shader) {
     glAttachShader(_id, shader.id());
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    appendKey(_binaryCacheKey, 'S', UnsignedInt(shader.type()));
+    for(const std::string& source: shader.sources())
+        appendKey(_binaryCacheKey, {source.data(), source.size()});
+    #endif
 }
 
 void AbstractShaderProgram::attachShaders(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
@@ -301,14 +469,26 @@ void AbstractShaderProgram::attachShaders(std::initializer_list<std::reference_w
 
 void AbstractShaderProgram::bindAttributeLocationInternal(const UnsignedInt location, const Containers::ArrayReference<const char> name) {
     glBindAttribLocation(_id, location, name);
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    appendKey(_binaryCacheKey, 'A', location);
+    appendKey(_binaryCacheKey, name);
+    #endif
 }
 
 #ifndef MAGNUM_TARGET_GLES
 void AbstractShaderProgram::bindFragmentDataLocationInternal(const UnsignedInt location, const Containers::ArrayReference<const char> name) {
     glBindFragDataLocation(_id, location, name);
+
+    appendKey(_binaryCacheKey, 'F', location);
+    appendKey(_binaryCacheKey, name);
 }
 void AbstractShaderProgram::bindFragmentDataLocationIndexedInternal(const UnsignedInt location, UnsignedInt index, const Containers::ArrayReference<const char> name) {
     glBindFragDataLocationIndexed(_id, location, index, name);
+
+    appendKey(_binaryCacheKey, 'F', location);
+    appendKey(_binaryCacheKey, 'I', index);
+    appendKey(_binaryCacheKey, name);
 }
 #endif
 
@@ -320,14 +500,52 @@ void AbstractShaderProgram::setTransformFeedbackOutputs(const std::initializer_l
     for(const std::string& output: outputs) names[i++] = output.data();
 
     glTransformFeedbackVaryings(_id, outputs.size(), names, GLenum(bufferMode));
+
+    #ifndef MAGNUM_TARGET_WEBGL
+    appendKey(_binaryCacheKey, 'T', UnsignedInt(bufferMode));
+    for(const std::string& output: outputs)
+        appendKey(_binaryCacheKey, {output.data(), output.size()});
+    #endif
 }
 #endif
 
 bool AbstractShaderProgram::link(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders) {
+    submitLink(shaders);
+    return checkLink(shaders);
+}
+
+void AbstractShaderProgram::submitLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders) {
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    const std::string& binaryCacheDirectory = Context::current()->state().shaderProgram->binaryCacheDirectory;
+    #endif
+
+    /* Invoke (possibly parallel) linking on all shaders, unless their binary
+       is already in the cache */
+    for(AbstractShaderProgram& shader: shaders) {
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        if(!binaryCacheDirectory.empty() && (shader._binaryLoadedFromCache = shader.loadBinaryFromCache(binaryCacheDirectory)))
+            continue;
+        #endif
+
+        glLinkProgram(shader._id);
+    }
+}
+
+bool AbstractShaderProgram::isLinkFinished() const {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::KHR::parallel_shader_compile>())
+        return true;
+
+    GLint finished;
+    glGetProgramiv(_id, GL_COMPLETION_STATUS_KHR, &finished);
+    return finished == GL_TRUE;
+}
+
+bool AbstractShaderProgram::checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders) {
     bool allSuccess = true;
 
-    /* Invoke (possibly parallel) linking on all shaders */
-    for(AbstractShaderProgram& shader: shaders) glLinkProgram(shader._id);
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    const std::string& binaryCacheDirectory = Context::current()->state().shaderProgram->binaryCacheDirectory;
+    #endif
 
     /* After linking phase, check status of all shaders */
     Int i = 1;
@@ -343,6 +561,9 @@ bool AbstractShaderProgram::link(std::initializer_list<std::reference_wrapper<Ab
             glGetProgramInfoLog(shader._id, message.size(), nullptr, &message[0]);
         message.resize(std::max(logLength, 1)-1);
 
+        /* Relinking resets all uniforms to their defaults */
+        if(shader._uniformCache) shader._uniformCache->values.clear();
+
         /** @todo Remove when this is fixed everywhere (also the include above) */
         #if defined(CORRADE_TARGET_NACL_NEWLIB) || defined(CORRADE_TARGET_ANDROID) || defined(__MINGW32__)
         std::ostringstream converter;
@@ -382,6 +603,12 @@ bool AbstractShaderProgram::link(std::initializer_list<std::reference_wrapper<Ab
                 << message;
         }
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /* Save freshly linked binary to the cache */
+        if(success && !binaryCacheDirectory.empty() && !shader._binaryLoadedFromCache)
+            shader.saveBinaryToCache(binaryCacheDirectory);
+        #endif
+
         /* Success of all depends on each of them */
         allSuccess = allSuccess && success;
         ++i;
@@ -390,6 +617,70 @@ bool AbstractShaderProgram::link(std::initializer_list<std::reference_wrapper<Ab
     return allSuccess;
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/* The cache file contains size of the key, the key itself (to avoid issues
+   with hash collisions), binary format and the binary */
+std::string AbstractShaderProgram::binaryCacheKey() const {
+    Context& context = *Context::current();
+    return context.vendorString() + '\0' + context.rendererString() + '\0' + context.versionString() + '\0' + _binaryCacheKey;
+}
+
+bool AbstractShaderProgram::loadBinaryFromCache(const std::string& directory) {
+    const std::string key = binaryCacheKey();
+    const std::string filename = Utility::Directory::join(directory, Utility::MurmurHash2()(key).hexString() + ".bin");
+    const std::size_t headerSize = sizeof(UnsignedInt) + key.size() + sizeof(GLenum);
+
+    if(Utility::Directory::fileExists(filename)) {
+        const Containers::Array<char> data = Utility::Directory::read(filename);
+        const char* const bytes = data;
+
+        UnsignedInt keySize = 0;
+        if(data.size() > headerSize)
+            std::memcpy(&keySize, bytes, sizeof(UnsignedInt));
+
+        if(keySize == key.size() && std::memcmp(bytes + sizeof(UnsignedInt), key.data(), key.size()) == 0) {
+            GLenum format;
+            std::memcpy(&format, bytes + sizeof(UnsignedInt) + key.size(), sizeof(GLenum));
+            glProgramBinary(_id, format, bytes + headerSize, data.size() - headerSize);
+
+            /* The driver may reject the binary, e.g. after an update */
+            GLint success;
+            glGetProgramiv(_id, GL_LINK_STATUS, &success);
+            if(success) return true;
+        }
+    }
+
+    /* Not in the cache or rejected, the program will be linked from scratch,
+       allow retrieving the binary afterwards */
+    setRetrievableBinary(true);
+    return false;
+}
+
+void AbstractShaderProgram::saveBinaryToCache(const std::string& directory) {
+    GLint size;
+    glGetProgramiv(_id, GL_PROGRAM_BINARY_LENGTH, &size);
+    if(!size) return;
+
+    const std::string key = binaryCacheKey();
+    const std::string filename = Utility::Directory::join(directory, Utility::MurmurHash2()(key).hexString() + ".bin");
+    const std::size_t headerSize = sizeof(UnsignedInt) + key.size() + sizeof(GLenum);
+
+    Containers::Array<char> data{headerSize + size};
+    char* const bytes = data;
+    const UnsignedInt keySize = UnsignedInt(key.size());
+    std::memcpy(bytes, &keySize, sizeof(UnsignedInt));
+    std::memcpy(bytes + sizeof(UnsignedInt), key.data(), key.size());
+
+    GLenum format;
+    GLsizei length = 0;
+    glGetProgramBinary(_id, size, &length, &format, bytes + headerSize);
+    std::memcpy(bytes + sizeof(UnsignedInt) + key.size(), &format, sizeof(GLenum));
+
+    if(!Utility::Directory::write(filename, Containers::ArrayReference<const char>{bytes, headerSize + length}))
+        Warning() << "AbstractShaderProgram::link(): cannot save program binary to" << filename;
+}
+#endif
+
 Int AbstractShaderProgram::uniformLocationInternal(const Containers::ArrayReference<const char> name) {
     GLint location = glGetUniformLocation(_id, name);
     if(location == -1)
@@ -397,7 +688,36 @@ Int AbstractShaderProgram::uniformLocationInternal(const Containers::ArrayRefere
     return location;
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+UnsignedInt AbstractShaderProgram::uniformBlockIndexInternal(const Containers::ArrayReference<const char> name) {
+    const GLuint index = glGetUniformBlockIndex(_id, name);
+    if(index == GL_INVALID_INDEX)
+        Warning() << "AbstractShaderProgram: index of uniform block \'" + std::string{name, name.size()} + "\' cannot be retrieved!";
+    return index;
+}
+
+void AbstractShaderProgram::setUniformBlockBinding(const UnsignedInt index, const UnsignedInt binding) {
+    glUniformBlockBinding(_id, index, binding);
+}
+#endif
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+UnsignedInt AbstractShaderProgram::shaderStorageBlockIndexInternal(const Containers::ArrayReference<const char> name) {
+    const GLuint index = glGetProgramResourceIndex(_id, GL_SHADER_STORAGE_BLOCK, name);
+    if(index == GL_INVALID_INDEX)
+        Warning() << "AbstractShaderProgram: index of shader storage block \'" + std::string{name, name.size()} + "\' cannot be retrieved!";
+    return index;
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES
+void AbstractShaderProgram::setShaderStorageBlockBinding(const UnsignedInt index, const UnsignedInt binding) {
+    glShaderStorageBlockBinding(_id, index, binding);
+}
+#endif
+
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Float* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Float))) return;
     (this->*Context::current()->state().shaderProgram->uniform1fvImplementation)(location, count, values);
 }
 
@@ -424,6 +744,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::Vector<2, Float>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::Vector<2, Float>))) return;
     (this->*Context::current()->state().shaderProgram->uniform2fvImplementation)(location, count, values);
 }
 
@@ -450,6 +771,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::Vector<3, Float>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::Vector<3, Float>))) return;
     (this->*Context::current()->state().shaderProgram->uniform3fvImplementation)(location, count, values);
 }
 
@@ -476,6 +798,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::Vector<4, Float>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::Vector<4, Float>))) return;
     (this->*Context::current()->state().shaderProgram->uniform4fvImplementation)(location, count, values);
 }
 
@@ -502,6 +825,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Int* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Int))) return;
     (this->*Context::current()->state().shaderProgram->uniform1ivImplementation)(location, count, values);
 }
 
@@ -528,6 +852,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::Vector<2, Int>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::Vector<2, Int>))) return;
     (this->*Context::current()->state().shaderProgram->uniform2ivImplementation)(location, count, values);
 }
 
@@ -554,6 +879,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::Vector<3, Int>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::Vector<3, Int>))) return;
     (this->*Context::current()->state().shaderProgram->uniform3ivImplementation)(location, count, values);
 }
 
@@ -580,6 +906,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::Vector<4, Int>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::Vector<4, Int>))) return;
     (this->*Context::current()->state().shaderProgram->uniform4ivImplementation)(location, count, values);
 }
 
@@ -607,6 +934,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const UnsignedInt* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(UnsignedInt))) return;
     (this->*Context::current()->state().shaderProgram->uniform1uivImplementation)(location, count, values);
 }
 
@@ -624,6 +952,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::Vector<2, UnsignedInt>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::Vector<2, UnsignedInt>))) return;
     (this->*Context::current()->state().shaderProgram->uniform2uivImplementation)(location, count, values);
 }
 
@@ -641,6 +970,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::Vector<3, UnsignedInt>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::Vector<3, UnsignedInt>))) return;
     (this->*Context::current()->state().shaderProgram->uniform3uivImplementation)(location, count, values);
 }
 
@@ -658,6 +988,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::Vector<4, UnsignedInt>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::Vector<4, UnsignedInt>))) return;
     (this->*Context::current()->state().shaderProgram->uniform4uivImplementation)(location, count, values);
 }
 
@@ -677,6 +1008,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 
 #ifndef MAGNUM_TARGET_GLES
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Double* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Double))) return;
     (this->*Context::current()->state().shaderProgram->uniform1dvImplementation)(location, count, values);
 }
 
@@ -694,6 +1026,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::Vector<2, Double>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::Vector<2, Double>))) return;
     (this->*Context::current()->state().shaderProgram->uniform2dvImplementation)(location, count, values);
 }
 
@@ -711,6 +1044,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::Vector<3, Double>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::Vector<3, Double>))) return;
     (this->*Context::current()->state().shaderProgram->uniform3dvImplementation)(location, count, values);
 }
 
@@ -728,6 +1062,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::Vector<4, Double>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::Vector<4, Double>))) return;
     (this->*Context::current()->state().shaderProgram->uniform4dvImplementation)(location, count, values);
 }
 
@@ -746,6 +1081,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 #endif
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<2, 2, Float>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<2, 2, Float>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix2fvImplementation)(location, count, values);
 }
 
@@ -772,6 +1108,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<3, 3, Float>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<3, 3, Float>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix3fvImplementation)(location, count, values);
 }
 
@@ -798,6 +1135,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<4, 4, Float>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<4, 4, Float>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix4fvImplementation)(location, count, values);
 }
 
@@ -825,6 +1163,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<2, 3, Float>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<2, 3, Float>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix2x3fvImplementation)(location, count, values);
 }
 
@@ -842,6 +1181,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<3, 2, Float>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<3, 2, Float>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix3x2fvImplementation)(location, count, values);
 }
 
@@ -859,6 +1199,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<2, 4, Float>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<2, 4, Float>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix2x4fvImplementation)(location, count, values);
 }
 
@@ -876,6 +1217,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<4, 2, Float>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<4, 2, Float>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix4x2fvImplementation)(location, count, values);
 }
 
@@ -893,6 +1235,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<3, 4, Float>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<3, 4, Float>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix3x4fvImplementation)(location, count, values);
 }
 
@@ -910,6 +1253,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<4, 3, Float>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<4, 3, Float>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix4x3fvImplementation)(location, count, values);
 }
 
@@ -929,6 +1273,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT_SSOEXT(const GLint locat
 
 #ifndef MAGNUM_TARGET_GLES
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<2, 2, Double>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<2, 2, Double>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix2dvImplementation)(location, count, values);
 }
 
@@ -946,6 +1291,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<3, 3, Double>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<3, 3, Double>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix3dvImplementation)(location, count, values);
 }
 
@@ -963,6 +1309,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<4, 4, Double>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<4, 4, Double>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix4dvImplementation)(location, count, values);
 }
 
@@ -980,6 +1327,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<2, 3, Double>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<2, 3, Double>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix2x3dvImplementation)(location, count, values);
 }
 
@@ -997,6 +1345,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<3, 2, Double>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<3, 2, Double>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix3x2dvImplementation)(location, count, values);
 }
 
@@ -1014,6 +1363,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<2, 4, Double>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<2, 4, Double>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix2x4dvImplementation)(location, count, values);
 }
 
@@ -1031,6 +1381,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<4, 2, Double>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<4, 2, Double>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix4x2dvImplementation)(location, count, values);
 }
 
@@ -1048,6 +1399,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<3, 4, Double>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<3, 4, Double>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix3x4dvImplementation)(location, count, values);
 }
 
@@ -1065,6 +1417,7 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 
 void AbstractShaderProgram::setUniform(const Int location, const UnsignedInt count, const Math::RectangularMatrix<4, 3, Double>* const values) {
+    if(_uniformCache && !updateUniformCache(location, count, values, count*sizeof(Math::RectangularMatrix<4, 3, Double>))) return;
     (this->*Context::current()->state().shaderProgram->uniformMatrix4x3dvImplementation)(location, count, values);
 }
 
@@ -1082,4 +1435,20 @@ void AbstractShaderProgram::uniformImplementationDSAEXT(const GLint location, co
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void AbstractShaderProgram::setUniformHandle(const Int location, const UnsignedInt count, const GLuint64* const handles) {
+    if(_uniformCache && !updateUniformCache(location, count, handles, count*sizeof(GLuint64))) return;
+    (this->*Context::current()->state().shaderProgram->uniformHandleui64vImplementation)(location, count, handles);
+}
+
+void AbstractShaderProgram::uniformHandleImplementationDefault(const GLint location, const GLsizei count, const GLuint64* const values) {
+    use();
+    glUniformHandleui64vARB(location, count, values);
+}
+
+void AbstractShaderProgram::uniformHandleImplementationSSO(const GLint location, const GLsizei count, const GLuint64* const values) {
+    glProgramUniformHandleui64vARB(_id, location, count, values);
+}
+#endif
+
 }
@@ -30,6 +30,7 @@
  */
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <Corrade/Containers/Array.h>
 
@@ -394,6 +395,9 @@ comes in handy.
 class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
     friend Mesh;
     friend MeshView;
+    #ifndef MAGNUM_TARGET_GLES
+    friend OcclusionCuller;
+    #endif
     friend TransformFeedback;
     friend Implementation::ShaderProgramState;
 
@@ -460,7 +464,30 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
          */
         static Int maxComputeWorkGroupInvocations();
 
-        /** @todo MAX_COMPUTE_WORK_GROUP_COUNT, MAX_COMPUTE_WORK_GROUP_SIZE */
+        /**
+         * @brief Max supported compute work group count
+         *
+         * The result is cached, repeated queries don't result in repeated
+         * OpenGL calls. If neither extension @extension{ARB,compute_shader}
+         * (part of OpenGL 4.3) nor OpenGL ES 3.1 is available, returns zero
+         * vector.
+         * @see @ref dispatchCompute(), @fn_gl{Get} with
+         *      @def_gl{MAX_COMPUTE_WORK_GROUP_COUNT}
+         * @requires_gles30 Not defined in OpenGL ES 2.0
+         */
+        static Vector3i maxComputeWorkGroupCount();
+
+        /**
+         * @brief Max supported compute work group size
+         *
+         * The result is cached, repeated queries don't result in repeated
+         * OpenGL calls. If neither extension @extension{ARB,compute_shader}
+         * (part of OpenGL 4.3) nor OpenGL ES 3.1 is available, returns zero
+         * vector.
+         * @see @fn_gl{Get} with @def_gl{MAX_COMPUTE_WORK_GROUP_SIZE}
+         * @requires_gles30 Not defined in OpenGL ES 2.0
+         */
+        static Vector3i maxComputeWorkGroupSize();
 
         /**
          * @brief Max supported image unit count
@@ -559,6 +586,46 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
         static Int maxTexelOffset();
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Program binary cache directory
+         *
+         * Empty if the program binary cache is disabled.
+         * @see @ref setBinaryCacheDirectory()
+         * @requires_gles30 Program binaries are not available in OpenGL ES
+         *      2.0.
+         */
+        static std::string binaryCacheDirectory();
+
+        /**
+         * @brief Set program binary cache directory
+         *
+         * If set to non-empty directory, @ref link() first tries to load the
+         * program binary from the cache instead of linking the shaders. The
+         * binary is identified by sources and types of all attached shaders,
+         * by bound attribute, fragment data and transform feedback output
+         * locations and by vendor, renderer and version string of the
+         * driver. If no binary is found or the driver rejects it, the program
+         * is linked as usual and the resulting binary is saved to the cache.
+         * The directory is created if it doesn't exist. Note that the shaders
+         * still need to be compiled before linking.
+         *
+         * Returns `false` and disables the cache if retrieving program
+         * binaries is not supported, if the driver doesn't support any binary
+         * format or if the directory cannot be created. Empty string disables
+         * the cache and returns `true`. Initially the cache is disabled.
+         * @see @ref setRetrievableBinary(), @fn_gl{Get} with
+         *      @def_gl{NUM_PROGRAM_BINARY_FORMATS}
+         * @requires_gl41 Extension @extension{ARB,get_program_binary},
+         *      otherwise the function returns `false`.
+         * @requires_gles30 Program binaries are not available in OpenGL ES
+         *      2.0.
+         * @requires_gles Program binaries are not available in WebGL, the
+         *      function always returns `false`.
+         */
+        static bool setBinaryCacheDirectory(const std::string& directory);
+        #endif
+
         /**
          * @brief Constructor
          *
@@ -633,6 +700,85 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
          */
         std::pair<bool, std::string> validate();
 
+        /**
+         * @brief Whether uniform caching is enabled
+         *
+         * @see @ref setUniformCacheEnabled()
+         */
+        bool isUniformCacheEnabled() const { return !!_uniformCache; }
+
+        /**
+         * @brief Enable or disable uniform caching
+         * @return Reference to self (for method chaining)
+         *
+         * When enabled, the program keeps a CPU-side copy of each uniform
+         * value set through @ref setUniform() and values equal to the
+         * previously set ones are not uploaded at all, saving the OpenGL call
+         * and possibly also @fn_gl{UseProgram}. Skipped uploads are counted
+         * in @ref Context::elidedStateChangeCount(). Useful for programs
+         * that are set up from scratch for each draw, but with many values
+         * not changing between draws. Arrays of more than one value are
+         * always uploaded. The cache is emptied on relink and when disabled.
+         * Initially disabled.
+         *
+         * @attention Uniform values set with raw OpenGL calls are not
+         *      tracked and thus may cause the cache to get out of sync.
+         */
+        AbstractShaderProgram& setUniformCacheEnabled(bool enabled);
+
+        /**
+         * @brief Whether the linking is finished
+         *
+         * If @extension{KHR,parallel_shader_compile} is available, returns
+         * `false` while the driver is still linking the program submitted
+         * with @ref submitLink() in the background, `true` otherwise. Unlike
+         * @ref checkLink(), this function never blocks, so it can be used for
+         * polling the status e.g. from a loading screen.
+         * @see @ref Shader::isCompileFinished(), @fn_gl{GetProgram} with
+         *      @def_gl{COMPLETION_STATUS_KHR}
+         */
+        bool isLinkFinished() const;
+
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Dispatch compute
+         * @param workgroupCount    Workgroup count in given dimension
+         * @return Reference to self (for method chaining)
+         *
+         * Valid only on programs with compute shader attached. Use
+         * @ref Renderer::setMemoryBarrier() to make the results visible to
+         * subsequent operations.
+         * @see @ref dispatchComputeIndirect(),
+         *      @ref maxComputeWorkGroupCount(), @fn_gl{UseProgram},
+         *      @fn_gl{DispatchCompute}
+         * @requires_gl43 Extension @extension{ARB,compute_shader}
+         * @requires_gles31 Compute shaders are not available in OpenGL ES
+         *      3.0 and older.
+         */
+        AbstractShaderProgram& dispatchCompute(const Vector3ui& workgroupCount);
+
+        /**
+         * @brief Dispatch compute with workgroup count sourced from a buffer
+         * @param buffer        Buffer containing three @ref UnsignedInt
+         *      values with workgroup count in each dimension
+         * @param offset        Offset of the values in the buffer, must be a
+         *      multiple of four
+         * @return Reference to self (for method chaining)
+         *
+         * Allows the workgroup count to be computed on the GPU, e.g. by a
+         * previous culling pass. If the buffer was written by a shader, use
+         * @ref Renderer::setMemoryBarrier() with
+         * @ref Renderer::MemoryBarrier::Command before calling this function.
+         * @see @ref dispatchCompute(), @fn_gl{UseProgram},
+         *      @fn_gl{BindBuffer} with @def_gl{DISPATCH_INDIRECT_BUFFER},
+         *      @fn_gl{DispatchComputeIndirect}
+         * @requires_gl43 Extension @extension{ARB,compute_shader}
+         * @requires_gles31 Compute shaders are not available in OpenGL ES
+         *      3.0 and older.
+         */
+        AbstractShaderProgram& dispatchComputeIndirect(Buffer& buffer, GLintptr offset = 0);
+        #endif
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         /**
          * @brief Use shader for rendering
@@ -650,13 +796,45 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
          * output. All attached shaders must be compiled with
          * @ref Shader::compile() before linking. The operation is batched in a
          * way that allows the driver to link multiple shaders simultaneously
-         * (i.e. in multiple threads).
+         * (i.e. in multiple threads). If @ref setBinaryCacheDirectory() "binary cache"
+         * is enabled, the program binary is loaded from the cache, if
+         * possible, and saved to it after successful linking otherwise.
          * @see @fn_gl{LinkProgram}, @fn_gl{GetProgram} with
          *      @def_gl{LINK_STATUS} and @def_gl{INFO_LOG_LENGTH},
-         *      @fn_gl{GetProgramInfoLog}
+         *      @fn_gl{GetProgramInfoLog}, @fn_gl{ProgramBinary},
+         *      @fn_gl{GetProgramBinary}
          */
         static bool link(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders);
 
+        /**
+         * @brief Submit multiple shaders for linking
+         *
+         * Starts linking of all shaders without waiting for the result,
+         * loading the binaries from @ref setBinaryCacheDirectory() "binary cache",
+         * if enabled. All attached shaders must be compiled, but only their
+         * compilation needs to be submitted with @ref Shader::submitCompile()
+         * and not necessarily finished. Poll @ref isLinkFinished() and then
+         * call @ref checkLink() to get the result. Calling this function
+         * followed by @ref checkLink() is equivalent to calling
+         * @ref link(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>).
+         * @see @fn_gl{LinkProgram}
+         */
+        static void submitLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders);
+
+        /**
+         * @brief Check link status of multiple shaders
+         *
+         * Returns `false` if linking of any shader failed, `true` if
+         * everything succeeded. Linker message (if any) is printed to error
+         * output. Blocks until the linking is finished, expects that
+         * @ref submitLink() was called on all shaders before. Compilation
+         * errors of attached shaders are not reported, check them using
+         * @ref Shader::checkCompile() first.
+         * @see @fn_gl{GetProgram} with @def_gl{LINK_STATUS} and
+         *      @def_gl{INFO_LOG_LENGTH}, @fn_gl{GetProgramInfoLog}
+         */
+        static bool checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>> shaders);
+
         #ifndef MAGNUM_TARGET_GLES2
         /**
          * @brief Allow retrieving program binary
@@ -825,6 +1003,22 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
          */
         bool link() { return link({*this}); }
 
+        /**
+         * @brief Submit the shader for linking
+         *
+         * See @ref submitLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>)
+         * for more information.
+         */
+        void submitLink() { submitLink({*this}); }
+
+        /**
+         * @brief Check link status of the shader
+         *
+         * See @ref checkLink(std::initializer_list<std::reference_wrapper<AbstractShaderProgram>>)
+         * for more information.
+         */
+        bool checkLink() { return checkLink({*this}); }
+
         /**
          * @brief Get uniform location
          * @param name          Uniform name
@@ -844,6 +1038,89 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
             return uniformLocationInternal({name, size - 1});
         }
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Get uniform block index
+         * @param name          Uniform block name
+         *
+         * If the block is not found, prints a warning and returns
+         * @def_gl{INVALID_INDEX}.
+         * @see @ref setUniformBlockBinding(), @fn_gl{GetUniformBlockIndex}
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform blocks are not available in OpenGL ES
+         *      2.0.
+         */
+        UnsignedInt uniformBlockIndex(const std::string& name) {
+            return uniformBlockIndexInternal({name.data(), name.size()});
+        }
+
+        /** @overload */
+        template<std::size_t size> UnsignedInt uniformBlockIndex(const char(&name)[size]) {
+            return uniformBlockIndexInternal({name, size - 1});
+        }
+
+        /**
+         * @brief Set uniform block binding
+         * @param index         Uniform block index
+         * @param binding       Uniform buffer binding point
+         *
+         * The buffer bound to given binding point with
+         * @ref Buffer::bind(Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr)
+         * will be used as the uniform block data source.
+         * @see @ref uniformBlockIndex(), @ref Buffer::maxUniformBindings(),
+         *      @fn_gl{UniformBlockBinding}
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform blocks are not available in OpenGL ES
+         *      2.0.
+         */
+        void setUniformBlockBinding(UnsignedInt index, UnsignedInt binding);
+        #endif
+
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Get shader storage block index
+         * @param name          Shader storage block name
+         *
+         * If the block is not found, prints a warning and returns
+         * @def_gl{INVALID_INDEX}.
+         * @see @ref setShaderStorageBlockBinding(),
+         *      @fn_gl{GetProgramResourceIndex} with
+         *      @def_gl{SHADER_STORAGE_BLOCK}
+         * @requires_gl43 Extension @extension{ARB,shader_storage_buffer_object}
+         *      and @extension{ARB,program_interface_query}
+         * @requires_gles31 Shader storage is not available in OpenGL ES 3.0
+         *      and older.
+         */
+        UnsignedInt shaderStorageBlockIndex(const std::string& name) {
+            return shaderStorageBlockIndexInternal({name.data(), name.size()});
+        }
+
+        /** @overload */
+        template<std::size_t size> UnsignedInt shaderStorageBlockIndex(const char(&name)[size]) {
+            return shaderStorageBlockIndexInternal({name, size - 1});
+        }
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set shader storage block binding
+         * @param index         Shader storage block index
+         * @param binding       Shader storage buffer binding point
+         *
+         * The buffer bound to given binding point with
+         * @ref Buffer::bind(Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr)
+         * and @ref Buffer::Target::ShaderStorage will be used as the block
+         * data source.
+         * @see @ref shaderStorageBlockIndex(),
+         *      @ref Buffer::maxShaderStorageBindings(),
+         *      @fn_gl{ShaderStorageBlockBinding}
+         * @requires_gl43 Extension @extension{ARB,shader_storage_buffer_object}
+         * @requires_gl In OpenGL ES the binding can be specified only
+         *      explicitly in the shader using `layout(binding = N)`.
+         */
+        void setShaderStorageBlockBinding(UnsignedInt index, UnsignedInt binding);
+        #endif
+
         /**
          * @brief Set uniform value
          * @param location      Uniform location
@@ -964,12 +1241,49 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
         void setUniform(Int location, UnsignedInt count, const Math::RectangularMatrix<4, 3, Double>* values); /**< @overload */
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set bindless texture handle uniform
+         * @param location      Uniform location
+         * @param count         Handle count
+         * @param handles       Handles
+         *
+         * Sets sampler uniform to texture handle(s) obtained via
+         * @ref AbstractTexture::handle(). The handles need to be resident.
+         * If @extension{ARB,separate_shader_objects} (part of OpenGL 4.1) is
+         * not available, the shader is marked for use before the operation.
+         * @see @ref setUniform(), @fn_gl{UseProgram},
+         *      @fn_gl_extension{UniformHandle,ARB,bindless_texture} or
+         *      @fn_gl_extension{ProgramUniformHandle,ARB,bindless_texture}
+         * @requires_extension Extension @extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES.
+         */
+        void setUniformHandle(Int location, UnsignedInt count, const GLuint64* handles);
+
+        /** @overload */
+        void setUniformHandle(Int location, GLuint64 handle) {
+            setUniformHandle(location, 1, &handle);
+        }
+        #endif
+
     private:
         AbstractShaderProgram& setLabelInternal(Containers::ArrayReference<const char> label);
         void bindAttributeLocationInternal(UnsignedInt location, Containers::ArrayReference<const char> name);
         void bindFragmentDataLocationIndexedInternal(UnsignedInt location, UnsignedInt index, Containers::ArrayReference<const char> name);
         void bindFragmentDataLocationInternal(UnsignedInt location, Containers::ArrayReference<const char> name);
         Int uniformLocationInternal(Containers::ArrayReference<const char> name);
+        #ifndef MAGNUM_TARGET_GLES2
+        UnsignedInt uniformBlockIndexInternal(Containers::ArrayReference<const char> name);
+        #endif
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        UnsignedInt shaderStorageBlockIndexInternal(Containers::ArrayReference<const char> name);
+        #endif
+
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        std::string MAGNUM_LOCAL binaryCacheKey() const;
+        bool MAGNUM_LOCAL loadBinaryFromCache(const std::string& directory);
+        void MAGNUM_LOCAL saveBinaryToCache(const std::string& directory);
+        #endif
 
         #ifndef MAGNUM_BUILD_DEPRECATED
         void use();
@@ -1101,6 +1415,10 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
         void MAGNUM_LOCAL uniformImplementationSSO(GLint location, GLsizei count, const Math::RectangularMatrix<3, 4, GLdouble>* values);
         void MAGNUM_LOCAL uniformImplementationSSO(GLint location, GLsizei count, const Math::RectangularMatrix<4, 3, GLdouble>* values);
         #endif
+        #ifndef MAGNUM_TARGET_GLES
+        void MAGNUM_LOCAL uniformHandleImplementationDefault(GLint location, GLsizei count, const GLuint64* values);
+        void MAGNUM_LOCAL uniformHandleImplementationSSO(GLint location, GLsizei count, const GLuint64* values);
+        #endif
         void MAGNUM_LOCAL uniformImplementationDSAEXT_SSOEXT(GLint location, GLsizei count, const Math::RectangularMatrix<2, 2, GLfloat>* values);
         void MAGNUM_LOCAL uniformImplementationDSAEXT_SSOEXT(GLint location, GLsizei count, const Math::RectangularMatrix<3, 3, GLfloat>* values);
         void MAGNUM_LOCAL uniformImplementationDSAEXT_SSOEXT(GLint location, GLsizei count, const Math::RectangularMatrix<4, 4, GLfloat>* values);
@@ -1124,7 +1442,17 @@ class MAGNUM_EXPORT AbstractShaderProgram: public AbstractObject {
         void MAGNUM_LOCAL uniformImplementationDSAEXT(GLint location, GLsizei count, const Math::RectangularMatrix<4, 3, GLdouble>* values);
         #endif
 
+        /* Returns false if the value is the same as cached */
+        bool MAGNUM_LOCAL updateUniformCache(GLint location, GLsizei count, const void* data, std::size_t size);
+
         GLuint _id;
+        struct UniformCache;
+        std::unique_ptr<UniformCache> _uniformCache;
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /* Everything what affects the program binary, used as cache key */
+        std::string _binaryCacheKey;
+        bool _binaryLoadedFromCache;
+        #endif
 };
 
 }
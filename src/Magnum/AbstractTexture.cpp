@@ -42,6 +42,9 @@
 #endif
 
 #include "Implementation/DebugState.h"
+#include "Implementation/DeletionState.h"
+#include "Implementation/MemoryState.h"
+#include "Implementation/NamePoolState.h"
 #include "Implementation/State.h"
 #include "Implementation/TextureState.h"
 
@@ -122,6 +125,9 @@ void AbstractTexture::unbind(const Int textureUnit) {
     /* If given texture unit is already unbound, nothing to do */
     if(textureState.bindings[textureUnit].second == 0) return;
 
+    Implementation::State& state = Context::current()->state();
+    if(state.statisticsEnabled) ++state.statistics.textureBinds;
+
     /* Unbind the texture, reset state tracker */
     Context::current()->state().texture->unbindImplementation(textureUnit);
     textureState.bindings[textureUnit] = {};
@@ -159,6 +165,23 @@ void AbstractTexture::unbindImplementationDSAEXT(const GLint textureUnit) {
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void AbstractTexture::bindImage(const Int imageUnit, const Int level, const ImageAccess access, const TextureFormat format) {
+    /* The texture must be created, glBindImageTexture() takes the ID */
+    createIfNotAlready();
+    glBindImageTexture(imageUnit, _id, level, GL_TRUE, 0, GLenum(access), GLenum(format));
+}
+
+void AbstractTexture::bindImageLayer(const Int imageUnit, const Int level, const Int layer, const ImageAccess access, const TextureFormat format) {
+    createIfNotAlready();
+    glBindImageTexture(imageUnit, _id, level, GL_FALSE, layer, GLenum(access), GLenum(format));
+}
+
+void AbstractTexture::unbindImage(const Int imageUnit) {
+    glBindImageTexture(imageUnit, 0, 0, GL_FALSE, 0, GL_READ_ONLY, GL_R8);
+}
+#endif
+
 void AbstractTexture::unbind(const Int firstTextureUnit, const std::size_t count) {
     /* State tracker is updated in the implementations */
     Context::current()->state().texture->bindMultiImplementation(firstTextureUnit, {nullptr, count});
@@ -180,9 +203,11 @@ void AbstractTexture::bindImplementationFallback(const GLint firstTextureUnit, c
 void AbstractTexture::bindImplementationMulti(const GLint firstTextureUnit, Containers::ArrayReference<AbstractTexture* const> textures) {
     Implementation::TextureState& textureState = *Context::current()->state().texture;
 
-    /* Create array of IDs and also update bindings in state tracker */
+    /* Create array of IDs and also update bindings in state tracker. Track
+       the first and last unit that actually changed so the call covers only
+       the smallest range needed. */
     Containers::Array<GLuint> ids{textures ? textures.size() : 0};
-    bool different = false;
+    std::size_t first = textures.size(), last = 0, changed = 0;
     for(std::size_t i = 0; i != textures.size(); ++i) {
         const GLuint id = textures && textures[i] ? textures[i]->_id : 0;
 
@@ -191,24 +216,33 @@ void AbstractTexture::bindImplementationMulti(const GLint firstTextureUnit, Cont
             ids[i] = id;
         }
 
-        if(textureState.bindings[firstTextureUnit + i].second != id) {
-            different = true;
-            textureState.bindings[firstTextureUnit + i].second = id;
+        std::pair<GLenum, GLuint>& binding = textureState.bindings[firstTextureUnit + i];
+        if(binding.second != id) {
+            if(first == textures.size()) first = i;
+            last = i;
+            ++changed;
+            binding = {textures && textures[i] ? textures[i]->_target : 0, id};
         }
     }
 
     /* Avoid doing the binding if there is nothing different */
-    if(different) glBindTextures(firstTextureUnit, textures.size(), ids);
+    if(first == textures.size()) return;
+
+    Implementation::State& state = Context::current()->state();
+    if(state.statisticsEnabled) state.statistics.textureBinds += changed;
+
+    glBindTextures(firstTextureUnit + first, last - first + 1, textures ? ids + first : nullptr);
 }
 #endif
 
-AbstractTexture::AbstractTexture(GLenum target): _target{target} {
+AbstractTexture::AbstractTexture(GLenum target): _target{target}, _memoryLabel{0}, _memoryUsage{0} {
     (this->*Context::current()->state().texture->createImplementation)();
     CORRADE_INTERNAL_ASSERT(_id != Implementation::State::DisengagedBinding);
+    Context::current()->state().memory->create(Context::MemoryObjectType::Texture);
 }
 
 void AbstractTexture::createImplementationDefault() {
-    glGenTextures(1, &_id);
+    _id = Context::current()->state().namePool->textures.take();
     _created = false;
 }
 
@@ -223,11 +257,18 @@ AbstractTexture::~AbstractTexture() {
     /* Moved out, nothing to do */
     if(!_id) return;
 
+    Context::current()->state().memory->destroy(Context::MemoryObjectType::Texture, _memoryLabel, _memoryUsage);
+
     /* Remove all bindings */
     for(auto& binding: Context::current()->state().texture->bindings)
         if(binding.second == _id) binding = {};
 
-    glDeleteTextures(1, &_id);
+    /* Never bound, so it's just a reserved name which can be reused */
+    if(!_created && Context::current()->state().namePool->textures.recycle(_id))
+        return;
+
+    if(!Context::current()->state().deletion->deferTexture(_id))
+        glDeleteTextures(1, &_id);
 }
 
 inline void AbstractTexture::createIfNotAlready() {
@@ -250,6 +291,7 @@ std::string AbstractTexture::label() {
 AbstractTexture& AbstractTexture::setLabelInternal(const Containers::ArrayReference<const char> label) {
     createIfNotAlready();
     Context::current()->state().debug->labelImplementation(GL_TEXTURE, _id, label);
+    _memoryLabel = Context::current()->state().memory->relabel(_memoryLabel, label, _memoryUsage);
     return *this;
 }
 
@@ -259,11 +301,35 @@ void AbstractTexture::bind(Int textureUnit) {
     /* If already bound in given texture unit, nothing to do */
     if(textureState.bindings[textureUnit].second == _id) return;
 
+    Implementation::State& state = Context::current()->state();
+    if(state.statisticsEnabled) ++state.statistics.textureBinds;
+
     /* Update state tracker, bind the texture to the unit */
     textureState.bindings[textureUnit] = {_target, _id};
     (this->*textureState.bindImplementation)(textureUnit);
 }
 
+#ifndef MAGNUM_TARGET_GLES
+GLuint64 AbstractTexture::handle() {
+    createIfNotAlready();
+    return glGetTextureHandleARB(_id);
+}
+
+AbstractTexture& AbstractTexture::makeResident() {
+    glMakeTextureHandleResidentARB(handle());
+    return *this;
+}
+
+AbstractTexture& AbstractTexture::makeNonResident() {
+    glMakeTextureHandleNonResidentARB(handle());
+    return *this;
+}
+
+bool AbstractTexture::isResident() {
+    return glIsTextureHandleResidentARB(handle());
+}
+#endif
+
 void AbstractTexture::bindImplementationDefault(GLint textureUnit) {
     Implementation::TextureState& textureState = *Context::current()->state().texture;
 
@@ -405,8 +471,76 @@ void AbstractTexture::invalidateImage(const Int level) {
 
 void AbstractTexture::generateMipmap() {
     (this->*Context::current()->state().texture->mipmapImplementation)();
+
+    /* Immutable storage already has all levels accounted. Otherwise the
+       generated levels take roughly one third of the base level, store that
+       in the first level records so a later setImage() replaces it. */
+    for(std::size_t face = 0; face != 6 && face < _imageMemoryUsage.size(); ++face)
+        if(_imageMemoryUsage[face]) setImageMemoryUsage(face ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + face : _target, 1, _imageMemoryUsage[face]/3);
+}
+
+void AbstractTexture::setStorageMemoryUsage(const std::size_t size) {
+    Context::current()->state().memory->resize(Context::MemoryObjectType::Texture, _memoryLabel, _memoryUsage, size);
+    _memoryUsage = size;
+
+    /* The storage replaces all images specified so far (the setStorage()
+       fallback calls setImage() for all levels before ending here) */
+    _imageMemoryUsage.clear();
+}
+
+void AbstractTexture::setImageMemoryUsage(const GLenum target, const GLint level, const std::size_t size) {
+    const std::size_t index = std::size_t(level)*6 + (target == _target ? 0 : target - GL_TEXTURE_CUBE_MAP_POSITIVE_X);
+    if(_imageMemoryUsage.size() <= index) _imageMemoryUsage.resize(index + 1);
+
+    const std::size_t previous = _imageMemoryUsage[index];
+    Context::current()->state().memory->resize(Context::MemoryObjectType::Texture, _memoryLabel, previous, size);
+    _memoryUsage = _memoryUsage - previous + size;
+    _imageMemoryUsage[index] = size;
+}
+
+#ifndef MAGNUM_TARGET_GLES
+Int AbstractTexture::sparsePageSizeCountInternal(const GLenum target, const TextureFormat format) {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::sparse_texture>())
+        return 0;
+
+    GLint count;
+    glGetInternalformativ(target, GLenum(format), GL_NUM_VIRTUAL_PAGE_SIZES_ARB, 1, &count);
+    return count;
+}
+
+Vector3i AbstractTexture::sparsePageSizeInternal(const GLenum target, const TextureFormat format, const Int index) {
+    const Int count = sparsePageSizeCountInternal(target, format);
+    CORRADE_ASSERT(index < count,
+        "AbstractTexture::sparsePageSize(): index" << index << "out of range for" << count << "page sizes", {});
+
+    /* The queries return all page sizes at once, pick the one at index */
+    Containers::Array<GLint> x{std::size_t(count)}, y{std::size_t(count)}, z{std::size_t(count)};
+    glGetInternalformativ(target, GLenum(format), GL_VIRTUAL_PAGE_SIZE_X_ARB, count, x);
+    glGetInternalformativ(target, GLenum(format), GL_VIRTUAL_PAGE_SIZE_Y_ARB, count, y);
+    glGetInternalformativ(target, GLenum(format), GL_VIRTUAL_PAGE_SIZE_Z_ARB, count, z);
+    return {x[index], y[index], z[index]};
+}
+
+void AbstractTexture::setSparseInternal(const bool sparse, const Int pageSizeIndex) {
+    (this->*Context::current()->state().texture->parameteriImplementation)(GL_TEXTURE_SPARSE_ARB, sparse);
+    if(sparse) (this->*Context::current()->state().texture->parameteriImplementation)(GL_VIRTUAL_PAGE_SIZE_INDEX_ARB, pageSizeIndex);
 }
 
+Int AbstractTexture::sparseLevelCountInternal() {
+    /** @todo use DSA query when available */
+    bindInternal();
+    GLint value;
+    glGetTexParameteriv(_target, GL_NUM_SPARSE_LEVELS_ARB, &value);
+    return value;
+}
+
+void AbstractTexture::setPageCommitmentInternal(const GLint level, const Vector3i& offset, const Vector3i& size, const bool commit) {
+    /** @todo EXT_direct_state_access has glTexturePageCommitmentEXT() */
+    bindInternal();
+    glTexPageCommitmentARB(_target, level, offset.x(), offset.y(), offset.z(), size.x(), size.y(), size.z(), commit);
+}
+#endif
+
 void AbstractTexture::mipmapImplementationDefault() {
     bindInternal();
     glGenerateMipmap(_target);
@@ -1210,6 +1344,66 @@ void AbstractTexture::subImageImplementationDSAEXT(GLint level, const Vector3i&
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void AbstractTexture::compressedSubImageImplementationDefault(const GLint level, const Math::Vector<1, GLint>& offset, const Math::Vector<1, GLsizei>& size, const CompressedColorFormat format, const GLvoid* const data, const GLsizei dataSize) {
+    bindInternal();
+    glCompressedTexSubImage1D(_target, level, offset[0], size[0], GLenum(format), dataSize, data);
+}
+
+void AbstractTexture::compressedSubImageImplementationDSA(const GLint level, const Math::Vector<1, GLint>& offset, const Math::Vector<1, GLsizei>& size, const CompressedColorFormat format, const GLvoid* const data, const GLsizei dataSize) {
+    glCompressedTextureSubImage1D(_id, level, offset[0], size[0], GLenum(format), dataSize, data);
+}
+
+void AbstractTexture::compressedSubImageImplementationDSAEXT(const GLint level, const Math::Vector<1, GLint>& offset, const Math::Vector<1, GLsizei>& size, const CompressedColorFormat format, const GLvoid* const data, const GLsizei dataSize) {
+    _created = true;
+    glCompressedTextureSubImage1DEXT(_id, _target, level, offset[0], size[0], GLenum(format), dataSize, data);
+}
+#endif
+
+void AbstractTexture::compressedSubImageImplementationDefault(const GLint level, const Vector2i& offset, const Vector2i& size, const CompressedColorFormat format, const GLvoid* const data, const GLsizei dataSize) {
+    bindInternal();
+    glCompressedTexSubImage2D(_target, level, offset.x(), offset.y(), size.x(), size.y(), GLenum(format), dataSize, data);
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void AbstractTexture::compressedSubImageImplementationDSA(const GLint level, const Vector2i& offset, const Vector2i& size, const CompressedColorFormat format, const GLvoid* const data, const GLsizei dataSize) {
+    glCompressedTextureSubImage2D(_id, level, offset.x(), offset.y(), size.x(), size.y(), GLenum(format), dataSize, data);
+}
+
+void AbstractTexture::compressedSubImageImplementationDSAEXT(const GLint level, const Vector2i& offset, const Vector2i& size, const CompressedColorFormat format, const GLvoid* const data, const GLsizei dataSize) {
+    _created = true;
+    glCompressedTextureSubImage2DEXT(_id, _target, level, offset.x(), offset.y(), size.x(), size.y(), GLenum(format), dataSize, data);
+}
+#endif
+
+void AbstractTexture::compressedSubImageImplementationDefault(const GLint level, const Vector3i& offset, const Vector3i& size, const CompressedColorFormat format, const GLvoid* const data, const GLsizei dataSize) {
+    bindInternal();
+    #ifndef MAGNUM_TARGET_GLES2
+    glCompressedTexSubImage3D(_target, level, offset.x(), offset.y(), offset.z(), size.x(), size.y(), size.z(), GLenum(format), dataSize, data);
+    #elif !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+    glCompressedTexSubImage3DOES(_target, level, offset.x(), offset.y(), offset.z(), size.x(), size.y(), size.z(), GLenum(format), dataSize, data);
+    #else
+    static_cast<void>(level);
+    static_cast<void>(offset);
+    static_cast<void>(size);
+    static_cast<void>(format);
+    static_cast<void>(data);
+    static_cast<void>(dataSize);
+    CORRADE_ASSERT_UNREACHABLE();
+    #endif
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void AbstractTexture::compressedSubImageImplementationDSA(const GLint level, const Vector3i& offset, const Vector3i& size, const CompressedColorFormat format, const GLvoid* const data, const GLsizei dataSize) {
+    glCompressedTextureSubImage3D(_id, level, offset.x(), offset.y(), offset.z(), size.x(), size.y(), size.z(), GLenum(format), dataSize, data);
+}
+
+void AbstractTexture::compressedSubImageImplementationDSAEXT(const GLint level, const Vector3i& offset, const Vector3i& size, const CompressedColorFormat format, const GLvoid* const data, const GLsizei dataSize) {
+    _created = true;
+    glCompressedTextureSubImage3DEXT(_id, _target, level, offset.x(), offset.y(), offset.z(), size.x(), size.y(), size.z(), GLenum(format), dataSize, data);
+}
+#endif
+
 void AbstractTexture::invalidateImageImplementationNoOp(GLint) {}
 
 #ifndef MAGNUM_TARGET_GLES
@@ -1235,6 +1429,7 @@ template<UnsignedInt dimensions> void AbstractTexture::image(GLint level, Image<
     const std::size_t dataSize = image.dataSize(size);
     char* data = new char[dataSize];
     Buffer::unbindInternal(Buffer::TargetHint::PixelPack);
+    image.storage().applyPack();
     (this->*Context::current()->state().texture->getImageImplementation)(level, image.format(), image.type(), dataSize, data);
     image.setData(image.format(), image.type(), size, data);
 }
@@ -1247,9 +1442,10 @@ template<UnsignedInt dimensions> void AbstractTexture::image(GLint level, Buffer
     const Math::Vector<dimensions, Int> size = DataHelper<dimensions>::imageSize(*this, level);
     const std::size_t dataSize = image.dataSize(size);
     if(image.size() != size)
-        image.setData(image.format(), image.type(), size, nullptr, usage);
+        image.setData(image.storage(), image.format(), image.type(), size, nullptr, usage);
 
     image.buffer().bindInternal(Buffer::TargetHint::PixelPack);
+    image.storage().applyPack();
     (this->*Context::current()->state().texture->getImageImplementation)(level, image.format(), image.type(), dataSize, nullptr);
 }
 
@@ -1267,6 +1463,7 @@ template<UnsignedInt dimensions> void AbstractTexture::subImage(const GLint leve
     char* data = new char[dataSize];
 
     Buffer::unbindInternal(Buffer::TargetHint::PixelPack);
+    image.storage().applyPack();
     glGetTextureSubImage(_id, level, paddedOffset.x(), paddedOffset.y(), paddedOffset.z(), paddedSize.x(), paddedSize.y(), paddedSize.z(), GLenum(image.format()), GLenum(image.type()), dataSize, data);
     image.setData(image.format(), image.type(), size, data);
 }
@@ -1283,9 +1480,10 @@ template<UnsignedInt dimensions> void AbstractTexture::subImage(const GLint leve
     const Vector3i paddedOffset = Vector3i::pad(range.min());
     const Vector3i paddedSize = Vector3i::pad(size, 1);
     if(image.size() != size)
-        image.setData(image.format(), image.type(), size, nullptr, usage);
+        image.setData(image.storage(), image.format(), image.type(), size, nullptr, usage);
 
     image.buffer().bindInternal(Buffer::TargetHint::PixelPack);
+    image.storage().applyPack();
     glGetTextureSubImage(_id, level, paddedOffset.x(), paddedOffset.y(), paddedOffset.z(), paddedSize.x(), paddedSize.y(), paddedSize.z(), GLenum(image.format()), GLenum(image.type()), dataSize, nullptr);
 }
 
@@ -1325,52 +1523,92 @@ Vector3i AbstractTexture::DataHelper<3>::imageSize(AbstractTexture& texture, con
 }
 #endif
 
+namespace {
+
+/* Estimated size of all levels of immutable storage, each level is divided in
+   dimensions where the divisor is 2 */
+std::size_t storageMemoryUsage(const GLsizei levels, const TextureFormat internalFormat, Vector3i size, const Vector3i& divisor) {
+    std::size_t memoryUsage = 0;
+    for(GLsizei level = 0; level != levels; ++level) {
+        memoryUsage += Implementation::imageMemoryUsage(GLenum(internalFormat), size);
+        size = Math::max(size/divisor, Vector3i{1});
+    }
+    return memoryUsage;
+}
+
+}
+
 #ifndef MAGNUM_TARGET_GLES
 void AbstractTexture::DataHelper<1>::setStorage(AbstractTexture& texture, const GLsizei levels, const TextureFormat internalFormat, const Math::Vector< 1, GLsizei >& size) {
     (texture.*Context::current()->state().texture->storage1DImplementation)(levels, internalFormat, size);
+    texture.setStorageMemoryUsage(storageMemoryUsage(levels, internalFormat, {size[0], 1, 1}, {2, 1, 1}));
 }
 #endif
 
 void AbstractTexture::DataHelper<2>::setStorage(AbstractTexture& texture, const GLsizei levels, const TextureFormat internalFormat, const Vector2i& size) {
     (texture.*Context::current()->state().texture->storage2DImplementation)(levels, internalFormat, size);
+
+    /* Layers of 1D array are not divided, cube maps have six faces */
+    #ifndef MAGNUM_TARGET_GLES
+    const Vector3i divisor = texture._target == GL_TEXTURE_1D_ARRAY ? Vector3i{2, 1, 1} : Vector3i{2, 2, 1};
+    #else
+    const Vector3i divisor{2, 2, 1};
+    #endif
+    texture.setStorageMemoryUsage(storageMemoryUsage(levels, internalFormat, {size, 1}, divisor)*(texture._target == GL_TEXTURE_CUBE_MAP ? 6 : 1));
 }
 
 void AbstractTexture::DataHelper<3>::setStorage(AbstractTexture& texture, const GLsizei levels, const TextureFormat internalFormat, const Vector3i& size) {
     (texture.*Context::current()->state().texture->storage3DImplementation)(levels, internalFormat, size);
+
+    /* Layers of array textures are not divided */
+    #ifndef MAGNUM_TARGET_GLES2
+    const bool is3D = texture._target == GL_TEXTURE_3D;
+    #else
+    const bool is3D = texture._target == GL_TEXTURE_3D_OES;
+    #endif
+    texture.setStorageMemoryUsage(storageMemoryUsage(levels, internalFormat, size, {2, 2, is3D ? 2 : 1}));
 }
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractTexture::DataHelper<2>::setStorageMultisample(AbstractTexture& texture, const GLsizei samples, const TextureFormat internalFormat, const Vector2i& size, const GLboolean fixedSampleLocations) {
     (texture.*Context::current()->state().texture->storage2DMultisampleImplementation)(samples, internalFormat, size, fixedSampleLocations);
+    texture.setStorageMemoryUsage(Implementation::imageMemoryUsage(GLenum(internalFormat), {size, 1})*samples);
 }
 #endif
 
 #ifndef MAGNUM_TARGET_GLES
 void AbstractTexture::DataHelper<3>::setStorageMultisample(AbstractTexture& texture, const GLsizei samples, const TextureFormat internalFormat, const Vector3i& size, const GLboolean fixedSampleLocations) {
     (texture.*Context::current()->state().texture->storage3DMultisampleImplementation)(samples, internalFormat, size, fixedSampleLocations);
+    texture.setStorageMemoryUsage(Implementation::imageMemoryUsage(GLenum(internalFormat), size)*samples);
 }
 #endif
 
 #ifndef MAGNUM_TARGET_GLES
 void AbstractTexture::DataHelper<1>::setImage(AbstractTexture& texture, const GLint level, const TextureFormat internalFormat, const ImageReference1D& image) {
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
+    image.storage().applyUnpack();
     texture.bindInternal();
     glTexImage1D(texture._target, level, GLint(internalFormat), image.size()[0], 0, GLenum(image.format()), GLenum(image.type()), image.data());
+    texture.setImageMemoryUsage(texture._target, level, Implementation::imageMemoryUsage(GLenum(internalFormat), {image.size()[0], 1, 1}));
 }
 
 void AbstractTexture::DataHelper<1>::setImage(AbstractTexture& texture, const GLint level, const TextureFormat internalFormat, BufferImage1D& image) {
     image.buffer().bindInternal(Buffer::TargetHint::PixelUnpack);
+    image.storage().applyUnpack();
     texture.bindInternal();
     glTexImage1D(texture._target, level, GLint(internalFormat), image.size()[0], 0, GLenum(image.format()), GLenum(image.type()), nullptr);
+    texture.setImageMemoryUsage(texture._target, level, Implementation::imageMemoryUsage(GLenum(internalFormat), {image.size()[0], 1, 1}));
 }
 
 void AbstractTexture::DataHelper<1>::setSubImage(AbstractTexture& texture, const GLint level, const Math::Vector<1, GLint>& offset, const ImageReference1D& image) {
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
+    image.storage().applyUnpack();
     (texture.*Context::current()->state().texture->subImage1DImplementation)(level, offset, image.size(), image.format(), image.type(), image.data());
 }
 
 void AbstractTexture::DataHelper<1>::setSubImage(AbstractTexture& texture, const GLint level, const Math::Vector<1, GLint>& offset, BufferImage1D& image) {
     image.buffer().bindInternal(Buffer::TargetHint::PixelUnpack);
+    image.storage().applyUnpack();
     (texture.*Context::current()->state().texture->subImage1DImplementation)(level, offset, image.size(), image.format(), image.type(), nullptr);
 }
 #endif
@@ -1379,15 +1617,19 @@ void AbstractTexture::DataHelper<2>::setImage(AbstractTexture& texture, const GL
     #ifndef MAGNUM_TARGET_GLES2
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     #endif
+    image.storage().applyUnpack();
     texture.bindInternal();
     glTexImage2D(target, level, GLint(internalFormat), image.size().x(), image.size().y(), 0, GLenum(image.format()), GLenum(image.type()), image.data());
+    texture.setImageMemoryUsage(target, level, Implementation::imageMemoryUsage(GLenum(internalFormat), {image.size(), 1}));
 }
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractTexture::DataHelper<2>::setImage(AbstractTexture& texture, const GLenum target, const GLint level, const TextureFormat internalFormat, BufferImage2D& image) {
     image.buffer().bindInternal(Buffer::TargetHint::PixelUnpack);
+    image.storage().applyUnpack();
     texture.bindInternal();
     glTexImage2D(target, level, GLint(internalFormat), image.size().x(), image.size().y(), 0, GLenum(image.format()), GLenum(image.type()), nullptr);
+    texture.setImageMemoryUsage(target, level, Implementation::imageMemoryUsage(GLenum(internalFormat), {image.size(), 1}));
 }
 #endif
 
@@ -1395,12 +1637,14 @@ void AbstractTexture::DataHelper<2>::setSubImage(AbstractTexture& texture, const
     #ifndef MAGNUM_TARGET_GLES2
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     #endif
+    image.storage().applyUnpack();
     (texture.*Context::current()->state().texture->subImage2DImplementation)(level, offset, image.size(), image.format(), image.type(), image.data());
 }
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractTexture::DataHelper<2>::setSubImage(AbstractTexture& texture, const GLint level, const Vector2i& offset, BufferImage2D& image) {
     image.buffer().bindInternal(Buffer::TargetHint::PixelUnpack);
+    image.storage().applyUnpack();
     (texture.*Context::current()->state().texture->subImage2DImplementation)(level, offset, image.size(), image.format(), image.type(), nullptr);
 }
 #endif
@@ -1409,6 +1653,7 @@ void AbstractTexture::DataHelper<3>::setImage(AbstractTexture& texture, const GL
     #ifndef MAGNUM_TARGET_GLES2
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     #endif
+    image.storage().applyUnpack();
     texture.bindInternal();
     #ifndef MAGNUM_TARGET_GLES2
     glTexImage3D(texture._target, level, GLint(internalFormat), image.size().x(), image.size().y(), image.size().z(), 0, GLenum(image.format()), GLenum(image.type()), image.data());
@@ -1420,13 +1665,16 @@ void AbstractTexture::DataHelper<3>::setImage(AbstractTexture& texture, const GL
     static_cast<void>(image);
     CORRADE_ASSERT_UNREACHABLE();
     #endif
+    texture.setImageMemoryUsage(texture._target, level, Implementation::imageMemoryUsage(GLenum(internalFormat), image.size()));
 }
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractTexture::DataHelper<3>::setImage(AbstractTexture& texture, const GLint level, const TextureFormat internalFormat, BufferImage3D& image) {
     image.buffer().bindInternal(Buffer::TargetHint::PixelUnpack);
+    image.storage().applyUnpack();
     texture.bindInternal();
     glTexImage3D(texture._target, level, GLint(internalFormat), image.size().x(), image.size().y(), image.size().z(), 0, GLenum(image.format()), GLenum(image.type()), nullptr);
+    texture.setImageMemoryUsage(texture._target, level, Implementation::imageMemoryUsage(GLenum(internalFormat), image.size()));
 }
 #endif
 
@@ -1434,22 +1682,88 @@ void AbstractTexture::DataHelper<3>::setSubImage(AbstractTexture& texture, const
     #ifndef MAGNUM_TARGET_GLES2
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     #endif
+    image.storage().applyUnpack();
     (texture.*Context::current()->state().texture->subImage3DImplementation)(level, offset, image.size(), image.format(), image.type(), image.data());
 }
 
 #ifndef MAGNUM_TARGET_GLES2
 void AbstractTexture::DataHelper<3>::setSubImage(AbstractTexture& texture, const GLint level, const Vector3i& offset, BufferImage3D& image) {
     image.buffer().bindInternal(Buffer::TargetHint::PixelUnpack);
+    image.storage().applyUnpack();
     (texture.*Context::current()->state().texture->subImage3DImplementation)(level, offset, image.size(), image.format(), image.type(), nullptr);
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void AbstractTexture::DataHelper<1>::setCompressedImage(AbstractTexture& texture, const GLint level, const CompressedImageReference1D& image) {
+    Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
+    texture.bindInternal();
+    glCompressedTexImage1D(texture._target, level, GLenum(image.format()), image.size()[0], 0, image.data().size(), image.data().data());
+    texture.setImageMemoryUsage(texture._target, level, image.data().size());
+}
+
+void AbstractTexture::DataHelper<1>::setCompressedSubImage(AbstractTexture& texture, const GLint level, const Math::Vector<1, GLint>& offset, const CompressedImageReference1D& image) {
+    Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
+    (texture.*Context::current()->state().texture->compressedSubImage1DImplementation)(level, offset, image.size(), image.format(), image.data().data(), image.data().size());
+}
+#endif
+
+void AbstractTexture::DataHelper<2>::setCompressedImage(AbstractTexture& texture, const GLenum target, const GLint level, const CompressedImageReference2D& image) {
+    #ifndef MAGNUM_TARGET_GLES2
+    Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
+    #endif
+    texture.bindInternal();
+    glCompressedTexImage2D(target, level, GLenum(image.format()), image.size().x(), image.size().y(), 0, image.data().size(), image.data().data());
+    texture.setImageMemoryUsage(target, level, image.data().size());
+}
+
+void AbstractTexture::DataHelper<2>::setCompressedSubImage(AbstractTexture& texture, const GLint level, const Vector2i& offset, const CompressedImageReference2D& image) {
+    #ifndef MAGNUM_TARGET_GLES2
+    Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
+    #endif
+    (texture.*Context::current()->state().texture->compressedSubImage2DImplementation)(level, offset, image.size(), image.format(), image.data().data(), image.data().size());
+}
+
+void AbstractTexture::DataHelper<3>::setCompressedImage(AbstractTexture& texture, const GLint level, const CompressedImageReference3D& image) {
+    #ifndef MAGNUM_TARGET_GLES2
+    Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
+    #endif
+    texture.bindInternal();
+    #ifndef MAGNUM_TARGET_GLES2
+    glCompressedTexImage3D(texture._target, level, GLenum(image.format()), image.size().x(), image.size().y(), image.size().z(), 0, image.data().size(), image.data().data());
+    #elif !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+    glCompressedTexImage3DOES(texture._target, level, GLenum(image.format()), image.size().x(), image.size().y(), image.size().z(), 0, image.data().size(), image.data().data());
+    #else
+    static_cast<void>(level);
+    static_cast<void>(image);
+    CORRADE_ASSERT_UNREACHABLE();
+    #endif
+    texture.setImageMemoryUsage(texture._target, level, image.data().size());
+}
+
+void AbstractTexture::DataHelper<3>::setCompressedSubImage(AbstractTexture& texture, const GLint level, const Vector3i& offset, const CompressedImageReference3D& image) {
+    #ifndef MAGNUM_TARGET_GLES2
+    Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
+    #endif
+    (texture.*Context::current()->state().texture->compressedSubImage3DImplementation)(level, offset, image.size(), image.format(), image.data().data(), image.data().size());
+}
+
 #ifndef MAGNUM_TARGET_GLES
 void AbstractTexture::DataHelper<1>::invalidateSubImage(AbstractTexture& texture, const GLint level, const Math::Vector<1, GLint>& offset, const Math::Vector<1, GLint>& size) {
     (texture.*Context::current()->state().texture->invalidateSubImageImplementation)(level, {offset[0], 0, 0}, {size[0], 1, 1});
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void AbstractTexture::DataHelper<2>::setPageCommitment(AbstractTexture& texture, const GLint level, const Range2Di& range, const bool commit) {
+    texture.setPageCommitmentInternal(level, {range.min(), 0}, {range.size(), 1}, commit);
+}
+
+void AbstractTexture::DataHelper<3>::setPageCommitment(AbstractTexture& texture, const GLint level, const Range3Di& range, const bool commit) {
+    texture.setPageCommitmentInternal(level, range.min(), range.size(), commit);
+}
+#endif
+
 void AbstractTexture::DataHelper<2>::invalidateSubImage(AbstractTexture& texture, const GLint level, const Vector2i& offset, const Vector2i& size) {
     (texture.*Context::current()->state().texture->invalidateSubImageImplementation)(level, {offset, 0}, {size, 1});
 }
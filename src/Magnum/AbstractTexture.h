@@ -29,6 +29,7 @@
  * @brief Class @ref Magnum::AbstractTexture
  */
 
+#include <vector>
 #include <Corrade/Containers/Array.h>
 
 #include "Magnum/AbstractObject.h"
@@ -51,6 +52,22 @@ namespace Implementation {
     #endif
 }
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+/**
+@brief Image access
+
+@see @ref AbstractTexture::bindImage(), @ref AbstractTexture::bindImageLayer()
+@requires_gl42 Extension @extension{ARB,shader_image_load_store}
+@requires_gles31 Shader image load/store is not available in OpenGL ES 3.0 and
+    older.
+*/
+enum class ImageAccess: GLenum {
+    ReadOnly = GL_READ_ONLY,    /**< The image will only be read */
+    WriteOnly = GL_WRITE_ONLY,  /**< The image will only be written */
+    ReadWrite = GL_READ_WRITE   /**< The image will be both read and written */
+};
+#endif
+
 /**
 @brief Base for textures
 
@@ -124,7 +141,6 @@ in order to preserve the data. If running on OpenGL ES or extension
 functions do nothing.
 
 @todo all texture [level] parameters, global texture parameters
-@todo Add glPixelStore encapsulation
 @todo Texture copying
 @todo Move constructor/assignment - how to avoid creation of empty texture and
     then deleting it immediately?
@@ -136,6 +152,9 @@ functions do nothing.
 class MAGNUM_EXPORT AbstractTexture: public AbstractObject {
     friend Implementation::TextureState;
     friend CubeMapTexture;
+    #ifndef MAGNUM_TARGET_GLES2
+    friend TextureUploadQueue;
+    #endif
 
     public:
         #ifdef MAGNUM_BUILD_DEPRECATED
@@ -233,6 +252,10 @@ class MAGNUM_EXPORT AbstractTexture: public AbstractObject {
          * texture unit is unbound. If @extension{ARB,multi_bind} (part of
          * OpenGL 4.4) is not available, the feature is emulated with sequence
          * of @ref bind(Int) / @ref unbind(Int) calls.
+         *
+         * Units which already have given texture bound are skipped and, if
+         * @extension{ARB,multi_bind} is used, only the smallest range
+         * enclosing the changed units is passed to the driver.
          * @note This function is meant to be used only internally from
          *      @ref AbstractShaderProgram subclasses. See its documentation
          *      for more information.
@@ -296,6 +319,19 @@ class MAGNUM_EXPORT AbstractTexture: public AbstractObject {
         /** @brief OpenGL texture ID */
         GLuint id() const { return _id; }
 
+        /**
+         * @brief Estimated memory usage
+         *
+         * Size of the texture storage in bytes, estimated from the internal
+         * format and size of all levels and faces specified either with
+         * immutable storage or by uploading an image. Compressed images are
+         * accounted with their exact data size, levels created with
+         * @ref generateMipmap() are estimated as one third of the base level.
+         * No OpenGL call is done.
+         * @see @ref Context::memoryUsage()
+         */
+        std::size_t memoryUsage() const { return _memoryUsage; }
+
         /**
          * @brief Bind texture to given texture unit
          *
@@ -314,6 +350,116 @@ class MAGNUM_EXPORT AbstractTexture: public AbstractObject {
          */
         void bind(Int textureUnit);
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /**
+         * @brief Bind texture level to given image unit
+         * @param imageUnit     Image unit
+         * @param level         Texture level
+         * @param access        Image access
+         * @param format        Image format
+         *
+         * Binds whole texture level for image load/store operations in
+         * shaders, for array, cube map and 3D textures all layers of it. The
+         * @p format must be a sized format compatible with internal format
+         * of the texture. Use @ref Renderer::setMemoryBarrier() to make the
+         * stores visible to subsequent operations.
+         * @see @ref bindImageLayer(), @ref unbindImage(),
+         *      @ref AbstractShaderProgram::maxImageUnits(),
+         *      @fn_gl{BindImageTexture}
+         * @requires_gl42 Extension @extension{ARB,shader_image_load_store}
+         * @requires_gles31 Shader image load/store is not available in OpenGL
+         *      ES 3.0 and older.
+         */
+        void bindImage(Int imageUnit, Int level, ImageAccess access, TextureFormat format);
+
+        /**
+         * @brief Bind texture layer to given image unit
+         * @param imageUnit     Image unit
+         * @param level         Texture level
+         * @param layer         Array layer, cube map face or 3D texture
+         *      slice
+         * @param access        Image access
+         * @param format        Image format
+         *
+         * Same as @ref bindImage(), but binds only one layer of array, cube
+         * map or 3D texture, which is then accessed as two-dimensional image
+         * in the shader.
+         * @see @ref unbindImage(), @fn_gl{BindImageTexture}
+         * @requires_gl42 Extension @extension{ARB,shader_image_load_store}
+         * @requires_gles31 Shader image load/store is not available in OpenGL
+         *      ES 3.0 and older.
+         */
+        void bindImageLayer(Int imageUnit, Int level, Int layer, ImageAccess access, TextureFormat format);
+
+        /**
+         * @brief Unbind any texture from given image unit
+         *
+         * @see @ref bindImage(), @fn_gl{BindImageTexture}
+         * @requires_gl42 Extension @extension{ARB,shader_image_load_store}
+         * @requires_gles31 Shader image load/store is not available in OpenGL
+         *      ES 3.0 and older.
+         */
+        static void unbindImage(Int imageUnit);
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Bindless texture handle
+         *
+         * Returns a 64-bit handle through which the texture can be sampled
+         * in shaders without binding it to any texture unit. The handle can
+         * be passed to the shader either via
+         * @ref AbstractShaderProgram::setUniformHandle() or as plain
+         * 64-bit value in uniform or shader storage buffer. The handle stays
+         * the same for the whole lifetime of the texture, so it's advised to
+         * query it only once. The texture must be complete and after the
+         * handle is created the texture parameters and the image data
+         * storage cannot be changed anymore. Before any use in shader, the
+         * handle must be made resident using @ref makeResident().
+         * @see @fn_gl_extension{GetTextureHandle,ARB,bindless_texture}
+         * @requires_extension Extension @extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES.
+         */
+        GLuint64 handle();
+
+        /**
+         * @brief Make the bindless texture handle resident
+         * @return Reference to self (for method chaining)
+         *
+         * Makes the @ref handle() resident, i.e. accessible from shaders.
+         * @see @ref makeNonResident(), @ref isResident(),
+         *      @fn_gl_extension{MakeTextureHandleResident,ARB,bindless_texture}
+         * @requires_extension Extension @extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES.
+         */
+        AbstractTexture& makeResident();
+
+        /**
+         * @brief Make the bindless texture handle non-resident
+         * @return Reference to self (for method chaining)
+         *
+         * The texture memory can be then paged out by the driver. Deleting
+         * the texture makes the handle non-resident implicitly.
+         * @see @ref makeResident(), @ref isResident(),
+         *      @fn_gl_extension{MakeTextureHandleNonResident,ARB,bindless_texture}
+         * @requires_extension Extension @extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES.
+         */
+        AbstractTexture& makeNonResident();
+
+        /**
+         * @brief Whether the bindless texture handle is resident
+         *
+         * The result is *not* cached, repeated queries will result in
+         * repeated OpenGL calls.
+         * @see @ref makeResident(),
+         *      @fn_gl_extension{IsTextureHandleResident,ARB,bindless_texture}
+         * @requires_extension Extension @extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES.
+         */
+        bool isResident();
+        #endif
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     private:
     #else
@@ -367,6 +513,14 @@ class MAGNUM_EXPORT AbstractTexture: public AbstractObject {
         void invalidateImage(Int level);
         void generateMipmap();
 
+        #ifndef MAGNUM_TARGET_GLES
+        static Int sparsePageSizeCountInternal(GLenum target, TextureFormat format);
+        static Vector3i sparsePageSizeInternal(GLenum target, TextureFormat format, Int index);
+        void setSparseInternal(bool sparse, Int pageSizeIndex);
+        Int sparseLevelCountInternal();
+        void setPageCommitmentInternal(GLint level, const Vector3i& offset, const Vector3i& size, bool commit);
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES
         template<UnsignedInt dimensions> void image(GLint level, Image<dimensions>& image);
         template<UnsignedInt dimensions> void image(GLint level, BufferImage<dimensions>& image, BufferUsage usage);
@@ -509,6 +663,24 @@ class MAGNUM_EXPORT AbstractTexture: public AbstractObject {
         void MAGNUM_LOCAL subImageImplementationDSAEXT(GLint level, const Vector3i& offset, const Vector3i& size, ColorFormat format, ColorType type, const GLvoid* data);
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        void MAGNUM_LOCAL compressedSubImageImplementationDefault(GLint level, const Math::Vector<1, GLint>& offset, const Math::Vector<1, GLsizei>& size, CompressedColorFormat format, const GLvoid* data, GLsizei dataSize);
+        void MAGNUM_LOCAL compressedSubImageImplementationDSA(GLint level, const Math::Vector<1, GLint>& offset, const Math::Vector<1, GLsizei>& size, CompressedColorFormat format, const GLvoid* data, GLsizei dataSize);
+        void MAGNUM_LOCAL compressedSubImageImplementationDSAEXT(GLint level, const Math::Vector<1, GLint>& offset, const Math::Vector<1, GLsizei>& size, CompressedColorFormat format, const GLvoid* data, GLsizei dataSize);
+        #endif
+
+        void MAGNUM_LOCAL compressedSubImageImplementationDefault(GLint level, const Vector2i& offset, const Vector2i& size, CompressedColorFormat format, const GLvoid* data, GLsizei dataSize);
+        #ifndef MAGNUM_TARGET_GLES
+        void MAGNUM_LOCAL compressedSubImageImplementationDSA(GLint level, const Vector2i& offset, const Vector2i& size, CompressedColorFormat format, const GLvoid* data, GLsizei dataSize);
+        void MAGNUM_LOCAL compressedSubImageImplementationDSAEXT(GLint level, const Vector2i& offset, const Vector2i& size, CompressedColorFormat format, const GLvoid* data, GLsizei dataSize);
+        #endif
+
+        void MAGNUM_LOCAL compressedSubImageImplementationDefault(GLint level, const Vector3i& offset, const Vector3i& size, CompressedColorFormat format, const GLvoid* data, GLsizei dataSize);
+        #ifndef MAGNUM_TARGET_GLES
+        void MAGNUM_LOCAL compressedSubImageImplementationDSA(GLint level, const Vector3i& offset, const Vector3i& size, CompressedColorFormat format, const GLvoid* data, GLsizei dataSize);
+        void MAGNUM_LOCAL compressedSubImageImplementationDSAEXT(GLint level, const Vector3i& offset, const Vector3i& size, CompressedColorFormat format, const GLvoid* data, GLsizei dataSize);
+        #endif
+
         void MAGNUM_LOCAL invalidateImageImplementationNoOp(GLint level);
         #ifndef MAGNUM_TARGET_GLES
         void MAGNUM_LOCAL invalidateImageImplementationARB(GLint level);
@@ -522,8 +694,16 @@ class MAGNUM_EXPORT AbstractTexture: public AbstractObject {
         ColorFormat MAGNUM_LOCAL imageFormatForInternalFormat(TextureFormat internalFormat);
         ColorType MAGNUM_LOCAL imageTypeForInternalFormat(TextureFormat internalFormat);
 
+        void MAGNUM_LOCAL setStorageMemoryUsage(std::size_t size);
+        void MAGNUM_LOCAL setImageMemoryUsage(GLenum target, GLint level, std::size_t size);
+
         GLuint _id;
         bool _created; /* see createIfNotAlready() for details */
+        UnsignedInt _memoryLabel;
+        std::size_t _memoryUsage;
+        /* Usage of images specified with setImage(), indexed with
+           level*6 + cube map face */
+        std::vector<std::size_t> _imageMemoryUsage;
 };
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -547,6 +727,9 @@ template<> struct MAGNUM_EXPORT AbstractTexture::DataHelper<1> {
     static void setSubImage(AbstractTexture& texture, GLint level, const Math::Vector<1, GLint>& offset, const ImageReference1D& image);
     static void setSubImage(AbstractTexture& texture, GLint level, const Math::Vector<1, GLint>& offset, BufferImage1D& image);
 
+    static void setCompressedImage(AbstractTexture& texture, GLint level, const CompressedImageReference1D& image);
+    static void setCompressedSubImage(AbstractTexture& texture, GLint level, const Math::Vector<1, GLint>& offset, const CompressedImageReference1D& image);
+
     static void invalidateSubImage(AbstractTexture& texture, GLint level, const Math::Vector<1, GLint>& offset, const Math::Vector<1, GLint>& size);
 };
 #endif
@@ -590,7 +773,21 @@ template<> struct MAGNUM_EXPORT AbstractTexture::DataHelper<2> {
     static void setSubImage(AbstractTexture& texture, GLint level, const Vector2i& offset, BufferImage2D& image);
     #endif
 
+    static void setCompressedImage(AbstractTexture& texture, GLint level, const CompressedImageReference2D& image) {
+        setCompressedImage(texture, texture._target, level, image);
+    }
+    static void setCompressedImage(AbstractTexture& texture, GLenum target, GLint level, const CompressedImageReference2D& image);
+    static void setCompressedSubImage(AbstractTexture& texture, GLint level, const Vector2i& offset, const CompressedImageReference2D& image);
+
     static void invalidateSubImage(AbstractTexture& texture, GLint level, const Vector2i& offset, const Vector2i& size);
+
+    #ifndef MAGNUM_TARGET_GLES
+    static Vector2i sparsePageSize(GLenum target, TextureFormat format, Int index) {
+        return sparsePageSizeInternal(target, format, index).xy();
+    }
+
+    static void setPageCommitment(AbstractTexture& texture, GLint level, const Range2Di& range, bool commit);
+    #endif
 };
 template<> struct MAGNUM_EXPORT AbstractTexture::DataHelper<3> {
     #ifdef MAGNUM_BUILD_DEPRECATED
@@ -629,11 +826,22 @@ template<> struct MAGNUM_EXPORT AbstractTexture::DataHelper<3> {
     static void setSubImage(AbstractTexture& texture, GLint level, const Vector3i& offset, BufferImage3D& image);
     #endif
 
+    static void setCompressedImage(AbstractTexture& texture, GLint level, const CompressedImageReference3D& image);
+    static void setCompressedSubImage(AbstractTexture& texture, GLint level, const Vector3i& offset, const CompressedImageReference3D& image);
+
     static void invalidateSubImage(AbstractTexture& texture, GLint level, const Vector3i& offset, const Vector3i& size);
+
+    #ifndef MAGNUM_TARGET_GLES
+    static Vector3i sparsePageSize(GLenum target, TextureFormat format, Int index) {
+        return sparsePageSizeInternal(target, format, index);
+    }
+
+    static void setPageCommitment(AbstractTexture& texture, GLint level, const Range3Di& range, bool commit);
+    #endif
 };
 #endif
 
-inline AbstractTexture::AbstractTexture(AbstractTexture&& other) noexcept: _target{other._target}, _id{other._id}, _created{other._created} {
+inline AbstractTexture::AbstractTexture(AbstractTexture&& other) noexcept: _target{other._target}, _id{other._id}, _created{other._created}, _memoryLabel{other._memoryLabel}, _memoryUsage{other._memoryUsage}, _imageMemoryUsage{std::move(other._imageMemoryUsage)} {
     other._id = 0;
 }
 
@@ -642,6 +850,9 @@ inline AbstractTexture& AbstractTexture::operator=(AbstractTexture&& other) noex
     swap(_target, other._target);
     swap(_id, other._id);
     swap(_created, other._created);
+    swap(_memoryLabel, other._memoryLabel);
+    swap(_memoryUsage, other._memoryUsage);
+    swap(_imageMemoryUsage, other._imageMemoryUsage);
     return *this;
 }
 
@@ -0,0 +1,112 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AllocationTracker.h"
+
+#ifdef MAGNUM_BUILD_ALLOCATION_TRACKING
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#endif
+
+namespace Magnum {
+
+namespace {
+    constexpr const char* SubsystemNames[]{
+        "Other",
+        "SceneGraph",
+        "Shapes",
+        "Text",
+        "DebugTools"
+    };
+
+    static_assert(sizeof(SubsystemNames)/sizeof(*SubsystemNames) == AllocationTracker::SubsystemCount, "wrong subsystem name count");
+}
+
+#ifdef MAGNUM_BUILD_ALLOCATION_TRACKING
+namespace {
+    /* Constant-initialized, so the counters are usable even for allocations
+       done during static initialization */
+    std::atomic<UnsignedLong> counts[AllocationTracker::SubsystemCount]{};
+
+    /* Without thread-local storage the current subsystem is shared by all
+       threads, atomic so concurrent scopes are at least not a data race */
+    #ifndef MAGNUM_BUILD_MULTITHREADED
+    std::atomic<AllocationTracker::Subsystem> currentSubsystem{AllocationTracker::Subsystem::Other};
+    #else
+    thread_local AllocationTracker::Subsystem currentSubsystem = AllocationTracker::Subsystem::Other;
+    #endif
+
+    inline std::atomic<UnsignedLong>& currentCounter() {
+        return counts[UnsignedInt(AllocationTracker::Subsystem(currentSubsystem))];
+    }
+}
+#endif
+
+const char* AllocationTracker::name(const Subsystem subsystem) {
+    return SubsystemNames[UnsignedInt(subsystem)];
+}
+
+UnsignedLong AllocationTracker::count(const Subsystem subsystem) {
+    #ifdef MAGNUM_BUILD_ALLOCATION_TRACKING
+    return counts[UnsignedInt(subsystem)].load(std::memory_order_relaxed);
+    #else
+    static_cast<void>(subsystem);
+    return 0;
+    #endif
+}
+
+#ifdef MAGNUM_BUILD_ALLOCATION_TRACKING
+AllocationTracker::Scope::Scope(const Subsystem subsystem): _previous{currentSubsystem} {
+    currentSubsystem = subsystem;
+}
+
+AllocationTracker::Scope::~Scope() {
+    currentSubsystem = _previous;
+}
+#endif
+
+}
+
+#ifdef MAGNUM_BUILD_ALLOCATION_TRACKING
+void* operator new(const std::size_t size) {
+    Magnum::currentCounter().fetch_add(1, std::memory_order_relaxed);
+    if(void* const memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc{};
+}
+
+void* operator new(const std::size_t size, const std::nothrow_t&) noexcept {
+    Magnum::currentCounter().fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+void operator delete(void* const memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* const memory, const std::nothrow_t&) noexcept {
+    std::free(memory);
+}
+#endif
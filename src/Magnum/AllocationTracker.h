@@ -0,0 +1,179 @@
+#ifndef Magnum_AllocationTracker_h
+#define Magnum_AllocationTracker_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::AllocationTracker, macro @ref MAGNUM_ALLOCATION_SCOPE()
+ */
+
+#include "Magnum/Types.h"
+#include "Magnum/visibility.h"
+#include "Magnum/configure.h"
+
+namespace Magnum {
+
+/**
+@brief Heap allocation tracker
+
+Counts heap allocations done through `operator new` and attributes them to
+engine subsystems, so it's possible to find out which calls allocate in
+steady state. Hot paths of the engine (e.g. transformation computation in
+@ref SceneGraph, drawing in @ref SceneGraph::AbstractCamera, collision
+detection in @ref Shapes::ShapeGroup or text layouting in @ref Text) mark
+themselves with @ref MAGNUM_ALLOCATION_SCOPE() and all allocations done
+inside them are attributed to given subsystem, allocations done elsewhere are
+counted as @ref Subsystem::Other. The scopes can be nested, the innermost one
+wins. Each thread has its own current scope, the counters are shared. If
+Magnum is built without `BUILD_MULTITHREADED`, there is no thread-local
+storage and the current scope is shared by all threads as well, so
+allocations done concurrently on other threads may be misattributed.
+
+The tracking is available only if Magnum is built with
+`BUILD_ALLOCATION_TRACKING` enabled (see @ref building-features), as it
+replaces global `operator new` and `operator delete` for the whole
+application. Otherwise @ref isAvailable() returns `false`, all counts are
+zero and @ref MAGNUM_ALLOCATION_SCOPE() expands to nothing, so it has no
+overhead. Note that on Windows the replaced operators affect only
+allocations done by the Magnum library itself if it's built as DLL.
+
+The counters are most conveniently viewed per frame using
+@ref DebugTools::Profiler, which prints average allocation count per frame
+for each subsystem along with the timing statistics. The counters can be also
+queried directly:
+@code
+UnsignedLong before = AllocationTracker::count(AllocationTracker::Subsystem::SceneGraph);
+camera.draw(drawables);
+Debug() << "Allocations:" << AllocationTracker::count(AllocationTracker::Subsystem::SceneGraph) - before;
+@endcode
+*/
+class MAGNUM_EXPORT AllocationTracker {
+    public:
+        /**
+         * @brief Subsystem
+         *
+         * @see @ref count(), @ref MAGNUM_ALLOCATION_SCOPE()
+         */
+        enum class Subsystem: UnsignedByte {
+            Other = 0,      /**< Everything outside of any tracked scope */
+            SceneGraph,     /**< @ref SceneGraph library */
+            Shapes,         /**< @ref Shapes library */
+            Text,           /**< @ref Text library */
+            DebugTools      /**< @ref DebugTools library */
+        };
+
+        /** @brief Count of subsystems */
+        enum: std::size_t { SubsystemCount = std::size_t(Subsystem::DebugTools) + 1 };
+
+        class Scope;
+
+        /**
+         * @brief Whether the allocation tracking is available
+         *
+         * Returns `true` if Magnum is built with `BUILD_ALLOCATION_TRACKING`.
+         */
+        constexpr static bool isAvailable() {
+            #ifdef MAGNUM_BUILD_ALLOCATION_TRACKING
+            return true;
+            #else
+            return false;
+            #endif
+        }
+
+        /**
+         * @brief Subsystem name
+         *
+         * Used by @ref DebugTools::Profiler::printStatistics().
+         */
+        static const char* name(Subsystem subsystem);
+
+        /**
+         * @brief Allocation count
+         *
+         * Total count of allocations attributed to given subsystem since the
+         * start of the application. Always `0` if the tracking is not
+         * available.
+         */
+        static UnsignedLong count(Subsystem subsystem);
+
+        AllocationTracker() = delete;
+};
+
+/**
+@brief Allocation tracking scope
+
+Attributes all allocations done in current thread during its lifetime to
+given subsystem, the previous subsystem is restored on destruction. Use
+@ref MAGNUM_ALLOCATION_SCOPE() instead of instantiating it directly, so the
+scope is compiled out if the tracking is not available.
+*/
+class MAGNUM_EXPORT AllocationTracker::Scope {
+    public:
+        #ifdef MAGNUM_BUILD_ALLOCATION_TRACKING
+        /** @brief Constructor */
+        explicit Scope(Subsystem subsystem);
+
+        /** @brief Destructor */
+        ~Scope();
+        #else
+        explicit Scope(Subsystem) {}
+        #endif
+
+        /** @brief Copying is not allowed */
+        Scope(const Scope&) = delete;
+
+        /** @brief Copying is not allowed */
+        Scope& operator=(const Scope&) = delete;
+
+    #ifdef MAGNUM_BUILD_ALLOCATION_TRACKING
+    private:
+        Subsystem _previous;
+    #endif
+};
+
+/** @hideinitializer
+@brief Attribute allocations in current scope to given subsystem
+
+Expands to an @ref AllocationTracker::Scope for given
+@ref AllocationTracker::Subsystem value if Magnum is built with
+`BUILD_ALLOCATION_TRACKING`, otherwise expands to nothing. Usage:
+@code
+void MyDrawable::draw(const Matrix4& transformationMatrix, SceneGraph::AbstractCamera3D& camera) {
+    MAGNUM_ALLOCATION_SCOPE(SceneGraph);
+
+    // ...
+}
+@endcode
+*/
+#ifdef MAGNUM_BUILD_ALLOCATION_TRACKING
+#define MAGNUM_ALLOCATION_SCOPE(subsystem)                                  \
+    Magnum::AllocationTracker::Scope _magnumAllocationScope{Magnum::AllocationTracker::Subsystem::subsystem}
+#else
+#define MAGNUM_ALLOCATION_SCOPE(subsystem) do {} while(false)
+#endif
+
+}
+
+#endif
@@ -29,18 +29,37 @@
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Directory.h>
 
+#if defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#define MAGNUM_AUDIO_USE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 namespace Magnum { namespace Audio {
 
+struct AbstractImporter::MappedFile {
+    #ifdef MAGNUM_AUDIO_USE_MMAP
+    ~MappedFile() { if(mapped) munmap(mapped, size); }
+
+    void* mapped{};
+    std::size_t size{};
+    #endif
+};
+
 AbstractImporter::AbstractImporter() = default;
 
 AbstractImporter::AbstractImporter(PluginManager::AbstractManager& manager, std::string plugin): PluginManager::AbstractPlugin(manager, std::move(plugin)) {}
 
+AbstractImporter::~AbstractImporter() = default;
+
 bool AbstractImporter::openData(Containers::ArrayReference<const char> data) {
     CORRADE_ASSERT(features() & Feature::OpenData,
         "Audio::AbstractImporter::openData(): feature not supported", nullptr);
 
     close();
-    doOpenData(data);
+    doOpenData(data, {});
     return isOpened();
 }
 
@@ -48,22 +67,60 @@ void AbstractImporter::doOpenData(Containers::ArrayReference<const char>) {
     CORRADE_ASSERT(false, "Audio::AbstractImporter::openData(): feature advertised but not implemented", );
 }
 
+void AbstractImporter::doOpenData(const Containers::ArrayReference<const char> data, DataFlags) {
+    doOpenData(data);
+}
+
 bool AbstractImporter::openFile(const std::string& filename) {
     close();
     doOpenFile(filename);
+
+    /* The mapping is not needed if the opening failed */
+    if(!isOpened()) _mappedFile = nullptr;
     return isOpened();
 }
 
 void AbstractImporter::doOpenFile(const std::string& filename) {
     CORRADE_ASSERT(features() & Feature::OpenData, "Audio::AbstractImporter::openFile(): not implemented", );
 
+    #ifdef MAGNUM_AUDIO_USE_MMAP
+    /* Map the file to memory, the pages are loaded on demand and the plugin
+       can reference them until the file is closed */
+    const int fd = ::open(filename.data(), O_RDONLY);
+    struct stat st;
+    if(fd == -1 || fstat(fd, &st) == -1) {
+        if(fd != -1) ::close(fd);
+        Error() << "Audio::AbstractImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+
+    std::unique_ptr<MappedFile> file{new MappedFile};
+    if(st.st_size) {
+        void* const mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapped == MAP_FAILED) {
+            ::close(fd);
+            Error() << "Audio::AbstractImporter::openFile(): cannot open file" << filename;
+            return;
+        }
+        file->mapped = mapped;
+        file->size = st.st_size;
+    }
+    ::close(fd);
+
+    /* Keep the mapping alive before calling the plugin so it's released
+       only after doClose() */
+    const Containers::ArrayReference<const char> data{static_cast<const char*>(file->mapped), file->size};
+    _mappedFile = std::move(file);
+    doOpenData(data, DataFlag::Persistent);
+    #else
     /* Open file */
     if(!Utility::Directory::fileExists(filename)) {
-        Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
+        Error() << "Audio::AbstractImporter::openFile(): cannot open file" << filename;
         return;
     }
 
-    doOpenData(Utility::Directory::read(filename));
+    doOpenData(Utility::Directory::read(filename), {});
+    #endif
 }
 
 void AbstractImporter::close() {
@@ -71,6 +128,9 @@ void AbstractImporter::close() {
         doClose();
         CORRADE_INTERNAL_ASSERT(!isOpened());
     }
+
+    _dataCopy = nullptr;
+    _mappedFile = nullptr;
 }
 
 Buffer::Format AbstractImporter::format() const {
@@ -88,4 +148,65 @@ Containers::Array<char> AbstractImporter::data() {
     return doData();
 }
 
+Containers::ArrayReference<const char> AbstractImporter::dataView() {
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::dataView(): no file opened", nullptr);
+    return doDataView();
+}
+
+Containers::ArrayReference<const char> AbstractImporter::doDataView() {
+    if(!_dataCopy) _dataCopy = doData();
+    return _dataCopy;
+}
+
+std::size_t AbstractImporter::frameSize() const {
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::frameSize(): no file opened", {});
+    switch(doFormat()) {
+        case Buffer::Format::Mono8: return 1;
+        case Buffer::Format::Mono16:
+        case Buffer::Format::Stereo8: return 2;
+        case Buffer::Format::Stereo16: return 4;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+std::size_t AbstractImporter::frameCount() const {
+    CORRADE_ASSERT(features() & Feature::Streaming,
+        "Audio::AbstractImporter::frameCount(): feature not supported", {});
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::frameCount(): no file opened", {});
+    return doFrameCount();
+}
+
+std::size_t AbstractImporter::doFrameCount() const {
+    CORRADE_ASSERT(false, "Audio::AbstractImporter::frameCount(): feature advertised but not implemented", {});
+}
+
+std::size_t AbstractImporter::read(Containers::ArrayReference<char> data) {
+    CORRADE_ASSERT(features() & Feature::Streaming,
+        "Audio::AbstractImporter::read(): feature not supported", {});
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::read(): no file opened", {});
+
+    /* Pass only whole frames to the implementation */
+    const std::size_t size = data.size()/frameSize()*frameSize();
+    if(!size) return 0;
+    return doRead({data.begin(), size});
+}
+
+std::size_t AbstractImporter::doRead(Containers::ArrayReference<char>) {
+    CORRADE_ASSERT(false, "Audio::AbstractImporter::read(): feature advertised but not implemented", {});
+}
+
+void AbstractImporter::seek(const std::size_t frame) {
+    CORRADE_ASSERT(features() & Feature::Streaming,
+        "Audio::AbstractImporter::seek(): feature not supported", );
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::seek(): no file opened", );
+    CORRADE_ASSERT(frame <= doFrameCount(),
+        "Audio::AbstractImporter::seek(): frame" << frame << "out of range for" << doFrameCount() << "frames", );
+    doSeek(frame);
+}
+
+void AbstractImporter::doSeek(std::size_t) {
+    CORRADE_ASSERT(false, "Audio::AbstractImporter::seek(): feature advertised but not implemented", );
+}
+
 }}
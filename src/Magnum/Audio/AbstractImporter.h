@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Audio::AbstractImporter
  */
 
+#include <memory>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/PluginManager/AbstractPlugin.h>
 
 #include "Magnum/Magnum.h"
@@ -48,6 +50,9 @@ importer plugins.
 Plugin implements function @ref doFeatures(), @ref doIsOpened(), one of or both
 @ref doOpenData() and @ref doOpenFile() functions, function @ref doClose() and
 data access functions @ref doFormat(), @ref doFrequency() and @ref doData().
+If @ref Feature::Streaming is supported, it implements also @ref doFrameCount(),
+@ref doRead() and @ref doSeek(). Plugins that keep the sample data in memory
+can implement also @ref doDataView() to avoid copying them.
 
 You don't need to do most of the redundant sanity checks, these things are
 checked by the implementation:
@@ -57,13 +62,19 @@ checked by the implementation:
     is any file opened.
 -   Function @ref doOpenData() is called only if @ref Feature::OpenData is
     supported.
+-   Memory passed to @ref doOpenData() with @ref DataFlag::Persistent is
+    kept valid until @ref doClose() is called, unless the opening fails.
+-   Functions @ref doFrameCount(), @ref doRead() and @ref doSeek() are called
+    only if @ref Feature::Streaming is supported.
+-   Function @ref doSeek() is called only with frame not larger than
+    @ref frameCount().
 -   All `do*()` implementations working on opened file are called only if
     there is any file opened.
 
-Plugin interface string is `"cz.mosra.magnum.Audio.AbstractImporter/0.1"`.
+Plugin interface string is `"cz.mosra.magnum.Audio.AbstractImporter/0.2.2"`.
 */
 class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractPlugin {
-    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Audio.AbstractImporter/0.1")
+    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Audio.AbstractImporter/0.2.2")
 
     public:
         /**
@@ -73,7 +84,14 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractPlugin
          */
         enum class Feature: UnsignedByte {
             /** Opening files from raw data using @ref openData() */
-            OpenData = 1 << 0
+            OpenData = 1 << 0,
+
+            /**
+             * Reading sample data in chunks using @ref read() and
+             * @ref seek(), without keeping the whole decoded file in
+             * memory. See @ref StreamingSource.
+             */
+            Streaming = 1 << 1
         };
 
         /**
@@ -83,12 +101,35 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractPlugin
          */
         typedef Containers::EnumSet<Feature> Features;
 
+        /**
+         * @brief Data flag
+         *
+         * @see @ref DataFlags, @ref doOpenData()
+         */
+        enum class DataFlag: UnsignedByte {
+            /**
+             * The data are guaranteed to stay valid and unchanged until
+             * @ref doClose() is called, so the implementation can reference
+             * them directly instead of making a copy.
+             */
+            Persistent = 1 << 0
+        };
+
+        /**
+         * @brief Data flags
+         *
+         * @see @ref doOpenData()
+         */
+        typedef Containers::EnumSet<DataFlag> DataFlags;
+
         /** @brief Default constructor */
         explicit AbstractImporter();
 
         /** @brief Plugin manager constructor */
         explicit AbstractImporter(PluginManager::AbstractManager& manager, std::string plugin);
 
+        ~AbstractImporter();
+
         /** @brief Features supported by this importer */
         Features features() const { return doFeatures(); }
 
@@ -109,7 +150,10 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractPlugin
          * @brief Open file
          *
          * Closes previous file, if it was opened, and tries to open given
-         * file. Returns `true` on success, `false` otherwise.
+         * file. Returns `true` on success, `false` otherwise. If the plugin
+         * doesn't implement file opening on its own, the file is
+         * memory-mapped on platforms that support it and the mapping is kept
+         * until the file is closed.
          * @see @ref features(), @ref openData()
          */
         bool openFile(const std::string& filename);
@@ -125,9 +169,62 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractPlugin
         /** @brief Sample frequency */
         UnsignedInt frequency() const;
 
-        /** @brief Sample data */
+        /**
+         * @brief Sample data
+         *
+         * Returns a copy of the data.
+         * @see @ref dataView()
+         */
         Containers::Array<char> data();
 
+        /**
+         * @brief Sample data view
+         *
+         * Unlike @ref data() doesn't copy the data if the plugin keeps them
+         * in memory, e.g. in a memory-mapped file, so they can be passed to
+         * @ref Buffer::setData() directly. Otherwise the data are
+         * retrieved using @ref data() and kept in the importer. The view is
+         * valid until the file is closed.
+         */
+        Containers::ArrayReference<const char> dataView();
+
+        /**
+         * @brief Frame size
+         *
+         * Size of one sample for all channels in bytes, calculated from
+         * @ref format().
+         */
+        std::size_t frameSize() const;
+
+        /**
+         * @brief Frame count
+         *
+         * Available only if @ref Feature::Streaming is supported.
+         */
+        std::size_t frameCount() const;
+
+        /**
+         * @brief Read next frames of sample data
+         * @param data      Where to put the data
+         * @return Count of frames read, `0` at the end of the data
+         *
+         * Reads at most `data.size()/frameSize()` frames of sample data
+         * following the previously read ones. Available only if
+         * @ref Feature::Streaming is supported.
+         * @see @ref seek()
+         */
+        std::size_t read(Containers::ArrayReference<char> data);
+
+        /**
+         * @brief Seek to given frame
+         *
+         * Next call to @ref read() will return the data starting at
+         * @p frame. Expects that @p frame is not larger than
+         * @ref frameCount(). Available only if @ref Feature::Streaming is
+         * supported.
+         */
+        void seek(std::size_t frame);
+
         /*@}*/
 
     #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -144,14 +241,37 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractPlugin
         /** @brief Implementation for @ref openData() */
         virtual void doOpenData(Containers::ArrayReference<const char> data);
 
+        /**
+         * @brief Implementation for @ref openData() and @ref openFile()
+         *
+         * Data passed from @ref openData() have no flags set, data passed
+         * from the default implementation of @ref doOpenFile() may have
+         * @ref DataFlag::Persistent set. Default implementation calls
+         * @ref doOpenData(Containers::ArrayReference<const char>), which
+         * should copy the data if it needs them after it returns. Override
+         * this function instead if the plugin can make use of the flags.
+         */
+        virtual void doOpenData(Containers::ArrayReference<const char> data, DataFlags flags);
+
+    protected:
         /**
          * @brief Implementation for @ref openFile()
          *
          * If @ref Feature::OpenData is supported, default implementation opens
-         * the file and calls @ref doOpenData() with its contents.
+         * the file and calls @ref doOpenData(Containers::ArrayReference<const char>, DataFlags)
+         * with its contents. On Unix (except Emscripten) the file is
+         * memory-mapped instead of read, the mapping is passed with
+         * @ref DataFlag::Persistent and released after @ref doClose(). On
+         * other platforms the contents are read into a temporary array and
+         * passed without any flags. It is allowed to call this function from
+         * your @ref doOpenFile() implementation.
          */
         virtual void doOpenFile(const std::string& filename);
 
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    private:
+    #endif
+
         /** @brief Implementation for @ref close() */
         virtual void doClose() = 0;
 
@@ -163,8 +283,38 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractPlugin
 
         /** @brief Implementation for @ref data() */
         virtual Containers::Array<char> doData() = 0;
+
+        /**
+         * @brief Implementation for @ref dataView()
+         *
+         * Default implementation calls @ref doData() and keeps the result
+         * until the file is closed.
+         */
+        virtual Containers::ArrayReference<const char> doDataView();
+
+        /** @brief Implementation for @ref frameCount() */
+        virtual std::size_t doFrameCount() const;
+
+        /**
+         * @brief Implementation for @ref read()
+         *
+         * The @p data size is always a multiple of @ref frameSize().
+         */
+        virtual std::size_t doRead(Containers::ArrayReference<char> data);
+
+        /** @brief Implementation for @ref seek() */
+        virtual void doSeek(std::size_t frame);
+
+    private:
+        struct MappedFile;
+
+        std::unique_ptr<MappedFile> _mappedFile;
+        Containers::Array<char> _dataCopy;
 };
 
+CORRADE_ENUMSET_OPERATORS(AbstractImporter::Features)
+CORRADE_ENUMSET_OPERATORS(AbstractImporter::DataFlags)
+
 }}
 
 #endif
@@ -29,13 +29,33 @@
  * @brief Forward declarations for @ref Magnum::Audio namespace
  */
 
+#include "Magnum/Types.h"
+
 namespace Magnum { namespace Audio {
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
 class AbstractImporter;
 class Buffer;
 class Context;
+
+template<UnsignedInt> class Listener;
+typedef Listener<2> Listener2D;
+typedef Listener<3> Listener3D;
+
+class Mixer;
+
+template<UnsignedInt> class Playable;
+typedef Playable<2> Playable2D;
+typedef Playable<3> Playable3D;
+
+template<UnsignedInt> class PlayableGroup;
+typedef PlayableGroup<2> PlayableGroup2D;
+typedef PlayableGroup<3> PlayableGroup3D;
+
+class PooledSource;
 class Source;
+class SourcePool;
+class StreamingSource;
 /* Renderer used only statically */
 #endif
 
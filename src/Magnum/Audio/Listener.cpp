@@ -0,0 +1,83 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Listener.h"
+
+#include <alc.h>
+
+#include "Magnum/Audio/PlayableGroup.h"
+#include "Magnum/Audio/Renderer.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace Audio {
+
+namespace {
+    void setListener(const Matrix3& transformationMatrix) {
+        Renderer::setListenerPosition(Vector3{transformationMatrix.translation(), 0.0f});
+        Renderer::setListenerOrientation(Vector3::zAxis(-1.0f), Vector3{transformationMatrix.up().normalized(), 0.0f});
+    }
+
+    void setListener(const Matrix4& transformationMatrix) {
+        Renderer::setListenerPosition(transformationMatrix.translation());
+        Renderer::setListenerOrientation(-transformationMatrix.backward().normalized(), transformationMatrix.up().normalized());
+    }
+}
+
+template<UnsignedInt dimensions> Listener<dimensions>::Listener(SceneGraph::AbstractObject<dimensions, Float>& object): SceneGraph::AbstractFeature<dimensions, Float>(object) {
+    SceneGraph::AbstractFeature<dimensions, Float>::setCachedTransformations(SceneGraph::CachedTransformation::Absolute);
+}
+
+template<UnsignedInt dimensions> void Listener<dimensions>::update(std::initializer_list<std::reference_wrapper<PlayableGroup<dimensions>>> groups) {
+    updateInternal(groups);
+}
+
+template<UnsignedInt dimensions> void Listener<dimensions>::update(const std::vector<std::reference_wrapper<PlayableGroup<dimensions>>>& groups) {
+    updateInternal(groups);
+}
+
+template<UnsignedInt dimensions> template<class T> void Listener<dimensions>::updateInternal(const T& groups) {
+    /* Listener object and all changed playables, cleaned at once so common
+       parents have their transformation computed only once */
+    std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>> objects{this->object()};
+    for(PlayableGroup<dimensions>& group: groups) group.collect(objects);
+
+    /* Apply all changes in the context at once */
+    ALCcontext* const context = alcGetCurrentContext();
+    alcSuspendContext(context);
+    SceneGraph::AbstractObject<dimensions, Float>::setClean(objects);
+    alcProcessContext(context);
+}
+
+template<UnsignedInt dimensions> void Listener<dimensions>::clean(const MatrixTypeFor<dimensions, Float>& absoluteTransformationMatrix) {
+    setListener(absoluteTransformationMatrix);
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template class MAGNUM_AUDIO_EXPORT Listener<2>;
+template class MAGNUM_AUDIO_EXPORT Listener<3>;
+#endif
+
+}}
@@ -0,0 +1,89 @@
+#ifndef Magnum_Audio_Listener_h
+#define Magnum_Audio_Listener_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::Listener, typedef @ref Magnum::Audio::Listener2D, @ref Magnum::Audio::Listener3D
+ */
+
+#include <initializer_list>
+#include <vector>
+
+#include "Magnum/Audio/Audio.h"
+#include "Magnum/Audio/visibility.h"
+#include "Magnum/SceneGraph/AbstractFeature.h"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Listener
+
+Feature making the object an audio listener. Listener position and
+orientation in @ref Renderer follow cached absolute transformation of the
+object, the listener looks in direction of negative Z axis of the object, for
+two-dimensional scenes the object is in the XY plane and looks in direction
+of negative Z. See @ref Playable for an usage example.
+
+There is only one listener in the OpenAL context, so it makes sense to have
+only one instance of this feature.
+@see @ref Listener2D, @ref Listener3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_AUDIO_EXPORT Listener: public SceneGraph::AbstractFeature<dimensions, Float> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object holding this feature
+         */
+        explicit Listener(SceneGraph::AbstractObject<dimensions, Float>& object);
+
+        /**
+         * @brief Update listener and playables
+         *
+         * Cleans the listener object and objects of all changed playables in
+         * given groups in one batch. Only changed positions and orientation
+         * are passed to OpenAL. Call it once every frame.
+         * @see @ref PlayableGroup::setClean()
+         */
+        void update(std::initializer_list<std::reference_wrapper<PlayableGroup<dimensions>>> groups);
+        void update(const std::vector<std::reference_wrapper<PlayableGroup<dimensions>>>& groups); /**< @overload */
+
+    protected:
+        /** Updates listener position and orientation */
+        void clean(const MatrixTypeFor<dimensions, Float>& absoluteTransformationMatrix) override;
+
+    private:
+        template<class T> void updateInternal(const T& groups);
+};
+
+/** @brief Listener for two-dimensional scenes */
+typedef Listener<2> Listener2D;
+
+/** @brief Listener for three-dimensional scenes */
+typedef Listener<3> Listener3D;
+
+}}
+
+#endif
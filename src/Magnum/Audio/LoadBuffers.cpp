@@ -0,0 +1,93 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "LoadBuffers.h"
+
+#include <memory>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/TaskScheduler.h"
+
+namespace Magnum { namespace Audio {
+
+namespace {
+
+struct Prepared {
+    std::unique_ptr<AbstractImporter> importer;
+    Containers::ArrayReference<const char> data;
+    Buffer::Format format;
+    UnsignedInt frequency;
+    bool opened;
+};
+
+void prepare(Prepared& prepared, const std::string& filename) {
+    if(!(prepared.opened = prepared.importer->openFile(filename))) return;
+
+    prepared.format = prepared.importer->format();
+    prepared.frequency = prepared.importer->frequency();
+    prepared.data = prepared.importer->dataView();
+
+    /* Fault in all pages of a memory-mapped file */
+    const volatile char* const data = prepared.data.data();
+    for(std::size_t i = 0; i < prepared.data.size(); i += 4096)
+        static_cast<void>(data[i]);
+}
+
+}
+
+std::vector<std::optional<Buffer>> loadBuffers(PluginManager::Manager<AbstractImporter>& manager, const std::string& plugin, const std::vector<std::string>& filenames, UnsignedInt threadCount) {
+    /* Plugin instances can't be created concurrently, so create one for
+       each file upfront. Each of them keeps its file open until the upload. */
+    std::vector<Prepared> prepared(filenames.size());
+    for(Prepared& p: prepared) {
+        p.importer = manager.instance(plugin);
+        CORRADE_ASSERT(p.importer,
+            "Audio::loadBuffers(): cannot instantiate plugin" << plugin, {});
+    }
+
+    /* Each file is a separate part by default, so the scheduler can balance
+       files of different size */
+    const std::size_t grainSize = threadCount ? (filenames.size() + threadCount - 1)/threadCount : 1;
+    TaskScheduler::global().parallelFor(filenames.size(), grainSize, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            prepare(prepared[i], filenames[i]);
+    });
+
+    /* Upload everything from the calling thread, closing the files as soon
+       as they are not needed */
+    std::vector<std::optional<Buffer>> buffers(prepared.size());
+    for(std::size_t i = 0; i != prepared.size(); ++i) {
+        Prepared& p = prepared[i];
+        if(!p.opened) continue;
+
+        buffers[i].emplace();
+        buffers[i]->setData(p.format, Containers::ArrayReference<const void>{p.data.data(), p.data.size()}, p.frequency);
+        p.importer = nullptr;
+    }
+
+    return buffers;
+}
+
+}}
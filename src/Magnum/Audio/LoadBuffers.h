@@ -0,0 +1,75 @@
+#ifndef Magnum_Audio_LoadBuffers_h
+#define Magnum_Audio_LoadBuffers_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Audio::loadBuffers()
+ */
+
+#include <string>
+#include <vector>
+#include <Corrade/PluginManager/Manager.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+#include "Magnum/Audio/Buffer.h"
+#include "MagnumExternal/Optional/optional.hpp"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Load many files into buffers at once
+@param manager      Importer plugin manager
+@param plugin       Importer plugin name
+@param filenames    Files to load
+@param threadCount  Count of parts to split the files into. If `0`, each
+    file is a separate part.
+
+Opens the files in parallel on @ref TaskScheduler::global(), each with its
+own instance of @p plugin, and then uploads all of them to new buffers from
+the calling thread, which is expected to have an OpenAL context current. The
+sample data are taken using @ref AbstractImporter::dataView(), so with
+plugins that reference memory-mapped files (such as @ref WavImporter) there
+are no intermediate copies. The workers touch all pages of the data, so the
+upload doesn't need to wait for the disk. If a file cannot be opened, its
+buffer is `std::nullopt`.
+@code
+PluginManager::Manager<Audio::AbstractImporter> manager{MAGNUM_PLUGINS_AUDIOIMPORTER_DIR};
+manager.load("WavAudioImporter");
+
+std::vector<std::optional<Audio::Buffer>> buffers = Audio::loadBuffers(manager, "WavAudioImporter", {"step.wav", "jump.wav", "land.wav"});
+@endcode
+
+All files are kept open until the upload finishes, split very large batches
+into smaller ones to keep the memory usage bounded. Expects that @p plugin is
+loaded. The importers are used concurrently, so the plugin must not use any
+shared global state.
+@see @ref Trade::ImageBatchImporter
+*/
+MAGNUM_AUDIO_EXPORT std::vector<std::optional<Buffer>> loadBuffers(PluginManager::Manager<AbstractImporter>& manager, const std::string& plugin, const std::vector<std::string>& filenames, UnsignedInt threadCount = 0);
+
+}}
+
+#endif
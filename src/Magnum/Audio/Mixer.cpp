@@ -0,0 +1,270 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Mixer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Audio/SourcePool.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Implementation/Simd.h"
+
+#if defined(MAGNUM_MATH_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MAGNUM_AUDIO_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Magnum { namespace Audio {
+
+namespace Implementation {
+
+double mixerResample(Float* const out, const std::size_t frameCount, const Float* const samples, const std::size_t sampleCount, double position, const double step, const bool looping) {
+    std::size_t i = 0;
+    while(i != frameCount) {
+        /* Wrap around or zero-fill the rest after reaching the end */
+        if(position >= sampleCount) {
+            if(!looping || !sampleCount) {
+                std::fill(out + i, out + frameCount, 0.0f);
+                return std::max(position, double(sampleCount));
+            }
+
+            position = std::fmod(position, double(sampleCount));
+        }
+
+        #ifdef MAGNUM_AUDIO_SSE2
+        /* Four frames at once while both interpolated samples are in range.
+           The offsets are calculated relative to the first sample in single
+           precision, so the range is one sample shorter to be safe from
+           rounding. */
+        if(position + 2.0 < sampleCount) {
+            const std::size_t interior = std::min(frameCount - i, std::size_t((sampleCount - 2.0 - position)/step));
+            const __m128 offsets = _mm_setr_ps(0.0f, Float(step), Float(2.0*step), Float(3.0*step));
+            std::size_t j = 0;
+            for(; j + 4 <= interior; j += 4) {
+                const double p = position + j*step;
+                const std::size_t base = std::size_t(p);
+                const __m128 f = _mm_add_ps(_mm_set1_ps(Float(p - base)), offsets);
+                const __m128i integer = _mm_cvttps_epi32(f);
+                const __m128 fraction = _mm_sub_ps(f, _mm_cvtepi32_ps(integer));
+
+                alignas(16) Int index[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(index), integer);
+                const Float* const s = samples + base;
+                const __m128 a = _mm_setr_ps(s[index[0]], s[index[1]], s[index[2]], s[index[3]]);
+                const __m128 b = _mm_setr_ps(s[index[0] + 1], s[index[1] + 1], s[index[2] + 1], s[index[3] + 1]);
+                _mm_storeu_ps(out + i + j, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), fraction)));
+            }
+
+            i += j;
+            position += j*step;
+            if(i == frameCount) break;
+        }
+        #endif
+
+        /* The next sample after the last one is either the first one or
+           silence */
+        const std::size_t index = std::size_t(position);
+        const Float fraction = Float(position - index);
+        const Float a = samples[index];
+        const Float b = index + 1 < sampleCount ? samples[index + 1] : looping ? samples[0] : 0.0f;
+        out[i++] = a + (b - a)*fraction;
+        position += step;
+    }
+
+    return position;
+}
+
+void mixerAccumulate(Float* const out, const Float* const in, const std::size_t frameCount, const Float gainBegin, const Float gainEnd) {
+    const Float delta = (gainEnd - gainBegin)/frameCount;
+    std::size_t i = 0;
+
+    #ifdef MAGNUM_MATH_SSE
+    const __m128 offsets = _mm_setr_ps(0.0f, delta, 2.0f*delta, 3.0f*delta);
+    for(; i + 4 <= frameCount; i += 4) {
+        const __m128 gain = _mm_add_ps(_mm_set1_ps(gainBegin + i*delta), offsets);
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(_mm_loadu_ps(in + i), gain)));
+    }
+    #endif
+
+    for(; i != frameCount; ++i)
+        out[i] += in[i]*(gainBegin + i*delta);
+}
+
+void mixerConvert(Short* const out, const Float* const in, const std::size_t frameCount) {
+    std::size_t i = 0;
+
+    #ifdef MAGNUM_AUDIO_SSE2
+    const __m128 min = _mm_set1_ps(-1.0f);
+    const __m128 max = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(32767.0f);
+    for(; i + 8 <= frameCount; i += 8) {
+        const __m128 a = _mm_mul_ps(_mm_max_ps(_mm_min_ps(_mm_loadu_ps(in + i), max), min), scale);
+        const __m128 b = _mm_mul_ps(_mm_max_ps(_mm_min_ps(_mm_loadu_ps(in + i + 4), max), min), scale);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b)));
+    }
+    #endif
+
+    for(; i != frameCount; ++i)
+        out[i] = Short(std::lround(Math::clamp(in[i], -1.0f, 1.0f)*32767.0f));
+}
+
+}
+
+namespace {
+
+/* Buses are evenly spaced on a horizontal circle, the first one is in front
+   of default listener orientation */
+Vector3 busDirection(const std::size_t id, const std::size_t busCount) {
+    const Float angle = 2.0f*Constants::pi()*id/busCount;
+    return {std::sin(angle), 0.0f, -std::cos(angle)};
+}
+
+}
+
+Mixer::Mixer(const std::size_t busCount, const UnsignedInt frequency, const std::size_t bufferFrames, const std::size_t bufferCount): _frequency{frequency}, _bufferFrames{bufferFrames}, _bufferCount{bufferCount}, _mixedCount{0}, _buffers(busCount*bufferCount), _sources(busCount), _mixed{Containers::Array<Float>::zeroInitialized(busCount*bufferFrames)}, _resampled{bufferFrames}, _converted{bufferFrames} {
+    CORRADE_ASSERT(busCount && busCount <= MaxBusCount,
+        "Audio::Mixer: expected 1 to" << MaxBusCount << "buses but got" << busCount, );
+    CORRADE_ASSERT(bufferCount >= 2,
+        "Audio::Mixer: expected at least two buffers but got" << bufferCount, );
+
+    /* The attenuation is done in software */
+    for(Source& source: _sources) source.setRolloffFactor(0.0f);
+    if(busCount == 1) _sources[0].setRelative(true);
+
+    for(std::size_t i = 0; i != bufferCount; ++i) _free.push_back(bufferCount - i - 1);
+}
+
+Mixer::~Mixer() {
+    std::vector<std::reference_wrapper<Source>> sources{_sources.begin(), _sources.end()};
+    Source::stop(sources);
+}
+
+void Mixer::update(const Vector3& listenerPosition, const std::vector<PooledSource*>& sources) {
+    const std::size_t busCount = _sources.size();
+    if(busCount > 1) for(std::size_t i = 0; i != busCount; ++i)
+        _sources[i].setPosition(listenerPosition + busDirection(i, busCount));
+
+    /* Target bus gains of all sources. Sources mixed for the first time
+       continue from their last playback offset and fade in. */
+    _gains.assign(sources.size()*busCount, 0.0f);
+    for(std::size_t i = 0; i != sources.size(); ++i) {
+        PooledSource& source = *sources[i];
+        Float* const gains = _gains.data() + i*busCount;
+
+        /* Gain with distance attenuation */
+        const Float gain = source._audibility/source._priority;
+
+        const Vector3 direction = source._relative ? Vector3{} : source._position - listenerPosition;
+        if(busCount == 1) gains[0] = gain;
+        else if(direction.x() == 0.0f && direction.z() == 0.0f)
+            std::fill_n(gains, busCount, gain/std::sqrt(Float(busCount)));
+        else {
+            /* Constant-power panning between the two nearest buses */
+            Float angle = std::atan2(direction.x(), -direction.z());
+            if(angle < 0.0f) angle += 2.0f*Constants::pi();
+            const Float sector = angle*busCount/(2.0f*Constants::pi());
+            const std::size_t id = std::size_t(sector)%busCount;
+            const Float t = (sector - std::floor(sector))*Constants::pi()*0.5f;
+            gains[id] = gain*std::cos(t);
+            gains[(id + 1)%busCount] = gain*std::sin(t);
+        }
+
+        if(!source._mixed) {
+            std::fill_n(source._mixGains, std::size_t(MaxBusCount), 0.0f);
+            source._mixPosition = source._offset;
+            source._mixed = true;
+        }
+    }
+    _mixedCount = sources.size();
+
+    /* Unqueue the processed buffers from all buses */
+    Int processed = _sources[0].processedBufferCount();
+    for(std::size_t i = 1; i != busCount; ++i)
+        processed = Math::min(processed, _sources[i].processedBufferCount());
+    for(; processed > 0 && !_queued.empty(); --processed) {
+        for(std::size_t i = 0; i != busCount; ++i)
+            _sources[i].unqueueBuffers({_buffers[i*_bufferCount + _queued.front()]});
+        _free.push_back(_queued.front());
+        _queued.pop_front();
+    }
+
+    /* Mix next data into them and queue them back */
+    while(!_free.empty()) {
+        const std::size_t slot = _free.back();
+        mix(slot, sources);
+        for(std::size_t i = 0; i != busCount; ++i)
+            _sources[i].queueBuffers({_buffers[i*_bufferCount + slot]});
+        _queued.push_back(slot);
+        _free.pop_back();
+    }
+
+    /* Start the buses for the first time or resume them if the queue ran
+       dry. Restart all of them to keep them in sync. */
+    for(Source& source: _sources) {
+        if(source.state() == Source::State::Playing) continue;
+
+        std::vector<std::reference_wrapper<Source>> all{_sources.begin(), _sources.end()};
+        Source::play(all);
+        break;
+    }
+}
+
+void Mixer::mix(const std::size_t slot, const std::vector<PooledSource*>& sources) {
+    const std::size_t busCount = _sources.size();
+    std::fill_n(_mixed.data(), _mixed.size(), 0.0f);
+
+    for(std::size_t i = 0; i != sources.size(); ++i) {
+        PooledSource& source = *sources[i];
+
+        /* Non-looping sources may finish in a previous buffer */
+        if(source._state != Source::State::Playing) continue;
+
+        const double step = double(source._pitch)*source._samplesFrequency/_frequency;
+        source._mixPosition = Implementation::mixerResample(_resampled.data(), _bufferFrames, source._samples.data(), source._samples.size(), source._mixPosition, step, source._looping);
+
+        const Float* const gains = _gains.data() + i*busCount;
+        for(std::size_t j = 0; j != busCount; ++j) {
+            if(gains[j] != 0.0f || source._mixGains[j] != 0.0f)
+                Implementation::mixerAccumulate(_mixed.data() + j*_bufferFrames, _resampled.data(), _bufferFrames, source._mixGains[j], gains[j]);
+            source._mixGains[j] = gains[j];
+        }
+
+        if(!source._looping && source._mixPosition >= source._samples.size()) {
+            source._state = Source::State::Stopped;
+            source._offset = 0;
+            source._mixed = false;
+        } else source._offset = Int(source._mixPosition);
+    }
+
+    for(std::size_t i = 0; i != busCount; ++i) {
+        Implementation::mixerConvert(_converted.data(), _mixed.data() + i*_bufferFrames, _bufferFrames);
+        _buffers[i*_bufferCount + slot].setData(Buffer::Format::Mono16, Containers::ArrayReference<const void>{_converted.data(), _bufferFrames*sizeof(Short)}, _frequency);
+    }
+}
+
+}}
@@ -0,0 +1,182 @@
+#ifndef Magnum_Audio_Mixer_h
+#define Magnum_Audio_Mixer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::Mixer
+ */
+
+#include <deque>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/Source.h"
+
+namespace Magnum { namespace Audio {
+
+namespace Implementation {
+    /* Resamples mono samples starting at given position into the output
+       using linear interpolation and returns the position after the last
+       output frame. If not looping and the end is reached, the rest of the
+       output is zero-filled and the returned position is not less than the
+       sample count. */
+    MAGNUM_AUDIO_EXPORT double mixerResample(Float* out, std::size_t frameCount, const Float* samples, std::size_t sampleCount, double position, double step, bool looping);
+
+    /* Adds the input multiplied by a gain linearly going from gainBegin to
+       gainEnd over the frames */
+    MAGNUM_AUDIO_EXPORT void mixerAccumulate(Float* out, const Float* in, std::size_t frameCount, Float gainBegin, Float gainEnd);
+
+    /* Converts the samples to 16-bit, clamping them to [-1, 1] */
+    MAGNUM_AUDIO_EXPORT void mixerConvert(Short* out, const Float* in, std::size_t frameCount);
+}
+
+/**
+@brief Software mixer for virtualized sources
+
+@ref SourcePool can play only as many sources as there are OpenAL sources in
+it, the less audible ones are virtualized and silent. If a mixer is attached
+to the pool using @ref SourcePool::setMixer(), virtualized playing sources
+with sample data in memory (see @ref PooledSource::setSamples()) are instead
+resampled, attenuated and mixed in software into a few streaming *bus*
+sources. The most audible sources still play as real OpenAL sources with
+full spatialization, so the pool can have thousands of sound emitters while
+using only a handful of OpenAL sources.
+
+The buses are placed evenly on a horizontal circle around the listener
+position in world space, so OpenAL keeps the rough direction of the mixed
+sources relative to listener orientation. Each mixed source is panned
+between the two buses nearest to its direction with constant power. A
+single bus is placed directly at the listener and mixed sources are not
+panned at all. Distance attenuation, gain and pitch are applied in software,
+the sources don't get Doppler shift or cone attenuation. Changes of gain and
+panning are ramped over one buffer to avoid clicks.
+
+## Usage
+
+@code
+Audio::SourcePool pool{32};
+Audio::Mixer mixer{4};
+pool.setMixer(&mixer);
+
+Audio::PooledSource footsteps{pool};
+footsteps.setBuffer(&footstepsBuffer)
+    .setSamples(footstepsSamples, 44100)
+    .setLooping(true)
+    .play();
+@endcode
+
+The mixed audio is queued ahead by the buffer count times buffer size, which
+is also the latency of sources switching between OpenAL and software
+playback. With the defaults it's about 70 milliseconds. Call
+@ref SourcePool::update() often enough to not let the queue run dry.
+*/
+class MAGNUM_AUDIO_EXPORT Mixer {
+    friend SourcePool;
+
+    public:
+        /** @brief Max bus count */
+        enum: std::size_t { MaxBusCount = 8 };
+
+        /**
+         * @brief Constructor
+         * @param busCount      Count of bus sources, at most
+         *      @ref MaxBusCount
+         * @param frequency     Mixing frequency
+         * @param bufferFrames  Frame count in each buffer
+         * @param bufferCount   Count of buffers queued in each bus
+         *
+         * Creates the bus sources and buffers upfront. Expects that
+         * @p busCount is at least `1` and @p bufferCount at least `2`.
+         */
+        explicit Mixer(std::size_t busCount = 4, UnsignedInt frequency = 44100, std::size_t bufferFrames = 1024, std::size_t bufferCount = 3);
+
+        /** @brief Copying is not allowed */
+        Mixer(const Mixer&) = delete;
+
+        /** @brief Moving is not allowed */
+        Mixer(Mixer&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Stops all bus sources.
+         */
+        ~Mixer();
+
+        /** @brief Copying is not allowed */
+        Mixer& operator=(const Mixer&) = delete;
+
+        /** @brief Moving is not allowed */
+        Mixer& operator=(Mixer&&) = delete;
+
+        /** @brief Bus count */
+        std::size_t busCount() const { return _sources.size(); }
+
+        /** @brief Mixing frequency */
+        UnsignedInt frequency() const { return _frequency; }
+
+        /** @brief Frame count in each buffer */
+        std::size_t bufferFrames() const { return _bufferFrames; }
+
+        /**
+         * @brief Bus source
+         *
+         * Can be used e.g. for setting overall gain of the mixed sources.
+         * Don't use it for controlling playback, position or attaching
+         * buffers.
+         */
+        Source& bus(std::size_t id) { return _sources[id]; }
+
+        /** @brief Count of sources mixed in last update */
+        std::size_t mixedSourceCount() const { return _mixedCount; }
+
+    private:
+        /* Called from SourcePool::update() with the virtualized playing
+           sources and their distance attenuation */
+        void update(const Vector3& listenerPosition, const std::vector<PooledSource*>& sources);
+
+        void mix(std::size_t slot, const std::vector<PooledSource*>& sources);
+
+        UnsignedInt _frequency;
+        std::size_t _bufferFrames, _bufferCount, _mixedCount;
+
+        /* Destroyed after the sources. Buffer for bus i and slot j is at
+           i*bufferCount + j, all buses are queued in lockstep. */
+        std::vector<Buffer> _buffers;
+        std::vector<Source> _sources;
+        std::deque<std::size_t> _queued;
+        std::vector<std::size_t> _free;
+
+        /* Target gain of each bus for each mixed source */
+        std::vector<Float> _gains;
+        Containers::Array<Float> _mixed, _resampled;
+        Containers::Array<Short> _converted;
+};
+
+}}
+
+#endif
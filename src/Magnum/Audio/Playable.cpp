@@ -0,0 +1,76 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Playable.h"
+
+#include "Magnum/Audio/PlayableGroup.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace Audio {
+
+namespace {
+    Vector3 position(const Matrix3& transformationMatrix) {
+        return Vector3{transformationMatrix.translation(), 0.0f};
+    }
+
+    Vector3 position(const Matrix4& transformationMatrix) {
+        return transformationMatrix.translation();
+    }
+}
+
+template<UnsignedInt dimensions> Playable<dimensions>::Playable(SceneGraph::AbstractObject<dimensions, Float>& object, PlayableGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, Playable<dimensions>, Float>(object, group), _queued{false} {
+    SceneGraph::AbstractFeature<dimensions, Float>::setCachedTransformations(SceneGraph::CachedTransformation::Absolute);
+
+    /* The object might be dirty already, so markDirty() won't be called */
+    if(group) group->enqueue(*this);
+}
+
+template<UnsignedInt dimensions> Playable<dimensions>::~Playable() {
+    if(group()) group()->untrack(*this);
+}
+
+template<UnsignedInt dimensions> PlayableGroup<dimensions>* Playable<dimensions>::group() {
+    return static_cast<PlayableGroup<dimensions>*>(SceneGraph::AbstractGroupedFeature<dimensions, Playable<dimensions>, Float>::group());
+}
+
+template<UnsignedInt dimensions> const PlayableGroup<dimensions>* Playable<dimensions>::group() const {
+    return static_cast<const PlayableGroup<dimensions>*>(SceneGraph::AbstractGroupedFeature<dimensions, Playable<dimensions>, Float>::group());
+}
+
+template<UnsignedInt dimensions> void Playable<dimensions>::markDirty() {
+    if(group()) group()->enqueue(*this);
+}
+
+template<UnsignedInt dimensions> void Playable<dimensions>::clean(const MatrixTypeFor<dimensions, Float>& absoluteTransformationMatrix) {
+    _source.setPosition(position(absoluteTransformationMatrix));
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template class MAGNUM_AUDIO_EXPORT Playable<2>;
+template class MAGNUM_AUDIO_EXPORT Playable<3>;
+#endif
+
+}}
@@ -0,0 +1,113 @@
+#ifndef Magnum_Audio_Playable_h
+#define Magnum_Audio_Playable_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::Playable, typedef @ref Magnum::Audio::Playable2D, @ref Magnum::Audio::Playable3D
+ */
+
+#include "Magnum/Audio/Source.h"
+#include "Magnum/SceneGraph/AbstractGroupedFeature.h"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Playable
+
+Feature attaching a @ref Source to an object. Position of the source follows
+cached absolute transformation of the object, for two-dimensional scenes the
+position is in the XY plane. The position is updated only if the object
+changed since last cleaning, which is done in batch for whole
+@ref PlayableGroup.
+@code
+Audio::PlayableGroup3D playables;
+Audio::Listener3D listener{cameraObject};
+
+Object3D engineObject;
+auto engine = new Audio::Playable3D{engineObject, &playables};
+engine->source()
+    .setBuffer(&engineBuffer)
+    .setLooping(true);
+playables.play();
+
+// each frame
+listener.update({playables});
+@endcode
+
+Use @ref source() for setting up other source properties, but not the
+position, as it would be overwritten on next update.
+@see @ref Playable2D, @ref Playable3D, @ref Listener
+*/
+template<UnsignedInt dimensions> class MAGNUM_AUDIO_EXPORT Playable: public SceneGraph::AbstractGroupedFeature<dimensions, Playable<dimensions>, Float> {
+    friend PlayableGroup<dimensions>;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object holding this feature
+         * @param group     Group this playable belongs to
+         */
+        explicit Playable(SceneGraph::AbstractObject<dimensions, Float>& object, PlayableGroup<dimensions>* group = nullptr);
+
+        /**
+         * @brief Destructor
+         *
+         * Removes the playable from queue of dirty playables in its group.
+         */
+        ~Playable();
+
+        /**
+         * @brief Group containing this playable
+         *
+         * If the playable doesn't belong to any group, returns `nullptr`.
+         */
+        PlayableGroup<dimensions>* group();
+        const PlayableGroup<dimensions>* group() const; /**< @overload */
+
+        /** @brief Source */
+        Source& source() { return _source; }
+
+    protected:
+        /** Enqueues the playable in its group */
+        void markDirty() override;
+
+        /** Updates source position */
+        void clean(const MatrixTypeFor<dimensions, Float>& absoluteTransformationMatrix) override;
+
+    private:
+        Source _source;
+        bool _queued;
+};
+
+/** @brief Playable for two-dimensional scenes */
+typedef Playable<2> Playable2D;
+
+/** @brief Playable for three-dimensional scenes */
+typedef Playable<3> Playable3D;
+
+}}
+
+#endif
@@ -0,0 +1,118 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PlayableGroup.h"
+
+#include <algorithm>
+
+namespace Magnum { namespace Audio {
+
+template<UnsignedInt dimensions> PlayableGroup<dimensions>::PlayableGroup() = default;
+
+template<UnsignedInt dimensions> PlayableGroup<dimensions>::~PlayableGroup() {
+    /* The playables stay alive, reset their bookkeeping so they can be added
+       to another group */
+    for(std::size_t i = 0; i != this->size(); ++i)
+        (*this)[i]._queued = false;
+}
+
+template<UnsignedInt dimensions> PlayableGroup<dimensions>& PlayableGroup<dimensions>::add(Playable<dimensions>& playable) {
+    /* Remove from previous group through its own interface, so its queue is
+       updated too */
+    if(playable.group()) playable.group()->remove(playable);
+
+    SceneGraph::FeatureGroup<dimensions, Playable<dimensions>, Float>::add(playable);
+    enqueue(playable);
+    return *this;
+}
+
+template<UnsignedInt dimensions> PlayableGroup<dimensions>& PlayableGroup<dimensions>::remove(Playable<dimensions>& playable) {
+    CORRADE_ASSERT(playable.group() == this,
+        "Audio::PlayableGroup::remove(): playable is not part of this group", *this);
+
+    untrack(playable);
+    SceneGraph::FeatureGroup<dimensions, Playable<dimensions>, Float>::remove(playable);
+    return *this;
+}
+
+template<UnsignedInt dimensions> void PlayableGroup<dimensions>::enqueue(Playable<dimensions>& playable) {
+    if(playable._queued) return;
+
+    playable._queued = true;
+    _queue.push_back(&playable);
+}
+
+template<UnsignedInt dimensions> void PlayableGroup<dimensions>::untrack(Playable<dimensions>& playable) {
+    if(!playable._queued) return;
+
+    _queue.erase(std::find(_queue.begin(), _queue.end(), &playable));
+    playable._queued = false;
+}
+
+template<UnsignedInt dimensions> void PlayableGroup<dimensions>::collect(std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>>& objects) {
+    for(Playable<dimensions>* playable: _queue) {
+        objects.push_back(playable->object());
+        playable->_queued = false;
+    }
+
+    _queue.clear();
+}
+
+template<UnsignedInt dimensions> void PlayableGroup<dimensions>::setClean() {
+    if(_queue.empty()) return;
+
+    std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>> objects;
+    objects.reserve(_queue.size());
+    collect(objects);
+    SceneGraph::AbstractObject<dimensions, Float>::setClean(objects);
+}
+
+template<UnsignedInt dimensions> std::vector<std::reference_wrapper<Source>> PlayableGroup<dimensions>::sources() {
+    std::vector<std::reference_wrapper<Source>> sources;
+    sources.reserve(this->size());
+    for(std::size_t i = 0; i != this->size(); ++i)
+        sources.push_back((*this)[i].source());
+    return sources;
+}
+
+template<UnsignedInt dimensions> void PlayableGroup<dimensions>::play() {
+    setClean();
+    Source::play(sources());
+}
+
+template<UnsignedInt dimensions> void PlayableGroup<dimensions>::pause() {
+    Source::pause(sources());
+}
+
+template<UnsignedInt dimensions> void PlayableGroup<dimensions>::stop() {
+    Source::stop(sources());
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template class MAGNUM_AUDIO_EXPORT PlayableGroup<2>;
+template class MAGNUM_AUDIO_EXPORT PlayableGroup<3>;
+#endif
+
+}}
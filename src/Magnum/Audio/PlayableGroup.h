@@ -0,0 +1,125 @@
+#ifndef Magnum_Audio_PlayableGroup_h
+#define Magnum_Audio_PlayableGroup_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::PlayableGroup, typedef @ref Magnum::Audio::PlayableGroup2D, @ref Magnum::Audio::PlayableGroup3D
+ */
+
+#include <vector>
+
+#include "Magnum/Audio/Playable.h"
+#include "Magnum/SceneGraph/FeatureGroup.h"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Group of playables
+
+See @ref Playable for more information. Keeps track of playables whose
+objects changed since last @ref setClean() and cleans only them, all at once.
+Playables should be added to and removed from the group either with the
+constructor parameter or using @ref add() and @ref remove() of this class, not
+through the base @ref SceneGraph::FeatureGroup interface.
+@see @ref PlayableGroup2D, @ref PlayableGroup3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_AUDIO_EXPORT PlayableGroup: public SceneGraph::FeatureGroup<dimensions, Playable<dimensions>, Float> {
+    friend Playable<dimensions>;
+    friend Listener<dimensions>;
+
+    public:
+        explicit PlayableGroup();
+
+        ~PlayableGroup();
+
+        /**
+         * @brief Add playable to the group
+         * @return Reference to self (for method chaining)
+         *
+         * If the playable is part of another group, it is removed from it
+         * first.
+         */
+        PlayableGroup<dimensions>& add(Playable<dimensions>& playable);
+
+        /**
+         * @brief Remove playable from the group
+         * @return Reference to self (for method chaining)
+         *
+         * The playable must be part of the group.
+         */
+        PlayableGroup<dimensions>& remove(Playable<dimensions>& playable);
+
+        /**
+         * @brief Update positions of changed playables
+         *
+         * Cleans objects of all playables that were marked dirty since last
+         * call in one batch. If nothing changed, the function is a no-op.
+         * @see @ref SceneGraph::AbstractObject::setClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>&),
+         *      @ref Listener::update()
+         */
+        void setClean();
+
+        /**
+         * @brief Play all sources in the group
+         *
+         * Updates positions first using @ref setClean(), then plays all
+         * sources at once.
+         * @see @ref Source::play(const std::vector<std::reference_wrapper<Source>>&)
+         */
+        void play();
+
+        /**
+         * @brief Pause all sources in the group
+         *
+         * @see @ref Source::pause(const std::vector<std::reference_wrapper<Source>>&)
+         */
+        void pause();
+
+        /**
+         * @brief Stop all sources in the group
+         *
+         * @see @ref Source::stop(const std::vector<std::reference_wrapper<Source>>&)
+         */
+        void stop();
+
+    private:
+        void MAGNUM_AUDIO_LOCAL enqueue(Playable<dimensions>& playable);
+        void MAGNUM_AUDIO_LOCAL untrack(Playable<dimensions>& playable);
+        void MAGNUM_AUDIO_LOCAL collect(std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>>& objects);
+        std::vector<std::reference_wrapper<Source>> MAGNUM_AUDIO_LOCAL sources();
+
+        std::vector<Playable<dimensions>*> _queue;
+};
+
+/** @brief Group of playables for two-dimensional scenes */
+typedef PlayableGroup<2> PlayableGroup2D;
+
+/** @brief Group of playables for three-dimensional scenes */
+typedef PlayableGroup<3> PlayableGroup3D;
+
+}}
+
+#endif
@@ -40,6 +40,50 @@ Source& Source::setBuffer(Buffer* buffer) {
 
 namespace {
 
+template<class T> Containers::Array<ALuint> bufferIds(const T& buffers) {
+    Containers::Array<ALuint> ids(buffers.size());
+    for(auto it = buffers.begin(); it != buffers.end(); ++it)
+        ids[it-buffers.begin()] = it->get().id();
+    return ids;
+}
+
+template<class T> void unqueueBuffersInternal(const ALuint id, const T& buffers) {
+    Containers::Array<ALuint> ids(buffers.size());
+    alSourceUnqueueBuffers(id, ids.size(), ids);
+
+    #ifndef CORRADE_NO_ASSERT
+    for(auto it = buffers.begin(); it != buffers.end(); ++it)
+        CORRADE_ASSERT(ids[it-buffers.begin()] == it->get().id(),
+            "Audio::Source::unqueueBuffers(): buffer" << it-buffers.begin() << "doesn't match the front of the queue", );
+    #endif
+}
+
+}
+
+Source& Source::queueBuffers(std::initializer_list<std::reference_wrapper<Buffer>> buffers) {
+    const auto ids = bufferIds(buffers);
+    alSourceQueueBuffers(_id, ids.size(), ids);
+    return *this;
+}
+
+Source& Source::queueBuffers(const std::vector<std::reference_wrapper<Buffer>>& buffers) {
+    const auto ids = bufferIds(buffers);
+    alSourceQueueBuffers(_id, ids.size(), ids);
+    return *this;
+}
+
+Source& Source::unqueueBuffers(std::initializer_list<std::reference_wrapper<Buffer>> buffers) {
+    unqueueBuffersInternal(_id, buffers);
+    return *this;
+}
+
+Source& Source::unqueueBuffers(const std::vector<std::reference_wrapper<Buffer>>& buffers) {
+    unqueueBuffersInternal(_id, buffers);
+    return *this;
+}
+
+namespace {
+
 Containers::Array<ALuint> sourceIds(const std::initializer_list<std::reference_wrapper<Source>>& sources) {
     Containers::Array<ALuint> ids(sources.size());
     for(auto it = sources.begin(); it != sources.end(); ++it)
@@ -44,8 +44,9 @@ namespace Magnum { namespace Audio {
 /**
 @brief Source
 
-Manages positional audio source.
-@todo Expose convenient API for buffer queuing
+Manages positional audio source. Either plays single buffer attached using
+@ref setBuffer() or a queue of buffers, see @ref queueBuffers(). For streaming
+long tracks from an importer see @ref StreamingSource.
 */
 class MAGNUM_AUDIO_EXPORT Source {
     public:
@@ -356,6 +357,51 @@ class MAGNUM_AUDIO_EXPORT Source {
          */
         Source& setBuffer(Buffer* buffer);
 
+        /**
+         * @brief Queue buffers
+         * @param buffers       Buffers to append to the queue
+         * @return Reference to self (for method chaining)
+         *
+         * Changes source type to @ref Type::Streaming. The buffers must be
+         * already filled with data and all buffers in the queue must have the
+         * same format.
+         * @see @ref unqueueBuffers(), @ref queuedBufferCount(),
+         *      @fn_al{SourceQueueBuffers}
+         */
+        Source& queueBuffers(std::initializer_list<std::reference_wrapper<Buffer>> buffers);
+        Source& queueBuffers(const std::vector<std::reference_wrapper<Buffer>>& buffers); /**< @overload */
+
+        /**
+         * @brief Unqueue processed buffers
+         * @param buffers       Buffers to remove from the queue
+         * @return Reference to self (for method chaining)
+         *
+         * Removes given buffers from the front of the queue. Expects that the
+         * buffers are in the same order as they were queued and that they
+         * were already processed, see @ref processedBufferCount(). After
+         * @ref stop() all buffers in the queue are processed.
+         * @see @fn_al{SourceUnqueueBuffers}
+         */
+        Source& unqueueBuffers(std::initializer_list<std::reference_wrapper<Buffer>> buffers);
+        Source& unqueueBuffers(const std::vector<std::reference_wrapper<Buffer>>& buffers); /**< @overload */
+
+        /**
+         * @brief Count of queued buffers
+         *
+         * Includes also the buffers which were already processed.
+         * @see @ref queueBuffers(), @fn_al{GetSourcei} with
+         *      @def_al{BUFFERS_QUEUED}
+         */
+        Int queuedBufferCount() const;
+
+        /**
+         * @brief Count of processed buffers
+         *
+         * @see @ref unqueueBuffers(), @fn_al{GetSourcei} with
+         *      @def_al{BUFFERS_PROCESSED}
+         */
+        Int processedBufferCount() const;
+
         /*@}*/
 
         /** @{ @name State management */
@@ -599,6 +645,18 @@ inline Source& Source::operator=(Source&& other) {
     return *this;
 }
 
+inline Int Source::queuedBufferCount() const {
+    ALint count;
+    alGetSourcei(_id, AL_BUFFERS_QUEUED, &count);
+    return count;
+}
+
+inline Int Source::processedBufferCount() const {
+    ALint count;
+    alGetSourcei(_id, AL_BUFFERS_PROCESSED, &count);
+    return count;
+}
+
 inline auto Source::state() const -> State {
     ALint state;
     alGetSourcei(_id, AL_SOURCE_STATE, &state);
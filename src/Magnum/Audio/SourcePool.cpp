@@ -0,0 +1,297 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SourcePool.h"
+
+#include <algorithm>
+#include <alc.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Audio {
+
+namespace {
+
+enum: UnsignedShort {
+    DirtyPosition = 1 << 0,
+    DirtyVelocity = 1 << 1,
+    DirtyRelative = 1 << 2,
+    DirtyGain = 1 << 3,
+    DirtyPitch = 1 << 4,
+    DirtyReferenceDistance = 1 << 5,
+    DirtyRolloffFactor = 1 << 6,
+    DirtyMaxDistance = 1 << 7,
+    DirtyBuffer = 1 << 8,
+    DirtyLooping = 1 << 9,
+    /* Playback was (re)started manually since last update */
+    DirtyPlay = 1 << 10,
+
+    DirtyParameters = (1 << 10) - 1
+};
+
+}
+
+SourcePool::SourcePool(const std::size_t sourceCount): _mixer{nullptr}, _sources(sourceCount) {
+    for(std::size_t i = 0; i != sourceCount; ++i) _free.push_back(sourceCount - i - 1);
+}
+
+SourcePool::~SourcePool() {
+    CORRADE_ASSERT(_pooled.empty(),
+        "Audio::SourcePool: destroyed with" << _pooled.size() << "pooled sources still alive", );
+}
+
+void SourcePool::release(PooledSource& pooled) {
+    _free.push_back(pooled._source);
+    pooled._source = PooledSource::NoSource;
+}
+
+void SourcePool::update(const Vector3& listenerPosition) {
+    ALCcontext* const context = alcGetCurrentContext();
+    alcSuspendContext(context);
+
+    /* Release sources that finished playing, were paused, stopped or
+       restarted since last update. Paused ones remember where they were. */
+    std::vector<std::reference_wrapper<Source>> stopped;
+    for(PooledSource* const pooled: _pooled) {
+        if(pooled->_source == PooledSource::NoSource) continue;
+
+        Source& source = _sources[pooled->_source];
+        if(pooled->_state == Source::State::Playing && !(pooled->_dirty & DirtyPlay)) {
+            if(source.state() != Source::State::Stopped) continue;
+
+            pooled->_state = Source::State::Stopped;
+            pooled->_offset = 0;
+        } else if(pooled->_state == Source::State::Paused)
+            pooled->_offset = source.offsetInSamples();
+
+        stopped.push_back(source);
+        release(*pooled);
+    }
+
+    /* Compute audibility of all playing sources */
+    std::vector<PooledSource*> candidates;
+    for(PooledSource* const pooled: _pooled) {
+        pooled->_audibility = 0.0f;
+        if(pooled->_state != Source::State::Playing) continue;
+
+        /* Inverse distance clamped model, which is the OpenAL default */
+        const Float distance = pooled->_relative ? pooled->_position.length() :
+            (pooled->_position - listenerPosition).length();
+        const Float clamped = Math::clamp(distance, pooled->_referenceDistance, pooled->_maxDistance);
+        const Float denominator = pooled->_referenceDistance + pooled->_rolloffFactor*(clamped - pooled->_referenceDistance);
+        const Float attenuation = denominator > 0.0f ? pooled->_referenceDistance/denominator : 1.0f;
+
+        pooled->_audibility = pooled->_priority*pooled->_gain*attenuation;
+        if(pooled->_audibility > 0.0f) candidates.push_back(pooled);
+    }
+
+    /* Most audible first, sources which already have an OpenAL source win
+       ties to avoid needless switching */
+    std::sort(candidates.begin(), candidates.end(), [](const PooledSource* a, const PooledSource* b) {
+        if(a->_audibility != b->_audibility) return a->_audibility > b->_audibility;
+        return a->_source != PooledSource::NoSource && b->_source == PooledSource::NoSource;
+    });
+    const std::size_t audibleCount = std::min(candidates.size(), _sources.size());
+
+    /* Virtualize the less audible ones */
+    for(auto it = candidates.begin() + audibleCount; it != candidates.end(); ++it) {
+        if((*it)->_source == PooledSource::NoSource) continue;
+
+        (*it)->_offset = _sources[(*it)->_source].offsetInSamples();
+        stopped.push_back(_sources[(*it)->_source]);
+        release(**it);
+    }
+
+    Source::stop(stopped);
+    for(Source& source: stopped) source.setBuffer(nullptr);
+
+    /* Give OpenAL sources to the most audible ones */
+    std::vector<std::reference_wrapper<Source>> started;
+    for(auto it = candidates.begin(); it != candidates.begin() + audibleCount; ++it) {
+        if((*it)->_source != PooledSource::NoSource) continue;
+
+        CORRADE_INTERNAL_ASSERT(!_free.empty());
+        (*it)->_source = _free.back();
+        (*it)->_dirty |= DirtyParameters;
+        _free.pop_back();
+        started.push_back(_sources[(*it)->_source]);
+    }
+
+    /* Apply changed parameters */
+    for(PooledSource* const pooled: _pooled) {
+        if(pooled->_source != PooledSource::NoSource) {
+            Source& source = _sources[pooled->_source];
+            const UnsignedShort dirty = pooled->_dirty;
+            if(dirty & DirtyPosition) source.setPosition(pooled->_position);
+            if(dirty & DirtyVelocity) source.setVelocity(pooled->_velocity);
+            if(dirty & DirtyRelative) source.setRelative(pooled->_relative);
+            if(dirty & DirtyGain) source.setGain(pooled->_gain);
+            if(dirty & DirtyPitch) source.setPitch(pooled->_pitch);
+            if(dirty & DirtyReferenceDistance) source.setReferenceDistance(pooled->_referenceDistance);
+            if(dirty & DirtyRolloffFactor) source.setRolloffFactor(pooled->_rolloffFactor);
+            if(dirty & DirtyMaxDistance) source.setMaxDistance(pooled->_maxDistance);
+            if(dirty & DirtyLooping) source.setLooping(pooled->_looping);
+            if(dirty & DirtyBuffer) {
+                source.setBuffer(pooled->_buffer);
+                /* Continue where the virtualized source was */
+                source.setOffsetInSamples(pooled->_offset);
+            }
+        }
+
+        pooled->_dirty = 0;
+    }
+
+    Source::play(started);
+
+    /* Mix the virtualized ones in software, if possible */
+    if(_mixer) {
+        std::vector<PooledSource*> mixed;
+        for(PooledSource* const pooled: _pooled) {
+            if(pooled->_source == PooledSource::NoSource && pooled->_audibility > 0.0f && pooled->_samples.size())
+                mixed.push_back(pooled);
+            else pooled->_mixed = false;
+        }
+
+        _mixer->update(listenerPosition, mixed);
+    }
+
+    alcProcessContext(context);
+}
+
+PooledSource::PooledSource(SourcePool& pool): _pool(pool), _source{NoSource}, _buffer{nullptr}, _priority{1.0f}, _gain{1.0f}, _pitch{1.0f}, _referenceDistance{1.0f}, _rolloffFactor{1.0f}, _maxDistance{Constants::inf()}, _audibility{0.0f}, _offset{0}, _state{Source::State::Initial}, _relative{false}, _looping{false}, _dirty{0}, _samplesFrequency{0}, _mixPosition{0.0}, _mixGains{}, _mixed{false} {
+    pool._pooled.push_back(this);
+}
+
+PooledSource::~PooledSource() {
+    if(_source != NoSource) {
+        Source& source = _pool._sources[_source];
+        source.stop();
+        source.setBuffer(nullptr);
+        _pool.release(*this);
+    }
+
+    _pool._pooled.erase(std::find(_pool._pooled.begin(), _pool._pooled.end(), this));
+}
+
+PooledSource& PooledSource::setPosition(const Vector3& position) {
+    _position = position;
+    _dirty |= DirtyPosition;
+    return *this;
+}
+
+PooledSource& PooledSource::setVelocity(const Vector3& velocity) {
+    _velocity = velocity;
+    _dirty |= DirtyVelocity;
+    return *this;
+}
+
+PooledSource& PooledSource::setRelative(const bool relative) {
+    _relative = relative;
+    _dirty |= DirtyRelative;
+    return *this;
+}
+
+PooledSource& PooledSource::setGain(const Float gain) {
+    _gain = gain;
+    _dirty |= DirtyGain;
+    return *this;
+}
+
+PooledSource& PooledSource::setPitch(const Float pitch) {
+    _pitch = pitch;
+    _dirty |= DirtyPitch;
+    return *this;
+}
+
+PooledSource& PooledSource::setReferenceDistance(const Float distance) {
+    _referenceDistance = distance;
+    _dirty |= DirtyReferenceDistance;
+    return *this;
+}
+
+PooledSource& PooledSource::setRolloffFactor(const Float factor) {
+    _rolloffFactor = factor;
+    _dirty |= DirtyRolloffFactor;
+    return *this;
+}
+
+PooledSource& PooledSource::setMaxDistance(const Float distance) {
+    _maxDistance = distance;
+    _dirty |= DirtyMaxDistance;
+    return *this;
+}
+
+PooledSource& PooledSource::setBuffer(Buffer* const buffer) {
+    /* The buffer can't be changed on a playing OpenAL source */
+    stop();
+    _buffer = buffer;
+    return *this;
+}
+
+PooledSource& PooledSource::setSamples(const Containers::ArrayReference<const Float> samples, const UnsignedInt frequency) {
+    _samples = samples;
+    _samplesFrequency = frequency;
+    _mixed = false;
+    return *this;
+}
+
+PooledSource& PooledSource::setLooping(const bool looping) {
+    _looping = looping;
+    _dirty |= DirtyLooping;
+    return *this;
+}
+
+void PooledSource::play() {
+    if(_state == Source::State::Playing) return;
+
+    /* Paused since last update, the OpenAL source is still playing */
+    if(_state == Source::State::Paused && _source != NoSource) {
+        _state = Source::State::Playing;
+        return;
+    }
+
+    if(_state != Source::State::Paused) _offset = 0;
+
+    _state = Source::State::Playing;
+    _dirty |= DirtyPlay;
+    _mixed = false;
+}
+
+void PooledSource::pause() {
+    if(_state == Source::State::Playing) _state = Source::State::Paused;
+}
+
+void PooledSource::stop() {
+    if(_state != Source::State::Playing && _state != Source::State::Paused) return;
+
+    _state = Source::State::Stopped;
+    _offset = 0;
+    _mixed = false;
+}
+
+}}
@@ -0,0 +1,383 @@
+#ifndef Magnum_Audio_SourcePool_h
+#define Magnum_Audio_SourcePool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::SourcePool, @ref Magnum::Audio::PooledSource
+ */
+
+#include <vector>
+
+#include "Magnum/Audio/Mixer.h"
+#include "Magnum/Audio/Source.h"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Source pool
+
+Scenes with hundreds of emitters can't have an OpenAL source for each of them,
+as implementations support only a limited count of them and each source adds
+to the mixing cost. The pool owns a fixed count of @ref Source objects and
+assigns them to the most audible @ref PooledSource "PooledSources" in each
+@ref update(). The remaining ones are *virtualized* --- they keep their
+parameters and playback state, but don't occupy any OpenAL source until they
+become audible enough again.
+
+Parameters of pooled sources are not applied immediately. Changed values are
+remembered and @ref update() applies all of them at once with the context
+suspended, together with batched play and stop of sources that got or lost an
+OpenAL source, see @ref Source::play(const std::vector<std::reference_wrapper<Source>>&).
+
+## Usage
+
+@code
+Audio::SourcePool pool{32};
+
+Audio::PooledSource footsteps{pool};
+footsteps.setBuffer(&footstepsBuffer)
+    .setLooping(true)
+    .setPriority(2.0f)
+    .play();
+
+// each frame
+footsteps.setPosition(player.position());
+pool.update(camera.position());
+@endcode
+
+The pool must outlive all its pooled sources.
+*/
+class MAGNUM_AUDIO_EXPORT SourcePool {
+    friend PooledSource;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param sourceCount   Count of OpenAL sources in the pool
+         *
+         * Creates all OpenAL sources upfront.
+         */
+        explicit SourcePool(std::size_t sourceCount);
+
+        /**
+         * @brief Destructor
+         *
+         * Expects that all pooled sources are already destroyed.
+         */
+        ~SourcePool();
+
+        /** @brief Copying is not allowed */
+        SourcePool(const SourcePool&) = delete;
+
+        /** @brief Moving is not allowed */
+        SourcePool(SourcePool&&) = delete;
+
+        /** @brief Copying is not allowed */
+        SourcePool& operator=(const SourcePool&) = delete;
+
+        /** @brief Moving is not allowed */
+        SourcePool& operator=(SourcePool&&) = delete;
+
+        /** @brief Count of OpenAL sources in the pool */
+        std::size_t sourceCount() const { return _sources.size(); }
+
+        /** @brief Count of OpenAL sources not assigned to any pooled source */
+        std::size_t freeSourceCount() const { return _free.size(); }
+
+        /** @brief Count of pooled sources */
+        std::size_t pooledSourceCount() const { return _pooled.size(); }
+
+        /**
+         * @brief Update the pool
+         * @param listenerPosition  Listener position, used for computing
+         *      audibility of non-relative sources
+         *
+         * Releases OpenAL sources of pooled sources that finished playing or
+         * were paused or stopped, computes @ref PooledSource::audibility()
+         * of all playing sources and assigns OpenAL sources to the most
+         * audible ones, taking them from the less audible ones. Then applies
+         * all changed parameters. Everything is done between
+         * @fn_alc{SuspendContext} and @fn_alc{ProcessContext}. Call it once
+         * every frame.
+         */
+        void update(const Vector3& listenerPosition);
+
+        /** @brief Software mixer */
+        Mixer* mixer() { return _mixer; }
+
+        /**
+         * @brief Set software mixer
+         * @return Reference to self (for method chaining)
+         *
+         * If set, virtualized playing sources with sample data are mixed in
+         * software in @ref update() instead of being silent. The mixer must
+         * stay alive while set. Pass `nullptr` to disable mixing. Default is
+         * `nullptr`.
+         * @see @ref PooledSource::setSamples()
+         */
+        SourcePool& setMixer(Mixer* mixer) {
+            _mixer = mixer;
+            return *this;
+        }
+
+    private:
+        void release(PooledSource& pooled);
+
+        Mixer* _mixer;
+        std::vector<Source> _sources;
+        std::vector<std::size_t> _free;
+        std::vector<PooledSource*> _pooled;
+};
+
+/**
+@brief Pooled source
+
+Virtual audio source managed by @ref SourcePool. Has the commonly used subset
+of @ref Source parameters, all of them are applied in next
+@ref SourcePool::update(). Virtualized playing sources remember their
+playback offset and continue from it after becoming audible again.
+
+@note Unless the source is mixed in software (see @ref setSamples()), the
+    playback offset doesn't advance while the source is virtualized, so
+    non-looping sources never finish while virtualized. Pooling is thus best
+    suited for looping ambient sounds and short one-shot effects with high
+    priority.
+*/
+class MAGNUM_AUDIO_EXPORT PooledSource {
+    friend SourcePool;
+    friend Mixer;
+
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Registers the source in the pool. No OpenAL source is assigned
+         * until it is played.
+         */
+        explicit PooledSource(SourcePool& pool);
+
+        /**
+         * @brief Destructor
+         *
+         * Stops the OpenAL source, if any, and returns it to the pool.
+         */
+        ~PooledSource();
+
+        /** @brief Copying is not allowed */
+        PooledSource(const PooledSource&) = delete;
+
+        /** @brief Moving is not allowed */
+        PooledSource(PooledSource&&) = delete;
+
+        /** @brief Copying is not allowed */
+        PooledSource& operator=(const PooledSource&) = delete;
+
+        /** @brief Moving is not allowed */
+        PooledSource& operator=(PooledSource&&) = delete;
+
+        /** @brief Pool */
+        SourcePool& pool() { return _pool; }
+
+        /**
+         * @brief Assigned OpenAL source
+         *
+         * Pointer to object in the pool or `nullptr` if the source is
+         * virtualized. Valid only until next @ref SourcePool::update(), don't
+         * use it for changing parameters or controlling playback.
+         */
+        Source* source() {
+            return _source == NoSource ? nullptr : &_pool._sources[_source];
+        }
+
+        /** @brief Whether the source is virtualized */
+        bool isVirtual() const { return _source == NoSource; }
+
+        /**
+         * @brief Audibility
+         *
+         * Priority multiplied with gain and distance attenuation, computed in
+         * last @ref SourcePool::update(). Sources with larger audibility get
+         * OpenAL sources first.
+         */
+        Float audibility() const { return _audibility; }
+
+        /** @brief Priority */
+        Float priority() const { return _priority; }
+
+        /**
+         * @brief Set priority
+         * @return Reference to self (for method chaining)
+         *
+         * Multiplier of audibility. Sources with zero priority never get an
+         * OpenAL source. Default is `1.0f`.
+         */
+        PooledSource& setPriority(Float priority) {
+            _priority = priority;
+            return *this;
+        }
+
+        /**
+         * @brief Set position
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Source::setPosition()
+         */
+        PooledSource& setPosition(const Vector3& position);
+
+        /**
+         * @brief Set velocity
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Source::setVelocity()
+         */
+        PooledSource& setVelocity(const Vector3& velocity);
+
+        /**
+         * @brief Interpret source relatively to listener
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Source::setRelative()
+         */
+        PooledSource& setRelative(bool relative);
+
+        /**
+         * @brief Set gain
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Source::setGain()
+         */
+        PooledSource& setGain(Float gain);
+
+        /**
+         * @brief Set pitch
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Source::setPitch()
+         */
+        PooledSource& setPitch(Float pitch);
+
+        /**
+         * @brief Set reference distance
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Source::setReferenceDistance()
+         */
+        PooledSource& setReferenceDistance(Float distance);
+
+        /**
+         * @brief Set rolloff factor
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Source::setRolloffFactor()
+         */
+        PooledSource& setRolloffFactor(Float factor);
+
+        /**
+         * @brief Set max distance
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Source::setMaxDistance()
+         */
+        PooledSource& setMaxDistance(Float distance);
+
+        /**
+         * @brief Attach buffer
+         * @return Reference to self (for method chaining)
+         *
+         * The buffer must stay alive while the source is playing. Stops the
+         * playback.
+         * @see @ref Source::setBuffer()
+         */
+        PooledSource& setBuffer(Buffer* buffer);
+
+        /**
+         * @brief Set sample data for software mixing
+         * @param samples   Mono samples in range @f$ [-1, 1] @f$, should be
+         *      the same as the data in the buffer
+         * @param frequency Sample frequency
+         * @return Reference to self (for method chaining)
+         *
+         * If set and the pool has a @ref Mixer, the source is mixed in
+         * software while virtualized, continuing from the current playback
+         * offset. The data must stay alive while the source is playing.
+         * Pass empty data to disable mixing. Default is empty.
+         * @see @ref SourcePool::setMixer()
+         */
+        PooledSource& setSamples(Containers::ArrayReference<const Float> samples, UnsignedInt frequency);
+
+        /**
+         * @brief Set looping
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Source::setLooping()
+         */
+        PooledSource& setLooping(bool looping);
+
+        /**
+         * @brief Playback state
+         *
+         * Updated in @ref SourcePool::update() when the playback finishes.
+         */
+        Source::State state() const { return _state; }
+
+        /**
+         * @brief Play
+         *
+         * Continues paused playback, otherwise starts playing from the
+         * beginning.
+         */
+        void play();
+
+        /** @brief Pause */
+        void pause();
+
+        /** @brief Stop */
+        void stop();
+
+    private:
+        enum: std::size_t { NoSource = ~std::size_t{} };
+
+        SourcePool& _pool;
+        std::size_t _source;
+        Buffer* _buffer;
+        Vector3 _position, _velocity;
+        Float _priority, _gain, _pitch, _referenceDistance, _rolloffFactor, _maxDistance, _audibility;
+        Int _offset;
+        Source::State _state;
+        bool _relative, _looping;
+        UnsignedShort _dirty;
+
+        /* Software mixing state, the position is in samples */
+        Containers::ArrayReference<const Float> _samples;
+        UnsignedInt _samplesFrequency;
+        double _mixPosition;
+        Float _mixGains[Mixer::MaxBusCount];
+        bool _mixed;
+};
+
+}}
+
+#endif
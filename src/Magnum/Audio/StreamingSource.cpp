@@ -0,0 +1,231 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "StreamingSource.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Audio/AbstractImporter.h"
+
+namespace Magnum { namespace Audio {
+
+StreamingSource::StreamingSource(AbstractImporter& importer, const std::size_t bufferSize, const std::size_t bufferCount): _importer(importer), _buffers(bufferCount), _state{Source::State::Initial}, _looping{false}, _finished{false}
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    , _quit{false}
+    #endif
+{
+    CORRADE_ASSERT(importer.features() & AbstractImporter::Feature::Streaming,
+        "Audio::StreamingSource: the importer doesn't support streaming", );
+    CORRADE_ASSERT(importer.isOpened(),
+        "Audio::StreamingSource: no file opened", );
+    CORRADE_ASSERT(bufferCount >= 2,
+        "Audio::StreamingSource: expected at least two buffers but got" << bufferCount, );
+
+    _format = importer.format();
+    _frequency = importer.frequency();
+
+    /* Whole frames in each buffer */
+    const std::size_t size = bufferSize/importer.frameSize()*importer.frameSize();
+    CORRADE_ASSERT(size,
+        "Audio::StreamingSource: buffer size" << bufferSize << "is too small for" << _format, );
+    _chunk = Containers::Array<char>(size);
+
+    for(std::size_t i = 0; i != bufferCount; ++i) _free.push_back(i);
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* Wake up four times during playback of one buffer */
+    _interval = std::chrono::microseconds{size*250000/(importer.frameSize()*_frequency)};
+    _thread = std::thread{&StreamingSource::run, this};
+    #endif
+}
+
+StreamingSource::~StreamingSource() {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _quit = true;
+    }
+    _condition.notify_one();
+    if(_thread.joinable()) _thread.join();
+    #endif
+
+    /* Release the queued buffers so they can be deleted */
+    _source.stop();
+    _source.setBuffer(nullptr);
+}
+
+StreamingSource& StreamingSource::setLooping(const bool looping) {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::lock_guard<std::mutex> lock{_mutex};
+    #endif
+    _looping = looping;
+    if(looping) _finished = false;
+    return *this;
+}
+
+Source::State StreamingSource::state() const {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::lock_guard<std::mutex> lock{_mutex};
+    #endif
+    return _state;
+}
+
+void StreamingSource::play() {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::lock_guard<std::mutex> lock{_mutex};
+    #endif
+    if(_state == Source::State::Playing) return;
+
+    /* Continue paused playback, otherwise fill the whole queue first */
+    if(_state != Source::State::Paused) {
+        refill();
+        if(_queued.empty()) return;
+    }
+
+    _source.play();
+    _state = Source::State::Playing;
+}
+
+void StreamingSource::pause() {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::lock_guard<std::mutex> lock{_mutex};
+    #endif
+    if(_state != Source::State::Playing) return;
+
+    _source.pause();
+    _state = Source::State::Paused;
+}
+
+void StreamingSource::stop() {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::lock_guard<std::mutex> lock{_mutex};
+    #endif
+    if(_state == Source::State::Playing || _state == Source::State::Paused)
+        reset();
+}
+
+void StreamingSource::seek(const std::size_t frame) {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::lock_guard<std::mutex> lock{_mutex};
+    #endif
+    const Source::State state = _state;
+
+    /* Drop everything queued and continue from the new position */
+    reset();
+    _importer.seek(frame);
+    if(state == Source::State::Initial || state == Source::State::Stopped) {
+        _state = state;
+        return;
+    }
+
+    refill();
+    if(_queued.empty()) return;
+    if(state == Source::State::Playing) _source.play();
+    _state = state;
+}
+
+void StreamingSource::update() {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::lock_guard<std::mutex> lock{_mutex};
+    #endif
+    updateInternal();
+}
+
+void StreamingSource::updateInternal() {
+    if(_state != Source::State::Playing) return;
+
+    /* Unqueue processed buffers from the front, refill them and append them
+       to the back */
+    for(Int processed = _source.processedBufferCount(); processed && !_queued.empty(); --processed) {
+        _source.unqueueBuffers({_buffers[_queued.front()]});
+        _free.push_back(_queued.front());
+        _queued.pop_front();
+    }
+    refill();
+
+    /* The source stops if it runs out of queued data before they are
+       refilled, resume it. If everything was played, stop for real. */
+    if(_source.state() == Source::State::Stopped) {
+        if(!_queued.empty()) _source.play();
+        else reset();
+    }
+}
+
+void StreamingSource::refill() {
+    while(!_free.empty() && !_finished) {
+        /* Read until the chunk is full or there are no more data. If
+           looping, rewind at the end, but not twice in a row to avoid
+           infinite loop on empty data. */
+        std::size_t size = 0;
+        bool rewound = false;
+        while(size != _chunk.size()) {
+            const std::size_t frames = _importer.read({_chunk.begin() + size, _chunk.size() - size});
+            if(frames) {
+                size += frames*_importer.frameSize();
+                rewound = false;
+            } else if(_looping && !rewound) {
+                _importer.seek(0);
+                rewound = true;
+            } else break;
+        }
+
+        if(!size) {
+            _finished = true;
+            break;
+        }
+
+        Buffer& buffer = _buffers[_free.back()];
+        buffer.setData(_format, Containers::ArrayReference<const void>{_chunk.begin(), size}, _frequency);
+        _source.queueBuffers({buffer});
+        _queued.push_back(_free.back());
+        _free.pop_back();
+    }
+}
+
+void StreamingSource::reset() {
+    /* All queued buffers are processed after stopping */
+    _source.stop();
+    while(!_queued.empty()) {
+        _source.unqueueBuffers({_buffers[_queued.front()]});
+        _free.push_back(_queued.front());
+        _queued.pop_front();
+    }
+
+    _importer.seek(0);
+    _finished = false;
+    _state = Source::State::Stopped;
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void StreamingSource::run() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    while(!_quit) {
+        updateInternal();
+        _condition.wait_for(lock, _interval);
+    }
+}
+#endif
+
+}}
@@ -0,0 +1,212 @@
+#ifndef Magnum_Audio_StreamingSource_h
+#define Magnum_Audio_StreamingSource_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Audio::StreamingSource
+ */
+
+#include <deque>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#include "Magnum/Audio/Buffer.h"
+#include "Magnum/Audio/Source.h"
+
+namespace Magnum { namespace Audio {
+
+/**
+@brief Streaming source
+
+Plays long tracks without decoding them into memory as a whole. Keeps a ring
+of small @ref Buffer "Buffers" queued in a @ref Source and refills the
+processed ones with next chunks read from an importer supporting
+@ref AbstractImporter::Feature::Streaming. The refilling is done on a
+background thread, which wakes up four times during playback of one buffer.
+If the queue runs dry (e.g. because the disk was too slow), the playback is
+resumed as soon as there are new data.
+
+## Usage
+
+The importer must be opened and must stay alive for the whole lifetime of the
+streaming source. Positioning and other properties are set through
+@ref source(), playback is controlled through @ref play(), @ref pause() and
+@ref stop() of this class, @ref seek() jumps to given position in the track.
+@code
+std::unique_ptr<Audio::AbstractImporter> importer = manager.instance("WavAudioImporter");
+importer->openFile("music.wav");
+
+Audio::StreamingSource music{*importer};
+music.setLooping(true)
+    .play();
+music.source().setGain(0.5f);
+@endcode
+
+With the default settings a 44.1 kHz stereo track takes only 96 kB of sample
+memory instead of over 10 MB per minute.
+
+@note On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" there is no background
+    thread and you need to call @ref update() periodically, e.g. every frame.
+*/
+class MAGNUM_AUDIO_EXPORT StreamingSource {
+    public:
+        /**
+         * @brief Constructor
+         * @param importer      Opened importer supporting
+         *      @ref AbstractImporter::Feature::Streaming
+         * @param bufferSize    Size of each buffer in bytes
+         * @param bufferCount   Count of buffers in the queue
+         *
+         * The @p bufferSize is rounded down to whole frames. Expects that
+         * @p bufferCount is at least `2`.
+         */
+        explicit StreamingSource(AbstractImporter& importer, std::size_t bufferSize = 32768, std::size_t bufferCount = 3);
+
+        /**
+         * @brief Destructor
+         *
+         * Stops the background thread and the playback.
+         */
+        ~StreamingSource();
+
+        /** @brief Copying is not allowed */
+        StreamingSource(const StreamingSource&) = delete;
+
+        /** @brief Moving is not allowed */
+        StreamingSource(StreamingSource&&) = delete;
+
+        /** @brief Copying is not allowed */
+        StreamingSource& operator=(const StreamingSource&) = delete;
+
+        /** @brief Moving is not allowed */
+        StreamingSource& operator=(StreamingSource&&) = delete;
+
+        /**
+         * @brief Underlying source
+         *
+         * Use it for setting up position, gain and other properties. Don't
+         * use it for controlling playback or attaching buffers.
+         */
+        Source& source() { return _source; }
+
+        /** @brief Whether the playback is looping */
+        bool isLooping() const { return _looping; }
+
+        /**
+         * @brief Set looping
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, the importer is seeked back to the beginning after reaching the end of its
+         * data. Default is `false`.
+         */
+        StreamingSource& setLooping(bool looping);
+
+        /**
+         * @brief Playback state
+         *
+         * Unlike @ref Source::state(), temporary stops caused by running out
+         * of queued data are reported as @ref Source::State::Playing.
+         */
+        Source::State state() const;
+
+        /**
+         * @brief Play
+         *
+         * Continues paused playback, otherwise starts playing from the
+         * beginning.
+         */
+        void play();
+
+        /** @brief Pause */
+        void pause();
+
+        /**
+         * @brief Stop
+         *
+         * Next call to @ref play() will start from the beginning.
+         */
+        void stop();
+
+        /**
+         * @brief Seek to given frame
+         *
+         * Drops all queued data and continues the playback (if any) from
+         * given frame. If stopped, next call to @ref play() will start from
+         * given frame. See @ref AbstractImporter::seek() for more
+         * information.
+         */
+        void seek(std::size_t frame);
+
+        /**
+         * @brief Refill processed buffers
+         *
+         * Called automatically from the background thread, call it
+         * periodically yourself on @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+         */
+        void update();
+
+    private:
+        void updateInternal();
+        void refill();
+        void reset();
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        void run();
+        #endif
+
+        AbstractImporter& _importer;
+        Buffer::Format _format;
+        UnsignedInt _frequency;
+        Containers::Array<char> _chunk;
+
+        /* Destroyed after the source */
+        std::vector<Buffer> _buffers;
+        Source _source;
+
+        /* Indices of queued buffers in the queue order and of buffers
+           waiting for being filled */
+        std::deque<std::size_t> _queued;
+        std::vector<std::size_t> _free;
+
+        Source::State _state;
+        bool _looping, _finished;
+
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        mutable std::mutex _mutex;
+        std::condition_variable _condition;
+        std::chrono::microseconds _interval;
+        bool _quit;
+        std::thread _thread;
+        #endif
+};
+
+}}
+
+#endif
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Directory.h>
@@ -37,10 +38,16 @@ struct AbstractImporterTest: TestSuite::Tester {
     explicit AbstractImporterTest();
 
     void openFile();
+    void streamingNotSupported();
+    void seekOutOfRange();
+    void dataView();
 };
 
 AbstractImporterTest::AbstractImporterTest() {
-    addTests({&AbstractImporterTest::openFile});
+    addTests({&AbstractImporterTest::openFile,
+              &AbstractImporterTest::streamingNotSupported,
+              &AbstractImporterTest::seekOutOfRange,
+              &AbstractImporterTest::dataView});
 }
 
 void AbstractImporterTest::openFile() {
@@ -71,6 +78,97 @@ void AbstractImporterTest::openFile() {
     CORRADE_VERIFY(importer.isOpened());
 }
 
+void AbstractImporterTest::streamingNotSupported() {
+    class Importer: public Audio::AbstractImporter {
+        private:
+            Features doFeatures() const override { return {}; }
+            bool doIsOpened() const override { return true; }
+            void doClose() override {}
+
+            Buffer::Format doFormat() const override { return {}; }
+            UnsignedInt doFrequency() const override { return {}; }
+            Corrade::Containers::Array<char> doData() override { return nullptr; }
+    };
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Importer importer;
+    char data[4];
+    CORRADE_COMPARE(importer.frameCount(), 0);
+    CORRADE_COMPARE(importer.read(data), 0);
+    importer.seek(0);
+    CORRADE_COMPARE(out.str(),
+        "Audio::AbstractImporter::frameCount(): feature not supported\n"
+        "Audio::AbstractImporter::read(): feature not supported\n"
+        "Audio::AbstractImporter::seek(): feature not supported\n");
+}
+
+void AbstractImporterTest::seekOutOfRange() {
+    class Importer: public Audio::AbstractImporter {
+        private:
+            Features doFeatures() const override { return Feature::Streaming; }
+            bool doIsOpened() const override { return true; }
+            void doClose() override {}
+
+            Buffer::Format doFormat() const override { return Buffer::Format::Stereo16; }
+            UnsignedInt doFrequency() const override { return {}; }
+            Corrade::Containers::Array<char> doData() override { return nullptr; }
+
+            std::size_t doFrameCount() const override { return 3; }
+            void doSeek(std::size_t) override {}
+    };
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Importer importer;
+    CORRADE_COMPARE(importer.frameSize(), 4);
+    importer.seek(3);
+    CORRADE_COMPARE(out.str(), "");
+    importer.seek(4);
+    CORRADE_COMPARE(out.str(), "Audio::AbstractImporter::seek(): frame 4 out of range for 3 frames\n");
+}
+
+void AbstractImporterTest::dataView() {
+    class Importer: public Audio::AbstractImporter {
+        public:
+            explicit Importer(): opened(true), dataCalls(0) {}
+
+        private:
+            Features doFeatures() const override { return {}; }
+            bool doIsOpened() const override { return opened; }
+            void doClose() override { opened = false; }
+
+            Buffer::Format doFormat() const override { return {}; }
+            UnsignedInt doFrequency() const override { return {}; }
+            Corrade::Containers::Array<char> doData() override {
+                ++dataCalls;
+                Containers::Array<char> data(3);
+                data[0] = 'a';
+                data[1] = 'b';
+                data[2] = 'c';
+                return data;
+            }
+
+        public:
+            bool opened;
+            Int dataCalls;
+    };
+
+    /* Default implementation copies the data once and keeps them */
+    Importer importer;
+    const Containers::ArrayReference<const char> data = importer.dataView();
+    CORRADE_COMPARE(data.size(), 3);
+    CORRADE_COMPARE(data[2], 'c');
+    CORRADE_VERIFY(importer.dataView().data() == data.data());
+    CORRADE_COMPARE(importer.dataCalls, 1);
+
+    /* The copy is released on close */
+    importer.close();
+    CORRADE_VERIFY(!importer.opened);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::AbstractImporterTest)
@@ -0,0 +1,118 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Audio/Mixer.h"
+
+namespace Magnum { namespace Audio { namespace Test {
+
+struct MixerTest: TestSuite::Tester {
+    explicit MixerTest();
+
+    void resample();
+    void resampleHalfStep();
+    void resampleEnd();
+    void resampleLooping();
+    void accumulate();
+    void convert();
+};
+
+MixerTest::MixerTest() {
+    addTests({&MixerTest::resample,
+              &MixerTest::resampleHalfStep,
+              &MixerTest::resampleEnd,
+              &MixerTest::resampleLooping,
+              &MixerTest::accumulate,
+              &MixerTest::convert});
+}
+
+void MixerTest::resample() {
+    std::vector<Float> samples(32);
+    for(std::size_t i = 0; i != samples.size(); ++i) samples[i] = Float(i);
+
+    std::vector<Float> out(13);
+    const double position = Implementation::mixerResample(out.data(), out.size(), samples.data(), samples.size(), 2.0, 1.0, false);
+    CORRADE_COMPARE(position, 15.0);
+    for(std::size_t i = 0; i != out.size(); ++i)
+        CORRADE_COMPARE(out[i], Float(i + 2));
+}
+
+void MixerTest::resampleHalfStep() {
+    std::vector<Float> samples(32);
+    for(std::size_t i = 0; i != samples.size(); ++i) samples[i] = Float(i*2);
+
+    std::vector<Float> out(17);
+    const double position = Implementation::mixerResample(out.data(), out.size(), samples.data(), samples.size(), 0.5, 0.5, false);
+    CORRADE_COMPARE(position, 9.0);
+    for(std::size_t i = 0; i != out.size(); ++i)
+        CORRADE_COMPARE(out[i], Float(i + 1));
+}
+
+void MixerTest::resampleEnd() {
+    const Float samples[]{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+
+    /* Interpolated to silence after the last sample, then zero-filled */
+    std::vector<Float> out(10, 7.0f);
+    const double position = Implementation::mixerResample(out.data(), out.size(), samples, 6, 2.5, 1.0, false);
+    CORRADE_VERIFY(position >= 6.0);
+    const Float expected[]{3.5f, 4.5f, 5.5f, 3.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        CORRADE_COMPARE(out[i], expected[i]);
+}
+
+void MixerTest::resampleLooping() {
+    const Float samples[]{0.0f, 1.0f, 2.0f, 3.0f};
+
+    std::vector<Float> out(10);
+    const double position = Implementation::mixerResample(out.data(), out.size(), samples, 4, 1.5, 1.0, true);
+    CORRADE_COMPARE(position, 3.5);
+    const Float expected[]{1.5f, 2.5f, 1.5f, 0.5f, 1.5f, 2.5f, 1.5f, 0.5f, 1.5f, 2.5f};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        CORRADE_COMPARE(out[i], expected[i]);
+}
+
+void MixerTest::accumulate() {
+    std::vector<Float> out(10, 1.0f);
+    const std::vector<Float> in(10, 2.0f);
+
+    Implementation::mixerAccumulate(out.data(), in.data(), out.size(), 0.0f, 1.0f);
+    const Float expected[]{1.0f, 1.2f, 1.4f, 1.6f, 1.8f, 2.0f, 2.2f, 2.4f, 2.6f, 2.8f};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        CORRADE_COMPARE(out[i], expected[i]);
+}
+
+void MixerTest::convert() {
+    const Float in[]{0.0f, 0.5f, -0.5f, 1.0f, -1.0f, 2.0f, -3.0f, 0.25f, 1.0f/32767.0f, -1.0f/32767.0f};
+
+    std::vector<Short> out(10);
+    Implementation::mixerConvert(out.data(), in, out.size());
+    CORRADE_COMPARE(out, (std::vector<Short>{0, 16384, -16384, 32767, -32767, 32767, -32767, 8192, 1, -1}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Audio::Test::MixerTest)
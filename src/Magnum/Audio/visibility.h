@@ -38,5 +38,6 @@
 #else
     #define MAGNUM_AUDIO_EXPORT CORRADE_VISIBILITY_STATIC
 #endif
+#define MAGNUM_AUDIO_LOCAL CORRADE_VISIBILITY_LOCAL
 
 #endif
@@ -33,6 +33,10 @@
 #include "Implementation/State.h"
 #include "Implementation/BufferState.h"
 #include "Implementation/DebugState.h"
+#include "Implementation/DeletionState.h"
+#include "Implementation/MemoryState.h"
+#include "Implementation/MeshState.h"
+#include "Implementation/NamePoolState.h"
 
 namespace Magnum {
 
@@ -162,23 +166,25 @@ void Buffer::copy(Buffer& read, Buffer& write, const GLintptr readOffset, const
 }
 #endif
 
-Buffer::Buffer(const TargetHint targetHint): _targetHint{targetHint}
+Buffer::Buffer(const TargetHint targetHint): _targetHint{targetHint},
     #ifdef CORRADE_TARGET_NACL
-    , _mappedBuffer{nullptr}
+    _mappedBuffer{nullptr},
     #endif
+    _memoryUsage{0}, _memoryLabel{0}
 {
     (this->*Context::current()->state().buffer->createImplementation)();
     CORRADE_INTERNAL_ASSERT(_id != Implementation::State::DisengagedBinding);
+    Context::current()->state().memory->create(Context::MemoryObjectType::Buffer);
 }
 
 void Buffer::createImplementationDefault() {
-    glGenBuffers(1, &_id);
+    _id = Context::current()->state().namePool->buffers.take();
     _created = false;
 }
 
 #ifndef MAGNUM_TARGET_GLES
 void Buffer::createImplementationDSA() {
-    glCreateBuffers(1, &_id);
+    _id = Context::current()->state().namePool->buffers.take();
     _created = true;
 }
 #endif
@@ -193,7 +199,17 @@ Buffer::~Buffer() {
     for(std::size_t i = 1; i != Implementation::BufferState::TargetCount; ++i)
         if(bindings[i] == _id) bindings[i] = 0;
 
-    glDeleteBuffers(1, &_id);
+    /* Deleting the buffer detaches it from vertex attributes */
+    Context::current()->state().mesh->invalidateVertexAttributes(_id);
+
+    Context::current()->state().memory->destroy(Context::MemoryObjectType::Buffer, _memoryLabel, _memoryUsage);
+
+    /* Never bound, so it's just a reserved name which can be reused */
+    if(!_created && Context::current()->state().namePool->buffers.recycle(_id))
+        return;
+
+    if(!Context::current()->state().deletion->deferBuffer(_id))
+        glDeleteBuffers(1, &_id);
 }
 
 inline void Buffer::createIfNotAlready() {
@@ -224,6 +240,7 @@ Buffer& Buffer::setLabelInternal(const Containers::ArrayReference<const char> la
     #else
     Context::current()->state().debug->labelImplementation(GL_BUFFER_KHR, _id, label);
     #endif
+    _memoryLabel = Context::current()->state().memory->relabel(_memoryLabel, label, _memoryUsage);
     return *this;
 }
 
@@ -265,6 +282,7 @@ Buffer& Buffer::bind(const Target target, const UnsignedInt index, const GLintpt
     CORRADE_INTERNAL_ASSERT(target == Target::AtomicCounter || target == Target::ShaderStorage || target == Target::Uniform || GLenum(target) == GL_TRANSFORM_FEEDBACK_BUFFER);
     #endif
     glBindBufferRange(GLenum(target), index, _id, offset, size);
+    _created = true;
     return *this;
 }
 
@@ -273,6 +291,7 @@ Buffer& Buffer::bind(const Target target, const UnsignedInt index) {
     CORRADE_INTERNAL_ASSERT(target == Target::AtomicCounter || target == Target::ShaderStorage || target == Target::Uniform || GLenum(target) == GL_TRANSFORM_FEEDBACK_BUFFER);
     #endif
     glBindBufferBase(GLenum(target), index, _id);
+    _created = true;
     return *this;
 }
 #endif
@@ -288,12 +307,38 @@ Int Buffer::size() {
 }
 
 Buffer& Buffer::setData(const Containers::ArrayReference<const void> data, const BufferUsage usage) {
-    (this->*Context::current()->state().buffer->dataImplementation)(data.size(), data, usage);
+    Implementation::State& state = Context::current()->state();
+    if(state.statisticsEnabled && data.data())
+        state.statistics.bufferUploadBytes += data.size();
+
+    (this->*state.buffer->dataImplementation)(data.size(), data, usage);
+    setMemoryUsage(data.size());
     return *this;
 }
 
+#ifndef MAGNUM_TARGET_GLES
+Buffer& Buffer::setStorage(const Containers::ArrayReference<const void> data, const StorageFlags flags) {
+    Implementation::State& state = Context::current()->state();
+    if(state.statisticsEnabled && data.data())
+        state.statistics.bufferUploadBytes += data.size();
+
+    (this->*state.buffer->storageImplementation)(data.size(), data, flags);
+    setMemoryUsage(data.size());
+    return *this;
+}
+#endif
+
+void Buffer::setMemoryUsage(const std::size_t size) {
+    Context::current()->state().memory->resize(Context::MemoryObjectType::Buffer, _memoryLabel, _memoryUsage, size);
+    _memoryUsage = size;
+}
+
 Buffer& Buffer::setSubData(const GLintptr offset, const Containers::ArrayReference<const void> data) {
-    (this->*Context::current()->state().buffer->subDataImplementation)(offset, data.size(), data);
+    Implementation::State& state = Context::current()->state();
+    if(state.statisticsEnabled)
+        state.statistics.bufferUploadBytes += data.size();
+
+    (this->*state.buffer->subDataImplementation)(offset, data.size(), data);
     return *this;
 }
 
@@ -471,6 +516,21 @@ void Buffer::dataImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, Buffe
 }
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+void Buffer::storageImplementationDefault(GLsizeiptr size, const GLvoid* data, StorageFlags flags) {
+    glBufferStorage(GLenum(bindSomewhereInternal(_targetHint)), size, data, GLbitfield(flags));
+}
+
+void Buffer::storageImplementationDSA(const GLsizeiptr size, const GLvoid* const data, const StorageFlags flags) {
+    glNamedBufferStorage(_id, size, data, GLbitfield(flags));
+}
+
+void Buffer::storageImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, StorageFlags flags) {
+    _created = true;
+    glNamedBufferStorageEXT(_id, size, data, GLbitfield(flags));
+}
+#endif
+
 void Buffer::subDataImplementationDefault(GLintptr offset, GLsizeiptr size, const GLvoid* data) {
     glBufferSubData(GLenum(bindSomewhereInternal(_targetHint)), offset, size, data);
 }
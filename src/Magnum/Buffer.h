@@ -210,6 +210,15 @@ functions do nothing.
  */
 class MAGNUM_EXPORT Buffer: public AbstractObject {
     friend Implementation::BufferState;
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    friend AbstractShaderProgram;
+    #endif
+    #ifndef MAGNUM_TARGET_GLES2
+    friend TextureUploadQueue;
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    friend OcclusionCuller;
+    #endif
 
     public:
         /**
@@ -554,9 +563,29 @@ class MAGNUM_EXPORT Buffer: public AbstractObject {
              * before mapping.
              */
             #ifndef MAGNUM_TARGET_GLES2
-            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT
+            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT,
             #else
-            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT_EXT
+            Unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT_EXT,
+            #endif
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * Allow the buffer to stay mapped while it is used by the GL. The
+             * buffer storage must be allocated with
+             * @ref StorageFlag::MapPersistent using @ref setStorage().
+             * @requires_gl44 Extension @extension{ARB,buffer_storage}
+             * @requires_gl Persistent mapping is not available in OpenGL ES.
+             */
+            Persistent = GL_MAP_PERSISTENT_BIT,
+
+            /**
+             * Make writes to persistently mapped buffer visible to the GL
+             * without explicit flushing. The buffer storage must be allocated
+             * with @ref StorageFlag::MapCoherent using @ref setStorage().
+             * @requires_gl44 Extension @extension{ARB,buffer_storage}
+             * @requires_gl Coherent mapping is not available in OpenGL ES.
+             */
+            Coherent = GL_MAP_COHERENT_BIT
             #endif
         };
 
@@ -570,6 +599,46 @@ class MAGNUM_EXPORT Buffer: public AbstractObject {
          */
         typedef Containers::EnumSet<MapFlag> MapFlags;
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Buffer storage flag
+         *
+         * @see @ref StorageFlags, @ref setStorage()
+         * @requires_gl44 Extension @extension{ARB,buffer_storage}
+         * @requires_gl Immutable buffer storage is not available in OpenGL
+         *      ES.
+         */
+        enum class StorageFlag: GLbitfield {
+            /** Allow the buffer to be mapped for reading. */
+            MapRead = GL_MAP_READ_BIT,
+
+            /** Allow the buffer to be mapped for writing. */
+            MapWrite = GL_MAP_WRITE_BIT,
+
+            /** Allow the buffer to be mapped persistently. */
+            MapPersistent = GL_MAP_PERSISTENT_BIT,
+
+            /** Allow the buffer to be mapped coherently. */
+            MapCoherent = GL_MAP_COHERENT_BIT,
+
+            /** Allow the buffer contents to be updated with @ref setSubData(). */
+            DynamicStorage = GL_DYNAMIC_STORAGE_BIT,
+
+            /** Prefer to allocate the storage in client memory. */
+            ClientStorage = GL_CLIENT_STORAGE_BIT
+        };
+
+        /**
+         * @brief Buffer storage flags
+         *
+         * @see @ref setStorage()
+         * @requires_gl44 Extension @extension{ARB,buffer_storage}
+         * @requires_gl Immutable buffer storage is not available in OpenGL
+         *      ES.
+         */
+        typedef Containers::EnumSet<StorageFlag> StorageFlags;
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES
         /**
          * @brief Minimal supported mapping alignment
@@ -933,6 +1002,17 @@ class MAGNUM_EXPORT Buffer: public AbstractObject {
          */
         Int size();
 
+        /**
+         * @brief Estimated GPU memory usage
+         *
+         * Size in bytes passed to the last call to @ref setData() or
+         * @ref setStorage(), `0` if the buffer has no data store yet. Unlike
+         * @ref size() doesn't query the driver. Accounted as
+         * @ref Context::MemoryObjectType::Buffer in
+         * @ref Context::memoryUsage().
+         */
+        std::size_t memoryUsage() const { return _memoryUsage; }
+
         #ifndef MAGNUM_TARGET_GLES
         /**
          * @brief Buffer data
@@ -1000,6 +1080,31 @@ class MAGNUM_EXPORT Buffer: public AbstractObject {
             return *this;
         }
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set immutable buffer storage
+         * @param data      Data
+         * @param flags     Storage flags
+         * @return Reference to self (for method chaining)
+         *
+         * After calling this function the buffer size can't be changed and
+         * @ref setData() can't be used anymore. Contents of the buffer can be
+         * updated with @ref setSubData() only if
+         * @ref StorageFlag::DynamicStorage is set, otherwise only through
+         * mapping. If neither @extension{ARB,direct_state_access} (part of
+         * OpenGL 4.5) nor @extension{EXT,direct_state_access} is available,
+         * the buffer is bound to hinted target before the operation (if not
+         * already).
+         * @see @ref setTargetHint(), @fn_gl2{NamedBufferStorage,BufferStorage},
+         *      @fn_gl_extension{NamedBufferStorage,EXT,direct_state_access},
+         *      eventually @fn_gl{BindBuffer} and @fn_gl{BufferStorage}
+         * @requires_gl44 Extension @extension{ARB,buffer_storage}
+         * @requires_gl Immutable buffer storage is not available in OpenGL
+         *      ES, use @ref setData() instead.
+         */
+        Buffer& setStorage(Containers::ArrayReference<const void> data, StorageFlags flags);
+        #endif
+
         /**
          * @brief Set buffer subdata
          * @param offset    Offset in the buffer
@@ -1213,6 +1318,7 @@ class MAGNUM_EXPORT Buffer: public AbstractObject {
         void MAGNUM_LOCAL createIfNotAlready();
 
         Buffer& setLabelInternal(Containers::ArrayReference<const char> label);
+        void MAGNUM_LOCAL setMemoryUsage(std::size_t size);
 
         #ifndef MAGNUM_TARGET_GLES
         void subDataInternal(GLintptr offset, GLsizeiptr size, GLvoid* data);
@@ -1236,6 +1342,12 @@ class MAGNUM_EXPORT Buffer: public AbstractObject {
         void MAGNUM_LOCAL dataImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, BufferUsage usage);
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        void MAGNUM_LOCAL storageImplementationDefault(GLsizeiptr size, const GLvoid* data, StorageFlags flags);
+        void MAGNUM_LOCAL storageImplementationDSA(GLsizeiptr size, const GLvoid* data, StorageFlags flags);
+        void MAGNUM_LOCAL storageImplementationDSAEXT(GLsizeiptr size, const GLvoid* data, StorageFlags flags);
+        #endif
+
         void MAGNUM_LOCAL subDataImplementationDefault(GLintptr offset, GLsizeiptr size, const GLvoid* data);
         #ifndef MAGNUM_TARGET_GLES
         void MAGNUM_LOCAL subDataImplementationDSA(GLintptr offset, GLsizeiptr size, const GLvoid* data);
@@ -1282,9 +1394,14 @@ class MAGNUM_EXPORT Buffer: public AbstractObject {
         void* _mappedBuffer;
         #endif
         bool _created; /* see createIfNotAlready() for details */
+        std::size_t _memoryUsage;
+        UnsignedInt _memoryLabel;
 };
 
 CORRADE_ENUMSET_OPERATORS(Buffer::MapFlags)
+#ifndef MAGNUM_TARGET_GLES
+CORRADE_ENUMSET_OPERATORS(Buffer::StorageFlags)
+#endif
 
 /** @debugoperatorclassenum{Magnum::Buffer,Magnum::Buffer::TargetHint} */
 Debug MAGNUM_EXPORT operator<<(Debug debug, Buffer::TargetHint value);
@@ -1298,7 +1415,7 @@ inline Buffer::Buffer(Buffer&& other) noexcept: _id{other._id}, _targetHint{othe
     #ifdef CORRADE_TARGET_NACL
     _mappedBuffer{other._mappedBuffer},
     #endif
-     _created{other._created}
+     _created{other._created}, _memoryUsage{other._memoryUsage}, _memoryLabel{other._memoryLabel}
 {
     other._id = 0;
     #ifdef CORRADE_TARGET_NACL
@@ -1314,6 +1431,8 @@ inline Buffer& Buffer::operator=(Buffer&& other) noexcept {
     swap(_mappedBuffer, other._mappedBuffer);
     #endif
     swap(_created, other._created);
+    swap(_memoryUsage, other._memoryUsage);
+    swap(_memoryLabel, other._memoryLabel);
     return *this;
 }
 
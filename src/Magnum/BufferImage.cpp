@@ -32,9 +32,32 @@ template<UnsignedInt dimensions> BufferImage<dimensions>::BufferImage(ColorForma
     _buffer.setData({data, dataSize(size)}, usage);
 }
 
+template<UnsignedInt dimensions> BufferImage<dimensions>::BufferImage(const PixelStorage& storage, ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, const void* data, BufferUsage usage): AbstractImage(storage, format, type), _size(size), _buffer(Buffer::TargetHint::PixelPack) {
+    _buffer.setData({data, dataSize(size)}, usage);
+}
+
 template<UnsignedInt dimensions> BufferImage<dimensions>::BufferImage(ColorFormat format, ColorType type): AbstractImage(format, type), _buffer(Buffer::TargetHint::PixelPack) {}
 
+template<UnsignedInt dimensions> BufferImage<dimensions>::BufferImage(const PixelStorage& storage, ColorFormat format, ColorType type): AbstractImage(storage, format, type), _buffer(Buffer::TargetHint::PixelPack) {}
+
+template<UnsignedInt dimensions> BufferImage<dimensions>::BufferImage(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, Buffer&& buffer) noexcept: AbstractImage(format, type), _size(size), _buffer(std::move(buffer)) {}
+
+template<UnsignedInt dimensions> BufferImage<dimensions>::BufferImage(const PixelStorage& storage, ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, Buffer&& buffer) noexcept: AbstractImage(storage, format, type), _size(size), _buffer(std::move(buffer)) {}
+
+template<UnsignedInt dimensions> Buffer BufferImage<dimensions>::release() {
+    Buffer buffer{Buffer::TargetHint::PixelPack};
+    using std::swap;
+    swap(buffer, _buffer);
+    _size = {};
+    return buffer;
+}
+
 template<UnsignedInt dimensions> void BufferImage<dimensions>::setData(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, const void* data, BufferUsage usage) {
+    setData({}, format, type, size, data, usage);
+}
+
+template<UnsignedInt dimensions> void BufferImage<dimensions>::setData(const PixelStorage& storage, ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, const void* data, BufferUsage usage) {
+    _storage = storage;
     _format = format;
     _type = type;
     _size = size;
@@ -66,6 +66,20 @@ template<UnsignedInt dimensions> class BufferImage: public AbstractImage {
          */
         explicit BufferImage(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, const void* data, BufferUsage usage);
 
+        /**
+         * @brief Construct with custom pixel storage
+         * @param storage           Pixel storage parameters
+         * @param format            Format of pixel data
+         * @param type              Data type of pixel data
+         * @param size              Image size
+         * @param data              Image data
+         * @param usage             Image buffer usage
+         *
+         * The buffer is filled with @ref PixelStorage::dataSize() bytes of
+         * @p data, i.e. including all skipped pixels, rows and images.
+         */
+        explicit BufferImage(const PixelStorage& storage, ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, const void* data, BufferUsage usage);
+
         /**
          * @brief Constructor
          * @param format            Format of pixel data
@@ -76,6 +90,41 @@ template<UnsignedInt dimensions> class BufferImage: public AbstractImage {
          */
         /*implicit*/ BufferImage(ColorFormat format, ColorType type);
 
+        /**
+         * @brief Construct with custom pixel storage and without data
+         * @param storage           Pixel storage parameters
+         * @param format            Format of pixel data
+         * @param type              Data type of pixel data
+         *
+         * Useful for reading into a sub-rectangle of a buffer, e.g. using
+         * @ref AbstractFramebuffer::read().
+         */
+        explicit BufferImage(const PixelStorage& storage, ColorFormat format, ColorType type);
+
+        /**
+         * @brief Construct from existing buffer
+         * @param format            Format of pixel data
+         * @param type              Data type of pixel data
+         * @param size              Image size
+         * @param buffer            Buffer with image data
+         *
+         * Takes over an existing buffer, for example one recycled from a
+         * pool using @ref release(), instead of allocating a new one. The
+         * buffer is expected to be at least @ref dataSize() "dataSize(size)"
+         * bytes large, its contents are not touched.
+         */
+        explicit BufferImage(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, Buffer&& buffer) noexcept;
+
+        /**
+         * @brief Construct from existing buffer with custom pixel storage
+         *
+         * Similar to @ref BufferImage(ColorFormat, ColorType, const VectorTypeFor<dimensions, Int>&, Buffer&&),
+         * the buffer can for example contain the whole video frame with
+         * padded rows or a big atlas and the image describes only its
+         * sub-rectangle.
+         */
+        explicit BufferImage(const PixelStorage& storage, ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, Buffer&& buffer) noexcept;
+
         /** @brief Copying is not allowed */
         BufferImage(const BufferImage<dimensions>&) = delete;
 
@@ -99,6 +148,16 @@ template<UnsignedInt dimensions> class BufferImage: public AbstractImage {
         /** @brief Image buffer */
         Buffer& buffer() { return _buffer; }
 
+        /**
+         * @brief Release image buffer
+         *
+         * Releases the ownership of the buffer and resets the size to zero.
+         * The buffer can be then reused for another image, see
+         * @ref BufferImage(ColorFormat, ColorType, const VectorTypeFor<dimensions, Int>&, Buffer&&).
+         * The image is left with new empty buffer.
+         */
+        Buffer release();
+
         /**
          * @brief Set image data
          * @param format            Format of pixel data
@@ -108,13 +167,22 @@ template<UnsignedInt dimensions> class BufferImage: public AbstractImage {
          * @param usage             Image buffer usage
          *
          * Updates the image buffer with given data. The data are not deleted
-         * after filling the buffer.
+         * after filling the buffer. Pixel storage is reset to default.
          * @see @ref Buffer::setData()
          * @todo Make it more flexible (usable with
          *      @extension{ARB,buffer_storage}, avoiding relocations...)
          */
         void setData(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, const void* data, BufferUsage usage);
 
+        /**
+         * @brief Set image data with custom pixel storage
+         *
+         * Similar to @ref setData(ColorFormat, ColorType, const VectorTypeFor<dimensions, Int>&, const void*, BufferUsage),
+         * fills the buffer with @ref PixelStorage::dataSize() bytes of
+         * @p data.
+         */
+        void setData(const PixelStorage& storage, ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, const void* data, BufferUsage usage);
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         /**
          * @copybrief setData(ColorFormat, ColorType, const VectorTypeFor<dimensions, Int>&, const void*, BufferUsage)
@@ -0,0 +1,119 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "BufferReadbackQueue.h"
+
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Renderer.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+BufferReadbackQueue::BufferReadbackQueue(const UnsignedInt frameCount): _next{0}, _pendingCount{0} {
+    CORRADE_ASSERT(frameCount,
+        "BufferReadbackQueue: expected at least one frame", );
+
+    _slots.resize(frameCount);
+
+    #ifndef MAGNUM_TARGET_GLES
+    _sync = Context::current()->isExtensionSupported<Extensions::GL::ARB::sync>();
+    #else
+    _sync = true;
+    #endif
+}
+
+BufferReadbackQueue::~BufferReadbackQueue() = default;
+
+GLsizeiptr BufferReadbackQueue::pendingSize() const {
+    return _pendingCount ? oldest().size : 0;
+}
+
+bool BufferReadbackQueue::read(Buffer& buffer, const GLintptr offset, const GLsizeiptr size) {
+    if(_pendingCount == _slots.size()) return false;
+
+    /* Reallocate the staging buffer only if it's not large enough */
+    Slot& slot = _slots[_next];
+    if(slot.capacity < size) {
+        slot.buffer.setData({nullptr, std::size_t(size)}, BufferUsage::StreamRead);
+        slot.capacity = size;
+    }
+
+    Buffer::copy(buffer, slot.buffer, offset, 0, size);
+    slot.size = size;
+    if(_sync) slot.fence.reset(new Fence);
+
+    _next = (_next + 1)%_slots.size();
+    ++_pendingCount;
+    return true;
+}
+
+bool BufferReadbackQueue::tryGet(const Containers::ArrayReference<char> data) {
+    Slot& slot = oldest();
+
+    /* Without fences assume the oldest readback is done when all frames
+       are in flight */
+    if(!_pendingCount || (_sync ? !slot.fence->isSignaled() : _pendingCount != _slots.size()))
+        return false;
+
+    copy(slot, data);
+    return true;
+}
+
+bool BufferReadbackQueue::get(const Containers::ArrayReference<char> data) {
+    if(!_pendingCount) return false;
+
+    /* The fence is waited on without the flush flag, so make sure it gets
+       submitted, otherwise the wait might never end */
+    Slot& slot = oldest();
+    if(_sync) {
+        Renderer::flush();
+        while(!slot.fence->clientWait(std::chrono::milliseconds{1})) {}
+    } else Renderer::finish();
+
+    copy(slot, data);
+    return true;
+}
+
+void BufferReadbackQueue::copy(Slot& slot, const Containers::ArrayReference<char> data) {
+    CORRADE_ASSERT(data.size() >= std::size_t(slot.size),
+        "BufferReadbackQueue: expected at least" << slot.size << "bytes for the data but got" << data.size(), );
+
+    if(slot.size) {
+        const void* mapped = slot.buffer.map(0, slot.size, Buffer::MapFlag::Read);
+        std::memcpy(data.data(), mapped, slot.size);
+        CORRADE_INTERNAL_ASSERT_OUTPUT(slot.buffer.unmap());
+    }
+
+    slot.fence.reset();
+    --_pendingCount;
+}
+
+}
+#endif
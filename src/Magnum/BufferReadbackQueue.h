@@ -0,0 +1,182 @@
+#ifndef Magnum_BufferReadbackQueue_h
+#define Magnum_BufferReadbackQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::BufferReadbackQueue
+ */
+
+#include <memory>
+#include <vector>
+#include <Corrade/Containers/ArrayReference.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Fence.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+/**
+@brief Asynchronous buffer readback queue
+
+@ref Buffer::data() and @ref Buffer::subData() wait until all commands
+writing to the buffer are done and the data are transferred to client
+memory, which stalls the pipeline when reading results of transform feedback
+or GPU simulation. This class instead copies the data into a ring of staging
+buffers using @ref Buffer::copy(), each guarded with a @ref Fence. The copy
+finishes asynchronously a few frames later and the data are then mapped and
+copied into memory provided by the caller. Example usage for consuming
+particle positions computed with transform feedback:
+@code
+BufferReadbackQueue queue;
+
+// each frame, after the simulation step
+if(!queue.read(positions, 0, particleCount*sizeof(Vector3))) {
+    // all readbacks still pending, results of this frame dropped
+}
+
+std::vector<Vector3> result(queue.pendingSize()/sizeof(Vector3));
+if(queue.tryGet({reinterpret_cast<char*>(result.data()), result.size()*sizeof(Vector3)})) {
+    // use results from a previous frame...
+}
+@endcode
+
+The frame count specifies how many readbacks can be in flight. If
+@extension{ARB,sync} is not available, the readback is considered completed
+when all other frames are in flight, which still avoids the stall in most
+cases. Staging buffers are reallocated only if the read size grows.
+@requires_gl31 Extension @extension{ARB,copy_buffer}
+@requires_gles30 Buffer copying is not available in OpenGL ES 2.0.
+@requires_webgl20 Buffer mapping is not available in WebGL.
+@see @ref FramebufferReadbackQueue
+*/
+class MAGNUM_EXPORT BufferReadbackQueue {
+    public:
+        /**
+         * @brief Constructor
+         * @param frameCount    Count of readbacks in flight
+         */
+        explicit BufferReadbackQueue(UnsignedInt frameCount = 3);
+
+        ~BufferReadbackQueue();
+
+        /** @brief Copying is not allowed */
+        BufferReadbackQueue(const BufferReadbackQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        BufferReadbackQueue(BufferReadbackQueue&&) = delete;
+
+        /** @brief Copying is not allowed */
+        BufferReadbackQueue& operator=(const BufferReadbackQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        BufferReadbackQueue& operator=(BufferReadbackQueue&&) = delete;
+
+        /** @brief Count of readbacks in flight */
+        UnsignedInt frameCount() const { return _slots.size(); }
+
+        /**
+         * @brief Count of pending readbacks
+         *
+         * Including completed ones not yet retrieved using @ref tryGet() or
+         * @ref get().
+         */
+        UnsignedInt pendingCount() const { return _pendingCount; }
+
+        /**
+         * @brief Size of oldest pending readback
+         *
+         * Size of memory needed by next @ref tryGet() or @ref get(), `0` if
+         * there are no pending readbacks.
+         */
+        GLsizeiptr pendingSize() const;
+
+        /**
+         * @brief Issue buffer readback
+         * @param buffer    Buffer to read from
+         * @param offset    Offset in the buffer
+         * @param size      Data size
+         * @return `False` if all readbacks are pending, `true` otherwise
+         *
+         * Copies given range of @p buffer into a staging buffer, doesn't
+         * wait for the commands writing to @p buffer to finish.
+         * @see @ref Buffer::copy()
+         */
+        bool read(Buffer& buffer, GLintptr offset, GLsizeiptr size);
+
+        /**
+         * @brief Try to get oldest completed readback
+         * @return `False` if there is no pending readback or it is not
+         *      completed yet, `true` otherwise
+         *
+         * If the oldest readback is completed, maps its staging buffer,
+         * copies the data into @p data and makes the slot available for
+         * next @ref read(). Never blocks. Expects that @p data is at least
+         * @ref pendingSize() large.
+         * @see @ref Buffer::map(), @ref Fence::isSignaled()
+         */
+        bool tryGet(Containers::ArrayReference<char> data);
+
+        /**
+         * @brief Get oldest readback
+         * @return `False` if there is no pending readback, `true` otherwise
+         *
+         * Like @ref tryGet(), but if the oldest readback is not completed
+         * yet, waits for it. Useful for draining the queue.
+         * @see @ref Fence::clientWait(), @ref Renderer::finish()
+         */
+        bool get(Containers::ArrayReference<char> data);
+
+    private:
+        struct Slot {
+            explicit Slot(): buffer{Buffer::TargetHint::CopyWrite}, capacity{0}, size{0} {}
+
+            Buffer buffer;
+            std::unique_ptr<Fence> fence;
+            GLsizeiptr capacity, size;
+        };
+
+        Slot& oldest() {
+            return _slots[(_next + _slots.size() - _pendingCount)%_slots.size()];
+        }
+
+        const Slot& oldest() const {
+            return _slots[(_next + _slots.size() - _pendingCount)%_slots.size()];
+        }
+
+        void copy(Slot& slot, Containers::ArrayReference<char> data);
+
+        std::vector<Slot> _slots;
+        UnsignedInt _next, _pendingCount;
+        bool _sync;
+};
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -0,0 +1,157 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BufferRing.h"
+
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+
+namespace Magnum {
+
+namespace {
+
+/* The region size doesn't need to be a multiple of the alignment, so the
+   offset has to be aligned in the whole buffer and not just in the region */
+inline GLintptr alignedOffset(const GLintptr regionOffset, const GLintptr offset, const GLsizeiptr alignment) {
+    return (regionOffset + offset + alignment - 1)/alignment*alignment - regionOffset;
+}
+
+}
+
+BufferRing::BufferRing(const Buffer::TargetHint targetHint, const GLsizeiptr size, const UnsignedInt frameCount): _buffer{targetHint}, _size{size}, _frameCount{frameCount}, _frame{frameCount - 1}, _offset{0}, _persistent{false}, _sync{true}, _inFrame{false}, _storage{nullptr}, _data{nullptr}, _fences(frameCount, nullptr) {
+    CORRADE_ASSERT(frameCount, "BufferRing::BufferRing(): frame count must not be zero", );
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(Context::current()->isExtensionSupported<Extensions::GL::ARB::buffer_storage>()) {
+        const Buffer::MapFlags flags = Buffer::MapFlag::Write|Buffer::MapFlag::Persistent|Buffer::MapFlag::Coherent;
+        _buffer.setStorage({nullptr, std::size_t(size*frameCount)}, Buffer::StorageFlag::MapWrite|Buffer::StorageFlag::MapPersistent|Buffer::StorageFlag::MapCoherent);
+        _storage = static_cast<char*>(_buffer.map(0, size*frameCount, flags));
+        _persistent = true;
+        return;
+    }
+
+    _sync = Context::current()->isExtensionSupported<Extensions::GL::ARB::sync>();
+    #endif
+
+    _buffer.setData({nullptr, std::size_t(size*frameCount)}, BufferUsage::StreamDraw);
+}
+
+BufferRing::~BufferRing() {
+    if(_persistent || (_inFrame && _data)) _buffer.unmap();
+    for(GLsync fence: _fences) if(fence) glDeleteSync(fence);
+}
+
+bool BufferRing::beginFrame() {
+    CORRADE_ASSERT(!_inFrame, "BufferRing::beginFrame(): previous frame not ended", false);
+
+    _frame = (_frame + 1) % _frameCount;
+    _offset = 0;
+    _inFrame = true;
+
+    /* Wait until the GPU is done with this region, but don't block forever
+       if the GPU hangs or the fence is broken */
+    bool synchronized = true;
+    if(GLsync& fence = _fences[_frame]) {
+        const GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+        if(result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED) {
+            if(result == GL_WAIT_FAILED)
+                Warning() << "BufferRing::beginFrame(): waiting for fence of frame" << _frame << "failed, falling back to synchronized mapping";
+            else
+                Warning() << "BufferRing::beginFrame(): fence of frame" << _frame << "not signaled after one second, falling back to synchronized mapping";
+            synchronized = false;
+        }
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    if(_persistent) {
+        /* There's no way to make the driver synchronize access to persistent
+           mapping, drain the whole pipeline instead */
+        if(!synchronized) glFinish();
+        _data = _storage + _frame*_size;
+        return synchronized;
+    }
+
+    Buffer::MapFlags flags = Buffer::MapFlag::Write|Buffer::MapFlag::FlushExplicit;
+
+    /* Fence guarding the region was waited on, no need to synchronize
+       again */
+    if(_sync && synchronized) flags |= Buffer::MapFlag::InvalidateRange|Buffer::MapFlag::Unsynchronized;
+
+    /* The wait failed, let the driver synchronize the mapping */
+    else if(_sync) flags |= Buffer::MapFlag::InvalidateRange;
+
+    /* No fences, orphan the whole storage on wrap-around and let the driver
+       deal with it */
+    else if(_frame == 0) {
+        _buffer.invalidateData();
+        flags |= Buffer::MapFlag::InvalidateBuffer;
+    } else flags |= Buffer::MapFlag::InvalidateRange|Buffer::MapFlag::Unsynchronized;
+
+    _data = static_cast<char*>(_buffer.map(_frame*_size, _size, flags));
+    return synchronized;
+}
+
+GLsizeiptr BufferRing::available(const GLsizeiptr alignment) const {
+    if(!_data) return 0;
+
+    const GLintptr offset = alignedOffset(_frame*_size, _offset, alignment);
+    return offset < _size ? _size - offset : 0;
+}
+
+auto BufferRing::allocate(const GLsizeiptr size, const GLsizeiptr alignment) -> Allocation {
+    CORRADE_ASSERT(_inFrame, "BufferRing::allocate(): no frame in progress", {});
+    CORRADE_ASSERT(_data, "BufferRing::allocate(): current frame was already flushed", {});
+
+    const GLintptr offset = alignedOffset(_frame*_size, _offset, alignment);
+    CORRADE_ASSERT(offset + size <= _size, "BufferRing::allocate(): can't allocate" << size << "bytes, only" << _size - offset << "left in the frame", {});
+
+    _offset = offset + size;
+    return {_data + offset, _frame*_size + offset};
+}
+
+void BufferRing::flush() {
+    CORRADE_ASSERT(_inFrame, "BufferRing::flush(): no frame in progress", );
+
+    if(!_persistent && _data) {
+        if(_offset) _buffer.flushMappedRange(0, _offset);
+        _buffer.unmap();
+    }
+
+    _data = nullptr;
+}
+
+void BufferRing::endFrame() {
+    CORRADE_ASSERT(_inFrame, "BufferRing::endFrame(): no frame in progress", );
+
+    flush();
+
+    if(_sync) _fences[_frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    _inFrame = false;
+}
+
+}
@@ -0,0 +1,212 @@
+#ifndef Magnum_BufferRing_h
+#define Magnum_BufferRing_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::BufferRing
+ */
+
+#include <vector>
+
+#include "Magnum/Buffer.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+/**
+@brief Ring buffer for streaming per-frame data
+
+Allocates one @ref Buffer divided into @ref frameCount() equally sized
+regions and hands out aligned sub-allocations from the region belonging to
+current frame. Each region is guarded with a fence after the frame is
+submitted, so the CPU never overwrites data the GPU is still reading from.
+Example usage:
+@code
+BufferRing ring{Buffer::TargetHint::Uniform, 1024*1024};
+
+// each frame
+ring.beginFrame();
+BufferRing::Allocation a = ring.allocate(sizeof(Matrix4), Buffer::uniformOffsetAlignment());
+*static_cast<Matrix4*>(a.data) = transformation;
+// ...
+ring.endFrame();
+
+ring.buffer().bind(Buffer::Target::Uniform, 0, a.offset, sizeof(Matrix4));
+@endcode
+
+## Performance optimizations
+
+If @extension{ARB,buffer_storage} (part of OpenGL 4.4) is available, the
+storage is allocated with @ref Buffer::setStorage() and mapped persistently and
+coherently only once, so there is no @fn_gl{MapBufferRange} /
+@fn_gl{UnmapBuffer} call per frame. Otherwise the frame region is mapped
+in @ref beginFrame() with @ref Buffer::MapFlag::Unsynchronized (the fence
+already ensured the GPU is done with it) and unmapped in @ref endFrame(). If
+fence sync objects are not available either (OpenGL 3.1 without
+@extension{ARB,sync}), the whole storage is orphaned with
+@ref Buffer::invalidateData() and @ref Buffer::MapFlag::InvalidateBuffer
+each time the ring wraps around.
+@requires_gl30 Extension @extension{ARB,map_buffer_range}
+@requires_gles30 Buffer mapping with fences is not available in OpenGL ES
+    2.0.
+@requires_webgl20 Buffer mapping is not available in WebGL.
+*/
+class MAGNUM_EXPORT BufferRing {
+    public:
+        /**
+         * @brief Sub-allocation
+         *
+         * @see @ref allocate()
+         */
+        struct Allocation {
+            /** @brief Mapped memory to write to */
+            void* data;
+
+            /**
+             * @brief Offset of the data in @ref buffer()
+             *
+             * Multiple of the alignment passed to @ref allocate(), even if
+             * the region size isn't.
+             */
+            GLintptr offset;
+        };
+
+        /**
+         * @brief Constructor
+         * @param targetHint    Target hint for the underlying buffer
+         * @param size          Size of one frame region in bytes
+         * @param frameCount    Count of frames in flight
+         *
+         * Allocates storage of @p size*@p frameCount bytes.
+         * @see @ref Buffer::setStorage(), @ref Buffer::setData()
+         */
+        explicit BufferRing(Buffer::TargetHint targetHint, GLsizeiptr size, UnsignedInt frameCount = 3);
+
+        /** @brief Copying is not allowed */
+        BufferRing(const BufferRing&) = delete;
+
+        /** @brief Moving is not allowed */
+        BufferRing(BufferRing&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Unmaps the buffer and deletes all pending fences.
+         * @see @fn_gl{DeleteSync}
+         */
+        ~BufferRing();
+
+        /** @brief Copying is not allowed */
+        BufferRing& operator=(const BufferRing&) = delete;
+
+        /** @brief Moving is not allowed */
+        BufferRing& operator=(BufferRing&&) = delete;
+
+        /** @brief Underlying buffer */
+        Buffer& buffer() { return _buffer; }
+
+        /** @brief Size of one frame region in bytes */
+        GLsizeiptr size() const { return _size; }
+
+        /** @brief Count of frames in flight */
+        UnsignedInt frameCount() const { return _frameCount; }
+
+        /** @brief Whether the buffer is persistently mapped */
+        bool isPersistent() const { return _persistent; }
+
+        /**
+         * @brief Space left in current frame region
+         *
+         * Count of bytes that can be allocated with given @p alignment in
+         * current frame. Returns `0` if there is no frame in progress or it
+         * was already flushed.
+         * @see @ref allocate()
+         */
+        GLsizeiptr available(GLsizeiptr alignment = 1) const;
+
+        /**
+         * @brief Begin a frame
+         *
+         * Advances to next frame region, waits for its fence (if any) and,
+         * if the buffer is not persistently mapped, maps it. The wait is
+         * bounded to one second. If the fence isn't signaled by then or the
+         * wait fails, prints a warning, lets the driver synchronize the
+         * mapping (or calls @fn_gl{Finish} for persistently mapped buffer)
+         * and returns `false`. The frame is begun in both cases.
+         * @see @fn_gl{ClientWaitSync}, @ref Buffer::map()
+         */
+        bool beginFrame();
+
+        /**
+         * @brief Allocate a range in current frame region
+         * @param size      Size in bytes
+         * @param alignment Alignment of the offset, e.g.
+         *      @ref Buffer::uniformOffsetAlignment()
+         *
+         * Expects that @ref beginFrame() was called, that @ref flush() wasn't
+         * called since and that there is enough space left in current frame
+         * region.
+         */
+        Allocation allocate(GLsizeiptr size, GLsizeiptr alignment = 1);
+
+        /**
+         * @brief Make current frame data available to the GPU
+         *
+         * Unmaps the region if the buffer is not persistently mapped, so it
+         * can be used as a source for GL commands issued before
+         * @ref endFrame(), e.g. pixel unpack operations. No allocations are
+         * possible in current frame after calling this function. Called
+         * implicitly from @ref endFrame().
+         * @see @ref Buffer::flushMappedRange(), @ref Buffer::unmap()
+         */
+        void flush();
+
+        /**
+         * @brief End a frame
+         *
+         * Calls @ref flush() and inserts a fence guarding the region, so all
+         * commands issued until now that read from it are finished before it
+         * is reused.
+         * @see @fn_gl{FenceSync}, @ref Buffer::unmap()
+         */
+        void endFrame();
+
+    private:
+        Buffer _buffer;
+        GLsizeiptr _size;
+        UnsignedInt _frameCount, _frame;
+        GLintptr _offset;
+        bool _persistent, _sync, _inFrame;
+        char *_storage, *_data;
+        std::vector<GLsync> _fences;
+};
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
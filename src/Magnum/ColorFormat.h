@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Enum @ref Magnum::ColorFormat, @ref Magnum::ColorType
+ * @brief Enum @ref Magnum::ColorFormat, @ref Magnum::ColorType, @ref Magnum::CompressedColorFormat
  */
 
 #include "Magnum/Magnum.h"
@@ -491,12 +491,380 @@ enum class ColorType: GLenum {
     #endif
 };
 
+/**
+@brief Format of compressed image data
+
+Block-compressed formats for @ref CompressedImageReference and
+@ref Trade::CompressedImageData, uploaded to textures with
+@ref Texture::setCompressedImage() and others. The value is used also as
+internal format of the texture.
+@see @ref ColorFormat
+*/
+enum class CompressedColorFormat: GLenum {
+    /**
+     * S3TC DXT1 (BC1) compressed RGB, normalized unsigned.
+     * @requires_extension Extension @extension{EXT,texture_compression_s3tc}
+     * @requires_es_extension Extension @es_extension{EXT,texture_compression_s3tc}
+     */
+    RGBS3tcDxt1 = GL_COMPRESSED_RGB_S3TC_DXT1_EXT,
+
+    /**
+     * S3TC DXT1 (BC1) compressed RGBA, normalized unsigned.
+     * @requires_extension Extension @extension{EXT,texture_compression_s3tc}
+     * @requires_es_extension Extension @es_extension{EXT,texture_compression_s3tc}
+     */
+    RGBAS3tcDxt1 = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,
+
+    /**
+     * S3TC DXT3 (BC2) compressed RGBA, normalized unsigned.
+     * @requires_extension Extension @extension{EXT,texture_compression_s3tc}
+     * @requires_es_extension Extension @es_extension{EXT,texture_compression_s3tc}
+     */
+    RGBAS3tcDxt3 = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT,
+
+    /**
+     * S3TC DXT5 (BC3) compressed RGBA, normalized unsigned.
+     * @requires_extension Extension @extension{EXT,texture_compression_s3tc}
+     * @requires_es_extension Extension @es_extension{EXT,texture_compression_s3tc}
+     */
+    RGBAS3tcDxt5 = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,
+
+    #ifndef MAGNUM_TARGET_GLES
+    /**
+     * RGTC (BC4) compressed red channel, normalized unsigned.
+     * @requires_gl30 Extension @extension{EXT,texture_compression_rgtc}
+     * @requires_gl RGTC texture compression is not available in OpenGL ES.
+     */
+    RedRgtc1 = GL_COMPRESSED_RED_RGTC1,
+
+    /**
+     * RGTC (BC5) compressed red and green channel, normalized unsigned.
+     * @requires_gl30 Extension @extension{EXT,texture_compression_rgtc}
+     * @requires_gl RGTC texture compression is not available in OpenGL ES.
+     */
+    RGRgtc2 = GL_COMPRESSED_RG_RGTC2,
+
+    /**
+     * RGTC (BC4) compressed red channel, normalized signed.
+     * @requires_gl30 Extension @extension{EXT,texture_compression_rgtc}
+     * @requires_gl RGTC texture compression is not available in OpenGL ES.
+     */
+    SignedRedRgtc1 = GL_COMPRESSED_SIGNED_RED_RGTC1,
+
+    /**
+     * RGTC (BC5) compressed red and green channel, normalized signed.
+     * @requires_gl30 Extension @extension{EXT,texture_compression_rgtc}
+     * @requires_gl RGTC texture compression is not available in OpenGL ES.
+     */
+    SignedRGRgtc2 = GL_COMPRESSED_SIGNED_RG_RGTC2,
+
+    /**
+     * BPTC (BC6H) compressed RGB, unsigned float.
+     * @requires_gl42 Extension @extension{ARB,texture_compression_bptc}
+     * @requires_gl BPTC texture compression is not available in OpenGL ES.
+     */
+    RGBBptcUnsignedFloat = GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT,
+
+    /**
+     * BPTC (BC6H) compressed RGB, signed float.
+     * @requires_gl42 Extension @extension{ARB,texture_compression_bptc}
+     * @requires_gl BPTC texture compression is not available in OpenGL ES.
+     */
+    RGBBptcSignedFloat = GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT,
+
+    /**
+     * BPTC (BC7) compressed RGBA, normalized unsigned.
+     * @requires_gl42 Extension @extension{ARB,texture_compression_bptc}
+     * @requires_gl BPTC texture compression is not available in OpenGL ES.
+     */
+    RGBABptcUnorm = GL_COMPRESSED_RGBA_BPTC_UNORM,
+
+    /**
+     * BPTC (BC7) compressed sRGBA, normalized unsigned.
+     * @requires_gl42 Extension @extension{ARB,texture_compression_bptc}
+     * @requires_gl BPTC texture compression is not available in OpenGL ES.
+     */
+    SRGBAlphaBptcUnorm = GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM,
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES2
+    /**
+     * ETC2 compressed RGB, normalized unsigned.
+     * @requires_gl43 Extension @extension{ARB,ES3_compatibility}
+     * @requires_gles30 ETC2 texture compression is not available in OpenGL ES 2.0.
+     */
+    RGB8Etc2 = GL_COMPRESSED_RGB8_ETC2,
+
+    /**
+     * ETC2 compressed sRGB, normalized unsigned.
+     * @requires_gl43 Extension @extension{ARB,ES3_compatibility}
+     * @requires_gles30 ETC2 texture compression is not available in OpenGL ES 2.0.
+     */
+    SRGB8Etc2 = GL_COMPRESSED_SRGB8_ETC2,
+
+    /**
+     * ETC2 compressed RGB with 1bit punch-through alpha, normalized unsigned.
+     * @requires_gl43 Extension @extension{ARB,ES3_compatibility}
+     * @requires_gles30 ETC2 texture compression is not available in OpenGL ES 2.0.
+     */
+    RGB8PunchthroughAlpha1Etc2 = GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,
+
+    /**
+     * ETC2 compressed sRGB with 1bit punch-through alpha, normalized unsigned.
+     * @requires_gl43 Extension @extension{ARB,ES3_compatibility}
+     * @requires_gles30 ETC2 texture compression is not available in OpenGL ES 2.0.
+     */
+    SRGB8PunchthroughAlpha1Etc2 = GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2,
+
+    /**
+     * ETC2/EAC compressed RGBA, normalized unsigned.
+     * @requires_gl43 Extension @extension{ARB,ES3_compatibility}
+     * @requires_gles30 ETC2 texture compression is not available in OpenGL ES 2.0.
+     */
+    RGBA8Etc2Eac = GL_COMPRESSED_RGBA8_ETC2_EAC,
+
+    /**
+     * ETC2/EAC compressed sRGB with alpha, normalized unsigned.
+     * @requires_gl43 Extension @extension{ARB,ES3_compatibility}
+     * @requires_gles30 ETC2 texture compression is not available in OpenGL ES 2.0.
+     */
+    SRGB8Alpha8Etc2Eac = GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,
+
+    /**
+     * EAC compressed red channel, normalized unsigned.
+     * @requires_gl43 Extension @extension{ARB,ES3_compatibility}
+     * @requires_gles30 ETC2 texture compression is not available in OpenGL ES 2.0.
+     */
+    R11Eac = GL_COMPRESSED_R11_EAC,
+
+    /**
+     * EAC compressed red channel, normalized signed.
+     * @requires_gl43 Extension @extension{ARB,ES3_compatibility}
+     * @requires_gles30 ETC2 texture compression is not available in OpenGL ES 2.0.
+     */
+    SignedR11Eac = GL_COMPRESSED_SIGNED_R11_EAC,
+
+    /**
+     * EAC compressed red and green channel, normalized unsigned.
+     * @requires_gl43 Extension @extension{ARB,ES3_compatibility}
+     * @requires_gles30 ETC2 texture compression is not available in OpenGL ES 2.0.
+     */
+    RG11Eac = GL_COMPRESSED_RG11_EAC,
+
+    /**
+     * EAC compressed red and green channel, normalized signed.
+     * @requires_gl43 Extension @extension{ARB,ES3_compatibility}
+     * @requires_gles30 ETC2 texture compression is not available in OpenGL ES 2.0.
+     */
+    SignedRG11Eac = GL_COMPRESSED_SIGNED_RG11_EAC,
+    #endif
+
+    /**
+     * ASTC compressed RGBA with 4&times;4 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    RGBAAstc4x4 = GL_COMPRESSED_RGBA_ASTC_4x4_KHR,
+
+    /**
+     * ASTC compressed RGBA with 5&times;4 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    RGBAAstc5x4 = GL_COMPRESSED_RGBA_ASTC_5x4_KHR,
+
+    /**
+     * ASTC compressed RGBA with 5&times;5 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    RGBAAstc5x5 = GL_COMPRESSED_RGBA_ASTC_5x5_KHR,
+
+    /**
+     * ASTC compressed RGBA with 6&times;5 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    RGBAAstc6x5 = GL_COMPRESSED_RGBA_ASTC_6x5_KHR,
+
+    /**
+     * ASTC compressed RGBA with 6&times;6 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    RGBAAstc6x6 = GL_COMPRESSED_RGBA_ASTC_6x6_KHR,
+
+    /**
+     * ASTC compressed RGBA with 8&times;5 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    RGBAAstc8x5 = GL_COMPRESSED_RGBA_ASTC_8x5_KHR,
+
+    /**
+     * ASTC compressed RGBA with 8&times;6 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    RGBAAstc8x6 = GL_COMPRESSED_RGBA_ASTC_8x6_KHR,
+
+    /**
+     * ASTC compressed RGBA with 8&times;8 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    RGBAAstc8x8 = GL_COMPRESSED_RGBA_ASTC_8x8_KHR,
+
+    /**
+     * ASTC compressed RGBA with 10&times;5 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    RGBAAstc10x5 = GL_COMPRESSED_RGBA_ASTC_10x5_KHR,
+
+    /**
+     * ASTC compressed RGBA with 10&times;6 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    RGBAAstc10x6 = GL_COMPRESSED_RGBA_ASTC_10x6_KHR,
+
+    /**
+     * ASTC compressed RGBA with 10&times;8 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    RGBAAstc10x8 = GL_COMPRESSED_RGBA_ASTC_10x8_KHR,
+
+    /**
+     * ASTC compressed RGBA with 10&times;10 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    RGBAAstc10x10 = GL_COMPRESSED_RGBA_ASTC_10x10_KHR,
+
+    /**
+     * ASTC compressed RGBA with 12&times;10 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    RGBAAstc12x10 = GL_COMPRESSED_RGBA_ASTC_12x10_KHR,
+
+    /**
+     * ASTC compressed RGBA with 12&times;12 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    RGBAAstc12x12 = GL_COMPRESSED_RGBA_ASTC_12x12_KHR,
+
+    /**
+     * ASTC compressed sRGB with alpha with 4&times;4 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    SRGB8Alpha8Astc4x4 = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR,
+
+    /**
+     * ASTC compressed sRGB with alpha with 5&times;4 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    SRGB8Alpha8Astc5x4 = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR,
+
+    /**
+     * ASTC compressed sRGB with alpha with 5&times;5 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    SRGB8Alpha8Astc5x5 = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR,
+
+    /**
+     * ASTC compressed sRGB with alpha with 6&times;5 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    SRGB8Alpha8Astc6x5 = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR,
+
+    /**
+     * ASTC compressed sRGB with alpha with 6&times;6 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    SRGB8Alpha8Astc6x6 = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR,
+
+    /**
+     * ASTC compressed sRGB with alpha with 8&times;5 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    SRGB8Alpha8Astc8x5 = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR,
+
+    /**
+     * ASTC compressed sRGB with alpha with 8&times;6 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    SRGB8Alpha8Astc8x6 = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR,
+
+    /**
+     * ASTC compressed sRGB with alpha with 8&times;8 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    SRGB8Alpha8Astc8x8 = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR,
+
+    /**
+     * ASTC compressed sRGB with alpha with 10&times;5 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    SRGB8Alpha8Astc10x5 = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR,
+
+    /**
+     * ASTC compressed sRGB with alpha with 10&times;6 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    SRGB8Alpha8Astc10x6 = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR,
+
+    /**
+     * ASTC compressed sRGB with alpha with 10&times;8 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    SRGB8Alpha8Astc10x8 = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR,
+
+    /**
+     * ASTC compressed sRGB with alpha with 10&times;10 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    SRGB8Alpha8Astc10x10 = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR,
+
+    /**
+     * ASTC compressed sRGB with alpha with 12&times;10 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    SRGB8Alpha8Astc12x10 = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR,
+
+    /**
+     * ASTC compressed sRGB with alpha with 12&times;12 blocks, normalized unsigned.
+     * @requires_extension Extension @extension{KHR,texture_compression_astc_ldr}
+     * @requires_es_extension Extension @es_extension{KHR,texture_compression_astc_ldr}
+     */
+    SRGB8Alpha8Astc12x12 = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR
+};
+
 /** @debugoperatorenum{Magnum::ColorFormat} */
 Debug MAGNUM_EXPORT operator<<(Debug debug, ColorFormat value);
 
 /** @debugoperatorenum{Magnum::ColorType} */
 Debug MAGNUM_EXPORT operator<<(Debug debug, ColorType value);
 
+/** @debugoperatorenum{Magnum::CompressedColorFormat} */
+Debug MAGNUM_EXPORT operator<<(Debug debug, CompressedColorFormat value);
+
 }
 
 #endif
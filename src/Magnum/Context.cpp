@@ -25,8 +25,13 @@
 
 #include "Context.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <string>
-#include <unordered_map>
+#ifdef MAGNUM_BUILD_MULTITHREADED
+#include <mutex>
+#endif
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/String.h>
 
@@ -46,8 +51,12 @@
 
 #include "Implementation/State.h"
 #include "Implementation/BufferState.h"
+#include "Implementation/DeletionState.h"
 #include "Implementation/FramebufferState.h"
+#include "Implementation/MemoryState.h"
 #include "Implementation/MeshState.h"
+#include "Implementation/NamePoolState.h"
+#include "Implementation/RendererState.h"
 #include "Implementation/ShaderProgramState.h"
 #include "Implementation/TextureState.h"
 #include "Implementation/TransformFeedbackState.h"
@@ -77,7 +86,9 @@ const std::vector<Extension>& Extension::extensions(Version version) {
         _extension(GL,ARB,sparse_buffer),
         _extension(GL,ARB,transform_feedback_overflow_query),
         _extension(GL,ATI,texture_mirror_once),
+        _extension(GL,ATI,meminfo),
         _extension(GL,EXT,texture_filter_anisotropic),
+        _extension(GL,EXT,texture_compression_s3tc),
         _extension(GL,EXT,texture_mirror_clamp),
         _extension(GL,EXT,direct_state_access),
         _extension(GL,EXT,texture_sRGB_decode),
@@ -86,7 +97,9 @@ const std::vector<Extension>& Extension::extensions(Version version) {
         _extension(GL,EXT,debug_marker),
         _extension(GL,GREMEDY,string_marker),
         _extension(GL,KHR,texture_compression_astc_ldr),
-        _extension(GL,KHR,texture_compression_astc_hdr)};
+        _extension(GL,KHR,texture_compression_astc_hdr),
+        _extension(GL,KHR,parallel_shader_compile),
+        _extension(GL,NVX,gpu_memory_info)};
     static const std::vector<Extension> extensions300{
         _extension(GL,ARB,map_buffer_range),
         _extension(GL,ARB,color_buffer_float),
@@ -229,6 +242,7 @@ const std::vector<Extension>& Extension::extensions(Version version) {
         _extension(GL,EXT,debug_marker),
         _extension(GL,EXT,disjoint_timer_query),
         _extension(GL,EXT,texture_sRGB_decode),
+        _extension(GL,EXT,texture_compression_s3tc),
         _extension(GL,EXT,separate_shader_objects),
         _extension(GL,EXT,sRGB),
         _extension(GL,EXT,multisampled_render_to_texture),
@@ -239,6 +253,7 @@ const std::vector<Extension>& Extension::extensions(Version version) {
         _extension(GL,KHR,robustness),
         _extension(GL,KHR,robust_buffer_access_behavior),
         _extension(GL,KHR,context_flush_control),
+        _extension(GL,KHR,parallel_shader_compile),
         _extension(GL,NV,read_buffer_front),
         _extension(GL,NV,read_depth),
         _extension(GL,NV,read_stencil),
@@ -327,11 +342,58 @@ const std::vector<Extension>& Extension::extensions(Version version) {
     CORRADE_ASSERT_UNREACHABLE();
 }
 
+#ifndef MAGNUM_BUILD_MULTITHREADED
 Context* Context::_current = nullptr;
+#else
+thread_local Context* Context::_current = nullptr;
+#endif
+
+namespace {
+
+/* Compares null-terminated extension string to a string of given length that
+   isn't necessarily null-terminated */
+int compareExtensionString(const char* const extension, const char* const string, const std::size_t length) {
+    const int result = std::strncmp(extension, string, length);
+    if(result) return result;
+    return extension[length] ? 1 : 0;
+}
+
+/* Binary search in extensions sorted by their string */
+const Extension* findExtension(const std::vector<const Extension*>& sorted, const char* const string, const std::size_t length) {
+    const auto found = std::lower_bound(sorted.begin(), sorted.end(), string,
+        [length](const Extension* a, const char* b) {
+            return compareExtensionString(a->string(), b, length) < 0;
+        });
+    if(found != sorted.end() && compareExtensionString((*found)->string(), string, length) == 0)
+        return *found;
+    return nullptr;
+}
+
+UnsignedInt microsecondsSince(std::chrono::high_resolution_clock::time_point& since) {
+    const auto now = std::chrono::high_resolution_clock::now();
+    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(now - since).count();
+    since = now;
+    return UnsignedInt(duration);
+}
+
+}
+
+Context::Context(void functionLoader()): _startupTimes{} {
+    auto time = std::chrono::high_resolution_clock::now();
 
-Context::Context(void functionLoader()) {
     /* Load GL function pointers */
+    #ifndef MAGNUM_BUILD_MULTITHREADED
     if(functionLoader) functionLoader();
+    #else
+    /* Function pointers are global, don't load them from more threads at
+       once */
+    if(functionLoader) {
+        static std::mutex mutex;
+        std::lock_guard<std::mutex> lock{mutex};
+        functionLoader();
+    }
+    #endif
+    _startupTimes.functionLoading = microsecondsSince(time);
 
     /* Get version */
     #if defined(MAGNUM_TARGET_GLES) && !defined(MAGNUM_TARGET_GLES2)
@@ -447,23 +509,68 @@ Context::Context(void functionLoader()) {
         for(const Extension& extension: Extension::extensions(versions[i]))
             extensionStatus.set(extension._index);
 
+    _startupTimes.versionQuery = microsecondsSince(time);
+
     /* List of extensions from future versions (extensions from current and
        previous versions should be supported automatically, so we don't need
-       to check for them) */
-    std::unordered_map<std::string, Extension> futureExtensions;
+       to check for them), sorted for binary search. The extension strings
+       are static, so only pointers are stored. */
+    std::vector<const Extension*> futureExtensions;
+    {
+        std::size_t count = 0;
+        for(std::size_t i = future; i != versions.size(); ++i)
+            count += Extension::extensions(versions[i]).size();
+        futureExtensions.reserve(count);
+    }
     for(std::size_t i = future; i != versions.size(); ++i)
         for(const Extension& extension: Extension::extensions(versions[i]))
-            futureExtensions.emplace(extension._string, extension);
-
-    /* Check for presence of future and vendor extensions */
-    const std::vector<std::string> extensions = extensionStrings();
-    for(const std::string& extension: extensions) {
-        const auto found = futureExtensions.find(extension);
-        if(found != futureExtensions.end()) {
-            _supportedExtensions.push_back(found->second);
-            extensionStatus.set(found->second._index);
+            futureExtensions.push_back(&extension);
+    std::sort(futureExtensions.begin(), futureExtensions.end(),
+        [](const Extension* a, const Extension* b) {
+            return std::strcmp(a->_string, b->_string) < 0;
+        });
+
+    /* Check for presence of future and vendor extensions. The strings are
+       matched directly as returned by the driver to avoid allocating a copy
+       of each. */
+    const auto checkExtension = [this, &futureExtensions](const char* string, std::size_t length) {
+        const Extension* found = findExtension(futureExtensions, string, length);
+        if(found) {
+            _supportedExtensions.push_back(*found);
+            extensionStatus.set(found->_index);
+        }
+    };
+    #ifndef MAGNUM_TARGET_GLES2
+    GLint extensionCount = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+    #ifndef MAGNUM_TARGET_GLES3
+    if(extensionCount || isVersionSupported(Version::GL300))
+    #endif
+    {
+        for(GLint i = 0; i != extensionCount; ++i) {
+            const char* const extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+            checkExtension(extension, std::strlen(extension));
+        }
+    }
+    #ifndef MAGNUM_TARGET_GLES3
+    else
+    #endif
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES3
+    /* OpenGL 2.1 / OpenGL ES 2.0 doesn't have glGetStringi(), split the
+       space-separated string in place */
+    {
+        const char* e = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+        while(e && *e) {
+            const char* const end = std::strchr(e, ' ');
+            const std::size_t length = end ? end - e : std::strlen(e);
+            if(length) checkExtension(e, length);
+            e = end ? end + 1 : nullptr;
         }
     }
+    #endif
+    _startupTimes.extensionQuery = microsecondsSince(time);
 
     /* Reset minimal required version to Version::None for whole array */
     for(auto& i: _extensionRequiredVersion) i = Version::None;
@@ -476,6 +583,7 @@ Context::Context(void functionLoader()) {
     /* Setup driver workarounds (increase required version for particular
        extensions), see Implementation/driverWorkarounds.cpp */
     setupDriverWorkarounds();
+    _startupTimes.driverWorkarounds = microsecondsSince(time);
 
     /* Set this context as current */
     CORRADE_ASSERT(!_current, "Context: Another context currently active", );
@@ -491,10 +599,13 @@ Context::Context(void functionLoader()) {
     /** @todo Get rid of these */
     DefaultFramebuffer::initializeContextBasedFunctionality(*this);
     Renderer::initializeContextBasedFunctionality();
+    _startupTimes.stateInitialization = microsecondsSince(time);
 }
 
 Context::~Context() {
     CORRADE_ASSERT(_current == this, "Context: Cannot destroy context which is not currently active", );
+    _state->deletion->flush();
+    _state->namePool->clear();
     delete _state;
     _current = nullptr;
 }
@@ -562,6 +673,80 @@ Version Context::supportedVersion(std::initializer_list<Version> versions) const
     #endif
 }
 
+UnsignedLong Context::elidedStateChangeCount() const {
+    return _state->elidedStateChangeCount;
+}
+
+bool Context::isStatisticsEnabled() const {
+    return _state->statisticsEnabled;
+}
+
+void Context::setStatisticsEnabled(const bool enabled) {
+    _state->statisticsEnabled = enabled;
+}
+
+Context::Statistics Context::statistics() const {
+    return _state->statistics;
+}
+
+void Context::resetStatistics() {
+    _state->statistics = {};
+}
+
+Context::MemoryUsage Context::memoryUsage(const MemoryObjectType type) const {
+    return _state->memory->usage[std::size_t(type)];
+}
+
+UnsignedLong Context::memoryUsage() const {
+    UnsignedLong size = 0;
+    for(const MemoryUsage& usage: _state->memory->usage) size += usage.size;
+    return size;
+}
+
+std::vector<std::pair<std::string, UnsignedLong>> Context::memoryUsageByLabel() const {
+    std::vector<std::pair<std::string, UnsignedLong>> out;
+    for(const auto& label: _state->memory->labels)
+        if(label.second) out.push_back(label);
+    return out;
+}
+
+Long Context::availableMemory() {
+    return _state->memory->availableMemoryImplementation();
+}
+
+Long Context::totalMemory() {
+    return _state->memory->totalMemoryImplementation();
+}
+
+bool Context::isDeferredDeletionEnabled() const {
+    return _state->deletion->enabled;
+}
+
+void Context::setDeferredDeletionEnabled(const bool enabled) {
+    _state->deletion->enabled = enabled;
+}
+
+void Context::setDeferredDeletionTarget(Context* const context) {
+    _state->deletion->shared = context ? context->_state->deletion.get() : _state->deletion.get();
+}
+
+std::size_t Context::deferredDeletionCount() const {
+    return _state->deletion->count();
+}
+
+void Context::flushDeferredDeletions() {
+    CORRADE_ASSERT(_current == this, "Context::flushDeferredDeletions(): the context is not current", );
+    _state->deletion->flush();
+}
+
+std::size_t Context::namePoolSize() const {
+    return _state->namePool->buffers.batchSize;
+}
+
+void Context::setNamePoolSize(const std::size_t size) {
+    _state->namePool->setBatchSize(size);
+}
+
 void Context::resetState(const States states) {
     if(states & State::Buffers)
         _state->buffer->reset();
@@ -570,7 +755,8 @@ void Context::resetState(const States states) {
     if(states & State::Meshes)
         _state->mesh->reset();
 
-    /* Nothing to reset for renderer yet */
+    if(states & State::Renderer)
+        _state->renderer->reset();
 
     if(states & State::Shaders) {
         /* Nothing to reset for shaders */
@@ -598,6 +784,19 @@ Debug operator<<(Debug debug, const Context::Flag value) {
 
     return debug << "Context::Flag::(invalid)";
 }
+
+Debug operator<<(Debug debug, const Context::MemoryObjectType value) {
+    switch(value) {
+        #define _c(value) case Context::MemoryObjectType::value: return debug << "Context::MemoryObjectType::" #value;
+        _c(Buffer)
+        _c(Texture)
+        _c(Renderbuffer)
+        _c(Mesh)
+        #undef _c
+    }
+
+    return debug << "Context::MemoryObjectType::(invalid)";
+}
 #endif
 
 }
@@ -32,6 +32,8 @@
 #include <cstdlib>
 #include <array>
 #include <bitset>
+#include <string>
+#include <utility>
 #include <vector>
 #include <Corrade/Containers/EnumSet.h>
 
@@ -92,6 +94,80 @@ the instance is available during whole lifetime of `*Application` object. It's
 also possible to create the context without using any `*Application` class
 using @ref Platform::Context subclass, see @ref platform documentation for more
 information.
+
+## Multiple contexts
+
+If Magnum is built with `BUILD_MULTITHREADED` enabled, the current context is
+tracked separately for each thread. Each thread can then create its own OpenGL
+context together with its own @ref Platform::Context instance, having its own
+state tracker. See @ref Platform::WindowlessEglContext for an example. The
+@ref DefaultFramebuffer instance is still global, thus such contexts should
+render only into @ref Framebuffer objects.
+
+## Uploading data from a loader thread
+
+Secondary contexts can share objects with the main one, e.g. using
+@ref Platform::Sdl2Application::SharedContext or
+@ref Platform::WindowlessEglContext::Configuration::setSharedContext(). With
+`BUILD_MULTITHREADED` enabled, a loader thread can make the shared context
+current, create its own @ref Platform::Context and then upload buffer and
+texture data without stalling the main thread. The created objects are
+handed over to the main thread together with a @ref Fence, which ensures the
+upload is finished before the main context uses them:
+@code
+// in application constructor
+Platform::Sdl2Application::SharedContext sharedContext{*this};
+
+// loader thread
+sharedContext.makeCurrent();
+Platform::Context context;
+for(;;) {
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, image.size())
+        .setSubImage(0, {}, image);
+    Fence fence;
+
+    std::lock_guard<std::mutex> lock{mutex};
+    loaded.emplace_back(std::move(texture), std::move(fence));
+}
+
+// main thread, each frame
+std::lock_guard<std::mutex> lock{mutex};
+for(auto& item: loaded) {
+    item.second.wait();
+    textures.push_back(std::move(item.first));
+}
+loaded.clear();
+@endcode
+
+Only buffers, textures, renderbuffers, shaders, shader programs, queries and
+sync objects are shared. Container objects such as @ref Mesh "meshes" (vertex
+array objects), @ref Framebuffer "framebuffers" and
+@ref TransformFeedback "transform feedbacks" have to be created in the context
+which uses them. Shared objects should be destroyed only after the other
+context stopped using them.
+
+## Deferred object deletion
+
+By default, destructors of @ref Buffer, @ref Texture "textures",
+@ref Renderbuffer, @ref Framebuffer and @ref Mesh delete the OpenGL object
+immediately, which on some drivers causes a stall in the middle of a frame.
+With @ref setDeferredDeletionEnabled() the names are only put into a queue and
+deleted in batches, one `glDelete*()` call per object type, when
+@ref flushDeferredDeletions() is called, e.g. right after swapping buffers:
+@code
+Context::current()->setDeferredDeletionEnabled(true);
+
+// each frame
+drawEvent();
+swapBuffers();
+Context::current()->flushDeferredDeletions();
+@endcode
+
+The queue is protected by a mutex. A loader thread with a shared context can
+use @ref setDeferredDeletionTarget() to send names of buffers, textures and
+renderbuffers it destroys to the queue of the main context, so the deletion
+happens on the main thread at frame end.
 */
 class MAGNUM_EXPORT Context {
     friend Platform::Context;
@@ -178,6 +254,186 @@ class MAGNUM_EXPORT Context {
          */
         typedef Containers::EnumSet<State> States;
 
+        /**
+         * @brief Rendering statistics
+         *
+         * @see @ref setStatisticsEnabled(), @ref statistics()
+         */
+        struct Statistics {
+            /**
+             * Draw calls. A multi-draw and indirect draw is counted as one
+             * call.
+             */
+            UnsignedInt drawCalls;
+
+            /**
+             * Vertices (or indices, for indexed meshes) submitted, multiplied
+             * by instance count
+             */
+            UnsignedLong vertices;
+
+            /**
+             * Bytes uploaded using @ref Buffer::setData(),
+             * @ref Buffer::setSubData() and @ref Buffer::setStorage()
+             */
+            UnsignedLong bufferUploadBytes;
+
+            /** Texture units whose binding actually changed */
+            UnsignedInt textureBinds;
+
+            /** Texture units whose sampler binding actually changed */
+            UnsignedInt samplerBinds;
+
+            /** Shader program switches */
+            UnsignedInt programSwitches;
+
+            /** Framebuffer binding changes */
+            UnsignedInt framebufferBinds;
+        };
+
+        /**
+         * @brief Object type for GPU memory accounting
+         *
+         * @see @ref memoryUsage(MemoryObjectType)
+         */
+        enum class MemoryObjectType: UnsignedByte {
+            /** @ref Magnum::Buffer "Buffer" */
+            Buffer,
+
+            /** Texture of any type */
+            Texture,
+
+            /** @ref Magnum::Renderbuffer "Renderbuffer" */
+            Renderbuffer,
+
+            /**
+             * @ref Magnum::Mesh "Mesh". Meshes only reference buffers, which
+             * are accounted as @ref MemoryObjectType::Buffer, so only the
+             * object count is tracked for them. See @ref Mesh::memoryUsage()
+             * for size of buffers referenced by particular mesh.
+             */
+            Mesh
+        };
+
+        /** @brief Count of GPU memory accounting object types */
+        enum: std::size_t { MemoryObjectTypeCount = std::size_t(MemoryObjectType::Mesh) + 1 };
+
+        /**
+         * @brief Estimated GPU memory usage
+         *
+         * @see @ref memoryUsage(MemoryObjectType)
+         */
+        struct MemoryUsage {
+            /** Estimated size in bytes */
+            UnsignedLong size;
+
+            /** Count of live objects */
+            UnsignedInt count;
+        };
+
+        /**
+         * @brief Whether deferred object deletion is enabled
+         *
+         * @see @ref setDeferredDeletionEnabled()
+         */
+        bool isDeferredDeletionEnabled() const;
+
+        /**
+         * @brief Enable or disable deferred object deletion
+         *
+         * Disabled by default. When enabled, destroyed @ref Buffer,
+         * @ref Texture "texture", @ref Renderbuffer, @ref Framebuffer and
+         * @ref Mesh objects are not deleted immediately, but put into a
+         * queue which is emptied by @ref flushDeferredDeletions(). Disabling
+         * it doesn't flush the queue.
+         * @see @ref deferredDeletionCount()
+         */
+        void setDeferredDeletionEnabled(bool enabled);
+
+        /**
+         * @brief Send shared objects to queue of another context
+         *
+         * If deferred deletion is enabled in this context, names of deleted
+         * buffers, textures and renderbuffers are put into the queue of
+         * @p context instead, which can be done from any thread. The
+         * @p context must share objects with this one and must outlive it.
+         * Framebuffers and meshes are not shared between contexts, so they
+         * are always put into the queue of this context. Pass `nullptr` to
+         * use the queue of this context again.
+         */
+        void setDeferredDeletionTarget(Context* context);
+
+        /**
+         * @brief Count of objects waiting for deletion
+         *
+         * @see @ref flushDeferredDeletions()
+         */
+        std::size_t deferredDeletionCount() const;
+
+        /**
+         * @brief Delete all queued objects
+         *
+         * Calls `glDelete*()` once for each object type with all names
+         * queued so far. Expects that this context is current. Called also
+         * on context destruction.
+         * @see @ref setDeferredDeletionEnabled(), @fn_gl{DeleteBuffers},
+         *      @fn_gl{DeleteTextures}, @fn_gl{DeleteRenderbuffers},
+         *      @fn_gl{DeleteFramebuffers}, @fn_gl{DeleteVertexArrays}
+         */
+        void flushDeferredDeletions();
+
+        /**
+         * @brief Object name pool size
+         *
+         * @see @ref setNamePoolSize()
+         */
+        std::size_t namePoolSize() const;
+
+        /**
+         * @brief Set object name pool size
+         *
+         * Default is `0`, i.e. each created @ref Buffer,
+         * @ref Texture "texture", @ref Renderbuffer and query generates its
+         * name with a separate `glGen*()` call. With non-zero @p size, names
+         * are generated in batches of @p size and handed out on object
+         * construction, which saves a lot of calls when creating many objects
+         * at load time. Names of objects which were destroyed without ever
+         * being bound are put back into the pool. Objects which were used
+         * are deleted as usual (or put into the deferred deletion queue,
+         * see @ref setDeferredDeletionEnabled()), as their name can't be
+         * reused before the deletion.
+         *
+         * If @extension{ARB,direct_state_access} is available, buffers and
+         * renderbuffers are pooled using @fn_gl{CreateBuffers} and
+         * @fn_gl{CreateRenderbuffers}. Textures and queries need to know
+         * their target at creation, so with DSA they are not pooled. Pooled
+         * names are deleted on context destruction.
+         */
+        void setNamePoolSize(std::size_t size);
+
+        /**
+         * @brief Startup time breakdown
+         *
+         * All values are in microseconds.
+         * @see @ref startupTimes()
+         */
+        struct StartupTimes {
+            /** Loading OpenGL function pointers */
+            UnsignedInt functionLoading;
+
+            /** Querying OpenGL version and context flags */
+            UnsignedInt versionQuery;
+
+            /** Querying and matching supported extensions */
+            UnsignedInt extensionQuery;
+
+            /** Detecting the driver and setting up driver workarounds */
+            UnsignedInt driverWorkarounds;
+
+            /** Initializing the state tracker */
+            UnsignedInt stateInitialization;
+        };
+
         /**
          * @brief Detected driver
          *
@@ -224,7 +480,12 @@ class MAGNUM_EXPORT Context {
         /** @brief Moving is not allowed */
         Context& operator=(Context&&) = delete;
 
-        /** @brief Current context */
+        /**
+         * @brief Current context
+         *
+         * If Magnum is built with `BUILD_MULTITHREADED`, returns context
+         * current in the calling thread.
+         */
         static Context* current() { return _current; }
 
         /**
@@ -458,6 +719,149 @@ class MAGNUM_EXPORT Context {
          */
         void resetState(States states = ~States{});
 
+        /**
+         * @brief Count of elided state changes
+         *
+         * Count of OpenGL calls skipped since context creation because the
+         * internal state tracker already matched the requested value. Counts
+         * fixed-function state set through @ref Renderer, framebuffer
+         * bindings, viewport and shader program switches. The counter is
+         * monotonic and not affected by @ref resetState(), query it
+         * periodically and subtract to get per-frame values.
+         */
+        UnsignedLong elidedStateChangeCount() const;
+
+        /**
+         * @brief Whether rendering statistics are enabled
+         *
+         * @see @ref setStatisticsEnabled()
+         */
+        bool isStatisticsEnabled() const;
+
+        /**
+         * @brief Enable or disable rendering statistics
+         *
+         * Disabled by default. When enabled, draw calls, submitted vertices,
+         * buffer uploads, texture binds, shader program switches and
+         * framebuffer binds issued by the engine are counted. Only calls
+         * that reach OpenGL are counted, calls elided by the state tracker
+         * are not. The counting is a few integer increments per call, so it
+         * is cheap enough to be left enabled in release builds. Calls made
+         * with raw OpenGL are not counted.
+         * @see @ref statistics(), @ref resetStatistics()
+         */
+        void setStatisticsEnabled(bool enabled);
+
+        /**
+         * @brief Rendering statistics
+         *
+         * Values accumulated since the last call to @ref resetStatistics()
+         * while statistics were enabled. To get per-frame values, call
+         * @ref resetStatistics() once per frame, e.g. right after swapping
+         * buffers.
+         * @see @ref setStatisticsEnabled()
+         */
+        Statistics statistics() const;
+
+        /**
+         * @brief Reset rendering statistics
+         *
+         * Sets all counters in @ref statistics() to zero.
+         */
+        void resetStatistics();
+
+        /**
+         * @brief Estimated GPU memory usage of given object type
+         *
+         * Unlike @ref statistics(), the memory accounting is always enabled,
+         * as it is updated only when an object is created, destroyed or its
+         * storage is (re)specified. The sizes are estimated from storage
+         * format and dimensions of the objects, not queried from the driver:
+         *
+         * -    size of @ref Buffer is the size passed to
+         *      @ref Buffer::setData() or @ref Buffer::setStorage()
+         * -    size of textures is the sum of sizes of all specified mip
+         *      levels (and cube map faces, layers and samples), compressed
+         *      images are accounted with their exact data size
+         * -    size of @ref Renderbuffer is its size multiplied by sample
+         *      count
+         *
+         * Three-component formats with 8- and 16-bit channels are assumed to
+         * be padded to four components, as most drivers do. Alignment and
+         * metadata overhead of the driver is not included. Sparse textures
+         * are accounted with size of their whole storage, regardless of
+         * committed pages. Objects created with raw OpenGL calls are not
+         * accounted.
+         * @see @ref memoryUsage(), @ref memoryUsageByLabel(),
+         *      @ref availableMemory(), @ref Buffer::memoryUsage(),
+         *      @ref AbstractTexture::memoryUsage(),
+         *      @ref Renderbuffer::memoryUsage()
+         */
+        MemoryUsage memoryUsage(MemoryObjectType type) const;
+
+        /**
+         * @brief Estimated total GPU memory usage
+         *
+         * Sum of sizes of all object types in bytes.
+         * @see @ref memoryUsage(MemoryObjectType)
+         */
+        UnsignedLong memoryUsage() const;
+
+        /**
+         * @brief Estimated GPU memory usage per object label
+         *
+         * Sizes of buffers, textures and renderbuffers aggregated by labels
+         * set with their `setLabel()` function, in bytes, in order in which
+         * the labels were first used. Objects without any label are
+         * accounted under an empty string, labels without any live memory
+         * are not included. The labels are recorded even if neither
+         * @extension{KHR,debug} nor @extension2{EXT,debug_label} is
+         * available, so it's possible to categorize the memory (e.g.
+         * `"terrain"`, `"ui"`) in any case.
+         * @see @ref memoryUsage(MemoryObjectType)
+         */
+        std::vector<std::pair<std::string, UnsignedLong>> memoryUsageByLabel() const;
+
+        /**
+         * @brief Driver-reported available GPU memory
+         *
+         * Currently available dedicated video memory in bytes as reported
+         * by the driver, useful for deriving budgets of e.g.
+         * @ref TextureStreamer or @ref ResourceManager. If neither
+         * @extension{NVX,gpu_memory_info} nor @extension{ATI,meminfo} is
+         * available, returns `-1`. The value is queried from the driver on
+         * every call, so don't call it every frame.
+         * @see @ref totalMemory(), @fn_gl{Get} with
+         *      @def_gl{GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX} or
+         *      @def_gl{TEXTURE_FREE_MEMORY_ATI}
+         * @requires_gl Memory info extensions are not available in OpenGL
+         *      ES or WebGL, always returns `-1` there.
+         */
+        Long availableMemory();
+
+        /**
+         * @brief Driver-reported total GPU memory
+         *
+         * Total dedicated video memory in bytes as reported by the driver.
+         * If @extension{NVX,gpu_memory_info} is not available, returns `-1`.
+         * The value doesn't change during lifetime of the context, but is
+         * queried from the driver on every call.
+         * @see @ref availableMemory(), @fn_gl{Get} with
+         *      @def_gl{GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX}
+         * @requires_gl Memory info extensions are not available in OpenGL
+         *      ES or WebGL, always returns `-1` there.
+         */
+        Long totalMemory();
+
+        /**
+         * @brief Startup time breakdown
+         *
+         * Time spent in particular phases of context creation, useful for
+         * short-lived applications where startup time matters. Displayed
+         * also by @ref magnum-info.
+         */
+        StartupTimes startupTimes() const { return _startupTimes; }
+
         /**
          * @brief Detect driver
          *
@@ -472,7 +876,11 @@ class MAGNUM_EXPORT Context {
         #endif
 
     private:
+        #ifndef MAGNUM_BUILD_MULTITHREADED
         static Context* _current;
+        #else
+        static thread_local Context* _current;
+        #endif
 
         explicit Context(void functionLoader());
 
@@ -483,18 +891,23 @@ class MAGNUM_EXPORT Context {
         Int _minorVersion;
         Flags _flags;
 
-        std::array<Version, 160> _extensionRequiredVersion;
-        std::bitset<160> extensionStatus;
+        std::array<Version, 170> _extensionRequiredVersion;
+        std::bitset<170> extensionStatus;
         std::vector<Extension> _supportedExtensions;
 
         Implementation::State* _state;
 
         std::optional<DetectedDrivers> _detectedDrivers;
+
+        StartupTimes _startupTimes;
 };
 
 /** @debugoperatorclassenum{Magnum::Context,Magnum::Context::Flag} */
 MAGNUM_EXPORT Debug operator<<(Debug debug, Context::Flag value);
 
+/** @debugoperatorclassenum{Magnum::Context,Magnum::Context::MemoryObjectType} */
+MAGNUM_EXPORT Debug operator<<(Debug debug, Context::MemoryObjectType value);
+
 /** @hideinitializer
 @brief Assert that given OpenGL version is supported
 @param version      Version
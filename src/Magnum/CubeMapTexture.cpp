@@ -61,6 +61,7 @@ void CubeMapTexture::image(const Int level, Image3D& image) {
     const std::size_t dataSize = image.dataSize(size);
     char* data = new char[dataSize];
     Buffer::unbindInternal(Buffer::TargetHint::PixelPack);
+    image.storage().applyPack();
     glGetTextureImage(_id, level, GLenum(image.format()), GLenum(image.type()), dataSize, data);
     image.setData(image.format(), image.type(), size, data);
 }
@@ -74,9 +75,10 @@ void CubeMapTexture::image(const Int level, BufferImage3D& image, const BufferUs
     const Vector3i size{imageSize(level), 6};
     const std::size_t dataSize = image.dataSize(size);
     if(image.size() != size)
-        image.setData(image.format(), image.type(), size, nullptr, usage);
+        image.setData(image.storage(), image.format(), image.type(), size, nullptr, usage);
 
     image.buffer().bindInternal(Buffer::TargetHint::PixelPack);
+    image.storage().applyPack();
     glGetTextureImage(_id, level, GLenum(image.format()), GLenum(image.type()), dataSize, nullptr);
 }
 
@@ -90,6 +92,7 @@ void CubeMapTexture::image(const Coordinate coordinate, const Int level, Image2D
     const std::size_t dataSize = image.dataSize(size);
     char* data = new char[dataSize];
     Buffer::unbindInternal(Buffer::TargetHint::PixelPack);
+    image.storage().applyPack();
     (this->*Context::current()->state().texture->getCubeImageImplementation)(coordinate, level, size, image.format(), image.type(), dataSize, data);
     image.setData(image.format(), image.type(), size, data);
 }
@@ -103,9 +106,10 @@ void CubeMapTexture::image(const Coordinate coordinate, const Int level, BufferI
     const Vector2i size = imageSize(level);
     const std::size_t dataSize = image.dataSize(size);
     if(image.size() != size)
-        image.setData(image.format(), image.type(), size, nullptr, usage);
+        image.setData(image.storage(), image.format(), image.type(), size, nullptr, usage);
 
     image.buffer().bindInternal(Buffer::TargetHint::PixelPack);
+    image.storage().applyPack();
     (this->*Context::current()->state().texture->getCubeImageImplementation)(coordinate, level, size, image.format(), image.type(), dataSize, nullptr);
 }
 
@@ -126,12 +130,14 @@ BufferImage3D CubeMapTexture::subImage(const Int level, const Range3Di& range, B
 
 CubeMapTexture& CubeMapTexture::setSubImage(const Int level, const Vector3i& offset, const ImageReference3D& image) {
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
+    image.storage().applyUnpack();
     glTextureSubImage3D(_id, level, offset.x(), offset.y(), offset.z(), image.size().x(), image.size().y(), image.size().z(), GLenum(image.format()), GLenum(image.type()), image.data());
     return *this;
 }
 
 CubeMapTexture& CubeMapTexture::setSubImage(const Int level, const Vector3i& offset, BufferImage3D& image) {
     image.buffer().bindInternal(Buffer::TargetHint::PixelUnpack);
+    image.storage().applyUnpack();
     glTextureSubImage3D(_id, level, offset.x(), offset.y(), offset.z(), image.size().x(), image.size().y(), image.size().z(), GLenum(image.format()), GLenum(image.type()), nullptr);
     return *this;
 }
@@ -141,6 +147,7 @@ CubeMapTexture& CubeMapTexture::setSubImage(const Coordinate coordinate, const I
     #ifndef MAGNUM_TARGET_GLES2
     Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
     #endif
+    image.storage().applyUnpack();
     (this->*Context::current()->state().texture->cubeSubImageImplementation)(coordinate, level, offset, image.size(), image.format(), image.type(), image.data());
     return *this;
 }
@@ -148,11 +155,20 @@ CubeMapTexture& CubeMapTexture::setSubImage(const Coordinate coordinate, const I
 #ifndef MAGNUM_TARGET_GLES2
 CubeMapTexture& CubeMapTexture::setSubImage(const Coordinate coordinate, const Int level, const Vector2i& offset, BufferImage2D& image) {
     image.buffer().bindInternal(Buffer::TargetHint::PixelUnpack);
+    image.storage().applyUnpack();
     (this->*Context::current()->state().texture->cubeSubImageImplementation)(coordinate, level, offset, image.size(), image.format(), image.type(), nullptr);
     return *this;
 }
 #endif
 
+CubeMapTexture& CubeMapTexture::setCompressedSubImage(const Coordinate coordinate, const Int level, const Vector2i& offset, const CompressedImageReference2D& image) {
+    #ifndef MAGNUM_TARGET_GLES2
+    Buffer::unbindInternal(Buffer::TargetHint::PixelUnpack);
+    #endif
+    (this->*Context::current()->state().texture->cubeCompressedSubImageImplementation)(coordinate, level, offset, image.size(), image.format(), image.data().data(), image.data().size());
+    return *this;
+}
+
 #ifndef MAGNUM_TARGET_GLES2
 Vector2i CubeMapTexture::getImageSizeImplementationDefault(const Int level) {
     Vector2i size;
@@ -217,4 +233,20 @@ void CubeMapTexture::subImageImplementationDSAEXT(const Coordinate coordinate, c
 }
 #endif
 
+void CubeMapTexture::compressedSubImageImplementationDefault(const Coordinate coordinate, const GLint level, const Vector2i& offset, const Vector2i& size, const CompressedColorFormat format, const GLvoid* const data, const GLsizei dataSize) {
+    bindInternal();
+    glCompressedTexSubImage2D(GLenum(coordinate), level, offset.x(), offset.y(), size.x(), size.y(), GLenum(format), dataSize, data);
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void CubeMapTexture::compressedSubImageImplementationDSA(const Coordinate coordinate, const GLint level, const Vector2i& offset, const Vector2i& size, const CompressedColorFormat format, const GLvoid* const data, const GLsizei dataSize) {
+    glCompressedTextureSubImage3D(_id, level, offset.x(), offset.y(), GLenum(coordinate) - GL_TEXTURE_CUBE_MAP_POSITIVE_X, size.x(), size.y(), 1, GLenum(format), dataSize, data);
+}
+
+void CubeMapTexture::compressedSubImageImplementationDSAEXT(const Coordinate coordinate, const GLint level, const Vector2i& offset, const Vector2i& size, const CompressedColorFormat format, const GLvoid* const data, const GLsizei dataSize) {
+    _created = true;
+    glCompressedTextureSubImage2DEXT(_id, GLenum(coordinate), level, offset.x(), offset.y(), size.x(), size.y(), GLenum(format), dataSize, data);
+}
+#endif
+
 }
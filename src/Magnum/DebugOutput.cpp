@@ -28,6 +28,7 @@
 #include <Corrade/Utility/Assert.h>
 
 #include "Magnum/Context.h"
+#include "Magnum/DebugOutputQueue.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Implementation/State.h"
 #include "Magnum/Implementation/DebugState.h"
@@ -42,11 +43,19 @@ void
 APIENTRY
 #endif
 callbackWrapper(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* userParam) {
-    Context::current()->state().debug->messageCallback(DebugOutput::Source(source), DebugOutput::Type(type), id, DebugOutput::Severity(severity), std::string{message, std::size_t(length)}, userParam);
+    Implementation::DebugState& state = *Context::current()->state().debug;
+
+    /* Queue the message directly, without the temporary string */
+    if(state.messageQueue)
+        state.messageQueue->push(DebugOutput::Source(source), DebugOutput::Type(type), id, DebugOutput::Severity(severity), message, std::size_t(length));
+    else
+        state.messageCallback(DebugOutput::Source(source), DebugOutput::Type(type), id, DebugOutput::Severity(severity), std::string{message, std::size_t(length)}, userParam);
 }
 #endif
 
-void defaultCallback(const DebugOutput::Source source, const DebugOutput::Type type, const UnsignedInt id, const DebugOutput::Severity severity, const std::string& string, const void*) {
+}
+
+void DebugOutput::defaultCallback(const Source source, const Type type, const UnsignedInt id, const Severity severity, const std::string& string, const void*) {
     Debug output;
     output << "Debug output:";
 
@@ -102,8 +111,6 @@ void defaultCallback(const DebugOutput::Source source, const DebugOutput::Type t
     output << '(' + std::to_string(id) + "):" << string;
 }
 
-}
-
 Int DebugOutput::maxLoggedMessages() {
     if(!Context::current()->isExtensionSupported<Extensions::GL::KHR::debug>())
         return 0;
@@ -139,7 +146,9 @@ Int DebugOutput::maxMessageLength() {
 }
 
 void DebugOutput::setCallback(const Callback callback, const void* userParam) {
-    Context::current()->state().debug->callbackImplementation(callback, userParam);
+    Implementation::DebugState& state = *Context::current()->state().debug;
+    state.messageQueue = nullptr;
+    state.callbackImplementation(callback, userParam);
 }
 
 void DebugOutput::setDefaultCallback() {
@@ -177,8 +186,9 @@ void DebugOutput::callbackImplementationKhr(const Callback callback, const void*
     const Callback original = Context::current()->state().debug->messageCallback;
     Context::current()->state().debug->messageCallback = callback;
 
-    /* Adding callback */
-    if(!original && callback) {
+    /* Adding or replacing callback, setting it again also when replacing to
+       update the user parameter */
+    if(callback) {
         #if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
         #ifndef MAGNUM_TARGET_GLES
         glDebugMessageCallback
@@ -40,6 +40,8 @@ namespace Magnum {
 
 namespace Implementation { struct DebugState; }
 
+class DebugOutputQueue;
+
 /**
 @brief Debug output
 
@@ -117,6 +119,7 @@ objects with labels. See @ref AbstractQuery::setLabel(),
 */
 class MAGNUM_EXPORT DebugOutput {
     friend Implementation::DebugState;
+    friend DebugOutputQueue;
 
     public:
         /**
@@ -370,7 +373,7 @@ class MAGNUM_EXPORT DebugOutput {
          * @ref Renderer::Feature::DebugOutput is enabled. If OpenGL 4.3 is not
          * supported and @extension{KHR,debug} desktop or ES extension is not
          * available, this function does nothing.
-         * @see @ref setDefaultCallback(),
+         * @see @ref setDefaultCallback(), @ref DebugOutputQueue,
          *      @ref Renderer::Feature::DebugOutputSynchronous,
          *      @fn_gl{DebugMessageCallback}
          */
@@ -395,6 +398,8 @@ class MAGNUM_EXPORT DebugOutput {
         DebugOutput() = delete;
 
     private:
+        static MAGNUM_LOCAL void defaultCallback(Source source, Type type, UnsignedInt id, Severity severity, const std::string& string, const void*);
+
         static void setEnabledInternal(GLenum source, GLenum type, GLenum severity, std::initializer_list<UnsignedInt> ids, bool enabled);
         static MAGNUM_LOCAL void controlImplementationNoOp(GLenum, GLenum, GLenum, std::initializer_list<UnsignedInt>, bool);
         static MAGNUM_LOCAL void controlImplementationKhr(GLenum source, GLenum type, GLenum severity, std::initializer_list<UnsignedInt> ids, bool enabled);
@@ -821,6 +826,13 @@ class MAGNUM_EXPORT DebugGroup {
          */
         ~DebugGroup() { if(_active) pop(); }
 
+        /**
+         * @brief Whether the group is active
+         *
+         * @see @ref push(), @ref pop()
+         */
+        bool isActive() const { return _active; }
+
         /**
          * @brief Push debug group onto the stack
          *
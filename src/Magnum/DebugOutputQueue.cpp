@@ -0,0 +1,150 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DebugOutputQueue.h"
+
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Implementation/State.h"
+#include "Magnum/Implementation/DebugState.h"
+
+namespace Magnum {
+
+namespace {
+    /* Size of the table counting message occurrences for rate limiting */
+    constexpr std::size_t CountTableSize = 256;
+}
+
+struct DebugOutputQueue::Slot {
+    std::atomic<bool> ready{false};
+    DebugOutput::Source source;
+    DebugOutput::Type type;
+    UnsignedInt id;
+    DebugOutput::Severity severity;
+    UnsignedInt length;
+};
+
+DebugOutputQueue::DebugOutputQueue(const UnsignedInt capacity, const UnsignedInt maxMessageLength): _maxMessageLength{maxMessageLength}, _rateLimit{1}, _write{0}, _read{0}, _droppedCount{0}, _suppressedCount{0} {
+    CORRADE_ASSERT(capacity,
+        "DebugOutputQueue: expected non-zero capacity", );
+
+    /* Power-of-two capacity, so the slot index can be masked and the
+       counters can wrap around */
+    _mask = (1u << Math::log2(2*capacity - 1)) - 1;
+
+    _slots.reset(new Slot[_mask + 1]);
+    _messages.reset(new char[std::size_t(_mask + 1)*maxMessageLength]);
+    _counts.reset(new std::atomic<UnsignedInt>[CountTableSize]);
+    for(std::size_t i = 0; i != CountTableSize; ++i) _counts[i] = 0;
+}
+
+DebugOutputQueue::~DebugOutputQueue() { uninstall(); }
+
+DebugOutputQueue& DebugOutputQueue::install() {
+    /* Setting the callback resets the queue pointer, so set it after */
+    DebugOutput::setCallback(callback, this);
+    Context::current()->state().debug->messageQueue = this;
+    return *this;
+}
+
+bool DebugOutputQueue::isInstalled() const {
+    return Context::current() && Context::current()->state().debug->messageQueue == this;
+}
+
+DebugOutputQueue& DebugOutputQueue::uninstall() {
+    if(isInstalled()) DebugOutput::setCallback(nullptr);
+    return *this;
+}
+
+void DebugOutputQueue::callback(const DebugOutput::Source source, const DebugOutput::Type type, const UnsignedInt id, const DebugOutput::Severity severity, const std::string& message, const void* const userParam) {
+    static_cast<DebugOutputQueue*>(const_cast<void*>(userParam))->push(source, type, id, severity, message.data(), message.size());
+}
+
+void DebugOutputQueue::push(const DebugOutput::Source source, const DebugOutput::Type type, const UnsignedInt id, const DebugOutput::Severity severity, const char* const message, const std::size_t length) {
+    /* Rate limiting, counting also the suppressed occurrences */
+    if(_counts[id % CountTableSize].fetch_add(1, std::memory_order_relaxed) >= _rateLimit.load(std::memory_order_relaxed)) {
+        _suppressedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    /* Reserve a slot, drop the message if the queue is full */
+    UnsignedInt write = _write.load(std::memory_order_relaxed);
+    do {
+        if(write - _read.load(std::memory_order_acquire) > _mask) {
+            _droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    } while(!_write.compare_exchange_weak(write, write + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    Slot& slot = _slots[write & _mask];
+    slot.source = source;
+    slot.type = type;
+    slot.id = id;
+    slot.severity = severity;
+    slot.length = UnsignedInt(Math::min(length, std::size_t(_maxMessageLength)));
+    std::memcpy(_messages.get() + std::size_t(write & _mask)*_maxMessageLength, message, slot.length);
+
+    /* Publish the slot to the consumer */
+    slot.ready.store(true, std::memory_order_release);
+}
+
+std::size_t DebugOutputQueue::drain(const Callback callback, const void* const userParam) {
+    std::size_t count = 0;
+    for(UnsignedInt read = _read.load(std::memory_order_relaxed); ; ++read, ++count) {
+        Slot& slot = _slots[read & _mask];
+
+        /* Stop also at slots that are reserved but not written yet, they will
+           be processed next time */
+        if(!slot.ready.load(std::memory_order_acquire)) break;
+
+        /* Reusing the string, so it doesn't allocate once large enough */
+        _message.source = slot.source;
+        _message.type = slot.type;
+        _message.id = slot.id;
+        _message.severity = slot.severity;
+        _message.count = Math::max(_counts[slot.id % CountTableSize].load(std::memory_order_relaxed), 1u);
+        _message.message.assign(_messages.get() + std::size_t(read & _mask)*_maxMessageLength, slot.length);
+
+        /* Release the slot for producers */
+        slot.ready.store(false, std::memory_order_relaxed);
+        _read.store(read + 1, std::memory_order_release);
+
+        if(callback) callback(_message, userParam);
+        else if(_message.count > 1)
+            DebugOutput::defaultCallback(_message.source, _message.type, _message.id, _message.severity, _message.message + " (" + std::to_string(_message.count) + " times)", nullptr);
+        else DebugOutput::defaultCallback(_message.source, _message.type, _message.id, _message.severity, _message.message, nullptr);
+    }
+
+    /* Start new rate limiting period */
+    for(std::size_t i = 0; i != CountTableSize; ++i)
+        _counts[i].store(0, std::memory_order_relaxed);
+
+    return count;
+}
+
+}
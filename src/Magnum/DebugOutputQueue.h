@@ -0,0 +1,220 @@
+#ifndef Magnum_DebugOutputQueue_h
+#define Magnum_DebugOutputQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::DebugOutputQueue
+ */
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "Magnum/DebugOutput.h"
+
+namespace Magnum {
+
+/**
+@brief Queued debug output
+
+The callback set with @ref DebugOutput::setCallback() is called for every
+message synchronously as it arrives, with the message copied into a
+`std::string`. That gets expensive when the driver repeatedly emits the same
+performance warning. This class instead copies the messages into a
+preallocated lock-free ring buffer and lets the application process them at a
+convenient time, usually once per frame:
+@code
+Renderer::enable(Renderer::Feature::DebugOutput);
+DebugOutputQueue queue;
+queue.install();
+
+// each frame
+queue.drain();
+@endcode
+
+Messages with the same ID are rate-limited --- only the first
+@ref rateLimit() occurrences between two @ref drain() calls are queued, the
+rest is only counted and the count is reported in @ref Message::count.
+Messages longer than @ref maxMessageLength() are truncated. If the ring is
+full, new messages are dropped, see @ref droppedCount().
+
+The messages can arrive from driver threads if
+@ref Renderer::Feature::DebugOutputSynchronous is not enabled, the queue
+supports multiple producers, but @ref drain() is expected to be called only
+from one thread at a time.
+@see @ref DebugOutput::setEnabled()
+*/
+class MAGNUM_EXPORT DebugOutputQueue {
+    public:
+        /** @brief Queued message */
+        struct Message {
+            DebugOutput::Source source;     /**< @brief Message source */
+            DebugOutput::Type type;         /**< @brief Message type */
+            UnsignedInt id;                 /**< @brief Message ID */
+            DebugOutput::Severity severity; /**< @brief Message severity */
+
+            /**
+             * @brief Occurrence count
+             *
+             * How many times a message with given ID was emitted since last
+             * @ref drain(), including the rate-limited ones.
+             */
+            UnsignedInt count;
+
+            std::string message;            /**< @brief Message string */
+        };
+
+        /**
+         * @brief Drain callback
+         *
+         * @see @ref drain()
+         */
+        typedef void(*Callback)(const Message&, const void*);
+
+        /**
+         * @brief Constructor
+         * @param capacity          Count of messages the queue can hold.
+         *      Rounded up to nearest power of two.
+         * @param maxMessageLength  Max length of stored message
+         */
+        explicit DebugOutputQueue(UnsignedInt capacity = 256, UnsignedInt maxMessageLength = 512);
+
+        /**
+         * @brief Destructor
+         *
+         * Calls @ref uninstall().
+         */
+        ~DebugOutputQueue();
+
+        /** @brief Copying is not allowed */
+        DebugOutputQueue(const DebugOutputQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        DebugOutputQueue(DebugOutputQueue&&) = delete;
+
+        /** @brief Copying is not allowed */
+        DebugOutputQueue& operator=(const DebugOutputQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        DebugOutputQueue& operator=(DebugOutputQueue&&) = delete;
+
+        /** @brief Count of messages the queue can hold */
+        UnsignedInt capacity() const { return _mask + 1; }
+
+        /** @brief Max length of stored message */
+        UnsignedInt maxMessageLength() const { return _maxMessageLength; }
+
+        /** @brief Max count of queued messages with the same ID per drain */
+        UnsignedInt rateLimit() const { return _rateLimit; }
+
+        /**
+         * @brief Set max count of queued messages with the same ID per drain
+         * @return Reference to self (for method chaining)
+         *
+         * Default is `1`, i.e. repeated messages are reported only once.
+         * IDs are tracked in a fixed-size table, so distinct IDs colliding
+         * in the table share the limit.
+         */
+        DebugOutputQueue& setRateLimit(UnsignedInt limit) {
+            _rateLimit = limit;
+            return *this;
+        }
+
+        /**
+         * @brief Install the queue as debug message callback
+         * @return Reference to self (for method chaining)
+         *
+         * Replaces any previously set callback. Calling
+         * @ref DebugOutput::setCallback() afterwards uninstalls the queue.
+         * @see @ref isInstalled()
+         */
+        DebugOutputQueue& install();
+
+        /** @brief Whether the queue is installed as debug message callback */
+        bool isInstalled() const;
+
+        /**
+         * @brief Uninstall the queue
+         * @return Reference to self (for method chaining)
+         *
+         * If the queue is installed, removes the debug message callback,
+         * otherwise does nothing. Queued messages are kept.
+         */
+        DebugOutputQueue& uninstall();
+
+        /**
+         * @brief Push message to the queue
+         *
+         * Called from the debug message callback, doesn't allocate or
+         * block. Can be used to add application messages directly.
+         */
+        void push(DebugOutput::Source source, DebugOutput::Type type, UnsignedInt id, DebugOutput::Severity severity, const char* message, std::size_t length);
+
+        /**
+         * @brief Process queued messages
+         * @param callback          Callback called for each message. If
+         *      `nullptr`, the messages are printed in the same format as with
+         *      @ref DebugOutput::setDefaultCallback(), with occurrence count
+         *      appended if it is larger than one.
+         * @param userParam         User parameter passed to the callback
+         * @return Count of processed messages
+         *
+         * Calls the callback for all queued messages in order of arrival
+         * and resets the rate limiting.
+         */
+        std::size_t drain(Callback callback = nullptr, const void* userParam = nullptr);
+
+        /**
+         * @brief Count of dropped messages
+         *
+         * Messages that didn't fit into the queue.
+         */
+        UnsignedInt droppedCount() const { return _droppedCount; }
+
+        /**
+         * @brief Count of suppressed messages
+         *
+         * Messages that weren't queued because of @ref rateLimit().
+         */
+        UnsignedInt suppressedCount() const { return _suppressedCount; }
+
+    private:
+        struct Slot;
+
+        static void callback(DebugOutput::Source source, DebugOutput::Type type, UnsignedInt id, DebugOutput::Severity severity, const std::string& message, const void* userParam);
+
+        UnsignedInt _mask, _maxMessageLength;
+        std::atomic<UnsignedInt> _rateLimit;
+        std::unique_ptr<Slot[]> _slots;
+        std::unique_ptr<char[]> _messages;
+        std::unique_ptr<std::atomic<UnsignedInt>[]> _counts;
+        std::atomic<UnsignedInt> _write, _read, _droppedCount, _suppressedCount;
+        Message _message;
+};
+
+}
+
+#endif
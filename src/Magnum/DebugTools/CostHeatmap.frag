@@ -0,0 +1,41 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Requires GL 3.0, which has both texelFetch() and user-defined outputs */
+
+uniform highp sampler2D costTexture;
+uniform highp float maxCost;
+uniform lowp float opacity;
+
+out lowp vec4 fragmentColor;
+
+void main() {
+    highp float cost = texelFetch(costTexture, ivec2(gl_FragCoord.xy), 0).r;
+    if(cost <= 0.0) discard;
+
+    /* Blue → cyan → green → yellow → red ramp */
+    highp float t = 4.0*clamp(cost/maxCost, 0.0, 1.0);
+    fragmentColor = vec4(clamp(vec3(t - 2.0, 2.0 - abs(t - 2.0), 2.0 - t), 0.0, 1.0), opacity);
+}
@@ -0,0 +1,261 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CostVisualizer.h"
+
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/Shader.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/TimeQuery.h"
+#include "Magnum/SceneGraph/AbstractCamera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/Shaders/Flat.h"
+#include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace DebugTools {
+
+namespace {
+
+class HeatmapShader: public AbstractShaderProgram {
+    public:
+        explicit HeatmapShader();
+
+        HeatmapShader& setMaxCost(Float cost) {
+            setUniform(maxCostUniform, cost);
+            return *this;
+        }
+
+        HeatmapShader& setOpacity(Float opacity) {
+            setUniform(opacityUniform, opacity);
+            return *this;
+        }
+
+        HeatmapShader& setTexture(Texture2D& texture) {
+            texture.bind(TextureUnit);
+            return *this;
+        }
+
+    private:
+        enum: Int { TextureUnit = 0 };
+
+        Int maxCostUniform,
+            opacityUniform;
+};
+
+HeatmapShader::HeatmapShader() {
+    Utility::Resource rs("MagnumDebugTools");
+
+    const Version version = Context::current()->supportedVersion({Version::GL330, Version::GL300});
+
+    Shader vert = Shaders::Implementation::createCompatibilityShader(rs, version, Shader::Type::Vertex);
+    Shader frag = Shaders::Implementation::createCompatibilityShader(rs, version, Shader::Type::Fragment);
+
+    vert.addSource(rs.get("FullScreenTriangle.glsl"))
+        .addSource(rs.get("CostHeatmap.vert"));
+    frag.addSource(rs.get("CostHeatmap.frag"));
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+
+    attachShaders({vert, frag});
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+    maxCostUniform = uniformLocation("maxCost");
+    opacityUniform = uniformLocation("opacity");
+    setUniform(uniformLocation("costTexture"), TextureUnit);
+}
+
+}
+
+template<UnsignedInt dimensions> struct CostVisualizer<dimensions>::State {
+    explicit State(const Vector2i& size, UnsignedInt frameCount);
+
+    Shaders::Flat<dimensions> flatShader;
+    HeatmapShader heatmapShader;
+    Texture2D cost;
+    Renderbuffer depth;
+    Framebuffer framebuffer;
+    Mesh fullScreenTriangle;
+    SceneGraph::DrawableGroup<dimensions, Float> costables;
+
+    /* Either measuring the registered drawables or rendering the cost pass */
+    bool measuring{};
+    UnsignedInt frameCount;
+    /* Index of the time query slot used by current measure() */
+    UnsignedInt slot{};
+};
+
+template<UnsignedInt dimensions> CostVisualizer<dimensions>::State::State(const Vector2i& size, const UnsignedInt frameCount): framebuffer{{{}, size}}, frameCount{frameCount} {
+    /* gl_VertexID is available on GL 3.0+, so no buffer is needed */
+    fullScreenTriangle.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(3);
+}
+
+template<UnsignedInt dimensions> class CostVisualizer<dimensions>::Costable: public SceneGraph::Drawable<dimensions, Float> {
+    public:
+        explicit Costable(SceneGraph::Drawable<dimensions, Float>& drawable, State& state, Mesh& mesh): SceneGraph::Drawable<dimensions, Float>{drawable.object(), &state.costables}, _state(state), _drawable(drawable), _mesh(mesh), _issued(state.frameCount, false), _milliseconds{}, _cost{} {
+            _queries.reserve(state.frameCount);
+            for(UnsignedInt i = 0; i != state.frameCount; ++i)
+                _queries.emplace_back(TimeQuery::Target::TimeElapsed);
+        }
+
+        SceneGraph::Drawable<dimensions, Float>& drawable() { return _drawable; }
+        Float milliseconds() const { return _milliseconds; }
+
+        /* Value written to the cost texture in the cost pass */
+        void setCost(Float cost) { _cost = cost; }
+
+    private:
+        void draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::AbstractCamera<dimensions, Float>& camera) override {
+            /* Draw the original drawable, collect the result of the query
+               issued frameCount frames ago before reusing it */
+            if(_state.measuring) {
+                TimeQuery& query = _queries[_state.slot];
+                if(_issued[_state.slot])
+                    _milliseconds = query.result<UnsignedLong>()/1.0e6f;
+
+                query.begin();
+                _drawable.draw(transformationMatrix, camera);
+                query.end();
+                _issued[_state.slot] = true;
+
+            /* Draw the footprint with cost of given mode. Overdraw is
+               counted with additive blending of ones. */
+            } else {
+                _state.flatShader.setTransformationProjectionMatrix(camera.projectionMatrix()*transformationMatrix)
+                    .setColor(Color4{_cost, 0.0f, 0.0f, 0.0f});
+                _mesh.draw(_state.flatShader);
+            }
+        }
+
+    private:
+        State& _state;
+        SceneGraph::Drawable<dimensions, Float>& _drawable;
+        Mesh& _mesh;
+        std::vector<TimeQuery> _queries;
+        std::vector<bool> _issued;
+        Float _milliseconds, _cost;
+};
+
+template<UnsignedInt dimensions> CostVisualizer<dimensions>::CostVisualizer(const Vector2i& size, const UnsignedInt frameCount): _mode{Mode::Overdraw}, _maxOverdraw{8.0f}, _maxDrawTime{1.0f}, _opacity{0.75f} {
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::timer_query);
+    CORRADE_ASSERT(frameCount, "DebugTools::CostVisualizer: expected at least one frame in flight", );
+
+    _state.reset(new State{size, frameCount});
+    setSize(size);
+}
+
+template<UnsignedInt dimensions> CostVisualizer<dimensions>::~CostVisualizer() {
+    /* The features reference the state, destroy them while it's still
+       alive */
+    while(!_state->costables.isEmpty()) delete &_state->costables[0];
+}
+
+template<UnsignedInt dimensions> Framebuffer& CostVisualizer<dimensions>::framebuffer() { return _state->framebuffer; }
+
+template<UnsignedInt dimensions> Texture2D& CostVisualizer<dimensions>::texture() { return _state->cost; }
+
+template<UnsignedInt dimensions> void CostVisualizer<dimensions>::setSize(const Vector2i& size) {
+    /* Texture storage is immutable, so it has to be recreated */
+    _state->cost = Texture2D{};
+    _state->cost.setMinificationFilter(Sampler::Filter::Nearest)
+        .setMagnificationFilter(Sampler::Filter::Nearest)
+        .setStorage(1, TextureFormat::R32F, size);
+    _state->depth.setStorage(RenderbufferFormat::DepthComponent24, size);
+    _state->framebuffer.attachTexture(Framebuffer::ColorAttachment{0}, _state->cost, 0)
+        .attachRenderbuffer(Framebuffer::BufferAttachment::Depth, _state->depth)
+        .mapForDraw(Framebuffer::ColorAttachment{0})
+        .setViewport({{}, size});
+}
+
+template<UnsignedInt dimensions> void CostVisualizer<dimensions>::add(SceneGraph::Drawable<dimensions, Float>& drawable, Mesh& mesh) {
+    new Costable{drawable, *_state, mesh};
+}
+
+template<UnsignedInt dimensions> void CostVisualizer<dimensions>::measure(SceneGraph::AbstractCamera<dimensions, Float>& camera) {
+    _state->measuring = true;
+    camera.draw(_state->costables);
+    _state->measuring = false;
+    _state->slot = (_state->slot + 1) % _state->frameCount;
+}
+
+template<UnsignedInt dimensions> auto CostVisualizer<dimensions>::drawTimes() const -> std::vector<std::pair<SceneGraph::Drawable<dimensions, Float>*, Float>> {
+    std::vector<std::pair<SceneGraph::Drawable<dimensions, Float>*, Float>> out;
+    out.reserve(_state->costables.size());
+    for(std::size_t i = 0; i != _state->costables.size(); ++i) {
+        Costable& costable = static_cast<Costable&>(_state->costables[i]);
+        out.emplace_back(&costable.drawable(), costable.milliseconds());
+    }
+    return out;
+}
+
+template<UnsignedInt dimensions> void CostVisualizer<dimensions>::draw(SceneGraph::AbstractCamera<dimensions, Float>& camera) {
+    for(std::size_t i = 0; i != _state->costables.size(); ++i) {
+        Costable& costable = static_cast<Costable&>(_state->costables[i]);
+        costable.setCost(_mode == Mode::Overdraw ? 1.0f : costable.milliseconds());
+    }
+
+    /* Float clear through glClearBuffer() isn't exposed, so the global clear
+       color gets reset */
+    Renderer::setClearColor(Color4{});
+    _state->framebuffer.clear(FramebufferClear::Color|FramebufferClear::Depth)
+        .bind(FramebufferTarget::Draw);
+
+    if(_mode == Mode::Overdraw) {
+        Renderer::enable(Renderer::Feature::Blending);
+        Renderer::setBlendFunction(Renderer::BlendFunction::One, Renderer::BlendFunction::One);
+    } else Renderer::disable(Renderer::Feature::Blending);
+
+    camera.draw(_state->costables);
+
+    Renderer::disable(Renderer::Feature::Blending);
+}
+
+template<UnsignedInt dimensions> void CostVisualizer<dimensions>::composite() {
+    Renderer::enable(Renderer::Feature::Blending);
+    Renderer::setBlendFunction(Renderer::BlendFunction::SourceAlpha, Renderer::BlendFunction::OneMinusSourceAlpha);
+
+    _state->heatmapShader.setMaxCost(_mode == Mode::Overdraw ? _maxOverdraw : _maxDrawTime)
+        .setOpacity(_opacity)
+        .setTexture(_state->cost);
+    _state->fullScreenTriangle.draw(_state->heatmapShader);
+
+    Renderer::disable(Renderer::Feature::Blending);
+}
+
+template class CostVisualizer<2>;
+template class CostVisualizer<3>;
+
+}}
@@ -0,0 +1,292 @@
+#ifndef Magnum_DebugTools_CostVisualizer_h
+#define Magnum_DebugTools_CostVisualizer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::DebugTools::CostVisualizer, typedef @ref Magnum::DebugTools::CostVisualizer2D, @ref Magnum::DebugTools::CostVisualizer3D
+ */
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/DebugTools/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Overdraw and draw cost visualizer
+
+Shows where the GPU time of a frame goes by rendering a per-pixel cost of
+registered drawables into a floating-point texture and compositing it as a
+heatmap over the frame. Pixels without any cost are left untouched, the
+cheapest pixels are blue, going through green to red for pixels reaching
+the maximal cost. Two modes are available:
+
+-   @ref Mode::Overdraw counts how many times each pixel is rasterized, using
+    additive blending. With depth test disabled every fragment is counted,
+    with depth test enabled only fragments passing it.
+-   @ref Mode::DrawTime shows the GPU time spent in the draw of the
+    drawable visible in each pixel, measured with a @ref TimeQuery around
+    each drawable's @ref SceneGraph::Drawable::draw() "draw()".
+
+## Basic usage
+
+Register drawables together with meshes which are used to render their
+footprint in the cost pass. The visualizer creates a hidden feature for each,
+which is destroyed together with the object:
+@code
+DebugTools::CostVisualizer3D visualizer{defaultFramebuffer.viewport().size()};
+visualizer.add(*drawable, mesh);
+@endcode
+
+When the visualization is enabled, draw the registered drawables through
+@ref measure() instead of @ref SceneGraph::AbstractCamera::draw(), which
+renders them as usual but measures the time of each draw. Then render the
+cost pass and composite the heatmap over the frame:
+@code
+void MyApplication::drawEvent() {
+    defaultFramebuffer.clear(FramebufferClear::Color|FramebufferClear::Depth);
+    visualizer.measure(camera);
+
+    visualizer.draw(camera);
+    defaultFramebuffer.bind(FramebufferTarget::Draw);
+    Renderer::disable(Renderer::Feature::DepthTest);
+    visualizer.composite();
+    Renderer::enable(Renderer::Feature::DepthTest);
+
+    swapBuffers();
+}
+@endcode
+
+The time queries are read back with a latency of @p frameCount frames, so
+the measurement doesn't stall the pipeline. Only one time elapsed query can
+be active at a time, so the drawables shouldn't use their own. The cost pass
+uses the current renderer state except for blending and leaves the cost
+framebuffer bound, so bind your framebuffer again before compositing. The
+composite pass covers the whole viewport, expects the depth test to be
+disabled and the bound framebuffer to have the same size as the cost
+texture.
+
+The registered drawables are expected to live as long as their objects.
+@see @ref CostVisualizer2D, @ref CostVisualizer3D, @ref Profiler
+@requires_gl33 Extension @extension{ARB,timer_query}
+@requires_gl Time queries and blending of floating-point render targets are
+    not available in OpenGL ES.
+*/
+template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT CostVisualizer {
+    public:
+        /**
+         * @brief Visualization mode
+         *
+         * @see @ref setMode()
+         */
+        enum class Mode: UnsignedByte {
+            /** Rasterized fragment count */
+            Overdraw,
+
+            /** Draw time of the visible drawable, in milliseconds */
+            DrawTime
+        };
+
+        /**
+         * @brief Constructor
+         * @param size          Size of the cost framebuffer
+         * @param frameCount    Count of frames the time measurements are
+         *      in flight
+         *
+         * The size should match size of the framebuffer the heatmap is
+         * composited onto.
+         */
+        explicit CostVisualizer(const Vector2i& size, UnsignedInt frameCount = 3);
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys all features created in @ref add().
+         */
+        ~CostVisualizer();
+
+        /** @brief Copying is not allowed */
+        CostVisualizer(const CostVisualizer<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        CostVisualizer(CostVisualizer<dimensions>&&) = delete;
+
+        /** @brief Copying is not allowed */
+        CostVisualizer<dimensions>& operator=(const CostVisualizer<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        CostVisualizer<dimensions>& operator=(CostVisualizer<dimensions>&&) = delete;
+
+        /** @brief Cost framebuffer */
+        Framebuffer& framebuffer();
+
+        /**
+         * @brief Cost texture
+         *
+         * Single-channel @ref TextureFormat::R32F texture containing the cost
+         * of each pixel after @ref draw().
+         */
+        Texture2D& texture();
+
+        /**
+         * @brief Set size of the cost framebuffer
+         *
+         * Call when the window is resized. Recreates the cost texture.
+         */
+        void setSize(const Vector2i& size);
+
+        /** @brief Visualization mode */
+        Mode mode() const { return _mode; }
+
+        /**
+         * @brief Set visualization mode
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref Mode::Overdraw.
+         */
+        CostVisualizer<dimensions>& setMode(Mode mode) {
+            _mode = mode;
+            return *this;
+        }
+
+        /** @brief Overdraw shown as the hottest color */
+        Float maxOverdraw() const { return _maxOverdraw; }
+
+        /**
+         * @brief Set overdraw shown as the hottest color
+         * @return Reference to self (for method chaining)
+         *
+         * Used in @ref Mode::Overdraw. Default is `8.0f`.
+         */
+        CostVisualizer<dimensions>& setMaxOverdraw(Float overdraw) {
+            _maxOverdraw = overdraw;
+            return *this;
+        }
+
+        /** @brief Draw time shown as the hottest color */
+        Float maxDrawTime() const { return _maxDrawTime; }
+
+        /**
+         * @brief Set draw time shown as the hottest color
+         * @return Reference to self (for method chaining)
+         *
+         * In milliseconds, used in @ref Mode::DrawTime. Default is `1.0f`.
+         */
+        CostVisualizer<dimensions>& setMaxDrawTime(Float milliseconds) {
+            _maxDrawTime = milliseconds;
+            return *this;
+        }
+
+        /** @brief Heatmap opacity */
+        Float opacity() const { return _opacity; }
+
+        /**
+         * @brief Set heatmap opacity
+         * @return Reference to self (for method chaining)
+         *
+         * Default is `0.75f`.
+         */
+        CostVisualizer<dimensions>& setOpacity(Float opacity) {
+            _opacity = opacity;
+            return *this;
+        }
+
+        /**
+         * @brief Register drawable for visualization
+         * @param drawable  Drawable
+         * @param mesh      Mesh with @ref Shaders::Flat::Position attribute
+         *      used for rendering the drawable footprint in the cost pass
+         *
+         * The mesh is expected to be alive for the whole lifetime of the
+         * object. It should be the same mesh as the drawable renders,
+         * otherwise the overdraw doesn't match.
+         */
+        void add(SceneGraph::Drawable<dimensions, Float>& drawable, Mesh& mesh);
+
+        /**
+         * @brief Draw registered drawables and measure their draw time
+         *
+         * Calls @ref SceneGraph::Drawable::draw() "draw()" of all registered
+         * drawables into currently bound framebuffer, each wrapped in a
+         * @ref TimeQuery. Results of the queries issued @p frameCount calls
+         * ago are collected at the same time.
+         * @see @ref drawTimes()
+         */
+        void measure(SceneGraph::AbstractCamera<dimensions, Float>& camera);
+
+        /**
+         * @brief Last measured draw times
+         *
+         * Pairs of registered drawables and their draw time in milliseconds.
+         * Drawables which were not measured yet have zero time, culled
+         * drawables keep the last measured value.
+         */
+        std::vector<std::pair<SceneGraph::Drawable<dimensions, Float>*, Float>> drawTimes() const;
+
+        /**
+         * @brief Render the cost pass
+         *
+         * Renders the cost of registered drawables according to @ref mode()
+         * into @ref texture(). Resets clear color to zero and leaves
+         * @ref framebuffer() bound for drawing, bind the target framebuffer
+         * before calling @ref composite().
+         */
+        void draw(SceneGraph::AbstractCamera<dimensions, Float>& camera);
+
+        /**
+         * @brief Composite the heatmap
+         *
+         * Blends the heatmap of @ref texture() over currently bound
+         * framebuffer.
+         */
+        void composite();
+
+    private:
+        class Costable;
+        struct State;
+
+        std::unique_ptr<State> _state;
+        Mode _mode;
+        Float _maxOverdraw, _maxDrawTime, _opacity;
+};
+
+/** @brief Two-dimensional cost visualizer */
+typedef CostVisualizer<2> CostVisualizer2D;
+
+/** @brief Three-dimensional cost visualizer */
+typedef CostVisualizer<3> CostVisualizer3D;
+
+}}
+#else
+#error this header is not available in OpenGL ES build
+#endif
+
+#endif
@@ -39,12 +39,35 @@ typedef ForceRenderer<2> ForceRenderer2D;
 typedef ForceRenderer<3> ForceRenderer3D;
 class ForceRendererOptions;
 
+template<UnsignedInt> class LineBatch;
+typedef LineBatch<2> LineBatch2D;
+typedef LineBatch<3> LineBatch3D;
+
 template<UnsignedInt> class ObjectRenderer;
 typedef ObjectRenderer<2> ObjectRenderer2D;
 typedef ObjectRenderer<3> ObjectRenderer3D;
 class ObjectRendererOptions;
 
+#ifndef MAGNUM_TARGET_GLES
+template<UnsignedInt> class CostVisualizer;
+typedef CostVisualizer<2> CostVisualizer2D;
+typedef CostVisualizer<3> CostVisualizer3D;
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+class FrameCapture;
+
+template<UnsignedInt> class ObjectPicker;
+typedef ObjectPicker<2> ObjectPicker2D;
+typedef ObjectPicker<3> ObjectPicker3D;
+#endif
+
 class Profiler;
+
+template<UnsignedInt> class RendererBatch;
+typedef RendererBatch<2> RendererBatch2D;
+typedef RendererBatch<3> RendererBatch3D;
+
 class ResourceManager;
 
 template<UnsignedInt> class ShapeRenderer;
@@ -27,6 +27,7 @@
 
 #include "Magnum/Buffer.h"
 #include "Magnum/Mesh.h"
+#include "Magnum/DebugTools/RendererBatch.h"
 #include "Magnum/DebugTools/ResourceManager.h"
 #include "Magnum/SceneGraph/AbstractCamera.h"
 #include "Magnum/Shaders/Flat.h"
@@ -41,6 +42,24 @@ template<UnsignedInt dimensions> ResourceKey shaderKey();
 template<> inline ResourceKey shaderKey<2>() { return ResourceKey("FlatShader2D"); }
 template<> inline ResourceKey shaderKey<3>() { return ResourceKey("FlatShader3D"); }
 
+/* The mesh has the same vertex layout in both cases, but the per-instance
+   transformation attached by RendererBatch differs, so it's not shared */
+template<UnsignedInt dimensions> ResourceKey meshKey();
+template<> inline ResourceKey meshKey<2>() { return ResourceKey("force2d"); }
+template<> inline ResourceKey meshKey<3>() { return ResourceKey("force3d"); }
+
+template<UnsignedInt dimensions> ResourceKey vertexBufferKey();
+template<> inline ResourceKey vertexBufferKey<2>() { return ResourceKey("force2d-vertices"); }
+template<> inline ResourceKey vertexBufferKey<3>() { return ResourceKey("force3d-vertices"); }
+
+template<UnsignedInt dimensions> ResourceKey indexBufferKey();
+template<> inline ResourceKey indexBufferKey<2>() { return ResourceKey("force2d-indices"); }
+template<> inline ResourceKey indexBufferKey<3>() { return ResourceKey("force3d-indices"); }
+
+template<UnsignedInt dimensions> ResourceKey instanceBufferKey();
+template<> inline ResourceKey instanceBufferKey<2>() { return ResourceKey("force2d-instances"); }
+template<> inline ResourceKey instanceBufferKey<3>() { return ResourceKey("force3d-instances"); }
+
 constexpr std::array<Vector2, 4> positions{{
     {0.0f,  0.0f},
     {1.0f,  0.0f},
@@ -62,9 +81,10 @@ template<UnsignedInt dimensions> ForceRenderer<dimensions>::ForceRenderer(SceneG
     if(!shader) ResourceManager::instance().set<AbstractShaderProgram>(shader.key(), new Shaders::Flat<dimensions>);
 
     /* Mesh and vertex buffer */
-    mesh = ResourceManager::instance().get<Mesh>("force");
-    vertexBuffer = ResourceManager::instance().get<Buffer>("force-vertices");
-    indexBuffer = ResourceManager::instance().get<Buffer>("force-indices");
+    mesh = ResourceManager::instance().get<Mesh>(meshKey<dimensions>());
+    vertexBuffer = ResourceManager::instance().get<Buffer>(vertexBufferKey<dimensions>());
+    indexBuffer = ResourceManager::instance().get<Buffer>(indexBufferKey<dimensions>());
+    instanceBuffer = ResourceManager::instance().get<Buffer>(instanceBufferKey<dimensions>());
     if(mesh) return;
 
     /* Create the mesh */
@@ -90,7 +110,14 @@ template<UnsignedInt dimensions> ForceRenderer<dimensions>::ForceRenderer(SceneG
 template<UnsignedInt dimensions> ForceRenderer<dimensions>::~ForceRenderer() = default;
 
 template<UnsignedInt dimensions> void ForceRenderer<dimensions>::draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::AbstractCamera<dimensions, Float>& camera) {
-    shader->setTransformationProjectionMatrix(camera.projectionMatrix()*Implementation::forceRendererTransformation<dimensions>(transformationMatrix.transformPoint(forcePosition), force)*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{options->scale()}))
+    const MatrixTypeFor<dimensions, Float> transformationProjectionMatrix = camera.projectionMatrix()*Implementation::forceRendererTransformation<dimensions>(transformationMatrix.transformPoint(forcePosition), force)*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{options->scale()});
+
+    if(RendererBatch<dimensions>* const batch = RendererBatch<dimensions>::current()) {
+        batch->addFlatInstance(mesh, nullptr, instanceBuffer, transformationProjectionMatrix, options->color());
+        return;
+    }
+
+    shader->setTransformationProjectionMatrix(transformationProjectionMatrix)
         .setColor(options->color());
     mesh->draw(*shader);
 }
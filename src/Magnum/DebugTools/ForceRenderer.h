@@ -83,7 +83,8 @@ class ForceRendererOptions {
 @brief Force renderer
 
 Visualizes force pushing on object by an arrow of the same direction and size.
-See @ref debug-tools-renderers for more information.
+See @ref debug-tools-renderers for more information. All force renderers can be
+drawn with a single draw call using @ref RendererBatch.
 
 @anchor DebugTools-ForceRenderer-usage
 ## Basic usage
@@ -137,7 +138,7 @@ template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT ForceRenderer: p
         Resource<ForceRendererOptions> options;
         Resource<AbstractShaderProgram, Shaders::Flat<dimensions>> shader;
         Resource<Mesh> mesh;
-        Resource<Buffer> vertexBuffer, indexBuffer;
+        Resource<Buffer> vertexBuffer, indexBuffer, instanceBuffer;
 };
 
 /** @brief Two-dimensional force renderer */
@@ -0,0 +1,192 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FrameCapture.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/ImageReference.h"
+#include "Magnum/TaskScheduler.h"
+#include "Magnum/Trade/AbstractImageConverter.h"
+
+namespace Magnum { namespace DebugTools {
+
+struct FrameCapture::Job {
+    /* Both buffers are reused for all images encoded using this job */
+    std::vector<char> pixels, encoded;
+    ColorFormat format;
+    ColorType type;
+    Vector2i size;
+    std::string filename;
+};
+
+struct FrameCapture::State {
+    explicit State(Trade::AbstractImageConverter& converter, UnsignedInt threadCount, UnsignedInt jobCount): converter(converter), scheduler(TaskScheduler::global()), threadCount{threadCount}, jobCount{jobCount}, writtenCount{0}, failedCount{0} {}
+
+    void encode(Job& job);
+
+    Trade::AbstractImageConverter& converter;
+    TaskScheduler& scheduler;
+    const UnsignedInt threadCount, jobCount;
+    std::atomic<UnsignedInt> writtenCount, failedCount;
+
+    /* All allocated jobs and the ones not used by any task, guarded by the
+       mutex */
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Job>> jobs;
+    std::vector<Job*> free;
+
+    /* Submitted tasks, some of them may be already finished. Touched only
+       from the render thread. */
+    std::deque<Task> tasks;
+};
+
+void FrameCapture::State::encode(Job& job) {
+    bool success = converter.exportToData(ImageReference2D{job.format, job.type, job.size, job.pixels.data()}, job.encoded);
+    if(success) {
+        std::ofstream out{job.filename, std::ofstream::binary};
+        if(!out.write(job.encoded.data(), job.encoded.size())) {
+            Error() << "DebugTools::FrameCapture: cannot write to file" << job.filename;
+            success = false;
+        }
+    }
+    ++(success ? writtenCount : failedCount);
+
+    std::lock_guard<std::mutex> lock{mutex};
+    free.push_back(&job);
+}
+
+FrameCapture::FrameCapture(Trade::AbstractImageConverter& converter, const ColorFormat format, const ColorType type, const UnsignedInt threadCount, const UnsignedInt frameCount): _queue{format, type, frameCount}, _droppedCount{0} {
+    CORRADE_ASSERT(converter.features() & Trade::AbstractImageConverter::Feature::ConvertData,
+        "DebugTools::FrameCapture: the converter doesn't support exporting to data", );
+    CORRADE_ASSERT(threadCount,
+        "DebugTools::FrameCapture: expected at least one thread", );
+
+    /* Staging buffers for images waiting for or being encoded. Allocated
+       lazily, when there is none available the completed readbacks stay in
+       the queue and subsequent captures are dropped. */
+    _state.reset(new State{converter, threadCount, threadCount + frameCount});
+}
+
+FrameCapture::~FrameCapture() { finish(); }
+
+UnsignedInt FrameCapture::threadCount() const { return _state->threadCount; }
+
+UnsignedInt FrameCapture::writtenCount() const { return _state->writtenCount; }
+
+UnsignedInt FrameCapture::droppedCount() const { return _droppedCount; }
+
+UnsignedInt FrameCapture::failedCount() const { return _state->failedCount; }
+
+bool FrameCapture::capture(AbstractFramebuffer& framebuffer, const Range2Di& rectangle, std::string filename) {
+    if(!_queue.read(framebuffer, rectangle)) {
+        ++_droppedCount;
+        return false;
+    }
+
+    _filenames.push_back(std::move(filename));
+    return true;
+}
+
+void FrameCapture::update() {
+    while(dispatch(false)) {}
+}
+
+void FrameCapture::finish() {
+    while(dispatch(true)) {}
+
+    for(const Task& task: _state->tasks) _state->scheduler.wait(task);
+    _state->tasks.clear();
+}
+
+bool FrameCapture::dispatch(const bool wait) {
+    if(!_queue.pendingCount()) return false;
+
+    State& state = *_state;
+    while(!state.tasks.empty() && state.tasks.front().isDone())
+        state.tasks.pop_front();
+
+    /* Get a free staging buffer, allocate a new one if the limit is not
+       reached yet. Otherwise all of them are used by the tasks, wait for the
+       oldest one. If the scheduler has no workers, the tasks are executed
+       only while waiting, so wait even if not asked to. */
+    Job* job;
+    {
+        std::unique_lock<std::mutex> lock{state.mutex};
+        while(state.free.empty() && state.jobs.size() == state.jobCount) {
+            if(!wait && state.scheduler.threadCount() > 1) return false;
+
+            const Task task = state.tasks.front();
+            state.tasks.pop_front();
+            lock.unlock();
+            state.scheduler.wait(task);
+            lock.lock();
+        }
+
+        if(!state.free.empty()) {
+            job = state.free.back();
+            state.free.pop_back();
+        } else {
+            state.jobs.emplace_back(new Job);
+            job = state.jobs.back().get();
+        }
+    }
+
+    const ImageReference2D image = wait ? _queue.get() : _queue.tryGet();
+    if(!image.data()) {
+        std::lock_guard<std::mutex> lock{state.mutex};
+        state.free.push_back(job);
+        return false;
+    }
+
+    /* Copy the data out so the buffer can be unmapped and reused for next
+       readback right away. Assigning same-sized data doesn't reallocate. */
+    job->pixels.assign(image.data(), image.data() + image.dataSize(image.size()));
+    job->format = image.format();
+    job->type = image.type();
+    job->size = image.size();
+    job->filename = std::move(_filenames.front());
+    _filenames.pop_front();
+    _queue.release();
+
+    /* At most threadCount images are encoded at the same time, so each task
+       waits for the one submitted threadCount tasks before. The tasks pruned
+       from the deque are already finished. */
+    Task dependency;
+    if(state.tasks.size() >= state.threadCount)
+        dependency = state.tasks[state.tasks.size() - state.threadCount];
+    state.tasks.push_back(state.scheduler.submit([&state, job]() {
+        state.encode(*job);
+    }, {dependency}));
+    return true;
+}
+
+}}
+#endif
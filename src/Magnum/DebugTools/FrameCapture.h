@@ -0,0 +1,181 @@
+#ifndef Magnum_DebugTools_FrameCapture_h
+#define Magnum_DebugTools_FrameCapture_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::DebugTools::FrameCapture
+ */
+
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "Magnum/FramebufferReadbackQueue.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/DebugTools/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Asynchronous screenshot and video frame capture
+
+Captures framebuffer contents into files without stalling the render thread.
+The pixels are read back using @ref FramebufferReadbackQueue. Once a readback
+completes, @ref update() copies the pixels into a staging buffer and submits
+a task to @ref TaskScheduler::global() that encodes the image with given
+@ref Trade::AbstractImageConverter and writes the file. Both the staging and
+the encoding buffers are reused, so steady-state capture doesn't allocate.
+Example usage for recording each frame into a numbered TGA sequence:
+@code
+PluginManager::Manager<Trade::AbstractImageConverter> manager{MAGNUM_PLUGINS_IMAGECONVERTER_DIR};
+std::unique_ptr<Trade::AbstractImageConverter> converter = manager.instance("TgaImageConverter");
+DebugTools::FrameCapture capture{*converter, ColorFormat::BGRA, ColorType::UnsignedByte};
+
+// each frame, after drawing
+capture.capture(defaultFramebuffer, defaultFramebuffer.viewport(),
+    Utility::formatString("frame{:.05}.tga", frame));
+capture.update();
+
+// at the end of recording
+capture.finish();
+@endcode
+
+If all readbacks or all staging buffers are in use, the frame is dropped
+instead of blocking, see @ref droppedCount(). Increase the frame count or the
+thread count if that happens often. If the scheduler has no worker threads,
+the images are encoded on the render thread in @ref update() once all staging
+buffers are in use, or in @ref finish(). Up to thread count images are
+encoded at the same time, so the converter must not modify any internal state
+during conversion, which holds for
+@ref Trade::TgaImageConverter "TgaImageConverter". Pass `1` as thread count
+otherwise.
+@requires_gles30 Pixel buffer objects are not available in OpenGL ES 2.0.
+@requires_webgl20 Buffer mapping is not available in WebGL.
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT FrameCapture {
+    public:
+        /**
+         * @brief Constructor
+         * @param converter     Converter used to encode captured images.
+         *      Expected to support @ref Trade::AbstractImageConverter::Feature::ConvertData.
+         * @param format        Format of read pixel data
+         * @param type          Data type of read pixel data
+         * @param threadCount   Max count of images encoded in parallel
+         * @param frameCount    Count of readbacks in flight
+         *
+         * The converter is not owned by the class and is expected to be
+         * alive for whole instance lifetime. The tasks are submitted to the
+         * scheduler that's global at construction time.
+         */
+        explicit FrameCapture(Trade::AbstractImageConverter& converter, ColorFormat format, ColorType type, UnsignedInt threadCount = 2, UnsignedInt frameCount = 3);
+
+        /**
+         * @brief Destructor
+         *
+         * Calls @ref finish().
+         */
+        ~FrameCapture();
+
+        /** @brief Copying is not allowed */
+        FrameCapture(const FrameCapture&) = delete;
+
+        /** @brief Moving is not allowed */
+        FrameCapture(FrameCapture&&) = delete;
+
+        /** @brief Copying is not allowed */
+        FrameCapture& operator=(const FrameCapture&) = delete;
+
+        /** @brief Moving is not allowed */
+        FrameCapture& operator=(FrameCapture&&) = delete;
+
+        /** @brief Max count of images encoded in parallel */
+        UnsignedInt threadCount() const;
+
+        /**
+         * @brief Capture framebuffer contents into a file
+         * @return `False` if the frame was dropped, `true` otherwise
+         *
+         * Issues asynchronous readback of given rectangle, the file is
+         * written later, after the readback completes and the image is
+         * encoded. Doesn't block.
+         * @see @ref update(), @ref FramebufferReadbackQueue::read()
+         */
+        bool capture(AbstractFramebuffer& framebuffer, const Range2Di& rectangle, std::string filename);
+
+        /**
+         * @brief Submit encoding of completed readbacks
+         *
+         * Expected to be called once per frame. Doesn't block if the
+         * scheduler has worker threads.
+         * @see @ref FramebufferReadbackQueue::tryGet()
+         */
+        void update();
+
+        /**
+         * @brief Finish all pending captures
+         *
+         * Waits for all readbacks and until all files are written.
+         */
+        void finish();
+
+        /** @brief Count of written files */
+        UnsignedInt writtenCount() const;
+
+        /**
+         * @brief Count of dropped frames
+         *
+         * Frames that were dropped in @ref capture() because all readbacks
+         * or staging buffers were in use.
+         */
+        UnsignedInt droppedCount() const;
+
+        /**
+         * @brief Count of failed captures
+         *
+         * Frames which failed to be encoded or written. The reason is
+         * printed to error output.
+         */
+        UnsignedInt failedCount() const;
+
+    private:
+        struct Job;
+        struct State;
+
+        bool dispatch(bool wait);
+
+        FramebufferReadbackQueue _queue;
+        std::deque<std::string> _filenames;
+        std::unique_ptr<State> _state;
+        UnsignedInt _droppedCount;
+};
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
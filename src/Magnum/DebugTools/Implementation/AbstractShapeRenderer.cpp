@@ -28,6 +28,8 @@
 #include "Magnum/AbstractShaderProgram.h"
 #include "Magnum/Buffer.h"
 #include "Magnum/Mesh.h"
+#include "Magnum/MeshView.h"
+#include "Magnum/DebugTools/RendererBatch.h"
 #include "Magnum/DebugTools/ResourceManager.h"
 #include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/Shaders/Flat.h"
@@ -110,11 +112,12 @@ template<> void create<3>(Trade::MeshData3D& data, Resource<Mesh>& meshResource,
 
 }
 
-template<UnsignedInt dimensions> AbstractShapeRenderer<dimensions>::AbstractShapeRenderer(ResourceKey meshKey, ResourceKey vertexBufferKey, ResourceKey indexBufferKey) {
+template<UnsignedInt dimensions> AbstractShapeRenderer<dimensions>::AbstractShapeRenderer(ResourceKey meshKey, ResourceKey vertexBufferKey, ResourceKey indexBufferKey, ResourceKey instanceBufferKey) {
     wireframeShader = ResourceManager::instance().get<AbstractShaderProgram, Shaders::Flat<dimensions>>(shaderKey<dimensions>());
     wireframeMesh = ResourceManager::instance().get<Mesh>(meshKey);
     vertexBuffer = ResourceManager::instance().get<Buffer>(vertexBufferKey);
     indexBuffer = ResourceManager::instance().get<Buffer>(indexBufferKey);
+    instanceBuffer = ResourceManager::instance().get<Buffer>(instanceBufferKey);
 
     if(!wireframeShader) ResourceManager::instance().set<AbstractShaderProgram>(shaderKey<dimensions>(),
         new Shaders::Flat<dimensions>, ResourceDataState::Final, ResourcePolicy::Resident);
@@ -126,6 +129,18 @@ template<UnsignedInt dimensions> void AbstractShapeRenderer<dimensions>::createR
     create<dimensions>(data, wireframeMesh, vertexBuffer, indexBuffer);
 }
 
+template<UnsignedInt dimensions> void AbstractShapeRenderer<dimensions>::drawWireframe(const MatrixTypeFor<dimensions, Float>& transformationProjectionMatrix, const Color4& color, MeshView* const view) {
+    if(RendererBatch<dimensions>* const batch = RendererBatch<dimensions>::current()) {
+        batch->addFlatInstance(wireframeMesh, view, instanceBuffer, transformationProjectionMatrix, color);
+        return;
+    }
+
+    wireframeShader->setTransformationProjectionMatrix(transformationProjectionMatrix)
+        .setColor(color);
+    if(view) view->draw(*wireframeShader);
+    else wireframeMesh->draw(*wireframeShader);
+}
+
 template class AbstractShapeRenderer<2>;
 template class AbstractShapeRenderer<3>;
 
@@ -25,6 +25,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include "Magnum/Color.h"
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/Resource.h"
 #include "Magnum/DebugTools/DebugTools.h"
@@ -47,7 +48,7 @@ template<> struct MeshData<3> { typedef Trade::MeshData3D Type; };
 
 template<UnsignedInt dimensions> class AbstractShapeRenderer {
     public:
-        AbstractShapeRenderer(ResourceKey mesh, ResourceKey vertexBuffer, ResourceKey indexBuffer);
+        AbstractShapeRenderer(ResourceKey mesh, ResourceKey vertexBuffer, ResourceKey indexBuffer, ResourceKey instanceBuffer);
         virtual ~AbstractShapeRenderer();
 
         virtual void draw(Resource<ShapeRendererOptions>& options, const MatrixTypeFor<dimensions, Float>& projectionMatrix) = 0;
@@ -56,11 +57,15 @@ template<UnsignedInt dimensions> class AbstractShapeRenderer {
         /* Call only if the mesh resource isn't already present */
         void createResources(typename MeshData<dimensions>::Type data);
 
+        /* Draws the whole mesh or given view of it, or adds it to currently
+           active RendererBatch */
+        void drawWireframe(const MatrixTypeFor<dimensions, Float>& transformationProjectionMatrix, const Color4& color, MeshView* view = nullptr);
+
         Resource<AbstractShaderProgram, Shaders::Flat<dimensions>> wireframeShader;
         Resource<Mesh> wireframeMesh;
 
     private:
-        Resource<Buffer> indexBuffer, vertexBuffer;
+        Resource<Buffer> indexBuffer, vertexBuffer, instanceBuffer;
 };
 
 }}}
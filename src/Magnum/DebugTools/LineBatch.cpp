@@ -0,0 +1,228 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "LineBatch.h"
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/DebugTools/ResourceManager.h"
+#include "Magnum/SceneGraph/AbstractCamera.h"
+#include "Magnum/Shaders/VertexColor.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/BufferRing.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#endif
+
+namespace Magnum { namespace DebugTools {
+
+namespace {
+
+template<UnsignedInt dimensions> LineBatch<dimensions>*& internalInstance() {
+    static LineBatch<dimensions>* instance = nullptr;
+    return instance;
+}
+
+template<UnsignedInt dimensions> ResourceKey shaderKey();
+template<> inline ResourceKey shaderKey<2>() { return ResourceKey("VertexColorShader2D"); }
+template<> inline ResourceKey shaderKey<3>() { return ResourceKey("VertexColorShader3D"); }
+
+/* Box edges as pairs of corner indices, bit i of the index is coordinate i */
+template<UnsignedInt dimensions> struct BoxEdges;
+template<> struct BoxEdges<2> {
+    static constexpr UnsignedByte indices[]{0, 1, 1, 3, 3, 2, 2, 0};
+};
+template<> struct BoxEdges<3> {
+    static constexpr UnsignedByte indices[]{
+        0, 1, 1, 3, 3, 2, 2, 0, /* Back face */
+        4, 5, 5, 7, 7, 6, 6, 4, /* Front face */
+        0, 4, 1, 5, 2, 6, 3, 7  /* Connecting edges */
+    };
+};
+
+constexpr UnsignedByte BoxEdges<2>::indices[];
+constexpr UnsignedByte BoxEdges<3>::indices[];
+
+template<UnsignedInt dimensions> inline VectorTypeFor<dimensions, Float> boxCorner(const UnsignedByte index) {
+    VectorTypeFor<dimensions, Float> corner;
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        corner[i] = index & (1 << i) ? 1.0f : -1.0f;
+    return corner;
+}
+
+template<UnsignedInt dimensions> inline VectorTypeFor<dimensions, Float> circlePoint(const Float angle) {
+    VectorTypeFor<dimensions, Float> point;
+    point[0] = Math::cos(Rad(angle));
+    point[1] = Math::sin(Rad(angle));
+    return point;
+}
+
+}
+
+template<UnsignedInt dimensions> LineBatch<dimensions>& LineBatch<dimensions>::instance() {
+    CORRADE_ASSERT(internalInstance<dimensions>(), "DebugTools::LineBatch::instance(): no instance exists", *internalInstance<dimensions>());
+    return *internalInstance<dimensions>();
+}
+
+template<UnsignedInt dimensions> LineBatch<dimensions>::LineBatch(const UnsignedInt capacity, const UnsignedInt frameCount): _capacity{capacity}, _lineCount{0}, _droppedCount{0}, _firstVertex{0}, _buffer{Buffer::TargetHint::Array} {
+    CORRADE_ASSERT(!internalInstance<dimensions>(), "DebugTools::LineBatch::LineBatch(): another instance is already created", );
+    internalInstance<dimensions>() = this;
+
+    _shader = ResourceManager::instance().get<AbstractShaderProgram, Shaders::VertexColor<dimensions>>(shaderKey<dimensions>());
+    if(!_shader) ResourceManager::instance().set<AbstractShaderProgram>(_shader.key(), new Shaders::VertexColor<dimensions>);
+
+    Buffer* buffer = &_buffer;
+
+    /* Stream directly into mapped memory, if possible */
+    #ifndef MAGNUM_TARGET_GLES2
+    #ifndef MAGNUM_TARGET_GLES
+    if(Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+    #endif
+    {
+        _ring.reset(new BufferRing{Buffer::TargetHint::Array, GLsizeiptr(capacity*2*sizeof(Vertex)), frameCount});
+        _ring->beginFrame();
+        buffer = &_ring->buffer();
+    }
+    #else
+    static_cast<void>(frameCount);
+    #endif
+
+    /* Otherwise collect the data in preallocated memory */
+    if(buffer == &_buffer) _vertices.reserve(capacity*2);
+
+    _mesh.setPrimitive(MeshPrimitive::Lines)
+        .addVertexBuffer(*buffer, 0,
+            typename Shaders::VertexColor<dimensions>::Position{},
+            typename Shaders::VertexColor<dimensions>::Color{});
+}
+
+template<UnsignedInt dimensions> LineBatch<dimensions>::~LineBatch() {
+    CORRADE_INTERNAL_ASSERT(internalInstance<dimensions>() == this);
+    internalInstance<dimensions>() = nullptr;
+}
+
+template<UnsignedInt dimensions> auto LineBatch<dimensions>::allocateLine() -> Vertex* {
+    if(_lineCount == _capacity) {
+        ++_droppedCount;
+        return nullptr;
+    }
+
+    #ifndef MAGNUM_TARGET_GLES2
+    if(_ring) {
+        /* Consecutive allocations with unit alignment are contiguous, so
+           it's enough to remember where the first one is */
+        const BufferRing::Allocation allocation = _ring->allocate(2*sizeof(Vertex));
+        if(!_lineCount++) _firstVertex = allocation.offset/sizeof(Vertex);
+        return static_cast<Vertex*>(allocation.data);
+    }
+    #endif
+
+    /* Capacity is reserved, this doesn't reallocate */
+    _vertices.resize(_vertices.size() + 2);
+    ++_lineCount;
+    return _vertices.data() + _vertices.size() - 2;
+}
+
+template<UnsignedInt dimensions> LineBatch<dimensions>& LineBatch<dimensions>::add(const VectorTypeFor<dimensions, Float>& a, const VectorTypeFor<dimensions, Float>& b, const Color3& colorA, const Color3& colorB) {
+    if(Vertex* const vertices = allocateLine()) {
+        vertices[0] = {a, colorA};
+        vertices[1] = {b, colorB};
+    }
+
+    return *this;
+}
+
+template<UnsignedInt dimensions> LineBatch<dimensions>& LineBatch<dimensions>::addCross(const VectorTypeFor<dimensions, Float>& position, const Float size, const Color3& color) {
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        VectorTypeFor<dimensions, Float> offset;
+        offset[i] = size/2;
+        add(position - offset, position + offset, color);
+    }
+
+    return *this;
+}
+
+template<UnsignedInt dimensions> LineBatch<dimensions>& LineBatch<dimensions>::addBox(const MatrixTypeFor<dimensions, Float>& transformation, const Color3& color) {
+    const UnsignedByte* const indices = BoxEdges<dimensions>::indices;
+    constexpr std::size_t count = sizeof(BoxEdges<dimensions>::indices);
+    for(std::size_t i = 0; i != count; i += 2)
+        add(transformation.transformPoint(boxCorner<dimensions>(indices[i])),
+            transformation.transformPoint(boxCorner<dimensions>(indices[i + 1])), color);
+
+    return *this;
+}
+
+template<UnsignedInt dimensions> LineBatch<dimensions>& LineBatch<dimensions>::addCircle(const MatrixTypeFor<dimensions, Float>& transformation, const Color3& color, const UnsignedInt segments) {
+    CORRADE_ASSERT(segments >= 3, "DebugTools::LineBatch::addCircle(): expected at least three segments", *this);
+
+    const Float step = Constants::tau()/segments;
+    VectorTypeFor<dimensions, Float> previous = transformation.transformPoint(circlePoint<dimensions>(0.0f));
+    for(UnsignedInt i = 1; i <= segments; ++i) {
+        const VectorTypeFor<dimensions, Float> current = transformation.transformPoint(circlePoint<dimensions>(i == segments ? 0.0f : i*step));
+        add(previous, current, color);
+        previous = current;
+    }
+
+    return *this;
+}
+
+template<UnsignedInt dimensions> void LineBatch<dimensions>::draw(const MatrixTypeFor<dimensions, Float>& transformationProjectionMatrix) {
+    #ifndef MAGNUM_TARGET_GLES2
+    if(_ring) _ring->flush();
+    else
+    #endif
+    {
+        _buffer.setData(_vertices, BufferUsage::StreamDraw);
+        _firstVertex = 0;
+    }
+
+    if(_lineCount) {
+        _shader->setTransformationProjectionMatrix(transformationProjectionMatrix);
+        _mesh.setCount(_lineCount*2)
+            .setBaseVertex(_firstVertex)
+            .draw(*_shader);
+    }
+
+    /* Fence the region after the draw and start writing into next one */
+    #ifndef MAGNUM_TARGET_GLES2
+    if(_ring) {
+        _ring->endFrame();
+        _ring->beginFrame();
+    }
+    #endif
+
+    _vertices.clear();
+    _lineCount = _droppedCount = 0;
+}
+
+template<UnsignedInt dimensions> void LineBatch<dimensions>::draw(SceneGraph::AbstractCamera<dimensions, Float>& camera) {
+    draw(camera.projectionMatrix()*camera.cameraMatrix());
+}
+
+template class LineBatch<2>;
+template class LineBatch<3>;
+
+}}
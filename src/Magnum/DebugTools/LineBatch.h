@@ -0,0 +1,230 @@
+#ifndef Magnum_DebugTools_LineBatch_h
+#define Magnum_DebugTools_LineBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::DebugTools::LineBatch, typedef @ref Magnum::DebugTools::LineBatch2D, @ref Magnum::DebugTools::LineBatch3D, function @ref Magnum::DebugTools::lines()
+ */
+
+#include <memory>
+#include <vector>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Color.h"
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Resource.h"
+#include "Magnum/DebugTools/visibility.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/Shaders/Shaders.h"
+
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Immediate-mode debug line batch
+
+Collects lines and simple wireframe shapes for one frame and draws all of them
+with a single draw call. Unlike @ref ShapeRenderer or @ref ObjectRenderer no
+object features need to be created, which is handy for transient
+visualization like contact points, rays or velocity vectors. Similarly to
+@ref ResourceManager, there can be only one instance of given dimension count
+and it is globally accessible through @ref instance() or @ref lines(). Example
+usage:
+@code
+// Create the batch at application startup
+DebugTools::ResourceManager manager;
+DebugTools::LineBatch3D lines;
+
+// Anywhere during the frame
+DebugTools::lines().add(a, b, Color3::fromHSV(120.0_degf, 1.0f, 0.7f))
+    .addCross(contactPoint, 0.1f, {1.0f, 0.0f, 0.0f});
+
+// At the end of the frame
+lines.draw(camera);
+@endcode
+
+The lines are drawn using @ref Shaders::VertexColor, which is shared with
+@ref ObjectRenderer through @ref ResourceManager instance, thus it is
+expected to exist for whole lifetime of the batch.
+
+## Performance optimizations
+
+The vertices are written directly into @ref BufferRing memory, persistently
+mapped if @extension{ARB,buffer_storage} is available, and the region is
+guarded by a fence, so there are no allocations, copies or stalls in steady
+state. If buffer mapping is not available (OpenGL ES 2.0, WebGL or
+@extension{ARB,map_buffer_range} not supported), the vertices are collected
+into a preallocated array and uploaded with @ref Buffer::setData() in
+@ref draw().
+
+The capacity is fixed, lines added above it in one frame are counted in
+@ref droppedCount() and not drawn.
+@see @ref LineBatch2D, @ref LineBatch3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT LineBatch {
+    public:
+        /**
+         * @brief Global instance
+         *
+         * Expects that the instance exists.
+         * @see @ref lines()
+         */
+        static LineBatch<dimensions>& instance();
+
+        /**
+         * @brief Constructor
+         * @param capacity      Max count of lines drawn in one frame
+         * @param frameCount    Count of frames in flight
+         *
+         * Expects that no other instance of the same dimension count exists.
+         */
+        explicit LineBatch(UnsignedInt capacity = 16384, UnsignedInt frameCount = 3);
+
+        /** @brief Copying is not allowed */
+        LineBatch(const LineBatch<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        LineBatch(LineBatch<dimensions>&&) = delete;
+
+        ~LineBatch();
+
+        /** @brief Copying is not allowed */
+        LineBatch<dimensions>& operator=(const LineBatch<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        LineBatch<dimensions>& operator=(LineBatch<dimensions>&&) = delete;
+
+        /** @brief Max count of lines in one frame */
+        UnsignedInt capacity() const { return _capacity; }
+
+        /** @brief Count of lines added in current frame */
+        UnsignedInt lineCount() const { return _lineCount; }
+
+        /**
+         * @brief Count of lines dropped in current frame
+         *
+         * Lines that didn't fit into @ref capacity().
+         */
+        UnsignedInt droppedCount() const { return _droppedCount; }
+
+        /**
+         * @brief Add a line
+         * @return Reference to self (for method chaining)
+         */
+        LineBatch<dimensions>& add(const VectorTypeFor<dimensions, Float>& a, const VectorTypeFor<dimensions, Float>& b, const Color3& color) {
+            return add(a, b, color, color);
+        }
+
+        /**
+         * @brief Add a line with color gradient
+         * @return Reference to self (for method chaining)
+         */
+        LineBatch<dimensions>& add(const VectorTypeFor<dimensions, Float>& a, const VectorTypeFor<dimensions, Float>& b, const Color3& colorA, const Color3& colorB);
+
+        /**
+         * @brief Add a crosshair
+         * @return Reference to self (for method chaining)
+         *
+         * Adds one axis-aligned line with length of @p size for each
+         * dimension, centered at @p position.
+         */
+        LineBatch<dimensions>& addCross(const VectorTypeFor<dimensions, Float>& position, Float size, const Color3& color);
+
+        /**
+         * @brief Add a box
+         * @return Reference to self (for method chaining)
+         *
+         * Adds edges of a square (in 2D) or cube (in 3D) with corners at
+         * `-1` and `+1`, transformed with @p transformation.
+         */
+        LineBatch<dimensions>& addBox(const MatrixTypeFor<dimensions, Float>& transformation, const Color3& color);
+
+        /**
+         * @brief Add a circle
+         * @return Reference to self (for method chaining)
+         *
+         * Adds unit circle in XY plane with @p segments segments,
+         * transformed with @p transformation.
+         */
+        LineBatch<dimensions>& addCircle(const MatrixTypeFor<dimensions, Float>& transformation, const Color3& color, UnsignedInt segments = 32);
+
+        /**
+         * @brief Draw all lines and begin next frame
+         * @param transformationProjectionMatrix    Transformation and
+         *      projection matrix applied to all lines
+         *
+         * Issues a single draw call and resets the batch for next frame.
+         */
+        void draw(const MatrixTypeFor<dimensions, Float>& transformationProjectionMatrix);
+
+        /**
+         * @brief Draw all lines using given camera and begin next frame
+         *
+         * Equivalent to calling @ref draw(const MatrixTypeFor<dimensions, Float>&)
+         * with camera projection and camera matrix.
+         */
+        void draw(SceneGraph::AbstractCamera<dimensions, Float>& camera);
+
+    private:
+        struct Vertex {
+            VectorTypeFor<dimensions, Float> position;
+            Color3 color;
+        };
+
+        Vertex* allocateLine();
+
+        UnsignedInt _capacity, _lineCount, _droppedCount;
+        Int _firstVertex;
+
+        #ifndef MAGNUM_TARGET_GLES2
+        std::unique_ptr<BufferRing> _ring;
+        #endif
+        Buffer _buffer;
+        std::vector<Vertex> _vertices;
+
+        Mesh _mesh;
+        Resource<AbstractShaderProgram, Shaders::VertexColor<dimensions>> _shader;
+};
+
+/** @brief Two-dimensional line batch */
+typedef LineBatch<2> LineBatch2D;
+
+/** @brief Three-dimensional line batch */
+typedef LineBatch<3> LineBatch3D;
+
+/**
+@brief Global line batch instance
+
+Shorthand for @ref LineBatch::instance(), `DebugTools::lines()` returns the
+three-dimensional batch, `DebugTools::lines<2>()` the two-dimensional one.
+*/
+template<UnsignedInt dimensions = 3> inline LineBatch<dimensions>& lines() {
+    return LineBatch<dimensions>::instance();
+}
+
+}}
+
+#endif
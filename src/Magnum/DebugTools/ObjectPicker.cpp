@@ -0,0 +1,131 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ObjectPicker.h"
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/SceneGraph/AbstractCamera.h"
+
+namespace Magnum { namespace DebugTools {
+
+template<UnsignedInt dimensions> class ObjectPicker<dimensions>::Pickable: public SceneGraph::Drawable<dimensions, Float> {
+    public:
+        explicit Pickable(SceneGraph::AbstractObject<dimensions, Float>& object, ObjectPicker<dimensions>& picker, Mesh& mesh, UnsignedInt id): SceneGraph::Drawable<dimensions, Float>{object, &picker._drawables}, _picker(picker), _mesh(mesh), _id{id} {}
+
+        ~Pickable() {
+            /* Release the ID for reuse */
+            _picker._objects[_id - 1] = nullptr;
+            _picker._freeIds.push_back(_id);
+        }
+
+    private:
+        void draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::AbstractCamera<dimensions, Float>& camera) override {
+            _picker._shader.setTransformationProjectionMatrix(camera.projectionMatrix()*transformationMatrix)
+                .setObjectId(_id);
+            _mesh.draw(_picker._shader);
+        }
+
+        ObjectPicker<dimensions>& _picker;
+        Mesh& _mesh;
+        UnsignedInt _id;
+};
+
+template<UnsignedInt dimensions> ObjectPicker<dimensions>::ObjectPicker(const Vector2i& size, const UnsignedInt frameCount): _shader{Shaders::Flat<dimensions>::Flag::ObjectId}, _framebuffer{{{}, size}}, _queue{ColorFormat::RedInteger, ColorType::UnsignedInt, frameCount} {
+    _color.setStorage(RenderbufferFormat::R32UI, size);
+    _depth.setStorage(RenderbufferFormat::DepthComponent24, size);
+    _framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, _color)
+        .attachRenderbuffer(Framebuffer::BufferAttachment::Depth, _depth)
+        .mapForDraw(Framebuffer::ColorAttachment{0})
+        .mapForRead(Framebuffer::ColorAttachment{0});
+}
+
+template<UnsignedInt dimensions> ObjectPicker<dimensions>::~ObjectPicker() {
+    /* The features reference the picker, destroy them while it's still
+       alive */
+    while(!_drawables.isEmpty()) delete &_drawables[0];
+}
+
+template<UnsignedInt dimensions> void ObjectPicker<dimensions>::setSize(const Vector2i& size) {
+    _color.setStorage(RenderbufferFormat::R32UI, size);
+    _depth.setStorage(RenderbufferFormat::DepthComponent24, size);
+    _framebuffer.setViewport({{}, size});
+}
+
+template<UnsignedInt dimensions> UnsignedInt ObjectPicker<dimensions>::add(SceneGraph::AbstractObject<dimensions, Float>& object, Mesh& mesh) {
+    UnsignedInt id;
+    if(!_freeIds.empty()) {
+        id = _freeIds.back();
+        _freeIds.pop_back();
+        _objects[id - 1] = &object;
+    } else {
+        _objects.push_back(&object);
+        id = _objects.size();
+    }
+
+    new Pickable{object, *this, mesh, id};
+    return id;
+}
+
+template<UnsignedInt dimensions> SceneGraph::AbstractObject<dimensions, Float>* ObjectPicker<dimensions>::object(const UnsignedInt id) const {
+    return id && id <= _objects.size() ? _objects[id - 1] : nullptr;
+}
+
+template<UnsignedInt dimensions> bool ObjectPicker<dimensions>::pick(SceneGraph::AbstractCamera<dimensions, Float>& camera, const Vector2i& position) {
+    CORRADE_ASSERT((position >= Vector2i{}).all() && (position < _framebuffer.viewport().size()).all(),
+        "DebugTools::ObjectPicker::pick(): position" << position << "is outside of the framebuffer", false);
+    const Range2Di rectangle = Range2Di::fromSize(position, Vector2i{1});
+
+    if(_queue.pendingCount() == _queue.frameCount()) return false;
+
+    /* Clear and rasterize only the picked pixel */
+    Renderer::enable(Renderer::Feature::ScissorTest);
+    Renderer::setScissor(rectangle);
+    _framebuffer.clearColor(0, Vector4ui{})
+        .clear(FramebufferClear::Depth);
+    _framebuffer.bind(FramebufferTarget::Draw);
+    camera.draw(_drawables);
+    Renderer::disable(Renderer::Feature::ScissorTest);
+
+    return _queue.read(_framebuffer, rectangle);
+}
+
+template<UnsignedInt dimensions> bool ObjectPicker<dimensions>::tryGet(SceneGraph::AbstractObject<dimensions, Float>*& object) {
+    const ImageReference2D image = _queue.tryGet();
+    if(!image.data()) return false;
+
+    const UnsignedInt id = *image.data<UnsignedInt>();
+    _queue.release();
+
+    object = this->object(id);
+    return true;
+}
+
+template class ObjectPicker<2>;
+template class ObjectPicker<3>;
+
+}}
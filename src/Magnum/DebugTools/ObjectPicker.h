@@ -0,0 +1,212 @@
+#ifndef Magnum_DebugTools_ObjectPicker_h
+#define Magnum_DebugTools_ObjectPicker_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::DebugTools::ObjectPicker, typedef @ref Magnum::DebugTools::ObjectPicker2D, @ref Magnum::DebugTools::ObjectPicker3D
+ */
+
+#include <vector>
+
+#include "Magnum/Framebuffer.h"
+#include "Magnum/FramebufferReadbackQueue.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/Shaders/Flat.h"
+#include "Magnum/DebugTools/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief GPU object picker
+
+Renders registered objects with unique IDs with @ref Shaders::Flat::Flag::ObjectId "Shaders::Flat::Flag::ObjectId"
+into an offscreen @ref RenderbufferFormat::R32UI attachment and maps the
+pixel under cursor back to the object. Compared to raycasting against
+@ref Shapes on the CPU the cost doesn't depend on mesh complexity, as only
+a single pixel is rasterized (the rest is discarded with scissor test) and
+the result is read back asynchronously via @ref FramebufferReadbackQueue, thus
+picking doesn't stall the pipeline.
+
+## Basic usage
+
+Register objects together with meshes which should be used for picking, the
+picker creates a hidden drawable feature for each, which is destroyed together
+with the object:
+@code
+DebugTools::ObjectPicker3D picker{defaultFramebuffer.viewport().size()};
+picker.add(*object, mesh);
+@endcode
+
+On click, render the picking pass for given position and query the result a
+few frames later, once the readback is finished:
+@code
+void MyApplication::mousePressEvent(MouseEvent& event) {
+    // Framebuffer origin is in bottom left corner
+    const Vector2i position{event.position().x(),
+        defaultFramebuffer.viewport().sizeY() - event.position().y() - 1};
+    picker.pick(camera, position);
+    defaultFramebuffer.bind(FramebufferTarget::Draw);
+}
+
+void MyApplication::drawEvent() {
+    SceneGraph::AbstractObject3D* picked;
+    if(picker.tryGet(picked) && picked) {
+        // picked an object
+    }
+
+    // ...
+}
+@endcode
+
+The picking pass uses the current renderer state, so you might want to enable
+@ref Renderer::Feature::DepthTest for it. Scissor test is disabled afterwards
+and the picking framebuffer is left bound, so bind your framebuffer again
+before continuing. The object IDs are recycled after the object is destroyed,
+so a readback which was in flight during object destruction might return
+another object.
+
+@see @ref ObjectPicker2D, @ref ObjectPicker3D
+@requires_gl30 Extension @extension{EXT,gpu_shader4} and
+    @extension{ARB,framebuffer_object}
+@requires_gles30 Integer color attachments and pixel buffer objects are not
+    available in OpenGL ES 2.0.
+@requires_webgl20 Buffer mapping is not available in WebGL.
+*/
+template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT ObjectPicker {
+    public:
+        /**
+         * @brief Constructor
+         * @param size          Size of the picking framebuffer
+         * @param frameCount    Count of picking readbacks in flight
+         *
+         * The size should match size of the framebuffer you are picking
+         * from.
+         */
+        explicit ObjectPicker(const Vector2i& size, UnsignedInt frameCount = 3);
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys all picking features created in @ref add().
+         */
+        ~ObjectPicker();
+
+        /** @brief Copying is not allowed */
+        ObjectPicker(const ObjectPicker<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        ObjectPicker(ObjectPicker<dimensions>&&) = delete;
+
+        /** @brief Copying is not allowed */
+        ObjectPicker<dimensions>& operator=(const ObjectPicker<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        ObjectPicker<dimensions>& operator=(ObjectPicker<dimensions>&&) = delete;
+
+        /** @brief Picking framebuffer */
+        Framebuffer& framebuffer() { return _framebuffer; }
+
+        /**
+         * @brief Set size of the picking framebuffer
+         *
+         * Call when the window is resized.
+         */
+        void setSize(const Vector2i& size);
+
+        /**
+         * @brief Register object for picking
+         * @param object    Object
+         * @param mesh      Mesh with @ref Shaders::Flat::Position attribute
+         *      used for picking the object
+         * @return Object ID, always greater than zero
+         *
+         * The mesh is expected to be alive for the whole lifetime of the
+         * object. It can be a simplified version of the rendered mesh.
+         */
+        UnsignedInt add(SceneGraph::AbstractObject<dimensions, Float>& object, Mesh& mesh);
+
+        /**
+         * @brief Object for given ID
+         *
+         * Returns `nullptr` for `0` and for IDs of already destroyed objects.
+         */
+        SceneGraph::AbstractObject<dimensions, Float>* object(UnsignedInt id) const;
+
+        /** @brief Count of picking readbacks in flight */
+        UnsignedInt pendingCount() const { return _queue.pendingCount(); }
+
+        /**
+         * @brief Render picking pass for given position
+         * @param camera    Camera
+         * @param position  Position in framebuffer coordinates, with origin
+         *      in bottom left corner
+         *
+         * Renders all registered objects into a single pixel of the picking
+         * framebuffer and schedules its readback. Returns `false` without
+         * rendering anything if @p frameCount readbacks are already in
+         * flight.
+         * @see @ref tryGet()
+         */
+        bool pick(SceneGraph::AbstractCamera<dimensions, Float>& camera, const Vector2i& position);
+
+        /**
+         * @brief Try to get picking result
+         * @param[out] object   Picked object or `nullptr` if there was no
+         *      object at given position
+         *
+         * Returns `true` and fills @p object with result of the oldest
+         * @ref pick() if its readback is finished, otherwise returns `false`
+         * and @p object is left untouched.
+         */
+        bool tryGet(SceneGraph::AbstractObject<dimensions, Float>*& object);
+
+    private:
+        class Pickable;
+
+        Shaders::Flat<dimensions> _shader;
+        Renderbuffer _color, _depth;
+        Framebuffer _framebuffer;
+        FramebufferReadbackQueue _queue;
+        SceneGraph::DrawableGroup<dimensions, Float> _drawables;
+
+        std::vector<SceneGraph::AbstractObject<dimensions, Float>*> _objects;
+        std::vector<UnsignedInt> _freeIds;
+};
+
+/** @brief Two-dimensional object picker */
+typedef ObjectPicker<2> ObjectPicker2D;
+
+/** @brief Three-dimensional object picker */
+typedef ObjectPicker<3> ObjectPicker3D;
+
+}}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -27,6 +27,7 @@
 
 #include "Magnum/Buffer.h"
 #include "Magnum/Mesh.h"
+#include "Magnum/DebugTools/RendererBatch.h"
 #include "Magnum/DebugTools/ResourceManager.h"
 #include "Magnum/MeshTools/Interleave.h"
 #include "Magnum/SceneGraph/AbstractCamera.h"
@@ -42,6 +43,7 @@ template<> struct Renderer<2> {
     static ResourceKey shader() { return {"VertexColorShader2D"}; }
     static ResourceKey vertexBuffer() { return {"object2d-vertices"}; }
     static ResourceKey indexBuffer() { return {"object2d-indices"}; }
+    static ResourceKey instanceBuffer() { return {"object2d-instances"}; }
     static ResourceKey mesh() { return {"object2d"}; }
 
     static const std::array<Vector2, 8> positions;
@@ -87,6 +89,7 @@ template<> struct Renderer<3> {
     static ResourceKey shader() { return {"VertexColorShader3D"}; }
     static ResourceKey vertexBuffer() { return {"object3d-vertices"}; }
     static ResourceKey indexBuffer() { return {"object3d-indices"}; }
+    static ResourceKey instanceBuffer() { return {"object3d-instances"}; }
     static ResourceKey mesh() { return {"object3d"}; }
 
     static const std::array<Vector3, 12> positions;
@@ -153,6 +156,7 @@ template<UnsignedInt dimensions> ObjectRenderer<dimensions>::ObjectRenderer(Scen
     mesh = ResourceManager::instance().get<Mesh>(Renderer<dimensions>::mesh());
     vertexBuffer = ResourceManager::instance().get<Buffer>(Renderer<dimensions>::vertexBuffer());
     indexBuffer = ResourceManager::instance().get<Buffer>(Renderer<dimensions>::indexBuffer());
+    instanceBuffer = ResourceManager::instance().get<Buffer>(Renderer<dimensions>::instanceBuffer());
     if(mesh) return;
 
     /* Create the mesh */
@@ -179,7 +183,14 @@ template<UnsignedInt dimensions> ObjectRenderer<dimensions>::ObjectRenderer(Scen
 template<UnsignedInt dimensions> ObjectRenderer<dimensions>::~ObjectRenderer() = default;
 
 template<UnsignedInt dimensions> void ObjectRenderer<dimensions>::draw(const MatrixTypeFor<dimensions, Float>& transformationMatrix, SceneGraph::AbstractCamera<dimensions, Float>& camera) {
-    shader->setTransformationProjectionMatrix(camera.projectionMatrix()*transformationMatrix*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{options->size()}));
+    const MatrixTypeFor<dimensions, Float> transformationProjectionMatrix = camera.projectionMatrix()*transformationMatrix*MatrixTypeFor<dimensions, Float>::scaling(VectorTypeFor<dimensions, Float>{options->size()});
+
+    if(RendererBatch<dimensions>* const batch = RendererBatch<dimensions>::current()) {
+        batch->addVertexColorInstance(mesh, instanceBuffer, transformationProjectionMatrix);
+        return;
+    }
+
+    shader->setTransformationProjectionMatrix(transformationProjectionMatrix);
     mesh->draw(*shader);
 }
 
@@ -67,7 +67,8 @@ class ObjectRendererOptions {
 @brief Object renderer
 
 Visualizes object position, rotation and scale using colored axes. See
-@ref debug-tools-renderers for more information.
+@ref debug-tools-renderers for more information. All object renderers can be
+drawn with a single draw call using @ref RendererBatch.
 
 @anchor DebugTools-ObjectRenderer-usage
 ## Basic usage
@@ -106,7 +107,7 @@ template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT ObjectRenderer:
         Resource<ObjectRendererOptions> options;
         Resource<AbstractShaderProgram, Shaders::VertexColor<dimensions>> shader;
         Resource<Mesh> mesh;
-        Resource<Buffer> vertexBuffer, indexBuffer;
+        Resource<Buffer> vertexBuffer, indexBuffer, instanceBuffer;
 };
 
 /** @brief Two-dimensional object renderer */
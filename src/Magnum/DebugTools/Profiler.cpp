@@ -26,15 +26,197 @@
 #include "Profiler.h"
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <numeric>
+#include <ostream>
+#include <thread>
 #include <Corrade/Utility/Assert.h>
 
-#include "Magnum/Magnum.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/QueryPool.h"
+#include "Magnum/TimeQuery.h"
 
 using namespace std::chrono;
 
 namespace Magnum { namespace DebugTools {
 
+namespace {
+    /* Marker of a stopped profiler in the GPU timestamp sequence */
+    constexpr Profiler::Section StoppedSection = ~Profiler::Section{};
+
+    void writeEscaped(std::ostream& out, const std::string& string) {
+        for(const char c: string) {
+            if(c == '"' || c == '\\') out << '\\' << c;
+            else if(UnsignedByte(c) < 0x20) out << ' ';
+            else out << c;
+        }
+    }
+
+    void writeMicroseconds(std::ostream& out, const nanoseconds time) {
+        const Long ns = time.count();
+        const Long abs = ns < 0 ? -ns : ns;
+        if(ns < 0) out << '-';
+        out << abs/1000 << '.' << char('0' + abs/100%10) << char('0' + abs/10%10) << char('0' + abs%10);
+    }
+}
+
+struct Profiler::GpuTiming {
+    explicit GpuTiming(std::size_t delay): queries{TimeQuery::Target::Timestamp, UnsignedInt(delay)}, frameCount{0}, previousFrame{~UnsignedLong{}}, previousSection{StoppedSection}, previousTimestamp{0} {}
+
+    /* Timestamp of each section change, the results arrive in order once
+       available and are waited for only after the delay */
+    QueryPool<TimeQuery> queries;
+    std::size_t frameCount;
+
+    /* Last delivered timestamp and section started at it */
+    UnsignedLong previousFrame;
+    Section previousSection;
+    UnsignedLong previousTimestamp;
+
+    std::vector<nanoseconds> frameData;
+    std::vector<nanoseconds> totalData;
+};
+
+struct Profiler::Trace {
+    enum class Type: UnsignedByte { Cpu, Gpu, Frame };
+
+    struct Event {
+        Type type;
+        Section section;
+        UnsignedInt thread;
+        UnsignedLong frame;
+        nanoseconds begin, end;
+    };
+
+    explicit Trace(std::size_t capacity): events(capacity), next{0}, count{0}, frame{0}, gpuEpoch{0}, gpuEpochValid{false} {}
+
+    void add(Type type, Section section, UnsignedInt thread, UnsignedLong frame, nanoseconds begin, nanoseconds end) {
+        events[next] = {type, section, thread, frame, begin, end};
+        next = (next + 1) % events.size();
+        if(count < events.size()) ++count;
+    }
+
+    std::vector<Event> events;
+    std::size_t next, count;
+    UnsignedLong frame;
+    high_resolution_clock::time_point epoch;
+    UnsignedLong gpuEpoch;
+    bool gpuEpochValid;
+};
+
+/* Trace thread IDs. Scopes on the thread calling nextFrame() share the track
+   with sections started with start(), other threads get IDs after the GPU. */
+enum: UnsignedInt {
+    MainThread = 1,
+    GpuThread = 2,
+    FirstOtherThread = 3
+};
+
+struct Profiler::ThreadData {
+    struct Event {
+        Section section;
+        high_resolution_clock::time_point begin, end;
+        high_resolution_clock::duration self;
+    };
+
+    struct StackEntry {
+        Section section;
+        high_resolution_clock::time_point begin;
+        high_resolution_clock::duration children;
+    };
+
+    explicit ThreadData(Threads& threads, std::size_t capacity, std::thread::id thread, UnsignedInt id, bool main): threads(threads), events(capacity), thread{thread}, id{id}, main{main}, write{0}, read{0}, dropped{0} {}
+
+    Threads& threads;
+
+    /* Single-producer single-consumer ring, written only by the owning thread
+       and read only in nextFrame() */
+    std::vector<Event> events;
+    const std::thread::id thread;
+    const UnsignedInt id;
+    const bool main;
+    std::atomic<std::size_t> write, read, dropped;
+
+    /* Accessed only by the owning thread */
+    std::vector<StackEntry> stack;
+};
+
+struct Profiler::Threads {
+    explicit Threads(): id{nextId++}, capacity{4096}, otherCount{0}, recording{false}, mainScopeTime{} {}
+
+    /* Unique ID to distinguish profilers in thread-local caches, as a new
+       profiler can be allocated at the address of a deleted one */
+    static std::atomic<UnsignedLong> nextId;
+    const UnsignedLong id;
+
+    std::size_t capacity;
+    UnsignedInt otherCount;
+    std::thread::id mainThread;
+    std::atomic<bool> recording;
+
+    /* Guards only the buffer list, taken once per thread on registration and
+       in nextFrame() */
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadData>> data;
+
+    /* Time spent in top-level scopes on the main thread since last save(),
+       accessed only by the main thread */
+    high_resolution_clock::duration mainScopeTime;
+};
+
+std::atomic<UnsignedLong> Profiler::Threads::nextId{0};
+
+Profiler::Profiler(): enabled(false), debugGroups(false), measureDuration(60), currentFrame(0), frameCount(0), sections{"Other"}, currentSection(otherSection), threads{new Threads} {}
+
+Profiler::~Profiler() = default;
+
+void Profiler::enableGpuTiming(const std::size_t delay) {
+    CORRADE_ASSERT(!enabled, "Profiler: cannot enable GPU timing when profiling is enabled", );
+    CORRADE_ASSERT(delay, "Profiler: GPU timing delay must not be zero", );
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::timer_query);
+    #else
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::EXT::disjoint_timer_query);
+    #endif
+    gpu.reset(new GpuTiming{delay});
+}
+
+void Profiler::disableGpuTiming() {
+    CORRADE_ASSERT(!enabled, "Profiler: cannot disable GPU timing when profiling is enabled", );
+    gpu.reset();
+}
+
+void Profiler::enableDebugGroups() {
+    CORRADE_ASSERT(!enabled, "Profiler: cannot enable debug groups when profiling is enabled", );
+    debugGroups = true;
+}
+
+void Profiler::disableDebugGroups() {
+    CORRADE_ASSERT(!enabled, "Profiler: cannot disable debug groups when profiling is enabled", );
+    debugGroups = false;
+}
+
+void Profiler::setThreadBufferCapacity(const std::size_t events) {
+    CORRADE_ASSERT(!enabled, "Profiler: cannot set thread buffer capacity when profiling is enabled", );
+    CORRADE_ASSERT(events, "Profiler: thread buffer capacity must not be zero", );
+
+    /* Existing buffers are reallocated on next enable() */
+    threads->capacity = events;
+}
+
+void Profiler::enableTrace(const std::size_t capacity) {
+    CORRADE_ASSERT(!enabled, "Profiler: cannot enable trace when profiling is enabled", );
+    CORRADE_ASSERT(capacity, "Profiler: trace capacity must not be zero", );
+    trace.reset(new Trace{capacity});
+}
+
+void Profiler::disableTrace() {
+    CORRADE_ASSERT(!enabled, "Profiler: cannot disable trace when profiling is enabled", );
+    trace.reset();
+}
+
 Profiler::Section Profiler::addSection(const std::string& name) {
     CORRADE_ASSERT(!enabled, "Profiler: cannot add section when profiling is enabled", 0);
     sections.push_back(name);
@@ -48,13 +230,66 @@ void Profiler::setMeasureDuration(std::size_t frames) {
 
 void Profiler::enable() {
     enabled = true;
+
+    /* Discard everything recorded by other threads so far */
+    {
+        std::lock_guard<std::mutex> lock{threads->mutex};
+        threads->mainThread = std::this_thread::get_id();
+        threads->mainScopeTime = high_resolution_clock::duration::zero();
+        for(std::unique_ptr<ThreadData>& data: threads->data) {
+            if(data->events.size() != threads->capacity)
+                data->events = std::vector<ThreadData::Event>(threads->capacity);
+            data->read.store(data->write.load(std::memory_order_acquire), std::memory_order_release);
+            data->dropped.store(0, std::memory_order_relaxed);
+        }
+    }
+    threads->recording.store(true, std::memory_order_release);
     frameData.assign(measureDuration*sections.size(), high_resolution_clock::duration::zero());
     totalData.assign(sections.size(), high_resolution_clock::duration::zero());
     frameCount = 0;
+
+    #ifdef MAGNUM_BUILD_ALLOCATION_TRACKING
+    for(std::size_t i = 0; i != AllocationTracker::SubsystemCount; ++i) {
+        allocationPrevious[i] = AllocationTracker::count(AllocationTracker::Subsystem(i));
+        allocationTotal[i] = 0;
+    }
+    allocationFrameData.assign(measureDuration*AllocationTracker::SubsystemCount, 0);
+    #endif
+
+    if(gpu) {
+        gpu->frameData.assign(measureDuration*sections.size(), nanoseconds::zero());
+        gpu->totalData.assign(sections.size(), nanoseconds::zero());
+        gpu->frameCount = 0;
+        gpu->previousFrame = ~UnsignedLong{};
+        gpu->queries.discardPending();
+    }
+
+    if(trace) {
+        trace->next = trace->count = 0;
+        trace->frame = 0;
+        trace->epoch = high_resolution_clock::now();
+
+        /* Align GPU time with the CPU epoch */
+        trace->gpuEpochValid = false;
+        #ifndef MAGNUM_TARGET_GLES2
+        if(gpu) {
+            GLint64 timestamp;
+            #ifndef MAGNUM_TARGET_GLES
+            glGetInteger64v(GL_TIMESTAMP, &timestamp);
+            #else
+            glGetInteger64v(GL_TIMESTAMP_EXT, &timestamp);
+            #endif
+            trace->gpuEpoch = timestamp;
+            trace->gpuEpochValid = true;
+        }
+        #endif
+    }
 }
 
 void Profiler::disable() {
     enabled = false;
+    if(debugGroup.isActive()) debugGroup.pop();
+    threads->recording.store(false, std::memory_order_release);
 }
 
 void Profiler::start(Section section) {
@@ -64,6 +299,11 @@ void Profiler::start(Section section) {
     save();
 
     currentSection = section;
+    if(gpu) gpuMarker(section);
+    if(debugGroups) {
+        if(debugGroup.isActive()) debugGroup.pop();
+        debugGroup.push(DebugGroup::Source::Application, section, sections[section]);
+    }
 }
 
 void Profiler::stop() {
@@ -72,25 +312,179 @@ void Profiler::stop() {
     save();
 
     previousTime = high_resolution_clock::time_point();
+    if(gpu) gpuMarker(StoppedSection);
+    if(debugGroup.isActive()) debugGroup.pop();
+}
+
+auto Profiler::threadData() -> ThreadData& {
+    /* Cache the buffer for the last used profiler so the lookup is done only
+       once per thread. Needs thread-local storage, otherwise the lookup is
+       done every time. */
+    #ifdef MAGNUM_BUILD_MULTITHREADED
+    thread_local UnsignedLong cachedId = ~UnsignedLong{};
+    thread_local ThreadData* cachedData = nullptr;
+    if(cachedId == threads->id) return *cachedData;
+    #endif
+
+    std::lock_guard<std::mutex> lock{threads->mutex};
+    const std::thread::id thread = std::this_thread::get_id();
+
+    /* The thread might have been registered already and then switched to
+       another profiler */
+    ThreadData* found = nullptr;
+    for(std::unique_ptr<ThreadData>& data: threads->data) if(data->thread == thread) {
+        found = data.get();
+        break;
+    }
+
+    if(!found) {
+        const bool main = thread == threads->mainThread;
+        threads->data.emplace_back(new ThreadData{*threads, threads->capacity, thread, main ? UnsignedInt(MainThread) : FirstOtherThread + threads->otherCount++, main});
+        found = threads->data.back().get();
+    }
+
+    #ifdef MAGNUM_BUILD_MULTITHREADED
+    cachedId = threads->id;
+    cachedData = found;
+    #endif
+    return *found;
+}
+
+void Profiler::threadsCollect() {
+    std::lock_guard<std::mutex> lock{threads->mutex};
+    for(std::unique_ptr<ThreadData>& data: threads->data) {
+        const std::size_t read = data->read.load(std::memory_order_relaxed);
+        const std::size_t write = data->write.load(std::memory_order_acquire);
+        for(std::size_t i = read; i != write; ++i) {
+            const ThreadData::Event& event = data->events[i % data->events.size()];
+            frameData[currentFrame*sections.size() + event.section] += event.self;
+            if(trace) trace->add(Trace::Type::Cpu, event.section, data->id, trace->frame, event.begin - trace->epoch, event.end - trace->epoch);
+        }
+
+        /* Release the slots back to the producer */
+        data->read.store(write, std::memory_order_release);
+
+        if(const std::size_t dropped = data->dropped.exchange(0, std::memory_order_relaxed))
+            Warning() << "Profiler: dropped" << dropped << "events on thread" << data->id << "- increase the thread buffer capacity";
+    }
+}
+
+Profiler::Scope::Scope(Profiler& profiler, const Section section): _data{} {
+    if(!profiler.threads->recording.load(std::memory_order_acquire)) return;
+    CORRADE_ASSERT(section < profiler.sections.size(), "Profiler::Scope: unknown section", );
+
+    _data = &profiler.threadData();
+    if(profiler.debugGroups && _data->main)
+        _debugGroup.push(DebugGroup::Source::Application, section, profiler.sections[section]);
+    _data->stack.push_back({section, high_resolution_clock::now(), high_resolution_clock::duration::zero()});
+}
+
+Profiler::Scope::~Scope() {
+    if(!_data) return;
+
+    const auto now = high_resolution_clock::now();
+    const ThreadData::StackEntry entry = _data->stack.back();
+    _data->stack.pop_back();
+
+    /* Propagate the duration to the parent so its self time excludes it */
+    const high_resolution_clock::duration duration = now - entry.begin;
+    if(!_data->stack.empty()) _data->stack.back().children += duration;
+    else if(_data->main) _data->threads.mainScopeTime += duration;
+
+    /* Drop the event if the ring is full */
+    const std::size_t write = _data->write.load(std::memory_order_relaxed);
+    if(write - _data->read.load(std::memory_order_acquire) == _data->events.size()) {
+        _data->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    _data->events[write % _data->events.size()] = {entry.section, entry.begin, now, duration - entry.children};
+    _data->write.store(write + 1, std::memory_order_release);
+}
+
+void Profiler::gpuMarker(const Section section) {
+    gpu->queries.acquire([this, section](UnsignedLong frame, UnsignedLong timestamp) {
+        gpuResult(frame, section, timestamp);
+    }).timestamp();
+}
+
+void Profiler::gpuResult(const UnsignedLong frame, const Section section, const UnsignedLong timestamp) {
+    /* Each frame starts with a new marker, so only consecutive markers from
+       the same frame delimit a section */
+    if(frame == gpu->previousFrame && gpu->previousSection != StoppedSection) {
+        const UnsignedLong previous = gpu->previousTimestamp;
+        gpu->frameData[currentFrame*sections.size() + gpu->previousSection] += nanoseconds(timestamp - previous);
+
+        /* The pool frame counter is advanced in gpuCollect() right before
+           the trace frame counter, map the result frame to the trace */
+        if(trace) {
+            if(!trace->gpuEpochValid) {
+                trace->gpuEpoch = previous;
+                trace->gpuEpochValid = true;
+            }
+            const UnsignedLong age = gpu->queries.frame() - frame;
+            trace->add(Trace::Type::Gpu, gpu->previousSection, GpuThread, trace->frame + 1 - std::min<UnsignedLong>(trace->frame + 1, age), nanoseconds(Long(previous - trace->gpuEpoch)), nanoseconds(Long(timestamp - trace->gpuEpoch)));
+        }
+    }
+
+    if(frame != gpu->previousFrame && gpu->frameCount < measureDuration) ++gpu->frameCount;
+
+    gpu->previousFrame = frame;
+    gpu->previousSection = section;
+    gpu->previousTimestamp = timestamp;
+}
+
+void Profiler::gpuCollect() {
+    /* Close the current frame. If a section is running, it continues in the
+       next one. */
+    const bool running = previousTime != high_resolution_clock::time_point();
+    if(running) gpuMarker(StoppedSection);
+
+    /* Deliver timestamps that are already available. The data are added to
+       current frame, so they are delayed, but not stalling. */
+    gpu->queries.nextFrame();
+
+    if(running) gpuMarker(currentSection);
 }
 
 void Profiler::save() {
     auto now = high_resolution_clock::now();
 
     /* If the profiler is already running, add time to given section */
-    if(previousTime != high_resolution_clock::time_point())
-        frameData[currentFrame*sections.size()+currentSection] += now-previousTime;
+    if(previousTime != high_resolution_clock::time_point()) {
+        /* Time spent in scopes is counted in their own sections */
+        frameData[currentFrame*sections.size()+currentSection] += now - previousTime - std::min(now - previousTime, threads->mainScopeTime);
+
+        if(trace) trace->add(Trace::Type::Cpu, currentSection, MainThread, trace->frame, previousTime - trace->epoch, now - trace->epoch);
+    }
+
+    threads->mainScopeTime = high_resolution_clock::duration::zero();
 
     /* Set current time as previous for next section */
     previousTime = now;
 }
 
 void Profiler::nextFrame() {
+    MAGNUM_ALLOCATION_SCOPE(DebugTools);
+
     if(!enabled) return;
 
     /* Next frame index */
     std::size_t nextFrame = (currentFrame+1) % measureDuration;
 
+    /* Merge scopes recorded by all threads */
+    threadsCollect();
+
+    /* Read back available GPU times from previous frames */
+    if(gpu) gpuCollect();
+
+    /* Mark the frame boundary */
+    if(trace) {
+        const nanoseconds now = high_resolution_clock::now() - trace->epoch;
+        trace->add(Trace::Type::Frame, 0, MainThread, trace->frame, now, now);
+        ++trace->frame;
+    }
+
     /* Add times of current frame to total */
     for(std::size_t i = 0; i != sections.size(); ++i)
         totalData[i] += frameData[currentFrame*sections.size()+i];
@@ -101,12 +495,41 @@ void Profiler::nextFrame() {
         frameData[nextFrame*sections.size()+i] = high_resolution_clock::duration::zero();
     }
 
+    /* The same for GPU times */
+    if(gpu) for(std::size_t i = 0; i != sections.size(); ++i) {
+        gpu->totalData[i] += gpu->frameData[currentFrame*sections.size()+i];
+        gpu->totalData[i] -= gpu->frameData[nextFrame*sections.size()+i];
+        gpu->frameData[nextFrame*sections.size()+i] = nanoseconds::zero();
+    }
+
+    /* Allocations done since the previous frame */
+    #ifdef MAGNUM_BUILD_ALLOCATION_TRACKING
+    for(std::size_t i = 0; i != AllocationTracker::SubsystemCount; ++i) {
+        const UnsignedLong count = AllocationTracker::count(AllocationTracker::Subsystem(i));
+        allocationFrameData[currentFrame*AllocationTracker::SubsystemCount+i] = count - allocationPrevious[i];
+        allocationTotal[i] += count - allocationPrevious[i];
+        allocationTotal[i] -= allocationFrameData[nextFrame*AllocationTracker::SubsystemCount+i];
+        allocationFrameData[nextFrame*AllocationTracker::SubsystemCount+i] = 0;
+        allocationPrevious[i] = count;
+    }
+    #endif
+
     /* Advance to next frame */
     currentFrame = nextFrame;
 
     if(frameCount < measureDuration) ++frameCount;
 }
 
+Double Profiler::allocationsPerFrame(const AllocationTracker::Subsystem subsystem) const {
+    #ifdef MAGNUM_BUILD_ALLOCATION_TRACKING
+    if(!enabled || !frameCount) return 0.0;
+    return Double(allocationTotal[UnsignedInt(subsystem)])/frameCount;
+    #else
+    static_cast<void>(subsystem);
+    return 0.0;
+    #endif
+}
+
 void Profiler::printStatistics() {
     if(!enabled) return;
 
@@ -116,8 +539,48 @@ void Profiler::printStatistics() {
     std::sort(totalSorted.begin(), totalSorted.end(), [this](std::size_t i, std::size_t j){return totalData[i] > totalData[j];});
 
     Debug() << "Statistics for last" << measureDuration << "frames:";
-    for(std::size_t i = 0; i != sections.size(); ++i)
-        Debug() << " " << sections[totalSorted[i]] << duration_cast<microseconds>(totalData[totalSorted[i]]).count()/frameCount << u8"µs";
+    for(std::size_t i = 0; i != sections.size(); ++i) {
+        Debug d;
+        d << " " << sections[totalSorted[i]] << duration_cast<microseconds>(totalData[totalSorted[i]]).count()/frameCount << u8"µs";
+        if(gpu) d << "CPU," << (gpu->frameCount ? duration_cast<microseconds>(gpu->totalData[totalSorted[i]]).count()/gpu->frameCount : 0) << u8"µs GPU";
+    }
+
+    #ifdef MAGNUM_BUILD_ALLOCATION_TRACKING
+    Debug() << "Heap allocations per frame:";
+    for(std::size_t i = 0; i != AllocationTracker::SubsystemCount; ++i) {
+        const AllocationTracker::Subsystem subsystem = AllocationTracker::Subsystem(i);
+        const Double count = allocationsPerFrame(subsystem);
+        if(count > 0.0) Debug() << " " << AllocationTracker::name(subsystem) << count;
+    }
+    #endif
+}
+
+void Profiler::writeChromeTrace(std::ostream& out) const {
+    CORRADE_ASSERT(trace, "Profiler::writeChromeTrace(): trace is not enabled", );
+
+    out << "{\"traceEvents\":[\n"
+        << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n"
+        << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}";
+    for(UnsignedInt i = 0; i != threads->otherCount; ++i)
+        out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << FirstOtherThread + i << ",\"args\":{\"name\":\"Thread " << i + 1 << "\"}}";
+
+    /* Oldest event first */
+    const std::size_t first = trace->count == trace->events.size() ? trace->next : 0;
+    for(std::size_t i = 0; i != trace->count; ++i) {
+        const Trace::Event& event = trace->events[(first + i) % trace->events.size()];
+        out << ",\n{\"name\":\"";
+        if(event.type == Trace::Type::Frame) out << "Frame " << event.frame;
+        else writeEscaped(out, sections[event.section]);
+        out << "\",\"ph\":\"" << (event.type == Trace::Type::Frame ? "i\",\"s\":\"g" : "X") << "\",\"pid\":1,\"tid\":" << event.thread << ",\"ts\":";
+        writeMicroseconds(out, event.begin);
+        if(event.type != Trace::Type::Frame) {
+            out << ",\"dur\":";
+            writeMicroseconds(out, event.end - event.begin);
+        }
+        out << ",\"args\":{\"frame\":" << event.frame << "}}";
+    }
+
+    out << "\n]}\n";
 }
 
 }}
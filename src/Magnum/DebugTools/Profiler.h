@@ -31,9 +31,13 @@
 
 #include <chrono>
 #include <initializer_list>
+#include <iosfwd>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "Magnum/AllocationTracker.h"
+#include "Magnum/DebugOutput.h"
 #include "Magnum/Types.h"
 #include "Magnum/DebugTools/visibility.h"
 
@@ -96,7 +100,85 @@ p.printStatistics();
 It's possible to start profiler only for certain parts of the code and then
 stop it again using @ref stop(), if you are not interested in profiling the rest.
 
-@todo Some unit testing
+## GPU time measurement
+
+The CPU time doesn't say much about where the GPU spends its time, as most
+OpenGL commands are executed asynchronously. Calling @ref enableGpuTiming()
+before @ref enable() additionally marks each section change with a
+@ref TimeQuery timestamp. The queries are recycled by a @ref QueryPool and
+read back only once the GPU has processed them, so the measurement doesn't
+stall the pipeline. @ref printStatistics() then shows
+both CPU and GPU time for each section.
+
+## Frame traces
+
+Averages hide individual frame spikes. Calling @ref enableTrace() before
+@ref enable() records begin and end of every section (and of every GPU
+section, if GPU time measurement is enabled) into a preallocated ring buffer.
+The recorded events can then be written using @ref writeChromeTrace() in the
+Chrome `trace_event` JSON format, which can be opened in `chrome://tracing`
+or imported into Tracy or other tools:
+@code
+p.enableTrace();
+p.enable();
+
+// ...
+
+std::ofstream out{"trace.json"};
+p.writeChromeTrace(out);
+@endcode
+
+## Debug groups
+
+Calling @ref enableDebugGroups() additionally wraps each section in a
+@ref DebugGroup named after the section, so the sections are visible in GPU
+debuggers such as RenderDoc or Nsight. @ref Scope "Scopes" on the thread that
+called @ref enable() push nested groups, scopes on other threads are not
+affected. When debug groups are disabled, no GL calls are made.
+
+## Allocation counts
+
+If Magnum is built with `BUILD_ALLOCATION_TRACKING`, the profiler also
+samples the @ref AllocationTracker counters in each @ref nextFrame() and
+@ref printStatistics() shows average count of heap allocations per frame for
+each engine subsystem, which is useful for eliminating allocations in steady
+state. The counts include allocations from all threads. Use
+@ref allocationsPerFrame() to query the values directly.
+
+@anchor DebugTools-Profiler-nested-sections
+## Nested and multi-threaded sections
+
+Sections started with @ref start() are exclusive and can be used only from
+the thread that calls @ref nextFrame(). For nesting and for profiling other
+threads, use @ref Scope, which measures given section for its lifetime:
+@code
+void Loader::loadTexture(const std::string& filename) {
+    DebugTools::Profiler::Scope scope{profiler, sections.textureLoading};
+
+    {
+        DebugTools::Profiler::Scope decode{profiler, sections.decoding};
+        // ...
+    }
+
+    // ...
+}
+@endcode
+
+Each thread has its own section stack and its own preallocated event buffer,
+so the recording doesn't involve any locking. Only the first scope recorded in
+each thread locks a mutex to register the buffer. Remembering the buffer needs
+thread-local storage, so if Magnum is built without `BUILD_MULTITHREADED`,
+each scope locks the mutex to look the buffer up. The buffers are merged into
+the statistics (and the trace, if enabled) in @ref nextFrame(). The statistics
+count *self* time of nested scopes, i.e. without the time spent in child
+scopes, and time spent in top-level scopes on the thread which calls
+@ref nextFrame() is subtracted from the section started with @ref start(). If
+a buffer gets full before the next frame, further events from given thread are
+dropped, see @ref setThreadBufferCapacity().
+
+The @ref enable(), @ref disable() and other setup functions are still meant
+to be called only while no other thread records any scopes.
+
 @todo More time intervals
 */
 class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
@@ -115,7 +197,11 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
          */
         static const Section otherSection = 0;
 
-        explicit Profiler(): enabled(false), measureDuration(60), currentFrame(0), frameCount(0), sections{"Other"}, currentSection(otherSection) {}
+        class Scope;
+
+        explicit Profiler();
+
+        ~Profiler();
 
         /**
          * @brief Set measure duration
@@ -126,6 +212,102 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
          */
         void setMeasureDuration(std::size_t frames);
 
+        /**
+         * @brief Enable GPU time measurement
+         * @param delay     Count of frames in flight after which the GPU
+         *      results are waited for
+         *
+         * Results are read back as soon as they're available. If they are
+         * not available after @p delay frames, reading them blocks. The
+         * default of 3 frames should be enough for most drivers.
+         * @attention This function cannot be called if profiling is enabled.
+         * @see @ref disableGpuTiming(), @ref QueryPool,
+         *      @fn_gl{QueryCounter} with @def_gl{TIMESTAMP}
+         * @requires_gl33 Extension @extension{ARB,timer_query}
+         * @requires_es_extension Extension @es_extension{EXT,disjoint_timer_query}
+         */
+        void enableGpuTiming(std::size_t delay = 3);
+
+        /**
+         * @brief Disable GPU time measurement
+         *
+         * @attention This function cannot be called if profiling is enabled.
+         * @see @ref enableGpuTiming()
+         */
+        void disableGpuTiming();
+
+        /** @brief Whether GPU time measurement is enabled */
+        bool isGpuTimingEnabled() const { return !!gpu; }
+
+        /**
+         * @brief Enable frame trace recording
+         * @param capacity  Event count kept in the ring buffer
+         *
+         * Every finished section and every frame boundary is recorded as one
+         * event, when the buffer is full, oldest events are overwritten. No
+         * allocations are done while profiling.
+         * @attention This function cannot be called if profiling is enabled.
+         * @see @ref disableTrace(), @ref writeChromeTrace()
+         */
+        void enableTrace(std::size_t capacity = 65536);
+
+        /**
+         * @brief Disable frame trace recording
+         *
+         * Discards all recorded events.
+         * @attention This function cannot be called if profiling is enabled.
+         * @see @ref enableTrace()
+         */
+        void disableTrace();
+
+        /** @brief Whether frame trace recording is enabled */
+        bool isTraceEnabled() const { return !!trace; }
+
+        /**
+         * @brief Enable debug groups
+         *
+         * Each section started with @ref start() and each @ref Scope on the
+         * thread that called @ref enable() is wrapped in a @ref DebugGroup
+         * with the section name as message and section ID as ID. With debug
+         * groups enabled, scopes should not span calls to @ref start() or
+         * @ref stop(), otherwise the groups get mismatched.
+         * @attention This function cannot be called if profiling is enabled.
+         * @see @ref disableDebugGroups()
+         */
+        void enableDebugGroups();
+
+        /**
+         * @brief Disable debug groups
+         *
+         * @attention This function cannot be called if profiling is enabled.
+         * @see @ref enableDebugGroups()
+         */
+        void disableDebugGroups();
+
+        /** @brief Whether debug groups are enabled */
+        bool isDebugGroupsEnabled() const { return debugGroups; }
+
+        /**
+         * @brief Write recorded trace
+         *
+         * Writes the recorded events as Chrome `trace_event` JSON, CPU
+         * sections on one thread track and GPU sections on another. Times are
+         * relative to the call to @ref enable(). On OpenGL ES 2.0 the GPU
+         * track is aligned to the first GPU event instead, as the GPU
+         * timestamp can't be queried directly. Expects that trace recording
+         * is enabled.
+         */
+        void writeChromeTrace(std::ostream& out) const;
+
+        /**
+         * @brief Set per-thread event buffer capacity
+         *
+         * Count of @ref Scope events each thread can record between two
+         * calls to @ref nextFrame(). Default is 4096.
+         * @attention This function cannot be called if profiling is enabled.
+         */
+        void setThreadBufferCapacity(std::size_t events);
+
         /**
          * @brief Add named section
          *
@@ -190,24 +372,98 @@ class MAGNUM_DEBUGTOOLS_EXPORT Profiler {
          */
         void nextFrame();
 
+        /**
+         * @brief Average heap allocation count per frame
+         *
+         * Averaged through the same frame count as the section durations.
+         * Always `0` if Magnum is not built with `BUILD_ALLOCATION_TRACKING`
+         * or if profiling is disabled.
+         * @see @ref AllocationTracker::isAvailable()
+         */
+        Double allocationsPerFrame(AllocationTracker::Subsystem subsystem) const;
+
         /**
          * @brief Print statistics
          *
-         * Prints statistics about previous frame ordered by duration.
+         * Prints statistics about previous frame ordered by CPU duration. If
+         * GPU time measurement is enabled, GPU duration is printed next to
+         * each section. If allocation tracking is available, average count
+         * of heap allocations per frame is printed for each subsystem that
+         * allocated.
          * @note Does nothing if profiling is disabled.
          */
         void printStatistics();
 
     private:
+        struct GpuTiming;
+        struct Trace;
+        struct ThreadData;
+        struct Threads;
+
         void save();
+        void gpuMarker(Section section);
+        void gpuResult(UnsignedLong frame, Section section, UnsignedLong timestamp);
+        void gpuCollect();
+        void threadsCollect();
+        ThreadData& threadData();
 
-        bool enabled;
+        bool enabled, debugGroups;
         std::size_t measureDuration, currentFrame, frameCount;
         std::vector<std::string> sections;
         std::vector<std::chrono::high_resolution_clock::duration> frameData;
         std::vector<std::chrono::high_resolution_clock::duration> totalData;
         std::chrono::high_resolution_clock::time_point previousTime;
         Section currentSection;
+        DebugGroup debugGroup;
+        std::unique_ptr<GpuTiming> gpu;
+        std::unique_ptr<Trace> trace;
+        std::unique_ptr<Threads> threads;
+        #ifdef MAGNUM_BUILD_ALLOCATION_TRACKING
+        UnsignedLong allocationPrevious[AllocationTracker::SubsystemCount];
+        UnsignedLong allocationTotal[AllocationTracker::SubsystemCount];
+        std::vector<UnsignedLong> allocationFrameData;
+        #endif
+};
+
+/**
+@brief Scoped profiler section
+
+Measures given section from construction to destruction. Can be nested and
+used from any thread, see @ref DebugTools-Profiler-nested-sections "Profiler class
+documentation" for details. Does nothing if the profiler was disabled at the
+time of construction.
+*/
+class MAGNUM_DEBUGTOOLS_EXPORT Profiler::Scope {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Starts measuring @p section on current thread.
+         */
+        explicit Scope(Profiler& profiler, Section section);
+
+        /** @brief Copying is not allowed */
+        Scope(const Scope&) = delete;
+
+        /** @brief Moving is not allowed */
+        Scope(Scope&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Records the section into current thread buffer.
+         */
+        ~Scope();
+
+        /** @brief Copying is not allowed */
+        Scope& operator=(const Scope&) = delete;
+
+        /** @brief Moving is not allowed */
+        Scope& operator=(Scope&&) = delete;
+
+    private:
+        ThreadData* _data;
+        DebugGroup _debugGroup;
 };
 
 }}
@@ -0,0 +1,248 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RendererBatch.h"
+
+#include <vector>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Buffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshView.h"
+#include "Magnum/DebugTools/ResourceManager.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Shaders/Flat.h"
+#include "Magnum/Shaders/VertexColor.h"
+#endif
+
+namespace Magnum { namespace DebugTools {
+
+namespace {
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>*& currentBatch() {
+    static RendererBatch<dimensions>* current = nullptr;
+    return current;
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+template<UnsignedInt dimensions> ResourceKey flatShaderKey();
+template<> inline ResourceKey flatShaderKey<2>() { return ResourceKey("FlatShader2DInstanced"); }
+template<> inline ResourceKey flatShaderKey<3>() { return ResourceKey("FlatShader3DInstanced"); }
+
+template<UnsignedInt dimensions> ResourceKey vertexColorShaderKey();
+template<> inline ResourceKey vertexColorShaderKey<2>() { return ResourceKey("VertexColorShader2DInstanced"); }
+template<> inline ResourceKey vertexColorShaderKey<3>() { return ResourceKey("VertexColorShader3DInstanced"); }
+#endif
+
+}
+
+template<UnsignedInt dimensions> struct RendererBatch<dimensions>::State {
+    #ifndef MAGNUM_TARGET_GLES2
+    /* Layout matches Flat::TransformationMatrix followed by Flat::Color */
+    struct FlatInstance {
+        MatrixTypeFor<dimensions, Float> transformationProjectionMatrix;
+        Color4 color;
+    };
+
+    struct FlatDraw {
+        Mesh* mesh;
+        MeshView* view;
+        Buffer* instanceBuffer;
+        std::vector<FlatInstance> instances;
+    };
+
+    struct VertexColorDraw {
+        Mesh* mesh;
+        Buffer* instanceBuffer;
+        std::vector<MatrixTypeFor<dimensions, Float>> instances;
+    };
+
+    Resource<AbstractShaderProgram, Shaders::Flat<dimensions>> flatShader;
+    Resource<AbstractShaderProgram, Shaders::VertexColor<dimensions>> vertexColorShader;
+
+    std::vector<FlatDraw> flatDraws;
+    std::vector<VertexColorDraw> vertexColorDraws;
+    #endif
+};
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>* RendererBatch<dimensions>::current() {
+    return currentBatch<dimensions>();
+}
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>::RendererBatch(): _state{new State}, _supported{false} {
+    #ifndef MAGNUM_TARGET_GLES2
+    #ifndef MAGNUM_TARGET_GLES
+    _supported = Context::current()->isExtensionSupported<Extensions::GL::ARB::instanced_arrays>() &&
+        Context::current()->isExtensionSupported<Extensions::GL::ARB::draw_instanced>();
+    #else
+    _supported = true;
+    #endif
+    if(!_supported) return;
+
+    _state->flatShader = ResourceManager::instance().get<AbstractShaderProgram, Shaders::Flat<dimensions>>(flatShaderKey<dimensions>());
+    if(!_state->flatShader) ResourceManager::instance().set<AbstractShaderProgram>(_state->flatShader.key(),
+        new Shaders::Flat<dimensions>{Shaders::Flat<dimensions>::Flag::InstancedTransformation|Shaders::Flat<dimensions>::Flag::InstancedColor},
+        ResourceDataState::Final, ResourcePolicy::Resident);
+
+    _state->vertexColorShader = ResourceManager::instance().get<AbstractShaderProgram, Shaders::VertexColor<dimensions>>(vertexColorShaderKey<dimensions>());
+    if(!_state->vertexColorShader) ResourceManager::instance().set<AbstractShaderProgram>(_state->vertexColorShader.key(),
+        new Shaders::VertexColor<dimensions>{Shaders::VertexColor<dimensions>::Flag::InstancedTransformation},
+        ResourceDataState::Final, ResourcePolicy::Resident);
+    #endif
+}
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>::~RendererBatch() {
+    if(currentBatch<dimensions>() == this) currentBatch<dimensions>() = nullptr;
+}
+
+template<UnsignedInt dimensions> RendererBatch<dimensions>& RendererBatch<dimensions>::begin() {
+    if(!_supported) return *this;
+
+    CORRADE_ASSERT(!currentBatch<dimensions>(),
+        "DebugTools::RendererBatch::begin(): another batch is already active", *this);
+
+    currentBatch<dimensions>() = this;
+    return *this;
+}
+
+template<UnsignedInt dimensions> UnsignedInt RendererBatch<dimensions>::end() {
+    if(!_supported) return 0;
+
+    CORRADE_ASSERT(currentBatch<dimensions>() == this,
+        "DebugTools::RendererBatch::end(): the batch is not active", 0);
+
+    currentBatch<dimensions>() = nullptr;
+
+    UnsignedInt drawCount = 0;
+
+    #ifndef MAGNUM_TARGET_GLES2
+    /* The per-instance matrices already contain the projection */
+    if(!_state->flatDraws.empty()) {
+        _state->flatShader->setTransformationProjectionMatrix({})
+            .setColor(Color4{1.0f});
+
+        for(auto& draw: _state->flatDraws) {
+            /* Views of the same mesh share the instance buffer, the data are
+               reuploaded for each of them */
+            const Int instanceCount = draw.instances.size();
+            draw.instanceBuffer->setData(draw.instances, BufferUsage::StreamDraw);
+            if(draw.view) {
+                draw.view->setInstanceCount(instanceCount)
+                    .draw(*_state->flatShader);
+                draw.view->setInstanceCount(1);
+            } else {
+                draw.mesh->setInstanceCount(instanceCount)
+                    .draw(*_state->flatShader);
+                draw.mesh->setInstanceCount(1);
+            }
+            ++drawCount;
+        }
+    }
+
+    if(!_state->vertexColorDraws.empty()) {
+        _state->vertexColorShader->setTransformationProjectionMatrix({});
+
+        for(auto& draw: _state->vertexColorDraws) {
+            draw.instanceBuffer->setData(draw.instances, BufferUsage::StreamDraw);
+            draw.mesh->setInstanceCount(draw.instances.size())
+                .draw(*_state->vertexColorShader);
+            draw.mesh->setInstanceCount(1);
+            ++drawCount;
+        }
+    }
+
+    _state->flatDraws.clear();
+    _state->vertexColorDraws.clear();
+    #endif
+
+    return drawCount;
+}
+
+template<UnsignedInt dimensions> void RendererBatch<dimensions>::addFlatInstance(Resource<Mesh>& mesh, MeshView* const view, Resource<Buffer>& instanceBuffer, const MatrixTypeFor<dimensions, Float>& transformationProjectionMatrix, const Color4& color) {
+    #ifndef MAGNUM_TARGET_GLES2
+    /* Create the instance buffer and attach it to the mesh, if not already */
+    if(!instanceBuffer) {
+        Buffer* buffer = new Buffer{Buffer::TargetHint::Array};
+        ResourceManager::instance().set(instanceBuffer.key(), buffer, ResourceDataState::Final, ResourcePolicy::Manual);
+        mesh->addVertexBufferInstanced(*buffer, 1, 0,
+            typename Shaders::Flat<dimensions>::TransformationMatrix{},
+            typename Shaders::Flat<dimensions>::Color{});
+    }
+
+    /* There is only a handful of distinct meshes, linear search is enough */
+    Mesh* const meshPointer = mesh;
+    auto found = _state->flatDraws.begin();
+    for(; found != _state->flatDraws.end(); ++found)
+        if(found->mesh == meshPointer && found->view == view) break;
+    if(found == _state->flatDraws.end()) {
+        _state->flatDraws.push_back({meshPointer, view, instanceBuffer, {}});
+        found = _state->flatDraws.end() - 1;
+    }
+
+    found->instances.push_back({transformationProjectionMatrix, color});
+    #else
+    static_cast<void>(mesh);
+    static_cast<void>(view);
+    static_cast<void>(instanceBuffer);
+    static_cast<void>(transformationProjectionMatrix);
+    static_cast<void>(color);
+    CORRADE_ASSERT_UNREACHABLE();
+    #endif
+}
+
+template<UnsignedInt dimensions> void RendererBatch<dimensions>::addVertexColorInstance(Resource<Mesh>& mesh, Resource<Buffer>& instanceBuffer, const MatrixTypeFor<dimensions, Float>& transformationProjectionMatrix) {
+    #ifndef MAGNUM_TARGET_GLES2
+    if(!instanceBuffer) {
+        Buffer* buffer = new Buffer{Buffer::TargetHint::Array};
+        ResourceManager::instance().set(instanceBuffer.key(), buffer, ResourceDataState::Final, ResourcePolicy::Manual);
+        mesh->addVertexBufferInstanced(*buffer, 1, 0,
+            typename Shaders::VertexColor<dimensions>::TransformationMatrix{});
+    }
+
+    Mesh* const meshPointer = mesh;
+    auto found = _state->vertexColorDraws.begin();
+    for(; found != _state->vertexColorDraws.end(); ++found)
+        if(found->mesh == meshPointer) break;
+    if(found == _state->vertexColorDraws.end()) {
+        _state->vertexColorDraws.push_back({meshPointer, instanceBuffer, {}});
+        found = _state->vertexColorDraws.end() - 1;
+    }
+
+    found->instances.push_back(transformationProjectionMatrix);
+    #else
+    static_cast<void>(mesh);
+    static_cast<void>(instanceBuffer);
+    static_cast<void>(transformationProjectionMatrix);
+    CORRADE_ASSERT_UNREACHABLE();
+    #endif
+}
+
+template class RendererBatch<2>;
+template class RendererBatch<3>;
+
+}}
@@ -0,0 +1,159 @@
+#ifndef Magnum_DebugTools_RendererBatch_h
+#define Magnum_DebugTools_RendererBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::DebugTools::RendererBatch, typedef @ref Magnum::DebugTools::RendererBatch2D, @ref Magnum::DebugTools::RendererBatch3D
+ */
+
+#include <memory>
+
+#include "Magnum/Color.h"
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Resource.h"
+#include "Magnum/DebugTools/visibility.h"
+
+namespace Magnum { namespace DebugTools {
+
+/**
+@brief Instanced debug renderer batch
+
+Collects draws of @ref ShapeRenderer, @ref ObjectRenderer and
+@ref ForceRenderer for one frame and then renders each primitive type (sphere,
+box, capsule, line segment, object axes, force arrow...) with a single
+instanced draw call, instead of one draw call per renderer. Example usage:
+@code
+DebugTools::RendererBatch3D batch;
+
+void MyApplication::drawEvent() {
+    // ...
+
+    // Collect all debug renderers, then draw them all at once
+    batch.begin();
+    camera.draw(debugDrawables);
+    batch.end();
+
+    // ...
+}
+@endcode
+
+While the batch is active, the renderers only record final transformation
+and color of each instance. On @ref end() the per-instance data are uploaded
+to a buffer and drawn using @ref Shaders::Flat or @ref Shaders::VertexColor
+with instanced transformation. Only one batch of given dimension count can be
+active at a time. The rendered output is the same as without the batch, only
+possibly in different order.
+
+If instanced rendering is not available (see below), @ref begin() does
+nothing and the renderers draw everything directly as usual.
+@requires_gl33 Extension @extension{ARB,instanced_arrays} and
+    @extension{ARB,draw_instanced} for instanced rendering
+@requires_gles30 Instanced rendering is not available in OpenGL ES 2.0, the
+    renderers draw everything directly there.
+@see @ref RendererBatch2D, @ref RendererBatch3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_DEBUGTOOLS_EXPORT RendererBatch {
+    public:
+        /**
+         * @brief Currently active batch
+         *
+         * Returns batch on which @ref begin() was called and @ref end() not
+         * yet, or `nullptr` if there is no such batch.
+         */
+        static RendererBatch<dimensions>* current();
+
+        /** @brief Constructor */
+        explicit RendererBatch();
+
+        /** @brief Copying is not allowed */
+        RendererBatch(const RendererBatch<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        RendererBatch(RendererBatch<dimensions>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * If the batch is active, it is deactivated without drawing anything.
+         */
+        ~RendererBatch();
+
+        /** @brief Copying is not allowed */
+        RendererBatch<dimensions>& operator=(const RendererBatch<dimensions>&) = delete;
+
+        /** @brief Moving is not allowed */
+        RendererBatch<dimensions>& operator=(RendererBatch<dimensions>&&) = delete;
+
+        /**
+         * @brief Whether instanced rendering is supported
+         *
+         * If `false`, @ref begin() does nothing.
+         */
+        bool isSupported() const { return _supported; }
+
+        /**
+         * @brief Begin collecting renderer draws
+         * @return Reference to self (for method chaining)
+         *
+         * Makes this batch @ref current(). Expects that no other batch of the
+         * same dimension count is active.
+         */
+        RendererBatch<dimensions>& begin();
+
+        /**
+         * @brief Draw all collected instances
+         * @return Count of issued draw calls
+         *
+         * Issues one instanced draw call for each distinct mesh collected
+         * since @ref begin() and deactivates the batch. Expects that the
+         * batch is active or that instanced rendering is not supported, in
+         * which case this function does nothing and returns `0`.
+         */
+        UnsignedInt end();
+
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        /* Used by the renderers. The instance buffer is created and attached
+           to the mesh on first use, the mesh is then shared by all batches. */
+        void addFlatInstance(Resource<Mesh>& mesh, MeshView* view, Resource<Buffer>& instanceBuffer, const MatrixTypeFor<dimensions, Float>& transformationProjectionMatrix, const Color4& color);
+        void addVertexColorInstance(Resource<Mesh>& mesh, Resource<Buffer>& instanceBuffer, const MatrixTypeFor<dimensions, Float>& transformationProjectionMatrix);
+        #endif
+
+    private:
+        struct State;
+
+        std::unique_ptr<State> _state;
+        bool _supported;
+};
+
+/** @brief Two-dimensional renderer batch */
+typedef RendererBatch<2> RendererBatch2D;
+
+/** @brief Three-dimensional renderer batch */
+typedef RendererBatch<3> RendererBatch3D;
+
+}}
+
+#endif
@@ -118,7 +118,8 @@ class ShapeRendererOptions {
 @brief Shape renderer
 
 Visualizes collision shapes using wireframe primitives. See
-@ref debug-tools-renderers for more information.
+@ref debug-tools-renderers for more information. All shapes of the same type
+can be drawn with a single draw call using @ref RendererBatch.
 
 @anchor DebugTools-ShapeRenderer-usage
 ## Basic usage
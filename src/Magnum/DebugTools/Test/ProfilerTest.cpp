@@ -0,0 +1,189 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <thread>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/DebugTools/Profiler.h"
+
+namespace Magnum { namespace DebugTools { namespace Test {
+
+struct ProfilerTest: TestSuite::Tester {
+    explicit ProfilerTest();
+
+    void trace();
+    void traceOverflow();
+
+    void scopeNested();
+    void scopeThread();
+    void scopeDisabled();
+
+    void debugGroupsDisabled();
+};
+
+ProfilerTest::ProfilerTest() {
+    addTests({&ProfilerTest::trace,
+              &ProfilerTest::traceOverflow,
+
+              &ProfilerTest::scopeNested,
+              &ProfilerTest::scopeThread,
+              &ProfilerTest::scopeDisabled,
+
+              &ProfilerTest::debugGroupsDisabled});
+}
+
+void ProfilerTest::trace() {
+    Profiler p;
+    const Profiler::Section draw = p.addSection("Draw \"scene\"");
+    p.enableTrace();
+    CORRADE_VERIFY(p.isTraceEnabled());
+    p.enable();
+
+    p.start(draw);
+    p.start();
+    p.stop();
+    p.nextFrame();
+
+    std::ostringstream out;
+    p.writeChromeTrace(out);
+    const std::string trace = out.str();
+
+    CORRADE_VERIFY(trace.find("{\"traceEvents\":[") == 0);
+    CORRADE_VERIFY(trace.find("\"name\":\"Draw \\\"scene\\\"\",\"ph\":\"X\",\"pid\":1,\"tid\":1") != std::string::npos);
+    CORRADE_VERIFY(trace.find("\"name\":\"Other\",\"ph\":\"X\"") != std::string::npos);
+    CORRADE_VERIFY(trace.find("\"name\":\"Frame 0\",\"ph\":\"i\"") != std::string::npos);
+    CORRADE_VERIFY(trace.find("\"tid\":2,\"ts\"") == std::string::npos);
+}
+
+void ProfilerTest::traceOverflow() {
+    Profiler p;
+    p.enableTrace(2);
+    p.enable();
+
+    /* Two "Other" sections and two frame markers, only the last frame
+       marker and the section before it survive */
+    p.start();
+    p.stop();
+    p.nextFrame();
+    p.start();
+    p.stop();
+    p.nextFrame();
+
+    std::ostringstream out;
+    p.writeChromeTrace(out);
+    const std::string trace = out.str();
+
+    CORRADE_VERIFY(trace.find("\"Frame 0\"") == std::string::npos);
+    CORRADE_VERIFY(trace.find("\"Frame 1\"") != std::string::npos);
+    CORRADE_VERIFY(trace.find("\"frame\":1}},\n{\"name\":\"Frame 1\"") != std::string::npos);
+}
+
+void ProfilerTest::scopeNested() {
+    Profiler p;
+    const Profiler::Section outer = p.addSection("Outer");
+    const Profiler::Section inner = p.addSection("Inner");
+    p.enableTrace();
+    p.enable();
+
+    {
+        Profiler::Scope a{p, outer};
+        Profiler::Scope b{p, inner};
+    }
+    p.nextFrame();
+
+    std::ostringstream out;
+    p.writeChromeTrace(out);
+    const std::string trace = out.str();
+
+    /* Both on the main thread track, inner finishes first */
+    const std::size_t innerPosition = trace.find("\"name\":\"Inner\",\"ph\":\"X\",\"pid\":1,\"tid\":1");
+    const std::size_t outerPosition = trace.find("\"name\":\"Outer\",\"ph\":\"X\",\"pid\":1,\"tid\":1");
+    CORRADE_VERIFY(innerPosition != std::string::npos);
+    CORRADE_VERIFY(outerPosition != std::string::npos);
+    CORRADE_VERIFY(innerPosition < outerPosition);
+}
+
+void ProfilerTest::scopeThread() {
+    Profiler p;
+    const Profiler::Section worker = p.addSection("Worker");
+    p.enableTrace();
+    p.enable();
+
+    std::thread thread{[&p, worker]() {
+        Profiler::Scope scope{p, worker};
+    }};
+    thread.join();
+    p.nextFrame();
+
+    std::ostringstream out;
+    p.writeChromeTrace(out);
+    const std::string trace = out.str();
+
+    CORRADE_VERIFY(trace.find("\"tid\":3,\"args\":{\"name\":\"Thread 1\"}") != std::string::npos);
+    CORRADE_VERIFY(trace.find("\"name\":\"Worker\",\"ph\":\"X\",\"pid\":1,\"tid\":3") != std::string::npos);
+}
+
+void ProfilerTest::scopeDisabled() {
+    Profiler p;
+    const Profiler::Section section = p.addSection("Section");
+    p.enableTrace();
+
+    /* Constructed before enabling, records nothing */
+    {
+        Profiler::Scope scope{p, section};
+        p.enable();
+    }
+    p.nextFrame();
+
+    std::ostringstream out;
+    p.writeChromeTrace(out);
+    CORRADE_VERIFY(out.str().find("\"name\":\"Section\"") == std::string::npos);
+}
+
+void ProfilerTest::debugGroupsDisabled() {
+    Profiler p;
+    const Profiler::Section section = p.addSection("Section");
+    CORRADE_VERIFY(!p.isDebugGroupsEnabled());
+
+    /* Disabled groups don't touch GL, so this works without a context */
+    p.enable();
+    p.start(section);
+    {
+        Profiler::Scope scope{p, section};
+    }
+    p.stop();
+    p.nextFrame();
+    p.disable();
+
+    p.enableDebugGroups();
+    CORRADE_VERIFY(p.isDebugGroupsEnabled());
+    p.disableDebugGroups();
+    CORRADE_VERIFY(!p.isDebugGroupsEnabled());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::DebugTools::Test::ProfilerTest)
@@ -0,0 +1,379 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/Utility/Arguments.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Color.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/MeshTools/Compile.h"
+#include "Magnum/Primitives/Cube.h"
+#include "Magnum/Primitives/Cylinder.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Primitives/UVSphere.h"
+#include "Magnum/SceneGraph/Camera3D.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/Shaders/Phong.h"
+#include "Magnum/Shaders/Vector.h"
+#include "Magnum/Shapes/Shape.h"
+#include "Magnum/Shapes/ShapeGroup.h"
+#include "Magnum/Shapes/Sphere.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/GlyphCache.h"
+#include "Magnum/Text/Renderer.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+#ifdef CORRADE_TARGET_APPLE
+#include "Magnum/Platform/WindowlessCglApplication.h"
+#elif defined(CORRADE_TARGET_UNIX)
+#include "Magnum/Platform/WindowlessGlxApplication.h"
+#elif defined(CORRADE_TARGET_WINDOWS)
+#include "Magnum/Platform/WindowlessWglApplication.h"
+#else
+#error No windowless application available on this platform
+#endif
+
+#include "scenebenchmarkConfigure.h"
+
+/* Counting all heap allocations done by the process, reported per frame */
+namespace {
+    std::atomic<std::size_t> allocationCount{0};
+}
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+    if(void* const memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+#ifdef MAGNUM_BUILD_UTILITIES_STATIC_PLUGINS
+/* The bundled plugins are linked in statically and need to be imported from
+   the global namespace */
+static void importStaticPlugins() {
+    #ifdef MAGNUM_WITH_MAGNUMFONT
+    CORRADE_PLUGIN_IMPORT(MagnumFont)
+    #endif
+    #ifdef MAGNUM_WITH_TGAIMPORTER
+    CORRADE_PLUGIN_IMPORT(TgaImporter)
+    #endif
+}
+#endif
+
+namespace Magnum {
+
+/**
+@page magnum-scenebenchmark Scene rendering benchmark
+@brief Measures frame time of a procedurally generated scene
+
+@section magnum-scenebenchmark-usage Usage
+
+    magnum-scenebenchmark [-h|--help] [--objects N] [--frames N] [--size "X Y"] [--no-culling] [--no-sorting] [--font FONT] [--font-file FILE] [--plugin-dir DIR]
+
+Arguments:
+
+-   `-h`, `--help` -- display help message and exit
+-   `--objects N` -- count of objects in the scene (default: `10000`)
+-   `--frames N` -- count of measured frames (default: `100`)
+-   `--size "X Y"` -- framebuffer size (default: `"1280 720"`)
+-   `--no-culling` -- don't assign bounding spheres to the drawables, so
+    they are not culled against the view frustum
+-   `--no-sorting` -- don't sort the drawables by mesh
+-   `--font FONT` -- font plugin for object labels. If not set, no labels
+    are rendered.
+-   `--font-file FILE` -- font file for object labels
+-   `--plugin-dir DIR` -- base plugin dir (defaults to plugin directory in
+    Magnum install location). If Magnum is built with
+    `BUILD_UTILITIES_STATIC_PLUGINS`, the bundled plugins are linked in
+    statically and no directory is scanned unless this option is set.
+
+The utility builds a scene graph with given count of objects laid out on a
+cubic grid around the camera, each having one of a few @ref Primitives meshes
+drawn with @ref Shaders::Phong and a @ref Shapes::Sphere "sphere shape" in a
+@ref Shapes::ShapeGroup. Every frame all objects are rotated, collisions in
+the shape group are computed, the labels are laid out again with
+@ref Text::BatchRenderer and the scene is drawn into an offscreen
+framebuffer. The frame time includes waiting for the GPU to finish the
+rendering.
+
+After given count of frames it prints frame time percentiles, average count
+of draw calls and heap allocations per frame. The first frame is not
+measured, as it includes one-time driver and shader setup.
+
+@section magnum-scenebenchmark-example Example usage
+
+Comparing frame times of a scene with 50 thousand objects with and without
+frustum culling:
+
+    magnum-scenebenchmark --objects 50000
+    magnum-scenebenchmark --objects 50000 --no-culling
+*/
+
+namespace DebugTools {
+
+namespace {
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+class PhongDrawable: public SceneGraph::Drawable3D {
+    public:
+        explicit PhongDrawable(Object3D& object, Shaders::Phong& shader, Mesh& mesh, const Color3& color, std::size_t& drawCallCount, SceneGraph::DrawableGroup3D& drawables): SceneGraph::Drawable3D{object, &drawables}, _shader(shader), _mesh(mesh), _color{color}, _drawCallCount(drawCallCount) {}
+
+    private:
+        void draw(const Matrix4& transformationMatrix, SceneGraph::AbstractCamera3D& camera) override {
+            _shader.setDiffuseColor(_color)
+                .setTransformationMatrix(transformationMatrix)
+                .setNormalMatrix(transformationMatrix.rotation())
+                .setProjectionMatrix(camera.projectionMatrix());
+            _mesh.draw(_shader);
+            ++_drawCallCount;
+        }
+
+        Shaders::Phong& _shader;
+        Mesh& _mesh;
+        Color3 _color;
+        std::size_t& _drawCallCount;
+};
+
+Float percentile(const std::vector<Float>& sorted, const Float fraction) {
+    return sorted[std::min(sorted.size() - 1, std::size_t(fraction*sorted.size()))];
+}
+
+}
+
+class SceneBenchmark: public Platform::WindowlessApplication {
+    public:
+        explicit SceneBenchmark(const Arguments& arguments);
+
+        int exec() override;
+
+    private:
+        Utility::Arguments args;
+};
+
+SceneBenchmark::SceneBenchmark(const Arguments& arguments): Platform::WindowlessApplication(arguments, nullptr) {
+    args.addOption("objects", "10000").setHelpKey("objects", "N").setHelp("objects", "count of objects in the scene")
+        .addOption("frames", "100").setHelpKey("frames", "N").setHelp("frames", "count of measured frames")
+        .addOption("size", "1280 720").setHelpKey("size", "\"X Y\"").setHelp("size", "framebuffer size")
+        .addBooleanOption("no-culling").setHelp("no-culling", "don't cull the drawables against the view frustum")
+        .addBooleanOption("no-sorting").setHelp("no-sorting", "don't sort the drawables by mesh")
+        .addOption("font", "").setHelpKey("font", "FONT").setHelp("font", "font plugin for object labels, no labels are rendered if not set")
+        .addOption("font-file", "").setHelpKey("font-file", "FILE").setHelp("font-file", "font file for object labels")
+        .addOption("plugin-dir", MAGNUM_PLUGINS_DIR).setHelpKey("plugin-dir", "DIR").setHelp("plugin-dir", "base plugin dir")
+        .setHelp("Measures frame time of a procedurally generated scene.")
+        .parse(arguments.argc, arguments.argv);
+
+    createContext();
+}
+
+int SceneBenchmark::exec() {
+    const std::size_t objectCount = args.value<std::size_t>("objects");
+    const std::size_t frameCount = args.value<std::size_t>("frames");
+    const Vector2i size = args.value<Vector2i>("size");
+    if(!objectCount || !frameCount || (size <= Vector2i{0}).any()) {
+        Error() << "The object count, frame count and size must be positive";
+        return 1;
+    }
+
+    /* Offscreen framebuffer, as windowless contexts don't have any */
+    Renderbuffer color, depth;
+    color.setStorage(RenderbufferFormat::RGBA8, size);
+    depth.setStorage(RenderbufferFormat::DepthComponent24, size);
+    Framebuffer framebuffer{{{}, size}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color)
+        .attachRenderbuffer(Framebuffer::BufferAttachment::Depth, depth)
+        .bind(FramebufferTarget::ReadDraw);
+    Renderer::enable(Renderer::Feature::DepthTest);
+    Renderer::enable(Renderer::Feature::FaceCulling);
+
+    /* Meshes, the buffers need to be kept alive together with them */
+    const Trade::MeshData3D meshData[]{
+        Primitives::Cube::solid(),
+        Primitives::Icosphere::solid(2),
+        Primitives::UVSphere::solid(16, 32),
+        Primitives::Cylinder::solid(4, 24, 1.0f, Primitives::Cylinder::Flag::CapEnds)
+    };
+    std::vector<Mesh> meshes;
+    std::vector<std::unique_ptr<Buffer>> buffers;
+    for(const Trade::MeshData3D& data: meshData) {
+        std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compiled = MeshTools::compile(data, BufferUsage::StaticDraw);
+        meshes.push_back(std::move(std::get<0>(compiled)));
+        buffers.push_back(std::move(std::get<1>(compiled)));
+        buffers.push_back(std::move(std::get<2>(compiled)));
+    }
+
+    Shaders::Phong shader;
+    shader.setAmbientColor(Color3{0.1f})
+        .setSpecularColor(Color3{0.5f})
+        .setLightPosition({0.0f, 100.0f, 0.0f});
+
+    /* Scene with the objects on a cubic grid centered around the camera, so
+       a good portion of them is outside of the view frustum */
+    Scene3D scene;
+    SceneGraph::DrawableGroup3D drawables;
+    Shapes::ShapeGroup3D shapes;
+    std::size_t drawCallCount = 0;
+    std::vector<Object3D*> objects;
+    objects.reserve(objectCount);
+    const bool culling = !args.isSet("no-culling");
+    const std::size_t gridSize = std::size_t(std::ceil(std::cbrt(Float(objectCount))));
+    const Float spacing = 3.0f;
+    const Vector3 gridOffset{-0.5f*spacing*(gridSize - 1)};
+    for(std::size_t i = 0; i != objectCount; ++i) {
+        const Vector3 position = gridOffset + spacing*Vector3{Float(i%gridSize), Float(i/gridSize%gridSize), Float(i/(gridSize*gridSize))};
+        const std::size_t meshId = i%meshes.size();
+
+        Object3D* object = new Object3D{&scene};
+        object->translate(position);
+        objects.push_back(object);
+
+        PhongDrawable* drawable = new PhongDrawable{*object, shader, meshes[meshId], Color3::fromHSV(Deg(Float(i*37%360)), 0.75f, 0.9f), drawCallCount, drawables};
+        drawable->setSortKey(SceneGraph::Drawable3D::sortKey(0, 0, meshId));
+        if(culling) drawable->setBoundingSphere({}, Constants::sqrt3());
+
+        new Shapes::Shape<Shapes::Sphere3D>{*object, {{}, 1.1f}, &shapes};
+    }
+
+    Object3D cameraObject{&scene};
+    SceneGraph::Camera3D camera{cameraObject};
+    camera.setPerspective(Deg(60.0f), Vector2{size}.aspectRatio(), 0.1f, 1000.0f)
+        .setViewport(size);
+    camera.setSortingEnabled(!args.isSet("no-sorting"));
+
+    /* Labels, if a font is specified. The plugin manager is created only
+       then, so plugin directories aren't scanned needlessly. */
+    std::unique_ptr<PluginManager::Manager<Text::AbstractFont>> fontManager;
+    std::unique_ptr<Text::AbstractFont> font;
+    std::unique_ptr<Text::GlyphCache> glyphCache;
+    std::unique_ptr<Text::BatchRenderer3D> labels;
+    std::unique_ptr<Shaders::Vector3D> labelShader;
+    std::vector<std::string> labelTexts;
+    if(!args.value("font").empty()) {
+        #ifdef MAGNUM_BUILD_UTILITIES_STATIC_PLUGINS
+        importStaticPlugins();
+        #endif
+        const std::string pluginDir = args.value("plugin-dir");
+        fontManager.reset(new PluginManager::Manager<Text::AbstractFont>{pluginDir.empty() ? std::string{} : Utility::Directory::join(pluginDir, "fonts/")});
+        if(!(fontManager->load(args.value("font")) & (PluginManager::LoadState::Loaded|PluginManager::LoadState::Static)))
+            return 1;
+        font = fontManager->instance(args.value("font"));
+        if(!font->openFile(args.value("font-file"), 32.0f)) {
+            Error() << "Cannot open font" << args.value("font-file");
+            return 1;
+        }
+
+        glyphCache.reset(new Text::GlyphCache{Vector2i{512}});
+        font->fillGlyphCache(*glyphCache, "Object 0123456789");
+
+        labelTexts.reserve(objectCount);
+        std::size_t glyphCount = 0;
+        for(std::size_t i = 0; i != objectCount; ++i) {
+            labelTexts.push_back("Object " + std::to_string(i));
+            glyphCount += labelTexts.back().size();
+        }
+
+        labels.reset(new Text::BatchRenderer3D{*font, *glyphCache, 0.5f});
+        labels->reserve(glyphCount, BufferUsage::StreamDraw, BufferUsage::StaticDraw);
+        labelShader.reset(new Shaders::Vector3D{Shaders::Vector3D::Flag::VertexColor});
+        labelShader->setColor(Color3{1.0f})
+            .setVectorTexture(glyphCache->texture());
+    }
+
+    std::vector<Float> frameTimes;
+    frameTimes.reserve(frameCount);
+    std::size_t drawCallSum = 0, allocationSum = 0, collisionSum = 0;
+    for(std::size_t frame = 0; frame != frameCount + 1; ++frame) {
+        drawCallCount = 0;
+        const std::size_t allocationsBefore = allocationCount;
+        const auto begin = std::chrono::high_resolution_clock::now();
+
+        for(Object3D* object: objects) object->rotateYLocal(Deg(1.0f));
+
+        const std::size_t collisionCount = shapes.collisions().size();
+
+        framebuffer.clear(FramebufferClear::Color|FramebufferClear::Depth);
+        camera.draw(drawables);
+
+        if(labels) {
+            labels->clear();
+            for(std::size_t i = 0; i != objectCount; ++i)
+                labels->add(labelTexts[i], objects[i]->transformation()*Matrix4::translation(Vector3::yAxis(1.5f)), Color3{1.0f}, Text::Alignment::MiddleCenter);
+            labels->update();
+
+            Renderer::enable(Renderer::Feature::Blending);
+            Renderer::setBlendFunction(Renderer::BlendFunction::One, Renderer::BlendFunction::OneMinusSourceAlpha);
+            labelShader->setTransformationProjectionMatrix(camera.projectionMatrix()*camera.cameraMatrix());
+            labels->mesh().draw(*labelShader);
+            Renderer::disable(Renderer::Feature::Blending);
+            ++drawCallCount;
+        }
+
+        Renderer::finish();
+
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        /* Skip the first frame */
+        if(!frame) continue;
+
+        frameTimes.push_back(std::chrono::duration<Float, std::milli>(end - begin).count());
+        drawCallSum += drawCallCount;
+        allocationSum += allocationCount - allocationsBefore;
+        collisionSum += collisionCount;
+    }
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+    Debug() << "Objects:" << objectCount << "Frames:" << frameCount;
+    Debug() << "Frame time in ms: min" << frameTimes.front() << "p50" << percentile(frameTimes, 0.5f) << "p90" << percentile(frameTimes, 0.9f) << "p99" << percentile(frameTimes, 0.99f) << "max" << frameTimes.back();
+    Debug() << "Per frame: draw calls" << Float(drawCallSum)/frameCount << "heap allocations" << Float(allocationSum)/frameCount << "collisions" << Float(collisionSum)/frameCount;
+
+    return 0;
+}
+
+}
+
+}
+
+MAGNUM_WINDOWLESSAPPLICATION_MAIN(Magnum::DebugTools::SceneBenchmark)
@@ -435,6 +435,20 @@ class MAGNUM_EXPORT DefaultFramebuffer: public AbstractFramebuffer {
             AbstractFramebuffer::clear(mask);
             return *this;
         }
+        #ifndef MAGNUM_TARGET_GLES2
+        DefaultFramebuffer& clearColor(Int drawBuffer, const Color4& color) {
+            AbstractFramebuffer::clearColor(drawBuffer, color);
+            return *this;
+        }
+        DefaultFramebuffer& clearColor(Int drawBuffer, const Vector4ui& color) {
+            AbstractFramebuffer::clearColor(drawBuffer, color);
+            return *this;
+        }
+        DefaultFramebuffer& clearColor(Int drawBuffer, const Vector4i& color) {
+            AbstractFramebuffer::clearColor(drawBuffer, color);
+            return *this;
+        }
+        #endif
         #endif
 
     private:
@@ -0,0 +1,166 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DrawList.h"
+
+#include <algorithm>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/AbstractTexture.h"
+#include "Magnum/Buffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshView.h"
+
+namespace Magnum {
+
+DrawList::DrawList(const std::size_t threadCount): _sorting{Sorting::State} {
+    _recorders.reserve(threadCount);
+    for(std::size_t i = 0; i != threadCount; ++i)
+        _recorders.push_back(Recorder{*this});
+}
+
+DrawList::~DrawList() = default;
+
+UnsignedShort DrawList::addMesh(Mesh& mesh) {
+    CORRADE_ASSERT(_meshes.size() < 0xffff,
+        "DrawList::addMesh(): too many meshes", {});
+    _meshes.push_back({&mesh, nullptr});
+    return _meshes.size() - 1;
+}
+
+UnsignedShort DrawList::addMesh(MeshView& mesh) {
+    CORRADE_ASSERT(_meshes.size() < 0xffff,
+        "DrawList::addMesh(): too many meshes", {});
+    _meshes.push_back({nullptr, &mesh});
+    return _meshes.size() - 1;
+}
+
+UnsignedShort DrawList::addShader(AbstractShaderProgram& shader) {
+    CORRADE_ASSERT(_shaders.size() < 0xffff,
+        "DrawList::addShader(): too many shaders", {});
+    _shaders.push_back(&shader);
+    return _shaders.size() - 1;
+}
+
+UnsignedShort DrawList::addTexture(AbstractTexture& texture) {
+    CORRADE_ASSERT(_textures.size() < NoTexture,
+        "DrawList::addTexture(): too many textures", {});
+    _textures.push_back(&texture);
+    return _textures.size() - 1;
+}
+
+DrawList& DrawList::addUniformBuffer(Buffer& buffer, const UnsignedInt index, const GLsizeiptr size) {
+    CORRADE_ASSERT(_uniformBuffers.size() < UniformBufferCount,
+        "DrawList::addUniformBuffer(): at most" << UniformBufferCount << "buffers can be added", *this);
+    _uniformBuffers.push_back({&buffer, index, size});
+    return *this;
+}
+
+DrawList::Recorder& DrawList::recorder(const std::size_t thread) {
+    CORRADE_ASSERT(thread < _recorders.size(),
+        "DrawList::recorder(): index" << thread << "out of range for" << _recorders.size() << "recorders", _recorders.front());
+    return _recorders[thread];
+}
+
+DrawList::Recorder& DrawList::Recorder::draw(const UnsignedShort mesh, const UnsignedShort shader, const std::initializer_list<UnsignedShort> textures, const std::initializer_list<UnsignedInt> uniformOffsets, const UnsignedLong key) {
+    CORRADE_ASSERT(mesh < _list->_meshes.size() && shader < _list->_shaders.size(),
+        "DrawList::Recorder::draw(): invalid mesh or shader ID", *this);
+    CORRADE_ASSERT(textures.size() <= TextureCount && uniformOffsets.size() <= UniformBufferCount,
+        "DrawList::Recorder::draw(): too many textures or uniform offsets", *this);
+
+    Command command;
+    command.key = key;
+    command.mesh = mesh;
+    command.shader = shader;
+    std::fill_n(std::copy(textures.begin(), textures.end(), command.textures), TextureCount - textures.size(), UnsignedShort(NoTexture));
+    std::fill_n(std::copy(uniformOffsets.begin(), uniformOffsets.end(), command.uniformOffsets), UniformBufferCount - uniformOffsets.size(), 0);
+
+    #ifndef CORRADE_NO_ASSERT
+    for(const UnsignedShort texture: textures)
+        CORRADE_ASSERT(texture == NoTexture || texture < _list->_textures.size(),
+            "DrawList::Recorder::draw(): invalid texture ID" << texture, *this);
+    #endif
+
+    _commands.push_back(command);
+    return *this;
+}
+
+DrawList& DrawList::merge() {
+    const std::size_t sortFrom = _commands.size();
+    for(Recorder& recorder: _recorders) {
+        _commands.insert(_commands.end(), recorder._commands.begin(), recorder._commands.end());
+        recorder._commands.clear();
+    }
+
+    /* Stable sort, so commands with equal state keep the recorded order */
+    if(_sorting == Sorting::State)
+        std::stable_sort(_commands.begin() + sortFrom, _commands.end(), [](const Command& a, const Command& b) {
+            if(a.shader != b.shader) return a.shader < b.shader;
+            if(a.textures[0] != b.textures[0]) return a.textures[0] < b.textures[0];
+            return a.mesh < b.mesh;
+        });
+    else if(_sorting == Sorting::Key)
+        std::stable_sort(_commands.begin() + sortFrom, _commands.end(), [](const Command& a, const Command& b) {
+            return a.key < b.key;
+        });
+
+    return *this;
+}
+
+void DrawList::replay() {
+    merge();
+
+    /* Indexed uniform buffer bindings are not tracked in the state tracker,
+       so we can't assume anything about them at the beginning */
+    const Command* previous = nullptr;
+    for(const Command& command: _commands) {
+        for(std::size_t i = 0; i != TextureCount; ++i)
+            if(command.textures[i] != NoTexture)
+                _textures[command.textures[i]]->bind(i);
+
+        for(std::size_t i = 0; i != _uniformBuffers.size(); ++i) {
+            if(previous && previous->uniformOffsets[i] == command.uniformOffsets[i])
+                continue;
+
+            const UniformBuffer& buffer = _uniformBuffers[i];
+            buffer.buffer->bind(Buffer::Target::Uniform, buffer.index, command.uniformOffsets[i], buffer.size);
+        }
+
+        const MeshReference& mesh = _meshes[command.mesh];
+        if(mesh.mesh) mesh.mesh->draw(*_shaders[command.shader]);
+        else mesh.view->draw(*_shaders[command.shader]);
+
+        previous = &command;
+    }
+
+    _commands.clear();
+}
+
+void DrawList::clear() {
+    for(Recorder& recorder: _recorders) recorder._commands.clear();
+    _commands.clear();
+}
+
+}
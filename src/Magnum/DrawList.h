@@ -0,0 +1,330 @@
+#ifndef Magnum_DrawList_h
+#define Magnum_DrawList_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::DrawList
+ */
+#endif
+
+#include <initializer_list>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/OpenGL.h"
+#include "Magnum/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+/**
+@brief Draw list recorded from multiple threads
+
+OpenGL calls can be issued only from the thread owning the context, but
+deciding what to draw --- culling, level-of-detail selection, filling uniform
+data --- doesn't need OpenGL at all. This class lets worker threads record
+compact draw commands into per-thread lists, which are then merged, sorted to
+minimize state changes and replayed on the OpenGL thread.
+
+All meshes, shaders, textures and uniform buffers used by the commands are
+registered up front on the OpenGL thread and commands refer to them only by
+16-bit IDs, so a command is just a few dozen bytes:
+@code
+DrawList list{threadCount};
+const UnsignedShort shader = list.addShader(phong);
+const UnsignedShort diffuse = list.addTexture(diffuseTexture);
+list.addUniformBuffer(perObjectUniforms, 0, sizeof(PerObject));
+
+std::vector<UnsignedShort> meshes;
+for(Mesh& mesh: sceneMeshes) meshes.push_back(list.addMesh(mesh));
+
+// on each worker thread
+DrawList::Recorder& recorder = list.recorder(threadId);
+for(const Object& object: objectsOfThisThread) {
+    if(!object.visible(frustum)) continue;
+    // write per-object data at `offset` of (persistently mapped) uniform buffer
+    recorder.draw(meshes[object.meshId()], shader, {diffuse}, {offset});
+}
+
+// on the OpenGL thread, after all workers are done
+list.replay();
+@endcode
+
+Each recorder is expected to be used from one thread at a time and IDs are
+expected to be registered before any recording starts --- the class doesn't
+do any locking, so registration, @ref merge(), @ref replay() and
+@ref clear() must not overlap with recording.
+
+@section DrawList-sorting Command sorting
+
+On @ref merge(), commands from all recorders are concatenated in recorder
+order and then stably sorted according to @ref setSorting(). By default they
+are sorted by shader, then by the first texture, then by mesh, so each shader
+is used once per replay and texture binds are minimized. With
+@ref Sorting::Key the commands are sorted by the user-supplied key (e.g.
+one created with @ref SceneGraph::Drawable::sortKey()), with
+@ref Sorting::None the recorded order is preserved, which is useful e.g.
+for back-to-front drawing of transparent objects with order established by
+the workers themselves.
+
+@section DrawList-replay Replay
+
+On @ref replay(), textures of each command are bound to consecutive texture
+units starting from `0` using @ref AbstractTexture::bind(), which is a no-op
+if the texture is already bound, units of unused texture slots are left
+untouched. Uniform buffer ranges are not tracked by @ref Buffer, so they are
+tracked during the replay and bound only if the offset differs from the
+previous command. The mesh is then drawn with the shader. Recorded commands
+are discarded afterwards, allocated memory is kept for the next frame.
+@requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+@requires_gles30 Uniform buffers are not available in OpenGL ES 2.0.
+*/
+class MAGNUM_EXPORT DrawList {
+    public:
+        enum: std::size_t {
+            TextureCount = 4,       /**< Max count of textures per command */
+            UniformBufferCount = 4  /**< Max count of uniform buffers */
+        };
+
+        enum: UnsignedShort {
+            NoTexture = 0xffff  /**< Texture ID denoting unused texture slot */
+        };
+
+        /** @brief Command sorting */
+        enum class Sorting: UnsignedByte {
+            None,   /**< Keep the recorded order */
+
+            /**
+             * Sort by shader, then by the first texture, then by mesh.
+             * Default.
+             */
+            State,
+
+            Key     /**< Sort by user-supplied key */
+        };
+
+        /**
+         * @brief Draw command
+         *
+         * Unused texture slots are set to @ref NoTexture, unused uniform offsets
+         * to `0`.
+         */
+        struct Command {
+            UnsignedLong key;                           /**< @brief Sort key */
+            UnsignedShort mesh;                         /**< @brief Mesh ID */
+            UnsignedShort shader;                       /**< @brief Shader ID */
+            UnsignedShort textures[TextureCount];       /**< @brief Texture IDs */
+            UnsignedInt uniformOffsets[UniformBufferCount]; /**< @brief Uniform buffer offsets */
+        };
+
+        /**
+         * @brief Per-thread command recorder
+         *
+         * See @ref DrawList for more information.
+         */
+        class MAGNUM_EXPORT Recorder {
+            friend DrawList;
+
+            public:
+                /**
+                 * @brief Record draw command
+                 * @param mesh              Mesh ID returned from @ref DrawList::addMesh()
+                 * @param shader            Shader ID returned from @ref DrawList::addShader()
+                 * @param textures          Texture IDs returned from
+                 *      @ref DrawList::addTexture(), bound to consecutive
+                 *      units starting from `0`. At most @ref DrawList::TextureCount
+                 *      items.
+                 * @param uniformOffsets    Offsets into uniform buffers in
+                 *      order in which they were added with @ref DrawList::addUniformBuffer().
+                 *      At most @ref DrawList::UniformBufferCount items,
+                 *      missing offsets are treated as `0`.
+                 * @param key               Sort key, used with
+                 *      @ref Sorting::Key
+                 * @return Reference to self (for method chaining)
+                 *
+                 * Doesn't call any OpenGL function.
+                 */
+                Recorder& draw(UnsignedShort mesh, UnsignedShort shader, std::initializer_list<UnsignedShort> textures = {}, std::initializer_list<UnsignedInt> uniformOffsets = {}, UnsignedLong key = 0);
+
+                /** @brief Count of recorded commands */
+                std::size_t size() const { return _commands.size(); }
+
+            private:
+                explicit Recorder(const DrawList& list): _list(&list) {}
+
+                const DrawList* _list;
+                std::vector<Command> _commands;
+        };
+
+        /**
+         * @brief Constructor
+         * @param threadCount   Count of recorders
+         *
+         * Doesn't call any OpenGL function.
+         */
+        explicit DrawList(std::size_t threadCount);
+
+        /** @brief Copying is not allowed */
+        DrawList(const DrawList&) = delete;
+
+        /** @brief Moving is not allowed */
+        DrawList(DrawList&&) = delete;
+
+        ~DrawList();
+
+        /** @brief Copying is not allowed */
+        DrawList& operator=(const DrawList&) = delete;
+
+        /** @brief Moving is not allowed */
+        DrawList& operator=(DrawList&&) = delete;
+
+        /** @brief Command sorting */
+        Sorting sorting() const { return _sorting; }
+
+        /**
+         * @brief Set command sorting
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref Sorting::State.
+         */
+        DrawList& setSorting(Sorting sorting) {
+            _sorting = sorting;
+            return *this;
+        }
+
+        /**
+         * @brief Register mesh
+         * @return Mesh ID to use in @ref Recorder::draw()
+         *
+         * The mesh is expected to be alive for the whole lifetime of the
+         * list. At most 65535 meshes can be registered.
+         */
+        UnsignedShort addMesh(Mesh& mesh);
+        UnsignedShort addMesh(MeshView& mesh); /**< @overload */
+
+        /**
+         * @brief Register shader
+         * @return Shader ID to use in @ref Recorder::draw()
+         *
+         * The shader is expected to be alive for the whole lifetime of the
+         * list. At most 65535 shaders can be registered.
+         */
+        UnsignedShort addShader(AbstractShaderProgram& shader);
+
+        /**
+         * @brief Register texture
+         * @return Texture ID to use in @ref Recorder::draw()
+         *
+         * The texture is expected to be alive for the whole lifetime of the
+         * list. At most 65535 textures can be registered.
+         */
+        UnsignedShort addTexture(AbstractTexture& texture);
+
+        /**
+         * @brief Add uniform buffer
+         * @param buffer    Buffer
+         * @param index     Uniform buffer binding index
+         * @param size      Size of the range bound for each command
+         * @return Reference to self (for method chaining)
+         *
+         * Offsets into the buffer are specified for each command in
+         * @ref Recorder::draw(). At most @ref UniformBufferCount buffers can
+         * be added, the offsets need to respect
+         * @ref Buffer::uniformOffsetAlignment().
+         */
+        DrawList& addUniformBuffer(Buffer& buffer, UnsignedInt index, GLsizeiptr size);
+
+        /** @brief Count of recorders */
+        std::size_t recorderCount() const { return _recorders.size(); }
+
+        /**
+         * @brief Recorder for given thread
+         *
+         * Expects that @p thread is less than @ref recorderCount().
+         */
+        Recorder& recorder(std::size_t thread);
+
+        /**
+         * @brief Merge and sort recorded commands
+         * @return Reference to self (for method chaining)
+         *
+         * Appends commands from all recorders to @ref commands(), clears the
+         * recorders and sorts the commands according to @ref sorting().
+         * Doesn't call any OpenGL function.
+         */
+        DrawList& merge();
+
+        /**
+         * @brief Merged commands
+         *
+         * Filled by @ref merge().
+         */
+        const std::vector<Command>& commands() const { return _commands; }
+
+        /**
+         * @brief Replay recorded commands
+         *
+         * Calls @ref merge(), executes all merged commands and clears them.
+         * See @ref DrawList-replay "class documentation" for more
+         * information.
+         */
+        void replay();
+
+        /**
+         * @brief Discard recorded commands
+         *
+         * Clears all recorders and merged commands without executing them.
+         */
+        void clear();
+
+    private:
+        struct MeshReference {
+            Mesh* mesh;
+            MeshView* view;
+        };
+
+        struct UniformBuffer {
+            Buffer* buffer;
+            UnsignedInt index;
+            GLsizeiptr size;
+        };
+
+        Sorting _sorting;
+        std::vector<Recorder> _recorders;
+        std::vector<MeshReference> _meshes;
+        std::vector<AbstractShaderProgram*> _shaders;
+        std::vector<AbstractTexture*> _textures;
+        std::vector<UniformBuffer> _uniformBuffers;
+        std::vector<Command> _commands;
+};
+
+}
+#else
+#error this header is not available on OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -193,8 +193,10 @@ namespace GL {
         _extension(GL,ARB,transform_feedback_overflow_query, GL300, None) // #173
     } namespace ATI {
         _extension(GL,ATI,texture_mirror_once,          GL210,  None) // #221
+        _extension(GL,ATI,meminfo,                      GL210,  None) // #359
     } namespace EXT {
         _extension(GL,EXT,texture_filter_anisotropic,   GL210,  None) // #187
+        _extension(GL,EXT,texture_compression_s3tc,     GL210,  None) // #198
         /* EXT_framebuffer_object, EXT_packed_depth_stencil, EXT_framebuffer_blit,
            EXT_framebuffer_multisample replaced with ARB_framebuffer_object */
         _extension(GL,EXT,texture_mirror_clamp,         GL210,  None) // #298
@@ -220,13 +222,16 @@ namespace GL {
         _extension(GL,KHR,debug,                        GL210, GL430) // #119
         _extension(GL,KHR,context_flush_control,        GL210, GL450) // #168
         _extension(GL,KHR,robustness,                   GL320, GL450) // #170
+        _extension(GL,KHR,parallel_shader_compile,      GL210,  None) // #192
     } namespace NV {
         _extension(GL,NV,primitive_restart,             GL210, GL310) // #285
         _extension(GL,NV,depth_buffer_float,            GL210, GL300) // #334
         _extension(GL,NV,conditional_render,            GL210, GL300) // #346
         /* NV_draw_texture not supported */                           // #430
+    } namespace NVX {
+        _extension(GL,NVX,gpu_memory_info,              GL210,  None) // #438
     }
-    /* IMPORTANT: if this line is > 233 (73 + size), don't forget to update array size in Context.h */
+    /* IMPORTANT: if this line is > 243 (73 + size), don't forget to update array size in Context.h */
     #else
     #line 1
     namespace ANGLE {
@@ -284,6 +289,7 @@ namespace GL {
         #endif
         _extension(GL,EXT,disjoint_timer_query,     GLES200,    None) // #150
         _extension(GL,EXT,texture_sRGB_decode,      GLES200,    None) // #152
+        _extension(GL,EXT,texture_compression_s3tc, GLES200,    None) // #154
         #ifdef MAGNUM_TARGET_GLES2
         _extension(GL,EXT,instanced_arrays,         GLES200, GLES300) // #156
         _extension(GL,EXT,draw_instanced,           GLES200, GLES300) // #157
@@ -298,6 +304,7 @@ namespace GL {
         _extension(GL,KHR,robustness,               GLES200,    None) // #170
         _extension(GL,KHR,robust_buffer_access_behavior, GLES200, None) // #189
         _extension(GL,KHR,context_flush_control,    GLES200,    None) // #191
+        _extension(GL,KHR,parallel_shader_compile,  GLES200,    None) // #288
     } namespace NV {
         #ifdef MAGNUM_TARGET_GLES2
         _extension(GL,NV,draw_buffers,              GLES200, GLES300) // #91
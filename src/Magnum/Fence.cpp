@@ -0,0 +1,67 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Fence.h"
+
+#include <utility>
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+Fence::Fence(): _id{glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)} {
+    /* Waiting on an unflushed fence from another context would never return */
+    glFlush();
+}
+
+Fence::Fence(Fence&& other) noexcept: _id{other._id} {
+    other._id = nullptr;
+}
+
+Fence::~Fence() {
+    if(_id) glDeleteSync(_id);
+}
+
+Fence& Fence::operator=(Fence&& other) noexcept {
+    std::swap(_id, other._id);
+    return *this;
+}
+
+bool Fence::isSignaled() const {
+    GLint status;
+    glGetSynciv(_id, GL_SYNC_STATUS, 1, nullptr, &status);
+    return status == GL_SIGNALED;
+}
+
+bool Fence::clientWait(const std::chrono::nanoseconds timeout) {
+    const GLenum result = glClientWaitSync(_id, 0, timeout.count());
+    return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+}
+
+void Fence::wait() {
+    glWaitSync(_id, 0, GL_TIMEOUT_IGNORED);
+}
+
+}
+#endif
@@ -0,0 +1,135 @@
+#ifndef Magnum_Fence_h
+#define Magnum_Fence_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Fence
+ */
+
+#include <chrono>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/OpenGL.h"
+#include "Magnum/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+/**
+@brief Fence sync object
+
+Inserted into the command stream of current context, becomes signaled when
+all previously submitted commands are finished. Sync objects are shared
+between contexts, so it can be used to hand over objects created in a
+secondary shared context on a loader thread to the main context without
+calling @fn_gl{Finish}. See @ref Context for a complete example.
+@code
+// loader thread
+texture.setSubImage(0, {}, image);
+Fence fence;
+// pass the texture and the fence to the main thread ...
+
+// main thread
+fence.wait();
+mesh.draw(shader.setTexture(texture));
+@endcode
+@requires_gl32 Extension @extension{ARB,sync}
+@requires_gles30 Sync objects are not available in OpenGL ES 2.0.
+@requires_webgl20 Sync objects are not available in WebGL 1.0.
+*/
+class MAGNUM_EXPORT Fence {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Inserts the fence into the command stream and flushes it, so it is
+         * guaranteed to become signaled even if it's waited on in another
+         * context.
+         * @see @fn_gl{FenceSync}, @fn_gl{Flush}
+         */
+        explicit Fence();
+
+        /** @brief Copying is not allowed */
+        Fence(const Fence&) = delete;
+
+        /** @brief Move constructor */
+        Fence(Fence&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * @see @fn_gl{DeleteSync}
+         */
+        ~Fence();
+
+        /** @brief Copying is not allowed */
+        Fence& operator=(const Fence&) = delete;
+
+        /** @brief Move assignment */
+        Fence& operator=(Fence&& other) noexcept;
+
+        /** @brief OpenGL sync object */
+        GLsync id() const { return _id; }
+
+        /**
+         * @brief Whether the fence is signaled
+         *
+         * Doesn't block.
+         * @see @fn_gl{GetSync} with @def_gl{SYNC_STATUS}
+         */
+        bool isSignaled() const;
+
+        /**
+         * @brief Wait for the fence on the CPU
+         * @param timeout   Timeout
+         * @return `True` if the fence was signaled, `false` if the timeout
+         *      expired
+         *
+         * Blocks the calling thread until the fence is signaled or given
+         * time elapsed.
+         * @see @ref wait(), @fn_gl{ClientWaitSync}
+         */
+        bool clientWait(std::chrono::nanoseconds timeout);
+
+        /**
+         * @brief Wait for the fence on the GPU
+         *
+         * Returns immediately, but the commands submitted in current context
+         * afterwards are not executed until the fence is signaled.
+         * @see @ref clientWait(), @fn_gl{WaitSync}
+         */
+        void wait();
+
+    private:
+        GLsync _id;
+};
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -46,6 +46,7 @@
 #endif
 
 #include "Implementation/DebugState.h"
+#include "Implementation/DeletionState.h"
 #include "Implementation/State.h"
 #include "Implementation/FramebufferState.h"
 
@@ -117,7 +118,8 @@ Framebuffer::~Framebuffer() {
         defaultFramebuffer.bind(FramebufferTarget::Draw);
     }
 
-    glDeleteFramebuffers(1, &_id);
+    if(!Context::current()->state().deletion->deferFramebuffer(_id))
+        glDeleteFramebuffers(1, &_id);
 }
 
 std::string Framebuffer::label() {
@@ -247,6 +249,21 @@ Framebuffer& Framebuffer::attachTextureLayer(Framebuffer::BufferAttachment attac
     (this->*Context::current()->state().framebuffer->textureLayerImplementation)(attachment, texture.id(), 0, layer);
     return *this;
 }
+
+Framebuffer& Framebuffer::attachLayeredTexture(const BufferAttachment attachment, Texture2DArray& texture, const Int level) {
+    (this->*Context::current()->state().framebuffer->layeredTextureImplementation)(attachment, texture.id(), level);
+    return *this;
+}
+
+Framebuffer& Framebuffer::attachLayeredTexture(const BufferAttachment attachment, CubeMapTexture& texture, const Int level) {
+    (this->*Context::current()->state().framebuffer->layeredTextureImplementation)(attachment, texture.id(), level);
+    return *this;
+}
+
+Framebuffer& Framebuffer::attachLayeredTexture(const BufferAttachment attachment, CubeMapTextureArray& texture, const Int level) {
+    (this->*Context::current()->state().framebuffer->layeredTextureImplementation)(attachment, texture.id(), level);
+    return *this;
+}
 #endif
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -329,6 +346,19 @@ void Framebuffer::textureLayerImplementationDSAEXT(BufferAttachment attachment,
     _created = true;
     glNamedFramebufferTextureLayerEXT(_id, GLenum(attachment), textureId, mipLevel, layer);
 }
+
+void Framebuffer::layeredTextureImplementationDefault(BufferAttachment attachment, GLuint textureId, GLint mipLevel) {
+    glFramebufferTexture(GLenum(bindInternal()), GLenum(attachment), textureId, mipLevel);
+}
+
+void Framebuffer::layeredTextureImplementationDSA(const BufferAttachment attachment, const GLuint textureId, const GLint mipLevel) {
+    glNamedFramebufferTexture(_id, GLenum(attachment), textureId, mipLevel);
+}
+
+void Framebuffer::layeredTextureImplementationDSAEXT(BufferAttachment attachment, GLuint textureId, GLint mipLevel) {
+    _created = true;
+    glNamedFramebufferTextureEXT(_id, GLenum(attachment), textureId, mipLevel);
+}
 #endif
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -618,6 +618,50 @@ class MAGNUM_EXPORT Framebuffer: public AbstractFramebuffer, public AbstractObje
         Framebuffer& attachTextureLayer(BufferAttachment attachment, MultisampleTexture2DArray& texture, Int layer);
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Attach all layers of texture to given buffer
+         * @param attachment        Buffer attachment
+         * @param texture           Texture
+         * @param level             Mip level
+         * @return Reference to self (for method chaining)
+         *
+         * Makes the attachment layered, the layer into which each primitive
+         * is rendered is then selected in the shader using `gl_Layer`, see
+         * for example @ref Shaders::Flat::Flag::Stereo and
+         * @ref Shaders::Flat::Flag::CubeMap. If neither
+         * @extension{ARB,direct_state_access} (part of OpenGL 4.5) nor
+         * @extension{EXT,direct_state_access} is available, the framebuffer
+         * is bound before the operation (if not already).
+         * @see @ref attachTextureLayer(),
+         *      @fn_gl2{NamedFramebufferTexture,FramebufferTexture},
+         *      @fn_gl_extension{NamedFramebufferTexture,EXT,direct_state_access},
+         *      eventually @fn_gl{BindFramebuffer} and @fn_gl{FramebufferTexture}
+         * @requires_gl32 Extension @extension{ARB,geometry_shader4}
+         * @requires_gl Layered attachments are not available in OpenGL ES.
+         */
+        Framebuffer& attachLayeredTexture(BufferAttachment attachment, Texture2DArray& texture, Int level);
+
+        /** @overload
+         *
+         * Cube map faces are layers in order given by
+         * @ref CubeMapTexture::Coordinate, i.e. @f$ +X @f$, @f$ -X @f$,
+         * @f$ +Y @f$, @f$ -Y @f$, @f$ +Z @f$, @f$ -Z @f$.
+         * @requires_gl32 Extension @extension{ARB,geometry_shader4}
+         * @requires_gl Layered attachments are not available in OpenGL ES.
+         */
+        Framebuffer& attachLayeredTexture(BufferAttachment attachment, CubeMapTexture& texture, Int level);
+
+        /** @overload
+         *
+         * Layer `6*i + face` corresponds to given face of `i`-th cube map,
+         * with faces ordered as in @ref CubeMapTexture::Coordinate.
+         * @requires_gl40 Extension @extension{ARB,texture_cube_map_array}
+         * @requires_gl Layered attachments are not available in OpenGL ES.
+         */
+        Framebuffer& attachLayeredTexture(BufferAttachment attachment, CubeMapTextureArray& texture, Int level);
+        #endif
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         #ifndef MAGNUM_TARGET_GLES
         /**
@@ -654,6 +698,20 @@ class MAGNUM_EXPORT Framebuffer: public AbstractFramebuffer, public AbstractObje
             AbstractFramebuffer::clear(mask);
             return *this;
         }
+        #ifndef MAGNUM_TARGET_GLES2
+        Framebuffer& clearColor(Int drawBuffer, const Color4& color) {
+            AbstractFramebuffer::clearColor(drawBuffer, color);
+            return *this;
+        }
+        Framebuffer& clearColor(Int drawBuffer, const Vector4ui& color) {
+            AbstractFramebuffer::clearColor(drawBuffer, color);
+            return *this;
+        }
+        Framebuffer& clearColor(Int drawBuffer, const Vector4i& color) {
+            AbstractFramebuffer::clearColor(drawBuffer, color);
+            return *this;
+        }
+        #endif
         #endif
 
     private:
@@ -687,6 +745,12 @@ class MAGNUM_EXPORT Framebuffer: public AbstractFramebuffer, public AbstractObje
         void MAGNUM_LOCAL textureLayerImplementationDSA(BufferAttachment attachment, GLuint textureId, GLint level, GLint layer);
         void MAGNUM_LOCAL textureLayerImplementationDSAEXT(BufferAttachment attachment, GLuint textureId, GLint level, GLint layer);
         #endif
+
+        #ifndef MAGNUM_TARGET_GLES
+        void MAGNUM_LOCAL layeredTextureImplementationDefault(BufferAttachment attachment, GLuint textureId, GLint level);
+        void MAGNUM_LOCAL layeredTextureImplementationDSA(BufferAttachment attachment, GLuint textureId, GLint level);
+        void MAGNUM_LOCAL layeredTextureImplementationDSAEXT(BufferAttachment attachment, GLuint textureId, GLint level);
+        #endif
 };
 
 /** @debugoperatorclassenum{Magnum::Framebuffer,Magnum::Framebuffer::Status} */
@@ -0,0 +1,119 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "FramebufferReadbackQueue.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/AbstractFramebuffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Renderer.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+FramebufferReadbackQueue::FramebufferReadbackQueue(const ColorFormat format, const ColorType type, const UnsignedInt frameCount): _next{0}, _pendingCount{0}, _mapped{false} {
+    CORRADE_ASSERT(frameCount,
+        "FramebufferReadbackQueue: expected at least one frame", );
+
+    _slots.reserve(frameCount);
+    for(UnsignedInt i = 0; i != frameCount; ++i) _slots.emplace_back(format, type);
+
+    #ifndef MAGNUM_TARGET_GLES
+    _sync = Context::current()->isExtensionSupported<Extensions::GL::ARB::sync>();
+    #else
+    _sync = true;
+    #endif
+}
+
+FramebufferReadbackQueue::~FramebufferReadbackQueue() {
+    if(_mapped) release();
+}
+
+bool FramebufferReadbackQueue::read(AbstractFramebuffer& framebuffer, const Range2Di& rectangle) {
+    if(_pendingCount == _slots.size()) return false;
+
+    Slot& slot = _slots[_next];
+    framebuffer.read(rectangle, slot.image, BufferUsage::StreamRead);
+    if(_sync) slot.fence.reset(new Fence);
+
+    _next = (_next + 1)%_slots.size();
+    ++_pendingCount;
+    return true;
+}
+
+ImageReference2D FramebufferReadbackQueue::tryGet() {
+    CORRADE_ASSERT(!_mapped,
+        "FramebufferReadbackQueue::tryGet(): previous data not released", ImageReference2D(ColorFormat{}, ColorType{}, {}));
+
+    Slot& slot = oldest();
+
+    /* Without fences assume the oldest readback is done when all frames
+       are in flight */
+    if(!_pendingCount || (_sync ? !slot.fence->isSignaled() : _pendingCount != _slots.size()))
+        return ImageReference2D{slot.image.format(), slot.image.type(), {}};
+
+    return map(slot);
+}
+
+ImageReference2D FramebufferReadbackQueue::get() {
+    CORRADE_ASSERT(!_mapped,
+        "FramebufferReadbackQueue::get(): previous data not released", ImageReference2D(ColorFormat{}, ColorType{}, {}));
+
+    Slot& slot = oldest();
+    if(!_pendingCount)
+        return ImageReference2D{slot.image.format(), slot.image.type(), {}};
+
+    /* The fence is waited on without the flush flag, so make sure it gets
+       submitted, otherwise the wait might never end */
+    if(_sync) {
+        Renderer::flush();
+        while(!slot.fence->clientWait(std::chrono::milliseconds{1})) {}
+    } else Renderer::finish();
+
+    return map(slot);
+}
+
+ImageReference2D FramebufferReadbackQueue::map(Slot& slot) {
+    const void* data = slot.image.buffer().map(0, slot.image.dataSize(slot.image.size()), Buffer::MapFlag::Read);
+    _mapped = true;
+    return ImageReference2D{slot.image.format(), slot.image.type(), slot.image.size(), data};
+}
+
+void FramebufferReadbackQueue::release() {
+    CORRADE_ASSERT(_mapped,
+        "FramebufferReadbackQueue::release(): no data to release", );
+
+    Slot& slot = oldest();
+    CORRADE_INTERNAL_ASSERT_OUTPUT(slot.image.buffer().unmap());
+    slot.fence.reset();
+
+    _mapped = false;
+    --_pendingCount;
+}
+
+}
+#endif
@@ -0,0 +1,178 @@
+#ifndef Magnum_FramebufferReadbackQueue_h
+#define Magnum_FramebufferReadbackQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::FramebufferReadbackQueue
+ */
+
+#include <memory>
+#include <vector>
+
+#include "Magnum/BufferImage.h"
+#include "Magnum/Fence.h"
+#include "Magnum/ImageReference.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+/**
+@brief Asynchronous framebuffer readback queue
+
+@ref AbstractFramebuffer::read(const Range2Di&, Image2D&) waits until all
+rendering is done and the pixels are transferred to client memory. This class
+instead reads the pixels into a ring of @ref BufferImage2D "buffer images",
+each guarded with a @ref Fence. The readback finishes asynchronously a few
+frames later and the data are then accessed by mapping the buffer, without
+any additional copy. Example usage for video capture:
+@code
+FramebufferReadbackQueue queue{ColorFormat::RGBA, ColorType::UnsignedByte};
+
+// each frame, after drawing
+if(!queue.read(defaultFramebuffer, defaultFramebuffer.viewport())) {
+    // all readbacks still pending, frame dropped
+}
+
+ImageReference2D image = queue.tryGet();
+if(image.data()) {
+    encoder.addFrame(image);
+    queue.release();
+}
+@endcode
+
+The frame count specifies how many readbacks can be in flight. If
+@extension{ARB,sync} is not available, the readback is considered completed
+when all other frames are in flight, which still avoids the stall in most
+cases.
+@requires_gles30 Pixel buffer objects are not available in OpenGL ES 2.0.
+@requires_webgl20 Buffer mapping is not available in WebGL.
+*/
+class MAGNUM_EXPORT FramebufferReadbackQueue {
+    public:
+        /**
+         * @brief Constructor
+         * @param format        Format of read pixel data
+         * @param type          Data type of read pixel data
+         * @param frameCount    Count of readbacks in flight
+         */
+        explicit FramebufferReadbackQueue(ColorFormat format, ColorType type, UnsignedInt frameCount = 3);
+
+        /**
+         * @brief Destructor
+         *
+         * Unmaps the data returned by @ref tryGet(), if not released yet.
+         */
+        ~FramebufferReadbackQueue();
+
+        /** @brief Copying is not allowed */
+        FramebufferReadbackQueue(const FramebufferReadbackQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        FramebufferReadbackQueue(FramebufferReadbackQueue&&) = delete;
+
+        /** @brief Copying is not allowed */
+        FramebufferReadbackQueue& operator=(const FramebufferReadbackQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        FramebufferReadbackQueue& operator=(FramebufferReadbackQueue&&) = delete;
+
+        /** @brief Count of readbacks in flight */
+        UnsignedInt frameCount() const { return _slots.size(); }
+
+        /**
+         * @brief Count of pending readbacks
+         *
+         * Including completed ones not yet retrieved using @ref tryGet() and
+         * @ref release().
+         */
+        UnsignedInt pendingCount() const { return _pendingCount; }
+
+        /**
+         * @brief Issue framebuffer readback
+         * @return `False` if all readbacks are pending, `true` otherwise
+         *
+         * Doesn't wait for the rendering to finish. The buffer is
+         * reallocated only if the rectangle size changes.
+         * @see @ref AbstractFramebuffer::read(const Range2Di&, BufferImage2D&, BufferUsage)
+         */
+        bool read(AbstractFramebuffer& framebuffer, const Range2Di& rectangle);
+
+        /**
+         * @brief Try to get oldest completed readback
+         *
+         * If the oldest readback is completed, maps its buffer and returns
+         * reference to the data, which is valid until @ref release() is
+         * called. Otherwise returns image with `nullptr` data. Never blocks.
+         * Expects that data returned by previous call were released.
+         * @see @ref Buffer::map(), @ref Fence::isSignaled()
+         */
+        ImageReference2D tryGet();
+
+        /**
+         * @brief Get oldest readback
+         *
+         * Like @ref tryGet(), but if the oldest readback is not completed
+         * yet, waits for it. Returns image with `nullptr` data only if there
+         * are no pending readbacks. Useful for draining the queue at the end
+         * of capture.
+         * @see @ref Fence::clientWait(), @ref Renderer::finish()
+         */
+        ImageReference2D get();
+
+        /**
+         * @brief Release data returned by @ref tryGet() or @ref get()
+         *
+         * Unmaps the buffer and makes the slot available for next
+         * @ref read().
+         * @see @ref Buffer::unmap()
+         */
+        void release();
+
+    private:
+        struct Slot {
+            explicit Slot(ColorFormat format, ColorType type): image{format, type} {}
+
+            BufferImage2D image;
+            std::unique_ptr<Fence> fence;
+        };
+
+        Slot& oldest() {
+            return _slots[(_next + _slots.size() - _pendingCount)%_slots.size()];
+        }
+
+        ImageReference2D map(Slot& slot);
+
+        std::vector<Slot> _slots;
+        UnsignedInt _next, _pendingCount;
+        bool _sync, _mapped;
+};
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -0,0 +1,215 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GeometryPool.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum {
+
+GeometryPool::Ranges::Ranges(const UnsignedInt capacity): capacity{capacity}, used{0} {
+    if(capacity) free_.emplace_back(0, capacity);
+}
+
+UnsignedInt GeometryPool::Ranges::allocate(const UnsignedInt size) {
+    if(!size) return 0;
+
+    /* First fit */
+    for(auto it = free_.begin(); it != free_.end(); ++it) {
+        if(it->second < size) continue;
+
+        const UnsignedInt offset = it->first;
+        if(it->second == size) free_.erase(it);
+        else {
+            it->first += size;
+            it->second -= size;
+        }
+
+        used += size;
+        return offset;
+    }
+
+    return ~UnsignedInt{};
+}
+
+void GeometryPool::Ranges::free(const UnsignedInt offset, const UnsignedInt size) {
+    if(!size) return;
+
+    auto next = std::lower_bound(free_.begin(), free_.end(), std::make_pair(offset, UnsignedInt{}));
+
+    /* Merge with the following range */
+    if(next != free_.end() && offset + size == next->first) {
+        next->first = offset;
+        next->second += size;
+    } else next = free_.emplace(next, offset, size);
+
+    /* Merge with the preceding range */
+    if(next != free_.begin()) {
+        auto previous = next - 1;
+        if(previous->first + previous->second == offset) {
+            previous->second += next->second;
+            free_.erase(next);
+        }
+    }
+
+    used -= size;
+}
+
+UnsignedInt GeometryPool::Ranges::largestFree() const {
+    UnsignedInt largest = 0;
+    for(const auto& range: free_) largest = std::max(largest, range.second);
+    return largest;
+}
+
+GeometryPool::GeometryPool(const GLsizei vertexStride, const UnsignedInt vertexCapacity, const Mesh::IndexType indexType, const UnsignedInt indexCapacity, const BufferUsage usage): _vertexBuffer{Buffer::TargetHint::Array}, _indexBuffer{Buffer::TargetHint::ElementArray}, _vertexStride{vertexStride}, _indexType{indexType}, _vertices{vertexCapacity}, _indices{indexCapacity} {
+    CORRADE_ASSERT(vertexStride && vertexCapacity, "GeometryPool::GeometryPool(): vertex stride and capacity must not be zero", );
+
+    _vertexBuffer.setData({nullptr, std::size_t(vertexStride)*vertexCapacity}, usage);
+    if(indexCapacity) {
+        _indexBuffer.setData({nullptr, Mesh::indexSize(indexType)*indexCapacity}, usage);
+        _mesh.setIndexBuffer(_indexBuffer, 0, indexType);
+    }
+}
+
+GeometryPool::~GeometryPool() = default;
+
+auto GeometryPool::allocate(const UnsignedInt vertexCount, const UnsignedInt indexCount) -> Handle {
+    CORRADE_ASSERT(!indexCount || _indices.capacity, "GeometryPool::allocate(): the pool is not indexed", invalidHandle);
+
+    /* Not enough space at all */
+    if(_vertices.capacity - _vertices.used < vertexCount || _indices.capacity - _indices.used < indexCount)
+        return invalidHandle;
+
+    /* Enough space, but fragmented */
+    if(_vertices.largestFree() < vertexCount || _indices.largestFree() < indexCount)
+        defragment();
+
+    Allocation allocation{_vertices.allocate(vertexCount), vertexCount, _indices.allocate(indexCount), indexCount};
+    CORRADE_INTERNAL_ASSERT(allocation.vertexOffset != ~UnsignedInt{} && allocation.indexOffset != ~UnsignedInt{});
+
+    /* Reuse a free handle, if any */
+    if(!_freeHandles.empty()) {
+        const Handle handle = _freeHandles.back();
+        _freeHandles.pop_back();
+        _allocations[handle] = allocation;
+        return handle;
+    }
+
+    _allocations.push_back(allocation);
+    return _allocations.size() - 1;
+}
+
+void GeometryPool::free(const Handle handle) {
+    CORRADE_ASSERT(handle < _allocations.size() && _allocations[handle].vertexOffset != ~UnsignedInt{},
+        "GeometryPool::free(): invalid handle" << handle, );
+
+    Allocation& allocation = _allocations[handle];
+    _vertices.free(allocation.vertexOffset, allocation.vertexCount);
+    _indices.free(allocation.indexOffset, allocation.indexCount);
+    allocation = {~UnsignedInt{}, 0, ~UnsignedInt{}, 0};
+    _freeHandles.push_back(handle);
+}
+
+auto GeometryPool::allocation(const Handle handle) const -> Allocation {
+    CORRADE_ASSERT(handle < _allocations.size() && _allocations[handle].vertexOffset != ~UnsignedInt{},
+        "GeometryPool::allocation(): invalid handle" << handle, {});
+    return _allocations[handle];
+}
+
+GeometryPool& GeometryPool::setVertexData(const Handle handle, const Containers::ArrayReference<const void> data) {
+    const Allocation a = allocation(handle);
+    CORRADE_ASSERT(data.size() <= std::size_t(_vertexStride)*a.vertexCount,
+        "GeometryPool::setVertexData(): expected at most" << std::size_t(_vertexStride)*a.vertexCount << "bytes but got" << data.size(), *this);
+    _vertexBuffer.setSubData(GLintptr(_vertexStride)*a.vertexOffset, data);
+    return *this;
+}
+
+GeometryPool& GeometryPool::setIndexData(const Handle handle, const Containers::ArrayReference<const void> data) {
+    const Allocation a = allocation(handle);
+    const std::size_t indexSize = Mesh::indexSize(_indexType);
+    CORRADE_ASSERT(data.size() <= indexSize*a.indexCount,
+        "GeometryPool::setIndexData(): expected at most" << indexSize*a.indexCount << "bytes but got" << data.size(), *this);
+    _indexBuffer.setSubData(indexSize*a.indexOffset, data);
+    return *this;
+}
+
+MeshView& GeometryPool::setupView(const Handle handle, MeshView& view) const {
+    const Allocation a = allocation(handle);
+    view.setBaseVertex(a.vertexOffset);
+    if(_indices.capacity) view.setCount(a.indexCount)
+        .setIndexRange(a.indexOffset, 0, a.vertexCount ? a.vertexCount - 1 : 0);
+    else view.setCount(a.vertexCount);
+    return view;
+}
+
+void GeometryPool::draw(const Handle handle, AbstractShaderProgram& shader) {
+    MeshView view{_mesh};
+    setupView(handle, view).draw(shader);
+}
+
+void GeometryPool::defragment() {
+    compact(_vertexBuffer, _vertices, _vertexStride, _allocations, &Allocation::vertexOffset, &Allocation::vertexCount);
+    if(_indices.capacity)
+        compact(_indexBuffer, _indices, Mesh::indexSize(_indexType), _allocations, &Allocation::indexOffset, &Allocation::indexCount);
+}
+
+void GeometryPool::compact(Buffer& buffer, Ranges& ranges, const std::size_t elementSize, std::vector<Allocation>& allocations, UnsignedInt Allocation::*const offset, UnsignedInt Allocation::*const count) {
+    /* Already compact */
+    if(ranges.free_.empty() || (ranges.free_.size() == 1 && ranges.free_.front().first + ranges.free_.front().second == ranges.capacity))
+        return;
+
+    /* Live allocations ordered by offset */
+    std::vector<std::size_t> order;
+    for(std::size_t i = 0; i != allocations.size(); ++i)
+        if(allocations[i].vertexOffset != ~UnsignedInt{} && allocations[i].*count)
+            order.push_back(i);
+    std::sort(order.begin(), order.end(), [&allocations, offset](std::size_t a, std::size_t b) {
+        return allocations[a].*offset < allocations[b].*offset;
+    });
+
+    /* Copying within one buffer with overlapping ranges is not allowed, so
+       pack the data into a temporary buffer and copy them back in one go.
+       The buffer keeps its ID, so the mesh doesn't need to be updated. */
+    Buffer temporary;
+    temporary.setData({nullptr, elementSize*ranges.used}, BufferUsage::StreamCopy);
+    UnsignedInt packed = 0;
+    for(const std::size_t i: order) {
+        Allocation& a = allocations[i];
+        Buffer::copy(buffer, temporary, elementSize*(a.*offset), elementSize*packed, elementSize*(a.*count));
+        a.*offset = packed;
+        packed += a.*count;
+    }
+    if(packed) Buffer::copy(temporary, buffer, 0, 0, elementSize*packed);
+
+    /* Empty allocations stay at the beginning */
+    for(Allocation& a: allocations)
+        if(a.vertexOffset != ~UnsignedInt{} && !(a.*count)) a.*offset = 0;
+
+    ranges.free_.clear();
+    if(packed != ranges.capacity) ranges.free_.emplace_back(packed, ranges.capacity - packed);
+}
+
+}
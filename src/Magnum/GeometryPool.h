@@ -0,0 +1,294 @@
+#ifndef Magnum_GeometryPool_h
+#define Magnum_GeometryPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::GeometryPool
+ */
+
+#include <utility>
+#include <vector>
+#include <Corrade/Containers/ArrayReference.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshView.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+/**
+@brief Pool of geometry sharing one vertex and index buffer
+
+Instead of having a separate @ref Buffer pair for each small dynamic mesh
+(terrain patches, UI elements...), the pool allocates one vertex and one
+index buffer of fixed capacity and hands out ranges of them. All ranges share
+one @ref Mesh with the vertex layout set up by the user and each range is
+drawn through a @ref MeshView with appropriate base vertex and index offset
+(see @ref draw() and @ref setupView()),
+so there are no buffer or VAO binding changes between them. Example usage:
+@code
+GeometryPool pool{sizeof(Vector3)*2, 65536, Mesh::IndexType::UnsignedShort, 196608};
+pool.mesh().setPrimitive(MeshPrimitive::Triangles)
+    .addVertexBuffer(pool.vertexBuffer(), 0, Shaders::Phong::Position{}, Shaders::Phong::Normal{});
+
+// create a patch
+GeometryPool::Handle patch = pool.allocate(vertices.size(), indices.size());
+pool.setVertexData(patch, vertices)
+    .setIndexData(patch, indices);
+
+// draw it
+pool.draw(patch, shader);
+
+// destroy it
+pool.free(patch);
+@endcode
+
+The vertex data of all ranges must have the same layout and the indices are
+relative to the range beginning. Indices of non-indexed pools (created with
+zero index capacity) are ignored.
+
+## Sub-allocation and defragmentation
+
+Free space in both buffers is tracked with a sorted free list, allocation
+takes the first range that's large enough and freed ranges are merged with
+their neighbors. If there is enough free space for an allocation, but it is
+too fragmented, @ref allocate() calls @ref defragment(), which moves all
+ranges to the beginning of the buffers using @ref Buffer::copy() through a
+temporary buffer. The buffer IDs don't change, so the mesh doesn't need to be
+set up again, only offsets of the ranges are changed. Handles stay valid, but
+views set up with @ref setupView() before must be set up again.
+@requires_gl31 Extension @extension{ARB,copy_buffer}
+@requires_gl32 Extension @extension{ARB,draw_elements_base_vertex} for
+    indexed pools
+@requires_gles30 Buffer copying is not available in OpenGL ES 2.0.
+@requires_gl Base vertex for indexed meshes is not available in OpenGL ES,
+    only non-indexed pools can be used there.
+*/
+class MAGNUM_EXPORT GeometryPool {
+    public:
+        /**
+         * @brief Handle
+         *
+         * @see @ref allocate(), @ref invalidHandle
+         */
+        typedef UnsignedInt Handle;
+
+        /**
+         * @brief Invalid handle
+         *
+         * Returned from @ref allocate() if there is not enough space.
+         */
+        static const Handle invalidHandle = ~Handle{};
+
+        /**
+         * @brief Allocated range
+         *
+         * @see @ref allocation()
+         */
+        struct Allocation {
+            /** @brief Offset of first vertex in the vertex buffer */
+            UnsignedInt vertexOffset;
+
+            /** @brief Vertex count */
+            UnsignedInt vertexCount;
+
+            /** @brief Offset of first index in the index buffer */
+            UnsignedInt indexOffset;
+
+            /** @brief Index count */
+            UnsignedInt indexCount;
+        };
+
+        /**
+         * @brief Constructor
+         * @param vertexStride      Size of one vertex in bytes
+         * @param vertexCapacity    Count of vertices in the pool
+         * @param indexType         Index type
+         * @param indexCapacity     Count of indices in the pool. If zero, the
+         *      pool is not indexed.
+         * @param usage             Buffer usage
+         *
+         * Allocates both buffers and sets up the index buffer of
+         * @ref mesh(). Vertex attributes are left for the user to specify.
+         */
+        explicit GeometryPool(GLsizei vertexStride, UnsignedInt vertexCapacity, Mesh::IndexType indexType = Mesh::IndexType::UnsignedInt, UnsignedInt indexCapacity = 0, BufferUsage usage = BufferUsage::DynamicDraw);
+
+        /** @brief Copying is not allowed */
+        GeometryPool(const GeometryPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        GeometryPool(GeometryPool&&) = delete;
+
+        ~GeometryPool();
+
+        /** @brief Copying is not allowed */
+        GeometryPool& operator=(const GeometryPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        GeometryPool& operator=(GeometryPool&&) = delete;
+
+        /** @brief Vertex buffer */
+        Buffer& vertexBuffer() { return _vertexBuffer; }
+
+        /** @brief Index buffer */
+        Buffer& indexBuffer() { return _indexBuffer; }
+
+        /**
+         * @brief Shared mesh
+         *
+         * Set vertex attributes of the pool on it using
+         * @ref Mesh::addVertexBuffer() with @ref vertexBuffer() and zero
+         * offset.
+         */
+        Mesh& mesh() { return _mesh; }
+
+        /** @brief Size of one vertex in bytes */
+        GLsizei vertexStride() const { return _vertexStride; }
+
+        /** @brief Vertex capacity */
+        UnsignedInt vertexCapacity() const { return _vertices.capacity; }
+
+        /** @brief Index capacity */
+        UnsignedInt indexCapacity() const { return _indices.capacity; }
+
+        /** @brief Count of allocated vertices */
+        UnsignedInt vertexCount() const { return _vertices.used; }
+
+        /** @brief Count of allocated indices */
+        UnsignedInt indexCount() const { return _indices.used; }
+
+        /** @brief Count of live allocations */
+        std::size_t allocationCount() const {
+            return _allocations.size() - _freeHandles.size();
+        }
+
+        /**
+         * @brief Allocate a range
+         *
+         * Returns @ref invalidHandle if there's not enough free space in the
+         * pool. If there is enough space, but it is fragmented,
+         * @ref defragment() is called first.
+         */
+        Handle allocate(UnsignedInt vertexCount, UnsignedInt indexCount = 0);
+
+        /**
+         * @brief Free a range
+         *
+         * The handle can be reused by subsequent allocations.
+         */
+        void free(Handle handle);
+
+        /** @brief Allocated range */
+        Allocation allocation(Handle handle) const;
+
+        /**
+         * @brief Set vertex data
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the data fit into the allocated range.
+         * @see @ref Buffer::setSubData()
+         */
+        GeometryPool& setVertexData(Handle handle, Containers::ArrayReference<const void> data);
+
+        /** @overload */
+        template<class T> GeometryPool& setVertexData(Handle handle, const std::vector<T>& data) {
+            return setVertexData(handle, {data.data(), data.size()});
+        }
+
+        /**
+         * @brief Set index data
+         * @return Reference to self (for method chaining)
+         *
+         * The indices are relative to the beginning of the vertex range.
+         * Expects that the pool is indexed and the data fit into the
+         * allocated range.
+         * @see @ref Buffer::setSubData()
+         */
+        GeometryPool& setIndexData(Handle handle, Containers::ArrayReference<const void> data);
+
+        /** @overload */
+        template<class T> GeometryPool& setIndexData(Handle handle, const std::vector<T>& data) {
+            return setIndexData(handle, {data.data(), data.size()});
+        }
+
+        /**
+         * @brief Set up a view on given range
+         *
+         * Expects that @p view was created from @ref mesh(). The view is
+         * valid until next call to @ref defragment(). Useful for
+         * @ref MeshView::draw(AbstractShaderProgram&, Containers::ArrayReference<const std::reference_wrapper<MeshView>>) "multi-draw".
+         */
+        MeshView& setupView(Handle handle, MeshView& view) const;
+
+        /**
+         * @brief Draw given range
+         *
+         * @see @ref setupView(), @ref MeshView::draw()
+         */
+        void draw(Handle handle, AbstractShaderProgram& shader);
+
+        /**
+         * @brief Defragment the pool
+         *
+         * Moves all allocated ranges to the beginning of the buffers, so the
+         * free space is contiguous. Does nothing if the pool is already
+         * compact. Called implicitly from @ref allocate() if needed.
+         * @see @ref Buffer::copy()
+         */
+        void defragment();
+
+    private:
+        struct MAGNUM_LOCAL Ranges {
+            explicit Ranges(UnsignedInt capacity);
+
+            UnsignedInt allocate(UnsignedInt size);
+            void free(UnsignedInt offset, UnsignedInt size);
+            UnsignedInt largestFree() const;
+
+            UnsignedInt capacity, used;
+
+            /* Sorted by offset, neighboring ranges are always merged */
+            std::vector<std::pair<UnsignedInt, UnsignedInt>> free_;
+        };
+
+        MAGNUM_LOCAL static void compact(Buffer& buffer, Ranges& ranges, std::size_t elementSize, std::vector<Allocation>& allocations, UnsignedInt Allocation::*offset, UnsignedInt Allocation::*count);
+
+        Buffer _vertexBuffer, _indexBuffer;
+        Mesh _mesh;
+        GLsizei _vertexStride;
+        Mesh::IndexType _indexType;
+        Ranges _vertices, _indices;
+        std::vector<Allocation> _allocations;
+        std::vector<Handle> _freeHandles;
+};
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -28,11 +28,16 @@
 namespace Magnum {
 
 template<UnsignedInt dimensions> void Image<dimensions>::setData(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, void* data) {
-    delete[] _data;
+    setData(format, type, size, data, nullptr);
+}
+
+template<UnsignedInt dimensions> void Image<dimensions>::setData(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, void* data, ImageDeleter deleter) {
+    deleteData();
     _format = format;
     _type = type;
     _size = size;
     _data = reinterpret_cast<char*>(data);
+    _deleter = deleter;
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -54,7 +54,20 @@ template<UnsignedInt dimensions> class Image: public AbstractImage {
          * Note that the image data are not copied on construction, but they
          * are deleted on class destruction.
          */
-        explicit Image(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, void* data): AbstractImage{format, type}, _size{size}, _data{reinterpret_cast<char*>(data)} {}
+        explicit Image(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, void* data): AbstractImage{format, type}, _size{size}, _data{reinterpret_cast<char*>(data)}, _deleter{} {}
+
+        /**
+         * @brief Construct with custom deleter
+         * @param format            Format of pixel data
+         * @param type              Data type of pixel data
+         * @param size              Image size
+         * @param data              Image data
+         * @param deleter           Data deleter
+         *
+         * The data are not copied on construction, on destruction they are
+         * passed to @p deleter instead of being deleted using `delete[]`.
+         */
+        explicit Image(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, void* data, ImageDeleter deleter): AbstractImage{format, type}, _size{size}, _data{reinterpret_cast<char*>(data)}, _deleter{deleter} {}
 
         /**
          * @brief Constructor
@@ -64,7 +77,7 @@ template<UnsignedInt dimensions> class Image: public AbstractImage {
          * Dimensions are set to zero and data pointer to `nullptr`, call
          * @ref setData() to fill the image with data.
          */
-        /*implicit*/ Image(ColorFormat format, ColorType type): AbstractImage(format, type), _data{} {}
+        /*implicit*/ Image(ColorFormat format, ColorType type): AbstractImage(format, type), _data{}, _deleter{} {}
 
         /** @brief Copying is not allowed */
         Image(const Image<dimensions>&) = delete;
@@ -79,7 +92,7 @@ template<UnsignedInt dimensions> class Image: public AbstractImage {
         Image<dimensions>& operator=(Image<dimensions>&& other) noexcept;
 
         /** @brief Destructor */
-        ~Image() { delete[] _data; }
+        ~Image() { deleteData(); }
 
         /** @brief Conversion to reference */
         /*implicit*/ operator ImageReference<dimensions>()
@@ -135,6 +148,15 @@ template<UnsignedInt dimensions> class Image: public AbstractImage {
          */
         void setData(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, void* data);
 
+        /**
+         * @brief Set image data with custom deleter
+         *
+         * Like @ref setData(ColorFormat, ColorType, const VectorTypeFor<dimensions, Int>&, void*),
+         * but the data are passed to @p deleter on destruction instead of
+         * being deleted using `delete[]`.
+         */
+        void setData(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, void* data, ImageDeleter deleter);
+
         /**
          * @brief Release data storage
          *
@@ -144,9 +166,24 @@ template<UnsignedInt dimensions> class Image: public AbstractImage {
          */
         char* release();
 
+        /**
+         * @brief Data deleter
+         *
+         * If `nullptr`, the data are deleted using `delete[]`. If the data
+         * are going to be taken over using @ref release(), query the deleter
+         * first and free the data using it afterwards.
+         */
+        ImageDeleter deleter() const { return _deleter; }
+
     private:
+        void deleteData() {
+            if(_deleter) _deleter(_data, dataSize(_size));
+            else delete[] _data;
+        }
+
         Math::Vector<Dimensions, Int> _size;
         char* _data;
+        ImageDeleter _deleter;
 };
 
 /** @brief One-dimensional image */
@@ -158,9 +195,10 @@ typedef Image<2> Image2D;
 /** @brief Three-dimensional image */
 typedef Image<3> Image3D;
 
-template<UnsignedInt dimensions> inline Image<dimensions>::Image(Image<dimensions>&& other) noexcept: AbstractImage(std::move(other)), _size(std::move(other._size)), _data(std::move(other._data)) {
+template<UnsignedInt dimensions> inline Image<dimensions>::Image(Image<dimensions>&& other) noexcept: AbstractImage(std::move(other)), _size(std::move(other._size)), _data(std::move(other._data)), _deleter(other._deleter) {
     other._size = {};
     other._data = nullptr;
+    other._deleter = nullptr;
 }
 
 template<UnsignedInt dimensions> inline Image<dimensions>& Image<dimensions>::operator=(Image<dimensions>&& other) noexcept {
@@ -168,6 +206,7 @@ template<UnsignedInt dimensions> inline Image<dimensions>& Image<dimensions>::op
     using std::swap;
     swap(_size, other._size);
     swap(_data, other._data);
+    swap(_deleter, other._deleter);
     return *this;
 }
 
@@ -186,6 +225,7 @@ template<UnsignedInt dimensions> inline char* Image<dimensions>::release() {
     char* const data = _data;
     _size = {};
     _data = nullptr;
+    _deleter = nullptr;
     return data;
 }
 
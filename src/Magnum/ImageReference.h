@@ -26,9 +26,11 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::ImageReference, typedef @ref Magnum::ImageReference1D, @ref Magnum::ImageReference2D, @ref Magnum::ImageReference3D
+ * @brief Class @ref Magnum::ImageReference, @ref Magnum::CompressedImageReference, typedef @ref Magnum::ImageReference1D, @ref Magnum::ImageReference2D, @ref Magnum::ImageReference3D, @ref Magnum::CompressedImageReference1D, @ref Magnum::CompressedImageReference2D, @ref Magnum::CompressedImageReference3D
  */
 
+#include <Corrade/Containers/ArrayReference.h>
+
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/AbstractImage.h"
 #include "Magnum/DimensionTraits.h"
@@ -47,6 +49,10 @@ targeted for wrapping data which are either stored in stack/constant memory
 same properties for each frame, such as video stream. Thus it is not possible
 to change image properties, only data pointer.
 
+Pixel layout is described by @ref PixelStorage, which makes it possible to
+reference a sub-rectangle of a larger image or rows with padding without
+copying the data.
+
 Interchangeable with @ref Image, @ref BufferImage or @ref Trade::ImageData.
 @see @ref ImageReference1D, @ref ImageReference2D, @ref ImageReference3D
 */
@@ -63,6 +69,20 @@ template<UnsignedInt dimensions> class ImageReference: public AbstractImage {
          */
         constexpr explicit ImageReference(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, const void* data): AbstractImage(format, type), _size(size), _data(reinterpret_cast<const char*>(data)) {}
 
+        /**
+         * @brief Construct with custom pixel storage
+         * @param storage           Pixel storage parameters
+         * @param format            Format of pixel data
+         * @param type              Data type of pixel data
+         * @param size              Image size
+         * @param data              Image data
+         *
+         * The @p data point to the beginning of the whole memory described
+         * by @p storage, not to the first pixel of the image, see
+         * @ref PixelStorage for an example.
+         */
+        constexpr explicit ImageReference(const PixelStorage& storage, ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, const void* data): AbstractImage(storage, format, type), _size(size), _data(reinterpret_cast<const char*>(data)) {}
+
         /**
          * @brief Constructor
          * @param format            Format of pixel data
@@ -74,6 +94,18 @@ template<UnsignedInt dimensions> class ImageReference: public AbstractImage {
          */
         constexpr explicit ImageReference(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size): AbstractImage(format, type), _size(size), _data(nullptr) {}
 
+        /**
+         * @brief Construct with custom pixel storage and without data
+         * @param storage           Pixel storage parameters
+         * @param format            Format of pixel data
+         * @param type              Data type of pixel data
+         * @param size              Image size
+         *
+         * Data pointer is set to `nullptr`, call @ref setData() to fill the
+         * image with data.
+         */
+        constexpr explicit ImageReference(const PixelStorage& storage, ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size): AbstractImage(storage, format, type), _size(size), _data(nullptr) {}
+
         /** @brief Image size */
         constexpr VectorTypeFor<dimensions, Int> size() const { return _size; }
 
@@ -116,6 +148,75 @@ typedef ImageReference<2> ImageReference2D;
 /** @brief Three-dimensional image wrapper */
 typedef ImageReference<3> ImageReference3D;
 
+/**
+@brief Compressed image reference
+
+Adds information about dimensions and compression format to block-compressed
+data in memory. Similarly to @ref ImageReference, this class doesn't delete the
+data on destruction. The data are passed to OpenGL as-is, their size is thus
+expected to match the format and image size.
+
+Interchangeable with @ref Trade::CompressedImageData.
+@see @ref CompressedImageReference1D, @ref CompressedImageReference2D,
+    @ref CompressedImageReference3D, @ref Texture::setCompressedImage()
+*/
+template<UnsignedInt dimensions> class CompressedImageReference {
+    public:
+        const static UnsignedInt Dimensions = dimensions; /**< @brief Image dimension count */
+
+        /**
+         * @brief Constructor
+         * @param format            Format of compressed data
+         * @param size              Image size
+         * @param data              Image data
+         */
+        explicit CompressedImageReference(CompressedColorFormat format, const VectorTypeFor<dimensions, Int>& size, Containers::ArrayReference<const char> data): _format{format}, _size{size}, _data{data} {}
+
+        /**
+         * @brief Constructor
+         * @param format            Format of compressed data
+         * @param size              Image size
+         *
+         * Data are set to empty, call @ref setData() to fill the image with
+         * data.
+         */
+        explicit CompressedImageReference(CompressedColorFormat format, const VectorTypeFor<dimensions, Int>& size): _format{format}, _size{size} {}
+
+        /** @brief Format of compressed data */
+        CompressedColorFormat format() const { return _format; }
+
+        /** @brief Image size */
+        VectorTypeFor<dimensions, Int> size() const { return _size; }
+
+        /** @brief Raw data */
+        Containers::ArrayReference<const char> data() const { return _data; }
+
+        /**
+         * @brief Set image data
+         * @param data              Image data
+         *
+         * Dimensions and format remain the same as passed in constructor. The
+         * data are not copied nor deleted on destruction.
+         */
+        void setData(Containers::ArrayReference<const char> data) {
+            _data = data;
+        }
+
+    private:
+        CompressedColorFormat _format;
+        Math::Vector<Dimensions, Int> _size;
+        Containers::ArrayReference<const char> _data;
+};
+
+/** @brief One-dimensional compressed image wrapper */
+typedef CompressedImageReference<1> CompressedImageReference1D;
+
+/** @brief Two-dimensional compressed image wrapper */
+typedef CompressedImageReference<2> CompressedImageReference2D;
+
+/** @brief Three-dimensional compressed image wrapper */
+typedef CompressedImageReference<3> CompressedImageReference3D;
+
 }
 
 #endif
@@ -78,7 +78,7 @@ std::size_t BufferState::indexForTarget(Buffer::TargetHint target) {
     CORRADE_ASSERT_UNREACHABLE();
 }
 
-BufferState::BufferState(Context& context, std::vector<std::string>& extensions): bindings()
+BufferState::BufferState(Context& context, std::vector<const char*>& extensions): bindings()
     #ifndef MAGNUM_TARGET_GLES2
     #ifndef MAGNUM_TARGET_GLES
     , minMapAlignment(0)
@@ -106,6 +106,7 @@ BufferState::BufferState(Context& context, std::vector<std::string>& extensions)
         getParameterImplementation = &Buffer::getParameterImplementationDSA;
         getSubDataImplementation = &Buffer::getSubDataImplementationDSA;
         dataImplementation = &Buffer::dataImplementationDSA;
+        storageImplementation = &Buffer::storageImplementationDSA;
         subDataImplementation = &Buffer::subDataImplementationDSA;
         mapImplementation = &Buffer::mapImplementationDSA;
         mapRangeImplementation = &Buffer::mapRangeImplementationDSA;
@@ -118,6 +119,7 @@ BufferState::BufferState(Context& context, std::vector<std::string>& extensions)
         getParameterImplementation = &Buffer::getParameterImplementationDSAEXT;
         getSubDataImplementation = &Buffer::getSubDataImplementationDSAEXT;
         dataImplementation = &Buffer::dataImplementationDSAEXT;
+        storageImplementation = &Buffer::storageImplementationDSAEXT;
         subDataImplementation = &Buffer::subDataImplementationDSAEXT;
         mapImplementation = &Buffer::mapImplementationDSAEXT;
         mapRangeImplementation = &Buffer::mapRangeImplementationDSAEXT;
@@ -134,6 +136,9 @@ BufferState::BufferState(Context& context, std::vector<std::string>& extensions)
         getSubDataImplementation = &Buffer::getSubDataImplementationDefault;
         #endif
         dataImplementation = &Buffer::dataImplementationDefault;
+        #ifndef MAGNUM_TARGET_GLES
+        storageImplementation = &Buffer::storageImplementationDefault;
+        #endif
         subDataImplementation = &Buffer::subDataImplementationDefault;
         mapImplementation = &Buffer::mapImplementationDefault;
         mapRangeImplementation = &Buffer::mapRangeImplementationDefault;
@@ -42,7 +42,7 @@ struct BufferState {
     static std::size_t indexForTarget(Buffer::TargetHint target);
     static const Buffer::TargetHint targetForIndex[TargetCount-1];
 
-    explicit BufferState(Context& context, std::vector<std::string>& extensions);
+    explicit BufferState(Context& context, std::vector<const char*>& extensions);
 
     void reset();
 
@@ -57,6 +57,9 @@ struct BufferState {
     void(Buffer::*getSubDataImplementation)(GLintptr, GLsizeiptr, GLvoid*);
     #endif
     void(Buffer::*dataImplementation)(GLsizeiptr, const GLvoid*, BufferUsage);
+    #ifndef MAGNUM_TARGET_GLES
+    void(Buffer::*storageImplementation)(GLsizeiptr, const GLvoid*, Buffer::StorageFlags);
+    #endif
     void(Buffer::*subDataImplementation)(GLintptr, GLsizeiptr, const GLvoid*);
     void(Buffer::*invalidateImplementation)();
     void(Buffer::*invalidateSubImplementation)(GLintptr, GLsizeiptr);
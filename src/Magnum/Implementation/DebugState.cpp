@@ -31,12 +31,13 @@
 
 namespace Magnum { namespace Implementation {
 
-DebugState::DebugState(Context& context, std::vector<std::string>& extensions):
+DebugState::DebugState(Context& context, std::vector<const char*>& extensions):
     maxLabelLength{0},
     maxLoggedMessages{0},
     maxMessageLength{0},
     maxStackDepth{0},
-    messageCallback(nullptr)
+    messageCallback(nullptr),
+    messageQueue(nullptr)
 {
     if(context.isExtensionSupported<Extensions::GL::KHR::debug>()) {
         extensions.push_back(Extensions::GL::KHR::debug::string());
@@ -33,7 +33,7 @@
 namespace Magnum { namespace Implementation {
 
 struct DebugState {
-    explicit DebugState(Context& context, std::vector<std::string>& extensions);
+    explicit DebugState(Context& context, std::vector<const char*>& extensions);
 
     std::string(*getLabelImplementation)(GLenum, GLuint);
     void(*labelImplementation)(GLenum, GLuint, Containers::ArrayReference<const char>);
@@ -46,6 +46,7 @@ struct DebugState {
 
     GLint maxLabelLength, maxLoggedMessages, maxMessageLength, maxStackDepth;
     DebugOutput::Callback messageCallback;
+    DebugOutputQueue* messageQueue;
 };
 
 }}
@@ -0,0 +1,72 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DeletionState.h"
+
+namespace Magnum { namespace Implementation {
+
+bool DeletionState::defer(DeletionState* const queue, std::vector<GLuint> DeletionState::* const names, const GLuint id) {
+    if(!enabled) return false;
+
+    std::lock_guard<std::mutex> lock{queue->mutex};
+    (queue->*names).push_back(id);
+    return true;
+}
+
+std::size_t DeletionState::count() {
+    std::lock_guard<std::mutex> lock{mutex};
+    return buffers.size() + textures.size() + renderbuffers.size() + framebuffers.size() + vertexArrays.size();
+}
+
+void DeletionState::flush() {
+    /* Take the names out so other threads aren't blocked by the GL calls */
+    std::vector<GLuint> deletedBuffers, deletedTextures, deletedRenderbuffers, deletedFramebuffers, deletedVertexArrays;
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        std::swap(deletedBuffers, buffers);
+        std::swap(deletedTextures, textures);
+        std::swap(deletedRenderbuffers, renderbuffers);
+        std::swap(deletedFramebuffers, framebuffers);
+        std::swap(deletedVertexArrays, vertexArrays);
+    }
+
+    if(!deletedBuffers.empty())
+        glDeleteBuffers(deletedBuffers.size(), deletedBuffers.data());
+    if(!deletedTextures.empty())
+        glDeleteTextures(deletedTextures.size(), deletedTextures.data());
+    if(!deletedRenderbuffers.empty())
+        glDeleteRenderbuffers(deletedRenderbuffers.size(), deletedRenderbuffers.data());
+    if(!deletedFramebuffers.empty())
+        glDeleteFramebuffers(deletedFramebuffers.size(), deletedFramebuffers.data());
+    if(!deletedVertexArrays.empty()) {
+        #ifndef MAGNUM_TARGET_GLES2
+        glDeleteVertexArrays(deletedVertexArrays.size(), deletedVertexArrays.data());
+        #elif !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+        glDeleteVertexArraysOES(deletedVertexArrays.size(), deletedVertexArrays.data());
+        #endif
+    }
+}
+
+}}
@@ -0,0 +1,71 @@
+#ifndef Magnum_Implementation_DeletionState_h
+#define Magnum_Implementation_DeletionState_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <mutex>
+#include <vector>
+
+#include "Magnum/OpenGL.h"
+#include "Magnum/Types.h"
+#include "Magnum/configure.h"
+
+namespace Magnum { namespace Implementation {
+
+struct DeletionState {
+    explicit DeletionState(): enabled{false}, shared{this} {}
+
+    /* Returns false if deferred deletion is disabled and the caller should
+       delete the object immediately. Names of buffers, textures and
+       renderbuffers are valid in all sharing contexts so they go to the
+       shared queue, container objects stay in the local one. */
+    bool deferBuffer(GLuint id) { return defer(shared, &DeletionState::buffers, id); }
+    bool deferTexture(GLuint id) { return defer(shared, &DeletionState::textures, id); }
+    bool deferRenderbuffer(GLuint id) { return defer(shared, &DeletionState::renderbuffers, id); }
+    bool deferFramebuffer(GLuint id) { return defer(this, &DeletionState::framebuffers, id); }
+    bool deferVertexArray(GLuint id) { return defer(this, &DeletionState::vertexArrays, id); }
+
+    std::size_t count();
+
+    /* Must be called with the owning context current */
+    void flush();
+
+    bool enabled;
+    DeletionState* shared;
+
+    std::mutex mutex;
+    std::vector<GLuint> buffers,
+        textures,
+        renderbuffers,
+        framebuffers,
+        vertexArrays;
+
+    private:
+        bool defer(DeletionState* queue, std::vector<GLuint> DeletionState::*names, GLuint id);
+};
+
+}}
+
+#endif
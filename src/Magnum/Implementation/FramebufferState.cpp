@@ -35,7 +35,7 @@ namespace Magnum { namespace Implementation {
 
 constexpr const Range2Di FramebufferState::DisengagedViewport;
 
-FramebufferState::FramebufferState(Context& context, std::vector<std::string>& extensions): readBinding{0}, drawBinding{0}, renderbufferBinding{0}, maxDrawBuffers{0}, maxColorAttachments{0}, maxRenderbufferSize{0}, maxSamples{0},
+FramebufferState::FramebufferState(Context& context, std::vector<const char*>& extensions): readBinding{0}, drawBinding{0}, renderbufferBinding{0}, maxDrawBuffers{0}, maxColorAttachments{0}, maxRenderbufferSize{0}, maxSamples{0},
     #ifndef MAGNUM_TARGET_GLES
     maxDualSourceDrawBuffers{0},
     #endif
@@ -69,6 +69,7 @@ FramebufferState::FramebufferState(Context& context, std::vector<std::string>& e
         texture1DImplementation = &Framebuffer::texture1DImplementationDSA;
         texture2DImplementation = &Framebuffer::texture2DImplementationDSA;
         textureLayerImplementation = &Framebuffer::textureLayerImplementationDSA;
+        layeredTextureImplementation = &Framebuffer::layeredTextureImplementationDSA;
 
         renderbufferStorageImplementation = &Renderbuffer::storageImplementationDSA;
 
@@ -84,6 +85,7 @@ FramebufferState::FramebufferState(Context& context, std::vector<std::string>& e
         texture1DImplementation = &Framebuffer::texture1DImplementationDSAEXT;
         texture2DImplementation = &Framebuffer::texture2DImplementationDSAEXT;
         textureLayerImplementation = &Framebuffer::textureLayerImplementationDSAEXT;
+        layeredTextureImplementation = &Framebuffer::layeredTextureImplementationDSAEXT;
 
         renderbufferStorageImplementation = &Renderbuffer::storageImplementationDSAEXT;
     } else
@@ -100,6 +102,9 @@ FramebufferState::FramebufferState(Context& context, std::vector<std::string>& e
         #endif
         texture2DImplementation = &Framebuffer::texture2DImplementationDefault;
         textureLayerImplementation = &Framebuffer::textureLayerImplementationDefault;
+        #ifndef MAGNUM_TARGET_GLES
+        layeredTextureImplementation = &Framebuffer::layeredTextureImplementationDefault;
+        #endif
 
         renderbufferStorageImplementation = &Renderbuffer::storageImplementationDefault;
     }
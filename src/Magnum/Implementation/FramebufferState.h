@@ -35,7 +35,7 @@ namespace Magnum { namespace Implementation {
 struct FramebufferState {
     constexpr static const Range2Di DisengagedViewport{{}, {-1, -1}};
 
-    explicit FramebufferState(Context& context, std::vector<std::string>& extensions);
+    explicit FramebufferState(Context& context, std::vector<const char*>& extensions);
 
     void reset();
 
@@ -56,6 +56,9 @@ struct FramebufferState {
     #endif
     void(Framebuffer::*texture2DImplementation)(Framebuffer::BufferAttachment, GLenum, GLuint, GLint);
     void(Framebuffer::*textureLayerImplementation)(Framebuffer::BufferAttachment, GLuint, GLint, GLint);
+    #ifndef MAGNUM_TARGET_GLES
+    void(Framebuffer::*layeredTextureImplementation)(Framebuffer::BufferAttachment, GLuint, GLint);
+    #endif
 
     void(Renderbuffer::*createRenderbufferImplementation)();
     void(Renderbuffer::*renderbufferStorageImplementation)(RenderbufferFormat, const Vector2i&);
@@ -0,0 +1,284 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MemoryState.h"
+
+#include <Corrade/Containers/ArrayReference.h>
+
+#include "Magnum/Extensions.h"
+#include "Magnum/Math/Vector3.h"
+
+#ifndef MAGNUM_TARGET_GLES
+/* Not in the OpenGL headers */
+#ifndef GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX
+#define GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX 0x9047
+#endif
+#ifndef GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX
+#define GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX 0x9049
+#endif
+#ifndef GL_TEXTURE_FREE_MEMORY_ATI
+#define GL_TEXTURE_FREE_MEMORY_ATI 0x87FC
+#endif
+#endif
+
+namespace Magnum { namespace Implementation {
+
+namespace {
+    Long memoryImplementationNone() { return -1; }
+
+    #ifndef MAGNUM_TARGET_GLES
+    /* The extensions report the sizes in kB */
+    Long availableMemoryImplementationNvx() {
+        GLint value;
+        glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &value);
+        return Long(value)*1024;
+    }
+
+    Long totalMemoryImplementationNvx() {
+        GLint value;
+        glGetIntegerv(GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX, &value);
+        return Long(value)*1024;
+    }
+
+    Long availableMemoryImplementationAti() {
+        /* Total free memory in the pool, largest free block, total and
+           largest free auxiliary memory */
+        GLint values[4];
+        glGetIntegerv(GL_TEXTURE_FREE_MEMORY_ATI, values);
+        return Long(values[0])*1024;
+    }
+    #endif
+}
+
+MemoryState::MemoryState(Context& context, std::vector<const char*>& extensions): usage(), labels{{{}, 0}} {
+    #ifndef MAGNUM_TARGET_GLES
+    if(context.isExtensionSupported<Extensions::GL::NVX::gpu_memory_info>()) {
+        extensions.push_back(Extensions::GL::NVX::gpu_memory_info::string());
+        availableMemoryImplementation = availableMemoryImplementationNvx;
+        totalMemoryImplementation = totalMemoryImplementationNvx;
+
+    } else if(context.isExtensionSupported<Extensions::GL::ATI::meminfo>()) {
+        extensions.push_back(Extensions::GL::ATI::meminfo::string());
+        availableMemoryImplementation = availableMemoryImplementationAti;
+        totalMemoryImplementation = memoryImplementationNone;
+
+    } else
+    #endif
+    {
+        availableMemoryImplementation = memoryImplementationNone;
+        totalMemoryImplementation = memoryImplementationNone;
+    }
+
+    #ifdef MAGNUM_TARGET_GLES
+    static_cast<void>(context);
+    static_cast<void>(extensions);
+    #endif
+}
+
+UnsignedInt MemoryState::relabel(const UnsignedInt label, const Containers::ArrayReference<const char> name, const std::size_t size) {
+    const auto inserted = labelIndices.emplace(std::string{name.data(), name.size()}, labels.size());
+    if(inserted.second) labels.emplace_back(inserted.first->first, 0);
+
+    const UnsignedInt index = inserted.first->second;
+    labels[label].second -= size;
+    labels[index].second += size;
+    return index;
+}
+
+namespace {
+    /* Estimated bits per pixel of given internal format, for unknown formats
+       assumes four 8-bit components */
+    UnsignedInt bitsPerPixel(const GLenum internalFormat) {
+        switch(internalFormat) {
+            #ifndef MAGNUM_TARGET_GLES2
+            case GL_RED:
+            case GL_R8:
+            case GL_R8_SNORM:
+            case GL_R8UI:
+            case GL_R8I:
+            #else
+            case GL_RED_EXT:
+            case GL_R8_EXT:
+            case GL_LUMINANCE:
+            #endif
+            #ifndef MAGNUM_TARGET_GLES
+            case GL_R3_G3_B2:
+            case GL_RGBA2:
+            case GL_STENCIL_INDEX:
+            case GL_STENCIL_INDEX1:
+            case GL_STENCIL_INDEX4:
+            /* Compression chosen by the driver, assuming 2:1 ratio or better */
+            case GL_COMPRESSED_RED:
+            case GL_COMPRESSED_RG:
+            case GL_COMPRESSED_RGB:
+            case GL_COMPRESSED_RGBA:
+            #else
+            case GL_STENCIL_INDEX1_OES:
+            case GL_STENCIL_INDEX4_OES:
+            #endif
+            case GL_STENCIL_INDEX8:
+                return 8;
+
+            #ifndef MAGNUM_TARGET_GLES2
+            case GL_RG:
+            case GL_RG8:
+            case GL_RG8_SNORM:
+            case GL_RG8UI:
+            case GL_RG8I:
+            case GL_R16UI:
+            case GL_R16I:
+            case GL_R16F:
+            #else
+            case GL_RG_EXT:
+            case GL_RG8_EXT:
+            case GL_LUMINANCE_ALPHA:
+            #endif
+            #ifndef MAGNUM_TARGET_GLES
+            case GL_R16:
+            case GL_R16_SNORM:
+            case GL_RGB4:
+            case GL_RGB5:
+            case GL_STENCIL_INDEX16:
+            #endif
+            case GL_RGB565:
+            case GL_RGBA4:
+            case GL_RGB5_A1:
+            case GL_DEPTH_COMPONENT16:
+                return 16;
+
+            #ifndef MAGNUM_TARGET_GLES2
+            case GL_RGB8:
+            case GL_RGBA8:
+            case GL_RGB8_SNORM:
+            case GL_RGBA8_SNORM:
+            case GL_RGB8UI:
+            case GL_RGB8I:
+            case GL_RGBA8UI:
+            case GL_RGBA8I:
+            case GL_RG16UI:
+            case GL_RG16I:
+            case GL_RG16F:
+            case GL_R32UI:
+            case GL_R32I:
+            case GL_R32F:
+            case GL_R11F_G11F_B10F:
+            case GL_RGB9_E5:
+            case GL_SRGB8:
+            case GL_SRGB8_ALPHA8:
+            case GL_RGB10_A2:
+            case GL_RGB10_A2UI:
+            case GL_DEPTH_COMPONENT24:
+            case GL_DEPTH_COMPONENT32F:
+            case GL_DEPTH_STENCIL:
+            case GL_DEPTH24_STENCIL8:
+            #else
+            case GL_RGB8_OES:
+            case GL_RGBA8_OES:
+            case GL_RGB10_EXT:
+            case GL_RGB10_A2_EXT:
+            case GL_SRGB8_ALPHA8_EXT:
+            case GL_DEPTH_COMPONENT24_OES:
+            case GL_DEPTH_STENCIL_OES:
+            case GL_DEPTH24_STENCIL8_OES:
+            #endif
+            #ifndef MAGNUM_TARGET_GLES
+            case GL_RG16:
+            case GL_RG16_SNORM:
+            case GL_RGB10:
+            case GL_SRGB:
+            case GL_SRGB_ALPHA:
+            case GL_DEPTH_COMPONENT32:
+            #else
+            case GL_SRGB_EXT:
+            case GL_SRGB_ALPHA_EXT:
+            case GL_DEPTH_COMPONENT32_OES:
+            #endif
+            case GL_RGB:
+            case GL_RGBA:
+            case GL_DEPTH_COMPONENT:
+                return 32;
+
+            #ifndef MAGNUM_TARGET_GLES2
+            case GL_RGB16UI:
+            case GL_RGB16I:
+            case GL_RGB16F:
+            case GL_RGBA16UI:
+            case GL_RGBA16I:
+            case GL_RGBA16F:
+            case GL_RG32UI:
+            case GL_RG32I:
+            case GL_RG32F:
+            case GL_DEPTH32F_STENCIL8:
+            #endif
+            #ifndef MAGNUM_TARGET_GLES
+            case GL_RGB16:
+            case GL_RGB16_SNORM:
+            case GL_RGBA16:
+            case GL_RGBA16_SNORM:
+            case GL_RGB12:
+            case GL_RGBA12:
+            #endif
+                return 64;
+
+            #ifndef MAGNUM_TARGET_GLES2
+            case GL_RGB32UI:
+            case GL_RGB32I:
+            case GL_RGB32F:
+                return 96;
+
+            case GL_RGBA32UI:
+            case GL_RGBA32I:
+            case GL_RGBA32F:
+                return 128;
+            #endif
+        }
+
+        return 32;
+    }
+}
+
+std::size_t imageMemoryUsage(const GLenum internalFormat, const Vector3i& size) {
+    #ifndef MAGNUM_TARGET_GLES
+    /* Block-compressed formats with 4x4 blocks */
+    const std::size_t blockCount = std::size_t((size.x() + 3)/4)*((size.y() + 3)/4)*size.z();
+    switch(internalFormat) {
+        case GL_COMPRESSED_RED_RGTC1:
+        case GL_COMPRESSED_SIGNED_RED_RGTC1:
+            return blockCount*8;
+
+        case GL_COMPRESSED_RG_RGTC2:
+        case GL_COMPRESSED_SIGNED_RG_RGTC2:
+        case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:
+        case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:
+        case GL_COMPRESSED_RGBA_BPTC_UNORM:
+        case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+            return blockCount*16;
+    }
+    #endif
+
+    return std::size_t(size.product())*bitsPerPixel(internalFormat)/8;
+}
+
+}}
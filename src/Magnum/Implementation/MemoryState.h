@@ -0,0 +1,78 @@
+#ifndef Magnum_Implementation_MemoryState_h
+#define Magnum_Implementation_MemoryState_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Context.h"
+
+namespace Magnum { namespace Implementation {
+
+struct MemoryState {
+    explicit MemoryState(Context& context, std::vector<const char*>& extensions);
+
+    void create(Context::MemoryObjectType type) {
+        ++usage[std::size_t(type)].count;
+    }
+
+    void destroy(Context::MemoryObjectType type, UnsignedInt label, std::size_t size) {
+        resize(type, label, size, 0);
+        --usage[std::size_t(type)].count;
+    }
+
+    /* Changes accounted size of an object from previous to size */
+    void resize(Context::MemoryObjectType type, UnsignedInt label, std::size_t previous, std::size_t size) {
+        usage[std::size_t(type)].size += UnsignedLong(size) - UnsignedLong(previous);
+        labels[label].second += UnsignedLong(size) - UnsignedLong(previous);
+    }
+
+    /* Moves size of an object from given label to a new one, returns index
+       of the new label */
+    UnsignedInt relabel(UnsignedInt label, Containers::ArrayReference<const char> name, std::size_t size);
+
+    Long(*availableMemoryImplementation)();
+    Long(*totalMemoryImplementation)();
+
+    Context::MemoryUsage usage[Context::MemoryObjectTypeCount];
+
+    /* Label names and sizes, the first one is for unlabeled objects. Objects
+       store just the index, the labels are never removed. */
+    std::vector<std::pair<std::string, UnsignedLong>> labels;
+    std::unordered_map<std::string, UnsignedInt> labelIndices;
+};
+
+/* Estimated size of an image of given internal format in bytes. Block
+   compressed formats are rounded up to whole 4x4 blocks, three-component
+   formats with 8- and 16-bit channels are padded to four components. */
+std::size_t imageMemoryUsage(GLenum internalFormat, const Vector3i& size);
+
+}}
+
+#endif
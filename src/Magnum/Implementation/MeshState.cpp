@@ -33,7 +33,7 @@
 
 namespace Magnum { namespace Implementation {
 
-MeshState::MeshState(Context& context, std::vector<std::string>& extensions): currentVAO(0)
+MeshState::MeshState(Context& context, std::vector<const char*>& extensions): currentVAO(0)
     #ifndef MAGNUM_TARGET_GLES2
     , maxElementIndex{0}, maxElementsIndices{0}, maxElementsVertices{0}
     #endif
@@ -111,6 +111,13 @@ MeshState::MeshState(Context& context, std::vector<std::string>& extensions): cu
 
         multiDrawImplementation = &MeshView::multiDrawImplementationDefault;
     } else multiDrawImplementation = &MeshView::multiDrawImplementationFallback;
+    #else
+    /* Indirect multi draw implementation on desktop */
+    if(context.isExtensionSupported<Extensions::GL::ARB::multi_draw_indirect>()) {
+        extensions.push_back(Extensions::GL::ARB::multi_draw_indirect::string());
+
+        multiDrawIndirectImplementation = &MeshView::multiDrawIndirectImplementationDefault;
+    } else multiDrawIndirectImplementation = &MeshView::multiDrawIndirectImplementationFallback;
     #endif
 
     #ifdef MAGNUM_TARGET_GLES2
@@ -169,6 +176,50 @@ MeshState::MeshState(Context& context, std::vector<std::string>& extensions): cu
 
 void MeshState::reset() {
     currentVAO = State::DisengagedBinding;
+
+    /* Forget everything, the attributes will be specified again on next
+       draw */
+    vertexAttributes.clear();
+}
+
+bool MeshState::updateVertexAttribute(const GLuint location, const VertexAttribute& attribute, GLuint& previousDivisor) {
+    if(location >= vertexAttributes.size())
+        vertexAttributes.resize(location + 1, VertexAttribute{VertexAttribute::Kind::Disabled, false, false, 0, 0, 0, 0, 0, 0});
+
+    VertexAttribute& current = vertexAttributes[location];
+    previousDivisor = current.kind == VertexAttribute::Kind::Disabled ? 0 : current.divisor;
+    const bool changed =
+        current.kind != attribute.kind ||
+        current.buffer != attribute.buffer ||
+        current.size != attribute.size ||
+        current.type != attribute.type ||
+        current.normalized != attribute.normalized ||
+        current.offset != attribute.offset ||
+        current.stride != attribute.stride ||
+        current.divisor != attribute.divisor;
+
+    current = attribute;
+    current.used = true;
+    return changed;
+}
+
+void MeshState::disableUnusedVertexAttributes() {
+    for(std::size_t i = 0; i != vertexAttributes.size(); ++i) {
+        VertexAttribute& attribute = vertexAttributes[i];
+        if(attribute.kind != VertexAttribute::Kind::Disabled && !attribute.used) {
+            glDisableVertexAttribArray(GLuint(i));
+            attribute.kind = VertexAttribute::Kind::Disabled;
+        }
+
+        attribute.used = false;
+    }
+}
+
+void MeshState::invalidateVertexAttributes(const GLuint buffer) {
+    /* The attributes stay enabled, they're disabled or respecified on next
+       draw */
+    for(VertexAttribute& attribute: vertexAttributes)
+        if(attribute.buffer == buffer) attribute.buffer = 0;
 }
 
 }}
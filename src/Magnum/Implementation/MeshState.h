@@ -29,14 +29,41 @@
 #include <string>
 
 #include "Magnum/Mesh.h"
+#include "Magnum/MeshView.h"
 
 namespace Magnum { namespace Implementation {
 
 struct MeshState {
-    explicit MeshState(Context& context, std::vector<std::string>& extensions);
+    /* Attribute state of the default vertex array, used only on the non-VAO
+       path to respecify only attributes that differ from previous draw */
+    struct VertexAttribute {
+        enum class Kind: UnsignedByte { Disabled, Generic, Integer, Long };
+
+        Kind kind;
+        bool normalized, used;
+        GLuint buffer;
+        GLint size;
+        GLenum type;
+        GLintptr offset;
+        GLsizei stride;
+        GLuint divisor;
+    };
+
+    explicit MeshState(Context& context, std::vector<const char*>& extensions);
 
     void reset();
 
+    /* Marks the attribute at given location as used in current draw. Returns
+       true if it differs from the cached state and needs to be specified,
+       divisor of the previous attribute is saved to `previousDivisor`. */
+    bool updateVertexAttribute(GLuint location, const VertexAttribute& attribute, GLuint& previousDivisor);
+
+    /* Disables enabled attributes not used since last call */
+    void disableUnusedVertexAttributes();
+
+    /* The buffer is being deleted, it gets detached from the attributes */
+    void invalidateVertexAttributes(GLuint buffer);
+
     void(Mesh::*createImplementation)();
     void(Mesh::*destroyImplementation)();
     void(Mesh::*attributePointerImplementation)(const Mesh::GenericAttribute&);
@@ -59,10 +86,13 @@ struct MeshState {
     #endif
 
     #ifdef MAGNUM_TARGET_GLES
-    void(*multiDrawImplementation)(std::initializer_list<std::reference_wrapper<MeshView>>);
+    void(*multiDrawImplementation)(Containers::ArrayReference<const std::reference_wrapper<MeshView>>);
+    #else
+    void(*multiDrawIndirectImplementation)(Containers::ArrayReference<const std::reference_wrapper<MeshView>>, Buffer&);
     #endif
 
     GLuint currentVAO;
+    std::vector<VertexAttribute> vertexAttributes;
     #ifndef MAGNUM_TARGET_GLES2
     GLint64 maxElementIndex;
     GLint maxElementsIndices, maxElementsVertices;
@@ -0,0 +1,103 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "NamePoolState.h"
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+
+namespace Magnum { namespace Implementation {
+
+GLuint NamePool::take() {
+    if(names.empty()) {
+        names.resize(batchSize ? batchSize : 1);
+        generate(names.size(), names.data());
+    }
+
+    const GLuint id = names.back();
+    names.pop_back();
+    return id;
+}
+
+bool NamePool::recycle(const GLuint id) {
+    if(!batchSize) return false;
+
+    names.push_back(id);
+    return true;
+}
+
+void NamePool::clear() {
+    if(!names.empty()) destroy(names.size(), names.data());
+    names.clear();
+}
+
+NamePoolState::NamePoolState(Context& context, std::vector<const char*>& extensions) {
+    /* Buffers and renderbuffers created with DSA don't have any type yet, so
+       they can be created in advance as well. Textures and queries need to
+       know the target, so these are pooled only in the non-DSA path. */
+    #ifndef MAGNUM_TARGET_GLES
+    if(context.isExtensionSupported<Extensions::GL::ARB::direct_state_access>()) {
+        extensions.push_back(Extensions::GL::ARB::direct_state_access::string());
+
+        buffers.generate = [](GLsizei n, GLuint* ids) { glCreateBuffers(n, ids); };
+        renderbuffers.generate = [](GLsizei n, GLuint* ids) { glCreateRenderbuffers(n, ids); };
+    } else
+    #endif
+    {
+        buffers.generate = [](GLsizei n, GLuint* ids) { glGenBuffers(n, ids); };
+        renderbuffers.generate = [](GLsizei n, GLuint* ids) { glGenRenderbuffers(n, ids); };
+    }
+
+    textures.generate = [](GLsizei n, GLuint* ids) { glGenTextures(n, ids); };
+    #ifndef MAGNUM_TARGET_GLES2
+    queries.generate = [](GLsizei n, GLuint* ids) { glGenQueries(n, ids); };
+    queries.destroy = [](GLsizei n, const GLuint* ids) { glDeleteQueries(n, ids); };
+    #elif !defined(CORRADE_TARGET_EMSCRIPTEN)
+    queries.generate = [](GLsizei n, GLuint* ids) { glGenQueriesEXT(n, ids); };
+    queries.destroy = [](GLsizei n, const GLuint* ids) { glDeleteQueriesEXT(n, ids); };
+    #endif
+
+    buffers.destroy = [](GLsizei n, const GLuint* ids) { glDeleteBuffers(n, ids); };
+    textures.destroy = [](GLsizei n, const GLuint* ids) { glDeleteTextures(n, ids); };
+    renderbuffers.destroy = [](GLsizei n, const GLuint* ids) { glDeleteRenderbuffers(n, ids); };
+
+    #ifdef MAGNUM_TARGET_GLES
+    static_cast<void>(context);
+    static_cast<void>(extensions);
+    #endif
+}
+
+void NamePoolState::setBatchSize(const std::size_t size) {
+    buffers.batchSize = textures.batchSize = queries.batchSize = renderbuffers.batchSize = size;
+}
+
+void NamePoolState::clear() {
+    buffers.clear();
+    textures.clear();
+    queries.clear();
+    renderbuffers.clear();
+}
+
+}}
@@ -0,0 +1,73 @@
+#ifndef Magnum_Implementation_NamePoolState_h
+#define Magnum_Implementation_NamePoolState_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/OpenGL.h"
+
+namespace Magnum { namespace Implementation {
+
+/* Names generated in batches and handed out one by one. With zero batch size
+   each take() generates just one name, as if there was no pool at all. */
+struct NamePool {
+    typedef void(*GenerateFunction)(GLsizei, GLuint*);
+    typedef void(*DeleteFunction)(GLsizei, const GLuint*);
+
+    explicit NamePool(): generate{}, destroy{}, batchSize{0} {}
+
+    GLuint take();
+
+    /* Puts back name of object which was never bound (thus it's just a
+       reserved name, indistinguishable from a new one). Returns false if
+       pooling is disabled and the caller should delete the name. */
+    bool recycle(GLuint id);
+
+    /* Deletes all pooled names */
+    void clear();
+
+    GenerateFunction generate;
+    DeleteFunction destroy;
+    std::size_t batchSize;
+    std::vector<GLuint> names;
+};
+
+struct NamePoolState {
+    explicit NamePoolState(Context& context, std::vector<const char*>& extensions);
+
+    void setBatchSize(std::size_t size);
+    void clear();
+
+    NamePool buffers,
+        textures,
+        queries,
+        renderbuffers;
+};
+
+}}
+
+#endif
@@ -27,10 +27,13 @@
 
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
+#include "Magnum/Math/Constants.h"
 
 namespace Magnum { namespace Implementation {
 
-RendererState::RendererState(Context& context, std::vector<std::string>& extensions): resetNotificationStrategy() {
+constexpr const Range2Di RendererState::DisengagedScissor;
+
+RendererState::RendererState(Context& context, std::vector<const char*>& extensions): resetNotificationStrategy() {
     /* Float depth clear value implementation */
     #ifndef MAGNUM_TARGET_GLES
     if(context.isExtensionSupported<Extensions::GL::ARB::ES2_compatibility>())
@@ -61,6 +64,38 @@ RendererState::RendererState(Context& context, std::vector<std::string>& extensi
 
         graphicsResetStatusImplementation = &Renderer::graphicsResetStatusImplementationRobustness;
     } else graphicsResetStatusImplementation = &Renderer::graphicsResetStatusImplementationDefault;
+
+    /* We don't know anything about the state of a context that might have
+       been touched before us */
+    reset();
+}
+
+void RendererState::reset() {
+    features.clear();
+
+    blendEquationRgb = blendEquationAlpha = DisengagedValue;
+    blendSourceRgb = blendDestinationRgb = blendSourceAlpha = blendDestinationAlpha = DisengagedValue;
+    blendColor = Color4{Constants::nan()};
+    colorMask[0] = colorMask[1] = colorMask[2] = colorMask[3] = DisengagedMask;
+
+    depthFunction = DisengagedValue;
+    depthMask = DisengagedMask;
+
+    for(Stencil& s: stencil) {
+        s.function = s.stencilFail = s.depthFail = s.depthPass = DisengagedValue;
+        s.referenceValue = 0;
+        s.mask = s.writeMask = 0;
+        s.writeMaskKnown = false;
+    }
+
+    frontFace = faceCullingMode = DisengagedValue;
+    polygonOffset = Vector2{Constants::nan()};
+    scissor = DisengagedScissor;
+
+    for(PixelStorageState* s: {&packPixelStorage, &unpackPixelStorage}) {
+        s->alignment = s->rowLength = s->imageHeight = -1;
+        s->skip = Vector3i{-1};
+    }
 }
 
 }}
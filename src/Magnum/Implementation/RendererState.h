@@ -28,17 +28,65 @@
 #include <string>
 #include <vector>
 
+#include "Magnum/Color.h"
 #include "Magnum/Renderer.h"
+#include "Magnum/Math/Range.h"
 
 namespace Magnum { namespace Implementation {
 
 struct RendererState {
-    explicit RendererState(Context& context, std::vector<std::string>& extensions);
+    explicit RendererState(Context& context, std::vector<const char*>& extensions);
+
+    enum: GLenum { DisengagedValue = ~GLenum{} };
+    enum: GLboolean { DisengagedMask = 0xff };
+    constexpr static const Range2Di DisengagedScissor{{}, {-1, -1}};
+
+    /* Sets all tracked state to disengaged values, so the next call is
+       always passed to GL */
+    void reset();
 
     void(*clearDepthfImplementation)(GLfloat);
     Renderer::GraphicsResetStatus(*graphicsResetStatusImplementation)();
 
     Renderer::ResetNotificationStrategy resetNotificationStrategy;
+
+    /* Features with known state, unknown ones are not present */
+    std::vector<std::pair<GLenum, bool>> features;
+
+    /* Blending. NaN in the color never compares equal. */
+    GLenum blendEquationRgb, blendEquationAlpha;
+    GLenum blendSourceRgb, blendDestinationRgb, blendSourceAlpha, blendDestinationAlpha;
+    Color4 blendColor;
+    GLboolean colorMask[4];
+
+    /* Depth */
+    GLenum depthFunction;
+    GLboolean depthMask;
+
+    /* Stencil, index 0 is front face, 1 is back face */
+    struct Stencil {
+        GLenum function;
+        GLint referenceValue;
+        GLuint mask;
+        GLenum stencilFail, depthFail, depthPass;
+        GLuint writeMask;
+        bool writeMaskKnown;
+    } stencil[2];
+
+    /* Face culling */
+    GLenum frontFace, faceCullingMode;
+
+    /* Polygon offset, NaN if unknown */
+    Vector2 polygonOffset;
+
+    /* Scissor */
+    Range2Di scissor;
+
+    /* Pixel storage, -1 if unknown */
+    struct PixelStorageState {
+        GLint alignment, rowLength, imageHeight;
+        Vector3i skip;
+    } packPixelStorage, unpackPixelStorage;
 };
 
 }}
@@ -33,7 +33,7 @@
 
 namespace Magnum { namespace Implementation {
 
-ShaderProgramState::ShaderProgramState(Context& context, std::vector<std::string>& extensions): current(0), maxVertexAttributes(0)
+ShaderProgramState::ShaderProgramState(Context& context, std::vector<const char*>& extensions): current(0), maxVertexAttributes(0)
         #ifndef MAGNUM_TARGET_GLES2
         , maxAtomicCounterBufferSize(0), maxComputeSharedMemorySize(0), maxComputeWorkGroupInvocations(0), maxImageUnits(0), maxCombinedShaderOutputResources(0), maxUniformLocations(0), minTexelOffset(0), maxTexelOffset(0), maxUniformBlockSize(0), maxShaderStorageBlockSize(0)
         #endif
@@ -90,6 +90,7 @@ ShaderProgramState::ShaderProgramState(Context& context, std::vector<std::string
         uniformMatrix4x2dvImplementation = &AbstractShaderProgram::uniformImplementationSSO;
         uniformMatrix3x4dvImplementation = &AbstractShaderProgram::uniformImplementationSSO;
         uniformMatrix4x3dvImplementation = &AbstractShaderProgram::uniformImplementationSSO;
+        uniformHandleui64vImplementation = &AbstractShaderProgram::uniformHandleImplementationSSO;
         #endif
     } else
     #endif
@@ -148,6 +149,7 @@ ShaderProgramState::ShaderProgramState(Context& context, std::vector<std::string
         uniformMatrix4x2dvImplementation = &AbstractShaderProgram::uniformImplementationDSAEXT;
         uniformMatrix3x4dvImplementation = &AbstractShaderProgram::uniformImplementationDSAEXT;
         uniformMatrix4x3dvImplementation = &AbstractShaderProgram::uniformImplementationDSAEXT;
+        uniformHandleui64vImplementation = &AbstractShaderProgram::uniformHandleImplementationDefault;
         #endif
     } else {
         uniform1fvImplementation = &AbstractShaderProgram::uniformImplementationDefault;
@@ -192,6 +194,7 @@ ShaderProgramState::ShaderProgramState(Context& context, std::vector<std::string
         uniformMatrix4x2dvImplementation = &AbstractShaderProgram::uniformImplementationDefault;
         uniformMatrix3x4dvImplementation = &AbstractShaderProgram::uniformImplementationDefault;
         uniformMatrix4x3dvImplementation = &AbstractShaderProgram::uniformImplementationDefault;
+        uniformHandleui64vImplementation = &AbstractShaderProgram::uniformHandleImplementationDefault;
         #endif
     }
 }
@@ -30,11 +30,12 @@
 
 #include "Magnum/Magnum.h"
 #include "Magnum/OpenGL.h"
+#include "Magnum/Math/Vector3.h"
 
 namespace Magnum { namespace Implementation {
 
 struct ShaderProgramState {
-    explicit ShaderProgramState(Context& context, std::vector<std::string>& extensions);
+    explicit ShaderProgramState(Context& context, std::vector<const char*>& extensions);
 
     void reset();
 
@@ -80,6 +81,7 @@ struct ShaderProgramState {
     void(AbstractShaderProgram::*uniformMatrix4x2dvImplementation)(GLint, GLsizei, const Math::RectangularMatrix<4, 2, GLdouble>*);
     void(AbstractShaderProgram::*uniformMatrix3x4dvImplementation)(GLint, GLsizei, const Math::RectangularMatrix<3, 4, GLdouble>*);
     void(AbstractShaderProgram::*uniformMatrix4x3dvImplementation)(GLint, GLsizei, const Math::RectangularMatrix<4, 3, GLdouble>*);
+    void(AbstractShaderProgram::*uniformHandleui64vImplementation)(GLint, GLsizei, const GLuint64*);
     #endif
 
     /* Currently used program */
@@ -97,11 +99,17 @@ struct ShaderProgramState {
         maxTexelOffset,
         maxUniformBlockSize;
     GLint64 maxShaderStorageBlockSize;
+    Vector3i maxComputeWorkGroupCount,
+        maxComputeWorkGroupSize;
     #endif
 
     #ifndef MAGNUM_TARGET_GLES
     GLint maxImageSamples;
     #endif
+
+    #ifndef MAGNUM_TARGET_GLES2
+    std::string binaryCacheDirectory;
+    #endif
 };
 
 }}
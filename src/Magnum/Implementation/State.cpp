@@ -26,14 +26,18 @@
 #include "State.h"
 
 #include <algorithm>
+#include <cstring>
 
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 
 #include "BufferState.h"
 #include "DebugState.h"
+#include "DeletionState.h"
 #include "FramebufferState.h"
+#include "MemoryState.h"
 #include "MeshState.h"
+#include "NamePoolState.h"
 #include "QueryState.h"
 #include "RendererState.h"
 #include "ShaderState.h"
@@ -45,10 +49,10 @@
 
 namespace Magnum { namespace Implementation {
 
-State::State(Context& context) {
+State::State(Context& context): elidedStateChangeCount{}, statisticsEnabled{false}, statistics() {
     /* List of extensions used in current context. Guesstimate count to avoid
        unnecessary reallocations. */
-    std::vector<std::string> extensions;
+    std::vector<const char*> extensions;
     #ifndef MAGNUM_TARGET_GLES
     extensions.reserve(32);
     #else
@@ -57,8 +61,11 @@ State::State(Context& context) {
 
     buffer.reset(new BufferState{context, extensions});
     debug.reset(new DebugState{context, extensions});
+    deletion.reset(new DeletionState);
     framebuffer.reset(new FramebufferState{context, extensions});
+    memory.reset(new MemoryState{context, extensions});
     mesh.reset(new MeshState{context, extensions});
+    namePool.reset(new NamePoolState{context, extensions});
     query.reset(new QueryState{context, extensions});
     renderer.reset(new RendererState{context, extensions});
     shader.reset(new ShaderState);
@@ -69,8 +76,12 @@ State::State(Context& context) {
     #endif
 
     /* Sort the features and remove duplicates */
-    std::sort(extensions.begin(), extensions.end());
-    extensions.erase(std::unique(extensions.begin(), extensions.end()), extensions.end());
+    std::sort(extensions.begin(), extensions.end(), [](const char* a, const char* b) {
+        return std::strcmp(a, b) < 0;
+    });
+    extensions.erase(std::unique(extensions.begin(), extensions.end(), [](const char* a, const char* b) {
+        return std::strcmp(a, b) == 0;
+    }), extensions.end());
 
     Debug() << "Using optional features:";
     for(const auto& ext: extensions) Debug() << "   " << ext;
@@ -27,6 +27,7 @@
 
 #include <memory>
 
+#include "Magnum/Context.h"
 #include "Magnum/Magnum.h"
 #include "Magnum/OpenGL.h"
 
@@ -34,8 +35,11 @@ namespace Magnum { namespace Implementation {
 
 struct BufferState;
 struct DebugState;
+struct DeletionState;
 struct FramebufferState;
+struct MemoryState;
 struct MeshState;
+struct NamePoolState;
 struct QueryState;
 struct RendererState;
 struct ShaderState;
@@ -55,8 +59,11 @@ struct State {
 
     std::unique_ptr<BufferState> buffer;
     std::unique_ptr<DebugState> debug;
+    std::unique_ptr<DeletionState> deletion;
     std::unique_ptr<FramebufferState> framebuffer;
+    std::unique_ptr<MemoryState> memory;
     std::unique_ptr<MeshState> mesh;
+    std::unique_ptr<NamePoolState> namePool;
     std::unique_ptr<QueryState> query;
     std::unique_ptr<RendererState> renderer;
     std::unique_ptr<ShaderState> shader;
@@ -65,6 +72,13 @@ struct State {
     #ifndef MAGNUM_TARGET_GLES2
     std::unique_ptr<TransformFeedbackState> transformFeedback;
     #endif
+
+    /* Count of GL calls skipped because the tracked state already matched */
+    UnsignedLong elidedStateChangeCount;
+
+    /* Rendering statistics, updated only if enabled */
+    bool statisticsEnabled;
+    Context::Statistics statistics;
 };
 
 }}
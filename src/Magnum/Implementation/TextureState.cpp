@@ -38,7 +38,7 @@
 
 namespace Magnum { namespace Implementation {
 
-TextureState::TextureState(Context& context, std::vector<std::string>& extensions): maxSize{}, max3DSize{}, maxCubeMapSize{},
+TextureState::TextureState(Context& context, std::vector<const char*>& extensions): maxSize{}, max3DSize{}, maxCubeMapSize{},
     #ifndef MAGNUM_TARGET_GLES2
     maxArrayLayers{},
     #endif
@@ -101,11 +101,15 @@ TextureState::TextureState(Context& context, std::vector<std::string>& extension
         extensions.push_back(Extensions::GL::ARB::multi_bind::string());
 
         bindMultiImplementation = &AbstractTexture::bindImplementationMulti;
+        bindSamplersImplementation = &Sampler::bindImplementationMulti;
 
     } else
     #endif
     {
         bindMultiImplementation = &AbstractTexture::bindImplementationFallback;
+        #ifndef MAGNUM_TARGET_GLES2
+        bindSamplersImplementation = &Sampler::bindImplementationFallback;
+        #endif
     }
 
     /* DSA/non-DSA implementation */
@@ -124,12 +128,16 @@ TextureState::TextureState(Context& context, std::vector<std::string>& extension
         subImage1DImplementation = &AbstractTexture::subImageImplementationDSA;
         subImage2DImplementation = &AbstractTexture::subImageImplementationDSA;
         subImage3DImplementation = &AbstractTexture::subImageImplementationDSA;
+        compressedSubImage1DImplementation = &AbstractTexture::compressedSubImageImplementationDSA;
+        compressedSubImage2DImplementation = &AbstractTexture::compressedSubImageImplementationDSA;
+        compressedSubImage3DImplementation = &AbstractTexture::compressedSubImageImplementationDSA;
 
         setBufferImplementation = &BufferTexture::setBufferImplementationDSA;
         setBufferRangeImplementation = &BufferTexture::setBufferRangeImplementationDSA;
 
         getCubeImageSizeImplementation = &CubeMapTexture::getImageSizeImplementationDSA;
         cubeSubImageImplementation = &CubeMapTexture::subImageImplementationDSA;
+        cubeCompressedSubImageImplementation = &CubeMapTexture::compressedSubImageImplementationDSA;
 
     } else if(context.isExtensionSupported<Extensions::GL::EXT::direct_state_access>()) {
         extensions.push_back(Extensions::GL::EXT::direct_state_access::string());
@@ -145,12 +153,16 @@ TextureState::TextureState(Context& context, std::vector<std::string>& extension
         subImage1DImplementation = &AbstractTexture::subImageImplementationDSAEXT;
         subImage2DImplementation = &AbstractTexture::subImageImplementationDSAEXT;
         subImage3DImplementation = &AbstractTexture::subImageImplementationDSAEXT;
+        compressedSubImage1DImplementation = &AbstractTexture::compressedSubImageImplementationDSAEXT;
+        compressedSubImage2DImplementation = &AbstractTexture::compressedSubImageImplementationDSAEXT;
+        compressedSubImage3DImplementation = &AbstractTexture::compressedSubImageImplementationDSAEXT;
 
         setBufferImplementation = &BufferTexture::setBufferImplementationDSAEXT;
         setBufferRangeImplementation = &BufferTexture::setBufferRangeImplementationDSAEXT;
 
         getCubeImageSizeImplementation = &CubeMapTexture::getImageSizeImplementationDSAEXT;
         cubeSubImageImplementation = &CubeMapTexture::subImageImplementationDSAEXT;
+        cubeCompressedSubImageImplementation = &CubeMapTexture::compressedSubImageImplementationDSAEXT;
 
     } else
     #endif
@@ -174,6 +186,11 @@ TextureState::TextureState(Context& context, std::vector<std::string>& extension
         #endif
         subImage2DImplementation = &AbstractTexture::subImageImplementationDefault;
         subImage3DImplementation = &AbstractTexture::subImageImplementationDefault;
+        #ifndef MAGNUM_TARGET_GLES
+        compressedSubImage1DImplementation = &AbstractTexture::compressedSubImageImplementationDefault;
+        #endif
+        compressedSubImage2DImplementation = &AbstractTexture::compressedSubImageImplementationDefault;
+        compressedSubImage3DImplementation = &AbstractTexture::compressedSubImageImplementationDefault;
 
         #ifndef MAGNUM_TARGET_GLES
         setBufferImplementation = &BufferTexture::setBufferImplementationDefault;
@@ -184,6 +201,7 @@ TextureState::TextureState(Context& context, std::vector<std::string>& extension
         getCubeImageSizeImplementation = &CubeMapTexture::getImageSizeImplementationDefault;
         #endif
         cubeSubImageImplementation = &CubeMapTexture::subImageImplementationDefault;
+        cubeCompressedSubImageImplementation = &CubeMapTexture::compressedSubImageImplementationDefault;
     }
 
     /* Data invalidation implementation */
@@ -310,12 +328,18 @@ TextureState::TextureState(Context& context, std::vector<std::string>& extension
     glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &maxTextureUnits);
     CORRADE_INTERNAL_ASSERT(maxTextureUnits > 0);
     bindings.resize(maxTextureUnits);
+    #ifndef MAGNUM_TARGET_GLES2
+    samplerBindings.resize(maxTextureUnits);
+    #endif
 }
 
 TextureState::~TextureState() = default;
 
 void TextureState::reset() {
     std::fill_n(bindings.begin(), bindings.size(), std::pair<GLenum, GLuint>{{}, State::DisengagedBinding});
+    #ifndef MAGNUM_TARGET_GLES2
+    std::fill_n(samplerBindings.begin(), samplerBindings.size(), State::DisengagedBinding);
+    #endif
 }
 
 }}
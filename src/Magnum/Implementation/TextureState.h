@@ -33,13 +33,16 @@
 namespace Magnum { namespace Implementation {
 
 struct TextureState {
-    explicit TextureState(Context& context, std::vector<std::string>& extensions);
+    explicit TextureState(Context& context, std::vector<const char*>& extensions);
     ~TextureState();
 
     void reset();
 
     void(*unbindImplementation)(GLint);
     void(*bindMultiImplementation)(GLint, Containers::ArrayReference<AbstractTexture* const>);
+    #ifndef MAGNUM_TARGET_GLES2
+    void(*bindSamplersImplementation)(GLint, Containers::ArrayReference<Sampler* const>);
+    #endif
     void(AbstractTexture::*createImplementation)();
     void(AbstractTexture::*bindImplementation)(GLint);
     void(AbstractTexture::*parameteriImplementation)(GLenum, GLint);
@@ -74,6 +77,11 @@ struct TextureState {
     #endif
     void(AbstractTexture::*subImage2DImplementation)(GLint, const Vector2i&, const Vector2i&, ColorFormat, ColorType, const GLvoid*);
     void(AbstractTexture::*subImage3DImplementation)(GLint, const Vector3i&, const Vector3i&, ColorFormat, ColorType, const GLvoid*);
+    #ifndef MAGNUM_TARGET_GLES
+    void(AbstractTexture::*compressedSubImage1DImplementation)(GLint, const Math::Vector<1, GLint>&, const Math::Vector<1, GLsizei>&, CompressedColorFormat, const GLvoid*, GLsizei);
+    #endif
+    void(AbstractTexture::*compressedSubImage2DImplementation)(GLint, const Vector2i&, const Vector2i&, CompressedColorFormat, const GLvoid*, GLsizei);
+    void(AbstractTexture::*compressedSubImage3DImplementation)(GLint, const Vector3i&, const Vector3i&, CompressedColorFormat, const GLvoid*, GLsizei);
     void(AbstractTexture::*invalidateImageImplementation)(GLint);
     void(AbstractTexture::*invalidateSubImageImplementation)(GLint, const Vector3i&, const Vector3i&);
 
@@ -89,6 +97,7 @@ struct TextureState {
     void(CubeMapTexture::*getCubeImageImplementation)(CubeMapTexture::Coordinate, GLint, const Vector2i&, ColorFormat, ColorType, std::size_t, GLvoid*);
     #endif
     void(CubeMapTexture::*cubeSubImageImplementation)(CubeMapTexture::Coordinate, GLint, const Vector2i&, const Vector2i&, ColorFormat, ColorType, const GLvoid*);
+    void(CubeMapTexture::*cubeCompressedSubImageImplementation)(CubeMapTexture::Coordinate, GLint, const Vector2i&, const Vector2i&, CompressedColorFormat, const GLvoid*, GLsizei);
 
     GLint maxSize,
         max3DSize,
@@ -116,6 +125,9 @@ struct TextureState {
     #endif
 
     std::vector<std::pair<GLenum, GLuint>> bindings;
+    #ifndef MAGNUM_TARGET_GLES2
+    std::vector<GLuint> samplerBindings;
+    #endif
 };
 
 }}
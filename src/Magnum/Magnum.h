@@ -86,6 +86,17 @@ Defined if built as static libraries. Default are shared libraries.
 #define MAGNUM_BUILD_STATIC
 #undef MAGNUM_BUILD_STATIC
 
+/**
+@brief SIMD math build
+
+Defined if built with SSE or NEON specializations of
+@ref Math::Vector4 "Vector4", @ref Math::Matrix4 "Matrix4" and
+@ref Math::Quaternion "Quaternion" of @ref Float. Disabled by default.
+@see @ref building, @ref cmake
+*/
+#define MAGNUM_BUILD_SIMD
+#undef MAGNUM_BUILD_SIMD
+
 /**
 @brief OpenGL ES target
 
@@ -186,6 +197,9 @@ typedef std::int64_t Long;
 /** @brief Float (32bit) */
 typedef float Float;
 
+/** @brief Half-precision float (16bit) */
+typedef Math::Half Half;
+
 /** @brief Two-component float vector */
 typedef Math::Vector2<Float> Vector2;
 
@@ -464,6 +478,9 @@ template<UnsignedInt> class BufferImage;
 typedef BufferImage<1> BufferImage1D;
 typedef BufferImage<2> BufferImage2D;
 typedef BufferImage<3> BufferImage3D;
+
+class BufferReadbackQueue;
+class BufferRing;
 #endif
 
 #ifndef MAGNUM_TARGET_GLES
@@ -480,6 +497,12 @@ typedef BasicColor4<UnsignedByte> Color4ub;
 
 enum class ColorFormat: GLenum;
 enum class ColorType: GLenum;
+enum class CompressedColorFormat: GLenum;
+
+template<UnsignedInt> class CompressedImageReference;
+typedef CompressedImageReference<1> CompressedImageReference1D;
+typedef CompressedImageReference<2> CompressedImageReference2D;
+typedef CompressedImageReference<3> CompressedImageReference3D;
 
 class Context;
 
@@ -492,14 +515,29 @@ class CubeMapTextureArray;
 /* DefaultFramebuffer is available only through global instance */
 /* DimensionTraits forward declaration is not needed */
 
+#ifndef MAGNUM_TARGET_GLES2
+class DrawList;
+#endif
+
 class Extension;
+#ifndef MAGNUM_TARGET_GLES2
+class Fence;
+#endif
 class Framebuffer;
+#ifndef MAGNUM_TARGET_GLES2
+class FramebufferReadbackQueue;
+class GeometryPool;
+#endif
 
 template<UnsignedInt> class Image;
 typedef Image<1> Image1D;
 typedef Image<2> Image2D;
 typedef Image<3> Image3D;
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+enum class ImageAccess: GLenum;
+#endif
+
 template<UnsignedInt> class ImageReference;
 typedef ImageReference<1> ImageReference1D;
 typedef ImageReference<2> ImageReference2D;
@@ -519,16 +557,29 @@ typedef MultisampleTexture<3> MultisampleTexture2DArray;
 #endif
 #endif
 
+#ifndef MAGNUM_TARGET_GLES
+class OcclusionCuller;
+#endif
+
+class PixelStorage;
+
 /* AbstractQuery is not used directly */
 class PrimitiveQuery;
 class SampleQuery;
 class TimeQuery;
+template<class> class QueryPool;
 
 class RectangleTexture;
 
 class Renderbuffer;
 enum class RenderbufferFormat: GLenum;
 
+class RenderPass;
+enum class RenderPassLoad: UnsignedByte;
+enum class RenderPassStore: UnsignedByte;
+
+class RenderTargetPool;
+
 enum class ResourceState: UnsignedByte;
 enum class ResourceDataState: UnsignedByte;
 enum class ResourcePolicy: UnsignedByte;
@@ -537,6 +588,9 @@ class ResourceKey;
 template<class...> class ResourceManager;
 
 class Sampler;
+#ifndef MAGNUM_TARGET_GLES2
+class SamplerCache;
+#endif
 class Shader;
 
 template<UnsignedInt> class Texture;
@@ -554,12 +608,27 @@ typedef TextureArray<1> Texture1DArray;
 typedef TextureArray<2> Texture2DArray;
 #endif
 
+class Task;
+enum class TaskAffinity: UnsignedByte;
+class TaskScheduler;
+
 enum class TextureFormat: GLenum;
 
+#ifndef MAGNUM_TARGET_GLES
+class TexturePageResidency;
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+class TextureStreamer;
+class TextureUploadQueue;
+#endif
+
 class TransformFeedback;
 class Timeline;
 
 enum class Version: Int;
+
+template<class...> class VertexLayout;
 #endif
 
 }
@@ -93,6 +93,7 @@ RectangularMatrix<cols, rows, Double> w =
 
 Implementation based on *Golub, G. H.; Reinsch, C. (1970). "Singular value
 decomposition and least squares solutions"*.
+@see @ref svd3x3()
 */
 /* The matrix is passed by value because it is changed inside */
 template<std::size_t cols, std::size_t rows, class T> std::tuple<RectangularMatrix<cols, rows, T>, Vector<cols, T>, Matrix<cols, T>> svd(RectangularMatrix<cols, rows, T> m) {
@@ -0,0 +1,292 @@
+#ifndef Magnum_Math_Algorithms_Svd3x3_h
+#define Magnum_Math_Algorithms_Svd3x3_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Algorithms::svd3x3(), @ref Magnum::Math::Algorithms::polarDecomposition(), @ref Magnum::Math::Algorithms::polarDecompositionBatch()
+ */
+
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <Corrade/Containers/ArrayReference.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix.h"
+#include "Magnum/Math/Quaternion.h"
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+namespace Implementation {
+
+/* Jacobi sweeps done on the symmetric matrix, enough for the off-diagonal
+   elements to get below the type precision */
+template<class T> struct Svd3x3Sweeps;
+template<> struct Svd3x3Sweeps<Float> { enum: std::size_t { Value = 5 }; };
+#ifndef MAGNUM_TARGET_GLES
+template<> struct Svd3x3Sweeps<Double> { enum: std::size_t { Value = 8 }; };
+#endif
+
+/* Inverse square root is on the critical path of every step, the fast
+   approximation is precise enough for Float */
+inline Float svd3x3SqrtInverted(const Float value) { return Math::sqrtInvertedFast(value); }
+#ifndef MAGNUM_TARGET_GLES
+inline Double svd3x3SqrtInverted(const Double value) { return Math::sqrtInverted(value); }
+#endif
+
+/* All helpers below process given count of independent matrices ("lanes")
+   in lockstep. A single matrix is a dependency chain of square roots and
+   divisions, with more lanes the CPU can overlap the chains and the compiler
+   is able to vectorize the loops, as there are no data-dependent branches. */
+
+/* Rotation of the symmetric matrix in plane of axes p and q, zeroing
+   (approximately) the off-diagonal element. Uses the half-angle
+   approximation from McAdams et al. with the angle falling back to π/4 if
+   the approximation is too imprecise, so no trigonometric functions are
+   needed. Accumulated into the quaternion, the rotation is around axis k. */
+template<std::size_t p, std::size_t q, std::size_t k, std::size_t lanes, class T> void svd3x3JacobiStep(Matrix3x3<T>(&s)[lanes], Quaternion<T>(&v)[lanes]) {
+    /* (3 + 2√2), cos(π/8), sin(π/8) */
+    constexpr T Gamma = T(5.82842712474619);
+    constexpr T CosPi8 = T(0.923879532511287);
+    constexpr T SinPi8 = T(0.38268343236509);
+
+    for(std::size_t l = 0; l != lanes; ++l) {
+        const T a = s[l][p][p];
+        const T b = s[l][q][p];
+        const T d = s[l][q][q];
+
+        T ch = T(2)*(a - d);
+        T sh = b;
+        const bool approximate = Gamma*sh*sh < ch*ch;
+        const T w = svd3x3SqrtInverted(ch*ch + sh*sh);
+        ch = approximate ? w*ch : CosPi8;
+        sh = approximate ? w*sh : SinPi8;
+
+        /* Skip rotations below machine precision, otherwise the off-diagonal
+           elements would eventually end up as slow denormals */
+        sh = std::abs(sh) > std::numeric_limits<T>::epsilon() ? sh : T(0);
+
+        /* Full-angle sine and cosine from the half-angle ones */
+        const T c = ch*ch - sh*sh;
+        const T sn = T(2)*ch*sh;
+
+        const T pk = s[l][p][k];
+        const T qk = s[l][q][k];
+        s[l][p][p] = c*c*a + T(2)*c*sn*b + sn*sn*d;
+        s[l][q][q] = sn*sn*a - T(2)*c*sn*b + c*c*d;
+        s[l][q][p] = s[l][p][q] = b*(c*c - sn*sn) - c*sn*(a - d);
+        s[l][k][p] = s[l][p][k] = c*pk + sn*qk;
+        s[l][k][q] = s[l][q][k] = c*qk - sn*pk;
+
+        Vector3<T> axis;
+        axis[k] = sh;
+        v[l] = v[l]*Quaternion<T>{axis, ch};
+    }
+}
+
+/* Swaps the two values if the condition is true, negating the second to
+   keep handedness if the values are columns */
+template<class T> inline void svd3x3ConditionalSwap(const bool swap, Vector<3, T>& a, Vector<3, T>& b) {
+    const Vector<3, T> t = a;
+    a = swap ? b : a;
+    b = swap ? -t : b;
+}
+
+template<class T> inline void svd3x3ConditionalSwap(const bool swap, T& a, T& b) {
+    const T t = a;
+    a = swap ? b : a;
+    b = swap ? t : b;
+}
+
+/* Sorts columns of both matrices by decreasing length of columns of b */
+template<std::size_t lanes, class T> void svd3x3Sort(Matrix3x3<T>(&b)[lanes], Matrix3x3<T>(&v)[lanes]) {
+    for(std::size_t l = 0; l != lanes; ++l) {
+        T rho0 = b[l][0].dot();
+        T rho1 = b[l][1].dot();
+        T rho2 = b[l][2].dot();
+        bool swap = rho0 < rho1;
+        svd3x3ConditionalSwap(swap, b[l][0], b[l][1]);
+        svd3x3ConditionalSwap(swap, v[l][0], v[l][1]);
+        svd3x3ConditionalSwap(swap, rho0, rho1);
+        swap = rho0 < rho2;
+        svd3x3ConditionalSwap(swap, b[l][0], b[l][2]);
+        svd3x3ConditionalSwap(swap, v[l][0], v[l][2]);
+        svd3x3ConditionalSwap(swap, rho0, rho2);
+        swap = rho1 < rho2;
+        svd3x3ConditionalSwap(swap, b[l][1], b[l][2]);
+        svd3x3ConditionalSwap(swap, v[l][1], v[l][2]);
+    }
+}
+
+/* Givens rotation of rows i and j zeroing element at column i, row j, the
+   transposed rotation is accumulated into u. The half-angle is chosen so the
+   diagonal element stays non-negative. */
+template<std::size_t i, std::size_t j, std::size_t lanes, class T> void svd3x3QrStep(Matrix3x3<T>(&r)[lanes], Matrix3x3<T>(&u)[lanes]) {
+    constexpr T Epsilon = TypeTraits<T>::epsilon()*TypeTraits<T>::epsilon();
+
+    for(std::size_t l = 0; l != lanes; ++l) {
+        const T a = r[l][i][i];
+        const T b = r[l][i][j];
+        const T rho = std::sqrt(a*a + b*b);
+        T sh = rho > Epsilon ? b : T(0);
+        T ch = std::abs(a) + std::max(rho, Epsilon);
+        svd3x3ConditionalSwap(a < T(0), sh, ch);
+        const T w = svd3x3SqrtInverted(ch*ch + sh*sh);
+        ch *= w;
+        sh *= w;
+
+        const T c = ch*ch - sh*sh;
+        const T sn = T(2)*ch*sh;
+        for(std::size_t col = 0; col != 3; ++col) {
+            const T ri = r[l][col][i];
+            const T rj = r[l][col][j];
+            r[l][col][i] = c*ri + sn*rj;
+            r[l][col][j] = c*rj - sn*ri;
+        }
+
+        const Vector<3, T> ui = u[l][i];
+        const Vector<3, T> uj = u[l][j];
+        u[l][i] = c*ui + sn*uj;
+        u[l][j] = c*uj - sn*ui;
+    }
+}
+
+template<std::size_t lanes, class T> void svd3x3(const Matrix3x3<T>* const m, Matrix3x3<T>* const u, Vector3<T>* const w, Matrix3x3<T>* const v) {
+    /* Eigenanalysis of the symmetric matrix */
+    Matrix3x3<T> s[lanes];
+    Quaternion<T> q[lanes];
+    for(std::size_t l = 0; l != lanes; ++l)
+        s[l] = m[l].transposed()*m[l];
+    for(std::size_t i = 0; i != Svd3x3Sweeps<T>::Value; ++i) {
+        svd3x3JacobiStep<0, 1, 2>(s, q);
+        svd3x3JacobiStep<1, 2, 0>(s, q);
+        svd3x3JacobiStep<2, 0, 1>(s, q);
+    }
+
+    /* Sort the columns by singular values */
+    Matrix3x3<T> b[lanes], vLanes[lanes];
+    for(std::size_t l = 0; l != lanes; ++l) {
+        vLanes[l] = q[l].normalized().toMatrix();
+        b[l] = m[l]*vLanes[l];
+    }
+    svd3x3Sort(b, vLanes);
+
+    /* QR decomposition, R is diagonal as the columns are orthogonal now */
+    Matrix3x3<T> uLanes[lanes];
+    svd3x3QrStep<0, 1>(b, uLanes);
+    svd3x3QrStep<0, 2>(b, uLanes);
+    svd3x3QrStep<1, 2>(b, uLanes);
+
+    for(std::size_t l = 0; l != lanes; ++l) {
+        u[l] = uLanes[l];
+        w[l] = {b[l][0][0], b[l][1][1], b[l][2][2]};
+        v[l] = vLanes[l];
+    }
+}
+
+}
+
+/**
+@brief Singular Value Decomposition of 3x3 matrix
+
+Specialized variant of @ref svd() for 3x3 matrices, with fixed count of
+iterations and no data-dependent branches, considerably faster especially
+when processing many matrices at once using @ref polarDecompositionBatch().
+Returns @f$ U @f$, diagonal of @f$ \Sigma @f$ and non-transposed @f$ V @f$
+such that @f[
+    M = U \Sigma V^T
+@f]
+Unlike @ref svd(), both @f$ U @f$ and @f$ V @f$ are always rotations (i.e.,
+with determinant @f$ 1 @f$) and the singular values are sorted in descending
+order, with the last one negative if the matrix has negative determinant.
+
+Implementation based on *McAdams, A.; Selle, A.; Tamstorf, R.; Teran, J.;
+Sifakis, E. (2011). "Computing the Singular Value Decomposition of 3x3
+matrices with minimal branching and elementary floating point operations"*:
+eigenvectors of @f$ M^T M @f$ are found using Jacobi iteration with the
+rotation accumulated in a quaternion, the singular values and @f$ U @f$ are
+then extracted using QR decomposition of @f$ M V @f$.
+@see @ref polarDecomposition()
+*/
+template<class T> std::tuple<Matrix3x3<T>, Vector3<T>, Matrix3x3<T>> svd3x3(const Matrix3x3<T>& m) {
+    Matrix3x3<T> u, v;
+    Vector3<T> w;
+    Implementation::svd3x3<1>(&m, &u, &w, &v);
+    return std::make_tuple(u, w, v);
+}
+
+/**
+@brief Polar decomposition of 3x3 matrix
+
+Decomposes the matrix into rotation @f$ R @f$ and symmetric stretch
+@f$ S @f$ such that @f[
+    M = R S
+@f]
+The rotation is calculated as @f$ U V^T @f$ from @ref svd3x3(), the stretch as
+@f$ V \Sigma V^T @f$. If the matrix has negative determinant, @f$ R @f$ is
+still a rotation and the reflection is contained in @f$ S @f$, which is the
+desired behavior when extracting rotation from animation or physics
+transformations.
+@see @ref polarDecompositionBatch()
+*/
+template<class T> std::pair<Matrix3x3<T>, Matrix3x3<T>> polarDecomposition(const Matrix3x3<T>& m) {
+    Matrix3x3<T> u, v;
+    Vector3<T> w;
+    Implementation::svd3x3<1>(&m, &u, &w, &v);
+    const Matrix3x3<T> vTransposed = v.transposed();
+    return {u*vTransposed, Matrix3x3<T>{v[0]*w[0], v[1]*w[1], v[2]*w[2]}*vTransposed};
+}
+
+/**
+@brief Extract rotations from many 3x3 matrices at once
+@param matrices     Matrices to decompose
+@param rotations    Output, must have the same size as @p matrices
+
+Calculates rotation part of @ref polarDecomposition() of each matrix. The
+matrices are processed four at a time, which hides latency of the
+calculation and allows the compiler to vectorize it.
+*/
+template<class T> void polarDecompositionBatch(const Corrade::Containers::ArrayReference<const Matrix3x3<T>> matrices, const Corrade::Containers::ArrayReference<Matrix3x3<T>> rotations) {
+    CORRADE_ASSERT(matrices.size() == rotations.size(),
+        "Math::Algorithms::polarDecompositionBatch(): expected" << matrices.size() << "output matrices but got" << rotations.size(), );
+
+    Matrix3x3<T> u[4], v[4];
+    Vector3<T> w[4];
+    std::size_t i = 0;
+    for(; i + 4 <= matrices.size(); i += 4) {
+        Implementation::svd3x3<4>(matrices.data() + i, u, w, v);
+        for(std::size_t l = 0; l != 4; ++l)
+            rotations[i + l] = u[l]*v[l].transposed();
+    }
+    for(; i != matrices.size(); ++i) {
+        Implementation::svd3x3<1>(matrices.data() + i, u, w, v);
+        rotations[i] = u[0]*v[0].transposed();
+    }
+}
+
+}}}
+
+#endif
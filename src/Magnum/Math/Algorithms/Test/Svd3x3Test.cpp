@@ -0,0 +1,182 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Algorithms/Svd3x3.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+struct Svd3x3Test: Corrade::TestSuite::Tester {
+    explicit Svd3x3Test();
+
+    void svd();
+    void svdNegativeDeterminant();
+    void svdRankDeficient();
+    void svdDouble();
+    void polarDecomposition();
+    void polarDecompositionNegativeDeterminant();
+    void polarDecompositionBatch();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Matrix3x3<Float> Matrix3x3;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Vector3<Float> Vector3;
+#ifndef MAGNUM_TARGET_GLES
+typedef Math::Matrix3x3<Double> Matrix3x3d;
+typedef Math::Matrix4<Double> Matrix4d;
+typedef Math::Vector3<Double> Vector3d;
+#endif
+
+namespace {
+    /* Rotation around arbitrary axis, scaling and another rotation */
+    const Matrix3x3 a = Matrix4::rotation(Deg(35.0f), Vector3(1.0f, 2.0f, -0.5f).normalized()).rotationScaling()*
+        Matrix3x3::fromDiagonal({3.0f, 1.0f, 2.0f})*
+        Matrix4::rotation(Deg(-70.0f), Vector3(0.3f, -1.0f, 0.8f).normalized()).rotationScaling();
+
+    Matrix3x3 reconstruct(const Matrix3x3& u, const Vector3& w, const Matrix3x3& v) {
+        return u*Matrix3x3::fromDiagonal(w)*v.transposed();
+    }
+}
+
+Svd3x3Test::Svd3x3Test() {
+    addTests({&Svd3x3Test::svd,
+              &Svd3x3Test::svdNegativeDeterminant,
+              &Svd3x3Test::svdRankDeficient,
+              &Svd3x3Test::svdDouble,
+              &Svd3x3Test::polarDecomposition,
+              &Svd3x3Test::polarDecompositionNegativeDeterminant,
+              &Svd3x3Test::polarDecompositionBatch});
+}
+
+void Svd3x3Test::svd() {
+    Matrix3x3 u, v;
+    Vector3 w;
+    std::tie(u, w, v) = Algorithms::svd3x3(a);
+
+    /* Sorted singular values */
+    CORRADE_COMPARE(w, Vector3(3.0f, 2.0f, 1.0f));
+
+    /* Both matrices are rotations */
+    CORRADE_COMPARE(u*u.transposed(), Matrix3x3());
+    CORRADE_COMPARE(v*v.transposed(), Matrix3x3());
+    CORRADE_COMPARE(u.determinant(), 1.0f);
+    CORRADE_COMPARE(v.determinant(), 1.0f);
+
+    CORRADE_COMPARE(reconstruct(u, w, v), a);
+}
+
+void Svd3x3Test::svdNegativeDeterminant() {
+    const Matrix3x3 b = a*Matrix3x3::fromDiagonal({1.0f, -1.0f, 1.0f});
+
+    Matrix3x3 u, v;
+    Vector3 w;
+    std::tie(u, w, v) = Algorithms::svd3x3(b);
+
+    /* The reflection is in the smallest singular value, not in U or V */
+    CORRADE_COMPARE(w, Vector3(3.0f, 2.0f, -1.0f));
+    CORRADE_COMPARE(u.determinant(), 1.0f);
+    CORRADE_COMPARE(v.determinant(), 1.0f);
+    CORRADE_COMPARE(reconstruct(u, w, v), b);
+}
+
+void Svd3x3Test::svdRankDeficient() {
+    /* Third column is linear combination of the first two */
+    const Matrix3x3 b{Vector3(1.0f, 2.0f, 3.0f),
+                      Vector3(-1.0f, 0.5f, 2.0f),
+                      Vector3(0.0f, 2.5f, 5.0f)};
+
+    Matrix3x3 u, v;
+    Vector3 w;
+    std::tie(u, w, v) = Algorithms::svd3x3(b);
+
+    CORRADE_VERIFY(std::abs(w[2]) < 1.0e-5f);
+    CORRADE_COMPARE(u.determinant(), 1.0f);
+    CORRADE_COMPARE(v.determinant(), 1.0f);
+    CORRADE_VERIFY(Math::abs((reconstruct(u, w, v) - b).toVector()).max() < 1.0e-5f);
+}
+
+void Svd3x3Test::svdDouble() {
+    #ifndef MAGNUM_TARGET_GLES
+    const Matrix3x3d b = Matrix4d::rotation(Math::Deg<Double>(35.0), Vector3d(1.0, 2.0, -0.5).normalized()).rotationScaling()*
+        Matrix3x3d::fromDiagonal({3.0, 1.0, 2.0});
+
+    Matrix3x3d u, v;
+    Vector3d w;
+    std::tie(u, w, v) = Algorithms::svd3x3(b);
+
+    CORRADE_COMPARE(w, Vector3d(3.0, 2.0, 1.0));
+    CORRADE_COMPARE(u*Matrix3x3d::fromDiagonal(w)*v.transposed(), b);
+    #else
+    CORRADE_SKIP("Double precision is not supported when targeting OpenGL ES.");
+    #endif
+}
+
+void Svd3x3Test::polarDecomposition() {
+    const Matrix3x3 rotation = Matrix4::rotation(Deg(35.0f), Vector3(1.0f, 2.0f, -0.5f).normalized()).rotationScaling();
+    const Matrix3x3 b = rotation*Matrix3x3::fromDiagonal({3.0f, 1.0f, 2.0f});
+
+    const std::pair<Matrix3x3, Matrix3x3> rs = Algorithms::polarDecomposition(b);
+    CORRADE_COMPARE(rs.first, rotation);
+    CORRADE_COMPARE(rs.second, Matrix3x3::fromDiagonal({3.0f, 1.0f, 2.0f}));
+    CORRADE_COMPARE(rs.first*rs.second, b);
+
+    /* Stretch is symmetric for general matrices */
+    const std::pair<Matrix3x3, Matrix3x3> rs2 = Algorithms::polarDecomposition(a);
+    CORRADE_COMPARE(rs2.first.determinant(), 1.0f);
+    CORRADE_COMPARE(rs2.second, rs2.second.transposed());
+    CORRADE_COMPARE(rs2.first*rs2.second, a);
+}
+
+void Svd3x3Test::polarDecompositionNegativeDeterminant() {
+    const Matrix3x3 rotation = Matrix4::rotation(Deg(35.0f), Vector3(1.0f, 2.0f, -0.5f).normalized()).rotationScaling();
+    const Matrix3x3 b = rotation*Matrix3x3::fromDiagonal({-2.0f, 2.0f, 2.0f});
+
+    /* The rotation part is still a rotation */
+    const std::pair<Matrix3x3, Matrix3x3> rs = Algorithms::polarDecomposition(b);
+    CORRADE_COMPARE(rs.first.determinant(), 1.0f);
+    CORRADE_COMPARE(rs.second.determinant(), -8.0f);
+    CORRADE_COMPARE(rs.first*rs.second, b);
+}
+
+void Svd3x3Test::polarDecompositionBatch() {
+    /* Seven matrices to test both the four-at-a-time and the remaining
+       path */
+    Matrix3x3 matrices[7];
+    for(std::size_t i = 0; i != 7; ++i)
+        matrices[i] = Matrix4::rotation(Deg(25.0f*i), Vector3(1.0f, Float(i), -1.0f).normalized()).rotationScaling()*
+            Matrix3x3::fromDiagonal({1.0f + i, 2.0f, 0.5f*i + 0.1f});
+
+    Matrix3x3 rotations[7];
+    Algorithms::polarDecompositionBatch<Float>(matrices, rotations);
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(rotations[i], Algorithms::polarDecomposition(matrices[i]).first);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::Svd3x3Test)
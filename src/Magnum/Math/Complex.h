@@ -53,7 +53,7 @@ namespace Implementation {
 @f]
 @see @ref Complex::dot() const
 */
-template<class T> inline T dot(const Complex<T>& a, const Complex<T>& b) {
+template<class T> constexpr T dot(const Complex<T>& a, const Complex<T>& b) {
     return a.real()*b.real() + a.imaginary()*b.imaginary();
 }
 
@@ -246,8 +246,8 @@ template<class T> class Complex {
          *
          * @see @ref operator+=(const Complex<T>&)
          */
-        Complex<T> operator+(const Complex<T>& other) const {
-            return Complex<T>(*this) += other;
+        constexpr Complex<T> operator+(const Complex<T>& other) const {
+            return {_real + other._real, _imaginary + other._imaginary};
         }
 
         /**
@@ -257,7 +257,7 @@ template<class T> class Complex {
          *      -c = -a -ib
          * @f]
          */
-        Complex<T> operator-() const {
+        constexpr Complex<T> operator-() const {
             return {-_real, -_imaginary};
         }
 
@@ -279,8 +279,8 @@ template<class T> class Complex {
          *
          * @see @ref operator-=(const Complex<T>&)
          */
-        Complex<T> operator-(const Complex<T>& other) const {
-            return Complex<T>(*this) -= other;
+        constexpr Complex<T> operator-(const Complex<T>& other) const {
+            return {_real - other._real, _imaginary - other._imaginary};
         }
 
         /**
@@ -301,8 +301,8 @@ template<class T> class Complex {
          *
          * @see @ref operator*=(T)
          */
-        Complex<T> operator*(T scalar) const {
-            return Complex<T>(*this) *= scalar;
+        constexpr Complex<T> operator*(T scalar) const {
+            return {_real*scalar, _imaginary*scalar};
         }
 
         /**
@@ -323,8 +323,8 @@ template<class T> class Complex {
          *
          * @see @ref operator/=(T)
          */
-        Complex<T> operator/(T scalar) const {
-            return Complex<T>(*this) /= scalar;
+        constexpr Complex<T> operator/(T scalar) const {
+            return {_real/scalar, _imaginary/scalar};
         }
 
         /**
@@ -334,7 +334,7 @@ template<class T> class Complex {
          *      c_0 c_1 = (a_0 + ib_0)(a_1 + ib_1) = (a_0 a_1 - b_0 b_1) + i(a_1 b_0 + a_0 b_1)
          * @f]
          */
-        Complex<T> operator*(const Complex<T>& other) const {
+        constexpr Complex<T> operator*(const Complex<T>& other) const {
             return {_real*other._real - _imaginary*other._imaginary,
                     _imaginary*other._real + _real*other._imaginary};
         }
@@ -349,7 +349,7 @@ template<class T> class Complex {
          * @f]
          * @see @ref dot(const Complex&, const Complex&), @ref isNormalized()
          */
-        T dot() const { return Math::dot(*this, *this); }
+        constexpr T dot() const { return Math::dot(*this, *this); }
 
         /**
          * @brief Complex number length
@@ -385,7 +385,7 @@ template<class T> class Complex {
          *      c^* = a - ib
          * @f]
          */
-        Complex<T> conjugated() const {
+        constexpr Complex<T> conjugated() const {
             return {_real, -_imaginary};
         }
 
@@ -438,7 +438,7 @@ template<class T> class Complex {
 
 Same as @ref Complex::operator*(T) const.
 */
-template<class T> inline Complex<T> operator*(T scalar, const Complex<T>& complex) {
+template<class T> constexpr Complex<T> operator*(T scalar, const Complex<T>& complex) {
     return complex*scalar;
 }
 
@@ -450,7 +450,7 @@ template<class T> inline Complex<T> operator*(T scalar, const Complex<T>& comple
 @f]
 @see @ref Complex::operator/()
 */
-template<class T> inline Complex<T> operator/(T scalar, const Complex<T>& complex) {
+template<class T> constexpr Complex<T> operator/(T scalar, const Complex<T>& complex) {
     return {scalar/complex.real(), scalar/complex.imaginary()};
 }
 
@@ -97,8 +97,8 @@ template<class T> class Dual {
          *
          * @see @ref operator+=()
          */
-        Dual<T> operator+(const Dual<T>& other) const {
-            return Dual<T>(*this)+=other;
+        constexpr Dual<T> operator+(const Dual<T>& other) const {
+            return {_real + other._real, _dual + other._dual};
         }
 
         /**
@@ -108,7 +108,7 @@ template<class T> class Dual {
          *      -\hat a = -a_0 - \epsilon a_\epsilon
          * @f]
          */
-        Dual<T> operator-() const {
+        constexpr Dual<T> operator-() const {
             return {-_real, -_dual};
         }
 
@@ -130,8 +130,8 @@ template<class T> class Dual {
          *
          * @see @ref operator-=()
          */
-        Dual<T> operator-(const Dual<T>& other) const {
-            return Dual<T>(*this)-=other;
+        constexpr Dual<T> operator-(const Dual<T>& other) const {
+            return {_real - other._real, _dual - other._dual};
         }
 
         /**
@@ -141,7 +141,7 @@ template<class T> class Dual {
          *      \hat a \hat b = a_0 b_0 + \epsilon (a_0 b_\epsilon + a_\epsilon b_0)
          * @f]
          */
-        template<class U> Dual<T> operator*(const Dual<U>& other) const {
+        template<class U> constexpr Dual<T> operator*(const Dual<U>& other) const {
             return {_real*other._real, _real*other._dual + _dual*other._real};
         }
 
@@ -152,7 +152,7 @@ template<class T> class Dual {
          *      \frac{\hat a}{\hat b} = \frac{a_0}{b_0} + \epsilon \frac{a_\epsilon b_0 - a_0 b_\epsilon}{b_0^2}
          * @f]
          */
-        template<class U> Dual<T> operator/(const Dual<U>& other) const {
+        template<class U> constexpr Dual<T> operator/(const Dual<U>& other) const {
             return {_real/other._real, (_dual*other._real - _real*other._dual)/(other._real*other._real)};
         }
 
@@ -163,7 +163,7 @@ template<class T> class Dual {
          *      \overline{\hat a} = a_0 - \epsilon a_\epsilon
          * @f]
          */
-        Dual<T> conjugated() const {
+        constexpr Dual<T> conjugated() const {
             return {_real, -_dual};
         }
 
@@ -173,27 +173,27 @@ template<class T> class Dual {
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
 #define MAGNUM_DUAL_SUBCLASS_IMPLEMENTATION(Type, Underlying)               \
-    Type<T> operator-() const {                                             \
+    constexpr Type<T> operator-() const {                                   \
         return Dual<Underlying<T>>::operator-();                            \
     }                                                                       \
     Type<T>& operator+=(const Dual<Underlying<T>>& other) {                 \
         Dual<Underlying<T>>::operator+=(other);                             \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator+(const Dual<Underlying<T>>& other) const {             \
+    constexpr Type<T> operator+(const Dual<Underlying<T>>& other) const {   \
         return Dual<Underlying<T>>::operator+(other);                       \
     }                                                                       \
     Type<T>& operator-=(const Dual<Underlying<T>>& other) {                 \
         Dual<Underlying<T>>::operator-=(other);                             \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator-(const Dual<Underlying<T>>& other) const {             \
+    constexpr Type<T> operator-(const Dual<Underlying<T>>& other) const {   \
         return Dual<Underlying<T>>::operator-(other);                       \
     }                                                                       \
-    template<class U> Type<T> operator*(const Dual<U>& other) const {       \
+    template<class U> constexpr Type<T> operator*(const Dual<U>& other) const { \
         return Dual<Underlying<T>>::operator*(other);                       \
     }                                                                       \
-    template<class U> Type<T> operator/(const Dual<U>& other) const {       \
+    template<class U> constexpr Type<T> operator/(const Dual<U>& other) const { \
         return Dual<Underlying<T>>::operator/(other);                       \
     }
 #endif
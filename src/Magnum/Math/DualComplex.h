@@ -181,7 +181,7 @@ template<class T> class DualComplex: public Dual<Complex<T>> {
          * @f]
          * @todo can this be done similarly to dual quaternions?
          */
-        DualComplex<T> operator*(const DualComplex<T>& other) const {
+        constexpr DualComplex<T> operator*(const DualComplex<T>& other) const {
             return {Dual<Complex<T>>::real()*other.real(), Dual<Complex<T>>::real()*other.dual() + Dual<Complex<T>>::dual()};
         }
 
@@ -194,7 +194,7 @@ template<class T> class DualComplex: public Dual<Complex<T>> {
          * @see @ref dualConjugated(), @ref conjugated(),
          *      @ref Complex::conjugated()
          */
-        DualComplex<T> complexConjugated() const {
+        constexpr DualComplex<T> complexConjugated() const {
             return {Dual<Complex<T>>::real().conjugated(), Dual<Complex<T>>::dual().conjugated()};
         }
 
@@ -207,7 +207,7 @@ template<class T> class DualComplex: public Dual<Complex<T>> {
          * @see @ref complexConjugated(), @ref conjugated(),
          *      @ref Dual::conjugated()
          */
-        DualComplex<T> dualConjugated() const {
+        constexpr DualComplex<T> dualConjugated() const {
             return Dual<Complex<T>>::conjugated();
         }
 
@@ -220,7 +220,7 @@ template<class T> class DualComplex: public Dual<Complex<T>> {
          * @see @ref complexConjugated(), @ref dualConjugated(),
          *      @ref Complex::conjugated(), @ref Dual::conjugated()
          */
-        DualComplex<T> conjugated() const {
+        constexpr DualComplex<T> conjugated() const {
             return {Dual<Complex<T>>::real().conjugated(), {-Dual<Complex<T>>::dual().real(), Dual<Complex<T>>::dual().imaginary()}};
         }
 
@@ -233,7 +233,7 @@ template<class T> class DualComplex: public Dual<Complex<T>> {
          * @f]
          * @todo Can this be done similarly to dual quaternins?
          */
-        T lengthSquared() const {
+        constexpr T lengthSquared() const {
             return Dual<Complex<T>>::real().dot();
         }
 
@@ -307,21 +307,21 @@ template<class T> class DualComplex: public Dual<Complex<T>> {
         /* Verbatim copy of DUAL_SUBCLASS_IMPLEMENTATION(), as we need to hide
            Dual's operator*() and operator/() */
         #ifndef DOXYGEN_GENERATING_OUTPUT
-        DualComplex<T> operator-() const {
+        constexpr DualComplex<T> operator-() const {
             return Dual<Complex<T>>::operator-();
         }
         DualComplex<T>& operator+=(const Dual<Complex<T>>& other) {
             Dual<Complex<T>>::operator+=(other);
             return *this;
         }
-        DualComplex<T> operator+(const Dual<Complex<T>>& other) const {
+        constexpr DualComplex<T> operator+(const Dual<Complex<T>>& other) const {
             return Dual<Complex<T>>::operator+(other);
         }
         DualComplex<T>& operator-=(const Dual<Complex<T>>& other) {
             Dual<Complex<T>>::operator-=(other);
             return *this;
         }
-        DualComplex<T> operator-(const Dual<Complex<T>>& other) const {
+        constexpr DualComplex<T> operator-(const Dual<Complex<T>>& other) const {
             return Dual<Complex<T>>::operator-(other);
         }
         #endif
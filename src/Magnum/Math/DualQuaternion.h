@@ -193,7 +193,7 @@ template<class T> class DualQuaternion: public Dual<Quaternion<T>> {
          * @see @ref dualConjugated(), @ref conjugated(),
          *      @ref Quaternion::conjugated()
          */
-        DualQuaternion<T> quaternionConjugated() const {
+        constexpr DualQuaternion<T> quaternionConjugated() const {
             return {Dual<Quaternion<T>>::real().conjugated(), Dual<Quaternion<T>>::dual().conjugated()};
         }
 
@@ -206,7 +206,7 @@ template<class T> class DualQuaternion: public Dual<Quaternion<T>> {
          * @see @ref quaternionConjugated(), @ref conjugated(),
          *      @ref Dual::conjugated()
          */
-        DualQuaternion<T> dualConjugated() const {
+        constexpr DualQuaternion<T> dualConjugated() const {
             return Dual<Quaternion<T>>::conjugated();
         }
 
@@ -219,7 +219,7 @@ template<class T> class DualQuaternion: public Dual<Quaternion<T>> {
          * @see @ref quaternionConjugated(), @ref dualConjugated(),
          *      @ref Quaternion::conjugated(), @ref Dual::conjugated()
          */
-        DualQuaternion<T> conjugated() const {
+        constexpr DualQuaternion<T> conjugated() const {
             return {Dual<Quaternion<T>>::real().conjugated(), {Dual<Quaternion<T>>::dual().vector(), -Dual<Quaternion<T>>::dual().scalar()}};
         }
 
@@ -232,7 +232,7 @@ template<class T> class DualQuaternion: public Dual<Quaternion<T>> {
          *      |\hat q|^2 = \sqrt{\hat q^* \hat q}^2 = q_0 \cdot q_0 + \epsilon 2 (q_0 \cdot q_\epsilon)
          * @f]
          */
-        Dual<T> lengthSquared() const {
+        constexpr Dual<T> lengthSquared() const {
             return {Dual<Quaternion<T>>::real().dot(), T(2)*dot(Dual<Quaternion<T>>::real(), Dual<Quaternion<T>>::dual())};
         }
 
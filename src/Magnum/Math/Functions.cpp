@@ -25,6 +25,18 @@
 
 #include "Functions.h"
 
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Implementation/Simd.h"
+
+#if defined(MAGNUM_MATH_SSE) && defined(__F16C__)
+#define MAGNUM_MATH_F16C
+#include <immintrin.h>
+#elif defined(MAGNUM_MATH_NEON) && (defined(__aarch64__) || (defined(__ARM_FP) && (__ARM_FP & 2)))
+#define MAGNUM_MATH_NEON_FP16
+#endif
+
 namespace Magnum { namespace Math {
 
 UnsignedInt log2(UnsignedInt number) {
@@ -41,4 +53,101 @@ UnsignedInt log(UnsignedInt base, UnsignedInt number) {
     return log;
 }
 
+/* Based on https://gist.github.com/rygorous/2156668 */
+UnsignedShort packHalf(const Float value) {
+    UnsignedInt bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const UnsignedInt sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    UnsignedInt out;
+
+    /* Too large for half, infinity or NaN */
+    if(bits >= (127u + 16u) << 23)
+        out = bits > 255u << 23 ? 0x7e00 : 0x7c00;
+
+    /* Denormal half or zero, let the FPU do the rounding by adding a magic
+       value that aligns the mantissa */
+    else if(bits < 113u << 23) {
+        const UnsignedInt magicBits = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+        Float magic, f;
+        std::memcpy(&magic, &magicBits, sizeof(magic));
+        std::memcpy(&f, &bits, sizeof(f));
+        f += magic;
+        std::memcpy(&bits, &f, sizeof(bits));
+        out = bits - magicBits;
+
+    /* Normal half, rebias the exponent and round the mantissa to nearest
+       even */
+    } else {
+        const UnsignedInt mantissaOdd = (bits >> 13) & 1;
+        bits += ((15u - 127u) << 23) + 0xfff + mantissaOdd;
+        out = bits >> 13;
+    }
+
+    return UnsignedShort(out | (sign >> 16));
+}
+
+Float unpackHalf(const UnsignedShort value) {
+    const UnsignedInt shiftedExponent = 0x7c00u << 13;
+    UnsignedInt bits = (value & 0x7fffu) << 13;
+    const UnsignedInt exponent = bits & shiftedExponent;
+    bits += (127u - 15u) << 23;
+
+    /* Infinity or NaN */
+    if(exponent == shiftedExponent)
+        bits += (128u - 16u) << 23;
+
+    /* Zero or denormal, renormalize */
+    else if(exponent == 0) {
+        bits += 1u << 23;
+        const UnsignedInt magicBits = 113u << 23;
+        Float magic, f;
+        std::memcpy(&magic, &magicBits, sizeof(magic));
+        std::memcpy(&f, &bits, sizeof(f));
+        f -= magic;
+        std::memcpy(&bits, &f, sizeof(bits));
+    }
+
+    bits |= UnsignedInt(value & 0x8000u) << 16;
+
+    Float out;
+    std::memcpy(&out, &bits, sizeof(out));
+    return out;
+}
+
+void packHalf(const Corrade::Containers::ArrayReference<const Float> input, const Corrade::Containers::ArrayReference<UnsignedShort> output) {
+    CORRADE_ASSERT(input.size() == output.size(),
+        "Math::packHalf(): expected output array of size" << input.size() << "but got" << output.size(), );
+
+    std::size_t i = 0;
+    #if defined(MAGNUM_MATH_F16C)
+    for(; i + 8 <= input.size(); i += 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output.data() + i),
+            _mm256_cvtps_ph(_mm256_loadu_ps(input.data() + i), _MM_FROUND_TO_NEAREST_INT));
+    #elif defined(MAGNUM_MATH_NEON_FP16)
+    for(; i + 4 <= input.size(); i += 4)
+        vst1_u16(output.data() + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(input.data() + i))));
+    #endif
+
+    for(; i != input.size(); ++i) output[i] = packHalf(input[i]);
+}
+
+void unpackHalf(const Corrade::Containers::ArrayReference<const UnsignedShort> input, const Corrade::Containers::ArrayReference<Float> output) {
+    CORRADE_ASSERT(input.size() == output.size(),
+        "Math::unpackHalf(): expected output array of size" << input.size() << "but got" << output.size(), );
+
+    std::size_t i = 0;
+    #if defined(MAGNUM_MATH_F16C)
+    for(; i + 8 <= input.size(); i += 8)
+        _mm256_storeu_ps(output.data() + i,
+            _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + i))));
+    #elif defined(MAGNUM_MATH_NEON_FP16)
+    for(; i + 4 <= input.size(); i += 4)
+        vst1q_f32(output.data() + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(input.data() + i))));
+    #endif
+
+    for(; i != input.size(); ++i) output[i] = unpackHalf(input[i]);
+}
+
 }}
@@ -30,9 +30,11 @@
  */
 
 #include <cmath>
+#include <cstring>
 #include <limits>
 #include <type_traits>
 #include <utility>
+#include <Corrade/Containers/ArrayReference.h>
 
 #include "Magnum/visibility.h"
 #include "Magnum/Math/Vector.h"
@@ -79,6 +81,43 @@ UnsignedInt MAGNUM_EXPORT log2(UnsignedInt number);
  */
 UnsignedInt MAGNUM_EXPORT log(UnsignedInt base, UnsignedInt number);
 
+/**
+ * @brief Pack 32-bit float value into 16-bit half-float representation
+ *
+ * Rounds to nearest even, values too large for half-float representation
+ * are converted to infinity, NaN is preserved.
+ * @see @ref unpackHalf()
+ */
+UnsignedShort MAGNUM_EXPORT packHalf(Float value);
+
+/**
+ * @brief Unpack 16-bit half-float representation into 32-bit float value
+ *
+ * The conversion is exact.
+ * @see @ref packHalf()
+ */
+Float MAGNUM_EXPORT unpackHalf(UnsignedShort value);
+
+/**
+ * @brief Pack array of 32-bit floats into 16-bit half-float representation
+ *
+ * Batch variant of @ref packHalf(Float). Expects that both arrays have the
+ * same size. Uses F16C instructions on x86 and NEON half-float conversion
+ * on ARM if the library is compiled with them enabled (e.g. with `-mf16c`),
+ * otherwise falls back to the scalar variant. The results are the same
+ * except for NaN payload.
+ */
+void MAGNUM_EXPORT packHalf(Corrade::Containers::ArrayReference<const Float> input, Corrade::Containers::ArrayReference<UnsignedShort> output);
+
+/**
+ * @brief Unpack array of 16-bit half-floats into 32-bit float values
+ *
+ * Batch variant of @ref unpackHalf(UnsignedShort). Expects that both arrays
+ * have the same size. Uses the same instructions as
+ * @ref packHalf(Corrade::Containers::ArrayReference<const Float>, Corrade::Containers::ArrayReference<UnsignedShort>).
+ */
+void MAGNUM_EXPORT unpackHalf(Corrade::Containers::ArrayReference<const UnsignedShort> input, Corrade::Containers::ArrayReference<Float> output);
+
 /** @todo Can't trigonometric functions be done with only one overload? */
 
 /** @brief Sine */
@@ -114,6 +153,185 @@ template<class T> inline Rad<T> acos(T value) { return Rad<T>(std::acos(value));
 /** @brief Arc tangent */
 template<class T> inline Rad<T> atan(T value) { return Rad<T>(std::atan(value)); }
 
+/**
+@brief Sine and cosine
+
+Returns sine as first value and cosine as second. Cheaper than calling
+@ref sin() and @ref cos() separately where the compiler fuses both into a
+single `sincos()` call.
+@see @ref sincosFast()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> inline std::pair<T, T> sincos(Rad<T> angle);
+#else
+template<class T> inline std::pair<T, T> sincos(Unit<Rad, T> angle) {
+    return {std::sin(T(angle)), std::cos(T(angle))};
+}
+template<class T> inline std::pair<T, T> sincos(Unit<Deg, T> angle) { return sincos(Rad<T>(angle)); }
+#endif
+
+namespace Implementation {
+    /* Reduces the angle to [-π, π] with τ split into two parts to keep the
+       reduction exact for large angles, rounding is done by adding and
+       subtracting 1.5*2^23 */
+    inline Float reduceAngleFast(const Float angle) {
+        const Float n = (angle*0.159154943f + 12582912.0f) - 12582912.0f;
+        return (angle - n*6.28125f) - n*0.00193530717f;
+    }
+
+    /* Mirrors the angle from [-π, 3π/2] to [-π/2, π/2] and evaluates
+       minimax polynomial of sine there */
+    inline Float sinFastReduced(Float x) {
+        x = std::max(std::min(x, 3.14159265f - x), -3.14159265f - x);
+        const Float x2 = x*x;
+        return x*(1.0f + x2*(-0.166656823f + x2*(0.00831238262f + x2*-0.000184926817f)));
+    }
+
+    /* Abramowitz & Stegun 4.4.45 for arccosine of value in [0, 1] */
+    inline Float acosFastPositive(const Float value) {
+        return std::sqrt(1.0f - value)*(1.5707288f + value*(-0.2121144f + value*(0.0742610f + value*-0.0187293f)));
+    }
+}
+
+/**
+@brief Fast approximate sine
+
+Range reduction and a seventh-degree polynomial. Maximal absolute error
+compared to @ref sin() is @f$ 2 \cdot 10^{-6} @f$ for angles of magnitude up
+to @f$ 10^4 @f$ radians, the result is always in range @f$ [-1, 1] @f$.
+Available only for @ref Magnum::Float "Float".
+@see @ref cosFast(), @ref sincosFast()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+inline Float sinFast(Rad<Float> angle);
+#else
+inline Float sinFast(Unit<Rad, Float> angle) {
+    return Implementation::sinFastReduced(Implementation::reduceAngleFast(Float(angle)));
+}
+inline Float sinFast(Unit<Deg, Float> angle) { return sinFast(Rad<Float>(angle)); }
+#endif
+
+/**
+@brief Fast approximate cosine
+
+Sine shifted by @f$ \frac{\pi}{2} @f$ after range reduction, with the same
+error bounds as @ref sinFast().
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+inline Float cosFast(Rad<Float> angle);
+#else
+inline Float cosFast(Unit<Rad, Float> angle) {
+    return Implementation::sinFastReduced(Implementation::reduceAngleFast(Float(angle)) + 1.57079633f);
+}
+inline Float cosFast(Unit<Deg, Float> angle) { return cosFast(Rad<Float>(angle)); }
+#endif
+
+/**
+@brief Fast approximate sine and cosine
+
+Equivalent to calling @ref sinFast() and @ref cosFast(), but the range
+reduction is done only once.
+@see @ref sincos()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+inline std::pair<Float, Float> sincosFast(Rad<Float> angle);
+#else
+inline std::pair<Float, Float> sincosFast(Unit<Rad, Float> angle) {
+    const Float reduced = Implementation::reduceAngleFast(Float(angle));
+    return {Implementation::sinFastReduced(reduced),
+            Implementation::sinFastReduced(reduced + 1.57079633f)};
+}
+inline std::pair<Float, Float> sincosFast(Unit<Deg, Float> angle) { return sincosFast(Rad<Float>(angle)); }
+#endif
+
+/**
+@brief Fast approximate sine of vector components
+
+Angles are in radians. Uses SSE or NEON on four-component vectors if the
+library is built with SIMD enabled.
+@see @ref sinFast(Rad<Float>)
+*/
+template<std::size_t size> inline Vector<size, Float> sinFast(const Vector<size, Float>& angles) {
+    Vector<size, Float> out;
+    for(std::size_t i = 0; i != size; ++i)
+        out[i] = Implementation::sinFastReduced(Implementation::reduceAngleFast(angles[i]));
+    return out;
+}
+
+/**
+@brief Fast approximate cosine of vector components
+
+Angles are in radians. Uses SSE or NEON on four-component vectors if the
+library is built with SIMD enabled.
+@see @ref cosFast(Rad<Float>)
+*/
+template<std::size_t size> inline Vector<size, Float> cosFast(const Vector<size, Float>& angles) {
+    Vector<size, Float> out;
+    for(std::size_t i = 0; i != size; ++i)
+        out[i] = Implementation::sinFastReduced(Implementation::reduceAngleFast(angles[i]) + 1.57079633f);
+    return out;
+}
+
+/**
+@brief Fast approximate sine and cosine of vector components
+
+Angles are in radians. Uses SSE or NEON on four-component vectors if the
+library is built with SIMD enabled.
+@see @ref sincosFast(Rad<Float>)
+*/
+template<std::size_t size> inline std::pair<Vector<size, Float>, Vector<size, Float>> sincosFast(const Vector<size, Float>& angles) {
+    std::pair<Vector<size, Float>, Vector<size, Float>> out;
+    for(std::size_t i = 0; i != size; ++i) {
+        const Float reduced = Implementation::reduceAngleFast(angles[i]);
+        out.first[i] = Implementation::sinFastReduced(reduced);
+        out.second[i] = Implementation::sinFastReduced(reduced + 1.57079633f);
+    }
+    return out;
+}
+
+#if defined(MAGNUM_MATH_SIMD) && !defined(DOXYGEN_GENERATING_OUTPUT)
+inline Vector<4, Float> sinFast(const Vector<4, Float>& angles) {
+    Vector<4, Float> out;
+    Implementation::simdSinCosFast4(angles.data(), out.data(), nullptr);
+    return out;
+}
+
+inline Vector<4, Float> cosFast(const Vector<4, Float>& angles) {
+    Vector<4, Float> out;
+    Implementation::simdSinCosFast4(angles.data(), nullptr, out.data());
+    return out;
+}
+
+inline std::pair<Vector<4, Float>, Vector<4, Float>> sincosFast(const Vector<4, Float>& angles) {
+    std::pair<Vector<4, Float>, Vector<4, Float>> out;
+    Implementation::simdSinCosFast4(angles.data(), out.first.data(), out.second.data());
+    return out;
+}
+#endif
+
+/**
+@brief Fast approximate arc sine
+
+Polynomial approximation from Abramowitz & Stegun, formula 4.4.45. Maximal
+absolute error compared to @ref asin() is @f$ 7 \cdot 10^{-5} @f$. Expects
+that the value is in range @f$ [-1, 1] @f$. Available only for
+@ref Magnum::Float "Float".
+*/
+inline Rad<Float> asinFast(const Float value) {
+    const Float r = 1.57079633f - Implementation::acosFastPositive(std::abs(value));
+    return Rad<Float>(value < 0.0f ? -r : r);
+}
+
+/**
+@brief Fast approximate arc cosine
+
+Same approximation and error bounds as @ref asinFast().
+*/
+inline Rad<Float> acosFast(const Float value) {
+    const Float r = Implementation::acosFastPositive(std::abs(value));
+    return Rad<Float>(value < 0.0f ? 3.14159265f - r : r);
+}
+
 /**
 @{ @name Scalar/vector functions
 
@@ -349,6 +567,48 @@ template<std::size_t size, class T> Vector<size, T> sqrtInverted(const Vector<si
 }
 #endif
 
+/**
+@brief Fast approximate inverse square root
+
+Hardware estimate refined with one Newton-Raphson step on SSE, elsewhere an
+integer approximation refined with two steps. Maximal relative error compared
+to @ref sqrtInverted() is @f$ 5 \cdot 10^{-6} @f$ for positive normal values.
+Vector overload operates component-wise, using SSE or NEON on four-component
+vectors if the library is built with SIMD enabled. Available only for
+@ref Magnum::Float "Float".
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> inline T sqrtInvertedFast(const T& a);
+#else
+inline Float sqrtInvertedFast(const Float a) {
+    #ifdef MAGNUM_MATH_SSE
+    const Float r = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a)));
+    return r*(1.5f - 0.5f*a*r*r);
+    #else
+    UnsignedInt i;
+    std::memcpy(&i, &a, sizeof(Float));
+    i = 0x5f375a86 - (i >> 1);
+    Float r;
+    std::memcpy(&r, &i, sizeof(Float));
+    r = r*(1.5f - 0.5f*a*r*r);
+    return r*(1.5f - 0.5f*a*r*r);
+    #endif
+}
+template<std::size_t size> inline Vector<size, Float> sqrtInvertedFast(const Vector<size, Float>& a) {
+    Vector<size, Float> out;
+    for(std::size_t i = 0; i != size; ++i)
+        out[i] = sqrtInvertedFast(a[i]);
+    return out;
+}
+#ifdef MAGNUM_MATH_SIMD
+inline Vector<4, Float> sqrtInvertedFast(const Vector<4, Float>& a) {
+    Vector<4, Float> out;
+    Implementation::simdSqrtInvertedFast4(a.data(), out.data());
+    return out;
+}
+#endif
+#endif
+
 /**
 @brief Linear interpolation of two values
 @param a     First value
@@ -0,0 +1,145 @@
+#ifndef Magnum_Math_Geometry_BoundingSphere_h
+#define Magnum_Math_Geometry_BoundingSphere_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::Geometry::BoundingSphere
+ */
+
+#include <utility>
+#include <Corrade/Containers/ArrayReference.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Math { namespace Geometry {
+
+/** @brief Functions for computing bounding spheres */
+class BoundingSphere {
+    public:
+        BoundingSphere() = delete;
+
+        /**
+         * @brief Bounding sphere of given points
+         * @return Sphere center and radius
+         *
+         * Computes an approximate bounding sphere in two linear passes. The
+         * initial sphere is spanned by the most distant pair of points
+         * extremal along the coordinate axes and the space diagonals (i.e.
+         * the extremal set of the EPOS-14 algorithm), it is then grown to
+         * include all points that lie outside of it (Ritter's algorithm). The result is usually within a few percent of the
+         * minimal bounding sphere. Returns zero center and radius if
+         * @p points is empty.
+         */
+        template<class T> static std::pair<Vector3<T>, T> fromPoints(Corrade::Containers::ArrayReference<const Vector3<T>> points) {
+            return fromPoints(points.data(), points.size(), sizeof(Vector3<T>));
+        }
+
+        /**
+         * @brief Bounding sphere of given strided points
+         * @param points    Pointer to the first point
+         * @param count     Point count
+         * @param stride    Distance between two consecutive points in bytes
+         *
+         * Useful for e.g. positions in interleaved vertex data. See
+         * @ref fromPoints(Corrade::Containers::ArrayReference<const Vector3<T>>)
+         * for more information.
+         */
+        template<class T> static std::pair<Vector3<T>, T> fromPoints(const Vector3<T>* points, std::size_t count, std::size_t stride);
+};
+
+template<class T> std::pair<Vector3<T>, T> BoundingSphere::fromPoints(const Vector3<T>* const points, const std::size_t count, const std::size_t stride) {
+    if(!count) return {};
+
+    const char* const data = reinterpret_cast<const char*>(points);
+    auto point = [data, stride](std::size_t i) -> const Vector3<T>& {
+        return *reinterpret_cast<const Vector3<T>*>(data + i*stride);
+    };
+
+    /* Directions in which the extremal points are searched */
+    const Vector3<T> directions[]{
+        {T(1), T(0), T(0)},
+        {T(0), T(1), T(0)},
+        {T(0), T(0), T(1)},
+        {T(1), T(1), T(1)},
+        {T(1), T(1), T(-1)},
+        {T(1), T(-1), T(1)},
+        {T(1), T(-1), T(-1)}
+    };
+    constexpr std::size_t directionCount = sizeof(directions)/sizeof(directions[0]);
+
+    /* First pass: find extremal points along all directions */
+    std::size_t minIndex[directionCount]{}, maxIndex[directionCount]{};
+    T minProjection[directionCount], maxProjection[directionCount];
+    for(std::size_t j = 0; j != directionCount; ++j)
+        minProjection[j] = maxProjection[j] = dot(point(0), directions[j]);
+    for(std::size_t i = 1; i != count; ++i) {
+        for(std::size_t j = 0; j != directionCount; ++j) {
+            const T projection = dot(point(i), directions[j]);
+            if(projection < minProjection[j]) {
+                minProjection[j] = projection;
+                minIndex[j] = i;
+            } else if(projection > maxProjection[j]) {
+                maxProjection[j] = projection;
+                maxIndex[j] = i;
+            }
+        }
+    }
+
+    /* Initial sphere spanned by the most distant extremal pair */
+    std::size_t a = minIndex[0], b = maxIndex[0];
+    T distanceSquared = (point(b) - point(a)).dot();
+    for(std::size_t j = 1; j != directionCount; ++j) {
+        const T d = (point(maxIndex[j]) - point(minIndex[j])).dot();
+        if(d > distanceSquared) {
+            distanceSquared = d;
+            a = minIndex[j];
+            b = maxIndex[j];
+        }
+    }
+    Vector3<T> center = (point(a) + point(b))/T(2);
+    T radius = std::sqrt(distanceSquared)/T(2);
+    T radiusSquared = radius*radius;
+
+    /* Second pass: grow the sphere to include all outlying points */
+    for(std::size_t i = 0; i != count; ++i) {
+        const Vector3<T> difference = point(i) - center;
+        const T dSquared = difference.dot();
+        if(dSquared <= radiusSquared) continue;
+
+        const T d = std::sqrt(dSquared);
+        const T newRadius = (radius + d)/T(2);
+        center += difference*((newRadius - radius)/d);
+        radius = newRadius;
+        radiusSquared = radius*radius;
+    }
+
+    return {center, radius};
+}
+
+}}}
+
+#endif
@@ -29,11 +29,18 @@
  * @brief Class @ref Magnum::Math::Geometry::Distance
  */
 
+#include <Corrade/Containers/ArrayReference.h>
+
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Implementation/Simd.h"
 
 namespace Magnum { namespace Math { namespace Geometry {
 
+namespace Implementation {
+    template<class T> struct DistanceBatch;
+}
+
 /** @brief Functions for computing distances */
 class Distance {
     public:
@@ -162,8 +169,126 @@ class Distance {
          * the square root.
          */
         template<class T> static T lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& point);
+
+        /**
+         * @brief Distances of points from line segment in 2D, squared
+         * @param a         Starting point of the line segment
+         * @param b         Ending point of the line segment
+         * @param points    Points
+         * @param distances Output, must have the same size as @p points
+         *
+         * Batch variant of
+         * @ref lineSegmentPointSquared(const Vector2<T>&, const Vector2<T>&, const Vector2<T>&).
+         * The point is projected onto the segment and the projection is
+         * clamped, which gives the same result without branches, so the loop
+         * can be vectorized by the compiler. The results may differ from the
+         * single-point variant in the last few bits.
+         */
+        template<class T> static void lineSegmentPointSquared(const Vector2<T>& a, const Vector2<T>& b, Corrade::Containers::ArrayReference<const typename Math::Implementation::NonDeduced<Vector2<T>>::Type> points, Corrade::Containers::ArrayReference<typename Math::Implementation::NonDeduced<T>::Type> distances);
+
+        /**
+         * @brief Distances of points from line segment in 3D, squared
+         * @param a         Starting point of the line segment
+         * @param b         Ending point of the line segment
+         * @param points    Points
+         * @param distances Output, must have the same size as @p points
+         *
+         * Batch variant of
+         * @ref lineSegmentPointSquared(const Vector3<T>&, const Vector3<T>&, const Vector3<T>&),
+         * see the 2D batch variant above for more information. If the
+         * target supports SSE, the @ref Magnum::Float "Float" variant
+         * processes four points at once using SSE intrinsics.
+         */
+        template<class T> static void lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, Corrade::Containers::ArrayReference<const typename Math::Implementation::NonDeduced<Vector3<T>>::Type> points, Corrade::Containers::ArrayReference<typename Math::Implementation::NonDeduced<T>::Type> distances);
+
+        /**
+         * @brief Distances of point from line segments in 3D, squared
+         * @param a         Starting points of the line segments
+         * @param b         Ending points of the line segments
+         * @param point     Point
+         * @param distances Output, must have the same size as @p a and @p b
+         *
+         * Batch variant of
+         * @ref lineSegmentPointSquared(const Vector3<T>&, const Vector3<T>&, const Vector3<T>&)
+         * for testing one point against many segments, e.g. for snapping.
+         * Uses the same branchless formulation as the batch variants above.
+         */
+        template<class T> static void lineSegmentPointSquared(Corrade::Containers::ArrayReference<const typename Math::Implementation::NonDeduced<Vector3<T>>::Type> a, Corrade::Containers::ArrayReference<const typename Math::Implementation::NonDeduced<Vector3<T>>::Type> b, const Vector3<T>& point, Corrade::Containers::ArrayReference<typename Math::Implementation::NonDeduced<T>::Type> distances);
 };
 
+namespace Implementation {
+
+/* Branchless distance of point from segment, abDotInverse is 1/|b - a|^2 or
+   zero for a degenerate segment */
+template<std::size_t size, class T> inline T lineSegmentPointSquaredClamped(const Vector<size, T>& a, const Vector<size, T>& ab, const T abDotInverse, const Vector<size, T>& point) {
+    const Vector<size, T> pa = point - a;
+    const T t = Math::clamp(dot(pa, ab)*abDotInverse, T(0), T(1));
+    return (pa - ab*t).dot();
+}
+
+template<std::size_t size, class T> void lineSegmentPointSquaredBatch(const Vector<size, T>& a, const Vector<size, T>& b, const Vector<size, T>* const points, T* const distances, const std::size_t count) {
+    const Vector<size, T> ab = b - a;
+    const T abDot = ab.dot();
+    const T abDotInverse = abDot == T(0) ? T(0) : T(1)/abDot;
+    for(std::size_t i = 0; i != count; ++i)
+        distances[i] = lineSegmentPointSquaredClamped(a, ab, abDotInverse, points[i]);
+}
+
+template<class T> struct DistanceBatch {
+    template<std::size_t size> static void lineSegmentPointSquared(const Vector<size, T>& a, const Vector<size, T>& b, const Vector<size, T>* const points, T* const distances, const std::size_t count) {
+        lineSegmentPointSquaredBatch(a, b, points, distances, count);
+    }
+};
+
+#ifdef MAGNUM_MATH_SSE
+template<> struct DistanceBatch<Float> {
+    template<std::size_t size> static void lineSegmentPointSquared(const Vector<size, Float>& a, const Vector<size, Float>& b, const Vector<size, Float>* const points, Float* const distances, const std::size_t count) {
+        lineSegmentPointSquaredBatch(a, b, points, distances, count);
+    }
+
+    static void lineSegmentPointSquared(const Vector<3, Float>& a, const Vector<3, Float>& b, const Vector<3, Float>* const points, Float* const distances, const std::size_t count) {
+        const Vector<3, Float> ab = b - a;
+        const Float abDot = ab.dot();
+        const Float abDotInverse = abDot == 0.0f ? 0.0f : 1.0f/abDot;
+
+        const __m128 ax = _mm_set1_ps(a[0]), ay = _mm_set1_ps(a[1]), az = _mm_set1_ps(a[2]);
+        const __m128 abx = _mm_set1_ps(ab[0]), aby = _mm_set1_ps(ab[1]), abz = _mm_set1_ps(ab[2]);
+        const __m128 inverse = _mm_set1_ps(abDotInverse);
+        const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+
+        /* Four points at a time. The points are tightly packed, load them as
+           three vectors and transpose to X, Y and Z components. */
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            const Float* const data = points[i].data();
+            const __m128 m0 = _mm_loadu_ps(data + 0); /* x0 y0 z0 x1 */
+            const __m128 m1 = _mm_loadu_ps(data + 4); /* y1 z1 x2 y2 */
+            const __m128 m2 = _mm_loadu_ps(data + 8); /* z2 x3 y3 z3 */
+            const __m128 t0 = _mm_shuffle_ps(m1, m2, _MM_SHUFFLE(2, 1, 3, 2)); /* x2 y2 x3 y3 */
+            const __m128 t1 = _mm_shuffle_ps(m0, m1, _MM_SHUFFLE(1, 0, 2, 1)); /* y0 z0 y1 z1 */
+            const __m128 px = _mm_sub_ps(_mm_shuffle_ps(m0, t0, _MM_SHUFFLE(2, 0, 3, 0)), ax);
+            const __m128 py = _mm_sub_ps(_mm_shuffle_ps(t1, t0, _MM_SHUFFLE(3, 1, 2, 0)), ay);
+            const __m128 pz = _mm_sub_ps(_mm_shuffle_ps(t1, m2, _MM_SHUFFLE(3, 0, 3, 1)), az);
+
+            /* Projection parameter, clamped to the segment */
+            __m128 t = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, abx), _mm_mul_ps(py, aby)), _mm_mul_ps(pz, abz));
+            t = _mm_min_ps(_mm_max_ps(_mm_mul_ps(t, inverse), zero), one);
+
+            const __m128 dx = _mm_sub_ps(px, _mm_mul_ps(abx, t));
+            const __m128 dy = _mm_sub_ps(py, _mm_mul_ps(aby, t));
+            const __m128 dz = _mm_sub_ps(pz, _mm_mul_ps(abz, t));
+            _mm_storeu_ps(distances + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)));
+        }
+
+        /* Remaining points */
+        for(; i != count; ++i)
+            distances[i] = lineSegmentPointSquaredClamped(a, ab, abDotInverse, points[i]);
+    }
+};
+#endif
+
+}
+
 template<class T> T Distance::lineSegmentPoint(const Vector2<T>& a, const Vector2<T>& b, const Vector2<T>& point) {
     const Vector2<T> pointMinusA = point - a;
     const Vector2<T> pointMinusB = point - b;
@@ -223,6 +348,28 @@ template<class T> T Distance::lineSegmentPointSquared(const Vector3<T>& a, const
     return cross(pointMinusA, pointMinusB).dot()/bDistanceA;
 }
 
+template<class T> void Distance::lineSegmentPointSquared(const Vector2<T>& a, const Vector2<T>& b, Corrade::Containers::ArrayReference<const typename Math::Implementation::NonDeduced<Vector2<T>>::Type> points, Corrade::Containers::ArrayReference<typename Math::Implementation::NonDeduced<T>::Type> distances) {
+    CORRADE_ASSERT(points.size() == distances.size(),
+        "Math::Geometry::Distance::lineSegmentPointSquared(): expected" << points.size() << "output values but got" << distances.size(), );
+    Implementation::DistanceBatch<T>::template lineSegmentPointSquared<2>(a, b, static_cast<const Vector<2, T>*>(points.data()), distances.data(), points.size());
+}
+
+template<class T> void Distance::lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, Corrade::Containers::ArrayReference<const typename Math::Implementation::NonDeduced<Vector3<T>>::Type> points, Corrade::Containers::ArrayReference<typename Math::Implementation::NonDeduced<T>::Type> distances) {
+    CORRADE_ASSERT(points.size() == distances.size(),
+        "Math::Geometry::Distance::lineSegmentPointSquared(): expected" << points.size() << "output values but got" << distances.size(), );
+    Implementation::DistanceBatch<T>::lineSegmentPointSquared(a, b, static_cast<const Vector<3, T>*>(points.data()), distances.data(), points.size());
+}
+
+template<class T> void Distance::lineSegmentPointSquared(Corrade::Containers::ArrayReference<const typename Math::Implementation::NonDeduced<Vector3<T>>::Type> a, Corrade::Containers::ArrayReference<const typename Math::Implementation::NonDeduced<Vector3<T>>::Type> b, const Vector3<T>& point, Corrade::Containers::ArrayReference<typename Math::Implementation::NonDeduced<T>::Type> distances) {
+    CORRADE_ASSERT(a.size() == b.size() && a.size() == distances.size(),
+        "Math::Geometry::Distance::lineSegmentPointSquared(): expected" << a.size() << "segment ends and output values but got" << b.size() << "and" << distances.size(), );
+    for(std::size_t i = 0; i != a.size(); ++i) {
+        const Vector3<T> ab = b[i] - a[i];
+        const T abDot = ab.dot();
+        distances[i] = Implementation::lineSegmentPointSquaredClamped<3, T>(a[i], ab, abDot == T(0) ? T(0) : T(1)/abDot, point);
+    }
+}
+
 }}}
 
 #endif
@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Math::Geometry::Intersection
  */
 
+#include <Corrade/Containers/ArrayReference.h>
+
 #include "Magnum/Math/Vector3.h"
 
 namespace Magnum { namespace Math { namespace Geometry {
@@ -123,8 +125,32 @@ class Intersection {
             const T f = dot(planePosition, planeNormal);
             return (f-dot(planeNormal, p))/dot(planeNormal, r);
         }
+
+        /**
+         * @brief Intersections of a plane and lines
+         * @param planePosition Plane position
+         * @param planeNormal   Plane normal
+         * @param p             Starting points of the lines
+         * @param r             Directions of the lines
+         * @param t             Output, must have the same size as @p p and
+         *      @p r
+         *
+         * Batch variant of @ref planeLine(const Vector3<T>&, const Vector3<T>&, const Vector3<T>&, const Vector3<T>&),
+         * useful e.g. for picking. The plane parameter is computed only once
+         * and the loop has no branches, so it can be vectorized by the
+         * compiler.
+         */
+        template<class T> static void planeLine(const Vector3<T>& planePosition, const Vector3<T>& planeNormal, Corrade::Containers::ArrayReference<const typename Math::Implementation::NonDeduced<Vector3<T>>::Type> p, Corrade::Containers::ArrayReference<const typename Math::Implementation::NonDeduced<Vector3<T>>::Type> r, Corrade::Containers::ArrayReference<typename Math::Implementation::NonDeduced<T>::Type> t);
 };
 
+template<class T> void Intersection::planeLine(const Vector3<T>& planePosition, const Vector3<T>& planeNormal, Corrade::Containers::ArrayReference<const typename Math::Implementation::NonDeduced<Vector3<T>>::Type> p, Corrade::Containers::ArrayReference<const typename Math::Implementation::NonDeduced<Vector3<T>>::Type> r, Corrade::Containers::ArrayReference<typename Math::Implementation::NonDeduced<T>::Type> t) {
+    CORRADE_ASSERT(p.size() == r.size() && p.size() == t.size(),
+        "Math::Geometry::Intersection::planeLine(): expected" << p.size() << "line directions and output values but got" << r.size() << "and" << t.size(), );
+    const T f = dot(planePosition, planeNormal);
+    for(std::size_t i = 0; i != p.size(); ++i)
+        t[i] = (f-dot(planeNormal, p[i]))/dot(planeNormal, r[i]);
+}
+
 }}}
 
 #endif
@@ -0,0 +1,109 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Geometry/BoundingSphere.h"
+
+namespace Magnum { namespace Math { namespace Geometry { namespace Test {
+
+struct BoundingSphereTest: Corrade::TestSuite::Tester {
+    explicit BoundingSphereTest();
+
+    void empty();
+    void onePoint();
+    void points();
+    void strided();
+};
+
+typedef Math::Vector3<Float> Vector3;
+
+BoundingSphereTest::BoundingSphereTest() {
+    addTests({&BoundingSphereTest::empty,
+              &BoundingSphereTest::onePoint,
+              &BoundingSphereTest::points,
+              &BoundingSphereTest::strided});
+}
+
+void BoundingSphereTest::empty() {
+    const auto sphere = BoundingSphere::fromPoints<Float>(nullptr);
+    CORRADE_COMPARE(sphere.first, Vector3());
+    CORRADE_COMPARE(sphere.second, 0.0f);
+}
+
+void BoundingSphereTest::onePoint() {
+    const Vector3 points[]{{1.0f, -2.0f, 3.0f}};
+    const auto sphere = BoundingSphere::fromPoints<Float>(points);
+    CORRADE_COMPARE(sphere.first, Vector3(1.0f, -2.0f, 3.0f));
+    CORRADE_COMPARE(sphere.second, 0.0f);
+}
+
+void BoundingSphereTest::points() {
+    /* Corners of a box, the minimal sphere is found exactly */
+    const Vector3 points[]{
+        {-1.0f, -2.0f, -3.0f},
+        { 3.0f, -2.0f, -3.0f},
+        {-1.0f,  2.0f, -3.0f},
+        { 3.0f,  2.0f, -3.0f},
+        {-1.0f, -2.0f,  3.0f},
+        { 3.0f, -2.0f,  3.0f},
+        {-1.0f,  2.0f,  3.0f},
+        { 3.0f,  2.0f,  3.0f},
+        { 0.5f,  0.5f,  0.5f}
+    };
+    const auto sphere = BoundingSphere::fromPoints<Float>(points);
+    CORRADE_COMPARE(sphere.first, Vector3(1.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(sphere.second, std::sqrt(17.0f));
+
+    /* Outlying point not among the initial extremal pair, all points
+       should be inside */
+    const Vector3 points2[]{
+        {-1.0f,  0.0f,  0.0f},
+        { 1.0f,  0.0f,  0.0f},
+        { 0.0f,  0.9f,  0.0f},
+        { 0.0f,  0.0f, -0.9f},
+        { 0.6f,  0.6f,  0.6f}
+    };
+    const auto sphere2 = BoundingSphere::fromPoints<Float>(points2);
+    for(const Vector3& point: points2)
+        CORRADE_VERIFY((point - sphere2.first).length() <= sphere2.second*1.0001f);
+    CORRADE_VERIFY(sphere2.second < 1.2f);
+}
+
+void BoundingSphereTest::strided() {
+    /* Position interleaved with normal */
+    const Vector3 data[]{
+        {-1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f},
+        { 1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f},
+        { 0.0f, 0.5f, 0.0f}, {0.0f, 0.0f, 1.0f}
+    };
+    const auto sphere = BoundingSphere::fromPoints(data, 3, 2*sizeof(Vector3));
+    CORRADE_COMPARE(sphere.first, Vector3());
+    CORRADE_COMPARE(sphere.second, 1.0f);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::BoundingSphereTest)
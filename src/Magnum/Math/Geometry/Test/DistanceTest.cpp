@@ -37,6 +37,10 @@ struct DistanceTest: Corrade::TestSuite::Tester {
     void linePoint3D();
     void lineSegmentPoint2D();
     void lineSegmentPoint3D();
+    void lineSegmentPointBatch2D();
+    void lineSegmentPointBatch3D();
+    void lineSegmentPointBatch3DDegenerate();
+    void lineSegmentsPointBatch();
 };
 
 typedef Math::Vector2<Float> Vector2;
@@ -47,7 +51,11 @@ DistanceTest::DistanceTest() {
     addTests({&DistanceTest::linePoint2D,
               &DistanceTest::linePoint3D,
               &DistanceTest::lineSegmentPoint2D,
-              &DistanceTest::lineSegmentPoint3D});
+              &DistanceTest::lineSegmentPoint3D,
+              &DistanceTest::lineSegmentPointBatch2D,
+              &DistanceTest::lineSegmentPointBatch3D,
+              &DistanceTest::lineSegmentPointBatch3DDegenerate,
+              &DistanceTest::lineSegmentsPointBatch});
 }
 
 void DistanceTest::linePoint2D() {
@@ -156,6 +164,86 @@ void DistanceTest::lineSegmentPoint3D() {
                     Constants::sqrt2());
 }
 
+void DistanceTest::lineSegmentPointBatch2D() {
+    const Vector2 a(0.0f);
+    const Vector2 b(1.0f);
+    const Vector2 points[]{
+        Vector2(0.25f),
+        Vector2(-1.0f),
+        Vector2(1.0f + 1.0f/Constants::sqrt2()),
+        {1.0f, 0.0f},
+        Vector2(1.0f, 0.0f) - Vector2(1.0f, 0.5f)
+    };
+
+    Float distances[5];
+    Distance::lineSegmentPointSquared(a, b, points, distances);
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_COMPARE(distances[i], Distance::lineSegmentPointSquared(a, b, points[i]));
+}
+
+void DistanceTest::lineSegmentPointBatch3D() {
+    const Vector3 a(0.0f);
+    const Vector3 b(1.0f);
+
+    /* More than four points to test both the vectorized and the remainder
+       code path */
+    const Vector3 points[]{
+        Vector3(0.25f),
+        Vector3(-1.0f),
+        Vector3(1.0f + 1.0f/Constants::sqrt3()),
+        {1.0f, 0.0f, 1.0f},
+        Vector3(1.0f, 0.0f, 1.0f) - Vector3(1.0f),
+        Vector3(1.0f, 0.0f, 1.0f) + Vector3(1.0f),
+        {0.0f, 2.0f, -1.0f}
+    };
+
+    Float distances[7];
+    Distance::lineSegmentPointSquared(a, b, points, distances);
+    for(std::size_t i = 0; i != 7; ++i)
+        CORRADE_COMPARE(distances[i], Distance::lineSegmentPointSquared(a, b, points[i]));
+}
+
+void DistanceTest::lineSegmentPointBatch3DDegenerate() {
+    const Vector3 a(1.0f);
+    const Vector3 points[]{
+        Vector3(1.0f),
+        {1.0f, 3.0f, 1.0f},
+        Vector3(0.0f),
+        {2.0f, 1.0f, 1.0f},
+        {1.0f, 1.0f, -1.0f}
+    };
+
+    /* Unlike the single-point variant the result is distance from the point
+       and not NaN */
+    Float distances[5];
+    Distance::lineSegmentPointSquared(a, a, points, distances);
+    CORRADE_COMPARE(distances[0], 0.0f);
+    CORRADE_COMPARE(distances[1], 4.0f);
+    CORRADE_COMPARE(distances[2], 3.0f);
+    CORRADE_COMPARE(distances[3], 1.0f);
+    CORRADE_COMPARE(distances[4], 4.0f);
+}
+
+void DistanceTest::lineSegmentsPointBatch() {
+    const Vector3 a[]{
+        Vector3(0.0f),
+        Vector3(1.0f),
+        {0.0f, 0.0f, 1.0f}
+    };
+    const Vector3 b[]{
+        Vector3(1.0f),
+        Vector3(0.0f),
+        {2.0f, 0.0f, 1.0f}
+    };
+    const Vector3 point(1.0f, 0.0f, 1.0f);
+
+    Float distances[3];
+    Distance::lineSegmentPointSquared(a, b, point, distances);
+    CORRADE_COMPARE(distances[0], Distance::lineSegmentPointSquared(a[0], b[0], point));
+    CORRADE_COMPARE(distances[1], Distance::lineSegmentPointSquared(a[1], b[1], point));
+    CORRADE_COMPARE(distances[2], 0.0f);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::DistanceTest)
@@ -33,6 +33,7 @@ struct IntersectionTest: Corrade::TestSuite::Tester {
     explicit IntersectionTest();
 
     void planeLine();
+    void planeLineBatch();
     void lineLine();
 };
 
@@ -42,6 +43,7 @@ typedef Math::Constants<Float> Constants;
 
 IntersectionTest::IntersectionTest() {
     addTests({&IntersectionTest::planeLine,
+              &IntersectionTest::planeLineBatch,
               &IntersectionTest::lineLine});
 }
 
@@ -66,6 +68,27 @@ void IntersectionTest::planeLine() {
         {1.0f, 0.0f, 1.0f}, {-1.0f, 0.0f, 0.0f}), -Constants::inf());
 }
 
+void IntersectionTest::planeLineBatch() {
+    const Vector3 planePosition(-1.0f, 1.0f, 0.5f);
+    const Vector3 planeNormal(0.0f, 0.0f, 1.0f);
+    const Vector3 p[]{
+        {0.0f, 0.0f, -1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 1.0f}
+    };
+    const Vector3 r[]{
+        {0.0f, 0.0f, 2.0f},
+        {0.0f, 0.0f, 1.0f},
+        {-1.0f, 0.0f, 0.0f}
+    };
+
+    Float t[3];
+    Intersection::planeLine(planePosition, planeNormal, p, r, t);
+    CORRADE_COMPARE(t[0], 0.75f);
+    CORRADE_COMPARE(t[1], -0.5f);
+    CORRADE_COMPARE(t[2], -Constants::inf());
+}
+
 void IntersectionTest::lineLine() {
     const Vector2 p(-1.0f, -1.0f);
     const Vector2 r(1.0, 2.0f);
@@ -0,0 +1,102 @@
+#ifndef Magnum_Math_Half_h
+#define Magnum_Math_Half_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::Half
+ */
+
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Half-precision float
+
+Storage type for 16-bit floating-point values, e.g. for vertex attributes or
+image data. Doesn't provide any arithmetic, convert it to @ref Magnum::Float "Float"
+for calculations. The conversion is done using @ref packHalf() and
+@ref unpackHalf(), for converting whole arrays use the batch variants of these
+functions.
+@see @ref Magnum::Half
+*/
+class Half {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates positive zero.
+         */
+        constexpr /*implicit*/ Half() noexcept: _data{} {}
+
+        /** @brief Construct from raw 16-bit representation */
+        constexpr explicit Half(UnsignedShort data) noexcept: _data{data} {}
+
+        /**
+         * @brief Construct from 32-bit float
+         *
+         * @see @ref packHalf()
+         */
+        explicit Half(Float value) noexcept: _data{packHalf(value)} {}
+
+        /**
+         * @brief Convert to 32-bit float
+         *
+         * @see @ref unpackHalf()
+         */
+        explicit operator Float() const { return unpackHalf(_data); }
+
+        /** @brief Raw 16-bit representation */
+        constexpr UnsignedShort data() const { return _data; }
+
+        /**
+         * @brief Equality comparison
+         *
+         * Compares the raw representation, thus positive and negative zero
+         * are not equal and NaN with the same representation is equal.
+         */
+        constexpr bool operator==(Half other) const { return _data == other._data; }
+
+        /** @brief Non-equality comparison */
+        constexpr bool operator!=(Half other) const { return _data != other._data; }
+
+        /** @brief Negated value */
+        constexpr Half operator-() const { return Half{UnsignedShort(_data ^ 0x8000)}; }
+
+    private:
+        UnsignedShort _data;
+};
+
+/** @debugoperator{Magnum::Math::Half} */
+inline Corrade::Utility::Debug operator<<(Corrade::Utility::Debug debug, Half value) {
+    return debug << Float(value);
+}
+
+}}
+
+#endif
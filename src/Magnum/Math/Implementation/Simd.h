@@ -0,0 +1,235 @@
+#ifndef Magnum_Math_Implementation_Simd_h
+#define Magnum_Math_Implementation_Simd_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <cmath>
+
+#include "Magnum/Types.h"
+
+/* Instruction sets available on the target. The batch APIs (such as in
+   Math::Geometry::Distance) use them unconditionally, the specializations of
+   Vector4, Matrix4 and Quaternion of Float are enabled only if the library
+   is built with MAGNUM_BUILD_SIMD */
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define MAGNUM_MATH_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MAGNUM_MATH_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(MAGNUM_BUILD_SIMD) && (defined(MAGNUM_MATH_SSE) || defined(MAGNUM_MATH_NEON))
+#define MAGNUM_MATH_SIMD
+#endif
+
+#ifdef MAGNUM_MATH_SIMD
+namespace Magnum { namespace Math { namespace Implementation {
+
+/* All kernels operate on unaligned, tightly packed four-component vectors
+   and column-major 4x4 matrices, so they can be used directly on the
+   storage of Vector4, Matrix4 and Quaternion without changing its layout */
+
+inline Float simdDot4(const Float* const a, const Float* const b) {
+    #ifdef MAGNUM_MATH_SSE
+    const __m128 m = _mm_mul_ps(_mm_loadu_ps(a), _mm_loadu_ps(b));
+    const __m128 s = _mm_add_ps(m, _mm_movehl_ps(m, m));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1))));
+    #else
+    const float32x4_t m = vmulq_f32(vld1q_f32(a), vld1q_f32(b));
+    const float32x2_t s = vadd_f32(vget_low_f32(m), vget_high_f32(m));
+    return vget_lane_f32(vpadd_f32(s, s), 0);
+    #endif
+}
+
+inline void simdNormalize4(const Float* const a, Float* const out) {
+    const Float lengthInverted = 1.0f/std::sqrt(simdDot4(a, a));
+    #ifdef MAGNUM_MATH_SSE
+    _mm_storeu_ps(out, _mm_mul_ps(_mm_loadu_ps(a), _mm_set1_ps(lengthInverted)));
+    #else
+    vst1q_f32(out, vmulq_n_f32(vld1q_f32(a), lengthInverted));
+    #endif
+}
+
+/* out = a*b, where a is 4x4 and b has given count of four-component
+   columns. The output must not alias the inputs. */
+inline void simdMultiply4x4(const Float* const a, const Float* const b, Float* const out, const std::size_t cols) {
+    #ifdef MAGNUM_MATH_SSE
+    const __m128 a0 = _mm_loadu_ps(a + 0);
+    const __m128 a1 = _mm_loadu_ps(a + 4);
+    const __m128 a2 = _mm_loadu_ps(a + 8);
+    const __m128 a3 = _mm_loadu_ps(a + 12);
+    for(std::size_t col = 0; col != cols; ++col) {
+        const Float* const bc = b + col*4;
+        _mm_storeu_ps(out + col*4, _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(a0, _mm_set1_ps(bc[0])), _mm_mul_ps(a1, _mm_set1_ps(bc[1]))),
+            _mm_add_ps(_mm_mul_ps(a2, _mm_set1_ps(bc[2])), _mm_mul_ps(a3, _mm_set1_ps(bc[3])))));
+    }
+    #else
+    const float32x4_t a0 = vld1q_f32(a + 0);
+    const float32x4_t a1 = vld1q_f32(a + 4);
+    const float32x4_t a2 = vld1q_f32(a + 8);
+    const float32x4_t a3 = vld1q_f32(a + 12);
+    for(std::size_t col = 0; col != cols; ++col) {
+        const Float* const bc = b + col*4;
+        float32x4_t c = vmulq_n_f32(a0, bc[0]);
+        c = vmlaq_n_f32(c, a1, bc[1]);
+        c = vmlaq_n_f32(c, a2, bc[2]);
+        c = vmlaq_n_f32(c, a3, bc[3]);
+        vst1q_f32(out + col*4, c);
+    }
+    #endif
+}
+
+/* Vectorized Math::sinFast(), Math::cosFast() and Math::sqrtInvertedFast(),
+   with the same constants and error bounds as the scalar variants. The
+   angles are rounded to whole turns by adding and subtracting 1.5*2^23. */
+#ifdef MAGNUM_MATH_SSE
+inline __m128 simdSinFastReduced(__m128 x) {
+    x = _mm_max_ps(_mm_min_ps(x, _mm_sub_ps(_mm_set1_ps(3.14159265f), x)), _mm_sub_ps(_mm_set1_ps(-3.14159265f), x));
+    const __m128 x2 = _mm_mul_ps(x, x);
+    __m128 p = _mm_add_ps(_mm_mul_ps(x2, _mm_set1_ps(-0.000184926817f)), _mm_set1_ps(0.00831238262f));
+    p = _mm_add_ps(_mm_mul_ps(x2, p), _mm_set1_ps(-0.166656823f));
+    p = _mm_add_ps(_mm_mul_ps(x2, p), _mm_set1_ps(1.0f));
+    return _mm_mul_ps(x, p);
+}
+#else
+inline float32x4_t simdSinFastReduced(float32x4_t x) {
+    x = vmaxq_f32(vminq_f32(x, vsubq_f32(vdupq_n_f32(3.14159265f), x)), vsubq_f32(vdupq_n_f32(-3.14159265f), x));
+    const float32x4_t x2 = vmulq_f32(x, x);
+    float32x4_t p = vmlaq_n_f32(vdupq_n_f32(0.00831238262f), x2, -0.000184926817f);
+    p = vmlaq_f32(vdupq_n_f32(-0.166656823f), x2, p);
+    p = vmlaq_f32(vdupq_n_f32(1.0f), x2, p);
+    return vmulq_f32(x, p);
+}
+#endif
+
+/* Either of the outputs can be null */
+inline void simdSinCosFast4(const Float* const a, Float* const sin, Float* const cos) {
+    #ifdef MAGNUM_MATH_SSE
+    const __m128 x = _mm_loadu_ps(a);
+    const __m128 magic = _mm_set1_ps(12582912.0f);
+    const __m128 n = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(0.159154943f)), magic), magic);
+    const __m128 r = _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(n, _mm_set1_ps(6.28125f))), _mm_mul_ps(n, _mm_set1_ps(0.00193530717f)));
+    if(sin) _mm_storeu_ps(sin, simdSinFastReduced(r));
+    if(cos) _mm_storeu_ps(cos, simdSinFastReduced(_mm_add_ps(r, _mm_set1_ps(1.57079633f))));
+    #else
+    const float32x4_t x = vld1q_f32(a);
+    const float32x4_t magic = vdupq_n_f32(12582912.0f);
+    const float32x4_t n = vsubq_f32(vmlaq_n_f32(magic, x, 0.159154943f), magic);
+    const float32x4_t r = vmlsq_n_f32(vmlsq_n_f32(x, n, 6.28125f), n, 0.00193530717f);
+    if(sin) vst1q_f32(sin, simdSinFastReduced(r));
+    if(cos) vst1q_f32(cos, simdSinFastReduced(vaddq_f32(r, vdupq_n_f32(1.57079633f))));
+    #endif
+}
+
+/* Hardware estimate refined with Newton-Raphson steps, one on SSE (12-bit
+   estimate), two on NEON (8-bit estimate) */
+inline void simdSqrtInvertedFast4(const Float* const a, Float* const out) {
+    #ifdef MAGNUM_MATH_SSE
+    const __m128 x = _mm_loadu_ps(a);
+    const __m128 r = _mm_rsqrt_ps(x);
+    _mm_storeu_ps(out, _mm_mul_ps(r, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), x), _mm_mul_ps(r, r)))));
+    #else
+    const float32x4_t x = vld1q_f32(a);
+    float32x4_t r = vrsqrteq_f32(x);
+    r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(x, r), r));
+    r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(x, r), r));
+    vst1q_f32(out, r);
+    #endif
+}
+
+#ifdef MAGNUM_MATH_SSE
+/* Hamilton product of quaternions stored as (x, y, z, w) */
+inline void simdQuaternionMultiply(const Float* const a, const Float* const b, Float* const out) {
+    const __m128 qa = _mm_loadu_ps(a);
+    const __m128 qb = _mm_loadu_ps(b);
+
+    /* w = aw*bw - ax*bx - ay*by - az*bz, the sign of the middle two terms of
+       the last component is flipped separately */
+    const __m128 t0 = _mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(3, 3, 3, 3)), qb);
+    const __m128 t1 = _mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(0, 2, 1, 0)),
+                                 _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(0, 3, 3, 3)));
+    const __m128 t2 = _mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(1, 0, 2, 1)),
+                                 _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(1, 1, 0, 2)));
+    const __m128 t3 = _mm_mul_ps(_mm_shuffle_ps(qa, qa, _MM_SHUFFLE(2, 1, 0, 2)),
+                                 _mm_shuffle_ps(qb, qb, _MM_SHUFFLE(2, 0, 2, 1)));
+    const __m128 signW = _mm_set_ps(-0.0f, 0.0f, 0.0f, 0.0f);
+    _mm_storeu_ps(out, _mm_sub_ps(_mm_add_ps(t0, _mm_xor_ps(_mm_add_ps(t1, t2), signW)), t3));
+}
+
+/* Shuffles used for the 4D cross product below, (y, x, x, x), (z, z, y, y)
+   and (w, w, w, z) */
+inline __m128 simdShuffle1000(const __m128 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 1)); }
+inline __m128 simdShuffle2211(const __m128 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 2, 2)); }
+inline __m128 simdShuffle3332(const __m128 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 3, 3)); }
+
+/* Vector orthogonal to all three input vectors, with
+   dot(a, simdCross4(b, c, d)) being determinant of matrix with columns a, b,
+   c, d. The 2x2 determinants of c and d are computed in three arrangements,
+   then combined with components of b. */
+inline __m128 simdCross4(const __m128 b, const __m128 c, const __m128 d) {
+    const __m128 c0 = simdShuffle1000(c), c1 = simdShuffle2211(c), c2 = simdShuffle3332(c);
+    const __m128 d0 = simdShuffle1000(d), d1 = simdShuffle2211(d), d2 = simdShuffle3332(d);
+    const __m128 w0 = _mm_sub_ps(_mm_mul_ps(c1, d2), _mm_mul_ps(c2, d1));
+    const __m128 w1 = _mm_sub_ps(_mm_mul_ps(c0, d2), _mm_mul_ps(c2, d0));
+    const __m128 w2 = _mm_sub_ps(_mm_mul_ps(c0, d1), _mm_mul_ps(c1, d0));
+    const __m128 x = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(simdShuffle1000(b), w0), _mm_mul_ps(simdShuffle2211(b), w1)), _mm_mul_ps(simdShuffle3332(b), w2));
+    return _mm_xor_ps(x, _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f));
+}
+
+/* Inverse of column-major 4x4 matrix. Rows of the inverse are 4D cross
+   products of the remaining columns, scaled by inverse determinant. */
+inline void simdInvert4x4(const Float* const m, Float* const out) {
+    const __m128 a = _mm_loadu_ps(m + 0);
+    const __m128 b = _mm_loadu_ps(m + 4);
+    const __m128 c = _mm_loadu_ps(m + 8);
+    const __m128 d = _mm_loadu_ps(m + 12);
+
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    __m128 r0 = simdCross4(b, c, d);
+    __m128 r1 = _mm_xor_ps(simdCross4(a, c, d), sign);
+    __m128 r2 = simdCross4(d, a, b);
+    __m128 r3 = _mm_xor_ps(simdCross4(c, a, b), sign);
+
+    /* Determinant from the first row, then rows to columns */
+    const __m128 ar0 = _mm_mul_ps(a, r0);
+    const __m128 s = _mm_add_ps(ar0, _mm_movehl_ps(ar0, ar0));
+    const __m128 determinant = _mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1)));
+    const __m128 determinantInverted = _mm_div_ps(_mm_set1_ps(1.0f), _mm_shuffle_ps(determinant, determinant, _MM_SHUFFLE(0, 0, 0, 0)));
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    _mm_storeu_ps(out + 0, _mm_mul_ps(r0, determinantInverted));
+    _mm_storeu_ps(out + 4, _mm_mul_ps(r1, determinantInverted));
+    _mm_storeu_ps(out + 8, _mm_mul_ps(r2, determinantInverted));
+    _mm_storeu_ps(out + 12, _mm_mul_ps(r3, determinantInverted));
+}
+#endif
+
+}}}
+#endif
+
+#endif
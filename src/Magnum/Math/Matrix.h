@@ -35,6 +35,7 @@ namespace Magnum { namespace Math {
 
 namespace Implementation {
     template<std::size_t, class> struct MatrixDeterminant;
+    template<std::size_t, class> struct MatrixInverse;
 }
 
 /**
@@ -143,9 +144,12 @@ template<std::size_t size, class T> class Matrix: public RectangularMatrix<size,
          * Computed using Cramer's rule: @f[
          *      A^{-1} = \frac{1}{\det(A)} Adj(A)
          * @f]
-         * See @ref invertedOrthogonal(), @ref Matrix3::invertedRigid() and
-         * @ref Matrix4::invertedRigid() which are faster alternatives for
-         * particular matrix types.
+         * For 4x4 matrices the adjugate is computed in closed form without
+         * branches, reusing the twelve 2x2 subdeterminants of the top and
+         * bottom half of the matrix. See @ref invertedOrthogonal(),
+         * @ref Matrix3::invertedRigid() and @ref Matrix4::invertedRigid()
+         * which are faster alternatives for particular matrix types and
+         * @ref Matrix4::invertBatch() for inverting many matrices at once.
          */
         Matrix<size, T> inverted() const;
 
@@ -168,13 +172,13 @@ template<std::size_t size, class T> class Matrix: public RectangularMatrix<size,
 
         #ifndef DOXYGEN_GENERATING_OUTPUT
         /* Reimplementation of functions to return correct type */
-        Matrix<size, T> operator*(const Matrix<size, T>& other) const {
+        constexpr Matrix<size, T> operator*(const Matrix<size, T>& other) const {
             return RectangularMatrix<size, size, T>::operator*(other);
         }
-        template<std::size_t otherCols> RectangularMatrix<otherCols, size, T> operator*(const RectangularMatrix<otherCols, size, T>& other) const {
+        template<std::size_t otherCols> constexpr RectangularMatrix<otherCols, size, T> operator*(const RectangularMatrix<otherCols, size, T>& other) const {
             return RectangularMatrix<size, size, T>::operator*(other);
         }
-        Vector<size, T> operator*(const Vector<size, T>& other) const {
+        constexpr Vector<size, T> operator*(const Vector<size, T>& other) const {
             return RectangularMatrix<size, size, T>::operator*(other);
         }
         MAGNUM_RECTANGULARMATRIX_SUBCLASS_IMPLEMENTATION(size, size, Matrix<size, T>)
@@ -225,21 +229,21 @@ template<std::size_t size, class T> inline Corrade::Utility::Debug operator<<(Co
     constexpr const VectorType<T> operator[](std::size_t col) const {       \
         return VectorType<T>(Matrix<size, T>::operator[](col));             \
     }                                                                       \
-    VectorType<T> row(std::size_t row) const {                              \
+    constexpr VectorType<T> row(std::size_t row) const {                    \
         return VectorType<T>(Matrix<size, T>::row(row));                    \
     }                                                                       \
                                                                             \
-    Type<T> operator*(const Matrix<size, T>& other) const {                 \
+    constexpr Type<T> operator*(const Matrix<size, T>& other) const {       \
         return Matrix<size, T>::operator*(other);                           \
     }                                                                       \
-    template<std::size_t otherCols> RectangularMatrix<otherCols, size, T> operator*(const RectangularMatrix<otherCols, size, T>& other) const { \
+    template<std::size_t otherCols> constexpr RectangularMatrix<otherCols, size, T> operator*(const RectangularMatrix<otherCols, size, T>& other) const { \
         return Matrix<size, T>::operator*(other);                           \
     }                                                                       \
-    VectorType<T> operator*(const Vector<size, T>& other) const {           \
+    constexpr VectorType<T> operator*(const Vector<size, T>& other) const { \
         return Matrix<size, T>::operator*(other);                           \
     }                                                                       \
                                                                             \
-    Type<T> transposed() const { return Matrix<size, T>::transposed(); }    \
+    constexpr Type<T> transposed() const { return Matrix<size, T>::transposed(); } \
     constexpr VectorType<T> diagonal() const { return Matrix<size, T>::diagonal(); } \
     Type<T> inverted() const { return Matrix<size, T>::inverted(); }        \
     Type<T> invertedOrthogonal() const {                                    \
@@ -273,6 +277,63 @@ template<class T> struct MatrixDeterminant<1, T> {
     }
 };
 
+template<std::size_t size, class T> struct MatrixInverse {
+    Matrix<size, T> operator()(const Matrix<size, T>& m) const;
+};
+
+template<std::size_t size, class T> Matrix<size, T> MatrixInverse<size, T>::operator()(const Matrix<size, T>& m) const {
+    Matrix<size, T> out(Matrix<size, T>::Zero);
+
+    const T determinant = m.determinant();
+
+    for(std::size_t col = 0; col != size; ++col)
+        for(std::size_t row = 0; row != size; ++row)
+            out[col][row] = (((row+col) & 1) ? -1 : 1)*m.ij(row, col).determinant()/determinant;
+
+    return out;
+}
+
+template<class T> struct MatrixInverse<4, T> {
+    Matrix<4, T> operator()(const Matrix<4, T>& m) const;
+};
+
+template<class T> Matrix<4, T> MatrixInverse<4, T>::operator()(const Matrix<4, T>& m) const {
+    /* Subdeterminants of the first two and the last two rows, m[col][row] */
+    const T s0 = m[0][0]*m[1][1] - m[0][1]*m[1][0];
+    const T s1 = m[0][0]*m[2][1] - m[0][1]*m[2][0];
+    const T s2 = m[0][0]*m[3][1] - m[0][1]*m[3][0];
+    const T s3 = m[1][0]*m[2][1] - m[1][1]*m[2][0];
+    const T s4 = m[1][0]*m[3][1] - m[1][1]*m[3][0];
+    const T s5 = m[2][0]*m[3][1] - m[2][1]*m[3][0];
+    const T c0 = m[0][2]*m[1][3] - m[0][3]*m[1][2];
+    const T c1 = m[0][2]*m[2][3] - m[0][3]*m[2][2];
+    const T c2 = m[0][2]*m[3][3] - m[0][3]*m[3][2];
+    const T c3 = m[1][2]*m[2][3] - m[1][3]*m[2][2];
+    const T c4 = m[1][2]*m[3][3] - m[1][3]*m[3][2];
+    const T c5 = m[2][2]*m[3][3] - m[2][3]*m[3][2];
+
+    const T determinantInverted = T(1)/(s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0);
+
+    Matrix<4, T> out(Matrix<4, T>::Zero);
+    out[0][0] = ( m[1][1]*c5 - m[2][1]*c4 + m[3][1]*c3)*determinantInverted;
+    out[1][0] = (-m[1][0]*c5 + m[2][0]*c4 - m[3][0]*c3)*determinantInverted;
+    out[2][0] = ( m[1][3]*s5 - m[2][3]*s4 + m[3][3]*s3)*determinantInverted;
+    out[3][0] = (-m[1][2]*s5 + m[2][2]*s4 - m[3][2]*s3)*determinantInverted;
+    out[0][1] = (-m[0][1]*c5 + m[2][1]*c2 - m[3][1]*c1)*determinantInverted;
+    out[1][1] = ( m[0][0]*c5 - m[2][0]*c2 + m[3][0]*c1)*determinantInverted;
+    out[2][1] = (-m[0][3]*s5 + m[2][3]*s2 - m[3][3]*s1)*determinantInverted;
+    out[3][1] = ( m[0][2]*s5 - m[2][2]*s2 + m[3][2]*s1)*determinantInverted;
+    out[0][2] = ( m[0][1]*c4 - m[1][1]*c2 + m[3][1]*c0)*determinantInverted;
+    out[1][2] = (-m[0][0]*c4 + m[1][0]*c2 - m[3][0]*c0)*determinantInverted;
+    out[2][2] = ( m[0][3]*s4 - m[1][3]*s2 + m[3][3]*s0)*determinantInverted;
+    out[3][2] = (-m[0][2]*s4 + m[1][2]*s2 - m[3][2]*s0)*determinantInverted;
+    out[0][3] = (-m[0][1]*c3 + m[1][1]*c1 - m[2][1]*c0)*determinantInverted;
+    out[1][3] = ( m[0][0]*c3 - m[1][0]*c1 + m[2][0]*c0)*determinantInverted;
+    out[2][3] = (-m[0][3]*s3 + m[1][3]*s1 - m[2][3]*s0)*determinantInverted;
+    out[3][3] = ( m[0][2]*s3 - m[1][2]*s1 + m[2][2]*s0)*determinantInverted;
+    return out;
+}
+
 }
 #endif
 
@@ -301,17 +362,17 @@ template<std::size_t size, class T> Matrix<size-1, T> Matrix<size, T>::ij(const
     return out;
 }
 
-template<std::size_t size, class T> Matrix<size, T> Matrix<size, T>::inverted() const {
-    Matrix<size, T> out(Zero);
-
-    const T _determinant = determinant();
-
-    for(std::size_t col = 0; col != size; ++col)
-        for(std::size_t row = 0; row != size; ++row)
-            out[col][row] = (((row+col) & 1) ? -1 : 1)*ij(row, col).determinant()/_determinant;
+template<std::size_t size, class T> inline Matrix<size, T> Matrix<size, T>::inverted() const {
+    return Implementation::MatrixInverse<size, T>()(*this);
+}
 
+#if defined(MAGNUM_MATH_SIMD) && defined(MAGNUM_MATH_SSE) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> inline Matrix<4, Float> Matrix<4, Float>::inverted() const {
+    Matrix<4, Float> out(Zero);
+    Implementation::simdInvert4x4(data(), out.data());
     return out;
 }
+#endif
 
 }}
 
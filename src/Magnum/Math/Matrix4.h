@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Math::Matrix4
  */
 
+#include <Corrade/Containers/ArrayReference.h>
+
 #include "Magnum/Math/Matrix.h"
 #include "Magnum/Math/Vector4.h"
 
@@ -407,6 +409,33 @@ template<class T> class Matrix4: public Matrix4x4<T> {
          */
         Matrix4<T> invertedRigid() const;
 
+        /**
+         * @brief Invert many matrices at once
+         * @param matrices  Matrices to invert
+         * @param out       Output, must have the same size as @p matrices
+         *
+         * Equivalent to calling @ref inverted() on each matrix. The 4x4
+         * inverse has no branches, so consecutive matrices can be processed
+         * in an interleaved fashion by the CPU. If built with
+         * @ref MAGNUM_BUILD_SIMD, the @ref Magnum::Float "Float" variant uses
+         * SSE. The output may not alias the input.
+         * @see @ref normalMatrixBatch()
+         */
+        static void invertBatch(Corrade::Containers::ArrayReference<const Matrix4<T>> matrices, Corrade::Containers::ArrayReference<Matrix4<T>> out);
+
+        /**
+         * @brief Compute normal matrices of many transformations at once
+         * @param transformations   Transformation matrices
+         * @param out               Output, must have the same size as
+         *      @p transformations
+         *
+         * Computes inverse transpose of @ref rotationScaling() of each
+         * matrix, useful e.g. for setting normal matrices of all drawables in
+         * a scene.
+         * @see @ref invertBatch()
+         */
+        static void normalMatrixBatch(Corrade::Containers::ArrayReference<const Matrix4<T>> transformations, Corrade::Containers::ArrayReference<Matrix3x3<T>> out);
+
         /**
          * @brief Transform 3D vector with the matrix
          *
@@ -573,6 +602,22 @@ template<class T> Matrix4<T> Matrix4<T>::invertedRigid() const {
     return from(inverseRotation, inverseRotation*-translation());
 }
 
+template<class T> void Matrix4<T>::invertBatch(const Corrade::Containers::ArrayReference<const Matrix4<T>> matrices, const Corrade::Containers::ArrayReference<Matrix4<T>> out) {
+    CORRADE_ASSERT(matrices.size() == out.size(),
+        "Math::Matrix4::invertBatch(): expected" << matrices.size() << "output matrices but got" << out.size(), );
+
+    for(std::size_t i = 0; i != matrices.size(); ++i)
+        out[i] = matrices[i].inverted();
+}
+
+template<class T> void Matrix4<T>::normalMatrixBatch(const Corrade::Containers::ArrayReference<const Matrix4<T>> transformations, const Corrade::Containers::ArrayReference<Matrix3x3<T>> out) {
+    CORRADE_ASSERT(transformations.size() == out.size(),
+        "Math::Matrix4::normalMatrixBatch(): expected" << transformations.size() << "output matrices but got" << out.size(), );
+
+    for(std::size_t i = 0; i != transformations.size(); ++i)
+        out[i] = transformations[i].rotationScaling().inverted().transposed();
+}
+
 }}
 
 namespace Corrade { namespace Utility {
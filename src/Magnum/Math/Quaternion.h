@@ -47,7 +47,7 @@ namespace Magnum { namespace Math {
 @f]
 @see @ref Quaternion::dot() const
 */
-template<class T> inline T dot(const Quaternion<T>& a, const Quaternion<T>& b) {
+template<class T> constexpr T dot(const Quaternion<T>& a, const Quaternion<T>& b) {
     return dot(a.vector(), b.vector()) + a.scalar()*b.scalar();
 }
 
@@ -290,8 +290,8 @@ template<class T> class Quaternion {
          *
          * @see @ref operator+=()
          */
-        Quaternion<T> operator+(const Quaternion<T>& other) const {
-            return Quaternion<T>(*this) += other;
+        constexpr Quaternion<T> operator+(const Quaternion<T>& other) const {
+            return {_vector + other._vector, _scalar + other._scalar};
         }
 
         /**
@@ -301,7 +301,7 @@ template<class T> class Quaternion {
          *      -q = [-\boldsymbol q_V, -q_S]
          * @f]
          */
-        Quaternion<T> operator-() const { return {-_vector, -_scalar}; }
+        constexpr Quaternion<T> operator-() const { return {-_vector, -_scalar}; }
 
         /**
          * @brief Subtract and assign quaternion
@@ -321,8 +321,8 @@ template<class T> class Quaternion {
          *
          * @see @ref operator-=()
          */
-        Quaternion<T> operator-(const Quaternion<T>& other) const {
-            return Quaternion<T>(*this) -= other;
+        constexpr Quaternion<T> operator-(const Quaternion<T>& other) const {
+            return {_vector - other._vector, _scalar - other._scalar};
         }
 
         /**
@@ -343,8 +343,8 @@ template<class T> class Quaternion {
          *
          * @see @ref operator*=(T)
          */
-        Quaternion<T> operator*(T scalar) const {
-            return Quaternion<T>(*this) *= scalar;
+        constexpr Quaternion<T> operator*(T scalar) const {
+            return {_vector*scalar, _scalar*scalar};
         }
 
         /**
@@ -365,8 +365,8 @@ template<class T> class Quaternion {
          *
          * @see @ref operator/=(T)
          */
-        Quaternion<T> operator/(T scalar) const {
-            return Quaternion<T>(*this) /= scalar;
+        constexpr Quaternion<T> operator/(T scalar) const {
+            return {_vector/scalar, _scalar/scalar};
         }
 
         /**
@@ -376,8 +376,12 @@ template<class T> class Quaternion {
          *      p q = [p_S \boldsymbol q_V + q_S \boldsymbol p_V + \boldsymbol p_V \times \boldsymbol q_V,
          *             p_S q_S - \boldsymbol p_V \cdot \boldsymbol q_V]
          * @f]
+         *
+         * Usable in constant expressions, except for the
+         * @ref Magnum::Float "Float" variant if built with
+         * @ref MAGNUM_BUILD_SIMD.
          */
-        Quaternion<T> operator*(const Quaternion<T>& other) const;
+        constexpr Quaternion<T> operator*(const Quaternion<T>& other) const;
 
         /**
          * @brief Dot product of the quaternion
@@ -390,7 +394,7 @@ template<class T> class Quaternion {
          * @see @ref isNormalized(),
          *      @ref dot(const Quaternion<T>&, const Quaternion<T>&)
          */
-        T dot() const { return Math::dot(*this, *this); }
+        constexpr T dot() const { return Math::dot(*this, *this); }
 
         /**
          * @brief Quaternion length
@@ -417,7 +421,7 @@ template<class T> class Quaternion {
          *      q^* = [-\boldsymbol q_V, q_S]
          * @f]
          */
-        Quaternion<T> conjugated() const { return {-_vector, _scalar}; }
+        constexpr Quaternion<T> conjugated() const { return {-_vector, _scalar}; }
 
         /**
          * @brief Inverted quaternion
@@ -492,7 +496,7 @@ template<class T> class Quaternion {
 
 Same as @ref Quaternion::operator*(T) const.
 */
-template<class T> inline Quaternion<T> operator*(T scalar, const Quaternion<T>& quaternion) {
+template<class T> constexpr Quaternion<T> operator*(T scalar, const Quaternion<T>& quaternion) {
     return quaternion*scalar;
 }
 
@@ -542,8 +546,10 @@ template<class T> Quaternion<T> quaternionFromMatrix(const Matrix3x3<T>& m) {
                            m[0][1] - m[1][0])*t, s*T(0.5)};
     }
 
-    /* Diagonal is negative */
-    const std::size_t i = diagonal.max();
+    /* Diagonal is negative, pick the largest element */
+    std::size_t i = 0;
+    if(diagonal[1] > diagonal[0]) i = 1;
+    if(diagonal[2] > diagonal[i]) i = 2;
     const std::size_t j = (i + 1) % 3;
     const std::size_t k = (i + 2) % 3;
 
@@ -595,11 +601,35 @@ template<class T> Matrix3x3<T> Quaternion<T>::toMatrix() const {
     };
 }
 
-template<class T> inline Quaternion<T> Quaternion<T>::operator*(const Quaternion<T>& other) const {
+template<class T> constexpr Quaternion<T> Quaternion<T>::operator*(const Quaternion<T>& other) const {
     return {_scalar*other._vector + other._scalar*_vector + Math::cross(_vector, other._vector),
             _scalar*other._scalar - Math::dot(_vector, other._vector)};
 }
 
+#if defined(MAGNUM_MATH_SIMD) && !defined(DOXYGEN_GENERATING_OUTPUT)
+/* The SIMD variants treat the vector and scalar part as one four-component
+   vector */
+static_assert(sizeof(Quaternion<Float>) == 4*sizeof(Float), "Improper size of Quaternion<Float>");
+
+template<> inline Float dot(const Quaternion<Float>& a, const Quaternion<Float>& b) {
+    return Implementation::simdDot4(reinterpret_cast<const Float*>(&a), reinterpret_cast<const Float*>(&b));
+}
+
+template<> inline Quaternion<Float> Quaternion<Float>::normalized() const {
+    Quaternion<Float> out;
+    Implementation::simdNormalize4(reinterpret_cast<const Float*>(this), reinterpret_cast<Float*>(&out));
+    return out;
+}
+
+#ifdef MAGNUM_MATH_SSE
+template<> inline Quaternion<Float> Quaternion<Float>::operator*(const Quaternion<Float>& other) const {
+    Quaternion<Float> out;
+    Implementation::simdQuaternionMultiply(reinterpret_cast<const Float*>(this), reinterpret_cast<const Float*>(&other), reinterpret_cast<Float*>(&out));
+    return out;
+}
+#endif
+#endif
+
 template<class T> inline Quaternion<T> Quaternion<T>::invertedNormalized() const {
     CORRADE_ASSERT(isNormalized(), "Math::Quaternion::invertedNormalized(): quaternion must be normalized", {});
     return conjugated();
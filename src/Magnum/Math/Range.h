@@ -29,7 +29,12 @@
  * @brief Class @ref Magnum::Math::Range, @ref Magnum::Math::Range2D, @ref Magnum::Math::Range3D, alias @ref Magnum::Math::Range1D
  */
 
-#include "Magnum/Math/Vector3.h"
+#include <Corrade/Containers/ArrayReference.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Implementation/Simd.h"
 
 namespace Magnum { namespace Math {
 
@@ -39,6 +44,8 @@ namespace Implementation {
     template<class T> struct RangeTraits<1, T> { typedef Vector<1, T> Type; };
     template<class T> struct RangeTraits<2, T> { typedef Vector2<T> Type; };
     template<class T> struct RangeTraits<3, T> { typedef Vector3<T> Type; };
+
+    template<UnsignedInt, class> struct RangeBatch;
 }
 
 /**
@@ -68,6 +75,49 @@ template<UnsignedInt dimensions, class T> class Range {
             return {min, min+size};
         }
 
+        /**
+         * @brief Create range containing given points
+         *
+         * Returns zero range if @p points is empty. If the target supports
+         * SSE, the @ref Magnum::Float "Float" variant of @ref Range3D
+         * processes four points at once using SSE intrinsics.
+         * @see @ref join()
+         */
+        static Range<dimensions, T> fromPoints(Corrade::Containers::ArrayReference<const VectorType> points) {
+            return fromPoints(points.data(), points.size(), sizeof(VectorType));
+        }
+
+        /**
+         * @brief Create range containing given strided points
+         * @param points    Pointer to the first point
+         * @param count     Point count
+         * @param stride    Distance between two consecutive points in bytes
+         *
+         * Useful for e.g. positions in interleaved vertex data. The points
+         * are expected to be suitably aligned for @ref VectorType.
+         * @see @ref fromPoints(Corrade::Containers::ArrayReference<const VectorType>)
+         */
+        static Range<dimensions, T> fromPoints(const VectorType* points, std::size_t count, std::size_t stride);
+
+        /**
+         * @brief Union of many ranges
+         *
+         * Returns smallest range containing all @p ranges or zero range if
+         * @p ranges is empty.
+         * @see @ref joined(), @ref intersect()
+         */
+        static Range<dimensions, T> join(Corrade::Containers::ArrayReference<const Range<dimensions, T>> ranges);
+
+        /**
+         * @brief Intersection of many ranges
+         *
+         * Returns zero range if @p ranges is empty. If the ranges don't have
+         * any common point, minimal coordinates of the result are larger
+         * than maximal coordinates in at least one dimension.
+         * @see @ref intersected(), @ref join()
+         */
+        static Range<dimensions, T> intersect(Corrade::Containers::ArrayReference<const Range<dimensions, T>> ranges);
+
         /**
          * @brief Construct zero range
          *
@@ -172,6 +222,28 @@ template<UnsignedInt dimensions, class T> class Range {
          */
         Range<dimensions, T> scaled(const VectorType& scaling) const;
 
+        /**
+         * @brief Union with another range
+         *
+         * Smallest range containing both ranges.
+         * @see @ref join(), @ref intersected()
+         */
+        Range<dimensions, T> joined(const Range<dimensions, T>& other) const {
+            return {Math::min(_min, other._min), Math::max(_max, other._max)};
+        }
+
+        /**
+         * @brief Intersection with another range
+         *
+         * If the ranges don't have any common point, minimal coordinates of
+         * the result are larger than maximal coordinates in at least one
+         * dimension.
+         * @see @ref intersect(), @ref joined()
+         */
+        Range<dimensions, T> intersected(const Range<dimensions, T>& other) const {
+            return {Math::max(_min, other._min), Math::min(_max, other._max)};
+        }
+
     private:
         VectorType _min, _max;
 };
@@ -189,6 +261,25 @@ template<UnsignedInt dimensions, class T> class Range {
     }                                                                       \
     Type<T> scaled(const VectorType<T>& scaling) const {                    \
         return Range<dimensions, T>::scaled(scaling);                       \
+    }                                                                       \
+    Type<T> joined(const Range<dimensions, T>& other) const {               \
+        return Range<dimensions, T>::joined(other);                         \
+    }                                                                       \
+    Type<T> intersected(const Range<dimensions, T>& other) const {          \
+        return Range<dimensions, T>::intersected(other);                    \
+    }                                                                       \
+                                                                            \
+    static Type<T> fromPoints(Corrade::Containers::ArrayReference<const VectorType<T>> points) { \
+        return Range<dimensions, T>::fromPoints(points);                    \
+    }                                                                       \
+    static Type<T> fromPoints(const VectorType<T>* points, std::size_t count, std::size_t stride) { \
+        return Range<dimensions, T>::fromPoints(points, count, stride);     \
+    }                                                                       \
+    static Type<T> join(Corrade::Containers::ArrayReference<const Type<T>> ranges) { \
+        return Range<dimensions, T>::join({ranges.data(), ranges.size()});  \
+    }                                                                       \
+    static Type<T> intersect(Corrade::Containers::ArrayReference<const Type<T>> ranges) { \
+        return Range<dimensions, T>::intersect({ranges.data(), ranges.size()}); \
     }
 #endif
 
@@ -298,6 +389,16 @@ template<class T> class Range2D: public Range<2, T> {
             return (Range<2, T>::min().y() + Range<2, T>::max().y())/T(2);
         }
 
+        /**
+         * @brief Transformed range
+         *
+         * Smallest range containing all corners of the range transformed
+         * with @p transformation. Computed using Arvo's method, i.e. without
+         * transforming the corners.
+         * @see @ref Range3D::transformed()
+         */
+        Range2D<T> transformed(const Matrix3<T>& transformation) const;
+
         MAGNUM_RANGE_SUBCLASS_IMPLEMENTATION(2, Range2D, Vector2)
 };
 
@@ -446,6 +547,46 @@ template<class T> class Range3D: public Range<3, T> {
             return (Range<3, T>::min().z() + Range<3, T>::max().z())/T(2);
         }
 
+        /**
+         * @brief Transformed range
+         *
+         * Smallest range containing all eight corners of the range
+         * transformed with @p transformation. Computed using Arvo's method,
+         * i.e. without transforming the corners. Useful e.g. for getting
+         * world-space bounding box of an object for culling.
+         * @see @ref transformBatch(), @ref Range2D::transformed()
+         */
+        Range3D<T> transformed(const Matrix4<T>& transformation) const;
+
+        /**
+         * @brief Transform many ranges with one matrix
+         * @param transformation    Transformation
+         * @param ranges            Ranges to transform
+         * @param out               Output, must have the same size as
+         *      @p ranges
+         *
+         * Equivalent to calling @ref transformed() on each range. If the
+         * target supports SSE, the @ref Magnum::Float "Float" variant uses
+         * SSE intrinsics. The output may alias the input.
+         */
+        static void transformBatch(const Matrix4<T>& transformation, Corrade::Containers::ArrayReference<const Range3D<T>> ranges, Corrade::Containers::ArrayReference<Range3D<T>> out);
+
+        /**
+         * @brief Transform many ranges, each with its own matrix
+         * @param transformations   Transformations
+         * @param ranges            Ranges to transform, must have the same
+         *      size as @p transformations
+         * @param out               Output, must have the same size as
+         *      @p ranges
+         *
+         * Equivalent to calling @ref transformed() on each range with the
+         * matrix at the same index, e.g. for getting world-space bounding
+         * boxes of all objects in a scene. See
+         * @ref transformBatch(const Matrix4<T>&, Corrade::Containers::ArrayReference<const Range3D<T>>, Corrade::Containers::ArrayReference<Range3D<T>>)
+         * for more information.
+         */
+        static void transformBatch(Corrade::Containers::ArrayReference<const Matrix4<T>> transformations, Corrade::Containers::ArrayReference<const Range3D<T>> ranges, Corrade::Containers::ArrayReference<Range3D<T>> out);
+
         MAGNUM_RANGE_SUBCLASS_IMPLEMENTATION(3, Range3D, Vector3)
 };
 
@@ -474,6 +615,191 @@ template<UnsignedInt dimensions, class T> Range<dimensions, T> Range<dimensions,
     return {_min*scaling, _max*scaling};
 }
 
+namespace Implementation {
+
+template<UnsignedInt dimensions, class T> struct RangeBatch {
+    static Range<dimensions, T> fromPoints(const typename RangeTraits<dimensions, T>::Type* const points, const std::size_t count, const std::size_t stride) {
+        typedef typename RangeTraits<dimensions, T>::Type VectorType;
+        if(!count) return {};
+
+        const char* const data = reinterpret_cast<const char*>(points);
+        VectorType min = *points, max = *points;
+        for(std::size_t i = 1; i != count; ++i) {
+            const VectorType& point = *reinterpret_cast<const VectorType*>(data + i*stride);
+            min = Math::min(min, point);
+            max = Math::max(max, point);
+        }
+
+        return {min, max};
+    }
+};
+
+/* Arvo's method -- the minimum and maximum of each product of matrix element
+   and range coordinate is added to the translation */
+template<class T> Range3D<T> transformRange(const Matrix4<T>& transformation, const Range3D<T>& range) {
+    Vector3<T> min = transformation.translation();
+    Vector3<T> max = min;
+    for(std::size_t i = 0; i != 3; ++i) {
+        const Vector3<T> a = transformation[i].xyz()*range.min()[i];
+        const Vector3<T> b = transformation[i].xyz()*range.max()[i];
+        min += Math::min(a, b);
+        max += Math::max(a, b);
+    }
+
+    return {min, max};
+}
+
+template<class T> struct RangeTransformBatch {
+    static void transform(const Matrix4<T>* const transformations, const std::size_t transformationStep, const Range3D<T>* const ranges, Range3D<T>* const out, const std::size_t count) {
+        for(std::size_t i = 0; i != count; ++i)
+            out[i] = transformRange(transformations[i*transformationStep], ranges[i]);
+    }
+};
+
+#ifdef MAGNUM_MATH_SSE
+template<> struct RangeBatch<3, Float> {
+    static Range<3, Float> fromPoints(const Vector3<Float>* const points, const std::size_t count, const std::size_t stride) {
+        /* Generic code for strided or too short input */
+        if(stride != sizeof(Vector3<Float>) || count < 4) {
+            if(!count) return {};
+
+            const char* const data = reinterpret_cast<const char*>(points);
+            Vector3<Float> min = *points, max = *points;
+            for(std::size_t i = 1; i != count; ++i) {
+                const Vector3<Float>& point = *reinterpret_cast<const Vector3<Float>*>(data + i*stride);
+                min = Math::min(min, point);
+                max = Math::max(max, point);
+            }
+
+            return {min, max};
+        }
+
+        /* Four points at a time. The points are tightly packed, thus every
+           three vectors contain X, Y and Z components at fixed lanes and the
+           vectors can be reduced separately without any shuffling. */
+        const Float* const data = points->data();
+        __m128 min0 = _mm_loadu_ps(data + 0), max0 = min0; /* x0 y0 z0 x1 */
+        __m128 min1 = _mm_loadu_ps(data + 4), max1 = min1; /* y1 z1 x2 y2 */
+        __m128 min2 = _mm_loadu_ps(data + 8), max2 = min2; /* z2 x3 y3 z3 */
+        std::size_t i = 4;
+        for(; i + 4 <= count; i += 4) {
+            const __m128 m0 = _mm_loadu_ps(data + 3*i + 0);
+            const __m128 m1 = _mm_loadu_ps(data + 3*i + 4);
+            const __m128 m2 = _mm_loadu_ps(data + 3*i + 8);
+            min0 = _mm_min_ps(min0, m0);
+            min1 = _mm_min_ps(min1, m1);
+            min2 = _mm_min_ps(min2, m2);
+            max0 = _mm_max_ps(max0, m0);
+            max1 = _mm_max_ps(max1, m1);
+            max2 = _mm_max_ps(max2, m2);
+        }
+
+        /* Reduce the lanes, component N is at positions N, N + 3, N + 6 and
+           N + 9 */
+        Float mins[12], maxs[12];
+        _mm_storeu_ps(mins + 0, min0);
+        _mm_storeu_ps(mins + 4, min1);
+        _mm_storeu_ps(mins + 8, min2);
+        _mm_storeu_ps(maxs + 0, max0);
+        _mm_storeu_ps(maxs + 4, max1);
+        _mm_storeu_ps(maxs + 8, max2);
+        Vector3<Float> min = Vector3<Float>::from(mins), max = Vector3<Float>::from(maxs);
+        for(std::size_t j = 3; j != 12; j += 3) {
+            min = Math::min(min, Vector3<Float>::from(mins + j));
+            max = Math::max(max, Vector3<Float>::from(maxs + j));
+        }
+
+        /* Remaining points */
+        for(; i != count; ++i) {
+            min = Math::min(min, points[i]);
+            max = Math::max(max, points[i]);
+        }
+
+        return {min, max};
+    }
+};
+
+template<> struct RangeTransformBatch<Float> {
+    static void transform(const Matrix4<Float>* const transformations, const std::size_t transformationStep, const Range3D<Float>* const ranges, Range3D<Float>* const out, const std::size_t count) {
+        for(std::size_t i = 0; i != count; ++i) {
+            /* The fourth component is ignored */
+            const Float* const m = transformations[i*transformationStep].data();
+            const Vector3<Float> rangeMin = ranges[i].min();
+            const Vector3<Float> rangeMax = ranges[i].max();
+            __m128 min = _mm_loadu_ps(m + 12);
+            __m128 max = min;
+            for(std::size_t j = 0; j != 3; ++j) {
+                const __m128 column = _mm_loadu_ps(m + 4*j);
+                const __m128 a = _mm_mul_ps(column, _mm_set1_ps(rangeMin[j]));
+                const __m128 b = _mm_mul_ps(column, _mm_set1_ps(rangeMax[j]));
+                min = _mm_add_ps(min, _mm_min_ps(a, b));
+                max = _mm_add_ps(max, _mm_max_ps(a, b));
+            }
+
+            Float result[8];
+            _mm_storeu_ps(result + 0, min);
+            _mm_storeu_ps(result + 4, max);
+            out[i] = {Vector3<Float>::from(result), Vector3<Float>::from(result + 4)};
+        }
+    }
+};
+#endif
+
+}
+
+template<UnsignedInt dimensions, class T> Range<dimensions, T> Range<dimensions, T>::fromPoints(const VectorType* const points, const std::size_t count, const std::size_t stride) {
+    return Implementation::RangeBatch<dimensions, T>::fromPoints(points, count, stride);
+}
+
+template<UnsignedInt dimensions, class T> Range<dimensions, T> Range<dimensions, T>::join(const Corrade::Containers::ArrayReference<const Range<dimensions, T>> ranges) {
+    if(!ranges.size()) return {};
+
+    Range<dimensions, T> out = ranges[0];
+    for(std::size_t i = 1; i != ranges.size(); ++i)
+        out = out.joined(ranges[i]);
+
+    return out;
+}
+
+template<UnsignedInt dimensions, class T> Range<dimensions, T> Range<dimensions, T>::intersect(const Corrade::Containers::ArrayReference<const Range<dimensions, T>> ranges) {
+    if(!ranges.size()) return {};
+
+    Range<dimensions, T> out = ranges[0];
+    for(std::size_t i = 1; i != ranges.size(); ++i)
+        out = out.intersected(ranges[i]);
+
+    return out;
+}
+
+template<class T> Range2D<T> Range2D<T>::transformed(const Matrix3<T>& transformation) const {
+    Vector2<T> min = transformation.translation();
+    Vector2<T> max = min;
+    for(std::size_t i = 0; i != 2; ++i) {
+        const Vector2<T> a = transformation[i].xy()*Range<2, T>::min()[i];
+        const Vector2<T> b = transformation[i].xy()*Range<2, T>::max()[i];
+        min += Math::min(a, b);
+        max += Math::max(a, b);
+    }
+
+    return {min, max};
+}
+
+template<class T> Range3D<T> Range3D<T>::transformed(const Matrix4<T>& transformation) const {
+    return Implementation::transformRange(transformation, *this);
+}
+
+template<class T> void Range3D<T>::transformBatch(const Matrix4<T>& transformation, const Corrade::Containers::ArrayReference<const Range3D<T>> ranges, const Corrade::Containers::ArrayReference<Range3D<T>> out) {
+    CORRADE_ASSERT(ranges.size() == out.size(),
+        "Math::Range3D::transformBatch(): expected" << ranges.size() << "output ranges but got" << out.size(), );
+    Implementation::RangeTransformBatch<T>::transform(&transformation, 0, ranges.data(), out.data(), ranges.size());
+}
+
+template<class T> void Range3D<T>::transformBatch(const Corrade::Containers::ArrayReference<const Matrix4<T>> transformations, const Corrade::Containers::ArrayReference<const Range3D<T>> ranges, const Corrade::Containers::ArrayReference<Range3D<T>> out) {
+    CORRADE_ASSERT(transformations.size() == ranges.size() && ranges.size() == out.size(),
+        "Math::Range3D::transformBatch(): expected" << transformations.size() << "ranges and output ranges but got" << ranges.size() << "and" << out.size(), );
+    Implementation::RangeTransformBatch<T>::transform(transformations.data(), 1, ranges.data(), out.data(), ranges.size());
+}
+
 }}
 
 namespace Corrade { namespace Utility {
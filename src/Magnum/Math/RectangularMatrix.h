@@ -179,7 +179,7 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          * stored.
          * @see @ref operator[]()
          */
-        Vector<cols, T> row(std::size_t row) const;
+        constexpr Vector<cols, T> row(std::size_t row) const;
 
         /** @brief Equality comparison */
         bool operator==(const RectangularMatrix<cols, rows, T>& other) const {
@@ -206,7 +206,7 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          *      \boldsymbol B_j = -\boldsymbol A_j
          * @f]
          */
-        RectangularMatrix<cols, rows, T> operator-() const;
+        constexpr RectangularMatrix<cols, rows, T> operator-() const;
 
         /**
          * @brief Add and assign matrix
@@ -227,8 +227,8 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          *
          * @see @ref operator+=()
          */
-        RectangularMatrix<cols, rows, T> operator+(const RectangularMatrix<cols, rows, T>& other) const {
-            return RectangularMatrix<cols, rows, T>(*this)+=other;
+        constexpr RectangularMatrix<cols, rows, T> operator+(const RectangularMatrix<cols, rows, T>& other) const {
+            return addInternal(typename Implementation::GenerateSequence<cols>::Type(), other);
         }
 
         /**
@@ -250,8 +250,8 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          *
          * @see @ref operator-=()
          */
-        RectangularMatrix<cols, rows, T> operator-(const RectangularMatrix<cols, rows, T>& other) const {
-            return RectangularMatrix<cols, rows, T>(*this)-=other;
+        constexpr RectangularMatrix<cols, rows, T> operator-(const RectangularMatrix<cols, rows, T>& other) const {
+            return subtractInternal(typename Implementation::GenerateSequence<cols>::Type(), other);
         }
 
         /**
@@ -273,8 +273,8 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          *
          * @see @ref operator*=(T), @ref operator*(T, const RectangularMatrix<cols, rows, T>&)
          */
-        RectangularMatrix<cols, rows, T> operator*(T number) const {
-            return RectangularMatrix<cols, rows, T>(*this) *= number;
+        constexpr RectangularMatrix<cols, rows, T> operator*(T number) const {
+            return multiplyInternal(typename Implementation::GenerateSequence<cols>::Type(), number);
         }
 
         /**
@@ -297,8 +297,8 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          * @see @ref operator/=(T),
          *      @ref operator/(T, const RectangularMatrix<cols, rows, T>&)
          */
-        RectangularMatrix<cols, rows, T> operator/(T number) const {
-            return RectangularMatrix<cols, rows, T>(*this) /= number;
+        constexpr RectangularMatrix<cols, rows, T> operator/(T number) const {
+            return divideInternal(typename Implementation::GenerateSequence<cols>::Type(), number);
         }
 
         /**
@@ -307,8 +307,12 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          * @f[
          *      (\boldsymbol {AB})_{ji} = \sum_{k=0}^{m-1} \boldsymbol A_{ki} \boldsymbol B_{jk}
          * @f]
+         *
+         * Usable in constant expressions, except for the 4x4
+         * @ref Magnum::Float "Float" variant if built with
+         * @ref MAGNUM_BUILD_SIMD, which is implemented with SIMD intrinsics.
          */
-        template<std::size_t size> RectangularMatrix<size, rows, T> operator*(const RectangularMatrix<size, cols, T>& other) const;
+        template<std::size_t size> constexpr RectangularMatrix<size, rows, T> operator*(const RectangularMatrix<size, cols, T>& other) const;
 
         /**
          * @brief Multiply vector
@@ -318,16 +322,14 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          *      (\boldsymbol {Aa})_i = \sum_{k=0}^{m-1} \boldsymbol A_{ki} \boldsymbol a_k
          * @f]
          */
-        Vector<rows, T> operator*(const Vector<cols, T>& other) const {
-            return operator*(RectangularMatrix<1, cols, T>(other))[0];
-        }
+        constexpr Vector<rows, T> operator*(const Vector<cols, T>& other) const;
 
         /**
          * @brief Transposed matrix
          *
          * @see @ref row()
          */
-        RectangularMatrix<rows, cols, T> transposed() const;
+        constexpr RectangularMatrix<rows, cols, T> transposed() const;
 
         /**
          * @brief Values on diagonal
@@ -363,6 +365,17 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
 
         template<std::size_t ...sequence> constexpr Vector<DiagonalSize, T> diagonalInternal(Implementation::Sequence<sequence...>) const;
 
+        /* Implementation for the constexpr arithmetic operators, row() and
+           transposed() */
+        template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> negateInternal(Implementation::Sequence<sequence...>) const;
+        template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> addInternal(Implementation::Sequence<sequence...>, const RectangularMatrix<cols, rows, T>& other) const;
+        template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> subtractInternal(Implementation::Sequence<sequence...>, const RectangularMatrix<cols, rows, T>& other) const;
+        template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> multiplyInternal(Implementation::Sequence<sequence...>, T number) const;
+        template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> divideInternal(Implementation::Sequence<sequence...>, T number) const;
+        template<std::size_t size, std::size_t ...sequence> constexpr RectangularMatrix<size, rows, T> multiplyInternal(Implementation::Sequence<sequence...>, const RectangularMatrix<size, cols, T>& other) const;
+        template<std::size_t ...sequence> constexpr Vector<cols, T> rowInternal(Implementation::Sequence<sequence...>, std::size_t row) const;
+        template<std::size_t ...sequence> constexpr RectangularMatrix<rows, cols, T> transposedInternal(Implementation::Sequence<sequence...>) const;
+
         Vector<rows, T> _data[cols];
 };
 
@@ -425,7 +438,7 @@ template<class T> using Matrix4x3 = RectangularMatrix<4, 3, T>;
 
 Same as @ref RectangularMatrix::operator*(T) const.
 */
-template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<cols, rows, T> operator*(
+template<std::size_t cols, std::size_t rows, class T> constexpr RectangularMatrix<cols, rows, T> operator*(
     #ifdef DOXYGEN_GENERATING_OUTPUT
     T
     #else
@@ -468,7 +481,7 @@ Internally the same as multiplying one-column matrix with one-row matrix. @f[
 @f]
 @see @ref RectangularMatrix::operator*(const RectangularMatrix<size, cols, T>&) const
 */
-template<std::size_t size, std::size_t cols, class T> inline RectangularMatrix<cols, size, T> operator*(const Vector<size, T>& vector, const RectangularMatrix<cols, 1, T>& matrix) {
+template<std::size_t size, std::size_t cols, class T> constexpr RectangularMatrix<cols, size, T> operator*(const Vector<size, T>& vector, const RectangularMatrix<cols, 1, T>& matrix) {
     return RectangularMatrix<1, size, T>(vector)*matrix;
 }
 
@@ -527,62 +540,76 @@ extern template Corrade::Utility::Debug MAGNUM_EXPORT operator<<(Corrade::Utilit
         return Math::RectangularMatrix<cols, rows, T>::fromDiagonal(diagonal); \
     }                                                                       \
                                                                             \
-    __VA_ARGS__ operator-() const {                                         \
+    constexpr __VA_ARGS__ operator-() const {                               \
         return Math::RectangularMatrix<cols, rows, T>::operator-();         \
     }                                                                       \
     __VA_ARGS__& operator+=(const Math::RectangularMatrix<cols, rows, T>& other) { \
         Math::RectangularMatrix<cols, rows, T>::operator+=(other);          \
         return *this;                                                       \
     }                                                                       \
-    __VA_ARGS__ operator+(const Math::RectangularMatrix<cols, rows, T>& other) const { \
+    constexpr __VA_ARGS__ operator+(const Math::RectangularMatrix<cols, rows, T>& other) const { \
         return Math::RectangularMatrix<cols, rows, T>::operator+(other);    \
     }                                                                       \
     __VA_ARGS__& operator-=(const Math::RectangularMatrix<cols, rows, T>& other) { \
         Math::RectangularMatrix<cols, rows, T>::operator-=(other);          \
         return *this;                                                       \
     }                                                                       \
-    __VA_ARGS__ operator-(const Math::RectangularMatrix<cols, rows, T>& other) const { \
+    constexpr __VA_ARGS__ operator-(const Math::RectangularMatrix<cols, rows, T>& other) const { \
         return Math::RectangularMatrix<cols, rows, T>::operator-(other);    \
     }                                                                       \
     __VA_ARGS__& operator*=(T number) {                                     \
         Math::RectangularMatrix<cols, rows, T>::operator*=(number);         \
         return *this;                                                       \
     }                                                                       \
-    __VA_ARGS__ operator*(T number) const {                                 \
+    constexpr __VA_ARGS__ operator*(T number) const {                       \
         return Math::RectangularMatrix<cols, rows, T>::operator*(number);   \
     }                                                                       \
     __VA_ARGS__& operator/=(T number) {                                     \
         Math::RectangularMatrix<cols, rows, T>::operator/=(number);         \
         return *this;                                                       \
     }                                                                       \
-    __VA_ARGS__ operator/(T number) const {                                 \
+    constexpr __VA_ARGS__ operator/(T number) const {                       \
         return Math::RectangularMatrix<cols, rows, T>::operator/(number);   \
     }
 
 #define MAGNUM_MATRIX_OPERATOR_IMPLEMENTATION(...)                          \
-    template<std::size_t size, class T> inline __VA_ARGS__ operator*(typename std::common_type<T>::type number, const __VA_ARGS__& matrix) { \
+    template<std::size_t size, class T> constexpr __VA_ARGS__ operator*(typename std::common_type<T>::type number, const __VA_ARGS__& matrix) { \
         return number*static_cast<const Math::RectangularMatrix<size, size, T>&>(matrix); \
     }                                                                       \
     template<std::size_t size, class T> inline __VA_ARGS__ operator/(typename std::common_type<T>::type number, const __VA_ARGS__& matrix) { \
         return number/static_cast<const Math::RectangularMatrix<size, size, T>&>(matrix); \
     }                                                                       \
-    template<std::size_t size, class T> inline __VA_ARGS__ operator*(const Vector<size, T>& vector, const RectangularMatrix<size, 1, T>& matrix) { \
+    template<std::size_t size, class T> constexpr __VA_ARGS__ operator*(const Vector<size, T>& vector, const RectangularMatrix<size, 1, T>& matrix) { \
         return Math::RectangularMatrix<1, size, T>(vector)*matrix;          \
     }
 
 #define MAGNUM_MATRIXn_OPERATOR_IMPLEMENTATION(size, Type)                  \
-    template<class T> inline Type<T> operator*(typename std::common_type<T>::type number, const Type<T>& matrix) { \
+    template<class T> constexpr Type<T> operator*(typename std::common_type<T>::type number, const Type<T>& matrix) { \
         return number*static_cast<const Math::RectangularMatrix<size, size, T>&>(matrix); \
     }                                                                       \
     template<class T> inline Type<T> operator/(typename std::common_type<T>::type number, const Type<T>& matrix) { \
         return number/static_cast<const Math::RectangularMatrix<size, size, T>&>(matrix); \
     }                                                                       \
-    template<class T> inline Type<T> operator*(const Vector<size, T>& vector, const RectangularMatrix<size, 1, T>& matrix) { \
+    template<class T> constexpr Type<T> operator*(const Vector<size, T>& vector, const RectangularMatrix<size, 1, T>& matrix) { \
         return Math::RectangularMatrix<1, size, T>(vector)*matrix;          \
     }
 #endif
 
 namespace Implementation {
+    /* Linear combination of matrix columns with vector components (i.e.
+       matrix-vector product), unrolled so it's usable in constant
+       expressions. Accumulates in the same order as the original loop. */
+    template<std::size_t i> struct MatrixColumnCombination {
+        template<std::size_t cols, std::size_t rows, class T> constexpr static Vector<rows, T> combine(const RectangularMatrix<cols, rows, T>& matrix, const Vector<cols, T>& vector) {
+            return MatrixColumnCombination<i - 1>::combine(matrix, vector) + matrix[i]*vector[i];
+        }
+    };
+    template<> struct MatrixColumnCombination<0> {
+        template<std::size_t cols, std::size_t rows, class T> constexpr static Vector<rows, T> combine(const RectangularMatrix<cols, rows, T>& matrix, const Vector<cols, T>& vector) {
+            return matrix[0]*vector[0];
+        }
+    };
+
     template<std::size_t rows, std::size_t i, class T, std::size_t ...sequence> constexpr Vector<rows, T> diagonalMatrixColumn2(Implementation::Sequence<sequence...>, const T& number) {
         return {(sequence == i ? number : T(0))...};
     }
@@ -593,43 +620,38 @@ namespace Implementation {
 
 template<std::size_t cols, std::size_t rows, class T> template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T>::RectangularMatrix(Implementation::Sequence<sequence...>, const Vector<DiagonalSize, T>& diagonal): _data{Implementation::diagonalMatrixColumn<rows, sequence>(sequence < DiagonalSize ? diagonal[sequence] : T{})...} {}
 
-template<std::size_t cols, std::size_t rows, class T> inline Vector<cols, T> RectangularMatrix<cols, rows, T>::row(std::size_t row) const {
-    Vector<cols, T> out;
-
-    for(std::size_t i = 0; i != cols; ++i)
-        out[i] = _data[i][row];
+template<std::size_t cols, std::size_t rows, class T> constexpr Vector<cols, T> RectangularMatrix<cols, rows, T>::row(std::size_t row) const {
+    return rowInternal(typename Implementation::GenerateSequence<cols>::Type(), row);
+}
 
-    return out;
+template<std::size_t cols, std::size_t rows, class T> constexpr RectangularMatrix<cols, rows, T> RectangularMatrix<cols, rows, T>::operator-() const {
+    return negateInternal(typename Implementation::GenerateSequence<cols>::Type());
 }
 
-template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<cols, rows, T> RectangularMatrix<cols, rows, T>::operator-() const {
-    RectangularMatrix<cols, rows, T> out;
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t size> constexpr RectangularMatrix<size, rows, T> RectangularMatrix<cols, rows, T>::operator*(const RectangularMatrix<size, cols, T>& other) const {
+    return multiplyInternal(typename Implementation::GenerateSequence<size>::Type(), other);
+}
 
-    for(std::size_t i = 0; i != cols; ++i)
-        out._data[i] = -_data[i];
+template<std::size_t cols, std::size_t rows, class T> constexpr Vector<rows, T> RectangularMatrix<cols, rows, T>::operator*(const Vector<cols, T>& other) const {
+    return Implementation::MatrixColumnCombination<cols - 1>::combine(*this, other);
+}
 
+#if defined(MAGNUM_MATH_SIMD) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> template<std::size_t size> inline RectangularMatrix<size, 4, Float> RectangularMatrix<4, 4, Float>::operator*(const RectangularMatrix<size, 4, Float>& other) const {
+    RectangularMatrix<size, 4, Float> out;
+    Implementation::simdMultiply4x4(data(), other.data(), out.data(), size);
     return out;
 }
 
-template<std::size_t cols, std::size_t rows, class T> template<std::size_t size> inline RectangularMatrix<size, rows, T> RectangularMatrix<cols, rows, T>::operator*(const RectangularMatrix<size, cols, T>& other) const {
-    RectangularMatrix<size, rows, T> out;
-
-    for(std::size_t col = 0; col != size; ++col)
-        for(std::size_t row = 0; row != rows; ++row)
-            for(std::size_t pos = 0; pos != cols; ++pos)
-                out[col][row] += _data[pos][row]*other._data[col][pos];
-
+template<> inline Vector<4, Float> RectangularMatrix<4, 4, Float>::operator*(const Vector<4, Float>& other) const {
+    Vector<4, Float> out;
+    Implementation::simdMultiply4x4(data(), other.data(), out.data(), 1);
     return out;
 }
+#endif
 
-template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<rows, cols, T> RectangularMatrix<cols, rows, T>::transposed() const {
-    RectangularMatrix<rows, cols, T> out;
-
-    for(std::size_t col = 0; col != cols; ++col)
-        for(std::size_t row = 0; row != rows; ++row)
-            out[row][col] = _data[col][row];
-
-    return out;
+template<std::size_t cols, std::size_t rows, class T> constexpr RectangularMatrix<rows, cols, T> RectangularMatrix<cols, rows, T>::transposed() const {
+    return transposedInternal(typename Implementation::GenerateSequence<rows>::Type());
 }
 
 template<std::size_t cols, std::size_t rows, class T> constexpr auto RectangularMatrix<cols, rows, T>::diagonal() const -> Vector<DiagonalSize, T> { return diagonalInternal(typename Implementation::GenerateSequence<DiagonalSize>::Type()); }
@@ -638,6 +660,38 @@ template<std::size_t cols, std::size_t rows, class T> constexpr auto Rectangular
 template<std::size_t cols, std::size_t rows, class T> template<std::size_t ...sequence> constexpr auto RectangularMatrix<cols, rows, T>::diagonalInternal(Implementation::Sequence<sequence...>) const -> Vector<DiagonalSize, T> {
     return {(*this)[sequence][sequence]...};
 }
+
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> RectangularMatrix<cols, rows, T>::negateInternal(Implementation::Sequence<sequence...>) const {
+    return {-_data[sequence]...};
+}
+
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> RectangularMatrix<cols, rows, T>::addInternal(Implementation::Sequence<sequence...>, const RectangularMatrix<cols, rows, T>& other) const {
+    return {(_data[sequence] + other._data[sequence])...};
+}
+
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> RectangularMatrix<cols, rows, T>::subtractInternal(Implementation::Sequence<sequence...>, const RectangularMatrix<cols, rows, T>& other) const {
+    return {(_data[sequence] - other._data[sequence])...};
+}
+
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> RectangularMatrix<cols, rows, T>::multiplyInternal(Implementation::Sequence<sequence...>, T number) const {
+    return {(_data[sequence]*number)...};
+}
+
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t ...sequence> constexpr RectangularMatrix<cols, rows, T> RectangularMatrix<cols, rows, T>::divideInternal(Implementation::Sequence<sequence...>, T number) const {
+    return {(_data[sequence]/number)...};
+}
+
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t size, std::size_t ...sequence> constexpr RectangularMatrix<size, rows, T> RectangularMatrix<cols, rows, T>::multiplyInternal(Implementation::Sequence<sequence...>, const RectangularMatrix<size, cols, T>& other) const {
+    return {Implementation::MatrixColumnCombination<cols - 1>::combine(*this, other._data[sequence])...};
+}
+
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t ...sequence> constexpr Vector<cols, T> RectangularMatrix<cols, rows, T>::rowInternal(Implementation::Sequence<sequence...>, std::size_t row) const {
+    return {_data[sequence][row]...};
+}
+
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t ...sequence> constexpr RectangularMatrix<rows, cols, T> RectangularMatrix<cols, rows, T>::transposedInternal(Implementation::Sequence<sequence...>) const {
+    return {rowInternal(typename Implementation::GenerateSequence<cols>::Type(), sequence)...};
+}
 #endif
 
 }}
@@ -26,7 +26,7 @@
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Functions.h"
-#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Vector4.h"
 
 namespace Magnum { namespace Math { namespace Test {
 
@@ -50,6 +50,7 @@ struct FunctionsTest: Corrade::TestSuite::Tester {
 
     void sqrt();
     void sqrtInverted();
+    void sqrtInvertedFast();
     void lerp();
     void lerpInverted();
     void fma();
@@ -65,8 +66,15 @@ struct FunctionsTest: Corrade::TestSuite::Tester {
     void pow();
     void log();
     void log2();
+    void packHalf();
+    void unpackHalf();
+    void packHalfBatch();
+    void unpackHalfBatch();
     void trigonometric();
     void trigonometricWithBase();
+    void sincos();
+    void trigonometricFast();
+    void trigonometricFastVector();
 };
 
 typedef Math::Constants<Float> Constants;
@@ -77,6 +85,7 @@ typedef Math::Vector3<Float> Vector3;
 typedef Math::Vector3<UnsignedByte> Vector3ub;
 typedef Math::Vector3<Byte> Vector3b;
 typedef Math::Vector3<Int> Vector3i;
+typedef Math::Vector4<Float> Vector4;
 
 FunctionsTest::FunctionsTest() {
     addTests({&FunctionsTest::min,
@@ -96,6 +105,7 @@ FunctionsTest::FunctionsTest() {
 
               &FunctionsTest::sqrt,
               &FunctionsTest::sqrtInverted,
+              &FunctionsTest::sqrtInvertedFast,
               &FunctionsTest::lerp,
               &FunctionsTest::lerpInverted,
               &FunctionsTest::fma,
@@ -111,8 +121,15 @@ FunctionsTest::FunctionsTest() {
               &FunctionsTest::pow,
               &FunctionsTest::log,
               &FunctionsTest::log2,
+              &FunctionsTest::packHalf,
+              &FunctionsTest::unpackHalf,
+              &FunctionsTest::packHalfBatch,
+              &FunctionsTest::unpackHalfBatch,
               &FunctionsTest::trigonometric,
-              &FunctionsTest::trigonometricWithBase});
+              &FunctionsTest::trigonometricWithBase,
+              &FunctionsTest::sincos,
+              &FunctionsTest::trigonometricFast,
+              &FunctionsTest::trigonometricFastVector});
 }
 
 void FunctionsTest::min() {
@@ -220,6 +237,17 @@ void FunctionsTest::sqrtInverted() {
     CORRADE_COMPARE(Math::sqrtInverted(Vector3(1.0f, 4.0f, 16.0f)), Vector3(1.0f, 0.5f, 0.25f));
 }
 
+void FunctionsTest::sqrtInvertedFast() {
+    for(Float a: {1.0e-30f, 0.3f, 1.0f, 16.0f, 12345.6f, 1.0e30f}) {
+        CORRADE_VERIFY(std::abs(Math::sqrtInvertedFast(a)*std::sqrt(a) - 1.0f) < 5.0e-6f);
+    }
+
+    const Vector4 b = Math::sqrtInvertedFast(Vector4(1.0f, 4.0f, 16.0f, 0.01f));
+    const Vector4 expected(1.0f, 0.5f, 0.25f, 10.0f);
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_VERIFY(std::abs(b[i]/expected[i] - 1.0f) < 5.0e-6f);
+}
+
 void FunctionsTest::lerp() {
     /* Floating-point / integral scalar */
     CORRADE_COMPARE(Math::lerp(2.0f, 5.0f, 0.5f), 3.5f);
@@ -410,6 +438,63 @@ void FunctionsTest::log2() {
     CORRADE_COMPARE(Math::log2(2153), 11);
 }
 
+void FunctionsTest::packHalf() {
+    CORRADE_COMPARE(Math::packHalf(0.0f), 0x0000);
+    CORRADE_COMPARE(Math::packHalf(-0.0f), 0x8000);
+    CORRADE_COMPARE(Math::packHalf(1.0f), 0x3c00);
+    CORRADE_COMPARE(Math::packHalf(-2.0f), 0xc000);
+    CORRADE_COMPARE(Math::packHalf(1.0f/3.0f), 0x3555);
+    CORRADE_COMPARE(Math::packHalf(65504.0f), 0x7bff);
+
+    /* Round to nearest even */
+    CORRADE_COMPARE(Math::packHalf(1.0f + 1.0f/2048.0f), 0x3c00);
+    CORRADE_COMPARE(Math::packHalf(1.0f + 3.0f/2048.0f), 0x3c02);
+
+    /* Denormals */
+    CORRADE_COMPARE(Math::packHalf(1.0f/16777216.0f), 0x0001);
+    CORRADE_COMPARE(Math::packHalf(-3.0f/16777216.0f), 0x8003);
+
+    /* Overflow, infinity and NaN */
+    CORRADE_COMPARE(Math::packHalf(65520.0f), 0x7c00);
+    CORRADE_COMPARE(Math::packHalf(1.0e6f), 0x7c00);
+    CORRADE_COMPARE(Math::packHalf(Constants::inf()), 0x7c00);
+    CORRADE_COMPARE(Math::packHalf(-Constants::inf()), 0xfc00);
+    CORRADE_COMPARE(Math::packHalf(Constants::nan()), 0x7e00);
+}
+
+void FunctionsTest::unpackHalf() {
+    CORRADE_COMPARE(Math::unpackHalf(0x0000), 0.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0x3c00), 1.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0xc000), -2.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0x3555), 0.33325195f);
+    CORRADE_COMPARE(Math::unpackHalf(0x7bff), 65504.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0x0001), 1.0f/16777216.0f);
+    CORRADE_VERIFY(Math::unpackHalf(0x7c00) == Constants::inf());
+    CORRADE_VERIFY(Math::unpackHalf(0xfc00) == -Constants::inf());
+    CORRADE_VERIFY(Math::unpackHalf(0x7e00) != Math::unpackHalf(0x7e00));
+}
+
+void FunctionsTest::packHalfBatch() {
+    /* More than one SIMD block and a scalar tail */
+    const Float in[]{0.0f, -0.0f, 1.0f, -2.0f, 1.0f/3.0f, 65504.0f,
+        1.0f/16777216.0f, -3.0f/16777216.0f, 65520.0f, 1.0e6f, 0.5f};
+    UnsignedShort out[11];
+    Math::packHalf(in, out);
+
+    for(std::size_t i = 0; i != 11; ++i)
+        CORRADE_COMPARE(out[i], Math::packHalf(in[i]));
+}
+
+void FunctionsTest::unpackHalfBatch() {
+    const UnsignedShort in[]{0x0000, 0x8000, 0x3c00, 0xc000, 0x3555, 0x7bff,
+        0x0001, 0x8003, 0x7c00, 0xfc00, 0x3800};
+    Float out[11];
+    Math::unpackHalf(in, out);
+
+    for(std::size_t i = 0; i != 11; ++i)
+        CORRADE_COMPARE(out[i], Math::unpackHalf(in[i]));
+}
+
 void FunctionsTest::trigonometric() {
     CORRADE_COMPARE(Math::sin(Deg(30.0f)), 0.5f);
     CORRADE_COMPARE(Math::sin(Rad(Constants::pi()/6)), 0.5f);
@@ -439,6 +524,49 @@ void FunctionsTest::trigonometricWithBase() {
     CORRADE_COMPARE(Math::tan(2*Rad(Constants::pi()/8)), 1.0f);
 }
 
+void FunctionsTest::sincos() {
+    const auto expected = std::make_pair(0.5f, 0.866025404f);
+    CORRADE_COMPARE(Math::sincos(Deg(30.0f)), expected);
+    CORRADE_COMPARE(Math::sincos(Rad(Constants::pi()/6)), expected);
+    CORRADE_COMPARE(Math::sincos(2*Deg(15.0f)), expected);
+}
+
+void FunctionsTest::trigonometricFast() {
+    for(Float angle = -1000.0f; angle < 1000.0f; angle += 0.0137f) {
+        const std::pair<Float, Float> sincos = Math::sincosFast(Rad(angle));
+        CORRADE_VERIFY(std::abs(Math::sinFast(Rad(angle)) - std::sin(angle)) < 2.0e-6f);
+        CORRADE_VERIFY(std::abs(Math::cosFast(Rad(angle)) - std::cos(angle)) < 2.0e-6f);
+        CORRADE_COMPARE(sincos.first, Math::sinFast(Rad(angle)));
+        CORRADE_COMPARE(sincos.second, Math::cosFast(Rad(angle)));
+    }
+
+    /* Extremes are not exceeding the range */
+    CORRADE_VERIFY(std::abs(Math::sinFast(Deg(90.0f))) <= 1.0f);
+    CORRADE_VERIFY(std::abs(Math::cosFast(Deg(0.0f))) <= 1.0f);
+
+    for(Float value = -1.0f; value <= 1.0f; value += 0.001f) {
+        CORRADE_VERIFY(std::abs(Float(Math::asinFast(value)) - std::asin(value)) < 7.0e-5f);
+        CORRADE_VERIFY(std::abs(Float(Math::acosFast(value)) - std::acos(value)) < 7.0e-5f);
+    }
+}
+
+void FunctionsTest::trigonometricFastVector() {
+    /* Four components go through the SIMD variant if enabled */
+    const Vector4 a(-7.5f, 0.3f, 2.0f, 1234.5f);
+    const Vector3 b(-7.5f, 0.3f, 2.0f);
+    const std::pair<Vector4, Vector4> sincosA = Math::sincosFast(a);
+    const std::pair<Vector3, Vector3> sincosB = Math::sincosFast(b);
+    for(std::size_t i = 0; i != 4; ++i) {
+        CORRADE_COMPARE(Math::sinFast(a)[i], Math::sinFast(Rad(a[i])));
+        CORRADE_COMPARE(Math::cosFast(a)[i], Math::cosFast(Rad(a[i])));
+        CORRADE_COMPARE(sincosA.first[i], Math::sinFast(Rad(a[i])));
+        CORRADE_COMPARE(sincosA.second[i], Math::cosFast(Rad(a[i])));
+    }
+    CORRADE_COMPARE(Math::sinFast(b), sincosB.first);
+    CORRADE_COMPARE(Math::cosFast(b), sincosB.second);
+    CORRADE_COMPARE(sincosB.first[2], Math::sinFast(Rad(2.0f)));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::FunctionsTest)
@@ -0,0 +1,100 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Half.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct HalfTest: Corrade::TestSuite::Tester {
+    explicit HalfTest();
+
+    void construct();
+    void constructDefault();
+    void constructData();
+    void compare();
+    void negate();
+
+    void debug();
+};
+
+HalfTest::HalfTest() {
+    addTests({&HalfTest::construct,
+              &HalfTest::constructDefault,
+              &HalfTest::constructData,
+              &HalfTest::compare,
+              &HalfTest::negate,
+
+              &HalfTest::debug});
+}
+
+void HalfTest::construct() {
+    const Half a{1.0f};
+    CORRADE_COMPARE(a.data(), 0x3c00);
+    CORRADE_COMPARE(Float(a), 1.0f);
+
+    const Half b{-2.0f};
+    CORRADE_COMPARE(b.data(), 0xc000);
+    CORRADE_COMPARE(Float(b), -2.0f);
+}
+
+void HalfTest::constructDefault() {
+    constexpr Half a;
+    CORRADE_COMPARE(a.data(), 0x0000);
+    CORRADE_COMPARE(Float(a), 0.0f);
+}
+
+void HalfTest::constructData() {
+    constexpr Half a{UnsignedShort(0x3555)};
+    constexpr UnsignedShort b = a.data();
+    CORRADE_COMPARE(b, 0x3555);
+    CORRADE_COMPARE(Float(a), 0.33325195f);
+}
+
+void HalfTest::compare() {
+    CORRADE_VERIFY(Half{1.0f} == Half{UnsignedShort(0x3c00)});
+    CORRADE_VERIFY(Half{1.0f} != Half{-1.0f});
+
+    /* Bitwise comparison, so signed zeros differ */
+    CORRADE_VERIFY(Half{0.0f} != Half{-0.0f});
+}
+
+void HalfTest::negate() {
+    CORRADE_COMPARE(Float(-Half{3.5f}), -3.5f);
+    CORRADE_COMPARE((-Half{}).data(), 0x8000);
+}
+
+void HalfTest::debug() {
+    std::ostringstream o;
+
+    Debug(&o) << Half{2.5f};
+    CORRADE_COMPARE(o.str(), "2.5\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::HalfTest)
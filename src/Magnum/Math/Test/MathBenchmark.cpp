@@ -0,0 +1,172 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Test/BenchmarkTester.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct MathBenchmark: Magnum::Test::BenchmarkTester {
+    explicit MathBenchmark();
+
+    void vectorDot();
+    void vectorCross();
+    void vectorNormalized();
+    void matrixMultiply();
+    void matrixTransformPoint();
+    void quaternionMultiply();
+    void quaternionSlerp();
+    void quaternionToMatrix();
+
+    private:
+        std::vector<Vector3<Float>> _vectors;
+        std::vector<Vector4<Float>> _vectors4;
+        std::vector<Matrix4<Float>> _matrices;
+        std::vector<Quaternion<Float>> _quaternions;
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Quaternion<Float> Quaternion;
+
+namespace {
+    /* Enough data to not fit into L1 cache, repeated few times */
+    constexpr std::size_t Count = 4096;
+    constexpr std::size_t Repeats = 64;
+}
+
+MathBenchmark::MathBenchmark() {
+    addTests({&MathBenchmark::vectorDot,
+              &MathBenchmark::vectorCross,
+              &MathBenchmark::vectorNormalized,
+              &MathBenchmark::matrixMultiply,
+              &MathBenchmark::matrixTransformPoint,
+              &MathBenchmark::quaternionMultiply,
+              &MathBenchmark::quaternionSlerp,
+              &MathBenchmark::quaternionToMatrix});
+
+    _vectors.reserve(Count);
+    _vectors4.reserve(Count);
+    _matrices.reserve(Count);
+    _quaternions.reserve(Count);
+    for(std::size_t i = 0; i != Count; ++i) {
+        const Vector3 axis = Vector3(1.0f, Float(i%7), -1.0f).normalized();
+        _vectors.push_back({Float(i%16), 1.0f + Float(i%5), -2.0f});
+        _vectors4.push_back({Float(i%16), 1.0f + Float(i%5), -2.0f, 0.5f});
+        _matrices.push_back(Matrix4::translation(_vectors.back())*
+            Matrix4::rotation(Deg(Float(i%360)), axis));
+        _quaternions.push_back(Quaternion::rotation(Deg(Float(i%360)), axis));
+    }
+}
+
+void MathBenchmark::vectorDot() {
+    Float sum{};
+    benchmark("Math::dot(Vector4, Vector4):", Count, Repeats, [this, &sum]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            sum += Math::dot(_vectors4[i], _vectors4[Count - i - 1]);
+    });
+
+    /* Use the result so the computation doesn't get optimized out */
+    CORRADE_VERIFY(sum > 0.0f);
+}
+
+void MathBenchmark::vectorCross() {
+    std::vector<Vector3> out(Count);
+    benchmark("Math::cross(Vector3, Vector3):", Count, Repeats, [this, &out]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Math::cross(_vectors[i], _vectors[Count - i - 1]);
+    });
+
+    CORRADE_COMPARE(out[7], Math::cross(_vectors[7], _vectors[Count - 8]));
+}
+
+void MathBenchmark::vectorNormalized() {
+    std::vector<Vector4> out(Count);
+    benchmark("Vector4::normalized():", Count, Repeats, [this, &out]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = _vectors4[i].normalized();
+    });
+
+    CORRADE_VERIFY(out[Count/2].isNormalized());
+}
+
+void MathBenchmark::matrixMultiply() {
+    std::vector<Matrix4> out(Count);
+    benchmark("Matrix4::operator*(Matrix4):", Count, Repeats, [this, &out]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = _matrices[i]*_matrices[Count - i - 1];
+    });
+
+    CORRADE_COMPARE(out[7], _matrices[7]*_matrices[Count - 8]);
+}
+
+void MathBenchmark::matrixTransformPoint() {
+    std::vector<Vector3> out(Count);
+    benchmark("Matrix4::transformPoint():", Count, Repeats, [this, &out]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = _matrices[i].transformPoint(_vectors[i]);
+    });
+
+    CORRADE_COMPARE(out[7], (_matrices[7]*Vector4{_vectors[7], 1.0f}).xyz());
+}
+
+void MathBenchmark::quaternionMultiply() {
+    std::vector<Quaternion> out(Count);
+    benchmark("Quaternion::operator*(Quaternion):", Count, Repeats, [this, &out]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = _quaternions[i]*_quaternions[Count - i - 1];
+    });
+
+    CORRADE_VERIFY(out[Count/2].isNormalized());
+}
+
+void MathBenchmark::quaternionSlerp() {
+    std::vector<Quaternion> out(Count);
+    benchmark("Math::slerp(Quaternion, Quaternion):", Count, Repeats, [this, &out]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Math::slerp(_quaternions[i], _quaternions[(i + Count/2)%Count], 0.35f);
+    });
+
+    CORRADE_VERIFY(out[Count/2].isNormalized());
+}
+
+void MathBenchmark::quaternionToMatrix() {
+    std::vector<Matrix<3, Float>> out(Count);
+    benchmark("Quaternion::toMatrix():", Count, Repeats, [this, &out]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = _quaternions[i].toMatrix();
+    });
+
+    CORRADE_COMPARE(out[7], _matrices[7].rotation());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::MathBenchmark)
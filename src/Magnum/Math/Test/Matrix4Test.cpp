@@ -82,6 +82,7 @@ struct Matrix4Test: Corrade::TestSuite::Tester {
     void shearingXY();
     void shearingXZ();
     void shearingYZ();
+    void multiplyConstexpr();
     void orthographicProjection();
     void perspectiveProjection();
     void perspectiveProjectionFov();
@@ -94,6 +95,8 @@ struct Matrix4Test: Corrade::TestSuite::Tester {
     void uniformScalingPart();
     void vectorParts();
     void invertedRigid();
+    void invertBatch();
+    void normalMatrixBatch();
     void transform();
 
     void debug();
@@ -130,6 +133,7 @@ Matrix4Test::Matrix4Test() {
               &Matrix4Test::shearingXY,
               &Matrix4Test::shearingXZ,
               &Matrix4Test::shearingYZ,
+              &Matrix4Test::multiplyConstexpr,
               &Matrix4Test::orthographicProjection,
               &Matrix4Test::perspectiveProjection,
               &Matrix4Test::perspectiveProjectionFov,
@@ -142,6 +146,8 @@ Matrix4Test::Matrix4Test() {
               &Matrix4Test::uniformScalingPart,
               &Matrix4Test::vectorParts,
               &Matrix4Test::invertedRigid,
+              &Matrix4Test::invertBatch,
+              &Matrix4Test::normalMatrixBatch,
               &Matrix4Test::transform,
 
               &Matrix4Test::debug,
@@ -360,6 +366,21 @@ void Matrix4Test::shearingYZ() {
     CORRADE_COMPARE(a.transformPoint(Vector3(1.0f)), Vector3(1.0f, 4.0f, -4.0f));
 }
 
+void Matrix4Test::multiplyConstexpr() {
+    /* Integer variant to not be affected by the SIMD specializations */
+    constexpr Matrix4i a = Matrix4i::translation({1, 2, 3})*Matrix4i::scaling({2, 3, 4});
+    CORRADE_COMPARE(a, Matrix4i({2, 0, 0, 0},
+                                {0, 3, 0, 0},
+                                {0, 0, 4, 0},
+                                {1, 2, 3, 1}));
+
+    constexpr Math::Vector4<Int> b = a*Math::Vector4<Int>{1, 1, 1, 1};
+    CORRADE_COMPARE(b, (Math::Vector4<Int>{3, 5, 7, 1}));
+
+    constexpr Matrix4i c = a.transposed();
+    CORRADE_COMPARE(c[0], (Math::Vector4<Int>{2, 0, 0, 1}));
+}
+
 void Matrix4Test::orthographicProjection() {
     Matrix4 expected({0.4f, 0.0f,   0.0f, 0.0f},
                      {0.0f, 0.5f,   0.0f, 0.0f},
@@ -503,6 +524,40 @@ void Matrix4Test::invertedRigid() {
     CORRADE_COMPARE(actual.invertedRigid(), actual.inverted());
 }
 
+void Matrix4Test::invertBatch() {
+    const Matrix4 matrices[]{
+        Matrix4::rotation(Deg(-74.0f), Vector3(-1.0f, 0.5f, 2.0f).normalized())*
+            Matrix4::translation({1.0f, 2.0f, -3.0f}),
+        Matrix4::perspectiveProjection(Deg(45.0f), 4.0f/3.0f, 0.1f, 100.0f),
+        Matrix4::scaling({2.0f, 0.5f, -4.0f})
+    };
+
+    Matrix4 out[3];
+    Matrix4::invertBatch(matrices, out);
+    CORRADE_COMPARE(out[0], matrices[0].invertedRigid());
+    CORRADE_COMPARE(out[1]*matrices[1], Matrix4());
+    CORRADE_COMPARE(out[2], Matrix4::scaling({0.5f, 2.0f, -0.25f}));
+
+    std::ostringstream o;
+    Error::setOutput(&o);
+    Matrix4::invertBatch(matrices, {out, 2});
+    CORRADE_COMPARE(o.str(), "Math::Matrix4::invertBatch(): expected 3 output matrices but got 2\n");
+}
+
+void Matrix4Test::normalMatrixBatch() {
+    const Matrix4 transformations[]{
+        Matrix4::rotationX(Deg(35.0f))*Matrix4::translation({1.0f, 2.0f, -3.0f}),
+        Matrix4::scaling({2.0f, 1.0f, 1.0f})
+    };
+
+    Matrix3x3 out[2];
+    Matrix4::normalMatrixBatch(transformations, out);
+
+    /* Rotation stays the same, scaling is inverted */
+    CORRADE_COMPARE(out[0], transformations[0].rotation());
+    CORRADE_COMPARE(out[1], Matrix4::scaling({0.5f, 1.0f, 1.0f}).rotationScaling());
+}
+
 void Matrix4Test::transform() {
     Matrix4 a = Matrix4::translation({1.0f, -5.0f, 3.5f})*Matrix4::rotation(Deg(90.0f), Vector3::zAxis());
     Vector3 v(1.0f, -2.0f, 5.5f);
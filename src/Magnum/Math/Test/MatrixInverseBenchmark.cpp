@@ -0,0 +1,126 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Algorithms/GaussJordan.h"
+#include "Magnum/Test/BenchmarkTester.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct MatrixInverseBenchmark: Magnum::Test::BenchmarkTester {
+    explicit MatrixInverseBenchmark();
+
+    void gaussJordan();
+    void inverted();
+    void invertedRigid();
+    void invertBatch();
+    void normalMatrixBatch();
+
+    private:
+        std::vector<Matrix4<Float>> _matrices;
+        std::vector<Matrix4<Float>> _out;
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Matrix<3, Float> Matrix3x3;
+typedef Math::Vector3<Float> Vector3;
+
+namespace {
+    /* Enough matrices to not fit into L1 cache, repeated few times */
+    constexpr std::size_t MatrixCount = 4096;
+    constexpr std::size_t Repeats = 64;
+}
+
+MatrixInverseBenchmark::MatrixInverseBenchmark(): _out(MatrixCount) {
+    addTests({&MatrixInverseBenchmark::gaussJordan,
+              &MatrixInverseBenchmark::inverted,
+              &MatrixInverseBenchmark::invertedRigid,
+              &MatrixInverseBenchmark::invertBatch,
+              &MatrixInverseBenchmark::normalMatrixBatch});
+
+    /* Rigid transformations, so all algorithms can be compared */
+    _matrices.reserve(MatrixCount);
+    for(std::size_t i = 0; i != MatrixCount; ++i)
+        _matrices.push_back(Matrix4::translation({Float(i%16), 1.0f, -2.0f})*
+            Matrix4::rotation(Deg(Float(i%360)), Vector3(1.0f, Float(i%7), -1.0f).normalized()));
+}
+
+void MatrixInverseBenchmark::gaussJordan() {
+    benchmark("Algorithms::gaussJordanInPlace():", MatrixCount, Repeats, [this]() {
+        for(std::size_t i = 0; i != MatrixCount; ++i) {
+            RectangularMatrix<4, 4, Float> a = _matrices[i];
+            RectangularMatrix<4, 4, Float> t = Matrix4();
+            Algorithms::gaussJordanInPlace(a, t);
+            _out[i] = Matrix4{t};
+        }
+    });
+
+    /* Use the results so the computation doesn't get optimized out, all
+       matrices are rigid transformations */
+    CORRADE_COMPARE(_out[MatrixCount/2]*_matrices[MatrixCount/2], Matrix4());
+}
+
+void MatrixInverseBenchmark::inverted() {
+    benchmark("Matrix4::inverted():", MatrixCount, Repeats, [this]() {
+        for(std::size_t i = 0; i != MatrixCount; ++i)
+            _out[i] = _matrices[i].inverted();
+    });
+
+    CORRADE_COMPARE(_out[MatrixCount/2]*_matrices[MatrixCount/2], Matrix4());
+}
+
+void MatrixInverseBenchmark::invertedRigid() {
+    benchmark("Matrix4::invertedRigid():", MatrixCount, Repeats, [this]() {
+        for(std::size_t i = 0; i != MatrixCount; ++i)
+            _out[i] = _matrices[i].invertedRigid();
+    });
+
+    CORRADE_COMPARE(_out[MatrixCount/2]*_matrices[MatrixCount/2], Matrix4());
+}
+
+void MatrixInverseBenchmark::invertBatch() {
+    benchmark("Matrix4::invertBatch():", MatrixCount, Repeats, [this]() {
+        Matrix4::invertBatch({_matrices.data(), MatrixCount}, {_out.data(), MatrixCount});
+    });
+
+    CORRADE_COMPARE(_out[MatrixCount/2]*_matrices[MatrixCount/2], Matrix4());
+}
+
+void MatrixInverseBenchmark::normalMatrixBatch() {
+    std::vector<Matrix3x3> normalMatrices(MatrixCount);
+    benchmark("Matrix4::normalMatrixBatch():", MatrixCount, Repeats, [this, &normalMatrices]() {
+        Matrix4::normalMatrixBatch({_matrices.data(), MatrixCount}, {normalMatrices.data(), MatrixCount});
+    });
+
+    /* The matrices are rigid, so the normal matrix is the rotation */
+    CORRADE_COMPARE(normalMatrices[MatrixCount/2], _matrices[MatrixCount/2].rotation());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::MatrixInverseBenchmark)
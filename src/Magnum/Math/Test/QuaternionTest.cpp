@@ -46,6 +46,7 @@ struct QuaternionTest: Corrade::TestSuite::Tester {
     void negated();
     void multiplyDivideScalar();
     void multiply();
+    void multiplyConstexpr();
 
     void dot();
     void dotSelf();
@@ -88,6 +89,7 @@ QuaternionTest::QuaternionTest() {
               &QuaternionTest::negated,
               &QuaternionTest::multiplyDivideScalar,
               &QuaternionTest::multiply,
+              &QuaternionTest::multiplyConstexpr,
 
               &QuaternionTest::dot,
               &QuaternionTest::dotSelf,
@@ -180,6 +182,16 @@ void QuaternionTest::multiply() {
                     Quaternion({-11.0f, -16.5f, 27.5f}, 115.0f));
 }
 
+void QuaternionTest::multiplyConstexpr() {
+    /* Double variant to not be affected by the SIMD specializations */
+    typedef Math::Quaternion<Double> Quaterniond;
+    constexpr Quaterniond a = Quaterniond({-6.0, -9.0, 15.0}, 0.5)*Quaterniond({2.0, 3.0, -5.0}, 2.0);
+    CORRADE_COMPARE(a, Quaterniond({-11.0, -16.5, 27.5}, 115.0));
+
+    constexpr Quaterniond b = (a + a.conjugated())/2.0;
+    CORRADE_COMPARE(b, Quaterniond({}, 115.0));
+}
+
 void QuaternionTest::dot() {
     Quaternion a({ 1.0f, 3.0f, -2.0f}, -4.0f);
     Quaternion b({-0.5f, 1.5f,  3.0f}, 12.0f);
@@ -299,6 +311,12 @@ void QuaternionTest::matrix() {
     Quaternion q2 = Quaternion::rotation(Deg(130.0f), axis);
     CORRADE_VERIFY(m2.trace() < 0.0f);
     CORRADE_COMPARE(Quaternion::fromMatrix(m2), q2);
+
+    /* Trace < 0, largest diagonal element other than the first */
+    Matrix3x3 m3 = Matrix4::rotationY(Deg(170.0f)).rotationScaling();
+    Quaternion q3 = Quaternion::rotation(Deg(170.0f), Vector3::yAxis());
+    CORRADE_VERIFY(m3.trace() < 0.0f);
+    CORRADE_COMPARE(Quaternion::fromMatrix(m3), q3);
 }
 
 void QuaternionTest::lerp() {
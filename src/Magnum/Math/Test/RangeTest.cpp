@@ -52,6 +52,16 @@ struct RangeTest: Corrade::TestSuite::Tester {
     void translated();
     void padded();
     void scaled();
+    void joined();
+    void intersected();
+    void join();
+    void intersect();
+
+    void fromPoints();
+    void fromPointsStrided();
+    void transformed2D();
+    void transformed3D();
+    void transformBatch();
 
     void subclassTypes();
     void subclass();
@@ -72,6 +82,7 @@ typedef Math::Range2D<Int> Range2Di;
 typedef Math::Range3D<Int> Range3Di;
 typedef Vector2<Int> Vector2i;
 typedef Vector3<Int> Vector3i;
+typedef Math::Vector3<Float> Vector3;
 
 RangeTest::RangeTest() {
     addTests({&RangeTest::construct,
@@ -88,6 +99,16 @@ RangeTest::RangeTest() {
               &RangeTest::translated,
               &RangeTest::padded,
               &RangeTest::scaled,
+              &RangeTest::joined,
+              &RangeTest::intersected,
+              &RangeTest::join,
+              &RangeTest::intersect,
+
+              &RangeTest::fromPoints,
+              &RangeTest::fromPointsStrided,
+              &RangeTest::transformed2D,
+              &RangeTest::transformed3D,
+              &RangeTest::transformBatch,
 
               &RangeTest::subclassTypes,
               &RangeTest::subclass,
@@ -300,6 +321,146 @@ void RangeTest::scaled() {
     CORRADE_COMPARE(a.scaled({2, -3}), b);
 }
 
+void RangeTest::joined() {
+    Range2Di a({34, 23}, {47, 30});
+    Range2Di b({40, 10}, {60, 25});
+
+    CORRADE_COMPARE(a.joined(b), Range2Di({34, 10}, {60, 30}));
+    CORRADE_COMPARE(b.joined(a), Range2Di({34, 10}, {60, 30}));
+}
+
+void RangeTest::intersected() {
+    Range2Di a({34, 23}, {47, 30});
+    Range2Di b({40, 10}, {60, 25});
+    Range2Di c({50, 40}, {60, 50});
+
+    CORRADE_COMPARE(a.intersected(b), Range2Di({40, 23}, {47, 25}));
+    CORRADE_COMPARE(b.intersected(a), Range2Di({40, 23}, {47, 25}));
+
+    /* Disjoint ranges, min is larger than max */
+    CORRADE_COMPARE(a.intersected(c), Range2Di({50, 40}, {47, 30}));
+}
+
+void RangeTest::join() {
+    const Range3Di ranges[]{
+        {{3, 5, -7}, {10, 6, 3}},
+        {{-1, 2, 0}, {4, 5, 6}},
+        {{5, 7, -3}, {8, 9, 0}}
+    };
+
+    CORRADE_COMPARE(Range3Di::join(ranges), Range3Di({-1, 2, -7}, {10, 9, 6}));
+    CORRADE_COMPARE(Range3Di::join(nullptr), Range3Di());
+}
+
+void RangeTest::intersect() {
+    const Range3Di ranges[]{
+        {{3, 5, -7}, {10, 6, 3}},
+        {{-1, 2, 0}, {4, 5, 6}},
+        {{2, 1, -3}, {8, 9, 1}}
+    };
+
+    CORRADE_COMPARE(Range3Di::intersect(ranges), Range3Di({3, 5, 0}, {4, 5, 1}));
+    CORRADE_COMPARE(Range3Di::intersect(nullptr), Range3Di());
+}
+
+void RangeTest::fromPoints() {
+    /* More than one SSE iteration and a remainder */
+    const Vector3 points[]{
+        { 1.0f,  2.0f,  3.0f},
+        {-1.0f,  5.0f,  0.0f},
+        { 4.0f, -2.0f,  1.0f},
+        { 0.0f,  0.0f,  9.0f},
+        { 2.0f,  2.0f,  2.0f},
+        {-7.0f,  1.0f,  1.0f},
+        { 3.0f,  3.0f, -3.0f},
+        { 0.0f,  1.0f,  0.5f},
+        { 5.0f,  0.5f,  0.0f},
+        { 0.5f, -8.0f,  0.0f},
+        { 0.0f,  0.0f, 10.0f}
+    };
+
+    CORRADE_COMPARE(Range3D::fromPoints(points), Range3D({-7.0f, -8.0f, -3.0f}, {5.0f, 5.0f, 10.0f}));
+    CORRADE_COMPARE(Range3D::fromPoints({points, 3}), Range3D({-1.0f, -2.0f, 0.0f}, {4.0f, 5.0f, 3.0f}));
+    CORRADE_COMPARE(Range3D::fromPoints({points, 4}), Range3D({-1.0f, -2.0f, 0.0f}, {4.0f, 5.0f, 9.0f}));
+    CORRADE_COMPARE(Range3D::fromPoints(nullptr), Range3D());
+
+    const Vector2i points2D[]{{3, 5}, {-1, 7}, {4, 2}};
+    CORRADE_COMPARE(Range2Di::fromPoints(points2D), Range2Di({-1, 2}, {4, 7}));
+}
+
+void RangeTest::fromPointsStrided() {
+    /* Position interleaved with normal */
+    const Vector3 data[]{
+        { 1.0f,  2.0f, 3.0f}, {0.0f, 100.0f, 0.0f},
+        {-1.0f,  5.0f, 0.0f}, {0.0f, 100.0f, 0.0f},
+        { 4.0f, -2.0f, 1.0f}, {0.0f, 100.0f, 0.0f},
+        { 0.0f,  0.0f, 9.0f}, {0.0f, 100.0f, 0.0f},
+        { 2.0f,  2.0f, 2.0f}, {0.0f, 100.0f, 0.0f}
+    };
+
+    CORRADE_COMPARE(Range3D::fromPoints(data, 5, 2*sizeof(Vector3)),
+        Range3D({-1.0f, -2.0f, 0.0f}, {4.0f, 5.0f, 9.0f}));
+}
+
+void RangeTest::transformed2D() {
+    const Range2D a({0.0f, 0.0f}, {2.0f, 1.0f});
+    const auto transformation = Matrix3<Float>::translation({1.0f, 2.0f})*
+        Matrix3<Float>::rotation(Rad<Float>(Constants<Float>::pi()/2.0f));
+
+    const Range2D b = a.transformed(transformation);
+    CORRADE_COMPARE(b.min(), Vector2<Float>(0.0f, 2.0f));
+    CORRADE_COMPARE(b.max(), Vector2<Float>(1.0f, 4.0f));
+}
+
+void RangeTest::transformed3D() {
+    const Range3D a({-1.0f, 0.0f, 2.0f}, {3.0f, 4.0f, 5.0f});
+    const auto transformation = Matrix4<Float>::translation({1.0f, 2.0f, 3.0f})*
+        Matrix4<Float>::rotation(Rad<Float>(0.7f), Vector3(1.0f, 1.0f, 0.0f).normalized())*
+        Matrix4<Float>::scaling({2.0f, -1.0f, 3.0f});
+
+    /* Brute force -- transform all corners */
+    Vector3 min = transformation.transformPoint(a.min());
+    Vector3 max = min;
+    for(std::size_t i = 0; i != 8; ++i) {
+        const Vector3 corner = transformation.transformPoint({
+            i & 1 ? a.max().x() : a.min().x(),
+            i & 2 ? a.max().y() : a.min().y(),
+            i & 4 ? a.max().z() : a.min().z()});
+        min = Math::min(min, corner);
+        max = Math::max(max, corner);
+    }
+
+    const Range3D b = a.transformed(transformation);
+    CORRADE_COMPARE(b.min(), min);
+    CORRADE_COMPARE(b.max(), max);
+}
+
+void RangeTest::transformBatch() {
+    const Range3D ranges[]{
+        {{-1.0f, 0.0f, 2.0f}, {3.0f, 4.0f, 5.0f}},
+        {{0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}},
+        {{-5.0f, 2.0f, 3.0f}, {-4.0f, 7.0f, 3.5f}}
+    };
+    const Matrix4<Float> transformations[]{
+        Matrix4<Float>::rotationX(Rad<Float>(0.5f)),
+        Matrix4<Float>::translation({1.0f, 2.0f, 3.0f})*Matrix4<Float>::scaling({-2.0f, 1.0f, 1.0f}),
+        Matrix4<Float>::rotationZ(Rad<Float>(-1.3f))*Matrix4<Float>::scaling({1.0f, 0.5f, 2.0f})
+    };
+
+    Range3D out[3];
+    Range3D::transformBatch(transformations[0], ranges, out);
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_COMPARE(out[i].min(), ranges[i].transformed(transformations[0]).min());
+        CORRADE_COMPARE(out[i].max(), ranges[i].transformed(transformations[0]).max());
+    }
+
+    Range3D::transformBatch(transformations, ranges, out);
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_COMPARE(out[i].min(), ranges[i].transformed(transformations[i]).min());
+        CORRADE_COMPARE(out[i].max(), ranges[i].transformed(transformations[i]).max());
+    }
+}
+
 template<class T> class BasicRect: public Math::Range<2, T> {
     public:
         template<class ...U> BasicRect(U&&... args): Math::Range<2, T>{std::forward<U>(args)...} {}
@@ -317,6 +478,10 @@ void RangeTest::subclassTypes() {
     CORRADE_VERIFY((std::is_same<decltype(r.translated(a)), Recti>::value));
     CORRADE_VERIFY((std::is_same<decltype(r.padded(a)), Recti>::value));
     CORRADE_VERIFY((std::is_same<decltype(r.scaled(a)), Recti>::value));
+    CORRADE_VERIFY((std::is_same<decltype(r.joined(r)), Recti>::value));
+    CORRADE_VERIFY((std::is_same<decltype(r.intersected(r)), Recti>::value));
+    CORRADE_VERIFY((std::is_same<decltype(Recti::fromPoints(nullptr)), Recti>::value));
+    CORRADE_VERIFY((std::is_same<decltype(Recti::join(nullptr)), Recti>::value));
 }
 
 void RangeTest::subclass() {
@@ -0,0 +1,108 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Algorithms/Svd.h"
+#include "Magnum/Math/Algorithms/Svd3x3.h"
+#include "Magnum/Test/BenchmarkTester.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct SvdBenchmark: Magnum::Test::BenchmarkTester {
+    explicit SvdBenchmark();
+
+    void svd();
+    void svd3x3();
+    void polarDecompositionBatch();
+
+    private:
+        std::vector<Matrix3x3<Float>> _matrices;
+        std::vector<Matrix3x3<Float>> _out;
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Matrix3x3<Float> Matrix3x3;
+typedef Math::Vector3<Float> Vector3;
+
+namespace {
+    constexpr std::size_t MatrixCount = 4096;
+    constexpr std::size_t Repeats = 16;
+}
+
+SvdBenchmark::SvdBenchmark(): _out(MatrixCount) {
+    addTests({&SvdBenchmark::svd,
+              &SvdBenchmark::svd3x3,
+              &SvdBenchmark::polarDecompositionBatch});
+
+    /* Rotations with non-uniform scaling, so all algorithms can be compared
+       on extracting the rotation */
+    _matrices.reserve(MatrixCount);
+    for(std::size_t i = 0; i != MatrixCount; ++i)
+        _matrices.push_back(Matrix4::rotation(Deg(Float(i%360)), Vector3(1.0f, Float(i%7), -1.0f).normalized()).rotationScaling()*
+            Matrix3x3::fromDiagonal({1.0f + Float(i%5), 2.0f, 0.5f}));
+}
+
+void SvdBenchmark::svd() {
+    benchmark("Algorithms::svd():", MatrixCount, Repeats, [this]() {
+        for(std::size_t i = 0; i != MatrixCount; ++i) {
+            RectangularMatrix<3, 3, Float> u;
+            Vector3 w;
+            Matrix3x3 v;
+            std::tie(u, w, v) = Algorithms::svd(RectangularMatrix<3, 3, Float>{_matrices[i]});
+            _out[i] = Matrix3x3{u}*v.transposed();
+        }
+    });
+
+    /* Use the results so the computation doesn't get optimized out */
+    CORRADE_COMPARE(_out[MatrixCount/2], Matrix4::rotation(Deg(Float((MatrixCount/2)%360)), Vector3(1.0f, Float((MatrixCount/2)%7), -1.0f).normalized()).rotationScaling());
+}
+
+void SvdBenchmark::svd3x3() {
+    benchmark("Algorithms::svd3x3():", MatrixCount, Repeats, [this]() {
+        for(std::size_t i = 0; i != MatrixCount; ++i) {
+            Matrix3x3 u, v;
+            Vector3 w;
+            std::tie(u, w, v) = Algorithms::svd3x3(_matrices[i]);
+            _out[i] = u*v.transposed();
+        }
+    });
+
+    CORRADE_COMPARE(_out[MatrixCount/2], Matrix4::rotation(Deg(Float((MatrixCount/2)%360)), Vector3(1.0f, Float((MatrixCount/2)%7), -1.0f).normalized()).rotationScaling());
+}
+
+void SvdBenchmark::polarDecompositionBatch() {
+    benchmark("Algorithms::polarDecompositionBatch():", MatrixCount, Repeats, [this]() {
+        Algorithms::polarDecompositionBatch<Float>({_matrices.data(), MatrixCount}, {_out.data(), MatrixCount});
+    });
+
+    CORRADE_COMPARE(_out[MatrixCount/2], Matrix4::rotation(Deg(Float((MatrixCount/2)%360)), Vector3(1.0f, Float((MatrixCount/2)%7), -1.0f).normalized()).rotationScaling());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::SvdBenchmark)
@@ -74,6 +74,7 @@ struct VectorTest: Corrade::TestSuite::Tester {
     void multiplyDivide();
     void multiplyDivideIntegral();
     void multiplyDivideComponentWise();
+    void arithmeticConstexpr();
     void multiplyDivideComponentWiseIntegral();
     void modulo();
     void bitwise();
@@ -130,6 +131,7 @@ VectorTest::VectorTest() {
               &VectorTest::multiplyDivide,
               &VectorTest::multiplyDivideIntegral,
               &VectorTest::multiplyDivideComponentWise,
+              &VectorTest::arithmeticConstexpr,
               &VectorTest::multiplyDivideComponentWiseIntegral,
               &VectorTest::modulo,
               &VectorTest::bitwise,
@@ -293,6 +295,20 @@ void VectorTest::addSubtract() {
     CORRADE_COMPARE(c - b, a);
 }
 
+void VectorTest::arithmeticConstexpr() {
+    constexpr Vector3 a(1.0f, -3.0f, 5.0f);
+    constexpr Vector3 b(7.5f, 33.0f, -15.0f);
+
+    constexpr Vector3 c = -(a + b)*2.0f - a/0.5f;
+    CORRADE_COMPARE(c, Vector3(-19.0f, -54.0f, 10.0f));
+
+    constexpr Vector3 d = a*b/b;
+    CORRADE_COMPARE(d, a);
+
+    constexpr Float e = Math::dot(a, b);
+    CORRADE_COMPARE(e, -166.5f);
+}
+
 void VectorTest::multiplyDivide() {
     Vector4 vector(1.0f, 2.0f, 3.0f, 4.0f);
     Vector4 multiplied(-1.5f, -3.0f, -4.5f, -6.0f);
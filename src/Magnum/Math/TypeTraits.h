@@ -111,6 +111,11 @@ namespace Implementation {
     template<class T> struct TypeTraitsIntegral: TypeTraitsDefault<T> {
         constexpr static T epsilon() { return T(1); }
     };
+
+    /* Prevents template argument deduction from given parameter, so e.g.
+       batch functions taking array views accept anything convertible to
+       them */
+    template<class T> struct NonDeduced { typedef T Type; };
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
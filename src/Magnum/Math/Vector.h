@@ -39,11 +39,25 @@
 #include "Magnum/Math/Angle.h"
 #include "Magnum/Math/BoolVector.h"
 #include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Math/Implementation/Simd.h"
 
 namespace Magnum { namespace Math {
 
 namespace Implementation {
     template<std::size_t, class, class> struct VectorConverter;
+
+    /* Unrolled sum of component products, usable in constant expressions.
+       Sums in the same order as Vector::sum(). */
+    template<std::size_t i> struct Dot {
+        template<std::size_t size, class T> constexpr static T dot(const Vector<size, T>& a, const Vector<size, T>& b) {
+            return T(Dot<i - 1>::dot(a, b) + a[i]*b[i]);
+        }
+    };
+    template<> struct Dot<0> {
+        template<std::size_t size, class T> constexpr static T dot(const Vector<size, T>& a, const Vector<size, T>& b) {
+            return T(a[0]*b[0]);
+        }
+    };
 }
 
 /** @relatesalso Vector
@@ -55,8 +69,8 @@ vectors are parallel and `-1` when two *normalized* vectors are antiparallel. @f
 @f]
 @see @ref Vector::dot() const, @ref Vector::operator-(), @ref Vector2::perpendicular()
 */
-template<std::size_t size, class T> inline T dot(const Vector<size, T>& a, const Vector<size, T>& b) {
-    return (a*b).sum();
+template<std::size_t size, class T> constexpr T dot(const Vector<size, T>& a, const Vector<size, T>& b) {
+    return Implementation::Dot<size - 1>::dot(a, b);
 }
 
 /** @relatesalso Vector
@@ -269,7 +283,9 @@ template<std::size_t size, class T> class Vector {
          * @f]
          * @see @ref Vector2::perpendicular()
          */
-        Vector<size, T> operator-() const;
+        constexpr Vector<size, T> operator-() const {
+            return negateInternal(typename Implementation::GenerateSequence<size>::Type());
+        }
 
         /**
          * @brief Add and assign vector
@@ -290,8 +306,8 @@ template<std::size_t size, class T> class Vector {
          *
          * @see @ref operator+=(), @ref sum()
          */
-        Vector<size, T> operator+(const Vector<size, T>& other) const {
-            return Vector<size, T>(*this) += other;
+        constexpr Vector<size, T> operator+(const Vector<size, T>& other) const {
+            return addInternal(typename Implementation::GenerateSequence<size>::Type(), other);
         }
 
         /**
@@ -313,8 +329,8 @@ template<std::size_t size, class T> class Vector {
          *
          * @see @ref operator-=()
          */
-        Vector<size, T> operator-(const Vector<size, T>& other) const {
-            return Vector<size, T>(*this) -= other;
+        constexpr Vector<size, T> operator-(const Vector<size, T>& other) const {
+            return subtractInternal(typename Implementation::GenerateSequence<size>::Type(), other);
         }
 
         /**
@@ -340,8 +356,8 @@ template<std::size_t size, class T> class Vector {
          *      @ref operator*=(T), operator*(T, const Vector<size, T>&),
          *      @ref operator*(const Vector<size, Integral>&, FloatingPoint)
          */
-        Vector<size, T> operator*(T number) const {
-            return Vector<size, T>(*this) *= number;
+        constexpr Vector<size, T> operator*(T number) const {
+            return multiplyInternal(typename Implementation::GenerateSequence<size>::Type(), number);
         }
 
         /**
@@ -367,8 +383,8 @@ template<std::size_t size, class T> class Vector {
          *      @ref operator/=(T), operator/(T, const Vector<size, T>&),
          *      @ref operator/(const Vector<size, Integral>&, FloatingPoint)
          */
-        Vector<size, T> operator/(T number) const {
-            return Vector<size, T>(*this) /= number;
+        constexpr Vector<size, T> operator/(T number) const {
+            return divideInternal(typename Implementation::GenerateSequence<size>::Type(), number);
         }
 
         /**
@@ -394,8 +410,8 @@ template<std::size_t size, class T> class Vector {
          *      @ref operator*(const Vector<size, Integral>&, const Vector<size, FloatingPoint>&),
          *      @ref product()
          */
-        Vector<size, T> operator*(const Vector<size, T>& other) const {
-            return Vector<size, T>(*this) *= other;
+        constexpr Vector<size, T> operator*(const Vector<size, T>& other) const {
+            return multiplyInternal(typename Implementation::GenerateSequence<size>::Type(), other);
         }
 
         /**
@@ -420,8 +436,8 @@ template<std::size_t size, class T> class Vector {
          * @see @ref operator/(T) const, @ref operator/=(const Vector<size, T>&),
          *      @ref operator/(const Vector<size, Integral>&, const Vector<size, FloatingPoint>&)
          */
-        Vector<size, T> operator/(const Vector<size, T>& other) const {
-            return Vector<size, T>(*this) /= other;
+        constexpr Vector<size, T> operator/(const Vector<size, T>& other) const {
+            return divideInternal(typename Implementation::GenerateSequence<size>::Type(), other);
         }
 
         /**
@@ -434,7 +450,7 @@ template<std::size_t size, class T> class Vector {
          * @see @ref dot(const Vector<size, T>&, const Vector<size, T>&),
          *      @ref isNormalized()
          */
-        T dot() const { return Math::dot(*this, *this); }
+        constexpr T dot() const { return Math::dot(*this, *this); }
 
         /**
          * @brief Vector length
@@ -545,6 +561,31 @@ template<std::size_t size, class T> class Vector {
             return {sequence < otherSize ? a[sequence] : value...};
         }
 
+        /* Implementation for the constexpr arithmetic operators. The T()
+           casts are there to avoid narrowing conversions for small integral
+           types, the result is the same as with the in-place operators. */
+        template<std::size_t ...sequence> constexpr Vector<size, T> negateInternal(Implementation::Sequence<sequence...>) const {
+            return {T(-_data[sequence])...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> addInternal(Implementation::Sequence<sequence...>, const Vector<size, T>& other) const {
+            return {T(_data[sequence] + other._data[sequence])...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> subtractInternal(Implementation::Sequence<sequence...>, const Vector<size, T>& other) const {
+            return {T(_data[sequence] - other._data[sequence])...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> multiplyInternal(Implementation::Sequence<sequence...>, T number) const {
+            return {T(_data[sequence]*number)...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> divideInternal(Implementation::Sequence<sequence...>, T number) const {
+            return {T(_data[sequence]/number)...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> multiplyInternal(Implementation::Sequence<sequence...>, const Vector<size, T>& other) const {
+            return {T(_data[sequence]*other._data[sequence])...};
+        }
+        template<std::size_t ...sequence> constexpr Vector<size, T> divideInternal(Implementation::Sequence<sequence...>, const Vector<size, T>& other) const {
+            return {T(_data[sequence]/other._data[sequence])...};
+        }
+
         T _data[size];
 };
 
@@ -553,7 +594,7 @@ template<std::size_t size, class T> class Vector {
 
 Same as @ref Vector::operator*(T) const.
 */
-template<std::size_t size, class T> inline Vector<size, T> operator*(
+template<std::size_t size, class T> constexpr Vector<size, T> operator*(
     #ifdef DOXYGEN_GENERATING_OUTPUT
     T
     #else
@@ -1082,49 +1123,49 @@ extern template Corrade::Utility::Debug MAGNUM_EXPORT operator<<(Corrade::Utilit
         return *this;                                                       \
     }                                                                       \
                                                                             \
-    Type<T> operator-() const {                                             \
+    constexpr Type<T> operator-() const {                                   \
         return Math::Vector<size, T>::operator-();                          \
     }                                                                       \
     Type<T>& operator+=(const Math::Vector<size, T>& other) {               \
         Math::Vector<size, T>::operator+=(other);                           \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator+(const Math::Vector<size, T>& other) const {           \
+    constexpr Type<T> operator+(const Math::Vector<size, T>& other) const { \
         return Math::Vector<size, T>::operator+(other);                     \
     }                                                                       \
     Type<T>& operator-=(const Math::Vector<size, T>& other) {               \
         Math::Vector<size, T>::operator-=(other);                           \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator-(const Math::Vector<size, T>& other) const {           \
+    constexpr Type<T> operator-(const Math::Vector<size, T>& other) const { \
         return Math::Vector<size, T>::operator-(other);                     \
     }                                                                       \
     Type<T>& operator*=(T number) {                                         \
         Math::Vector<size, T>::operator*=(number);                          \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator*(T number) const {                                     \
+    constexpr Type<T> operator*(T number) const {                           \
         return Math::Vector<size, T>::operator*(number);                    \
     }                                                                       \
     Type<T>& operator/=(T number) {                                         \
         Math::Vector<size, T>::operator/=(number);                          \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator/(T number) const {                                     \
+    constexpr Type<T> operator/(T number) const {                           \
         return Math::Vector<size, T>::operator/(number);                    \
     }                                                                       \
     Type<T>& operator*=(const Math::Vector<size, T>& other) {               \
         Math::Vector<size, T>::operator*=(other);                           \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator*(const Math::Vector<size, T>& other) const {           \
+    constexpr Type<T> operator*(const Math::Vector<size, T>& other) const { \
         return Math::Vector<size, T>::operator*(other);                     \
     }                                                                       \
     Type<T>& operator/=(const Math::Vector<size, T>& other) {               \
         Math::Vector<size, T>::operator/=(other);                           \
         return *this;                                                       \
     }                                                                       \
-    Type<T> operator/(const Math::Vector<size, T>& other) const {           \
+    constexpr Type<T> operator/(const Math::Vector<size, T>& other) const { \
         return Math::Vector<size, T>::operator/(other);                     \
     }                                                                       \
                                                                             \
@@ -1142,7 +1183,7 @@ extern template Corrade::Utility::Debug MAGNUM_EXPORT operator<<(Corrade::Utilit
     }
 
 #define MAGNUM_VECTORn_OPERATOR_IMPLEMENTATION(size, Type)                  \
-    template<class T> inline Type<T> operator*(typename std::common_type<T>::type number, const Type<T>& vector) { \
+    template<class T> constexpr Type<T> operator*(typename std::common_type<T>::type number, const Type<T>& vector) { \
         return number*static_cast<const Math::Vector<size, T>&>(vector);    \
     }                                                                       \
     template<class T> inline Type<T> operator/(typename std::common_type<T>::type number, const Type<T>& vector) { \
@@ -1275,15 +1316,6 @@ template<std::size_t size, class T> inline BoolVector<size> Vector<size, T>::ope
     return out;
 }
 
-template<std::size_t size, class T> inline Vector<size, T> Vector<size, T>::operator-() const {
-    Vector<size, T> out;
-
-    for(std::size_t i = 0; i != size; ++i)
-        out._data[i] = -_data[i];
-
-    return out;
-}
-
 template<std::size_t size, class T> inline Vector<size, T> Vector<size, T>::projectedOntoNormalized(const Vector<size, T>& line) const {
     CORRADE_ASSERT(line.isNormalized(), "Math::Vector::projectedOntoNormalized(): line must be normalized", {});
     return line*Math::dot(*this, line);
@@ -1325,6 +1357,18 @@ template<std::size_t size, class T> inline T Vector<size, T>::max() const {
     return out;
 }
 
+#if defined(MAGNUM_MATH_SIMD) && !defined(DOXYGEN_GENERATING_OUTPUT)
+template<> inline Float dot(const Vector<4, Float>& a, const Vector<4, Float>& b) {
+    return Implementation::simdDot4(a.data(), b.data());
+}
+
+template<> inline Vector<4, Float> Vector<4, Float>::normalized() const {
+    Vector<4, Float> out;
+    Implementation::simdNormalize4(_data, out._data);
+    return out;
+}
+#endif
+
 }}
 
 namespace Corrade { namespace Utility {
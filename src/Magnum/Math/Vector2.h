@@ -47,7 +47,7 @@ perpendicular. @f[
 @see @ref Vector2::perpendicular(),
     @ref dot(const Vector<size, T>&, const Vector<size, T>&)
  */
-template<class T> inline T cross(const Vector2<T>& a, const Vector2<T>& b) {
+template<class T> constexpr T cross(const Vector2<T>& a, const Vector2<T>& b) {
     return dot(a.perpendicular(), b);
 }
 
@@ -150,7 +150,7 @@ template<class T> class Vector2: public Vector<2, T> {
          *      @ref dot(const Vector<size, T>&, const Vector<size, T>&),
          *      @ref operator-() const
          */
-        Vector2<T> perpendicular() const { return {-y(), x()}; }
+        constexpr Vector2<T> perpendicular() const { return {-y(), x()}; }
 
         /**
          * @brief Aspect ratio
@@ -50,7 +50,7 @@ https://twitter.com/sjb3d/status/563640846671953920): @f[
 @f]
 @see @ref cross(const Vector2<T>&, const Vector2<T>&)
 */
-template<class T> inline Vector3<T> cross(const Vector3<T>& a, const Vector3<T>& b) {
+template<class T> constexpr Vector3<T> cross(const Vector3<T>& a, const Vector3<T>& b) {
     return swizzle<'y', 'z', 'x'>(a*swizzle<'y', 'z', 'x'>(b) -
                                   b*swizzle<'y', 'z', 'x'>(a));
 }
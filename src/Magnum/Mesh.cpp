@@ -25,15 +25,19 @@
 
 #include "Mesh.h"
 
+#include <algorithm>
 #include <Corrade/Utility/Debug.h>
 
 #include "Magnum/AbstractShaderProgram.h"
 #include "Magnum/Buffer.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
+#include "Magnum/VertexLayout.h"
 
 #include "Implementation/DebugState.h"
+#include "Implementation/DeletionState.h"
 #include "Implementation/BufferState.h"
+#include "Implementation/MemoryState.h"
 #include "Implementation/MeshState.h"
 #include "Implementation/State.h"
 
@@ -100,12 +104,15 @@ Mesh::Mesh(const MeshPrimitive primitive): _primitive{primitive}, _count{0}, _ba
     _indexOffset(0), _indexType(IndexType::UnsignedInt), _indexBuffer(nullptr)
 {
     (this->*Context::current()->state().mesh->createImplementation)();
+    Context::current()->state().memory->create(Context::MemoryObjectType::Mesh);
 }
 
 Mesh::~Mesh() {
     /* Moved out, nothing to do */
     if(!_id) return;
 
+    Context::current()->state().memory->destroy(Context::MemoryObjectType::Mesh, 0, 0);
+
     /* Remove current vao from the state */
     GLuint& current = Context::current()->state().mesh->currentVAO;
     if(current == _id) current = 0;
@@ -181,6 +188,29 @@ std::string Mesh::label() {
     #endif
 }
 
+std::size_t Mesh::memoryUsage() const {
+    /* Gather distinct buffers, the same buffer is usually referenced by more
+       than one attribute */
+    std::vector<const Buffer*> buffers;
+    if(_indexBuffer) buffers.push_back(_indexBuffer);
+    for(const GenericAttribute& attribute: _attributes)
+        buffers.push_back(attribute.buffer);
+    #ifndef MAGNUM_TARGET_GLES2
+    for(const IntegerAttribute& attribute: _integerAttributes)
+        buffers.push_back(attribute.buffer);
+    #ifndef MAGNUM_TARGET_GLES
+    for(const LongAttribute& attribute: _longAttributes)
+        buffers.push_back(attribute.buffer);
+    #endif
+    #endif
+    std::sort(buffers.begin(), buffers.end());
+
+    std::size_t memoryUsage = 0;
+    for(auto it = buffers.begin(), end = std::unique(buffers.begin(), buffers.end()); it != end; ++it)
+        memoryUsage += (*it)->memoryUsage();
+    return memoryUsage;
+}
+
 Mesh& Mesh::setLabelInternal(const Containers::ArrayReference<const char> label) {
     createIfNotAlready();
     #ifndef MAGNUM_TARGET_GLES
@@ -232,11 +262,17 @@ void Mesh::drawInternal(Int count, Int baseVertex, Int instanceCount, GLintptr i
 #endif
 {
 
-    const Implementation::MeshState& state = *Context::current()->state().mesh;
+    Implementation::State& contextState = Context::current()->state();
+    const Implementation::MeshState& state = *contextState.mesh;
 
     /* Nothing to draw */
     if(!count || !instanceCount) return;
 
+    if(contextState.statisticsEnabled) {
+        ++contextState.statistics.drawCalls;
+        contextState.statistics.vertices += UnsignedLong(count)*instanceCount;
+    }
+
     (this->*state.bindImplementation)();
 
     /* Non-instanced mesh */
@@ -372,6 +408,8 @@ void Mesh::createImplementationVAODSA() {
 void Mesh::destroyImplementationDefault() {}
 
 void Mesh::destroyImplementationVAO() {
+    if(Context::current()->state().deletion->deferVertexArray(_id)) return;
+
     #ifndef MAGNUM_TARGET_GLES2
     glDeleteVertexArrays(1, &_id);
     #elif !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
@@ -381,6 +419,56 @@ void Mesh::destroyImplementationVAO() {
     #endif
 }
 
+void Mesh::addVertexLayoutInternal(Buffer& buffer, const GLintptr offset, const GLsizei stride, const GLuint divisor, const Implementation::VertexLayoutAttribute* const attributes, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i) {
+        const Implementation::VertexLayoutAttribute& attribute = attributes[i];
+        switch(attribute.kind) {
+            case Implementation::VertexLayoutAttributeKind::Generic:
+                for(UnsignedInt j = 0; j != attribute.vectorCount; ++j)
+                    attributePointerInternal(GenericAttribute{
+                        &buffer,
+                        attribute.location + j,
+                        attribute.components,
+                        attribute.type,
+                        false,
+                        GLintptr(offset + attribute.offset + j*attribute.vectorSize),
+                        stride,
+                        divisor
+                    });
+                break;
+
+            #ifndef MAGNUM_TARGET_GLES2
+            case Implementation::VertexLayoutAttributeKind::Integer:
+                attributePointerInternal(IntegerAttribute{
+                    &buffer,
+                    attribute.location,
+                    attribute.components,
+                    attribute.type,
+                    GLintptr(offset + attribute.offset),
+                    stride,
+                    divisor
+                });
+                break;
+
+            #ifndef MAGNUM_TARGET_GLES
+            case Implementation::VertexLayoutAttributeKind::Long:
+                for(UnsignedInt j = 0; j != attribute.vectorCount; ++j)
+                    attributePointerInternal(LongAttribute{
+                        &buffer,
+                        attribute.location + j,
+                        attribute.components,
+                        attribute.type,
+                        GLintptr(offset + attribute.offset + j*attribute.vectorSize),
+                        stride,
+                        divisor
+                    });
+                break;
+            #endif
+            #endif
+        }
+    }
+}
+
 void Mesh::attributePointerInternal(const GenericAttribute& attribute) {
     (this->*Context::current()->state().mesh->attributePointerImplementation)(attribute);
 }
@@ -540,41 +628,55 @@ void Mesh::bindIndexBufferImplementationVAO(Buffer& buffer) {
 }
 
 void Mesh::bindImplementationDefault() {
-    /* Specify vertex attributes */
-    for(const GenericAttribute& attribute: _attributes)
+    Implementation::MeshState& state = *Context::current()->state().mesh;
+    typedef Implementation::MeshState::VertexAttribute VertexAttribute;
+    GLuint previousDivisor;
+
+    /* Specify vertex attributes that differ from the previous draw */
+    for(const GenericAttribute& attribute: _attributes) {
+        if(!state.updateVertexAttribute(attribute.location, {VertexAttribute::Kind::Generic, attribute.normalized, true, attribute.buffer->id(), attribute.size, attribute.type, attribute.offset, attribute.stride, attribute.divisor}, previousDivisor)) continue;
         vertexAttribPointer(attribute);
+        if(!attribute.divisor && previousDivisor) resetVertexAttribDivisor(attribute.location);
+    }
 
     #ifndef MAGNUM_TARGET_GLES2
-    for(const IntegerAttribute& attribute: _integerAttributes)
+    for(const IntegerAttribute& attribute: _integerAttributes) {
+        if(!state.updateVertexAttribute(attribute.location, {VertexAttribute::Kind::Integer, false, true, attribute.buffer->id(), attribute.size, attribute.type, attribute.offset, attribute.stride, attribute.divisor}, previousDivisor)) continue;
         vertexAttribPointer(attribute);
+        if(!attribute.divisor && previousDivisor) resetVertexAttribDivisor(attribute.location);
+    }
 
     #ifndef MAGNUM_TARGET_GLES
-    for(const LongAttribute& attribute: _longAttributes)
+    for(const LongAttribute& attribute: _longAttributes) {
+        if(!state.updateVertexAttribute(attribute.location, {VertexAttribute::Kind::Long, false, true, attribute.buffer->id(), attribute.size, attribute.type, attribute.offset, attribute.stride, attribute.divisor}, previousDivisor)) continue;
         vertexAttribPointer(attribute);
+        if(!attribute.divisor && previousDivisor) resetVertexAttribDivisor(attribute.location);
+    }
     #endif
     #endif
 
+    /* Disable attributes left over from previous draws */
+    state.disableUnusedVertexAttributes();
+
     /* Bind index buffer, if the mesh is indexed */
     if(_indexBuffer) _indexBuffer->bindInternal(Buffer::TargetHint::ElementArray);
 }
 
+void Mesh::resetVertexAttribDivisor(const GLuint location) {
+    #ifndef MAGNUM_TARGET_GLES2
+    glVertexAttribDivisor(location, 0);
+    #else
+    (this->*Context::current()->state().mesh->vertexAttribDivisorImplementation)(location, 0);
+    #endif
+}
+
 void Mesh::bindImplementationVAO() {
     bindVAO();
 }
 
 void Mesh::unbindImplementationDefault() {
-    for(const GenericAttribute& attribute: _attributes)
-        glDisableVertexAttribArray(attribute.location);
-
-    #ifndef MAGNUM_TARGET_GLES2
-    for(const IntegerAttribute& attribute: _integerAttributes)
-        glDisableVertexAttribArray(attribute.location);
-
-    #ifndef MAGNUM_TARGET_GLES
-    for(const LongAttribute& attribute: _longAttributes)
-        glDisableVertexAttribArray(attribute.location);
-    #endif
-    #endif
+    /* The attributes are left enabled so the next draw can reuse them, unused
+       ones get disabled in bindImplementationDefault() */
 }
 
 void Mesh::unbindImplementationVAO() {}
@@ -117,7 +117,10 @@ enum class MeshPrimitive: GLenum {
     #endif
 };
 
-namespace Implementation { struct MeshState; }
+namespace Implementation {
+    struct MeshState;
+    struct VertexLayoutAttribute;
+}
 
 /**
 @brief Mesh
@@ -337,6 +340,9 @@ drawing commands are used on desktop OpenGL and OpenGL ES 3.0. See also
  */
 class MAGNUM_EXPORT Mesh: public AbstractObject {
     friend MeshView;
+    #ifndef MAGNUM_TARGET_GLES
+    friend OcclusionCuller;
+    #endif
     friend Implementation::MeshState;
 
     public:
@@ -502,6 +508,17 @@ class MAGNUM_EXPORT Mesh: public AbstractObject {
          */
         bool isIndexed() const { return _indexBuffer; }
 
+        /**
+         * @brief Estimated memory usage
+         *
+         * Sum of @ref Buffer::memoryUsage() of all distinct buffers
+         * referenced by the mesh as vertex or index buffers. Buffers shared
+         * with other meshes are counted in each of them, so the sum over all
+         * meshes can be larger than @ref Context::memoryUsage() for buffers.
+         * No OpenGL call is done.
+         */
+        std::size_t memoryUsage() const;
+
         /**
          * @brief Index size
          *
@@ -738,6 +755,39 @@ class MAGNUM_EXPORT Mesh: public AbstractObject {
             return *this;
         }
 
+        /**
+         * @brief Add buffer with compile-time vertex layout
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to calling @ref addVertexBuffer(Buffer&, GLintptr, const T&...)
+         * with all attributes of the layout, but the stride and attribute
+         * offsets are not computed at runtime, the precomputed attribute
+         * setup of the layout is used instead. See @ref VertexLayout for
+         * more information.
+         */
+        template<class ...T> Mesh& addVertexBuffer(Buffer& buffer, GLintptr offset, const VertexLayout<T...>&) {
+            addVertexLayoutInternal(buffer, offset, VertexLayout<T...>::Stride, 0, VertexLayout<T...>::attributes(), VertexLayout<T...>::AttributeCount);
+            return *this;
+        }
+
+        /**
+         * @brief Add instanced buffer with compile-time vertex layout
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to calling @ref addVertexBufferInstanced(Buffer&, UnsignedInt, GLintptr, const T&...)
+         * with all attributes of the layout, see
+         * @ref addVertexBuffer(Buffer&, GLintptr, const VertexLayout<T...>&)
+         * for more information.
+         * @requires_gl33 Extension @extension{ARB,instanced_arrays}
+         * @requires_gles30 Extension @es_extension{ANGLE,instanced_arrays},
+         *      @es_extension{EXT,instanced_arrays} or
+         *      @es_extension{NV,instanced_arrays} in OpenGL ES 2.0.
+         */
+        template<class ...T> Mesh& addVertexBufferInstanced(Buffer& buffer, UnsignedInt divisor, GLintptr offset, const VertexLayout<T...>&) {
+            addVertexLayoutInternal(buffer, offset, VertexLayout<T...>::Stride, divisor, VertexLayout<T...>::attributes(), VertexLayout<T...>::AttributeCount);
+            return *this;
+        }
+
         /**
          * @brief Set index buffer
          * @param buffer        Index buffer
@@ -891,6 +941,8 @@ class MAGNUM_EXPORT Mesh: public AbstractObject {
         }
         void addVertexBufferInternal(Buffer&, GLsizei, GLuint, GLintptr) {}
 
+        void addVertexLayoutInternal(Buffer& buffer, GLintptr offset, GLsizei stride, GLuint divisor, const Implementation::VertexLayoutAttribute* attributes, std::size_t count);
+
         template<UnsignedInt location, class T> void addVertexAttribute(typename std::enable_if<std::is_same<typename Implementation::Attribute<T>::ScalarType, Float>::value, Buffer&>::type buffer, const Attribute<location, T>& attribute, GLintptr offset, GLsizei stride, GLuint divisor) {
             for(UnsignedInt i = 0; i != Attribute<location, T>::VectorCount; ++i)
                 attributePointerInternal(GenericAttribute{
@@ -993,6 +1045,7 @@ class MAGNUM_EXPORT Mesh: public AbstractObject {
 
         void MAGNUM_LOCAL bindImplementationDefault();
         void MAGNUM_LOCAL bindImplementationVAO();
+        void MAGNUM_LOCAL resetVertexAttribDivisor(GLuint location);
 
         void MAGNUM_LOCAL unbindImplementationDefault();
         void MAGNUM_LOCAL unbindImplementationVAO();
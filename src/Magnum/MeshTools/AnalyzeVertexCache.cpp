@@ -0,0 +1,64 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AnalyzeVertexCache.h"
+
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace MeshTools {
+
+VertexCacheStatistics analyzeVertexCache(const std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::analyzeVertexCache(): index count is not divisible by 3", {});
+    CORRADE_ASSERT(cacheSize, "MeshTools::analyzeVertexCache(): cache size can't be zero", {});
+
+    if(indices.empty()) return {};
+
+    /* Timestamp of when each vertex was put into the cache. The vertex is in
+       the cache if less than cacheSize other vertices were put there since
+       then. Starting the time after cache size so all vertices are missing
+       initially. */
+    std::vector<std::size_t> timestamp(vertexCount);
+    std::vector<bool> referenced(vertexCount);
+    std::size_t time = cacheSize + 1;
+    std::size_t misses = 0;
+    std::size_t referencedCount = 0;
+    for(const UnsignedInt index: indices) {
+        CORRADE_ASSERT(index < vertexCount, "MeshTools::analyzeVertexCache(): index" << index << "out of range for" << vertexCount << "vertices", {});
+
+        if(!referenced[index]) {
+            referenced[index] = true;
+            ++referencedCount;
+        }
+
+        if(time - timestamp[index] > cacheSize) {
+            timestamp[index] = time++;
+            ++misses;
+        }
+    }
+
+    return {Float(misses)/(indices.size()/3), Float(misses)/referencedCount};
+}
+
+}}
@@ -0,0 +1,80 @@
+#ifndef Magnum_MeshTools_AnalyzeVertexCache_h
+#define Magnum_MeshTools_AnalyzeVertexCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::VertexCacheStatistics, function @ref Magnum::MeshTools::analyzeVertexCache()
+ */
+
+#include <vector>
+
+#include "Magnum/Types.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Post-transform vertex cache statistics
+
+@see @ref analyzeVertexCache()
+*/
+struct VertexCacheStatistics {
+    /**
+     * @brief Average cache miss ratio
+     *
+     * Count of transformed vertices divided by triangle count. The best
+     * possible value is `0.5` for large regular meshes, `3.0` is the worst.
+     */
+    Float acmr;
+
+    /**
+     * @brief Average transform to vertex ratio
+     *
+     * Count of transformed vertices divided by count of vertices referenced
+     * by the mesh. The best possible value is `1.0`, unlike ACMR it doesn't
+     * depend on vertex/triangle ratio of the mesh.
+     */
+    Float atvr;
+};
+
+/**
+@brief Analyze post-transform vertex cache efficiency
+@param indices          Triangle index array
+@param vertexCount      Vertex count
+@param cacheSize        Post-transform vertex cache size
+
+Simulates FIFO post-transform vertex cache of given size, which is how most
+hardware implements it, and computes average cache miss ratio and average
+transform to vertex ratio. Useful for measuring the effect of
+@ref tipsify(), @ref optimizeVertexCache() or @ref optimizeOverdraw(). Expects
+that index count is divisible by 3, all indices are less than @p vertexCount
+and that @p cacheSize is not zero.
+*/
+VertexCacheStatistics MAGNUM_MESHTOOLS_EXPORT analyzeVertexCache(const std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+}}
+
+#endif
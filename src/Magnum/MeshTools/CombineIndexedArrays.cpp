@@ -26,17 +26,17 @@
 #include "CombineIndexedArrays.h"
 
 #include <cstring>
-#include <unordered_map>
 #include <Corrade/Utility/Assert.h>
-#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/TaskScheduler.h"
+#include "Magnum/Math/Functions.h"
 
 namespace Magnum { namespace MeshTools {
 
 namespace Implementation {
 
-std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> interleaveAndCombineIndexArrays(const std::reference_wrapper<const std::vector<UnsignedInt>>* begin, const std::reference_wrapper<const std::vector<UnsignedInt>>* end) {
+std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> interleaveAndCombineIndexArrays(const std::reference_wrapper<const std::vector<UnsignedInt>>* begin, const std::reference_wrapper<const std::vector<UnsignedInt>>* end, const UnsignedInt threadCount) {
     /* Array stride and size */
     const UnsignedInt stride = end - begin;
     const UnsignedInt inputSize = begin->get().size();
@@ -56,18 +56,18 @@ std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> interleaveAndCombi
 
     /* Combine them */
     std::vector<UnsignedInt> combinedIndices;
-    std::tie(combinedIndices, interleavedArrays) = MeshTools::combineIndexArrays(interleavedArrays, stride);
+    std::tie(combinedIndices, interleavedArrays) = MeshTools::combineIndexArrays(interleavedArrays, stride, threadCount);
     return {combinedIndices, interleavedArrays};
 }
 
-std::vector<UnsignedInt> combineIndexArrays(const std::reference_wrapper<std::vector<UnsignedInt>>* const begin, const std::reference_wrapper<std::vector<UnsignedInt>>* const end) {
+std::vector<UnsignedInt> combineIndexArrays(const std::reference_wrapper<std::vector<UnsignedInt>>* const begin, const std::reference_wrapper<std::vector<UnsignedInt>>* const end, const UnsignedInt threadCount) {
     /* Interleave and combine the arrays */
     std::vector<UnsignedInt> combinedIndices;
     std::vector<UnsignedInt> interleavedCombinedArrays;
     std::tie(combinedIndices, interleavedCombinedArrays) = Implementation::interleaveAndCombineIndexArrays(
         /* This will bite me hard once. */
         reinterpret_cast<const std::reference_wrapper<const std::vector<UnsignedInt>>*>(begin),
-        reinterpret_cast<const std::reference_wrapper<const std::vector<UnsignedInt>>*>(end));
+        reinterpret_cast<const std::reference_wrapper<const std::vector<UnsignedInt>>*>(end), threadCount);
 
     /* Update the original indices */
     const UnsignedInt stride = end - begin;
@@ -87,68 +87,128 @@ std::vector<UnsignedInt> combineIndexArrays(const std::reference_wrapper<std::ve
 
 namespace {
 
-class IndexHash {
-    public:
-        explicit IndexHash(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
-
-        std::size_t operator()(UnsignedInt key) const {
-            return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(indices.data()+key*stride), sizeof(UnsignedInt)*stride).byteArray());
-        }
-
-    private:
-        const std::vector<UnsignedInt>& indices;
-        UnsignedInt stride;
-};
-
-class IndexEqual {
-    public:
-        explicit IndexEqual(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
-
-        bool operator()(UnsignedInt a, UnsignedInt b) const {
-            return std::memcmp(indices.data()+a*stride, indices.data()+b*stride, sizeof(UnsignedInt)*stride) == 0;
-        }
+inline UnsignedInt hashIndices(const UnsignedInt* const indices, const UnsignedInt stride) {
+    UnsignedInt hash = 2166136261u;
+    for(UnsignedInt i = 0; i != stride; ++i)
+        hash = (hash ^ indices[i])*16777619u;
+    return hash ^ (hash >> 16);
+}
 
-    private:
-        const std::vector<UnsignedInt>& indices;
-        UnsignedInt stride;
-};
+/* Calls f(i) for i in [0, partCount), possibly in parallel */
+template<class F> void forEachPart(const UnsignedInt partCount, const F& f) {
+    TaskScheduler::global().parallelFor(partCount, 1, [&f](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) f(UnsignedInt(i));
+    });
+}
 
 }
 
-std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, const UnsignedInt stride) {
+std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, const UnsignedInt stride, UnsignedInt threadCount) {
     CORRADE_ASSERT(stride != 0, "MeshTools::combineIndexArrays(): stride can't be zero", {});
     CORRADE_ASSERT(interleavedArrays.size() % stride == 0, "MeshTools::combineIndexArrays(): array size is not divisible by stride", {});
-
-    /* Hash map with index combinations, containing just indices into
-       interleavedArrays vector, hashing and comparison is done using IndexHash
-       and IndexEqual functors. Reserving more buckets than necessary (i.e. as
-       if each combination was unique). */
-    std::unordered_map<UnsignedInt, UnsignedInt, IndexHash, IndexEqual> indexCombinations(
-        interleavedArrays.size()/stride,
-        IndexHash(interleavedArrays, stride),
-        IndexEqual(interleavedArrays, stride));
+    CORRADE_ASSERT(threadCount, "MeshTools::combineIndexArrays(): expected at least one thread", {});
+
+    const std::size_t count = interleavedArrays.size()/stride;
+    const UnsignedInt* const data = interleavedArrays.data();
+    if(threadCount > count) threadCount = Math::max(UnsignedInt(count), 1u);
+
+    /* Each thread processes one contiguous chunk of the tuples and also owns
+       one partition of the hash space, so lookups in different partitions
+       never touch the same data and no locking is needed */
+    const std::size_t chunkSize = (count + threadCount - 1)/threadCount;
+    const auto partition = [threadCount](const UnsignedInt hash) {
+        return UnsignedInt((UnsignedLong(hash)*threadCount) >> 32);
+    };
+
+    /* Hash all tuples and count them in each partition */
+    std::vector<UnsignedInt> hashes(count);
+    std::vector<std::size_t> partitionCounts(threadCount*threadCount);
+    forEachPart(threadCount, [&](const UnsignedInt thread) {
+        std::size_t* const counts = partitionCounts.data() + thread*threadCount;
+        for(std::size_t i = thread*chunkSize, end = Math::min((thread + 1)*chunkSize, count); i < end; ++i) {
+            hashes[i] = hashIndices(data + i*stride, stride);
+            ++counts[partition(hashes[i])];
+        }
+    });
+
+    /* Turn the counts into offsets of each chunk in each partition, ordered
+       first by partition and then by chunk, so the tuples in each partition
+       are sorted by their position in the array */
+    std::vector<std::size_t> partitionOffsets(threadCount + 1);
+    for(std::size_t p = 0, offset = 0; p != threadCount; ++p) {
+        partitionOffsets[p] = offset;
+        for(std::size_t t = 0; t != threadCount; ++t) {
+            const std::size_t c = partitionCounts[t*threadCount + p];
+            partitionCounts[t*threadCount + p] = offset;
+            offset += c;
+        }
+    }
+    partitionOffsets[threadCount] = count;
+
+    std::vector<UnsignedInt> partitioned(count);
+    forEachPart(threadCount, [&](const UnsignedInt thread) {
+        std::size_t* const offsets = partitionCounts.data() + thread*threadCount;
+        for(std::size_t i = thread*chunkSize, end = Math::min((thread + 1)*chunkSize, count); i < end; ++i)
+            partitioned[offsets[partition(hashes[i])]++] = i;
+    });
+
+    /* Find first occurence of each tuple in each partition using an
+       open-addressing hash table with linear probing, at most half full */
+    std::vector<UnsignedInt> firstOccurence(count);
+    forEachPart(threadCount, [&](const UnsignedInt thread) {
+        const std::size_t begin = partitionOffsets[thread];
+        const std::size_t end = partitionOffsets[thread + 1];
+        std::size_t tableSize = 1;
+        while(tableSize < 2*(end - begin)) tableSize <<= 1;
+        const std::size_t tableMask = tableSize - 1;
+        constexpr UnsignedInt Empty = ~UnsignedInt{};
+        std::vector<UnsignedInt> table(tableSize, Empty);
+
+        for(std::size_t i = begin; i != end; ++i) {
+            const UnsignedInt index = partitioned[i];
+            std::size_t slot = hashes[index] & tableMask;
+            for(; table[slot] != Empty; slot = (slot + 1) & tableMask) {
+                const UnsignedInt other = table[slot];
+                if(hashes[other] == hashes[index] && std::memcmp(data + other*stride, data + index*stride, sizeof(UnsignedInt)*stride) == 0)
+                    break;
+            }
+
+            if(table[slot] == Empty) table[slot] = index;
+            firstOccurence[index] = table[slot];
+        }
+    });
+
+    /* Count unique tuples in each chunk to know where to put them in the
+       output */
+    std::vector<std::size_t> uniqueOffsets(threadCount + 1);
+    forEachPart(threadCount, [&](const UnsignedInt thread) {
+        std::size_t unique = 0;
+        for(std::size_t i = thread*chunkSize, end = Math::min((thread + 1)*chunkSize, count); i < end; ++i)
+            if(firstOccurence[i] == i) ++unique;
+        uniqueOffsets[thread + 1] = unique;
+    });
+    for(std::size_t t = 0; t != threadCount; ++t)
+        uniqueOffsets[t + 1] += uniqueOffsets[t];
 
     /* Make the index combinations unique. Original indices into original
        `interleavedArrays` array were 0, 1, 2, 3, ..., `combinedIndices`
-       contains new ones into new (shorter) `newInterleavedArrays` array. */
-    std::vector<UnsignedInt> combinedIndices;
-    combinedIndices.reserve(interleavedArrays.size()/stride);
-    std::vector<UnsignedInt> newInterleavedArrays;
-    for(std::size_t oldIndex = 0, end = interleavedArrays.size()/stride; oldIndex != end; ++oldIndex) {
-        /* Try to insert new index combination to the map */
-        const auto result = indexCombinations.emplace(oldIndex, indexCombinations.size());
-
-        /* Add the (either new or already existing) index to resulting index array */
-        combinedIndices.push_back(result.first->second);
-
-        /* If this is new combination, copy it to new interleaved arrays */
-        if(result.second) newInterleavedArrays.insert(newInterleavedArrays.end(),
-            interleavedArrays.begin()+oldIndex*stride,
-            interleavedArrays.begin()+(oldIndex+1)*stride);
-    }
-
-    CORRADE_INTERNAL_ASSERT(combinedIndices.size() == interleavedArrays.size()/stride &&
-                            newInterleavedArrays.size() <= interleavedArrays.size());
+       contains new ones into new (shorter) `newInterleavedArrays` array.
+       First number the unique tuples and copy them to the output, then
+       resolve the duplicates, which may refer to other chunks. */
+    std::vector<UnsignedInt> combinedIndices(count);
+    std::vector<UnsignedInt> newInterleavedArrays(uniqueOffsets[threadCount]*stride);
+    forEachPart(threadCount, [&](const UnsignedInt thread) {
+        std::size_t unique = uniqueOffsets[thread];
+        for(std::size_t i = thread*chunkSize, end = Math::min((thread + 1)*chunkSize, count); i < end; ++i) {
+            if(firstOccurence[i] != i) continue;
+            std::memcpy(newInterleavedArrays.data() + unique*stride, data + i*stride, sizeof(UnsignedInt)*stride);
+            combinedIndices[i] = unique++;
+        }
+    });
+    forEachPart(threadCount, [&](const UnsignedInt thread) {
+        for(std::size_t i = thread*chunkSize, end = Math::min((thread + 1)*chunkSize, count); i < end; ++i)
+            if(firstOccurence[i] != i) combinedIndices[i] = combinedIndices[firstOccurence[i]];
+    });
 
     return {std::move(combinedIndices), std::move(newInterleavedArrays)};
 }
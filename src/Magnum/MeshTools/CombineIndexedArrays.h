@@ -44,7 +44,7 @@
 namespace Magnum { namespace MeshTools {
 
 namespace Implementation {
-    MAGNUM_MESHTOOLS_EXPORT std::vector<UnsignedInt> combineIndexArrays(const std::reference_wrapper<std::vector<UnsignedInt>>* begin, const std::reference_wrapper<std::vector<UnsignedInt>>* end);
+    MAGNUM_MESHTOOLS_EXPORT std::vector<UnsignedInt> combineIndexArrays(const std::reference_wrapper<std::vector<UnsignedInt>>* begin, const std::reference_wrapper<std::vector<UnsignedInt>>* end, UnsignedInt threadCount = 1);
 }
 
 /**
@@ -82,17 +82,17 @@ which can be then indexed with the combined index array:
 Again, first triangle in the mesh will have positions `a c f` and normals
 `B D E`.
 
-This function calls @ref combineIndexArrays(const std::vector<UnsignedInt>&, UnsignedInt)
-internally. See also @ref combineIndexedArrays() which does the vertex data
-reordering automatically.
+This function calls @ref combineIndexArrays(const std::vector<UnsignedInt>&, UnsignedInt, UnsignedInt)
+internally, @p threadCount is passed to it. See also @ref combineIndexedArrays()
+which does the vertex data reordering automatically.
 */
-inline std::vector<UnsignedInt> combineIndexArrays(const std::vector<std::reference_wrapper<std::vector<UnsignedInt>>>& arrays) {
-    return Implementation::combineIndexArrays(&arrays[0], &arrays[0] + arrays.size());
+inline std::vector<UnsignedInt> combineIndexArrays(const std::vector<std::reference_wrapper<std::vector<UnsignedInt>>>& arrays, UnsignedInt threadCount = 1) {
+    return Implementation::combineIndexArrays(&arrays[0], &arrays[0] + arrays.size(), threadCount);
 }
 
 /** @overload */
-inline std::vector<UnsignedInt> combineIndexArrays(std::initializer_list<std::reference_wrapper<std::vector<UnsignedInt>>> arrays) {
-    return Implementation::combineIndexArrays(arrays.begin(), arrays.end());
+inline std::vector<UnsignedInt> combineIndexArrays(std::initializer_list<std::reference_wrapper<std::vector<UnsignedInt>>> arrays, UnsignedInt threadCount = 1) {
+    return Implementation::combineIndexArrays(arrays.begin(), arrays.end(), threadCount);
 }
 
 /**
@@ -114,13 +114,19 @@ And second pair value is the cleaned up interleaved array:
 
     0 1 2 3 5 4 0 4 1 6 3 1 2 1
 
+The index combinations are hashed into an open-addressing hash table. If
+@p threadCount is larger than `1`, the array is split into @p threadCount
+contiguous chunks processed in parallel on @ref TaskScheduler::global() and
+each chunk owns one partition of the hash space, so no locking is needed. The
+result is the same regardless of thread count. Expects that @p threadCount is
+not zero.
 @see @ref combineIndexedArrays()
 */
-MAGNUM_MESHTOOLS_EXPORT std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, UnsignedInt stride);
+MAGNUM_MESHTOOLS_EXPORT std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, UnsignedInt stride, UnsignedInt threadCount = 1);
 
 namespace Implementation {
 
-MAGNUM_MESHTOOLS_EXPORT std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> interleaveAndCombineIndexArrays(const std::reference_wrapper<const std::vector<UnsignedInt>>* begin, const std::reference_wrapper<const std::vector<UnsignedInt>>* end);
+MAGNUM_MESHTOOLS_EXPORT std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> interleaveAndCombineIndexArrays(const std::reference_wrapper<const std::vector<UnsignedInt>>* begin, const std::reference_wrapper<const std::vector<UnsignedInt>>* end, UnsignedInt threadCount = 1);
 
 template<class T> void writeCombinedArray(const UnsignedInt stride, const UnsignedInt offset, const std::vector<UnsignedInt>& interleavedCombinedIndexArrays, std::vector<T>& array) {
     /* Can't use duplicate() here because we aren't accessing the index data sequentially */
@@ -145,6 +151,10 @@ template<class T, class ...U> inline void writeCombinedArrays(UnsignedInt stride
 
 }
 
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template<class ...T> std::vector<UnsignedInt> combineIndexedArrays(UnsignedInt threadCount, const std::pair<const std::vector<UnsignedInt>&, std::vector<T>&>&... indexedArrays);
+#endif
+
 /**
 @brief Combine indexed arrays
 @param[in,out] indexedArrays Index and attribute arrays
@@ -180,12 +190,27 @@ procedure.
 /* Implementation note: It's done using tuples because it is more clear which
    parameter is index array and which is attribute array, mainly when both are
    of the same type. */
-template<class ...T> std::vector<UnsignedInt> combineIndexedArrays(const std::pair<const std::vector<UnsignedInt>&, std::vector<T>&>&... indexedArrays) {
+template<class ...T> inline std::vector<UnsignedInt> combineIndexedArrays(const std::pair<const std::vector<UnsignedInt>&, std::vector<T>&>&... indexedArrays) {
+    return combineIndexedArrays(1, indexedArrays...);
+}
+
+/**
+@brief Combine indexed arrays in parallel
+@param[in] threadCount      Count of parts to split the index combining into
+@param[in,out] indexedArrays Index and attribute arrays
+@return Array with resulting indices
+
+Same as @ref combineIndexedArrays(const std::pair<const std::vector<UnsignedInt>&, std::vector<T>&>&...),
+but passes @p threadCount to @ref combineIndexArrays(const std::vector<UnsignedInt>&, UnsignedInt, UnsignedInt),
+which is useful for large imported meshes, where this is usually the most
+expensive step.
+*/
+template<class ...T> std::vector<UnsignedInt> combineIndexedArrays(UnsignedInt threadCount, const std::pair<const std::vector<UnsignedInt>&, std::vector<T>&>&... indexedArrays) {
     /* Interleave and combine index arrays */
     std::vector<UnsignedInt> combinedIndices;
     std::vector<UnsignedInt> interleavedCombinedIndexArrays;
     auto i = {std::ref(indexedArrays.first)...};
-    std::tie(combinedIndices, interleavedCombinedIndexArrays) = Implementation::interleaveAndCombineIndexArrays(i.begin(), i.end());
+    std::tie(combinedIndices, interleavedCombinedIndexArrays) = Implementation::interleaveAndCombineIndexArrays(i.begin(), i.end(), threadCount);
 
     /* Write combined arrays */
     Implementation::writeCombinedArrays(sizeof...(T), 0, interleavedCombinedIndexArrays, indexedArrays.second...);
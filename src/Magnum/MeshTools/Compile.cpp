@@ -25,7 +25,10 @@
 
 #include "Compile.h"
 
+#include <cstring>
+
 #include "Magnum/Buffer.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/MeshTools/Interleave.h"
@@ -38,6 +41,28 @@
 
 namespace Magnum { namespace MeshTools {
 
+namespace {
+
+std::unique_ptr<Buffer> compileIndices(Mesh& mesh, const std::vector<UnsignedInt>& indices, const std::size_t vertexCount, const BufferUsage usage) {
+    if(indices.empty()) {
+        mesh.setCount(vertexCount);
+        return nullptr;
+    }
+
+    Containers::Array<char> indexData;
+    Mesh::IndexType indexType;
+    UnsignedInt indexStart, indexEnd;
+    std::tie(indexData, indexType, indexStart, indexEnd) = MeshTools::compressIndices(indices);
+
+    std::unique_ptr<Buffer> indexBuffer{new Buffer{Buffer::TargetHint::ElementArray}};
+    indexBuffer->setData(indexData, usage);
+    mesh.setCount(indices.size())
+        .setIndexBuffer(*indexBuffer, 0, indexType, indexStart, indexEnd);
+    return indexBuffer;
+}
+
+}
+
 std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData2D& meshData, const BufferUsage usage) {
     Mesh mesh;
     mesh.setPrimitive(meshData.primitive());
@@ -74,21 +99,9 @@ std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const
     /* Fill vertex buffer with interleaved data */
     vertexBuffer->setData(data, usage);
 
-    /* If indexed, fill index buffer and configure indexed mesh */
-    std::unique_ptr<Buffer> indexBuffer;
-    if(meshData.isIndexed()) {
-        Containers::Array<char> indexData;
-        Mesh::IndexType indexType;
-        UnsignedInt indexStart, indexEnd;
-        std::tie(indexData, indexType, indexStart, indexEnd) = MeshTools::compressIndices(meshData.indices());
-
-        indexBuffer.reset(new Buffer{Buffer::TargetHint::ElementArray});
-        indexBuffer->setData(indexData, usage);
-        mesh.setCount(meshData.indices().size())
-            .setIndexBuffer(*indexBuffer, 0, indexType, indexStart, indexEnd);
-
-    /* Else set vertex count */
-    } else mesh.setCount(meshData.positions(0).size());
+    /* If indexed, fill index buffer and configure indexed mesh, else set
+       vertex count */
+    std::unique_ptr<Buffer> indexBuffer = compileIndices(mesh, meshData.indices(), meshData.positions(0).size(), usage);
 
     return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::move(indexBuffer));
 }
@@ -146,23 +159,107 @@ std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const
     /* Fill vertex buffer with interleaved data */
     vertexBuffer->setData(data, usage);
 
-    /* If indexed, fill index buffer and configure indexed mesh */
-    std::unique_ptr<Buffer> indexBuffer;
-    if(meshData.isIndexed()) {
-        Containers::Array<char> indexData;
-        Mesh::IndexType indexType;
-        UnsignedInt indexStart, indexEnd;
-        std::tie(indexData, indexType, indexStart, indexEnd) = MeshTools::compressIndices(meshData.indices());
+    /* If indexed, fill index buffer and configure indexed mesh, else set
+       vertex count */
+    std::unique_ptr<Buffer> indexBuffer = compileIndices(mesh, meshData.indices(), meshData.positions(0).size(), usage);
 
-        indexBuffer.reset(new Buffer{Buffer::TargetHint::ElementArray});
-        indexBuffer->setData(indexData, usage);
-        mesh.setCount(meshData.indices().size())
-            .setIndexBuffer(*indexBuffer, 0, indexType, indexStart, indexEnd);
+    return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::move(indexBuffer));
+}
 
-    /* Else set vertex count */
-    } else mesh.setCount(meshData.positions(0).size());
+std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>, Matrix4> compile(const Trade::MeshData3D& meshData, const BufferUsage usage, const CompileFlags flags) {
+    Mesh mesh;
+    mesh.setPrimitive(meshData.primitive());
 
-    return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::move(indexBuffer));
+    const std::vector<Vector3>& positions = meshData.positions(0);
+
+    /* Decide about attribute sizes, stride and offsets. Each attribute is
+       padded to four bytes. */
+    const UnsignedInt positionSize = flags & CompileFlag::QuantizePositions ?
+        3*sizeof(UnsignedShort) : sizeof(Vector3);
+    const UnsignedInt normalSize = !meshData.hasNormals() ? 0 :
+        flags & CompileFlag::QuantizeNormals ? 3*sizeof(Byte) : sizeof(Vector3);
+    const UnsignedInt textureCoordsSize = !meshData.hasTextureCoords2D() ? 0 :
+        flags & CompileFlag::QuantizeTextureCoordinates ? 2*sizeof(UnsignedShort) : sizeof(Vector2);
+    const auto padded = [](UnsignedInt size) { return (size + 3) & ~3; };
+    const UnsignedInt normalOffset = padded(positionSize);
+    const UnsignedInt textureCoordsOffset = normalOffset + padded(normalSize);
+    const UnsignedInt stride = textureCoordsOffset + padded(textureCoordsSize);
+
+    /* Positions are quantized relative to the bounding box, flat dimensions
+       are kept at unit scale to avoid division by zero */
+    Matrix4 dequantization;
+    Vector3 min, scale{1.0f};
+    if(flags & CompileFlag::QuantizePositions && !positions.empty()) {
+        min = positions[0];
+        Vector3 max = positions[0];
+        for(const Vector3& position: positions) {
+            min = Math::min(min, position);
+            max = Math::max(max, position);
+        }
+
+        const Vector3 size = max - min;
+        for(std::size_t i = 0; i != 3; ++i)
+            if(size[i] > 0.0f) scale[i] = size[i];
+
+        dequantization = Matrix4::translation(min)*Matrix4::scaling(scale);
+    }
+
+    /* Pack the vertex data */
+    Containers::Array<char> data = Containers::Array<char>::zeroInitialized(stride*positions.size());
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        char* const vertex = data.begin() + i*stride;
+
+        if(flags & CompileFlag::QuantizePositions) {
+            const Math::Vector3<UnsignedShort> position{Math::round((positions[i] - min)/scale*65535.0f)};
+            std::memcpy(vertex, position.data(), positionSize);
+        } else std::memcpy(vertex, positions[i].data(), positionSize);
+
+        if(normalSize) {
+            const Vector3& normal = meshData.normals(0)[i];
+            if(flags & CompileFlag::QuantizeNormals) {
+                const Math::Vector3<Byte> packed{Math::round(Math::clamp(normal, -1.0f, 1.0f)*127.0f)};
+                std::memcpy(vertex + normalOffset, packed.data(), normalSize);
+            } else std::memcpy(vertex + normalOffset, normal.data(), normalSize);
+        }
+
+        if(textureCoordsSize) {
+            const Vector2& textureCoords = meshData.textureCoords2D(0)[i];
+            if(flags & CompileFlag::QuantizeTextureCoordinates) {
+                const UnsignedShort packed[]{Math::packHalf(textureCoords.x()), Math::packHalf(textureCoords.y())};
+                std::memcpy(vertex + textureCoordsOffset, packed, textureCoordsSize);
+            } else std::memcpy(vertex + textureCoordsOffset, textureCoords.data(), textureCoordsSize);
+        }
+    }
+
+    /* Create vertex buffer and configure the attributes */
+    std::unique_ptr<Buffer> vertexBuffer{new Buffer{Buffer::TargetHint::Array}};
+    vertexBuffer->setData(data, usage);
+
+    mesh.addVertexBuffer(*vertexBuffer, 0,
+        flags & CompileFlag::QuantizePositions ?
+            Shaders::Generic3D::Position{Shaders::Generic3D::Position::DataType::UnsignedShort, Shaders::Generic3D::Position::DataOption::Normalized} :
+            Shaders::Generic3D::Position{},
+        stride - positionSize);
+
+    if(normalSize) mesh.addVertexBuffer(*vertexBuffer, 0,
+        normalOffset,
+        flags & CompileFlag::QuantizeNormals ?
+            Shaders::Generic3D::Normal{Shaders::Generic3D::Normal::DataType::Byte, Shaders::Generic3D::Normal::DataOption::Normalized} :
+            Shaders::Generic3D::Normal{},
+        stride - normalOffset - normalSize);
+
+    if(textureCoordsSize) mesh.addVertexBuffer(*vertexBuffer, 0,
+        textureCoordsOffset,
+        flags & CompileFlag::QuantizeTextureCoordinates ?
+            Shaders::Generic3D::TextureCoordinates{Shaders::Generic3D::TextureCoordinates::DataType::HalfFloat} :
+            Shaders::Generic3D::TextureCoordinates{},
+        stride - textureCoordsOffset - textureCoordsSize);
+
+    /* If indexed, fill index buffer and configure indexed mesh, else set
+       vertex count */
+    std::unique_ptr<Buffer> indexBuffer = compileIndices(mesh, meshData.indices(), positions.size(), usage);
+
+    return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::move(indexBuffer), dequantization);
 }
 
 }}
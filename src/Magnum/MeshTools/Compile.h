@@ -26,13 +26,15 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::compile()
+ * @brief Function @ref Magnum::MeshTools::compile(), enum @ref Magnum::MeshTools::CompileFlag, enum set @ref Magnum::MeshTools::CompileFlags
  */
 
 #include <tuple>
 #include <memory>
+#include <Corrade/Containers/EnumSet.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/Trade/Trade.h"
 #include "Magnum/MeshTools/visibility.h"
 
@@ -80,6 +82,75 @@ greater flexibility.
 */
 MAGNUM_MESHTOOLS_EXPORT std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData3D& meshData, BufferUsage usage);
 
+/**
+@brief Mesh compilation flag
+
+@see @ref CompileFlags,
+    @ref compile(const Trade::MeshData3D&, BufferUsage, CompileFlags)
+*/
+enum class CompileFlag: UnsignedByte {
+    /**
+     * Quantize positions to normalized unsigned 16-bit integers relative to
+     * the mesh bounding box. The returned dequantization matrix needs to be
+     * applied to the transformation matrix.
+     */
+    QuantizePositions = 1 << 0,
+
+    /**
+     * Quantize normals to normalized signed 8-bit integers.
+     */
+    QuantizeNormals = 1 << 1,
+
+    /**
+     * Convert texture coordinates to half floats.
+     * @requires_gl30 Extension @extension{ARB,half_float_vertex}
+     * @requires_gles30 Extension @es_extension{OES,vertex_half_float}
+     *      in OpenGL ES 2.0
+     */
+    QuantizeTextureCoordinates = 1 << 2
+};
+
+/**
+@brief Mesh compilation flags
+
+@see @ref compile(const Trade::MeshData3D&, BufferUsage, CompileFlags)
+*/
+typedef Containers::EnumSet<CompileFlag> CompileFlags;
+
+CORRADE_ENUMSET_OPERATORS(CompileFlags)
+
+/**
+@brief Compile 3D mesh data with quantized vertex attributes
+
+Similar to @ref compile(const Trade::MeshData3D&, BufferUsage), but the
+vertex attributes are packed according to @p flags. Each attribute is padded
+to four bytes, so with all flags the vertex takes 16 bytes instead of 32:
+
+-   With @ref CompileFlag::QuantizePositions the positions are stored as three
+    normalized unsigned shorts covering mesh bounding box, the
+    @ref Shaders::Generic3D::Position attribute is configured with
+    @ref Attribute::DataType::UnsignedShort and
+    @ref Attribute::DataOption::Normalized.
+-   With @ref CompileFlag::QuantizeNormals the normals are stored as three
+    normalized signed bytes, the @ref Shaders::Generic3D::Normal attribute
+    is configured with @ref Attribute::DataType::Byte and
+    @ref Attribute::DataOption::Normalized.
+-   With @ref CompileFlag::QuantizeTextureCoordinates the texture coordinates
+    are stored as half floats, the @ref Shaders::Generic3D::TextureCoordinates
+    attribute is configured with @ref Attribute::DataType::HalfFloat.
+
+The last returned value is the dequantization matrix, which transforms the
+normalized positions back to the original space. Multiply the shader
+transformation matrix with it, the normal matrix should be calculated from
+the original transformation. If @ref CompileFlag::QuantizePositions is not
+set, identity matrix is returned. Hardware-decoded packed formats like
+@ref Attribute::DataType::Int2101010Rev are only allowed for four-component
+attributes and octahedral encoding needs decoding in the shader, so neither of
+them is used for the three-component generic normal attribute.
+@see @ref Math::packHalf(), @ref shaders-generic
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>, Matrix4> compile(const Trade::MeshData3D& meshData, BufferUsage usage, CompileFlags flags);
+
 }}
 
 #endif
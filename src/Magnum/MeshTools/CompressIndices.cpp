@@ -29,51 +29,165 @@
 #include <algorithm>
 #include <Corrade/Containers/Array.h>
 
-#include "Magnum/Math/Functions.h"
 #include "Magnum/Buffer.h"
+#include "Magnum/MeshView.h"
 
 namespace Magnum { namespace MeshTools {
 
 namespace {
 
+constexpr UnsignedInt RestartIndex = 0xFFFFFFFFu;
+
 template<class> constexpr Mesh::IndexType indexType();
 template<> constexpr Mesh::IndexType indexType<UnsignedByte>() { return Mesh::IndexType::UnsignedByte; }
 template<> constexpr Mesh::IndexType indexType<UnsignedShort>() { return Mesh::IndexType::UnsignedShort; }
 template<> constexpr Mesh::IndexType indexType<UnsignedInt>() { return Mesh::IndexType::UnsignedInt; }
 
-template<class T> inline std::pair<Containers::Array<char>, Mesh::IndexType> compress(const std::vector<UnsignedInt>& indices) {
-    Containers::Array<char> buffer(indices.size()*sizeof(T));
-    for(std::size_t i = 0; i != indices.size(); ++i) {
-        T index = static_cast<T>(indices[i]);
-        std::memcpy(buffer.begin()+i*sizeof(T), &index, sizeof(T));
+/* Writes the indices relative to given base vertex, the output can alias the
+   input as long as sizeof(T) <= sizeof(UnsignedInt) -- i-th output index
+   overwrites only input indices that were already read */
+template<class T> void compress(char* const out, const UnsignedInt* const indices, const std::size_t count, const bool restart, const UnsignedInt baseVertex) {
+    for(std::size_t i = 0; i != count; ++i) {
+        const UnsignedInt input = indices[i];
+        const T index = restart && input == RestartIndex ? T(~T{}) : T(input - baseVertex);
+        std::memcpy(out + i*sizeof(T), &index, sizeof(T));
+    }
+}
+
+/* Index range, skipping restart indices */
+std::pair<UnsignedInt, UnsignedInt> indexRange(const UnsignedInt* const indices, const std::size_t count, const bool restart) {
+    UnsignedInt min = ~UnsignedInt{}, max = 0;
+    for(std::size_t i = 0; i != count; ++i) {
+        const UnsignedInt index = indices[i];
+        if(restart && index == RestartIndex) continue;
+        min = std::min(min, index);
+        max = std::max(max, index);
     }
 
-    return {std::move(buffer), indexType<T>()};
+    /* Empty or only restart indices */
+    if(min > max) return {0, 0};
+    return {min, max};
+}
+
+Mesh::IndexType compressedIndexType(const UnsignedInt max, const bool restart) {
+    /* With primitive restart the maximal value of the type is reserved */
+    if(max < 0xFFu + (restart ? 0 : 1)) return Mesh::IndexType::UnsignedByte;
+    if(max < 0xFFFFu + (restart ? 0 : 1)) return Mesh::IndexType::UnsignedShort;
+    return Mesh::IndexType::UnsignedInt;
 }
 
 }
 
-std::tuple<Containers::Array<char>, Mesh::IndexType, UnsignedInt, UnsignedInt> compressIndices(const std::vector<UnsignedInt>& indices) {
+std::tuple<Containers::Array<char>, Mesh::IndexType, UnsignedInt, UnsignedInt> compressIndices(const std::vector<UnsignedInt>& indices, const CompressIndicesFlags flags) {
     /** @todo Performance hint when range can be represented by smaller value? */
-    auto minmax = std::minmax_element(indices.begin(), indices.end());
-    std::pair<Containers::Array<char>, Mesh::IndexType> typeData;
-    switch(Math::log(256, *minmax.second)) {
-        case 0:
-            typeData = compress<UnsignedByte>(indices);
+    const std::pair<UnsignedInt, UnsignedInt> range = indexRange(indices.data(), indices.size(), !!(flags & CompressIndicesFlag::PrimitiveRestart));
+    Containers::Array<char> data{indices.size()*Mesh::indexSize(compressedIndexType(range.second, !!(flags & CompressIndicesFlag::PrimitiveRestart)))};
+
+    Mesh::IndexType type;
+    std::tie(type, std::ignore, std::ignore) = compressIndicesInto(data, indices, flags);
+
+    return std::make_tuple(std::move(data), type, range.first, range.second);
+}
+
+std::tuple<Mesh::IndexType, UnsignedInt, UnsignedInt> compressIndicesInto(const Containers::ArrayReference<char> data, const std::vector<UnsignedInt>& indices, const CompressIndicesFlags flags) {
+    const bool restart = !!(flags & CompressIndicesFlag::PrimitiveRestart);
+    const std::pair<UnsignedInt, UnsignedInt> range = indexRange(indices.data(), indices.size(), restart);
+    const Mesh::IndexType type = compressedIndexType(range.second, restart);
+    CORRADE_ASSERT(data.size() >= indices.size()*Mesh::indexSize(type),
+        "MeshTools::compressIndicesInto(): expected at least" << indices.size()*Mesh::indexSize(type) << "bytes but got" << data.size(), {});
+
+    switch(type) {
+        case Mesh::IndexType::UnsignedByte:
+            compress<UnsignedByte>(data.begin(), indices.data(), indices.size(), restart, 0);
             break;
-        case 1:
-            typeData = compress<UnsignedShort>(indices);
+        case Mesh::IndexType::UnsignedShort:
+            compress<UnsignedShort>(data.begin(), indices.data(), indices.size(), restart, 0);
             break;
-        case 2:
-        case 3:
-            typeData = compress<UnsignedInt>(indices);
+        case Mesh::IndexType::UnsignedInt:
+            compress<UnsignedInt>(data.begin(), indices.data(), indices.size(), restart, 0);
             break;
+    }
+
+    return std::make_tuple(type, range.first, range.second);
+}
+
+std::pair<Containers::Array<char>, std::vector<IndexChunk>> compressIndicesSplit(const std::vector<UnsignedInt>& indices, const UnsignedInt primitiveSize, const CompressIndicesFlags flags) {
+    const bool restart = !!(flags & CompressIndicesFlag::PrimitiveRestart);
+    CORRADE_ASSERT(restart || (primitiveSize && indices.size() % primitiveSize == 0),
+        "MeshTools::compressIndicesSplit(): expected index count divisible by" << primitiveSize << "but got" << indices.size(), {});
+
+    /* Max difference between indices in one chunk, with primitive restart the
+       0xffff value is reserved */
+    const UnsignedInt maxRange = restart ? 0xFFFEu : 0xFFFFu;
+
+    /* Find chunk boundaries. Each chunk is a contiguous range of the input
+       consisting of whole primitives, restart indices between primitives in
+       one chunk are kept. */
+    std::vector<IndexChunk> chunks;
+    std::size_t chunkBegin = 0, chunkEnd = 0, indexCount = 0;
+    UnsignedInt chunkMin = 0, chunkMax = 0;
+    for(std::size_t begin = 0; begin != indices.size(); ) {
+        /* Find end of current primitive, skip empty ones */
+        std::size_t end;
+        if(restart) {
+            end = std::find(indices.begin() + begin, indices.end(), RestartIndex) - indices.begin();
+            if(end == begin) {
+                ++begin;
+                continue;
+            }
+        } else end = begin + primitiveSize;
+
+        const std::pair<UnsignedInt, UnsignedInt> range = indexRange(indices.data() + begin, end - begin, false);
+        CORRADE_ASSERT(range.second - range.first <= maxRange,
+            "MeshTools::compressIndicesSplit(): primitive at index" << begin << "references" << range.second - range.first + 1 << "vertices", {});
+
+        /* Extend the current chunk, if possible */
+        if(chunkEnd != chunkBegin && std::max(chunkMax, range.second) - std::min(chunkMin, range.first) <= maxRange) {
+            chunkMin = std::min(chunkMin, range.first);
+            chunkMax = std::max(chunkMax, range.second);
+
+        /* Otherwise finish it and start a new one */
+        } else {
+            if(chunkEnd != chunkBegin) {
+                chunks.push_back({UnsignedInt(chunkBegin), UnsignedInt(chunkEnd - chunkBegin), Int(chunkMin), 0, chunkMax - chunkMin});
+                indexCount += chunkEnd - chunkBegin;
+            }
+            chunkBegin = begin;
+            chunkMin = range.first;
+            chunkMax = range.second;
+        }
+
+        chunkEnd = end;
+        begin = restart && end != indices.size() ? end + 1 : end;
+    }
+    if(chunkEnd != chunkBegin) {
+        chunks.push_back({UnsignedInt(chunkBegin), UnsignedInt(chunkEnd - chunkBegin), Int(chunkMin), 0, chunkMax - chunkMin});
+        indexCount += chunkEnd - chunkBegin;
+    }
 
-        default:
-            CORRADE_ASSERT(false, "MeshTools::compressIndices(): no type able to index" << *minmax.second << "elements.", {});
+    /* Write the chunks one after another, update offsets to point to the
+       output */
+    Containers::Array<char> data{indexCount*sizeof(UnsignedShort)};
+    std::size_t offset = 0;
+    for(IndexChunk& chunk: chunks) {
+        compress<UnsignedShort>(data.begin() + offset*sizeof(UnsignedShort), indices.data() + chunk.indexOffset, chunk.indexCount, restart, chunk.baseVertex);
+        chunk.indexOffset = offset;
+        offset += chunk.indexCount;
     }
 
-    return std::make_tuple(std::move(typeData.first), typeData.second, *minmax.first, *minmax.second);
+    return {std::move(data), std::move(chunks)};
+}
+
+std::vector<MeshView> indexChunkViews(Mesh& mesh, const std::vector<IndexChunk>& chunks) {
+    std::vector<MeshView> views;
+    views.reserve(chunks.size());
+    for(const IndexChunk& chunk: chunks) {
+        views.emplace_back(mesh);
+        views.back().setCount(chunk.indexCount)
+            .setBaseVertex(chunk.baseVertex)
+            .setIndexRange(chunk.indexOffset, chunk.indexStart, chunk.indexEnd);
+    }
+    return views;
 }
 
 #ifdef MAGNUM_BUILD_DEPRECATED
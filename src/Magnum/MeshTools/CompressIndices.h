@@ -26,19 +26,49 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::compressIndices()
+ * @brief Struct @ref Magnum::MeshTools::IndexChunk, enum @ref Magnum::MeshTools::CompressIndicesFlag, enum set @ref Magnum::MeshTools::CompressIndicesFlags, function @ref Magnum::MeshTools::compressIndices(), @ref Magnum::MeshTools::compressIndicesInto(), @ref Magnum::MeshTools::compressIndicesSplit(), @ref Magnum::MeshTools::indexChunkViews()
  */
 
 #include <tuple>
+#include <vector>
+#include <Corrade/Containers/EnumSet.h>
 
 #include "Magnum/Mesh.h"
 #include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
 
+/**
+@brief Index compression flag
+
+@see @ref CompressIndicesFlags, @ref compressIndices()
+*/
+enum class CompressIndicesFlag: UnsignedByte {
+    /**
+     * Treat `0xFFFFFFFF` in the input as primitive restart index. It is
+     * excluded from the index range and written as the maximal value of the
+     * output index type, which is the restart index used with
+     * @ref Renderer::Feature::PrimitiveRestartFixedIndex and in OpenGL ES
+     * 3.0, where primitive restart is always enabled. Because of that, the
+     * maximal value is not used for regular indices, e.g. index `255` needs
+     * @ref Mesh::IndexType::UnsignedShort.
+     */
+    PrimitiveRestart = 1 << 0
+};
+
+/**
+@brief Index compression flags
+
+@see @ref compressIndices()
+*/
+typedef Containers::EnumSet<CompressIndicesFlag> CompressIndicesFlags;
+
+CORRADE_ENUMSET_OPERATORS(CompressIndicesFlags)
+
 /**
 @brief Compress vertex indices
 @param indices  Index array
+@param flags    Compression flags
 @return Index range, type and compressed index array
 
 This function takes index array and outputs them compressed to smallest
@@ -62,9 +92,119 @@ Mesh mesh;
 mesh.setCount(indices.size())
     .setIndexBuffer(indexBuffer, 0, indexType, indexStart, indexEnd);
 @endcode
+@see @ref compressIndicesInto(), @ref compressIndicesSplit()
 @todo Extract IndexType out of Mesh class
 */
-std::tuple<Containers::Array<char>, Mesh::IndexType, UnsignedInt, UnsignedInt> MAGNUM_MESHTOOLS_EXPORT compressIndices(const std::vector<UnsignedInt>& indices);
+std::tuple<Containers::Array<char>, Mesh::IndexType, UnsignedInt, UnsignedInt> MAGNUM_MESHTOOLS_EXPORT compressIndices(const std::vector<UnsignedInt>& indices, CompressIndicesFlags flags = {});
+
+/**
+@brief Compress vertex indices into existing memory
+@param data     Output memory
+@param indices  Index array
+@param flags    Compression flags
+@return Index range and type
+
+Same as @ref compressIndices(), but writes the output into @p data instead of
+allocating a new array. The memory must be large enough to contain the indices
+of returned type, `indices.size()*4` bytes are always enough. The output can
+also alias the input, so the following compresses the indices in-place:
+@code
+std::vector<UnsignedInt> indices;
+
+Mesh::IndexType indexType;
+UnsignedInt indexStart, indexEnd;
+std::tie(indexType, indexStart, indexEnd) = MeshTools::compressIndicesInto(
+    {reinterpret_cast<char*>(indices.data()), indices.size()*4}, indices);
+
+Buffer indexBuffer;
+indexBuffer.setData({indices.data(), indices.size()*Mesh::indexSize(indexType)}, BufferUsage::StaticDraw);
+@endcode
+*/
+std::tuple<Mesh::IndexType, UnsignedInt, UnsignedInt> MAGNUM_MESHTOOLS_EXPORT compressIndicesInto(Containers::ArrayReference<char> data, const std::vector<UnsignedInt>& indices, CompressIndicesFlags flags = {});
+
+/**
+@brief Index chunk
+
+Contiguous range of the index array produced by @ref compressIndicesSplit().
+@see @ref indexChunkViews()
+*/
+struct IndexChunk {
+    /** @brief Offset of the first index */
+    UnsignedInt indexOffset;
+
+    /** @brief Index count */
+    UnsignedInt indexCount;
+
+    /** @brief Base vertex added to all indices in the chunk */
+    Int baseVertex;
+
+    /** @brief Minimal index in the chunk, without the base vertex */
+    UnsignedInt indexStart;
+
+    /** @brief Maximal index in the chunk, without the base vertex */
+    UnsignedInt indexEnd;
+};
+
+/**
+@brief Compress vertex indices into 16-bit chunks
+@param indices          Index array
+@param primitiveSize    Index count of one primitive
+@param flags            Compression flags
+@return Compressed index array of @ref Mesh::IndexType::UnsignedShort type and
+    list of chunks
+
+Splits the index array into contiguous chunks, each of them referencing at
+most 65536 consecutive vertices (65535 with
+@ref CompressIndicesFlag::PrimitiveRestart), and stores the indices relative
+to the first referenced vertex of each chunk. Meshes with more than 65536
+vertices can be thus drawn with 16-bit indices. The primitives are kept in
+order and never split, @p primitiveSize is `3` for triangles, `2` for lines
+and `1` for points. With @ref CompressIndicesFlag::PrimitiveRestart
+@p primitiveSize is ignored and the primitives are delimited by the restart
+indices instead, which makes it usable also for strips and fans. Restart
+indices at chunk boundaries are dropped. Expects that @p primitiveSize is not
+zero and index count is divisible by it and that no primitive references more
+than 65536 (65535) consecutive vertices.
+
+Each chunk can be drawn using @ref MeshView with base vertex, see
+@ref indexChunkViews(). Because base vertex is not available for indexed
+meshes in OpenGL ES, there you need to use separate @ref Mesh for each chunk,
+with each vertex buffer added at offset of @ref IndexChunk::baseVertex
+vertices:
+@code
+Containers::Array<char> indexData;
+std::vector<MeshTools::IndexChunk> chunks;
+std::tie(indexData, chunks) = MeshTools::compressIndicesSplit(indices);
+
+Buffer indexBuffer;
+indexBuffer.setData(indexData, BufferUsage::StaticDraw);
+
+std::vector<Mesh> meshes(chunks.size());
+for(std::size_t i = 0; i != chunks.size(); ++i) {
+    const MeshTools::IndexChunk& chunk = chunks[i];
+    meshes[i].setCount(chunk.indexCount)
+        .addVertexBuffer(vertexBuffer, chunk.baseVertex*sizeof(Vertex), MyShader::Position{}, MyShader::Normal{})
+        .setIndexBuffer(indexBuffer, chunk.indexOffset*2, Mesh::IndexType::UnsignedShort, chunk.indexStart, chunk.indexEnd);
+}
+@endcode
+*/
+std::pair<Containers::Array<char>, std::vector<IndexChunk>> MAGNUM_MESHTOOLS_EXPORT compressIndicesSplit(const std::vector<UnsignedInt>& indices, UnsignedInt primitiveSize = 3, CompressIndicesFlags flags = {});
+
+/**
+@brief Create mesh views for index chunks
+@param mesh         Indexed mesh containing the compressed index buffer
+@param chunks       Chunks returned by @ref compressIndicesSplit()
+
+Creates one @ref MeshView for each chunk with the index range, count and base
+vertex set up, so the whole mesh can be drawn in one
+@ref MeshView::draw(AbstractShaderProgram&, Containers::ArrayReference<const std::reference_wrapper<MeshView>>) "MeshView::draw()"
+batch. Expects that the index buffer was created from the data returned by
+@ref compressIndicesSplit() and set with @ref Mesh::IndexType::UnsignedShort.
+@requires_gl32 Extension @extension{ARB,draw_elements_base_vertex}
+@requires_gl Base vertex cannot be specified for indexed meshes in OpenGL
+    ES.
+*/
+std::vector<MeshView> MAGNUM_MESHTOOLS_EXPORT indexChunkViews(Mesh& mesh, const std::vector<IndexChunk>& chunks);
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 /**
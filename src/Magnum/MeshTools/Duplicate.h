@@ -29,10 +29,12 @@
  * @brief Function @ref Magnum::MeshTools::duplicate()
  */
 
+#include <atomic>
 #include <vector>
 #include <Corrade/Utility/Assert.h>
 
 #include "Magnum/Types.h"
+#include "Magnum/MeshTools/ExecutionPolicy.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -53,6 +55,30 @@ template<class T> std::vector<T> duplicate(const std::vector<UnsignedInt>& indic
     return out;
 }
 
+/**
+@brief Duplicate data using index array and given execution policy
+
+Same as @ref duplicate(const std::vector<UnsignedInt>&, const std::vector<T>&),
+but the work is executed according to @p policy. The type is expected to be
+default-constructible.
+*/
+template<class T> std::vector<T> duplicate(const ExecutionPolicy& policy, const std::vector<UnsignedInt>& indices, const std::vector<T>& data) {
+    std::vector<T> out(indices.size());
+
+    /* Out-of-range indices are skipped and reported after the loop, as the
+       assertion can't return from the other threads */
+    std::atomic<bool> outOfRange{false};
+    policy.parallelFor(indices.size(), [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            if(indices[i] < data.size()) out[i] = data[indices[i]];
+            else outOfRange = true;
+        }
+    });
+    CORRADE_ASSERT(!outOfRange, "MeshTools::duplicate(): index out of range", {});
+
+    return out;
+}
+
 }}
 
 #endif
@@ -0,0 +1,62 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ExecutionPolicy.h"
+
+#include <algorithm>
+#include <Corrade/configure.h>
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#include <vector>
+#endif
+
+namespace Magnum { namespace MeshTools {
+
+ThreadPool::ThreadPool(const UnsignedInt threadCount): _scheduler{new TaskScheduler{threadCount}} {}
+
+ThreadPool::~ThreadPool() = default;
+
+UnsignedInt ThreadPool::threadCount() const { return _scheduler->threadCount(); }
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void ExecutionPolicy::runOnThreads(const UnsignedInt threadCount, const std::size_t grainSize, const std::size_t count, void(*const fn)(const void*, std::size_t, std::size_t), const void* const data) {
+    /* Split the work into contiguous ranges, the calling thread processes the
+       last one */
+    const std::size_t chunk = std::max((count + threadCount - 1)/threadCount, grainSize);
+    std::vector<std::thread> threads;
+    std::size_t begin = 0;
+    for(; begin + chunk < count; begin += chunk)
+        threads.emplace_back(fn, data, begin, begin + chunk);
+    fn(data, begin, count);
+    for(std::thread& thread: threads) thread.join();
+}
+#else
+void ExecutionPolicy::runOnThreads(UnsignedInt, std::size_t, const std::size_t count, void(*const fn)(const void*, std::size_t, std::size_t), const void* const data) {
+    fn(data, 0, count);
+}
+#endif
+
+}}
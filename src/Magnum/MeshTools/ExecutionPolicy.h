@@ -0,0 +1,239 @@
+#ifndef Magnum_MeshTools_ExecutionPolicy_h
+#define Magnum_MeshTools_ExecutionPolicy_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::MeshTools::ThreadPool, @ref Magnum::MeshTools::ExecutionPolicy
+ */
+
+#include <cstddef>
+#include <memory>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/TaskScheduler.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Thread pool for parallel mesh processing
+
+Keeps a set of worker threads alive, so running many parallel operations in
+a row doesn't pay for creating and joining the threads every time. Pass it
+to algorithms through @ref ExecutionPolicy. The calling thread always takes
+part in the work, so a pool with thread count `n` creates `n - 1` worker
+threads. The pool is a dedicated @ref TaskScheduler instance, use
+@ref ExecutionPolicy(TaskScheduler&, std::size_t) to share the threads with
+other subsystems instead. Operations can be submitted from different threads
+at once and also from inside a running operation. On
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" no threads are created and
+everything is executed on the calling thread.
+*/
+class MAGNUM_MESHTOOLS_EXPORT ThreadPool {
+    public:
+        /**
+         * @brief Constructor
+         * @param threadCount   Thread count including the calling thread. If
+         *      `0`, the count of hardware threads is used.
+         */
+        explicit ThreadPool(UnsignedInt threadCount = 0);
+
+        /** @brief Copying is not allowed */
+        ThreadPool(const ThreadPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ThreadPool(ThreadPool&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Stops and joins all worker threads.
+         */
+        ~ThreadPool();
+
+        /** @brief Copying is not allowed */
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ThreadPool& operator=(ThreadPool&&) = delete;
+
+        /** @brief Thread count including the calling thread */
+        UnsignedInt threadCount() const;
+
+        /** @brief Underlying task scheduler */
+        TaskScheduler& scheduler() { return *_scheduler; }
+
+    private:
+        std::unique_ptr<TaskScheduler> _scheduler;
+};
+
+/**
+@brief Execution policy for parallel mesh processing
+
+Controls how embarrassingly parallel loops in @ref duplicate(),
+@ref flipNormals(), @ref generateFlatNormals(), @ref interleave() and
+@ref transformPointsInPlace() and related functions are executed. All these
+functions have an overload taking the policy as a first parameter, the
+overloads without it run serially. Example usage:
+@code
+MeshTools::ThreadPool pool;
+MeshTools::ExecutionPolicy parallel{pool};
+
+std::vector<Vector3> positions = MeshTools::duplicate(parallel, indices, uniquePositions);
+MeshTools::transformPointsInPlace(parallel, transformation, positions.data(), positions.size());
+@endcode
+
+Alternatively the policy can use the @ref TaskScheduler::global() "global task scheduler"
+shared with other subsystems:
+@code
+MeshTools::ExecutionPolicy parallel{TaskScheduler::global()};
+@endcode
+
+The work is split into contiguous ranges of at least @ref grainSize()
+elements, so the threads don't fight over the same cache lines and the
+synchronization overhead is amortized. Inputs not larger than the grain size
+are always processed serially on the calling thread. The results are the
+same regardless of the policy.
+*/
+class ExecutionPolicy {
+    public:
+        /** @brief Default grain size */
+        enum: std::size_t { DefaultGrainSize = 16384 };
+
+        /**
+         * @brief Serial execution
+         *
+         * Everything is executed on the calling thread.
+         */
+        constexpr explicit ExecutionPolicy() noexcept: _pool{}, _scheduler{}, _threadCount{1}, _grainSize{DefaultGrainSize} {}
+
+        /**
+         * @brief Execution on a thread pool
+         *
+         * The pool is expected to be alive for as long as the policy is
+         * used. The grain-sized parts are handed out to the threads
+         * dynamically, so unevenly expensive parts don't stall the
+         * operation.
+         */
+        explicit ExecutionPolicy(ThreadPool& pool, std::size_t grainSize = DefaultGrainSize) noexcept: _pool{&pool}, _scheduler{&pool.scheduler()}, _threadCount{pool.threadCount()}, _grainSize{grainSize ? grainSize : 1} {}
+
+        /**
+         * @brief Execution on a task scheduler
+         *
+         * Same as @ref ExecutionPolicy(ThreadPool&, std::size_t), but using
+         * given task scheduler, such as @ref TaskScheduler::global(). The
+         * scheduler is expected to be alive for as long as the policy is
+         * used.
+         */
+        explicit ExecutionPolicy(TaskScheduler& scheduler, std::size_t grainSize = DefaultGrainSize) noexcept: _pool{}, _scheduler{&scheduler}, _threadCount{scheduler.threadCount()}, _grainSize{grainSize ? grainSize : 1} {}
+
+        /**
+         * @brief Execution on temporary threads
+         *
+         * The work is split into @p threadCount equally large parts (but
+         * not smaller than the grain size), processed by temporary threads
+         * created for each operation and the calling thread. Useful for
+         * one-off operations, prefer
+         * @ref ExecutionPolicy(ThreadPool&, std::size_t) otherwise. Expects
+         * that @p threadCount is at least `1`.
+         */
+        explicit ExecutionPolicy(UnsignedInt threadCount, std::size_t grainSize = DefaultGrainSize): _pool{}, _scheduler{}, _threadCount{threadCount}, _grainSize{grainSize ? grainSize : 1} {
+            CORRADE_ASSERT(threadCount, "MeshTools::ExecutionPolicy: expected at least one thread", );
+        }
+
+        /**
+         * @brief Thread pool
+         *
+         * If the policy doesn't use a thread pool, returns `nullptr`.
+         */
+        ThreadPool* pool() const { return _pool; }
+
+        /**
+         * @brief Task scheduler
+         *
+         * If the policy uses neither a thread pool nor a task scheduler,
+         * returns `nullptr`.
+         */
+        TaskScheduler* scheduler() const { return _scheduler; }
+
+        /** @brief Thread count including the calling thread */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /** @brief Whether the execution is serial */
+        bool isSerial() const { return _threadCount <= 1; }
+
+        /** @brief Grain size */
+        std::size_t grainSize() const { return _grainSize; }
+
+        /**
+         * @brief Set grain size
+         * @return Reference to self (for method chaining)
+         *
+         * Minimal count of elements processed by one thread at once. Values
+         * lower than `1` are clamped to `1`. Default is
+         * @ref DefaultGrainSize.
+         */
+        ExecutionPolicy& setGrainSize(std::size_t size) {
+            _grainSize = size ? size : 1;
+            return *this;
+        }
+
+        /**
+         * @brief Execute a loop
+         *
+         * Calls `fn(begin, end)` on disjoint contiguous ranges covering
+         * @f$ [0, count) @f$, possibly in parallel. The function is expected
+         * to be safe to call from multiple threads at once for different
+         * ranges.
+         */
+        template<class F> void parallelFor(std::size_t count, const F& fn) const;
+
+    private:
+        template<class F> static void call(const void* fn, std::size_t begin, std::size_t end) {
+            (*static_cast<const F*>(fn))(begin, end);
+        }
+
+        MAGNUM_MESHTOOLS_EXPORT static void runOnThreads(UnsignedInt threadCount, std::size_t grainSize, std::size_t count, void(*fn)(const void*, std::size_t, std::size_t), const void* data);
+
+        ThreadPool* _pool;
+        TaskScheduler* _scheduler;
+        UnsignedInt _threadCount;
+        std::size_t _grainSize;
+};
+
+template<class F> void ExecutionPolicy::parallelFor(const std::size_t count, const F& fn) const {
+    if(_threadCount > 1 && count > _grainSize) {
+        if(_scheduler) _scheduler->parallelFor(count, _grainSize, fn);
+        else runOnThreads(_threadCount, _grainSize, count, call<F>, &fn);
+        return;
+    }
+
+    fn(std::size_t{0}, count);
+}
+
+}}
+
+#endif
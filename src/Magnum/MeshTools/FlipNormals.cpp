@@ -30,16 +30,31 @@
 namespace Magnum { namespace MeshTools {
 
 void flipFaceWinding(std::vector<UnsignedInt>& indices) {
+    flipFaceWinding(ExecutionPolicy{}, indices);
+}
+
+void flipFaceWinding(const ExecutionPolicy& policy, std::vector<UnsignedInt>& indices) {
     CORRADE_ASSERT(!(indices.size()%3), "MeshTools::flipNormals(): index count is not divisible by 3!", );
 
-    using std::swap;
-    for(std::size_t i = 0; i != indices.size(); i += 3)
-        swap(indices[i+1], indices[i+2]);
+    /* Parallelize over faces, not indices */
+    UnsignedInt* const data = indices.data();
+    policy.parallelFor(indices.size()/3, [data](const std::size_t begin, const std::size_t end) {
+        using std::swap;
+        for(std::size_t i = begin*3; i != end*3; i += 3)
+            swap(data[i+1], data[i+2]);
+    });
 }
 
 void flipNormals(std::vector<Vector3>& normals) {
-    for(Vector3& normal: normals)
-        normal = -normal;
+    flipNormals(ExecutionPolicy{}, normals);
+}
+
+void flipNormals(const ExecutionPolicy& policy, std::vector<Vector3>& normals) {
+    Vector3* const data = normals.data();
+    policy.parallelFor(normals.size(), [data](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            data[i] = -data[i];
+    });
 }
 
 }}
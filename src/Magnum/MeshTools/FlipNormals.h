@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/ExecutionPolicy.h"
 #include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
@@ -48,6 +49,14 @@ but flips only face winding.
 */
 void MAGNUM_MESHTOOLS_EXPORT flipFaceWinding(std::vector<UnsignedInt>& indices);
 
+/**
+@brief Flip face winding using given execution policy
+
+Same as @ref flipFaceWinding(std::vector<UnsignedInt>&), but the work is
+executed according to @p policy.
+*/
+void MAGNUM_MESHTOOLS_EXPORT flipFaceWinding(const ExecutionPolicy& policy, std::vector<UnsignedInt>& indices);
+
 /**
 @brief Flip mesh normals
 @param[in,out] normals  Normal array to operate on
@@ -57,6 +66,14 @@ but flips only normals, not face winding.
 */
 void MAGNUM_MESHTOOLS_EXPORT flipNormals(std::vector<Vector3>& normals);
 
+/**
+@brief Flip mesh normals using given execution policy
+
+Same as @ref flipNormals(std::vector<Vector3>&), but the work is executed
+according to @p policy.
+*/
+void MAGNUM_MESHTOOLS_EXPORT flipNormals(const ExecutionPolicy& policy, std::vector<Vector3>& normals);
+
 /**
 @brief Flip mesh normals and face winding
 @param[in,out] indices  Index array to operate on
@@ -74,6 +91,17 @@ inline void flipNormals(std::vector<UnsignedInt>& indices, std::vector<Vector3>&
     flipNormals(normals);
 }
 
+/**
+@brief Flip mesh normals and face winding using given execution policy
+
+Same as @ref flipNormals(std::vector<UnsignedInt>&, std::vector<Vector3>&),
+but the work is executed according to @p policy.
+*/
+inline void flipNormals(const ExecutionPolicy& policy, std::vector<UnsignedInt>& indices, std::vector<Vector3>& normals) {
+    flipFaceWinding(policy, indices);
+    flipNormals(policy, normals);
+}
+
 }}
 
 #endif
@@ -32,26 +32,27 @@
 namespace Magnum { namespace MeshTools {
 
 std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateFlatNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions) {
+    return generateFlatNormals(ExecutionPolicy{}, indices, positions);
+}
+
+std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateFlatNormals(const ExecutionPolicy& policy, const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions) {
     CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateFlatNormals(): index count is not divisible by 3!", (std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>>()));
 
-    /* Create normal for every triangle (assuming counterclockwise winding) */
-    std::vector<UnsignedInt> normalIndices;
-    normalIndices.reserve(indices.size());
-    std::vector<Vector3> normals;
-    normals.reserve(indices.size()/3);
-    for(std::size_t i = 0; i != indices.size(); i += 3) {
-        const Vector3 normal = Math::cross(positions[indices[i+2]]-positions[indices[i+1]],
-                                           positions[indices[i]]-positions[indices[i+1]]).normalized();
-
-        /* Use the same normal for all three vertices of the face */
-        normalIndices.push_back(normals.size());
-        normalIndices.push_back(normals.size());
-        normalIndices.push_back(normals.size());
-        normals.push_back(normal);
-    }
+    /* Create normal for every triangle (assuming counterclockwise winding),
+       use the same normal for all three vertices of the face */
+    std::vector<UnsignedInt> normalIndices(indices.size());
+    std::vector<Vector3> normals(indices.size()/3);
+    policy.parallelFor(normals.size(), [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            const UnsignedInt* const face = indices.data() + i*3;
+            normals[i] = Math::cross(positions[face[2]]-positions[face[1]],
+                                     positions[face[0]]-positions[face[1]]).normalized();
+            normalIndices[i*3] = normalIndices[i*3 + 1] = normalIndices[i*3 + 2] = i;
+        }
+    });
 
     /* Remove duplicate normals and return */
-    normalIndices = MeshTools::duplicate(normalIndices, MeshTools::removeDuplicates(normals));
+    normalIndices = MeshTools::duplicate(policy, normalIndices, MeshTools::removeDuplicates(normals));
     return std::make_tuple(std::move(normalIndices), std::move(normals));
 }
 
@@ -33,6 +33,7 @@
 #include <vector>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/ExecutionPolicy.h"
 #include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
@@ -56,11 +57,25 @@ std::tie(normalIndices, normals) = MeshTools::generateFlatNormals(vertexIndices,
 You can then use @ref combineIndexedArrays() to combine normal and vertex array
 to use the same indices.
 
+Combining the arrays duplicates vertices shared among faces with different
+normals. If the mesh is rendered with @ref Shaders::Phong, consider using
+@ref Shaders::Phong::Flag::FlatShading instead, which doesn't need the normals
+at all.
+
 @attention The function requires the mesh to have triangle faces, thus index
     count must be divisible by 3.
 */
 std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> MAGNUM_MESHTOOLS_EXPORT generateFlatNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions);
 
+/**
+@brief Generate flat normals using given execution policy
+
+Same as @ref generateFlatNormals(const std::vector<UnsignedInt>&, const std::vector<Vector3>&),
+but the per-face normals are calculated according to @p policy. Removing the
+duplicates is done serially.
+*/
+std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> MAGNUM_MESHTOOLS_EXPORT generateFlatNormals(const ExecutionPolicy& policy, const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions);
+
 }}
 
 #endif
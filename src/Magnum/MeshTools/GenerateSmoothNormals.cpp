@@ -0,0 +1,108 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateSmoothNormals.h"
+
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/TaskScheduler.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+
+namespace Magnum { namespace MeshTools {
+
+std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const Rad creaseAngle, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateSmoothNormals(): index count is not divisible by 3", (std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>>()));
+    CORRADE_ASSERT(threadCount, "MeshTools::generateSmoothNormals(): expected at least one thread", (std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>>()));
+
+    #ifndef CORRADE_NO_ASSERT
+    for(const UnsignedInt index: indices)
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::generateSmoothNormals(): index" << index << "out of range for" << positions.size() << "vertices", (std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>>()));
+    #endif
+
+    /* Unit face normals (assuming counterclockwise winding) and face angles
+       at each corner */
+    std::vector<Vector3> faceNormals(indices.size()/3);
+    std::vector<Float> cornerAngles(indices.size());
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const Vector3 normal = Math::cross(positions[indices[i + 1]] - positions[indices[i]],
+                                           positions[indices[i + 2]] - positions[indices[i]]);
+        const Float length = normal.length();
+        if(length != 0.0f) faceNormals[i/3] = normal/length;
+
+        for(std::size_t j = 0; j != 3; ++j) {
+            const Vector3& position = positions[indices[i + j]];
+            const Vector3 a = positions[indices[i + (j + 1)%3]] - position;
+            const Vector3 b = positions[indices[i + (j + 2)%3]] - position;
+            cornerAngles[i + j] = std::atan2(Math::cross(a, b).length(), Math::dot(a, b));
+        }
+    }
+
+    /* Vertex-to-corner adjacency in a compressed form, the corners of vertex
+       `v` are in range [offsets[v], offsets[v + 1]) */
+    std::vector<UnsignedInt> offsets(positions.size() + 1);
+    for(const UnsignedInt index: indices) ++offsets[index + 1];
+    for(std::size_t i = 1; i != offsets.size(); ++i) offsets[i] += offsets[i - 1];
+    std::vector<UnsignedInt> corners(indices.size());
+    {
+        std::vector<UnsignedInt> position{offsets.begin(), offsets.end() - 1};
+        for(std::size_t i = 0; i != indices.size(); ++i)
+            corners[position[indices[i]]++] = i;
+    }
+
+    /* Average normals of faces around each vertex for each corner. Each
+       corner belongs to exactly one vertex, so the vertex ranges can be
+       processed in parallel. */
+    const Float creaseCos = Math::cos(creaseAngle);
+    std::vector<Vector3> normals(indices.size());
+    const auto smooth = [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t v = begin; v != end; ++v) {
+            for(UnsignedInt i = offsets[v]; i != offsets[v + 1]; ++i) {
+                const Vector3& faceNormal = faceNormals[corners[i]/3];
+
+                Vector3 normal;
+                for(UnsignedInt j = offsets[v]; j != offsets[v + 1]; ++j) {
+                    const Vector3& otherNormal = faceNormals[corners[j]/3];
+                    if(i == j || Math::dot(faceNormal, otherNormal) >= creaseCos)
+                        normal += otherNormal*cornerAngles[corners[j]];
+                }
+
+                /* Degenerate faces have zero normal */
+                const Float length = normal.length();
+                normals[corners[i]] = length != 0.0f ? normal/length : faceNormal;
+            }
+        }
+    };
+
+    TaskScheduler::global().parallelFor(positions.size(), (positions.size() + threadCount - 1)/threadCount, smooth);
+
+    /* Remove duplicate normals and return */
+    std::vector<UnsignedInt> normalIndices = MeshTools::removeDuplicates(normals);
+    return std::make_tuple(std::move(normalIndices), std::move(normals));
+}
+
+}}
@@ -0,0 +1,87 @@
+#ifndef Magnum_MeshTools_GenerateSmoothNormals_h
+#define Magnum_MeshTools_GenerateSmoothNormals_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateSmoothNormals()
+ */
+
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Generate smooth normals
+@param indices      Array of triangle face indices
+@param positions    Array of vertex positions
+@param creaseAngle  Max angle between faces that are smoothed together
+@param threadCount  Count of parts to split the work into
+@return Normal indices and vectors
+
+For each face corner averages normals of all faces sharing the vertex whose
+normal differs from normal of the corner face by not more than
+@p creaseAngle. The face normals are weighted by the angle of the face at
+given vertex, which makes the result independent of how the surface is
+tessellated. Default crease angle smooths all faces together, pass for
+example `60.0_degf` to keep sharp edges sharp. Duplicate normals are
+removed before returning, so vertices on smooth surfaces share the same
+normal and vertices on creases get one normal for each side. Example usage:
+@code
+std::vector<UnsignedInt> vertexIndices;
+std::vector<Vector3> positions;
+
+std::vector<UnsignedInt> normalIndices;
+std::vector<Vector3> normals;
+std::tie(normalIndices, normals) = MeshTools::generateSmoothNormals(vertexIndices, positions, Deg(60.0f));
+@endcode
+You can then use @ref combineIndexedArrays() to combine normal and vertex
+array to use the same indices and @ref generateTangents() to generate the
+tangent space.
+
+The vertex-to-face adjacency is built in linear time, the faces are
+expected to be connected through the position indices, so call
+@ref removeDuplicates() on the positions first if they aren't. If
+@p threadCount is larger than `1`, the vertices are split into at most
+@p threadCount contiguous ranges processed in parallel on
+@ref TaskScheduler::global().
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3. All indices are expected to be less than
+    size of @p positions and @p threadCount is expected to be nonzero.
+
+@see @ref generateFlatNormals()
+*/
+std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> MAGNUM_MESHTOOLS_EXPORT generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, Rad creaseAngle = Rad(Constants::pi()), UnsignedInt threadCount = 1);
+
+}}
+
+#endif
@@ -0,0 +1,97 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateTangents.h"
+
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace MeshTools {
+
+std::vector<Vector4> generateTangents(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, const std::vector<Vector2>& textureCoords) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateTangents(): index count is not divisible by 3", {});
+    CORRADE_ASSERT(normals.size() == positions.size() && textureCoords.size() == positions.size(),
+        "MeshTools::generateTangents(): expected" << positions.size() << "normals and texture coordinates but got" << normals.size() << "and" << textureCoords.size(), {});
+
+    #ifndef CORRADE_NO_ASSERT
+    for(const UnsignedInt index: indices)
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::generateTangents(): index" << index << "out of range for" << positions.size() << "vertices", {});
+    #endif
+
+    /* Accumulate normalized face tangents and bitangents weighted by face
+       angle at each corner */
+    std::vector<Vector3> tangents(positions.size());
+    std::vector<Vector3> bitangents(positions.size());
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        const Vector3 e1 = positions[indices[i + 1]] - positions[indices[i]];
+        const Vector3 e2 = positions[indices[i + 2]] - positions[indices[i]];
+        const Vector2 uv1 = textureCoords[indices[i + 1]] - textureCoords[indices[i]];
+        const Vector2 uv2 = textureCoords[indices[i + 2]] - textureCoords[indices[i]];
+
+        /* Degenerate texture mapping, nothing to contribute */
+        const Float determinant = uv1.x()*uv2.y() - uv2.x()*uv1.y();
+        if(determinant == 0.0f) continue;
+
+        const Vector3 tangent = (e1*uv2.y() - e2*uv1.y())/determinant;
+        const Vector3 bitangent = (e2*uv1.x() - e1*uv2.x())/determinant;
+        const Float tangentLength = tangent.length();
+        const Float bitangentLength = bitangent.length();
+        if(tangentLength == 0.0f || bitangentLength == 0.0f) continue;
+
+        for(std::size_t j = 0; j != 3; ++j) {
+            const Vector3& position = positions[indices[i + j]];
+            const Vector3 a = positions[indices[i + (j + 1)%3]] - position;
+            const Vector3 b = positions[indices[i + (j + 2)%3]] - position;
+            const Float angle = std::atan2(Math::cross(a, b).length(), Math::dot(a, b));
+
+            tangents[indices[i + j]] += tangent*(angle/tangentLength);
+            bitangents[indices[i + j]] += bitangent*(angle/bitangentLength);
+        }
+    }
+
+    /* Orthogonalize against the normal and calculate the bitangent sign */
+    std::vector<Vector4> out(positions.size());
+    for(std::size_t i = 0; i != positions.size(); ++i) {
+        const Vector3& normal = normals[i];
+        Vector3 tangent = tangents[i] - normal*Math::dot(normal, tangents[i]);
+
+        /* No usable tangent, pick any perpendicular direction */
+        if(tangent.dot() < 1.0e-12f)
+            tangent = Math::cross(normal, std::abs(normal.x()) < 0.9f ? Vector3::xAxis() : Vector3::yAxis());
+
+        const Float length = tangent.length();
+        if(length != 0.0f) tangent /= length;
+
+        const Float sign = Math::dot(Math::cross(normal, tangent), bitangents[i]) < 0.0f ? -1.0f : 1.0f;
+        out[i] = {tangent, sign};
+    }
+
+    return out;
+}
+
+}}
@@ -0,0 +1,77 @@
+#ifndef Magnum_MeshTools_GenerateTangents_h
+#define Magnum_MeshTools_GenerateTangents_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateTangents()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Generate tangent space
+@param indices          Array of triangle face indices
+@param positions        Array of vertex positions
+@param normals          Array of vertex normals
+@param textureCoords    Array of vertex texture coordinates
+@return Tangent for each vertex
+
+For each vertex calculates tangent pointing in the direction of increasing
+first texture coordinate, orthogonalized against the vertex normal. The
+output follows the same convention as MikkTSpace: the first three components
+are the normalized tangent and the fourth is the sign of the bitangent, which
+is then reconstructed in the shader as `sign*cross(normal, tangent)`. Face
+tangents are normalized and weighted by the angle of the face at given
+vertex before averaging. Vertices with no usable texture coordinates get an
+arbitrary tangent perpendicular to the normal. Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions, normals;
+std::vector<Vector2> textureCoords;
+std::tie(indices, positions, normals, textureCoords) = ...;
+
+std::vector<Vector4> tangents = MeshTools::generateTangents(indices, positions, normals, textureCoords);
+@endcode
+
+Vertices with mirrored texture mapping should not be shared between the
+mirrored parts, otherwise the tangents cancel each other out.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3. All attribute arrays are expected to have
+    the same size and all indices are expected to be less than that.
+
+@see @ref generateSmoothNormals(), @ref combineIndexedArrays()
+*/
+std::vector<Vector4> MAGNUM_MESHTOOLS_EXPORT generateTangents(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::vector<Vector3>& normals, const std::vector<Vector2>& textureCoords);
+
+}}
+
+#endif
@@ -0,0 +1,107 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateWireframeVertexIndices.h"
+
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+    enum: UnsignedByte { NoCorner = 0xff };
+}
+
+std::tuple<std::vector<UnsignedInt>, std::vector<Float>> generateWireframeVertexIndices(std::vector<UnsignedInt>& indices, const std::size_t vertexCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateWireframeVertexIndices(): index count is not divisible by 3!", (std::tuple<std::vector<UnsignedInt>, std::vector<Float>>()));
+
+    /* Corner assigned to each vertex and index of a duplicate of each
+       original vertex for each corner, if there is any */
+    std::vector<UnsignedByte> corners(vertexCount, NoCorner);
+    std::vector<UnsignedInt> copies(vertexCount*3, ~UnsignedInt{});
+    std::vector<UnsignedInt> vertexMapping(vertexCount);
+    for(std::size_t i = 0; i != vertexCount; ++i) vertexMapping[i] = i;
+
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        /* Keep already assigned corners, if they don't collide */
+        UnsignedByte used = 0;
+        bool resolved[3]{};
+        for(std::size_t j = 0; j != 3; ++j) {
+            CORRADE_ASSERT(indices[i + j] < vertexCount, "MeshTools::generateWireframeVertexIndices(): index out of range", (std::tuple<std::vector<UnsignedInt>, std::vector<Float>>()));
+
+            const UnsignedByte corner = corners[indices[i + j]];
+            if(corner == NoCorner || (used & (1 << corner))) continue;
+            used |= 1 << corner;
+            resolved[j] = true;
+        }
+
+        for(std::size_t j = 0; j != 3; ++j) {
+            if(resolved[j]) continue;
+
+            UnsignedInt& index = indices[i + j];
+
+            /* Vertex without a corner gets the first free one */
+            if(corners[index] == NoCorner) {
+                UnsignedByte corner = 0;
+                while(used & (1 << corner)) ++corner;
+                corners[index] = corner;
+                used |= 1 << corner;
+                continue;
+            }
+
+            /* Colliding vertex, reuse its duplicate with a free corner, if
+               there is any, otherwise create a new one */
+            const UnsignedInt original = vertexMapping[index];
+            UnsignedByte corner = NoCorner;
+            for(UnsignedByte c = 0; c != 3; ++c) {
+                if(used & (1 << c)) continue;
+                if(corner == NoCorner) corner = c;
+                if(copies[original*3 + c] != ~UnsignedInt{}) {
+                    corner = c;
+                    break;
+                }
+            }
+
+            UnsignedInt& copy = copies[original*3 + corner];
+            if(copy == ~UnsignedInt{}) {
+                copy = vertexMapping.size();
+                vertexMapping.push_back(original);
+                corners.push_back(corner);
+            }
+
+            index = copy;
+            used |= 1 << corner;
+        }
+    }
+
+    /* Vertices not referenced by any triangle are left at the first corner */
+    std::vector<Float> vertexIndices;
+    vertexIndices.reserve(corners.size());
+    for(const UnsignedByte corner: corners)
+        vertexIndices.push_back(corner == NoCorner ? 0.0f : Float(corner));
+
+    return std::make_tuple(std::move(vertexMapping), std::move(vertexIndices));
+}
+
+}}
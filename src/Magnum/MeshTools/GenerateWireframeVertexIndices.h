@@ -0,0 +1,76 @@
+#ifndef Magnum_MeshTools_GenerateWireframeVertexIndices_h
+#define Magnum_MeshTools_GenerateWireframeVertexIndices_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateWireframeVertexIndices()
+ */
+
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Generate wireframe vertex indices for indexed mesh
+@param[in,out] indices  Array of triangle face indices
+@param vertexCount      Vertex count
+@return Vertex mapping and vertex index attribute
+
+Assigns each vertex a corner index (`0`, `1` or `2`) so that all three vertices
+of every triangle have different corners. This is the value expected in the
+@ref Shaders::MeshVisualizer::VertexIndex attribute, so you can draw wireframe
+of indexed meshes with @ref Shaders::MeshVisualizer::Flag::VertexIndexAttribute
+and without a geometry shader. The function needs to run only once per mesh.
+
+Vertices are shared between triangles whenever possible. A vertex gets
+duplicated only if it can't get a corner different from the other vertices in
+some triangle. In that case the duplicate is appended after the original
+vertices and @p indices are updated to reference it. The first returned array
+maps each output vertex to the original one, pass it to @ref duplicate() to
+expand vertex data. The second array contains the corner indices for all output
+vertices. Example usage:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+std::vector<UnsignedInt> vertexMapping;
+std::vector<Float> vertexIndices;
+std::tie(vertexMapping, vertexIndices) = MeshTools::generateWireframeVertexIndices(indices, positions.size());
+positions = MeshTools::duplicate(vertexMapping, positions);
+@endcode
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+*/
+std::tuple<std::vector<UnsignedInt>, std::vector<Float>> MAGNUM_MESHTOOLS_EXPORT generateWireframeVertexIndices(std::vector<UnsignedInt>& indices, std::size_t vertexCount);
+
+}}
+
+#endif
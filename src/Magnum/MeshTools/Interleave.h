@@ -33,11 +33,14 @@
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Assert.h>
 
+#include "Magnum/Buffer.h"
 #include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/ExecutionPolicy.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 #include <tuple>
-#include "Magnum/Buffer.h"
 #include "Magnum/Mesh.h"
 #endif
 
@@ -83,6 +86,14 @@ template<class T> typename std::enable_if<!std::is_convertible<T, std::size_t>::
     return sizeof(typename T::value_type);
 }
 
+/* Copy data from strided view to the buffer */
+template<class T> std::size_t writeOneInterleaved(std::size_t stride, char* startingOffset, const Trade::StridedArrayReference<T>& attributeList) {
+    for(std::size_t i = 0; i != attributeList.size(); ++i)
+        std::memcpy(startingOffset + i*stride, attributeList.data() + i*attributeList.stride(), sizeof(T));
+
+    return sizeof(T);
+}
+
 /* Skip gap */
 constexpr std::size_t writeOneInterleaved(std::size_t, char*, std::size_t gap) { return gap; }
 
@@ -92,6 +103,36 @@ template<class T, class ...U> void writeInterleaved(std::size_t stride, char* st
     writeInterleaved(stride, startingOffset + writeOneInterleaved(stride, startingOffset, first), next...);
 }
 
+/* Copy data in given vertex range to the buffer, used for parallel
+   interleaving. Unlike above, the attribute list needs random access. */
+template<class T> typename std::enable_if<!std::is_convertible<T, std::size_t>::value, std::size_t>::type writeOneInterleaved(std::size_t stride, char* startingOffset, const T& attributeList, std::size_t begin, std::size_t end) {
+    for(std::size_t i = begin; i != end; ++i)
+        std::memcpy(startingOffset + i*stride, reinterpret_cast<const char*>(&attributeList[i]), sizeof(typename T::value_type));
+
+    return sizeof(typename T::value_type);
+}
+
+/* Copy data in given vertex range from strided view to the buffer */
+template<class T> std::size_t writeOneInterleaved(std::size_t stride, char* startingOffset, const Trade::StridedArrayReference<T>& attributeList, std::size_t begin, std::size_t end) {
+    for(std::size_t i = begin; i != end; ++i)
+        std::memcpy(startingOffset + i*stride, attributeList.data() + i*attributeList.stride(), sizeof(T));
+
+    return sizeof(T);
+}
+
+/* Skip gap */
+constexpr std::size_t writeOneInterleaved(std::size_t, char*, std::size_t gap, std::size_t, std::size_t) { return gap; }
+
+/* Write interleaved data in given vertex range */
+inline void writeInterleavedRange(std::size_t, char*, std::size_t, std::size_t) {}
+template<class T, class ...U> void writeInterleavedRange(std::size_t stride, char* startingOffset, std::size_t begin, std::size_t end, const T& first, const U&... next) {
+    writeInterleavedRange(stride, startingOffset + writeOneInterleaved(stride, startingOffset, first, begin, end), begin, end, next...);
+}
+
+/* Allocates the buffer storage and maps it for writing, returns nullptr if
+   buffer mapping is not available */
+MAGNUM_MESHTOOLS_EXPORT char* mapInterleaved(Buffer& buffer, std::size_t size, BufferUsage usage);
+
 }
 
 /**
@@ -132,13 +173,14 @@ would be 21 bytes, causing possible performance loss.
 @note The only requirements to attribute array type is that it must have
     typedef `T::value_type`, forward iterator (to be used with range-based
     for) and function `size()` returning count of elements. In most cases it
-    will be `std::vector` or `std::array`.
+    will be `std::vector` or `std::array`. Attributes already interleaved
+    with other data can be passed as @ref Trade::StridedArrayReference.
 
-@see @ref interleaveInto()
+@see @ref interleaveInto(), @ref interleave(Buffer&, BufferUsage, const T&...)
 @todo remove `std::enable_if` when deprecated overloads are removed
 */
-/* enable_if to avoid clash with overloaded function below */
-template<class T, class ...U> typename std::enable_if<!std::is_same<T, Mesh>::value, Containers::Array<char>>::type
+/* enable_if to avoid clash with overloaded functions below */
+template<class T, class ...U> typename std::enable_if<!std::is_same<T, Mesh>::value && !std::is_same<T, Buffer>::value && !std::is_same<T, ExecutionPolicy>::value, Containers::Array<char>>::type
     interleave(const T& first, const U&... next)
 {
     /* Compute buffer size and stride */
@@ -178,6 +220,98 @@ template<class T, class ...U> void interleaveInto(Containers::ArrayReference<cha
     Implementation::writeInterleaved(stride, buffer.begin(), first, next...);
 }
 
+/**
+@brief Interleave vertex attributes using given execution policy
+
+Same as @ref interleave(const T&, const U&...), but the vertices are split
+into ranges interleaved according to @p policy. Expects that the attribute
+arrays have random access using `operator[]`, such as `std::vector` or
+@ref Trade::StridedArrayReference.
+*/
+template<class T, class ...U> Containers::Array<char> interleave(const ExecutionPolicy& policy, const T& first, const U&... next) {
+    const std::size_t attributeCount = Implementation::AttributeCount{}(first, next...);
+    const std::size_t stride = Implementation::Stride{}(first, next...);
+    if(!attributeCount || attributeCount == ~std::size_t(0)) return nullptr;
+
+    Containers::Array<char> data = Containers::Array<char>::zeroInitialized(attributeCount*stride);
+    char* const out = data.begin();
+    policy.parallelFor(attributeCount, [&](const std::size_t begin, const std::size_t end) {
+        Implementation::writeInterleavedRange(stride, out, begin, end, first, next...);
+    });
+
+    return data;
+}
+
+/**
+@brief Interleave vertex attributes into existing buffer using given execution policy
+
+Same as @ref interleaveInto(Containers::ArrayReference<char>, const T&, const U&...),
+but the vertices are split into ranges interleaved according to @p policy.
+The attribute arrays are expected to have random access, see
+@ref interleave(const ExecutionPolicy&, const T&, const U&...).
+*/
+template<class T, class ...U> void interleaveInto(const ExecutionPolicy& policy, Containers::ArrayReference<char> buffer, const T& first, const U&... next) {
+    const std::size_t attributeCount = Implementation::AttributeCount{}(first, next...);
+    const std::size_t stride = Implementation::Stride{}(first, next...);
+    CORRADE_ASSERT(attributeCount*stride <= buffer.size(), "MeshTools::interleaveInto(): the data buffer is too small, expected" << attributeCount*stride << "but got" << buffer.size(), );
+
+    char* const out = buffer.begin();
+    policy.parallelFor(attributeCount, [&](const std::size_t begin, const std::size_t end) {
+        Implementation::writeInterleavedRange(stride, out, begin, end, first, next...);
+    });
+}
+
+/**
+@brief Interleave vertex attributes directly into a buffer
+@param buffer       Output vertex buffer
+@param usage        Vertex buffer usage
+@param attributes   Attribute arrays and gaps
+@return Vertex count
+
+Unlike @ref interleave(const T&, const U&...) followed by
+@ref Buffer::setData() this function doesn't create any temporary array.
+The buffer storage is allocated to fit the interleaved data, mapped with
+@ref Buffer::MapFlag::Write and @ref Buffer::MapFlag::InvalidateBuffer and
+the attributes are written directly into the mapped memory. Example usage:
+@code
+std::vector<Vector3> positions;
+std::vector<Vector2> textureCoordinates;
+
+Buffer vertexBuffer;
+Mesh mesh;
+mesh.setCount(MeshTools::interleave(vertexBuffer, BufferUsage::StaticDraw, positions, textureCoordinates))
+    .addVertexBuffer(vertexBuffer, 0, MyShader::Position{}, MyShader::TextureCoordinates{});
+@endcode
+
+Similarly to @ref interleaveInto(), the gaps are left uninitialized. If
+@extension{ARB,map_buffer_range} (part of OpenGL 3.0) or
+@es_extension{EXT,map_buffer_range} in OpenGL ES 2.0 is not available or the
+buffer contents get corrupted during unmapping, the data are interleaved into
+a temporary array and uploaded using @ref Buffer::setData() instead.
+
+@attention Similarly to @ref interleave(), this function expects that all
+    arrays have the same size.
+*/
+template<class ...T> std::size_t interleave(Buffer& buffer, BufferUsage usage, const T&... attributes) {
+    const std::size_t attributeCount = Implementation::AttributeCount{}(attributes...);
+    const std::size_t stride = Implementation::Stride{}(attributes...);
+
+    /* Nothing to upload */
+    if(!attributeCount || attributeCount == ~std::size_t(0)) {
+        buffer.setData({nullptr, 0}, usage);
+        return 0;
+    }
+
+    /* Write the data directly to the mapped buffer, fall back to a copy if
+       mapping is not possible */
+    char* const data = Implementation::mapInterleaved(buffer, attributeCount*stride, usage);
+    if(data) Implementation::writeInterleaved(stride, data, attributes...);
+    if(!data || !buffer.unmap())
+        buffer.setData(interleave(attributes...), usage);
+
+    return attributeCount;
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 /**
 @brief Interleave vertex attributes, write them to array buffer and configure the mesh
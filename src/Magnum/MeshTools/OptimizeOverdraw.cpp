@@ -0,0 +1,142 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OptimizeOverdraw.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+void optimizeOverdraw(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::optimizeOverdraw(): index count is not divisible by 3", );
+    CORRADE_ASSERT(cacheSize, "MeshTools::optimizeOverdraw(): cache size can't be zero", );
+    CORRADE_ASSERT(threshold >= 1.0f, "MeshTools::optimizeOverdraw(): expected threshold not less than 1.0 but got" << threshold, );
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    /* FIFO cache simulation, the same as in analyzeVertexCache(). Increasing
+       the time by more than cache size flushes it. */
+    std::vector<std::size_t> timestamp(positions.size());
+    std::size_t time = cacheSize + 1;
+    const auto misses = [&](const std::size_t triangle) {
+        UnsignedInt count = 0;
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt v = indices[triangle*3 + i];
+            if(time - timestamp[v] > cacheSize) {
+                timestamp[v] = time++;
+                ++count;
+            }
+        }
+        return count;
+    };
+
+    #ifndef CORRADE_NO_ASSERT
+    for(const UnsignedInt index: indices)
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::optimizeOverdraw(): index" << index << "out of range for" << positions.size() << "vertices", );
+    #endif
+
+    /* Hard boundaries are at triangles that miss all three vertices,
+       clusters are described by their first triangle */
+    std::vector<std::size_t> hardClusters;
+    for(std::size_t i = 0; i != triangleCount; ++i)
+        if(misses(i) == 3 || i == 0) hardClusters.push_back(i);
+    hardClusters.push_back(triangleCount);
+
+    /* Split each hard cluster further while its cache miss ratio is good
+       enough. Each new cluster starts with a flushed cache. */
+    std::vector<std::size_t> clusters;
+    for(std::size_t c = 0; c + 1 < hardClusters.size(); ++c) {
+        const std::size_t begin = hardClusters[c];
+        const std::size_t end = hardClusters[c + 1];
+
+        time += cacheSize + 1;
+        std::size_t clusterMisses = 0;
+        for(std::size_t i = begin; i != end; ++i) clusterMisses += misses(i);
+        const Float limit = threshold*clusterMisses/(end - begin);
+
+        clusters.push_back(begin);
+        time += cacheSize + 1;
+        std::size_t subclusterBegin = begin, subclusterMisses = 0;
+        for(std::size_t i = begin; i != end; ++i) {
+            subclusterMisses += misses(i);
+            if(i + 1 != end && Float(subclusterMisses)/(i + 1 - subclusterBegin) <= limit) {
+                clusters.push_back(i + 1);
+                subclusterBegin = i + 1;
+                subclusterMisses = 0;
+                time += cacheSize + 1;
+            }
+        }
+    }
+    clusters.push_back(triangleCount);
+
+    /* Mesh centroid */
+    Vector3 meshCentroid;
+    for(const UnsignedInt index: indices) meshCentroid += positions[index];
+    meshCentroid /= Float(indices.size());
+
+    /* Sort key for each cluster -- how much is the area-weighted cluster
+       normal pointing away from the mesh center */
+    const std::size_t clusterCount = clusters.size() - 1;
+    std::vector<Float> sortKey(clusterCount);
+    for(std::size_t cluster = 0; cluster != clusterCount; ++cluster) {
+        Vector3 centroid, normal;
+        Float area = 0.0f;
+        for(std::size_t i = clusters[cluster]; i != clusters[cluster + 1]; ++i) {
+            const Vector3& a = positions[indices[i*3]];
+            const Vector3& b = positions[indices[i*3 + 1]];
+            const Vector3& c = positions[indices[i*3 + 2]];
+            const Vector3 n = Math::cross(b - a, c - a);
+            const Float triangleArea = n.length();
+            centroid += (a + b + c)*triangleArea/3.0f;
+            normal += n;
+            area += triangleArea;
+        }
+
+        if(area == 0.0f || normal.isZero()) continue;
+        sortKey[cluster] = Math::dot(centroid/area - meshCentroid, normal.normalized());
+    }
+
+    std::vector<UnsignedInt> order(clusterCount);
+    for(std::size_t i = 0; i != clusterCount; ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&sortKey](UnsignedInt a, UnsignedInt b) {
+        return sortKey[a] > sortKey[b];
+    });
+
+    /* Write the clusters in new order */
+    std::vector<UnsignedInt> outputIndices;
+    outputIndices.reserve(indices.size());
+    for(const UnsignedInt c: order)
+        outputIndices.insert(outputIndices.end(), indices.begin() + clusters[c]*3, indices.begin() + clusters[c + 1]*3);
+
+    /* Swap original index buffer with optimized */
+    using std::swap;
+    swap(indices, outputIndices);
+}
+
+}}
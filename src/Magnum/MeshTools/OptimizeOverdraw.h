@@ -0,0 +1,65 @@
+#ifndef Magnum_MeshTools_OptimizeOverdraw_h
+#define Magnum_MeshTools_OptimizeOverdraw_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeOverdraw()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Reorder triangle clusters to reduce overdraw
+@param[in,out] indices  Indices array to operate on
+@param[in] positions    Vertex positions
+@param[in] cacheSize    Post-transform vertex cache size
+@param[in] threshold    How much the vertex cache efficiency can degrade
+
+Splits the index array into clusters of triangles that are good for
+post-transform vertex cache and sorts the clusters so the ones facing outwards
+from the mesh center, i.e. the likely occluders, are drawn first. Cluster
+boundaries are first placed where the simulated FIFO cache is flushed anyway
+and then each cluster is split further as long as its average cache miss ratio
+doesn't get worse than @p threshold times the original. Larger @p threshold
+thus means less overdraw at the cost of more vertex shader invocations. The
+index array is expected to be already optimized using @ref tipsify() or
+@ref optimizeVertexCache(), which put the hard boundaries to reasonable places.
+Algorithm used: *Pedro V. Sander, Diego Nehab, and Joshua Barczak - Fast
+Triangle Reordering for Vertex Locality and Reduced Overdraw, SIGGRAPH 2007,
+http://gfx.cs.princeton.edu/pubs/Sander_2007_%3ETR/index.php*. Expects that
+index count is divisible by 3, all indices are less than size of @p positions,
+@p cacheSize is not zero and @p threshold is not less than `1.0`.
+*/
+void MAGNUM_MESHTOOLS_EXPORT optimizeOverdraw(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, std::size_t cacheSize, Float threshold = 1.05f);
+
+}}
+
+#endif
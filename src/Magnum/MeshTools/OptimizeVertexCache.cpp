@@ -0,0 +1,175 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OptimizeVertexCache.h"
+
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Constants from the paper */
+constexpr Float CacheDecayPower = 1.5f;
+constexpr Float LastTriangleScore = 0.75f;
+constexpr Float ValenceBoostScale = 2.0f;
+constexpr Float ValenceBoostPower = 0.5f;
+
+constexpr UnsignedInt NotInCache = ~UnsignedInt{};
+
+Float vertexScore(const UnsignedInt cachePosition, const std::size_t cacheSize, const UnsignedInt liveTriangleCount) {
+    /* No triangles left, the vertex is not interesting anymore */
+    if(!liveTriangleCount) return -1.0f;
+
+    Float score = 0.0f;
+    if(cachePosition != NotInCache) {
+        /* Vertices of the last triangle have fixed score, so it doesn't
+           matter which of them is used next */
+        if(cachePosition < 3) score = LastTriangleScore;
+        else score = std::pow(1.0f - Float(cachePosition - 3)/(cacheSize - 3), CacheDecayPower);
+    }
+
+    /* Bonus for vertices with only few triangles left to get rid of them
+       quickly */
+    return score + ValenceBoostScale*std::pow(Float(liveTriangleCount), -ValenceBoostPower);
+}
+
+}
+
+void optimizeVertexCache(std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::optimizeVertexCache(): index count is not divisible by 3", );
+    CORRADE_ASSERT(cacheSize > 3, "MeshTools::optimizeVertexCache(): expected cache size larger than 3 but got" << cacheSize, );
+
+    const std::size_t triangleCount = indices.size()/3;
+
+    /* Vertex-triangle adjacency, the same as in tipsify(). Triangles of i-th
+       vertex are in neighbors[neighborOffset[i]] ; neighbors[neighborOffset[i]
+       + liveTriangleCount[i]], emitted triangles are removed from the list. */
+    std::vector<UnsignedInt> liveTriangleCount(vertexCount);
+    for(const UnsignedInt index: indices) {
+        CORRADE_ASSERT(index < vertexCount, "MeshTools::optimizeVertexCache(): index" << index << "out of range for" << vertexCount << "vertices", );
+        ++liveTriangleCount[index];
+    }
+    std::vector<UnsignedInt> neighborOffset(vertexCount + 1);
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        neighborOffset[i + 1] = neighborOffset[i] + liveTriangleCount[i];
+    std::vector<UnsignedInt> neighbors(indices.size());
+    {
+        std::vector<UnsignedInt> fill(neighborOffset.begin(), neighborOffset.end() - 1);
+        for(std::size_t i = 0; i != indices.size(); ++i)
+            neighbors[fill[indices[i]]++] = i/3;
+    }
+
+    /* Initial vertex scores */
+    std::vector<UnsignedInt> cachePosition(vertexCount, NotInCache);
+    std::vector<Float> score(vertexCount);
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        score[i] = vertexScore(NotInCache, cacheSize, liveTriangleCount[i]);
+    const auto triangleScore = [&](const std::size_t triangle) {
+        return score[indices[triangle*3]] + score[indices[triangle*3 + 1]] + score[indices[triangle*3 + 2]];
+    };
+    std::vector<bool> emitted(triangleCount);
+
+    /* LRU cache, with space for vertices of one more triangle */
+    std::vector<UnsignedInt> cache, newCache;
+    cache.reserve(cacheSize + 3);
+    newCache.reserve(cacheSize + 3);
+
+    std::vector<UnsignedInt> outputIndices;
+    outputIndices.reserve(indices.size());
+
+    /* Start with the best triangle */
+    std::size_t best = 0;
+    for(std::size_t i = 1; i < triangleCount; ++i)
+        if(triangleScore(i) > triangleScore(best)) best = i;
+
+    /* Cursor for finding next triangle when there is no candidate in cache */
+    std::size_t cursor = 0;
+    while(best != triangleCount) {
+        emitted[best] = true;
+
+        /* Emit the triangle, remove it from adjacency of its vertices and put
+           the vertices to front of the cache */
+        newCache.clear();
+        for(std::size_t i = 0; i != 3; ++i) {
+            const UnsignedInt v = indices[best*3 + i];
+            outputIndices.push_back(v);
+
+            UnsignedInt* const begin = neighbors.data() + neighborOffset[v];
+            UnsignedInt* const end = begin + liveTriangleCount[v];
+            for(UnsignedInt* t = begin; t != end; ++t) if(*t == best) {
+                *t = *(end - 1);
+                break;
+            }
+            --liveTriangleCount[v];
+
+            newCache.push_back(v);
+        }
+        for(const UnsignedInt v: cache)
+            if(v != newCache[0] && v != newCache[1] && v != newCache[2])
+                newCache.push_back(v);
+
+        /* Vertices that fell out of the cache */
+        for(std::size_t i = cacheSize; i < newCache.size(); ++i) {
+            const UnsignedInt v = newCache[i];
+            cachePosition[v] = NotInCache;
+            score[v] = vertexScore(NotInCache, cacheSize, liveTriangleCount[v]);
+        }
+        if(newCache.size() > cacheSize) newCache.resize(cacheSize);
+        std::swap(cache, newCache);
+
+        /* Update scores of vertices in the cache and of their triangles */
+        for(std::size_t i = 0; i != cache.size(); ++i) {
+            cachePosition[cache[i]] = i;
+            score[cache[i]] = vertexScore(i, cacheSize, liveTriangleCount[cache[i]]);
+        }
+
+        /* Pick the best triangle from those touching the cache */
+        best = triangleCount;
+        Float bestScore = -1.0f;
+        for(const UnsignedInt v: cache) {
+            for(UnsignedInt* t = neighbors.data() + neighborOffset[v], *end = t + liveTriangleCount[v]; t != end; ++t) {
+                const Float s = triangleScore(*t);
+                if(s > bestScore) {
+                    best = *t;
+                    bestScore = s;
+                }
+            }
+        }
+
+        /* Dead end, continue with the first remaining triangle */
+        if(best == triangleCount) {
+            while(cursor != triangleCount && emitted[cursor]) ++cursor;
+            best = cursor;
+        }
+    }
+
+    /* Swap original index buffer with optimized */
+    using std::swap;
+    swap(indices, outputIndices);
+}
+
+}}
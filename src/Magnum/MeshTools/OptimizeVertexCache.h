@@ -0,0 +1,61 @@
+#ifndef Magnum_MeshTools_OptimizeVertexCache_h
+#define Magnum_MeshTools_OptimizeVertexCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeVertexCache()
+ */
+
+#include <vector>
+
+#include "Magnum/Types.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Optimize the mesh for post-transform vertex cache
+@param[in,out] indices  Indices array to operate on
+@param[in] vertexCount  Vertex count
+@param[in] cacheSize    Size of simulated LRU cache
+
+Alternative to @ref tipsify() which reorders the triangles greedily based on
+vertex scores computed from their position in a simulated LRU cache and count
+of their remaining triangles. It is slower than @ref tipsify() and doesn't
+reach its efficiency if the exact hardware cache size is known, but it gives
+good results across wide range of cache sizes, so the default is usually good
+enough. Algorithm used: *Tom
+Forsyth - Linear-Speed Vertex Cache Optimisation, 2006,
+https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html*. Expects that
+index count is divisible by 3, all indices are less than @p vertexCount and
+@p cacheSize is larger than `3`. Use @ref analyzeVertexCache() to measure the
+result.
+*/
+void MAGNUM_MESHTOOLS_EXPORT optimizeVertexCache(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize = 32);
+
+}}
+
+#endif
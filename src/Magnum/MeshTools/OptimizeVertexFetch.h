@@ -0,0 +1,98 @@
+#ifndef Magnum_MeshTools_OptimizeVertexFetch_h
+#define Magnum_MeshTools_OptimizeVertexFetch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeVertexFetch()
+ */
+
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace Implementation {
+    inline void remapAttributes(const std::vector<UnsignedInt>&, std::size_t) {}
+    template<class T, class ...U> void remapAttributes(const std::vector<UnsignedInt>& remap, const std::size_t vertexCount, std::vector<T>& first, std::vector<U>&... next) {
+        std::vector<T> output(vertexCount);
+        for(std::size_t i = 0; i != first.size(); ++i)
+            if(remap[i] != ~UnsignedInt{}) output[remap[i]] = first[i];
+        using std::swap;
+        swap(output, first);
+
+        remapAttributes(remap, vertexCount, next...);
+    }
+}
+
+/**
+@brief Reorder vertices for better vertex fetch locality
+@param[in,out] indices      Indices array to operate on
+@param[in,out] attribute    Vertex attribute array
+@param[in,out] attributes   Other vertex attribute arrays
+@return Count of resulting vertices
+
+Reorders vertex data in order in which they are first referenced by the index
+array, so the vertex fetch accesses the memory mostly sequentially, and updates
+the index array accordingly. Vertices that are not referenced are removed. This
+should be done after reordering the triangles using @ref tipsify(),
+@ref optimizeVertexCache() or @ref optimizeOverdraw(). All attribute arrays
+are reordered the same way:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+std::vector<Vector3> normals;
+
+MeshTools::optimizeVertexCache(indices, positions.size());
+MeshTools::optimizeVertexFetch(indices, positions, normals);
+@endcode
+
+Expects that all attribute arrays have the same size and that all indices are
+in range.
+*/
+template<class T, class ...U> std::size_t optimizeVertexFetch(std::vector<UnsignedInt>& indices, std::vector<T>& attribute, std::vector<U>&... attributes) {
+    #ifndef CORRADE_NO_ASSERT
+    for(const std::size_t size: {attribute.size(), attributes.size()...})
+        CORRADE_ASSERT(size == attribute.size(), "MeshTools::optimizeVertexFetch(): expected" << attribute.size() << "items in all attribute arrays but got" << size, {});
+    #endif
+
+    /* New position of each vertex */
+    std::vector<UnsignedInt> remap(attribute.size(), ~UnsignedInt{});
+    UnsignedInt vertexCount = 0;
+    for(UnsignedInt& index: indices) {
+        CORRADE_ASSERT(index < attribute.size(), "MeshTools::optimizeVertexFetch(): index" << index << "out of range for" << attribute.size() << "vertices", {});
+        if(remap[index] == ~UnsignedInt{}) remap[index] = vertexCount++;
+        index = remap[index];
+    }
+
+    Implementation::remapAttributes(remap, vertexCount, attribute, attributes...);
+    return vertexCount;
+}
+
+}}
+
+#endif
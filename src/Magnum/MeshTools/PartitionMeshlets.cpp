@@ -0,0 +1,234 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PartitionMeshlets.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/MeshView.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Spread lower ten bits of the value so there are two zero bits between
+   each */
+UnsignedInt spreadBits(UnsignedInt value) {
+    value &= 0x3ff;
+    value = (value | (value << 16)) & 0x030000ff;
+    value = (value | (value << 8)) & 0x0300f00f;
+    value = (value | (value << 4)) & 0x030c30c3;
+    value = (value | (value << 2)) & 0x09249249;
+    return value;
+}
+
+}
+
+std::vector<Meshlet> partitionMeshlets(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt maxVertices, const UnsignedInt maxTriangles) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::partitionMeshlets(): index count is not divisible by 3", {});
+    CORRADE_ASSERT(maxVertices >= 3 && maxTriangles, "MeshTools::partitionMeshlets(): expected at least 3 vertices and one triangle per meshlet but got" << maxVertices << "and" << maxTriangles, {});
+
+    #ifndef CORRADE_NO_ASSERT
+    for(const UnsignedInt index: indices)
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::partitionMeshlets(): index" << index << "out of range for" << positions.size() << "vertices", {});
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return {};
+
+    /* Triangle centers and bounds of the whole mesh */
+    std::vector<Vector3> centers(triangleCount);
+    Vector3 min{std::numeric_limits<Float>::max()}, max{-std::numeric_limits<Float>::max()};
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        centers[i] = (positions[indices[i*3]] + positions[indices[i*3 + 1]] + positions[indices[i*3 + 2]])/3.0f;
+        min = Math::min(min, centers[i]);
+        max = Math::max(max, centers[i]);
+    }
+
+    /* Seeds are taken in Morton order of the triangle centers, so consecutive
+       meshlets are close to each other */
+    std::vector<UnsignedInt> seeds(triangleCount);
+    {
+        const Vector3 size = max - min;
+        const Float scale = 1023.0f/Math::max(Math::max(size.x(), size.y()), Math::max(size.z(), std::numeric_limits<Float>::min()));
+        std::vector<UnsignedInt> codes(triangleCount);
+        for(std::size_t i = 0; i != triangleCount; ++i) {
+            const Vector3 p = (centers[i] - min)*scale;
+            codes[i] = spreadBits(UnsignedInt(p.x())) | (spreadBits(UnsignedInt(p.y())) << 1) | (spreadBits(UnsignedInt(p.z())) << 2);
+            seeds[i] = i;
+        }
+        std::stable_sort(seeds.begin(), seeds.end(), [&codes](UnsignedInt a, UnsignedInt b) {
+            return codes[a] < codes[b];
+        });
+    }
+
+    /* Vertex-to-triangle adjacency, triangles using vertex `v` are in range
+       [offsets[v], offsets[v + 1]) */
+    std::vector<UnsignedInt> offsets(positions.size() + 1);
+    for(const UnsignedInt index: indices) ++offsets[index + 1];
+    for(std::size_t i = 1; i != offsets.size(); ++i) offsets[i] += offsets[i - 1];
+    std::vector<UnsignedInt> adjacency(indices.size());
+    {
+        std::vector<UnsignedInt> position{offsets.begin(), offsets.end() - 1};
+        for(std::size_t i = 0; i != indices.size(); ++i)
+            adjacency[position[indices[i]]++] = i/3;
+    }
+
+    std::vector<bool> assigned(triangleCount);
+    /* ID of the last meshlet which used given vertex, offset by one so zero
+       means none */
+    std::vector<UnsignedInt> vertexMeshlet(positions.size());
+    /* ID of the last meshlet which had given triangle as a candidate */
+    std::vector<UnsignedInt> triangleMeshlet(triangleCount);
+
+    std::vector<UnsignedInt> out;
+    out.reserve(indices.size());
+    std::vector<Meshlet> meshlets;
+    std::vector<UnsignedInt> candidates;
+    std::vector<UnsignedInt> meshletVertices;
+
+    for(const UnsignedInt seed: seeds) {
+        if(assigned[seed]) continue;
+
+        const UnsignedInt id = meshlets.size() + 1;
+        const UnsignedInt indexOffset = out.size();
+        UnsignedInt triangles = 0;
+        Vector3 centerSum;
+        candidates.assign(1, seed);
+        triangleMeshlet[seed] = id;
+        meshletVertices.clear();
+
+        while(triangles != maxTriangles) {
+            /* Pick the candidate adding least new vertices, the one closest
+               to the current meshlet center in case of a tie */
+            const Vector3 center = triangles ? centerSum/Float(triangles) : centers[seed];
+            std::size_t best = ~std::size_t{};
+            UnsignedInt bestNewVertices = 4;
+            Float bestDistance = 0.0f;
+            for(std::size_t i = 0; i < candidates.size(); ++i) {
+                /* Remove candidates assigned meanwhile */
+                const UnsignedInt t = candidates[i];
+                if(assigned[t]) {
+                    candidates[i--] = candidates.back();
+                    candidates.pop_back();
+                    continue;
+                }
+
+                UnsignedInt newVertices = 0;
+                for(std::size_t j = 0; j != 3; ++j)
+                    if(vertexMeshlet[indices[t*3 + j]] != id) ++newVertices;
+                if(meshletVertices.size() + newVertices > maxVertices) continue;
+
+                const Float distance = (centers[t] - center).dot();
+                if(newVertices < bestNewVertices || (newVertices == bestNewVertices && distance < bestDistance)) {
+                    best = i;
+                    bestNewVertices = newVertices;
+                    bestDistance = distance;
+                }
+            }
+
+            if(best == ~std::size_t{}) break;
+
+            /* Add the triangle and its neighbors as new candidates */
+            const UnsignedInt t = candidates[best];
+            candidates[best] = candidates.back();
+            candidates.pop_back();
+            assigned[t] = true;
+            ++triangles;
+            centerSum += centers[t];
+            for(std::size_t j = 0; j != 3; ++j) {
+                const UnsignedInt v = indices[t*3 + j];
+                out.push_back(v);
+                if(vertexMeshlet[v] != id) {
+                    vertexMeshlet[v] = id;
+                    meshletVertices.push_back(v);
+                }
+                for(UnsignedInt k = offsets[v]; k != offsets[v + 1]; ++k) {
+                    const UnsignedInt neighbor = adjacency[k];
+                    if(assigned[neighbor] || triangleMeshlet[neighbor] == id) continue;
+                    triangleMeshlet[neighbor] = id;
+                    candidates.push_back(neighbor);
+                }
+            }
+        }
+
+        /* Bounding sphere around center of the vertex bounding box */
+        Meshlet meshlet;
+        meshlet.indexOffset = indexOffset;
+        meshlet.indexCount = out.size() - indexOffset;
+        meshlet.vertexStart = *std::min_element(meshletVertices.begin(), meshletVertices.end());
+        meshlet.vertexEnd = *std::max_element(meshletVertices.begin(), meshletVertices.end());
+        Vector3 vertexMin{positions[meshletVertices[0]]}, vertexMax{positions[meshletVertices[0]]};
+        for(const UnsignedInt v: meshletVertices) {
+            vertexMin = Math::min(vertexMin, positions[v]);
+            vertexMax = Math::max(vertexMax, positions[v]);
+        }
+        meshlet.center = (vertexMin + vertexMax)*0.5f;
+        meshlet.radius = 0.0f;
+        for(const UnsignedInt v: meshletVertices)
+            meshlet.radius = Math::max(meshlet.radius, (positions[v] - meshlet.center).length());
+
+        /* Normal cone from the average normal and the largest deviation from
+           it */
+        std::vector<Vector3> normals;
+        normals.reserve(triangles);
+        Vector3 axis;
+        for(UnsignedInt i = meshlet.indexOffset; i != out.size(); i += 3) {
+            const Vector3 normal = Math::cross(positions[out[i + 1]] - positions[out[i]], positions[out[i + 2]] - positions[out[i]]);
+            const Float length = normal.length();
+            if(length == 0.0f) continue;
+            normals.push_back(normal/length);
+            axis += normals.back();
+        }
+        const Float axisLength = axis.length();
+        meshlet.coneAxis = axisLength != 0.0f ? axis/axisLength : Vector3{};
+        Float minDot = 1.0f;
+        for(const Vector3& normal: normals)
+            minDot = Math::min(minDot, Math::dot(normal, meshlet.coneAxis));
+        meshlet.coneCutoff = minDot <= 0.0f ? 1.0f : std::sqrt(1.0f - minDot*minDot);
+
+        meshlets.push_back(meshlet);
+    }
+
+    indices = std::move(out);
+    return meshlets;
+}
+
+std::vector<MeshView> meshletViews(Mesh& mesh, const std::vector<Meshlet>& meshlets) {
+    std::vector<MeshView> views;
+    views.reserve(meshlets.size());
+    for(const Meshlet& meshlet: meshlets) {
+        views.emplace_back(mesh);
+        views.back().setCount(meshlet.indexCount)
+            .setIndexRange(meshlet.indexOffset, meshlet.vertexStart, meshlet.vertexEnd);
+    }
+    return views;
+}
+
+}}
@@ -0,0 +1,141 @@
+#ifndef Magnum_MeshTools_PartitionMeshlets_h
+#define Magnum_MeshTools_PartitionMeshlets_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::Meshlet, function @ref Magnum::MeshTools::partitionMeshlets(), @ref Magnum::MeshTools::meshletViews()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Meshlet
+
+Contiguous range of the index array produced by @ref partitionMeshlets()
+together with its bounds.
+@see @ref meshletViews()
+*/
+struct Meshlet {
+    /** @brief Offset of the first index */
+    UnsignedInt indexOffset;
+
+    /** @brief Index count */
+    UnsignedInt indexCount;
+
+    /** @brief Minimal vertex index referenced by the meshlet */
+    UnsignedInt vertexStart;
+
+    /** @brief Maximal vertex index referenced by the meshlet */
+    UnsignedInt vertexEnd;
+
+    /** @brief Bounding sphere center */
+    Vector3 center;
+
+    /** @brief Bounding sphere radius */
+    Float radius;
+
+    /**
+     * @brief Normal cone axis
+     *
+     * Normalized average of the triangle normals, zero if the triangles
+     * face all directions.
+     */
+    Vector3 coneAxis;
+
+    /**
+     * @brief Normal cone cutoff
+     *
+     * Sine of the largest angle between @ref coneAxis and any triangle
+     * normal, `1.0` if the angle is larger than 90°, in which case the
+     * meshlet can't be backface-culled.
+     * @see @ref isBackfacing()
+     */
+    Float coneCutoff;
+
+    /**
+     * @brief Whether the meshlet is backfacing
+     * @param cameraPosition    Camera position in the same coordinate
+     *      system as the meshlet
+     *
+     * Returns `true` if all triangles of the meshlet are guaranteed to be
+     * facing away from the camera and the whole meshlet can be culled.
+     */
+    bool isBackfacing(const Vector3& cameraPosition) const {
+        const Vector3 direction = center - cameraPosition;
+        return Math::dot(direction, coneAxis) >= coneCutoff*direction.length() + radius;
+    }
+};
+
+/**
+@brief Partition triangle mesh into meshlets
+@param[in,out] indices  Indices array to operate on
+@param[in] positions    Vertex positions
+@param[in] maxVertices  Max vertex count in one meshlet
+@param[in] maxTriangles Max triangle count in one meshlet
+@return Meshlets, in order in which they are in the reordered index array
+
+Splits the mesh into spatially coherent clusters of connected triangles so
+culling and level of detail selection can be done per cluster instead of for
+the whole mesh. The triangles are reordered so each meshlet is a contiguous
+range of @p indices, the vertices are not touched, so all meshlets share the
+same vertex buffer. Each meshlet starts from first unassigned triangle in
+Morton order of triangle centers and grows by adding adjacent triangles that
+add the least new vertices, preferring the ones closest to the meshlet
+center, until either of the limits is reached. The defaults are suitable for
+most GPUs. For each meshlet a bounding sphere and a normal cone is computed,
+see @ref Meshlet::isBackfacing() for how to use it for culling. Expects that
+index count is divisible by 3, all indices are less than size of
+@p positions, @p maxVertices is at least `3` and @p maxTriangles is not zero.
+
+Call @ref optimizeVertexCache() on the meshlet ranges and
+@ref optimizeVertexFetch() on the result afterwards for better memory
+locality.
+@see @ref meshletViews()
+*/
+std::vector<Meshlet> MAGNUM_MESHTOOLS_EXPORT partitionMeshlets(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt maxVertices = 64, UnsignedInt maxTriangles = 124);
+
+/**
+@brief Create mesh views for meshlets
+@param mesh         Indexed mesh containing the reordered index buffer
+@param meshlets     Meshlets returned by @ref partitionMeshlets()
+
+Creates one @ref MeshView for each meshlet with the index range and count set
+up, so the meshlets that pass culling can be drawn separately or in one
+@ref MeshView::draw(AbstractShaderProgram&, Containers::ArrayReference<const std::reference_wrapper<MeshView>>) "MeshView::draw()"
+batch. Expects that the index buffer was created from the index array
+reordered by @ref partitionMeshlets().
+*/
+std::vector<MeshView> MAGNUM_MESHTOOLS_EXPORT meshletViews(Mesh& mesh, const std::vector<Meshlet>& meshlets);
+
+}}
+
+#endif
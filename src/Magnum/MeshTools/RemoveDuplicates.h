@@ -30,10 +30,8 @@
  */
 
 #include <limits>
-#include <numeric>
-#include <unordered_map>
 #include <vector>
-#include <Corrade/Utility/MurmurHash2.h>
+#include <Corrade/Utility/Assert.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Functions.h"
@@ -47,12 +45,137 @@
 namespace Magnum { namespace MeshTools {
 
 namespace Implementation {
-    template<std::size_t size> class VectorHash {
-        public:
-            std::size_t operator()(const Math::Vector<size, std::size_t>& data) const {
-                return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(&data), sizeof(data)).byteArray());
+    /* Spatial hash of a grid cell, the primes are from Teschner et al.,
+       Optimized Spatial Hashing for Collision Detection of Deformable
+       Objects */
+    template<std::size_t size> inline std::size_t cellHash(const Math::Vector<size, std::size_t>& cell) {
+        constexpr std::size_t Primes[]{73856093, 19349663, 83492791, 25165843};
+        std::size_t hash = 0;
+        for(std::size_t i = 0; i != size; ++i)
+            hash ^= cell[i]*Primes[i%4];
+        return hash ^ (hash >> 16);
+    }
+
+    inline bool attributesEqual(std::size_t, std::size_t) { return true; }
+    template<class T, class ...U> inline bool attributesEqual(const std::size_t a, const std::size_t b, const std::vector<T>& first, const std::vector<U>&... next) {
+        return first[a] == first[b] && attributesEqual(a, b, next...);
+    }
+
+    inline void moveAttributes(std::size_t, std::size_t) {}
+    template<class T, class ...U> inline void moveAttributes(const std::size_t to, const std::size_t from, std::vector<T>& first, std::vector<U>&... next) {
+        first[to] = first[from];
+        moveAttributes(to, from, next...);
+    }
+
+    inline void resizeAttributes(std::size_t) {}
+    template<class T, class ...U> inline void resizeAttributes(const std::size_t size, std::vector<T>& first, std::vector<U>&... next) {
+        first.resize(size);
+        resizeAttributes(size, next...);
+    }
+
+    template<class Vector, class ...T> std::vector<UnsignedInt> removeDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon, std::vector<T>&... attributes) {
+        typedef Math::Vector<Vector::Size, std::size_t> Cell;
+        struct Slot {
+            Cell cell;
+            UnsignedInt index;
+        };
+
+        std::vector<UnsignedInt> resultIndices;
+        if(data.empty()) return resultIndices;
+        resultIndices.reserve(data.size());
+
+        /* Get bounds */
+        Vector min = data[0], max = data[0];
+        for(const auto& v: data) {
+            min = Math::min(v, min);
+            max = Math::max(v, max);
+        }
+
+        /* Make epsilon so large that std::size_t can index all cells inside
+           the bounds, including the neighbors. */
+        epsilon = Math::max(epsilon, typename Vector::Type((max-min).max()/(std::numeric_limits<std::size_t>::max() - 1)));
+
+        /* Open-addressing hash table with linear probing, at most half full.
+           Each slot contains the cell and index of first unique vector in
+           it. With only one attribute there is at most one unique vector in
+           each cell, as all vectors in the cell are nearer than epsilon. */
+        std::size_t tableSize = 1;
+        while(tableSize < 2*data.size()) tableSize <<= 1;
+        const std::size_t tableMask = tableSize - 1;
+        constexpr UnsignedInt Empty = ~UnsignedInt{};
+        std::vector<Slot> table(tableSize, Slot{Cell{}, Empty});
+
+        /* Offsets of all 3^n neighbor cells, the cell itself first. Cells
+           are unsigned, so the offset -1 wraps around, but such cell is never
+           occupied. */
+        std::vector<Cell> neighbors{Cell{}};
+        for(std::size_t i = 0; i != Vector::Size; ++i) {
+            const std::size_t count = neighbors.size();
+            for(std::size_t j = 0; j != count; ++j) {
+                Cell neighbor = neighbors[j];
+                neighbor[i] = 1;
+                neighbors.push_back(neighbor);
+                neighbor[i] = ~std::size_t{};
+                neighbors.push_back(neighbor);
+            }
+        }
+
+        /* Single pass over the data, compacting unique vectors to the front
+           of the array */
+        UnsignedInt uniqueCount = 0;
+        for(std::size_t i = 0; i != data.size(); ++i) {
+            const Cell cell((data[i] - min)/epsilon);
+
+            /* Find first unique vector in the neighborhood that is nearer
+               than epsilon in each dimension and has the same attributes */
+            UnsignedInt found = Empty;
+            for(const Cell& offset: neighbors) {
+                const Cell neighbor = cell + offset;
+                for(std::size_t slot = cellHash(neighbor) & tableMask; table[slot].index != Empty; slot = (slot + 1) & tableMask) {
+                    if(table[slot].cell != neighbor) continue;
+
+                    const Vector& unique = data[table[slot].index];
+                    bool near = true;
+                    for(std::size_t c = 0; c != Vector::Size; ++c) {
+                        const typename Vector::Type d = unique[c] - data[i][c];
+                        if(d >= epsilon || -d >= epsilon) {
+                            near = false;
+                            break;
+                        }
+                    }
+
+                    if(near && attributesEqual(table[slot].index, i, attributes...)) {
+                        found = table[slot].index;
+                        break;
+                    }
+                }
+
+                if(found != Empty) break;
             }
-    };
+
+            if(found != Empty) {
+                resultIndices.push_back(found);
+                continue;
+            }
+
+            /* Not found, add new unique vector. Moving it to earlier position
+               doesn't affect any vector that's yet to be processed. */
+            std::size_t slot = cellHash(cell) & tableMask;
+            while(table[slot].index != Empty) slot = (slot + 1) & tableMask;
+            table[slot] = Slot{cell, uniqueCount};
+            if(i != uniqueCount) {
+                data[uniqueCount] = data[i];
+                moveAttributes(uniqueCount, i, attributes...);
+            }
+            resultIndices.push_back(uniqueCount++);
+        }
+
+        /* Shrink the data arrays */
+        data.resize(uniqueCount);
+        resizeAttributes(uniqueCount, attributes...);
+
+        return resultIndices;
+    }
 }
 
 /**
@@ -62,9 +185,13 @@ namespace Implementation {
     melt together
 @return Index array and unique data
 
-Removes duplicate data from the array by collapsing them into buckets of size
-@p epsilon. First vector in given bucket is used, other ones are thrown away,
-no interpolation is done. Note that this function is meant to be used for
+Removes duplicate data from the array by merging vectors that are nearer than
+@p epsilon in each dimension. First vector is used, other ones nearer to it are
+thrown away, no interpolation is done. The vectors are put into a spatial hash
+grid with cell size @p epsilon and only the cell of each vector and its
+immediate neighbors are searched, so the operation is done in a single pass in
+`O(n)` time on average and also vertices on the opposite sides of cell
+boundaries are merged. Note that this function is meant to be used for
 floating-point data (or generally with non-zero @p epsilon), for discrete data
 the usual sorting method is much more efficient.
 
@@ -97,70 +224,46 @@ std::vector<UnsignedInt> indices = MeshTools::combineIndexedArrays(
     std::make_pair(std::cref(texCoordIndices), std::ref(texCoords))
 );
 @endcode
-*/
-template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon = Math::TypeTraits<typename Vector::Type>::epsilon()) {
-    /* Get bounds */
-    Vector min = data[0], max = data[0];
-    for(const auto& v: data) {
-        min = Math::min(v, min);
-        max = Math::max(v, max);
-    }
-
-    /* Make epsilon so large that std::size_t can index all vectors inside the
-       bounds. */
-    epsilon = Math::max(epsilon, typename Vector::Type((max-min).max()/std::numeric_limits<std::size_t>::max()));
-
-    /* Resulting index array */
-    std::vector<UnsignedInt> resultIndices(data.size());
-    std::iota(resultIndices.begin(), resultIndices.end(), 0);
-
-    /* Table containing original vector index for each discretized vector.
-       Reserving more buckets than necessary (i.e. as if each vector was
-       unique). */
-    std::unordered_map<Math::Vector<Vector::Size, std::size_t>, UnsignedInt, Implementation::VectorHash<Vector::Size>> table(data.size());
-
-    /* Index array for each pass, new data array */
-    std::vector<UnsignedInt> indices;
-    indices.reserve(data.size());
-
-    /* First go with original coordinates, then move them by epsilon/2 in each
-       direction. */
-    Vector moved;
-    for(std::size_t moving = 0; moving <= Vector::Size; ++moving) {
-        /* Go through all vectors */
-        for(std::size_t i = 0; i != data.size(); ++i) {
-            /* Try to insert new vertex to the table */
-            const Math::Vector<Vector::Size, std::size_t> v((data[i] + moved - min)/epsilon);
-            const auto result = table.emplace(v, table.size());
-
-            /* Add the (either new or already existing) index to index array */
-            indices.push_back(result.first->second);
-
-            /* If this is new combination, copy the data to new (earlier)
-               possition in the array */
-            if(result.second && i != table.size()-1) data[table.size()-1] = data[i];
-        }
 
-        /* Shrink the data array */
-        CORRADE_INTERNAL_ASSERT(data.size() >= table.size());
-        data.resize(table.size());
-
-        /* Remap the resulting index array */
-        for(auto& i: resultIndices) i = indices[i];
+If all the arrays are not indexed and have the same size, use
+@ref removeDuplicates(std::vector<Vector>&, typename Vector::Type, std::vector<T>&, std::vector<U>&...)
+instead, which removes the duplicates in all of them at once.
+*/
+template<class Vector> inline std::vector<UnsignedInt> removeDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon = Math::TypeTraits<typename Vector::Type>::epsilon()) {
+    return Implementation::removeDuplicates(data, epsilon);
+}
 
-        /* Finished */
-        if(moving == Vector::Size) continue;
+/**
+@brief Remove duplicate vertices with multiple attributes
+@param[in,out] data         Input position data array
+@param[out] epsilon         Epsilon value, vertices nearer than this distance
+    will be melt together
+@param[in,out] attributes   Additional vertex attribute arrays
+@return Index array
+
+Like @ref removeDuplicates(std::vector<Vector>&, typename Vector::Type), but
+two vertices are merged only if also all additional attributes compare equal
+(i.e. with fuzzy comparison for floating-point types). The attribute arrays
+are compacted in the same way as @p data, so the returned index array is
+usable for all of them. Doing this in one pass is faster than removing
+duplicates in each array separately and combining the results afterwards:
+@code
+std::vector<Vector3> positions;
+std::vector<Vector3> normals;
+std::vector<Vector2> texCoords;
 
-        /* Move vertex coordinates by epsilon/2 in next direction */
-        moved = Vector();
-        moved[moving] = epsilon/2;
+std::vector<UnsignedInt> indices = MeshTools::removeDuplicates(positions, 1.0e-5f, normals, texCoords);
+@endcode
 
-        /* Clear the structures for next pass */
-        table.clear();
-        indices.clear();
-    }
+Expects that all attribute arrays have the same size as @p data.
+*/
+template<class Vector, class T, class ...U> std::vector<UnsignedInt> removeDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon, std::vector<T>& attribute, std::vector<U>&... attributes) {
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t size: {attribute.size(), attributes.size()...})
+        CORRADE_ASSERT(size == data.size(), "MeshTools::removeDuplicates(): expected" << data.size() << "items in all attribute arrays but got" << size, {});
+    #endif
 
-    return resultIndices;
+    return Implementation::removeDuplicates(data, epsilon, attribute, attributes...);
 }
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -0,0 +1,288 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Simplify.h"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <tuple>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Symmetric 4x4 matrix of the quadric, together with the accumulated area so
+   the error can be normalized to squared distance */
+struct Quadric {
+    Double a00, a01, a02, a11, a12, a22, b0, b1, b2, c, weight;
+
+    Quadric(): a00{}, a01{}, a02{}, a11{}, a12{}, a22{}, b0{}, b1{}, b2{}, c{}, weight{} {}
+
+    Quadric& operator+=(const Quadric& other) {
+        a00 += other.a00; a01 += other.a01; a02 += other.a02;
+        a11 += other.a11; a12 += other.a12; a22 += other.a22;
+        b0 += other.b0; b1 += other.b1; b2 += other.b2;
+        c += other.c;
+        weight += other.weight;
+        return *this;
+    }
+
+    void addPlane(const Math::Vector3<Double>& n, const Double d, const Double w) {
+        a00 += w*n.x()*n.x(); a01 += w*n.x()*n.y(); a02 += w*n.x()*n.z();
+        a11 += w*n.y()*n.y(); a12 += w*n.y()*n.z(); a22 += w*n.z()*n.z();
+        b0 += w*n.x()*d; b1 += w*n.y()*d; b2 += w*n.z()*d;
+        c += w*d*d;
+        weight += w;
+    }
+
+    Double error(const Vector3& point) const {
+        const Double x = point.x(), y = point.y(), z = point.z();
+        const Double e = a00*x*x + 2*a01*x*y + 2*a02*x*z + a11*y*y + 2*a12*y*z + a22*z*z + 2*(b0*x + b1*y + b2*z) + c;
+        return weight > 0.0 ? std::max(e, 0.0)/weight : 0.0;
+    }
+};
+
+struct Collapse {
+    Double cost;
+    UnsignedInt from, to;
+
+    bool operator<(const Collapse& other) const {
+        /* Inverted, so std::priority_queue has the cheapest on top */
+        return cost > other.cost;
+    }
+};
+
+}
+
+void simplify(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::size_t targetIndexCount, const Float maxError) {
+    CORRADE_ASSERT(indices.size() % 3 == 0, "MeshTools::simplify(): index count is not divisible by 3", );
+
+    #ifndef CORRADE_NO_ASSERT
+    for(const UnsignedInt index: indices)
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::simplify(): index" << index << "out of range for" << positions.size() << "vertices", );
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+    std::size_t liveTriangleCount = triangleCount;
+    if(liveTriangleCount*3 <= targetIndexCount) return;
+
+    /* Lock vertices that share position with other vertices, i.e. are on
+       texture coordinate or normal seams */
+    std::vector<bool> locked(positions.size());
+    {
+        std::vector<UnsignedInt> sorted(positions.size());
+        for(std::size_t i = 0; i != sorted.size(); ++i) sorted[i] = i;
+        const auto less = [&positions](UnsignedInt a, UnsignedInt b) {
+            return std::make_tuple(positions[a].x(), positions[a].y(), positions[a].z()) <
+                   std::make_tuple(positions[b].x(), positions[b].y(), positions[b].z());
+        };
+        std::sort(sorted.begin(), sorted.end(), less);
+        for(std::size_t i = 1; i < sorted.size(); ++i) if(positions[sorted[i - 1]] == positions[sorted[i]])
+            locked[sorted[i - 1]] = locked[sorted[i]] = true;
+    }
+
+    /* Lock vertices on open boundaries, i.e. on edges referenced by only one
+       triangle */
+    {
+        std::vector<std::pair<UnsignedInt, UnsignedInt>> edges;
+        edges.reserve(indices.size());
+        for(std::size_t i = 0; i != triangleCount; ++i) for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt a = indices[i*3 + j], b = indices[i*3 + (j + 1)%3];
+            edges.emplace_back(std::min(a, b), std::max(a, b));
+        }
+        std::sort(edges.begin(), edges.end());
+        for(std::size_t i = 0; i != edges.size(); ) {
+            std::size_t j = i + 1;
+            while(j != edges.size() && edges[j] == edges[i]) ++j;
+            if(j - i == 1) locked[edges[i].first] = locked[edges[i].second] = true;
+            i = j;
+        }
+    }
+
+    /* Per-vertex quadrics from area-weighted triangle planes and the list of
+       triangles around each vertex */
+    std::vector<Quadric> quadrics(positions.size());
+    std::vector<std::vector<UnsignedInt>> vertexTriangles(positions.size());
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        const Math::Vector3<Double> a{positions[indices[i*3]]},
+            b{positions[indices[i*3 + 1]]},
+            c{positions[indices[i*3 + 2]]};
+        const Math::Vector3<Double> normal = Math::cross(b - a, c - a);
+        const Double length = normal.length();
+
+        for(std::size_t j = 0; j != 3; ++j) {
+            vertexTriangles[indices[i*3 + j]].push_back(i);
+            if(length == 0.0) continue;
+            const Math::Vector3<Double> n = normal/length;
+            quadrics[indices[i*3 + j]].addPlane(n, -Math::dot(n, a), length*0.5);
+        }
+    }
+
+    std::vector<bool> triangleRemoved(triangleCount);
+    std::vector<bool> vertexRemoved(positions.size());
+
+    const auto cost = [&](UnsignedInt from, UnsignedInt to) {
+        Quadric q = quadrics[from];
+        q += quadrics[to];
+        return std::sqrt(q.error(positions[to]));
+    };
+
+    std::priority_queue<Collapse> queue;
+    const auto pushCollapse = [&](UnsignedInt from, UnsignedInt to) {
+        if(!locked[from]) queue.push({cost(from, to), from, to});
+    };
+    for(std::size_t i = 0; i != triangleCount; ++i) for(std::size_t j = 0; j != 3; ++j) {
+        const UnsignedInt a = indices[i*3 + j], b = indices[i*3 + (j + 1)%3];
+        pushCollapse(a, b);
+        pushCollapse(b, a);
+    }
+
+    while(liveTriangleCount*3 > targetIndexCount && !queue.empty()) {
+        const Collapse collapse = queue.top();
+        queue.pop();
+
+        const UnsignedInt from = collapse.from, to = collapse.to;
+        if(vertexRemoved[from] || vertexRemoved[to]) continue;
+
+        /* The quadrics only grow, so if the cost changed since the collapse
+           was queued, requeue it with the updated cost */
+        const Double currentCost = cost(from, to);
+        if(currentCost > collapse.cost) {
+            queue.push({currentCost, from, to});
+            continue;
+        }
+
+        if(currentCost > maxError) break;
+
+        /* Verify that the edge still exists and that no remaining triangle
+           gets flipped */
+        bool hasEdge = false, flips = false;
+        for(const UnsignedInt t: vertexTriangles[from]) {
+            if(triangleRemoved[t]) continue;
+
+            bool containsTo = false;
+            Vector3 before[3], after[3];
+            for(std::size_t j = 0; j != 3; ++j) {
+                const UnsignedInt v = indices[t*3 + j];
+                if(v == to) containsTo = true;
+                before[j] = positions[v];
+                after[j] = positions[v == from ? to : v];
+            }
+
+            if(containsTo) {
+                hasEdge = true;
+                continue;
+            }
+
+            const Vector3 normalBefore = Math::cross(before[1] - before[0], before[2] - before[0]);
+            const Vector3 normalAfter = Math::cross(after[1] - after[0], after[2] - after[0]);
+            if(Math::dot(normalBefore, normalAfter) <= 0.0f) {
+                flips = true;
+                break;
+            }
+        }
+        if(!hasEdge || flips) continue;
+
+        /* Perform the collapse. Triangles containing both vertices are
+           removed, the others are moved to the target vertex. */
+        std::vector<UnsignedInt> neighbors;
+        for(const UnsignedInt t: vertexTriangles[from]) {
+            if(triangleRemoved[t]) continue;
+
+            bool containsTo = false;
+            for(std::size_t j = 0; j != 3; ++j) {
+                UnsignedInt& v = indices[t*3 + j];
+                if(v == to) containsTo = true;
+                else if(v == from) v = to;
+                else neighbors.push_back(v);
+            }
+
+            if(containsTo) {
+                triangleRemoved[t] = true;
+                --liveTriangleCount;
+            } else vertexTriangles[to].push_back(t);
+        }
+
+        vertexRemoved[from] = true;
+        vertexTriangles[from].clear();
+        quadrics[to] += quadrics[from];
+
+        /* Edges to the former neighbors are new candidates now */
+        for(const UnsignedInt neighbor: neighbors) {
+            pushCollapse(to, neighbor);
+            pushCollapse(neighbor, to);
+        }
+    }
+
+    /* Compact the index array, keeping the original triangle order */
+    std::size_t out = 0;
+    for(std::size_t i = 0; i != triangleCount; ++i) {
+        if(triangleRemoved[i]) continue;
+        for(std::size_t j = 0; j != 3; ++j)
+            indices[out*3 + j] = indices[i*3 + j];
+        ++out;
+    }
+    indices.resize(out*3);
+}
+
+std::vector<Trade::MeshData3D> generateLods(const Trade::MeshData3D& mesh, std::initializer_list<Float> ratios) {
+    CORRADE_ASSERT(mesh.isIndexed() && mesh.primitive() == MeshPrimitive::Triangles,
+        "MeshTools::generateLods(): expected indexed triangle mesh", {});
+
+    std::vector<Trade::MeshData3D> lods;
+    lods.reserve(ratios.size());
+
+    const std::size_t triangleCount = mesh.indices().size()/3;
+    std::vector<UnsignedInt> indices = mesh.indices();
+    Float previousRatio = 1.0f;
+    for(const Float ratio: ratios) {
+        CORRADE_ASSERT(ratio > 0.0f && ratio <= previousRatio,
+            "MeshTools::generateLods(): expected decreasing ratios in range (0, 1] but got" << ratio << "after" << previousRatio, {});
+        previousRatio = ratio;
+
+        simplify(indices, mesh.positions(0), std::size_t(std::round(triangleCount*ratio))*3);
+
+        std::vector<std::vector<Vector3>> positions, normals;
+        std::vector<std::vector<Vector2>> textureCoords2D;
+        for(UnsignedInt i = 0; i != mesh.positionArrayCount(); ++i)
+            positions.push_back(mesh.positions(i));
+        for(UnsignedInt i = 0; i != mesh.normalArrayCount(); ++i)
+            normals.push_back(mesh.normals(i));
+        for(UnsignedInt i = 0; i != mesh.textureCoords2DArrayCount(); ++i)
+            textureCoords2D.push_back(mesh.textureCoords2D(i));
+
+        lods.emplace_back(MeshPrimitive::Triangles, indices, std::move(positions), std::move(normals), std::move(textureCoords2D));
+    }
+
+    return lods;
+}
+
+}}
@@ -0,0 +1,90 @@
+#ifndef Magnum_MeshTools_Simplify_h
+#define Magnum_MeshTools_Simplify_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::simplify(), @ref Magnum::MeshTools::generateLods()
+ */
+
+#include <initializer_list>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Simplify a triangle mesh
+@param[in,out] indices      Indices array to operate on
+@param[in] positions        Vertex positions
+@param[in] targetIndexCount Target index count
+@param[in] maxError         Max allowed geometric error
+
+Iteratively collapses the cheapest edge of the mesh until index count is not
+larger than @p targetIndexCount or the cheapest collapse would cause error
+larger than @p maxError. Collapse cost is evaluated using quadric error metric
+and the error is measured as distance from the original surface, thus in the
+same units as @p positions. Algorithm used: *Michael Garland and Paul S.
+Heckbert - Surface Simplification Using Quadric Error Metrics, SIGGRAPH 1997,
+http://mgarland.org/files/papers/quadrics.pdf*.
+
+Each edge is collapsed into one of its existing vertices, so only the index
+array is modified and all vertex attributes stay valid. Vertices on open
+boundaries and vertices sharing position with other vertices (i.e. on
+texture coordinate or normal seams) are never moved, so the seams stay intact.
+Call @ref removeDuplicates() on the mesh first to make sure vertices that
+differ only in their index aren't treated as seams. Collapses that would flip
+orientation of any triangle are rejected. Triangles that stay are in the
+original order, vertices that are no longer referenced are left in place, use
+@ref optimizeVertexFetch() to remove them. Expects that index count is
+divisible by 3 and all indices are less than size of @p positions.
+@see @ref generateLods()
+*/
+void MAGNUM_MESHTOOLS_EXPORT simplify(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, std::size_t targetIndexCount, Float maxError = Constants::inf());
+
+/**
+@brief Generate chain of simplified meshes
+@param mesh     Indexed triangle mesh
+@param ratios   Target triangle count ratios
+
+For each item in @p ratios creates a copy of @p mesh with the index array
+simplified using @ref simplify() to given fraction of the original triangle
+count. Each level is simplified from the previous one, so the ratios are
+expected to be in range @f$ (0, 1] @f$ and in decreasing order. The first
+position array is used for evaluating the error, all vertex attributes are
+copied unchanged. Levels that can't be simplified further without breaking
+seams or boundaries have more triangles than requested. Expects that the mesh
+is indexed and has @ref MeshPrimitive::Triangles primitive.
+@see @ref SceneGraph::LodDrawable
+*/
+std::vector<Trade::MeshData3D> MAGNUM_MESHTOOLS_EXPORT generateLods(const Trade::MeshData3D& mesh, std::initializer_list<Float> ratios);
+
+}}
+
+#endif
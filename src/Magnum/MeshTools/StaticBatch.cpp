@@ -0,0 +1,151 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "StaticBatch.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshView.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/Compile.h"
+#include "Magnum/MeshTools/Transform.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools {
+
+StaticBatch::StaticBatch(): _primitive{}, _hasNormals{}, _hasTextureCoords2D{} {}
+
+StaticBatch::StaticBatch(StaticBatch&&) = default;
+
+StaticBatch::~StaticBatch() = default;
+
+StaticBatch& StaticBatch::operator=(StaticBatch&&) = default;
+
+std::size_t StaticBatch::add(const Trade::MeshData3D& mesh, const Matrix4& transformation) {
+    CORRADE_ASSERT(mesh.positionArrayCount(),
+        "MeshTools::StaticBatch::add(): the mesh has no positions", {});
+    if(_ranges.empty()) {
+        _primitive = mesh.primitive();
+        _hasNormals = mesh.hasNormals();
+        _hasTextureCoords2D = mesh.hasTextureCoords2D();
+    } else CORRADE_ASSERT(mesh.primitive() == _primitive && mesh.hasNormals() == _hasNormals && mesh.hasTextureCoords2D() == _hasTextureCoords2D,
+        "MeshTools::StaticBatch::add(): the mesh has different primitive or attributes than the batch", {});
+
+    const std::vector<Vector3>& positions = mesh.positions(0);
+    CORRADE_ASSERT(!_hasNormals || mesh.normals(0).size() == positions.size(),
+        "MeshTools::StaticBatch::add(): expected" << positions.size() << "normals but got" << mesh.normals(0).size(), {});
+    CORRADE_ASSERT(!_hasTextureCoords2D || mesh.textureCoords2D(0).size() == positions.size(),
+        "MeshTools::StaticBatch::add(): expected" << positions.size() << "texture coordinates but got" << mesh.textureCoords2D(0).size(), {});
+    #ifndef CORRADE_NO_ASSERT
+    if(mesh.isIndexed()) for(const UnsignedInt index: mesh.indices()) CORRADE_ASSERT(index < positions.size(),
+        "MeshTools::StaticBatch::add(): index" << index << "out of bounds for" << positions.size() << "vertices", {});
+    #endif
+
+    const UnsignedInt vertexOffset = _positions.size();
+    const UnsignedInt indexOffset = _indices.size();
+
+    /* Append the vertices and transform them in place */
+    _positions.insert(_positions.end(), positions.begin(), positions.end());
+    transformPointsInPlace(transformation, _positions.data() + vertexOffset, positions.size());
+    if(_hasNormals) {
+        const std::vector<Vector3>& normals = mesh.normals(0);
+        _normals.insert(_normals.end(), normals.begin(), normals.end());
+        transformNormalsInPlace(transformation, _normals.data() + vertexOffset, normals.size());
+    }
+    if(_hasTextureCoords2D) {
+        const std::vector<Vector2>& textureCoords2D = mesh.textureCoords2D(0);
+        _textureCoords2D.insert(_textureCoords2D.end(), textureCoords2D.begin(), textureCoords2D.end());
+    }
+
+    /* Offset the indices to point to the merged vertex array, generate
+       them for non-indexed meshes */
+    Range range{indexOffset, 0, vertexOffset, vertexOffset, {}};
+    if(mesh.isIndexed()) {
+        _indices.reserve(_indices.size() + mesh.indices().size());
+        UnsignedInt vertexEnd = 0;
+        for(const UnsignedInt index: mesh.indices()) {
+            _indices.push_back(vertexOffset + index);
+            vertexEnd = Math::max(vertexEnd, index);
+        }
+        range.vertexEnd += vertexEnd;
+    } else {
+        _indices.reserve(_indices.size() + positions.size());
+        for(UnsignedInt i = 0; i != positions.size(); ++i)
+            _indices.push_back(vertexOffset + i);
+        if(!positions.empty()) range.vertexEnd += positions.size() - 1;
+    }
+    range.indexCount = _indices.size() - indexOffset;
+
+    /* Bounds of the transformed positions */
+    if(!positions.empty()) {
+        Vector3 min = _positions[vertexOffset], max = min;
+        for(std::size_t i = vertexOffset + 1; i != _positions.size(); ++i) {
+            min = Math::min(min, _positions[i]);
+            max = Math::max(max, _positions[i]);
+        }
+        range.bounds = {min, max};
+    }
+
+    _ranges.push_back(range);
+    return _ranges.size() - 1;
+}
+
+Trade::MeshData3D StaticBatch::meshData() const {
+    CORRADE_ASSERT(!_ranges.empty(),
+        "MeshTools::StaticBatch::meshData(): the batch is empty", (Trade::MeshData3D{MeshPrimitive::Triangles, {}, {{}}, {}, {}}));
+
+    std::vector<std::vector<Vector3>> normals;
+    if(_hasNormals) normals.push_back(_normals);
+    std::vector<std::vector<Vector2>> textureCoords2D;
+    if(_hasTextureCoords2D) textureCoords2D.push_back(_textureCoords2D);
+    return Trade::MeshData3D{_primitive, _indices, {_positions}, std::move(normals), std::move(textureCoords2D)};
+}
+
+std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> StaticBatch::compile(const BufferUsage usage) const {
+    return MeshTools::compile(meshData(), usage);
+}
+
+std::vector<MeshView> StaticBatch::views(Mesh& mesh) const {
+    std::vector<MeshView> views;
+    views.reserve(_ranges.size());
+    for(const Range& range: _ranges) {
+        views.emplace_back(mesh);
+        views.back().setCount(range.indexCount)
+            .setIndexRange(range.indexOffset, range.vertexStart, range.vertexEnd);
+    }
+    return views;
+}
+
+void StaticBatch::clear() {
+    _indices.clear();
+    _positions.clear();
+    _normals.clear();
+    _textureCoords2D.clear();
+    _ranges.clear();
+}
+
+}}
@@ -0,0 +1,183 @@
+#ifndef Magnum_MeshTools_StaticBatch_h
+#define Magnum_MeshTools_StaticBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::MeshTools::StaticBatch
+ */
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Static batch of immobile meshes
+
+Merges meshes of immobile objects sharing the same material into a single
+vertex and index buffer, so they can be drawn with a few draw calls instead of
+one draw call per object. The vertices are transformed into the batch
+coordinate system using @ref transformPointsInPlace() and
+@ref transformNormalsInPlace() when added, the indices are offset to point to
+the merged vertex array, so no base vertex support is needed for drawing.
+Each added mesh is kept as a separate index range together with its bounds,
+so the ranges can still be culled one by one:
+@code
+MeshTools::StaticBatch batch;
+for(Object3D* object: immobileObjectsWithBrickMaterial)
+    batch.add(brickMeshData, object->absoluteTransformationMatrix());
+
+Mesh mesh;
+std::unique_ptr<Buffer> vertices, indices;
+std::tie(mesh, vertices, indices) = batch.compile(BufferUsage::StaticDraw);
+std::vector<MeshView> views = batch.views(mesh);
+
+// ...
+
+for(std::size_t i = 0; i != views.size(); ++i)
+    if(frustum.intersects(batch.ranges()[i].bounds)) views[i].draw(shader);
+@endcode
+
+The batch doesn't know anything about materials, create one batch for each
+material. All meshes added to one batch are expected to have the same
+primitive and the same set of attributes, only the first position, normal and
+texture coordinate array of each mesh is used. As the vertices are baked in,
+the batch needs to be rebuilt if any of the objects moves.
+*/
+class MAGNUM_MESHTOOLS_EXPORT StaticBatch {
+    public:
+        /**
+         * @brief Range of a mesh in the batch
+         *
+         * @see @ref ranges()
+         */
+        struct Range {
+            /** @brief Offset of the first index */
+            UnsignedInt indexOffset;
+
+            /** @brief Index count */
+            UnsignedInt indexCount;
+
+            /** @brief Minimal vertex index referenced by the range */
+            UnsignedInt vertexStart;
+
+            /** @brief Maximal vertex index referenced by the range */
+            UnsignedInt vertexEnd;
+
+            /** @brief Bounds of transformed vertex positions */
+            Range3D bounds;
+        };
+
+        /** @brief Constructor */
+        explicit StaticBatch();
+
+        /** @brief Copying is not allowed */
+        StaticBatch(const StaticBatch&) = delete;
+
+        /** @brief Move constructor */
+        StaticBatch(StaticBatch&&);
+
+        ~StaticBatch();
+
+        /** @brief Copying is not allowed */
+        StaticBatch& operator=(const StaticBatch&) = delete;
+
+        /** @brief Move assignment */
+        StaticBatch& operator=(StaticBatch&&);
+
+        /** @brief Whether the batch is empty */
+        bool isEmpty() const { return _ranges.empty(); }
+
+        /** @brief Index ranges of added meshes, in order they were added */
+        const std::vector<Range>& ranges() const { return _ranges; }
+
+        /** @brief Vertex count of the merged mesh */
+        std::size_t vertexCount() const { return _positions.size(); }
+
+        /** @brief Index count of the merged mesh */
+        std::size_t indexCount() const { return _indices.size(); }
+
+        /**
+         * @brief Add mesh
+         * @param mesh              Mesh data
+         * @param transformation    Absolute transformation of the object
+         * @return ID of the mesh range in @ref ranges()
+         *
+         * Non-indexed meshes are converted to indexed. Expects that the mesh
+         * has the same primitive and the same set of attributes as the
+         * previously added meshes and that the transformation is affine.
+         */
+        std::size_t add(const Trade::MeshData3D& mesh, const Matrix4& transformation);
+
+        /**
+         * @brief Merged mesh data
+         *
+         * Expects that the batch is not empty.
+         */
+        Trade::MeshData3D meshData() const;
+
+        /**
+         * @brief Compile the merged mesh
+         *
+         * Equivalent to calling @ref compile(const Trade::MeshData3D&, BufferUsage)
+         * on @ref meshData(). The mesh is always indexed. Expects that the
+         * batch is not empty.
+         */
+        std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(BufferUsage usage) const;
+
+        /**
+         * @brief Create mesh views for the ranges
+         * @param mesh      Mesh returned by @ref compile()
+         *
+         * Creates one @ref MeshView for each range in @ref ranges() with the
+         * index range and count set up, so the ranges that pass culling can
+         * be drawn separately or in one
+         * @ref MeshView::draw(AbstractShaderProgram&, Containers::ArrayReference<const std::reference_wrapper<MeshView>>) "MeshView::draw()"
+         * batch.
+         */
+        std::vector<MeshView> views(Mesh& mesh) const;
+
+        /** @brief Remove all meshes from the batch */
+        void clear();
+
+    private:
+        MeshPrimitive _primitive;
+        bool _hasNormals, _hasTextureCoords2D;
+        std::vector<UnsignedInt> _indices;
+        std::vector<Vector3> _positions, _normals;
+        std::vector<Vector2> _textureCoords2D;
+        std::vector<Range> _ranges;
+};
+
+}}
+
+#endif
@@ -26,12 +26,17 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::subdivide()
+ * @brief Function @ref Magnum::MeshTools::subdivide(), @ref Magnum::MeshTools::subdivideLoop()
  */
 
+#include <cstdint>
+#include <utility>
 #include <vector>
+#include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Magnum.h"
+
 namespace Magnum { namespace MeshTools {
 
 namespace Implementation {
@@ -58,6 +63,68 @@ template<class Vertex, class Interpolator> class Subdivide {
         }
 };
 
+/* Open-addressing hash map from an undirected edge to its ID with linear
+   probing. The table has at least twice as many slots as there are indices
+   in the mesh, so it never fills up and doesn't need to be rehashed. Keys are
+   std::uint64_t because UnsignedLong is not available on WebGL. */
+class SubdivideEdgeHash {
+    public:
+        explicit SubdivideEdgeHash(const std::size_t indexCount) {
+            std::size_t capacity = 16;
+            while(capacity < indexCount*2) capacity <<= 1;
+            _mask = capacity - 1;
+            _keys.assign(capacity, Empty);
+            _values.resize(capacity);
+        }
+
+        /* Returns ID of given edge and true if the edge wasn't there before
+           and was added with given ID */
+        std::pair<UnsignedInt, bool> insert(const UnsignedInt a, const UnsignedInt b, const UnsignedInt id) {
+            const std::uint64_t key = a < b ? (std::uint64_t(a) << 32 | b) : (std::uint64_t(b) << 32 | a);
+            std::size_t i = std::size_t((key*0x9e3779b97f4a7c15ull) >> 32) & _mask;
+            for(; _keys[i] != key; i = (i + 1) & _mask) {
+                if(_keys[i] != Empty) continue;
+                _keys[i] = key;
+                _values[i] = id;
+                return {id, true};
+            }
+
+            return {_values[i], false};
+        }
+
+    private:
+        enum: std::uint64_t { Empty = ~std::uint64_t{} };
+
+        std::size_t _mask;
+        std::vector<std::uint64_t> _keys;
+        std::vector<UnsignedInt> _values;
+};
+
+/* Reserves the final index count and the final vertex count of a closed mesh
+   (each level adds one vertex per edge, E = F*3/2), so there are no
+   reallocations during the subdivision */
+template<class Vertex> void subdivideReserve(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices, const UnsignedInt levels) {
+    std::size_t faceCount = indices.size()/3;
+    std::size_t vertexCount = vertices.size();
+    for(UnsignedInt i = 0; i != levels; ++i) {
+        vertexCount += faceCount*3/2;
+        faceCount *= 4;
+    }
+
+    indices.reserve(faceCount*3);
+    vertices.reserve(vertexCount);
+}
+
+/* Adds three new faces for face at given offset and replaces the original
+   with the middle one, see Subdivide::operator() for the ordering */
+inline void subdivideFace(std::vector<UnsignedInt>& indices, const std::size_t i, const UnsignedInt(&newVertices)[3]) {
+    indices.insert(indices.end(), {indices[i], newVertices[0], newVertices[2]});
+    indices.insert(indices.end(), {newVertices[0], indices[i + 1], newVertices[1]});
+    indices.insert(indices.end(), {newVertices[2], newVertices[1], indices[i + 2]});
+    for(std::size_t j = 0; j != 3; ++j)
+        indices[i + j] = newVertices[j];
+}
+
 }
 
 /**
@@ -76,6 +143,148 @@ template<class Vertex, class Interpolator> inline void subdivide(std::vector<Uns
     Implementation::Subdivide<Vertex, Interpolator>(indices, vertices)(interpolator);
 }
 
+/**
+@brief Subdivide the mesh multiple times
+@tparam Vertex          Vertex data type
+@tparam Interpolator    See `interpolator` function parameter
+@param[in,out] indices  Index array to operate on
+@param[in,out] vertices Vertex array to operate on
+@param levels           Subdivision level count
+@param interpolator     Functor or function pointer which interpolates
+    two adjacent vertices: `Vertex interpolator(Vertex a, Vertex b)`
+
+Subdivides each triangle face into four new @p levels times, with the faces
+ordered the same as in @ref subdivide(std::vector<UnsignedInt>&, std::vector<Vertex>&, Interpolator).
+Unlike that function, midpoints of edges shared by more faces are created
+only once, so there's no need to remove duplicate vertices afterwards. The
+output arrays are allocated for all levels upfront.
+@see @ref subdivideLoop()
+*/
+template<class Vertex, class Interpolator> void subdivide(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices, const UnsignedInt levels, Interpolator interpolator) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::subdivide(): index count is not divisible by 3!", );
+
+    Implementation::subdivideReserve(indices, vertices, levels);
+
+    for(UnsignedInt level = 0; level != levels; ++level) {
+        const std::size_t indexCount = indices.size();
+        Implementation::SubdivideEdgeHash edges{indexCount};
+
+        for(std::size_t i = 0; i != indexCount; i += 3) {
+            /* Interpolate each side, reuse the midpoint from neighbor face */
+            UnsignedInt newVertices[3];
+            for(std::size_t j = 0; j != 3; ++j) {
+                const UnsignedInt a = indices[i + j], b = indices[i + (j + 1)%3];
+                const std::pair<UnsignedInt, bool> edge = edges.insert(a, b, vertices.size());
+                if(edge.second) vertices.push_back(interpolator(vertices[a], vertices[b]));
+                newVertices[j] = edge.first;
+            }
+
+            Implementation::subdivideFace(indices, i, newVertices);
+        }
+    }
+}
+
+/**
+@brief Subdivide the mesh using Loop subdivision
+@tparam Vertex          Vertex data type, expected to be a @ref Math::Vector
+    or its subclass
+@param[in,out] indices  Index array to operate on
+@param[in,out] vertices Vertex array to operate on
+@param levels           Subdivision level count
+
+Topology of the result is the same as with @ref subdivide(std::vector<UnsignedInt>&, std::vector<Vertex>&, UnsignedInt, Interpolator),
+but instead of just interpolating the edges, all vertices are repositioned
+to approximate a smooth surface. New edge vertices are weighted
+@f$ \frac{3}{8} @f$ from the edge endpoints and @f$ \frac{1}{8} @f$ from
+the two opposite vertices, original vertices of valence @f$ n @f$ are
+moved toward their neighbors with Warren's weight @f$ \beta = \frac{3}{8n} @f$
+(@f$ \frac{3}{16} @f$ for @f$ n = 3 @f$). Vertices on mesh boundary are
+smoothed only along the boundary, so open meshes don't shrink away from
+their border. Edges shared by more than two faces are treated as creases
+and just interpolated.
+*/
+template<class Vertex> void subdivideLoop(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices, const UnsignedInt levels) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::subdivideLoop(): index count is not divisible by 3!", );
+
+    typedef typename Vertex::Type T;
+    struct Edge {
+        UnsignedInt vertices[2];
+        UnsignedInt opposite[2];
+        UnsignedInt faceCount;
+    };
+
+    Implementation::subdivideReserve(indices, vertices, levels);
+
+    std::vector<Edge> edgeData;
+    std::vector<Vertex> neighborSums, boundarySums;
+    std::vector<UnsignedInt> valences, boundaryValences;
+    for(UnsignedInt level = 0; level != levels; ++level) {
+        const std::size_t indexCount = indices.size();
+        const std::size_t vertexCount = vertices.size();
+        Implementation::SubdivideEdgeHash edges{indexCount};
+        edgeData.clear();
+        edgeData.reserve(indexCount);
+
+        /* Gather unique edges along with their opposite vertices and
+           subdivide the topology */
+        for(std::size_t i = 0; i != indexCount; i += 3) {
+            UnsignedInt newVertices[3];
+            for(std::size_t j = 0; j != 3; ++j) {
+                const UnsignedInt a = indices[i + j], b = indices[i + (j + 1)%3], c = indices[i + (j + 2)%3];
+                const std::pair<UnsignedInt, bool> edge = edges.insert(a, b, edgeData.size());
+                if(edge.second) edgeData.push_back({{a, b}, {c, c}, 1});
+                else if(++edgeData[edge.first].faceCount == 2)
+                    edgeData[edge.first].opposite[1] = c;
+                newVertices[j] = vertexCount + edge.first;
+            }
+
+            Implementation::subdivideFace(indices, i, newVertices);
+        }
+
+        /* Calculate new edge vertices from the original positions and
+           accumulate neighbors of the original vertices */
+        neighborSums.assign(vertexCount, Vertex{});
+        boundarySums.assign(vertexCount, Vertex{});
+        valences.assign(vertexCount, 0);
+        boundaryValences.assign(vertexCount, 0);
+        for(const Edge& edge: edgeData) {
+            const Vertex& a = vertices[edge.vertices[0]];
+            const Vertex& b = vertices[edge.vertices[1]];
+
+            neighborSums[edge.vertices[0]] += b;
+            neighborSums[edge.vertices[1]] += a;
+            ++valences[edge.vertices[0]];
+            ++valences[edge.vertices[1]];
+
+            if(edge.faceCount == 1) {
+                boundarySums[edge.vertices[0]] += b;
+                boundarySums[edge.vertices[1]] += a;
+                ++boundaryValences[edge.vertices[0]];
+                ++boundaryValences[edge.vertices[1]];
+            }
+
+            Vertex v;
+            if(edge.faceCount == 2)
+                v = (a + b)*T(3.0/8.0) + (vertices[edge.opposite[0]] + vertices[edge.opposite[1]])*T(1.0/8.0);
+            else v = (a + b)*T(0.5);
+            vertices.push_back(v);
+        }
+
+        /* Reposition the original vertices. Boundary vertices are smoothed
+           only if there are exactly two boundary edges, corners of
+           non-manifold fans are kept in place. */
+        for(std::size_t i = 0; i != vertexCount; ++i) {
+            if(boundaryValences[i]) {
+                if(boundaryValences[i] == 2)
+                    vertices[i] = vertices[i]*T(3.0/4.0) + boundarySums[i]*T(1.0/8.0);
+            } else if(const UnsignedInt n = valences[i]) {
+                const T beta = n == 3 ? T(3.0/16.0) : T(3.0/8.0)/T(n);
+                vertices[i] = vertices[i]*(T(1) - T(n)*beta) + neighborSums[i]*beta;
+            }
+        }
+    }
+}
+
 namespace Implementation {
 
 template<class Vertex, class Interpolator> void Subdivide<Vertex, Interpolator>::operator()(Interpolator interpolator) {
@@ -0,0 +1,69 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/AnalyzeVertexCache.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct AnalyzeVertexCacheTest: TestSuite::Tester {
+    explicit AnalyzeVertexCacheTest();
+
+    void empty();
+    void analyze();
+};
+
+AnalyzeVertexCacheTest::AnalyzeVertexCacheTest() {
+    addTests({&AnalyzeVertexCacheTest::empty,
+              &AnalyzeVertexCacheTest::analyze});
+}
+
+void AnalyzeVertexCacheTest::empty() {
+    const VertexCacheStatistics statistics = MeshTools::analyzeVertexCache({}, 0, 16);
+    CORRADE_COMPARE(statistics.acmr, 0.0f);
+    CORRADE_COMPARE(statistics.atvr, 0.0f);
+}
+
+void AnalyzeVertexCacheTest::analyze() {
+    /* Vertex 5 is not used at all */
+    const std::vector<UnsignedInt> indices{0, 1, 2, 2, 1, 3, 4, 4, 0};
+
+    /* Everything fits into the cache, so only each vertex is transformed
+       once */
+    const VertexCacheStatistics large = MeshTools::analyzeVertexCache(indices, 6, 16);
+    CORRADE_COMPARE(large.acmr, 5.0f/3.0f);
+    CORRADE_COMPARE(large.atvr, 1.0f);
+
+    /* With cache of size 1 only directly repeated vertices hit the cache */
+    const VertexCacheStatistics small = MeshTools::analyzeVertexCache(indices, 6, 1);
+    CORRADE_COMPARE(small.acmr, 7.0f/3.0f);
+    CORRADE_COMPARE(small.atvr, 7.0f/5.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::AnalyzeVertexCacheTest)
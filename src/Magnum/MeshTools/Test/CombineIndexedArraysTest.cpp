@@ -38,12 +38,18 @@ struct CombineIndexedArraysTest: TestSuite::Tester {
     void wrongIndexCount();
     void indexArrays();
     void indexedArrays();
+    void interleavedIndexArraysThreaded();
+    void indexedArraysThreaded();
+    void zeroThreads();
 };
 
 CombineIndexedArraysTest::CombineIndexedArraysTest() {
     addTests({&CombineIndexedArraysTest::wrongIndexCount,
               &CombineIndexedArraysTest::indexArrays,
-              &CombineIndexedArraysTest::indexedArrays});
+              &CombineIndexedArraysTest::indexedArrays,
+              &CombineIndexedArraysTest::interleavedIndexArraysThreaded,
+              &CombineIndexedArraysTest::indexedArraysThreaded,
+              &CombineIndexedArraysTest::zeroThreads});
 }
 
 void CombineIndexedArraysTest::wrongIndexCount() {
@@ -87,6 +93,59 @@ void CombineIndexedArraysTest::indexedArrays() {
     CORRADE_COMPARE(array3, (std::vector<UnsignedInt>{6, 7}));
 }
 
+void CombineIndexedArraysTest::interleavedIndexArraysThreaded() {
+    /* The example from the documentation */
+    const std::vector<UnsignedInt> interleaved{0, 1, 2, 3, 5, 4, 0, 1, 0, 4, 1, 6, 3, 1, 2, 3, 2, 1};
+
+    /* Result should be the same for any thread count, including more
+       threads than items */
+    for(UnsignedInt threadCount: {1, 2, 3, 4, 16}) {
+        std::vector<UnsignedInt> combined, cleaned;
+        std::tie(combined, cleaned) = MeshTools::combineIndexArrays(interleaved, 2, threadCount);
+        CORRADE_COMPARE(combined, (std::vector<UnsignedInt>{0, 1, 2, 0, 3, 4, 5, 1, 6}));
+        CORRADE_COMPARE(cleaned, (std::vector<UnsignedInt>{0, 1, 2, 3, 5, 4, 0, 4, 1, 6, 3, 1, 2, 1}));
+    }
+}
+
+void CombineIndexedArraysTest::indexedArraysThreaded() {
+    /* Many duplicates spread across all chunks */
+    std::vector<UnsignedInt> a, b;
+    for(UnsignedInt i = 0; i != 1000; ++i) {
+        a.push_back((i*7)%31);
+        b.push_back(i%5);
+    }
+    std::vector<UnsignedInt> array1(31), array2(5);
+    for(UnsignedInt i = 0; i != 31; ++i) array1[i] = i;
+    for(UnsignedInt i = 0; i != 5; ++i) array2[i] = 100 + i;
+    std::vector<UnsignedInt> expected1 = array1, expected2 = array2;
+
+    const std::vector<UnsignedInt> expected = MeshTools::combineIndexedArrays(
+        std::make_pair(std::cref(a), std::ref(expected1)),
+        std::make_pair(std::cref(b), std::ref(expected2)));
+    const std::vector<UnsignedInt> result = MeshTools::combineIndexedArrays(4,
+        std::make_pair(std::cref(a), std::ref(array1)),
+        std::make_pair(std::cref(b), std::ref(array2)));
+
+    CORRADE_COMPARE(result, expected);
+    CORRADE_COMPARE(array1, expected1);
+    CORRADE_COMPARE(array2, expected2);
+
+    /* Each combination is there exactly once */
+    CORRADE_COMPARE(array1.size(), 155);
+    for(std::size_t i = 0; i != result.size(); ++i) {
+        CORRADE_COMPARE(array1[result[i]], a[i]);
+        CORRADE_COMPARE(array2[result[i]], 100 + b[i]);
+    }
+}
+
+void CombineIndexedArraysTest::zeroThreads() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+    MeshTools::combineIndexArrays({0, 1, 0, 1}, 2, 0);
+
+    CORRADE_COMPARE(ss.str(), "MeshTools::combineIndexArrays(): expected at least one thread\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CombineIndexedArraysTest)
@@ -37,12 +37,26 @@ struct CompressIndicesTest: TestSuite::Tester {
     void compressChar();
     void compressShort();
     void compressInt();
+    void compressEmpty();
+    void compressPrimitiveRestart();
+    void compressInto();
+    void compressIntoInPlace();
+
+    void split();
+    void splitPrimitiveRestart();
 };
 
 CompressIndicesTest::CompressIndicesTest() {
     addTests({&CompressIndicesTest::compressChar,
               &CompressIndicesTest::compressShort,
-              &CompressIndicesTest::compressInt});
+              &CompressIndicesTest::compressInt,
+              &CompressIndicesTest::compressEmpty,
+              &CompressIndicesTest::compressPrimitiveRestart,
+              &CompressIndicesTest::compressInto,
+              &CompressIndicesTest::compressIntoInPlace,
+
+              &CompressIndicesTest::split,
+              &CompressIndicesTest::splitPrimitiveRestart});
 }
 
 void CompressIndicesTest::compressChar() {
@@ -108,6 +122,149 @@ void CompressIndicesTest::compressInt() {
     }
 }
 
+void CompressIndicesTest::compressEmpty() {
+    Containers::Array<char> data;
+    Mesh::IndexType type;
+    UnsignedInt start, end;
+    std::tie(data, type, start, end) = MeshTools::compressIndices(std::vector<UnsignedInt>{});
+
+    CORRADE_COMPARE(start, 0);
+    CORRADE_COMPARE(end, 0);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedByte);
+    CORRADE_VERIFY(data.empty());
+}
+
+void CompressIndicesTest::compressPrimitiveRestart() {
+    Containers::Array<char> data;
+    Mesh::IndexType type;
+    UnsignedInt start, end;
+
+    /* 254 is the largest index that fits into 8 bits with restart */
+    std::tie(data, type, start, end) = MeshTools::compressIndices(
+        std::vector<UnsignedInt>{3, 254, 0xFFFFFFFFu, 2}, CompressIndicesFlag::PrimitiveRestart);
+
+    CORRADE_COMPARE(start, 2);
+    CORRADE_COMPARE(end, 254);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedByte);
+    CORRADE_COMPARE(std::vector<char>(data.begin(), data.end()),
+        (std::vector<char>{ 0x03, char(0xfe), char(0xff), 0x02 }));
+
+    /* 255 is reserved for the restart index */
+    std::tie(data, type, start, end) = MeshTools::compressIndices(
+        std::vector<UnsignedInt>{255, 0xFFFFFFFFu, 1}, CompressIndicesFlag::PrimitiveRestart);
+
+    CORRADE_COMPARE(start, 1);
+    CORRADE_COMPARE(end, 255);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedShort);
+    if(!Utility::Endianness::isBigEndian()) {
+        CORRADE_COMPARE(std::vector<char>(data.begin(), data.end()),
+            (std::vector<char>{ char(0xff), 0x00,
+                           char(0xff), char(0xff),
+                           0x01, 0x00 }));
+    } else {
+        CORRADE_COMPARE(std::vector<char>(data.begin(), data.end()),
+            (std::vector<char>{ 0x00, char(0xff),
+                           char(0xff), char(0xff),
+                           0x00, 0x01 }));
+    }
+}
+
+void CompressIndicesTest::compressInto() {
+    char data[6]{0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f};
+
+    Mesh::IndexType type;
+    UnsignedInt start, end;
+    std::tie(type, start, end) = MeshTools::compressIndicesInto(data,
+        std::vector<UnsignedInt>{1, 2, 3, 0, 4});
+
+    CORRADE_COMPARE(start, 0);
+    CORRADE_COMPARE(end, 4);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedByte);
+
+    /* The rest is untouched */
+    CORRADE_COMPARE(std::vector<char>(data, data + 6),
+        (std::vector<char>{ 0x01, 0x02, 0x03, 0x00, 0x04, 0x7f }));
+}
+
+void CompressIndicesTest::compressIntoInPlace() {
+    std::vector<UnsignedInt> indices{1, 256, 0, 5};
+
+    Mesh::IndexType type;
+    UnsignedInt start, end;
+    std::tie(type, start, end) = MeshTools::compressIndicesInto(
+        {reinterpret_cast<char*>(indices.data()), indices.size()*4}, indices);
+
+    CORRADE_COMPARE(start, 0);
+    CORRADE_COMPARE(end, 256);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedShort);
+
+    const UnsignedShort* const compressed = reinterpret_cast<const UnsignedShort*>(indices.data());
+    CORRADE_COMPARE(std::vector<UnsignedShort>(compressed, compressed + 4),
+        (std::vector<UnsignedShort>{1, 256, 0, 5}));
+}
+
+void CompressIndicesTest::split() {
+    /* Three triangles, the first two fit into one chunk, the third needs a new
+       one */
+    Containers::Array<char> data;
+    std::vector<IndexChunk> chunks;
+    std::tie(data, chunks) = MeshTools::compressIndicesSplit(std::vector<UnsignedInt>{
+        100, 101, 65635,
+        65635, 101, 102,
+        65636, 65637, 100000});
+
+    CORRADE_COMPARE(chunks.size(), 2);
+    CORRADE_COMPARE(chunks[0].indexOffset, 0);
+    CORRADE_COMPARE(chunks[0].indexCount, 6);
+    CORRADE_COMPARE(chunks[0].baseVertex, 100);
+    CORRADE_COMPARE(chunks[0].indexStart, 0);
+    CORRADE_COMPARE(chunks[0].indexEnd, 65535);
+    CORRADE_COMPARE(chunks[1].indexOffset, 6);
+    CORRADE_COMPARE(chunks[1].indexCount, 3);
+    CORRADE_COMPARE(chunks[1].baseVertex, 65636);
+    CORRADE_COMPARE(chunks[1].indexStart, 0);
+    CORRADE_COMPARE(chunks[1].indexEnd, 34364);
+
+    CORRADE_COMPARE(data.size(), 9*2);
+    const UnsignedShort* const compressed = reinterpret_cast<const UnsignedShort*>(data.begin());
+    CORRADE_COMPARE(std::vector<UnsignedShort>(compressed, compressed + 9),
+        (std::vector<UnsignedShort>{
+            0, 1, 65535,
+            65535, 1, 2,
+            0, 1, 34364}));
+}
+
+void CompressIndicesTest::splitPrimitiveRestart() {
+    /* Two strips fitting into one chunk (restart index between them kept), the
+       third needs new chunk (restart index dropped) */
+    Containers::Array<char> data;
+    std::vector<IndexChunk> chunks;
+    std::tie(data, chunks) = MeshTools::compressIndicesSplit(std::vector<UnsignedInt>{
+        0xFFFFFFFFu,
+        10, 11, 12, 13, 0xFFFFFFFFu,
+        14, 65544, 15, 0xFFFFFFFFu, 0xFFFFFFFFu,
+        65545, 65546, 65547}, 0, CompressIndicesFlag::PrimitiveRestart);
+
+    CORRADE_COMPARE(chunks.size(), 2);
+    CORRADE_COMPARE(chunks[0].indexOffset, 0);
+    CORRADE_COMPARE(chunks[0].indexCount, 8);
+    CORRADE_COMPARE(chunks[0].baseVertex, 10);
+    CORRADE_COMPARE(chunks[0].indexStart, 0);
+    CORRADE_COMPARE(chunks[0].indexEnd, 65534);
+    CORRADE_COMPARE(chunks[1].indexOffset, 8);
+    CORRADE_COMPARE(chunks[1].indexCount, 3);
+    CORRADE_COMPARE(chunks[1].baseVertex, 65545);
+    CORRADE_COMPARE(chunks[1].indexStart, 0);
+    CORRADE_COMPARE(chunks[1].indexEnd, 2);
+
+    const UnsignedShort* const compressed = reinterpret_cast<const UnsignedShort*>(data.begin());
+    CORRADE_COMPARE(std::vector<UnsignedShort>(compressed, compressed + data.size()/2),
+        (std::vector<UnsignedShort>{
+            0, 1, 2, 3, 65535,
+            4, 65534, 5,
+            0, 1, 2}));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CompressIndicesTest)
@@ -34,10 +34,12 @@ struct DuplicateTest: TestSuite::Tester {
     explicit DuplicateTest();
 
     void duplicate();
+    void duplicatePolicy();
 };
 
 DuplicateTest::DuplicateTest() {
-    addTests({&DuplicateTest::duplicate});
+    addTests({&DuplicateTest::duplicate,
+              &DuplicateTest::duplicatePolicy});
 }
 
 void DuplicateTest::duplicate() {
@@ -45,6 +47,16 @@ void DuplicateTest::duplicate() {
                     (std::vector<Int>{35, 35, -7, -18, 12, 12}));
 }
 
+void DuplicateTest::duplicatePolicy() {
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt i = 0; i != 1001; ++i) indices.push_back((i*7)%4);
+    const std::vector<Int> data{-7, 35, 12, -18};
+
+    ThreadPool pool{3};
+    CORRADE_COMPARE(MeshTools::duplicate(ExecutionPolicy{pool, 10}, indices, data),
+                    MeshTools::duplicate(indices, data));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::DuplicateTest)
@@ -0,0 +1,227 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/ExecutionPolicy.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct ExecutionPolicyTest: TestSuite::Tester {
+    explicit ExecutionPolicyTest();
+
+    void constructSerial();
+    void constructPool();
+    void constructScheduler();
+    void constructThreads();
+    void constructThreadsZero();
+    void grainSize();
+
+    void parallelForSerial();
+    void parallelForBelowGrainSize();
+    void parallelForPool();
+    void parallelForPoolRepeated();
+    void parallelForSchedulerNested();
+    void parallelForThreads();
+};
+
+ExecutionPolicyTest::ExecutionPolicyTest() {
+    addTests({&ExecutionPolicyTest::constructSerial,
+              &ExecutionPolicyTest::constructPool,
+              &ExecutionPolicyTest::constructScheduler,
+              &ExecutionPolicyTest::constructThreads,
+              &ExecutionPolicyTest::constructThreadsZero,
+              &ExecutionPolicyTest::grainSize,
+
+              &ExecutionPolicyTest::parallelForSerial,
+              &ExecutionPolicyTest::parallelForBelowGrainSize,
+              &ExecutionPolicyTest::parallelForPool,
+              &ExecutionPolicyTest::parallelForPoolRepeated,
+              &ExecutionPolicyTest::parallelForSchedulerNested,
+              &ExecutionPolicyTest::parallelForThreads});
+}
+
+namespace {
+    /* Increments each element of the array in the range, so it can be
+       verified that each element was visited exactly once */
+    struct Visit {
+        std::vector<Int>& visited;
+        std::atomic<std::size_t>& callCount;
+
+        void operator()(const std::size_t begin, const std::size_t end) const {
+            ++callCount;
+            for(std::size_t i = begin; i != end; ++i) ++visited[i];
+        }
+    };
+}
+
+void ExecutionPolicyTest::constructSerial() {
+    ExecutionPolicy policy;
+    CORRADE_VERIFY(!policy.pool());
+    CORRADE_VERIFY(!policy.scheduler());
+    CORRADE_VERIFY(policy.isSerial());
+    CORRADE_COMPARE(policy.threadCount(), 1);
+    CORRADE_COMPARE(policy.grainSize(), std::size_t(ExecutionPolicy::DefaultGrainSize));
+}
+
+void ExecutionPolicyTest::constructPool() {
+    ThreadPool pool{3};
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_COMPARE(pool.threadCount(), 3);
+    #else
+    CORRADE_COMPARE(pool.threadCount(), 1);
+    #endif
+
+    ExecutionPolicy policy{pool, 256};
+    CORRADE_COMPARE(policy.pool(), &pool);
+    CORRADE_COMPARE(policy.scheduler(), &pool.scheduler());
+    CORRADE_COMPARE(policy.threadCount(), pool.threadCount());
+    CORRADE_COMPARE(policy.grainSize(), 256);
+
+    /* Default is hardware thread count */
+    ThreadPool defaultPool;
+    CORRADE_VERIFY(defaultPool.threadCount() >= 1);
+}
+
+void ExecutionPolicyTest::constructScheduler() {
+    TaskScheduler scheduler{3};
+
+    ExecutionPolicy policy{scheduler, 256};
+    CORRADE_VERIFY(!policy.pool());
+    CORRADE_COMPARE(policy.scheduler(), &scheduler);
+    CORRADE_COMPARE(policy.threadCount(), scheduler.threadCount());
+    CORRADE_COMPARE(policy.grainSize(), 256);
+}
+
+void ExecutionPolicyTest::constructThreads() {
+    ExecutionPolicy policy{4, 128};
+    CORRADE_VERIFY(!policy.pool());
+    CORRADE_VERIFY(!policy.isSerial());
+    CORRADE_COMPARE(policy.threadCount(), 4);
+    CORRADE_COMPARE(policy.grainSize(), 128);
+}
+
+void ExecutionPolicyTest::constructThreadsZero() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    ExecutionPolicy{0};
+    CORRADE_COMPARE(out.str(), "MeshTools::ExecutionPolicy: expected at least one thread\n");
+}
+
+void ExecutionPolicyTest::grainSize() {
+    ExecutionPolicy policy;
+    policy.setGrainSize(1000);
+    CORRADE_COMPARE(policy.grainSize(), 1000);
+
+    /* Zero is clamped */
+    policy.setGrainSize(0);
+    CORRADE_COMPARE(policy.grainSize(), 1);
+}
+
+void ExecutionPolicyTest::parallelForSerial() {
+    std::vector<Int> visited(10007);
+    std::atomic<std::size_t> callCount{0};
+    ExecutionPolicy{}.setGrainSize(100).parallelFor(visited.size(), Visit{visited, callCount});
+
+    CORRADE_COMPARE(callCount, 1);
+    CORRADE_COMPARE(visited, std::vector<Int>(10007, 1));
+}
+
+void ExecutionPolicyTest::parallelForBelowGrainSize() {
+    ThreadPool pool{4};
+    std::vector<Int> visited(1000);
+    std::atomic<std::size_t> callCount{0};
+    ExecutionPolicy{pool, 1000}.parallelFor(visited.size(), Visit{visited, callCount});
+
+    /* Processed at once on the calling thread */
+    CORRADE_COMPARE(callCount, 1);
+    CORRADE_COMPARE(visited, std::vector<Int>(1000, 1));
+}
+
+void ExecutionPolicyTest::parallelForPool() {
+    ThreadPool pool{4};
+
+    /* Count not divisible by the grain size */
+    std::vector<Int> visited(10007);
+    std::atomic<std::size_t> callCount{0};
+    ExecutionPolicy{pool, 100}.parallelFor(visited.size(), Visit{visited, callCount});
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_COMPARE(callCount, 101);
+    #endif
+    CORRADE_COMPARE(visited, std::vector<Int>(10007, 1));
+}
+
+void ExecutionPolicyTest::parallelForPoolRepeated() {
+    ThreadPool pool{3};
+    ExecutionPolicy policy{pool, 10};
+
+    std::vector<Int> visited(1001);
+    std::atomic<std::size_t> callCount{0};
+    for(std::size_t i = 0; i != 100; ++i)
+        policy.parallelFor(visited.size(), Visit{visited, callCount});
+
+    CORRADE_COMPARE(visited, std::vector<Int>(1001, 100));
+}
+
+void ExecutionPolicyTest::parallelForSchedulerNested() {
+    TaskScheduler scheduler{4};
+    ExecutionPolicy policy{scheduler, 10};
+
+    /* Operations submitted from inside a running operation don't deadlock */
+    std::vector<Int> visited(1000);
+    std::atomic<std::size_t> callCount{0};
+    policy.parallelFor(100, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            ExecutionPolicy{scheduler, 10}.parallelFor(10, [&visited, i](const std::size_t innerBegin, const std::size_t innerEnd) {
+                for(std::size_t j = innerBegin; j != innerEnd; ++j) ++visited[i*10 + j];
+            });
+        callCount += end - begin;
+    });
+
+    CORRADE_COMPARE(callCount, 100);
+    CORRADE_COMPARE(visited, std::vector<Int>(1000, 1));
+}
+
+void ExecutionPolicyTest::parallelForThreads() {
+    std::vector<Int> visited(10007);
+    std::atomic<std::size_t> callCount{0};
+    ExecutionPolicy{3, 100}.parallelFor(visited.size(), Visit{visited, callCount});
+
+    /* Equally large parts for each thread */
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_COMPARE(callCount, 3);
+    #endif
+    CORRADE_COMPARE(visited, std::vector<Int>(10007, 1));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::ExecutionPolicyTest)
@@ -0,0 +1,131 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/GenerateSmoothNormals.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateSmoothNormalsTest: TestSuite::Tester {
+    explicit GenerateSmoothNormalsTest();
+
+    void wrongIndexCount();
+    void generate();
+    void crease();
+    void threaded();
+};
+
+GenerateSmoothNormalsTest::GenerateSmoothNormalsTest() {
+    addTests({&GenerateSmoothNormalsTest::wrongIndexCount,
+              &GenerateSmoothNormalsTest::generate,
+              &GenerateSmoothNormalsTest::crease,
+              &GenerateSmoothNormalsTest::threaded});
+}
+
+namespace {
+
+/* Roof with ridge along Z, the two faces are at right angle */
+const std::vector<UnsignedInt> RoofIndices{
+    0, 2, 1,
+    0, 1, 3
+};
+
+const std::vector<Vector3> RoofPositions{
+    {0.0f, 1.0f, 0.0f},
+    {0.0f, 1.0f, 1.0f},
+    {-1.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f}
+};
+
+}
+
+void GenerateSmoothNormalsTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> normals;
+    std::tie(indices, normals) = MeshTools::generateSmoothNormals({
+        0, 1
+    }, {{}, {}});
+
+    CORRADE_COMPARE(indices.size(), 0);
+    CORRADE_COMPARE(normals.size(), 0);
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateSmoothNormals(): index count is not divisible by 3\n");
+}
+
+void GenerateSmoothNormalsTest::generate() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> normals;
+    std::tie(indices, normals) = MeshTools::generateSmoothNormals(RoofIndices, RoofPositions);
+
+    /* The ridge vertices are shared by both faces with equal angles, so they
+       point straight up, the others have the face normal */
+    CORRADE_COMPARE(indices.size(), 6);
+    CORRADE_COMPARE(normals.size(), 3);
+    CORRADE_COMPARE(normals[indices[0]], Vector3::yAxis());
+    CORRADE_COMPARE(normals[indices[1]], Vector3(-1.0f, 1.0f, 0.0f).normalized());
+    CORRADE_COMPARE(normals[indices[2]], Vector3::yAxis());
+    CORRADE_COMPARE(normals[indices[3]], Vector3::yAxis());
+    CORRADE_COMPARE(normals[indices[4]], Vector3::yAxis());
+    CORRADE_COMPARE(normals[indices[5]], Vector3(1.0f, 1.0f, 0.0f).normalized());
+}
+
+void GenerateSmoothNormalsTest::crease() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> normals;
+    std::tie(indices, normals) = MeshTools::generateSmoothNormals(RoofIndices, RoofPositions, Deg(60.0f));
+
+    /* The faces are at right angle, so they don't get smoothed together */
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 0, 0,
+        1, 1, 1
+    }));
+    CORRADE_COMPARE(normals, (std::vector<Vector3>{
+        Vector3(-1.0f, 1.0f, 0.0f).normalized(),
+        Vector3(1.0f, 1.0f, 0.0f).normalized()
+    }));
+}
+
+void GenerateSmoothNormalsTest::threaded() {
+    std::vector<UnsignedInt> indices, indicesThreaded;
+    std::vector<Vector3> normals, normalsThreaded;
+    std::tie(indices, normals) = MeshTools::generateSmoothNormals(RoofIndices, RoofPositions);
+
+    /* More threads than vertices */
+    std::tie(indicesThreaded, normalsThreaded) = MeshTools::generateSmoothNormals(RoofIndices, RoofPositions, Rad(Constants::pi()), 7);
+    CORRADE_COMPARE(indicesThreaded, indices);
+    CORRADE_COMPARE(normalsThreaded, normals);
+
+    std::tie(indicesThreaded, normalsThreaded) = MeshTools::generateSmoothNormals(RoofIndices, RoofPositions, Rad(Constants::pi()), 2);
+    CORRADE_COMPARE(indicesThreaded, indices);
+    CORRADE_COMPARE(normalsThreaded, normals);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateSmoothNormalsTest)
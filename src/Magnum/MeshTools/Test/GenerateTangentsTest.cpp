@@ -0,0 +1,127 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/MeshTools/GenerateTangents.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateTangentsTest: TestSuite::Tester {
+    explicit GenerateTangentsTest();
+
+    void wrongIndexCount();
+    void wrongAttributeCount();
+    void generate();
+    void mirrored();
+    void degenerate();
+};
+
+GenerateTangentsTest::GenerateTangentsTest() {
+    addTests({&GenerateTangentsTest::wrongIndexCount,
+              &GenerateTangentsTest::wrongAttributeCount,
+              &GenerateTangentsTest::generate,
+              &GenerateTangentsTest::mirrored,
+              &GenerateTangentsTest::degenerate});
+}
+
+namespace {
+
+/* Unit quad in XY plane facing +Z */
+const std::vector<UnsignedInt> QuadIndices{
+    0, 1, 2,
+    0, 2, 3
+};
+
+const std::vector<Vector3> QuadPositions{
+    {0.0f, 0.0f, 0.0f},
+    {1.0f, 0.0f, 0.0f},
+    {1.0f, 1.0f, 0.0f},
+    {0.0f, 1.0f, 0.0f}
+};
+
+const std::vector<Vector3> QuadNormals(4, Vector3::zAxis());
+
+}
+
+void GenerateTangentsTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+    const std::vector<Vector4> tangents = MeshTools::generateTangents({0, 1}, {}, {}, {});
+
+    CORRADE_VERIFY(tangents.empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateTangents(): index count is not divisible by 3\n");
+}
+
+void GenerateTangentsTest::wrongAttributeCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+    const std::vector<Vector4> tangents = MeshTools::generateTangents(QuadIndices, QuadPositions, QuadNormals, {{}});
+
+    CORRADE_VERIFY(tangents.empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateTangents(): expected 4 normals and texture coordinates but got 4 and 1\n");
+}
+
+void GenerateTangentsTest::generate() {
+    const std::vector<Vector4> tangents = MeshTools::generateTangents(QuadIndices, QuadPositions, QuadNormals, {
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {1.0f, 1.0f},
+        {0.0f, 1.0f}
+    });
+
+    CORRADE_COMPARE(tangents, (std::vector<Vector4>(4, {1.0f, 0.0f, 0.0f, 1.0f})));
+}
+
+void GenerateTangentsTest::mirrored() {
+    /* Texture mirrored horizontally, the tangent points to -X and the
+       bitangent (still +Y) has to be reconstructed with negative sign */
+    const std::vector<Vector4> tangents = MeshTools::generateTangents(QuadIndices, QuadPositions, QuadNormals, {
+        {1.0f, 0.0f},
+        {0.0f, 0.0f},
+        {0.0f, 1.0f},
+        {1.0f, 1.0f}
+    });
+
+    CORRADE_COMPARE(tangents, (std::vector<Vector4>(4, {-1.0f, 0.0f, 0.0f, -1.0f})));
+}
+
+void GenerateTangentsTest::degenerate() {
+    /* All texture coordinates the same, any tangent perpendicular to the
+       normal is fine */
+    const std::vector<Vector4> tangents = MeshTools::generateTangents(QuadIndices, QuadPositions, QuadNormals, std::vector<Vector2>(4));
+
+    CORRADE_COMPARE(tangents.size(), 4);
+    for(const Vector4& tangent: tangents) {
+        CORRADE_VERIFY(tangent.xyz().isNormalized());
+        CORRADE_COMPARE(Math::dot(tangent.xyz(), Vector3::zAxis()), 0.0f);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateTangentsTest)
@@ -0,0 +1,115 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/MeshTools/GenerateWireframeVertexIndices.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateWireframeVertexIndicesTest: TestSuite::Tester {
+    explicit GenerateWireframeVertexIndicesTest();
+
+    void wrongIndexCount();
+    void indexOutOfRange();
+    void shared();
+    void duplicated();
+};
+
+GenerateWireframeVertexIndicesTest::GenerateWireframeVertexIndicesTest() {
+    addTests({&GenerateWireframeVertexIndicesTest::wrongIndexCount,
+              &GenerateWireframeVertexIndicesTest::indexOutOfRange,
+              &GenerateWireframeVertexIndicesTest::shared,
+              &GenerateWireframeVertexIndicesTest::duplicated});
+}
+
+void GenerateWireframeVertexIndicesTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+    std::vector<UnsignedInt> indices{0, 1};
+    std::vector<UnsignedInt> vertexMapping;
+    std::vector<Float> vertexIndices;
+    std::tie(vertexMapping, vertexIndices) = MeshTools::generateWireframeVertexIndices(indices, 2);
+
+    CORRADE_COMPARE(vertexMapping.size(), 0);
+    CORRADE_COMPARE(vertexIndices.size(), 0);
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateWireframeVertexIndices(): index count is not divisible by 3!\n");
+}
+
+void GenerateWireframeVertexIndicesTest::indexOutOfRange() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+    std::vector<UnsignedInt> indices{0, 1, 3};
+    MeshTools::generateWireframeVertexIndices(indices, 3);
+
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateWireframeVertexIndices(): index out of range\n");
+}
+
+void GenerateWireframeVertexIndicesTest::shared() {
+    /* Two triangles of a quad need no duplicates */
+    std::vector<UnsignedInt> indices{
+        0, 1, 2,
+        0, 2, 3
+    };
+    std::vector<UnsignedInt> vertexMapping;
+    std::vector<Float> vertexIndices;
+    std::tie(vertexMapping, vertexIndices) = MeshTools::generateWireframeVertexIndices(indices, 4);
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 1, 2,
+        0, 2, 3
+    }));
+    CORRADE_COMPARE(vertexMapping, (std::vector<UnsignedInt>{0, 1, 2, 3}));
+    CORRADE_COMPARE(vertexIndices, (std::vector<Float>{0.0f, 1.0f, 2.0f, 1.0f}));
+}
+
+void GenerateWireframeVertexIndicesTest::duplicated() {
+    /* Three faces of a tetrahedron, vertex 3 can't have the same corner in
+       the second and in the third face. The fourth face reuses the
+       duplicate. */
+    std::vector<UnsignedInt> indices{
+        0, 1, 2,
+        0, 1, 3,
+        0, 2, 3,
+        2, 3, 0
+    };
+    std::vector<UnsignedInt> vertexMapping;
+    std::vector<Float> vertexIndices;
+    std::tie(vertexMapping, vertexIndices) = MeshTools::generateWireframeVertexIndices(indices, 4);
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
+        0, 1, 2,
+        0, 1, 3,
+        0, 2, 4,
+        2, 4, 0
+    }));
+    CORRADE_COMPARE(vertexMapping, (std::vector<UnsignedInt>{0, 1, 2, 3, 3}));
+    CORRADE_COMPARE(vertexIndices, (std::vector<Float>{0.0f, 1.0f, 2.0f, 2.0f, 1.0f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateWireframeVertexIndicesTest)
@@ -29,6 +29,7 @@
 #include <Corrade/Utility/Debug.h>
 
 #include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Trade/StridedMeshData.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
 
@@ -41,8 +42,11 @@ struct InterleaveTest: Corrade::TestSuite::Tester {
     void strideGaps();
     void write();
     void writeGaps();
+    void writeStrided();
 
     void interleaveInto();
+    void interleavePolicy();
+    void interleaveIntoPolicy();
 };
 
 InterleaveTest::InterleaveTest() {
@@ -52,8 +56,11 @@ InterleaveTest::InterleaveTest() {
               &InterleaveTest::strideGaps,
               &InterleaveTest::write,
               &InterleaveTest::writeGaps,
+              &InterleaveTest::writeStrided,
 
-              &InterleaveTest::interleaveInto});
+              &InterleaveTest::interleaveInto,
+              &InterleaveTest::interleavePolicy,
+              &InterleaveTest::interleaveIntoPolicy});
 }
 
 void InterleaveTest::attributeCount() {
@@ -129,6 +136,28 @@ void InterleaveTest::writeGaps() {
     }
 }
 
+void InterleaveTest::writeStrided() {
+    /* Shorts interleaved with bytes, taking only the shorts */
+    const char source[] = {
+        0x06, 0x00, 0x7f, 0x7f,
+        0x07, 0x00, 0x7f, 0x7f,
+        0x08, 0x00, 0x7f, 0x7f
+    };
+    const Trade::StridedArrayReference<Short> shorts{source, 3, 4};
+    CORRADE_COMPARE(Implementation::AttributeCount{}(shorts), std::size_t(3));
+    CORRADE_COMPARE((Implementation::Stride{}(std::vector<Byte>(), shorts, 1)), std::size_t(4));
+
+    const Containers::Array<char> data = MeshTools::interleave(
+        std::vector<Byte>{0, 1, 2}, shorts, 1);
+
+    /* Same in both endians, the source is just copied */
+    CORRADE_COMPARE(std::vector<char>(data.begin(), data.end()), (std::vector<char>{
+        0x00, 0x06, 0x00, 0x00,
+        0x01, 0x07, 0x00, 0x00,
+        0x02, 0x08, 0x00, 0x00
+    }));
+}
+
 void InterleaveTest::interleaveInto() {
     auto data = Containers::Array<char>::from(
         0x11, 0x33, 0x55, 0x77, 0x11, 0x33, 0x55, 0x77, 0x11, 0x33, 0x55, 0x77,
@@ -158,6 +187,44 @@ void InterleaveTest::interleaveInto() {
     }
 }
 
+void InterleaveTest::interleavePolicy() {
+    std::vector<Byte> a;
+    std::vector<Short> b;
+    std::vector<Int> c;
+    for(Int i = 0; i != 1001; ++i) {
+        a.push_back(i%128);
+        b.push_back(-i);
+        c.push_back(i*1000);
+    }
+
+    ThreadPool pool{3};
+    const Containers::Array<char> expected = MeshTools::interleave(a, 3, b, c, 1);
+    const Containers::Array<char> actual = MeshTools::interleave(ExecutionPolicy{pool, 10}, a, 3, b, c, 1);
+    CORRADE_COMPARE(actual.size(), expected.size());
+    CORRADE_COMPARE((std::vector<char>{actual.begin(), actual.end()}),
+                    (std::vector<char>{expected.begin(), expected.end()}));
+}
+
+void InterleaveTest::interleaveIntoPolicy() {
+    std::vector<Short> a;
+    std::vector<Int> b;
+    for(Int i = 0; i != 1001; ++i) {
+        a.push_back(i);
+        b.push_back(-i);
+    }
+
+    /* Gaps are left untouched */
+    Containers::Array<char> expected(1001*8);
+    Containers::Array<char> actual(1001*8);
+    for(std::size_t i = 0; i != expected.size(); ++i) expected[i] = actual[i] = char(i%64);
+
+    ThreadPool pool{3};
+    MeshTools::interleaveInto(expected, a, 2, b);
+    MeshTools::interleaveInto(ExecutionPolicy{pool, 10}, actual, a, 2, b);
+    CORRADE_COMPARE((std::vector<char>{actual.begin(), actual.end()}),
+                    (std::vector<char>{expected.begin(), expected.end()}));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::InterleaveTest)
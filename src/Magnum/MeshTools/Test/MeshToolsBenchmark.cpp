@@ -0,0 +1,203 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <tuple>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/CombineIndexedArrays.h"
+#include "Magnum/MeshTools/CompressIndices.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Subdivide.h"
+#include "Magnum/MeshTools/Tipsify.h"
+#include "Magnum/Test/BenchmarkTester.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct MeshToolsBenchmark: Magnum::Test::BenchmarkTester {
+    explicit MeshToolsBenchmark();
+
+    void removeDuplicates();
+    void tipsify();
+    void interleave();
+    void compressIndices();
+    void combineIndexedArrays();
+    void subdivideRemoveDuplicates();
+    void subdivide();
+
+    private:
+        std::vector<UnsignedInt> _indices;
+        std::vector<Vector3> _positions;
+        std::vector<Vector3> _normals;
+        std::vector<Vector2> _textureCoordinates;
+
+        /* Per-face normals for the whole mesh, as it would come from a
+           non-smooth OBJ file */
+        std::vector<UnsignedInt> _faceNormalIndices;
+        std::vector<Vector3> _faceNormals;
+};
+
+namespace {
+    /* A 256x256 vertex grid, i.e. 65k vertices and 130k triangles, which is
+       roughly the size of a detailed character or terrain tile */
+    constexpr UnsignedInt GridSize = 256;
+    constexpr std::size_t Repeats = 4;
+}
+
+MeshToolsBenchmark::MeshToolsBenchmark() {
+    addTests({&MeshToolsBenchmark::removeDuplicates,
+              &MeshToolsBenchmark::tipsify,
+              &MeshToolsBenchmark::interleave,
+              &MeshToolsBenchmark::compressIndices,
+              &MeshToolsBenchmark::combineIndexedArrays,
+              &MeshToolsBenchmark::subdivideRemoveDuplicates,
+              &MeshToolsBenchmark::subdivide});
+
+    /* Slightly wavy grid */
+    for(UnsignedInt y = 0; y != GridSize; ++y) for(UnsignedInt x = 0; x != GridSize; ++x) {
+        const Float height = Math::sin(Rad(x*0.1f))*Math::cos(Rad(y*0.1f));
+        _positions.push_back({Float(x), height, Float(y)});
+        _normals.push_back(Vector3{-0.1f*height, 1.0f, 0.1f*height}.normalized());
+        _textureCoordinates.push_back(Vector2{Float(x), Float(y)}/Float(GridSize - 1));
+    }
+
+    /* Two triangles for each quad, in scanline order */
+    for(UnsignedInt y = 0; y != GridSize - 1; ++y) for(UnsignedInt x = 0; x != GridSize - 1; ++x) {
+        const UnsignedInt i = y*GridSize + x;
+        _indices.insert(_indices.end(), {i, i + GridSize, i + 1,
+                                         i + 1, i + GridSize, i + GridSize + 1});
+    }
+
+    for(std::size_t i = 0; i != _indices.size(); i += 3) {
+        const Vector3 normal = Math::cross(_positions[_indices[i + 1]] - _positions[_indices[i]],
+                                           _positions[_indices[i + 2]] - _positions[_indices[i]]).normalized();
+        const UnsignedInt index = _faceNormals.size();
+        _faceNormals.push_back(normal);
+        _faceNormalIndices.insert(_faceNormalIndices.end(), {index, index, index});
+    }
+}
+
+void MeshToolsBenchmark::removeDuplicates() {
+    /* Non-indexed mesh, each vertex is there six times on average */
+    const std::vector<Vector3> duplicated = duplicate(_indices, _positions);
+
+    std::vector<Vector3> data;
+    std::vector<UnsignedInt> indices;
+    benchmark("MeshTools::removeDuplicates(), per vertex:", duplicated.size(), Repeats, [&]() {
+        data = duplicated;
+        indices = MeshTools::removeDuplicates(data);
+    });
+
+    /* Use the results so the computation doesn't get optimized out */
+    CORRADE_COMPARE(data.size(), _positions.size());
+    CORRADE_COMPARE(indices.size(), duplicated.size());
+}
+
+void MeshToolsBenchmark::tipsify() {
+    std::vector<UnsignedInt> indices;
+    benchmark("MeshTools::tipsify(), per index:", _indices.size(), Repeats, [&]() {
+        indices = _indices;
+        MeshTools::tipsify(indices, _positions.size(), 24);
+    });
+
+    CORRADE_COMPARE(indices.size(), _indices.size());
+}
+
+void MeshToolsBenchmark::interleave() {
+    Containers::Array<char> data;
+    benchmark("MeshTools::interleave(), per vertex:", _positions.size(), Repeats, [&]() {
+        data = MeshTools::interleave(_positions, _normals, _textureCoordinates);
+    });
+
+    CORRADE_COMPARE(data.size(), _positions.size()*(sizeof(Vector3)*2 + sizeof(Vector2)));
+}
+
+void MeshToolsBenchmark::compressIndices() {
+    Containers::Array<char> data;
+    Mesh::IndexType type;
+    UnsignedInt start, end;
+    benchmark("MeshTools::compressIndices(), per index:", _indices.size(), Repeats, [&]() {
+        std::tie(data, type, start, end) = MeshTools::compressIndices(_indices);
+    });
+
+    /* 65k vertices don't fit into 16 bits */
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedInt);
+    CORRADE_COMPARE(end, _positions.size() - 1);
+}
+
+void MeshToolsBenchmark::combineIndexedArrays() {
+    std::vector<Vector3> positions, normals;
+    std::vector<UnsignedInt> indices;
+    benchmark("MeshTools::combineIndexedArrays(), per index:", _indices.size(), Repeats, [&]() {
+        positions = _positions;
+        normals = _faceNormals;
+        indices = MeshTools::combineIndexedArrays(
+            std::make_pair(std::cref(_indices), std::ref(positions)),
+            std::make_pair(std::cref(_faceNormalIndices), std::ref(normals)));
+    });
+
+    /* Each face has its own vertices */
+    CORRADE_COMPARE(indices.size(), _indices.size());
+    CORRADE_COMPARE(positions.size(), _indices.size());
+    CORRADE_COMPARE(normals.size(), positions.size());
+}
+
+void MeshToolsBenchmark::subdivideRemoveDuplicates() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    benchmark("MeshTools::subdivide() + removeDuplicates(), per index:", _indices.size(), Repeats, [&]() {
+        indices = _indices;
+        positions = _positions;
+        MeshTools::subdivide(indices, positions, [](const Vector3& a, const Vector3& b) {
+            return (a + b)*0.5f;
+        });
+        const std::vector<UnsignedInt> unique = MeshTools::removeDuplicates(positions);
+        for(UnsignedInt& index: indices) index = unique[index];
+    });
+
+    CORRADE_COMPARE(indices.size(), _indices.size()*4);
+}
+
+void MeshToolsBenchmark::subdivide() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    benchmark("MeshTools::subdivide() with shared edges, per index:", _indices.size(), Repeats, [&]() {
+        indices = _indices;
+        positions = _positions;
+        MeshTools::subdivide(indices, positions, 1, [](const Vector3& a, const Vector3& b) {
+            return (a + b)*0.5f;
+        });
+    });
+
+    CORRADE_COMPARE(indices.size(), _indices.size()*4);
+    CORRADE_COMPARE(positions.size(), (GridSize*2 - 1)*(GridSize*2 - 1));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::MeshToolsBenchmark)
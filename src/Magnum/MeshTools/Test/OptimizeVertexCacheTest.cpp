@@ -0,0 +1,100 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <array>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/AnalyzeVertexCache.h"
+#include "Magnum/MeshTools/OptimizeVertexCache.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct OptimizeVertexCacheTest: TestSuite::Tester {
+    explicit OptimizeVertexCacheTest();
+
+    void empty();
+    void optimize();
+};
+
+OptimizeVertexCacheTest::OptimizeVertexCacheTest() {
+    addTests({&OptimizeVertexCacheTest::empty,
+              &OptimizeVertexCacheTest::optimize});
+}
+
+namespace {
+    /* Sorted triangles with the smallest vertex index first, to compare
+       triangle sets regardless of order */
+    std::vector<std::array<UnsignedInt, 3>> triangles(const std::vector<UnsignedInt>& indices) {
+        std::vector<std::array<UnsignedInt, 3>> out;
+        for(std::size_t i = 0; i != indices.size(); i += 3) {
+            std::array<UnsignedInt, 3> t{{indices[i], indices[i + 1], indices[i + 2]}};
+            std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+            out.push_back(t);
+        }
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+}
+
+void OptimizeVertexCacheTest::empty() {
+    std::vector<UnsignedInt> indices;
+    MeshTools::optimizeVertexCache(indices, 0);
+    CORRADE_VERIFY(indices.empty());
+}
+
+void OptimizeVertexCacheTest::optimize() {
+    /* 32x32 vertex grid with triangles in scattered order */
+    constexpr UnsignedInt Size = 32;
+    constexpr UnsignedInt TriangleCount = (Size - 1)*(Size - 1)*2;
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt i = 0; i != TriangleCount; ++i) {
+        /* 997 is a prime, so this goes through all triangles */
+        const UnsignedInt t = (i*997)%TriangleCount;
+        const UnsignedInt quad = t/2;
+        const UnsignedInt v = (quad/(Size - 1))*Size + quad%(Size - 1);
+        if(t%2) indices.insert(indices.end(), {v, v + Size, v + 1});
+        else indices.insert(indices.end(), {v + 1, v + Size, v + Size + 1});
+    }
+
+    const auto original = triangles(indices);
+    const Float originalAcmr = MeshTools::analyzeVertexCache(indices, Size*Size, 16).acmr;
+
+    MeshTools::optimizeVertexCache(indices, Size*Size);
+
+    /* The triangles stay the same, including winding */
+    CORRADE_COMPARE(indices.size(), TriangleCount*3);
+    CORRADE_VERIFY(triangles(indices) == original);
+
+    /* The result should be close to ideal 0.5 */
+    const Float acmr = MeshTools::analyzeVertexCache(indices, Size*Size, 16).acmr;
+    CORRADE_VERIFY(acmr < originalAcmr);
+    CORRADE_VERIFY(acmr < 0.8f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeVertexCacheTest)
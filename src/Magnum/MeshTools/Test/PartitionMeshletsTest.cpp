@@ -0,0 +1,161 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <array>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/MeshTools/PartitionMeshlets.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct PartitionMeshletsTest: TestSuite::Tester {
+    explicit PartitionMeshletsTest();
+
+    void empty();
+    void partition();
+    void limits();
+    void cone();
+};
+
+PartitionMeshletsTest::PartitionMeshletsTest() {
+    addTests({&PartitionMeshletsTest::empty,
+              &PartitionMeshletsTest::partition,
+              &PartitionMeshletsTest::limits,
+              &PartitionMeshletsTest::cone});
+}
+
+namespace {
+
+/* Grid of size x size quads in XY plane facing +Z */
+void grid(const UnsignedInt size, std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+    for(UnsignedInt y = 0; y <= size; ++y)
+        for(UnsignedInt x = 0; x <= size; ++x)
+            positions.emplace_back(Float(x), Float(y), 0.0f);
+    for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+        const UnsignedInt a = y*(size + 1) + x, b = a + 1, c = a + size + 2, d = a + size + 1;
+        indices.insert(indices.end(), {a, b, c, a, c, d});
+    }
+}
+
+std::vector<std::array<UnsignedInt, 3>> sortedTriangles(const std::vector<UnsignedInt>& indices) {
+    std::vector<std::array<UnsignedInt, 3>> triangles;
+    for(std::size_t i = 0; i != indices.size(); i += 3)
+        triangles.push_back({{indices[i], indices[i + 1], indices[i + 2]}});
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+}
+
+void PartitionMeshletsTest::empty() {
+    std::vector<UnsignedInt> indices;
+    CORRADE_VERIFY(MeshTools::partitionMeshlets(indices, {}).empty());
+    CORRADE_VERIFY(indices.empty());
+}
+
+void PartitionMeshletsTest::partition() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(16, indices, positions);
+    const std::vector<UnsignedInt> original = indices;
+
+    const std::vector<Meshlet> meshlets = MeshTools::partitionMeshlets(indices, positions);
+
+    /* The triangles are only reordered, with the same winding */
+    CORRADE_COMPARE(sortedTriangles(indices), sortedTriangles(original));
+
+    /* 512 triangles, at least five meshlets are needed */
+    CORRADE_VERIFY(meshlets.size() >= 5);
+
+    /* The meshlets cover the whole index array */
+    UnsignedInt offset = 0;
+    for(const Meshlet& meshlet: meshlets) {
+        CORRADE_COMPARE(meshlet.indexOffset, offset);
+        offset += meshlet.indexCount;
+
+        const auto begin = indices.begin() + meshlet.indexOffset;
+        const auto end = begin + meshlet.indexCount;
+        CORRADE_COMPARE(meshlet.vertexStart, *std::min_element(begin, end));
+        CORRADE_COMPARE(meshlet.vertexEnd, *std::max_element(begin, end));
+
+        /* All vertices are inside the bounding sphere */
+        for(auto it = begin; it != end; ++it)
+            CORRADE_VERIFY((positions[*it] - meshlet.center).length() <= meshlet.radius*1.0001f);
+
+        /* Flat grid, so zero-width cone pointing up, backfacing only when
+           looking from below */
+        CORRADE_COMPARE(meshlet.coneAxis, Vector3::zAxis());
+        CORRADE_COMPARE(meshlet.coneCutoff, 0.0f);
+        CORRADE_VERIFY(meshlet.isBackfacing(meshlet.center - Vector3::zAxis(100.0f)));
+        CORRADE_VERIFY(!meshlet.isBackfacing(meshlet.center + Vector3::zAxis(100.0f)));
+    }
+    CORRADE_COMPARE(offset, indices.size());
+}
+
+void PartitionMeshletsTest::limits() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(16, indices, positions);
+
+    const std::vector<Meshlet> meshlets = MeshTools::partitionMeshlets(indices, positions, 16, 10);
+    CORRADE_VERIFY(meshlets.size() >= 52);
+    for(const Meshlet& meshlet: meshlets) {
+        CORRADE_VERIFY(meshlet.indexCount <= 30);
+
+        std::vector<UnsignedInt> vertices{indices.begin() + meshlet.indexOffset, indices.begin() + meshlet.indexOffset + meshlet.indexCount};
+        std::sort(vertices.begin(), vertices.end());
+        CORRADE_VERIFY(std::unique(vertices.begin(), vertices.end()) - vertices.begin() <= 16);
+    }
+}
+
+void PartitionMeshletsTest::cone() {
+    /* Two triangles forming a roof with faces at right angle */
+    std::vector<UnsignedInt> indices{
+        0, 2, 1,
+        0, 1, 3
+    };
+    const std::vector<Vector3> positions{
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, 1.0f, 1.0f},
+        {-1.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f}
+    };
+
+    const std::vector<Meshlet> meshlets = MeshTools::partitionMeshlets(indices, positions);
+    CORRADE_COMPARE(meshlets.size(), 1);
+    CORRADE_COMPARE(meshlets[0].indexCount, 6);
+    CORRADE_COMPARE(meshlets[0].coneAxis, Vector3::yAxis());
+    CORRADE_COMPARE(meshlets[0].coneCutoff, Constants::sqrt2()/2.0f);
+
+    /* Looking from below at the roof, both faces are backfacing. Looking
+       from the side one face is visible. */
+    CORRADE_VERIFY(meshlets[0].isBackfacing({0.0f, -100.0f, 0.5f}));
+    CORRADE_VERIFY(!meshlets[0].isBackfacing({-100.0f, 0.0f, 0.5f}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::PartitionMeshletsTest)
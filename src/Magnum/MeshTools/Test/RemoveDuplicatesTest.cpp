@@ -23,9 +23,10 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
-#include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
@@ -34,10 +35,18 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     explicit RemoveDuplicatesTest();
 
     void removeDuplicates();
+    void removeDuplicatesEmpty();
+    void removeDuplicatesCellBoundary();
+    void removeDuplicatesMultipleAttributes();
+    void removeDuplicatesMultipleAttributesWrongSize();
 };
 
 RemoveDuplicatesTest::RemoveDuplicatesTest() {
-    addTests({&RemoveDuplicatesTest::removeDuplicates});
+    addTests({&RemoveDuplicatesTest::removeDuplicates,
+              &RemoveDuplicatesTest::removeDuplicatesEmpty,
+              &RemoveDuplicatesTest::removeDuplicatesCellBoundary,
+              &RemoveDuplicatesTest::removeDuplicatesMultipleAttributes,
+              &RemoveDuplicatesTest::removeDuplicatesMultipleAttributesWrongSize});
 }
 
 void RemoveDuplicatesTest::removeDuplicates() {
@@ -59,6 +68,83 @@ void RemoveDuplicatesTest::removeDuplicates() {
     }));
 }
 
+void RemoveDuplicatesTest::removeDuplicatesEmpty() {
+    std::vector<Vector2> data;
+    CORRADE_COMPARE(MeshTools::removeDuplicates(data), std::vector<UnsignedInt>{});
+    CORRADE_VERIFY(data.empty());
+}
+
+void RemoveDuplicatesTest::removeDuplicatesCellBoundary() {
+    /* With minimum at 0 the cell boundary is at 1.0, the first two should be
+       merged even though they are in different cells, the third is too far
+       from both */
+    std::vector<Vector3> data{
+        {0.0f, 0.0f, 0.0f},
+        {0.99f, 2.5f, 0.5f},
+        {1.01f, 2.5f, 0.5f},
+        {2.5f, 0.5f, 1.0f}
+    };
+
+    const std::vector<UnsignedInt> indices = MeshTools::removeDuplicates(data, 1.0f);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 1, 2}));
+    CORRADE_COMPARE(data, (std::vector<Vector3>{
+        {0.0f, 0.0f, 0.0f},
+        {0.99f, 2.5f, 0.5f},
+        {2.5f, 0.5f, 1.0f}
+    }));
+}
+
+void RemoveDuplicatesTest::removeDuplicatesMultipleAttributes() {
+    /* First two vertices have the same position, but different normal, the
+       last one is the same as the second one */
+    std::vector<Vector3> positions{
+        {1.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f}
+    };
+    std::vector<Vector3> normals{
+        Vector3::zAxis(),
+        Vector3::yAxis(),
+        Vector3::zAxis(),
+        Vector3::yAxis()
+    };
+    std::vector<Vector2> textureCoordinates{
+        {0.0f, 0.0f},
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {0.0f, 0.0f}
+    };
+
+    const std::vector<UnsignedInt> indices = MeshTools::removeDuplicates(positions, 1.0e-3f, normals, textureCoordinates);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 2, 1}));
+    CORRADE_COMPARE(positions, (std::vector<Vector3>{
+        {1.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}
+    }));
+    CORRADE_COMPARE(normals, (std::vector<Vector3>{
+        Vector3::zAxis(),
+        Vector3::yAxis(),
+        Vector3::zAxis()
+    }));
+    CORRADE_COMPARE(textureCoordinates, (std::vector<Vector2>{
+        {0.0f, 0.0f},
+        {0.0f, 0.0f},
+        {1.0f, 0.0f}
+    }));
+}
+
+void RemoveDuplicatesTest::removeDuplicatesMultipleAttributesWrongSize() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    std::vector<Vector3> positions(3);
+    std::vector<Vector3> normals(2);
+    MeshTools::removeDuplicates(positions, 1.0e-3f, normals);
+    CORRADE_COMPARE(out.str(), "MeshTools::removeDuplicates(): expected 3 items in all attribute arrays but got 2\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::RemoveDuplicatesTest)
@@ -0,0 +1,202 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Simplify.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct SimplifyTest: TestSuite::Tester {
+    explicit SimplifyTest();
+
+    void empty();
+    void flat();
+    void targetIndexCount();
+    void maxError();
+    void seam();
+    void generateLods();
+};
+
+SimplifyTest::SimplifyTest() {
+    addTests({&SimplifyTest::empty,
+              &SimplifyTest::flat,
+              &SimplifyTest::targetIndexCount,
+              &SimplifyTest::maxError,
+              &SimplifyTest::seam,
+              &SimplifyTest::generateLods});
+}
+
+namespace {
+
+/* Closed cube from -1 to 1 with each face split into 2x2 quads. The corners,
+   edge centers and face centers are shared, 26 vertices, 48 triangles. */
+std::vector<Vector3> cubePositions() {
+    std::vector<Vector3> positions;
+    for(Int z = -1; z <= 1; ++z) for(Int y = -1; y <= 1; ++y) for(Int x = -1; x <= 1; ++x)
+        if(x || y || z) positions.emplace_back(x, y, z);
+    return positions;
+}
+
+UnsignedInt cubeVertex(Int x, Int y, Int z) {
+    const UnsignedInt id = (z + 1)*9 + (y + 1)*3 + (x + 1);
+    /* The (0, 0, 0) vertex is not present */
+    return id > 13 ? id - 1 : id;
+}
+
+std::vector<UnsignedInt> cubeIndices() {
+    std::vector<UnsignedInt> indices;
+    for(Int axis = 0; axis != 3; ++axis) for(Int sign = -1; sign <= 1; sign += 2) {
+        for(Int u = -1; u != 1; ++u) for(Int v = -1; v != 1; ++v) {
+            const auto vertex = [&](Int a, Int b) {
+                Int c[3];
+                c[axis] = sign;
+                c[(axis + 1)%3] = a;
+                c[(axis + 2)%3] = b;
+                return cubeVertex(c[0], c[1], c[2]);
+            };
+            const UnsignedInt a = vertex(u, v), b = vertex(u + 1, v),
+                c = vertex(u + 1, v + 1), d = vertex(u, v + 1);
+            if(sign > 0) indices.insert(indices.end(), {a, b, c, a, c, d});
+            else indices.insert(indices.end(), {a, c, b, a, d, c});
+        }
+    }
+    return indices;
+}
+
+bool isCorner(const Vector3& position) {
+    return position.x() != 0.0f && position.y() != 0.0f && position.z() != 0.0f;
+}
+
+}
+
+void SimplifyTest::empty() {
+    std::vector<UnsignedInt> indices;
+    MeshTools::simplify(indices, {}, 0);
+    CORRADE_VERIFY(indices.empty());
+}
+
+void SimplifyTest::flat() {
+    const std::vector<Vector3> positions = cubePositions();
+    std::vector<UnsignedInt> indices = cubeIndices();
+    CORRADE_COMPARE(indices.size(), 144);
+
+    /* All flat areas get collapsed without introducing any error, only the
+       twelve triangles between the corners stay */
+    MeshTools::simplify(indices, positions, 0, 1.0e-4f);
+    CORRADE_COMPARE(indices.size(), 36);
+    for(const UnsignedInt index: indices)
+        CORRADE_VERIFY(isCorner(positions[index]));
+}
+
+void SimplifyTest::targetIndexCount() {
+    const std::vector<Vector3> positions = cubePositions();
+    std::vector<UnsignedInt> indices = cubeIndices();
+
+    /* Each collapse on closed mesh removes two triangles */
+    MeshTools::simplify(indices, positions, 72);
+    CORRADE_COMPARE(indices.size(), 72);
+
+    /* Nothing to do */
+    MeshTools::simplify(indices, positions, 72);
+    CORRADE_COMPARE(indices.size(), 72);
+}
+
+void SimplifyTest::maxError() {
+    std::vector<Vector3> positions = cubePositions();
+    const std::vector<UnsignedInt> original = cubeIndices();
+
+    /* Pull the +X face center outwards, making a bump */
+    const UnsignedInt center = cubeVertex(1, 0, 0);
+    positions[center].x() = 1.5f;
+
+    /* Removing the bump causes an error, so it stays */
+    std::vector<UnsignedInt> indices = original;
+    MeshTools::simplify(indices, positions, 0, 1.0e-4f);
+    CORRADE_VERIFY(indices.size() > 36);
+    CORRADE_VERIFY(std::find(indices.begin(), indices.end(), center) != indices.end());
+
+    /* With larger error allowed it gets flattened */
+    indices = original;
+    MeshTools::simplify(indices, positions, 36, 1.0f);
+    CORRADE_COMPARE(indices.size(), 36);
+    CORRADE_VERIFY(std::find(indices.begin(), indices.end(), center) == indices.end());
+}
+
+void SimplifyTest::seam() {
+    std::vector<Vector3> positions = cubePositions();
+    std::vector<UnsignedInt> indices = cubeIndices();
+
+    /* Split the +X face center into two vertices with the same position,
+       as if there was a texture coordinate seam going through it */
+    const UnsignedInt center = cubeVertex(1, 0, 0);
+    const UnsignedInt duplicate = positions.size();
+    positions.push_back(positions[center]);
+    std::size_t replaced = 0;
+    for(std::size_t i = 0; i != indices.size() && replaced != 2; ++i) {
+        if(indices[i] != center) continue;
+        /* Replace in whole triangles so the seam splits the face center */
+        const std::size_t triangle = i/3;
+        for(std::size_t j = 0; j != 3; ++j) if(indices[triangle*3 + j] == center) {
+            indices[triangle*3 + j] = duplicate;
+            ++replaced;
+        }
+    }
+    CORRADE_COMPARE(replaced, 2);
+
+    /* Both seam vertices are locked, so they are still referenced */
+    MeshTools::simplify(indices, positions, 0, 1.0e-4f);
+    CORRADE_VERIFY(indices.size() > 36);
+    CORRADE_VERIFY(std::find(indices.begin(), indices.end(), center) != indices.end());
+    CORRADE_VERIFY(std::find(indices.begin(), indices.end(), duplicate) != indices.end());
+}
+
+void SimplifyTest::generateLods() {
+    const Trade::MeshData3D mesh{MeshPrimitive::Triangles, cubeIndices(), {cubePositions()}, {cubePositions()}, {}};
+
+    const std::vector<Trade::MeshData3D> lods = MeshTools::generateLods(mesh, {1.0f, 0.5f, 0.25f});
+    CORRADE_COMPARE(lods.size(), 3);
+
+    CORRADE_COMPARE(lods[0].indices(), mesh.indices());
+    CORRADE_COMPARE(lods[1].indices().size(), 72);
+    CORRADE_COMPARE(lods[2].indices().size(), 36);
+
+    /* Vertex data are copied unchanged */
+    for(const Trade::MeshData3D& lod: lods) {
+        CORRADE_COMPARE(lod.primitive(), MeshPrimitive::Triangles);
+        CORRADE_COMPARE(lod.positionArrayCount(), 1);
+        CORRADE_COMPARE(lod.positions(0), mesh.positions(0));
+        CORRADE_COMPARE(lod.normalArrayCount(), 1);
+        CORRADE_COMPARE(lod.textureCoords2DArrayCount(), 0);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SimplifyTest)
@@ -0,0 +1,192 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/StaticBatch.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct StaticBatchTest: TestSuite::Tester {
+    explicit StaticBatchTest();
+
+    void empty();
+    void indexed();
+    void nonIndexed();
+    void normalsTextureCoordinates();
+    void differentAttributes();
+    void clear();
+};
+
+StaticBatchTest::StaticBatchTest() {
+    addTests({&StaticBatchTest::empty,
+              &StaticBatchTest::indexed,
+              &StaticBatchTest::nonIndexed,
+              &StaticBatchTest::normalsTextureCoordinates,
+              &StaticBatchTest::differentAttributes,
+              &StaticBatchTest::clear});
+}
+
+namespace {
+
+Trade::MeshData3D triangle() {
+    return Trade::MeshData3D{MeshPrimitive::Triangles, {0, 1, 2}, {{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}}}, {}, {}};
+}
+
+}
+
+void StaticBatchTest::empty() {
+    StaticBatch batch;
+    CORRADE_VERIFY(batch.isEmpty());
+    CORRADE_COMPARE(batch.vertexCount(), 0);
+    CORRADE_COMPARE(batch.indexCount(), 0);
+}
+
+void StaticBatchTest::indexed() {
+    StaticBatch batch;
+    CORRADE_COMPARE(batch.add(triangle(), Matrix4::translation({10.0f, 0.0f, 0.0f})), 0);
+    CORRADE_COMPARE(batch.add(triangle(), Matrix4::translation({0.0f, 0.0f, -5.0f})*Matrix4::scaling(Vector3{2.0f})), 1);
+
+    CORRADE_VERIFY(!batch.isEmpty());
+    CORRADE_COMPARE(batch.vertexCount(), 6);
+    CORRADE_COMPARE(batch.indexCount(), 6);
+
+    Trade::MeshData3D data = batch.meshData();
+    CORRADE_COMPARE(data.primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(!data.hasNormals());
+    CORRADE_VERIFY(!data.hasTextureCoords2D());
+    CORRADE_COMPARE(data.indices(), (std::vector<UnsignedInt>{0, 1, 2, 3, 4, 5}));
+    CORRADE_COMPARE(data.positions(0), (std::vector<Vector3>{
+        {10.0f, 0.0f, 0.0f},
+        {11.0f, 0.0f, 0.0f},
+        {10.0f, 1.0f, 0.0f},
+        {0.0f, 0.0f, -5.0f},
+        {2.0f, 0.0f, -5.0f},
+        {0.0f, 2.0f, -5.0f}}));
+
+    CORRADE_COMPARE(batch.ranges().size(), 2);
+    const StaticBatch::Range& first = batch.ranges()[0];
+    CORRADE_COMPARE(first.indexOffset, 0);
+    CORRADE_COMPARE(first.indexCount, 3);
+    CORRADE_COMPARE(first.vertexStart, 0);
+    CORRADE_COMPARE(first.vertexEnd, 2);
+    CORRADE_COMPARE(first.bounds, (Range3D{{10.0f, 0.0f, 0.0f}, {11.0f, 1.0f, 0.0f}}));
+
+    const StaticBatch::Range& second = batch.ranges()[1];
+    CORRADE_COMPARE(second.indexOffset, 3);
+    CORRADE_COMPARE(second.indexCount, 3);
+    CORRADE_COMPARE(second.vertexStart, 3);
+    CORRADE_COMPARE(second.vertexEnd, 5);
+    CORRADE_COMPARE(second.bounds, (Range3D{{0.0f, 0.0f, -5.0f}, {2.0f, 2.0f, -5.0f}}));
+}
+
+void StaticBatchTest::nonIndexed() {
+    StaticBatch batch;
+    batch.add(triangle(), {});
+    batch.add(Trade::MeshData3D{MeshPrimitive::Triangles, {}, {{
+        {0.0f, 0.0f, 1.0f},
+        {1.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 1.0f}}}, {}, {}}, {});
+
+    /* Non-indexed mesh gets sequential indices */
+    CORRADE_COMPARE(batch.meshData().indices(), (std::vector<UnsignedInt>{0, 1, 2, 3, 4, 5}));
+    CORRADE_COMPARE(batch.ranges()[1].indexOffset, 3);
+    CORRADE_COMPARE(batch.ranges()[1].indexCount, 3);
+    CORRADE_COMPARE(batch.ranges()[1].vertexStart, 3);
+    CORRADE_COMPARE(batch.ranges()[1].vertexEnd, 5);
+}
+
+void StaticBatchTest::normalsTextureCoordinates() {
+    StaticBatch batch;
+    batch.add(Trade::MeshData3D{MeshPrimitive::Triangles, {0, 1, 2}, {{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}}}, {{
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f}}}, {{
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {0.0f, 1.0f}}}},
+        Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::rotationX(Deg(90.0f))*Matrix4::scaling({1.0f, 4.0f, 1.0f}));
+
+    Trade::MeshData3D data = batch.meshData();
+    CORRADE_VERIFY(data.hasNormals());
+    CORRADE_VERIFY(data.hasTextureCoords2D());
+
+    /* Normals are rotated but stay normalized regardless of the scaling,
+       texture coordinates are untouched */
+    CORRADE_COMPARE(data.positions(0)[2], (Vector3{1.0f, 2.0f, 7.0f}));
+    CORRADE_COMPARE(data.normals(0), (std::vector<Vector3>{
+        {0.0f, -1.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f}}));
+    CORRADE_COMPARE(data.textureCoords2D(0), (std::vector<Vector2>{
+        {0.0f, 0.0f},
+        {1.0f, 0.0f},
+        {0.0f, 1.0f}}));
+}
+
+void StaticBatchTest::differentAttributes() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    StaticBatch batch;
+    batch.add(triangle(), {});
+    batch.add(Trade::MeshData3D{MeshPrimitive::Lines, {}, {{{}, {}}}, {}, {}}, {});
+    batch.add(Trade::MeshData3D{MeshPrimitive::Triangles, {0, 1, 2}, {{{}, {}, {}}}, {{{}, {}, {}}}, {}}, {});
+    batch.add(Trade::MeshData3D{MeshPrimitive::Triangles, {0, 1, 3}, {{{}, {}, {}}}, {}, {}}, {});
+
+    CORRADE_COMPARE(batch.ranges().size(), 1);
+    CORRADE_COMPARE(batch.vertexCount(), 3);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::StaticBatch::add(): the mesh has different primitive or attributes than the batch\n"
+        "MeshTools::StaticBatch::add(): the mesh has different primitive or attributes than the batch\n"
+        "MeshTools::StaticBatch::add(): index 3 out of bounds for 3 vertices\n");
+}
+
+void StaticBatchTest::clear() {
+    StaticBatch batch;
+    batch.add(triangle(), {});
+    batch.clear();
+    CORRADE_VERIFY(batch.isEmpty());
+    CORRADE_COMPARE(batch.vertexCount(), 0);
+    CORRADE_COMPARE(batch.indexCount(), 0);
+
+    /* Attributes of the batch can change after clearing */
+    batch.add(Trade::MeshData3D{MeshPrimitive::Lines, {}, {{{}, {}}}, {}, {}}, {});
+    CORRADE_COMPARE(batch.meshData().primitive(), MeshPrimitive::Lines);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::StaticBatchTest)
@@ -26,6 +26,7 @@
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Subdivide.h"
 
@@ -36,6 +37,11 @@ struct SubdivideTest: TestSuite::Tester {
 
     void wrongIndexCount();
     void subdivide();
+    void subdivideLevels();
+    void subdivideLevelsMultiple();
+    void subdivideLoopWrongIndexCount();
+    void subdivideLoop();
+    void subdivideLoopBoundary();
 };
 
 namespace {
@@ -48,7 +54,12 @@ inline Vector1 interpolator(Vector1 a, Vector1 b) { return (a[0]+b[0])/2; }
 
 SubdivideTest::SubdivideTest() {
     addTests({&SubdivideTest::wrongIndexCount,
-              &SubdivideTest::subdivide});
+              &SubdivideTest::subdivide,
+              &SubdivideTest::subdivideLevels,
+              &SubdivideTest::subdivideLevelsMultiple,
+              &SubdivideTest::subdivideLoopWrongIndexCount,
+              &SubdivideTest::subdivideLoop,
+              &SubdivideTest::subdivideLoopBoundary});
 }
 
 void SubdivideTest::wrongIndexCount() {
@@ -72,6 +83,80 @@ void SubdivideTest::subdivide() {
     CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{4, 5, 6, 7, 8, 9, 0, 4, 6, 4, 1, 5, 6, 5, 2, 1, 7, 9, 7, 2, 8, 9, 8, 3}));
 }
 
+void SubdivideTest::subdivideLevels() {
+    std::vector<Vector1> positions{0, 2, 6, 8};
+    std::vector<UnsignedInt> indices{0, 1, 2, 1, 2, 3};
+    MeshTools::subdivide(indices, positions, 1, interpolator);
+
+    /* Midpoint of the shared edge is there only once */
+    CORRADE_VERIFY(positions == (std::vector<Vector1>{0, 2, 6, 8, 1, 4, 3, 7, 5}));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{4, 5, 6, 5, 7, 8, 0, 4, 6, 4, 1, 5, 6, 5, 2, 1, 5, 8, 5, 2, 7, 8, 7, 3}));
+}
+
+void SubdivideTest::subdivideLevelsMultiple() {
+    std::vector<Vector1> positions{0, 2, 6, 8};
+    std::vector<UnsignedInt> indices{0, 1, 2, 1, 2, 3};
+    MeshTools::subdivide(indices, positions, 2, interpolator);
+
+    /* Same as removing duplicates after each level: 4 + 5 + 16 vertices */
+    CORRADE_COMPARE(indices.size(), 6*16);
+    CORRADE_COMPARE(positions.size(), 25);
+
+    std::vector<Vector1> positionsLevelByLevel{0, 2, 6, 8};
+    std::vector<UnsignedInt> indicesLevelByLevel{0, 1, 2, 1, 2, 3};
+    MeshTools::subdivide(indicesLevelByLevel, positionsLevelByLevel, 1, interpolator);
+    MeshTools::subdivide(indicesLevelByLevel, positionsLevelByLevel, 1, interpolator);
+    CORRADE_VERIFY(positions == positionsLevelByLevel);
+    CORRADE_COMPARE(indices, indicesLevelByLevel);
+}
+
+void SubdivideTest::subdivideLoopWrongIndexCount() {
+    std::stringstream ss;
+    Error::setOutput(&ss);
+
+    std::vector<Vector3> positions;
+    std::vector<UnsignedInt> indices{0, 1};
+    MeshTools::subdivideLoop(indices, positions, 1);
+    CORRADE_COMPARE(ss.str(), "MeshTools::subdivideLoop(): index count is not divisible by 3!\n");
+}
+
+void SubdivideTest::subdivideLoop() {
+    /* Regular tetrahedron centered at origin. Sum of all vertices is zero,
+       so both edge and original vertices end up at quarter of the distance
+       to the origin. */
+    std::vector<Vector3> positions{
+        { 1.0f,  1.0f,  1.0f},
+        { 1.0f, -1.0f, -1.0f},
+        {-1.0f,  1.0f, -1.0f},
+        {-1.0f, -1.0f,  1.0f}};
+    std::vector<UnsignedInt> indices{0, 1, 2, 0, 3, 1, 0, 2, 3, 1, 3, 2};
+    MeshTools::subdivideLoop(indices, positions, 1);
+
+    CORRADE_COMPARE(indices.size(), 48);
+    CORRADE_COMPARE(positions.size(), 10);
+    CORRADE_COMPARE(positions[0], (Vector3{0.25f, 0.25f, 0.25f}));
+    CORRADE_COMPARE(positions[3], (Vector3{-0.25f, -0.25f, 0.25f}));
+
+    /* Edge 0-1, 1-2 */
+    CORRADE_COMPARE(indices[0], 4);
+    CORRADE_COMPARE(positions[4], (Vector3{0.5f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(indices[1], 5);
+    CORRADE_COMPARE(positions[5], (Vector3{0.0f, 0.0f, -0.5f}));
+}
+
+void SubdivideTest::subdivideLoopBoundary() {
+    std::vector<Vector2> positions{{0.0f, 0.0f}, {4.0f, 0.0f}, {0.0f, 4.0f}};
+    std::vector<UnsignedInt> indices{0, 1, 2};
+    MeshTools::subdivideLoop(indices, positions, 1);
+
+    /* Boundary vertices are smoothed only along the boundary, boundary
+       edges are just interpolated */
+    CORRADE_COMPARE(positions, (std::vector<Vector2>{
+        {0.5f, 0.5f}, {3.0f, 0.5f}, {0.5f, 3.0f},
+        {2.0f, 0.0f}, {2.0f, 2.0f}, {0.0f, 2.0f}}));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{3, 4, 5, 0, 3, 5, 3, 1, 4, 5, 4, 2}));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SubdivideTest)
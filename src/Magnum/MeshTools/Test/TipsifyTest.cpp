@@ -35,6 +35,9 @@ struct TipsifyTest: TestSuite::Tester {
 
     void buildAdjacency();
     void tipsify();
+    void tipsifyScratch();
+    void tipsify16bit();
+    void tipsifyMultiple();
 };
 
 /*
@@ -79,11 +82,36 @@ namespace {
     };
 
     constexpr std::size_t VertexCount = 19;
+
+    const std::vector<UnsignedInt> Tipsified{
+        4, 1, 0,
+        9, 5, 4,
+        1, 4, 5,
+        9, 4, 8,
+        12, 9, 8,
+        13, 9, 12,
+        10, 9, 13,
+        13, 14, 10,
+        10, 6, 5,
+        10, 5, 9,
+        6, 10, 11,
+        14, 11, 10,
+        6, 3, 2,
+        11, 7, 6,
+        7, 3, 6,
+        6, 2, 5,
+        2, 1, 5,
+        14, 15, 11, /* from dead-end vertex stack */
+        16, 17, 18 /* arbitrary vertex */
+    };
 }
 
 TipsifyTest::TipsifyTest() {
     addTests({&TipsifyTest::buildAdjacency,
-              &TipsifyTest::tipsify});
+              &TipsifyTest::tipsify,
+              &TipsifyTest::tipsifyScratch,
+              &TipsifyTest::tipsify16bit,
+              &TipsifyTest::tipsifyMultiple});
 }
 
 void TipsifyTest::buildAdjacency() {
@@ -136,27 +164,46 @@ void TipsifyTest::tipsify() {
     std::vector<UnsignedInt> indices = Indices;
     MeshTools::tipsify(indices, VertexCount, 3);
 
-    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{
-        4, 1, 0,
-        9, 5, 4,
-        1, 4, 5,
-        9, 4, 8,
-        12, 9, 8,
-        13, 9, 12,
-        10, 9, 13,
-        13, 14, 10,
-        10, 6, 5,
-        10, 5, 9,
-        6, 10, 11,
-        14, 11, 10,
-        6, 3, 2,
-        11, 7, 6,
-        7, 3, 6,
-        6, 2, 5,
-        2, 1, 5,
-        14, 15, 11, /* from dead-end vertex stack */
-        16, 17, 18 /* arbitrary vertex */
-    }));
+    CORRADE_COMPARE(indices, Tipsified);
+}
+
+void TipsifyTest::tipsifyScratch() {
+    TipsifyScratch scratch;
+
+    /* Larger mesh first, the smaller one should reuse the memory without
+       any leftovers affecting the result */
+    std::vector<UnsignedInt> indices = Indices;
+    MeshTools::tipsify(indices, VertexCount, 3, scratch);
+    CORRADE_COMPARE(indices, Tipsified);
+
+    std::vector<UnsignedInt> small{2, 1, 0, 1, 2, 3};
+    MeshTools::tipsify(small, 4, 3, scratch);
+    CORRADE_COMPARE(small, (std::vector<UnsignedInt>{2, 1, 0, 1, 2, 3}));
+
+    indices = Indices;
+    MeshTools::tipsify(indices, VertexCount, 3, scratch);
+    CORRADE_COMPARE(indices, Tipsified);
+
+    scratch.clear();
+    indices = Indices;
+    MeshTools::tipsify(indices, VertexCount, 3, scratch);
+    CORRADE_COMPARE(indices, Tipsified);
+}
+
+void TipsifyTest::tipsify16bit() {
+    std::vector<UnsignedShort> indices(Indices.begin(), Indices.end());
+    MeshTools::tipsify(indices, VertexCount, 3);
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedShort>(Tipsified.begin(), Tipsified.end())));
+}
+
+void TipsifyTest::tipsifyMultiple() {
+    std::vector<std::vector<UnsignedInt>> meshes(5, Indices);
+    std::vector<std::reference_wrapper<std::vector<UnsignedInt>>> references(meshes.begin(), meshes.end());
+    MeshTools::tipsify(references, std::vector<UnsignedInt>(5, VertexCount), 3, 3);
+
+    for(const std::vector<UnsignedInt>& indices: meshes)
+        CORRADE_COMPARE(indices, Tipsified);
 }
 
 }}}
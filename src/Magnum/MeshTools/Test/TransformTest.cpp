@@ -24,6 +24,7 @@
 */
 
 #include <array>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Matrix3.h"
@@ -40,6 +41,12 @@ struct TransformTest: TestSuite::Tester {
 
     void transformPoints2D();
     void transformPoints3D();
+
+    void transformVectorsStrided();
+    void transformPointsStrided();
+    void transformPointsStridedThreaded();
+    void transformPointsStridedPolicy();
+    void transformNormalsStrided();
 };
 
 TransformTest::TransformTest() {
@@ -47,7 +54,13 @@ TransformTest::TransformTest() {
               &TransformTest::transformVectors3D,
 
               &TransformTest::transformPoints2D,
-              &TransformTest::transformPoints3D});
+              &TransformTest::transformPoints3D,
+
+              &TransformTest::transformVectorsStrided,
+              &TransformTest::transformPointsStrided,
+              &TransformTest::transformPointsStridedThreaded,
+              &TransformTest::transformPointsStridedPolicy,
+              &TransformTest::transformNormalsStrided});
 }
 
 constexpr static std::array<Vector2, 2> points2D{{
@@ -116,6 +129,101 @@ void TransformTest::transformPoints3D() {
     CORRADE_COMPARE(quaternion, points3DRotatedTranslated);
 }
 
+namespace {
+    struct Vertex {
+        Vector3 position;
+        Vector2 textureCoordinates;
+    };
+}
+
+void TransformTest::transformVectorsStrided() {
+    Vertex matrix[]{
+        {points3D[0], {0.5f, 1.0f}},
+        {points3D[1], {1.5f, 2.0f}}
+    };
+    Vertex quaternion[]{
+        {points3D[0], {0.5f, 1.0f}},
+        {points3D[1], {1.5f, 2.0f}}
+    };
+    MeshTools::transformVectorsInPlace(Matrix4::rotationZ(Deg(90.0f)), &matrix[0].position, 2, sizeof(Vertex));
+    MeshTools::transformVectorsInPlace(Quaternion::rotation(Deg(90.0f), Vector3::zAxis()), &quaternion[0].position, 2, sizeof(Vertex));
+
+    CORRADE_COMPARE(matrix[0].position, points3DRotated[0]);
+    CORRADE_COMPARE(matrix[1].position, points3DRotated[1]);
+    CORRADE_COMPARE(quaternion[0].position, points3DRotated[0]);
+    CORRADE_COMPARE(quaternion[1].position, points3DRotated[1]);
+
+    /* Data between the vectors are not touched */
+    CORRADE_COMPARE(matrix[0].textureCoordinates, Vector2(0.5f, 1.0f));
+    CORRADE_COMPARE(matrix[1].textureCoordinates, Vector2(1.5f, 2.0f));
+}
+
+void TransformTest::transformPointsStrided() {
+    Vertex matrix[]{
+        {points3D[0], {0.5f, 1.0f}},
+        {points3D[1], {1.5f, 2.0f}}
+    };
+    Vertex quaternion[]{
+        {points3D[0], {0.5f, 1.0f}},
+        {points3D[1], {1.5f, 2.0f}}
+    };
+    MeshTools::transformPointsInPlace(
+        Matrix4::translation(Vector3::yAxis(-1.0f))*Matrix4::rotationZ(Deg(90.0f)), &matrix[0].position, 2, sizeof(Vertex));
+    MeshTools::transformPointsInPlace(
+        DualQuaternion::translation(Vector3::yAxis(-1.0f))*DualQuaternion::rotation(Deg(90.0f), Vector3::zAxis()), &quaternion[0].position, 2, sizeof(Vertex));
+
+    CORRADE_COMPARE(matrix[0].position, points3DRotatedTranslated[0]);
+    CORRADE_COMPARE(matrix[1].position, points3DRotatedTranslated[1]);
+    CORRADE_COMPARE(quaternion[0].position, points3DRotatedTranslated[0]);
+    CORRADE_COMPARE(quaternion[1].position, points3DRotatedTranslated[1]);
+    CORRADE_COMPARE(matrix[0].textureCoordinates, Vector2(0.5f, 1.0f));
+    CORRADE_COMPARE(matrix[1].textureCoordinates, Vector2(1.5f, 2.0f));
+}
+
+void TransformTest::transformPointsStridedThreaded() {
+    const Matrix4 transformation = Matrix4::translation({1.0f, -2.0f, 0.5f})*
+        Matrix4::rotationX(Deg(35.0f))*Matrix4::scaling({2.0f, 1.0f, 0.5f});
+
+    /* Count not divisible by thread count */
+    std::vector<Vector3> points;
+    for(std::size_t i = 0; i != 1001; ++i)
+        points.emplace_back(Float(i), 1.0f, -0.5f*i);
+    std::vector<Vector3> expected = MeshTools::transformPoints(transformation, points);
+
+    MeshTools::transformPointsInPlace(transformation, points.data(), points.size(), sizeof(Vector3), 3);
+    CORRADE_COMPARE(points, expected);
+}
+
+void TransformTest::transformPointsStridedPolicy() {
+    const Matrix4 transformation = Matrix4::translation({1.0f, -2.0f, 0.5f})*
+        Matrix4::rotationX(Deg(35.0f))*Matrix4::scaling({2.0f, 1.0f, 0.5f});
+
+    /* Count not divisible by the grain size */
+    std::vector<Vector3> points;
+    for(std::size_t i = 0; i != 1001; ++i)
+        points.emplace_back(Float(i), 1.0f, -0.5f*i);
+    std::vector<Vector3> expected = MeshTools::transformPoints(transformation, points);
+
+    ThreadPool pool{3};
+    MeshTools::transformPointsInPlace(ExecutionPolicy{pool, 64}, transformation, points.data(), points.size());
+    CORRADE_COMPARE(points, expected);
+}
+
+void TransformTest::transformNormalsStrided() {
+    /* Non-uniform scaling, a surface with normal (1, 1, 0) scaled twice in X
+       should end up with normal (1, 2, 0) */
+    Vertex normals[]{
+        {Vector3(1.0f, 1.0f, 0.0f).normalized(), {0.5f, 1.0f}},
+        {Vector3::zAxis(), {1.5f, 2.0f}}
+    };
+    MeshTools::transformNormalsInPlace(Matrix4::translation({5.0f, 3.0f, 1.0f})*
+        Matrix4::scaling({2.0f, 1.0f, 1.0f}), &normals[0].position, 2, sizeof(Vertex));
+
+    CORRADE_COMPARE(normals[0].position, Vector3(1.0f, 2.0f, 0.0f).normalized());
+    CORRADE_COMPARE(normals[1].position, Vector3::zAxis());
+    CORRADE_COMPARE(normals[0].textureCoordinates, Vector2(0.5f, 1.0f));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TransformTest)
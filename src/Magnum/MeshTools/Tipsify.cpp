@@ -25,37 +25,83 @@
 
 #include "Tipsify.h"
 
-#include <stack>
+#include <Corrade/Utility/Assert.h>
 
-namespace Magnum { namespace MeshTools { namespace Implementation {
+#include "Magnum/TaskScheduler.h"
 
-void Tipsify::operator()(std::size_t cacheSize) {
+namespace Magnum { namespace MeshTools {
+
+namespace Implementation {
+
+template<class T> struct TipsifyImplementation {
+    static void buildAdjacency(const std::vector<T>& indices, UnsignedInt vertexCount, std::vector<UnsignedInt>& liveTriangleCount, std::vector<UnsignedInt>& neighborOffset, std::vector<UnsignedInt>& neighbors);
+
+    static void run(std::vector<T>& indices, UnsignedInt vertexCount, std::size_t cacheSize, TipsifyScratch& scratch);
+};
+
+template<class T> void TipsifyImplementation<T>::buildAdjacency(const std::vector<T>& indices, const UnsignedInt vertexCount, std::vector<UnsignedInt>& liveTriangleCount, std::vector<UnsignedInt>& neighborOffset, std::vector<UnsignedInt>& neighbors) {
+    /* How many times is each vertex referenced == count of neighboring
+       triangles for each vertex */
+    liveTriangleCount.assign(vertexCount, 0);
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        ++liveTriangleCount[indices[i]];
+
+    /* Building offset array from counts. Neighbors for i-th vertex will at
+       the end be in interval neighbors[neighborOffset[i]] ;
+       neighbors[neighborOffset[i+1]]. Currently the values are shifted to
+       right, because the next loop will shift them back left. */
+    neighborOffset.resize(vertexCount+1);
+    neighborOffset[0] = 0;
+    UnsignedInt sum = 0;
+    for(std::size_t i = 0; i != vertexCount; ++i) {
+        neighborOffset[i+1] = sum;
+        sum += liveTriangleCount[i];
+    }
+
+    /* Array of neighbors, using (and changing) neighborOffset array for
+       positioning. All items get overwritten, so no need to clear it. */
+    neighbors.resize(sum);
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        neighbors[neighborOffset[indices[i]+1]++] = i/3;
+}
+
+template<class T> void TipsifyImplementation<T>::run(std::vector<T>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize, TipsifyScratch& scratch) {
     /* Neighboring triangles for each vertex, per-vertex live triangle count */
-    std::vector<UnsignedInt> liveTriangleCount, neighborPosition, neighbors;
-    buildAdjacency(liveTriangleCount, neighborPosition, neighbors);
+    std::vector<UnsignedInt>& liveTriangleCount = scratch._liveTriangleCount;
+    std::vector<UnsignedInt>& neighborPosition = scratch._neighborOffset;
+    std::vector<UnsignedInt>& neighbors = scratch._neighbors;
+    buildAdjacency(indices, vertexCount, liveTriangleCount, neighborPosition, neighbors);
 
     /* Global time, per-vertex caching timestamps, per-triangle emmited flag */
     UnsignedInt time = cacheSize+1;
-    std::vector<UnsignedInt> timestamp(vertexCount);
-    std::vector<bool> emitted(indices.size()/3);
+    std::vector<UnsignedInt>& timestamp = scratch._timestamp;
+    timestamp.assign(vertexCount, 0);
+    std::vector<bool>& emitted = scratch._emitted;
+    emitted.assign(indices.size()/3, false);
 
     /* Dead-end vertex stack */
-    std::stack<UnsignedInt> deadEndStack;
+    std::vector<UnsignedInt>& deadEndStack = scratch._deadEndStack;
+    deadEndStack.clear();
+
+    /* Array with candidates for next fanning vertex (in 1-ring around
+       fanning vertex) */
+    std::vector<UnsignedInt>& candidates = scratch._candidates;
 
     /* Output index buffer */
-    std::vector<UnsignedInt> outputIndices;
+    std::vector<UnsignedInt>& outputIndices = scratch._outputIndices;
+    outputIndices.clear();
     outputIndices.reserve(indices.size());
 
     /* Starting vertex for fanning, cursor */
     UnsignedInt fanningVertex = 0;
     UnsignedInt i = 0;
     while(fanningVertex != 0xFFFFFFFFu) {
-        /* Array with candidates for next fanning vertex (in 1-ring around
-           fanning vertex) */
-        std::vector<UnsignedInt> candidates;
+        candidates.clear();
 
         /* For all neighbors of fanning vertex */
-        for(UnsignedInt ti = neighborPosition[fanningVertex], t = neighbors[ti]; ti != neighborPosition[fanningVertex+1]; t = neighbors[++ti]) {
+        for(UnsignedInt ti = neighborPosition[fanningVertex]; ti != neighborPosition[fanningVertex+1]; ++ti) {
+            const UnsignedInt t = neighbors[ti];
+
             /* Continue if already emitted */
             if(emitted[t]) continue;
             emitted[t] = true;
@@ -68,7 +114,7 @@ void Tipsify::operator()(std::size_t cacheSize) {
 
                 /* Add to dead end stack and candidates array */
                 /** @todo Limit size of dead end stack to cache size */
-                deadEndStack.push(v);
+                deadEndStack.push_back(v);
                 candidates.push_back(v);
 
                 /* Decrease live triangle count */
@@ -105,8 +151,8 @@ void Tipsify::operator()(std::size_t cacheSize) {
         if(fanningVertex == 0xFFFFFFFFu) {
             /* Find vertex with live triangles in dead-end stack */
             while(!deadEndStack.empty()) {
-                unsigned int d = deadEndStack.top();
-                deadEndStack.pop();
+                const UnsignedInt d = deadEndStack.back();
+                deadEndStack.pop_back();
 
                 if(!liveTriangleCount[d]) continue;
                 fanningVertex = d;
@@ -124,38 +170,61 @@ void Tipsify::operator()(std::size_t cacheSize) {
         }
     }
 
-    /* Swap original index buffer with optimized */
-    using std::swap;
-    swap(indices, outputIndices);
+    /* Copy the optimized index buffer back, keeping the output array
+       allocated in the scratch memory for next use */
+    for(std::size_t j = 0; j != outputIndices.size(); ++j)
+        indices[j] = T(outputIndices[j]);
+}
+
+void Tipsify::operator()(std::size_t cacheSize) {
+    TipsifyScratch scratch;
+    TipsifyImplementation<UnsignedInt>::run(indices, vertexCount, cacheSize, scratch);
 }
 
 void Tipsify::buildAdjacency(std::vector<UnsignedInt>& liveTriangleCount, std::vector<UnsignedInt>& neighborOffset, std::vector<UnsignedInt>& neighbors) const {
-    /* How many times is each vertex referenced == count of neighboring
-       triangles for each vertex */
-    liveTriangleCount.clear();
-    liveTriangleCount.resize(vertexCount);
-    for(std::size_t i = 0; i != indices.size(); ++i)
-        ++liveTriangleCount[indices[i]];
+    TipsifyImplementation<UnsignedInt>::buildAdjacency(indices, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+}
 
-    /* Building offset array from counts. Neighbors for i-th vertex will at
-       the end be in interval neighbors[neighborOffset[i]] ;
-       neighbors[neighborOffset[i+1]]. Currently the values are shifted to
-       right, because the next loop will shift them back left. */
-    neighborOffset.clear();
-    neighborOffset.reserve(vertexCount+1);
-    neighborOffset.push_back(0);
-    UnsignedInt sum = 0;
-    for(std::size_t i = 0; i != vertexCount; ++i) {
-        neighborOffset.push_back(sum);
-        sum += liveTriangleCount[i];
-    }
+}
 
-    /* Array of neighbors, using (and changing) neighborOffset array for
-       positioning */
-    neighbors.clear();
-    neighbors.resize(sum);
-    for(std::size_t i = 0; i != indices.size(); ++i)
-        neighbors[neighborOffset[indices[i]+1]++] = i/3;
+void TipsifyScratch::clear() {
+    *this = TipsifyScratch{};
+}
+
+void tipsify(std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize, TipsifyScratch& scratch) {
+    Implementation::TipsifyImplementation<UnsignedInt>::run(indices, vertexCount, cacheSize, scratch);
+}
+
+void tipsify(std::vector<UnsignedShort>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize, TipsifyScratch& scratch) {
+    Implementation::TipsifyImplementation<UnsignedShort>::run(indices, vertexCount, cacheSize, scratch);
+}
+
+void tipsify(std::vector<UnsignedShort>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    TipsifyScratch scratch;
+    Implementation::TipsifyImplementation<UnsignedShort>::run(indices, vertexCount, cacheSize, scratch);
+}
+
+namespace {
+
+void tipsifyRange(const std::vector<std::reference_wrapper<std::vector<UnsignedInt>>>& meshes, const std::vector<UnsignedInt>& vertexCounts, const std::size_t cacheSize, const std::size_t begin, const std::size_t end) {
+    TipsifyScratch scratch;
+    for(std::size_t i = begin; i != end; ++i)
+        Implementation::TipsifyImplementation<UnsignedInt>::run(meshes[i], vertexCounts[i], cacheSize, scratch);
+}
+
+}
+
+void tipsify(const std::vector<std::reference_wrapper<std::vector<UnsignedInt>>>& meshes, const std::vector<UnsignedInt>& vertexCounts, const std::size_t cacheSize, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(meshes.size() == vertexCounts.size(),
+        "MeshTools::tipsify(): expected" << meshes.size() << "vertex counts but got" << vertexCounts.size(), );
+    CORRADE_ASSERT(threadCount,
+        "MeshTools::tipsify(): expected at least one thread", );
+
+    /* At most threadCount ranges, each with its own scratch memory */
+    const std::size_t count = meshes.size();
+    TaskScheduler::global().parallelFor(count, (count + threadCount - 1)/threadCount, [&](const std::size_t begin, const std::size_t end) {
+        tipsifyRange(meshes, vertexCounts, cacheSize, begin, end);
+    });
 }
 
-}}}
+}}
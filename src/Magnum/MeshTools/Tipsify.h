@@ -26,9 +26,10 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::tipsify()
+ * @brief Class @ref Magnum::MeshTools::TipsifyScratch, function @ref Magnum::MeshTools::tipsify()
  */
 
+#include <functional>
 #include <vector>
 
 #include "Magnum/Types.h"
@@ -36,6 +37,32 @@
 
 namespace Magnum { namespace MeshTools {
 
+namespace Implementation {
+    template<class> struct TipsifyImplementation;
+}
+
+/**
+@brief Reusable scratch memory for @ref tipsify()
+
+Holds the adjacency and bookkeeping arrays used by @ref tipsify(). When
+optimizing many meshes in a row, passing the same instance to each call makes
+the memory allocated for the first (or largest) mesh reused by all subsequent
+calls instead of being allocated and freed again for each of them. The
+instance can't be shared between threads.
+@see @ref tipsify(std::vector<UnsignedInt>&, UnsignedInt, std::size_t, TipsifyScratch&)
+*/
+class MAGNUM_MESHTOOLS_EXPORT TipsifyScratch {
+    public:
+        /** @brief Free all allocated memory */
+        void clear();
+
+    private:
+        template<class> friend struct Implementation::TipsifyImplementation;
+
+        std::vector<UnsignedInt> _liveTriangleCount, _neighborOffset, _neighbors, _timestamp, _deadEndStack, _candidates, _outputIndices;
+        std::vector<bool> _emitted;
+};
+
 namespace Implementation {
 
 class MAGNUM_MESHTOOLS_EXPORT Tipsify {
@@ -77,6 +104,43 @@ inline void tipsify(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount,
     Implementation::Tipsify(indices, vertexCount)(cacheSize);
 }
 
+/**
+@brief Tipsify the mesh using reusable scratch memory
+
+Same as @ref tipsify(std::vector<UnsignedInt>&, UnsignedInt, std::size_t), but
+all temporary arrays are taken from @p scratch, which keeps the memory for
+subsequent calls.
+*/
+MAGNUM_MESHTOOLS_EXPORT void tipsify(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize, TipsifyScratch& scratch);
+
+/**
+@brief Tipsify the mesh with 16-bit indices
+
+Same as @ref tipsify(std::vector<UnsignedInt>&, UnsignedInt, std::size_t, TipsifyScratch&),
+but operating directly on 16-bit indices, without the need to expand them to
+32-bit first.
+*/
+MAGNUM_MESHTOOLS_EXPORT void tipsify(std::vector<UnsignedShort>& indices, UnsignedInt vertexCount, std::size_t cacheSize, TipsifyScratch& scratch);
+
+/** @overload */
+MAGNUM_MESHTOOLS_EXPORT void tipsify(std::vector<UnsignedShort>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+@brief Tipsify multiple meshes in parallel
+@param[in,out] meshes       Index arrays of the meshes to operate on
+@param[in] vertexCounts     Vertex count of each mesh
+@param[in] cacheSize        Post-transform vertex cache size
+@param[in] threadCount      Count of parts to split the work into
+
+Equivalent to calling @ref tipsify(std::vector<UnsignedInt>&, UnsignedInt, std::size_t)
+on each mesh. If @p threadCount is larger than `1`, the meshes are split into
+at most @p threadCount contiguous ranges processed in parallel on
+@ref TaskScheduler::global(), each of them with its own @ref TipsifyScratch.
+Expects that @p vertexCounts has the same size as @p meshes and that
+@p threadCount is not zero.
+*/
+MAGNUM_MESHTOOLS_EXPORT void tipsify(const std::vector<std::reference_wrapper<std::vector<UnsignedInt>>>& meshes, const std::vector<UnsignedInt>& vertexCounts, std::size_t cacheSize, UnsignedInt threadCount = 1);
+
 }}
 
 #endif
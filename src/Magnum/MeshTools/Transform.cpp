@@ -0,0 +1,148 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Transform.h"
+
+#include <Corrade/configure.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Implementation/Simd.h"
+#include "Magnum/MeshTools/ExecutionPolicy.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+enum class Kind { Point, Vector, Normal };
+
+/* Affine transformation of items in [begin, end), the translation is used
+   only for points and the result is normalized for normals */
+void transformRange(const Matrix4& matrix, const Kind kind, char* const data, const std::size_t stride, const std::size_t begin, const std::size_t end) {
+    #ifdef MAGNUM_MATH_SSE
+    /* Columns with the fourth component zeroed out, so the fourth component
+       of the result is always zero */
+    const __m128 c0 = _mm_setr_ps(matrix[0][0], matrix[0][1], matrix[0][2], 0.0f);
+    const __m128 c1 = _mm_setr_ps(matrix[1][0], matrix[1][1], matrix[1][2], 0.0f);
+    const __m128 c2 = _mm_setr_ps(matrix[2][0], matrix[2][1], matrix[2][2], 0.0f);
+    const __m128 c3 = kind == Kind::Point ?
+        _mm_setr_ps(matrix[3][0], matrix[3][1], matrix[3][2], 0.0f) : _mm_setzero_ps();
+
+    for(std::size_t i = begin; i != end; ++i) {
+        Float* const v = reinterpret_cast<Float*>(data + i*stride);
+        __m128 r = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(v[0])), _mm_mul_ps(c1, _mm_set1_ps(v[1]))),
+            _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(v[2])), c3));
+
+        if(kind == Kind::Normal) {
+            const __m128 m = _mm_mul_ps(r, r);
+            const __m128 s = _mm_add_ps(m, _mm_movehl_ps(m, m));
+            const __m128 length = _mm_sqrt_ps(_mm_add_ps(
+                _mm_shuffle_ps(s, s, _MM_SHUFFLE(0, 0, 0, 0)),
+                _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1))));
+            r = _mm_div_ps(r, length);
+        }
+
+        /* Store only three components to not overwrite the data after */
+        _mm_storel_pi(reinterpret_cast<__m64*>(v), r);
+        _mm_store_ss(v + 2, _mm_movehl_ps(r, r));
+    }
+    #else
+    const Vector3 c0 = matrix[0].xyz();
+    const Vector3 c1 = matrix[1].xyz();
+    const Vector3 c2 = matrix[2].xyz();
+    const Vector3 c3 = kind == Kind::Point ? matrix[3].xyz() : Vector3{};
+
+    for(std::size_t i = begin; i != end; ++i) {
+        Vector3& v = *reinterpret_cast<Vector3*>(data + i*stride);
+        v = c0*v.x() + c1*v.y() + c2*v.z() + c3;
+        if(kind == Kind::Normal) v = v.normalized();
+    }
+    #endif
+}
+
+void transform(const ExecutionPolicy& policy, const Matrix4& matrix, const Kind kind, Vector3* const items, const std::size_t count, const std::size_t stride) {
+    CORRADE_ASSERT(stride >= sizeof(Vector3),
+        "MeshTools::transform*InPlace(): expected stride to be at least" << sizeof(Vector3) << "bytes but got" << stride, );
+
+    char* const data = reinterpret_cast<char*>(items);
+    policy.parallelFor(count, [&](const std::size_t begin, const std::size_t end) {
+        transformRange(matrix, kind, data, stride, begin, end);
+    });
+}
+
+/* Equally large contiguous ranges for each thread */
+inline ExecutionPolicy threadPolicy(const UnsignedInt threadCount) {
+    return ExecutionPolicy{threadCount, 1};
+}
+
+}
+
+void transformVectorsInPlace(const ExecutionPolicy& policy, const Matrix4& matrix, Vector3* const vectors, const std::size_t count, const std::size_t stride) {
+    transform(policy, matrix, Kind::Vector, vectors, count, stride);
+}
+
+void transformVectorsInPlace(const Matrix4& matrix, Vector3* const vectors, const std::size_t count, const std::size_t stride, const UnsignedInt threadCount) {
+    transformVectorsInPlace(threadPolicy(threadCount), matrix, vectors, count, stride);
+}
+
+void transformVectorsInPlace(const ExecutionPolicy& policy, const Quaternion& normalizedQuaternion, Vector3* const vectors, const std::size_t count, const std::size_t stride) {
+    CORRADE_ASSERT(normalizedQuaternion.isNormalized(),
+        "MeshTools::transformVectorsInPlace(): quaternion must be normalized", );
+    transform(policy, Matrix4::from(normalizedQuaternion.toMatrix(), {}), Kind::Vector, vectors, count, stride);
+}
+
+void transformVectorsInPlace(const Quaternion& normalizedQuaternion, Vector3* const vectors, const std::size_t count, const std::size_t stride, const UnsignedInt threadCount) {
+    transformVectorsInPlace(threadPolicy(threadCount), normalizedQuaternion, vectors, count, stride);
+}
+
+void transformNormalsInPlace(const ExecutionPolicy& policy, const Matrix4& matrix, Vector3* const normals, const std::size_t count, const std::size_t stride) {
+    transform(policy, Matrix4::from(matrix.rotationScaling().inverted().transposed(), {}), Kind::Normal, normals, count, stride);
+}
+
+void transformNormalsInPlace(const Matrix4& matrix, Vector3* const normals, const std::size_t count, const std::size_t stride, const UnsignedInt threadCount) {
+    transformNormalsInPlace(threadPolicy(threadCount), matrix, normals, count, stride);
+}
+
+void transformPointsInPlace(const ExecutionPolicy& policy, const Matrix4& matrix, Vector3* const points, const std::size_t count, const std::size_t stride) {
+    CORRADE_ASSERT(matrix.row(3) == Vector4(0.0f, 0.0f, 0.0f, 1.0f),
+        "MeshTools::transformPointsInPlace(): the matrix is not affine", );
+    transform(policy, matrix, Kind::Point, points, count, stride);
+}
+
+void transformPointsInPlace(const Matrix4& matrix, Vector3* const points, const std::size_t count, const std::size_t stride, const UnsignedInt threadCount) {
+    transformPointsInPlace(threadPolicy(threadCount), matrix, points, count, stride);
+}
+
+void transformPointsInPlace(const ExecutionPolicy& policy, const DualQuaternion& normalizedDualQuaternion, Vector3* const points, const std::size_t count, const std::size_t stride) {
+    CORRADE_ASSERT(normalizedDualQuaternion.isNormalized(),
+        "MeshTools::transformPointsInPlace(): dual quaternion must be normalized", );
+    transform(policy, normalizedDualQuaternion.toMatrix(), Kind::Point, points, count, stride);
+}
+
+void transformPointsInPlace(const DualQuaternion& normalizedDualQuaternion, Vector3* const points, const std::size_t count, const std::size_t stride, const UnsignedInt threadCount) {
+    transformPointsInPlace(threadPolicy(threadCount), normalizedDualQuaternion, points, count, stride);
+}
+
+}}
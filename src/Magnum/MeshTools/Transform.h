@@ -26,11 +26,14 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::transformVectorsInPlace(), @ref Magnum::MeshTools::transformVectors(), @ref Magnum::MeshTools::transformPointsInPlace(), @ref Magnum::MeshTools::transformPoints()
+ * @brief Function @ref Magnum::MeshTools::transformVectorsInPlace(), @ref Magnum::MeshTools::transformVectors(), @ref Magnum::MeshTools::transformPointsInPlace(), @ref Magnum::MeshTools::transformPoints(), @ref Magnum::MeshTools::transformNormalsInPlace()
  */
 
+#include "Magnum/Magnum.h"
 #include "Magnum/Math/DualQuaternion.h"
 #include "Magnum/Math/DualComplex.h"
+#include "Magnum/MeshTools/ExecutionPolicy.h"
+#include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -77,6 +80,71 @@ template<class T, class U> void transformVectorsInPlace(const Math::Matrix4<T>&
     for(auto& vector: vectors) vector = matrix.transformVector(vector);
 }
 
+/**
+@brief Transform strided vectors in-place using given transformation
+@param matrix       Transformation matrix
+@param vectors      Pointer to the first vector
+@param count        Vector count
+@param stride       Distance between two consecutive vectors in bytes
+@param threadCount  Count of threads to split the work among
+
+Bulk variant of @ref transformVectorsInPlace(const Math::Matrix4<T>&, U&) for
+large meshes. The vectors can be e.g. an attribute in interleaved vertex data,
+see @ref interleave(). Uses SSE intrinsics if the target supports them. If
+@p threadCount is larger than `1`, the vectors are split into equally large
+contiguous ranges processed in parallel by `threadCount - 1` temporary threads
+and the calling thread. Expects that the stride is at least the size of
+@ref Vector3.
+@see @ref transformNormalsInPlace()
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformVectorsInPlace(const Matrix4& matrix, Vector3* vectors, std::size_t count, std::size_t stride = sizeof(Vector3), UnsignedInt threadCount = 1);
+
+/**
+@brief Transform strided vectors in-place using given transformation and execution policy
+
+Same as @ref transformVectorsInPlace(const Matrix4&, Vector3*, std::size_t, std::size_t, UnsignedInt),
+but the work is executed according to @p policy, for example on a
+@ref ThreadPool.
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformVectorsInPlace(const ExecutionPolicy& policy, const Matrix4& matrix, Vector3* vectors, std::size_t count, std::size_t stride = sizeof(Vector3));
+
+/**
+@brief Transform strided vectors in-place using given rotation quaternion
+
+Converts @p normalizedQuaternion to a rotation matrix and calls
+@ref transformVectorsInPlace(const Matrix4&, Vector3*, std::size_t, std::size_t, UnsignedInt),
+which is faster than rotating every vector with the quaternion. Expects that
+the quaternion is normalized.
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformVectorsInPlace(const Quaternion& normalizedQuaternion, Vector3* vectors, std::size_t count, std::size_t stride = sizeof(Vector3), UnsignedInt threadCount = 1);
+
+/** @overload */
+void MAGNUM_MESHTOOLS_EXPORT transformVectorsInPlace(const ExecutionPolicy& policy, const Quaternion& normalizedQuaternion, Vector3* vectors, std::size_t count, std::size_t stride = sizeof(Vector3));
+
+/**
+@brief Transform normals in-place using given transformation
+@param matrix       Transformation matrix
+@param normals      Pointer to the first normal
+@param count        Normal count
+@param stride       Distance between two consecutive normals in bytes
+@param threadCount  Count of threads to split the work among
+
+Transforms the normals with inverse transpose of the rotation and scaling
+part of @p matrix and normalizes them, so they stay perpendicular to the
+surface even if the transformation involves non-uniform scaling. See
+@ref transformVectorsInPlace(const Matrix4&, Vector3*, std::size_t, std::size_t, UnsignedInt)
+for description of the other parameters.
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformNormalsInPlace(const Matrix4& matrix, Vector3* normals, std::size_t count, std::size_t stride = sizeof(Vector3), UnsignedInt threadCount = 1);
+
+/**
+@brief Transform normals in-place using given transformation and execution policy
+
+Same as @ref transformNormalsInPlace(const Matrix4&, Vector3*, std::size_t, std::size_t, UnsignedInt),
+but the work is executed according to @p policy.
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformNormalsInPlace(const ExecutionPolicy& policy, const Matrix4& matrix, Vector3* normals, std::size_t count, std::size_t stride = sizeof(Vector3));
+
 /**
 @brief Transform vectors using given transformation
 
@@ -132,6 +200,58 @@ template<class T, class U> void transformPointsInPlace(const Math::Matrix4<T>& m
     for(auto& point: points) point = matrix.transformPoint(point);
 }
 
+/**
+@brief Transform strided points in-place using given transformation
+@param matrix       Transformation matrix
+@param points       Pointer to the first point
+@param count        Point count
+@param stride       Distance between two consecutive points in bytes
+@param threadCount  Count of threads to split the work among
+
+Bulk variant of @ref transformPointsInPlace(const Math::Matrix4<T>&, U&) for
+large meshes. Expects that the matrix is affine, i.e. that its bottom row is
+@f$ (0, 0, 0, 1) @f$. See
+@ref transformVectorsInPlace(const Matrix4&, Vector3*, std::size_t, std::size_t, UnsignedInt)
+for description of the other parameters.
+
+Example usage, transforming positions in interleaved vertex data:
+@code
+struct Vertex {
+    Vector3 position;
+    Vector3 normal;
+    Vector2 textureCoordinates;
+};
+std::vector<Vertex> vertices;
+
+Matrix4 transformation = ...;
+MeshTools::transformPointsInPlace(transformation, &vertices[0].position, vertices.size(), sizeof(Vertex), 4);
+MeshTools::transformNormalsInPlace(transformation, &vertices[0].normal, vertices.size(), sizeof(Vertex), 4);
+@endcode
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformPointsInPlace(const Matrix4& matrix, Vector3* points, std::size_t count, std::size_t stride = sizeof(Vector3), UnsignedInt threadCount = 1);
+
+/**
+@brief Transform strided points in-place using given transformation and execution policy
+
+Same as @ref transformPointsInPlace(const Matrix4&, Vector3*, std::size_t, std::size_t, UnsignedInt),
+but the work is executed according to @p policy, for example on a
+@ref ThreadPool.
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformPointsInPlace(const ExecutionPolicy& policy, const Matrix4& matrix, Vector3* points, std::size_t count, std::size_t stride = sizeof(Vector3));
+
+/**
+@brief Transform strided points in-place using given dual quaternion
+
+Converts @p normalizedDualQuaternion to a transformation matrix and calls
+@ref transformPointsInPlace(const Matrix4&, Vector3*, std::size_t, std::size_t, UnsignedInt),
+which is faster than transforming every point with the dual quaternion.
+Expects that the dual quaternion is normalized.
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformPointsInPlace(const DualQuaternion& normalizedDualQuaternion, Vector3* points, std::size_t count, std::size_t stride = sizeof(Vector3), UnsignedInt threadCount = 1);
+
+/** @overload */
+void MAGNUM_MESHTOOLS_EXPORT transformPointsInPlace(const ExecutionPolicy& policy, const DualQuaternion& normalizedDualQuaternion, Vector3* points, std::size_t count, std::size_t stride = sizeof(Vector3));
+
 /**
 @brief Transform points using given transformation
 
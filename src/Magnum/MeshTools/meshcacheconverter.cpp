@@ -0,0 +1,452 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <tuple>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/Utility/Arguments.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/CompressIndices.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/MeshTools/GenerateSmoothNormals.h"
+#include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/MeshTools/OptimizeVertexFetch.h"
+#include "Magnum/MeshTools/RemoveDuplicates.h"
+#include "Magnum/MeshTools/Tipsify.h"
+#include "Magnum/TaskScheduler.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/Trade/MeshObjectData3D.h"
+#include "Magnum/Trade/SceneData.h"
+#include "MagnumPlugins/MeshCacheImporter/MeshCacheHeader.h"
+
+#include "meshcacheconverterConfigure.h"
+
+#ifdef MAGNUM_BUILD_UTILITIES_STATIC_PLUGINS
+/* The bundled plugins are linked in statically and need to be imported from
+   the global namespace */
+static void importStaticPlugins() {
+    #ifdef MAGNUM_WITH_MESHCACHEIMPORTER
+    CORRADE_PLUGIN_IMPORT(MeshCacheImporter)
+    #endif
+    #ifdef MAGNUM_WITH_OBJIMPORTER
+    CORRADE_PLUGIN_IMPORT(ObjImporter)
+    #endif
+}
+#endif
+
+namespace Magnum {
+
+/** @page magnum-meshcacheconverter Mesh cache conversion utility
+@brief Converts meshes, images and scenes to binary cache format
+
+@section magnum-meshcacheconverter-usage Usage
+
+    magnum-meshcacheconverter [-h|--help] [--importer IMPORTER] [--plugin-dir DIR] [--remove-duplicates] [--generate-normals] [--optimize] [--threads N] [--] input output
+
+Arguments:
+
+-   `input` -- input file
+-   `output` -- output mesh cache file
+-   `-h`, `--help` -- display help message and exit
+-   `--importer IMPORTER` -- mesh importer plugin (default: @ref Trade::ObjImporter "ObjImporter")
+-   `--plugin-dir DIR` -- base plugin dir (defaults to plugin directory in
+    Magnum install location). If Magnum is built with
+    `BUILD_UTILITIES_STATIC_PLUGINS`, the bundled plugins are linked in
+    statically and no directory is scanned unless this option is set.
+-   `--remove-duplicates` -- remove duplicate vertices using
+    @ref MeshTools::removeDuplicates()
+-   `--generate-normals` -- generate smooth normals using
+    @ref MeshTools::generateSmoothNormals() for meshes which don't have any
+-   `--optimize` -- optimize for vertex cache using @ref MeshTools::tipsify()
+    and for vertex fetch using @ref MeshTools::optimizeVertexFetch()
+-   `--threads N` -- count of threads processing the meshes (default: `1`)
+
+All 3D meshes in the input file are converted. The optional processing steps
+are done only on indexed or non-indexed triangle meshes, in the order in
+which they are listed above. Indices are compressed with
+@ref MeshTools::compressIndices() and first position, normal and texture
+coordinate array are interleaved with @ref MeshTools::interleave(), other
+attribute arrays are ignored. All 2D images are stored with their pixel data
+as-is and objects of the default scene (or the first scene, if there is no
+default) are stored as a flattened hierarchy with parents before children,
+only the mesh instances are kept, materials, cameras and lights are dropped.
+
+The resulting file can be then opened with
+@ref Trade::MeshCacheImporter "MeshCacheImporter" plugin, see its
+documentation for more information. The data can be uploaded to the GPU
+directly from the (memory-mapped) file without any further processing.
+
+@section magnum-meshcacheconverter-example Example usage
+
+    magnum-meshcacheconverter --remove-duplicates --optimize --threads 4 scene.obj scene.mesh
+
+This will open `scene.obj` using @ref Trade::ObjImporter "ObjImporter" plugin,
+optimizes all meshes in it using four threads and stores them to
+`scene.mesh`.
+*/
+
+namespace MeshTools {
+
+namespace {
+
+struct Options {
+    bool removeDuplicates, generateNormals, optimize;
+};
+
+/* Converted mesh, waiting for offsets to be filled */
+struct CacheMesh {
+    Trade::MeshCacheMeshHeader header;
+    std::string name;
+    Containers::Array<char> indexData;
+    Containers::Array<char> vertexData;
+};
+
+/* Converted image and object, waiting for offsets to be filled */
+struct CacheImage {
+    Trade::MeshCacheImageHeader header;
+    std::string name;
+    Containers::ArrayReference<const char> data;
+    std::optional<Trade::ImageData2D> image;
+};
+
+struct CacheObject {
+    Trade::MeshCacheObjectHeader header;
+    std::string name;
+};
+
+inline std::size_t aligned(const std::size_t offset) {
+    return (offset + Trade::MeshCacheAlignment - 1)/Trade::MeshCacheAlignment*Trade::MeshCacheAlignment;
+}
+
+/* Expands the data to be indexed by given index array */
+template<class T> void expand(const std::vector<UnsignedInt>& indices, std::vector<T>& data) {
+    data = duplicate(indices, data);
+}
+
+void process(const Options& options, std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions, std::vector<Vector3>& normals, std::vector<Vector2>& textureCoordinates) {
+    /* Generated normals are indexed separately, so the mesh has to be
+       expanded and the duplicates removed afterwards */
+    const bool generateNormals = options.generateNormals && normals.empty();
+    if(options.removeDuplicates || generateNormals) {
+        std::vector<UnsignedInt> normalIndices;
+        if(generateNormals)
+            std::tie(normalIndices, normals) = generateSmoothNormals(indices, positions);
+        else if(!normals.empty()) normalIndices = indices;
+
+        expand(indices, positions);
+        if(!normals.empty()) expand(normalIndices, normals);
+        if(!textureCoordinates.empty()) expand(indices, textureCoordinates);
+
+        if(!normals.empty() && !textureCoordinates.empty())
+            indices = removeDuplicates(positions, Math::TypeTraits<Float>::epsilon(), normals, textureCoordinates);
+        else if(!normals.empty())
+            indices = removeDuplicates(positions, Math::TypeTraits<Float>::epsilon(), normals);
+        else if(!textureCoordinates.empty())
+            indices = removeDuplicates(positions, Math::TypeTraits<Float>::epsilon(), textureCoordinates);
+        else indices = removeDuplicates(positions);
+    }
+
+    if(options.optimize) {
+        tipsify(indices, positions.size(), 24);
+        if(!normals.empty() && !textureCoordinates.empty())
+            optimizeVertexFetch(indices, positions, normals, textureCoordinates);
+        else if(!normals.empty())
+            optimizeVertexFetch(indices, positions, normals);
+        else if(!textureCoordinates.empty())
+            optimizeVertexFetch(indices, positions, textureCoordinates);
+        else optimizeVertexFetch(indices, positions);
+    }
+}
+
+CacheMesh convert(const Options& options, const Trade::MeshData3D& data, std::string name) {
+    CacheMesh mesh;
+    mesh.name = std::move(name);
+    Trade::MeshCacheMeshHeader& header = mesh.header;
+    std::memset(&header, 0, sizeof(Trade::MeshCacheMeshHeader));
+    header.primitive = UnsignedInt(data.primitive());
+
+    /* Take first array of each attribute */
+    std::vector<UnsignedInt> indices;
+    if(data.isIndexed()) indices = data.indices();
+    std::vector<Vector3> positions = data.positions(0);
+    std::vector<Vector3> normals;
+    if(data.hasNormals()) normals = data.normals(0);
+    std::vector<Vector2> textureCoordinates;
+    if(data.hasTextureCoords2D()) textureCoordinates = data.textureCoords2D(0);
+
+    /* Process triangle meshes, the result is always indexed */
+    if(data.primitive() == MeshPrimitive::Triangles && (options.removeDuplicates || options.generateNormals || options.optimize)) {
+        if(!data.isIndexed()) {
+            indices.resize(positions.size());
+            std::iota(indices.begin(), indices.end(), 0);
+        }
+        process(options, indices, positions, normals, textureCoordinates);
+    }
+
+    /* Compress the indices */
+    if(!indices.empty()) {
+        Mesh::IndexType indexType;
+        std::tie(mesh.indexData, indexType, header.indexStart, header.indexEnd) = compressIndices(indices);
+        header.indexType = UnsignedInt(indexType);
+        header.indexCount = indices.size();
+    }
+
+    /* Interleave the attributes */
+    header.vertexCount = positions.size();
+    header.normalOffset = Trade::MeshCacheNoAttribute;
+    header.textureCoordinateOffset = Trade::MeshCacheNoAttribute;
+    if(!normals.empty() && !textureCoordinates.empty()) {
+        header.normalOffset = sizeof(Vector3);
+        header.textureCoordinateOffset = 2*sizeof(Vector3);
+        header.vertexStride = 2*sizeof(Vector3) + sizeof(Vector2);
+        mesh.vertexData = interleave(positions, normals, textureCoordinates);
+    } else if(!normals.empty()) {
+        header.normalOffset = sizeof(Vector3);
+        header.vertexStride = 2*sizeof(Vector3);
+        mesh.vertexData = interleave(positions, normals);
+    } else if(!textureCoordinates.empty()) {
+        header.textureCoordinateOffset = sizeof(Vector3);
+        header.vertexStride = sizeof(Vector3) + sizeof(Vector2);
+        mesh.vertexData = interleave(positions, textureCoordinates);
+    } else {
+        header.vertexStride = sizeof(Vector3);
+        mesh.vertexData = interleave(positions);
+    }
+
+    return mesh;
+}
+
+/* Flattens the object hierarchy, parents before children */
+bool importObjects(Trade::AbstractImporter& importer, const std::vector<UnsignedInt>& children, const Int parent, std::vector<CacheObject>& objects) {
+    for(const UnsignedInt id: children) {
+        const std::unique_ptr<Trade::ObjectData3D> data = importer.object3D(id);
+        if(!data) {
+            Error() << "Cannot import object" << id;
+            return false;
+        }
+
+        CacheObject object;
+        std::memset(&object.header, 0, sizeof(Trade::MeshCacheObjectHeader));
+        object.name = importer.object3DName(id);
+        object.header.parent = parent;
+        object.header.mesh = data->instanceType() == Trade::ObjectInstanceType3D::Mesh ? Int(data->instance()) : Trade::MeshCacheNoReference;
+        std::memcpy(object.header.transformation, data->transformation().data(), sizeof(Matrix4));
+
+        const Int index = objects.size();
+        objects.push_back(std::move(object));
+        if(!importObjects(importer, data->children(), index, objects))
+            return false;
+    }
+
+    return true;
+}
+
+}
+
+int meshCacheConverter(const int argc, char** const argv) {
+    Utility::Arguments args;
+    args.addArgument("input").setHelp("input", "input file")
+        .addArgument("output").setHelp("output", "output mesh cache file")
+        .addOption("importer", "ObjImporter").setHelp("importer", "mesh importer plugin")
+        .addOption("plugin-dir", MAGNUM_PLUGINS_DIR).setHelpKey("plugin-dir", "DIR").setHelp("plugin-dir", "base plugin dir")
+        .addBooleanOption("remove-duplicates").setHelp("remove-duplicates", "remove duplicate vertices")
+        .addBooleanOption("generate-normals").setHelp("generate-normals", "generate smooth normals for meshes which don't have any")
+        .addBooleanOption("optimize").setHelp("optimize", "optimize for vertex cache and vertex fetch")
+        .addOption("threads", "1").setHelpKey("threads", "N").setHelp("threads", "count of threads processing the meshes")
+        .setHelp("Converts meshes, images and scenes to binary cache format.")
+        .parse(argc, argv);
+
+    const Options options{args.isSet("remove-duplicates"), args.isSet("generate-normals"), args.isSet("optimize")};
+    const UnsignedInt threadCount = Math::max(args.value<UnsignedInt>("threads"), 1u);
+
+    /* Load importer plugin. Don't scan any directory if the plugin dir is
+       empty. */
+    #ifdef MAGNUM_BUILD_UTILITIES_STATIC_PLUGINS
+    importStaticPlugins();
+    #endif
+    const std::string pluginDir = args.value("plugin-dir");
+    PluginManager::Manager<Trade::AbstractImporter> importerManager(pluginDir.empty() ? std::string{} : Utility::Directory::join(pluginDir, "importers/"));
+    if(!(importerManager.load(args.value("importer")) & (PluginManager::LoadState::Loaded|PluginManager::LoadState::Static)))
+        return 1;
+    std::unique_ptr<Trade::AbstractImporter> importer = importerManager.instance(args.value("importer"));
+
+    /* Open input file */
+    if(!importer->openFile(args.value("input"))) {
+        Error() << "Cannot open file" << args.value("input");
+        return 1;
+    }
+
+    /* Import all meshes. The importer isn't thread-safe, so this is done
+       upfront. */
+    std::vector<Trade::MeshData3D> data;
+    std::vector<std::string> names;
+    data.reserve(importer->mesh3DCount());
+    names.reserve(importer->mesh3DCount());
+    for(UnsignedInt i = 0; i != importer->mesh3DCount(); ++i) {
+        std::optional<Trade::MeshData3D> mesh = importer->mesh3D(i);
+        if(!mesh) {
+            Error() << "Cannot import mesh" << i;
+            return 1;
+        }
+
+        names.push_back(importer->mesh3DName(i));
+        if(mesh->positionArrayCount() > 1 || mesh->normalArrayCount() > 1 || mesh->textureCoords2DArrayCount() > 1)
+            Warning() << "Mesh" << names.back() << "has more than one array of some attribute, using only the first";
+        data.push_back(std::move(*mesh));
+    }
+
+    /* Convert all meshes, each thread picks the next unprocessed one. The
+       scheduler is made global for the conversion, so the MeshTools
+       algorithms called from it use the same threads. */
+    std::vector<CacheMesh> meshes(data.size());
+    {
+        TaskScheduler scheduler{threadCount};
+        TaskScheduler::setGlobal(&scheduler);
+        TaskScheduler::global().parallelFor(data.size(), 1, [&](const std::size_t begin, const std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i)
+                meshes[i] = convert(options, data[i], std::move(names[i]));
+        });
+        TaskScheduler::setGlobal(nullptr);
+    }
+
+    /* Import all images */
+    std::vector<CacheImage> images;
+    images.reserve(importer->image2DCount());
+    for(UnsignedInt i = 0; i != importer->image2DCount(); ++i) {
+        CacheImage image;
+        image.image = importer->image2D(i);
+        if(!image.image) {
+            Error() << "Cannot import image" << i;
+            return 1;
+        }
+
+        std::memset(&image.header, 0, sizeof(Trade::MeshCacheImageHeader));
+        image.name = importer->image2DName(i);
+        image.header.format = UnsignedInt(image.image->format());
+        image.header.type = UnsignedInt(image.image->type());
+        image.header.size[0] = image.image->size().x();
+        image.header.size[1] = image.image->size().y();
+        image.data = {image.image->data(), image.image->dataSize(image.image->size())};
+        images.push_back(std::move(image));
+    }
+
+    /* Import the scene hierarchy */
+    std::vector<CacheObject> objects;
+    const Int sceneId = importer->defaultScene() != -1 ? importer->defaultScene() : (importer->sceneCount() ? 0 : -1);
+    if(sceneId != -1) {
+        std::optional<Trade::SceneData> scene = importer->scene(sceneId);
+        if(!scene) {
+            Error() << "Cannot import scene" << sceneId;
+            return 1;
+        }
+        if(!importObjects(*importer, scene->children3D(), Trade::MeshCacheNoReference, objects))
+            return 1;
+    }
+
+    /* Compute data offsets */
+    std::size_t offset = sizeof(Trade::MeshCacheHeader) + sizeof(Trade::MeshCacheSceneHeader) +
+        meshes.size()*sizeof(Trade::MeshCacheMeshHeader) +
+        images.size()*sizeof(Trade::MeshCacheImageHeader) +
+        objects.size()*sizeof(Trade::MeshCacheObjectHeader);
+    for(CacheMesh& mesh: meshes) {
+        mesh.header.nameOffset = offset = aligned(offset);
+        mesh.header.nameSize = mesh.name.size();
+        offset += mesh.name.size();
+        mesh.header.indexDataOffset = offset = aligned(offset);
+        offset += mesh.indexData.size();
+        mesh.header.vertexDataOffset = offset = aligned(offset);
+        offset += mesh.vertexData.size();
+    }
+    for(CacheImage& image: images) {
+        image.header.nameOffset = offset = aligned(offset);
+        image.header.nameSize = image.name.size();
+        offset += image.name.size();
+        image.header.dataOffset = offset = aligned(offset);
+        image.header.dataSize = image.data.size();
+        offset += image.data.size();
+    }
+    for(CacheObject& object: objects) {
+        object.header.nameOffset = offset;
+        object.header.nameSize = object.name.size();
+        offset += object.name.size();
+    }
+
+    /* Assemble the file */
+    Containers::Array<char> out = Containers::Array<char>::zeroInitialized(offset);
+    Trade::MeshCacheHeader header;
+    std::memcpy(header.magic, "MGMC", 4);
+    header.version = 2;
+    header.meshCount = meshes.size();
+    header.reserved = 0;
+    std::memcpy(out.begin(), &header, sizeof(Trade::MeshCacheHeader));
+    Trade::MeshCacheSceneHeader sceneHeader{};
+    sceneHeader.imageCount = images.size();
+    sceneHeader.objectCount = objects.size();
+    char* headers = out.begin() + sizeof(Trade::MeshCacheHeader);
+    std::memcpy(headers, &sceneHeader, sizeof(Trade::MeshCacheSceneHeader));
+    headers += sizeof(Trade::MeshCacheSceneHeader);
+    for(const CacheMesh& mesh: meshes) {
+        std::memcpy(headers, &mesh.header, sizeof(Trade::MeshCacheMeshHeader));
+        headers += sizeof(Trade::MeshCacheMeshHeader);
+        std::copy(mesh.name.begin(), mesh.name.end(), out.begin() + mesh.header.nameOffset);
+        std::copy(mesh.indexData.begin(), mesh.indexData.end(), out.begin() + mesh.header.indexDataOffset);
+        std::copy(mesh.vertexData.begin(), mesh.vertexData.end(), out.begin() + mesh.header.vertexDataOffset);
+    }
+    for(const CacheImage& image: images) {
+        std::memcpy(headers, &image.header, sizeof(Trade::MeshCacheImageHeader));
+        headers += sizeof(Trade::MeshCacheImageHeader);
+        std::copy(image.name.begin(), image.name.end(), out.begin() + image.header.nameOffset);
+        std::copy(image.data.begin(), image.data.end(), out.begin() + image.header.dataOffset);
+    }
+    for(const CacheObject& object: objects) {
+        std::memcpy(headers, &object.header, sizeof(Trade::MeshCacheObjectHeader));
+        headers += sizeof(Trade::MeshCacheObjectHeader);
+        std::copy(object.name.begin(), object.name.end(), out.begin() + object.header.nameOffset);
+    }
+
+    /* Save the file */
+    std::ofstream file(args.value("output"), std::ios::binary);
+    if(!file.good() || !file.write(out.begin(), out.size())) {
+        Error() << "Cannot save file" << args.value("output");
+        return 1;
+    }
+
+    Debug() << "Converted" << meshes.size() << "meshes," << images.size() << "images and" << objects.size() << "objects to" << out.size() << "bytes";
+    return 0;
+}
+
+}}
+
+int main(int argc, char** argv) {
+    return Magnum::MeshTools::meshCacheConverter(argc, argv);
+}
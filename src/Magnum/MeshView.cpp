@@ -29,6 +29,7 @@
 #include <Corrade/Utility/Assert.h>
 
 #include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Buffer.h"
 #include "Magnum/Context.h"
 #include "Magnum/Mesh.h"
 
@@ -37,8 +38,7 @@
 
 namespace Magnum {
 
-void MeshView::draw(AbstractShaderProgram& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
-    /* Why std::initializer_list doesn't have empty()? */
+void MeshView::draw(AbstractShaderProgram& shader, Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes) {
     if(!meshes.size()) return;
 
     shader.use();
@@ -56,10 +56,11 @@ void MeshView::draw(AbstractShaderProgram& shader, std::initializer_list<std::re
     #endif
 }
 
-void MeshView::multiDrawImplementationDefault(std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+void MeshView::multiDrawImplementationDefault(Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes) {
     CORRADE_INTERNAL_ASSERT(meshes.size());
 
-    const Implementation::MeshState& state = *Context::current()->state().mesh;
+    Implementation::State& contextState = Context::current()->state();
+    const Implementation::MeshState& state = *contextState.mesh;
 
     Mesh& original = meshes.begin()->get()._original;
     Containers::Array<GLsizei> count{meshes.size()};
@@ -89,6 +90,11 @@ void MeshView::multiDrawImplementationDefault(std::initializer_list<std::referen
         ++i;
     }
 
+    if(contextState.statisticsEnabled) {
+        ++contextState.statistics.drawCalls;
+        for(const GLsizei c: count) contextState.statistics.vertices += c;
+    }
+
     (original.*state.bindImplementation)();
 
     /* Non-indexed meshes */
@@ -125,8 +131,86 @@ void MeshView::multiDrawImplementationDefault(std::initializer_list<std::referen
     (original.*state.unbindImplementation)();
 }
 
+#ifndef MAGNUM_TARGET_GLES
+void MeshView::drawIndirect(AbstractShaderProgram& shader, Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes, Buffer& indirectBuffer) {
+    if(!meshes.size()) return;
+
+    shader.use();
+
+    #ifndef CORRADE_NO_ASSERT
+    const Mesh* original = &meshes.begin()->get()._original.get();
+    for(MeshView& mesh: meshes)
+        CORRADE_ASSERT(&mesh._original.get() == original, "MeshView::drawIndirect(): all meshes must be views of the same original mesh", );
+    #endif
+
+    Context::current()->state().mesh->multiDrawIndirectImplementation(meshes, indirectBuffer);
+}
+
+namespace {
+    /* Layouts defined by ARB_draw_indirect */
+    struct DrawArraysIndirectCommand {
+        GLuint count, instanceCount, first, baseInstance;
+    };
+
+    struct DrawElementsIndirectCommand {
+        GLuint count, instanceCount, firstIndex;
+        GLint baseVertex;
+        GLuint baseInstance;
+    };
+}
+
+void MeshView::multiDrawIndirectImplementationDefault(Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes, Buffer& indirectBuffer) {
+    CORRADE_INTERNAL_ASSERT(meshes.size());
+
+    Implementation::State& contextState = Context::current()->state();
+    const Implementation::MeshState& state = *contextState.mesh;
+
+    Mesh& original = meshes.begin()->get()._original;
+
+    if(contextState.statisticsEnabled) {
+        ++contextState.statistics.drawCalls;
+        for(MeshView& mesh: meshes)
+            contextState.statistics.vertices += UnsignedLong(mesh._count)*mesh._instanceCount;
+    }
+
+    /* Build the commands and upload them */
+    if(!original._indexBuffer) {
+        Containers::Array<DrawArraysIndirectCommand> commands{meshes.size()};
+        for(std::size_t i = 0; i != meshes.size(); ++i) {
+            const MeshView& mesh = meshes[i];
+            commands[i] = {GLuint(mesh._count), GLuint(mesh._instanceCount), GLuint(mesh._baseVertex), mesh._baseInstance};
+        }
+        indirectBuffer.setData({commands.data(), commands.size()*sizeof(DrawArraysIndirectCommand)}, BufferUsage::StreamDraw);
+    } else {
+        const std::size_t indexSize = original.indexSize();
+        Containers::Array<DrawElementsIndirectCommand> commands{meshes.size()};
+        for(std::size_t i = 0; i != meshes.size(); ++i) {
+            const MeshView& mesh = meshes[i];
+            CORRADE_ASSERT(mesh._indexOffset % indexSize == 0, "MeshView::drawIndirect(): index offset" << mesh._indexOffset << "is not a multiple of index size", );
+            commands[i] = {GLuint(mesh._count), GLuint(mesh._instanceCount), GLuint(mesh._indexOffset/indexSize), mesh._baseVertex, mesh._baseInstance};
+        }
+        indirectBuffer.setData({commands.data(), commands.size()*sizeof(DrawElementsIndirectCommand)}, BufferUsage::StreamDraw);
+    }
+
+    indirectBuffer.bindInternal(Buffer::TargetHint::DrawIndirect);
+    (original.*state.bindImplementation)();
+
+    if(!original._indexBuffer)
+        glMultiDrawArraysIndirect(GLenum(original._primitive), nullptr, meshes.size(), 0);
+    else
+        glMultiDrawElementsIndirect(GLenum(original._primitive), GLenum(original._indexType), nullptr, meshes.size(), 0);
+
+    (original.*state.unbindImplementation)();
+}
+
+void MeshView::multiDrawIndirectImplementationFallback(Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes, Buffer&) {
+    for(MeshView& mesh: meshes)
+        mesh._original.get().drawInternal(mesh._count, mesh._baseVertex, mesh._instanceCount, mesh._baseInstance, mesh._indexOffset, mesh._indexStart, mesh._indexEnd);
+}
+#endif
+
 #ifdef MAGNUM_TARGET_GLES
-void MeshView::multiDrawImplementationFallback(std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+void MeshView::multiDrawImplementationFallback(Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes) {
     for(MeshView& mesh: meshes) {
         #ifndef MAGNUM_TARGET_GLES2
         mesh._original.get().drawInternal(mesh._count, mesh._baseVertex, mesh._instanceCount, mesh._indexOffset, mesh._indexStart, mesh._indexEnd);
@@ -31,6 +31,7 @@
 
 #include <functional>
 #include <initializer_list>
+#include <Corrade/Containers/Array.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/OpenGL.h"
@@ -58,6 +59,9 @@ lifetime.
 */
 class MAGNUM_EXPORT MeshView {
     friend Implementation::MeshState;
+    #ifndef MAGNUM_TARGET_GLES
+    friend OcclusionCuller;
+    #endif
 
     public:
         /**
@@ -79,13 +83,59 @@ class MAGNUM_EXPORT MeshView {
          *      or @fn_gl{BindVertexArray}, @fn_gl{MultiDrawArrays} or
          *      @fn_gl{MultiDrawElements}/@fn_gl{MultiDrawElementsBaseVertex}
          */
-        static void draw(AbstractShaderProgram& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes);
+        static void draw(AbstractShaderProgram& shader, Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes);
 
         /** @overload */
-        static void draw(AbstractShaderProgram&& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+        static void draw(AbstractShaderProgram&& shader, Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes) {
             draw(shader, meshes);
         }
 
+        /** @overload */
+        static void draw(AbstractShaderProgram& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+            draw(shader, {meshes.begin(), meshes.size()});
+        }
+
+        /** @overload */
+        static void draw(AbstractShaderProgram&& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes) {
+            draw(shader, {meshes.begin(), meshes.size()});
+        }
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Draw multiple meshes at once using indirect draw commands
+         * @param shader            Shader
+         * @param meshes            Meshes to draw
+         * @param indirectBuffer    Buffer to which the draw commands are
+         *      uploaded
+         *
+         * Unlike @ref draw(AbstractShaderProgram&, Containers::ArrayReference<const std::reference_wrapper<MeshView>>)
+         * the meshes can be instanced and can have @ref baseInstance()
+         * specified. The draw commands are built on the CPU side, uploaded
+         * into @p indirectBuffer with @ref Buffer::setData() and submitted
+         * using single @fn_gl{MultiDrawArraysIndirect} or
+         * @fn_gl{MultiDrawElementsIndirect} call. The buffer can be reused
+         * across frames, in which case the driver is able to orphan its
+         * previous storage.
+         *
+         * If @extension{ARB,multi_draw_indirect} (part of OpenGL 4.3) is not
+         * available, the functionality is emulated using sequence of
+         * @ref draw(AbstractShaderProgram&) calls and @p indirectBuffer is
+         * left untouched.
+         * @attention All meshes must be views of the same original mesh. In
+         *      case of indexed meshes the index buffer offset must be a
+         *      multiple of @ref Mesh::indexSize().
+         * @see @fn_gl{UseProgram}, @fn_gl{BindBuffer} with
+         *      @def_gl{DRAW_INDIRECT_BUFFER}, @fn_gl{BindVertexArray}
+         * @requires_gl Indirect drawing is not available in OpenGL ES.
+         */
+        static void drawIndirect(AbstractShaderProgram& shader, Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes, Buffer& indirectBuffer);
+
+        /** @overload */
+        static void drawIndirect(AbstractShaderProgram& shader, std::initializer_list<std::reference_wrapper<MeshView>> meshes, Buffer& indirectBuffer) {
+            drawIndirect(shader, {meshes.begin(), meshes.size()}, indirectBuffer);
+        }
+        #endif
+
         /**
          * @brief Constructor
          * @param original  Original, already configured mesh
@@ -245,7 +295,7 @@ class MAGNUM_EXPORT MeshView {
          * @brief Draw the mesh
          *
          * See @ref Mesh::draw() for more information.
-         * @see @ref draw(AbstractShaderProgram&, std::initializer_list<std::reference_wrapper<MeshView>>)
+         * @see @ref draw(AbstractShaderProgram&, Containers::ArrayReference<const std::reference_wrapper<MeshView>>)
          */
         void draw(AbstractShaderProgram& shader);
         void draw(AbstractShaderProgram&& shader) { draw(shader); } /**< @overload */
@@ -260,8 +310,13 @@ class MAGNUM_EXPORT MeshView {
         #endif
 
     private:
-        static MAGNUM_LOCAL void multiDrawImplementationDefault(std::initializer_list<std::reference_wrapper<MeshView>> meshes);
-        static MAGNUM_LOCAL void multiDrawImplementationFallback(std::initializer_list<std::reference_wrapper<MeshView>> meshes);
+        static MAGNUM_LOCAL void multiDrawImplementationDefault(Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes);
+        static MAGNUM_LOCAL void multiDrawImplementationFallback(Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes);
+
+        #ifndef MAGNUM_TARGET_GLES
+        static MAGNUM_LOCAL void multiDrawIndirectImplementationDefault(Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes, Buffer& indirectBuffer);
+        static MAGNUM_LOCAL void multiDrawIndirectImplementationFallback(Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes, Buffer& indirectBuffer);
+        #endif
 
         std::reference_wrapper<Mesh> _original;
 
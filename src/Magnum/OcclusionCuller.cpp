@@ -0,0 +1,461 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OcclusionCuller.h"
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/Shader.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/TransformFeedback.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+
+#include "Implementation/MeshState.h"
+#include "Implementation/State.h"
+
+namespace Magnum {
+
+namespace {
+
+struct DrawArraysIndirectCommand {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint first;
+    GLuint baseInstance;
+};
+
+struct DrawElementsIndirectCommand {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint baseVertex;
+    GLuint baseInstance;
+};
+
+struct CullInput {
+    Vector3 min, max;
+    Vector4ui command;
+    UnsignedInt baseInstance;
+};
+
+constexpr const char FullScreenTriangleVertexSource[] =
+    "void main() {\n"
+    "    gl_Position = vec4((gl_VertexID == 2) ?  3.0 : -1.0,\n"
+    "                       (gl_VertexID == 1) ? -3.0 :  1.0, 0.0, 1.0);\n"
+    "}\n";
+
+constexpr const char CopyFragmentSource[] =
+    "uniform sampler2D source;\n"
+    "out float depth;\n"
+    "void main() {\n"
+    "    depth = texelFetch(source, ivec2(gl_FragCoord.xy), 0).r;\n"
+    "}\n";
+
+/* Farthest depth of the 2x2 source texels, for odd source sizes the last
+   row or column includes also the remaining texels */
+constexpr const char ReduceFragmentSource[] =
+    "uniform sampler2D source;\n"
+    "uniform int sourceLevel;\n"
+    "out float depth;\n"
+    "float fetch(ivec2 position, ivec2 size) {\n"
+    "    return texelFetch(source, min(position, size - 1), sourceLevel).r;\n"
+    "}\n"
+    "void main() {\n"
+    "    ivec2 size = textureSize(source, sourceLevel);\n"
+    "    ivec2 p = ivec2(gl_FragCoord.xy)*2;\n"
+    "    float d = max(max(fetch(p, size), fetch(p + ivec2(1, 0), size)),\n"
+    "                  max(fetch(p + ivec2(0, 1), size), fetch(p + ivec2(1, 1), size)));\n"
+    "    bool extraX = (size.x & 1) == 1 && p.x + 3 == size.x;\n"
+    "    bool extraY = (size.y & 1) == 1 && p.y + 3 == size.y;\n"
+    "    if(extraX) d = max(d, max(fetch(p + ivec2(2, 0), size), fetch(p + ivec2(2, 1), size)));\n"
+    "    if(extraY) d = max(d, max(fetch(p + ivec2(0, 2), size), fetch(p + ivec2(1, 2), size)));\n"
+    "    if(extraX && extraY) d = max(d, fetch(p + ivec2(2, 2), size));\n"
+    "    depth = d;\n"
+    "}\n";
+
+/* Projects the box, picks the pyramid level where it covers at most 2x2
+   texels and compares its nearest depth with the farthest depth there */
+constexpr const char CullVertexSource[] =
+    "uniform highp mat4 transformationProjectionMatrix;\n"
+    "uniform highp sampler2D depthPyramid;\n"
+    "uniform int maxLevel;\n"
+    "in highp vec3 boxMin;\n"
+    "in highp vec3 boxMax;\n"
+    "in highp uvec4 command;\n"
+    "flat out highp uvec4 culledCommand;\n"
+    "#ifdef INDEXED\n"
+    "in highp uint baseInstance;\n"
+    "flat out highp uint culledBaseInstance;\n"
+    "#endif\n"
+    "bool isVisible() {\n"
+    "    vec3 minimum = vec3(1.0e30);\n"
+    "    vec3 maximum = vec3(-1.0e30);\n"
+    "    for(int i = 0; i != 8; ++i) {\n"
+    "        vec3 corner = mix(boxMin, boxMax, vec3(i & 1, (i >> 1) & 1, (i >> 2) & 1));\n"
+    "        vec4 clip = transformationProjectionMatrix*vec4(corner, 1.0);\n"
+    "        if(clip.w <= 0.0) return true;\n"
+    "        vec3 ndc = clip.xyz/clip.w;\n"
+    "        minimum = min(minimum, ndc);\n"
+    "        maximum = max(maximum, ndc);\n"
+    "    }\n"
+    "    if(any(lessThan(maximum, vec3(-1.0))) || any(greaterThan(minimum, vec3(1.0))))\n"
+    "        return false;\n"
+    "    vec2 size = vec2(textureSize(depthPyramid, 0));\n"
+    "    vec2 from = clamp(minimum.xy*0.5 + 0.5, 0.0, 1.0)*size;\n"
+    "    vec2 to = clamp(maximum.xy*0.5 + 0.5, 0.0, 1.0)*size;\n"
+    "    vec2 extent = max(to - from, vec2(1.0));\n"
+    "    int level = clamp(int(ceil(log2(max(extent.x, extent.y)))), 0, maxLevel);\n"
+    "    ivec2 a, b;\n"
+    "    for(;;) {\n"
+    "        ivec2 levelSize = textureSize(depthPyramid, level);\n"
+    "        vec2 scale = vec2(levelSize)/size;\n"
+    "        a = clamp(ivec2(from*scale), ivec2(0), levelSize - 1);\n"
+    "        b = clamp(ivec2(to*scale), ivec2(0), levelSize - 1);\n"
+    "        if(all(lessThanEqual(b - a, ivec2(1))) || level == maxLevel) break;\n"
+    "        ++level;\n"
+    "    }\n"
+    "    float farthest = max(\n"
+    "        max(texelFetch(depthPyramid, a, level).r, texelFetch(depthPyramid, ivec2(b.x, a.y), level).r),\n"
+    "        max(texelFetch(depthPyramid, ivec2(a.x, b.y), level).r, texelFetch(depthPyramid, b, level).r));\n"
+    "    return minimum.z*0.5 + 0.5 <= farthest;\n"
+    "}\n"
+    "void main() {\n"
+    "    culledCommand = uvec4(command.x, isVisible() ? command.y : 0u, command.zw);\n"
+    "    #ifdef INDEXED\n"
+    "    culledBaseInstance = baseInstance;\n"
+    "    #endif\n"
+    "    gl_Position = vec4(0.0);\n"
+    "}\n";
+
+/* Cube as a 14-vertex triangle strip, generated from vertex ID */
+constexpr const char BoxVertexSource[] =
+    "uniform highp mat4 transformationProjectionMatrix;\n"
+    "uniform highp vec3 boxMin;\n"
+    "uniform highp vec3 boxMax;\n"
+    "void main() {\n"
+    "    int b = 1 << gl_VertexID;\n"
+    "    vec3 corner = vec3((0x287a & b) != 0, (0x02af & b) != 0, (0x31e3 & b) != 0);\n"
+    "    gl_Position = transformationProjectionMatrix*vec4(mix(boxMin, boxMax, corner), 1.0);\n"
+    "}\n";
+
+constexpr const char BoxFragmentSource[] =
+    "void main() {}\n";
+
+}
+
+class OcclusionCuller::PyramidShader: public AbstractShaderProgram {
+    public:
+        explicit PyramidShader(const bool reduce) {
+            Shader vert{Version::GL300, Shader::Type::Vertex};
+            Shader frag{Version::GL300, Shader::Type::Fragment};
+            vert.addSource(FullScreenTriangleVertexSource);
+            frag.addSource(reduce ? ReduceFragmentSource : CopyFragmentSource);
+            CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+
+            attachShaders({vert, frag});
+            CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+            setUniform(uniformLocation("source"), 0);
+            sourceLevelUniform = reduce ? uniformLocation("sourceLevel") : -1;
+        }
+
+        PyramidShader& setSourceLevel(Int level) {
+            setUniform(sourceLevelUniform, level);
+            return *this;
+        }
+
+    private:
+        Int sourceLevelUniform;
+};
+
+class OcclusionCuller::CullShader: public AbstractShaderProgram {
+    public:
+        typedef Attribute<0, Vector3> BoxMin;
+        typedef Attribute<1, Vector3> BoxMax;
+        typedef Attribute<2, Vector4ui> Command;
+        typedef Attribute<3, UnsignedInt> BaseInstance;
+
+        explicit CullShader(const bool indexed) {
+            Shader vert{Version::GL300, Shader::Type::Vertex};
+            vert.addSource(indexed ? "#define INDEXED\n" : "")
+                .addSource(CullVertexSource);
+            CORRADE_INTERNAL_ASSERT_OUTPUT(vert.compile());
+
+            attachShader(vert);
+            bindAttributeLocation(BoxMin::Location, "boxMin");
+            bindAttributeLocation(BoxMax::Location, "boxMax");
+            bindAttributeLocation(Command::Location, "command");
+            if(indexed) {
+                bindAttributeLocation(BaseInstance::Location, "baseInstance");
+                setTransformFeedbackOutputs({"culledCommand", "culledBaseInstance"}, TransformFeedbackBufferMode::InterleavedAttributes);
+            } else setTransformFeedbackOutputs({"culledCommand"}, TransformFeedbackBufferMode::InterleavedAttributes);
+            CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+            transformationProjectionMatrixUniform = uniformLocation("transformationProjectionMatrix");
+            maxLevelUniform = uniformLocation("maxLevel");
+            setUniform(uniformLocation("depthPyramid"), 0);
+        }
+
+        CullShader& setTransformationProjectionMatrix(const Matrix4& matrix) {
+            setUniform(transformationProjectionMatrixUniform, matrix);
+            return *this;
+        }
+
+        CullShader& setMaxLevel(Int level) {
+            setUniform(maxLevelUniform, level);
+            return *this;
+        }
+
+    private:
+        Int transformationProjectionMatrixUniform,
+            maxLevelUniform;
+};
+
+class OcclusionCuller::BoxShader: public AbstractShaderProgram {
+    public:
+        explicit BoxShader() {
+            Shader vert{Version::GL300, Shader::Type::Vertex};
+            Shader frag{Version::GL300, Shader::Type::Fragment};
+            vert.addSource(BoxVertexSource);
+            frag.addSource(BoxFragmentSource);
+            CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+
+            attachShaders({vert, frag});
+            CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+            transformationProjectionMatrixUniform = uniformLocation("transformationProjectionMatrix");
+            boxMinUniform = uniformLocation("boxMin");
+            boxMaxUniform = uniformLocation("boxMax");
+        }
+
+        BoxShader& setTransformationProjectionMatrix(const Matrix4& matrix) {
+            setUniform(transformationProjectionMatrixUniform, matrix);
+            return *this;
+        }
+
+        BoxShader& setBox(const Range3D& box) {
+            setUniform(boxMinUniform, box.min());
+            setUniform(boxMaxUniform, box.max());
+            return *this;
+        }
+
+    private:
+        Int transformationProjectionMatrixUniform,
+            boxMinUniform,
+            boxMaxUniform;
+};
+
+OcclusionCuller::OcclusionCuller(const Vector2i& size): _indexed{false}, _levelCount{}, _pyramidFramebuffer{{{}, size}}, _commands{Buffer::TargetHint::DrawIndirect} {
+    MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL300);
+
+    _queryFallback = !Context::current()->isExtensionSupported<Extensions::GL::ARB::draw_indirect>() ||
+        !Context::current()->isExtensionSupported<Extensions::GL::ARB::transform_feedback2>();
+
+    if(_queryFallback) {
+        _boxShader.reset(new BoxShader);
+        _box.setPrimitive(MeshPrimitive::TriangleStrip)
+            .setCount(14);
+        return;
+    }
+
+    _copyShader.reset(new PyramidShader{false});
+    _reduceShader.reset(new PyramidShader{true});
+    _fullScreenTriangle.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(3);
+    _feedback.reset(new TransformFeedback);
+    _inputMesh.setPrimitive(MeshPrimitive::Points)
+        .addVertexBuffer(_input, 0, CullShader::BoxMin{}, CullShader::BoxMax{}, CullShader::Command{}, CullShader::BaseInstance{});
+
+    setSize(size);
+}
+
+OcclusionCuller::~OcclusionCuller() = default;
+
+void OcclusionCuller::setSize(const Vector2i& size) {
+    if(_queryFallback) return;
+
+    /* Immutable storage can't be resized, recreate the texture */
+    _levelCount = Math::log2(UnsignedInt(Math::max(size.x(), size.y()))) + 1;
+    _pyramid = Texture2D{};
+    _pyramid.setMinificationFilter(Sampler::Filter::Nearest, Sampler::Mipmap::Nearest)
+        .setMagnificationFilter(Sampler::Filter::Nearest)
+        .setWrapping(Sampler::Wrapping::ClampToEdge)
+        .setStorage(_levelCount, TextureFormat::R32F, size);
+}
+
+void OcclusionCuller::buildDepthPyramid(Texture2D& depth) {
+    if(_queryFallback) return;
+
+    /* Level 0 is a plain copy */
+    depth.bind(0);
+    _pyramidFramebuffer.attachTexture(Framebuffer::ColorAttachment{0}, _pyramid, 0)
+        .setViewport({{}, _pyramid.imageSize(0)})
+        .bind(FramebufferTarget::Draw);
+    _fullScreenTriangle.draw(*_copyShader);
+
+    /* Each next level reduces the previous one. Limit the sampled range to
+       the source level to avoid a feedback loop. */
+    _pyramid.bind(0);
+    for(Int level = 1; level != _levelCount; ++level) {
+        _pyramid.setBaseLevel(level - 1)
+            .setMaxLevel(level - 1);
+        _pyramidFramebuffer.attachTexture(Framebuffer::ColorAttachment{0}, _pyramid, level)
+            .setViewport({{}, _pyramid.imageSize(level)})
+            .bind(FramebufferTarget::Draw);
+        _fullScreenTriangle.draw(_reduceShader->setSourceLevel(level - 1));
+    }
+
+    _pyramid.setBaseLevel(0)
+        .setMaxLevel(_levelCount - 1);
+}
+
+void OcclusionCuller::setMeshes(Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes, Containers::ArrayReference<const Range3D> boundingBoxes) {
+    CORRADE_ASSERT(meshes.size() == boundingBoxes.size(),
+        "OcclusionCuller::setMeshes(): expected" << meshes.size() << "bounding boxes but got" << boundingBoxes.size(), );
+
+    _meshes.assign(meshes.begin(), meshes.end());
+    _boundingBoxes.assign(boundingBoxes.begin(), boundingBoxes.end());
+
+    if(_queryFallback) {
+        _queries.clear();
+        _queries.reserve(meshes.size());
+        for(std::size_t i = 0; i != meshes.size(); ++i)
+            _queries.emplace_back(SampleQuery::Target::AnySamplesPassed);
+        return;
+    }
+
+    if(meshes.empty()) return;
+
+    /* (Re)create the cull shader if indexing changed */
+    const Mesh& original = meshes[0].get()._original;
+    const bool indexed = original._indexBuffer;
+    if(!_cullShader || indexed != _indexed) {
+        _cullShader.reset(new CullShader{indexed});
+        _indexed = indexed;
+    }
+
+    /* Build the commands alongside the boxes */
+    const std::size_t indexSize = indexed ? original.indexSize() : 0;
+    std::vector<CullInput> input;
+    input.reserve(meshes.size());
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        const MeshView& mesh = meshes[i];
+        CORRADE_ASSERT(&mesh._original.get() == &original,
+            "OcclusionCuller::setMeshes(): all meshes must be views of the same mesh", );
+        if(!indexed) input.push_back({boundingBoxes[i].min(), boundingBoxes[i].max(),
+            {UnsignedInt(mesh._count), UnsignedInt(mesh._instanceCount), UnsignedInt(mesh._baseVertex), mesh._baseInstance}, 0});
+        else {
+            CORRADE_ASSERT(mesh._indexOffset % indexSize == 0, "OcclusionCuller::setMeshes(): index offset" << mesh._indexOffset << "is not a multiple of index size", );
+            input.push_back({boundingBoxes[i].min(), boundingBoxes[i].max(),
+                {UnsignedInt(mesh._count), UnsignedInt(mesh._instanceCount), UnsignedInt(mesh._indexOffset/indexSize), UnsignedInt(mesh._baseVertex)}, mesh._baseInstance});
+        }
+    }
+
+    _input.setData(input, BufferUsage::StaticDraw);
+    _inputMesh.setCount(input.size());
+    _commands.setData({nullptr, input.size()*(indexed ? sizeof(DrawElementsIndirectCommand) : sizeof(DrawArraysIndirectCommand))}, BufferUsage::DynamicCopy);
+    _feedback->attachBuffer(0, _commands);
+}
+
+void OcclusionCuller::cull(const Matrix4& transformationProjectionMatrix) {
+    if(_meshes.empty()) return;
+
+    /* Draw the boxes with all writes disabled, each into its own query */
+    if(_queryFallback) {
+        Renderer::setColorMask(false, false, false, false);
+        Renderer::setDepthMask(false);
+        _boxShader->setTransformationProjectionMatrix(transformationProjectionMatrix);
+        for(std::size_t i = 0; i != _meshes.size(); ++i) {
+            _queries[i].begin();
+            _box.draw(_boxShader->setBox(_boundingBoxes[i]));
+            _queries[i].end();
+        }
+        Renderer::setDepthMask(true);
+        Renderer::setColorMask(true, true, true, true);
+        return;
+    }
+
+    _pyramid.bind(0);
+    _cullShader->setTransformationProjectionMatrix(transformationProjectionMatrix)
+        .setMaxLevel(_levelCount - 1);
+
+    Renderer::enable(Renderer::Feature::RasterizerDiscard);
+    _feedback->begin(*_cullShader, TransformFeedback::PrimitiveMode::Points);
+    _inputMesh.draw(*_cullShader);
+    _feedback->end();
+    Renderer::disable(Renderer::Feature::RasterizerDiscard);
+}
+
+void OcclusionCuller::draw(AbstractShaderProgram& shader) {
+    if(_meshes.empty()) return;
+
+    if(_queryFallback) drawQueries(shader);
+    else drawGpu(shader);
+}
+
+void OcclusionCuller::drawGpu(AbstractShaderProgram& shader) {
+    Implementation::State& contextState = Context::current()->state();
+    const Implementation::MeshState& state = *contextState.mesh;
+
+    Mesh& original = _meshes[0].get()._original;
+
+    if(contextState.statisticsEnabled) {
+        ++contextState.statistics.drawCalls;
+        for(MeshView& mesh: _meshes)
+            contextState.statistics.vertices += UnsignedLong(mesh._count)*mesh._instanceCount;
+    }
+
+    shader.use();
+    _commands.bindInternal(Buffer::TargetHint::DrawIndirect);
+    (original.*state.bindImplementation)();
+
+    /* Without multi-draw, issue the commands one by one from the buffer */
+    const bool multiDraw = Context::current()->isExtensionSupported<Extensions::GL::ARB::multi_draw_indirect>();
+    if(!_indexed) {
+        if(multiDraw) glMultiDrawArraysIndirect(GLenum(original._primitive), nullptr, _meshes.size(), 0);
+        else for(std::size_t i = 0; i != _meshes.size(); ++i)
+            glDrawArraysIndirect(GLenum(original._primitive), reinterpret_cast<GLvoid*>(i*sizeof(DrawArraysIndirectCommand)));
+    } else {
+        if(multiDraw) glMultiDrawElementsIndirect(GLenum(original._primitive), GLenum(original._indexType), nullptr, _meshes.size(), 0);
+        else for(std::size_t i = 0; i != _meshes.size(); ++i)
+            glDrawElementsIndirect(GLenum(original._primitive), GLenum(original._indexType), reinterpret_cast<GLvoid*>(i*sizeof(DrawElementsIndirectCommand)));
+    }
+
+    (original.*state.unbindImplementation)();
+}
+
+void OcclusionCuller::drawQueries(AbstractShaderProgram& shader) {
+    for(std::size_t i = 0; i != _meshes.size(); ++i) {
+        _queries[i].beginConditionalRender(SampleQuery::ConditionalRenderMode::NoWait);
+        _meshes[i].get().draw(shader);
+        _queries[i].endConditionalRender();
+    }
+}
+
+}
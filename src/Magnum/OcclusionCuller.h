@@ -0,0 +1,212 @@
+#ifndef Magnum_OcclusionCuller_h
+#define Magnum_OcclusionCuller_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::OcclusionCuller
+ */
+
+#include <memory>
+#include <vector>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshView.h"
+#include "Magnum/SampleQuery.h"
+#include "Magnum/Texture.h"
+
+#ifndef MAGNUM_TARGET_GLES
+namespace Magnum {
+
+/**
+@brief Hierarchical-Z occlusion culler
+
+Culls meshes which are hidden behind objects drawn in the previous frame.
+Call @ref buildDepthPyramid() with depth texture of the previous frame. It
+reduces the depth texture into @ref depthPyramid(), with each mip level
+containing the farthest depth of corresponding 2x2 texels in the previous
+level. @ref cull() then tests bounding box of each mesh specified in
+@ref setMeshes() against the pyramid in a vertex shader. The visibility is
+written back into the indirect draw commands using @ref TransformFeedback,
+so the result never leaves the GPU. @ref draw() then submits all meshes with
+a single @fn_gl{MultiDrawElementsIndirect} call:
+@code
+OcclusionCuller culler{defaultFramebuffer.viewport().size()};
+culler.setMeshes(meshes, boundingBoxes);
+
+// each frame
+culler.buildDepthPyramid(previousDepth);
+culler.cull(projectionMatrix*cameraMatrix);
+culler.draw(shader);
+@endcode
+
+The bounding boxes are expected to be in the same coordinate system as the
+matrix passed to @ref cull(). Boxes crossing the near plane are always
+considered visible. Boxes outside of the view frustum are culled too.
+
+If @extension{ARB,draw_indirect} (part of OpenGL 4.0) or
+@extension{ARB,transform_feedback2} (part of OpenGL 4.0) is not available,
+the culler falls back to one @ref SampleQuery per mesh. @ref cull() then draws
+the bounding boxes against the current depth buffer with color and depth
+writes disabled and @ref draw() draws each mesh in a conditional rendering
+block. The depth pyramid is not used in that case, thus the occluders need to
+be drawn before calling @ref cull(). See @ref isQueryFallback().
+
+@attention All meshes must be views of the same original mesh. In case of
+    indexed meshes the index buffer offset must be a multiple of
+    @ref Mesh::indexSize().
+@requires_gl30 Extension @extension{ARB,texture_float} and
+    @extension{ARB,framebuffer_object}
+@requires_gl Indirect drawing is not available in OpenGL ES.
+*/
+class MAGNUM_EXPORT OcclusionCuller {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Size of the depth pyramid, should match size of
+         *      the depth texture
+         */
+        explicit OcclusionCuller(const Vector2i& size);
+
+        ~OcclusionCuller();
+
+        /** @brief Copying is not allowed */
+        OcclusionCuller(const OcclusionCuller&) = delete;
+
+        /** @brief Moving is not allowed */
+        OcclusionCuller(OcclusionCuller&&) = delete;
+
+        /** @brief Copying is not allowed */
+        OcclusionCuller& operator=(const OcclusionCuller&) = delete;
+
+        /** @brief Moving is not allowed */
+        OcclusionCuller& operator=(OcclusionCuller&&) = delete;
+
+        /**
+         * @brief Whether the culler uses sample query fallback
+         *
+         * See @ref OcclusionCuller "class documentation" for more
+         * information.
+         */
+        bool isQueryFallback() const { return _queryFallback; }
+
+        /**
+         * @brief Depth pyramid
+         *
+         * @ref TextureFormat::R32F texture with full mip chain.
+         */
+        Texture2D& depthPyramid() { return _pyramid; }
+
+        /** @brief Depth pyramid mip level count */
+        Int depthPyramidLevelCount() const { return _levelCount; }
+
+        /**
+         * @brief Set size of the depth pyramid
+         *
+         * Call when the window is resized.
+         */
+        void setSize(const Vector2i& size);
+
+        /**
+         * @brief Build depth pyramid
+         * @param depth     Depth texture of previous frame
+         *
+         * Does nothing if @ref isQueryFallback() is `true`. The viewport and
+         * framebuffer binding is changed, bind your framebuffer again
+         * afterwards.
+         */
+        void buildDepthPyramid(Texture2D& depth);
+
+        /**
+         * @brief Set meshes to cull
+         * @param meshes        Meshes
+         * @param boundingBoxes Bounding box of each mesh
+         *
+         * Builds draw commands and uploads them along with the bounding
+         * boxes. Call again when any of the meshes or boxes change.
+         */
+        void setMeshes(Containers::ArrayReference<const std::reference_wrapper<MeshView>> meshes, Containers::ArrayReference<const Range3D> boundingBoxes);
+
+        /** @overload */
+        void setMeshes(std::initializer_list<std::reference_wrapper<MeshView>> meshes, Containers::ArrayReference<const Range3D> boundingBoxes) {
+            setMeshes({meshes.begin(), meshes.size()}, boundingBoxes);
+        }
+
+        /**
+         * @brief Cull the meshes
+         * @param transformationProjectionMatrix    Transformation and
+         *      projection matrix of the bounding boxes
+         *
+         * Writes culled draw commands for @ref draw().
+         */
+        void cull(const Matrix4& transformationProjectionMatrix);
+
+        /**
+         * @brief Draw meshes which are not culled
+         *
+         * @see @ref MeshView::drawIndirect(), @fn_gl{UseProgram},
+         *      @fn_gl{BindBuffer} with @def_gl{DRAW_INDIRECT_BUFFER},
+         *      @fn_gl{BindVertexArray}, @fn_gl{MultiDrawElementsIndirect} or
+         *      @fn_gl{BeginConditionalRender}
+         */
+        void draw(AbstractShaderProgram& shader);
+
+    private:
+        class PyramidShader;
+        class CullShader;
+        class BoxShader;
+
+        void MAGNUM_LOCAL drawGpu(AbstractShaderProgram& shader);
+        void MAGNUM_LOCAL drawQueries(AbstractShaderProgram& shader);
+
+        bool _queryFallback, _indexed;
+        Int _levelCount;
+
+        Texture2D _pyramid;
+        Framebuffer _pyramidFramebuffer;
+        Mesh _fullScreenTriangle;
+        std::unique_ptr<PyramidShader> _copyShader, _reduceShader;
+
+        std::unique_ptr<CullShader> _cullShader;
+        std::unique_ptr<TransformFeedback> _feedback;
+        Buffer _input, _commands;
+        Mesh _inputMesh;
+
+        std::unique_ptr<BoxShader> _boxShader;
+        Mesh _box;
+        std::vector<SampleQuery> _queries;
+
+        std::vector<std::reference_wrapper<MeshView>> _meshes;
+        std::vector<Range3D> _boundingBoxes;
+};
+
+}
+#else
+#error this header is available only on desktop OpenGL build
+#endif
+
+#endif
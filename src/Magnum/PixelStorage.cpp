@@ -0,0 +1,136 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PixelStorage.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Context.h"
+
+#include "Implementation/State.h"
+#include "Implementation/RendererState.h"
+
+namespace Magnum {
+
+PixelStorage& PixelStorage::setAlignment(const Int alignment) {
+    CORRADE_ASSERT(alignment == 1 || alignment == 2 || alignment == 4 || alignment == 8,
+        "PixelStorage::setAlignment(): expected 1, 2, 4 or 8, got" << alignment, *this);
+    _alignment = alignment;
+    return *this;
+}
+
+std::pair<std::size_t, Math::Vector2<std::size_t>> PixelStorage::dataProperties(const std::size_t pixelSize, const Vector3i& size) const {
+    #ifndef MAGNUM_TARGET_GLES2
+    const std::size_t rowLength = _rowLength ? _rowLength : size.x();
+    const std::size_t imageHeight = _imageHeight ? _imageHeight : size.y();
+    #else
+    const std::size_t rowLength = size.x();
+    const std::size_t imageHeight = size.y();
+    #endif
+
+    const std::size_t rowStride = ((rowLength*pixelSize + _alignment - 1)/_alignment)*_alignment;
+    const std::size_t imageStride = rowStride*imageHeight;
+
+    #ifndef MAGNUM_TARGET_GLES2
+    const std::size_t offset = _skip.z()*imageStride + _skip.y()*rowStride + _skip.x()*pixelSize;
+    #else
+    const std::size_t offset = 0;
+    #endif
+
+    return {offset, {rowStride, imageStride}};
+}
+
+std::size_t PixelStorage::dataSize(const std::size_t pixelSize, const Vector3i& size) const {
+    if(!size.product()) return 0;
+
+    const Math::Vector2<std::size_t> stride = dataProperties(pixelSize, size).second;
+
+    /* Whole rows, except for the last one if the skip goes past the row
+       length */
+    #ifndef MAGNUM_TARGET_GLES2
+    const Vector3i skip = _skip;
+    #else
+    const Vector3i skip;
+    #endif
+    return stride[1]*(skip.z() + size.z() - 1) + stride[0]*(skip.y() + size.y() - 1) +
+        std::max(stride[0], (skip.x() + size.x())*pixelSize);
+}
+
+void PixelStorage::applyUnpack() const {
+    Implementation::RendererState::PixelStorageState& state = Context::current()->state().renderer->unpackPixelStorage;
+
+    if(state.alignment != _alignment)
+        glPixelStorei(GL_UNPACK_ALIGNMENT, state.alignment = _alignment);
+
+    #ifndef MAGNUM_TARGET_GLES2
+    if(state.rowLength != _rowLength)
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, state.rowLength = _rowLength);
+    if(state.imageHeight != _imageHeight)
+        glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, state.imageHeight = _imageHeight);
+    if(state.skip.x() != _skip.x())
+        glPixelStorei(GL_UNPACK_SKIP_PIXELS, state.skip.x() = _skip.x());
+    if(state.skip.y() != _skip.y())
+        glPixelStorei(GL_UNPACK_SKIP_ROWS, state.skip.y() = _skip.y());
+    if(state.skip.z() != _skip.z())
+        glPixelStorei(GL_UNPACK_SKIP_IMAGES, state.skip.z() = _skip.z());
+    #endif
+}
+
+void PixelStorage::applyPack() const {
+    Implementation::RendererState::PixelStorageState& state = Context::current()->state().renderer->packPixelStorage;
+
+    if(state.alignment != _alignment)
+        glPixelStorei(GL_PACK_ALIGNMENT, state.alignment = _alignment);
+
+    #ifndef MAGNUM_TARGET_GLES2
+    if(state.rowLength != _rowLength)
+        glPixelStorei(GL_PACK_ROW_LENGTH, state.rowLength = _rowLength);
+    if(state.skip.x() != _skip.x())
+        glPixelStorei(GL_PACK_SKIP_PIXELS, state.skip.x() = _skip.x());
+    if(state.skip.y() != _skip.y())
+        glPixelStorei(GL_PACK_SKIP_ROWS, state.skip.y() = _skip.y());
+    #endif
+
+    /* Three-dimensional texture queries are not available on ES */
+    #ifndef MAGNUM_TARGET_GLES
+    if(state.imageHeight != _imageHeight)
+        glPixelStorei(GL_PACK_IMAGE_HEIGHT, state.imageHeight = _imageHeight);
+    if(state.skip.z() != _skip.z())
+        glPixelStorei(GL_PACK_SKIP_IMAGES, state.skip.z() = _skip.z());
+    #endif
+}
+
+bool PixelStorage::operator==(const PixelStorage& other) const {
+    return _alignment == other._alignment
+        #ifndef MAGNUM_TARGET_GLES2
+        && _rowLength == other._rowLength
+        && _imageHeight == other._imageHeight
+        && _skip == other._skip
+        #endif
+        ;
+}
+
+}
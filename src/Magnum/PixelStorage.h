@@ -0,0 +1,210 @@
+#ifndef Magnum_PixelStorage_h
+#define Magnum_PixelStorage_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::PixelStorage
+ */
+
+#include <cstddef>
+#include <utility>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Pixel storage parameters
+
+Describes how image pixels are laid out in memory, i.e. the @fn_gl{PixelStore}
+state. The default values match the OpenGL defaults --- rows aligned to four
+bytes, tightly packed rows and images, no skipped pixels. Setting the row
+length, image height and skip makes it possible to reference a sub-rectangle
+of a larger image without copying it, for example a tile of a big atlas or a
+video frame with padded rows:
+@code
+// 256x256 tile at (512, 256) of a 2048x2048 RGBA atlas
+ImageReference2D tile{PixelStorage{}
+    .setRowLength(2048)
+    .setSkip({512, 256, 0}),
+    ColorFormat::RGBA, ColorType::UnsignedByte, {256, 256}, atlas.data()};
+texture.setSubImage(0, {}, tile);
+@endcode
+
+The parameters are applied when the image is passed to
+@ref Texture::setImage() "*Texture::setImage()",
+@ref Texture::setSubImage() "*Texture::setSubImage()",
+@ref Texture::image() "*Texture::image()",
+@ref Texture::subImage() "*Texture::subImage()" or
+@ref AbstractFramebuffer::read(). The pixel store state is tracked, so
+consecutive transfers with the same parameters don't result in any
+@fn_gl{PixelStore} calls.
+@see @ref ImageReference, @ref BufferImage
+*/
+class MAGNUM_EXPORT PixelStorage {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Alignment is `4`, row length and image height are `0` (i.e.
+         * derived from image size), skip is zero.
+         */
+        constexpr /*implicit*/ PixelStorage() noexcept: _alignment{4}
+            #ifndef MAGNUM_TARGET_GLES2
+            , _rowLength{0}, _imageHeight{0}, _skip{}
+            #endif
+            {}
+
+        /** @brief Row alignment */
+        constexpr Int alignment() const { return _alignment; }
+
+        /**
+         * @brief Set row alignment
+         * @return Reference to self (for method chaining)
+         *
+         * Valid values are `1`, `2`, `4` and `8`. Default is `4`.
+         * @see @fn_gl{PixelStore} with @def_gl{UNPACK_ALIGNMENT} or
+         *      @def_gl{PACK_ALIGNMENT}
+         */
+        PixelStorage& setAlignment(Int alignment);
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /** @brief Row length */
+        constexpr Int rowLength() const { return _rowLength; }
+
+        /**
+         * @brief Set row length
+         * @return Reference to self (for method chaining)
+         *
+         * Length of whole row in pixels. If set to `0`, the row length is
+         * taken from image size. Default is `0`.
+         * @see @fn_gl{PixelStore} with @def_gl{UNPACK_ROW_LENGTH} or
+         *      @def_gl{PACK_ROW_LENGTH}
+         * @requires_gles30 Pixel storage row length is not available in
+         *      OpenGL ES 2.0.
+         */
+        PixelStorage& setRowLength(Int length) {
+            _rowLength = length;
+            return *this;
+        }
+
+        /** @brief Image height */
+        constexpr Int imageHeight() const { return _imageHeight; }
+
+        /**
+         * @brief Set image height
+         * @return Reference to self (for method chaining)
+         *
+         * Height of whole image in rows, used only for three-dimensional
+         * images. If set to `0`, the height is taken from image size.
+         * Default is `0`.
+         * @see @fn_gl{PixelStore} with @def_gl{UNPACK_IMAGE_HEIGHT} or
+         *      @def_gl{PACK_IMAGE_HEIGHT}
+         * @requires_gles30 Pixel storage image height is not available in
+         *      OpenGL ES 2.0.
+         * @requires_gl Image height is used in OpenGL ES only for
+         *      uploading data, as three-dimensional texture queries are not
+         *      available there.
+         */
+        PixelStorage& setImageHeight(Int height) {
+            _imageHeight = height;
+            return *this;
+        }
+
+        /** @brief Pixel, row and image skip */
+        constexpr Vector3i skip() const { return _skip; }
+
+        /**
+         * @brief Set pixel, row and image skip
+         * @return Reference to self (for method chaining)
+         *
+         * Count of pixels, rows and images to skip from the start of the
+         * data. The image skip is used only for three-dimensional images.
+         * Default is zero.
+         * @see @fn_gl{PixelStore} with @def_gl{UNPACK_SKIP_PIXELS},
+         *      @def_gl{UNPACK_SKIP_ROWS}, @def_gl{UNPACK_SKIP_IMAGES} or
+         *      @def_gl{PACK_SKIP_PIXELS}, @def_gl{PACK_SKIP_ROWS},
+         *      @def_gl{PACK_SKIP_IMAGES}
+         * @requires_gles30 Pixel storage skip is not available in OpenGL ES
+         *      2.0.
+         * @requires_gl Image skip is used in OpenGL ES only for uploading
+         *      data, as three-dimensional texture queries are not available
+         *      there.
+         */
+        PixelStorage& setSkip(const Vector3i& skip) {
+            _skip = skip;
+            return *this;
+        }
+        #endif
+
+        /**
+         * @brief Data properties for given parameters
+         * @param pixelSize     Size of one pixel in bytes
+         * @param size          Image size, with `1` in unused dimensions
+         *
+         * Returns byte offset of the first pixel of the image from the
+         * start of the data and row and image stride in bytes.
+         */
+        std::pair<std::size_t, Math::Vector2<std::size_t>> dataProperties(std::size_t pixelSize, const Vector3i& size) const;
+
+        /**
+         * @brief Data size for given parameters
+         * @param pixelSize     Size of one pixel in bytes
+         * @param size          Image size, with `1` in unused dimensions
+         *
+         * Size of memory that needs to be available starting at the data
+         * pointer, including the skipped pixels, rows and images.
+         */
+        std::size_t dataSize(std::size_t pixelSize, const Vector3i& size) const;
+
+        /** @brief Equality comparison */
+        bool operator==(const PixelStorage& other) const;
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const PixelStorage& other) const {
+            return !operator==(other);
+        }
+
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        /* Applies the parameters to GL unpack or pack state, skipping values
+           that didn't change since last time */
+        void MAGNUM_LOCAL applyUnpack() const;
+        void MAGNUM_LOCAL applyPack() const;
+        #endif
+
+    private:
+        Int _alignment;
+        #ifndef MAGNUM_TARGET_GLES2
+        Int _rowLength, _imageHeight;
+        Vector3i _skip;
+        #endif
+};
+
+}
+
+#endif
@@ -60,7 +60,7 @@ AndroidApplication::AndroidApplication(const Arguments& arguments, const Configu
     createContext(configuration);
 }
 
-AndroidApplication::AndroidApplication(const Arguments& arguments, std::nullptr_t): _state(arguments) {
+AndroidApplication::AndroidApplication(const Arguments& arguments, std::nullptr_t): _state(arguments), _display{EGL_NO_DISPLAY}, _surface{EGL_NO_SURFACE}, _context{EGL_NO_CONTEXT} {
     /* Redirect debug output to Android log */
     _logOutput.reset(new LogOutput);
 }
@@ -68,7 +68,7 @@ AndroidApplication::AndroidApplication(const Arguments& arguments, std::nullptr_
 AndroidApplication::~AndroidApplication() {
     eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
     eglDestroyContext(_display, _context);
-    eglDestroySurface(_display, _surface);
+    if(_surface != EGL_NO_SURFACE) eglDestroySurface(_display, _surface);
     eglTerminate(_display);
 }
 
@@ -97,26 +97,46 @@ bool AndroidApplication::tryCreateContext(const Configuration& configuration) {
         EGL_NONE
     };
     EGLint configCount;
-    EGLConfig config;
-    if(!eglChooseConfig(_display, configAttributes, &config, 1, &configCount)) {
+    if(!eglChooseConfig(_display, configAttributes, &_config, 1, &configCount)) {
         Error() << "Platform::AndroidApplication::tryCreateContext(): cannot choose EGL config:"
                 << Implementation::eglErrorString(eglGetError());
         return false;
     }
 
+    /* Create surface and context */
+    _windowSize = configuration.size();
+    if(!createSurface()) return false;
+    if(!(_context = createEglContext())) {
+        Error() << "Platform::AndroidApplication::tryCreateContext(): cannot create EGL context:"
+                << Implementation::eglErrorString(eglGetError());
+        return false;
+    }
+
+    /* Make the context current */
+    CORRADE_INTERNAL_ASSERT_OUTPUT(eglMakeCurrent(_display, _surface, _surface, _context));
+
+    _c.reset(new Platform::Context);
+    return true;
+}
+
+bool AndroidApplication::createSurface() {
     /* Resize native window and match it to the selected format */
     EGLint format;
-    CORRADE_INTERNAL_ASSERT_OUTPUT(eglGetConfigAttrib(_display, config, EGL_NATIVE_VISUAL_ID, &format));
+    CORRADE_INTERNAL_ASSERT_OUTPUT(eglGetConfigAttrib(_display, _config, EGL_NATIVE_VISUAL_ID, &format));
     ANativeWindow_setBuffersGeometry(_state->window,
-        configuration.size().isZero() ? 0 : configuration.size().x(),
-        configuration.size().isZero() ? 0 : configuration.size().y(), format);
+        _windowSize.isZero() ? 0 : _windowSize.x(),
+        _windowSize.isZero() ? 0 : _windowSize.y(), format);
 
-    /* Create surface and context */
-    if(!(_surface = eglCreateWindowSurface(_display, config, _state->window, nullptr))) {
-        Error() << "Platform::AndroidApplication::tryCreateContext(): cannot create EGL window surface:"
+    if(!(_surface = eglCreateWindowSurface(_display, _config, _state->window, nullptr))) {
+        Error() << "Platform::AndroidApplication: cannot create EGL window surface:"
                 << Implementation::eglErrorString(eglGetError());
         return false;
     }
+
+    return true;
+}
+
+EGLContext AndroidApplication::createEglContext() {
     const EGLint contextAttributes[] = {
         #ifdef MAGNUM_TARGET_GLES2
         EGL_CONTEXT_CLIENT_VERSION, 2,
@@ -127,17 +147,48 @@ bool AndroidApplication::tryCreateContext(const Configuration& configuration) {
         #endif
         EGL_NONE
     };
-    if(!(_context = eglCreateContext(_display, config, EGL_NO_CONTEXT, contextAttributes))) {
-        Error() << "Platform::AndroidApplication::tryCreateContext(): cannot create EGL context:"
-                << Implementation::eglErrorString(eglGetError());
-        return false;
-    }
+    return eglCreateContext(_display, _config, EGL_NO_CONTEXT, contextAttributes);
+}
 
-    /* Make the context current */
-    CORRADE_INTERNAL_ASSERT_OUTPUT(eglMakeCurrent(_display, _surface, _surface, _context));
+void AndroidApplication::destroySurface() {
+    /* Keep the context alive, just detach it from the surface */
+    eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroySurface(_display, _surface);
+    _surface = EGL_NO_SURFACE;
+}
 
-    _c.reset(new Platform::Context);
-    return true;
+void AndroidApplication::restoreSurface() {
+    if(!createSurface()) return;
+
+    /* The context is usually preserved while the application is in
+       background, but the system can throw it away under memory pressure.
+       In that case create a new one and let the application recreate its
+       resources. */
+    if(!eglMakeCurrent(_display, _surface, _surface, _context)) {
+        const EGLint error = eglGetError();
+        if(error != EGL_CONTEXT_LOST && error != EGL_BAD_CONTEXT) {
+            Error() << "Platform::AndroidApplication: cannot make context current:"
+                    << Implementation::eglErrorString(error);
+            return;
+        }
+
+        eglDestroyContext(_display, _context);
+        if(!(_context = createEglContext())) {
+            Error() << "Platform::AndroidApplication: cannot recreate lost EGL context:"
+                    << Implementation::eglErrorString(eglGetError());
+            return;
+        }
+        CORRADE_INTERNAL_ASSERT_OUTPUT(eglMakeCurrent(_display, _surface, _surface, _context));
+
+        _c.reset();
+        _c.reset(new Platform::Context);
+        contextLostEvent();
+    }
+
+    /* The window might have different size than before, e.g. due to
+       changed orientation */
+    viewportEvent({ANativeWindow_getWidth(_state->window), ANativeWindow_getHeight(_state->window)});
+    redraw();
 }
 
 void AndroidApplication::swapBuffers() {
@@ -145,6 +196,7 @@ void AndroidApplication::swapBuffers() {
 }
 
 void AndroidApplication::viewportEvent(const Vector2i&) {}
+void AndroidApplication::contextLostEvent() {}
 void AndroidApplication::mousePressEvent(MouseEvent&) {}
 void AndroidApplication::mouseReleaseEvent(MouseEvent&) {}
 void AndroidApplication::mouseMoveEvent(MouseMoveEvent&) {}
@@ -171,12 +223,15 @@ void AndroidApplication::commandEvent(android_app* state, int32_t cmd) {
             if(!data.instance) {
                 data.instance = data.instancer(state);
                 data.instance->drawEvent();
-            }
+
+            /* Or just attach it to the new window when resuming */
+            } else data.instance->restoreSurface();
             break;
 
         case APP_CMD_TERM_WINDOW:
-            /* Destroy the application */
-            data.instance.reset();
+            /* Keep the application and its OpenGL resources alive while in
+               background, just give up the window */
+            if(data.instance) data.instance->destroySurface();
             break;
 
         case APP_CMD_GAINED_FOCUS:
@@ -232,7 +287,7 @@ void AndroidApplication::exec(android_app* state, std::unique_ptr<AndroidApplica
         int ident, events;
         android_poll_source* source;
         while((ident = ALooper_pollAll(
-            data.instance && (data.instance->_flags & Flag::Redraw) ? 0 : -1,
+            data.instance && data.instance->_surface != EGL_NO_SURFACE && (data.instance->_flags & Flag::Redraw) ? 0 : -1,
             nullptr, &events, reinterpret_cast<void**>(&source))) >= 0)
         {
             /* Process this event OH SIR MAY MY POOR EXISTENCE CALL THIS
@@ -244,9 +299,9 @@ void AndroidApplication::exec(android_app* state, std::unique_ptr<AndroidApplica
             if(state->destroyRequested != 0) return;
         }
 
-        /* Redraw the app if it wants to be redrawn. Frame limiting is done by
-           Android itself */
-        if(data.instance && (data.instance->_flags & Flag::Redraw))
+        /* Redraw the app if it wants to be redrawn and has a window. Frame
+           limiting is done by Android itself */
+        if(data.instance && data.instance->_surface != EGL_NO_SURFACE && (data.instance->_flags & Flag::Redraw))
             data.instance->drawEvent();
     }
 
@@ -256,6 +256,22 @@ class AndroidApplication {
         /** @copydoc Sdl2Application::drawEvent() */
         virtual void drawEvent() = 0;
 
+        /**
+         * @brief Context lost event
+         *
+         * The application and its OpenGL context are kept alive while the
+         * application is in background, so all resources are still
+         * available after it is resumed. The system can however discard the
+         * context under memory pressure. In that case a new context is
+         * created when the application is resumed and this function is
+         * called. All OpenGL objects created before are gone, destroy them
+         * first and then recreate them from data kept on the CPU side.
+         * Creating them lazily, e.g. with @ref ResourceManager loaders,
+         * makes the resources needed for the next frame available first.
+         * Default implementation does nothing.
+         */
+        virtual void contextLostEvent();
+
         /*@}*/
 
         /** @{ @name Mouse handling */
@@ -301,12 +317,19 @@ class AndroidApplication {
         static void commandEvent(android_app* state, std::int32_t cmd);
         static std::int32_t inputEvent(android_app* state, AInputEvent* event);
 
+        bool createSurface();
+        EGLContext createEglContext();
+        void destroySurface();
+        void restoreSurface();
+
         android_app* const _state;
         Flags _flags;
 
         EGLDisplay _display;
+        EGLConfig _config;
         EGLSurface _surface;
         EGLContext _context;
+        Vector2i _windowSize;
 
         std::unique_ptr<Platform::Context> _c;
         std::unique_ptr<LogOutput> _logOutput;
@@ -31,6 +31,7 @@
 
 #include <Corrade/Containers/EnumSet.h>
 
+#include "Magnum/Math/Range.h"
 #include "Magnum/Platform/ScreenedApplication.h"
 
 namespace Magnum { namespace Platform {
@@ -134,6 +135,14 @@ template<class Application> class BasicScreen: private Containers::LinkedListIte
          */
         void setPropagatedEvents(PropagatedEvents events) { _propagatedEvents = events; }
 
+        /**
+         * @brief Whether the screen requested a redraw
+         *
+         * Set by @ref redraw() and @ref redrawRectangle(), reset right
+         * before the application is redrawn.
+         */
+        bool isDirty() const { return _dirty; }
+
         /** @brief Application holding this screen */
         template<class T = BasicScreenedApplication<Application>> T* application() {
             return static_cast<T*>(Containers::LinkedListItem<BasicScreen<Application>, BasicScreenedApplication<Application>>::list());
@@ -172,8 +181,25 @@ template<class Application> class BasicScreen: private Containers::LinkedListIte
         }
 
     protected:
-        /** @brief Request redraw */
-        virtual void redraw() { application()->redraw(); }
+        /**
+         * @brief Request redraw
+         *
+         * Marks the whole screen as dirty and requests redraw of the
+         * application.
+         * @see @ref redrawRectangle()
+         */
+        virtual void redraw();
+
+        /**
+         * @brief Request redraw of given rectangle
+         *
+         * Marks given area of the screen as dirty and requests redraw of the
+         * application. The rectangle is in pixels with origin in bottom left
+         * corner, same as for @ref Renderer::setScissor(). See
+         * @ref BasicScreenedApplication for more information.
+         * @see @ref redraw()
+         */
+        void redrawRectangle(const Range2Di& rectangle);
 
         /**
          * @brief Focus event
@@ -259,6 +285,8 @@ template<class Application> class BasicScreen: private Containers::LinkedListIte
 
     private:
         PropagatedEvents _propagatedEvents;
+        Range2Di _damage;
+        bool _dirty, _fullDamage;
 };
 
 }}
@@ -29,9 +29,11 @@
  * @brief Class @ref Magnum::Platform::BasicScreenedApplication
  */
 
+#include <deque>
 #include <Corrade/Containers/LinkedList.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Platform/Platform.h"
 
 namespace Magnum { namespace Platform {
@@ -81,6 +83,45 @@ for(Screen* s = app.screens().first(); s; s = s->nextFartherScreen()) {
 }
 @endcode
 
+## Redrawing only what changed
+
+The application is redrawn only if requested, either by calling
+@ref Sdl2Application::redraw() "redraw()" on the application or on any
+screen. Screens can request redraw of only a part of the window using
+@ref BasicScreen::redrawRectangle(). The rectangles of all screens are joined
+and, if no screen requested redraw of the whole window, the drawing is
+limited to the joined rectangle using @ref Renderer::Feature::ScissorTest.
+All screens with @ref BasicScreen::PropagatedEvent::Draw enabled still get
+@ref BasicScreen::drawEvent() "drawEvent()" in back-to-front order, they
+can use @ref damage() to skip drawing of things outside of the area. The
+scissor test affects also @ref DefaultFramebuffer::clear() and it is
+disabled again after @ref globalDrawEvent().
+
+Whether the back buffer keeps its contents after buffer swap depends on the
+platform, so partial redraw is disabled by default and everything is redrawn
+every time. If you know the back buffer age, set it with @ref setBufferAge()
+and the areas redrawn in the previous frames will be redrawn again as needed.
+Together with the application sleeping until next event or redraw request
+(use e.g. @ref Sdl2Application::redrawAfter() for animations), this keeps
+idle tool UIs from draining the battery:
+@code
+class Toolbar: public Platform::Screen {
+    // ...
+
+    void mouseMoveEvent(MouseMoveEvent& event) override {
+        const Int hovered = buttonAt(event.position());
+        if(hovered == _hovered) return;
+
+        // Redraw only the old and the new hovered button
+        if(_hovered != -1) redrawRectangle(_buttonRectangles[_hovered]);
+        if(hovered != -1) redrawRectangle(_buttonRectangles[hovered]);
+        _hovered = hovered;
+    }
+};
+
+app.setBufferAge(2);
+@endcode
+
 ## Explicit template specializations
 
 The following specialization are explicitly compiled into each particular
@@ -170,6 +211,30 @@ template<class Application> class BasicScreenedApplication: public Application,
             return static_cast<const Containers::LinkedList<BasicScreen<Application>>&>(*this);
         }
 
+        /**
+         * @brief Damaged area
+         *
+         * Area of the window redrawn in the current draw event, in pixels
+         * with origin in bottom left corner. The whole window if everything
+         * is redrawn. See @ref BasicScreenedApplication "class documentation" for more
+         * information.
+         */
+        Range2Di damage() const { return _damage; }
+
+        /** @brief Back buffer age */
+        UnsignedInt bufferAge() const { return _bufferAge; }
+
+        /**
+         * @brief Set back buffer age
+         * @return Reference to self (for method chaining)
+         *
+         * Count of frames the back buffer contents are old after buffer
+         * swap. `0` means the contents are undefined and everything is
+         * redrawn every time, `1` means the contents are preserved, `2` is
+         * the usual double-buffering and so on. Default is `0`.
+         */
+        BasicScreenedApplication<Application>& setBufferAge(UnsignedInt age);
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         /**
          * @brief Front screen
@@ -236,6 +301,13 @@ template<class Application> class BasicScreenedApplication: public Application,
         void mousePressEvent(typename Application::MouseEvent& event) override final;
         void mouseReleaseEvent(typename Application::MouseEvent& event) override final;
         void mouseMoveEvent(typename Application::MouseMoveEvent& event) override final;
+
+        Vector2i _viewportSize;
+        Range2Di _damage;
+        UnsignedInt _bufferAge;
+
+        /* Areas redrawn in previous frames, the most recent first */
+        std::deque<Range2Di> _damageHistory;
 };
 
 }}
@@ -27,23 +27,35 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref ScreenedApplication.h and @ref Screen.h
  */
 
+#include "Magnum/Renderer.h"
 #include "Magnum/Platform/Screen.h"
 #include "Magnum/Platform/ScreenedApplication.h"
 
 namespace Magnum { namespace Platform {
 
-template<class Application> BasicScreen<Application>::BasicScreen() = default;
+template<class Application> BasicScreen<Application>::BasicScreen(): _dirty{false}, _fullDamage{false} {}
 template<class Application> BasicScreen<Application>::~BasicScreen() = default;
 
+template<class Application> void BasicScreen<Application>::redraw() {
+    _dirty = _fullDamage = true;
+    application()->redraw();
+}
+
+template<class Application> void BasicScreen<Application>::redrawRectangle(const Range2Di& rectangle) {
+    if(!_fullDamage) _damage = _dirty ? _damage.joined(rectangle) : rectangle;
+    _dirty = true;
+    application()->redraw();
+}
+
 template<class Application> void BasicScreen<Application>::keyPressEvent(KeyEvent&) {}
 template<class Application> void BasicScreen<Application>::keyReleaseEvent(KeyEvent&) {}
 template<class Application> void BasicScreen<Application>::mousePressEvent(MouseEvent&) {}
 template<class Application> void BasicScreen<Application>::mouseReleaseEvent(MouseEvent&) {}
 template<class Application> void BasicScreen<Application>::mouseMoveEvent(MouseMoveEvent&) {}
 
-template<class Application> BasicScreenedApplication<Application>::BasicScreenedApplication(const typename Application::Arguments& arguments, const typename Application::Configuration& configuration): Application(arguments, configuration) {}
+template<class Application> BasicScreenedApplication<Application>::BasicScreenedApplication(const typename Application::Arguments& arguments, const typename Application::Configuration& configuration): Application(arguments, configuration), _bufferAge{0} {}
 
-template<class Application> BasicScreenedApplication<Application>::BasicScreenedApplication(const typename Application::Arguments& arguments, std::nullptr_t): Application(arguments, nullptr) {}
+template<class Application> BasicScreenedApplication<Application>::BasicScreenedApplication(const typename Application::Arguments& arguments, std::nullptr_t): Application(arguments, nullptr), _bufferAge{0} {}
 
 template<class Application> BasicScreenedApplication<Application>::~BasicScreenedApplication() = default;
 
@@ -72,9 +84,19 @@ template<class Application> BasicScreenedApplication<Application>& BasicScreened
     return *this;
 }
 
+template<class Application> BasicScreenedApplication<Application>& BasicScreenedApplication<Application>::setBufferAge(const UnsignedInt age) {
+    _bufferAge = age;
+    _damageHistory.clear();
+    return *this;
+}
+
 template<class Application> void BasicScreenedApplication<Application>::globalViewportEvent(const Vector2i&) {}
 
 template<class Application> void BasicScreenedApplication<Application>::viewportEvent(const Vector2i& size) {
+    /* The buffers have new contents, forget what was drawn in them */
+    _viewportSize = size;
+    _damageHistory.clear();
+
     /* Call global event before all other (to resize framebuffer first) */
     globalViewportEvent(size);
 
@@ -82,12 +104,56 @@ template<class Application> void BasicScreenedApplication<Application>::viewport
 }
 
 template<class Application> void BasicScreenedApplication<Application>::drawEvent() {
+    /* Join dirty areas of all screens. If no screen is dirty, the redraw was
+       requested for the whole application, e.g. after adding a screen. The
+       flags are reset before drawing so the screens can request another
+       redraw from their draw events. */
+    bool dirty = false, full = false;
+    Range2Di damage;
+    for(BasicScreen<Application>& s: *this) {
+        if(!s._dirty) continue;
+
+        if(s._fullDamage) full = true;
+        else damage = dirty ? damage.joined(s._damage) : s._damage;
+        dirty = true;
+        s._dirty = s._fullDamage = false;
+    }
+
+    /* Partial redraw is possible only if the back buffer contents from
+       bufferAge() frames ago are known */
+    const Range2Di viewport{{}, _viewportSize};
+    const bool partial = dirty && !full && _bufferAge && _viewportSize.product() && _damageHistory.size() + 1 >= _bufferAge;
+    Range2Di current = viewport;
+    _damage = viewport;
+    if(partial) {
+        /* Nothing visible changed */
+        current = damage.intersected(viewport);
+        if(!(current.size() > Vector2i{0}).all()) return;
+
+        /* Redraw also what changed since the back buffer was drawn */
+        _damage = current;
+        for(const Range2Di& previous: _damageHistory)
+            _damage = _damage.joined(previous);
+    }
+
+    if(_bufferAge > 1) {
+        _damageHistory.push_front(current);
+        if(_damageHistory.size() >= _bufferAge) _damageHistory.pop_back();
+    }
+
+    if(partial) {
+        Renderer::enable(Renderer::Feature::ScissorTest);
+        Renderer::setScissor(_damage);
+    }
+
     /* Back-to-front rendering */
     for(BasicScreen<Application>* s = screens().last(); s; s = s->nextNearerScreen())
         if(s->propagatedEvents() & Implementation::PropagatedScreenEvent::Draw) s->drawEvent();
 
     /* Call global event after all other (to swap buffers last) */
     globalDrawEvent();
+
+    if(partial) Renderer::disable(Renderer::Feature::ScissorTest);
 }
 
 template<class Application> void BasicScreenedApplication<Application>::keyPressEvent(typename Application::KeyEvent& event) {
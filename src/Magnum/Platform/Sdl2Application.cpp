@@ -26,6 +26,11 @@
 #include "Sdl2Application.h"
 
 #ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <tuple>
 #else
 #include <emscripten/emscripten.h>
@@ -53,8 +58,72 @@ Sdl2Application::InputEvent::Modifiers fixedModifiers(Uint16 mod) {
     return modifiers;
 }
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+/* Bounded lock-free queue for one producer and one consumer thread */
+template<class T, std::size_t size> class SpscQueue {
+    public:
+        explicit SpscQueue(): _head{0}, _tail{0} {}
+
+        /* Called only from the producer thread, returns false if full */
+        bool push(const T& value) {
+            const std::size_t tail = _tail.load(std::memory_order_relaxed);
+            const std::size_t next = (tail + 1)%size;
+            if(next == _head.load(std::memory_order_acquire)) return false;
+
+            _data[tail] = value;
+            _tail.store(next, std::memory_order_release);
+            return true;
+        }
+
+        /* Called only from the consumer thread, returns false if empty */
+        bool pop(T& value) {
+            const std::size_t head = _head.load(std::memory_order_relaxed);
+            if(head == _tail.load(std::memory_order_acquire)) return false;
+
+            value = _data[head];
+            _head.store((head + 1)%size, std::memory_order_release);
+            return true;
+        }
+
+        bool isEmpty() const {
+            return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+        }
+
+    private:
+        T _data[size];
+        std::atomic<std::size_t> _head, _tail;
+};
+#endif
+
 }
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+struct Sdl2Application::RenderThread {
+    explicit RenderThread(): redraw{true}, exit{false}, hasPendingViewport{false} {}
+
+    /* Wakes up the render thread. The mutex is locked so the notification
+       can't get lost between checking the condition and waiting. */
+    void notify() {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+        }
+        condition.notify_one();
+    }
+
+    /* Viewport sizes from the main thread */
+    SpscQueue<Vector2i, 16> viewportEvents;
+    std::atomic<bool> redraw, exit;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::thread thread;
+
+    /* Accessed only from the main thread, used if the queue was full */
+    bool hasPendingViewport;
+    Vector2i pendingViewport;
+};
+#endif
+
 #ifdef CORRADE_TARGET_EMSCRIPTEN
 Sdl2Application* Sdl2Application::_instance = nullptr;
 void Sdl2Application::staticMainLoop() {
@@ -70,7 +139,14 @@ Sdl2Application::Sdl2Application(const Arguments& arguments, const Configuration
     createContext(configuration);
 }
 
-Sdl2Application::Sdl2Application(const Arguments&, std::nullptr_t): _glContext{nullptr}, _flags{Flag::Redraw} {
+Sdl2Application::Sdl2Application(const Arguments&, std::nullptr_t): _glContext{nullptr},
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    _drawDuration{0.0f}, _gpuFrameDuration{0.0f}, _framePacing{false},
+    #else
+    _swapInterval{1},
+    #endif
+    _redrawDeadline{0}, _flags{Flag::Redraw}
+{
     #ifdef CORRADE_TARGET_EMSCRIPTEN
     CORRADE_ASSERT(!_instance, "Platform::Sdl2Application::Sdl2Application(): the instance is already created", );
     _instance = this;
@@ -204,17 +280,89 @@ bool Sdl2Application::tryCreateContext(const Configuration& configuration) {
     #endif
 
     _context.reset(new Platform::Context);
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    if(configuration.hasRenderThread()) _renderThread.reset(new RenderThread);
+    #endif
+
     return true;
 }
 
 void Sdl2Application::swapBuffers() {
     #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* Track the longest recent frame duration, so a single faster frame
+       doesn't cause missing the refresh with the next one */
+    if(_framePacing) {
+        const Float duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - _drawStart).count()/1e6f + _gpuFrameDuration;
+        _drawDuration = duration > _drawDuration ? duration : _drawDuration*0.9f + duration*0.1f;
+    }
+
     SDL_GL_SwapWindow(_window);
+    _swapTimeline.bufferSwapped();
     #else
     SDL_Flip(_glContext);
     #endif
 }
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+Sdl2Application::SharedContext::SharedContext(Sdl2Application& application): _window{application._window}, _glContext{nullptr} {
+    CORRADE_ASSERT(application._glContext, "Platform::Sdl2Application::SharedContext: application context not created", );
+
+    /* SDL always makes the new context current, switch back */
+    SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
+    _glContext = SDL_GL_CreateContext(_window);
+    SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 0);
+    SDL_GL_MakeCurrent(_window, application._glContext);
+
+    if(!_glContext)
+        Error() << "Platform::Sdl2Application::SharedContext: cannot create context:" << SDL_GetError();
+}
+
+Sdl2Application::SharedContext::~SharedContext() {
+    if(!_glContext) return;
+
+    if(SDL_GL_GetCurrentContext() == _glContext) SDL_GL_MakeCurrent(_window, nullptr);
+    SDL_GL_DeleteContext(_glContext);
+}
+
+bool Sdl2Application::SharedContext::makeCurrent() {
+    CORRADE_ASSERT(_glContext, "Platform::Sdl2Application::SharedContext::makeCurrent(): the context is not created", false);
+
+    if(SDL_GL_MakeCurrent(_window, _glContext) != 0) {
+        Error() << "Platform::Sdl2Application::SharedContext::makeCurrent(): cannot make context current:" << SDL_GetError();
+        return false;
+    }
+
+    return true;
+}
+
+bool Sdl2Application::setSwapInterval(const Int interval) {
+    if(SDL_GL_SetSwapInterval(interval) == 0) return true;
+
+    if(interval == -1) {
+        Warning() << "Platform::Sdl2Application::setSwapInterval(): adaptive vsync not supported:" << SDL_GetError() << "(falling back to vsync)";
+        SDL_GL_SetSwapInterval(1);
+    } else Error() << "Platform::Sdl2Application::setSwapInterval(): cannot set swap interval:" << SDL_GetError();
+
+    return false;
+}
+
+Float Sdl2Application::framePacingDelay() const {
+    if(!_framePacing) return 0.0f;
+
+    /* Leave some headroom for wakeup latency and swap itself */
+    return _swapTimeline.timeToDeadline(_drawDuration + 0.002f);
+}
+#else
+bool Sdl2Application::setSwapInterval(const Int interval) {
+    /* The main loop timing can't be set before the main loop is running, so
+       it's done in the next iteration */
+    _swapInterval = interval;
+    _flags |= Flag::SwapIntervalChanged;
+    return true;
+}
+#endif
+
 Sdl2Application::~Sdl2Application() {
     _context.reset();
 
@@ -231,7 +379,21 @@ Sdl2Application::~Sdl2Application() {
 
 int Sdl2Application::exec() {
     #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* Hand the context over to the render thread */
+    if(_renderThread) {
+        SDL_GL_MakeCurrent(_window, nullptr);
+        _renderThread->thread = std::thread{&Sdl2Application::renderLoop, this};
+    }
+
     while(!(_flags & Flag::Exit)) mainLoop();
+
+    /* Wait for the current frame to finish and take the context back */
+    if(_renderThread) {
+        _renderThread->exit = true;
+        _renderThread->notify();
+        _renderThread->thread.join();
+        SDL_GL_MakeCurrent(_window, _glContext);
+    }
     #else
     emscripten_set_main_loop(staticMainLoop, 0, true);
     #endif
@@ -240,13 +402,104 @@ int Sdl2Application::exec() {
 
 void Sdl2Application::exit() {
     #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* Might be called from the render thread, wake up the main thread with a
+       quit event, which then sets the exit flag */
+    if(_renderThread) {
+        SDL_Event event;
+        event.type = SDL_QUIT;
+        SDL_PushEvent(&event);
+        return;
+    }
+
     _flags |= Flag::Exit;
     #else
     emscripten_cancel_main_loop();
     #endif
 }
 
+void Sdl2Application::redraw() {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    if(_renderThread) {
+        _renderThread->redraw = true;
+        _renderThread->notify();
+        return;
+    }
+    #endif
+
+    _flags |= Flag::Redraw;
+}
+
+void Sdl2Application::redrawAfter(const Float seconds) {
+    /* Zero means no redraw scheduled */
+    Uint32 deadline = SDL_GetTicks() + Uint32(seconds*1000.0f);
+    if(!deadline) deadline = 1;
+
+    /* Keep the earlier deadline. The tick counter wraps around, so compare
+       the difference. */
+    Uint32 current = _redrawDeadline;
+    do {
+        if(current && Sint32(current - deadline) <= 0) return;
+    } while(!_redrawDeadline.compare_exchange_weak(current, deadline));
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* Might be called from the render thread, wake up the main thread so it
+       waits for the new deadline */
+    if(_renderThread) {
+        SDL_Event event;
+        event.type = SDL_USEREVENT;
+        SDL_PushEvent(&event);
+    }
+    #endif
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void Sdl2Application::waitEvent() {
+    const Uint32 deadline = _redrawDeadline;
+    if(deadline) SDL_WaitEventTimeout(nullptr, std::max(Sint32(deadline - SDL_GetTicks()), Sint32(0)));
+    else SDL_WaitEvent(nullptr);
+}
+
+void Sdl2Application::renderLoop() {
+    SDL_GL_MakeCurrent(_window, _glContext);
+
+    RenderThread& state = *_renderThread;
+    while(!state.exit) {
+        /* Process only the last viewport size, the previous would be drawn
+           only to be thrown away */
+        Vector2i size;
+        bool resized = false;
+        while(state.viewportEvents.pop(size)) resized = true;
+        if(resized) viewportEvent(size);
+
+        if(state.redraw.exchange(false)) {
+            /* Input is handled on the other thread, so just sleep */
+            const Float delay = framePacingDelay();
+            if(delay) std::this_thread::sleep_for(std::chrono::microseconds{std::size_t(delay*1e6f)});
+
+            _drawStart = std::chrono::high_resolution_clock::now();
+            drawEvent();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{state.mutex};
+        state.condition.wait(lock, [&state]() {
+            return state.exit || state.redraw || !state.viewportEvents.isEmpty();
+        });
+    }
+
+    SDL_GL_MakeCurrent(_window, nullptr);
+}
+#endif
+
 void Sdl2Application::mainLoop() {
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    if(_flags & Flag::SwapIntervalChanged) {
+        _flags &= ~Flag::SwapIntervalChanged;
+        if(_swapInterval) emscripten_set_main_loop_timing(EM_TIMING_RAF, _swapInterval > 0 ? _swapInterval : 1);
+        else emscripten_set_main_loop_timing(EM_TIMING_SETTIMEOUT, 0);
+    }
+    #endif
+
     SDL_Event event;
 
     while(SDL_PollEvent(&event)) {
@@ -254,11 +507,19 @@ void Sdl2Application::mainLoop() {
             case SDL_WINDOWEVENT:
                 switch(event.window.event) {
                     case SDL_WINDOWEVENT_RESIZED:
+                        #ifndef CORRADE_TARGET_EMSCRIPTEN
+                        /* Viewport event is handled on the render thread */
+                        if(_renderThread) {
+                            _renderThread->pendingViewport = {event.window.data1, event.window.data2};
+                            _renderThread->hasPendingViewport = true;
+                            break;
+                        }
+                        #endif
                         viewportEvent({event.window.data1, event.window.data2});
                         _flags |= Flag::Redraw;
                         break;
                     case SDL_WINDOWEVENT_EXPOSED:
-                        _flags |= Flag::Redraw;
+                        redraw();
                         break;
                 } break;
 
@@ -296,14 +557,46 @@ void Sdl2Application::mainLoop() {
         }
     }
 
+    /* Scheduled redraw is due */
+    Uint32 deadline = _redrawDeadline;
+    if(deadline && Sint32(deadline - SDL_GetTicks()) <= 0 && _redrawDeadline.compare_exchange_strong(deadline, 0))
+        redraw();
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* Pass the new viewport size to the render thread. If the queue is full,
+       try again shortly instead of blocking input handling. */
+    if(_renderThread) {
+        if(_renderThread->hasPendingViewport && _renderThread->viewportEvents.push(_renderThread->pendingViewport)) {
+            _renderThread->hasPendingViewport = false;
+            redraw();
+        }
+
+        if(_renderThread->hasPendingViewport) SDL_WaitEventTimeout(nullptr, 1);
+        else waitEvent();
+        return;
+    }
+    #endif
+
     if(_flags & Flag::Redraw) {
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        /* Postpone the drawing closer to the next refresh, handling input
+           events arriving in the meantime */
+        const Int delay = Int(framePacingDelay()*1000.0f);
+        if(delay) {
+            SDL_WaitEventTimeout(nullptr, delay);
+            return;
+        }
+
+        _drawStart = std::chrono::high_resolution_clock::now();
+        #endif
+
         _flags &= ~Flag::Redraw;
         drawEvent();
         return;
     }
 
     #ifndef CORRADE_TARGET_EMSCRIPTEN
-    SDL_WaitEvent(nullptr);
+    waitEvent();
     #endif
 }
 
@@ -331,7 +624,7 @@ Sdl2Application::Configuration::Configuration():
     #endif
     _size(800, 600), _windowFlags{}, _sampleCount(0)
     #ifndef CORRADE_TARGET_EMSCRIPTEN
-    , _version(Version::None)
+    , _version(Version::None), _renderThread{false}
     #endif
     {}
 
@@ -29,11 +29,13 @@
  * @brief Class @ref Magnum::Platform::Sdl2Application, macro @ref MAGNUM_SDL2APPLICATION_MAIN()
  */
 
+#include <atomic>
 #include <memory>
 #include <Corrade/Corrade.h>
 #include <Corrade/Containers/EnumSet.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Timeline.h"
 #include "Magnum/Math/Vector2.h"
 #include "Magnum/Platform/Platform.h"
 
@@ -173,6 +175,30 @@ The CSS file contains rudimentary style to avoid eye bleeding.
 The application redirects all output (thus also @ref Corrade::Utility::Debug "Debug",
 @ref Corrade::Utility::Warning "Warning" and @ref Corrade::Utility::Error "Error")
 to JavaScript console.
+
+@anchor Platform-Sdl2Application-render-thread
+## Rendering on a dedicated thread
+
+By default events are processed and the screen is redrawn on the same thread,
+so a long @ref drawEvent() delays handling of user input and vice versa. Enable
+@ref Configuration::setRenderThread() to move the OpenGL context to a
+dedicated thread started in @ref exec(). The main thread then only waits for
+SDL events and calls @ref keyPressEvent(), @ref mousePressEvent() and other
+input handlers immediately, regardless of how long the current frame takes.
+Window size changes and redraw requests are passed to the render thread
+through a lock-free queue, the render thread calls @ref viewportEvent() and
+@ref drawEvent().
+
+Input handlers thus run in parallel with @ref drawEvent() and you need to
+synchronize state shared between them yourself, e.g. using atomics or a mutex.
+Don't call any OpenGL functions from input handlers, @ref redraw() and
+@ref exit() can be called from both threads. The context is current on the
+main thread again after @ref exec() returns, so OpenGL objects can be
+destroyed in the application destructor as usual.
+
+@note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten". Some
+    platforms (e.g. OS X) don't support rendering to a window from other than
+    the main thread.
 */
 class Sdl2Application {
     public:
@@ -183,6 +209,9 @@ class Sdl2Application {
         };
 
         class Configuration;
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        class SharedContext;
+        #endif
         class InputEvent;
         class KeyEvent;
         class MouseEvent;
@@ -234,7 +263,12 @@ class Sdl2Application {
          */
         int exec();
 
-        /** @brief Exit application main loop */
+        /**
+         * @brief Exit application main loop
+         *
+         * With @ref Platform-Sdl2Application-render-thread "render thread"
+         * enabled it can be called from any thread.
+         */
         void exit();
 
     protected:
@@ -279,14 +313,79 @@ class Sdl2Application {
          */
         void swapBuffers();
 
+        /**
+         * @brief Set swap interval
+         *
+         * Set `0` for no vertical sync, `1` for vertical sync and `-1` for
+         * adaptive vertical sync, which swaps immediately if the frame missed
+         * the refresh, trading stutter for tearing. If adaptive vertical sync
+         * is not supported, falls back to ordinary vertical sync. Returns
+         * `false` if given swap interval couldn't be set.
+         *
+         * In @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the main loop is
+         * driven by `requestAnimationFrame()` and the interval is the number
+         * of animation frames between two main loop iterations, `0` schedules
+         * the iterations using `setTimeout()` instead and `-1` is the same as
+         * `1`. The change is applied at the start of next main loop
+         * iteration, the function always returns `true`.
+         * @see @ref setFramePacing()
+         */
+        bool setSwapInterval(Int interval);
+
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        /**
+         * @brief Enable or disable frame pacing
+         *
+         * If enabled, @ref drawEvent() is postponed as late as possible
+         * before next predicted display refresh, while still handling input
+         * events, so the frame is drawn using the most recent input. The
+         * refresh is predicted from @ref swapBuffers() timing using
+         * @ref Timeline::bufferSwapped() and the frame duration is measured
+         * from start of @ref drawEvent() to @ref swapBuffers(). Makes sense
+         * only with vertical sync enabled using @ref setSwapInterval().
+         * Disabled by default. With
+         * @ref Platform-Sdl2Application-render-thread "render thread" enabled
+         * call it only before @ref exec() or from @ref drawEvent().
+         * @note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+         * @see @ref setGpuFrameDuration()
+         */
+        void setFramePacing(bool enabled) { _framePacing = enabled; }
+
+        /**
+         * @brief Set duration of GPU work for frame pacing
+         *
+         * The CPU time spent in @ref drawEvent() doesn't include the time
+         * the GPU needs to finish the frame. Measure it e.g. using
+         * @ref TimeQuery timestamps and pass it here to make the frame
+         * pacing predictions more accurate. Default is `0.0f`. Same thread
+         * restrictions as for @ref setFramePacing() apply.
+         * @note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+         */
+        void setGpuFrameDuration(Float seconds) { _gpuFrameDuration = seconds; }
+        #endif
+
         /**
          * @brief Redraw immediately
          *
          * Marks the window for redrawing, resulting in call to @ref drawEvent()
          * in the next iteration. You can call it from @ref drawEvent() itself
-         * to redraw immediately without waiting for user input.
+         * to redraw immediately without waiting for user input. With
+         * @ref Platform-Sdl2Application-render-thread "render thread" enabled
+         * it can be called from any thread.
+         */
+        void redraw();
+
+        /**
+         * @brief Redraw after given time
+         *
+         * Calls @ref redraw() after given time elapses, so animations can
+         * run at their own rate while the application sleeps waiting for
+         * events in between. If there's already an earlier redraw scheduled,
+         * the function does nothing. The precision is one millisecond. With
+         * @ref Platform-Sdl2Application-render-thread "render thread" enabled
+         * it can be called from any thread.
          */
-        void redraw() { _flags |= Flag::Redraw; }
+        void redrawAfter(Float seconds);
 
     #ifdef DOXYGEN_GENERATING_OUTPUT
     protected:
@@ -390,6 +489,8 @@ class Sdl2Application {
             Redraw = 1 << 0,
             #ifndef CORRADE_TARGET_EMSCRIPTEN
             Exit = 1 << 1
+            #else
+            SwapIntervalChanged = 1 << 1
             #endif
         };
 
@@ -404,14 +505,31 @@ class Sdl2Application {
         void mainLoop();
 
         #ifndef CORRADE_TARGET_EMSCRIPTEN
+        struct RenderThread;
+
+        void waitEvent();
+
+        void renderLoop();
+        Float framePacingDelay() const;
+
         SDL_Window* _window;
         SDL_GLContext _glContext;
+        std::unique_ptr<RenderThread> _renderThread;
+
+        Timeline _swapTimeline;
+        std::chrono::high_resolution_clock::time_point _drawStart;
+        Float _drawDuration, _gpuFrameDuration;
+        bool _framePacing;
         #else
         SDL_Surface* _glContext;
+        Int _swapInterval;
         #endif
 
         std::unique_ptr<Platform::Context> _context;
 
+        /* SDL_GetTicks() value of scheduled redraw, 0 if none */
+        std::atomic<Uint32> _redrawDeadline;
+
         Flags _flags;
 };
 
@@ -590,6 +708,33 @@ class Sdl2Application::Configuration {
             return *this;
         }
 
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        /**
+         * @brief Whether rendering is done on a dedicated thread
+         *
+         * @note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+         */
+        bool hasRenderThread() const { return _renderThread; }
+        #endif
+
+        /**
+         * @brief Render on a dedicated thread
+         * @return Reference to self (for method chaining)
+         *
+         * Default is `false`, see @ref Platform-Sdl2Application-render-thread "Rendering on a dedicated thread"
+         * for more information.
+         * @note In @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" this function
+         *      does nothing.
+         */
+        Configuration& setRenderThread(bool enabled) {
+            #ifndef CORRADE_TARGET_EMSCRIPTEN
+            _renderThread = enabled;
+            #else
+            static_cast<void>(enabled);
+            #endif
+            return *this;
+        }
+
         /** @brief Sample count */
         Int sampleCount() const { return _sampleCount; }
 
@@ -615,6 +760,7 @@ class Sdl2Application::Configuration {
         #ifndef CORRADE_TARGET_EMSCRIPTEN
         Version _version;
         Flags _flags;
+        bool _renderThread;
         #endif
 };
 
@@ -623,6 +769,64 @@ CORRADE_ENUMSET_OPERATORS(Sdl2Application::Configuration::Flags)
 #endif
 CORRADE_ENUMSET_OPERATORS(Sdl2Application::Configuration::WindowFlags)
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+/**
+@brief Shared OpenGL context
+
+Secondary OpenGL context sharing buffers, textures and other objects with the
+application context. Used for uploading data on a loader thread,
+see @ref Context for a complete example.
+
+@note Not available in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten".
+*/
+class Sdl2Application::SharedContext {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * Has to be called from the thread where the application context is
+         * current, e.g. in application constructor. The application context
+         * stays current afterwards. Prints message to error output on
+         * failure, check @ref isCreated() afterwards.
+         */
+        explicit SharedContext(Sdl2Application& application);
+
+        /**
+         * @brief Destructor
+         *
+         * The context is released first if it is current in the calling
+         * thread.
+         */
+        ~SharedContext();
+
+        /** @brief Copying is not allowed */
+        SharedContext(const SharedContext&) = delete;
+
+        /** @brief Moving is not allowed */
+        SharedContext(SharedContext&&) = delete;
+
+        /** @brief Copying is not allowed */
+        SharedContext& operator=(const SharedContext&) = delete;
+
+        /** @brief Moving is not allowed */
+        SharedContext& operator=(SharedContext&&) = delete;
+
+        /** @brief Whether the context was successfully created */
+        bool isCreated() const { return _glContext; }
+
+        /**
+         * @brief Make the context current in calling thread
+         *
+         * Prints message to error output and returns `false` on failure.
+         */
+        bool makeCurrent();
+
+    private:
+        SDL_Window* _window;
+        SDL_GLContext _glContext;
+};
+#endif
+
 /**
 @brief Base for input events
 
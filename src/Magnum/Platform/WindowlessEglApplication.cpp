@@ -0,0 +1,226 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "WindowlessEglApplication.h"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+#include <EGL/eglext.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Platform/Context.h"
+#include "Implementation/Egl.h"
+
+namespace Magnum { namespace Platform {
+
+namespace {
+
+bool hasClientExtension(const char* const extension) {
+    const char* const extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if(!extensions) return false;
+
+    /* Extension names are separated by spaces, avoid matching prefixes */
+    const std::size_t length = std::strlen(extension);
+    for(const char* found = extensions; (found = std::strstr(found, extension)); found += length)
+        if((found == extensions || found[-1] == ' ') && (found[length] == ' ' || found[length] == '\0'))
+            return true;
+
+    return false;
+}
+
+std::vector<EGLDeviceEXT> enumerateDevices() {
+    if(!hasClientExtension("EGL_EXT_device_enumeration") || !hasClientExtension("EGL_EXT_platform_device"))
+        return {};
+
+    auto eglQueryDevices = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(eglGetProcAddress("eglQueryDevicesEXT"));
+    EGLint count = 0;
+    if(!eglQueryDevices || !eglQueryDevices(0, nullptr, &count) || !count)
+        return {};
+
+    std::vector<EGLDeviceEXT> out(count);
+    if(!eglQueryDevices(count, out.data(), &count)) return {};
+    out.resize(count);
+    return out;
+}
+
+}
+
+UnsignedInt WindowlessEglContext::deviceCount() {
+    return enumerateDevices().size();
+}
+
+WindowlessEglContext::WindowlessEglContext(const Configuration& configuration): _display{EGL_NO_DISPLAY}, _surface{EGL_NO_SURFACE}, _glContext{EGL_NO_CONTEXT} {
+    /* Display on given device, if device enumeration is supported. Displays
+       are shared among all contexts on the same device. */
+    const std::vector<EGLDeviceEXT> devices = enumerateDevices();
+    if(!devices.empty()) {
+        CORRADE_ASSERT(configuration.device() < devices.size(),
+            "Platform::WindowlessEglContext: requested device" << configuration.device() << "but only" << devices.size() << "are available", );
+
+        auto eglGetPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        _display = eglGetPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, devices[configuration.device()], nullptr);
+    } else _display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    if(!eglInitialize(_display, nullptr, nullptr)) {
+        Error() << "Platform::WindowlessEglContext: cannot initialize EGL:" << Implementation::eglErrorString(eglGetError());
+        return;
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    const EGLenum api = EGL_OPENGL_API;
+    #else
+    const EGLenum api = EGL_OPENGL_ES_API;
+    #endif
+    if(!eglBindAPI(api)) {
+        Error() << "Platform::WindowlessEglContext: cannot bind EGL API:" << Implementation::eglErrorString(eglGetError());
+        return;
+    }
+
+    /* Choose EGL config */
+    static const EGLint attribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RED_SIZE, 1,
+        EGL_GREEN_SIZE, 1,
+        EGL_BLUE_SIZE, 1,
+        EGL_DEPTH_SIZE, 1,
+        #ifndef MAGNUM_TARGET_GLES
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        #elif defined(MAGNUM_TARGET_GLES3)
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT_KHR,
+        #elif defined(MAGNUM_TARGET_GLES2)
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,
+        #else
+        #error Unsupported OpenGL edition
+        #endif
+        EGL_NONE
+    };
+    EGLConfig config;
+    EGLint configCount;
+    if(!eglChooseConfig(_display, attribs, &config, 1, &configCount)) {
+        Error() << "Platform::WindowlessEglContext: cannot get EGL config:" << Implementation::eglErrorString(eglGetError());
+        return;
+    }
+
+    if(!configCount) {
+        Error() << "Platform::WindowlessEglContext: no matching EGL config available";
+        return;
+    }
+
+    /* Create pbuffer */
+    static const EGLint pbufferAttributes[] = {
+        EGL_WIDTH, 32,
+        EGL_HEIGHT, 32,
+        EGL_NONE
+    };
+    if(!(_surface = eglCreatePbufferSurface(_display, config, pbufferAttributes))) {
+        Error() << "Platform::WindowlessEglContext: cannot create pbuffer surface:" << Implementation::eglErrorString(eglGetError());
+        return;
+    }
+
+    static const EGLint contextAttributes[] = {
+        /* We need this to run ES (default is desktop GL) */
+        #ifdef MAGNUM_TARGET_GLES
+        EGL_CONTEXT_CLIENT_VERSION,
+        #ifdef MAGNUM_TARGET_GLES3
+        3,
+        #elif defined(MAGNUM_TARGET_GLES2)
+        2,
+        #else
+        #error Unsupported OpenGL ES version
+        #endif
+        #endif
+        EGL_NONE
+    };
+    if(!(_glContext = eglCreateContext(_display, config, configuration.sharedContext(), contextAttributes))) {
+        Error() << "Platform::WindowlessEglContext: cannot create EGL context:" << Implementation::eglErrorString(eglGetError());
+        _glContext = EGL_NO_CONTEXT;
+    }
+}
+
+WindowlessEglContext::WindowlessEglContext(WindowlessEglContext&& other) noexcept: _display{other._display}, _surface{other._surface}, _glContext{other._glContext} {
+    other._display = EGL_NO_DISPLAY;
+    other._surface = EGL_NO_SURFACE;
+    other._glContext = EGL_NO_CONTEXT;
+}
+
+WindowlessEglContext& WindowlessEglContext::operator=(WindowlessEglContext&& other) noexcept {
+    std::swap(_display, other._display);
+    std::swap(_surface, other._surface);
+    std::swap(_glContext, other._glContext);
+    return *this;
+}
+
+WindowlessEglContext::~WindowlessEglContext() {
+    if(_glContext != EGL_NO_CONTEXT) {
+        if(eglGetCurrentContext() == _glContext)
+            eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(_display, _glContext);
+    }
+    if(_surface != EGL_NO_SURFACE) eglDestroySurface(_display, _surface);
+
+    /* Not terminating the display, as it is shared with other contexts on
+       the same device */
+}
+
+bool WindowlessEglContext::makeCurrent() {
+    CORRADE_ASSERT(isCreated(), "Platform::WindowlessEglContext::makeCurrent(): the context is not created", false);
+
+    if(!eglMakeCurrent(_display, _surface, _surface, _glContext)) {
+        Error() << "Platform::WindowlessEglContext::makeCurrent(): cannot make context current:" << Implementation::eglErrorString(eglGetError());
+        return false;
+    }
+
+    return true;
+}
+
+WindowlessEglApplication::WindowlessEglApplication(const Arguments& arguments, const Configuration& configuration): WindowlessEglApplication{arguments, nullptr} {
+    createContext(configuration);
+}
+
+WindowlessEglApplication::WindowlessEglApplication(const Arguments&, std::nullptr_t) {}
+
+void WindowlessEglApplication::createContext(const Configuration& configuration) {
+    if(!tryCreateContext(configuration)) std::exit(1);
+}
+
+bool WindowlessEglApplication::tryCreateContext(const Configuration& configuration) {
+    CORRADE_ASSERT(!_context, "Platform::WindowlessEglApplication::tryCreateContext(): context already created", false);
+
+    std::unique_ptr<WindowlessEglContext> glContext{new WindowlessEglContext{configuration}};
+    if(!glContext->isCreated() || !glContext->makeCurrent()) return false;
+
+    _glContext = std::move(glContext);
+    _context.reset(new Platform::Context);
+    return true;
+}
+
+WindowlessEglApplication::~WindowlessEglApplication() {
+    _context.reset();
+    _glContext.reset();
+}
+
+}}
@@ -0,0 +1,315 @@
+#ifndef Magnum_Platform_WindowlessEglApplication_h
+#define Magnum_Platform_WindowlessEglApplication_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Platform::WindowlessEglContext, @ref Magnum::Platform::WindowlessEglApplication, macro @ref MAGNUM_WINDOWLESSEGLAPPLICATION_MAIN()
+ */
+
+#include <memory>
+#include <EGL/egl.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Platform/Context.h"
+
+namespace Magnum { namespace Platform {
+
+/**
+@brief Windowless EGL context
+
+Headless OpenGL context created using EGL without any windowing system,
+optionally on a particular GPU. Unlike @ref WindowlessEglApplication it can be
+instantiated more than once, which together with Magnum built with
+`BUILD_MULTITHREADED` allows rendering from more threads at the same time.
+Each thread creates its own OpenGL context, makes it current and then creates
+its own @ref Platform::Context with its own state tracker:
+@code
+const UnsignedInt deviceCount = Math::max(Platform::WindowlessEglContext::deviceCount(), 1u);
+
+std::vector<std::thread> workers;
+for(UnsignedInt i = 0; i != std::thread::hardware_concurrency(); ++i) workers.emplace_back([i, deviceCount]() {
+    Platform::WindowlessEglContext glContext{Platform::WindowlessEglContext::Configuration{}
+        .setDevice(i%deviceCount)};
+    if(!glContext.isCreated() || !glContext.makeCurrent()) return;
+
+    Platform::Context context;
+
+    Framebuffer framebuffer{Range2Di{{}, {256, 256}}};
+    // render thumbnails into the framebuffer ...
+});
+
+for(std::thread& worker: workers) worker.join();
+@endcode
+
+The context has only a tiny pbuffer surface, render into @ref Framebuffer
+objects instead of @ref DefaultFramebuffer. Selecting a GPU needs
+`EGL_EXT_device_enumeration` and `EGL_EXT_platform_device` client
+extensions, if they are not available, the default display is used
+for all contexts. OpenGL function pointers are shared by all contexts, so all
+used GPUs should be driven by the same driver.
+
+This class is part of @ref WindowlessEglApplication library, see its
+documentation for information about building and usage in CMake.
+*/
+class WindowlessEglContext {
+    public:
+        class Configuration;
+
+        /**
+         * @brief Count of available GPU devices
+         *
+         * Returns `0` if device enumeration is not supported by the EGL
+         * implementation.
+         * @see @ref Configuration::setDevice()
+         */
+        static UnsignedInt deviceCount();
+
+        /**
+         * @brief Constructor
+         *
+         * Creates the context, but doesn't make it current. Prints message to
+         * error output on failure, check @ref isCreated() afterwards.
+         * @see @ref makeCurrent()
+         */
+        explicit WindowlessEglContext(const Configuration& configuration);
+
+        /**
+         * @brief Destructor
+         *
+         * The context is released first if it is current in the calling
+         * thread.
+         */
+        ~WindowlessEglContext();
+
+        /** @brief Copying is not allowed */
+        WindowlessEglContext(const WindowlessEglContext&) = delete;
+
+        /** @brief Move constructor */
+        WindowlessEglContext(WindowlessEglContext&& other) noexcept;
+
+        /** @brief Copying is not allowed */
+        WindowlessEglContext& operator=(const WindowlessEglContext&) = delete;
+
+        /** @brief Move assignment */
+        WindowlessEglContext& operator=(WindowlessEglContext&& other) noexcept;
+
+        /** @brief Whether the context was successfully created */
+        bool isCreated() const { return _glContext != EGL_NO_CONTEXT; }
+
+        /**
+         * @brief Underlying EGL context
+         *
+         * Can be passed to @ref Configuration::setSharedContext().
+         */
+        EGLContext glContext() const { return _glContext; }
+
+        /**
+         * @brief Make the context current in calling thread
+         *
+         * Prints message to error output and returns `false` on failure.
+         */
+        bool makeCurrent();
+
+    private:
+        EGLDisplay _display;
+        EGLSurface _surface;
+        EGLContext _glContext;
+};
+
+/**
+@brief Configuration
+
+@see @ref WindowlessEglContext(), @ref WindowlessEglApplication(),
+    @ref WindowlessEglApplication::createContext(),
+    @ref WindowlessEglApplication::tryCreateContext()
+*/
+class WindowlessEglContext::Configuration {
+    public:
+        /*implicit*/ Configuration(): _device{}, _sharedContext{EGL_NO_CONTEXT} {}
+
+        /** @brief GPU device ID */
+        UnsignedInt device() const { return _device; }
+
+        /**
+         * @brief Set GPU device ID
+         * @return Reference to self (for method chaining)
+         *
+         * Expected to be smaller than @ref deviceCount(). Ignored if device
+         * enumeration is not supported. Default is `0`.
+         */
+        Configuration& setDevice(UnsignedInt id) {
+            _device = id;
+            return *this;
+        }
+
+        /** @brief Context to share OpenGL objects with */
+        EGLContext sharedContext() const { return _sharedContext; }
+
+        /**
+         * @brief Set context to share OpenGL objects with
+         * @return Reference to self (for method chaining)
+         *
+         * The context must be on the same device. Default is
+         * `EGL_NO_CONTEXT`, thus no sharing. See @ref Context for more
+         * information about using shared contexts.
+         * @see @ref WindowlessEglContext::glContext()
+         */
+        Configuration& setSharedContext(EGLContext context) {
+            _sharedContext = context;
+            return *this;
+        }
+
+    private:
+        UnsignedInt _device;
+        EGLContext _sharedContext;
+};
+
+/**
+@brief Windowless EGL application
+
+Application for offscreen rendering using @ref WindowlessEglContext, without
+any windowing system. Useful for rendering on headless servers.
+
+This application library is available on platforms with EGL. It depends on
+**EGL** library and is built if `WITH_WINDOWLESSEGLAPPLICATION` is enabled in
+CMake.
+
+## General usage
+
+In CMake you need to request `WindowlessEglApplication` component, add
+`${MAGNUM_WINDOWLESSEGLAPPLICATION_INCLUDE_DIRS}` to include path and link to
+`${MAGNUM_WINDOWLESSEGLAPPLICATION_LIBRARIES}`. If no other windowless
+application is requested, you can also use generic
+`${MAGNUM_WINDOWLESSAPPLICATION_INCLUDE_DIRS}` and
+`${MAGNUM_WINDOWLESSAPPLICATION_LIBRARIES}` aliases to simplify porting. Again,
+see @ref building and @ref cmake for more information.
+
+Place your code into @ref exec(). The subclass can be then used directly in
+`main()` -- see convenience macro @ref MAGNUM_WINDOWLESSEGLAPPLICATION_MAIN().
+See @ref platform for more information.
+@code
+class MyApplication: public Platform::WindowlessEglApplication {
+    // implement required methods...
+};
+MAGNUM_WINDOWLESSEGLAPPLICATION_MAIN(MyApplication)
+@endcode
+
+If no other application header is included, this class is also aliased to
+`Platform::WindowlessApplication` and the macro is aliased to
+`MAGNUM_WINDOWLESSAPPLICATION_MAIN()` to simplify porting.
+
+For rendering from more threads at once create additional
+@ref WindowlessEglContext instances, see its documentation for an example.
+*/
+class WindowlessEglApplication {
+    public:
+        /** @brief Application arguments */
+        struct Arguments {
+            int& argc;      /**< @brief Argument count */
+            char** argv;    /**< @brief Argument values */
+        };
+
+        /** @brief Configuration */
+        typedef WindowlessEglContext::Configuration Configuration;
+
+        /** @copydoc Sdl2Application::Sdl2Application(const Arguments&, const Configuration&) */
+        explicit WindowlessEglApplication(const Arguments& arguments, const Configuration& configuration = Configuration());
+
+        /** @copydoc Sdl2Application::Sdl2Application(const Arguments&, std::nullptr_t) */
+        explicit WindowlessEglApplication(const Arguments& arguments, std::nullptr_t);
+
+        /** @brief Copying is not allowed */
+        WindowlessEglApplication(const WindowlessEglApplication&) = delete;
+
+        /** @brief Moving is not allowed */
+        WindowlessEglApplication(WindowlessEglApplication&&) = delete;
+
+        /** @brief Copying is not allowed */
+        WindowlessEglApplication& operator=(const WindowlessEglApplication&) = delete;
+
+        /** @brief Moving is not allowed */
+        WindowlessEglApplication& operator=(WindowlessEglApplication&&) = delete;
+
+        /**
+         * @brief Execute application
+         * @return Value for returning from `main()`
+         *
+         * See @ref MAGNUM_WINDOWLESSEGLAPPLICATION_MAIN() for usage
+         * information.
+         */
+        virtual int exec() = 0;
+
+    protected:
+        /* Nobody will need to have (and delete) WindowlessEglApplication*,
+           thus this is faster than public pure virtual destructor */
+        ~WindowlessEglApplication();
+
+        /** @copydoc Sdl2Application::createContext() */
+        void createContext(const Configuration& configuration = Configuration());
+
+        /** @copydoc Sdl2Application::tryCreateContext() */
+        bool tryCreateContext(const Configuration& configuration);
+
+    private:
+        std::unique_ptr<WindowlessEglContext> _glContext;
+        std::unique_ptr<Platform::Context> _context;
+};
+
+/** @hideinitializer
+@brief Entry point for windowless EGL application
+@param className Class name
+
+See @ref Magnum::Platform::WindowlessEglApplication "Platform::WindowlessEglApplication"
+for usage information. This macro abstracts out platform-specific entry point
+code and is equivalent to the following, see @ref portability-applications for
+more information.
+@code
+int main(int argc, char** argv) {
+    className app({argc, argv});
+    return app.exec();
+}
+@endcode
+When no other windowless application header is included this macro is also
+aliased to `MAGNUM_WINDOWLESSAPPLICATION_MAIN()`.
+*/
+#define MAGNUM_WINDOWLESSEGLAPPLICATION_MAIN(className)                     \
+    int main(int argc, char** argv) {                                       \
+        className app({argc, argv});                                        \
+        return app.exec();                                                  \
+    }
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_WINDOWLESSAPPLICATION_MAIN
+typedef WindowlessEglApplication WindowlessApplication;
+#define MAGNUM_WINDOWLESSAPPLICATION_MAIN(className) MAGNUM_WINDOWLESSEGLAPPLICATION_MAIN(className)
+#else
+#undef MAGNUM_WINDOWLESSAPPLICATION_MAIN
+#endif
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,106 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PrimitiveCache.h"
+
+#include <unordered_map>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshTools/Compile.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Primitives {
+
+namespace {
+    struct CompiledMesh {
+        Mesh mesh;
+        std::unique_ptr<Buffer> vertexBuffer, indexBuffer;
+    };
+}
+
+struct PrimitiveCache::State {
+    std::unordered_map<std::string, Trade::MeshData2D> data2D;
+    std::unordered_map<std::string, Trade::MeshData3D> data3D;
+    std::unordered_map<std::string, CompiledMesh> meshes;
+};
+
+PrimitiveCache::PrimitiveCache(): _state{new State} {}
+
+PrimitiveCache::PrimitiveCache(PrimitiveCache&&) noexcept = default;
+
+PrimitiveCache::~PrimitiveCache() = default;
+
+PrimitiveCache& PrimitiveCache::operator=(PrimitiveCache&&) noexcept = default;
+
+std::size_t PrimitiveCache::dataCount() const {
+    return _state->data2D.size() + _state->data3D.size();
+}
+
+std::size_t PrimitiveCache::meshCount() const {
+    return _state->meshes.size();
+}
+
+void PrimitiveCache::clear() {
+    _state->meshes.clear();
+    _state->data2D.clear();
+    _state->data3D.clear();
+}
+
+const Trade::MeshData2D* PrimitiveCache::find2D(const std::string& key) const {
+    auto found = _state->data2D.find(key);
+    return found == _state->data2D.end() ? nullptr : &found->second;
+}
+
+const Trade::MeshData3D* PrimitiveCache::find3D(const std::string& key) const {
+    auto found = _state->data3D.find(key);
+    return found == _state->data3D.end() ? nullptr : &found->second;
+}
+
+Mesh* PrimitiveCache::findMesh(const std::string& key) {
+    auto found = _state->meshes.find(key);
+    return found == _state->meshes.end() ? nullptr : &found->second.mesh;
+}
+
+const Trade::MeshData2D& PrimitiveCache::insert(std::string&& key, Trade::MeshData2D&& data) {
+    return _state->data2D.emplace(std::move(key), std::move(data)).first->second;
+}
+
+const Trade::MeshData3D& PrimitiveCache::insert(std::string&& key, Trade::MeshData3D&& data) {
+    return _state->data3D.emplace(std::move(key), std::move(data)).first->second;
+}
+
+Mesh& PrimitiveCache::compile(const std::string& key, const Trade::MeshData2D& data) {
+    auto compiled = MeshTools::compile(data, BufferUsage::StaticDraw);
+    return _state->meshes.emplace(key, CompiledMesh{std::move(std::get<0>(compiled)), std::move(std::get<1>(compiled)), std::move(std::get<2>(compiled))}).first->second.mesh;
+}
+
+Mesh& PrimitiveCache::compile(const std::string& key, const Trade::MeshData3D& data) {
+    auto compiled = MeshTools::compile(data, BufferUsage::StaticDraw);
+    return _state->meshes.emplace(key, CompiledMesh{std::move(std::get<0>(compiled)), std::move(std::get<1>(compiled)), std::move(std::get<2>(compiled))}).first->second.mesh;
+}
+
+}}
@@ -0,0 +1,184 @@
+#ifndef Magnum_Primitives_PrimitiveCache_h
+#define Magnum_Primitives_PrimitiveCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Primitives::PrimitiveCache
+ */
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Primitives/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace Primitives {
+
+namespace Implementation {
+    /* The parameters are numbers, enums or enum sets, so their binary
+       representation is enough to identify them */
+    template<class T> void appendKey(std::string& key, const T& value) {
+        key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    inline void appendKeys(std::string&) {}
+    template<class T, class ...U> void appendKeys(std::string& key, const T& first, const U&... next) {
+        appendKey(key, first);
+        appendKeys(key, next...);
+    }
+}
+
+/**
+@brief Primitive cache
+
+Memoizes generated primitive data and compiled meshes, so primitives used
+repeatedly (for example by debug renderers) are generated and uploaded only
+once. A primitive is identified by the generator function and the values of
+all its parameters:
+@code
+Primitives::PrimitiveCache cache;
+
+// Generated on first use, returned from the cache afterwards
+const Trade::MeshData3D& data = cache.data(Primitives::Icosphere::solid, 3);
+Mesh& sphere = cache.mesh(Primitives::UVSphere::solid, 16, 32, Primitives::UVSphere::TextureCoords::DontGenerate);
+@endcode
+
+Default parameter values can't be deduced, so all parameters need to be
+specified. The meshes are compiled using @ref MeshTools::compile() with
+@ref BufferUsage::StaticDraw, the cache owns all the meshes and buffers and
+the returned references are valid until @ref clear() is called or the cache is
+destroyed. The cache is not thread-safe.
+*/
+class MAGNUM_PRIMITIVES_EXPORT PrimitiveCache {
+    public:
+        explicit PrimitiveCache();
+
+        /** @brief Copying is not allowed */
+        PrimitiveCache(const PrimitiveCache&) = delete;
+
+        /** @brief Move constructor */
+        PrimitiveCache(PrimitiveCache&&) noexcept;
+
+        ~PrimitiveCache();
+
+        /** @brief Copying is not allowed */
+        PrimitiveCache& operator=(const PrimitiveCache&) = delete;
+
+        /** @brief Move assignment */
+        PrimitiveCache& operator=(PrimitiveCache&&) noexcept;
+
+        /** @brief Count of cached primitive data */
+        std::size_t dataCount() const;
+
+        /** @brief Count of cached compiled meshes */
+        std::size_t meshCount() const;
+
+        /**
+         * @brief Two-dimensional primitive data
+         * @param generator     Primitive generator function, e.g.
+         *      @ref Circle::solid()
+         * @param args          Generator parameters
+         *
+         * Calls @p generator with @p args if the data are not already in the
+         * cache.
+         */
+        template<class ...Args> const Trade::MeshData2D& data(Trade::MeshData2D(*generator)(Args...), typename std::common_type<Args>::type... args) {
+            std::string key = this->key(generator, args...);
+            if(const Trade::MeshData2D* const found = find2D(key)) return *found;
+            return insert(std::move(key), generator(args...));
+        }
+
+        /**
+         * @brief Three-dimensional primitive data
+         * @param generator     Primitive generator function, e.g.
+         *      @ref Icosphere::solid()
+         * @param args          Generator parameters
+         *
+         * Calls @p generator with @p args if the data are not already in the
+         * cache.
+         */
+        template<class ...Args> const Trade::MeshData3D& data(Trade::MeshData3D(*generator)(Args...), typename std::common_type<Args>::type... args) {
+            std::string key = this->key(generator, args...);
+            if(const Trade::MeshData3D* const found = find3D(key)) return *found;
+            return insert(std::move(key), generator(args...));
+        }
+
+        /**
+         * @brief Compiled two-dimensional primitive
+         *
+         * Compiles the data returned by @ref data(Trade::MeshData2D(*)(Args...), typename std::common_type<Args>::type...)
+         * if the mesh is not already in the cache.
+         */
+        template<class ...Args> Mesh& mesh(Trade::MeshData2D(*generator)(Args...), typename std::common_type<Args>::type... args) {
+            const std::string key = this->key(generator, args...);
+            if(Mesh* const found = findMesh(key)) return *found;
+            return compile(key, data(generator, args...));
+        }
+
+        /**
+         * @brief Compiled three-dimensional primitive
+         *
+         * Compiles the data returned by @ref data(Trade::MeshData3D(*)(Args...), typename std::common_type<Args>::type...)
+         * if the mesh is not already in the cache.
+         */
+        template<class ...Args> Mesh& mesh(Trade::MeshData3D(*generator)(Args...), typename std::common_type<Args>::type... args) {
+            const std::string key = this->key(generator, args...);
+            if(Mesh* const found = findMesh(key)) return *found;
+            return compile(key, data(generator, args...));
+        }
+
+        /**
+         * @brief Clear the cache
+         *
+         * Frees all cached data, meshes and buffers.
+         */
+        void clear();
+
+    private:
+        struct State;
+
+        template<class T, class ...Args> static std::string key(T generator, const Args&... args) {
+            std::string key;
+            Implementation::appendKeys(key, generator, args...);
+            return key;
+        }
+
+        const Trade::MeshData2D* find2D(const std::string& key) const;
+        const Trade::MeshData3D* find3D(const std::string& key) const;
+        Mesh* findMesh(const std::string& key);
+        const Trade::MeshData2D& insert(std::string&& key, Trade::MeshData2D&& data);
+        const Trade::MeshData3D& insert(std::string&& key, Trade::MeshData3D&& data);
+        Mesh& compile(const std::string& key, const Trade::MeshData2D& data);
+        Mesh& compile(const std::string& key, const Trade::MeshData3D& data);
+
+        std::unique_ptr<State> _state;
+};
+
+}}
+
+#endif
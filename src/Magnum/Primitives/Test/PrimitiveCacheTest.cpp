@@ -0,0 +1,106 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Primitives/Circle.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Primitives/PrimitiveCache.h"
+#include "Magnum/Primitives/UVSphere.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Primitives { namespace Test {
+
+struct PrimitiveCacheTest: TestSuite::Tester {
+    explicit PrimitiveCacheTest();
+
+    void data();
+    void dataDifferentParameters();
+    void clear();
+};
+
+PrimitiveCacheTest::PrimitiveCacheTest() {
+    addTests({&PrimitiveCacheTest::data,
+              &PrimitiveCacheTest::dataDifferentParameters,
+              &PrimitiveCacheTest::clear});
+}
+
+void PrimitiveCacheTest::data() {
+    PrimitiveCache cache;
+    CORRADE_COMPARE(cache.dataCount(), 0);
+
+    const Trade::MeshData3D& a = cache.data(Icosphere::solid, 2);
+    CORRADE_COMPARE(a.indices().size(), 960);
+    CORRADE_COMPARE(cache.dataCount(), 1);
+
+    /* Second call with the same parameters returns the same instance */
+    const Trade::MeshData3D& b = cache.data(Icosphere::solid, 2);
+    CORRADE_VERIFY(&a == &b);
+    CORRADE_COMPARE(cache.dataCount(), 1);
+
+    /* 2D primitives are cached separately */
+    const Trade::MeshData2D& c = cache.data(Circle::wireframe, 8);
+    CORRADE_COMPARE(c.positions(0).size(), 8);
+    CORRADE_VERIFY(&c == &cache.data(Circle::wireframe, 8));
+    CORRADE_COMPARE(cache.dataCount(), 2);
+    CORRADE_COMPARE(cache.meshCount(), 0);
+}
+
+void PrimitiveCacheTest::dataDifferentParameters() {
+    PrimitiveCache cache;
+
+    const Trade::MeshData3D& a = cache.data(UVSphere::solid, 3, 4, UVSphere::TextureCoords::DontGenerate);
+    const Trade::MeshData3D& b = cache.data(UVSphere::solid, 3, 4, UVSphere::TextureCoords::Generate);
+    const Trade::MeshData3D& c = cache.data(UVSphere::solid, 4, 3, UVSphere::TextureCoords::DontGenerate);
+    const Trade::MeshData3D& d = cache.data(UVSphere::wireframe, 4, 4);
+    CORRADE_COMPARE(cache.dataCount(), 4);
+    CORRADE_VERIFY(&a != &b);
+    CORRADE_VERIFY(&a != &c);
+    CORRADE_VERIFY(&a != &d);
+    CORRADE_VERIFY(!a.hasTextureCoords2D());
+    CORRADE_VERIFY(b.hasTextureCoords2D());
+
+    CORRADE_VERIFY(&b == &cache.data(UVSphere::solid, 3, 4, UVSphere::TextureCoords::Generate));
+    CORRADE_COMPARE(cache.dataCount(), 4);
+}
+
+void PrimitiveCacheTest::clear() {
+    PrimitiveCache cache;
+    cache.data(Icosphere::solid, 1);
+    cache.data(Circle::solid, 5);
+    CORRADE_COMPARE(cache.dataCount(), 2);
+
+    cache.clear();
+    CORRADE_COMPARE(cache.dataCount(), 0);
+
+    CORRADE_COMPARE(cache.data(Icosphere::solid, 1).positions(0).size(), 42);
+    CORRADE_COMPARE(cache.dataCount(), 1);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Primitives::Test::PrimitiveCacheTest)
@@ -0,0 +1,259 @@
+#ifndef Magnum_QueryPool_h
+#define Magnum_QueryPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::QueryPool
+ */
+
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include "Magnum/AbstractQuery.h"
+
+namespace Magnum {
+
+/**
+@brief Pool of recycled queries with non-blocking result delivery
+
+@ref AbstractQuery::result() blocks until the GPU has processed the query,
+stalling the pipeline if called right after the query ended. This class
+instead keeps a pool of query objects of given type and target, records the
+frame in which each query was acquired and delivers results through a
+callback only once they're available. Finished queries are then recycled, so
+no queries are created or deleted in the steady state. Example usage for
+measuring GPU time of a rendering pass:
+@code
+QueryPool<TimeQuery> pool{TimeQuery::Target::TimeElapsed};
+
+// each frame
+TimeQuery& q = pool.acquire([](UnsignedLong frame, UnsignedLong nanoseconds) {
+    Debug() << "Shadow pass in frame" << frame << "took" << nanoseconds << "ns";
+});
+q.begin();
+// rendering...
+q.end();
+
+pool.nextFrame();
+@endcode
+
+Results are delivered in the order in which the queries were acquired, and
+only for queries from frames preceding the current one. Polling stops at the
+first query without an available result, so in the usual case the pool does
+a single @fn_gl{GetQueryObject} call per frame on top of reading the
+available results. If the GPU falls behind by more than the max latency
+frames, the oldest results are waited for, which bounds the pool size.
+
+@see @ref DebugTools::Profiler::enableGpuTiming()
+*/
+template<class T> class QueryPool {
+    public:
+        /**
+         * @brief Result type
+         *
+         * @ref Magnum::UnsignedLong "UnsignedLong" is not available in
+         * @ref MAGNUM_TARGET_WEBGL "WebGL", where @ref Magnum::UnsignedInt "UnsignedInt"
+         * is used instead.
+         */
+        #ifndef MAGNUM_TARGET_WEBGL
+        typedef UnsignedLong ResultType;
+        #else
+        typedef UnsignedInt ResultType;
+        #endif
+
+        /**
+         * @brief Result callback
+         *
+         * Called with the frame in which the query was acquired and its
+         * result.
+         */
+        typedef std::function<void(UnsignedLong, ResultType)> Callback;
+
+        /**
+         * @brief Constructor
+         * @param target        Target of all queries in the pool
+         * @param maxLatency    Count of frames after which a pending result
+         *      is waited for. `0` means the results are never waited for.
+         *
+         * No queries are created until @ref acquire() is called.
+         */
+        explicit QueryPool(typename T::Target target, UnsignedInt maxLatency = 0): _target{target}, _maxLatency{maxLatency}, _frame{0} {}
+
+        /** @brief Copying is not allowed */
+        QueryPool(const QueryPool<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        QueryPool(QueryPool<T>&&) = delete;
+
+        /** @brief Copying is not allowed */
+        QueryPool<T>& operator=(const QueryPool<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        QueryPool<T>& operator=(QueryPool<T>&&) = delete;
+
+        /** @brief Query target */
+        typename T::Target target() const { return _target; }
+
+        /** @brief Max latency */
+        UnsignedInt maxLatency() const { return _maxLatency; }
+
+        /**
+         * @brief Current frame
+         *
+         * Incremented with each @ref nextFrame() call, starting at `0`.
+         */
+        UnsignedLong frame() const { return _frame; }
+
+        /** @brief Count of all query objects in the pool */
+        std::size_t size() const { return _queries.size(); }
+
+        /** @brief Count of queries with result not yet delivered */
+        std::size_t pendingCount() const { return _pending.size(); }
+
+        /**
+         * @brief Acquire a query
+         * @param callback  Function called with the result once it's
+         *      available
+         *
+         * Returns a free query from the pool or creates a new one if there's
+         * none. The reference is valid until the result is delivered. Begin
+         * and end the query (or call @ref TimeQuery::timestamp()) before
+         * calling @ref nextFrame().
+         */
+        T& acquire(Callback callback);
+
+        /**
+         * @brief Advance to next frame
+         *
+         * Increments @ref frame() and calls @ref poll().
+         */
+        std::size_t nextFrame() {
+            ++_frame;
+            return poll();
+        }
+
+        /**
+         * @brief Deliver available results
+         * @return Count of delivered results
+         *
+         * Goes through pending queries from frames before @ref frame() in
+         * order they were acquired and calls the callback for each with
+         * result available, stopping at first that's not available yet.
+         * Results older than @ref maxLatency() frames are waited for.
+         * @see @ref AbstractQuery::resultAvailable()
+         */
+        std::size_t poll();
+
+        /**
+         * @brief Wait for and deliver all pending results
+         * @return Count of delivered results
+         *
+         * Blocks until all queries, including those from current frame, are
+         * processed by the GPU.
+         */
+        std::size_t finish();
+
+        /**
+         * @brief Discard all pending results
+         *
+         * The queries are returned to the pool without reading their results
+         * and without calling the callbacks.
+         */
+        void discardPending();
+
+    private:
+        struct Pending {
+            std::size_t query;
+            UnsignedLong frame;
+            Callback callback;
+        };
+
+        void deliver();
+
+        typename T::Target _target;
+        UnsignedInt _maxLatency;
+        UnsignedLong _frame;
+
+        /* Deque, so references returned from acquire() stay valid when the
+           pool grows */
+        std::deque<T> _queries;
+        std::vector<std::size_t> _free;
+        std::deque<Pending> _pending;
+};
+
+template<class T> T& QueryPool<T>::acquire(Callback callback) {
+    std::size_t query;
+    if(!_free.empty()) {
+        query = _free.back();
+        _free.pop_back();
+    } else {
+        query = _queries.size();
+        _queries.emplace_back(_target);
+    }
+
+    _pending.push_back({query, _frame, std::move(callback)});
+    return _queries[query];
+}
+
+template<class T> std::size_t QueryPool<T>::poll() {
+    std::size_t count = 0;
+    while(!_pending.empty() && _pending.front().frame < _frame) {
+        const Pending& pending = _pending.front();
+        if((!_maxLatency || _frame - pending.frame < _maxLatency) && !_queries[pending.query].resultAvailable())
+            break;
+
+        deliver();
+        ++count;
+    }
+
+    return count;
+}
+
+template<class T> std::size_t QueryPool<T>::finish() {
+    const std::size_t count = _pending.size();
+    while(!_pending.empty()) deliver();
+    return count;
+}
+
+template<class T> void QueryPool<T>::discardPending() {
+    for(const Pending& pending: _pending) _free.push_back(pending.query);
+    _pending.clear();
+}
+
+template<class T> void QueryPool<T>::deliver() {
+    /* Pop the query before calling the callback so it can acquire new
+       queries */
+    Pending pending = std::move(_pending.front());
+    _pending.pop_front();
+    const ResultType result = _queries[pending.query].template result<ResultType>();
+    _free.push_back(pending.query);
+    if(pending.callback) pending.callback(pending.frame, result);
+}
+
+}
+
+#endif
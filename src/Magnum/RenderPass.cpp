@@ -0,0 +1,90 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RenderPass.h"
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/DefaultFramebuffer.h"
+#include "Magnum/Framebuffer.h"
+
+#include "Implementation/FramebufferState.h"
+#include "Implementation/State.h"
+
+namespace Magnum {
+
+RenderPass::RenderPass(DefaultFramebuffer& framebuffer): _framebuffer(framebuffer), _resolve{}, _colorAttachmentCount{1}, _defaultFramebuffer{true}, _colorLoad{RenderPassLoad::Load}, _depthLoad{RenderPassLoad::Load}, _stencilLoad{RenderPassLoad::Load}, _colorStore{RenderPassStore::Store}, _depthStore{RenderPassStore::Store}, _stencilStore{RenderPassStore::Store} {}
+
+RenderPass::RenderPass(Framebuffer& framebuffer, const UnsignedInt colorAttachmentCount): _framebuffer(framebuffer), _resolve{}, _colorAttachmentCount{colorAttachmentCount}, _defaultFramebuffer{false}, _colorLoad{RenderPassLoad::Load}, _depthLoad{RenderPassLoad::Load}, _stencilLoad{RenderPassLoad::Load}, _colorStore{RenderPassStore::Store}, _depthStore{RenderPassStore::Store}, _stencilStore{RenderPassStore::Store} {}
+
+void RenderPass::begin() {
+    _framebuffer.bind(FramebufferTarget::Draw);
+
+    /* Invalidate what won't be loaded, so the tiler doesn't need to fetch it
+       from memory */
+    invalidate(_colorLoad == RenderPassLoad::DontCare,
+               _depthLoad == RenderPassLoad::DontCare,
+               _stencilLoad == RenderPassLoad::DontCare);
+
+    /* Clear everything in a single call */
+    FramebufferClearMask mask;
+    if(_colorLoad == RenderPassLoad::Clear) mask |= FramebufferClear::Color;
+    if(_depthLoad == RenderPassLoad::Clear) mask |= FramebufferClear::Depth;
+    if(_stencilLoad == RenderPassLoad::Clear) mask |= FramebufferClear::Stencil;
+    if(mask) _framebuffer.clear(mask);
+}
+
+void RenderPass::end() {
+    if(_resolve)
+        AbstractFramebuffer::blit(_framebuffer, *_resolve, _framebuffer.viewport(), _resolve->viewport(), _resolveMask, FramebufferBlitFilter::Nearest);
+
+    invalidate(_colorStore == RenderPassStore::DontCare,
+               _depthStore == RenderPassStore::DontCare,
+               _stencilStore == RenderPassStore::DontCare);
+}
+
+void RenderPass::invalidate(const bool color, const bool depth, const bool stencil) {
+    const std::size_t count = (color ? _colorAttachmentCount : 0) + (depth ? 1 : 0) + (stencil ? 1 : 0);
+    if(!count) return;
+
+    /** @todo C++14: use VLA to avoid heap allocation */
+    Containers::Array<GLenum> attachments(count);
+    std::size_t i = 0;
+    if(_defaultFramebuffer) {
+        if(color) attachments[i++] = GLenum(DefaultFramebuffer::InvalidationAttachment::Color);
+        if(depth) attachments[i++] = GLenum(DefaultFramebuffer::InvalidationAttachment::Depth);
+        if(stencil) attachments[i++] = GLenum(DefaultFramebuffer::InvalidationAttachment::Stencil);
+    } else {
+        if(color) for(UnsignedInt j = 0; j != _colorAttachmentCount; ++j)
+            attachments[i++] = GLenum(Framebuffer::InvalidationAttachment(Framebuffer::ColorAttachment(j)));
+        if(depth) attachments[i++] = GLenum(Framebuffer::InvalidationAttachment::Depth);
+        if(stencil) attachments[i++] = GLenum(Framebuffer::InvalidationAttachment::Stencil);
+    }
+
+    (_framebuffer.*Context::current()->state().framebuffer->invalidateImplementation)(count, attachments);
+}
+
+}
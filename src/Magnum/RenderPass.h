@@ -0,0 +1,209 @@
+#ifndef Magnum_RenderPass_h
+#define Magnum_RenderPass_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::RenderPass, enum @ref Magnum::RenderPassLoad, @ref Magnum::RenderPassStore
+ */
+
+#include "Magnum/AbstractFramebuffer.h"
+
+namespace Magnum {
+
+class DefaultFramebuffer;
+
+/**
+@brief Render pass load operation
+
+@see @ref RenderPass
+*/
+enum class RenderPassLoad: UnsignedByte {
+    Load,       /**< Previous contents are preserved */
+    Clear,      /**< Contents are cleared */
+    DontCare    /**< Previous contents are invalidated */
+};
+
+/**
+@brief Render pass store operation
+
+@see @ref RenderPass
+*/
+enum class RenderPassStore: UnsignedByte {
+    Store,      /**< Contents are preserved for later use */
+    DontCare    /**< Contents are invalidated at the end of the pass */
+};
+
+/**
+@brief Render pass
+
+Groups rendering into given framebuffer into a pass with specified load and
+store operations for color, depth and stencil buffers. On tiled GPUs an
+attachment which is neither loaded at the beginning nor stored at the end
+of the pass never leaves the on-chip memory, which saves significant memory
+bandwidth. The pass translates the operations to framebuffer clearing and
+invalidation:
+@code
+RenderPass pass{multisampled};
+pass.setColor(RenderPassLoad::Clear, RenderPassStore::DontCare)
+    .setDepth(RenderPassLoad::Clear, RenderPassStore::DontCare)
+    .setResolve(defaultFramebuffer);
+
+pass.begin();
+// draw the scene...
+pass.end();
+@endcode
+
+@ref begin() binds the framebuffer for drawing, invalidates buffers with
+@ref RenderPassLoad::DontCare and clears buffers with
+@ref RenderPassLoad::Clear using a single @ref AbstractFramebuffer::clear()
+call. Clear values are taken from @ref Renderer::setClearColor(),
+@ref Renderer::setClearDepth() and @ref Renderer::setClearStencil().
+@ref end() optionally resolves the framebuffer into another one using
+@ref AbstractFramebuffer::blit(), which is the way to resolve multisampled
+framebuffers, and then invalidates buffers with
+@ref RenderPassStore::DontCare.
+
+The color operations apply to all color attachments, as the
+@ref AbstractFramebuffer::clear() affects all draw buffers.
+
+If neither @extension{ARB,invalidate_subdata} (part of OpenGL 4.3),
+extension @es_extension{EXT,discard_framebuffer} in OpenGL ES 2.0 nor OpenGL
+ES 3.0 is available, the invalidation does nothing. Default load and store
+operations are @ref RenderPassLoad::Load and @ref RenderPassStore::Store
+for all buffers.
+*/
+class MAGNUM_EXPORT RenderPass {
+    public:
+        /**
+         * @brief Construct render pass for default framebuffer
+         *
+         * The framebuffer is expected to be alive for whole lifetime of the
+         * pass.
+         */
+        explicit RenderPass(DefaultFramebuffer& framebuffer);
+
+        /**
+         * @brief Construct render pass for framebuffer
+         * @param framebuffer           Framebuffer
+         * @param colorAttachmentCount  Count of color attachments, starting
+         *      from @ref Framebuffer::ColorAttachment "Framebuffer::ColorAttachment(0)"
+         *
+         * The framebuffer is expected to be alive for whole lifetime of the
+         * pass.
+         */
+        explicit RenderPass(Framebuffer& framebuffer, UnsignedInt colorAttachmentCount = 1);
+
+        /** @brief Framebuffer */
+        AbstractFramebuffer& framebuffer() { return _framebuffer; }
+
+        /**
+         * @brief Set color load and store operation
+         * @return Reference to self (for method chaining)
+         */
+        RenderPass& setColor(RenderPassLoad load, RenderPassStore store) {
+            _colorLoad = load;
+            _colorStore = store;
+            return *this;
+        }
+
+        /**
+         * @brief Set depth load and store operation
+         * @return Reference to self (for method chaining)
+         */
+        RenderPass& setDepth(RenderPassLoad load, RenderPassStore store) {
+            _depthLoad = load;
+            _depthStore = store;
+            return *this;
+        }
+
+        /**
+         * @brief Set stencil load and store operation
+         * @return Reference to self (for method chaining)
+         */
+        RenderPass& setStencil(RenderPassLoad load, RenderPassStore store) {
+            _stencilLoad = load;
+            _stencilStore = store;
+            return *this;
+        }
+
+        /**
+         * @brief Set resolve framebuffer
+         * @param destination   Destination framebuffer
+         * @param mask          Which buffers to resolve
+         * @return Reference to self (for method chaining)
+         *
+         * The @p destination is expected to be alive for whole lifetime of
+         * the pass. The resolve is done at the end of the pass, before
+         * invalidating the buffers. Source and destination rectangle is
+         * viewport of given framebuffer.
+         * @requires_gl30 Extension @extension{ARB,framebuffer_object}
+         * @requires_gles30 Extension @es_extension{ANGLE,framebuffer_blit} or
+         *      @es_extension{NV,framebuffer_blit} in OpenGL ES 2.0
+         */
+        RenderPass& setResolve(AbstractFramebuffer& destination, FramebufferBlitMask mask = FramebufferBlit::Color) {
+            _resolve = &destination;
+            _resolveMask = mask;
+            return *this;
+        }
+
+        /**
+         * @brief Begin the pass
+         *
+         * Binds the framebuffer for drawing, invalidates and clears its
+         * buffers based on the load operations.
+         * @see @ref AbstractFramebuffer::bind(),
+         *      @ref AbstractFramebuffer::clear(), @fn_gl{InvalidateFramebuffer}
+         *      or @fn_gles_extension{DiscardFramebuffer,EXT,discard_framebuffer}
+         *      on OpenGL ES 2.0
+         */
+        void begin();
+
+        /**
+         * @brief End the pass
+         *
+         * Resolves the framebuffer, if set via @ref setResolve(), and
+         * invalidates its buffers based on the store operations.
+         * @see @ref AbstractFramebuffer::blit(), @fn_gl{InvalidateFramebuffer}
+         *      or @fn_gles_extension{DiscardFramebuffer,EXT,discard_framebuffer}
+         *      on OpenGL ES 2.0
+         */
+        void end();
+
+    private:
+        void MAGNUM_LOCAL invalidate(bool color, bool depth, bool stencil);
+
+        AbstractFramebuffer& _framebuffer;
+        AbstractFramebuffer* _resolve;
+        FramebufferBlitMask _resolveMask;
+        UnsignedInt _colorAttachmentCount;
+        bool _defaultFramebuffer;
+        RenderPassLoad _colorLoad, _depthLoad, _stencilLoad;
+        RenderPassStore _colorStore, _depthStore, _stencilStore;
+};
+
+}
+
+#endif
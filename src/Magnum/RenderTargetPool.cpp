@@ -0,0 +1,206 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RenderTargetPool.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/Texture.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum {
+
+namespace {
+    struct TextureKey {
+        Vector2i size;
+        TextureFormat format;
+
+        bool operator==(const TextureKey& other) const {
+            return size == other.size && format == other.format;
+        }
+    };
+
+    struct RenderbufferKey {
+        Vector2i size;
+        RenderbufferFormat format;
+        Int samples;
+
+        bool operator==(const RenderbufferKey& other) const {
+            return size == other.size && format == other.format && samples == other.samples;
+        }
+    };
+
+    /* The object is allocated separately so references to it stay valid when
+       the vector is reallocated */
+    template<class T, class Key> struct Target {
+        Key key;
+        std::unique_ptr<T> object;
+        UnsignedLong lastUsedFrame;
+        bool used;
+    };
+
+    template<class T, class Key> T* acquire(std::vector<Target<T, Key>>& targets, const Key& key, const UnsignedLong frame) {
+        for(Target<T, Key>& target: targets) {
+            if(target.used || !(target.key == key)) continue;
+            target.used = true;
+            target.lastUsedFrame = frame;
+            return target.object.get();
+        }
+
+        return nullptr;
+    }
+
+    template<class T, class Key> T& add(std::vector<Target<T, Key>>& targets, const Key& key, std::unique_ptr<T> object, const UnsignedLong frame) {
+        targets.push_back({key, std::move(object), frame, true});
+        return *targets.back().object;
+    }
+
+    template<class T, class Key> bool release(std::vector<Target<T, Key>>& targets, T& object) {
+        for(Target<T, Key>& target: targets) {
+            if(target.object.get() != &object) continue;
+            if(!target.used) return false;
+            target.used = false;
+            return true;
+        }
+
+        return false;
+    }
+
+    template<class T, class Key> void nextFrame(std::vector<Target<T, Key>>& targets, const UnsignedLong frame, const UnsignedInt maxUnusedFrames) {
+        for(Target<T, Key>& target: targets) target.used = false;
+        targets.erase(std::remove_if(targets.begin(), targets.end(), [frame, maxUnusedFrames](const Target<T, Key>& target) {
+            return frame - target.lastUsedFrame > maxUnusedFrames;
+        }), targets.end());
+    }
+}
+
+struct RenderTargetPool::Targets {
+    explicit Targets(UnsignedInt maxUnusedFrames): maxUnusedFrames{maxUnusedFrames}, frame{0} {}
+
+    UnsignedInt maxUnusedFrames;
+    UnsignedLong frame;
+    std::vector<Target<Texture2D, TextureKey>> textures;
+    std::vector<Target<Renderbuffer, RenderbufferKey>> renderbuffers;
+    std::vector<Target<Framebuffer, Vector2i>> framebuffers;
+};
+
+RenderTargetPool::RenderTargetPool(const UnsignedInt maxUnusedFrames): _targets{new Targets{maxUnusedFrames}} {}
+
+RenderTargetPool::RenderTargetPool(RenderTargetPool&&) noexcept = default;
+
+RenderTargetPool::~RenderTargetPool() = default;
+
+RenderTargetPool& RenderTargetPool::operator=(RenderTargetPool&&) noexcept = default;
+
+std::size_t RenderTargetPool::textureCount() const {
+    return _targets->textures.size();
+}
+
+std::size_t RenderTargetPool::renderbufferCount() const {
+    return _targets->renderbuffers.size();
+}
+
+std::size_t RenderTargetPool::framebufferCount() const {
+    return _targets->framebuffers.size();
+}
+
+std::size_t RenderTargetPool::memoryUsage() const {
+    std::size_t memoryUsage = 0;
+    for(const auto& target: _targets->textures)
+        memoryUsage += target.object->memoryUsage();
+    for(const auto& target: _targets->renderbuffers)
+        memoryUsage += target.object->memoryUsage();
+    return memoryUsage;
+}
+
+Texture2D& RenderTargetPool::texture(const Vector2i& size, const TextureFormat format) {
+    const TextureKey key{size, format};
+    if(Texture2D* const texture = acquire(_targets->textures, key, _targets->frame))
+        return *texture;
+
+    std::unique_ptr<Texture2D> texture{new Texture2D};
+    texture->setMinificationFilter(Sampler::Filter::Linear)
+        .setMagnificationFilter(Sampler::Filter::Linear)
+        .setWrapping(Sampler::Wrapping::ClampToEdge)
+        .setStorage(1, format, size);
+    return add(_targets->textures, key, std::move(texture), _targets->frame);
+}
+
+Renderbuffer& RenderTargetPool::renderbuffer(const Vector2i& size, const RenderbufferFormat format, const Int samples) {
+    const RenderbufferKey key{size, format, samples};
+    if(Renderbuffer* const renderbuffer = acquire(_targets->renderbuffers, key, _targets->frame))
+        return *renderbuffer;
+
+    std::unique_ptr<Renderbuffer> renderbuffer{new Renderbuffer};
+    if(samples) renderbuffer->setStorageMultisample(samples, format, size);
+    else renderbuffer->setStorage(format, size);
+    return add(_targets->renderbuffers, key, std::move(renderbuffer), _targets->frame);
+}
+
+Framebuffer& RenderTargetPool::framebuffer(const Vector2i& size) {
+    if(Framebuffer* const framebuffer = acquire(_targets->framebuffers, size, _targets->frame))
+        return *framebuffer;
+
+    return add(_targets->framebuffers, size, std::unique_ptr<Framebuffer>{new Framebuffer{{{}, size}}}, _targets->frame);
+}
+
+void RenderTargetPool::release(Texture2D& texture) {
+    const bool released = Magnum::release(_targets->textures, texture);
+    CORRADE_ASSERT(released,
+        "RenderTargetPool::release(): texture not acquired from this pool or already released", );
+    static_cast<void>(released);
+}
+
+void RenderTargetPool::release(Renderbuffer& renderbuffer) {
+    const bool released = Magnum::release(_targets->renderbuffers, renderbuffer);
+    CORRADE_ASSERT(released,
+        "RenderTargetPool::release(): renderbuffer not acquired from this pool or already released", );
+    static_cast<void>(released);
+}
+
+void RenderTargetPool::release(Framebuffer& framebuffer) {
+    const bool released = Magnum::release(_targets->framebuffers, framebuffer);
+    CORRADE_ASSERT(released,
+        "RenderTargetPool::release(): framebuffer not acquired from this pool or already released", );
+    static_cast<void>(released);
+}
+
+void RenderTargetPool::nextFrame() {
+    Magnum::nextFrame(_targets->textures, _targets->frame, _targets->maxUnusedFrames);
+    Magnum::nextFrame(_targets->renderbuffers, _targets->frame, _targets->maxUnusedFrames);
+    Magnum::nextFrame(_targets->framebuffers, _targets->frame, _targets->maxUnusedFrames);
+    ++_targets->frame;
+}
+
+void RenderTargetPool::clear() {
+    _targets->textures.clear();
+    _targets->renderbuffers.clear();
+    _targets->framebuffers.clear();
+}
+
+}
@@ -0,0 +1,197 @@
+#ifndef Magnum_RenderTargetPool_h
+#define Magnum_RenderTargetPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::RenderTargetPool
+ */
+
+#include <memory>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+/**
+@brief Transient render target pool
+
+Hands out textures, renderbuffers and framebuffers for intermediate results
+of rendering passes, such as post-processing. Targets are keyed by size,
+format and sample count and recycled once they are released, so passes that
+don't overlap in time share the same memory and a resize doesn't need to
+recreate anything by hand:
+@code
+RenderTargetPool pool;
+
+// each frame
+Texture2D& color = pool.texture(size, TextureFormat::RGBA8);
+Renderbuffer& depth = pool.renderbuffer(size, RenderbufferFormat::DepthComponent24);
+Framebuffer& framebuffer = pool.framebuffer(size);
+framebuffer.attachTexture(Framebuffer::ColorAttachment(0), color, 0)
+    .attachRenderbuffer(Framebuffer::BufferAttachment::Depth, depth);
+// render the scene...
+pool.release(depth);
+pool.release(framebuffer);
+
+Texture2D& blurred = pool.texture(size, TextureFormat::RGBA8);
+// blur color into blurred, release color, ...
+
+pool.nextFrame();
+@endcode
+
+A target acquired from the pool is in use until it is passed to
+@ref release() or until the end of the frame, marked with @ref nextFrame().
+Releasing a target as soon as the pass that wrote it is done lets the
+following passes reuse it in the same frame. Targets which weren't used for
+more than given count of frames are deleted in @ref nextFrame(), which
+frees targets of the previous size after a viewport resize.
+
+Textures are created with single-level immutable storage, linear filtering
+and @ref Sampler::Wrapping::ClampToEdge. Framebuffers have viewport covering
+the whole size and keep attachments from their previous use, attach all
+buffers you need again after acquiring them.
+
+The pool owns all targets, references returned from it are valid until the
+target is deleted in @ref nextFrame(), @ref clear() is called or the pool
+is destroyed. Contents of a target are undefined after it is acquired.
+*/
+class MAGNUM_EXPORT RenderTargetPool {
+    public:
+        /**
+         * @brief Constructor
+         * @param maxUnusedFrames   Count of frames after which unused
+         *      targets are deleted
+         *
+         * Doesn't create any target.
+         */
+        explicit RenderTargetPool(UnsignedInt maxUnusedFrames = 2);
+
+        /** @brief Copying is not allowed */
+        RenderTargetPool(const RenderTargetPool&) = delete;
+
+        /** @brief Move constructor */
+        RenderTargetPool(RenderTargetPool&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all targets.
+         */
+        ~RenderTargetPool();
+
+        /** @brief Copying is not allowed */
+        RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+        /** @brief Move assignment */
+        RenderTargetPool& operator=(RenderTargetPool&&) noexcept;
+
+        /** @brief Count of textures in the pool, both used and free */
+        std::size_t textureCount() const;
+
+        /** @brief Count of renderbuffers in the pool, both used and free */
+        std::size_t renderbufferCount() const;
+
+        /** @brief Count of framebuffers in the pool, both used and free */
+        std::size_t framebufferCount() const;
+
+        /**
+         * @brief Estimated memory usage
+         *
+         * Sum of @ref AbstractTexture::memoryUsage() and
+         * @ref Renderbuffer::memoryUsage() of all targets in the pool.
+         */
+        std::size_t memoryUsage() const;
+
+        /**
+         * @brief Acquire texture
+         *
+         * If there's a free texture with given size and format, returns it,
+         * otherwise creates a new one.
+         * @see @ref release(Texture2D&)
+         */
+        Texture2D& texture(const Vector2i& size, TextureFormat format);
+
+        /**
+         * @brief Acquire renderbuffer
+         *
+         * If there's a free renderbuffer with given size, format and sample
+         * count, returns it, otherwise creates a new one. If @p samples is
+         * `0`, the storage is set with @ref Renderbuffer::setStorage(),
+         * otherwise with @ref Renderbuffer::setStorageMultisample().
+         * @see @ref release(Renderbuffer&)
+         */
+        Renderbuffer& renderbuffer(const Vector2i& size, RenderbufferFormat format, Int samples = 0);
+
+        /**
+         * @brief Acquire framebuffer
+         *
+         * If there's a free framebuffer with given size, returns it,
+         * otherwise creates a new one with viewport covering the whole size.
+         * @see @ref release(Framebuffer&)
+         */
+        Framebuffer& framebuffer(const Vector2i& size);
+
+        /**
+         * @brief Release texture
+         *
+         * The texture is expected to be acquired from this pool and not
+         * released yet. It can be handed out again right after this call.
+         */
+        void release(Texture2D& texture);
+
+        /** @overload */
+        void release(Renderbuffer& renderbuffer);
+
+        /** @overload */
+        void release(Framebuffer& framebuffer);
+
+        /**
+         * @brief End the frame
+         *
+         * Releases all targets that are still in use and deletes targets
+         * which weren't acquired in more than `maxUnusedFrames` frames
+         * passed to the constructor.
+         */
+        void nextFrame();
+
+        /**
+         * @brief Delete all targets
+         *
+         * All references previously returned from the pool are
+         * invalidated.
+         */
+        void clear();
+
+    private:
+        struct Targets;
+
+        std::unique_ptr<Targets> _targets;
+};
+
+}
+
+#endif
@@ -27,8 +27,12 @@
 
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
+#include "Magnum/Math/Vector3.h"
 
 #include "Implementation/DebugState.h"
+#include "Implementation/DeletionState.h"
+#include "Implementation/MemoryState.h"
+#include "Implementation/NamePoolState.h"
 #include "Implementation/FramebufferState.h"
 #include "Implementation/State.h"
 
@@ -64,18 +68,19 @@ Int Renderbuffer::maxSamples() {
     return value;
 }
 
-Renderbuffer::Renderbuffer() {
+Renderbuffer::Renderbuffer(): _memoryUsage{0}, _memoryLabel{0} {
     (this->*Context::current()->state().framebuffer->createRenderbufferImplementation)();
+    Context::current()->state().memory->create(Context::MemoryObjectType::Renderbuffer);
 }
 
 void Renderbuffer::createImplementationDefault() {
-    glGenRenderbuffers(1, &_id);
+    _id = Context::current()->state().namePool->renderbuffers.take();
     _created = false;
 }
 
 #ifndef MAGNUM_TARGET_GLES
 void Renderbuffer::createImplementationDSA() {
-    glCreateRenderbuffers(1, &_id);
+    _id = Context::current()->state().namePool->renderbuffers.take();
     _created = true;
 }
 #endif
@@ -88,7 +93,14 @@ Renderbuffer::~Renderbuffer() {
     GLuint& binding = Context::current()->state().framebuffer->renderbufferBinding;
     if(binding == _id) binding = 0;
 
-    glDeleteRenderbuffers(1, &_id);
+    Context::current()->state().memory->destroy(Context::MemoryObjectType::Renderbuffer, _memoryLabel, _memoryUsage);
+
+    /* Never bound, so it's just a reserved name which can be reused */
+    if(!_created && Context::current()->state().namePool->renderbuffers.recycle(_id))
+        return;
+
+    if(!Context::current()->state().deletion->deferRenderbuffer(_id))
+        glDeleteRenderbuffers(1, &_id);
 }
 
 inline void Renderbuffer::createIfNotAlready() {
@@ -110,15 +122,24 @@ std::string Renderbuffer::label() {
 Renderbuffer& Renderbuffer::setLabelInternal(const Containers::ArrayReference<const char> label) {
     createIfNotAlready();
     Context::current()->state().debug->labelImplementation(GL_RENDERBUFFER, _id, label);
+    _memoryLabel = Context::current()->state().memory->relabel(_memoryLabel, label, _memoryUsage);
     return *this;
 }
 
 void Renderbuffer::setStorage(const RenderbufferFormat internalFormat, const Vector2i& size) {
     (this->*Context::current()->state().framebuffer->renderbufferStorageImplementation)(internalFormat, size);
+    setMemoryUsage(internalFormat, size, 1);
 }
 
 void Renderbuffer::setStorageMultisample(const Int samples, const RenderbufferFormat internalFormat, const Vector2i& size) {
     (this->*Context::current()->state().framebuffer->renderbufferStorageMultisampleImplementation)(samples, internalFormat, size);
+    setMemoryUsage(internalFormat, size, samples ? samples : 1);
+}
+
+void Renderbuffer::setMemoryUsage(const RenderbufferFormat internalFormat, const Vector2i& size, const Int samples) {
+    const std::size_t memoryUsage = Implementation::imageMemoryUsage(GLenum(internalFormat), {size, 1})*samples;
+    Context::current()->state().memory->resize(Context::MemoryObjectType::Renderbuffer, _memoryLabel, _memoryUsage, memoryUsage);
+    _memoryUsage = memoryUsage;
 }
 
 void Renderbuffer::bind() {
@@ -184,6 +184,17 @@ class MAGNUM_EXPORT Renderbuffer: public AbstractObject {
          */
         void setStorageMultisample(Int samples, RenderbufferFormat internalFormat, const Vector2i& size);
 
+        /**
+         * @brief Estimated GPU memory usage
+         *
+         * Estimated from format, size and sample count passed to the last
+         * call to @ref setStorage() or @ref setStorageMultisample(), `0` if
+         * the renderbuffer has no storage yet. Accounted as
+         * @ref Context::MemoryObjectType::Renderbuffer in
+         * @ref Context::memoryUsage().
+         */
+        std::size_t memoryUsage() const { return _memoryUsage; }
+
     private:
         void MAGNUM_LOCAL createImplementationDefault();
         #ifndef MAGNUM_TARGET_GLES
@@ -193,6 +204,7 @@ class MAGNUM_EXPORT Renderbuffer: public AbstractObject {
         void MAGNUM_LOCAL createIfNotAlready();
 
         Renderbuffer& setLabelInternal(Containers::ArrayReference<const char> label);
+        void MAGNUM_LOCAL setMemoryUsage(RenderbufferFormat internalFormat, const Vector2i& size, Int samples);
 
         void MAGNUM_LOCAL storageImplementationDefault(RenderbufferFormat internalFormat, const Vector2i& size);
         #ifndef MAGNUM_TARGET_GLES
@@ -215,9 +227,11 @@ class MAGNUM_EXPORT Renderbuffer: public AbstractObject {
 
         GLuint _id;
         bool _created; /* see createIfNotAlready() for details */
+        std::size_t _memoryUsage;
+        UnsignedInt _memoryLabel;
 };
 
-inline Renderbuffer::Renderbuffer(Renderbuffer&& other) noexcept: _id{other._id}, _created{other._created} {
+inline Renderbuffer::Renderbuffer(Renderbuffer&& other) noexcept: _id{other._id}, _created{other._created}, _memoryUsage{other._memoryUsage}, _memoryLabel{other._memoryLabel} {
     other._id = 0;
 }
 
@@ -225,6 +239,8 @@ inline Renderbuffer& Renderbuffer::operator=(Renderbuffer&& other) noexcept {
     using std::swap;
     swap(_id, other._id);
     swap(_created, other._created);
+    swap(_memoryUsage, other._memoryUsage);
+    swap(_memoryLabel, other._memoryLabel);
     return *this;
 }
 
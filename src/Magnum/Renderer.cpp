@@ -25,6 +25,8 @@
 
 #include "Renderer.h"
 
+#include <algorithm>
+
 #include "Magnum/Math/Range.h"
 #include "Magnum/Color.h"
 #include "Magnum/Context.h"
@@ -35,16 +37,51 @@
 
 namespace Magnum {
 
+namespace {
+
+/* Fuzzy compare of Math types would elide small but intended changes */
+template<std::size_t size> bool equalsExactly(const Math::Vector<size, Float>& a, const Math::Vector<size, Float>& b) {
+    for(std::size_t i = 0; i != size; ++i)
+        if(a[i] != b[i]) return false;
+    return true;
+}
+
+/* Returns true if the call can be skipped, updates the counter */
+inline bool elide(Implementation::State& state, const bool same) {
+    if(same) ++state.elidedStateChangeCount;
+    return same;
+}
+
+/* Indices into RendererState::stencil affected by given facing */
+std::pair<std::size_t, std::size_t> stencilFaces(const Renderer::PolygonFacing facing) {
+    if(facing == Renderer::PolygonFacing::Front) return {0, 1};
+    if(facing == Renderer::PolygonFacing::Back) return {1, 2};
+    return {0, 2};
+}
+
+}
+
 void Renderer::enable(const Feature feature) {
-    glEnable(GLenum(feature));
+    setFeature(feature, true);
 }
 
 void Renderer::disable(const Feature feature) {
-    glDisable(GLenum(feature));
+    setFeature(feature, false);
 }
 
 void Renderer::setFeature(const Feature feature, const bool enabled) {
-    enabled ? enable(feature) : disable(feature);
+    Implementation::State& state = Context::current()->state();
+    std::vector<std::pair<GLenum, bool>>& features = state.renderer->features;
+
+    /* Update the tracked state, skip the call if already set */
+    auto found = std::find_if(features.begin(), features.end(), [feature](const std::pair<GLenum, bool>& f) { return f.first == GLenum(feature); });
+    if(found == features.end())
+        features.emplace_back(GLenum(feature), enabled);
+    else if(elide(state, found->second == enabled))
+        return;
+    else found->second = enabled;
+
+    enabled ? glEnable(GLenum(feature)) : glDisable(GLenum(feature));
 }
 
 void Renderer::setHint(const Hint target, const HintMode mode) {
@@ -70,11 +107,19 @@ void Renderer::setClearStencil(const Int stencil) {
 }
 
 void Renderer::setFrontFace(const FrontFace mode) {
-    glFrontFace(GLenum(mode));
+    Implementation::State& state = Context::current()->state();
+    GLenum& current = state.renderer->frontFace;
+    if(elide(state, current == GLenum(mode))) return;
+
+    glFrontFace(current = GLenum(mode));
 }
 
 void Renderer::setFaceCullingMode(const PolygonFacing mode) {
-    glCullFace(GLenum(mode));
+    Implementation::State& state = Context::current()->state();
+    GLenum& current = state.renderer->faceCullingMode;
+    if(elide(state, current == GLenum(mode))) return;
+
+    glCullFace(current = GLenum(mode));
 }
 
 #ifndef MAGNUM_TARGET_GLES
@@ -88,6 +133,11 @@ void Renderer::setPolygonMode(const PolygonMode mode) {
 #endif
 
 void Renderer::setPolygonOffset(const Float factor, const Float units) {
+    Implementation::State& state = Context::current()->state();
+    Vector2& current = state.renderer->polygonOffset;
+    if(elide(state, equalsExactly(current, Vector2{factor, units}))) return;
+
+    current = {factor, units};
     glPolygonOffset(factor, units);
 }
 
@@ -102,62 +152,149 @@ void Renderer::setPointSize(const Float size) {
 #endif
 
 void Renderer::setScissor(const Range2Di& rectangle) {
+    Implementation::State& state = Context::current()->state();
+    Range2Di& current = state.renderer->scissor;
+    if(elide(state, current == rectangle)) return;
+
+    current = rectangle;
     glScissor(rectangle.left(), rectangle.bottom(), rectangle.sizeX(), rectangle.sizeY());
 }
 
 void Renderer::setStencilFunction(const PolygonFacing facing, const StencilFunction function, const Int referenceValue, const UnsignedInt mask) {
+    Implementation::State& state = Context::current()->state();
+    const std::pair<std::size_t, std::size_t> faces = stencilFaces(facing);
+
+    bool same = true;
+    for(std::size_t i = faces.first; i != faces.second; ++i) {
+        Implementation::RendererState::Stencil& s = state.renderer->stencil[i];
+        if(s.function != GLenum(function) || s.referenceValue != referenceValue || s.mask != mask) {
+            same = false;
+            s.function = GLenum(function);
+            s.referenceValue = referenceValue;
+            s.mask = mask;
+        }
+    }
+    if(elide(state, same)) return;
+
     glStencilFuncSeparate(GLenum(facing), GLenum(function), referenceValue, mask);
 }
 
 void Renderer::setStencilFunction(const StencilFunction function, const Int referenceValue, const UnsignedInt mask) {
-    glStencilFunc(GLenum(function), referenceValue, mask);
+    setStencilFunction(PolygonFacing::FrontAndBack, function, referenceValue, mask);
 }
 
 void Renderer::setStencilOperation(const PolygonFacing facing, const StencilOperation stencilFail, const StencilOperation depthFail, const StencilOperation depthPass) {
+    Implementation::State& state = Context::current()->state();
+    const std::pair<std::size_t, std::size_t> faces = stencilFaces(facing);
+
+    bool same = true;
+    for(std::size_t i = faces.first; i != faces.second; ++i) {
+        Implementation::RendererState::Stencil& s = state.renderer->stencil[i];
+        if(s.stencilFail != GLenum(stencilFail) || s.depthFail != GLenum(depthFail) || s.depthPass != GLenum(depthPass)) {
+            same = false;
+            s.stencilFail = GLenum(stencilFail);
+            s.depthFail = GLenum(depthFail);
+            s.depthPass = GLenum(depthPass);
+        }
+    }
+    if(elide(state, same)) return;
+
     glStencilOpSeparate(GLenum(facing), GLenum(stencilFail), GLenum(depthFail), GLenum(depthPass));
 }
 
 void Renderer::setStencilOperation(const StencilOperation stencilFail, const StencilOperation depthFail, const StencilOperation depthPass) {
-    glStencilOp(GLenum(stencilFail), GLenum(depthFail), GLenum(depthPass));
+    setStencilOperation(PolygonFacing::FrontAndBack, stencilFail, depthFail, depthPass);
 }
 
 void Renderer::setDepthFunction(const DepthFunction function) {
-    glDepthFunc(GLenum(function));
+    Implementation::State& state = Context::current()->state();
+    GLenum& current = state.renderer->depthFunction;
+    if(elide(state, current == GLenum(function))) return;
+
+    glDepthFunc(current = GLenum(function));
 }
 
 void Renderer::setColorMask(const GLboolean allowRed, const GLboolean allowGreen, const GLboolean allowBlue, const GLboolean allowAlpha) {
+    Implementation::State& state = Context::current()->state();
+    GLboolean* const current = state.renderer->colorMask;
+    if(elide(state, current[0] == allowRed && current[1] == allowGreen && current[2] == allowBlue && current[3] == allowAlpha)) return;
+
+    current[0] = allowRed;
+    current[1] = allowGreen;
+    current[2] = allowBlue;
+    current[3] = allowAlpha;
     glColorMask(allowRed, allowGreen, allowBlue, allowAlpha);
 }
 
 void Renderer::setDepthMask(const GLboolean allow) {
-    glDepthMask(allow);
+    Implementation::State& state = Context::current()->state();
+    GLboolean& current = state.renderer->depthMask;
+    if(elide(state, current == allow)) return;
+
+    glDepthMask(current = allow);
 }
 
 void Renderer::setStencilMask(const PolygonFacing facing, const UnsignedInt allowBits) {
+    Implementation::State& state = Context::current()->state();
+    const std::pair<std::size_t, std::size_t> faces = stencilFaces(facing);
+
+    bool same = true;
+    for(std::size_t i = faces.first; i != faces.second; ++i) {
+        Implementation::RendererState::Stencil& s = state.renderer->stencil[i];
+        if(!s.writeMaskKnown || s.writeMask != allowBits) {
+            same = false;
+            s.writeMask = allowBits;
+            s.writeMaskKnown = true;
+        }
+    }
+    if(elide(state, same)) return;
+
     glStencilMaskSeparate(GLenum(facing), allowBits);
 }
 
 void Renderer::setStencilMask(const UnsignedInt allowBits) {
-    glStencilMask(allowBits);
+    setStencilMask(PolygonFacing::FrontAndBack, allowBits);
 }
 
 void Renderer::setBlendEquation(const BlendEquation equation) {
-    glBlendEquation(GLenum(equation));
+    setBlendEquation(equation, equation);
 }
 
 void Renderer::setBlendEquation(const BlendEquation rgb, const BlendEquation alpha) {
-    glBlendEquationSeparate(GLenum(rgb), GLenum(alpha));
+    Implementation::State& state = Context::current()->state();
+    Implementation::RendererState& r = *state.renderer;
+    if(elide(state, r.blendEquationRgb == GLenum(rgb) && r.blendEquationAlpha == GLenum(alpha))) return;
+
+    r.blendEquationRgb = GLenum(rgb);
+    r.blendEquationAlpha = GLenum(alpha);
+    if(rgb == alpha) glBlendEquation(GLenum(rgb));
+    else glBlendEquationSeparate(GLenum(rgb), GLenum(alpha));
 }
 
 void Renderer::setBlendFunction(const BlendFunction source, const BlendFunction destination) {
-    glBlendFunc(GLenum(source), GLenum(destination));
+    setBlendFunction(source, destination, source, destination);
 }
 
 void Renderer::setBlendFunction(const BlendFunction sourceRgb, const BlendFunction destinationRgb, const BlendFunction sourceAlpha, const BlendFunction destinationAlpha) {
-    glBlendFuncSeparate(GLenum(sourceRgb), GLenum(destinationRgb), GLenum(sourceAlpha), GLenum(destinationAlpha));
+    Implementation::State& state = Context::current()->state();
+    Implementation::RendererState& r = *state.renderer;
+    if(elide(state, r.blendSourceRgb == GLenum(sourceRgb) && r.blendDestinationRgb == GLenum(destinationRgb) && r.blendSourceAlpha == GLenum(sourceAlpha) && r.blendDestinationAlpha == GLenum(destinationAlpha))) return;
+
+    r.blendSourceRgb = GLenum(sourceRgb);
+    r.blendDestinationRgb = GLenum(destinationRgb);
+    r.blendSourceAlpha = GLenum(sourceAlpha);
+    r.blendDestinationAlpha = GLenum(destinationAlpha);
+    if(sourceRgb == sourceAlpha && destinationRgb == destinationAlpha)
+        glBlendFunc(GLenum(sourceRgb), GLenum(destinationRgb));
+    else glBlendFuncSeparate(GLenum(sourceRgb), GLenum(destinationRgb), GLenum(sourceAlpha), GLenum(destinationAlpha));
 }
 
 void Renderer::setBlendColor(const Color4& color) {
+    Implementation::State& state = Context::current()->state();
+    Color4& current = state.renderer->blendColor;
+    if(elide(state, equalsExactly(current, color))) return;
+
+    current = color;
     glBlendColor(color.r(), color.g(), color.b(), color.a());
 }
 
@@ -167,6 +304,16 @@ void Renderer::setLogicOperation(const LogicOperation operation) {
 }
 #endif
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+void Renderer::setMemoryBarrier(const MemoryBarriers barriers) {
+    glMemoryBarrier(GLbitfield(barriers));
+}
+
+void Renderer::setMemoryBarrierByRegion(const MemoryBarriers barriers) {
+    glMemoryBarrierByRegion(GLbitfield(barriers));
+}
+#endif
+
 Renderer::ResetNotificationStrategy Renderer::resetNotificationStrategy() {
     #ifndef MAGNUM_TARGET_GLES
     if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::robustness>())
@@ -42,6 +42,13 @@ namespace Implementation { struct RendererState; }
 /** @nosubgrouping
 @brief Global renderer configuration.
 
+The engine tracks the fixed-function state set through this class (features,
+blending, color/depth/stencil functions and masks, face culling, polygon
+offset and scissor rectangle) and skips OpenGL calls that wouldn't change
+anything. If you modify the state with raw OpenGL calls, call
+@ref Context::resetState() with @ref Context::State::Renderer afterwards. See
+also @ref Context::elidedStateChangeCount().
+
 @todo @extension{ARB,viewport_array}
 @todo `GL_POINT_SIZE_GRANULARITY`, `GL_POINT_SIZE_RANGE` (?)
 @todo `GL_STEREO`, `GL_DOUBLEBUFFER` (?)
@@ -193,6 +200,18 @@ class MAGNUM_EXPORT Renderer {
             PolygonOffsetPoint = GL_POLYGON_OFFSET_POINT,
             #endif
 
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * Primitive restart with fixed restart index, which is the maximal
+             * value of the index type used.
+             * @see @ref MeshTools::CompressIndicesFlag::PrimitiveRestart
+             * @requires_gl43 Extension @extension{ARB,ES3_compatibility}
+             * @requires_gl Always enabled in OpenGL ES 3.0, not available in
+             *      OpenGL ES 2.0.
+             */
+            PrimitiveRestartFixedIndex = GL_PRIMITIVE_RESTART_FIXED_INDEX,
+            #endif
+
             #ifndef MAGNUM_TARGET_GLES
             /**
              * Programmable point size. If enabled, the point size is taken
@@ -935,6 +954,129 @@ class MAGNUM_EXPORT Renderer {
         /*@}*/
         #endif
 
+        #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+        /** @{ @name Memory barriers */
+
+        /**
+         * @brief Memory barrier
+         *
+         * Specifies which kind of access issued after the barrier should see
+         * the data written by shaders via image stores, shader storage
+         * buffers or atomic counters before the barrier.
+         * @see @ref MemoryBarriers, @ref setMemoryBarrier(),
+         *      @ref setMemoryBarrierByRegion()
+         * @requires_gl42 Extension @extension{ARB,shader_image_load_store}
+         * @requires_gles31 Shader image load/store is not available in OpenGL
+         *      ES 3.0 and older.
+         */
+        enum class MemoryBarrier: GLbitfield {
+            /** Vertex data sourced from buffers */
+            VertexAttributeArray = GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT,
+
+            /** Vertex indices sourced from buffers */
+            ElementArray = GL_ELEMENT_ARRAY_BARRIER_BIT,
+
+            /** Uniforms sourced from buffers */
+            Uniform = GL_UNIFORM_BARRIER_BIT,
+
+            /** Texture fetches from shaders */
+            TextureFetch = GL_TEXTURE_FETCH_BARRIER_BIT,
+
+            /** Image load, store and atomic operations from shaders */
+            ShaderImageAccess = GL_SHADER_IMAGE_ACCESS_BARRIER_BIT,
+
+            /**
+             * Indirect draw and dispatch commands sourced from buffers, see
+             * @ref AbstractShaderProgram::dispatchComputeIndirect()
+             */
+            Command = GL_COMMAND_BARRIER_BIT,
+
+            /** Pixel pack and unpack operations with buffers */
+            PixelBuffer = GL_PIXEL_BUFFER_BARRIER_BIT,
+
+            /** Texture image updates and queries */
+            TextureUpdate = GL_TEXTURE_UPDATE_BARRIER_BIT,
+
+            /** Buffer data updates, copies, queries and mapping */
+            BufferUpdate = GL_BUFFER_UPDATE_BARRIER_BIT,
+
+            /** Framebuffer reads and writes */
+            Framebuffer = GL_FRAMEBUFFER_BARRIER_BIT,
+
+            /** Transform feedback writes to buffers */
+            TransformFeedback = GL_TRANSFORM_FEEDBACK_BARRIER_BIT,
+
+            /** Atomic counter operations on buffers */
+            AtomicCounter = GL_ATOMIC_COUNTER_BARRIER_BIT,
+
+            /**
+             * Shader storage buffer access from shaders
+             * @requires_gl43 Extension @extension{ARB,shader_storage_buffer_object}
+             */
+            ShaderStorage = GL_SHADER_STORAGE_BARRIER_BIT,
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * Access to persistently mapped buffers from client
+             * @requires_gl44 Extension @extension{ARB,buffer_storage}
+             * @requires_gl Persistent buffer mapping is not available in
+             *      OpenGL ES.
+             */
+            ClientMappedBuffer = GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT,
+
+            /**
+             * Query results written to buffers
+             * @requires_gl44 Extension @extension{ARB,query_buffer_object}
+             * @requires_gl Query buffers are not available in OpenGL ES.
+             */
+            QueryBuffer = GL_QUERY_BUFFER_BARRIER_BIT
+            #endif
+        };
+
+        /**
+         * @brief Memory barriers
+         *
+         * @see @ref setMemoryBarrier(), @ref setMemoryBarrierByRegion()
+         * @requires_gl42 Extension @extension{ARB,shader_image_load_store}
+         * @requires_gles31 Shader image load/store is not available in OpenGL
+         *      ES 3.0 and older.
+         */
+        typedef Containers::EnumSet<MemoryBarrier> MemoryBarriers;
+
+        /**
+         * @brief Set memory barrier
+         *
+         * Ensures that memory accesses of given kind issued after this call
+         * see the results of shader writes issued before this call, e.g.
+         * when a vertex buffer is filled by a compute shader dispatched with
+         * @ref AbstractShaderProgram::dispatchCompute().
+         * @see @ref setMemoryBarrierByRegion(), @fn_gl{MemoryBarrier}
+         * @requires_gl42 Extension @extension{ARB,shader_image_load_store}
+         * @requires_gles31 Shader image load/store is not available in OpenGL
+         *      ES 3.0 and older.
+         */
+        static void setMemoryBarrier(MemoryBarriers barriers);
+
+        /**
+         * @brief Set memory barrier by region
+         *
+         * Behaves like @ref setMemoryBarrier(), except that the barrier is
+         * limited to the framebuffer region being rasterized, which allows
+         * tiled implementations to avoid a full flush. Only
+         * @ref MemoryBarrier::AtomicCounter, @ref MemoryBarrier::Framebuffer,
+         * @ref MemoryBarrier::ShaderImageAccess,
+         * @ref MemoryBarrier::ShaderStorage, @ref MemoryBarrier::TextureFetch
+         * and @ref MemoryBarrier::Uniform are allowed.
+         * @see @fn_gl{MemoryBarrierByRegion}
+         * @requires_gl45 Extension @extension{ARB,ES3_1_compatibility}
+         * @requires_gles31 Shader image load/store is not available in OpenGL
+         *      ES 3.0 and older.
+         */
+        static void setMemoryBarrierByRegion(MemoryBarriers barriers);
+
+        /*@}*/
+        #endif
+
         /** @{ @name Renderer management */
 
         /**
@@ -1135,6 +1277,10 @@ class MAGNUM_EXPORT Renderer {
         static GraphicsResetStatus MAGNUM_LOCAL graphicsResetStatusImplementationRobustness();
 };
 
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+CORRADE_ENUMSET_OPERATORS(Renderer::MemoryBarriers)
+#endif
+
 /** @debugoperatorclassenum{Magnum::Renderer,Magnum::Renderer::Error} */
 Debug MAGNUM_EXPORT operator<<(Debug debug, Renderer::Error value);
 
@@ -29,6 +29,7 @@
  * @brief Class @ref Magnum::ResourceKey, @ref Magnum::Resource, enum @ref Magnum::ResourceState
  */
 
+#include <utility>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/MurmurHash2.h>
 
@@ -125,22 +126,22 @@ class Resource {
          * Creates empty resource. Resources are acquired from the manager by
          * calling @ref ResourceManager::get().
          */
-        explicit Resource(): manager(nullptr), lastCheck(0), _state(ResourceState::Final), data(nullptr) {}
+        explicit Resource(): manager(nullptr), _entry(0), lastCheck(0), _state(ResourceState::Final), data(nullptr) {}
 
         /** @brief Copy constructor */
-        Resource(const Resource<T, U>& other): manager(other.manager), _key(other._key), lastCheck(other.lastCheck), _state(other._state), data(other.data) {
-            if(manager) manager->incrementReferenceCount(_key);
+        Resource(const Resource<T, U>& other): manager(other.manager), _key(other._key), _entry(other._entry), lastCheck(other.lastCheck), _state(other._state), data(other.data) {
+            if(manager) manager->incrementReferenceCount(_entry);
         }
 
         /** @brief Move constructor */
-        Resource(Resource<T, U>&& other): manager(other.manager), _key(other._key), lastCheck(other.lastCheck), _state(other._state), data(other.data) {
+        Resource(Resource<T, U>&& other): manager(other.manager), _key(other._key), _entry(other._entry), lastCheck(other.lastCheck), _state(other._state), data(other.data) {
             /** @brief Make other's state well-defined */
             other.manager = nullptr;
         }
 
         /** @brief Destructor */
         ~Resource() {
-            if(manager) manager->decrementReferenceCount(_key);
+            if(manager) manager->decrementReferenceCount(_entry);
         }
 
         /** @brief Copy assignment */
@@ -223,38 +224,39 @@ class Resource {
         }
 
     private:
-        Resource(Implementation::ResourceManagerData<T>* manager, ResourceKey key): manager(manager), _key(key), lastCheck(0), _state(ResourceState::NotLoaded), data(nullptr) {
-            manager->incrementReferenceCount(key);
-        }
+        Resource(Implementation::ResourceManagerData<T>* manager, ResourceKey key): manager(manager), _key(key), _entry(manager->incrementReferenceCount(key)), lastCheck(0), _state(ResourceState::NotLoaded), data(nullptr) {}
 
         void acquire();
 
         Implementation::ResourceManagerData<T>* manager;
         ResourceKey _key;
+        std::size_t _entry; /* Stable index of the data in the manager */
         std::size_t lastCheck;
         ResourceState _state;
         T* data;
 };
 
 template<class T, class U> Resource<T, U>& Resource<T, U>::operator=(const Resource<T, U>& other) {
-    if(manager) manager->decrementReferenceCount(_key);
+    if(manager) manager->decrementReferenceCount(_entry);
 
     manager = other.manager;
     _key = other._key;
+    _entry = other._entry;
     lastCheck = other.lastCheck;
     _state = other._state;
     data = other.data;
 
-    if(manager) manager->incrementReferenceCount(_key);
+    if(manager) manager->incrementReferenceCount(_entry);
     return *this;
 }
 
 template<class T, class U> Resource<T, U>& Resource<T, U>::operator=(Resource<T, U>&& other) {
     /** @todo Just swap the values */
-    if(manager) manager->decrementReferenceCount(_key);
+    if(manager) manager->decrementReferenceCount(_entry);
 
     manager = other.manager;
     _key = other._key;
+    _entry = other._entry;
     lastCheck = other.lastCheck;
     _state = other._state;
     data = other.data;
@@ -270,13 +272,12 @@ template<class T, class U> void Resource<T, U>::acquire() {
     /* Nothing changed since last check */
     if(manager->lastChange() < lastCheck) return;
 
-    /* Acquire new data and save last check time */
-    const typename Implementation::ResourceManagerData<T>::Data& d = manager->data(_key);
+    /* Acquire new data and save last check time. Directly access the cached
+       entry, no need to look up the key. */
     lastCheck = manager->lastChange();
-
-    /* Try to get the data */
-    data = d.data;
-    _state = static_cast<ResourceState>(d.state);
+    const std::pair<T*, ResourceDataState> d = manager->load(_entry);
+    data = d.first;
+    _state = static_cast<ResourceState>(d.second);
 
     /* Data are not available */
     if(!data) {
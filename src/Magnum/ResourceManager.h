@@ -29,7 +29,12 @@
  * @brief Class @ref Magnum::ResourceManager, @ref Magnum::ResourceDataState, @ref Magnum::ResourcePolicy
  */
 
-#include <unordered_map>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "Magnum/Resource.h"
 
@@ -80,7 +85,9 @@ enum class ResourcePolicy: UnsignedByte {
 
     /**
      * The resource will be unloaded when manually calling
-     * @ref ResourceManager::free() if nothing references it.
+     * @ref ResourceManager::free() if nothing references it. It can be also
+     * evicted when the memory budget is exceeded, see
+     * @ref ResourceManager::setMemoryBudget().
      */
     Manual,
 
@@ -92,6 +99,18 @@ template<class> class AbstractResourceLoader;
 
 namespace Implementation {
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+typedef std::mutex ResourceMutex;
+typedef std::recursive_mutex ResourceLoaderMutex;
+#else
+/* No threads, no need to lock anything */
+struct ResourceMutex {
+    void lock() {}
+    void unlock() {}
+};
+typedef ResourceMutex ResourceLoaderMutex;
+#endif
+
 /** @todo Print either resource key or name string based on loader capabilities */
 
 template<class T> class ResourceManagerData {
@@ -107,9 +126,9 @@ template<class T> class ResourceManagerData {
         ResourceManagerData<T>& operator=(const ResourceManagerData<T>&) = delete;
         ResourceManagerData<T>& operator=(ResourceManagerData<T>&&) = delete;
 
-        std::size_t lastChange() const { return _lastChange; }
+        std::size_t lastChange() const { return _lastChange.load(std::memory_order_acquire); }
 
-        std::size_t count() const { return _data.size(); }
+        std::size_t count() const { return _count.load(std::memory_order_relaxed); }
 
         std::size_t referenceCount(ResourceKey key) const;
 
@@ -117,16 +136,22 @@ template<class T> class ResourceManagerData {
 
         template<class U> Resource<T, U> get(ResourceKey key);
 
-        void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy);
+        void set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size = 0, Int priority = 0);
+
+        std::size_t memoryBudget() const { return _memoryBudget; }
 
-        T* fallback() { return _fallback; }
-        const T* fallback() const { return _fallback; }
+        std::size_t memoryUsage() const { return _memoryUsage.load(std::memory_order_relaxed); }
+
+        void setMemoryBudget(std::size_t budget);
+
+        T* fallback() { return _fallback.load(std::memory_order_acquire); }
+        const T* fallback() const { return _fallback.load(std::memory_order_acquire); }
 
         void setFallback(T* data);
 
         void free();
 
-        void clear() { _data.clear(); }
+        void clear();
 
         AbstractResourceLoader<T>* loader() { return _loader; }
         const AbstractResourceLoader<T>* loader() const { return _loader; }
@@ -136,23 +161,92 @@ template<class T> class ResourceManagerData {
         void setLoader(AbstractResourceLoader<T>* loader);
 
     protected:
-        ResourceManagerData(): _fallback(nullptr), _loader(nullptr), _lastChange(0) {}
+        ResourceManagerData(): _blocks{}, _entryCount(0), _slots(nullptr), _count(0), _usedSlotCount(0), _fallback(nullptr), _loader(nullptr), _lastChange(0), _memoryBudget(0), _memoryUsage(0), _lastUse(0) {}
 
     private:
         struct Data;
 
-        const Data& data(ResourceKey key) { return _data[key]; }
+        /* Key is the whole resource key, as it has the same size as
+           std::size_t */
+        struct Slot {
+            std::atomic<std::size_t> key, entry;
+        };
+
+        struct SlotTable {
+            explicit SlotTable(std::size_t size);
+
+            std::unique_ptr<Slot[]> slots;
+            std::size_t size;
+        };
+
+        /* Entries are never moved to a different index while they exist, so
+           Resource can cache the index and skip the lookup */
+        enum: std::size_t {
+            EmptySlot = ~std::size_t{},
+            DeletedSlot = ~std::size_t{} - 1,
+            NotFound = EmptySlot,
+
+            /* Reference count of erased entries, which can't be referenced
+               anymore */
+            Erased = ~std::size_t{}
+        };
+
+        /* Entries are stored in blocks of growing size which are never
+           reallocated, so other threads can access them while new entries
+           are added */
+        enum: std::size_t {
+            FirstBlockSize = 16,
+            BlockCount = sizeof(std::size_t)*8 - 4
+        };
+
+        static std::size_t keyValue(ResourceKey key) {
+            return std::hash<ResourceKey>{}(key);
+        }
 
-        void incrementReferenceCount(ResourceKey key) {
-            ++_data[key].referenceCount;
+        Data& data(std::size_t entry);
+        const Data& data(std::size_t entry) const {
+            return const_cast<ResourceManagerData<T>*>(this)->data(entry);
         }
 
-        void decrementReferenceCount(ResourceKey key);
+        /* Consistent snapshot of entry data and state */
+        std::pair<T*, ResourceDataState> load(std::size_t entry) const;
 
-        std::unordered_map<ResourceKey, Data> _data;
-        T* _fallback;
+        std::size_t incrementReferenceCount(ResourceKey key);
+        bool tryIncrementReferenceCount(std::size_t entry, ResourceKey key);
+        void incrementReferenceCount(std::size_t entry);
+        void decrementReferenceCount(std::size_t entry);
+
+        std::size_t nextUse() {
+            return _lastUse.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+
+        /* find() doesn't need the lock, the others expect it to be held */
+        std::size_t find(ResourceKey key) const;
+        std::size_t insert(ResourceKey key);
+        bool erase(std::size_t entry);
+        void rehash(std::size_t slotCount);
+        void evict(ResourceKey except);
+        void deleteRetired();
+
+        /* Densely stored entries with a free list and an open-addressing
+           table with linear probing mapping keys to entry indices. The
+           tables replaced on rehash and data replaced in set() are kept until
+           free(), as other threads may still access them. */
+        Data* _blocks[BlockCount];
+        std::size_t _entryCount;
+        std::vector<std::size_t> _freeEntries;
+        std::atomic<SlotTable*> _slots;
+        std::vector<std::unique_ptr<SlotTable>> _slotTables;
+        std::vector<T*> _retired;
+        std::atomic<std::size_t> _count;
+        std::size_t _usedSlotCount;
+        std::atomic<T*> _fallback;
         AbstractResourceLoader<T>* _loader;
-        std::size_t _lastChange;
+        std::atomic<std::size_t> _lastChange;
+        std::size_t _memoryBudget;
+        std::atomic<std::size_t> _memoryUsage, _lastUse;
+        mutable ResourceMutex _mutex;
+        ResourceLoaderMutex _loaderMutex;
 };
 
 }
@@ -219,6 +313,45 @@ cube->draw(*shader);
 -   Destroying resource references and deleting manager instance when nothing
     references the resources anymore.
 
+## Memory budget
+
+Memory usage of each resource type can be limited with @ref setMemoryBudget().
+Resource size is not known to the manager, so it has to be passed to
+@ref set() together with the data (or it is reported by the loader, see
+@ref AbstractResourceLoader::set()). When the total size exceeds the budget,
+unreferenced resources with @ref ResourcePolicy::Manual are evicted, the ones
+with lowest priority and least recently used first. Evicted resources are
+removed from the manager completely, so the next @ref get() requests them
+from the loader again.
+@code
+manager.setMemoryBudget<Texture2D>(256*1024*1024);
+
+// Background textures are evicted before the others
+manager.set(key, texture, ResourceDataState::Final, ResourcePolicy::Manual,
+    image.dataSize(image.size()), -1);
+@endcode
+
+@anchor ResourceManager-thread-safety
+## Thread safety
+
+Resources can be acquired with @ref get() and accessed through @ref Resource
+instances from multiple threads at once without any locking on the caller
+side, e.g. when recording draw lists in parallel. Looking up an existing
+resource doesn't lock anything, only adding a new key, @ref set() and the
+other modifying functions serialize on a per-type lock. Data passed to
+@ref set() are published atomically, so other threads see either the
+previous or the new data together with the matching state, never a mix. A
+single @ref Resource instance is not meant to be shared between threads, copy
+it for each of them instead.
+
+If the data of a referenced resource are replaced, the previous data are not
+deleted until the next @ref free(), as other threads might still be
+accessing them. Because of that, @ref free(), @ref clear() and also
+@ref setMemoryBudget(), @ref setFallback() and @ref setLoader() should be
+called only when no other thread is accessing the manager, for example
+between frames. Loaders called from @ref get() don't need to be thread-safe,
+the manager serializes the calls.
+
 @see @ref AbstractResourceLoader
 */
 /* Due to too much work involved with explicit template instantiation (all
@@ -319,6 +452,33 @@ template<class... Types> class ResourceManager: private Implementation::Resource
             return set(key, new typename std::decay<U>::type(std::forward<U>(data)), state, policy);
         }
 
+        /**
+         * @brief Set resource data with size and priority
+         * @param key       Resource key
+         * @param data      Resource data
+         * @param state     Resource state
+         * @param policy    Resource policy
+         * @param size      Memory occupied by the resource, in arbitrary
+         *      units consistent with @ref setMemoryBudget()
+         * @param priority  Eviction priority. Resources with lower priority
+         *      are evicted first.
+         * @return Reference to self (for method chaining)
+         *
+         * Same as @ref set(ResourceKey, T*, ResourceDataState, ResourcePolicy),
+         * but additionally accounts the resource into @ref memoryUsage() and
+         * possibly evicts other resources to stay within
+         * @ref memoryBudget().
+         */
+        template<class T> ResourceManager<Types...>& set(ResourceKey key, T* data, ResourceDataState state, ResourcePolicy policy, std::size_t size, Int priority = 0) {
+            this->Implementation::ResourceManagerData<T>::set(key, data, state, policy, size, priority);
+            return *this;
+        }
+
+        /** @overload */
+        template<class U> ResourceManager<Types...>& set(ResourceKey key, U&& data, ResourceDataState state, ResourcePolicy policy, std::size_t size, Int priority = 0) {
+            return set(key, new typename std::decay<U>::type(std::forward<U>(data)), state, policy, size, priority);
+        }
+
         /**
          * @brief Set resource data
          * @return Reference to self (for method chaining)
@@ -335,6 +495,41 @@ template<class... Types> class ResourceManager: private Implementation::Resource
             return set(key, new typename std::decay<U>::type(std::forward<U>(data)));
         }
 
+        /**
+         * @brief Memory budget for given type of resources
+         *
+         * `0` means unlimited, which is the default.
+         * @see @ref setMemoryBudget(), @ref memoryUsage()
+         */
+        template<class T> std::size_t memoryBudget() const {
+            return this->Implementation::ResourceManagerData<T>::memoryBudget();
+        }
+
+        /**
+         * @brief Set memory budget for given type of resources
+         * @return Reference to self (for method chaining)
+         *
+         * If current memory usage exceeds the budget, unreferenced resources
+         * with @ref ResourcePolicy::Manual are evicted immediately. Set to
+         * `0` to disable the limit. See class documentation for more
+         * information.
+         * @see @ref memoryUsage()
+         */
+        template<class T> ResourceManager<Types...>& setMemoryBudget(std::size_t budget) {
+            this->Implementation::ResourceManagerData<T>::setMemoryBudget(budget);
+            return *this;
+        }
+
+        /**
+         * @brief Memory usage of given type of resources
+         *
+         * Sum of sizes passed to @ref set().
+         * @see @ref memoryBudget()
+         */
+        template<class T> std::size_t memoryUsage() const {
+            return this->Implementation::ResourceManagerData<T>::memoryUsage();
+        }
+
         /** @brief Fallback for not found resources */
         template<class T> T* fallback() {
             return this->Implementation::ResourceManagerData<T>::fallback();
@@ -362,6 +557,10 @@ template<class... Types> class ResourceManager: private Implementation::Resource
         /**
          * @brief Free all resources of given type which are not referenced
          * @return Reference to self (for method chaining)
+         *
+         * Also deletes data of given type replaced by @ref set() while they
+         * were referenced. See @ref ResourceManager-thread-safety "class documentation"
+         * for more information.
          */
         template<class T> ResourceManager<Types...>& free() {
             this->Implementation::ResourceManagerData<T>::free();
@@ -463,93 +662,179 @@ template<class T> void safeDelete(T* data) {
 
 template<class T> ResourceManagerData<T>::~ResourceManagerData() {
     /* Loaders are already deleted via freeLoaders() from ResourceManager */
-    safeDelete(_fallback);
+    for(Data* block: _blocks) delete[] block;
+    deleteRetired();
+    safeDelete(_fallback.load(std::memory_order_relaxed));
+}
+
+template<class T> ResourceManagerData<T>::SlotTable::SlotTable(const std::size_t size): slots{new Slot[size]}, size{size} {
+    for(std::size_t i = 0; i != size; ++i) {
+        slots[i].key.store(0, std::memory_order_relaxed);
+        slots[i].entry.store(EmptySlot, std::memory_order_relaxed);
+    }
+}
+
+template<class T> typename ResourceManagerData<T>::Data& ResourceManagerData<T>::data(std::size_t entry) {
+    std::size_t block = 0;
+    while(entry >= (std::size_t(FirstBlockSize) << block)) {
+        entry -= std::size_t(FirstBlockSize) << block;
+        ++block;
+    }
+    return _blocks[block][entry];
+}
+
+template<class T> std::pair<T*, ResourceDataState> ResourceManagerData<T>::load(const std::size_t entry) const {
+    const Data& d = data(entry);
+
+    /* Retry if set() was updating the entry in the meantime */
+    for(;;) {
+        const std::size_t version = d.version.load(std::memory_order_acquire);
+        if(version & 1) continue;
+        T* const pointer = d.data.load(std::memory_order_relaxed);
+        const ResourceDataState state = d.state.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(d.version.load(std::memory_order_relaxed) == version)
+            return {pointer, state};
+    }
 }
 
 template<class T> std::size_t ResourceManagerData<T>::referenceCount(const ResourceKey key) const {
-    auto it = _data.find(key);
-    if(it == _data.end()) return 0;
-    return it->second.referenceCount;
+    std::lock_guard<ResourceMutex> lock{_mutex};
+    const std::size_t entry = find(key);
+    if(entry == NotFound) return 0;
+    return data(entry).referenceCount.load(std::memory_order_relaxed);
 }
 
 template<class T> ResourceState ResourceManagerData<T>::state(const ResourceKey key) const {
-    const auto it = _data.find(key);
+    std::lock_guard<ResourceMutex> lock{_mutex};
+    const std::size_t entry = find(key);
+    const Data* const d = entry == NotFound ? nullptr : &data(entry);
+    const ResourceDataState state = d ? d->state.load(std::memory_order_relaxed) : ResourceDataState::Mutable;
 
     /* Resource not loaded */
-    if(it == _data.end() || !it->second.data) {
+    if(!d || !d->data.load(std::memory_order_relaxed)) {
         /* Fallback found, add *Fallback to state */
-        if(_fallback) {
-            if(it != _data.end() && it->second.state == ResourceDataState::Loading)
+        if(_fallback.load(std::memory_order_relaxed)) {
+            if(d && state == ResourceDataState::Loading)
                 return ResourceState::LoadingFallback;
-            else if(it != _data.end() && it->second.state == ResourceDataState::NotFound)
+            else if(d && state == ResourceDataState::NotFound)
                 return ResourceState::NotFoundFallback;
             else return ResourceState::NotLoadedFallback;
         }
 
         /* Fallback not found, loading didn't start yet */
-        if(it == _data.end() || (it->second.state != ResourceDataState::Loading && it->second.state != ResourceDataState::NotFound))
+        if(!d || (state != ResourceDataState::Loading && state != ResourceDataState::NotFound))
             return ResourceState::NotLoaded;
     }
 
     /* Loading / NotFound without fallback, Mutable / Final */
-    return static_cast<ResourceState>(it->second.state);
+    return static_cast<ResourceState>(state);
 }
 
 template<class T> template<class U> Resource<T, U> ResourceManagerData<T>::get(ResourceKey key) {
-    /* Ask loader for the data, if they aren't there yet */
-    if(_loader && _data.find(key) == _data.end())
-        _loader->load(key);
-
     return Resource<T, U>(this, key);
 }
 
-template<class T> void ResourceManagerData<T>::set(const ResourceKey key, T* const data, const ResourceDataState state, const ResourcePolicy policy) {
-    auto it = _data.find(key);
+template<class T> void ResourceManagerData<T>::set(const ResourceKey key, T* const data, const ResourceDataState state, const ResourcePolicy policy, const std::size_t size, const Int priority) {
+    std::lock_guard<ResourceMutex> lock{_mutex};
+    std::size_t entry = find(key);
 
     /* NotFound / Loading state shouldn't have any data */
     CORRADE_ASSERT((data == nullptr) == (state == ResourceDataState::NotFound || state == ResourceDataState::Loading),
         "ResourceManager::set(): data should be null if and only if state is NotFound or Loading", );
 
     /* Cannot change resource with already final state */
-    CORRADE_ASSERT(it == _data.end() || it->second.state != ResourceDataState::Final,
+    CORRADE_ASSERT(entry == NotFound || this->data(entry).state.load(std::memory_order_relaxed) != ResourceDataState::Final,
         "ResourceManager::set(): cannot change already final resource" << key, );
 
     /* If nothing is referencing reference-counted resource, we're done */
-    if(policy == ResourcePolicy::ReferenceCounted && (it == _data.end() || it->second.referenceCount == 0)) {
+    if(policy == ResourcePolicy::ReferenceCounted && (entry == NotFound || this->data(entry).referenceCount.load(std::memory_order_relaxed) == 0)) {
         Warning() << "ResourceManager: Reference-counted resource with key" << key << "isn't referenced from anywhere, deleting it immediately";
         safeDelete(data);
 
         /* Delete also already present resource (it could be here
             because previous policy could be other than
             ReferenceCounted) */
-        if(it != _data.end()) _data.erase(it);
+        if(entry != NotFound) erase(entry);
 
         return;
 
     /* Insert it, if not already here */
-    } else if(it == _data.end())
-        it = _data.emplace(key, Data()).first;
+    } else if(entry == NotFound)
+        entry = insert(key);
+
+    /* Publish the data and state together, readers retry while the version
+       is odd or changed */
+    Data& d = this->data(entry);
+    const std::size_t version = d.version.load(std::memory_order_relaxed);
+    d.version.store(version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    T* const previous = d.data.load(std::memory_order_relaxed);
+    d.data.store(data, std::memory_order_relaxed);
+    d.state.store(state, std::memory_order_relaxed);
+    d.version.store(version + 2, std::memory_order_release);
+
+    d.policy.store(policy, std::memory_order_relaxed);
+    d.priority = priority;
+    d.lastUse.store(nextUse(), std::memory_order_relaxed);
+    _memoryUsage.store(_memoryUsage.load(std::memory_order_relaxed) + size - d.size, std::memory_order_relaxed);
+    d.size = size;
+    _lastChange.fetch_add(1, std::memory_order_release);
+
+    /* Other threads may be still using the previous data through a
+       reference, keep them until free() in that case. Pairs with the fence
+       in tryIncrementReferenceCount(), so either the reference is visible
+       here or the other thread sees the new data. Acquire pairs with the
+       release in decrementReferenceCount(), so all accesses through a
+       released reference are done before the data are deleted. */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(previous) {
+        if(d.referenceCount.load(std::memory_order_acquire)) _retired.push_back(previous);
+        else safeDelete(previous);
+    }
+
+    /* Make room for the new data, if needed */
+    if(_memoryBudget && memoryUsage() > _memoryBudget) evict(key);
+}
 
-    /* Replace previous data */
-    safeDelete(it->second.data);
-    it->second.data = data;
-    it->second.state = state;
-    it->second.policy = policy;
-    ++_lastChange;
+template<class T> void ResourceManagerData<T>::setMemoryBudget(const std::size_t budget) {
+    std::lock_guard<ResourceMutex> lock{_mutex};
+    _memoryBudget = budget;
+    if(_memoryBudget && memoryUsage() > _memoryBudget) evict({});
 }
 
 template<class T> void ResourceManagerData<T>::setFallback(T* const data) {
-    safeDelete(_fallback);
-    _fallback = data;
+    std::lock_guard<ResourceMutex> lock{_mutex};
+    if(T* const previous = _fallback.exchange(data, std::memory_order_acq_rel))
+        _retired.push_back(previous);
 }
 
 template<class T> void ResourceManagerData<T>::free() {
-    /* Delete all non-referenced non-resident resources */
-    for(auto it = _data.begin(); it != _data.end(); ) {
-        if(it->second.policy != ResourcePolicy::Resident && !it->second.referenceCount)
-            it = _data.erase(it);
-        else ++it;
+    std::lock_guard<ResourceMutex> lock{_mutex};
+
+    /* Delete all non-referenced non-resident resources. Referenced ones
+       fail to be erased. */
+    for(std::size_t i = 0; i != _entryCount; ++i)
+        if(data(i).policy.load(std::memory_order_relaxed) != ResourcePolicy::Resident)
+            erase(i);
+
+    deleteRetired();
+}
+
+template<class T> void ResourceManagerData<T>::clear() {
+    std::lock_guard<ResourceMutex> lock{_mutex};
+    for(Data*& block: _blocks) {
+        delete[] block;
+        block = nullptr;
     }
+    _entryCount = 0;
+    _freeEntries.clear();
+    _slots.store(nullptr, std::memory_order_release);
+    _slotTables.clear();
+    deleteRetired();
+    _count.store(0, std::memory_order_relaxed);
+    _usedSlotCount = 0;
+    _memoryUsage.store(0, std::memory_order_relaxed);
 }
 
 template<class T> void ResourceManagerData<T>::setLoader(AbstractResourceLoader<T>* const loader) {
@@ -567,40 +852,240 @@ template<class T> void ResourceManagerData<T>::freeLoader() {
     delete _loader;
 }
 
-template<class T> void ResourceManagerData<T>::decrementReferenceCount(ResourceKey key) {
-    auto it = _data.find(key);
-    CORRADE_INTERNAL_ASSERT(it != _data.end());
+template<class T> std::size_t ResourceManagerData<T>::incrementReferenceCount(const ResourceKey key) {
+    /* Fast path without locking, if the entry is already there */
+    std::size_t entry = find(key);
+    if(entry != NotFound && tryIncrementReferenceCount(entry, key)) return entry;
+
+    /* Otherwise insert it */
+    bool inserted = false;
+    {
+        std::lock_guard<ResourceMutex> lock{_mutex};
+        entry = find(key);
+        if(entry == NotFound) {
+            entry = insert(key);
+            inserted = true;
+        }
+        incrementReferenceCount(entry);
+    }
+
+    /* Ask loader for the data. It calls set(), so it can't be done with the
+       lock held. Loaders don't need to be thread-safe, the calls are
+       serialized, but they may request other resources while loading. */
+    if(inserted && _loader) {
+        std::lock_guard<ResourceLoaderMutex> lock{_loaderMutex};
+        _loader->load(key);
+    }
+
+    return entry;
+}
+
+template<class T> bool ResourceManagerData<T>::tryIncrementReferenceCount(const std::size_t entry, const ResourceKey key) {
+    Data& d = data(entry);
+    std::size_t count = d.referenceCount.load(std::memory_order_relaxed);
+    do {
+        if(count == Erased) return false;
+    } while(!d.referenceCount.compare_exchange_weak(count, count + 1, std::memory_order_acquire, std::memory_order_relaxed));
+
+    /* The entry could get erased and reused for another key between the
+       lookup and the increment */
+    if(d.key.load(std::memory_order_relaxed) != keyValue(key)) {
+        decrementReferenceCount(entry);
+        return false;
+    }
 
-    /* Free the resource if it is reference counted */
-    if(--it->second.referenceCount == 0 && it->second.policy == ResourcePolicy::ReferenceCounted)
-        _data.erase(it);
+    /* See set() */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    d.lastUse.store(nextUse(), std::memory_order_relaxed);
+    return true;
 }
 
-template<class T> struct ResourceManagerData<T>::Data {
-    Data(): data(nullptr), state(ResourceDataState::Mutable), policy(ResourcePolicy::Manual), referenceCount(0) {}
+template<class T> void ResourceManagerData<T>::incrementReferenceCount(const std::size_t entry) {
+    Data& d = data(entry);
+    d.referenceCount.fetch_add(1, std::memory_order_relaxed);
+    d.lastUse.store(nextUse(), std::memory_order_relaxed);
+}
 
-    Data(const Data&) = delete;
+template<class T> void ResourceManagerData<T>::decrementReferenceCount(const std::size_t entry) {
+    Data& d = data(entry);
+    CORRADE_INTERNAL_ASSERT(d.referenceCount.load(std::memory_order_relaxed) != Erased);
+    d.lastUse.store(nextUse(), std::memory_order_relaxed);
+    if(d.referenceCount.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+    /* Free the resource if it is reference counted, resource which just
+       became unreferenced can also be evicted. Erasing fails if the entry
+       got referenced again in the meantime. */
+    const bool referenceCounted = d.policy.load(std::memory_order_relaxed) == ResourcePolicy::ReferenceCounted;
+    if(referenceCounted || (_memoryBudget && memoryUsage() > _memoryBudget)) {
+        std::lock_guard<ResourceMutex> lock{_mutex};
+        if(d.policy.load(std::memory_order_relaxed) == ResourcePolicy::ReferenceCounted)
+            erase(entry);
+        else if(_memoryBudget && memoryUsage() > _memoryBudget)
+            evict({});
+    }
+}
 
-    Data(Data&& other): data(other.data), state(other.state), policy(other.policy), referenceCount(other.referenceCount) {
-        other.data = nullptr;
-        other.referenceCount = 0;
+template<class T> std::size_t ResourceManagerData<T>::find(const ResourceKey key) const {
+    const SlotTable* const table = _slots.load(std::memory_order_acquire);
+    if(!table) return NotFound;
+
+    /* There is always at least one empty slot, so this terminates. Tables
+       replaced in the meantime are kept alive and never modified. */
+    const std::size_t value = keyValue(key);
+    const std::size_t mask = table->size - 1;
+    for(std::size_t slot = value & mask; ; slot = (slot + 1) & mask) {
+        const std::size_t entry = table->slots[slot].entry.load(std::memory_order_acquire);
+        if(entry == EmptySlot) return NotFound;
+        if(entry != DeletedSlot && table->slots[slot].key.load(std::memory_order_relaxed) == value) return entry;
     }
+}
+
+template<class T> std::size_t ResourceManagerData<T>::insert(const ResourceKey key) {
+    /* Keep the table at most half full, counting also deleted slots */
+    const SlotTable* table = _slots.load(std::memory_order_relaxed);
+    if(!table || (_usedSlotCount + 1)*2 > table->size) {
+        std::size_t slotCount = 16;
+        while(slotCount < (count() + 1)*4) slotCount *= 2;
+        rehash(slotCount);
+        table = _slots.load(std::memory_order_relaxed);
+    }
+
+    /* Reuse a free entry, if any, otherwise allocate a new block if the
+       last one is full */
+    std::size_t entry;
+    if(!_freeEntries.empty()) {
+        entry = _freeEntries.back();
+        _freeEntries.pop_back();
+    } else {
+        entry = _entryCount++;
+        std::size_t block = 0, offset = entry;
+        while(offset >= (std::size_t(FirstBlockSize) << block)) {
+            offset -= std::size_t(FirstBlockSize) << block;
+            ++block;
+        }
+        if(!_blocks[block]) _blocks[block] = new Data[std::size_t(FirstBlockSize) << block];
+    }
+
+    /* The key has to be visible before the reference count can be
+       incremented, see tryIncrementReferenceCount() */
+    Data& d = data(entry);
+    d.key.store(keyValue(key), std::memory_order_relaxed);
+    d.referenceCount.store(0, std::memory_order_release);
+    _count.fetch_add(1, std::memory_order_relaxed);
+
+    /* Publish the entry after the key */
+    const std::size_t mask = table->size - 1;
+    std::size_t slot = keyValue(key) & mask;
+    while(table->slots[slot].entry.load(std::memory_order_relaxed) != EmptySlot && table->slots[slot].entry.load(std::memory_order_relaxed) != DeletedSlot)
+        slot = (slot + 1) & mask;
+    if(table->slots[slot].entry.load(std::memory_order_relaxed) == EmptySlot) ++_usedSlotCount;
+    table->slots[slot].key.store(keyValue(key), std::memory_order_relaxed);
+    table->slots[slot].entry.store(entry, std::memory_order_release);
+
+    return entry;
+}
+
+template<class T> bool ResourceManagerData<T>::erase(const std::size_t entry) {
+    /* Referenced or already erased */
+    Data& d = data(entry);
+    std::size_t count = 0;
+    if(!d.referenceCount.compare_exchange_strong(count, Erased, std::memory_order_acquire, std::memory_order_relaxed))
+        return false;
+
+    const SlotTable* const table = _slots.load(std::memory_order_relaxed);
+    const std::size_t mask = table->size - 1;
+    std::size_t slot = d.key.load(std::memory_order_relaxed) & mask;
+    while(table->slots[slot].entry.load(std::memory_order_relaxed) != entry) slot = (slot + 1) & mask;
+    table->slots[slot].entry.store(DeletedSlot, std::memory_order_release);
+
+    /* Nobody references the data, so they can be deleted directly */
+    _memoryUsage.store(memoryUsage() - d.size, std::memory_order_relaxed);
+    safeDelete(d.data.exchange(nullptr, std::memory_order_relaxed));
+    d.state.store(ResourceDataState::Mutable, std::memory_order_relaxed);
+    d.policy.store(ResourcePolicy::Manual, std::memory_order_relaxed);
+    d.size = 0;
+    d.priority = 0;
+    d.lastUse.store(0, std::memory_order_relaxed);
+    _freeEntries.push_back(entry);
+    _count.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+template<class T> void ResourceManagerData<T>::rehash(const std::size_t slotCount) {
+    /* Fill a new table and then publish it, other threads may still look up
+       in the previous one */
+    std::unique_ptr<SlotTable> table{new SlotTable{slotCount}};
+    _usedSlotCount = 0;
+
+    const std::size_t mask = slotCount - 1;
+    for(std::size_t i = 0; i != _entryCount; ++i) {
+        const Data& d = data(i);
+        if(d.referenceCount.load(std::memory_order_relaxed) == Erased) continue;
+
+        const std::size_t key = d.key.load(std::memory_order_relaxed);
+        std::size_t slot = key & mask;
+        while(table->slots[slot].entry.load(std::memory_order_relaxed) != EmptySlot) slot = (slot + 1) & mask;
+        table->slots[slot].key.store(key, std::memory_order_relaxed);
+        table->slots[slot].entry.store(i, std::memory_order_relaxed);
+        ++_usedSlotCount;
+    }
+
+    _slots.store(table.get(), std::memory_order_release);
+    _slotTables.push_back(std::move(table));
+}
+
+template<class T> void ResourceManagerData<T>::evict(const ResourceKey except) {
+    /* Gather unreferenced manually managed resources */
+    std::vector<std::size_t> candidates;
+    for(std::size_t i = 0; i != _entryCount; ++i) {
+        const Data& d = data(i);
+        if(d.policy.load(std::memory_order_relaxed) == ResourcePolicy::Manual && !d.referenceCount.load(std::memory_order_relaxed) && d.data.load(std::memory_order_relaxed) && d.key.load(std::memory_order_relaxed) != keyValue(except))
+            candidates.push_back(i);
+    }
+
+    /* Evict the ones with lowest priority and least recently used first */
+    std::sort(candidates.begin(), candidates.end(), [this](std::size_t a, std::size_t b) {
+        const Data& da = data(a);
+        const Data& db = data(b);
+        return da.priority < db.priority || (da.priority == db.priority && da.lastUse.load(std::memory_order_relaxed) < db.lastUse.load(std::memory_order_relaxed));
+    });
+    for(std::size_t entry: candidates) {
+        if(memoryUsage() <= _memoryBudget) break;
+        erase(entry);
+    }
+}
+
+template<class T> void ResourceManagerData<T>::deleteRetired() {
+    for(T* data: _retired) safeDelete(data);
+    _retired.clear();
+
+    /* Keep only the current slot table */
+    if(_slotTables.size() > 1)
+        _slotTables.erase(_slotTables.begin(), _slotTables.end() - 1);
+}
+
+template<class T> struct ResourceManagerData<T>::Data {
+    Data(): key(0), data(nullptr), state(ResourceDataState::Mutable), policy(ResourcePolicy::Manual), referenceCount(Erased), version(0), lastUse(0), size(0), priority(0) {}
+
+    Data(const Data&) = delete;
 
     ~Data();
 
     Data& operator=(const Data&) = delete;
-    Data& operator=(Data&&) = delete;
 
-    T* data;
-    ResourceDataState state;
-    ResourcePolicy policy;
-    std::size_t referenceCount;
+    std::atomic<std::size_t> key;
+    std::atomic<T*> data;
+    std::atomic<ResourceDataState> state;
+    std::atomic<ResourcePolicy> policy;
+    std::atomic<std::size_t> referenceCount, version, lastUse;
+    std::size_t size;
+    Int priority;
 };
 
 template<class T> inline ResourceManagerData<T>::Data::~Data() {
-    CORRADE_ASSERT(referenceCount == 0,
+    CORRADE_ASSERT(referenceCount == 0 || referenceCount == Erased,
         "ResourceManager: cleared/destroyed while data are still referenced", );
-    safeDelete(data);
+    safeDelete(data.load(std::memory_order_relaxed));
 }
 
 }
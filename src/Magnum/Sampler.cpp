@@ -25,8 +25,12 @@
 
 #include "Sampler.h"
 
+#include <algorithm>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Array.h"
+#include "Magnum/Color.h"
 #include "Magnum/Context.h"
 #include "Magnum/Implementation/State.h"
 #include "Magnum/Implementation/TextureState.h"
@@ -60,6 +64,156 @@ Float Sampler::maxMaxAnisotropy() {
     return value;
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+void Sampler::unbind(const Int textureUnit) {
+    Implementation::State& state = Context::current()->state();
+    GLuint& binding = state.texture->samplerBindings[textureUnit];
+
+    /* If given texture unit has no sampler bound, nothing to do */
+    if(binding == 0) return;
+
+    if(state.statisticsEnabled) ++state.statistics.samplerBinds;
+
+    binding = 0;
+    glBindSampler(textureUnit, 0);
+}
+
+void Sampler::unbind(const Int firstTextureUnit, const std::size_t count) {
+    /* State tracker is updated in the implementations */
+    Context::current()->state().texture->bindSamplersImplementation(firstTextureUnit, {nullptr, count});
+}
+
+/** @todoc const std::initializer_list makes Doxygen grumpy */
+void Sampler::bind(const Int firstTextureUnit, std::initializer_list<Sampler*> samplers) {
+    /* State tracker is updated in the implementations */
+    Context::current()->state().texture->bindSamplersImplementation(firstTextureUnit, {samplers.begin(), samplers.size()});
+}
+
+void Sampler::bindImplementationFallback(const GLint firstTextureUnit, const Containers::ArrayReference<Sampler* const> samplers) {
+    for(std::size_t i = 0; i != samplers.size(); ++i)
+        samplers && samplers[i] ? samplers[i]->bind(firstTextureUnit + i) : unbind(firstTextureUnit + i);
+}
+
+#ifndef MAGNUM_TARGET_GLES
+/** @todoc const Containers::ArrayReference makes Doxygen grumpy */
+void Sampler::bindImplementationMulti(const GLint firstTextureUnit, Containers::ArrayReference<Sampler* const> samplers) {
+    Implementation::State& state = Context::current()->state();
+    std::vector<GLuint>& bindings = state.texture->samplerBindings;
+
+    /* Create array of IDs and update the state tracker. Track the first and
+       last unit that actually changed so the call covers only the smallest
+       range needed. */
+    Containers::Array<GLuint> ids{samplers.size()};
+    std::size_t first = samplers.size(), last = 0, changed = 0;
+    for(std::size_t i = 0; i != samplers.size(); ++i) {
+        ids[i] = samplers && samplers[i] ? samplers[i]->_id : 0;
+
+        GLuint& binding = bindings[firstTextureUnit + i];
+        if(binding == ids[i]) continue;
+
+        binding = ids[i];
+        first = std::min(first, i);
+        last = i;
+        ++changed;
+    }
+
+    /* Nothing changed */
+    if(!changed) return;
+
+    if(state.statisticsEnabled) state.statistics.samplerBinds += changed;
+
+    glBindSamplers(firstTextureUnit + first, last - first + 1, ids + first);
+}
+#endif
+
+Sampler::Sampler() {
+    glGenSamplers(1, &_id);
+}
+
+Sampler::~Sampler() {
+    /* Moved out, nothing to do */
+    if(!_id) return;
+
+    /* Remove all bindings from state tracker */
+    for(GLuint& binding: Context::current()->state().texture->samplerBindings)
+        if(binding == _id) binding = 0;
+
+    glDeleteSamplers(1, &_id);
+}
+
+void Sampler::bind(const Int textureUnit) {
+    Implementation::State& state = Context::current()->state();
+    GLuint& binding = state.texture->samplerBindings[textureUnit];
+
+    /* If already bound in given texture unit, nothing to do */
+    if(binding == _id) return;
+
+    if(state.statisticsEnabled) ++state.statistics.samplerBinds;
+
+    binding = _id;
+    glBindSampler(textureUnit, _id);
+}
+
+Sampler& Sampler::setMinificationFilter(const Filter filter, const Mipmap mipmap) {
+    glSamplerParameteri(_id, GL_TEXTURE_MIN_FILTER, GLint(filter)|GLint(mipmap));
+    return *this;
+}
+
+Sampler& Sampler::setMagnificationFilter(const Filter filter) {
+    glSamplerParameteri(_id, GL_TEXTURE_MAG_FILTER, GLint(filter));
+    return *this;
+}
+
+Sampler& Sampler::setMinLod(const Float lod) {
+    glSamplerParameterf(_id, GL_TEXTURE_MIN_LOD, lod);
+    return *this;
+}
+
+Sampler& Sampler::setMaxLod(const Float lod) {
+    glSamplerParameterf(_id, GL_TEXTURE_MAX_LOD, lod);
+    return *this;
+}
+
+#ifndef MAGNUM_TARGET_GLES
+Sampler& Sampler::setLodBias(const Float bias) {
+    glSamplerParameterf(_id, GL_TEXTURE_LOD_BIAS, bias);
+    return *this;
+}
+#endif
+
+Sampler& Sampler::setWrapping(const Array3D<Wrapping>& wrapping) {
+    glSamplerParameteri(_id, GL_TEXTURE_WRAP_S, GLint(wrapping.x()));
+    glSamplerParameteri(_id, GL_TEXTURE_WRAP_T, GLint(wrapping.y()));
+    glSamplerParameteri(_id, GL_TEXTURE_WRAP_R, GLint(wrapping.z()));
+    return *this;
+}
+
+Sampler& Sampler::setBorderColor(const Color4& color) {
+    #ifndef MAGNUM_TARGET_GLES
+    glSamplerParameterfv(_id, GL_TEXTURE_BORDER_COLOR, color.data());
+    #else
+    glSamplerParameterfv(_id, GL_TEXTURE_BORDER_COLOR_NV, color.data());
+    #endif
+    return *this;
+}
+
+Sampler& Sampler::setMaxAnisotropy(const Float anisotropy) {
+    if(Context::current()->isExtensionSupported<Extensions::GL::EXT::texture_filter_anisotropic>())
+        glSamplerParameterf(_id, GL_TEXTURE_MAX_ANISOTROPY_EXT, anisotropy);
+    return *this;
+}
+
+Sampler& Sampler::setCompareMode(const CompareMode mode) {
+    glSamplerParameteri(_id, GL_TEXTURE_COMPARE_MODE, GLenum(mode));
+    return *this;
+}
+
+Sampler& Sampler::setCompareFunction(const CompareFunction function) {
+    glSamplerParameteri(_id, GL_TEXTURE_COMPARE_FUNC, GLenum(function));
+    return *this;
+}
+#endif
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 Debug operator<<(Debug debug, const Sampler::Filter value) {
     switch(value) {
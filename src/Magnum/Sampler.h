@@ -29,19 +29,47 @@
  * @brief Class @ref Magnum::Sampler
  */
 
+#include <initializer_list>
+#include <utility>
+#include <Corrade/Containers/Containers.h>
+
+#include "Magnum/Array.h"
 #include "Magnum/Magnum.h"
 #include "Magnum/OpenGL.h"
 #include "Magnum/visibility.h"
 
 namespace Magnum {
 
+namespace Implementation { struct TextureState; }
+
 /**
 @brief Texture sampler
 
+Besides the enums used for configuring texture sampling state, on OpenGL ES
+3.0 and desktop OpenGL with @extension{ARB,sampler_objects} this class wraps
+an OpenGL sampler object. A sampler bound to a texture unit overrides the
+sampling state of the texture bound to the same unit, so one texture can be
+sampled with different filtering or wrapping without reconfiguring it and
+the sampling state needs to be set only once for all textures that share it:
+@code
+Sampler sampler;
+sampler.setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Linear)
+    .setMagnificationFilter(Sampler::Filter::Linear)
+    .setWrapping(Sampler::Wrapping::ClampToEdge);
+
+texture.bind(0);
+sampler.bind(0);
+@endcode
+
+Binding is tracked per texture unit, so binding the same sampler again is a
+no-op. Use @ref SamplerCache to share samplers with identical state.
+
 @see @ref Texture, @ref TextureArray, @ref CubeMapTexture,
     @ref CubeMapTextureArray, @ref RectangleTexture
 */
 class MAGNUM_EXPORT Sampler {
+    friend Implementation::TextureState;
+
     public:
         /**
          * @brief Texture filtering
@@ -242,8 +270,214 @@ class MAGNUM_EXPORT Sampler {
          */
         static CORRADE_DEPRECATED("use maxMaxAnisotropy() instead") Float maxAnisotropy() { return maxMaxAnisotropy(); }
         #endif
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Unbind any sampler from given texture unit
+         *
+         * The texture unit then uses sampling state of the texture bound to
+         * it. If there's no sampler bound, the function does nothing.
+         * @see @fn_gl{BindSampler}
+         * @requires_gl33 Extension @extension{ARB,sampler_objects}
+         * @requires_gles30 Sampler objects are not available in OpenGL ES
+         *      2.0.
+         */
+        static void unbind(Int textureUnit);
+
+        /**
+         * @brief Unbind samplers from given range of texture units
+         *
+         * Unbinds all samplers in the range @f$ [ firstTextureUnit ; firstTextureUnit + count ) @f$.
+         * If @extension{ARB,multi_bind} (part of OpenGL 4.4) is available,
+         * the units are unbound with a single call.
+         * @see @fn_gl{BindSamplers} or @fn_gl{BindSampler}
+         * @requires_gl33 Extension @extension{ARB,sampler_objects}
+         * @requires_gles30 Sampler objects are not available in OpenGL ES
+         *      2.0.
+         */
+        static void unbind(Int firstTextureUnit, std::size_t count);
+
+        /**
+         * @brief Bind samplers to given range of texture units
+         *
+         * Binds first sampler in the list to @p firstTextureUnit, second to
+         * `firstTextureUnit + 1` etc. If any sampler is `nullptr`, given
+         * texture unit is unbound. If @extension{ARB,multi_bind} (part of
+         * OpenGL 4.4) is available, only the smallest range of units whose
+         * binding actually changed is bound with a single call.
+         * @see @fn_gl{BindSamplers} or @fn_gl{BindSampler}
+         * @requires_gl33 Extension @extension{ARB,sampler_objects}
+         * @requires_gles30 Sampler objects are not available in OpenGL ES
+         *      2.0.
+         */
+        static void bind(Int firstTextureUnit, std::initializer_list<Sampler*> samplers);
+
+        /**
+         * @brief Constructor
+         *
+         * Creates new OpenGL sampler object with default OpenGL sampling
+         * state.
+         * @see @fn_gl{GenSamplers}
+         * @requires_gl33 Extension @extension{ARB,sampler_objects}
+         * @requires_gles30 Sampler objects are not available in OpenGL ES
+         *      2.0.
+         */
+        explicit Sampler();
+
+        /** @brief Copying is not allowed */
+        Sampler(const Sampler&) = delete;
+
+        /** @brief Move constructor */
+        Sampler(Sampler&& other) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes associated OpenGL sampler object.
+         * @see @fn_gl{DeleteSamplers}
+         */
+        ~Sampler();
+
+        /** @brief Copying is not allowed */
+        Sampler& operator=(const Sampler&) = delete;
+
+        /** @brief Move assignment */
+        Sampler& operator=(Sampler&& other) noexcept;
+
+        /** @brief OpenGL sampler ID */
+        GLuint id() const { return _id; }
+
+        /**
+         * @brief Bind sampler to given texture unit
+         *
+         * If the sampler is already bound to given unit, the function does
+         * nothing.
+         * @see @ref bind(Int, std::initializer_list<Sampler*>),
+         *      @ref unbind(), @fn_gl{BindSampler}
+         */
+        void bind(Int textureUnit);
+
+        /**
+         * @brief Set minification filter
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Texture::setMinificationFilter() for more information.
+         * @see @fn_gl{SamplerParameter} with @def_gl{TEXTURE_MIN_FILTER}
+         */
+        Sampler& setMinificationFilter(Filter filter, Mipmap mipmap = Mipmap::Base);
+
+        /**
+         * @brief Set magnification filter
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Texture::setMagnificationFilter() for more information.
+         * @see @fn_gl{SamplerParameter} with @def_gl{TEXTURE_MAG_FILTER}
+         */
+        Sampler& setMagnificationFilter(Filter filter);
+
+        /**
+         * @brief Set minimum level-of-detail parameter
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Texture::setMinLod() for more information.
+         * @see @fn_gl{SamplerParameter} with @def_gl{TEXTURE_MIN_LOD}
+         */
+        Sampler& setMinLod(Float lod);
+
+        /**
+         * @brief Set maximum level-of-detail parameter
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Texture::setMaxLod() for more information.
+         * @see @fn_gl{SamplerParameter} with @def_gl{TEXTURE_MAX_LOD}
+         */
+        Sampler& setMaxLod(Float lod);
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set level-of-detail bias
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Texture::setLodBias() for more information.
+         * @see @fn_gl{SamplerParameter} with @def_gl{TEXTURE_LOD_BIAS}
+         * @requires_gl Texture LOD bias can be specified only directly in
+         *      fragment shader in OpenGL ES.
+         */
+        Sampler& setLodBias(Float bias);
+        #endif
+
+        /**
+         * @brief Set wrapping
+         * @return Reference to self (for method chaining)
+         *
+         * Sets wrapping in all three directions. See
+         * @ref Texture::setWrapping() for more information.
+         * @see @fn_gl{SamplerParameter} with @def_gl{TEXTURE_WRAP_S},
+         *      @def_gl{TEXTURE_WRAP_T}, @def_gl{TEXTURE_WRAP_R}
+         */
+        Sampler& setWrapping(const Array3D<Wrapping>& wrapping);
+
+        /**
+         * @brief Set border color
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Texture::setBorderColor() for more information.
+         * @see @fn_gl{SamplerParameter} with @def_gl{TEXTURE_BORDER_COLOR}
+         * @requires_es_extension Extension @es_extension{NV,texture_border_clamp}
+         */
+        Sampler& setBorderColor(const Color4& color);
+
+        /**
+         * @brief Set max anisotropy
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Texture::setMaxAnisotropy() for more information. If
+         * extension @extension{EXT,texture_filter_anisotropic} (desktop or
+         * ES) is not available, this function does nothing.
+         * @see @fn_gl{SamplerParameter} with @def_gl{TEXTURE_MAX_ANISOTROPY_EXT}
+         */
+        Sampler& setMaxAnisotropy(Float anisotropy);
+
+        /**
+         * @brief Set depth texture comparison mode
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Texture::setCompareMode() for more information.
+         * @see @fn_gl{SamplerParameter} with @def_gl{TEXTURE_COMPARE_MODE}
+         */
+        Sampler& setCompareMode(CompareMode mode);
+
+        /**
+         * @brief Set depth texture comparison function
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Texture::setCompareFunction() for more information.
+         * @see @fn_gl{SamplerParameter} with @def_gl{TEXTURE_COMPARE_FUNC}
+         */
+        Sampler& setCompareFunction(CompareFunction function);
+
+    private:
+        static void MAGNUM_LOCAL bindImplementationFallback(GLint firstTextureUnit, Containers::ArrayReference<Sampler* const> samplers);
+        #ifndef MAGNUM_TARGET_GLES
+        static void MAGNUM_LOCAL bindImplementationMulti(GLint firstTextureUnit, Containers::ArrayReference<Sampler* const> samplers);
+        #endif
+
+        GLuint _id;
+        #endif
 };
 
+#ifndef MAGNUM_TARGET_GLES2
+inline Sampler::Sampler(Sampler&& other) noexcept: _id{other._id} {
+    other._id = 0;
+}
+
+inline Sampler& Sampler::operator=(Sampler&& other) noexcept {
+    using std::swap;
+    swap(_id, other._id);
+    return *this;
+}
+#endif
+
 /** @debugoperatorclassenum{Magnum::Sampler,Magnum::Sampler::Filter} */
 Debug MAGNUM_EXPORT operator<<(Debug debug, Sampler::Filter value);
 
@@ -0,0 +1,126 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "SamplerCache.h"
+
+#include <functional>
+#include <unordered_map>
+
+namespace Magnum {
+
+namespace {
+    struct ParametersHash {
+        std::size_t operator()(const SamplerCache::Parameters& parameters) const {
+            std::size_t hash = 0;
+            const auto combine = [&hash](const std::size_t value) {
+                hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            };
+            const std::hash<Float> floatHash;
+
+            combine(std::size_t(parameters.minificationFilter));
+            combine(std::size_t(parameters.mipmap));
+            combine(std::size_t(parameters.magnificationFilter));
+            for(UnsignedInt i = 0; i != 3; ++i)
+                combine(std::size_t(parameters.wrapping[i]));
+            combine(floatHash(parameters.minLod));
+            combine(floatHash(parameters.maxLod));
+            #ifndef MAGNUM_TARGET_GLES
+            combine(floatHash(parameters.lodBias));
+            #endif
+            for(UnsignedInt i = 0; i != 4; ++i)
+                combine(floatHash(parameters.borderColor[i]));
+            combine(floatHash(parameters.maxAnisotropy));
+            combine(std::size_t(parameters.compareMode));
+            combine(std::size_t(parameters.compareFunction));
+            return hash;
+        }
+    };
+}
+
+struct SamplerCache::Samplers {
+    /* Samplers are never moved after insertion, so the returned references
+       stay valid even on rehash */
+    std::unordered_map<Parameters, Sampler, ParametersHash> samplers;
+};
+
+bool SamplerCache::Parameters::operator==(const Parameters& other) const {
+    return minificationFilter == other.minificationFilter &&
+        mipmap == other.mipmap &&
+        magnificationFilter == other.magnificationFilter &&
+        wrapping == other.wrapping &&
+        minLod == other.minLod &&
+        maxLod == other.maxLod &&
+        #ifndef MAGNUM_TARGET_GLES
+        lodBias == other.lodBias &&
+        #endif
+        borderColor == other.borderColor &&
+        maxAnisotropy == other.maxAnisotropy &&
+        compareMode == other.compareMode &&
+        compareFunction == other.compareFunction;
+}
+
+SamplerCache::SamplerCache(): _samplers{new Samplers} {}
+
+SamplerCache::SamplerCache(SamplerCache&&) noexcept = default;
+
+SamplerCache::~SamplerCache() = default;
+
+SamplerCache& SamplerCache::operator=(SamplerCache&&) noexcept = default;
+
+std::size_t SamplerCache::size() const {
+    return _samplers->samplers.size();
+}
+
+Sampler& SamplerCache::get(const Parameters& parameters) {
+    /* Already cached */
+    auto found = _samplers->samplers.find(parameters);
+    if(found != _samplers->samplers.end()) return found->second;
+
+    Sampler& sampler = _samplers->samplers.emplace(parameters, Sampler{}).first->second;
+    sampler.setMinificationFilter(parameters.minificationFilter, parameters.mipmap)
+        .setMagnificationFilter(parameters.magnificationFilter)
+        .setWrapping(parameters.wrapping)
+        .setMinLod(parameters.minLod)
+        .setMaxLod(parameters.maxLod)
+        .setCompareMode(parameters.compareMode)
+        .setCompareFunction(parameters.compareFunction);
+    #ifndef MAGNUM_TARGET_GLES
+    sampler.setLodBias(parameters.lodBias);
+    #endif
+
+    /* These need extensions, set them only if not default */
+    if(parameters.borderColor != Color4{0.0f, 0.0f})
+        sampler.setBorderColor(parameters.borderColor);
+    if(parameters.maxAnisotropy != 1.0f)
+        sampler.setMaxAnisotropy(parameters.maxAnisotropy);
+
+    return sampler;
+}
+
+void SamplerCache::clear() {
+    _samplers->samplers.clear();
+}
+
+}
@@ -0,0 +1,203 @@
+#ifndef Magnum_SamplerCache_h
+#define Magnum_SamplerCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::SamplerCache
+ */
+#endif
+
+#include <memory>
+
+#include "Magnum/Array.h"
+#include "Magnum/Color.h"
+#include "Magnum/Sampler.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+/**
+@brief Sampler cache
+
+Creates one @ref Sampler for each distinct sampling state and returns the
+same instance for all subsequent requests with the same state. Textures can
+then be left in their default configuration and sampling is fully described
+by the samplers bound alongside them. As binding of samplers is tracked per
+texture unit, drawing many objects with the same sampling state results in
+no sampler-related OpenGL calls at all:
+@code
+SamplerCache cache;
+
+SamplerCache::Parameters trilinear;
+trilinear.minificationFilter = Sampler::Filter::Linear;
+trilinear.mipmap = Sampler::Mipmap::Linear;
+trilinear.maxAnisotropy = Sampler::maxMaxAnisotropy();
+
+SamplerCache::Parameters clampedTrilinear = trilinear;
+clampedTrilinear.wrapping = Sampler::Wrapping::ClampToEdge;
+
+for(Drawable& drawable: drawables) {
+    drawable.texture().bind(0);
+    cache.bind(0, drawable.clampToEdge() ? clampedTrilinear : trilinear);
+    drawable.mesh().draw(shader);
+}
+@endcode
+
+The cache owns the samplers, references returned from @ref get() are valid
+until the cache is destroyed or @ref clear() is called.
+@requires_gl33 Extension @extension{ARB,sampler_objects}
+@requires_gles30 Sampler objects are not available in OpenGL ES 2.0.
+*/
+class MAGNUM_EXPORT SamplerCache {
+    public:
+        /**
+         * @brief Sampling state
+         *
+         * Default values are the same as default OpenGL sampling state.
+         */
+        struct Parameters {
+            /** @brief Minification filter */
+            Sampler::Filter minificationFilter = Sampler::Filter::Nearest;
+
+            /** @brief Mip level selection for minification */
+            Sampler::Mipmap mipmap = Sampler::Mipmap::Linear;
+
+            /** @brief Magnification filter */
+            Sampler::Filter magnificationFilter = Sampler::Filter::Linear;
+
+            /** @brief Wrapping in all three directions */
+            Array3D<Sampler::Wrapping> wrapping = Sampler::Wrapping::Repeat;
+
+            /** @brief Minimum level-of-detail */
+            Float minLod = -1000.0f;
+
+            /** @brief Maximum level-of-detail */
+            Float maxLod = 1000.0f;
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * @brief Level-of-detail bias
+             *
+             * @requires_gl Texture LOD bias can be specified only directly
+             *      in fragment shader in OpenGL ES.
+             */
+            Float lodBias = 0.0f;
+            #endif
+
+            /**
+             * @brief Border color
+             *
+             * @requires_es_extension Extension @es_extension{NV,texture_border_clamp}
+             *      for values other than the default.
+             */
+            Color4 borderColor{0.0f, 0.0f};
+
+            /** @brief Max anisotropy */
+            Float maxAnisotropy = 1.0f;
+
+            /** @brief Depth texture comparison mode */
+            Sampler::CompareMode compareMode = Sampler::CompareMode::None;
+
+            /** @brief Depth texture comparison function */
+            Sampler::CompareFunction compareFunction = Sampler::CompareFunction::LessOrEqual;
+
+            /** @brief Equality comparison */
+            bool operator==(const Parameters& other) const;
+
+            /** @brief Non-equality comparison */
+            bool operator!=(const Parameters& other) const {
+                return !operator==(other);
+            }
+        };
+
+        /**
+         * @brief Constructor
+         *
+         * Doesn't create any sampler.
+         */
+        explicit SamplerCache();
+
+        /** @brief Copying is not allowed */
+        SamplerCache(const SamplerCache&) = delete;
+
+        /** @brief Move constructor */
+        SamplerCache(SamplerCache&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes all samplers.
+         */
+        ~SamplerCache();
+
+        /** @brief Copying is not allowed */
+        SamplerCache& operator=(const SamplerCache&) = delete;
+
+        /** @brief Move assignment */
+        SamplerCache& operator=(SamplerCache&&) noexcept;
+
+        /** @brief Count of distinct samplers in the cache */
+        std::size_t size() const;
+
+        /**
+         * @brief Sampler for given sampling state
+         *
+         * If there's no sampler with given state yet, creates it and sets
+         * all its parameters, otherwise returns the existing one.
+         */
+        Sampler& get(const Parameters& parameters);
+
+        /**
+         * @brief Bind sampler for given sampling state to given texture unit
+         * @return Reference to self (for method chaining)
+         *
+         * Equivalent to calling @ref get() and @ref Sampler::bind().
+         */
+        SamplerCache& bind(Int textureUnit, const Parameters& parameters) {
+            get(parameters).bind(textureUnit);
+            return *this;
+        }
+
+        /**
+         * @brief Delete all samplers
+         *
+         * All references previously returned from @ref get() are invalidated.
+         */
+        void clear();
+
+    private:
+        struct Samplers;
+
+        std::unique_ptr<Samplers> _samplers;
+};
+
+}
+#else
+#error this header is not available on OpenGL ES 2.0 build
+#endif
+
+#endif
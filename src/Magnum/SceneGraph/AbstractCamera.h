@@ -29,6 +29,11 @@
  * @brief Class @ref Magnum::SceneGraph::AbstractCamera, enum @ref Magnum::SceneGraph::AspectRatioPolicy, alias @ref Magnum::SceneGraph::AbstractBasicCamera2D, @ref Magnum::SceneGraph::AbstractBasicCamera3D, typedef @ref Magnum::SceneGraph::AbstractCamera2D, @ref Magnum::SceneGraph::AbstractCamera3D
  */
 
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/SceneGraph/AbstractFeature.h"
@@ -48,6 +53,8 @@ enum class AspectRatioPolicy: UnsignedByte {
 };
 
 namespace Implementation {
+    template<UnsignedInt dimensions, class T> void cullSpheres(const MatrixTypeFor<dimensions, T>& projectionMatrix, const std::vector<T>& spheres, std::vector<UnsignedByte>& visible);
+    template<class T> void radixSortByKey(std::vector<std::pair<UnsignedLong, T>>& items, std::vector<std::pair<UnsignedLong, T>>& scratch);
     template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRatioFix(AspectRatioPolicy aspectRatioPolicy, const Math::Vector2<T>& projectionScale, const Vector2i& viewport);
 }
 
@@ -75,6 +82,8 @@ and @ref SceneGraph-Camera3D-explicit-specializations "Camera3D" class documenta
     @ref Drawable, @ref DrawableGroup
 */
 template<UnsignedInt dimensions, class T> class AbstractCamera: public AbstractFeature<dimensions, T> {
+    friend AnimableGroup<dimensions, T>;
+
     public:
         /** @brief Aspect ratio policy */
         AspectRatioPolicy aspectRatioPolicy() const { return _aspectRatioPolicy; }
@@ -127,10 +136,85 @@ template<UnsignedInt dimensions, class T> class AbstractCamera: public AbstractF
          */
         virtual void setViewport(const Vector2i& size);
 
+        /** @brief Whether drawables are sorted before drawing */
+        bool isSortingEnabled() const { return _sortingEnabled; }
+
+        /**
+         * @brief Enable or disable sorting of drawables
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, drawables in the group are drawn in order of increasing
+         * @ref Drawable::sortKey() instead of the order in the group.
+         * Drawables with the same key keep their relative order. Default is
+         * `false`.
+         */
+        AbstractCamera<dimensions, T>& setSortingEnabled(bool enabled) {
+            _sortingEnabled = enabled;
+            return *this;
+        }
+
+        /** @brief Whether debug groups are emitted around drawing */
+        bool isDebugGroupsEnabled() const { return _debugGroupsEnabled; }
+
+        /**
+         * @brief Enable or disable debug groups around drawing
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, each @ref draw() call is wrapped in a @ref DebugGroup
+         * labeled with @ref debugLabel(), so the pass is visible in GPU
+         * debuggers such as RenderDoc or Nsight. Does nothing if neither
+         * @extension{KHR,debug} nor @extension{EXT,debug_marker} is
+         * available. Default is `false`, in which case no GL calls are made.
+         * @see @ref setDrawableDebugGroupsEnabled()
+         */
+        AbstractCamera<dimensions, T>& setDebugGroupsEnabled(bool enabled) {
+            _debugGroupsEnabled = enabled;
+            return *this;
+        }
+
+        /** @brief Whether debug groups are emitted around each drawable */
+        bool isDrawableDebugGroupsEnabled() const { return _drawableDebugGroupsEnabled; }
+
+        /**
+         * @brief Enable or disable debug groups around each drawable
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, drawing of each visible drawable is wrapped in a
+         * @ref DebugGroup labeled with @ref Drawable::debugLabel() and with
+         * its position in the draw order as ID. Culled drawables don't emit
+         * anything. Independent of @ref setDebugGroupsEnabled(). Default is
+         * `false`.
+         */
+        AbstractCamera<dimensions, T>& setDrawableDebugGroupsEnabled(bool enabled) {
+            _drawableDebugGroupsEnabled = enabled;
+            return *this;
+        }
+
+        /** @brief Debug group label */
+        std::string debugLabel() const { return _debugLabel; }
+
+        /**
+         * @brief Set debug group label
+         * @return Reference to self (for method chaining)
+         *
+         * Default is `"Camera"`.
+         * @see @ref setDebugGroupsEnabled()
+         */
+        AbstractCamera<dimensions, T>& setDebugLabel(std::string label) {
+            _debugLabel = std::move(label);
+            return *this;
+        }
+
         /**
          * @brief Draw
          *
-         * Draws given group of drawables.
+         * Draws given group of drawables. Drawables with bounding sphere
+         * that lies completely outside of the view frustum are skipped.
+         * Temporary storage needed for sorting, culling and transformation
+         * calculation is kept in the camera and reused, so drawing doesn't
+         * allocate any memory in steady state.
+         * @see @ref setSortingEnabled(), @ref Drawable::setBoundingSphere(),
+         *      @ref setDebugGroupsEnabled()
          */
         virtual void draw(DrawableGroup<dimensions, T>& group);
 
@@ -143,6 +227,21 @@ template<UnsignedInt dimensions, class T> class AbstractCamera: public AbstractF
 
         ~AbstractCamera();
 
+        /**
+         * @brief Cull bounding spheres
+         * @param spheres   Bounding spheres in camera space, first all X
+         *      coordinates, then all Y coordinates etc. and finally all
+         *      radii
+         * @param visible   Visibility of each sphere, to be cleared for
+         *      spheres outside of the view frustum
+         *
+         * Called from @ref draw(). Default implementation culls against the
+         * frustum given by @ref projectionMatrix(), subclasses rendering
+         * more views in one pass can override it to cull against all of
+         * them.
+         */
+        virtual void cullBoundingSpheres(const std::vector<T>& spheres, std::vector<UnsignedByte>& visible);
+
         /** Recalculates camera matrix */
         void cleanInverted(const MatrixTypeFor<dimensions, T>& invertedAbsoluteTransformationMatrix) override {
             _cameraMatrix = invertedAbsoluteTransformationMatrix;
@@ -156,10 +255,22 @@ template<UnsignedInt dimensions, class T> class AbstractCamera: public AbstractF
         #endif
 
     private:
+        /* Temporary storage for draw(), reused across frames */
+        struct DrawScratch {
+            std::vector<std::pair<UnsignedLong, Drawable<dimensions, T>*>> drawables, sorted;
+            std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
+            std::vector<MatrixTypeFor<dimensions, T>> transformations;
+            std::vector<T> spheres;
+            std::vector<UnsignedByte> visible;
+        };
+
         MatrixTypeFor<dimensions, T> _projectionMatrix;
         MatrixTypeFor<dimensions, T> _cameraMatrix;
 
         Vector2i _viewport;
+        bool _sortingEnabled, _debugGroupsEnabled, _drawableDebugGroupsEnabled;
+        std::string _debugLabel;
+        DrawScratch _drawScratch;
 };
 
 /**
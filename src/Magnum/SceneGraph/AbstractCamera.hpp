@@ -29,6 +29,11 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref AbstractCamera.h
  */
 
+#include <algorithm>
+
+#include "Magnum/AllocationTracker.h"
+#include "Magnum/DebugOutput.h"
+#include "Magnum/Math/Constants.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/SceneGraph/AbstractCamera.h"
 #include "Magnum/SceneGraph/Drawable.h"
@@ -37,6 +42,60 @@ namespace Magnum { namespace SceneGraph {
 
 namespace Implementation {
 
+/* Stable LSD radix sort, one byte per pass. Passes in which all keys have the
+   same byte are skipped, so keys using only a few bits are cheap to sort. */
+template<class T> void radixSortByKey(std::vector<std::pair<UnsignedLong, T>>& items, std::vector<std::pair<UnsignedLong, T>>& scratch) {
+    scratch.resize(items.size());
+    for(UnsignedInt shift = 0; shift != 64; shift += 8) {
+        std::size_t offsets[256]{};
+        for(const auto& item: items) ++offsets[(item.first >> shift) & 0xff];
+
+        /* All keys have the same byte, nothing to do in this pass */
+        if(offsets[(items.front().first >> shift) & 0xff] == items.size())
+            continue;
+
+        std::size_t sum = 0;
+        for(std::size_t& offset: offsets) {
+            const std::size_t count = offset;
+            offset = sum;
+            sum += count;
+        }
+
+        for(const auto& item: items)
+            scratch[offsets[(item.first >> shift) & 0xff]++] = item;
+        std::swap(items, scratch);
+    }
+}
+
+/* The spheres are in camera space, stored as SoA -- first all X coordinates,
+   then all Y coordinates etc. and finally all radii, so the inner loop over
+   one plane can be vectorized by the compiler. The planes are extracted from
+   the projection matrix (Gribb & Hartmann). */
+template<UnsignedInt dimensions, class T> void cullSpheres(const MatrixTypeFor<dimensions, T>& projectionMatrix, const std::vector<T>& spheres, std::vector<UnsignedByte>& visible) {
+    const std::size_t count = visible.size();
+    CORRADE_INTERNAL_ASSERT(spheres.size() == count*(dimensions + 1));
+
+    const Math::Vector<dimensions + 1, T> w = projectionMatrix.row(dimensions);
+    for(UnsignedInt i = 0; i != dimensions*2; ++i) {
+        Math::Vector<dimensions + 1, T> plane = i % 2 ?
+            w - projectionMatrix.row(i/2) : w + projectionMatrix.row(i/2);
+
+        /* Normalize the plane so the distance is in proper units */
+        T normalLength{0};
+        for(UnsignedInt d = 0; d != dimensions; ++d)
+            normalLength += plane[d]*plane[d];
+        plane /= std::sqrt(normalLength);
+
+        const T* const radii = spheres.data() + dimensions*count;
+        for(std::size_t j = 0; j != count; ++j) {
+            T distance = plane[dimensions];
+            for(UnsignedInt d = 0; d != dimensions; ++d)
+                distance += plane[d]*spheres[d*count + j];
+            visible[j] &= UnsignedByte(distance >= -radii[j]);
+        }
+    }
+}
+
 template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRatioFix(AspectRatioPolicy aspectRatioPolicy, const Math::Vector2<T>& projectionScale, const Vector2i& viewport) {
     /* Don't divide by zero / don't preserve anything */
     if(projectionScale.x() == 0 || projectionScale.y() == 0 || viewport.x() == 0 || viewport.y() == 0 || aspectRatioPolicy == AspectRatioPolicy::NotPreserved)
@@ -55,7 +114,7 @@ template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRat
 
 }
 
-template<UnsignedInt dimensions, class T> AbstractCamera<dimensions, T>::AbstractCamera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved) {
+template<UnsignedInt dimensions, class T> AbstractCamera<dimensions, T>::AbstractCamera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved), _sortingEnabled{false}, _debugGroupsEnabled{false}, _drawableDebugGroupsEnabled{false}, _debugLabel{"Camera"} {
     AbstractFeature<dimensions, T>::setCachedTransformations(CachedTransformation::InvertedAbsolute);
 }
 
@@ -76,24 +135,97 @@ template<UnsignedInt dimensions, class T> void AbstractCamera<dimensions, T>::se
     fixAspectRatio();
 }
 
+template<UnsignedInt dimensions, class T> void AbstractCamera<dimensions, T>::cullBoundingSpheres(const std::vector<T>& spheres, std::vector<UnsignedByte>& visible) {
+    Implementation::cullSpheres<dimensions, T>(_projectionMatrix, spheres, visible);
+}
+
 template<UnsignedInt dimensions, class T> void AbstractCamera<dimensions, T>::draw(DrawableGroup<dimensions, T>& group) {
+    MAGNUM_ALLOCATION_SCOPE(SceneGraph);
+
     AbstractObject<dimensions, T>* scene = AbstractFeature<dimensions, T>::object().scene();
     CORRADE_ASSERT(scene, "Camera::draw(): cannot draw when camera is not part of any scene", );
 
+    /* Popped on scope exit */
+    DebugGroup debugGroup;
+    if(_debugGroupsEnabled)
+        debugGroup.push(DebugGroup::Source::Application, 0, _debugLabel);
+
     /* Compute camera matrix */
     AbstractFeature<dimensions, T>::object().setClean();
 
-    /* Compute transformations of all objects in the group relative to the camera */
-    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
-    objects.reserve(group.size());
+    /* Take the storage used in previous frame, so a drawable drawing another
+       group with this camera doesn't overwrite it */
+    DrawScratch scratch;
+    std::swap(scratch, _drawScratch);
+
+    /* Order the drawables by sort key, if requested */
+    std::vector<std::pair<UnsignedLong, Drawable<dimensions, T>*>>& drawables = scratch.drawables;
+    drawables.clear();
+    drawables.reserve(group.size());
     for(std::size_t i = 0; i != group.size(); ++i)
-        objects.push_back(group[i].object());
-    std::vector<MatrixTypeFor<dimensions, T>> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
+        drawables.emplace_back(group.keys()[i], &group[i]);
+    if(_sortingEnabled && !drawables.empty())
+        Implementation::radixSortByKey(drawables, scratch.sorted);
+
+    /* Compute transformations of all objects in the group relative to the camera */
+    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects = scratch.objects;
+    objects.clear();
+    objects.reserve(drawables.size());
+    for(const auto& drawable: drawables)
+        objects.push_back(drawable.second->object());
+
+    /* Clean the objects first so their absolute transformations are cached
+       and only the parts of the hierarchy changed since last frame are
+       recomputed */
+    AbstractObject<dimensions, T>::setClean(objects);
+    std::vector<MatrixTypeFor<dimensions, T>>& transformations = scratch.transformations;
+    transformations.resize(objects.size());
+    scene->transformationMatrices(objects, {transformations.data(), transformations.size()}, _cameraMatrix);
+
+    /* Cull drawables having bounding sphere against the view frustum */
+    std::vector<UnsignedByte>& visible = scratch.visible;
+    visible.assign(drawables.size(), 1);
+    if(std::any_of(drawables.begin(), drawables.end(), [](const std::pair<UnsignedLong, Drawable<dimensions, T>*>& drawable) { return drawable.second->hasBoundingSphere(); })) {
+        const std::size_t count = drawables.size();
+        std::vector<T>& spheres = scratch.spheres;
+        spheres.assign(count*(dimensions + 1), T(0));
+        for(std::size_t i = 0; i != count; ++i) {
+            const Drawable<dimensions, T>& drawable = *drawables[i].second;
+
+            /* No bounding sphere, never cull */
+            if(!drawable.hasBoundingSphere()) {
+                spheres[dimensions*count + i] = Math::Constants<T>::inf();
+                continue;
+            }
+
+            /* Transform the center and scale the radius by the largest
+               scaling factor */
+            const VectorTypeFor<dimensions, T> center = transformations[i].transformPoint(drawable.boundingSphereCenter());
+            const auto rotationScaling = transformations[i].rotationScaling();
+            T scalingSquared{0};
+            for(UnsignedInt d = 0; d != dimensions; ++d)
+                scalingSquared = std::max(scalingSquared, rotationScaling[d].dot());
+
+            for(UnsignedInt d = 0; d != dimensions; ++d)
+                spheres[d*count + i] = center[d];
+            spheres[dimensions*count + i] = drawable.boundingSphereRadius()*std::sqrt(scalingSquared);
+        }
+
+        cullBoundingSpheres(spheres, visible);
+    }
 
     /* Perform the drawing */
-    for(std::size_t i = 0; i != transformations.size(); ++i)
-        group[i].draw(transformations[i], *this);
+    if(_drawableDebugGroupsEnabled) {
+        for(std::size_t i = 0; i != transformations.size(); ++i) {
+            if(!visible[i]) continue;
+            DebugGroup drawableGroup{DebugGroup::Source::Application, UnsignedInt(i), drawables[i].second->debugLabel()};
+            drawables[i].second->draw(transformations[i], *this);
+        }
+    } else for(std::size_t i = 0; i != transformations.size(); ++i)
+        if(visible[i]) drawables[i].second->draw(transformations[i], *this);
+
+    /* Give the storage back for next frame */
+    std::swap(scratch, _drawScratch);
 }
 
 }}
@@ -153,7 +153,7 @@ errors. See also @ref compilation-speedup-hpp for more information.
 */
 template<UnsignedInt dimensions, class T> class AbstractFeature
     #ifndef DOXYGEN_GENERATING_OUTPUT
-    : private Containers::LinkedListItem<AbstractFeature<dimensions, T>, AbstractObject<dimensions, T>>
+    : private Containers::LinkedListItem<AbstractFeature<dimensions, T>, AbstractObject<dimensions, T>>, public Implementation::PoolAllocated
     #endif
 {
     friend Containers::LinkedList<AbstractFeature<dimensions, T>>;
@@ -79,7 +79,7 @@ template<UnsignedInt dimensions, class Derived, class T> class AbstractGroupedFe
          * Adds the feature to the object and to group, if specified.
          * @see @ref FeatureGroup::add()
          */
-        explicit AbstractGroupedFeature(AbstractObject<dimensions, T>& object, FeatureGroup<dimensions, Derived, T>* group = nullptr): AbstractFeature<dimensions, T>(object), _group(nullptr) {
+        explicit AbstractGroupedFeature(AbstractObject<dimensions, T>& object, FeatureGroup<dimensions, Derived, T>* group = nullptr): AbstractFeature<dimensions, T>(object), _group(nullptr), _groupIndex{}, _groupKey{} {
             if(group) group->add(static_cast<Derived&>(*this));
         }
 
@@ -103,8 +103,30 @@ template<UnsignedInt dimensions, class Derived, class T> class AbstractGroupedFe
             return _group;
         }
 
+        /**
+         * @brief Group key
+         *
+         * @see @ref setGroupKey()
+         */
+        UnsignedLong groupKey() const { return _groupKey; }
+
+        /**
+         * @brief Set group key
+         *
+         * Arbitrary per-feature value, which is stored also contiguously
+         * in the group and is available through @ref FeatureGroup::keys()
+         * for fast processing of the whole group. Used for example by
+         * @ref Drawable::setSortKey(). Default is `0`.
+         */
+        void setGroupKey(UnsignedLong key) {
+            _groupKey = key;
+            if(_group) _group->AbstractFeatureGroup<dimensions, T>::keys[_groupIndex] = key;
+        }
+
     private:
         FeatureGroup<dimensions, Derived, T>* _group;
+        std::size_t _groupIndex;
+        UnsignedLong _groupKey;
 };
 
 /**
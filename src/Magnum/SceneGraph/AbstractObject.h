@@ -31,9 +31,11 @@
 
 #include <functional>
 #include <vector>
+#include <Corrade/Containers/ArrayReference.h>
 #include <Corrade/Containers/LinkedList.h>
 
 #include "Magnum/DimensionTraits.h"
+#include "Magnum/SceneGraph/ObjectPool.h"
 #include "Magnum/SceneGraph/SceneGraph.h"
 #include "Magnum/SceneGraph/visibility.h"
 
@@ -82,7 +84,7 @@ class documentation or @ref compilation-speedup-hpp for more information.
 */
 template<UnsignedInt dimensions, class T> class AbstractObject
     #ifndef DOXYGEN_GENERATING_OUTPUT
-    : private Containers::LinkedList<AbstractFeature<dimensions, T>>
+    : private Containers::LinkedList<AbstractFeature<dimensions, T>>, public Implementation::PoolAllocated
     #endif
 {
     friend Containers::LinkedList<AbstractFeature<dimensions, T>>;
@@ -187,7 +189,23 @@ template<UnsignedInt dimensions, class T> class AbstractObject
          *      when possible.
          */
         std::vector<MatrixType> transformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& initialTransformationMatrix = MatrixType()) const {
-            return doTransformationMatrices(objects, initialTransformationMatrix);
+            std::vector<MatrixType> transformationMatrices(objects.size());
+            doTransformationMatrices(objects, {transformationMatrices.data(), transformationMatrices.size()}, initialTransformationMatrix);
+            return transformationMatrices;
+        }
+
+        /**
+         * @brief Transformation matrices of given set of objects relative to this object into given array
+         *
+         * Same as above, but the matrices are put into @p out, which is
+         * expected to have the same size as @p objects. Doesn't allocate any
+         * memory in steady state.
+         * @warning This function cannot check if all objects are of the same
+         *      @ref Object type, use typesafe @ref Object::transformationMatrices()
+         *      when possible.
+         */
+        void transformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, Containers::ArrayReference<MatrixType> out, const MatrixType& initialTransformationMatrix = MatrixType()) const {
+            doTransformationMatrices(objects, out, initialTransformationMatrix);
         }
 
         #ifdef MAGNUM_BUILD_DEPRECATED
@@ -291,7 +309,7 @@ template<UnsignedInt dimensions, class T> class AbstractObject
 
         virtual MatrixType doTransformationMatrix() const = 0;
         virtual MatrixType doAbsoluteTransformationMatrix() const = 0;
-        virtual std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& initialTransformationMatrix) const = 0;
+        virtual void doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, Containers::ArrayReference<MatrixType> out, const MatrixType& initialTransformationMatrix) const = 0;
 
         virtual bool doIsDirty() const = 0;
         virtual void doSetDirty() = 0;
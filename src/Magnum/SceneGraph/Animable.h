@@ -29,6 +29,7 @@
  * @brief Class @ref Magnum::SceneGraph::Animable, alias @ref Magnum::SceneGraph::BasicAnimable2D, @ref Magnum::SceneGraph::BasicAnimable3D, typedef @ref Magnum::SceneGraph::Animable2D, @ref Magnum::SceneGraph::Animable3D, enum @ref Magnum::SceneGraph::AnimationState
  */
 
+#include "Magnum/DimensionTraits.h"
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
 #include "Magnum/SceneGraph/visibility.h"
 
@@ -123,6 +124,34 @@ void MyApplication::drawEvent() {
 }
 @endcode
 
+If the timeline has @ref Timeline::setFixedStepDuration() "fixed step duration"
+set, use @ref AnimableGroup::step(const Timeline&) instead. The animations are
+then always advanced in increments of the same duration, independently of the
+framerate.
+
+## Update rate level of detail
+
+With many animated objects, such as a large crowd, stepping all of them each
+frame may be needlessly expensive, as the far away ones don't need to be
+updated as often and the ones outside of the view don't need to be updated
+at all. Set @ref AnimableGroup::setUpdateIntervals() and pass the camera to
+@ref AnimableGroup::step(Float, Float, AbstractCamera<dimensions, T>&).
+Each running animable then gets an @ref updateInterval() based on its
+distance from the camera and @ref animationStep() is called only after at
+least that much time passed since its previous step. Animables with
+@ref setBoundingSphere() "bounding sphere" outside of the camera frustum use
+@ref AnimableGroup::setCulledUpdateInterval(), which by default pauses them
+until they get visible again. The time delta passed to @ref animationStep()
+is the whole time since the previous step, so animations integrating the
+delta don't slow down.
+@code
+SceneGraph::AnimableGroup3D crowd;
+crowd.setUpdateIntervals({{20.0f, 1.0f/30.0f}, {50.0f, 1.0f/10.0f}});
+
+// each frame
+crowd.step(timeline.previousFrameTime(), timeline.previousFrameDuration(), camera);
+@endcode
+
 ## Using multiple animable groups to improve performance
 
 @ref AnimableGroup is optimized for case when no animation is running -- it
@@ -220,6 +249,60 @@ template<UnsignedInt dimensions, class T> class Animable: public AbstractGrouped
             return *this;
         }
 
+        /**
+         * @brief Whether the animable has a bounding sphere
+         *
+         * @see @ref setBoundingSphere()
+         */
+        bool hasBoundingSphere() const { return _boundingSphereRadius >= T(0); }
+
+        /**
+         * @brief Bounding sphere center
+         *
+         * In object-local coordinates.
+         * @see @ref hasBoundingSphere()
+         */
+        VectorTypeFor<dimensions, T> boundingSphereCenter() const { return _boundingSphereCenter; }
+
+        /**
+         * @brief Bounding sphere radius
+         *
+         * If the animable doesn't have a bounding sphere, returns negative
+         * value.
+         * @see @ref hasBoundingSphere()
+         */
+        T boundingSphereRadius() const { return _boundingSphereRadius; }
+
+        /**
+         * @brief Set bounding sphere
+         * @param center    Center in object-local coordinates
+         * @param radius    Radius
+         * @return Reference to self (for method chaining)
+         *
+         * Used by @ref AnimableGroup::step(Float, Float, AbstractCamera<dimensions, T>&)
+         * to cull the animable against view frustum and to measure its
+         * distance from the camera. Passing negative radius removes the
+         * bounding sphere. By default the animable has no bounding sphere,
+         * is never culled and distance of its object origin is used.
+         */
+        Animable<dimensions, T>& setBoundingSphere(const VectorTypeFor<dimensions, T>& center, T radius) {
+            _boundingSphereCenter = center;
+            _boundingSphereRadius = radius;
+            return *this;
+        }
+
+        /**
+         * @brief Update interval
+         *
+         * Minimal time between two @ref animationStep() calls, selected in
+         * last @ref AnimableGroup::step(Float, Float, AbstractCamera<dimensions, T>&).
+         * `0.0f` means the animation is stepped each time, infinity that it
+         * is paused until it gets visible again.
+         * @see @ref AnimableGroup::setUpdateIntervals(),
+         *      @ref AnimableGroup::setCulledUpdateInterval()
+         */
+        Float updateInterval() const { return _updateInterval; }
+
         /**
          * @brief Group containing this animable
          *
@@ -261,7 +344,7 @@ template<UnsignedInt dimensions, class T> class Animable: public AbstractGrouped
         /**
          * @brief Perform animation step
          * @param time      Time from start of the animation
-         * @param delta     Time delta for current frame
+         * @param delta     Time delta since previous step
          *
          * This function is periodically called from @ref AnimableGroup::step()
          * if the animation state is set to @ref AnimationState::Running. After
@@ -273,6 +356,11 @@ template<UnsignedInt dimensions, class T> class Animable: public AbstractGrouped
          * was paused. If the animation is resumed from @ref AnimationState::Stopped,
          * @p time starts with zero.
          *
+         * If the group does update rate level of detail, the step may be
+         * called less often than each frame and @p delta is then the time
+         * since the previous step, see class documentation for more
+         * information.
+         *
          * @see @ref state(), @ref duration(), @ref isRepeated(),
          *      @ref repeatCount()
          */
@@ -337,6 +425,9 @@ template<UnsignedInt dimensions, class T> class Animable: public AbstractGrouped
         bool _repeated;
         UnsignedShort _repeatCount;
         UnsignedShort repeats;
+        VectorTypeFor<dimensions, T> _boundingSphereCenter;
+        T _boundingSphereRadius;
+        Float _updateInterval, accumulatedDelta;
 };
 
 /**
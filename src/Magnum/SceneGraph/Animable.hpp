@@ -29,14 +29,19 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Animable.h and @ref AnimableGroup.h
  */
 
+#include <algorithm>
+#include <cmath>
+
 #include "Magnum/Timeline.h"
 #include "Magnum/Math/Constants.h"
+#include "Magnum/SceneGraph/AbstractCamera.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
 #include "Magnum/SceneGraph/AnimableGroup.h"
 #include "Magnum/SceneGraph/Animable.h"
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>(object, group), _duration(0.0f), startTime(Constants::inf()), pauseTime(-Constants::inf()), previousState(AnimationState::Stopped), currentState(AnimationState::Stopped), _repeated(false), _repeatCount(0), repeats(0) {}
+template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>(object, group), _duration(0.0f), startTime(Constants::inf()), pauseTime(-Constants::inf()), previousState(AnimationState::Stopped), currentState(AnimationState::Stopped), _repeated(false), _repeatCount(0), repeats(0), _boundingSphereRadius(-1), _updateInterval(0.0f), accumulatedDelta(0.0f) {}
 
 template<UnsignedInt dimensions, class T> Animable<dimensions, T>::~Animable() {}
 
@@ -61,7 +66,115 @@ template<UnsignedInt dimensions, class T> const AnimableGroup<dimensions, T>* An
     return static_cast<const AnimableGroup<dimensions, T>*>(AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>::group());
 }
 
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>::AnimableGroup(): _runningCount(0), wakeUp(false), _culledUpdateInterval(Constants::inf()) {}
+
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>& AnimableGroup<dimensions, T>::setUpdateIntervals(std::vector<std::pair<T, Float>> intervals) {
+    CORRADE_ASSERT(std::is_sorted(intervals.begin(), intervals.end(), [](const std::pair<T, Float>& a, const std::pair<T, Float>& b) { return a.first < b.first; }),
+        "SceneGraph::AnimableGroup::setUpdateIntervals(): the distances are not in ascending order", *this);
+    _updateIntervals = std::move(intervals);
+    return *this;
+}
+
 template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::step(const Float time, const Float delta) {
+    stepInternal(time, delta, false);
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::step(const Float time, const Float delta, AbstractCamera<dimensions, T>& camera) {
+    if(!_runningCount && !wakeUp) return;
+
+    AbstractObject<dimensions, T>* scene = camera.object().scene();
+    CORRADE_ASSERT(scene, "SceneGraph::AnimableGroup::step(): camera is not part of any scene", );
+
+    /* Only running animations (including those started or resumed since
+       the last step) need the update interval */
+    LodScratch& scratch = _lodScratch;
+    std::vector<Animable<dimensions, T>*>& animables = scratch.animables;
+    animables.clear();
+    for(std::size_t i = 0; i != AnimableGroup<dimensions, T>::size(); ++i) {
+        Animable<dimensions, T>& animable = (*this)[i];
+        if(animable.currentState == AnimationState::Running)
+            animables.push_back(&animable);
+    }
+
+    if(!animables.empty()) {
+        /* Compute transformations of all running animables relative to the
+           camera in one batch */
+        std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects = scratch.objects;
+        objects.clear();
+        objects.reserve(animables.size());
+        for(Animable<dimensions, T>* animable: animables)
+            objects.push_back(animable->object());
+
+        AbstractObject<dimensions, T>::setClean(objects);
+        std::vector<MatrixTypeFor<dimensions, T>>& transformations = scratch.transformations;
+        transformations.resize(objects.size());
+        scene->transformationMatrices(objects, {transformations.data(), transformations.size()}, camera.cameraMatrix());
+
+        /* Bounding spheres in camera space, laid out the same way as for
+           drawable culling. Animables without bounding sphere have infinite
+           radius so they are never culled, their distance is measured to
+           the object origin. */
+        const std::size_t count = animables.size();
+        std::vector<T>& spheres = scratch.spheres;
+        spheres.assign(count*(dimensions + 1), T(0));
+        bool cull = false;
+        for(std::size_t i = 0; i != count; ++i) {
+            const Animable<dimensions, T>& animable = *animables[i];
+
+            if(!animable.hasBoundingSphere()) {
+                const VectorTypeFor<dimensions, T> center = transformations[i].translation();
+                for(UnsignedInt d = 0; d != dimensions; ++d)
+                    spheres[d*count + i] = center[d];
+                spheres[dimensions*count + i] = Math::Constants<T>::inf();
+                continue;
+            }
+
+            /* Transform the center and scale the radius by the largest
+               scaling factor */
+            const VectorTypeFor<dimensions, T> center = transformations[i].transformPoint(animable.boundingSphereCenter());
+            const auto rotationScaling = transformations[i].rotationScaling();
+            T scalingSquared{0};
+            for(UnsignedInt d = 0; d != dimensions; ++d)
+                scalingSquared = std::max(scalingSquared, rotationScaling[d].dot());
+
+            for(UnsignedInt d = 0; d != dimensions; ++d)
+                spheres[d*count + i] = center[d];
+            spheres[dimensions*count + i] = animable.boundingSphereRadius()*std::sqrt(scalingSquared);
+            cull = true;
+        }
+
+        std::vector<UnsignedByte>& visible = scratch.visible;
+        visible.assign(count, 1);
+        if(cull) camera.cullBoundingSpheres(spheres, visible);
+
+        /* Select the interval by distance of the nearest point of the
+           sphere */
+        for(std::size_t i = 0; i != count; ++i) {
+            if(!visible[i]) {
+                animables[i]->_updateInterval = _culledUpdateInterval;
+                continue;
+            }
+
+            T distanceSquared{0};
+            for(UnsignedInt d = 0; d != dimensions; ++d)
+                distanceSquared += spheres[d*count + i]*spheres[d*count + i];
+            T distance = std::sqrt(distanceSquared);
+            if(animables[i]->hasBoundingSphere())
+                distance -= spheres[dimensions*count + i];
+
+            Float interval = 0.0f;
+            for(const std::pair<T, Float>& level: _updateIntervals) {
+                if(distance < level.first) break;
+                interval = level.second;
+            }
+            animables[i]->_updateInterval = interval;
+        }
+    }
+
+    stepInternal(time, delta, true);
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::stepInternal(const Float time, const Float delta, const bool lod) {
     if(!_runningCount && !wakeUp) return;
     wakeUp = false;
 
@@ -96,6 +209,7 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
             animable.previousState = AnimationState::Running;
             animable.startTime = time;
             animable.repeats = 0;
+            animable.accumulatedDelta = 0.0f;
             ++_runningCount;
             animable.animationStarted();
 
@@ -103,6 +217,7 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
         } else if(animable.previousState == AnimationState::Paused) {
             animable.previousState = AnimationState::Running;
             animable.startTime += time - animable.pauseTime;
+            animable.accumulatedDelta = 0.0f;
             ++_runningCount;
             animable.animationResumed();
         }
@@ -130,12 +245,31 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
             "SceneGraph::AnimableGroup::step(): animation was started in future - probably wrong time passed", );
         CORRADE_ASSERT(delta >= 0.0f,
             "SceneGraph::AnimableGroup::step(): negative delta passed", );
-        animable.animationStep(time - animable.startTime, delta);
+
+        /* Skip the step if the update interval didn't pass yet, the time is
+           passed to the next step */
+        animable.accumulatedDelta += delta;
+        if(lod && animable.accumulatedDelta < animable._updateInterval)
+            continue;
+
+        animable.animationStep(time - animable.startTime, animable.accumulatedDelta);
+        animable.accumulatedDelta = 0.0f;
     }
 
     CORRADE_INTERNAL_ASSERT((_runningCount <= AnimableGroup<dimensions, T>::size()));
 }
 
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::fixedStep(const Float time, const Float stepDuration, const UnsignedInt count) {
+    for(UnsignedInt i = 0; i != count; ++i)
+        step(time - (count - i - 1)*stepDuration, stepDuration);
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::step(const Timeline& timeline) {
+    if(timeline.fixedStepDuration())
+        fixedStep(timeline.fixedStepTime(), timeline.fixedStepDuration(), timeline.fixedStepCount());
+    else step(timeline.previousFrameTime(), timeline.previousFrameDuration());
+}
+
 }}
 
 #endif
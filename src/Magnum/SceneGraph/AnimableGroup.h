@@ -29,6 +29,11 @@
  * @brief Class @ref Magnum::SceneGraph::AnimableGroup, alias @ref Magnum::SceneGraph::BasicAnimableGroup2D, @ref Magnum::SceneGraph::BasicAnimableGroup3D, typedef @ref Magnum::SceneGraph::AnimableGroup2D, @ref Magnum::SceneGraph::AnimableGroup3D
  */
 
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "Magnum/DimensionTraits.h"
 #include "Magnum/SceneGraph/FeatureGroup.h"
 #include "Magnum/SceneGraph/visibility.h"
 
@@ -48,7 +53,7 @@ template<UnsignedInt dimensions, class T> class AnimableGroup: public FeatureGro
         /**
          * @brief Constructor
          */
-        explicit AnimableGroup(): _runningCount(0), wakeUp(false) {}
+        explicit AnimableGroup();
 
         /**
          * @brief Count of running animations
@@ -57,19 +62,122 @@ template<UnsignedInt dimensions, class T> class AnimableGroup: public FeatureGro
          */
         std::size_t runningCount() const { return _runningCount; }
 
+        /**
+         * @brief Update intervals
+         *
+         * @see @ref setUpdateIntervals()
+         */
+        const std::vector<std::pair<T, Float>>& updateIntervals() const { return _updateIntervals; }
+
+        /**
+         * @brief Set update intervals
+         * @param intervals Pairs of distance from the camera and minimal
+         *      time between two animation steps for animables farther than
+         *      that distance
+         * @return Reference to self (for method chaining)
+         *
+         * Used by @ref step(Float, Float, AbstractCamera<dimensions, T>&).
+         * Animables closer than the first distance are stepped each time.
+         * Expects that the distances are in ascending order. Default is no
+         * intervals, i.e. all visible animables are stepped each time.
+         */
+        AnimableGroup<dimensions, T>& setUpdateIntervals(std::vector<std::pair<T, Float>> intervals);
+
+        /** @brief Update interval of culled animables */
+        Float culledUpdateInterval() const { return _culledUpdateInterval; }
+
+        /**
+         * @brief Set update interval of culled animables
+         * @return Reference to self (for method chaining)
+         *
+         * Minimal time between two animation steps for animables with
+         * bounding sphere outside of the camera frustum. Default is infinity,
+         * i.e. such animables are not stepped until they get visible again.
+         * @see @ref Animable::setBoundingSphere()
+         */
+        AnimableGroup<dimensions, T>& setCulledUpdateInterval(Float interval) {
+            _culledUpdateInterval = interval;
+            return *this;
+        }
+
         /**
          * @brief Perform animation step
          * @param time      Absolute time (e.g. @ref Timeline::previousFrameTime())
          * @param delta     Time delta for current frame (e.g. @ref Timeline::previousFrameDuration())
          *
          * If there are no running animations the function does nothing.
-         * @see @ref runningCount()
+         * Each running animation is stepped regardless of
+         * @ref Animable::updateInterval(), including the time not yet passed
+         * to it by a previous level of detail step.
+         * @see @ref runningCount(), @ref fixedStep()
          */
         void step(Float time, Float delta);
 
+        /**
+         * @brief Perform animation step with update rate level of detail
+         * @param time      Absolute time (e.g. @ref Timeline::previousFrameTime())
+         * @param delta     Time delta for current frame (e.g. @ref Timeline::previousFrameDuration())
+         * @param camera    Camera from which the distance and visibility is
+         *      computed
+         *
+         * Selects @ref Animable::updateInterval() of all running animables
+         * based on their distance from @p camera and visibility in its
+         * frustum, see @ref setUpdateIntervals() and
+         * @ref setCulledUpdateInterval(). An animable is then stepped only
+         * if at least its update interval passed since its previous step,
+         * with delta being all the time since. The transformations are
+         * computed in a single batch and storage for them is reused across
+         * calls. If there are no running animations the function does
+         * nothing.
+         * @see @ref Animable::setBoundingSphere()
+         */
+        void step(Float time, Float delta, AbstractCamera<dimensions, T>& camera);
+
+        /**
+         * @brief Perform fixed animation steps
+         * @param time          Absolute time of the last step (e.g.
+         *      @ref Timeline::fixedStepTime())
+         * @param stepDuration  Duration of one step (e.g.
+         *      @ref Timeline::fixedStepDuration())
+         * @param count         Count of steps (e.g.
+         *      @ref Timeline::fixedStepCount())
+         *
+         * Calls @ref step() @p count times with the same @p stepDuration
+         * delta, so the animations are advanced in the same increments
+         * regardless of the framerate. If @p count is `0`, the function does
+         * nothing.
+         */
+        void fixedStep(Float time, Float stepDuration, UnsignedInt count);
+
+        /**
+         * @brief Perform animation step for given timeline
+         *
+         * If @ref Timeline::fixedStepDuration() is set, calls @ref fixedStep()
+         * with @ref Timeline::fixedStepTime(),
+         * @ref Timeline::fixedStepDuration() and
+         * @ref Timeline::fixedStepCount(), otherwise calls @ref step() with
+         * @ref Timeline::previousFrameTime() and
+         * @ref Timeline::previousFrameDuration().
+         */
+        void step(const Timeline& timeline);
+
     private:
+        /* Temporary storage for step() with a camera, reused across calls */
+        struct LodScratch {
+            std::vector<Animable<dimensions, T>*> animables;
+            std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
+            std::vector<MatrixTypeFor<dimensions, T>> transformations;
+            std::vector<T> spheres;
+            std::vector<UnsignedByte> visible;
+        };
+
+        void stepInternal(Float time, Float delta, bool lod);
+
         std::size_t _runningCount;
         bool wakeUp;
+        std::vector<std::pair<T, Float>> _updateIntervals;
+        Float _culledUpdateInterval;
+        LodScratch _lodScratch;
 };
 
 /**
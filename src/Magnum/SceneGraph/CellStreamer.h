@@ -0,0 +1,405 @@
+#ifndef Magnum_SceneGraph_CellStreamer_h
+#define Magnum_SceneGraph_CellStreamer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::CellStreamer, enum @ref Magnum::SceneGraph::CellState
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Resource.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/SceneGraph/Object.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Cell state
+
+@see @ref CellStreamer::cellState()
+*/
+enum class CellState: UnsignedByte {
+    /** The cell is too far, its data are not requested. */
+    Unloaded,
+
+    /** The cell data are requested, but not yet loaded. */
+    Loading,
+
+    /** The cell data were not found. */
+    NotFound,
+
+    /**
+     * The cell data are loaded and the cell is being instantiated into the
+     * scene.
+     */
+    Instantiating,
+
+    /** The cell is fully instantiated. */
+    Instantiated
+};
+
+/** @debugoperatorenum{Magnum::SceneGraph::CellState} */
+Debug MAGNUM_SCENEGRAPH_EXPORT operator<<(Debug debug, CellState value);
+
+/**
+@brief Streaming of scene content partitioned into cells
+
+Manages content of a large world split into cells, each with its own bounds
+and @ref ResourceKey "resource key" of type @p Data (e.g. a list of meshes,
+textures and their transformations). Cells near the viewer are requested from
+a @ref ResourceManager, instantiated into the scene after the data arrive and
+deleted again after the viewer moves away:
+@code
+class TerrainStreamer: public SceneGraph::CellStreamer<SceneGraph::MatrixTransformation3D, TerrainCell> {
+    public:
+        using CellStreamer::CellStreamer;
+
+    private:
+        bool doInstantiate(std::size_t, TerrainCell& data, Object3D& object, std::size_t step) override {
+            // Create one object with a drawable per step, return true after
+            // the last one
+            const TerrainCell::Instance& instance = data.instances[step];
+            (new Object3D{&object})->setTransformation(instance.transformation);
+            // ...
+            return step + 1 == data.instances.size();
+        }
+};
+
+TerrainStreamer streamer{manager, scene};
+streamer.setDistances(200.0f, 250.0f)
+    .setInstantiationBudget(std::chrono::milliseconds{2});
+for(Int x = 0; x != 64; ++x) for(Int z = 0; z != 64; ++z)
+    streamer.addCell({{x*100.0f, -50.0f, z*100.0f}, {(x + 1)*100.0f, 50.0f, (z + 1)*100.0f}},
+        "terrain/" + std::to_string(x) + "-" + std::to_string(z) + ".cell");
+
+// In each frame
+loader.update(4);
+streamer.update(cameraObject.absoluteTransformation().translation());
+@endcode
+
+## Loading
+
+In each @ref update(), every unloaded cell which is nearer to the viewer than
+@ref loadDistance() is requested using @ref ResourceManager::get(). With an
+@ref AbstractAsyncResourceLoader the file IO and decoding happens on worker
+threads and the GPU upload in @ref AbstractAsyncResourceLoader::update(),
+which delivers only given count of resources per call, so neither of them
+stalls the frame. Cells which are farther from the viewer than
+@ref unloadDistance() are deleted from the scene and their resource
+references are released. With @ref ResourcePolicy::ReferenceCounted the data
+are freed right after, otherwise they are subject to the usual eviction
+rules of the manager, see @ref ResourceManager::setMemoryBudget(). The
+unload distance is expected to be larger than the load distance, so cells on
+the boundary aren't repeatedly loaded and unloaded as the viewer moves back
+and forth.
+
+## Instantiation
+
+After the data of a cell are loaded, an empty object for the cell is created
+under the parent object passed in the constructor and @ref doInstantiate() is
+called repeatedly with increasing step index until it returns `true`. Each
+@ref update() calls it until @ref instantiationBudget() is spent, but at least
+once, so the cost of populating the scene is spread across frames instead of
+causing a hitch. Cells nearest to the viewer are instantiated first. The cell
+object and all its children are deleted when the cell is unloaded, after
+calling @ref doUnload().
+
+The distance of a cell is distance of the nearest point of its bounds, so
+the viewer being inside a cell means zero distance. Every @ref update() tests
+all cells, which is negligible even for thousands of cells.
+
+The parent object is expected to outlive the streamer.
+*/
+template<class Transformation, class Data> class CellStreamer {
+    public:
+        /** @brief Vector type */
+        typedef VectorTypeFor<Transformation::Dimensions, typename Transformation::Type> VectorType;
+
+        /** @brief Range type */
+        typedef RangeTypeFor<Transformation::Dimensions, typename Transformation::Type> RangeType;
+
+        /**
+         * @brief Constructor
+         * @param manager   Resource manager providing cell data
+         * @param parent    Parent object for instantiated cells
+         */
+        template<class ...Types> explicit CellStreamer(ResourceManager<Types...>& manager, Object<Transformation>& parent);
+
+        /** @brief Copying is not allowed */
+        CellStreamer(const CellStreamer<Transformation, Data>&) = delete;
+
+        /** @brief Moving is not allowed */
+        CellStreamer(CellStreamer<Transformation, Data>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Deletes objects of all instantiated cells and releases all
+         * resource references.
+         */
+        virtual ~CellStreamer();
+
+        /** @brief Copying is not allowed */
+        CellStreamer<Transformation, Data>& operator=(const CellStreamer<Transformation, Data>&) = delete;
+
+        /** @brief Moving is not allowed */
+        CellStreamer<Transformation, Data>& operator=(CellStreamer<Transformation, Data>&&) = delete;
+
+        /**
+         * @brief Add cell
+         * @param bounds    Cell bounds in coordinate system of the parent
+         *      object
+         * @param key       Resource key of cell data
+         * @return Cell ID
+         *
+         * The cell is loaded on next @ref update() if it is near enough.
+         */
+        std::size_t addCell(const RangeType& bounds, ResourceKey key);
+
+        /** @brief Cell count */
+        std::size_t cellCount() const { return _cells.size(); }
+
+        /** @brief Cell bounds */
+        RangeType cellBounds(std::size_t id) const { return _cells[id].bounds; }
+
+        /** @brief Cell resource key */
+        ResourceKey cellKey(std::size_t id) const { return _cells[id].key; }
+
+        /** @brief Cell state */
+        CellState cellState(std::size_t id) const { return _cells[id].state; }
+
+        /**
+         * @brief Cell object
+         *
+         * Returns `nullptr` if the cell is not in
+         * @ref CellState::Instantiating or @ref CellState::Instantiated
+         * state.
+         */
+        Object<Transformation>* cellObject(std::size_t id) { return _cells[id].object; }
+
+        /** @brief Count of cells in given state */
+        std::size_t cellCount(CellState state) const;
+
+        /** @brief Load distance */
+        typename Transformation::Type loadDistance() const { return _loadDistance; }
+
+        /** @brief Unload distance */
+        typename Transformation::Type unloadDistance() const { return _unloadDistance; }
+
+        /**
+         * @brief Set load and unload distance
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p unload is not smaller than @p load. Default is
+         * `1` for both.
+         */
+        CellStreamer<Transformation, Data>& setDistances(typename Transformation::Type load, typename Transformation::Type unload);
+
+        /** @brief Instantiation time budget per update */
+        std::chrono::nanoseconds instantiationBudget() const { return _instantiationBudget; }
+
+        /**
+         * @brief Set instantiation time budget per update
+         * @return Reference to self (for method chaining)
+         *
+         * Default is 2 milliseconds. With zero budget exactly one
+         * @ref doInstantiate() step is done in each @ref update() if there
+         * is any cell to instantiate.
+         */
+        CellStreamer<Transformation, Data>& setInstantiationBudget(std::chrono::nanoseconds budget) {
+            _instantiationBudget = budget;
+            return *this;
+        }
+
+        /**
+         * @brief Update the cells
+         * @param position  Viewer position in coordinate system of the parent
+         *      object
+         *
+         * Requests cells near the viewer, unloads far cells and instantiates
+         * loaded cells until the time budget is spent. See class
+         * documentation for more information.
+         */
+        void update(const VectorType& position);
+
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    private:
+    #else
+    protected:
+    #endif
+        /**
+         * @brief Instantiate cell
+         * @param id        Cell ID
+         * @param data      Cell data
+         * @param object    Cell object
+         * @param step      Step index, starting from `0`
+         * @return Whether the cell is fully instantiated
+         *
+         * Called repeatedly from @ref update(), see class documentation for
+         * more information. The implementation is expected to do a small
+         * part of the work in each step, e.g. create one child object.
+         */
+        virtual bool doInstantiate(std::size_t id, Data& data, Object<Transformation>& object, std::size_t step) = 0;
+
+        /**
+         * @brief Unload cell
+         * @param id        Cell ID
+         * @param object    Cell object
+         *
+         * Called before the object of an instantiated or partially
+         * instantiated cell is deleted, e.g. to remove its features from
+         * external structures. Default implementation does nothing.
+         */
+        virtual void doUnload(std::size_t id, Object<Transformation>& object);
+
+    private:
+        struct Cell {
+            RangeType bounds;
+            ResourceKey key;
+            Resource<Data> resource;
+            Object<Transformation>* object;
+            std::size_t step;
+            typename Transformation::Type distanceSquared;
+            CellState state;
+        };
+
+        void unload(std::size_t id);
+
+        std::function<Resource<Data>(ResourceKey)> _get;
+        Object<Transformation>& _parent;
+        std::vector<Cell> _cells;
+        std::vector<std::size_t> _instantiating;
+        typename Transformation::Type _loadDistance, _unloadDistance;
+        std::chrono::nanoseconds _instantiationBudget;
+};
+
+template<class Transformation, class Data> template<class ...Types> CellStreamer<Transformation, Data>::CellStreamer(ResourceManager<Types...>& manager, Object<Transformation>& parent): _get{[&manager](ResourceKey key) { return manager.template get<Data>(key); }}, _parent(parent), _loadDistance{1}, _unloadDistance{1}, _instantiationBudget{std::chrono::milliseconds{2}} {}
+
+template<class Transformation, class Data> CellStreamer<Transformation, Data>::~CellStreamer() {
+    /* Not calling doUnload(), as the subclass is already destroyed */
+    for(Cell& cell: _cells) delete cell.object;
+}
+
+template<class Transformation, class Data> std::size_t CellStreamer<Transformation, Data>::addCell(const RangeType& bounds, const ResourceKey key) {
+    /* The resource is requested only when the cell gets near */
+    _cells.push_back(Cell{bounds, key, Resource<Data>{}, nullptr, 0, {}, CellState::Unloaded});
+    return _cells.size() - 1;
+}
+
+template<class Transformation, class Data> std::size_t CellStreamer<Transformation, Data>::cellCount(const CellState state) const {
+    return std::count_if(_cells.begin(), _cells.end(), [state](const Cell& cell) { return cell.state == state; });
+}
+
+template<class Transformation, class Data> CellStreamer<Transformation, Data>& CellStreamer<Transformation, Data>::setDistances(const typename Transformation::Type load, const typename Transformation::Type unload) {
+    CORRADE_ASSERT(load <= unload,
+        "SceneGraph::CellStreamer::setDistances(): unload distance" << unload << "is smaller than load distance" << load, *this);
+    _loadDistance = load;
+    _unloadDistance = unload;
+    return *this;
+}
+
+template<class Transformation, class Data> void CellStreamer<Transformation, Data>::doUnload(std::size_t, Object<Transformation>&) {}
+
+template<class Transformation, class Data> void CellStreamer<Transformation, Data>::unload(const std::size_t id) {
+    Cell& cell = _cells[id];
+    if(cell.object) {
+        doUnload(id, *cell.object);
+        delete cell.object;
+        cell.object = nullptr;
+    }
+
+    cell.resource = Resource<Data>{};
+    cell.state = CellState::Unloaded;
+}
+
+template<class Transformation, class Data> void CellStreamer<Transformation, Data>::update(const VectorType& position) {
+    const typename Transformation::Type loadDistanceSquared = _loadDistance*_loadDistance;
+    const typename Transformation::Type unloadDistanceSquared = _unloadDistance*_unloadDistance;
+
+    _instantiating.clear();
+    for(std::size_t i = 0; i != _cells.size(); ++i) {
+        Cell& cell = _cells[i];
+
+        /* Distance of the nearest point of the cell */
+        const VectorType nearest = Math::max(Math::min(position, cell.bounds.max()), cell.bounds.min());
+        cell.distanceSquared = (nearest - position).dot();
+
+        /* Request near cells, unload far ones */
+        if(cell.state == CellState::Unloaded) {
+            if(cell.distanceSquared > loadDistanceSquared) continue;
+            cell.resource = _get(cell.key);
+            cell.state = CellState::Loading;
+        } else if(cell.distanceSquared > unloadDistanceSquared) {
+            unload(i);
+            continue;
+        }
+
+        /* Check whether the data arrived */
+        if(cell.state == CellState::Loading) {
+            const ResourceState state = cell.resource.state();
+            if(state == ResourceState::NotFound || state == ResourceState::NotFoundFallback)
+                cell.state = CellState::NotFound;
+            else if(state == ResourceState::Mutable || state == ResourceState::Final) {
+                cell.object = new Object<Transformation>{&_parent};
+                cell.step = 0;
+                cell.state = CellState::Instantiating;
+            }
+        }
+
+        if(cell.state == CellState::Instantiating) _instantiating.push_back(i);
+    }
+
+    if(_instantiating.empty()) return;
+
+    /* Nearest cells first */
+    std::sort(_instantiating.begin(), _instantiating.end(), [this](std::size_t a, std::size_t b) {
+        return _cells[a].distanceSquared < _cells[b].distanceSquared;
+    });
+
+    /* Instantiate until the budget is spent, but do at least one step so
+       the streaming always progresses */
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(const std::size_t id: _instantiating) {
+        Cell& cell = _cells[id];
+        for(;;) {
+            const bool done = doInstantiate(id, *cell.resource, *cell.object, cell.step++);
+            if(done) cell.state = CellState::Instantiated;
+            if(std::chrono::steady_clock::now() - start >= _instantiationBudget) return;
+            if(done) break;
+        }
+    }
+}
+
+}}
+
+#endif
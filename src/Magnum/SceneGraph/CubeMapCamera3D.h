@@ -0,0 +1,176 @@
+#ifndef Magnum_SceneGraph_CubeMapCamera3D_h
+#define Magnum_SceneGraph_CubeMapCamera3D_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BasicCubeMapCamera3D, typedef @ref Magnum::SceneGraph::CubeMapCamera3D
+ */
+
+#include <Corrade/Containers/ArrayReference.h>
+
+#include "Magnum/SceneGraph/AbstractCamera.h"
+
+#ifdef CORRADE_TARGET_WINDOWS /* I so HATE windef.h */
+#undef near
+#undef far
+#endif
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Camera rendering all six faces of a cube map
+
+Meant for updating dynamic reflection probes. Instead of drawing the scene six
+times with a camera rotated towards each face, the drawables are sorted,
+culled and have their transformations computed only once and each visible
+drawable is drawn once. Drawables with a bounding sphere are culled against
+the union of all six face frustums, which is a cube with half-size equal to
+@ref far() centered at the camera.
+
+The transformation matrix passed to @ref Drawable::draw() is relative to the
+camera object. The drawable is expected to render six instances of the mesh,
+with the instance ID selecting the face matrix and the output layer, for
+example using @ref Shaders::Flat::Flag::CubeMap together with a layered
+framebuffer attachment. The faces are in the same order as
+@ref CubeMapTexture::Coordinate.
+@code
+CubeMapTexture probe;
+probe.setStorage(1, TextureFormat::RGBA8, Vector2i{256});
+Framebuffer framebuffer{{{}, Vector2i{256}}};
+framebuffer.attachLayeredTexture(Framebuffer::ColorAttachment(0), probe, 0);
+
+SceneGraph::CubeMapCamera3D camera{probeObject};
+camera.setClippingPlanes(0.1f, 100.0f);
+
+void MyDrawable::draw(const Matrix4& transformationMatrix, SceneGraph::AbstractCamera3D& abstractCamera) {
+    auto& camera = static_cast<SceneGraph::CubeMapCamera3D&>(abstractCamera);
+    shader.setTransformationProjectionMatrix(transformationMatrix)
+        .setViewProjectionMatrices(camera.faceViewProjectionMatrices());
+    mesh.setInstanceCount(6)
+        .draw(shader);
+}
+@endcode
+
+@anchor SceneGraph-CubeMapCamera3D-explicit-specializations
+## Explicit template specializations
+
+The following specialization is explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref CubeMapCamera3D.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref CubeMapCamera3D
+
+@see @ref scenegraph, @ref CubeMapCamera3D, @ref BasicStereoCamera3D,
+    @ref Drawable, @ref DrawableGroup
+*/
+template<class T> class BasicCubeMapCamera3D: public AbstractBasicCamera3D<T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object holding this feature
+         *
+         * Clipping planes are set to `0.01` and `100`.
+         */
+        explicit BasicCubeMapCamera3D(AbstractBasicObject3D<T>& object);
+
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        /* This is here to avoid ambiguity with deleted copy constructor when
+           passing `*this` from class subclassing both BasicCubeMapCamera3D
+           and AbstractObject */
+        template<class U, class = typename std::enable_if<std::is_base_of<AbstractBasicObject3D<T>, U>::value>::type> BasicCubeMapCamera3D(U& object): BasicCubeMapCamera3D(static_cast<AbstractBasicObject3D<T>&>(object)) {}
+        #endif
+
+        /**
+         * @brief Set clipping planes
+         * @param near          Near clipping plane
+         * @param far           Far clipping plane
+         * @return Reference to self (for method chaining)
+         *
+         * The projection of each face is a square perspective projection
+         * with 90° field of view.
+         * @see @ref Matrix4::perspectiveProjection()
+         */
+        BasicCubeMapCamera3D<T>& setClippingPlanes(T near, T far);
+
+        /** @brief Near clipping plane */
+        T near() const { return _near; }
+
+        /** @brief Far clipping plane */
+        T far() const { return _far; }
+
+        /**
+         * @brief Face matrix
+         *
+         * Rotates from camera space to space of given face, with faces in
+         * order @f$ +X @f$, @f$ -X @f$, @f$ +Y @f$, @f$ -Y @f$, @f$ +Z @f$,
+         * @f$ -Z @f$ and orientation following the cube map conventions.
+         * Expects that @p face is less than `6`.
+         */
+        Math::Matrix4<T> faceMatrix(UnsignedInt face) const;
+
+        /**
+         * @brief View projection matrix of given face
+         *
+         * @ref projectionMatrix() multiplied with @ref faceMatrix(). Expects
+         * that @p face is less than `6`.
+         */
+        Math::Matrix4<T> faceViewProjectionMatrix(UnsignedInt face) const;
+
+        /**
+         * @brief View projection matrices of all faces
+         *
+         * Meant to be passed directly to a shader rendering all faces at
+         * once.
+         * @see @ref faceViewProjectionMatrix()
+         */
+        Containers::ArrayReference<const Math::Matrix4<T>> faceViewProjectionMatrices() const {
+            return _faceViewProjections;
+        }
+
+    protected:
+        /** Culls against union of all face frustums */
+        void cullBoundingSpheres(const std::vector<T>& spheres, std::vector<UnsignedByte>& visible) override;
+
+    private:
+        T _near, _far;
+        Math::Matrix4<T> _faceViewProjections[6];
+};
+
+/**
+@brief Cube map camera for three-dimensional float scenes
+
+@see @ref StereoCamera3D
+*/
+typedef BasicCubeMapCamera3D<Float> CubeMapCamera3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT BasicCubeMapCamera3D<Float>;
+#endif
+
+}}
+
+#endif
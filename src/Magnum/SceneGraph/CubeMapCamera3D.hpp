@@ -0,0 +1,94 @@
+#ifndef Magnum_SceneGraph_CubeMapCamera3D_hpp
+#define Magnum_SceneGraph_CubeMapCamera3D_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref CubeMapCamera3D.h
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "Magnum/SceneGraph/AbstractCamera.hpp"
+#include "Magnum/SceneGraph/CubeMapCamera3D.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<class T> BasicCubeMapCamera3D<T>::BasicCubeMapCamera3D(AbstractBasicObject3D<T>& object): AbstractBasicCamera3D<T>(object) {
+    setClippingPlanes(T(0.01), T(100.0));
+}
+
+template<class T> BasicCubeMapCamera3D<T>& BasicCubeMapCamera3D<T>::setClippingPlanes(const T near, const T far) {
+    _near = near;
+    _far = far;
+
+    AbstractBasicCamera3D<T>::rawProjectionMatrix = Math::Matrix4<T>::perspectiveProjection(Math::Rad<T>(Math::Constants<T>::pi()/T(2)), T(1), near, far);
+    AbstractBasicCamera3D<T>::fixAspectRatio();
+
+    for(UnsignedInt face = 0; face != 6; ++face)
+        _faceViewProjections[face] = AbstractBasicCamera3D<T>::projectionMatrix()*faceMatrix(face);
+    return *this;
+}
+
+template<class T> Math::Matrix4<T> BasicCubeMapCamera3D<T>::faceMatrix(const UnsignedInt face) const {
+    CORRADE_ASSERT(face < 6, "SceneGraph::CubeMapCamera3D::faceMatrix(): index" << face << "out of range for 6 faces", {});
+
+    /* Direction and up vector of each face, in the order of cube map
+       coordinates. The up vector is flipped as the cube map faces have
+       origin in the top left corner. */
+    const Math::Vector3<T> directions[][2]{
+        {Math::Vector3<T>::xAxis(),      -Math::Vector3<T>::yAxis()},
+        {-Math::Vector3<T>::xAxis(),     -Math::Vector3<T>::yAxis()},
+        {Math::Vector3<T>::yAxis(),      Math::Vector3<T>::zAxis()},
+        {-Math::Vector3<T>::yAxis(),     -Math::Vector3<T>::zAxis()},
+        {Math::Vector3<T>::zAxis(),      -Math::Vector3<T>::yAxis()},
+        {-Math::Vector3<T>::zAxis(),     -Math::Vector3<T>::yAxis()}};
+    return Math::Matrix4<T>::lookAt({}, directions[face][0], directions[face][1]).invertedRigid();
+}
+
+template<class T> Math::Matrix4<T> BasicCubeMapCamera3D<T>::faceViewProjectionMatrix(const UnsignedInt face) const {
+    CORRADE_ASSERT(face < 6, "SceneGraph::CubeMapCamera3D::faceViewProjectionMatrix(): index" << face << "out of range for 6 faces", {});
+    return _faceViewProjections[face];
+}
+
+template<class T> void BasicCubeMapCamera3D<T>::cullBoundingSpheres(const std::vector<T>& spheres, std::vector<UnsignedByte>& visible) {
+    /* The union of all face frustums is a cube with half-size equal to the
+       far plane distance, test distance of the sphere center to it */
+    const std::size_t count = visible.size();
+    const T* const radii = spheres.data() + 3*count;
+    for(std::size_t i = 0; i != count; ++i) {
+        T distanceSquared{0};
+        for(UnsignedInt d = 0; d != 3; ++d) {
+            const T outside = std::max(std::abs(spheres[d*count + i]) - _far, T(0));
+            distanceSquared += outside*outside;
+        }
+        visible[i] &= UnsignedByte(distanceSquared <= radii[i]*radii[i]);
+    }
+}
+
+}}
+
+#endif
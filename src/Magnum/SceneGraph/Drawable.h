@@ -29,6 +29,10 @@
  * @brief Class @ref Magnum::SceneGraph::Drawable, @ref Magnum::SceneGraph::DrawableGroup, alias @ref Magnum::SceneGraph::BasicDrawable2D, @ref Magnum::SceneGraph::BasicDrawable3D, @ref Magnum::SceneGraph::BasicDrawableGroup2D, @ref Magnum::SceneGraph::BasicDrawableGroup3D, typedef @ref Magnum::SceneGraph::Drawable2D, @ref Magnum::SceneGraph::Drawable3D, @ref Magnum::SceneGraph::DrawableGroup2D, @ref Magnum::SceneGraph::DrawableGroup3D
  */
 
+#include <string>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -149,6 +153,34 @@ void MyApplication::drawEvent() {
 }
 @endcode
 
+## Sorting drawables by render state
+
+If drawables in one group use different shaders, materials or meshes, drawing
+them in insertion order results in a lot of redundant state changes. Each
+drawable can have a 64-bit sort key assigned using @ref setSortKey() and if
+sorting is enabled on the camera with
+@ref AbstractCamera::setSortingEnabled(), the drawables are drawn in order of
+increasing key. Drawables with the same state are then drawn consecutively and
+because the engine tracks currently bound shader, textures and meshes, the
+repeated binds are not passed to OpenGL at all. The key can be composed with
+@ref sortKey(UnsignedShort, UnsignedShort, UnsignedShort, UnsignedShort):
+@code
+drawable.setSortKey(SceneGraph::Drawable3D::sortKey(shaderId, materialId, meshId));
+camera.setSortingEnabled(true);
+@endcode
+
+## Frustum culling
+
+Drawables can have a bounding sphere in object-local coordinates assigned
+using @ref setBoundingSphere(). When drawing, the camera transforms the
+spheres of all drawables in the group into camera space, tests them against
+all planes of the view frustum in one batch and doesn't call @ref draw() for
+those that are completely outside. Drawables without bounding sphere are
+always drawn.
+@code
+drawable.setBoundingSphere({}, 1.0f);
+@endcode
+
 ## Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -164,6 +196,22 @@ errors. See also @ref compilation-speedup-hpp for more information.
 */
 template<UnsignedInt dimensions, class T> class Drawable: public AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T> {
     public:
+        /**
+         * @brief Compose sort key
+         * @param shader    Shader ID
+         * @param material  Material ID
+         * @param mesh      Mesh ID
+         * @param depth     Quantized depth
+         *
+         * The components are packed from the most significant to least
+         * significant, so the drawables are ordered primarily by shader, then
+         * by material, mesh and finally by depth.
+         * @see @ref setSortKey()
+         */
+        constexpr static UnsignedLong sortKey(UnsignedShort shader, UnsignedShort material, UnsignedShort mesh, UnsignedShort depth = 0) {
+            return (UnsignedLong(shader) << 48)|(UnsignedLong(material) << 32)|(UnsignedLong(mesh) << 16)|UnsignedLong(depth);
+        }
+
         /**
          * @brief Constructor
          * @param object    Object this drawable belongs to
@@ -188,6 +236,94 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
             return AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>::group();
         }
 
+        /** @brief Sort key */
+        UnsignedLong sortKey() const {
+            return AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>::groupKey();
+        }
+
+        /**
+         * @brief Set sort key
+         * @return Reference to self (for method chaining)
+         *
+         * Used for ordering the drawables if sorting is enabled in the camera.
+         * Default is `0`. The key is stored as
+         * @ref AbstractGroupedFeature::groupKey() "group key", so the camera
+         * can sort the drawables without accessing each of them.
+         * @see @ref AbstractCamera::setSortingEnabled(),
+         *      @ref sortKey(UnsignedShort, UnsignedShort, UnsignedShort, UnsignedShort)
+         */
+        Drawable<dimensions, T>& setSortKey(UnsignedLong key) {
+            AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>::setGroupKey(key);
+            return *this;
+        }
+
+        /**
+         * @brief Whether the drawable has a bounding sphere
+         *
+         * @see @ref setBoundingSphere()
+         */
+        bool hasBoundingSphere() const { return _boundingSphereRadius >= T(0); }
+
+        /**
+         * @brief Bounding sphere center
+         *
+         * In object-local coordinates.
+         * @see @ref hasBoundingSphere()
+         */
+        VectorTypeFor<dimensions, T> boundingSphereCenter() const { return _boundingSphereCenter; }
+
+        /**
+         * @brief Bounding sphere radius
+         *
+         * If the drawable doesn't have a bounding sphere, returns negative
+         * value.
+         * @see @ref hasBoundingSphere()
+         */
+        T boundingSphereRadius() const { return _boundingSphereRadius; }
+
+        /**
+         * @brief Set bounding sphere
+         * @param center    Center in object-local coordinates
+         * @param radius    Radius
+         * @return Reference to self (for method chaining)
+         *
+         * Used by the camera to cull the drawable against view frustum.
+         * Passing negative radius removes the bounding sphere. By default the drawable
+         * has no bounding sphere and is never culled.
+         */
+        Drawable<dimensions, T>& setBoundingSphere(const VectorTypeFor<dimensions, T>& center, T radius) {
+            _boundingSphereCenter = center;
+            _boundingSphereRadius = radius;
+            return *this;
+        }
+
+        /**
+         * @brief Set bounding sphere from bounding box
+         * @return Reference to self (for method chaining)
+         *
+         * Sets bounding sphere enclosing given box in object-local
+         * coordinates.
+         */
+        Drawable<dimensions, T>& setBoundingSphere(const Math::Range<dimensions, T>& box) {
+            return setBoundingSphere(box.center(), box.size().length()/T(2));
+        }
+
+        /** @brief Debug group label */
+        const std::string& debugLabel() const { return _debugLabel; }
+
+        /**
+         * @brief Set debug group label
+         * @return Reference to self (for method chaining)
+         *
+         * Used for the debug group emitted around the drawable if enabled
+         * in the camera. Default is `"Drawable"`.
+         * @see @ref AbstractCamera::setDrawableDebugGroupsEnabled()
+         */
+        Drawable<dimensions, T>& setDebugLabel(std::string label) {
+            _debugLabel = std::move(label);
+            return *this;
+        }
+
         /**
          * @brief Draw the object using given camera
          * @param transformationMatrix  Object transformation relative to camera
@@ -197,6 +333,11 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
          * @ref SceneGraph::AbstractCamera::projectionMatrix() "AbstractCamera::projectionMatrix()".
          */
         virtual void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, AbstractCamera<dimensions, T>& camera) = 0;
+
+    private:
+        VectorTypeFor<dimensions, T> _boundingSphereCenter;
+        T _boundingSphereRadius;
+        std::string _debugLabel;
 };
 
 /**
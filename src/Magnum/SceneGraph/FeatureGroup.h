@@ -44,20 +44,34 @@ See @ref FeatureGroup.
 */
 template<UnsignedInt dimensions, class T> class AbstractFeatureGroup {
     template<UnsignedInt, class, class> friend class FeatureGroup;
+    template<UnsignedInt, class, class> friend class AbstractGroupedFeature;
 
     explicit AbstractFeatureGroup();
     virtual ~AbstractFeatureGroup();
 
-    void add(AbstractFeature<dimensions, T>& feature);
-    void remove(AbstractFeature<dimensions, T>& feature);
+    void add(AbstractFeature<dimensions, T>& feature, UnsignedLong key);
+    void remove(std::size_t index);
 
     std::vector<std::reference_wrapper<AbstractFeature<dimensions, T>>> features;
+    std::vector<UnsignedLong> keys;
 };
 
 /**
 @brief Group of features
 
 See @ref AbstractGroupedFeature for more information.
+
+## Storage
+
+The features are stored in a contiguous array together with their
+@ref AbstractGroupedFeature::groupKey() "group keys", which are kept in a
+separate contiguous array available through @ref keys(), so code processing
+the whole group (such as sorting the drawables by key in
+@ref AbstractCamera::draw()) doesn't need to touch the features themselves.
+Each feature remembers its position in the group, so both adding and
+removing a feature are @f$ \mathcal{O}(1) @f$ operations. The removal moves
+the last feature into the place of the removed one, thus the order of
+features in the group is the insertion order only until the first removal.
 @see @ref scenegraph, @ref BasicFeatureGroup2D, @ref BasicFeatureGroup3D,
     @ref FeatureGroup2D, @ref FeatureGroup3D
 */
@@ -94,6 +108,17 @@ template<UnsignedInt dimensions, class Feature, class T> class FeatureGroup: pub
             return static_cast<Feature&>(AbstractFeatureGroup<dimensions, T>::features[index].get());
         }
 
+        /**
+         * @brief Group keys of all features
+         *
+         * The key at given index corresponds to the feature at the same
+         * index.
+         * @see @ref AbstractGroupedFeature::groupKey()
+         */
+        const std::vector<UnsignedLong>& keys() const {
+            return AbstractFeatureGroup<dimensions, T>::keys;
+        }
+
         /**
          * @brief Add feature to the group
          * @return Reference to self (for method chaining)
@@ -107,7 +132,8 @@ template<UnsignedInt dimensions, class Feature, class T> class FeatureGroup: pub
          * @brief Remove feature from the group
          * @return Reference to self (for method chaining)
          *
-         * The feature must be part of the group.
+         * The feature must be part of the group. The last feature in the
+         * group is moved to its place.
          * @see @ref add()
          */
         FeatureGroup<dimensions, Feature, T>& remove(Feature& feature);
@@ -159,7 +185,8 @@ template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions
         feature._group->remove(feature);
 
     /* Crossreference the feature and group together */
-    AbstractFeatureGroup<dimensions, T>::add(feature);
+    feature._groupIndex = AbstractFeatureGroup<dimensions, T>::features.size();
+    AbstractFeatureGroup<dimensions, T>::add(feature, feature._groupKey);
     feature._group = this;
     return *this;
 }
@@ -168,7 +195,12 @@ template<UnsignedInt dimensions, class Feature, class T> FeatureGroup<dimensions
     CORRADE_ASSERT(feature._group == this,
         "SceneGraph::AbstractFeatureGroup::remove(): feature is not part of this group", *this);
 
-    AbstractFeatureGroup<dimensions, T>::remove(feature);
+    /* Update index of the feature which was moved to the removed place */
+    const std::size_t index = feature._groupIndex;
+    AbstractFeatureGroup<dimensions, T>::remove(index);
+    if(index != AbstractFeatureGroup<dimensions, T>::features.size())
+        static_cast<Feature&>(AbstractFeatureGroup<dimensions, T>::features[index].get())._groupIndex = index;
+
     feature._group = nullptr;
     return *this;
 }
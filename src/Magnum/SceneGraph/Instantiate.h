@@ -0,0 +1,84 @@
+#ifndef Magnum_SceneGraph_Instantiate_h
+#define Magnum_SceneGraph_Instantiate_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::SceneGraph::instantiate()
+ */
+
+#include <vector>
+
+#include "Magnum/SceneGraph/Object.h"
+#include "Magnum/SceneGraph/ObjectPool.h"
+#include "Magnum/Trade/FlatSceneData3D.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Instantiate flattened scene
+@param scene    Flattened scene data
+@param parent   Parent for top-level objects of the scene
+@param pool     Pool to allocate the objects from or `nullptr` to allocate
+    them on the heap
+
+Creates one object for each object in @p scene in a single linear pass, with
+the same hierarchy and transformations. Returns the created objects in the
+same order as in @p scene, so e.g. drawables for mesh instances can be then
+attached based on @ref Trade::FlatSceneData3D::instanceTypes() and
+@ref Trade::FlatSceneData3D::instances():
+@code
+std::optional<Trade::FlatSceneData3D> data = importer.flatScene3D(0);
+std::vector<Object3D*> objects = SceneGraph::instantiate(*data, scene, &pool);
+for(std::size_t i = 0; i != objects.size(); ++i)
+    if(data->instanceTypes()[i] == Trade::ObjectInstanceType3D::Mesh)
+        new(pool) MeshDrawable{*objects[i], meshes[data->instances()[i]], &drawables};
+@endcode
+
+Together with @ref AbstractImporter::flatScene3D() "Trade::AbstractImporter::flatScene3D()"
+and @ref ObjectPool this avoids all per-object allocations other than the
+objects themselves.
+*/
+template<class Transformation> std::vector<Object<Transformation>*> instantiate(const Trade::FlatSceneData3D& scene, Object<Transformation>& parent, ObjectPool* pool = nullptr) {
+    const std::vector<Int>& parents = scene.parents();
+    const std::vector<Matrix4>& transformations = scene.transformations();
+
+    std::vector<Object<Transformation>*> objects;
+    objects.reserve(scene.objectCount());
+    for(std::size_t i = 0; i != scene.objectCount(); ++i) {
+        Object<Transformation>* const objectParent = parents[i] == -1 ? &parent : objects[parents[i]];
+        Object<Transformation>* const object = pool ?
+            new(*pool) Object<Transformation>{objectParent} :
+            new Object<Transformation>{objectParent};
+        object->setTransformation(Implementation::Transformation<Transformation>::fromMatrix(Math::Matrix4<typename Transformation::Type>{transformations[i]}));
+        objects.push_back(object);
+    }
+
+    return objects;
+}
+
+}}
+
+#endif
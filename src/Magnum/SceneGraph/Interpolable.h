@@ -0,0 +1,176 @@
+#ifndef Magnum_SceneGraph_Interpolable_h
+#define Magnum_SceneGraph_Interpolable_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::Interpolable, alias @ref Magnum::SceneGraph::BasicInterpolable2D, @ref Magnum::SceneGraph::BasicInterpolable3D, typedef @ref Magnum::SceneGraph::Interpolable2D, @ref Magnum::SceneGraph::Interpolable3D
+ */
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/SceneGraph/AbstractGroupedFeature.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Interpolable
+
+Keeps absolute transformation of the object from the last two fixed
+simulation steps and interpolates between them, so the motion is smooth even
+if the simulation runs at lower rate than the rendering. Each Interpolable is
+part of some @ref InterpolableGroup, which takes care of capturing and
+interpolating the transformations.
+
+## Usage
+
+Add the feature to objects which are moved by the simulation, call
+@ref InterpolableGroup::capture() after each fixed step and
+@ref InterpolableGroup::interpolate() before drawing. See
+@ref Timeline::setFixedStepDuration() for more information about fixed
+stepping.
+@code
+class Ball: public Object3D, SceneGraph::Drawable3D, SceneGraph::Interpolable3D {
+    public:
+        explicit Ball(Object3D* parent, SceneGraph::DrawableGroup3D* drawables, SceneGraph::InterpolableGroup3D* interpolables): Object3D{parent}, SceneGraph::Drawable3D{*this, drawables}, SceneGraph::Interpolable3D{*this, interpolables} {}
+
+    private:
+        void draw(const Matrix4&, SceneGraph::Camera3D& camera) override {
+            const Matrix4 transformationMatrix = camera.cameraMatrix()*interpolatedTransformationMatrix();
+            // ...
+        }
+};
+@endcode
+
+Translation and scaling are interpolated linearly, rotation is interpolated
+along the shortest path. The transformations are expected to not contain any
+shear or projection. The interpolated transformation lags behind the
+simulation by one fixed step at most.
+
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref Interpolable.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref Interpolable2D, @ref Interpolable3D
+
+@see @ref scenegraph, @ref BasicInterpolable2D, @ref BasicInterpolable3D,
+    @ref Interpolable2D, @ref Interpolable3D, @ref InterpolableGroup
+*/
+template<UnsignedInt dimensions, class T> class Interpolable: public AbstractGroupedFeature<dimensions, Interpolable<dimensions, T>, T> {
+    friend InterpolableGroup<dimensions, T>;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object this interpolable belongs to
+         * @param group     Group this interpolable belongs to
+         *
+         * All transformations are initially identity.
+         */
+        explicit Interpolable(AbstractObject<dimensions, T>& object, InterpolableGroup<dimensions, T>* group = nullptr);
+
+        /**
+         * @brief Absolute transformation at the previous fixed step
+         *
+         * @see @ref InterpolableGroup::capture()
+         */
+        MatrixTypeFor<dimensions, T> previousTransformationMatrix() const { return _previous; }
+
+        /**
+         * @brief Absolute transformation at the last fixed step
+         *
+         * @see @ref InterpolableGroup::capture()
+         */
+        MatrixTypeFor<dimensions, T> currentTransformationMatrix() const { return _current; }
+
+        /**
+         * @brief Interpolated absolute transformation
+         *
+         * Computed in @ref InterpolableGroup::interpolate().
+         */
+        MatrixTypeFor<dimensions, T> interpolatedTransformationMatrix() const { return _interpolated; }
+
+        /**
+         * @brief Reset the interpolation
+         * @return Reference to self (for method chaining)
+         *
+         * Sets all transformations to current absolute transformation of
+         * the object. Use when the object is moved discontinuously (e.g.
+         * teleported), so it doesn't visibly slide to the new position.
+         */
+        Interpolable<dimensions, T>& reset();
+
+        /** @brief Group containing this interpolable */
+        InterpolableGroup<dimensions, T>* interpolables();
+        const InterpolableGroup<dimensions, T>* interpolables() const; /**< @overload */
+
+    private:
+        MatrixTypeFor<dimensions, T> _previous, _current, _interpolated;
+        bool _captured;
+};
+
+/**
+@brief Interpolable for two-dimensional scenes
+
+Convenience alternative to `Interpolable<2, T>`. See @ref Interpolable for
+more information.
+@see @ref Interpolable2D, @ref BasicInterpolable3D
+*/
+template<class T> using BasicInterpolable2D = Interpolable<2, T>;
+
+/**
+@brief Interpolable for two-dimensional float scenes
+
+@see @ref Interpolable3D
+*/
+typedef BasicInterpolable2D<Float> Interpolable2D;
+
+/**
+@brief Interpolable for three-dimensional scenes
+
+Convenience alternative to `Interpolable<3, T>`. See @ref Interpolable for
+more information.
+@see @ref Interpolable3D, @ref BasicInterpolable2D
+*/
+template<class T> using BasicInterpolable3D = Interpolable<3, T>;
+
+/**
+@brief Interpolable for three-dimensional float scenes
+
+@see @ref Interpolable2D
+*/
+typedef BasicInterpolable3D<Float> Interpolable3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT Interpolable<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT Interpolable<3, Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,153 @@
+#ifndef Magnum_SceneGraph_Interpolable_hpp
+#define Magnum_SceneGraph_Interpolable_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Interpolable.h and @ref InterpolableGroup.h
+ */
+
+#include <functional>
+#include <vector>
+
+#include "Magnum/Math/Complex.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/Interpolable.h"
+#include "Magnum/SceneGraph/InterpolableGroup.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+/* Decompose both transformations to translation, rotation and scaling,
+   interpolate each separately and compose them back. Negative determinant
+   is handled by flipping the first axis. */
+template<class T> Math::Matrix3<T> interpolateTransformation(const Math::Matrix3<T>& a, const Math::Matrix3<T>& b, const T factor) {
+    Math::Vector2<T> scaling[2];
+    T angle[2];
+    const Math::Matrix3<T>* const matrices[]{&a, &b};
+    for(std::size_t i = 0; i != 2; ++i) {
+        const Math::Matrix3<T>& m = *matrices[i];
+        scaling[i] = {m.right().length(), m.up().length()};
+        if(m.rotationScaling().determinant() < T(0)) scaling[i].x() = -scaling[i].x();
+        angle[i] = std::atan2(m.right().y()/scaling[i].x(), m.right().x()/scaling[i].x());
+    }
+
+    /* Take the shortest path */
+    T delta = angle[1] - angle[0];
+    if(delta > Math::Constants<T>::pi()) delta -= T(2)*Math::Constants<T>::pi();
+    else if(delta < -Math::Constants<T>::pi()) delta += T(2)*Math::Constants<T>::pi();
+
+    return Math::Matrix3<T>::translation(Math::lerp(a.translation(), b.translation(), factor))*
+        Math::Matrix3<T>::rotation(Math::Rad<T>(angle[0] + delta*factor))*
+        Math::Matrix3<T>::scaling(Math::lerp(scaling[0], scaling[1], factor));
+}
+
+template<class T> Math::Matrix4<T> interpolateTransformation(const Math::Matrix4<T>& a, const Math::Matrix4<T>& b, const T factor) {
+    Math::Vector3<T> scaling[2];
+    Math::Quaternion<T> rotation[2];
+    const Math::Matrix4<T>* const matrices[]{&a, &b};
+    for(std::size_t i = 0; i != 2; ++i) {
+        const Math::Matrix4<T>& m = *matrices[i];
+        scaling[i] = {m.right().length(), m.up().length(), m.backward().length()};
+        if(m.rotationScaling().determinant() < T(0)) scaling[i].x() = -scaling[i].x();
+        rotation[i] = Math::Quaternion<T>::fromMatrix({m.right()/scaling[i].x(),
+                                                        m.up()/scaling[i].y(),
+                                                        m.backward()/scaling[i].z()});
+    }
+
+    /* Take the shortest path */
+    T cosAngle = Math::dot(rotation[0], rotation[1]);
+    if(cosAngle < T(0)) {
+        rotation[1] = -rotation[1];
+        cosAngle = -cosAngle;
+    }
+
+    /* Nearly identical rotations, sin(angle) would be zero. Linear
+       interpolation is precise enough there. */
+    Math::Quaternion<T> interpolated;
+    if(cosAngle > T(1) - Math::TypeTraits<T>::epsilon())
+        interpolated = (rotation[0]*(T(1) - factor) + rotation[1]*factor).normalized();
+    else {
+        const T angle = std::acos(cosAngle);
+        interpolated = (rotation[0]*std::sin((T(1) - factor)*angle) + rotation[1]*std::sin(factor*angle))/std::sin(angle);
+    }
+
+    return Math::Matrix4<T>::from(interpolated.toMatrix(), Math::lerp(a.translation(), b.translation(), factor))*
+        Math::Matrix4<T>::scaling(Math::lerp(scaling[0], scaling[1], factor));
+}
+
+}
+
+template<UnsignedInt dimensions, class T> Interpolable<dimensions, T>::Interpolable(AbstractObject<dimensions, T>& object, InterpolableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Interpolable<dimensions, T>, T>(object, group), _captured(false) {}
+
+template<UnsignedInt dimensions, class T> Interpolable<dimensions, T>& Interpolable<dimensions, T>::reset() {
+    _previous = _current = _interpolated = this->object().absoluteTransformationMatrix();
+    _captured = true;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> InterpolableGroup<dimensions, T>* Interpolable<dimensions, T>::interpolables() {
+    return static_cast<InterpolableGroup<dimensions, T>*>(AbstractGroupedFeature<dimensions, Interpolable<dimensions, T>, T>::group());
+}
+
+template<UnsignedInt dimensions, class T> const InterpolableGroup<dimensions, T>* Interpolable<dimensions, T>::interpolables() const {
+    return static_cast<const InterpolableGroup<dimensions, T>*>(AbstractGroupedFeature<dimensions, Interpolable<dimensions, T>, T>::group());
+}
+
+template<UnsignedInt dimensions, class T> void InterpolableGroup<dimensions, T>::capture() {
+    /* Clean all objects at once so the shared parts of the hierarchy are
+       computed only once */
+    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
+    objects.reserve(this->size());
+    for(std::size_t i = 0; i != this->size(); ++i)
+        objects.push_back((*this)[i].object());
+    AbstractObject<dimensions, T>::setClean(objects);
+
+    for(std::size_t i = 0; i != this->size(); ++i) {
+        Interpolable<dimensions, T>& interpolable = (*this)[i];
+        interpolable._previous = interpolable._current;
+        interpolable._current = interpolable.object().absoluteTransformationMatrix();
+        if(!interpolable._captured) {
+            interpolable._previous = interpolable._interpolated = interpolable._current;
+            interpolable._captured = true;
+        }
+    }
+}
+
+template<UnsignedInt dimensions, class T> void InterpolableGroup<dimensions, T>::interpolate(const T factor) {
+    for(std::size_t i = 0; i != this->size(); ++i) {
+        Interpolable<dimensions, T>& interpolable = (*this)[i];
+        interpolable._interpolated = Implementation::interpolateTransformation(interpolable._previous, interpolable._current, factor);
+    }
+}
+
+}}
+
+#endif
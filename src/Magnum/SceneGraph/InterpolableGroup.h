@@ -0,0 +1,110 @@
+#ifndef Magnum_SceneGraph_InterpolableGroup_h
+#define Magnum_SceneGraph_InterpolableGroup_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::InterpolableGroup, alias @ref Magnum::SceneGraph::BasicInterpolableGroup2D, @ref Magnum::SceneGraph::BasicInterpolableGroup3D, typedef @ref Magnum::SceneGraph::InterpolableGroup2D, @ref Magnum::SceneGraph::InterpolableGroup3D
+ */
+
+#include "Magnum/SceneGraph/FeatureGroup.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Group of interpolables
+
+See @ref Interpolable for more information.
+@see @ref scenegraph, @ref BasicInterpolableGroup2D,
+    @ref BasicInterpolableGroup3D, @ref InterpolableGroup2D,
+    @ref InterpolableGroup3D
+*/
+template<UnsignedInt dimensions, class T> class InterpolableGroup: public FeatureGroup<dimensions, Interpolable<dimensions, T>, T> {
+    public:
+        /**
+         * @brief Capture transformations after fixed step
+         *
+         * Makes the last captured transformation of each interpolable the
+         * previous one and saves current absolute transformation of its
+         * object. Transformations of all objects are computed in one batch.
+         * On first capture both transformations are set to the current
+         * one.
+         * @see @ref Interpolable::previousTransformationMatrix(),
+         *      @ref Interpolable::currentTransformationMatrix()
+         */
+        void capture();
+
+        /**
+         * @brief Interpolate between last two fixed steps
+         * @param factor    Interpolation factor in range @f$ [0; 1] @f$
+         *      (e.g. @ref Timeline::fixedStepInterpolation())
+         *
+         * Factor `0` gives the previous transformation, `1` the current one.
+         * @see @ref Interpolable::interpolatedTransformationMatrix()
+         */
+        void interpolate(T factor);
+};
+
+/**
+@brief Interpolable group for two-dimensional scenes
+
+Convenience alternative to `InterpolableGroup<2, T>`. See @ref Interpolable
+for more information.
+@see @ref InterpolableGroup2D, @ref BasicInterpolableGroup3D
+*/
+template<class T> using BasicInterpolableGroup2D = InterpolableGroup<2, T>;
+
+/**
+@brief Interpolable group for two-dimensional float scenes
+
+@see @ref InterpolableGroup3D
+*/
+typedef BasicInterpolableGroup2D<Float> InterpolableGroup2D;
+
+/**
+@brief Interpolable group for three-dimensional scenes
+
+Convenience alternative to `InterpolableGroup<3, T>`. See @ref Interpolable
+for more information.
+@see @ref InterpolableGroup3D, @ref BasicInterpolableGroup2D
+*/
+template<class T> using BasicInterpolableGroup3D = InterpolableGroup<3, T>;
+
+/**
+@brief Interpolable group for three-dimensional float scenes
+
+@see @ref InterpolableGroup2D
+*/
+typedef BasicInterpolableGroup3D<Float> InterpolableGroup3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT InterpolableGroup<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT InterpolableGroup<3, Float>;
+#endif
+
+}}
+
+#endif
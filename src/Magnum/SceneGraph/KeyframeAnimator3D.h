@@ -0,0 +1,221 @@
+#ifndef Magnum_SceneGraph_KeyframeAnimator3D_h
+#define Magnum_SceneGraph_KeyframeAnimator3D_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BasicKeyframeAnimator3D, typedef @ref Magnum::SceneGraph::KeyframeAnimator3D
+ */
+
+#include <vector>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Data-oriented keyframe animator for three-dimensional scenes
+
+Alternative to @ref Animable for large amounts of simple animations, such as
+crowds of characters. Instead of a virtual @ref Animable::animationStep()
+call on every object, keyframe tracks of translation, rotation and scaling
+are stored in contiguous arrays and all players are evaluated together in
+@ref step(), one linear pass for each channel. The results can then be
+written to @ref Object instances or to @ref TransformationArray in one pass.
+
+Keyframes of one track share the time values for all three channels.
+Translation and scaling are linearly interpolated, rotation is interpolated
+using spherical linear interpolation along the shortest path.
+
+@code
+KeyframeAnimator3D animator;
+UnsignedInt walk = animator.addTrack({0.0f, 0.5f, 1.0f},
+    {{}, Vector3::yAxis(0.2f), {}},
+    {Quaternion{}, Quaternion::rotation(Deg(30.0f), Vector3::zAxis()), Quaternion{}},
+    {Vector3{1.0f}, Vector3{1.0f}, Vector3{1.0f}});
+
+std::vector<Object3D*> characters;
+for(std::size_t i = 0; i != 5000; ++i) {
+    characters.push_back(new Object3D{&scene});
+    animator.addPlayer(walk, i*0.01f);
+}
+
+// each frame
+animator.step(timeline.previousFrameTime());
+animator.apply(characters);
+@endcode
+
+@see @ref scenegraph, @ref KeyframeAnimator3D
+*/
+template<class T> class BasicKeyframeAnimator3D {
+    public:
+        /** @brief Constructor */
+        explicit BasicKeyframeAnimator3D();
+
+        /** @brief Count of tracks */
+        std::size_t trackCount() const { return _tracks.size(); }
+
+        /**
+         * @brief Add keyframe track
+         * @param times         Keyframe times, in ascending order
+         * @param translations  Translation in each keyframe
+         * @param rotations     Normalized rotation in each keyframe
+         * @param scalings      Scaling in each keyframe
+         * @return ID of the track
+         *
+         * Expects that all arrays have the same non-zero size.
+         */
+        UnsignedInt addTrack(const std::vector<T>& times, const std::vector<Math::Vector3<T>>& translations, const std::vector<Math::Quaternion<T>>& rotations, const std::vector<Math::Vector3<T>>& scalings);
+
+        /** @brief Track duration */
+        T trackDuration(UnsignedInt track) const;
+
+        /** @brief Count of players */
+        std::size_t playerCount() const { return _playerTracks.size(); }
+
+        /**
+         * @brief Add player
+         * @param track     Track ID
+         * @param startTime Absolute time at which the track starts playing
+         * @param looping   Whether to repeat the track after it ends
+         * @return ID of the player, equal to its index in the result arrays
+         *
+         * Before @p startTime the first keyframe is used, after the end of
+         * non-looping track the last keyframe is used.
+         */
+        UnsignedInt addPlayer(UnsignedInt track, T startTime = T(0), bool looping = true);
+
+        /**
+         * @brief Evaluate all players
+         * @param time      Absolute time (e.g. @ref Timeline::previousFrameTime())
+         *
+         * Finds the keyframes for each player and then interpolates each
+         * channel for all players at once.
+         * @see @ref translations(), @ref rotations(), @ref scalings(),
+         *      @ref apply()
+         */
+        void step(T time);
+
+        /**
+         * @brief Translations computed in last step
+         *
+         * Indexed by player ID.
+         */
+        const std::vector<Math::Vector3<T>>& translations() const { return _translations; }
+
+        /**
+         * @brief Rotations computed in last step
+         *
+         * Indexed by player ID.
+         */
+        const std::vector<Math::Quaternion<T>>& rotations() const { return _rotations; }
+
+        /**
+         * @brief Scalings computed in last step
+         *
+         * Indexed by player ID.
+         */
+        const std::vector<Math::Vector3<T>>& scalings() const { return _scalings; }
+
+        /** @brief Transformation matrix of given player computed in last step */
+        Math::Matrix4<T> transformationMatrix(UnsignedInt player) const;
+
+        /**
+         * @brief Write results to objects
+         *
+         * Sets transformation of i-th object to result of i-th player.
+         * Expects that the count of objects is the same as
+         * @ref playerCount(). The result is converted to the object's
+         * transformation type, for rigid transformations the scaling is
+         * expected to be `1`.
+         */
+        template<class Transformation> void apply(const std::vector<Object<Transformation>*>& objects) const;
+
+        /**
+         * @brief Write results to transformation array
+         *
+         * Sets transformation of object with ID @p ids[i] to result of i-th
+         * player. Expects that the count of IDs is the same as
+         * @ref playerCount().
+         */
+        template<class Transformation> void apply(TransformationArray<Transformation>& array, const std::vector<UnsignedInt>& ids) const;
+
+    private:
+        struct Track {
+            UnsignedInt offset, count;
+        };
+
+        std::vector<Track> _tracks;
+
+        /* Keyframes of all tracks */
+        std::vector<T> _times;
+        std::vector<Math::Vector3<T>> _keyframeTranslations;
+        std::vector<Math::Quaternion<T>> _keyframeRotations;
+        std::vector<Math::Vector3<T>> _keyframeScalings;
+
+        /* Players */
+        std::vector<UnsignedInt> _playerTracks;
+        std::vector<T> _playerStartTimes;
+        std::vector<bool> _playerLooping;
+        std::vector<UnsignedInt> _playerHints;
+
+        /* Keyframe pairs and interpolation factors found in last step */
+        std::vector<UnsignedInt> _from, _to;
+        std::vector<T> _factors;
+
+        /* Results */
+        std::vector<Math::Vector3<T>> _translations;
+        std::vector<Math::Quaternion<T>> _rotations;
+        std::vector<Math::Vector3<T>> _scalings;
+};
+
+/**
+@brief Keyframe animator for three-dimensional float scenes
+
+@see @ref scenegraph
+*/
+typedef BasicKeyframeAnimator3D<Float> KeyframeAnimator3D;
+
+template<class T> template<class Transformation> void BasicKeyframeAnimator3D<T>::apply(const std::vector<Object<Transformation>*>& objects) const {
+    CORRADE_ASSERT(objects.size() == _playerTracks.size(),
+        "SceneGraph::KeyframeAnimator3D::apply(): expected" << _playerTracks.size() << "objects but got" << objects.size(), );
+
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        objects[i]->setTransformation(Implementation::Transformation<Transformation>::fromMatrix(transformationMatrix(i)));
+}
+
+template<class T> template<class Transformation> void BasicKeyframeAnimator3D<T>::apply(TransformationArray<Transformation>& array, const std::vector<UnsignedInt>& ids) const {
+    CORRADE_ASSERT(ids.size() == _playerTracks.size(),
+        "SceneGraph::KeyframeAnimator3D::apply(): expected" << _playerTracks.size() << "IDs but got" << ids.size(), );
+
+    for(std::size_t i = 0; i != ids.size(); ++i)
+        array.setTransformation(ids[i], Implementation::Transformation<Transformation>::fromMatrix(transformationMatrix(i)));
+}
+
+}}
+
+#endif
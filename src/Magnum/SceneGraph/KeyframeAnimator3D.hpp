@@ -0,0 +1,159 @@
+#ifndef Magnum_SceneGraph_KeyframeAnimator3D_hpp
+#define Magnum_SceneGraph_KeyframeAnimator3D_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref KeyframeAnimator3D.h
+ */
+
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/SceneGraph/KeyframeAnimator3D.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<class T> BasicKeyframeAnimator3D<T>::BasicKeyframeAnimator3D() = default;
+
+template<class T> UnsignedInt BasicKeyframeAnimator3D<T>::addTrack(const std::vector<T>& times, const std::vector<Math::Vector3<T>>& translations, const std::vector<Math::Quaternion<T>>& rotations, const std::vector<Math::Vector3<T>>& scalings) {
+    CORRADE_ASSERT(!times.empty() && translations.size() == times.size() && rotations.size() == times.size() && scalings.size() == times.size(),
+        "SceneGraph::KeyframeAnimator3D::addTrack(): expected the same non-zero count of times, translations, rotations and scalings", 0xFFFFFFFFu);
+
+    _tracks.push_back({UnsignedInt(_times.size()), UnsignedInt(times.size())});
+    _times.insert(_times.end(), times.begin(), times.end());
+    _keyframeTranslations.insert(_keyframeTranslations.end(), translations.begin(), translations.end());
+    _keyframeRotations.insert(_keyframeRotations.end(), rotations.begin(), rotations.end());
+    _keyframeScalings.insert(_keyframeScalings.end(), scalings.begin(), scalings.end());
+    return UnsignedInt(_tracks.size() - 1);
+}
+
+template<class T> T BasicKeyframeAnimator3D<T>::trackDuration(const UnsignedInt track) const {
+    CORRADE_ASSERT(track < _tracks.size(),
+        "SceneGraph::KeyframeAnimator3D::trackDuration(): invalid track" << track, T(0));
+
+    const Track& t = _tracks[track];
+    return _times[t.offset + t.count - 1] - _times[t.offset];
+}
+
+template<class T> UnsignedInt BasicKeyframeAnimator3D<T>::addPlayer(const UnsignedInt track, const T startTime, const bool looping) {
+    CORRADE_ASSERT(track < _tracks.size(),
+        "SceneGraph::KeyframeAnimator3D::addPlayer(): invalid track" << track, 0xFFFFFFFFu);
+
+    _playerTracks.push_back(track);
+    _playerStartTimes.push_back(startTime);
+    _playerLooping.push_back(looping);
+    _playerHints.push_back(0);
+
+    /* Initialize the results with first keyframe so they're not garbage
+       before first step() */
+    const UnsignedInt first = _tracks[track].offset;
+    _from.push_back(first);
+    _to.push_back(first);
+    _factors.push_back(T(0));
+    _translations.push_back(_keyframeTranslations[first]);
+    _rotations.push_back(_keyframeRotations[first]);
+    _scalings.push_back(_keyframeScalings[first]);
+    return UnsignedInt(_playerTracks.size() - 1);
+}
+
+template<class T> void BasicKeyframeAnimator3D<T>::step(const T time) {
+    const std::size_t count = _playerTracks.size();
+
+    /* Find keyframe pair and interpolation factor for each player. Time
+       usually advances only a bit between steps, so the search starts from
+       the keyframe found last time. */
+    for(std::size_t i = 0; i != count; ++i) {
+        const Track& track = _tracks[_playerTracks[i]];
+        const T* const times = _times.data() + track.offset;
+        const T duration = times[track.count - 1] - times[0];
+
+        T local = time - _playerStartTimes[i];
+        if(local < T(0)) local = T(0);
+        else if(_playerLooping[i] && duration > T(0)) local = std::fmod(local, duration);
+        else if(local > duration) local = duration;
+        const T t = times[0] + local;
+
+        UnsignedInt k = _playerHints[i];
+        if(times[k] > t) k = 0;
+        while(k + 1 < track.count && times[k + 1] <= t) ++k;
+        _playerHints[i] = k;
+
+        _from[i] = track.offset + k;
+        if(k + 1 < track.count) {
+            _to[i] = track.offset + k + 1;
+            _factors[i] = (t - times[k])/(times[k + 1] - times[k]);
+        } else {
+            _to[i] = track.offset + k;
+            _factors[i] = T(0);
+        }
+    }
+
+    /* Interpolate each channel in a separate tight loop */
+    for(std::size_t i = 0; i != count; ++i)
+        _translations[i] = Math::lerp(_keyframeTranslations[_from[i]], _keyframeTranslations[_to[i]], _factors[i]);
+
+    for(std::size_t i = 0; i != count; ++i) {
+        const Math::Quaternion<T>& a = _keyframeRotations[_from[i]];
+        Math::Quaternion<T> b = _keyframeRotations[_to[i]];
+        const T f = _factors[i];
+
+        /* Take the shortest path */
+        T cosAngle = Math::dot(a, b);
+        if(cosAngle < T(0)) {
+            b = -b;
+            cosAngle = -cosAngle;
+        }
+
+        /* Nearly identical rotations, sin(angle) would be zero. Linear
+           interpolation is precise enough there. */
+        if(cosAngle > T(1) - Math::TypeTraits<T>::epsilon()) {
+            _rotations[i] = (a*(T(1) - f) + b*f).normalized();
+            continue;
+        }
+
+        const T angle = std::acos(cosAngle);
+        _rotations[i] = (a*std::sin((T(1) - f)*angle) + b*std::sin(f*angle))/std::sin(angle);
+    }
+
+    for(std::size_t i = 0; i != count; ++i)
+        _scalings[i] = Math::lerp(_keyframeScalings[_from[i]], _keyframeScalings[_to[i]], _factors[i]);
+}
+
+template<class T> Math::Matrix4<T> BasicKeyframeAnimator3D<T>::transformationMatrix(const UnsignedInt player) const {
+    CORRADE_ASSERT(player < _playerTracks.size(),
+        "SceneGraph::KeyframeAnimator3D::transformationMatrix(): invalid player" << player, {});
+
+    Math::Matrix3x3<T> rotationScaling = _rotations[player].toMatrix();
+    for(std::size_t i = 0; i != 3; ++i) rotationScaling[i] *= _scalings[player][i];
+    return Math::Matrix4<T>::from(rotationScaling, _translations[player]);
+}
+
+}}
+
+#endif
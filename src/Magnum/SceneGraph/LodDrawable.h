@@ -0,0 +1,182 @@
+#ifndef Magnum_SceneGraph_LodDrawable_h
+#define Magnum_SceneGraph_LodDrawable_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::LodDrawable, alias @ref Magnum::SceneGraph::BasicLodDrawable2D, @ref Magnum::SceneGraph::BasicLodDrawable3D, typedef @ref Magnum::SceneGraph::LodDrawable2D, @ref Magnum::SceneGraph::LodDrawable3D
+ */
+
+#include <vector>
+
+#include "Magnum/SceneGraph/Drawable.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Drawable with level of detail selection
+
+Selects level of detail based on how large the drawable's
+@ref boundingSphereRadius() "bounding sphere" is on the screen and passes it
+to @ref drawLod(). Projected size is fraction of viewport height covered by
+the sphere diameter, i.e. `1.0` means the drawable fills the whole screen
+vertically. Level `0` is used if the projected size is not smaller than the
+first threshold, level `1` if it's not smaller than the second one and so on,
+the last level (equal to @ref thresholds() count) being used for everything
+smaller. Drawables without bounding sphere and drawables with the sphere
+center behind the camera are always drawn with level `0`.
+
+## Usage
+
+The levels can be generated for example with @ref MeshTools::generateLods():
+@code
+class Model: public Object3D, SceneGraph::LodDrawable3D {
+    public:
+        explicit Model(Object3D* parent, SceneGraph::DrawableGroup3D* group): Object3D{parent}, SceneGraph::LodDrawable3D{*this, group} {
+            std::vector<Trade::MeshData3D> lods = MeshTools::generateLods(data, {1.0f, 0.25f, 0.05f});
+            // compile the levels into _meshes ...
+            setBoundingSphere({}, 1.0f);
+            setThresholds({0.3f, 0.05f});
+        }
+
+    private:
+        void drawLod(UnsignedInt level, const Matrix4& transformationMatrix, SceneGraph::AbstractCamera3D& camera) override {
+            _shader.setTransformationMatrix(transformationMatrix)
+                .setProjectionMatrix(camera.projectionMatrix());
+            _meshes[level].draw(_shader);
+        }
+
+        Mesh _meshes[3];
+        Shaders::Phong _shader;
+};
+@endcode
+
+@see @ref scenegraph, @ref BasicLodDrawable2D, @ref BasicLodDrawable3D,
+    @ref LodDrawable2D, @ref LodDrawable3D
+*/
+template<UnsignedInt dimensions, class T> class LodDrawable: public Drawable<dimensions, T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object this drawable belongs to
+         * @param drawables Group this drawable belongs to
+         *
+         * See @ref Drawable::Drawable() for more information. By default
+         * there are no thresholds, so level `0` is always used.
+         */
+        explicit LodDrawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables = nullptr);
+
+        /** @brief Projected size thresholds */
+        const std::vector<T>& thresholds() const { return _thresholds; }
+
+        /**
+         * @brief Set projected size thresholds
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the thresholds are positive and in decreasing order.
+         * The drawable has one level more than there are thresholds.
+         */
+        LodDrawable<dimensions, T>& setThresholds(std::vector<T> thresholds);
+
+        /**
+         * @brief Level used in last draw
+         *
+         * Initially `0`.
+         */
+        UnsignedInt level() const { return _level; }
+
+        /**
+         * @brief Projected size of the bounding sphere
+         * @param transformationMatrix  Object transformation relative to camera
+         * @param camera                Camera
+         *
+         * Fraction of viewport height covered by the bounding sphere
+         * diameter. If the drawable doesn't have a bounding sphere or its
+         * center is behind the camera, returns infinity.
+         */
+        T projectedSize(const MatrixTypeFor<dimensions, T>& transformationMatrix, const AbstractCamera<dimensions, T>& camera) const;
+
+        /**
+         * @brief Draw the object
+         *
+         * Selects the level based on @ref projectedSize() and calls
+         * @ref drawLod().
+         */
+        void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, AbstractCamera<dimensions, T>& camera) override;
+
+    private:
+        /**
+         * @brief Draw the object using given level of detail
+         * @param level                 Level of detail, `0` is the most
+         *      detailed
+         * @param transformationMatrix  Object transformation relative to camera
+         * @param camera                Camera
+         */
+        virtual void drawLod(UnsignedInt level, const MatrixTypeFor<dimensions, T>& transformationMatrix, AbstractCamera<dimensions, T>& camera) = 0;
+
+        std::vector<T> _thresholds;
+        UnsignedInt _level;
+};
+
+/**
+@brief Drawable with level of detail selection for two-dimensional scenes
+
+Convenience alternative to `LodDrawable<2, T>`. See @ref LodDrawable for more
+information.
+@see @ref LodDrawable2D, @ref BasicLodDrawable3D
+*/
+template<class T> using BasicLodDrawable2D = LodDrawable<2, T>;
+
+/**
+@brief Drawable with level of detail selection for two-dimensional float scenes
+
+@see @ref LodDrawable3D
+*/
+typedef BasicLodDrawable2D<Float> LodDrawable2D;
+
+/**
+@brief Drawable with level of detail selection for three-dimensional scenes
+
+Convenience alternative to `LodDrawable<3, T>`. See @ref LodDrawable for more
+information.
+@see @ref LodDrawable3D, @ref BasicLodDrawable2D
+*/
+template<class T> using BasicLodDrawable3D = LodDrawable<3, T>;
+
+/**
+@brief Drawable with level of detail selection for three-dimensional float scenes
+
+@see @ref LodDrawable2D
+*/
+typedef BasicLodDrawable3D<Float> LodDrawable3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT LodDrawable<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT LodDrawable<3, Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef Magnum_SceneGraph_LodDrawable_hpp
+#define Magnum_SceneGraph_LodDrawable_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref LodDrawable.h
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/SceneGraph/AbstractCamera.h"
+#include "Magnum/SceneGraph/Drawable.hpp"
+#include "Magnum/SceneGraph/LodDrawable.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> LodDrawable<dimensions, T>::LodDrawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): Drawable<dimensions, T>(object, drawables), _level{0} {}
+
+template<UnsignedInt dimensions, class T> LodDrawable<dimensions, T>& LodDrawable<dimensions, T>::setThresholds(std::vector<T> thresholds) {
+    for(std::size_t i = 0; i != thresholds.size(); ++i) {
+        CORRADE_ASSERT(thresholds[i] > T(0) && (i == 0 || thresholds[i] < thresholds[i - 1]),
+            "SceneGraph::LodDrawable::setThresholds(): expected positive thresholds in decreasing order", *this);
+    }
+
+    _thresholds = std::move(thresholds);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> T LodDrawable<dimensions, T>::projectedSize(const MatrixTypeFor<dimensions, T>& transformationMatrix, const AbstractCamera<dimensions, T>& camera) const {
+    if(!this->hasBoundingSphere()) return Math::Constants<T>::inf();
+
+    /* Transform the center and scale the radius by the largest scaling
+       factor, the same as when culling */
+    const VectorTypeFor<dimensions, T> center = transformationMatrix.transformPoint(this->boundingSphereCenter());
+    const auto rotationScaling = transformationMatrix.rotationScaling();
+    T scalingSquared{0};
+    for(UnsignedInt d = 0; d != dimensions; ++d)
+        scalingSquared = std::max(scalingSquared, rotationScaling[d].dot());
+    const T radius = this->boundingSphereRadius()*std::sqrt(scalingSquared);
+
+    /* Homogeneous coordinate of the projected center, it's the view depth
+       for perspective projections and 1 for orthographic ones */
+    const MatrixTypeFor<dimensions, T> projectionMatrix = camera.projectionMatrix();
+    T w = projectionMatrix[dimensions][dimensions];
+    for(UnsignedInt d = 0; d != dimensions; ++d)
+        w += projectionMatrix[d][dimensions]*center[d];
+    if(w <= T(0)) return Math::Constants<T>::inf();
+
+    /* Radius in normalized device coordinates, which span two units
+       vertically */
+    return radius*std::abs(projectionMatrix[1][1])/w;
+}
+
+template<UnsignedInt dimensions, class T> void LodDrawable<dimensions, T>::draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, AbstractCamera<dimensions, T>& camera) {
+    const T size = projectedSize(transformationMatrix, camera);
+
+    _level = 0;
+    while(_level != _thresholds.size() && size < _thresholds[_level]) ++_level;
+
+    drawLod(_level, transformationMatrix, camera);
+}
+
+}}
+
+#endif
@@ -47,6 +47,13 @@ namespace Implementation {
     typedef Containers::EnumSet<ObjectFlag> ObjectFlags;
 
     CORRADE_ENUMSET_OPERATORS(ObjectFlags)
+
+    /* Temporary storage for transformation calculation, kept in the scene
+       and reused across calls */
+    template<class Transformation> struct ObjectScratch {
+        std::vector<std::reference_wrapper<Object<Transformation>>> objects, pending, jointObjects;
+        std::vector<typename Transformation::DataType> transformations;
+    };
 }
 
 /**
@@ -272,7 +279,9 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         /**
          * @brief Transformation relative to root object
          *
-         * @see @ref absoluteTransformationMatrix()
+         * If the object is clean, returns the transformation cached during
+         * last @ref setClean(), otherwise it is computed from all parents.
+         * @see @ref absoluteTransformationMatrix(), @ref isDirty()
          */
         typename Transformation::DataType absoluteTransformation() const;
 
@@ -285,6 +294,16 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
          */
         std::vector<MatrixType> transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const MatrixType& initialTransformationMatrix = MatrixType()) const;
 
+        /**
+         * @brief Transformation matrices of given set of objects relative to this object into given array
+         *
+         * Same as above, but the matrices are put into @p out, which is
+         * expected to have the same size as @p objects. Temporary storage
+         * needed for the calculation is kept in the scene and reused, so the
+         * function doesn't allocate any memory in steady state.
+         */
+        void transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, Containers::ArrayReference<MatrixType> out, const MatrixType& initialTransformationMatrix = MatrixType()) const;
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         /**
          * @copybrief transformationMatrices()
@@ -306,13 +325,28 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
          * @brief Transformations of given group of objects relative to this object
          *
          * All transformations can be premultiplied with @p initialTransformation,
-         * if specified.
-         * @see @ref transformationMatrices()
+         * if specified. Absolute transformations of clean objects are cached,
+         * so only the subtrees that were marked dirty since last
+         * @ref setClean() are recomputed. If more than one thread is set
+         * using @ref SceneGraph::setThreadCount(), transformations of large
+         * hierarchies are computed in parallel.
+         * @see @ref transformationMatrices(), @ref setDirty()
          */
         /* `objects` passed by copy intentionally (to allow move from
            transformationMatrices() and avoid copy in the function itself) */
         std::vector<typename Transformation::DataType> transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& initialTransformation = typename Transformation::DataType()) const;
 
+        /**
+         * @brief Transformations of given group of objects relative to this object into given array
+         *
+         * Same as above, but the transformations are put into @p out, which
+         * is expected to have the same size as @p objects. Temporary storage
+         * needed for the calculation is kept in the scene and reused, so the
+         * function doesn't allocate any memory in steady state, except for
+         * the parallel calculation of large hierarchies.
+         */
+        void transformations(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, Containers::ArrayReference<typename Transformation::DataType> out, const typename Transformation::DataType& initialTransformation = typename Transformation::DataType()) const;
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         /**
          * @copybrief transformations()
@@ -405,7 +439,11 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
             return absoluteTransformationMatrix();
         }
 
-        std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix) const override final;
+        void doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, Containers::ArrayReference<MatrixType> out, const MatrixType& initialTransformationMatrix) const override final;
+
+        bool MAGNUM_SCENEGRAPH_LOCAL transformationsInternal(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, std::vector<typename Transformation::DataType>& jointTransformations, const typename Transformation::DataType& initialTransformation) const;
+
+        static void MAGNUM_SCENEGRAPH_LOCAL computeJointTransformationsParallel(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, std::size_t objectCount, const typename Transformation::DataType& initialTransformation);
 
         typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const;
 
@@ -414,12 +452,16 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final { setClean(); }
         void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) override final;
 
+        static void MAGNUM_SCENEGRAPH_LOCAL setCleanInternal(std::vector<std::reference_wrapper<Object<Transformation>>>& objects);
         void MAGNUM_SCENEGRAPH_LOCAL setCleanInternal(const typename Transformation::DataType& absoluteTransformation);
 
         typedef Implementation::ObjectFlag Flag;
         typedef Implementation::ObjectFlags Flags;
-        UnsignedShort counter;
+        UnsignedInt counter;
         Flags flags;
+
+        /* Absolute transformation, valid only if the object is clean */
+        typename Transformation::DataType _absoluteTransformation;
 };
 
 }}
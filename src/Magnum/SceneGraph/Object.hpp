@@ -32,12 +32,45 @@
 #include <algorithm>
 #include <stack>
 
+#include "Magnum/AllocationTracker.h"
 #include "Magnum/SceneGraph/AbstractTransformation.h"
 #include "Magnum/SceneGraph/Object.h"
 #include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/Threading.h"
 
 namespace Magnum { namespace SceneGraph {
 
+namespace Implementation {
+
+/* Borrows scratch vector of the scene for lifetime of the instance. If the
+   function using it gets called recursively (e.g. from feature clean()
+   implementation), the nested call gets an empty vector instead of
+   overwriting the one that's in use. */
+template<class T> class ScratchBorrow {
+    public:
+        explicit ScratchBorrow(std::vector<T>* storage): _storage{storage} {
+            if(_storage) std::swap(*_storage, _data);
+            _data.clear();
+        }
+
+        ScratchBorrow(const ScratchBorrow<T>&) = delete;
+
+        ~ScratchBorrow() {
+            if(_storage) std::swap(*_storage, _data);
+        }
+
+        ScratchBorrow<T>& operator=(const ScratchBorrow<T>&) = delete;
+
+        std::vector<T>& operator*() { return _data; }
+        std::vector<T>* operator->() { return &_data; }
+
+    private:
+        std::vector<T>* _storage;
+        std::vector<T> _data;
+};
+
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 template<UnsignedInt dimensions, class T> void AbstractObject<dimensions, T>::setClean(const std::vector<AbstractObject<dimensions, T>*>& objects) {
     std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> references;
@@ -95,7 +128,7 @@ template<UnsignedInt dimensions, class T> auto AbstractObject<dimensions, T>::tr
 
 template<UnsignedInt dimensions, class T> AbstractTransformation<dimensions, T>::AbstractTransformation() {}
 
-template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFu), flags(Flag::Dirty) {
+template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFFFFFu), flags(Flag::Dirty) {
     setParent(parent);
 }
 
@@ -156,6 +189,7 @@ template<class Transformation> Object<Transformation>& Object<Transformation>::s
 }
 
 template<class Transformation> typename Transformation::DataType Object<Transformation>::absoluteTransformation() const {
+    if(!isDirty()) return _absoluteTransformation;
     if(!parent()) return Transformation::transformation();
     return Implementation::Transformation<Transformation>::compose(parent()->absoluteTransformation(), Transformation::transformation());
 }
@@ -178,6 +212,8 @@ template<class Transformation> void Object<Transformation>::setDirty() {
 }
 
 template<class Transformation> void Object<Transformation>::setClean() {
+    MAGNUM_ALLOCATION_SCOPE(SceneGraph);
+
     /* The object (and all its parents) are already clean, nothing to do */
     if(!(flags & Flag::Dirty)) return;
 
@@ -214,24 +250,47 @@ template<class Transformation> void Object<Transformation>::setClean() {
     }
 }
 
-template<class Transformation> auto Object<Transformation>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix) const -> std::vector<MatrixType> {
-    std::vector<std::reference_wrapper<Object<Transformation>>> castObjects;
-    castObjects.reserve(objects.size());
+template<class Transformation> void Object<Transformation>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const Containers::ArrayReference<MatrixType> out, const MatrixType& initialTransformationMatrix) const {
+    MAGNUM_ALLOCATION_SCOPE(SceneGraph);
+
+    const Scene<Transformation>* scene = this->scene();
+    Implementation::ScratchBorrow<std::reference_wrapper<Object<Transformation>>> castObjects{scene ? &scene->_scratch.objects : nullptr};
+    castObjects->reserve(objects.size());
     /** @todo Ensure this doesn't crash, somehow */
-    for(auto o: objects) castObjects.push_back(static_cast<Object<Transformation>&>(o.get()));
+    for(auto o: objects) castObjects->push_back(static_cast<Object<Transformation>&>(o.get()));
 
-    return transformationMatrices(std::move(castObjects), initialTransformationMatrix);
+    transformationMatrices(*castObjects, out, initialTransformationMatrix);
 }
 
 template<class Transformation> auto Object<Transformation>::transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const MatrixType& initialTransformationMatrix) const -> std::vector<MatrixType> {
-    std::vector<typename Transformation::DataType> transformations = this->transformations(std::move(objects), Implementation::Transformation<Transformation>::fromMatrix(initialTransformationMatrix));
-    std::vector<MatrixType> transformationMatrices(transformations.size());
+    MAGNUM_ALLOCATION_SCOPE(SceneGraph);
+
+    std::vector<typename Transformation::DataType> transformations;
+    if(!transformationsInternal(objects, transformations, Implementation::Transformation<Transformation>::fromMatrix(initialTransformationMatrix)))
+        return {};
+
+    std::vector<MatrixType> transformationMatrices(objects.size());
     for(std::size_t i = 0; i != objects.size(); ++i)
         transformationMatrices[i] = Implementation::Transformation<Transformation>::toMatrix(transformations[i]);
 
     return transformationMatrices;
 }
 
+template<class Transformation> void Object<Transformation>::transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const Containers::ArrayReference<MatrixType> out, const MatrixType& initialTransformationMatrix) const {
+    MAGNUM_ALLOCATION_SCOPE(SceneGraph);
+
+    CORRADE_ASSERT(out.size() == objects.size(),
+        "SceneGraph::Object::transformationMatrices(): expected output array of size" << objects.size() << "but got" << out.size(), );
+
+    const Scene<Transformation>* scene = this->scene();
+    Implementation::ScratchBorrow<typename Transformation::DataType> transformations{scene ? &scene->_scratch.transformations : nullptr};
+    if(!transformationsInternal(objects, *transformations, Implementation::Transformation<Transformation>::fromMatrix(initialTransformationMatrix)))
+        return;
+
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        out[i] = Implementation::Transformation<Transformation>::toMatrix((*transformations)[i]);
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 template<class Transformation> auto Object<Transformation>::transformationMatrices(const std::vector<Object<Transformation>*>& objects, const MatrixType& initialTransformationMatrix) const -> std::vector<MatrixType> {
     std::vector<std::reference_wrapper<Object<Transformation>>> references;
@@ -258,6 +317,33 @@ template<class Transformation> auto Object<Transformation>::transformationMatric
 #endif
 #endif
 
+template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& initialTransformation) const {
+    MAGNUM_ALLOCATION_SCOPE(SceneGraph);
+
+    std::vector<typename Transformation::DataType> transformations;
+    if(!transformationsInternal(objects, transformations, initialTransformation))
+        return {};
+
+    /* Shrink the array to contain only transformations of requested objects
+       and return */
+    transformations.resize(objects.size());
+    return transformations;
+}
+
+template<class Transformation> void Object<Transformation>::transformations(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const Containers::ArrayReference<typename Transformation::DataType> out, const typename Transformation::DataType& initialTransformation) const {
+    MAGNUM_ALLOCATION_SCOPE(SceneGraph);
+
+    CORRADE_ASSERT(out.size() == objects.size(),
+        "SceneGraph::Object::transformations(): expected output array of size" << objects.size() << "but got" << out.size(), );
+
+    const Scene<Transformation>* scene = this->scene();
+    Implementation::ScratchBorrow<typename Transformation::DataType> transformations{scene ? &scene->_scratch.transformations : nullptr};
+    if(!transformationsInternal(objects, *transformations, initialTransformation))
+        return;
+
+    std::copy(transformations->begin(), transformations->begin() + objects.size(), out.begin());
+}
+
 /*
 Computing absolute transformations for given list of objects
 
@@ -271,37 +357,44 @@ divided into two groups:
 Then for all joints their transformation (relative to parent joint) is
 computed and recursively concatenated together. Resulting transformations for
 joints which were originally in `object` list is then returned.
+
+Clean objects have their absolute transformation cached, so the hierarchy is
+not walked above them -- they are treated the same way as root object.
 */
-template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& initialTransformation) const {
-    CORRADE_ASSERT(objects.size() < 0xFFFFu, "SceneGraph::Object::transformations(): too large scene", {});
+template<class Transformation> bool Object<Transformation>::transformationsInternal(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, std::vector<typename Transformation::DataType>& jointTransformations, const typename Transformation::DataType& initialTransformation) const {
+    CORRADE_ASSERT(objects.size() < 0xFFFFFFFFu, "SceneGraph::Object::transformations(): too large scene", false);
 
     /* Remember object count for later */
-    std::size_t objectCount = objects.size();
+    const std::size_t objectCount = objects.size();
 
     /* Mark all original objects as joints and create initial list of joints
        from them */
     for(std::size_t i = 0; i != objects.size(); ++i) {
         /* Multiple occurences of one object in the array, don't overwrite it
            with different counter */
-        if(objects[i].get().counter != 0xFFFFu) continue;
+        if(objects[i].get().counter != 0xFFFFFFFFu) continue;
 
-        objects[i].get().counter = UnsignedShort(i);
+        objects[i].get().counter = UnsignedInt(i);
         objects[i].get().flags |= Flag::Joint;
     }
-    std::vector<std::reference_wrapper<Object<Transformation>>> jointObjects(objects);
 
     /* Scene object */
     const Scene<Transformation>* scene = this->scene();
 
+    Implementation::ScratchBorrow<std::reference_wrapper<Object<Transformation>>> jointObjects{scene ? &scene->_scratch.jointObjects : nullptr};
+    jointObjects->assign(objects.begin(), objects.end());
+
     /* Nearest common ancestor not yet implemented - assert this is done on scene */
-    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
+    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", false);
 
     /* Mark all objects up the hierarchy as visited */
-    auto it = objects.begin();
-    while(!objects.empty()) {
+    Implementation::ScratchBorrow<std::reference_wrapper<Object<Transformation>>> pending{scene ? &scene->_scratch.pending : nullptr};
+    pending->assign(objects.begin(), objects.end());
+    auto it = pending->begin();
+    while(!pending->empty()) {
         /* Already visited, remove and continue to next (duplicate occurence) */
         if(it->get().flags & Flag::Visited) {
-            it = objects.erase(it);
+            it = pending->erase(it);
             continue;
         }
 
@@ -312,57 +405,66 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
 
         /* If this is root object, remove from list */
         if(!parent) {
-            CORRADE_ASSERT(&it->get() == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
-            it = objects.erase(it);
+            CORRADE_ASSERT(&it->get() == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", false);
+            it = pending->erase(it);
+
+        /* Clean object has cached absolute transformation, no need to go
+           further up */
+        } else if(!it->get().isDirty()) {
+            it = pending->erase(it);
 
         /* Parent is an joint or already visited - remove current from list */
         } else if(parent->flags & (Flag::Visited|Flag::Joint)) {
-            it = objects.erase(it);
+            it = pending->erase(it);
 
             /* If not already marked as joint, mark it as such and add it to
                list of joint objects */
             if(!(parent->flags & Flag::Joint)) {
-                CORRADE_ASSERT(jointObjects.size() < 0xFFFFu,
-                               "SceneGraph::Object::transformations(): too large scene", {});
-                CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFu);
-                parent->counter = UnsignedShort(jointObjects.size());
+                CORRADE_ASSERT(jointObjects->size() < 0xFFFFFFFFu,
+                               "SceneGraph::Object::transformations(): too large scene", false);
+                CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFFFFFu);
+                parent->counter = UnsignedInt(jointObjects->size());
                 parent->flags |= Flag::Joint;
-                jointObjects.push_back(*parent);
+                jointObjects->push_back(*parent);
             }
 
         /* Else go up the hierarchy */
         } else *it = *parent;
 
         /* Cycle if reached end */
-        if(it == objects.end()) it = objects.begin();
+        if(it == pending->end()) it = pending->begin();
     }
 
     /* Array of absolute transformations in joints */
-    std::vector<typename Transformation::DataType> jointTransformations(jointObjects.size());
+    jointTransformations.resize(jointObjects->size());
 
-    /* Compute transformations for all joints */
-    for(std::size_t i = 0; i != jointTransformations.size(); ++i)
-        computeJointTransformation(jointObjects, jointTransformations, i, initialTransformation);
+    /* Compute transformations for all joints, in parallel if enabled and
+       worth it */
+    if(threadCount() > 1 && jointObjects->size() >= 1024)
+        computeJointTransformationsParallel(*jointObjects, jointTransformations, objectCount, initialTransformation);
+    else for(std::size_t i = 0; i != jointTransformations.size(); ++i)
+        computeJointTransformation(*jointObjects, jointTransformations, i, initialTransformation);
 
     /* Copy transformation for second or next occurences from first occurence
        of duplicate object */
     for(std::size_t i = 0; i != objectCount; ++i) {
-        if(jointObjects[i].get().counter != i)
-            jointTransformations[i] = jointTransformations[jointObjects[i].get().counter];
+        if((*jointObjects)[i].get().counter != i)
+            jointTransformations[i] = jointTransformations[(*jointObjects)[i].get().counter];
     }
 
-    /* All visited marks are now cleaned, clean joint marks and counters */
-    for(auto i: jointObjects) {
+    /* All visited marks except for joints are now cleaned, clean joint and
+       remaining visited marks and counters */
+    for(auto i: *jointObjects) {
         /* All not-already cleaned objects (...duplicate occurences) should
            have joint mark */
-        CORRADE_INTERNAL_ASSERT(i.get().counter == 0xFFFFu || i.get().flags & Flag::Joint);
-        i.get().flags &= ~Flag::Joint;
-        i.get().counter = 0xFFFFu;
+        CORRADE_INTERNAL_ASSERT(i.get().counter == 0xFFFFFFFFu || i.get().flags & Flag::Joint);
+        i.get().flags &= ~(Flag::Joint|Flag::Visited);
+        i.get().counter = 0xFFFFFFFFu;
     }
 
-    /* Shrink the array to contain only transformations of requested objects and return */
-    jointTransformations.resize(objectCount);
-    return jointTransformations;
+    /* Transformations of requested objects are at the beginning of the
+       array */
+    return true;
 }
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -398,6 +500,13 @@ template<class Transformation> typename Transformation::DataType Object<Transfor
        either due to recursion or duplicate object occurences), done */
     if(!(o.get().flags & Flag::Visited)) return jointTransformations[joint];
 
+    /* Clean object, use cached absolute transformation */
+    if(!o.get().isDirty()) {
+        o.get().flags &= ~Flag::Visited;
+        return (jointTransformations[joint] =
+            Implementation::Transformation<Transformation>::compose(initialTransformation, o.get()._absoluteTransformation));
+    }
+
     /* Initialize transformation */
     jointTransformations[joint] = o.get().transformation();
 
@@ -420,6 +529,15 @@ template<class Transformation> typename Transformation::DataType Object<Transfor
             return (jointTransformations[joint] =
                 Implementation::Transformation<Transformation>::compose(computeJointTransformation(jointObjects, jointTransformations, parent->counter, initialTransformation), jointTransformations[joint]));
 
+        /* Clean object, compose transformation with its cached absolute
+           transformation, done */
+        } else if(!parent->isDirty()) {
+            CORRADE_INTERNAL_ASSERT(parent->flags & Flag::Visited);
+            parent->flags &= ~Flag::Visited;
+            return (jointTransformations[joint] =
+                Implementation::Transformation<Transformation>::compose(
+                    Implementation::Transformation<Transformation>::compose(initialTransformation, parent->_absoluteTransformation), jointTransformations[joint]));
+
         /* Else compose transformation with parent, go up the hierarchy */
         } else {
             jointTransformations[joint] = Implementation::Transformation<Transformation>::compose(parent->transformation(), jointTransformations[joint]);
@@ -428,16 +546,131 @@ template<class Transformation> typename Transformation::DataType Object<Transfor
     }
 }
 
+/*
+Parallel variant of the above. First, transformation of each joint relative to
+its parent joint is computed -- each non-joint object belongs to exactly one
+joint, so the paths can be processed concurrently, only their visited marks
+are cleared (marks of joints are cleared afterwards in transformations()).
+Then the joints are sorted by their depth in the joint tree and composed with
+their parent joints level by level. The order of operations is the same as in
+the serial variant, so the results are the same.
+*/
+template<class Transformation> void Object<Transformation>::computeJointTransformationsParallel(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t objectCount, const typename Transformation::DataType& initialTransformation) {
+    const std::size_t count = jointObjects.size();
+    constexpr UnsignedInt Root = 0xFFFFFFFFu;
+    std::vector<UnsignedInt> parentJoints(count, Root);
+
+    Implementation::parallelFor(count, 256, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            Object<Transformation>& o = jointObjects[i];
+
+            /* Duplicate occurence, copied from the first one afterwards */
+            if(i < objectCount && o.counter != i) continue;
+
+            /* Clean object, use cached absolute transformation */
+            if(!o.isDirty()) {
+                jointTransformations[i] = Implementation::Transformation<Transformation>::compose(initialTransformation, o._absoluteTransformation);
+                continue;
+            }
+
+            /* Go up until next joint or root */
+            typename Transformation::DataType transformation = o.transformation();
+            for(Object<Transformation>* current = &o;;) {
+                Object<Transformation>* parent = current->parent();
+
+                /* Root object, compose transformation with initial, done */
+                if(!parent) {
+                    transformation = Implementation::Transformation<Transformation>::compose(initialTransformation, transformation);
+                    break;
+
+                /* Joint object, composed with it in the second pass */
+                } else if(parent->flags & Flag::Joint) {
+                    parentJoints[i] = parent->counter;
+                    break;
+
+                /* Clean object, compose with its cached absolute
+                   transformation, done */
+                } else if(!parent->isDirty()) {
+                    parent->flags &= ~Flag::Visited;
+                    transformation = Implementation::Transformation<Transformation>::compose(
+                        Implementation::Transformation<Transformation>::compose(initialTransformation, parent->_absoluteTransformation), transformation);
+                    break;
+                }
+
+                /* Else compose transformation with parent, go up the
+                   hierarchy */
+                parent->flags &= ~Flag::Visited;
+                transformation = Implementation::Transformation<Transformation>::compose(parent->transformation(), transformation);
+                current = parent;
+            }
+
+            jointTransformations[i] = transformation;
+        }
+    });
+
+    /* Calculate depth of each joint in the joint tree, reusing depths of
+       already processed parents */
+    std::vector<UnsignedInt> depths(count, Root);
+    std::vector<UnsignedInt> path;
+    UnsignedInt maxDepth = 0;
+    for(std::size_t i = 0; i != count; ++i) {
+        UnsignedInt p = UnsignedInt(i);
+        while(p != Root && depths[p] == Root) {
+            path.push_back(p);
+            p = parentJoints[p];
+        }
+
+        UnsignedInt depth = p == Root ? 0 : depths[p] + 1;
+        for(auto it = path.rbegin(); it != path.rend(); ++it)
+            depths[*it] = depth++;
+        path.clear();
+
+        maxDepth = std::max(maxDepth, depths[i]);
+    }
+
+    /* Sort the joints by depth */
+    std::vector<UnsignedInt> offsets(maxDepth + 2);
+    for(const UnsignedInt depth: depths) ++offsets[depth + 1];
+    for(std::size_t i = 1; i != offsets.size(); ++i) offsets[i] += offsets[i - 1];
+    std::vector<UnsignedInt> sorted(count);
+    {
+        std::vector<UnsignedInt> positions(offsets.begin(), offsets.end() - 1);
+        for(std::size_t i = 0; i != count; ++i)
+            sorted[positions[depths[i]]++] = UnsignedInt(i);
+    }
+
+    /* Compose with parent joints level by level, joints on the first level
+       are already done */
+    for(UnsignedInt depth = 1; depth <= maxDepth; ++depth) {
+        const UnsignedInt levelBegin = offsets[depth];
+        Implementation::parallelFor(offsets[depth + 1] - levelBegin, 256, [&](const std::size_t begin, const std::size_t end) {
+            for(std::size_t i = levelBegin + begin; i != levelBegin + end; ++i) {
+                const UnsignedInt joint = sorted[i];
+                jointTransformations[joint] = Implementation::Transformation<Transformation>::compose(jointTransformations[parentJoints[joint]], jointTransformations[joint]);
+            }
+        });
+    }
+}
+
 template<class Transformation> void Object<Transformation>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) {
-    std::vector<std::reference_wrapper<Object<Transformation>>> castObjects;
-    castObjects.reserve(objects.size());
+    MAGNUM_ALLOCATION_SCOPE(SceneGraph);
+
+    const Scene<Transformation>* scene = this->scene();
+    Implementation::ScratchBorrow<std::reference_wrapper<Object<Transformation>>> castObjects{scene ? &scene->_scratch.objects : nullptr};
+    castObjects->reserve(objects.size());
     /** @todo Ensure this doesn't crash, somehow */
-    for(auto o: objects) castObjects.push_back(static_cast<Object<Transformation>&>(o.get()));
+    for(auto o: objects) castObjects->push_back(static_cast<Object<Transformation>&>(o.get()));
 
-    setClean(std::move(castObjects));
+    setCleanInternal(*castObjects);
 }
 
 template<class Transformation> void Object<Transformation>::setClean(std::vector<std::reference_wrapper<Object<Transformation>>> objects) {
+    setCleanInternal(objects);
+}
+
+template<class Transformation> void Object<Transformation>::setCleanInternal(std::vector<std::reference_wrapper<Object<Transformation>>>& objects) {
+    MAGNUM_ALLOCATION_SCOPE(SceneGraph);
+
     /* Remove all clean objects from the list */
     auto firstClean = std::remove_if(objects.begin(), objects.end(), [](Object<Transformation>& o) { return !o.isDirty(); });
     objects.erase(firstClean, objects.end());
@@ -464,14 +697,16 @@ template<class Transformation> void Object<Transformation>::setClean(std::vector
     /* Compute absolute transformations */
     Scene<Transformation>* scene = objects[0].get().scene();
     CORRADE_ASSERT(scene, "Object::setClean(): objects must be part of some scene", );
-    std::vector<typename Transformation::DataType> transformations(scene->transformations(objects));
+    Implementation::ScratchBorrow<typename Transformation::DataType> transformations{&scene->_scratch.transformations};
+    if(!scene->transformationsInternal(objects, *transformations, typename Transformation::DataType()))
+        return;
 
     /* Go through all objects and clean them */
     for(std::size_t i = 0; i != objects.size(); ++i) {
         /* The object might be duplicated in the list, don't clean it more than once */
         if(!objects[i].get().isDirty()) continue;
 
-        objects[i].get().setCleanInternal(transformations[i]);
+        objects[i].get().setCleanInternal((*transformations)[i]);
         CORRADE_ASSERT(!objects[i].get().isDirty(), "SceneGraph::Object::setClean(): original implementation was not called", );
     }
 }
@@ -533,7 +768,8 @@ template<class Transformation> void Object<Transformation>::setCleanInternal(con
         }
     }
 
-    /* Mark object as clean */
+    /* Cache the transformation and mark object as clean */
+    _absoluteTransformation = absoluteTransformation;
     flags &= ~Flag::Dirty;
 }
 
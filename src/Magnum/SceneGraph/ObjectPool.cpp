@@ -0,0 +1,121 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ObjectPool.h"
+
+#include <new>
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace SceneGraph {
+
+namespace {
+    /* Stored in front of each object, padded to keep the object aligned */
+    struct Header {
+        ObjectPool* pool;
+        std::size_t size;
+    };
+
+    static_assert(sizeof(Header) <= ObjectPool::Alignment, "header doesn't fit into the alignment");
+
+    std::size_t sizeClass(const std::size_t size) {
+        return (size + ObjectPool::Alignment - 1)/ObjectPool::Alignment;
+    }
+}
+
+ObjectPool::ObjectPool(const std::size_t chunkSize): _chunkSize{chunkSize}, _chunkUsed{chunkSize}, _allocationCount{}, _freeLists(sizeClass(MaxPooledSize) + 1) {
+    CORRADE_ASSERT(chunkSize >= MaxPooledSize,
+        "SceneGraph::ObjectPool: chunk size must be at least" << std::size_t(MaxPooledSize), );
+}
+
+ObjectPool::~ObjectPool() {
+    CORRADE_ASSERT(!_allocationCount,
+        "SceneGraph::ObjectPool: destroyed with" << _allocationCount << "live allocations", );
+}
+
+void* ObjectPool::allocate(const std::size_t size) {
+    ++_allocationCount;
+
+    const std::size_t index = sizeClass(size);
+    if(index >= _freeLists.size()) return ::operator new(size);
+
+    /* Reuse previously freed memory of the same size */
+    if(void* const pointer = _freeLists[index]) {
+        _freeLists[index] = *static_cast<void**>(pointer);
+        return pointer;
+    }
+
+    /* Take a new piece of current chunk, allocate a new chunk if there's not
+       enough space left */
+    const std::size_t alignedSize = index*Alignment;
+    if(_chunkUsed + alignedSize > _chunkSize) {
+        _chunks.emplace_back(new char[_chunkSize]);
+        _chunkUsed = 0;
+    }
+
+    void* const pointer = _chunks.back().get() + _chunkUsed;
+    _chunkUsed += alignedSize;
+    return pointer;
+}
+
+void ObjectPool::deallocate(void* const pointer, const std::size_t size) {
+    --_allocationCount;
+
+    const std::size_t index = sizeClass(size);
+    if(index >= _freeLists.size()) return ::operator delete(pointer);
+
+    *static_cast<void**>(pointer) = _freeLists[index];
+    _freeLists[index] = pointer;
+}
+
+namespace Implementation {
+
+void* PoolAllocated::operator new(const std::size_t size) {
+    char* const memory = static_cast<char*>(::operator new(size + ObjectPool::Alignment));
+    new(memory) Header{nullptr, size};
+    return memory + ObjectPool::Alignment;
+}
+
+void* PoolAllocated::operator new(const std::size_t size, ObjectPool& pool) {
+    char* const memory = static_cast<char*>(pool.allocate(size + ObjectPool::Alignment));
+    new(memory) Header{&pool, size};
+    return memory + ObjectPool::Alignment;
+}
+
+void PoolAllocated::operator delete(void* const pointer) {
+    if(!pointer) return;
+
+    char* const memory = static_cast<char*>(pointer) - ObjectPool::Alignment;
+    const Header& header = *reinterpret_cast<Header*>(memory);
+    if(header.pool) header.pool->deallocate(memory, header.size + ObjectPool::Alignment);
+    else ::operator delete(memory);
+}
+
+void PoolAllocated::operator delete(void* const pointer, ObjectPool&) {
+    operator delete(pointer);
+}
+
+}
+
+}}
@@ -0,0 +1,154 @@
+#ifndef Magnum_SceneGraph_ObjectPool_h
+#define Magnum_SceneGraph_ObjectPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::ObjectPool
+ */
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Magnum/Types.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Memory pool for objects and features
+
+By default each @ref Object and feature is allocated separately on the heap,
+which for large scenes means hundreds of thousands of scattered small
+allocations and slow teardown. Objects and features can be instead allocated
+from a pool by passing it to `new`:
+@code
+SceneGraph::ObjectPool pool;
+Scene3D scene;
+
+for(std::size_t i = 0; i != 200000; ++i) {
+    Object3D* object = new(pool) Object3D{&scene};
+    new(pool) MyDrawable{*object, &drawables};
+}
+@endcode
+
+The memory is taken from large chunks, so objects created together are close
+to each other in memory. Deleted objects return the memory to a per-size free
+list of the pool, so deleting them is cheap and the memory is reused by
+further allocations of the same size. The chunks are released all at once on
+pool destruction. The objects are deleted as usual, either explicitly or by
+deleting their parent, heap-allocated and pool-allocated objects can be freely
+mixed in one hierarchy.
+
+The pool must outlive all objects allocated from it, in particular it must be
+declared before the scene it is used for. Allocating objects larger than
+@ref MaxPooledSize falls back to heap allocation. The pool is not
+thread-safe.
+*/
+class MAGNUM_SCENEGRAPH_EXPORT ObjectPool {
+    public:
+        enum: std::size_t {
+            /** Size alignment of pooled allocations */
+            Alignment = 16,
+
+            /** Max size of pooled allocation */
+            MaxPooledSize = 1024
+        };
+
+        /**
+         * @brief Constructor
+         * @param chunkSize     Size of memory chunks, in bytes
+         */
+        explicit ObjectPool(std::size_t chunkSize = 65536);
+
+        /** @brief Copying is not allowed */
+        ObjectPool(const ObjectPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ObjectPool(ObjectPool&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Expects that all objects allocated from the pool were deleted.
+         */
+        ~ObjectPool();
+
+        /** @brief Copying is not allowed */
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ObjectPool& operator=(ObjectPool&&) = delete;
+
+        /** @brief Count of live allocations */
+        std::size_t allocationCount() const { return _allocationCount; }
+
+        /** @brief Count of allocated memory chunks */
+        std::size_t chunkCount() const { return _chunks.size(); }
+
+        /**
+         * @brief Allocate memory
+         *
+         * The returned memory is aligned to @ref Alignment. Used by the
+         * placement `new` of @ref Object and features, you don't need to call
+         * this directly.
+         */
+        void* allocate(std::size_t size);
+
+        /**
+         * @brief Deallocate memory
+         *
+         * The @p size must be the same as was passed to @ref allocate().
+         */
+        void deallocate(void* pointer, std::size_t size);
+
+    private:
+        std::size_t _chunkSize, _chunkUsed, _allocationCount;
+        std::vector<std::unique_ptr<char[]>> _chunks;
+        std::vector<void*> _freeLists;
+};
+
+namespace Implementation {
+
+/* Base of AbstractObject and AbstractFeature, providing allocation from
+   ObjectPool. Each allocation has a header with the pool it came from (or
+   nullptr if it is on the heap) so the deletion doesn't need to know. As
+   the operators are static, classes deriving from both AbstractObject and
+   AbstractFeature don't have any ambiguity. */
+struct MAGNUM_SCENEGRAPH_EXPORT PoolAllocated {
+    static void* operator new(std::size_t size);
+    static void* operator new(std::size_t size, ObjectPool& pool);
+    static void* operator new(std::size_t, void* pointer) { return pointer; }
+    static void operator delete(void* pointer);
+    static void operator delete(void* pointer, ObjectPool&);
+    static void operator delete(void*, void*) {}
+};
+
+}
+
+}}
+
+#endif
@@ -40,11 +40,15 @@ Basically @ref Object which cannot have parent or non-default transformation.
 See @ref scenegraph for introduction.
 */
 template<class Transformation> class Scene: public Object<Transformation> {
+    friend Object<Transformation>;
+
     public:
         explicit Scene() = default;
 
     private:
         bool isScene() const override final { return true; }
+
+        mutable Implementation::ObjectScratch<Transformation> _scratch;
 };
 
 }}
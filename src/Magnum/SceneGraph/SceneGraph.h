@@ -105,6 +105,12 @@ template<class> class BasicCamera3D;
 typedef BasicCamera2D<Float> Camera2D;
 typedef BasicCamera3D<Float> Camera3D;
 
+template<class> class BasicCubeMapCamera3D;
+typedef BasicCubeMapCamera3D<Float> CubeMapCamera3D;
+
+enum class CellState: UnsignedByte;
+template<class, class> class CellStreamer;
+
 template<UnsignedInt, class> class Drawable;
 template<class T> using BasicDrawable2D = Drawable<2, T>;
 template<class T> using BasicDrawable3D = Drawable<3, T>;
@@ -128,12 +134,34 @@ template<class T> using BasicDrawableGroup3D = DrawableGroup<3, T>;
 typedef BasicDrawableGroup2D<Float> DrawableGroup2D;
 typedef BasicDrawableGroup3D<Float> DrawableGroup3D;
 
+template<UnsignedInt, class> class Interpolable;
+template<class T> using BasicInterpolable2D = Interpolable<2, T>;
+template<class T> using BasicInterpolable3D = Interpolable<3, T>;
+typedef BasicInterpolable2D<Float> Interpolable2D;
+typedef BasicInterpolable3D<Float> Interpolable3D;
+
+template<UnsignedInt, class> class InterpolableGroup;
+template<class T> using BasicInterpolableGroup2D = InterpolableGroup<2, T>;
+template<class T> using BasicInterpolableGroup3D = InterpolableGroup<3, T>;
+typedef BasicInterpolableGroup2D<Float> InterpolableGroup2D;
+typedef BasicInterpolableGroup3D<Float> InterpolableGroup3D;
+
+template<class> class BasicKeyframeAnimator3D;
+typedef BasicKeyframeAnimator3D<Float> KeyframeAnimator3D;
+
+template<UnsignedInt, class> class LodDrawable;
+template<class T> using BasicLodDrawable2D = LodDrawable<2, T>;
+template<class T> using BasicLodDrawable3D = LodDrawable<3, T>;
+typedef BasicLodDrawable2D<Float> LodDrawable2D;
+typedef BasicLodDrawable3D<Float> LodDrawable3D;
+
 template<class> class BasicMatrixTransformation2D;
 template<class> class BasicMatrixTransformation3D;
 typedef BasicMatrixTransformation2D<Float> MatrixTransformation2D;
 typedef BasicMatrixTransformation3D<Float> MatrixTransformation3D;
 
 template<class Transformation> class Object;
+class ObjectPool;
 
 template<class> class BasicRigidMatrixTransformation2D;
 template<class> class BasicRigidMatrixTransformation3D;
@@ -142,6 +170,24 @@ typedef BasicRigidMatrixTransformation3D<Float> RigidMatrixTransformation3D;
 
 template<class Transformation> class Scene;
 
+template<UnsignedInt, class> class SpatialFeature;
+template<class T> using BasicSpatialFeature2D = SpatialFeature<2, T>;
+template<class T> using BasicSpatialFeature3D = SpatialFeature<3, T>;
+typedef BasicSpatialFeature2D<Float> SpatialFeature2D;
+typedef BasicSpatialFeature3D<Float> SpatialFeature3D;
+
+template<UnsignedInt, class> class SpatialIndex;
+template<class T> using BasicSpatialIndex2D = SpatialIndex<2, T>;
+template<class T> using BasicSpatialIndex3D = SpatialIndex<3, T>;
+typedef BasicSpatialIndex2D<Float> SpatialIndex2D;
+typedef BasicSpatialIndex3D<Float> SpatialIndex3D;
+
+enum class StereoEye: UnsignedByte;
+template<class> class BasicStereoCamera3D;
+typedef BasicStereoCamera3D<Float> StereoCamera3D;
+
+template<class> class TransformationArray;
+
 template<UnsignedInt, class T, class = T> class TranslationTransformation;
 template<class T, class TranslationType = T> using BasicTranslationTransformation2D = TranslationTransformation<2, T, TranslationType>;
 template<class T, class TranslationType = T> using BasicTranslationTransformation3D = TranslationTransformation<3, T, TranslationType>;
@@ -0,0 +1,359 @@
+#ifndef Magnum_SceneGraph_SpatialIndex_h
+#define Magnum_SceneGraph_SpatialIndex_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::SpatialFeature, @ref Magnum::SceneGraph::SpatialIndex, alias @ref Magnum::SceneGraph::BasicSpatialFeature2D, @ref Magnum::SceneGraph::BasicSpatialFeature3D, @ref Magnum::SceneGraph::BasicSpatialIndex2D, @ref Magnum::SceneGraph::BasicSpatialIndex3D, typedef @ref Magnum::SceneGraph::SpatialFeature2D, @ref Magnum::SceneGraph::SpatialFeature3D, @ref Magnum::SceneGraph::SpatialIndex2D, @ref Magnum::SceneGraph::SpatialIndex3D
+ */
+
+#include <unordered_map>
+#include <vector>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/SceneGraph/AbstractGroupedFeature.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Feature tracking object bounds in a spatial index
+
+Holds axis-aligned bounds of the object in object-local space. The bounds
+are transformed into world space (as an axis-aligned box enclosing the
+transformed local box) when the object is cleaned and the feature is moved
+to corresponding place in its @ref SpatialIndex. See @ref SpatialIndex for
+more information.
+@see @ref SpatialFeature2D, @ref SpatialFeature3D
+*/
+template<UnsignedInt dimensions, class T> class SpatialFeature: public AbstractGroupedFeature<dimensions, SpatialFeature<dimensions, T>, T> {
+    friend SpatialIndex<dimensions, T>;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object this feature will be attached to
+         * @param bounds    Bounds in object-local space
+         * @param index     Spatial index this feature belongs to
+         *
+         * Adds the feature to the index, if specified.
+         */
+        explicit SpatialFeature(AbstractObject<dimensions, T>& object, const RangeTypeFor<dimensions, T>& bounds, SpatialIndex<dimensions, T>* index = nullptr);
+
+        /**
+         * @brief Destructor
+         *
+         * Removes the feature from the index, if any.
+         */
+        ~SpatialFeature();
+
+        /**
+         * @brief Spatial index containing this feature
+         *
+         * If the feature doesn't belong to any index, returns `nullptr`.
+         */
+        SpatialIndex<dimensions, T>* index();
+        const SpatialIndex<dimensions, T>* index() const; /**< @overload */
+
+        /** @brief Bounds in object-local space */
+        RangeTypeFor<dimensions, T> bounds() const { return _bounds; }
+
+        /**
+         * @brief Set bounds in object-local space
+         * @return Reference to self (for method chaining)
+         *
+         * The feature is moved in the index on next @ref SpatialIndex::update().
+         */
+        SpatialFeature<dimensions, T>& setBounds(const RangeTypeFor<dimensions, T>& bounds);
+
+        /**
+         * @brief Bounds in world space
+         *
+         * Updated in @ref SpatialIndex::update(), which is called implicitly
+         * from all queries.
+         */
+        RangeTypeFor<dimensions, T> absoluteBounds() const { return _absoluteBounds; }
+
+    protected:
+        /** Schedules update of the feature in the index */
+        void markDirty() override;
+
+        /** Recalculates absolute bounds */
+        void clean(const MatrixTypeFor<dimensions, T>& absoluteTransformationMatrix) override;
+
+    private:
+        void enqueue();
+
+        RangeTypeFor<dimensions, T> _bounds, _absoluteBounds;
+        UnsignedLong _node;
+        std::size_t _nodeIndex;
+        bool _queued, _boundsDirty;
+};
+
+/**
+@brief Spatial index of object bounds
+
+Group of @ref SpatialFeature instances organized in a loose octree (in 3D) or
+loose quadtree (in 2D), answering box, sphere and frustum queries without
+walking the whole scene.
+
+Each feature is stored in the deepest node whose cell is at least as large as
+the feature bounds on every axis, at the cell containing center of the
+bounds. Node bounds are enlarged by half of the cell size on each side, so
+every feature fits into the "loose" bounds of its node and never needs to be
+split between multiple nodes. Nodes are allocated only for cells that contain
+some features. Features with bounds center outside of @ref bounds() or with
+bounds larger than them are kept in a separate list which is tested by all
+queries.
+
+## Incremental updates
+
+The features are updated from the object dirty mechanism --- when an object
+with a spatial feature is marked as dirty or its feature bounds are changed,
+the feature is put into an update queue. @ref update(), called implicitly from
+all queries, cleans the queued objects, recomputes their world bounds and
+moves the features into new nodes if needed. The cost of the update is thus
+proportional to count of changed objects, not to count of all objects in the
+index.
+
+## Usage
+
+@code
+SceneGraph::SpatialIndex3D index{{{-1000.0f, -100.0f, -1000.0f}, {1000.0f, 100.0f, 1000.0f}}};
+
+// unit cube around each object
+for(Object3D* object: objects)
+    new SceneGraph::SpatialFeature3D{*object, {Vector3{-0.5f}, Vector3{0.5f}}, &index};
+
+// all objects within 50 m from the player
+std::vector<SceneGraph::SpatialFeature3D*> nearby;
+index.querySphere(player.absoluteTransformation().translation(), 50.0f, nearby);
+
+// all objects visible from a camera
+std::vector<SceneGraph::SpatialFeature3D*> visible;
+index.queryCamera(camera, visible);
+@endcode
+
+All queries only append to the output vector, so it can be reused across
+frames to avoid allocations. The features are reported in no particular
+order.
+@see @ref SpatialIndex2D, @ref SpatialIndex3D
+*/
+template<UnsignedInt dimensions, class T> class SpatialIndex: public FeatureGroup<dimensions, SpatialFeature<dimensions, T>, T> {
+    friend SpatialFeature<dimensions, T>;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param bounds    World bounds covered by the tree
+         * @param maxDepth  Max depth of the tree, at most `15`
+         */
+        explicit SpatialIndex(const RangeTypeFor<dimensions, T>& bounds, UnsignedInt maxDepth = 8);
+
+        /**
+         * @brief Destructor
+         *
+         * Removes all features from the index, but not deletes them.
+         */
+        ~SpatialIndex();
+
+        /** @brief World bounds covered by the tree */
+        RangeTypeFor<dimensions, T> bounds() const { return _bounds; }
+
+        /** @brief Max depth of the tree */
+        UnsignedInt maxDepth() const { return _maxDepth; }
+
+        /**
+         * @brief Count of allocated tree nodes
+         *
+         * Including nodes that contain no features directly but have some
+         * in their subtree.
+         */
+        std::size_t nodeCount() const { return _nodes.size(); }
+
+        /**
+         * @brief Add feature to the index
+         * @return Reference to self (for method chaining)
+         *
+         * If the feature is part of another index, it is removed from it.
+         * Hides @ref FeatureGroup::add(), which doesn't update the tree.
+         */
+        SpatialIndex<dimensions, T>& add(SpatialFeature<dimensions, T>& feature);
+
+        /**
+         * @brief Remove feature from the index
+         * @return Reference to self (for method chaining)
+         *
+         * The feature must be part of the index. Hides
+         * @ref FeatureGroup::remove(), which doesn't update the tree.
+         */
+        SpatialIndex<dimensions, T>& remove(SpatialFeature<dimensions, T>& feature);
+
+        /**
+         * @brief Update changed features
+         *
+         * Cleans objects of all features changed since last update,
+         * recomputes their world bounds and moves them in the tree. Called
+         * implicitly from all queries.
+         * @see @ref AbstractObject::setClean()
+         */
+        void update();
+
+        /**
+         * @brief Query features intersecting given box
+         *
+         * Appends all features with world bounds intersecting @p box to
+         * @p out.
+         */
+        void queryBox(const RangeTypeFor<dimensions, T>& box, std::vector<SpatialFeature<dimensions, T>*>& out);
+
+        /**
+         * @brief Query features intersecting given sphere
+         *
+         * Appends all features with world bounds intersecting sphere with
+         * given @p center and @p radius to @p out.
+         */
+        void querySphere(const VectorTypeFor<dimensions, T>& center, T radius, std::vector<SpatialFeature<dimensions, T>*>& out);
+
+        /**
+         * @brief Query features intersecting given frustum
+         * @param matrix    Projection matrix multiplied with camera matrix
+         * @param out       Output vector
+         *
+         * Appends all features with world bounds not lying completely
+         * outside of any frustum plane to @p out. The test is conservative,
+         * features near frustum corners might be reported even if they are
+         * not visible.
+         */
+        void queryFrustum(const MatrixTypeFor<dimensions, T>& matrix, std::vector<SpatialFeature<dimensions, T>*>& out);
+
+        /**
+         * @brief Query features visible from given camera
+         *
+         * Equivalent to calling @ref queryFrustum() with
+         * @ref AbstractCamera::projectionMatrix() multiplied with
+         * @ref AbstractCamera::cameraMatrix().
+         */
+        void queryCamera(AbstractCamera<dimensions, T>& camera, std::vector<SpatialFeature<dimensions, T>*>& out);
+
+    private:
+        struct Node {
+            std::vector<SpatialFeature<dimensions, T>*> features;
+
+            /* Count of features in the node and all its children */
+            std::size_t count;
+        };
+
+        enum: UnsignedLong {
+            NotInserted = ~UnsignedLong{},
+            Outside = ~UnsignedLong{} - 1
+        };
+
+        UnsignedLong nodeFor(const RangeTypeFor<dimensions, T>& bounds) const;
+        RangeTypeFor<dimensions, T> looseBounds(UnsignedLong node) const;
+        void insert(SpatialFeature<dimensions, T>& feature, UnsignedLong node);
+        void erase(SpatialFeature<dimensions, T>& feature);
+        template<class Test> void query(const Test& test, std::vector<SpatialFeature<dimensions, T>*>& out);
+
+        RangeTypeFor<dimensions, T> _bounds;
+        UnsignedInt _maxDepth;
+        std::unordered_map<UnsignedLong, Node> _nodes;
+        std::vector<SpatialFeature<dimensions, T>*> _outside, _queue;
+};
+
+/**
+@brief Spatial feature for two-dimensional scenes
+
+Convenience alternative to `SpatialFeature<2, T>`. See @ref SpatialIndex for
+more information.
+@see @ref SpatialFeature2D, @ref BasicSpatialFeature3D
+*/
+template<class T> using BasicSpatialFeature2D = SpatialFeature<2, T>;
+
+/**
+@brief Spatial feature for two-dimensional float scenes
+
+@see @ref SpatialFeature3D
+*/
+typedef BasicSpatialFeature2D<Float> SpatialFeature2D;
+
+/**
+@brief Spatial feature for three-dimensional scenes
+
+Convenience alternative to `SpatialFeature<3, T>`. See @ref SpatialIndex for
+more information.
+@see @ref SpatialFeature3D, @ref BasicSpatialFeature2D
+*/
+template<class T> using BasicSpatialFeature3D = SpatialFeature<3, T>;
+
+/**
+@brief Spatial feature for three-dimensional float scenes
+
+@see @ref SpatialFeature2D
+*/
+typedef BasicSpatialFeature3D<Float> SpatialFeature3D;
+
+/**
+@brief Spatial index for two-dimensional scenes
+
+Convenience alternative to `SpatialIndex<2, T>`. See @ref SpatialIndex for
+more information.
+@see @ref SpatialIndex2D, @ref BasicSpatialIndex3D
+*/
+template<class T> using BasicSpatialIndex2D = SpatialIndex<2, T>;
+
+/**
+@brief Spatial index for two-dimensional float scenes
+
+@see @ref SpatialIndex3D
+*/
+typedef BasicSpatialIndex2D<Float> SpatialIndex2D;
+
+/**
+@brief Spatial index for three-dimensional scenes
+
+Convenience alternative to `SpatialIndex<3, T>`. See @ref SpatialIndex for
+more information.
+@see @ref SpatialIndex3D, @ref BasicSpatialIndex2D
+*/
+template<class T> using BasicSpatialIndex3D = SpatialIndex<3, T>;
+
+/**
+@brief Spatial index for three-dimensional float scenes
+
+@see @ref SpatialIndex2D
+*/
+typedef BasicSpatialIndex3D<Float> SpatialIndex3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT SpatialFeature<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT SpatialFeature<3, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT SpatialIndex<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT SpatialIndex<3, Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,373 @@
+#ifndef Magnum_SceneGraph_SpatialIndex_hpp
+#define Magnum_SceneGraph_SpatialIndex_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref SpatialIndex.h
+ */
+
+#include <algorithm>
+#include <functional>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/AbstractCamera.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/FeatureGroup.hpp"
+#include "Magnum/SceneGraph/SpatialIndex.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+/* Node key is the tree level in the top bits and cell coordinates on given
+   level packed in 16 bits per axis */
+constexpr UnsignedLong spatialIndexNodeKey(UnsignedInt level, UnsignedInt x, UnsignedInt y, UnsignedInt z) {
+    return UnsignedLong(level) << 48 | UnsignedLong(z) << 32 | UnsignedLong(y) << 16 | UnsignedLong(x);
+}
+
+constexpr UnsignedInt spatialIndexNodeLevel(UnsignedLong key) {
+    return UnsignedInt(key >> 48);
+}
+
+constexpr UnsignedInt spatialIndexNodeCoordinate(UnsignedLong key, UnsignedInt axis) {
+    return UnsignedInt(key >> 16*axis) & 0xffff;
+}
+
+template<UnsignedInt dimensions, class T> inline bool spatialIndexOverlaps(const RangeTypeFor<dimensions, T>& a, const RangeTypeFor<dimensions, T>& b) {
+    return (a.min() <= b.max()).all() && (b.min() <= a.max()).all();
+}
+
+}
+
+template<UnsignedInt dimensions, class T> SpatialFeature<dimensions, T>::SpatialFeature(AbstractObject<dimensions, T>& object, const RangeTypeFor<dimensions, T>& bounds, SpatialIndex<dimensions, T>* index): AbstractGroupedFeature<dimensions, SpatialFeature<dimensions, T>, T>(object), _bounds{bounds}, _node{SpatialIndex<dimensions, T>::NotInserted}, _nodeIndex{}, _queued{false}, _boundsDirty{true} {
+    AbstractFeature<dimensions, T>::setCachedTransformations(CachedTransformation::Absolute);
+
+    /* Not passing the index to the base constructor, as it would bypass the
+       tree */
+    if(index) index->add(*this);
+}
+
+template<UnsignedInt dimensions, class T> SpatialFeature<dimensions, T>::~SpatialFeature() {
+    /* Remove from the tree before the base destructor removes the feature
+       just from the group */
+    if(SpatialIndex<dimensions, T>* const i = index()) i->remove(*this);
+}
+
+template<UnsignedInt dimensions, class T> SpatialIndex<dimensions, T>* SpatialFeature<dimensions, T>::index() {
+    return static_cast<SpatialIndex<dimensions, T>*>(this->group());
+}
+
+template<UnsignedInt dimensions, class T> const SpatialIndex<dimensions, T>* SpatialFeature<dimensions, T>::index() const {
+    return static_cast<const SpatialIndex<dimensions, T>*>(this->group());
+}
+
+template<UnsignedInt dimensions, class T> SpatialFeature<dimensions, T>& SpatialFeature<dimensions, T>::setBounds(const RangeTypeFor<dimensions, T>& bounds) {
+    _bounds = bounds;
+    _boundsDirty = true;
+    enqueue();
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> void SpatialFeature<dimensions, T>::markDirty() {
+    enqueue();
+}
+
+template<UnsignedInt dimensions, class T> void SpatialFeature<dimensions, T>::clean(const MatrixTypeFor<dimensions, T>& absoluteTransformationMatrix) {
+    /* Axis-aligned box enclosing the transformed local box */
+    const VectorTypeFor<dimensions, T> center = absoluteTransformationMatrix.transformPoint(_bounds.center());
+    const VectorTypeFor<dimensions, T> halfSize = _bounds.size()/T(2);
+    const auto rotationScaling = absoluteTransformationMatrix.rotationScaling();
+    VectorTypeFor<dimensions, T> transformedHalfSize;
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        transformedHalfSize += Math::abs(rotationScaling[i])*halfSize[i];
+
+    _absoluteBounds = {center - transformedHalfSize, center + transformedHalfSize};
+    _boundsDirty = false;
+}
+
+template<UnsignedInt dimensions, class T> void SpatialFeature<dimensions, T>::enqueue() {
+    SpatialIndex<dimensions, T>* const i = index();
+    if(!i || _queued) return;
+
+    _queued = true;
+    i->_queue.push_back(this);
+}
+
+template<UnsignedInt dimensions, class T> SpatialIndex<dimensions, T>::SpatialIndex(const RangeTypeFor<dimensions, T>& bounds, const UnsignedInt maxDepth): _bounds{bounds}, _maxDepth{maxDepth} {
+    CORRADE_ASSERT(maxDepth <= 15,
+        "SceneGraph::SpatialIndex: max depth can't be larger than 15, got" << maxDepth, );
+}
+
+template<UnsignedInt dimensions, class T> SpatialIndex<dimensions, T>::~SpatialIndex() {
+    /* The base destructor detaches the features from the group, reset the
+       tree state so they can be added to another index later */
+    for(std::size_t i = 0; i != this->size(); ++i) {
+        SpatialFeature<dimensions, T>& feature = (*this)[i];
+        feature._node = NotInserted;
+        feature._queued = false;
+    }
+}
+
+template<UnsignedInt dimensions, class T> SpatialIndex<dimensions, T>& SpatialIndex<dimensions, T>::add(SpatialFeature<dimensions, T>& feature) {
+    /* Remove from previous index, including its tree */
+    if(SpatialIndex<dimensions, T>* const previous = feature.index())
+        previous->remove(feature);
+
+    FeatureGroup<dimensions, SpatialFeature<dimensions, T>, T>::add(feature);
+
+    /* The feature gets inserted into the tree on next update */
+    feature._boundsDirty = true;
+    feature.enqueue();
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> SpatialIndex<dimensions, T>& SpatialIndex<dimensions, T>::remove(SpatialFeature<dimensions, T>& feature) {
+    CORRADE_ASSERT(feature.index() == this,
+        "SceneGraph::SpatialIndex::remove(): feature is not part of this index", *this);
+
+    erase(feature);
+    if(feature._queued) {
+        _queue.erase(std::find(_queue.begin(), _queue.end(), &feature));
+        feature._queued = false;
+    }
+
+    FeatureGroup<dimensions, SpatialFeature<dimensions, T>, T>::remove(feature);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::update() {
+    if(_queue.empty()) return;
+
+    /* Clean all changed objects at once. Multiple features can be attached
+       to the same object, so remove the duplicates first. */
+    {
+        std::vector<AbstractObject<dimensions, T>*> objects;
+        objects.reserve(_queue.size());
+        for(SpatialFeature<dimensions, T>* feature: _queue)
+            objects.push_back(&feature->object());
+        std::sort(objects.begin(), objects.end());
+        objects.erase(std::unique(objects.begin(), objects.end()), objects.end());
+
+        std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> references;
+        references.reserve(objects.size());
+        for(AbstractObject<dimensions, T>* object: objects)
+            references.push_back(*object);
+        AbstractObject<dimensions, T>::setClean(references);
+    }
+
+    for(SpatialFeature<dimensions, T>* feature: _queue) {
+        /* Only the bounds changed but not the object, so it wasn't cleaned
+           above */
+        if(feature->_boundsDirty)
+            feature->clean(feature->object().absoluteTransformationMatrix());
+
+        /* Move the feature only if it ends up in another node */
+        const UnsignedLong node = nodeFor(feature->_absoluteBounds);
+        if(node != feature->_node) {
+            erase(*feature);
+            insert(*feature, node);
+        }
+
+        feature->_queued = false;
+    }
+
+    _queue.clear();
+}
+
+template<UnsignedInt dimensions, class T> UnsignedLong SpatialIndex<dimensions, T>::nodeFor(const RangeTypeFor<dimensions, T>& bounds) const {
+    const VectorTypeFor<dimensions, T> center = bounds.center();
+    const VectorTypeFor<dimensions, T> size = bounds.size();
+    const VectorTypeFor<dimensions, T> rootSize = _bounds.size();
+
+    /* Center outside of the tree or the bounds too large for even the root
+       node */
+    if(!(center >= _bounds.min()).all() || !(center <= _bounds.max()).all() || !(size <= rootSize).all())
+        return Outside;
+
+    /* Deepest level with cells still at least as large as the bounds */
+    UnsignedInt level = 0;
+    while(level != _maxDepth && (size <= rootSize/T(1 << (level + 1))).all())
+        ++level;
+
+    /* Cell containing the center */
+    const Int cellCount = 1 << level;
+    const VectorTypeFor<dimensions, T> position = (center - _bounds.min())/rootSize*T(cellCount);
+    UnsignedInt coordinates[3]{};
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        coordinates[i] = UnsignedInt(Math::clamp(Int(position[i]), 0, cellCount - 1));
+
+    return Implementation::spatialIndexNodeKey(level, coordinates[0], coordinates[1], coordinates[2]);
+}
+
+template<UnsignedInt dimensions, class T> RangeTypeFor<dimensions, T> SpatialIndex<dimensions, T>::looseBounds(const UnsignedLong node) const {
+    const VectorTypeFor<dimensions, T> cellSize = _bounds.size()/T(1 << Implementation::spatialIndexNodeLevel(node));
+    VectorTypeFor<dimensions, T> min;
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        min[i] = _bounds.min()[i] + cellSize[i]*(T(Implementation::spatialIndexNodeCoordinate(node, i)) - T(0.5));
+
+    /* The loose bounds are twice as large as the cell */
+    return {min, min + cellSize*T(2)};
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::insert(SpatialFeature<dimensions, T>& feature, const UnsignedLong node) {
+    feature._node = node;
+
+    if(node == Outside) {
+        feature._nodeIndex = _outside.size();
+        _outside.push_back(&feature);
+        return;
+    }
+
+    std::vector<SpatialFeature<dimensions, T>*>& features = _nodes[node].features;
+    feature._nodeIndex = features.size();
+    features.push_back(&feature);
+
+    /* Update counts in the node and all its parents, creating them if not
+       present yet */
+    UnsignedLong key = node;
+    for(;;) {
+        ++_nodes[key].count;
+
+        const UnsignedInt level = Implementation::spatialIndexNodeLevel(key);
+        if(!level) break;
+        key = Implementation::spatialIndexNodeKey(level - 1,
+            Implementation::spatialIndexNodeCoordinate(key, 0) >> 1,
+            Implementation::spatialIndexNodeCoordinate(key, 1) >> 1,
+            Implementation::spatialIndexNodeCoordinate(key, 2) >> 1);
+    }
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::erase(SpatialFeature<dimensions, T>& feature) {
+    const UnsignedLong node = feature._node;
+    if(node == NotInserted) return;
+    feature._node = NotInserted;
+
+    /* Move the last feature into the place of the removed one */
+    std::vector<SpatialFeature<dimensions, T>*>& features = node == Outside ? _outside : _nodes.at(node).features;
+    features[feature._nodeIndex] = features.back();
+    features[feature._nodeIndex]->_nodeIndex = feature._nodeIndex;
+    features.pop_back();
+
+    if(node == Outside) return;
+
+    /* Update counts in the node and all its parents, removing the ones which
+       became empty */
+    UnsignedLong key = node;
+    for(;;) {
+        const auto found = _nodes.find(key);
+        CORRADE_INTERNAL_ASSERT(found != _nodes.end());
+        if(!--found->second.count) _nodes.erase(found);
+
+        const UnsignedInt level = Implementation::spatialIndexNodeLevel(key);
+        if(!level) break;
+        key = Implementation::spatialIndexNodeKey(level - 1,
+            Implementation::spatialIndexNodeCoordinate(key, 0) >> 1,
+            Implementation::spatialIndexNodeCoordinate(key, 1) >> 1,
+            Implementation::spatialIndexNodeCoordinate(key, 2) >> 1);
+    }
+}
+
+template<UnsignedInt dimensions, class T> template<class Test> void SpatialIndex<dimensions, T>::query(const Test& test, std::vector<SpatialFeature<dimensions, T>*>& out) {
+    update();
+
+    for(SpatialFeature<dimensions, T>* feature: _outside)
+        if(test(feature->_absoluteBounds)) out.push_back(feature);
+
+    if(_nodes.empty()) return;
+
+    std::vector<UnsignedLong> stack;
+    stack.reserve(_maxDepth*((1 << dimensions) - 1) + 1);
+    stack.push_back(Implementation::spatialIndexNodeKey(0, 0, 0, 0));
+    while(!stack.empty()) {
+        const UnsignedLong key = stack.back();
+        stack.pop_back();
+
+        if(!test(looseBounds(key))) continue;
+
+        for(SpatialFeature<dimensions, T>* feature: _nodes.at(key).features)
+            if(test(feature->_absoluteBounds)) out.push_back(feature);
+
+        const UnsignedInt level = Implementation::spatialIndexNodeLevel(key);
+        if(level == _maxDepth) continue;
+
+        /* Visit children which have some features */
+        const UnsignedInt x = Implementation::spatialIndexNodeCoordinate(key, 0) << 1;
+        const UnsignedInt y = Implementation::spatialIndexNodeCoordinate(key, 1) << 1;
+        const UnsignedInt z = Implementation::spatialIndexNodeCoordinate(key, 2) << 1;
+        for(UnsignedInt i = 0; i != 1 << dimensions; ++i) {
+            const UnsignedLong child = Implementation::spatialIndexNodeKey(level + 1,
+                x + (i & 1),
+                dimensions > 1 ? y + ((i >> 1) & 1) : 0,
+                dimensions > 2 ? z + ((i >> 2) & 1) : 0);
+            if(_nodes.find(child) != _nodes.end()) stack.push_back(child);
+        }
+    }
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::queryBox(const RangeTypeFor<dimensions, T>& box, std::vector<SpatialFeature<dimensions, T>*>& out) {
+    query([&box](const RangeTypeFor<dimensions, T>& bounds) {
+        return Implementation::spatialIndexOverlaps<dimensions, T>(bounds, box);
+    }, out);
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::querySphere(const VectorTypeFor<dimensions, T>& center, const T radius, std::vector<SpatialFeature<dimensions, T>*>& out) {
+    const T radiusSquared = radius*radius;
+    query([&center, radiusSquared](const RangeTypeFor<dimensions, T>& bounds) {
+        /* Squared distance of the nearest point of the box */
+        const VectorTypeFor<dimensions, T> nearest = Math::max(Math::min(center, bounds.max()), bounds.min());
+        return (nearest - center).dot() <= radiusSquared;
+    }, out);
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::queryFrustum(const MatrixTypeFor<dimensions, T>& matrix, std::vector<SpatialFeature<dimensions, T>*>& out) {
+    /* Extract the frustum planes, the same as when culling in
+       AbstractCamera::draw() */
+    Math::Vector<dimensions + 1, T> planes[dimensions*2];
+    const Math::Vector<dimensions + 1, T> w = matrix.row(dimensions);
+    for(UnsignedInt i = 0; i != dimensions*2; ++i)
+        planes[i] = i % 2 ? w - matrix.row(i/2) : w + matrix.row(i/2);
+
+    query([&planes](const RangeTypeFor<dimensions, T>& bounds) {
+        /* The box is outside if the corner farthest along the plane normal
+           is behind the plane */
+        for(const Math::Vector<dimensions + 1, T>& plane: planes) {
+            T distance = plane[dimensions];
+            for(UnsignedInt d = 0; d != dimensions; ++d)
+                distance += plane[d]*(plane[d] >= T(0) ? bounds.max()[d] : bounds.min()[d]);
+            if(distance < T(0)) return false;
+        }
+
+        return true;
+    }, out);
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::queryCamera(AbstractCamera<dimensions, T>& camera, std::vector<SpatialFeature<dimensions, T>*>& out) {
+    queryFrustum(camera.projectionMatrix()*camera.cameraMatrix(), out);
+}
+
+}}
+
+#endif
@@ -0,0 +1,201 @@
+#ifndef Magnum_SceneGraph_StereoCamera3D_h
+#define Magnum_SceneGraph_StereoCamera3D_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::BasicStereoCamera3D, typedef @ref Magnum::SceneGraph::StereoCamera3D
+ */
+
+#include "Magnum/SceneGraph/Camera3D.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Eye of a stereo camera
+
+@see @ref BasicStereoCamera3D::eyeViewProjectionMatrix()
+*/
+enum class StereoEye: UnsignedByte {
+    Left = 0,   /**< Left eye */
+    Right = 1   /**< Right eye */
+};
+
+/**
+@brief Stereo camera for three-dimensional scenes
+
+Renders both eyes in a single pass over the drawable group. Unlike calling
+@ref draw() once for each eye with a different camera, the drawables are
+sorted, culled and have their transformations computed only once and each
+visible drawable is drawn once, so the CPU cost of submitting the scene is
+the same as for a single view.
+
+The transformation matrix passed to @ref Drawable::draw() is relative to the
+camera object, i.e. to the point between the eyes. Each eye is offset by half
+of @ref eyeSeparation() along the X axis and has its own projection. The
+drawable is expected to render two instances of the mesh, with the instance
+ID selecting the eye matrix and the output layer, for example using
+@ref Shaders::Flat::Flag::Stereo together with a layered framebuffer
+attachment:
+@code
+Texture2DArray color;
+color.setStorage(1, TextureFormat::RGBA8, {eyeSize, 2});
+Framebuffer framebuffer{{{}, eyeSize}};
+framebuffer.attachLayeredTexture(Framebuffer::ColorAttachment(0), color, 0);
+
+void MyDrawable::draw(const Matrix4& transformationMatrix, SceneGraph::AbstractCamera3D& abstractCamera) {
+    auto& camera = static_cast<SceneGraph::StereoCamera3D&>(abstractCamera);
+    shader.setTransformationProjectionMatrix(transformationMatrix)
+        .setViewProjectionMatrices(
+            camera.eyeViewProjectionMatrix(SceneGraph::StereoEye::Left),
+            camera.eyeViewProjectionMatrix(SceneGraph::StereoEye::Right));
+    mesh.setInstanceCount(2)
+        .draw(shader);
+}
+@endcode
+
+Drawables with a bounding sphere are culled against both eye frustums and
+drawn if visible in at least one of them.
+
+@anchor SceneGraph-StereoCamera3D-explicit-specializations
+## Explicit template specializations
+
+The following specialization is explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref StereoCamera3D.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref StereoCamera3D
+
+@see @ref scenegraph, @ref StereoCamera3D, @ref BasicCamera3D, @ref Drawable,
+    @ref DrawableGroup
+*/
+template<class T> class BasicStereoCamera3D: public BasicCamera3D<T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object holding this feature
+         *
+         * Eye separation is set to `0`, both eyes use @ref projectionMatrix().
+         */
+        explicit BasicStereoCamera3D(AbstractBasicObject3D<T>& object);
+
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        /* This is here to avoid ambiguity with deleted copy constructor when
+           passing `*this` from class subclassing both BasicStereoCamera3D and
+           AbstractObject */
+        template<class U, class = typename std::enable_if<std::is_base_of<AbstractBasicObject3D<T>, U>::value>::type> BasicStereoCamera3D(U& object): BasicStereoCamera3D(static_cast<AbstractBasicObject3D<T>&>(object)) {}
+        #endif
+
+        /** @brief Distance between the eyes */
+        T eyeSeparation() const { return _eyeSeparation; }
+
+        /**
+         * @brief Set distance between the eyes
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref eyeMatrix()
+         */
+        BasicStereoCamera3D<T>& setEyeSeparation(T separation) {
+            _eyeSeparation = separation;
+            return *this;
+        }
+
+        /**
+         * @brief Set projection matrices of both eyes
+         * @return Reference to self (for method chaining)
+         *
+         * Meant for head-mounted displays, which usually have asymmetric
+         * projection for each eye. If not set, both eyes use
+         * @ref projectionMatrix().
+         */
+        BasicStereoCamera3D<T>& setEyeProjectionMatrices(const Math::Matrix4<T>& left, const Math::Matrix4<T>& right);
+
+        /**
+         * @brief Eye matrix
+         *
+         * Transforms from camera space to space of given eye, i.e. a
+         * translation by half of @ref eyeSeparation() along the X axis.
+         */
+        Math::Matrix4<T> eyeMatrix(StereoEye eye) const;
+
+        /** @brief Projection matrix of given eye */
+        Math::Matrix4<T> eyeProjectionMatrix(StereoEye eye) const;
+
+        /**
+         * @brief View projection matrix of given eye
+         *
+         * @ref eyeProjectionMatrix() multiplied with @ref eyeMatrix(). Meant
+         * to be applied to the transformation passed to @ref Drawable::draw().
+         */
+        Math::Matrix4<T> eyeViewProjectionMatrix(StereoEye eye) const {
+            return eyeProjectionMatrix(eye)*eyeMatrix(eye);
+        }
+
+        /* Overloads to remove WTF-factor from method chaining order */
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        BasicStereoCamera3D<T>& setOrthographic(const Math::Vector2<T>& size, T near, T far) {
+            BasicCamera3D<T>::setOrthographic(size, near, far);
+            return *this;
+        }
+        BasicStereoCamera3D<T>& setPerspective(const Math::Vector2<T>& size, T near, T far) {
+            BasicCamera3D<T>::setPerspective(size, near, far);
+            return *this;
+        }
+        BasicStereoCamera3D<T>& setPerspective(Math::Rad<T> fov, T aspectRatio, T near, T far) {
+            BasicCamera3D<T>::setPerspective(fov, aspectRatio, near, far);
+            return *this;
+        }
+        BasicStereoCamera3D<T>& setAspectRatioPolicy(AspectRatioPolicy policy) {
+            BasicCamera3D<T>::setAspectRatioPolicy(policy);
+            return *this;
+        }
+        #endif
+
+    protected:
+        /** Culls against both eye frustums */
+        void cullBoundingSpheres(const std::vector<T>& spheres, std::vector<UnsignedByte>& visible) override;
+
+    private:
+        T _eyeSeparation;
+        bool _hasEyeProjections;
+        Math::Matrix4<T> _eyeProjections[2];
+        std::vector<UnsignedByte> _visibleRight;
+};
+
+/**
+@brief Stereo camera for three-dimensional float scenes
+
+@see @ref Camera3D
+*/
+typedef BasicStereoCamera3D<Float> StereoCamera3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT BasicStereoCamera3D<Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef Magnum_SceneGraph_StereoCamera3D_hpp
+#define Magnum_SceneGraph_StereoCamera3D_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref StereoCamera3D.h
+ */
+
+#include "Magnum/SceneGraph/Camera3D.hpp"
+#include "Magnum/SceneGraph/StereoCamera3D.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<class T> BasicStereoCamera3D<T>::BasicStereoCamera3D(AbstractBasicObject3D<T>& object): BasicCamera3D<T>(object), _eyeSeparation(T(0)), _hasEyeProjections(false) {}
+
+template<class T> BasicStereoCamera3D<T>& BasicStereoCamera3D<T>::setEyeProjectionMatrices(const Math::Matrix4<T>& left, const Math::Matrix4<T>& right) {
+    _eyeProjections[0] = left;
+    _eyeProjections[1] = right;
+    _hasEyeProjections = true;
+    return *this;
+}
+
+template<class T> Math::Matrix4<T> BasicStereoCamera3D<T>::eyeMatrix(const StereoEye eye) const {
+    /* The left eye is on the negative X side, so the scene is moved to the
+       right relative to it */
+    return Math::Matrix4<T>::translation(Math::Vector3<T>::xAxis(eye == StereoEye::Left ? _eyeSeparation/T(2) : -_eyeSeparation/T(2)));
+}
+
+template<class T> Math::Matrix4<T> BasicStereoCamera3D<T>::eyeProjectionMatrix(const StereoEye eye) const {
+    return _hasEyeProjections ? _eyeProjections[UnsignedByte(eye)] : AbstractBasicCamera3D<T>::projectionMatrix();
+}
+
+template<class T> void BasicStereoCamera3D<T>::cullBoundingSpheres(const std::vector<T>& spheres, std::vector<UnsignedByte>& visible) {
+    /* A drawable is visible if it's visible from at least one eye */
+    _visibleRight = visible;
+    Implementation::cullSpheres<3, T>(eyeViewProjectionMatrix(StereoEye::Left), spheres, visible);
+    Implementation::cullSpheres<3, T>(eyeViewProjectionMatrix(StereoEye::Right), spheres, _visibleRight);
+    for(std::size_t i = 0; i != visible.size(); ++i)
+        visible[i] |= _visibleRight[i];
+}
+
+}}
+
+#endif
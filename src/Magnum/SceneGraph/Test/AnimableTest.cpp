@@ -24,11 +24,14 @@
 */
 
 #include <sstream>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/SceneGraph/Animable.h"
 #include "Magnum/SceneGraph/AnimableGroup.h"
+#include "Magnum/SceneGraph/Camera3D.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
 
 namespace Magnum { namespace SceneGraph { namespace Test {
 
@@ -37,23 +40,28 @@ struct AnimableTest: TestSuite::Tester {
 
     void state();
     void step();
+    void fixedStep();
     void duration();
     void repeat();
     void stop();
     void pause();
+    void updateLod();
 
     void debug();
 };
 
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
 
 AnimableTest::AnimableTest() {
     addTests({&AnimableTest::state,
               &AnimableTest::step,
+              &AnimableTest::fixedStep,
               &AnimableTest::duration,
               &AnimableTest::repeat,
               &AnimableTest::stop,
               &AnimableTest::pause,
+              &AnimableTest::updateLod,
 
               &AnimableTest::debug});
 }
@@ -214,6 +222,40 @@ void AnimableTest::step() {
     CORRADE_COMPARE(animable.delta, 0.75f);
 }
 
+void AnimableTest::fixedStep() {
+    class CountingAnimable: public SceneGraph::Animable3D {
+        public:
+            CountingAnimable(AbstractObject3D& object, AnimableGroup3D* group = nullptr): SceneGraph::Animable3D(object, group) {}
+
+            std::vector<Float> times, deltas;
+
+        protected:
+            void animationStep(Float time, Float delta) override {
+                times.push_back(time);
+                deltas.push_back(delta);
+            }
+    };
+
+    Object3D object;
+    AnimableGroup3D group;
+    CountingAnimable animable(object, &group);
+    animable.setState(AnimationState::Running);
+
+    /* Zero steps should do nothing */
+    group.fixedStep(1.0f, 0.25f, 0);
+    CORRADE_VERIFY(animable.times.empty());
+
+    /* Three steps ending at 1.5, the animation is started at 1.0 */
+    group.fixedStep(1.5f, 0.25f, 3);
+    CORRADE_COMPARE(animable.times, (std::vector<Float>{0.0f, 0.25f, 0.5f}));
+    CORRADE_COMPARE(animable.deltas, (std::vector<Float>{0.25f, 0.25f, 0.25f}));
+
+    /* Next frame continues where the previous ended */
+    group.fixedStep(1.75f, 0.25f, 1);
+    CORRADE_COMPARE(animable.times, (std::vector<Float>{0.0f, 0.25f, 0.5f, 0.75f}));
+    CORRADE_COMPARE(animable.deltas, (std::vector<Float>{0.25f, 0.25f, 0.25f, 0.25f}));
+}
+
 void AnimableTest::duration() {
     Object3D object;
     AnimableGroup3D group;
@@ -351,6 +393,86 @@ void AnimableTest::pause() {
     CORRADE_COMPARE(animable.time, 2.0f);
 }
 
+void AnimableTest::updateLod() {
+    class CountingAnimable: public SceneGraph::Animable3D {
+        public:
+            CountingAnimable(AbstractObject3D& object, AnimableGroup3D* group = nullptr): SceneGraph::Animable3D(object, group), count(0), time(-1.0f), delta(0.0f) {}
+
+            Int count;
+            Float time, delta;
+
+        protected:
+            void animationStep(Float time, Float delta) override {
+                ++count;
+                this->time = time;
+                this->delta = delta;
+            }
+    };
+
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setPerspective(Vector2{2.0f}, 1.0f, 100.0f);
+
+    Object3D nearObject{&scene};
+    nearObject.translate(Vector3::zAxis(-5.0f));
+    Object3D farObject{&scene};
+    farObject.translate(Vector3::zAxis(-50.0f));
+    Object3D behindObject{&scene};
+    behindObject.translate(Vector3::zAxis(10.0f));
+    Object3D unboundedObject{&scene};
+    unboundedObject.translate(Vector3::zAxis(10.0f));
+
+    AnimableGroup3D group;
+    group.setUpdateIntervals({{20.0f, 0.5f}});
+    CountingAnimable near{nearObject, &group};
+    CountingAnimable far{farObject, &group};
+    CountingAnimable behind{behindObject, &group};
+    CountingAnimable unbounded{unboundedObject, &group};
+    near.setBoundingSphere({}, 1.0f);
+    far.setBoundingSphere({}, 1.0f);
+    behind.setBoundingSphere({}, 1.0f);
+    for(CountingAnimable* a: {&near, &far, &behind, &unbounded})
+        a->setState(AnimationState::Running);
+
+    /* Far animable waits for its interval, the one behind the camera is
+       paused, the one without bounding sphere isn't culled */
+    group.step(1.0f, 0.25f, camera);
+    CORRADE_COMPARE(group.runningCount(), 4);
+    CORRADE_COMPARE(near.updateInterval(), 0.0f);
+    CORRADE_COMPARE(far.updateInterval(), 0.5f);
+    CORRADE_COMPARE(behind.updateInterval(), Constants::inf());
+    CORRADE_COMPARE(unbounded.updateInterval(), 0.0f);
+    CORRADE_COMPARE(near.count, 1);
+    CORRADE_COMPARE(far.count, 0);
+    CORRADE_COMPARE(behind.count, 0);
+    CORRADE_COMPARE(unbounded.count, 1);
+
+    /* Far animable gets the accumulated delta */
+    group.step(1.25f, 0.25f, camera);
+    CORRADE_COMPARE(near.count, 2);
+    CORRADE_COMPARE(far.count, 1);
+    CORRADE_COMPARE(far.time, 0.25f);
+    CORRADE_COMPARE(far.delta, 0.5f);
+    CORRADE_COMPARE(behind.count, 0);
+
+    /* Getting visible steps the animable with all the time since start */
+    behindObject.translate(Vector3::zAxis(-20.0f));
+    group.step(1.5f, 0.25f, camera);
+    CORRADE_COMPARE(behind.updateInterval(), 0.0f);
+    CORRADE_COMPARE(behind.count, 1);
+    CORRADE_COMPARE(behind.time, 0.5f);
+    CORRADE_COMPARE(behind.delta, 0.75f);
+    CORRADE_COMPARE(far.count, 1);
+
+    /* Step without camera steps everything including the pending time */
+    group.step(1.75f, 0.25f);
+    CORRADE_COMPARE(far.count, 2);
+    CORRADE_COMPARE(far.delta, 0.5f);
+    CORRADE_COMPARE(near.count, 4);
+    CORRADE_COMPARE(near.delta, 0.25f);
+}
+
 void AnimableTest::debug() {
     std::ostringstream o;
     Debug(&o) << AnimationState::Running;
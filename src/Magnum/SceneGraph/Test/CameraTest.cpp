@@ -28,10 +28,12 @@
 #include "Magnum/SceneGraph/AbstractCamera.hpp" /* only for aspectRatioFix(), so it doesn't have to be exported */
 #include "Magnum/SceneGraph/Camera2D.h"
 #include "Magnum/SceneGraph/Camera3D.h"
+#include "Magnum/SceneGraph/CubeMapCamera3D.h"
 #include "Magnum/SceneGraph/Drawable.h"
 #include "Magnum/SceneGraph/MatrixTransformation2D.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/StereoCamera3D.h"
 
 namespace Magnum { namespace SceneGraph { namespace Test {
 
@@ -47,6 +49,14 @@ struct CameraTest: TestSuite::Tester {
     void projectionSizePerspective();
     void projectionSizeViewport();
     void draw();
+    void drawSorted();
+    void drawCulled();
+    void drawDebugGroups();
+    void radixSort();
+    void stereoEyeMatrices();
+    void stereoDrawCulled();
+    void cubeMapFaceMatrices();
+    void cubeMapDrawCulled();
 };
 
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
@@ -62,7 +72,15 @@ CameraTest::CameraTest() {
               &CameraTest::projectionSizeOrthographic,
               &CameraTest::projectionSizePerspective,
               &CameraTest::projectionSizeViewport,
-              &CameraTest::draw});
+              &CameraTest::draw,
+              &CameraTest::drawSorted,
+              &CameraTest::drawCulled,
+              &CameraTest::drawDebugGroups,
+              &CameraTest::radixSort,
+              &CameraTest::stereoEyeMatrices,
+              &CameraTest::stereoDrawCulled,
+              &CameraTest::cubeMapFaceMatrices,
+              &CameraTest::cubeMapDrawCulled});
 }
 
 void CameraTest::fixAspectRatio() {
@@ -211,6 +229,317 @@ void CameraTest::draw() {
     CORRADE_COMPARE(thirdTransformation, Matrix4());
 }
 
+void CameraTest::drawSorted() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, std::vector<Int>& order, Int id): SceneGraph::Drawable3D(object, group), order(order), id(id) {}
+
+        protected:
+            void draw(const Matrix4&, AbstractCamera3D&) override {
+                order.push_back(id);
+            }
+
+        private:
+            std::vector<Int>& order;
+            Int id;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+    std::vector<Int> order;
+
+    Object3D first(&scene);
+    (new Drawable(first, &group, order, 0))->setSortKey(Drawable3D::sortKey(2, 0, 0));
+    (new Drawable(first, &group, order, 1))->setSortKey(Drawable3D::sortKey(1, 5, 0));
+    (new Drawable(first, &group, order, 2))->setSortKey(Drawable3D::sortKey(2, 0, 0));
+    (new Drawable(first, &group, order, 3))->setSortKey(Drawable3D::sortKey(1, 3, 7));
+
+    Camera3D camera(first);
+    CORRADE_VERIFY(!camera.isSortingEnabled());
+
+    /* Insertion order by default */
+    camera.draw(group);
+    CORRADE_COMPARE(order, (std::vector<Int>{0, 1, 2, 3}));
+
+    /* Sorted, stable for equal keys */
+    order.clear();
+    camera.setSortingEnabled(true)
+        .draw(group);
+    CORRADE_COMPARE(order, (std::vector<Int>{3, 1, 0, 2}));
+}
+
+void CameraTest::drawDebugGroups() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, Int& count): SceneGraph::Drawable3D(object, group), count(count) {}
+
+        protected:
+            void draw(const Matrix4&, AbstractCamera3D&) override { ++count; }
+
+        private:
+            Int& count;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+    Int count = 0;
+
+    Object3D first(&scene);
+    Drawable* drawable = new Drawable(first, &group, count);
+    CORRADE_COMPARE(drawable->debugLabel(), "Drawable");
+    drawable->setDebugLabel("Teapot");
+    CORRADE_COMPARE(drawable->debugLabel(), "Teapot");
+
+    Camera3D camera(first);
+    CORRADE_VERIFY(!camera.isDebugGroupsEnabled());
+    CORRADE_VERIFY(!camera.isDrawableDebugGroupsEnabled());
+    CORRADE_COMPARE(camera.debugLabel(), "Camera");
+
+    /* Disabled groups don't touch GL, so this works without a context */
+    camera.draw(group);
+    CORRADE_COMPARE(count, 1);
+
+    camera.setDebugGroupsEnabled(true)
+        .setDrawableDebugGroupsEnabled(true)
+        .setDebugLabel("Shadow pass");
+    CORRADE_VERIFY(camera.isDebugGroupsEnabled());
+    CORRADE_VERIFY(camera.isDrawableDebugGroupsEnabled());
+    CORRADE_COMPARE(camera.debugLabel(), "Shadow pass");
+}
+
+void CameraTest::drawCulled() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, std::vector<Int>& order, Int id): SceneGraph::Drawable3D(object, group), order(order), id(id) {}
+
+        protected:
+            void draw(const Matrix4&, AbstractCamera3D&) override {
+                order.push_back(id);
+            }
+
+        private:
+            std::vector<Int>& order;
+            Int id;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+    std::vector<Int> order;
+
+    /* In front of the camera */
+    Object3D first(&scene);
+    first.translate(Vector3::zAxis(-5.0f));
+    (new Drawable(first, &group, order, 0))->setBoundingSphere({}, 1.0f);
+
+    /* Behind the camera */
+    Object3D second(&scene);
+    second.translate(Vector3::zAxis(5.0f));
+    (new Drawable(second, &group, order, 1))->setBoundingSphere({}, 1.0f);
+
+    /* Behind the camera, but without bounding sphere */
+    new Drawable(second, &group, order, 2);
+
+    /* Far to the side, but scaled so it intersects the frustum */
+    Object3D third(&scene);
+    third.scale(Vector3(10.0f))
+        .translate({12.0f, 0.0f, -5.0f});
+    (new Drawable(third, &group, order, 3))->setBoundingSphere(Range3D{{-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, 0.5f}});
+
+    /* Far to the side */
+    Object3D fourth(&scene);
+    fourth.translate({12.0f, 0.0f, -5.0f});
+    (new Drawable(fourth, &group, order, 4))->setBoundingSphere({}, 1.0f);
+
+    Object3D cameraObject(&scene);
+    Camera3D camera(cameraObject);
+    camera.setPerspective(Deg(90.0f), 1.0f, 0.1f, 100.0f);
+    camera.draw(group);
+
+    CORRADE_COMPARE(order, (std::vector<Int>{0, 2, 3}));
+}
+
+void CameraTest::radixSort() {
+    std::vector<std::pair<UnsignedLong, Int>> items{
+        {0xff00000000000000ull, 0},
+        {3, 1},
+        {0x0000010000000000ull, 2},
+        {3, 3},
+        {0, 4}};
+    std::vector<std::pair<UnsignedLong, Int>> scratch;
+    Implementation::radixSortByKey(items, scratch);
+
+    CORRADE_COMPARE(items.size(), 5);
+    CORRADE_COMPARE(items[0].second, 4);
+    CORRADE_COMPARE(items[1].second, 1);
+    CORRADE_COMPARE(items[2].second, 3);
+    CORRADE_COMPARE(items[3].second, 2);
+    CORRADE_COMPARE(items[4].second, 0);
+}
+
+void CameraTest::stereoEyeMatrices() {
+    Scene3D scene;
+    Object3D cameraObject(&scene);
+    StereoCamera3D camera(cameraObject);
+    camera.setPerspective(Deg(90.0f), 1.0f, 0.1f, 100.0f)
+        .setEyeSeparation(0.064f);
+
+    CORRADE_COMPARE(camera.eyeSeparation(), 0.064f);
+    CORRADE_COMPARE(camera.eyeMatrix(StereoEye::Left), Matrix4::translation({0.032f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(camera.eyeMatrix(StereoEye::Right), Matrix4::translation({-0.032f, 0.0f, 0.0f}));
+
+    /* Both eyes use the camera projection by default */
+    CORRADE_COMPARE(camera.eyeProjectionMatrix(StereoEye::Left), camera.projectionMatrix());
+    CORRADE_COMPARE(camera.eyeProjectionMatrix(StereoEye::Right), camera.projectionMatrix());
+    CORRADE_COMPARE(camera.eyeViewProjectionMatrix(StereoEye::Right), camera.projectionMatrix()*Matrix4::translation({-0.032f, 0.0f, 0.0f}));
+
+    /* Custom per-eye projections */
+    const Matrix4 left = Matrix4::perspectiveProjection({0.2f, 0.2f}, 0.1f, 100.0f);
+    const Matrix4 right = Matrix4::perspectiveProjection({0.3f, 0.2f}, 0.1f, 100.0f);
+    camera.setEyeProjectionMatrices(left, right);
+    CORRADE_COMPARE(camera.eyeProjectionMatrix(StereoEye::Left), left);
+    CORRADE_COMPARE(camera.eyeProjectionMatrix(StereoEye::Right), right);
+    CORRADE_COMPARE(camera.eyeViewProjectionMatrix(StereoEye::Left), left*Matrix4::translation({0.032f, 0.0f, 0.0f}));
+}
+
+void CameraTest::stereoDrawCulled() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, std::vector<Int>& order, Int id): SceneGraph::Drawable3D(object, group), order(order), id(id) {}
+
+        protected:
+            void draw(const Matrix4&, AbstractCamera3D&) override {
+                order.push_back(id);
+            }
+
+        private:
+            std::vector<Int>& order;
+            Int id;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+    std::vector<Int> order;
+
+    /* In front of the camera, visible from both eyes */
+    Object3D first(&scene);
+    first.translate(Vector3::zAxis(-5.0f));
+    (new Drawable(first, &group, order, 0))->setBoundingSphere({}, 1.0f);
+
+    /* Visible only from the left eye */
+    Object3D second(&scene);
+    second.translate({-7.0f, 0.0f, -5.0f});
+    (new Drawable(second, &group, order, 1))->setBoundingSphere({}, 1.0f);
+
+    /* Visible only from the right eye */
+    Object3D third(&scene);
+    third.translate({7.0f, 0.0f, -5.0f});
+    (new Drawable(third, &group, order, 2))->setBoundingSphere({}, 1.0f);
+
+    /* Not visible from any eye */
+    Object3D fourth(&scene);
+    fourth.translate({12.0f, 0.0f, -5.0f});
+    (new Drawable(fourth, &group, order, 3))->setBoundingSphere({}, 1.0f);
+
+    Object3D cameraObject(&scene);
+    StereoCamera3D camera(cameraObject);
+    camera.setPerspective(Deg(90.0f), 1.0f, 0.1f, 100.0f)
+        .setEyeSeparation(2.0f);
+
+    /* Every visible drawable is drawn just once */
+    camera.draw(group);
+    CORRADE_COMPARE(order, (std::vector<Int>{0, 1, 2}));
+
+    /* A regular camera sees just the first */
+    order.clear();
+    Camera3D mono(cameraObject);
+    mono.setPerspective(Deg(90.0f), 1.0f, 0.1f, 100.0f);
+    mono.draw(group);
+    CORRADE_COMPARE(order, (std::vector<Int>{0}));
+}
+
+void CameraTest::cubeMapFaceMatrices() {
+    Scene3D scene;
+    Object3D cameraObject(&scene);
+    CubeMapCamera3D camera(cameraObject);
+    camera.setClippingPlanes(0.1f, 10.0f);
+
+    CORRADE_COMPARE(camera.near(), 0.1f);
+    CORRADE_COMPARE(camera.far(), 10.0f);
+    CORRADE_COMPARE(camera.projectionMatrix(), Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 10.0f));
+
+    /* Each face looks along its axis, with up vectors and right vectors
+       following the cube map conventions */
+    CORRADE_COMPARE(camera.faceMatrix(0).transformVector(Vector3::xAxis()), -Vector3::zAxis());
+    CORRADE_COMPARE(camera.faceMatrix(0).transformVector(-Vector3::yAxis()), Vector3::yAxis());
+    CORRADE_COMPARE(camera.faceMatrix(0).transformVector(-Vector3::zAxis()), Vector3::xAxis());
+    CORRADE_COMPARE(camera.faceMatrix(1).transformVector(-Vector3::xAxis()), -Vector3::zAxis());
+    CORRADE_COMPARE(camera.faceMatrix(1).transformVector(Vector3::zAxis()), Vector3::xAxis());
+    CORRADE_COMPARE(camera.faceMatrix(2).transformVector(Vector3::yAxis()), -Vector3::zAxis());
+    CORRADE_COMPARE(camera.faceMatrix(2).transformVector(Vector3::zAxis()), Vector3::yAxis());
+    CORRADE_COMPARE(camera.faceMatrix(3).transformVector(-Vector3::yAxis()), -Vector3::zAxis());
+    CORRADE_COMPARE(camera.faceMatrix(3).transformVector(-Vector3::zAxis()), Vector3::yAxis());
+    CORRADE_COMPARE(camera.faceMatrix(4).transformVector(Vector3::zAxis()), -Vector3::zAxis());
+    CORRADE_COMPARE(camera.faceMatrix(4).transformVector(Vector3::xAxis()), Vector3::xAxis());
+    CORRADE_COMPARE(camera.faceMatrix(5).transformVector(-Vector3::zAxis()), -Vector3::zAxis());
+    CORRADE_COMPARE(camera.faceMatrix(5).transformVector(-Vector3::xAxis()), Vector3::xAxis());
+
+    CORRADE_COMPARE(camera.faceViewProjectionMatrices().size(), 6);
+    CORRADE_COMPARE(camera.faceViewProjectionMatrix(3), camera.projectionMatrix()*camera.faceMatrix(3));
+    CORRADE_COMPARE(camera.faceViewProjectionMatrices()[3], camera.faceViewProjectionMatrix(3));
+}
+
+void CameraTest::cubeMapDrawCulled() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, std::vector<Int>& order, Int id): SceneGraph::Drawable3D(object, group), order(order), id(id) {}
+
+        protected:
+            void draw(const Matrix4&, AbstractCamera3D&) override {
+                order.push_back(id);
+            }
+
+        private:
+            std::vector<Int>& order;
+            Int id;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+    std::vector<Int> order;
+
+    /* Behind the camera, inside the range */
+    Object3D first(&scene);
+    first.translate(Vector3::zAxis(5.0f));
+    (new Drawable(first, &group, order, 0))->setBoundingSphere({}, 1.0f);
+
+    /* Out of the range */
+    Object3D second(&scene);
+    second.translate({0.0f, -12.0f, 0.0f});
+    (new Drawable(second, &group, order, 1))->setBoundingSphere({}, 1.0f);
+
+    /* Center out of the range, but the sphere intersects it */
+    Object3D third(&scene);
+    third.translate({10.5f, 0.0f, 0.0f});
+    (new Drawable(third, &group, order, 2))->setBoundingSphere({}, 1.0f);
+
+    /* Near the corner of the cube, out of the range */
+    Object3D fourth(&scene);
+    fourth.translate({10.8f, 10.8f, 10.8f});
+    (new Drawable(fourth, &group, order, 3))->setBoundingSphere({}, 1.0f);
+
+    /* Spanning more faces, drawn just once */
+    Object3D fifth(&scene);
+    fifth.translate({2.0f, 2.0f, 0.0f});
+    (new Drawable(fifth, &group, order, 4))->setBoundingSphere({}, 3.0f);
+
+    Object3D cameraObject(&scene);
+    CubeMapCamera3D camera(cameraObject);
+    camera.setClippingPlanes(0.1f, 10.0f);
+
+    camera.draw(group);
+    CORRADE_COMPARE(order, (std::vector<Int>{0, 2, 4}));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraTest)
@@ -0,0 +1,290 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/AbstractResourceLoader.h"
+#include "Magnum/ResourceManager.h"
+#include "Magnum/SceneGraph/CellStreamer.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct CellStreamerTest: TestSuite::Tester {
+    explicit CellStreamerTest();
+
+    void load();
+    void unload();
+    void unloadDistance();
+    void notFound();
+    void budget();
+    void distancesInvalid();
+    void debugState();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+typedef Magnum::ResourceManager<Int> ResourceManager;
+
+namespace {
+    /* Delivers the requested data only when asked to, each cell has two
+       child objects */
+    class DeferredLoader: public AbstractResourceLoader<Int> {
+        public:
+            void deliver() {
+                for(ResourceKey key: _requested) {
+                    if(key == ResourceKey{"missing"}) setNotFound(key);
+                    else set(key, 2, ResourceDataState::Final, ResourcePolicy::ReferenceCounted);
+                }
+                _requested.clear();
+            }
+
+        private:
+            void doLoad(ResourceKey key) override { _requested.push_back(key); }
+
+            std::vector<ResourceKey> _requested;
+    };
+
+    class Streamer: public CellStreamer<MatrixTransformation3D, Int> {
+        public:
+            explicit Streamer(ResourceManager& manager, Object3D& parent): CellStreamer<MatrixTransformation3D, Int>{manager, parent}, stepCount{}, objectCount{} {}
+
+            std::size_t stepCount, objectCount;
+            std::vector<std::size_t> unloaded;
+
+        private:
+            bool doInstantiate(std::size_t, Int& data, Object3D& object, std::size_t step) override {
+                new Object3D{&object};
+                ++stepCount;
+                ++objectCount;
+                return Int(step) + 1 == data;
+            }
+
+            void doUnload(std::size_t id, Object3D&) override {
+                unloaded.push_back(id);
+                objectCount -= 2;
+            }
+    };
+
+    /* Four cells along X axis, each ten units wide */
+    void addCells(Streamer& streamer) {
+        for(Int i = 0; i != 4; ++i)
+            streamer.addCell({{i*10.0f, -1.0f, -1.0f}, {(i + 1)*10.0f, 1.0f, 1.0f}}, "cell" + std::to_string(i));
+    }
+}
+
+CellStreamerTest::CellStreamerTest() {
+    addTests({&CellStreamerTest::load,
+              &CellStreamerTest::unload,
+              &CellStreamerTest::unloadDistance,
+              &CellStreamerTest::notFound,
+              &CellStreamerTest::budget,
+              &CellStreamerTest::distancesInvalid,
+              &CellStreamerTest::debugState});
+}
+
+void CellStreamerTest::load() {
+    ResourceManager manager;
+    auto loader = new DeferredLoader;
+    manager.setLoader(loader);
+
+    Scene3D scene;
+    Streamer streamer{manager, scene};
+    streamer.setDistances(5.0f, 12.0f)
+        .setInstantiationBudget(std::chrono::nanoseconds{0});
+    addCells(streamer);
+    CORRADE_COMPARE(streamer.cellCount(), 4);
+    CORRADE_COMPARE(streamer.cellKey(2), ResourceKey{"cell2"});
+    CORRADE_COMPARE(streamer.cellBounds(1), (Range3D{{10.0f, -1.0f, -1.0f}, {20.0f, 1.0f, 1.0f}}));
+    CORRADE_COMPARE(streamer.cellCount(CellState::Unloaded), 4);
+
+    /* The viewer is inside the first cell, the second is just near enough */
+    streamer.update({5.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE(streamer.cellState(0), CellState::Loading);
+    CORRADE_COMPARE(streamer.cellState(1), CellState::Loading);
+    CORRADE_COMPARE(streamer.cellState(2), CellState::Unloaded);
+    CORRADE_COMPARE(streamer.cellState(3), CellState::Unloaded);
+    CORRADE_COMPARE(loader->requestedCount(), 2);
+    CORRADE_VERIFY(!streamer.cellObject(0));
+
+    /* Nothing happens until the data arrive */
+    streamer.update({5.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE(streamer.cellCount(CellState::Loading), 2);
+    CORRADE_COMPARE(loader->requestedCount(), 2);
+    CORRADE_COMPARE(streamer.stepCount, 0);
+
+    /* With zero budget there's one step per update, nearest cell first */
+    loader->deliver();
+    streamer.update({5.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE(streamer.stepCount, 1);
+    CORRADE_COMPARE(streamer.cellState(0), CellState::Instantiating);
+    CORRADE_COMPARE(streamer.cellState(1), CellState::Instantiating);
+    CORRADE_VERIFY(streamer.cellObject(0));
+    CORRADE_VERIFY(streamer.cellObject(0)->parent() == &scene);
+    CORRADE_VERIFY(streamer.cellObject(0)->children().first());
+    CORRADE_VERIFY(!streamer.cellObject(1)->children().first());
+
+    streamer.update({5.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE(streamer.cellState(0), CellState::Instantiated);
+    CORRADE_COMPARE(streamer.cellState(1), CellState::Instantiating);
+
+    streamer.update({5.0f, 0.0f, 0.0f});
+    streamer.update({5.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE(streamer.cellCount(CellState::Instantiated), 2);
+    CORRADE_COMPARE(streamer.stepCount, 4);
+
+    /* No more work to do */
+    streamer.update({5.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE(streamer.stepCount, 4);
+}
+
+void CellStreamerTest::unload() {
+    ResourceManager manager;
+    auto loader = new DeferredLoader;
+    manager.setLoader(loader);
+
+    Scene3D scene;
+    Streamer streamer{manager, scene};
+    streamer.setDistances(5.0f, 12.0f)
+        .setInstantiationBudget(std::chrono::seconds{1});
+    addCells(streamer);
+
+    streamer.update({5.0f, 0.0f, 0.0f});
+    loader->deliver();
+    streamer.update({5.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE(streamer.cellCount(CellState::Instantiated), 2);
+    CORRADE_COMPARE(streamer.objectCount, 4);
+    CORRADE_COMPARE(manager.count<Int>(), 2);
+
+    /* Moving to the other end unloads the first two cells and releases
+       their data */
+    streamer.update({35.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE(streamer.unloaded, (std::vector<std::size_t>{0, 1}));
+    CORRADE_COMPARE(streamer.objectCount, 0);
+    CORRADE_COMPARE(streamer.cellState(0), CellState::Unloaded);
+    CORRADE_COMPARE(streamer.cellState(1), CellState::Unloaded);
+    CORRADE_VERIFY(!streamer.cellObject(0));
+    CORRADE_VERIFY(!streamer.cellObject(1));
+    CORRADE_COMPARE(manager.state<Int>("cell0"), ResourceState::NotLoaded);
+    CORRADE_COMPARE(manager.state<Int>("cell1"), ResourceState::NotLoaded);
+    CORRADE_COMPARE(streamer.cellState(2), CellState::Loading);
+    CORRADE_COMPARE(streamer.cellState(3), CellState::Loading);
+
+    /* Unloaded cells are requested again when getting near */
+    streamer.update({5.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE(streamer.cellState(0), CellState::Loading);
+    CORRADE_COMPARE(loader->requestedCount(), 6);
+}
+
+void CellStreamerTest::unloadDistance() {
+    ResourceManager manager;
+    auto loader = new DeferredLoader;
+    manager.setLoader(loader);
+
+    Scene3D scene;
+    Streamer streamer{manager, scene};
+    streamer.setDistances(5.0f, 12.0f)
+        .setInstantiationBudget(std::chrono::seconds{1});
+    addCells(streamer);
+
+    streamer.update({5.0f, 0.0f, 0.0f});
+    loader->deliver();
+    streamer.update({5.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE(streamer.cellCount(CellState::Instantiated), 2);
+
+    /* The first cell is out of load distance, but not out of unload
+       distance, so it's kept */
+    streamer.update({-10.0f, 0.0f, 0.0f});
+    CORRADE_COMPARE(streamer.cellState(0), CellState::Instantiated);
+    CORRADE_COMPARE(streamer.cellState(1), CellState::Unloaded);
+    CORRADE_COMPARE(streamer.unloaded, std::vector<std::size_t>{1});
+}
+
+void CellStreamerTest::notFound() {
+    ResourceManager manager;
+    auto loader = new DeferredLoader;
+    manager.setLoader(loader);
+
+    Scene3D scene;
+    Streamer streamer{manager, scene};
+    const std::size_t id = streamer.addCell({Vector3{-1.0f}, Vector3{1.0f}}, "missing");
+
+    streamer.update({});
+    loader->deliver();
+    streamer.update({});
+    CORRADE_COMPARE(streamer.cellState(id), CellState::NotFound);
+    CORRADE_VERIFY(!streamer.cellObject(id));
+
+    /* Not requested again while staying near */
+    streamer.update({});
+    CORRADE_COMPARE(loader->requestedCount(), 1);
+    CORRADE_COMPARE(streamer.stepCount, 0);
+}
+
+void CellStreamerTest::budget() {
+    ResourceManager manager;
+    auto loader = new DeferredLoader;
+    manager.setLoader(loader);
+
+    Scene3D scene;
+    Streamer streamer{manager, scene};
+    CORRADE_COMPARE(streamer.instantiationBudget(), std::chrono::milliseconds{2});
+    streamer.setDistances(100.0f, 100.0f)
+        .setInstantiationBudget(std::chrono::seconds{1});
+    CORRADE_COMPARE(streamer.loadDistance(), 100.0f);
+    CORRADE_COMPARE(streamer.unloadDistance(), 100.0f);
+    addCells(streamer);
+
+    /* Everything fits into the budget */
+    streamer.update({});
+    loader->deliver();
+    streamer.update({});
+    CORRADE_COMPARE(streamer.cellCount(CellState::Instantiated), 4);
+    CORRADE_COMPARE(streamer.stepCount, 8);
+}
+
+void CellStreamerTest::distancesInvalid() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    ResourceManager manager;
+    Scene3D scene;
+    Streamer streamer{manager, scene};
+    streamer.setDistances(5.0f, 4.0f);
+    CORRADE_COMPARE(streamer.loadDistance(), 1.0f);
+    CORRADE_COMPARE(out.str(), "SceneGraph::CellStreamer::setDistances(): unload distance 4 is smaller than load distance 5\n");
+}
+
+void CellStreamerTest::debugState() {
+    std::ostringstream out;
+    Debug(&out) << CellState::Instantiating << CellState(0xde);
+    CORRADE_COMPARE(out.str(), "SceneGraph::CellState::Instantiating SceneGraph::CellState::(invalid)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CellStreamerTest)
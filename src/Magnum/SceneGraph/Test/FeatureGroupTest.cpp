@@ -0,0 +1,158 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AbstractGroupedFeature.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Object.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct FeatureGroupTest: TestSuite::Tester {
+    explicit FeatureGroupTest();
+
+    void add();
+    void remove();
+    void removeLast();
+    void moveToAnotherGroup();
+    void keys();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+
+namespace {
+    class Feature: public AbstractGroupedFeature3D<Feature> {
+        public:
+            explicit Feature(AbstractObject3D& object, FeatureGroup3D<Feature>* group = nullptr): AbstractGroupedFeature3D<Feature>{object, group} {}
+    };
+
+    typedef FeatureGroup3D<Feature> Group;
+}
+
+FeatureGroupTest::FeatureGroupTest() {
+    addTests({&FeatureGroupTest::add,
+              &FeatureGroupTest::remove,
+              &FeatureGroupTest::removeLast,
+              &FeatureGroupTest::moveToAnotherGroup,
+              &FeatureGroupTest::keys});
+}
+
+void FeatureGroupTest::add() {
+    Object3D object;
+    Group group;
+    Feature a{object, &group};
+    Feature b{object};
+    group.add(b);
+
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_COMPARE(&group[0], &a);
+    CORRADE_COMPARE(&group[1], &b);
+    CORRADE_COMPARE(a.group(), &group);
+    CORRADE_COMPARE(b.group(), &group);
+}
+
+void FeatureGroupTest::remove() {
+    Object3D object;
+    Group group;
+    Feature a{object, &group};
+    Feature b{object, &group};
+    Feature c{object, &group};
+    Feature d{object, &group};
+
+    /* The last one is moved in place of the removed one */
+    group.remove(b);
+    CORRADE_VERIFY(!b.group());
+    CORRADE_COMPARE(group.size(), 3);
+    CORRADE_COMPARE(&group[0], &a);
+    CORRADE_COMPARE(&group[1], &d);
+    CORRADE_COMPARE(&group[2], &c);
+
+    /* The moved feature has its index updated */
+    group.remove(d);
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_COMPARE(&group[0], &a);
+    CORRADE_COMPARE(&group[1], &c);
+}
+
+void FeatureGroupTest::removeLast() {
+    Object3D object;
+    Group group;
+    Feature a{object, &group};
+    {
+        Feature b{object, &group};
+        CORRADE_COMPARE(group.size(), 2);
+    }
+
+    CORRADE_COMPARE(group.size(), 1);
+    CORRADE_COMPARE(&group[0], &a);
+
+    group.remove(a);
+    CORRADE_VERIFY(group.isEmpty());
+}
+
+void FeatureGroupTest::moveToAnotherGroup() {
+    Object3D object;
+    Group group1, group2;
+    Feature a{object, &group1};
+    Feature b{object, &group1};
+
+    group2.add(a);
+    CORRADE_COMPARE(a.group(), &group2);
+    CORRADE_COMPARE(group1.size(), 1);
+    CORRADE_COMPARE(&group1[0], &b);
+    CORRADE_COMPARE(group2.size(), 1);
+    CORRADE_COMPARE(&group2[0], &a);
+}
+
+void FeatureGroupTest::keys() {
+    Object3D object;
+    Group group1, group2;
+    Feature a{object, &group1};
+    Feature b{object};
+    Feature c{object, &group1};
+
+    a.setGroupKey(3);
+    b.setGroupKey(5);
+    c.setGroupKey(7);
+    CORRADE_COMPARE(group1.keys(), (std::vector<UnsignedLong>{3, 7}));
+
+    /* Key is preserved when adding to a group */
+    group1.add(b);
+    CORRADE_COMPARE(group1.keys(), (std::vector<UnsignedLong>{3, 7, 5}));
+
+    /* Keys move together with the features */
+    group1.remove(a);
+    CORRADE_COMPARE(group1.keys(), (std::vector<UnsignedLong>{5, 7}));
+    CORRADE_COMPARE(&group1[0], &b);
+
+    group2.add(a);
+    CORRADE_COMPARE(group2.keys(), std::vector<UnsignedLong>{3});
+    CORRADE_COMPARE(a.groupKey(), 3);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FeatureGroupTest)
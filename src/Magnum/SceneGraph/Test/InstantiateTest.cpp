@@ -0,0 +1,96 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Instantiate.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct InstantiateTest: TestSuite::Tester {
+    explicit InstantiateTest();
+
+    void instantiate();
+    void instantiatePool();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+InstantiateTest::InstantiateTest() {
+    addTests({&InstantiateTest::instantiate,
+              &InstantiateTest::instantiatePool});
+}
+
+namespace {
+    Trade::FlatSceneData3D sceneData() {
+        return Trade::FlatSceneData3D{{-1, 0, 0, -1},
+            {Matrix4::translation(Vector3::xAxis(2.0f)),
+             Matrix4::translation(Vector3::yAxis(3.0f)),
+             Matrix4::scaling(Vector3{2.0f}),
+             Matrix4{}},
+            {Trade::ObjectInstanceType3D::Empty, Trade::ObjectInstanceType3D::Mesh,
+             Trade::ObjectInstanceType3D::Mesh, Trade::ObjectInstanceType3D::Light},
+            {-1, 0, 1, 0},
+            {7, 5, 6, 8}};
+    }
+}
+
+void InstantiateTest::instantiate() {
+    Scene3D scene;
+    std::vector<Object3D*> objects = SceneGraph::instantiate(sceneData(), scene);
+
+    CORRADE_COMPARE(objects.size(), 4);
+    CORRADE_COMPARE(objects[0]->parent(), static_cast<Object3D*>(&scene));
+    CORRADE_COMPARE(objects[1]->parent(), objects[0]);
+    CORRADE_COMPARE(objects[2]->parent(), objects[0]);
+    CORRADE_COMPARE(objects[3]->parent(), static_cast<Object3D*>(&scene));
+
+    /* Children are in the original order */
+    CORRADE_COMPARE(objects[0]->children().first(), objects[1]);
+    CORRADE_COMPARE(objects[0]->children().last(), objects[2]);
+
+    CORRADE_COMPARE(objects[1]->absoluteTransformationMatrix(), Matrix4::translation({2.0f, 3.0f, 0.0f}));
+    CORRADE_COMPARE(objects[2]->transformationMatrix(), Matrix4::scaling(Vector3{2.0f}));
+}
+
+void InstantiateTest::instantiatePool() {
+    ObjectPool pool;
+    {
+        Scene3D scene;
+        std::vector<Object3D*> objects = SceneGraph::instantiate(sceneData(), scene, &pool);
+        CORRADE_COMPARE(objects.size(), 4);
+        CORRADE_COMPARE(pool.allocationCount(), 4);
+        CORRADE_COMPARE(objects[2]->parent(), objects[0]);
+    }
+
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::InstantiateTest)
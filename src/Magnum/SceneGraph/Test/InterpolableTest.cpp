@@ -0,0 +1,163 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/Interpolable.h"
+#include "Magnum/SceneGraph/InterpolableGroup.h"
+#include "Magnum/SceneGraph/MatrixTransformation2D.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct InterpolableTest: TestSuite::Tester {
+    explicit InterpolableTest();
+
+    void capture();
+    void reset();
+    void interpolate2D();
+    void interpolate3D();
+    void interpolateShortestPath();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+InterpolableTest::InterpolableTest() {
+    addTests({&InterpolableTest::capture,
+              &InterpolableTest::reset,
+              &InterpolableTest::interpolate2D,
+              &InterpolableTest::interpolate3D,
+              &InterpolableTest::interpolateShortestPath});
+}
+
+void InterpolableTest::capture() {
+    Scene3D scene;
+    Object3D parent{&scene};
+    Object3D object{&parent};
+    InterpolableGroup3D group;
+    Interpolable3D interpolable{object, &group};
+
+    /* First capture sets both transformations */
+    parent.translate(Vector3::xAxis(1.0f));
+    object.translate(Vector3::yAxis(2.0f));
+    group.capture();
+    CORRADE_COMPARE(interpolable.previousTransformationMatrix(), Matrix4::translation({1.0f, 2.0f, 0.0f}));
+    CORRADE_COMPARE(interpolable.currentTransformationMatrix(), Matrix4::translation({1.0f, 2.0f, 0.0f}));
+    CORRADE_COMPARE(interpolable.interpolatedTransformationMatrix(), Matrix4::translation({1.0f, 2.0f, 0.0f}));
+
+    /* Next capture shifts the current one to previous, parent movement is
+       taken into account */
+    parent.translate(Vector3::zAxis(3.0f));
+    group.capture();
+    CORRADE_COMPARE(interpolable.previousTransformationMatrix(), Matrix4::translation({1.0f, 2.0f, 0.0f}));
+    CORRADE_COMPARE(interpolable.currentTransformationMatrix(), Matrix4::translation({1.0f, 2.0f, 3.0f}));
+}
+
+void InterpolableTest::reset() {
+    Object3D object;
+    InterpolableGroup3D group;
+    Interpolable3D interpolable{object, &group};
+
+    group.capture();
+    object.translate(Vector3::xAxis(10.0f));
+    group.capture();
+    CORRADE_COMPARE(interpolable.previousTransformationMatrix(), Matrix4{});
+
+    /* Teleported, no interpolation from the original position */
+    interpolable.reset();
+    CORRADE_COMPARE(interpolable.previousTransformationMatrix(), Matrix4::translation(Vector3::xAxis(10.0f)));
+    CORRADE_COMPARE(interpolable.currentTransformationMatrix(), Matrix4::translation(Vector3::xAxis(10.0f)));
+    CORRADE_COMPARE(interpolable.interpolatedTransformationMatrix(), Matrix4::translation(Vector3::xAxis(10.0f)));
+}
+
+void InterpolableTest::interpolate2D() {
+    Object2D object;
+    InterpolableGroup2D group;
+    Interpolable2D interpolable{object, &group};
+
+    object.setTransformation(Matrix3::translation({2.0f, 0.0f})*Matrix3::scaling(Vector2{1.0f}));
+    group.capture();
+    object.setTransformation(Matrix3::translation({4.0f, 2.0f})*Matrix3::rotation(Deg(90.0f))*Matrix3::scaling({3.0f, 1.0f}));
+    group.capture();
+
+    group.interpolate(0.0f);
+    CORRADE_COMPARE(interpolable.interpolatedTransformationMatrix(), interpolable.previousTransformationMatrix());
+    group.interpolate(1.0f);
+    CORRADE_COMPARE(interpolable.interpolatedTransformationMatrix(), interpolable.currentTransformationMatrix());
+    group.interpolate(0.5f);
+    CORRADE_COMPARE(interpolable.interpolatedTransformationMatrix(), Matrix3::translation({3.0f, 1.0f})*Matrix3::rotation(Deg(45.0f))*Matrix3::scaling({2.0f, 1.0f}));
+}
+
+void InterpolableTest::interpolate3D() {
+    Object3D object;
+    InterpolableGroup3D group;
+    Interpolable3D interpolable{object, &group};
+
+    object.setTransformation(Matrix4::translation({2.0f, 0.0f, -1.0f}));
+    group.capture();
+    object.setTransformation(Matrix4::translation({4.0f, 2.0f, 1.0f})*Matrix4::rotationY(Deg(60.0f))*Matrix4::scaling({1.0f, 3.0f, 2.0f}));
+    group.capture();
+
+    group.interpolate(0.0f);
+    CORRADE_COMPARE(interpolable.interpolatedTransformationMatrix(), interpolable.previousTransformationMatrix());
+    group.interpolate(1.0f);
+    CORRADE_COMPARE(interpolable.interpolatedTransformationMatrix(), interpolable.currentTransformationMatrix());
+    group.interpolate(0.5f);
+    CORRADE_COMPARE(interpolable.interpolatedTransformationMatrix(), Matrix4::translation({3.0f, 1.0f, 0.0f})*Matrix4::rotationY(Deg(30.0f))*Matrix4::scaling({1.0f, 2.0f, 1.5f}));
+}
+
+void InterpolableTest::interpolateShortestPath() {
+    Object2D object2D;
+    InterpolableGroup2D group2D;
+    Interpolable2D interpolable2D{object2D, &group2D};
+
+    /* Interpolating between 170° and -170° should go over 180° */
+    object2D.setTransformation(Matrix3::rotation(Deg(170.0f)));
+    group2D.capture();
+    object2D.setTransformation(Matrix3::rotation(Deg(-170.0f)));
+    group2D.capture();
+    group2D.interpolate(0.5f);
+    CORRADE_COMPARE(interpolable2D.interpolatedTransformationMatrix(), Matrix3::rotation(Deg(180.0f)));
+
+    Object3D object3D;
+    InterpolableGroup3D group3D;
+    Interpolable3D interpolable3D{object3D, &group3D};
+
+    object3D.setTransformation(Matrix4::rotationX(Deg(170.0f)));
+    group3D.capture();
+    object3D.setTransformation(Matrix4::rotationX(Deg(-170.0f)));
+    group3D.capture();
+    group3D.interpolate(0.5f);
+    CORRADE_COMPARE(interpolable3D.interpolatedTransformationMatrix(), Matrix4::rotationX(Deg(180.0f)));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::InterpolableTest)
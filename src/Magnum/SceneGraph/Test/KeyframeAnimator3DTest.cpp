@@ -0,0 +1,253 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/DualQuaternionTransformation.h"
+#include "Magnum/SceneGraph/KeyframeAnimator3D.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Object.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/TransformationArray.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct KeyframeAnimator3DTest: TestSuite::Tester {
+    explicit KeyframeAnimator3DTest();
+
+    void addTrack();
+    void addTrackInvalid();
+    void addPlayerInvalidTrack();
+    void interpolate();
+    void clampNonLooping();
+    void looping();
+    void singleKeyframe();
+    void rotationShortestPath();
+    void applyObjects();
+    void applyObjectsInvalidCount();
+    void applyTransformationArray();
+};
+
+typedef Object<MatrixTransformation3D> Object3D;
+typedef Scene<MatrixTransformation3D> Scene3D;
+
+KeyframeAnimator3DTest::KeyframeAnimator3DTest() {
+    addTests({&KeyframeAnimator3DTest::addTrack,
+              &KeyframeAnimator3DTest::addTrackInvalid,
+              &KeyframeAnimator3DTest::addPlayerInvalidTrack,
+              &KeyframeAnimator3DTest::interpolate,
+              &KeyframeAnimator3DTest::clampNonLooping,
+              &KeyframeAnimator3DTest::looping,
+              &KeyframeAnimator3DTest::singleKeyframe,
+              &KeyframeAnimator3DTest::rotationShortestPath,
+              &KeyframeAnimator3DTest::applyObjects,
+              &KeyframeAnimator3DTest::applyObjectsInvalidCount,
+              &KeyframeAnimator3DTest::applyTransformationArray});
+}
+
+namespace {
+
+UnsignedInt addTranslationTrack(KeyframeAnimator3D& animator) {
+    return animator.addTrack({1.0f, 2.0f, 4.0f},
+        {{}, Vector3::xAxis(2.0f), Vector3::yAxis(4.0f)},
+        {Quaternion{}, Quaternion{}, Quaternion{}},
+        {Vector3{1.0f}, Vector3{3.0f}, Vector3{1.0f}});
+}
+
+}
+
+void KeyframeAnimator3DTest::addTrack() {
+    KeyframeAnimator3D animator;
+    CORRADE_COMPARE(animator.trackCount(), 0);
+
+    const UnsignedInt track = addTranslationTrack(animator);
+    CORRADE_COMPARE(track, 0);
+    CORRADE_COMPARE(animator.trackCount(), 1);
+    CORRADE_COMPARE(animator.trackDuration(track), 3.0f);
+
+    /* Before first step the first keyframe is used */
+    CORRADE_COMPARE(animator.addPlayer(track), 0);
+    CORRADE_COMPARE(animator.addPlayer(track), 1);
+    CORRADE_COMPARE(animator.playerCount(), 2);
+    CORRADE_COMPARE(animator.transformationMatrix(1), Matrix4());
+}
+
+void KeyframeAnimator3DTest::addTrackInvalid() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    KeyframeAnimator3D animator;
+    animator.addTrack({0.0f, 1.0f}, {{}, {}}, {Quaternion{}}, {Vector3{1.0f}, Vector3{1.0f}});
+    animator.addTrack({}, {}, {}, {});
+    CORRADE_COMPARE(animator.trackCount(), 0);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::KeyframeAnimator3D::addTrack(): expected the same non-zero count of times, translations, rotations and scalings\n"
+        "SceneGraph::KeyframeAnimator3D::addTrack(): expected the same non-zero count of times, translations, rotations and scalings\n");
+}
+
+void KeyframeAnimator3DTest::addPlayerInvalidTrack() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    KeyframeAnimator3D animator;
+    animator.addPlayer(0);
+    CORRADE_COMPARE(animator.playerCount(), 0);
+    CORRADE_COMPARE(out.str(), "SceneGraph::KeyframeAnimator3D::addPlayer(): invalid track 0\n");
+}
+
+void KeyframeAnimator3DTest::interpolate() {
+    KeyframeAnimator3D animator;
+    const UnsignedInt track = addTranslationTrack(animator);
+    animator.addPlayer(track, 0.0f, false);
+    animator.addPlayer(track, 1.0f, false);
+
+    /* First is in the middle of the first segment, second at the start */
+    animator.step(0.5f);
+    CORRADE_COMPARE(animator.translations()[0], Vector3::xAxis(1.0f));
+    CORRADE_COMPARE(animator.scalings()[0], Vector3{2.0f});
+    CORRADE_COMPARE(animator.translations()[1], Vector3{});
+    CORRADE_COMPARE(animator.transformationMatrix(0),
+        Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3{2.0f}));
+
+    /* Second segment */
+    animator.step(2.0f);
+    CORRADE_COMPARE(animator.translations()[0], (Vector3{1.0f, 2.0f, 0.0f}));
+    CORRADE_COMPARE(animator.scalings()[0], Vector3{2.0f});
+    CORRADE_COMPARE(animator.translations()[1], Vector3::xAxis(2.0f));
+
+    /* Going back in time */
+    animator.step(0.25f);
+    CORRADE_COMPARE(animator.translations()[0], Vector3::xAxis(0.5f));
+}
+
+void KeyframeAnimator3DTest::clampNonLooping() {
+    KeyframeAnimator3D animator;
+    const UnsignedInt track = addTranslationTrack(animator);
+    animator.addPlayer(track, 5.0f, false);
+
+    animator.step(1.0f);
+    CORRADE_COMPARE(animator.translations()[0], Vector3{});
+
+    animator.step(100.0f);
+    CORRADE_COMPARE(animator.translations()[0], Vector3::yAxis(4.0f));
+    CORRADE_COMPARE(animator.scalings()[0], Vector3{1.0f});
+}
+
+void KeyframeAnimator3DTest::looping() {
+    KeyframeAnimator3D animator;
+    const UnsignedInt track = addTranslationTrack(animator);
+    animator.addPlayer(track, 0.0f, true);
+
+    animator.step(3.5f);
+    CORRADE_COMPARE(animator.translations()[0], Vector3::xAxis(1.0f));
+
+    animator.step(5.0f);
+    CORRADE_COMPARE(animator.translations()[0], (Vector3{1.0f, 2.0f, 0.0f}));
+}
+
+void KeyframeAnimator3DTest::singleKeyframe() {
+    KeyframeAnimator3D animator;
+    const UnsignedInt track = animator.addTrack({0.0f}, {Vector3::zAxis(3.0f)}, {Quaternion{}}, {Vector3{1.0f}});
+    animator.addPlayer(track);
+    CORRADE_COMPARE(animator.trackDuration(track), 0.0f);
+
+    animator.step(10.0f);
+    CORRADE_COMPARE(animator.translations()[0], Vector3::zAxis(3.0f));
+}
+
+void KeyframeAnimator3DTest::rotationShortestPath() {
+    const Quaternion a = Quaternion::rotation(Deg(10.0f), Vector3::zAxis());
+    const Quaternion b = Quaternion::rotation(Deg(50.0f), Vector3::zAxis());
+
+    KeyframeAnimator3D animator;
+    const UnsignedInt track = animator.addTrack({0.0f, 1.0f, 2.0f, 3.0f},
+        {{}, {}, {}, {}},
+        /* -b is the same rotation as b, but on the other hemisphere */
+        {a, b, -b, a},
+        {Vector3{1.0f}, Vector3{1.0f}, Vector3{1.0f}, Vector3{1.0f}});
+    animator.addPlayer(track, 0.0f, false);
+
+    animator.step(0.5f);
+    CORRADE_COMPARE(animator.rotations()[0], Quaternion::rotation(Deg(30.0f), Vector3::zAxis()));
+
+    /* Identical rotations, no division by zero */
+    animator.step(1.5f);
+    CORRADE_VERIFY(animator.rotations()[0] == b || animator.rotations()[0] == -b);
+
+    /* Would go the long way around without flipping */
+    animator.step(2.5f);
+    const Quaternion expected = Quaternion::rotation(Deg(30.0f), Vector3::zAxis());
+    CORRADE_VERIFY(animator.rotations()[0] == expected || animator.rotations()[0] == -expected);
+}
+
+void KeyframeAnimator3DTest::applyObjects() {
+    KeyframeAnimator3D animator;
+    const UnsignedInt track = addTranslationTrack(animator);
+    animator.addPlayer(track, 0.0f, false);
+    animator.addPlayer(track, 1.0f, false);
+    animator.step(2.0f);
+
+    Scene3D scene;
+    Object3D a{&scene};
+    Object3D b{&scene};
+    animator.apply(std::vector<Object3D*>{&a, &b});
+    CORRADE_COMPARE(a.transformation(), Matrix4::translation({1.0f, 2.0f, 0.0f})*Matrix4::scaling(Vector3{2.0f}));
+    CORRADE_COMPARE(b.transformation(), Matrix4::translation(Vector3::xAxis(2.0f))*Matrix4::scaling(Vector3{3.0f}));
+}
+
+void KeyframeAnimator3DTest::applyObjectsInvalidCount() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    KeyframeAnimator3D animator;
+    animator.addPlayer(addTranslationTrack(animator));
+
+    animator.apply(std::vector<Object3D*>{});
+    CORRADE_COMPARE(out.str(), "SceneGraph::KeyframeAnimator3D::apply(): expected 1 objects but got 0\n");
+}
+
+void KeyframeAnimator3DTest::applyTransformationArray() {
+    const Quaternion rotation = Quaternion::rotation(Deg(90.0f), Vector3::xAxis());
+
+    KeyframeAnimator3D animator;
+    const UnsignedInt track = animator.addTrack({0.0f, 2.0f},
+        {{}, Vector3::zAxis(2.0f)},
+        {Quaternion{}, rotation},
+        {Vector3{1.0f}, Vector3{1.0f}});
+    animator.addPlayer(track, 0.0f, false);
+    animator.step(2.0f);
+
+    TransformationArray<DualQuaternionTransformation> array;
+    array.add();
+    const UnsignedInt id = array.add();
+    animator.apply(array, {id});
+    CORRADE_COMPARE(array.transformation(id), DualQuaternion::translation(Vector3::zAxis(2.0f))*DualQuaternion::rotation(Deg(90.0f), Vector3::xAxis()));
+    CORRADE_COMPARE(array.transformation(0), DualQuaternion());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::KeyframeAnimator3DTest)
@@ -0,0 +1,184 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Camera2D.h"
+#include "Magnum/SceneGraph/Camera3D.h"
+#include "Magnum/SceneGraph/LodDrawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation2D.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct LodDrawableTest: TestSuite::Tester {
+    explicit LodDrawableTest();
+
+    void projectedSizeOrthographic2D();
+    void projectedSizePerspective();
+    void projectedSizeNoBoundingSphere();
+    void select();
+    void thresholdsInvalid();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+namespace {
+    template<UnsignedInt dimensions> class Drawable: public SceneGraph::LodDrawable<dimensions, Float> {
+        public:
+            explicit Drawable(AbstractObject<dimensions, Float>& object, DrawableGroup<dimensions, Float>* group = nullptr): SceneGraph::LodDrawable<dimensions, Float>{object, group}, drawnLevel{~UnsignedInt{}} {}
+
+            UnsignedInt drawnLevel;
+
+        private:
+            void drawLod(UnsignedInt level, const MatrixTypeFor<dimensions, Float>&, AbstractCamera<dimensions, Float>&) override {
+                drawnLevel = level;
+            }
+    };
+}
+
+LodDrawableTest::LodDrawableTest() {
+    addTests({&LodDrawableTest::projectedSizeOrthographic2D,
+              &LodDrawableTest::projectedSizePerspective,
+              &LodDrawableTest::projectedSizeNoBoundingSphere,
+              &LodDrawableTest::select,
+              &LodDrawableTest::thresholdsInvalid});
+}
+
+void LodDrawableTest::projectedSizeOrthographic2D() {
+    Scene2D scene;
+    Object2D cameraObject{&scene};
+    Camera2D camera{cameraObject};
+    camera.setProjection({4.0f, 4.0f});
+
+    Object2D object{&scene};
+    Drawable<2> drawable{object};
+    drawable.setBoundingSphere({}, 1.0f);
+
+    /* The distance doesn't matter, the sphere covers half of the height */
+    CORRADE_COMPARE(drawable.projectedSize(Matrix3::translation({0.5f, 0.0f}), camera), 0.5f);
+
+    /* Scaling is taken into account */
+    CORRADE_COMPARE(drawable.projectedSize(Matrix3::scaling({0.5f, 1.5f}), camera), 0.75f);
+}
+
+void LodDrawableTest::projectedSizePerspective() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setPerspective(Deg(90.0f), 1.0f, 0.1f, 100.0f);
+
+    Object3D object{&scene};
+    Drawable<3> drawable{object};
+    drawable.setBoundingSphere({}, 1.0f);
+
+    CORRADE_COMPARE(drawable.projectedSize(Matrix4::translation(Vector3::zAxis(-2.0f)), camera), 0.5f);
+    CORRADE_COMPARE(drawable.projectedSize(Matrix4::translation(Vector3::zAxis(-10.0f)), camera), 0.1f);
+    CORRADE_COMPARE(drawable.projectedSize(Matrix4::translation(Vector3::zAxis(-10.0f))*Matrix4::scaling(Vector3(2.0f)), camera), 0.2f);
+
+    /* Behind the camera */
+    CORRADE_VERIFY(std::isinf(drawable.projectedSize(Matrix4::translation(Vector3::zAxis(5.0f)), camera)));
+}
+
+void LodDrawableTest::projectedSizeNoBoundingSphere() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setPerspective(Deg(90.0f), 1.0f, 0.1f, 100.0f);
+
+    Object3D object{&scene};
+    Drawable<3> drawable{object};
+    CORRADE_VERIFY(!drawable.hasBoundingSphere());
+    CORRADE_VERIFY(std::isinf(drawable.projectedSize(Matrix4::translation(Vector3::zAxis(-50.0f)), camera)));
+}
+
+void LodDrawableTest::select() {
+    Scene3D scene;
+    DrawableGroup3D group;
+
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setPerspective(Deg(90.0f), 1.0f, 0.1f, 100.0f);
+
+    Object3D near{&scene};
+    near.translate(Vector3::zAxis(-2.0f));
+    Object3D middle{&scene};
+    middle.translate(Vector3::zAxis(-10.0f));
+    Object3D far{&scene};
+    far.translate(Vector3::zAxis(-40.0f));
+    Object3D farScaled{&scene};
+    farScaled.scale(Vector3(4.0f))
+        .translate(Vector3::zAxis(-40.0f));
+
+    Drawable<3> nearDrawable{near, &group};
+    Drawable<3> middleDrawable{middle, &group};
+    Drawable<3> farDrawable{far, &group};
+    Drawable<3> farScaledDrawable{farScaled, &group};
+    Drawable<3> farNoSphereDrawable{far, &group};
+    for(Drawable<3>* d: {&nearDrawable, &middleDrawable, &farDrawable, &farScaledDrawable, &farNoSphereDrawable}) {
+        CORRADE_COMPARE(d->level(), 0);
+        d->setThresholds({0.3f, 0.05f});
+    }
+    for(Drawable<3>* d: {&nearDrawable, &middleDrawable, &farDrawable, &farScaledDrawable})
+        d->setBoundingSphere({}, 1.0f);
+
+    camera.draw(group);
+    CORRADE_COMPARE(nearDrawable.drawnLevel, 0);
+    CORRADE_COMPARE(middleDrawable.drawnLevel, 1);
+    CORRADE_COMPARE(farDrawable.drawnLevel, 2);
+    CORRADE_COMPARE(farDrawable.level(), 2);
+    CORRADE_COMPARE(farScaledDrawable.drawnLevel, 1);
+    CORRADE_COMPARE(farNoSphereDrawable.drawnLevel, 0);
+
+    /* Moving the object closer selects more detailed level */
+    far.translate(Vector3::zAxis(30.0f));
+    camera.draw(group);
+    CORRADE_COMPARE(farDrawable.drawnLevel, 1);
+}
+
+void LodDrawableTest::thresholdsInvalid() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Scene3D scene;
+    Object3D object{&scene};
+    Drawable<3> drawable{object};
+    drawable.setThresholds({0.5f, 0.5f});
+    drawable.setThresholds({0.5f, -0.1f});
+    CORRADE_VERIFY(drawable.thresholds().empty());
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::LodDrawable::setThresholds(): expected positive thresholds in decreasing order\n"
+        "SceneGraph::LodDrawable::setThresholds(): expected positive thresholds in decreasing order\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::LodDrawableTest)
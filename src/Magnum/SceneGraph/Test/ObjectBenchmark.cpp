@@ -0,0 +1,129 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/Test/BenchmarkTester.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+struct ObjectBenchmark: Magnum::Test::BenchmarkTester {
+    explicit ObjectBenchmark();
+
+    void transformations();
+    void transformationsShallow();
+    void transformationsArray();
+    void absoluteTransformationMatrix();
+
+    private:
+        Scene3D _scene;
+        std::vector<std::reference_wrapper<Object3D>> _objects;
+        std::vector<std::reference_wrapper<Object3D>> _leaves;
+};
+
+namespace {
+    /* 64 subtrees, each four levels deep with three children per object,
+       i.e. 7744 objects in total */
+    constexpr std::size_t RootCount = 64;
+    constexpr std::size_t ChildCount = 3;
+    constexpr std::size_t Depth = 4;
+    constexpr std::size_t Repeats = 32;
+}
+
+ObjectBenchmark::ObjectBenchmark() {
+    addTests({&ObjectBenchmark::transformations,
+              &ObjectBenchmark::transformationsShallow,
+              &ObjectBenchmark::transformationsArray,
+              &ObjectBenchmark::absoluteTransformationMatrix});
+
+    std::vector<Object3D*> level;
+    for(std::size_t i = 0; i != RootCount; ++i) {
+        Object3D* o = new Object3D{&_scene};
+        o->translate({Float(i%16), 0.0f, -Float(i/16)});
+        level.push_back(o);
+        _objects.push_back(*o);
+    }
+
+    for(std::size_t d = 0; d != Depth; ++d) {
+        std::vector<Object3D*> next;
+        for(Object3D* parent: level) for(std::size_t i = 0; i != ChildCount; ++i) {
+            Object3D* o = new Object3D{parent};
+            o->rotateY(Deg(15.0f*(i + 1)))
+                .translate({0.0f, 1.0f, 0.0f});
+            next.push_back(o);
+            _objects.push_back(*o);
+        }
+        level = std::move(next);
+    }
+
+    for(Object3D* o: level) _leaves.push_back(*o);
+}
+
+void ObjectBenchmark::transformations() {
+    std::vector<Matrix4> out;
+    benchmark("Object::transformationMatrices(), all objects:", _objects.size(), Repeats, [this, &out]() {
+        out = _scene.transformationMatrices(_objects);
+    });
+
+    /* Use the results so the computation doesn't get optimized out */
+    CORRADE_COMPARE(out.back(), _objects.back().get().absoluteTransformationMatrix());
+}
+
+void ObjectBenchmark::transformationsShallow() {
+    std::vector<Matrix4> out;
+    benchmark("Object::transformationMatrices(), leaves only:", _leaves.size(), Repeats, [this, &out]() {
+        out = _scene.transformationMatrices(_leaves);
+    });
+
+    CORRADE_COMPARE(out.back(), _leaves.back().get().absoluteTransformationMatrix());
+}
+
+void ObjectBenchmark::transformationsArray() {
+    std::vector<Matrix4> out(_objects.size());
+    benchmark("Object::transformationMatrices(), into array:", _objects.size(), Repeats, [this, &out]() {
+        _scene.transformationMatrices(_objects, {out.data(), out.size()});
+    });
+
+    CORRADE_COMPARE(out.back(), _objects.back().get().absoluteTransformationMatrix());
+}
+
+void ObjectBenchmark::absoluteTransformationMatrix() {
+    std::vector<Matrix4> out(_objects.size());
+    benchmark("Object::absoluteTransformationMatrix():", _objects.size(), Repeats, [this, &out]() {
+        for(std::size_t i = 0; i != _objects.size(); ++i)
+            out[i] = _objects[i].get().absoluteTransformationMatrix();
+    });
+
+    CORRADE_COMPARE(out.back(), _scene.transformationMatrices({_objects.back()}).front());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ObjectBenchmark)
@@ -0,0 +1,156 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Object.h"
+#include "Magnum/SceneGraph/ObjectPool.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct ObjectPoolTest: TestSuite::Tester {
+    explicit ObjectPoolTest();
+
+    void allocate();
+    void reuse();
+    void large();
+    void objects();
+    void mixed();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+namespace {
+    class Feature: public AbstractFeature3D {
+        public:
+            explicit Feature(AbstractObject3D& object, Int& destructed): AbstractFeature3D{object}, _destructed(destructed) {}
+            ~Feature() { ++_destructed; }
+
+        private:
+            Int& _destructed;
+    };
+}
+
+ObjectPoolTest::ObjectPoolTest() {
+    addTests({&ObjectPoolTest::allocate,
+              &ObjectPoolTest::reuse,
+              &ObjectPoolTest::large,
+              &ObjectPoolTest::objects,
+              &ObjectPoolTest::mixed});
+}
+
+void ObjectPoolTest::allocate() {
+    ObjectPool pool{1024};
+    void* a = pool.allocate(24);
+    void* b = pool.allocate(24);
+    CORRADE_COMPARE(pool.allocationCount(), 2);
+    CORRADE_COMPARE(pool.chunkCount(), 1);
+
+    /* Allocations are aligned and consecutive */
+    CORRADE_COMPARE(reinterpret_cast<std::size_t>(a) % ObjectPool::Alignment, 0);
+    CORRADE_COMPARE(static_cast<char*>(b) - static_cast<char*>(a), 32);
+
+    /* New chunk is allocated when the current one is full */
+    void* c = pool.allocate(1000);
+    CORRADE_COMPARE(pool.chunkCount(), 2);
+
+    pool.deallocate(a, 24);
+    pool.deallocate(b, 24);
+    pool.deallocate(c, 1000);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+}
+
+void ObjectPoolTest::reuse() {
+    ObjectPool pool;
+    void* a = pool.allocate(48);
+    pool.deallocate(a, 48);
+
+    /* Same size class gets the freed memory back */
+    void* b = pool.allocate(40);
+    CORRADE_COMPARE(b, a);
+
+    /* Different size class doesn't */
+    void* c = pool.allocate(64);
+    CORRADE_VERIFY(c != a);
+
+    pool.deallocate(b, 40);
+    pool.deallocate(c, 64);
+}
+
+void ObjectPoolTest::large() {
+    ObjectPool pool;
+    void* a = pool.allocate(ObjectPool::MaxPooledSize + 1);
+    CORRADE_COMPARE(pool.allocationCount(), 1);
+    CORRADE_COMPARE(pool.chunkCount(), 0);
+    pool.deallocate(a, ObjectPool::MaxPooledSize + 1);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+}
+
+void ObjectPoolTest::objects() {
+    ObjectPool pool;
+    Int destructed = 0;
+    {
+        Scene3D scene;
+        for(std::size_t i = 0; i != 100; ++i) {
+            Object3D* object = new(pool) Object3D{&scene};
+            new(pool) Feature{*object, destructed};
+            new(pool) Object3D{object};
+        }
+
+        CORRADE_COMPARE(pool.allocationCount(), 300);
+
+        /* Deleting object deletes its children and features */
+        delete scene.children().first();
+        CORRADE_COMPARE(pool.allocationCount(), 297);
+        CORRADE_COMPARE(destructed, 1);
+    }
+
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+    CORRADE_COMPARE(destructed, 100);
+}
+
+void ObjectPoolTest::mixed() {
+    ObjectPool pool;
+    Int destructed = 0;
+    {
+        Scene3D scene;
+        Object3D* a = new Object3D{&scene};
+        Object3D* b = new(pool) Object3D{a};
+        new Feature{*b, destructed};
+        new(pool) Feature{*a, destructed};
+        CORRADE_COMPARE(pool.allocationCount(), 2);
+    }
+
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+    CORRADE_COMPARE(destructed, 2);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ObjectPoolTest)
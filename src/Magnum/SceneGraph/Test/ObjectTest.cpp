@@ -23,11 +23,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <memory>
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/Threading.h"
 
 namespace Magnum { namespace SceneGraph { namespace Test {
 
@@ -42,6 +44,11 @@ struct ObjectTest: TestSuite::Tester {
     void transformationsRelative();
     void transformationsOrphan();
     void transformationsDuplicate();
+    void transformationsCached();
+    void transformationsLarge();
+    void transformationsParallel();
+    void transformationsArray();
+    void transformationsArrayWrongSize();
     void setClean();
     void setCleanListHierarchy();
     void setCleanListBulk();
@@ -76,6 +83,11 @@ ObjectTest::ObjectTest() {
               &ObjectTest::transformationsRelative,
               &ObjectTest::transformationsOrphan,
               &ObjectTest::transformationsDuplicate,
+              &ObjectTest::transformationsCached,
+              &ObjectTest::transformationsLarge,
+              &ObjectTest::transformationsParallel,
+              &ObjectTest::transformationsArray,
+              &ObjectTest::transformationsArrayWrongSize,
               &ObjectTest::setClean,
               &ObjectTest::setCleanListHierarchy,
               &ObjectTest::setCleanListBulk,
@@ -276,6 +288,152 @@ void ObjectTest::transformationsDuplicate() {
     }));
 }
 
+void ObjectTest::transformationsCached() {
+    Scene3D s;
+    Object3D first(&s);
+    first.rotateZ(Deg(30.0f));
+    Object3D second(&first);
+    second.scale(Vector3(0.5f));
+    Object3D third(&second);
+    third.translate(Vector3::xAxis(5.0f));
+
+    /* Clean everything, the transformations are now cached */
+    third.setClean();
+    CORRADE_VERIFY(!first.isDirty());
+    CORRADE_VERIFY(!second.isDirty());
+    CORRADE_VERIFY(!third.isDirty());
+    CORRADE_COMPARE(third.absoluteTransformation(),
+        Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f))*Matrix4::translation(Vector3::xAxis(5.0f)));
+
+    /* Clean objects only */
+    Matrix4 initial = Matrix4::rotationX(Deg(90.0f)).inverted();
+    CORRADE_COMPARE(s.transformations({third, first}, initial), (std::vector<Matrix4>{
+        initial*Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f))*Matrix4::translation(Vector3::xAxis(5.0f)),
+        initial*Matrix4::rotationZ(Deg(30.0f))
+    }));
+
+    /* Dirty subtree below clean parent */
+    second.scale(Vector3(2.0f));
+    CORRADE_VERIFY(!first.isDirty());
+    CORRADE_VERIFY(second.isDirty());
+    CORRADE_VERIFY(third.isDirty());
+    Object3D fourth(&first);
+    fourth.translate(Vector3::yAxis(3.0f));
+    CORRADE_COMPARE(s.transformations({third, fourth}, initial), (std::vector<Matrix4>{
+        initial*Matrix4::rotationZ(Deg(30.0f))*Matrix4::translation(Vector3::xAxis(5.0f)),
+        initial*Matrix4::rotationZ(Deg(30.0f))*Matrix4::translation(Vector3::yAxis(3.0f))
+    }));
+
+    /* Cache is updated after cleaning again */
+    Object3D::setClean({third, fourth});
+    CORRADE_COMPARE(s.transformations({third, second, fourth}), (std::vector<Matrix4>{
+        Matrix4::rotationZ(Deg(30.0f))*Matrix4::translation(Vector3::xAxis(5.0f)),
+        Matrix4::rotationZ(Deg(30.0f)),
+        Matrix4::rotationZ(Deg(30.0f))*Matrix4::translation(Vector3::yAxis(3.0f))
+    }));
+}
+
+void ObjectTest::transformationsLarge() {
+    /* More objects than would fit into 16-bit counter */
+    Scene3D s;
+    Object3D parent(&s);
+    parent.translate(Vector3::xAxis(1.0f));
+    std::vector<std::unique_ptr<Object3D>> children;
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    children.reserve(70000);
+    objects.reserve(70000);
+    for(std::size_t i = 0; i != 70000; ++i) {
+        children.emplace_back(new Object3D(&parent));
+        children.back()->translate(Vector3::yAxis(Float(i)));
+        objects.push_back(*children.back());
+    }
+
+    std::vector<Matrix4> transformations = s.transformations(objects);
+    CORRADE_COMPARE(transformations.size(), std::size_t(70000));
+    CORRADE_COMPARE(transformations[0], Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(transformations[69999], Matrix4::translation({1.0f, 69999.0f, 0.0f}));
+}
+
+void ObjectTest::transformationsParallel() {
+    /* Ternary tree with some clean objects */
+    Scene3D s;
+    std::vector<std::unique_ptr<Object3D>> objects;
+    std::vector<std::reference_wrapper<Object3D>> references;
+    objects.reserve(5000);
+    references.reserve(5000);
+    for(std::size_t i = 0; i != 5000; ++i) {
+        Object3D* parent = i ? objects[(i - 1)/3].get() : &s;
+        objects.emplace_back(new Object3D(parent));
+        objects.back()->rotateZ(Deg(Float(i%7)))
+            .translate(Vector3::xAxis(Float(i%5)));
+        references.push_back(*objects.back());
+    }
+    objects[1]->setClean();
+    objects[1000]->setClean();
+
+    const Matrix4 initial = Matrix4::rotationX(Deg(90.0f)).inverted();
+    std::vector<Matrix4> expected = s.transformations(references, initial);
+
+    setThreadCount(4);
+    CORRADE_COMPARE(threadCount(), 4);
+    std::vector<Matrix4> transformations = s.transformations(references, initial);
+    setThreadCount(1);
+    CORRADE_COMPARE(threadCount(), 1);
+
+    CORRADE_COMPARE(transformations, expected);
+
+    /* All marks should be cleaned up after the parallel computation */
+    CORRADE_COMPARE(s.transformations(references, initial), expected);
+}
+
+void ObjectTest::transformationsArray() {
+    Scene3D s;
+    Object3D first(&s);
+    first.rotateZ(Deg(30.0f));
+    Object3D second(&first);
+    second.scale(Vector3(0.5f));
+    Object3D third(&first);
+    third.translate(Vector3::xAxis(5.0f));
+
+    const Matrix4 initial = Matrix4::rotationX(Deg(90.0f)).inverted();
+    const std::vector<std::reference_wrapper<Object3D>> objects{second, third, second, first};
+    const std::vector<Matrix4> expected = s.transformations(objects, initial);
+
+    Matrix4 out[4];
+    s.transformations(objects, out, initial);
+    CORRADE_COMPARE(std::vector<Matrix4>(out, out + 4), expected);
+
+    /* Calling it again with the storage already allocated gives the same
+       result */
+    Matrix4 matrices[4];
+    s.transformationMatrices(objects, matrices, initial);
+    CORRADE_COMPARE(std::vector<Matrix4>(matrices, matrices + 4), expected);
+    s.transformationMatrices(objects, matrices, initial);
+    CORRADE_COMPARE(std::vector<Matrix4>(matrices, matrices + 4), expected);
+
+    /* Abstract interface */
+    const std::vector<std::reference_wrapper<AbstractObject3D>> abstractObjects{second, third, second, first};
+    Matrix4 abstractMatrices[4];
+    static_cast<AbstractObject3D&>(s).transformationMatrices(abstractObjects, abstractMatrices, initial);
+    CORRADE_COMPARE(std::vector<Matrix4>(abstractMatrices, abstractMatrices + 4), expected);
+}
+
+void ObjectTest::transformationsArrayWrongSize() {
+    std::ostringstream o;
+    Error::setOutput(&o);
+
+    Scene3D s;
+    Object3D first(&s);
+    Object3D second(&s);
+
+    Matrix4 out[1];
+    s.transformations({first, second}, out);
+    s.transformationMatrices({first, second}, out);
+    CORRADE_COMPARE(o.str(),
+        "SceneGraph::Object::transformations(): expected output array of size 2 but got 1\n"
+        "SceneGraph::Object::transformationMatrices(): expected output array of size 2 but got 1\n");
+}
+
 void ObjectTest::setClean() {
     Scene3D scene;
 
@@ -0,0 +1,331 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Angle.h"
+#include "Magnum/SceneGraph/Camera3D.h"
+#include "Magnum/SceneGraph/MatrixTransformation2D.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/SpatialIndex.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct SpatialIndexTest: TestSuite::Tester {
+    explicit SpatialIndexTest();
+
+    void absoluteBounds();
+    void queryBox();
+    void querySphere2D();
+    void queryCamera();
+    void outside();
+    void update();
+    void setBounds();
+    void remove();
+    void moveToAnotherIndex();
+    void destroyIndex();
+    void maxDepthInvalid();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+namespace {
+    const Range3D UnitBox{Vector3{-0.5f}, Vector3{0.5f}};
+
+    template<class T> std::vector<T*> sorted(std::vector<T*> features) {
+        std::sort(features.begin(), features.end());
+        return features;
+    }
+}
+
+SpatialIndexTest::SpatialIndexTest() {
+    addTests({&SpatialIndexTest::absoluteBounds,
+              &SpatialIndexTest::queryBox,
+              &SpatialIndexTest::querySphere2D,
+              &SpatialIndexTest::queryCamera,
+              &SpatialIndexTest::outside,
+              &SpatialIndexTest::update,
+              &SpatialIndexTest::setBounds,
+              &SpatialIndexTest::remove,
+              &SpatialIndexTest::moveToAnotherIndex,
+              &SpatialIndexTest::destroyIndex,
+              &SpatialIndexTest::maxDepthInvalid});
+}
+
+void SpatialIndexTest::absoluteBounds() {
+    Scene3D scene;
+    Object3D object{&scene};
+    object.rotateZ(Deg(45.0f))
+        .translate({1.0f, 2.0f, 3.0f});
+
+    SpatialIndex3D index{{Vector3{-8.0f}, Vector3{8.0f}}};
+    SpatialFeature3D feature{object, {Vector3{-1.0f}, Vector3{1.0f}}, &index};
+    CORRADE_VERIFY(feature.index() == &index);
+    CORRADE_COMPARE(index.size(), 1);
+
+    /* The bounds are updated lazily */
+    index.update();
+    CORRADE_COMPARE(feature.absoluteBounds(), (Range3D{
+        {1.0f - Constants::sqrt2(), 2.0f - Constants::sqrt2(), 2.0f},
+        {1.0f + Constants::sqrt2(), 2.0f + Constants::sqrt2(), 4.0f}}));
+}
+
+void SpatialIndexTest::queryBox() {
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene}, c{&scene};
+    a.translate({1.0f, 1.0f, 1.0f});
+    b.translate({-5.0f, 3.0f, 0.0f});
+    c.translate({1.5f, 1.0f, 1.0f});
+
+    SpatialIndex3D index{{Vector3{-8.0f}, Vector3{8.0f}}, 4};
+    SpatialFeature3D fa{a, UnitBox, &index};
+    SpatialFeature3D fb{b, UnitBox, &index};
+    SpatialFeature3D fc{c, UnitBox, &index};
+
+    std::vector<SpatialFeature3D*> out;
+    index.queryBox({{0.0f, 0.0f, 0.0f}, {1.2f, 1.2f, 1.2f}}, out);
+    CORRADE_COMPARE(sorted(out), sorted<SpatialFeature3D>({&fa, &fc}));
+
+    /* Queries only append */
+    index.queryBox({{-6.0f, 2.0f, -1.0f}, {-4.0f, 4.0f, 1.0f}}, out);
+    CORRADE_COMPARE(sorted(out), sorted<SpatialFeature3D>({&fa, &fb, &fc}));
+
+    out.clear();
+    index.queryBox({{4.0f, 4.0f, 4.0f}, {8.0f, 8.0f, 8.0f}}, out);
+    CORRADE_VERIFY(out.empty());
+}
+
+void SpatialIndexTest::querySphere2D() {
+    Scene2D scene;
+    Object2D a{&scene}, b{&scene};
+    a.translate({2.0f, 0.0f});
+    b.translate({-4.0f, -4.0f});
+
+    SpatialIndex2D index{{Vector2{-8.0f}, Vector2{8.0f}}};
+    SpatialFeature2D fa{a, {Vector2{-0.5f}, Vector2{0.5f}}, &index};
+    SpatialFeature2D fb{b, {Vector2{-0.5f}, Vector2{0.5f}}, &index};
+
+    std::vector<SpatialFeature2D*> out;
+    index.querySphere({0.0f, 0.0f}, 1.6f, out);
+    CORRADE_COMPARE(out, std::vector<SpatialFeature2D*>{&fa});
+
+    /* The nearest point of the box is its corner */
+    out.clear();
+    index.querySphere({-2.0f, -2.0f}, 2.0f, out);
+    CORRADE_VERIFY(out.empty());
+
+    index.querySphere({-2.0f, -2.0f}, 2.2f, out);
+    CORRADE_COMPARE(out, std::vector<SpatialFeature2D*>{&fb});
+}
+
+void SpatialIndexTest::queryCamera() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setPerspective(Deg(90.0f), 1.0f, 0.1f, 100.0f);
+
+    Object3D front{&scene}, behind{&scene}, side{&scene}, far{&scene};
+    front.translate({0.0f, 0.0f, -5.0f});
+    behind.translate({0.0f, 0.0f, 5.0f});
+    side.translate({7.0f, 0.0f, -5.0f});
+    /* Outside of the index bounds */
+    far.translate({0.0f, 0.0f, -50.0f});
+
+    SpatialIndex3D index{{Vector3{-8.0f}, Vector3{8.0f}}};
+    SpatialFeature3D ffront{front, UnitBox, &index};
+    SpatialFeature3D fbehind{behind, UnitBox, &index};
+    SpatialFeature3D fside{side, UnitBox, &index};
+    SpatialFeature3D ffar{far, UnitBox, &index};
+
+    std::vector<SpatialFeature3D*> out;
+    index.queryCamera(camera, out);
+    CORRADE_COMPARE(sorted(out), sorted<SpatialFeature3D>({&ffront, &ffar}));
+
+    /* Turning the camera around */
+    out.clear();
+    cameraObject.rotateY(Deg(180.0f));
+    index.queryCamera(camera, out);
+    CORRADE_COMPARE(out, std::vector<SpatialFeature3D*>{&fbehind});
+}
+
+void SpatialIndexTest::outside() {
+    Scene3D scene;
+    Object3D large{&scene}, small{&scene};
+    small.translate({20.0f, 0.0f, 0.0f});
+
+    SpatialIndex3D index{{Vector3{-8.0f}, Vector3{8.0f}}};
+    SpatialFeature3D flarge{large, {Vector3{-10.0f}, Vector3{10.0f}}, &index};
+    SpatialFeature3D fsmall{small, UnitBox, &index};
+
+    /* Neither of them needs any tree node */
+    std::vector<SpatialFeature3D*> out;
+    index.queryBox({Vector3{-1.0f}, Vector3{1.0f}}, out);
+    CORRADE_COMPARE(out, std::vector<SpatialFeature3D*>{&flarge});
+    CORRADE_COMPARE(index.nodeCount(), 0);
+
+    out.clear();
+    index.querySphere({20.0f, 0.0f, 0.0f}, 1.0f, out);
+    CORRADE_COMPARE(out, std::vector<SpatialFeature3D*>{&fsmall});
+}
+
+void SpatialIndexTest::update() {
+    Scene3D scene;
+    Object3D object{&scene};
+    object.translate({1.0f, 1.0f, 1.0f});
+
+    SpatialIndex3D index{{Vector3{-8.0f}, Vector3{8.0f}}, 4};
+    SpatialFeature3D feature{object, UnitBox, &index};
+
+    /* The feature is in the deepest level, with all parents allocated */
+    index.update();
+    CORRADE_VERIFY(!object.isDirty());
+    CORRADE_COMPARE(index.nodeCount(), 5);
+
+    /* Moving the object updates the feature on next query */
+    object.translate({-7.0f, -7.0f, -7.0f});
+    std::vector<SpatialFeature3D*> out;
+    index.queryBox({Vector3{0.0f}, Vector3{2.0f}}, out);
+    CORRADE_VERIFY(out.empty());
+    CORRADE_COMPARE(feature.absoluteBounds(), (Range3D{Vector3{-6.5f}, Vector3{-5.5f}}));
+    index.queryBox({Vector3{-7.0f}, Vector3{-5.0f}}, out);
+    CORRADE_COMPARE(out, std::vector<SpatialFeature3D*>{&feature});
+
+    /* Empty nodes of the old position got removed */
+    CORRADE_COMPARE(index.nodeCount(), 5);
+
+    /* Moving parent moves the feature as well */
+    Object3D child{&object};
+    SpatialFeature3D childFeature{child, UnitBox, &index};
+    object.translate({6.0f, 6.0f, 6.0f});
+    out.clear();
+    index.queryBox({Vector3{-0.1f}, Vector3{0.1f}}, out);
+    CORRADE_COMPARE(sorted(out), sorted<SpatialFeature3D>({&feature, &childFeature}));
+}
+
+void SpatialIndexTest::setBounds() {
+    Scene3D scene;
+    Object3D object{&scene};
+
+    SpatialIndex3D index{{Vector3{-8.0f}, Vector3{8.0f}}};
+    SpatialFeature3D feature{object, UnitBox, &index};
+    index.update();
+
+    /* The object is not dirty, but the feature still needs to be moved */
+    feature.setBounds({Vector3{3.0f}, Vector3{4.0f}});
+    CORRADE_COMPARE(feature.bounds(), (Range3D{Vector3{3.0f}, Vector3{4.0f}}));
+    std::vector<SpatialFeature3D*> out;
+    index.queryBox({Vector3{-1.0f}, Vector3{1.0f}}, out);
+    CORRADE_VERIFY(out.empty());
+    index.queryBox({Vector3{3.5f}, Vector3{5.0f}}, out);
+    CORRADE_COMPARE(out, std::vector<SpatialFeature3D*>{&feature});
+}
+
+void SpatialIndexTest::remove() {
+    Scene3D scene;
+    Object3D a{&scene}, b{&scene};
+
+    SpatialIndex3D index{{Vector3{-8.0f}, Vector3{8.0f}}};
+    SpatialFeature3D fa{a, UnitBox, &index};
+    {
+        SpatialFeature3D fb{b, UnitBox, &index};
+        index.update();
+        CORRADE_COMPARE(index.size(), 2);
+    }
+
+    /* Destroyed feature is not reported anymore */
+    CORRADE_COMPARE(index.size(), 1);
+    std::vector<SpatialFeature3D*> out;
+    index.queryBox({Vector3{-1.0f}, Vector3{1.0f}}, out);
+    CORRADE_COMPARE(out, std::vector<SpatialFeature3D*>{&fa});
+
+    /* Removing queued feature removes it from the update queue as well */
+    a.translate({1.0f, 0.0f, 0.0f});
+    index.remove(fa);
+    CORRADE_VERIFY(!fa.index());
+    CORRADE_VERIFY(index.isEmpty());
+    CORRADE_COMPARE(index.nodeCount(), 0);
+    out.clear();
+    index.queryBox({Vector3{-8.0f}, Vector3{8.0f}}, out);
+    CORRADE_VERIFY(out.empty());
+}
+
+void SpatialIndexTest::moveToAnotherIndex() {
+    Scene3D scene;
+    Object3D object{&scene};
+
+    SpatialIndex3D a{{Vector3{-8.0f}, Vector3{8.0f}}};
+    SpatialIndex3D b{{Vector3{-8.0f}, Vector3{8.0f}}};
+    SpatialFeature3D feature{object, UnitBox, &a};
+    a.update();
+    CORRADE_VERIFY(a.nodeCount() != 0);
+
+    b.add(feature);
+    CORRADE_VERIFY(feature.index() == &b);
+    CORRADE_VERIFY(a.isEmpty());
+    CORRADE_COMPARE(a.nodeCount(), 0);
+
+    std::vector<SpatialFeature3D*> out;
+    b.queryBox({Vector3{-1.0f}, Vector3{1.0f}}, out);
+    CORRADE_COMPARE(out, std::vector<SpatialFeature3D*>{&feature});
+}
+
+void SpatialIndexTest::destroyIndex() {
+    Scene3D scene;
+    Object3D object{&scene};
+    SpatialFeature3D feature{object, UnitBox};
+    CORRADE_VERIFY(!feature.index());
+
+    {
+        SpatialIndex3D index{{Vector3{-8.0f}, Vector3{8.0f}}};
+        index.add(feature);
+        index.update();
+    }
+
+    /* The feature can be added to another index afterwards */
+    CORRADE_VERIFY(!feature.index());
+    SpatialIndex3D index{{Vector3{-8.0f}, Vector3{8.0f}}};
+    index.add(feature);
+    std::vector<SpatialFeature3D*> out;
+    index.queryBox({Vector3{-1.0f}, Vector3{1.0f}}, out);
+    CORRADE_COMPARE(out, std::vector<SpatialFeature3D*>{&feature});
+}
+
+void SpatialIndexTest::maxDepthInvalid() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    SpatialIndex3D index{{Vector3{-8.0f}, Vector3{8.0f}}, 16};
+    CORRADE_COMPARE(out.str(), "SceneGraph::SpatialIndex: max depth can't be larger than 15, got 16\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::SpatialIndexTest)
@@ -0,0 +1,239 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/DualQuaternionTransformation.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/TransformationArray.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct TransformationArrayTest: TestSuite::Tester {
+    explicit TransformationArrayTest();
+
+    void add();
+    void addInvalidParent();
+    void update();
+    void updateDirty();
+    void setParent();
+    void setParentDescendant();
+    void remove();
+    void removeWithChildren();
+    void transformationMatrices();
+    void dualQuaternion();
+};
+
+typedef TransformationArray<MatrixTransformation3D> TransformationArray3D;
+
+TransformationArrayTest::TransformationArrayTest() {
+    addTests({&TransformationArrayTest::add,
+              &TransformationArrayTest::addInvalidParent,
+              &TransformationArrayTest::update,
+              &TransformationArrayTest::updateDirty,
+              &TransformationArrayTest::setParent,
+              &TransformationArrayTest::setParentDescendant,
+              &TransformationArrayTest::remove,
+              &TransformationArrayTest::removeWithChildren,
+              &TransformationArrayTest::transformationMatrices,
+              &TransformationArrayTest::dualQuaternion});
+}
+
+void TransformationArrayTest::add() {
+    TransformationArray3D a;
+    CORRADE_COMPARE(a.size(), 0);
+
+    const UnsignedInt first = a.add();
+    const UnsignedInt second = a.add(first, Matrix4::translation(Vector3::xAxis(2.0f)));
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_VERIFY(a.contains(first));
+    CORRADE_VERIFY(a.contains(second));
+    CORRADE_VERIFY(!a.contains(2));
+    CORRADE_COMPARE(a.parent(first), +TransformationArray3D::NoParent);
+    CORRADE_COMPARE(a.parent(second), first);
+    CORRADE_COMPARE(a.transformation(first), Matrix4());
+    CORRADE_COMPARE(a.transformation(second), Matrix4::translation(Vector3::xAxis(2.0f)));
+    CORRADE_VERIFY(a.isDirty(first));
+    CORRADE_VERIFY(a.isDirty(second));
+}
+
+void TransformationArrayTest::addInvalidParent() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    TransformationArray3D a;
+    a.add(3);
+    CORRADE_COMPARE(out.str(), "SceneGraph::TransformationArray::add(): invalid parent 3\n");
+}
+
+void TransformationArrayTest::update() {
+    TransformationArray3D a;
+    const UnsignedInt root = a.add(TransformationArray3D::NoParent, Matrix4::rotationZ(Deg(30.0f)));
+    const UnsignedInt first = a.add(root, Matrix4::scaling(Vector3(0.5f)));
+    const UnsignedInt second = a.add(first, Matrix4::translation(Vector3::xAxis(5.0f)));
+
+    a.update();
+    CORRADE_VERIFY(!a.isDirty(second));
+    CORRADE_COMPARE(a.absoluteTransformation(root), Matrix4::rotationZ(Deg(30.0f)));
+    CORRADE_COMPARE(a.absoluteTransformation(first),
+        Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f)));
+    CORRADE_COMPARE(a.absoluteTransformationMatrix(second),
+        Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f))*Matrix4::translation(Vector3::xAxis(5.0f)));
+}
+
+void TransformationArrayTest::updateDirty() {
+    TransformationArray3D a;
+    const UnsignedInt root = a.add();
+    const UnsignedInt first = a.add(root);
+    const UnsignedInt second = a.add(root, Matrix4::translation(Vector3::yAxis(1.0f)));
+    a.update();
+
+    /* Changing parent makes all children dirty */
+    a.transform(root, Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_VERIFY(a.isDirty(root));
+    CORRADE_VERIFY(a.isDirty(first));
+    CORRADE_VERIFY(a.isDirty(second));
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    a.absoluteTransformation(first);
+    CORRADE_COMPARE(out.str(), "SceneGraph::TransformationArray::absoluteTransformation(): the object is dirty, call update() first\n");
+
+    a.update();
+    CORRADE_COMPARE(a.absoluteTransformation(second), Matrix4::translation({1.0f, 1.0f, 0.0f}));
+
+    /* Changing child doesn't affect its siblings or parent */
+    a.transformLocal(first, Matrix4::scaling(Vector3(2.0f)));
+    CORRADE_VERIFY(!a.isDirty(root));
+    CORRADE_VERIFY(a.isDirty(first));
+    CORRADE_VERIFY(!a.isDirty(second));
+
+    a.update();
+    CORRADE_COMPARE(a.absoluteTransformation(first),
+        Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3(2.0f)));
+}
+
+void TransformationArrayTest::setParent() {
+    TransformationArray3D a;
+    const UnsignedInt child = a.add(TransformationArray3D::NoParent, Matrix4::translation(Vector3::xAxis(1.0f)));
+    const UnsignedInt grandchild = a.add(child, Matrix4::translation(Vector3::yAxis(1.0f)));
+    const UnsignedInt parent = a.add(TransformationArray3D::NoParent, Matrix4::translation(Vector3::zAxis(1.0f)));
+    a.update();
+
+    /* Parent added after the child, data get reordered */
+    a.setParent(child, parent);
+    CORRADE_COMPARE(a.parent(child), parent);
+    CORRADE_VERIFY(a.isDirty(grandchild));
+
+    a.update();
+    CORRADE_COMPARE(a.parent(child), parent);
+    CORRADE_COMPARE(a.parent(grandchild), child);
+    CORRADE_COMPARE(a.parent(parent), +TransformationArray3D::NoParent);
+    CORRADE_COMPARE(a.absoluteTransformation(child), Matrix4::translation({1.0f, 0.0f, 1.0f}));
+    CORRADE_COMPARE(a.absoluteTransformation(grandchild), Matrix4::translation({1.0f, 1.0f, 1.0f}));
+
+    /* Unparent */
+    a.setParent(child, TransformationArray3D::NoParent);
+    a.update();
+    CORRADE_COMPARE(a.absoluteTransformation(grandchild), Matrix4::translation({1.0f, 1.0f, 0.0f}));
+}
+
+void TransformationArrayTest::setParentDescendant() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    TransformationArray3D a;
+    const UnsignedInt root = a.add();
+    const UnsignedInt child = a.add(root);
+    a.setParent(root, root);
+    a.setParent(root, child);
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::TransformationArray::setParent(): the object cannot be a child of itself or its descendant\n"
+        "SceneGraph::TransformationArray::setParent(): the object cannot be a child of itself or its descendant\n");
+    CORRADE_COMPARE(a.parent(root), +TransformationArray3D::NoParent);
+}
+
+void TransformationArrayTest::remove() {
+    TransformationArray3D a;
+    const UnsignedInt root = a.add(TransformationArray3D::NoParent, Matrix4::translation(Vector3::xAxis(1.0f)));
+    const UnsignedInt first = a.add(root);
+    const UnsignedInt second = a.add(root, Matrix4::translation(Vector3::yAxis(1.0f)));
+
+    a.remove(first);
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_VERIFY(!a.contains(first));
+    CORRADE_COMPARE(a.parent(second), root);
+
+    a.update();
+    CORRADE_COMPARE(a.absoluteTransformation(second), Matrix4::translation({1.0f, 1.0f, 0.0f}));
+
+    /* ID of removed object is reused */
+    CORRADE_COMPARE(a.add(second), first);
+    CORRADE_COMPARE(a.parent(first), second);
+}
+
+void TransformationArrayTest::removeWithChildren() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    TransformationArray3D a;
+    const UnsignedInt root = a.add();
+    a.add(root);
+    a.remove(root);
+    CORRADE_COMPARE(out.str(), "SceneGraph::TransformationArray::remove(): object 0 has children\n");
+    CORRADE_COMPARE(a.size(), 2);
+}
+
+void TransformationArrayTest::transformationMatrices() {
+    TransformationArray3D a;
+    const UnsignedInt root = a.add(TransformationArray3D::NoParent, Matrix4::rotationZ(Deg(30.0f)));
+    const UnsignedInt first = a.add(root, Matrix4::scaling(Vector3(0.5f)));
+    const UnsignedInt second = a.add(root, Matrix4::translation(Vector3::xAxis(5.0f)));
+    a.update();
+
+    const Matrix4 initial = Matrix4::rotationX(Deg(90.0f)).inverted();
+    CORRADE_COMPARE(a.transformationMatrices({second, first, root}, initial), (std::vector<Matrix4>{
+        initial*Matrix4::rotationZ(Deg(30.0f))*Matrix4::translation(Vector3::xAxis(5.0f)),
+        initial*Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f)),
+        initial*Matrix4::rotationZ(Deg(30.0f))
+    }));
+}
+
+void TransformationArrayTest::dualQuaternion() {
+    TransformationArray<DualQuaternionTransformation> a;
+    const UnsignedInt root = a.add(TransformationArray<DualQuaternionTransformation>::NoParent, DualQuaternion::rotation(Deg(30.0f), Vector3::zAxis()));
+    const UnsignedInt child = a.add(root, DualQuaternion::translation(Vector3::xAxis(5.0f)));
+    a.update();
+
+    CORRADE_COMPARE(a.absoluteTransformation(child),
+        DualQuaternion::rotation(Deg(30.0f), Vector3::zAxis())*DualQuaternion::translation(Vector3::xAxis(5.0f)));
+    CORRADE_COMPARE(a.absoluteTransformationMatrix(child),
+        Matrix4::rotationZ(Deg(30.0f))*Matrix4::translation(Vector3::xAxis(5.0f)));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::TransformationArrayTest)
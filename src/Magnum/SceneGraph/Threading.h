@@ -0,0 +1,78 @@
+#ifndef Magnum_SceneGraph_Threading_h
+#define Magnum_SceneGraph_Threading_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::SceneGraph::threadCount(), @ref Magnum::SceneGraph::setThreadCount()
+ */
+
+#include <functional>
+
+#include "Magnum/Types.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Count of threads used for hierarchy update
+
+Thread count of @ref TaskScheduler::global(), which is `1` by default, i.e.
+no worker threads.
+@see @ref setThreadCount()
+*/
+MAGNUM_SCENEGRAPH_EXPORT UnsignedInt threadCount();
+
+/**
+@brief Set count of threads used for hierarchy update
+
+If set to more than `1`, @ref Object::transformations(),
+@ref Object::transformationMatrices() and @ref Object::setClean() split the
+work on large hierarchies across a pool of `count - 1` worker threads, the
+calling thread participates as well. The results are the same as with
+computation on a single thread. The hierarchy must not be modified from other
+threads during the computation. Setting the count to `1` destroys the worker
+threads. The work is executed on @ref TaskScheduler::global(), which is
+shared with other subsystems such as @ref Shapes::ShapeGroup for parallel
+collision queries, this function is equivalent to calling
+@ref TaskScheduler::setThreadCount() on it.
+
+On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" threads are not supported and
+the count is always `1`.
+*/
+MAGNUM_SCENEGRAPH_EXPORT void setThreadCount(UnsignedInt count);
+
+namespace Implementation {
+    /* Calls `function(begin, end)` for consecutive ranges of at most
+       `chunkSize` items covering `[0, count)`. The ranges are distributed
+       among the worker threads and the caller, returns after all of them
+       are processed. Can be called also from inside the function or from
+       other tasks running on the global task scheduler. */
+    MAGNUM_SCENEGRAPH_EXPORT void parallelFor(std::size_t count, std::size_t chunkSize, const std::function<void(std::size_t, std::size_t)>& function);
+}
+
+}}
+
+#endif
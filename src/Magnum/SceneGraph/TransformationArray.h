@@ -0,0 +1,240 @@
+#ifndef Magnum_SceneGraph_TransformationArray_h
+#define Magnum_SceneGraph_TransformationArray_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::TransformationArray
+ */
+
+#include <vector>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Data-oriented transformation hierarchy
+
+Alternative to @ref Object tree for large hierarchies. Instead of linking
+objects together with pointers, parent indices, local and absolute
+transformations are stored in contiguous arrays sorted so that every parent
+comes before all its children. Computing absolute transformations in
+@ref update() is then a single linear pass over the data, recomputing only
+the objects which were changed since last update (and their children).
+
+The @p Transformation template parameter is one of the classes used for
+@ref Object, for example @ref MatrixTransformation3D or
+@ref DualQuaternionTransformation. It specifies the underlying transformation
+type and the way how transformations are composed.
+
+Objects are referenced using IDs returned from @ref add(), the IDs stay the
+same during the whole lifetime of the object, even if the internal data are
+reordered. IDs of removed objects are reused for newly added ones.
+
+@code
+TransformationArray<MatrixTransformation3D> hierarchy;
+UnsignedInt parent = hierarchy.add(TransformationArray<MatrixTransformation3D>::NoParent,
+    Matrix4::translation(Vector3::xAxis(3.0f)));
+UnsignedInt child = hierarchy.add(parent, Matrix4::rotationZ(Deg(15.0f)));
+
+hierarchy.update();
+Matrix4 absolute = hierarchy.absoluteTransformationMatrix(child);
+@endcode
+
+@see @ref scenegraph
+*/
+template<class Transformation> class TransformationArray {
+    public:
+        /** @brief Underlying transformation type */
+        typedef typename Transformation::DataType DataType;
+
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<Transformation::Dimensions, typename Transformation::Type> MatrixType;
+
+        enum: UnsignedInt {
+            NoParent = 0xFFFFFFFFu  /**< Object without parent */
+        };
+
+        /** @brief Constructor */
+        explicit TransformationArray();
+
+        /** @brief Copying is not allowed */
+        TransformationArray(const TransformationArray<Transformation>&) = delete;
+
+        /** @brief Move constructor */
+        TransformationArray(TransformationArray<Transformation>&&) = default;
+
+        /** @brief Copying is not allowed */
+        TransformationArray<Transformation>& operator=(const TransformationArray<Transformation>&) = delete;
+
+        /** @brief Move assignment */
+        TransformationArray<Transformation>& operator=(TransformationArray<Transformation>&&) = default;
+
+        /** @brief Count of objects */
+        std::size_t size() const { return _parents.size(); }
+
+        /**
+         * @brief Whether given object ID is valid
+         *
+         * Returns `false` for IDs of removed objects.
+         */
+        bool contains(UnsignedInt id) const {
+            return id < _indices.size() && _indices[id] != NoParent;
+        }
+
+        /**
+         * @brief Add object
+         * @param parent            Parent object ID or @ref NoParent
+         * @param transformation    Object transformation
+         * @return ID of the new object
+         *
+         * The object is marked as dirty.
+         */
+        UnsignedInt add(UnsignedInt parent = NoParent, const DataType& transformation = DataType());
+
+        /**
+         * @brief Remove object
+         *
+         * The object must not have any children. Complexity is linear in
+         * object count.
+         */
+        void remove(UnsignedInt id);
+
+        /**
+         * @brief Parent object ID
+         *
+         * Returns @ref NoParent if the object has no parent.
+         */
+        UnsignedInt parent(UnsignedInt id) const;
+
+        /**
+         * @brief Set parent object
+         * @return Reference to self (for method chaining)
+         *
+         * The object must not be set as a child of itself or of its own
+         * descendant. The object is marked as dirty. If the parent was added
+         * after the object, the data are reordered in next @ref update().
+         */
+        TransformationArray<Transformation>& setParent(UnsignedInt id, UnsignedInt parent);
+
+        /** @brief Object transformation */
+        DataType transformation(UnsignedInt id) const;
+
+        /**
+         * @brief Set object transformation
+         * @return Reference to self (for method chaining)
+         *
+         * The object is marked as dirty.
+         */
+        TransformationArray<Transformation>& setTransformation(UnsignedInt id, const DataType& transformation);
+
+        /**
+         * @brief Reset object transformation
+         * @return Reference to self (for method chaining)
+         */
+        TransformationArray<Transformation>& resetTransformation(UnsignedInt id) {
+            return setTransformation(id, DataType());
+        }
+
+        /**
+         * @brief Transform object
+         * @return Reference to self (for method chaining)
+         *
+         * The transformation is applied after all others.
+         * @see @ref transformLocal()
+         */
+        TransformationArray<Transformation>& transform(UnsignedInt id, const DataType& transformation);
+
+        /**
+         * @brief Transform object as a local transformation
+         * @return Reference to self (for method chaining)
+         *
+         * Similar to the above, except that the transformation is applied
+         * before all others.
+         */
+        TransformationArray<Transformation>& transformLocal(UnsignedInt id, const DataType& transformation);
+
+        /**
+         * @brief Whether absolute transformation of the object is dirty
+         *
+         * Returns `true` if the object or any of its parents was changed since
+         * last @ref update().
+         */
+        bool isDirty(UnsignedInt id) const;
+
+        /**
+         * @brief Update absolute transformations
+         *
+         * Reorders the data if the hierarchy was changed, then computes
+         * absolute transformations of all dirty objects in a single pass.
+         */
+        void update();
+
+        /**
+         * @brief Absolute transformation
+         *
+         * Expects that the object is not dirty.
+         * @see @ref update(), @ref isDirty()
+         */
+        DataType absoluteTransformation(UnsignedInt id) const;
+
+        /**
+         * @brief Absolute transformation matrix
+         *
+         * @see @ref absoluteTransformation()
+         */
+        MatrixType absoluteTransformationMatrix(UnsignedInt id) const;
+
+        /**
+         * @brief Absolute transformation matrices of given objects
+         *
+         * All transformations are premultiplied with @p initialTransformation,
+         * if specified. Expects that none of the objects is dirty.
+         * @see @ref Object::transformationMatrices()
+         */
+        std::vector<MatrixType> transformationMatrices(const std::vector<UnsignedInt>& ids, const MatrixType& initialTransformation = MatrixType()) const;
+
+    private:
+        void sort();
+
+        /* Indexed by object ID, NoParent for removed objects */
+        std::vector<UnsignedInt> _indices;
+        std::vector<UnsignedInt> _freeIds;
+
+        /* Indexed by internal index, parent always before children */
+        std::vector<UnsignedInt> _ids;
+        std::vector<UnsignedInt> _parents;
+        std::vector<DataType> _transformations;
+        std::vector<DataType> _absoluteTransformations;
+        std::vector<UnsignedByte> _dirty;
+
+        bool _sorted;
+};
+
+}}
+
+#endif
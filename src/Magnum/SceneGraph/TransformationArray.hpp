@@ -0,0 +1,262 @@
+#ifndef Magnum_SceneGraph_TransformationArray_hpp
+#define Magnum_SceneGraph_TransformationArray_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref TransformationArray.h
+ */
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/AllocationTracker.h"
+#include "Magnum/SceneGraph/TransformationArray.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<class Transformation> TransformationArray<Transformation>::TransformationArray(): _sorted{true} {}
+
+template<class Transformation> UnsignedInt TransformationArray<Transformation>::add(const UnsignedInt parent, const DataType& transformation) {
+    CORRADE_ASSERT(parent == NoParent || contains(parent),
+        "SceneGraph::TransformationArray::add(): invalid parent" << parent, NoParent);
+
+    /* Reuse ID of some removed object, if possible */
+    UnsignedInt id;
+    if(_freeIds.empty()) {
+        id = UnsignedInt(_indices.size());
+        _indices.push_back(NoParent);
+    } else {
+        id = _freeIds.back();
+        _freeIds.pop_back();
+    }
+
+    /* The parent is already in the array, so appending keeps it sorted */
+    _indices[id] = UnsignedInt(_parents.size());
+    _ids.push_back(id);
+    _parents.push_back(parent == NoParent ? NoParent : _indices[parent]);
+    _transformations.push_back(transformation);
+    _absoluteTransformations.push_back(DataType());
+    _dirty.push_back(1);
+    return id;
+}
+
+template<class Transformation> void TransformationArray<Transformation>::remove(const UnsignedInt id) {
+    CORRADE_ASSERT(contains(id),
+        "SceneGraph::TransformationArray::remove(): invalid object" << id, );
+
+    const UnsignedInt index = _indices[id];
+    CORRADE_ASSERT(std::find(_parents.begin(), _parents.end(), index) == _parents.end(),
+        "SceneGraph::TransformationArray::remove(): object" << id << "has children", );
+
+    _ids.erase(_ids.begin() + index);
+    _parents.erase(_parents.begin() + index);
+    _transformations.erase(_transformations.begin() + index);
+    _absoluteTransformations.erase(_absoluteTransformations.begin() + index);
+    _dirty.erase(_dirty.begin() + index);
+
+    /* Update indices pointing after the removed object */
+    for(UnsignedInt& parent: _parents)
+        if(parent != NoParent && parent > index) --parent;
+    for(std::size_t i = index; i != _ids.size(); ++i)
+        --_indices[_ids[i]];
+
+    _indices[id] = NoParent;
+    _freeIds.push_back(id);
+}
+
+template<class Transformation> UnsignedInt TransformationArray<Transformation>::parent(const UnsignedInt id) const {
+    CORRADE_ASSERT(contains(id),
+        "SceneGraph::TransformationArray::parent(): invalid object" << id, NoParent);
+
+    const UnsignedInt parent = _parents[_indices[id]];
+    return parent == NoParent ? NoParent : _ids[parent];
+}
+
+template<class Transformation> TransformationArray<Transformation>& TransformationArray<Transformation>::setParent(const UnsignedInt id, const UnsignedInt parent) {
+    CORRADE_ASSERT(contains(id),
+        "SceneGraph::TransformationArray::setParent(): invalid object" << id, *this);
+    CORRADE_ASSERT(parent == NoParent || contains(parent),
+        "SceneGraph::TransformationArray::setParent(): invalid parent" << parent, *this);
+
+    const UnsignedInt index = _indices[id];
+    const UnsignedInt parentIndex = parent == NoParent ? NoParent : _indices[parent];
+
+    #ifndef CORRADE_NO_ASSERT
+    for(UnsignedInt p = parentIndex; p != NoParent; p = _parents[p])
+        CORRADE_ASSERT(p != index,
+            "SceneGraph::TransformationArray::setParent(): the object cannot be a child of itself or its descendant", *this);
+    #endif
+
+    /* Parent is after the object, reorder the data in next update() */
+    if(parentIndex != NoParent && parentIndex > index) _sorted = false;
+
+    _parents[index] = parentIndex;
+    _dirty[index] = 1;
+    return *this;
+}
+
+template<class Transformation> auto TransformationArray<Transformation>::transformation(const UnsignedInt id) const -> DataType {
+    CORRADE_ASSERT(contains(id),
+        "SceneGraph::TransformationArray::transformation(): invalid object" << id, {});
+
+    return _transformations[_indices[id]];
+}
+
+template<class Transformation> TransformationArray<Transformation>& TransformationArray<Transformation>::setTransformation(const UnsignedInt id, const DataType& transformation) {
+    CORRADE_ASSERT(contains(id),
+        "SceneGraph::TransformationArray::setTransformation(): invalid object" << id, *this);
+
+    const UnsignedInt index = _indices[id];
+    _transformations[index] = transformation;
+    _dirty[index] = 1;
+    return *this;
+}
+
+template<class Transformation> TransformationArray<Transformation>& TransformationArray<Transformation>::transform(const UnsignedInt id, const DataType& transformation) {
+    CORRADE_ASSERT(contains(id),
+        "SceneGraph::TransformationArray::transform(): invalid object" << id, *this);
+
+    return setTransformation(id, Implementation::Transformation<Transformation>::compose(transformation, _transformations[_indices[id]]));
+}
+
+template<class Transformation> TransformationArray<Transformation>& TransformationArray<Transformation>::transformLocal(const UnsignedInt id, const DataType& transformation) {
+    CORRADE_ASSERT(contains(id),
+        "SceneGraph::TransformationArray::transformLocal(): invalid object" << id, *this);
+
+    return setTransformation(id, Implementation::Transformation<Transformation>::compose(_transformations[_indices[id]], transformation));
+}
+
+template<class Transformation> bool TransformationArray<Transformation>::isDirty(const UnsignedInt id) const {
+    CORRADE_ASSERT(contains(id),
+        "SceneGraph::TransformationArray::isDirty(): invalid object" << id, true);
+
+    for(UnsignedInt p = _indices[id]; p != NoParent; p = _parents[p])
+        if(_dirty[p]) return true;
+    return false;
+}
+
+template<class Transformation> void TransformationArray<Transformation>::update() {
+    if(!_sorted) sort();
+
+    /* Parents are always before children, so their absolute transformation
+       is already computed and their dirtiness propagated */
+    for(std::size_t i = 0; i != _parents.size(); ++i) {
+        const UnsignedInt parent = _parents[i];
+        if(parent != NoParent && _dirty[parent]) _dirty[i] = 1;
+        if(!_dirty[i]) continue;
+
+        _absoluteTransformations[i] = parent == NoParent ? _transformations[i] :
+            Implementation::Transformation<Transformation>::compose(_absoluteTransformations[parent], _transformations[i]);
+    }
+
+    std::fill(_dirty.begin(), _dirty.end(), 0);
+}
+
+template<class Transformation> auto TransformationArray<Transformation>::absoluteTransformation(const UnsignedInt id) const -> DataType {
+    CORRADE_ASSERT(!isDirty(id),
+        "SceneGraph::TransformationArray::absoluteTransformation(): the object is dirty, call update() first", {});
+
+    return _absoluteTransformations[_indices[id]];
+}
+
+template<class Transformation> auto TransformationArray<Transformation>::absoluteTransformationMatrix(const UnsignedInt id) const -> MatrixType {
+    return Implementation::Transformation<Transformation>::toMatrix(absoluteTransformation(id));
+}
+
+template<class Transformation> auto TransformationArray<Transformation>::transformationMatrices(const std::vector<UnsignedInt>& ids, const MatrixType& initialTransformation) const -> std::vector<MatrixType> {
+    MAGNUM_ALLOCATION_SCOPE(SceneGraph);
+
+    std::vector<MatrixType> transformationMatrices;
+    transformationMatrices.reserve(ids.size());
+    for(const UnsignedInt id: ids) {
+        CORRADE_ASSERT(!isDirty(id),
+            "SceneGraph::TransformationArray::transformationMatrices(): object" << id << "is dirty, call update() first", {});
+        transformationMatrices.push_back(initialTransformation*Implementation::Transformation<Transformation>::toMatrix(_absoluteTransformations[_indices[id]]));
+    }
+
+    return transformationMatrices;
+}
+
+template<class Transformation> void TransformationArray<Transformation>::sort() {
+    const std::size_t count = _parents.size();
+
+    /* Calculate depth of each object, reusing depths of already processed
+       parents */
+    std::vector<UnsignedInt> depths(count, NoParent);
+    std::vector<UnsignedInt> path;
+    UnsignedInt maxDepth = 0;
+    for(std::size_t i = 0; i != count; ++i) {
+        UnsignedInt p = UnsignedInt(i);
+        while(p != NoParent && depths[p] == NoParent) {
+            path.push_back(p);
+            p = _parents[p];
+        }
+
+        UnsignedInt depth = p == NoParent ? 0 : depths[p] + 1;
+        for(auto it = path.rbegin(); it != path.rend(); ++it)
+            depths[*it] = depth++;
+        path.clear();
+
+        maxDepth = std::max(maxDepth, depths[i]);
+    }
+
+    /* Stable counting sort by depth, parent then always comes before all its
+       children */
+    std::vector<UnsignedInt> offsets(maxDepth + 2);
+    for(const UnsignedInt depth: depths) ++offsets[depth + 1];
+    for(std::size_t i = 1; i != offsets.size(); ++i) offsets[i] += offsets[i - 1];
+    std::vector<UnsignedInt> newIndices(count);
+    for(std::size_t i = 0; i != count; ++i)
+        newIndices[i] = offsets[depths[i]]++;
+
+    /* Reorder the data */
+    std::vector<UnsignedInt> ids(count);
+    std::vector<UnsignedInt> parents(count);
+    std::vector<DataType> transformations(count);
+    std::vector<DataType> absoluteTransformations(count);
+    std::vector<UnsignedByte> dirty(count);
+    for(std::size_t i = 0; i != count; ++i) {
+        const UnsignedInt index = newIndices[i];
+        ids[index] = _ids[i];
+        parents[index] = _parents[i] == NoParent ? NoParent : newIndices[_parents[i]];
+        transformations[index] = _transformations[i];
+        absoluteTransformations[index] = _absoluteTransformations[i];
+        dirty[index] = _dirty[i];
+        _indices[_ids[i]] = index;
+    }
+
+    std::swap(_ids, ids);
+    std::swap(_parents, parents);
+    std::swap(_transformations, transformations);
+    std::swap(_absoluteTransformations, absoluteTransformations);
+    std::swap(_dirty, dirty);
+    _sorted = true;
+}
+
+}}
+
+#endif
@@ -27,15 +27,22 @@
 #include "Magnum/SceneGraph/Animable.hpp"
 #include "Magnum/SceneGraph/Camera2D.hpp"
 #include "Magnum/SceneGraph/Camera3D.hpp"
+#include "Magnum/SceneGraph/CubeMapCamera3D.hpp"
 #include "Magnum/SceneGraph/Drawable.hpp"
 #include "Magnum/SceneGraph/DualComplexTransformation.h"
 #include "Magnum/SceneGraph/DualQuaternionTransformation.h"
 #include "Magnum/SceneGraph/FeatureGroup.hpp"
+#include "Magnum/SceneGraph/Interpolable.hpp"
+#include "Magnum/SceneGraph/KeyframeAnimator3D.hpp"
+#include "Magnum/SceneGraph/LodDrawable.hpp"
 #include "Magnum/SceneGraph/MatrixTransformation2D.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Object.hpp"
 #include "Magnum/SceneGraph/RigidMatrixTransformation2D.h"
 #include "Magnum/SceneGraph/RigidMatrixTransformation3D.h"
+#include "Magnum/SceneGraph/SpatialIndex.hpp"
+#include "Magnum/SceneGraph/StereoCamera3D.hpp"
+#include "Magnum/SceneGraph/TransformationArray.hpp"
 #include "Magnum/SceneGraph/TranslationTransformation.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -68,9 +75,23 @@ template class MAGNUM_SCENEGRAPH_EXPORT_HPP AbstractCamera<2, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP AbstractCamera<3, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP BasicCamera2D<Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP BasicCamera3D<Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP BasicStereoCamera3D<Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP BasicCubeMapCamera3D<Float>;
 
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Drawable<2, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Drawable<3, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP LodDrawable<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP LodDrawable<3, Float>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP Interpolable<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP Interpolable<3, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP InterpolableGroup<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP InterpolableGroup<3, Float>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP SpatialFeature<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP SpatialFeature<3, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP SpatialIndex<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP SpatialIndex<3, Float>;
 
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicDualComplexTransformation<Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicDualQuaternionTransformation<Float>>;
@@ -80,6 +101,18 @@ template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicRigidMatrixTransformatio
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicRigidMatrixTransformation3D<Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<TranslationTransformation<2, Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<TranslationTransformation<3, Float>>;
+
+/* Not marked with extern template anywhere, thus always exported here */
+template class MAGNUM_SCENEGRAPH_EXPORT TransformationArray<BasicDualComplexTransformation<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT TransformationArray<BasicDualQuaternionTransformation<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT TransformationArray<BasicMatrixTransformation2D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT TransformationArray<BasicMatrixTransformation3D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT TransformationArray<BasicRigidMatrixTransformation2D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT TransformationArray<BasicRigidMatrixTransformation3D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT TransformationArray<TranslationTransformation<2, Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT TransformationArray<TranslationTransformation<3, Float>>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT BasicKeyframeAnimator3D<Float>;
 #endif
 
 }}
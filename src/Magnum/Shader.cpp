@@ -40,6 +40,11 @@
 #include <sstream>
 #endif
 
+/* Not in the OpenGL headers yet */
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
 /* libgles-omap3-dev_4.03.00.02-r15.6 on BeagleBoard/Ångström linux 2011.3 doesn't have GLchar */
 #ifdef MAGNUM_TARGET_GLES
 typedef char GLchar;
@@ -697,13 +702,21 @@ Shader& Shader::addFile(const std::string& filename) {
 }
 
 bool Shader::compile(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
-    bool allSuccess = true;
+    #ifndef CORRADE_NO_ASSERT
+    for(Shader& shader: shaders)
+        CORRADE_ASSERT(shader._sources.size() > 1, "Shader::compile(): no files added", false);
+    #endif
+
+    submitCompile(shaders);
+    return checkCompile(shaders);
+}
 
+void Shader::submitCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
     /* Allocate large enough array for source pointers and sizes (to avoid
        reallocating it for each of them) */
     std::size_t maxSourceCount = 0;
     for(Shader& shader: shaders) {
-        CORRADE_ASSERT(shader._sources.size() > 1, "Shader::compile(): no files added", false);
+        CORRADE_ASSERT(shader._sources.size() > 1, "Shader::submitCompile(): no files added", );
         maxSourceCount = std::max(shader._sources.size(), maxSourceCount);
     }
     Containers::Array<const GLchar*> pointers(maxSourceCount);
@@ -721,6 +734,19 @@ bool Shader::compile(std::initializer_list<std::reference_wrapper<Shader>> shade
 
     /* Invoke (possibly parallel) compilation on all shaders */
     for(Shader& shader: shaders) glCompileShader(shader._id);
+}
+
+bool Shader::isCompileFinished() const {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::KHR::parallel_shader_compile>())
+        return true;
+
+    GLint finished;
+    glGetShaderiv(_id, GL_COMPLETION_STATUS_KHR, &finished);
+    return finished == GL_TRUE;
+}
+
+bool Shader::checkCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders) {
+    bool allSuccess = true;
 
     /* After compilation phase, check status of all shaders */
     Int i = 1;
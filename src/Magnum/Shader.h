@@ -452,6 +452,30 @@ class MAGNUM_EXPORT Shader: public AbstractObject {
          */
         static bool compile(std::initializer_list<std::reference_wrapper<Shader>> shaders);
 
+        /**
+         * @brief Submit multiple shaders for compilation
+         *
+         * Uploads sources of all shaders and starts their compilation without
+         * waiting for the result. Poll @ref isCompileFinished() and then
+         * call @ref checkCompile() to get the result. Calling this function
+         * followed by @ref checkCompile() is equivalent to calling
+         * @ref compile(std::initializer_list<std::reference_wrapper<Shader>>).
+         * @see @fn_gl{ShaderSource}, @fn_gl{CompileShader}
+         */
+        static void submitCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders);
+
+        /**
+         * @brief Check compilation status of multiple shaders
+         *
+         * Returns `false` if compilation of any shader failed, `true` if
+         * everything succeeded. Compiler messages (if any) are printed to
+         * error output. Blocks until the compilation is finished, expects
+         * that @ref submitCompile() was called on all shaders before.
+         * @see @fn_gl{GetShader} with @def_gl{COMPILE_STATUS} and
+         *      @def_gl{INFO_LOG_LENGTH}, @fn_gl{GetShaderInfoLog}
+         */
+        static bool checkCompile(std::initializer_list<std::reference_wrapper<Shader>> shaders);
+
         /**
          * @brief Constructor
          * @param version   Target version
@@ -559,6 +583,33 @@ class MAGNUM_EXPORT Shader: public AbstractObject {
          */
         bool compile() { return compile({*this}); }
 
+        /**
+         * @brief Submit shader for compilation
+         *
+         * See @ref submitCompile(std::initializer_list<std::reference_wrapper<Shader>>)
+         * for more information.
+         */
+        void submitCompile() { submitCompile({*this}); }
+
+        /**
+         * @brief Whether the compilation is finished
+         *
+         * If @extension{KHR,parallel_shader_compile} is available, returns
+         * `false` while the driver is still compiling the shader submitted
+         * with @ref submitCompile() in the background, `true` otherwise.
+         * Unlike @ref checkCompile(), this function never blocks.
+         * @see @fn_gl{GetShader} with @def_gl{COMPLETION_STATUS_KHR}
+         */
+        bool isCompileFinished() const;
+
+        /**
+         * @brief Check compilation status of the shader
+         *
+         * See @ref checkCompile(std::initializer_list<std::reference_wrapper<Shader>>)
+         * for more information.
+         */
+        bool checkCompile() { return checkCompile({*this}); }
+
     private:
         Shader& setLabelInternal(Containers::ArrayReference<const char> label);
 
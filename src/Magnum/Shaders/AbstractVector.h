@@ -29,10 +29,20 @@
  * @brief Class @ref Magnum::Shaders::AbstractVector, typedef @ref Magnum::Shaders::AbstractVector2D, @ref Magnum::Shaders::AbstractVector3D
  */
 
+#include <Corrade/Containers/EnumSet.h>
+
 #include "Magnum/Shaders/Generic.h"
 
 namespace Magnum { namespace Shaders {
 
+namespace Implementation {
+    enum class VectorFlag: UnsignedByte {
+        VertexColor = 1 << 0,
+        Multichannel = 1 << 1
+    };
+    typedef Containers::EnumSet<VectorFlag> VectorFlags;
+}
+
 /**
 @brief Base for vector shaders
 
@@ -56,6 +66,49 @@ template<UnsignedInt dimensions> class AbstractVector: public AbstractShaderProg
          */
         typedef typename Generic<dimensions>::TextureCoordinates TextureCoordinates;
 
+        /**
+         * @brief Vertex color
+         *
+         * @ref shaders-generic "Generic attribute", @ref Color4. Used only if
+         * @ref Flag::VertexColor is set.
+         */
+        typedef typename Generic<dimensions>::Color Color;
+
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        /**
+         * @brief Flag
+         *
+         * @see @ref Flags, @ref flags()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * The fill color is multiplied with per-vertex @ref Color
+             * attribute. Useful for drawing many differently colored texts
+             * in a single draw call, see @ref Text::BatchRenderer.
+             */
+            VertexColor = 1 << 0,
+
+            /**
+             * The vector texture is multichannel distance field, the shape is
+             * reconstructed from median of red, green and blue channel. See
+             * @ref TextureTools::multichannelDistanceField() for more
+             * information. Used only by @ref DistanceFieldVector, ignored by
+             * @ref Vector.
+             */
+            Multichannel = 1 << 1
+        };
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref flags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+        #else
+        typedef Implementation::VectorFlag Flag;
+        typedef Implementation::VectorFlags Flags;
+        #endif
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         enum: Int {
             /**
@@ -72,15 +125,23 @@ template<UnsignedInt dimensions> class AbstractVector: public AbstractShaderProg
          */
         AbstractVector<dimensions>& setVectorTexture(Texture2D& texture);
 
+        /** @brief Flags */
+        Flags flags() const { return _flags; }
+
     protected:
-        explicit AbstractVector() = default;
+        explicit AbstractVector(Flags flags = Flags()): _flags{flags} {}
         ~AbstractVector() = default;
 
         #ifndef MAGNUM_BUILD_DEPRECATED
         enum: Int { VectorTextureLayer = 15 };
         #endif
+
+    private:
+        Flags _flags;
 };
 
+CORRADE_ENUMSET_OPERATORS(Implementation::VectorFlags)
+
 /** @brief Base for two-dimensional text shaders */
 typedef AbstractVector<2> AbstractVector2D;
 
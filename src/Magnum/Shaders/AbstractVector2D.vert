@@ -44,7 +44,21 @@ in mediump vec2 textureCoordinates;
 
 out vec2 fragmentTextureCoordinates;
 
+#ifdef VERTEX_COLOR
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = COLOR_ATTRIBUTE_LOCATION) in lowp vec4 vertexColor;
+#else
+in lowp vec4 vertexColor;
+#endif
+out lowp vec4 interpolatedVertexColor;
+#endif
+
 void main() {
     gl_Position.xywz = vec4(transformationProjectionMatrix*vec3(position, 1.0), 0.0);
     fragmentTextureCoordinates = textureCoordinates;
+
+    #ifdef VERTEX_COLOR
+    /* Per-vertex color, if needed */
+    interpolatedVertexColor = vertexColor;
+    #endif
 }
@@ -44,7 +44,21 @@ in mediump vec2 textureCoordinates;
 
 out vec2 fragmentTextureCoordinates;
 
+#ifdef VERTEX_COLOR
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = COLOR_ATTRIBUTE_LOCATION) in lowp vec4 vertexColor;
+#else
+in lowp vec4 vertexColor;
+#endif
+out lowp vec4 interpolatedVertexColor;
+#endif
+
 void main() {
     gl_Position = transformationProjectionMatrix*position;
     fragmentTextureCoordinates = textureCoordinates;
+
+    #ifdef VERTEX_COLOR
+    /* Per-vertex color, if needed */
+    interpolatedVertexColor = vertexColor;
+    #endif
 }
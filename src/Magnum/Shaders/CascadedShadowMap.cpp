@@ -0,0 +1,71 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CascadedShadowMap.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Shaders/ShadowCascades.h"
+
+namespace Magnum { namespace Shaders {
+
+CascadedShadowMap::CascadedShadowMap(const Vector2i& size, const UnsignedInt cascadeCount, const TextureFormat format): _size{size} {
+    CORRADE_ASSERT(cascadeCount && cascadeCount <= ShadowCascades::MaxCascadeCount,
+        "Shaders::CascadedShadowMap: expected cascade count in range [1, 4], got" << cascadeCount, );
+
+    /* Linear filtering with depth comparison gives hardware 2x2 PCF for
+       each of the samples taken by the shader */
+    _texture.setMinificationFilter(Sampler::Filter::Linear)
+        .setMagnificationFilter(Sampler::Filter::Linear)
+        .setWrapping(Sampler::Wrapping::ClampToEdge)
+        .setCompareMode(Sampler::CompareMode::CompareRefToTexture)
+        .setCompareFunction(Sampler::CompareFunction::LessOrEqual)
+        .setStorage(1, format, {size, Int(cascadeCount)});
+
+    _framebuffers.reserve(cascadeCount);
+    for(UnsignedInt i = 0; i != cascadeCount; ++i) {
+        _framebuffers.emplace_back(Range2Di{{}, size});
+        _framebuffers.back().attachTextureLayer(Framebuffer::BufferAttachment::Depth, _texture, 0, i)
+            .mapForDraw(Framebuffer::DrawAttachment::None);
+    }
+}
+
+Framebuffer& CascadedShadowMap::framebuffer(const UnsignedInt cascade) {
+    CORRADE_ASSERT(cascade < _framebuffers.size(),
+        "Shaders::CascadedShadowMap::framebuffer(): index" << cascade << "out of range for" << _framebuffers.size() << "cascades", _framebuffers.front());
+    return _framebuffers[cascade];
+}
+
+CascadedShadowMap& CascadedShadowMap::bindCascade(const UnsignedInt cascade) {
+    CORRADE_ASSERT(cascade < _framebuffers.size(),
+        "Shaders::CascadedShadowMap::bindCascade(): index" << cascade << "out of range for" << _framebuffers.size() << "cascades", *this);
+    _framebuffers[cascade].clear(FramebufferClear::Depth)
+        .bind(FramebufferTarget::Draw);
+    return *this;
+}
+
+}}
+#endif
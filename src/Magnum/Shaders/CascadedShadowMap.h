@@ -0,0 +1,134 @@
+#ifndef Magnum_Shaders_CascadedShadowMap_h
+#define Magnum_Shaders_CascadedShadowMap_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::CascadedShadowMap
+ */
+
+#include <vector>
+
+#include "Magnum/Framebuffer.h"
+#include "Magnum/TextureArray.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Cascaded shadow map
+
+Depth texture array with one layer for each cascade of @ref ShadowCascades
+and a framebuffer for rendering into each layer. The texture is set up for
+depth comparison, so it can be directly passed to
+@ref Phong::setShadowMap().
+
+Shadow casters are rendered with @ref Depth shader. With
+@ref SceneGraph::Camera3D "SceneGraph::Camera3D" the shadow pass can reuse the
+sorted drawing of @ref SceneGraph::AbstractCamera::draw() "draw()" ---
+position a light camera object with @ref ShadowCascades::lightViewMatrix(),
+set its projection to @ref ShadowCascades::lightProjectionMatrix() and draw a
+group of drawables that use the @ref Depth shader:
+@code
+Shaders::ShadowCascades cascades{4};
+Shaders::CascadedShadowMap shadowMap{{2048, 2048}, 4};
+
+Object3D lightObject{&scene};
+SceneGraph::Camera3D lightCamera{lightObject};
+lightCamera.setSortingEnabled(true);
+
+// Each frame
+cascades.fit(camera.cameraMatrix(), camera.projectionMatrix(), sunDirection, 2048);
+for(UnsignedInt i = 0; i != cascades.cascadeCount(); ++i) {
+    shadowMap.bindCascade(i);
+    lightObject.setTransformation(cascades.lightViewMatrix(i).invertedRigid());
+    lightCamera.setProjectionMatrix(cascades.lightProjectionMatrix(i));
+    lightCamera.draw(shadowCasters);
+}
+
+defaultFramebuffer.bind(FramebufferTarget::Draw);
+phong.setShadowMap(shadowMap.texture())
+    .setShadowMatrices(cascades.shadowMatrices())
+    .setShadowSplitDepths(cascades.splitDepths());
+camera.draw(drawables);
+@endcode
+
+Polygon offset or front face culling during the shadow pass helps to reduce
+shadow acne in addition to @ref Phong::setShadowBias().
+@requires_gl30 Extension @extension{EXT,texture_array}
+@requires_gles30 Texture arrays are not available in OpenGL ES 2.0.
+*/
+class MAGNUM_SHADERS_EXPORT CascadedShadowMap {
+    public:
+        /**
+         * @brief Constructor
+         * @param size          Size of each cascade layer
+         * @param cascadeCount  Cascade count. Expected to be in range
+         *      @f$ [1, 4] @f$.
+         * @param format        Depth texture format
+         */
+        explicit CascadedShadowMap(const Vector2i& size, UnsignedInt cascadeCount = 4, TextureFormat format = TextureFormat::DepthComponent24);
+
+        /** @brief Size of each cascade layer */
+        Vector2i size() const { return _size; }
+
+        /** @brief Cascade count */
+        UnsignedInt cascadeCount() const { return _framebuffers.size(); }
+
+        /** @brief Depth texture array */
+        Texture2DArray& texture() { return _texture; }
+
+        /**
+         * @brief Framebuffer for rendering into given cascade
+         *
+         * Has only the depth attachment.
+         * @see @ref bindCascade()
+         */
+        Framebuffer& framebuffer(UnsignedInt cascade);
+
+        /**
+         * @brief Bind given cascade for rendering
+         * @return Reference to self (for method chaining)
+         *
+         * Clears the depth of given cascade layer and binds its framebuffer
+         * for drawing.
+         */
+        CascadedShadowMap& bindCascade(UnsignedInt cascade);
+
+    private:
+        Vector2i _size;
+        Texture2DArray _texture;
+        std::vector<Framebuffer> _framebuffers;
+};
+
+}}
+#else
+#error this header is not available on OpenGL ES 2.0 build
+#endif
+
+#endif
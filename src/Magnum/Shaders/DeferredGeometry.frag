@@ -0,0 +1,97 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef RUNTIME_CONST
+#define const
+#endif
+
+#ifdef DIFFUSE_TEXTURE
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 0) uniform sampler2D diffuseTexture;
+#else
+uniform sampler2D diffuseTexture;
+#endif
+#elif !defined(GL_ES)
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 3) uniform vec3 diffuseColor = vec3(1.0, 1.0, 1.0);
+#else
+uniform vec3 diffuseColor = vec3(1.0, 1.0, 1.0);
+#endif
+#else
+uniform lowp vec3 diffuseColor;
+#endif
+
+#ifndef GL_ES
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 4) uniform float specularIntensity = 1.0;
+layout(location = 5) uniform float shininess = 80.0;
+#else
+uniform float specularIntensity = 1.0;
+uniform float shininess = 80.0;
+#endif
+#else
+uniform lowp float specularIntensity;
+uniform mediump float shininess;
+#endif
+
+in mediump vec3 transformedNormal;
+
+#ifdef DIFFUSE_TEXTURE
+in mediump vec2 interpolatedTextureCoordinates;
+#endif
+
+/* Locations match DeferredGeometry::AlbedoOutput and NormalOutput */
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = 0) out lowp vec4 albedo;
+layout(location = 1) out mediump vec4 normalShininess;
+#else
+out lowp vec4 albedo;
+out mediump vec4 normalShininess;
+#endif
+
+/* Octahedron normal encoding, maps the unit sphere to [0, 1]^2 with uniform
+   precision. Decoded in DeferredLighting.frag. */
+mediump vec2 signNotZero(mediump vec2 v) {
+    return vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+}
+
+mediump vec2 encodeNormal(mediump vec3 n) {
+    n /= abs(n.x) + abs(n.y) + abs(n.z);
+    mediump vec2 e = n.z >= 0.0 ? n.xy : (1.0 - abs(n.yx))*signNotZero(n.xy);
+    return e*0.5 + 0.5;
+}
+
+void main() {
+    #ifdef DIFFUSE_TEXTURE
+    lowp const vec3 diffuseColor = texture(diffuseTexture, interpolatedTextureCoordinates).rgb;
+    #endif
+
+    albedo = vec4(diffuseColor, specularIntensity);
+
+    /* Shininess in range [1, 1024] is stored logarithmically, alpha marks
+       covered pixels for Impostor */
+    normalShininess = vec4(encodeNormal(normalize(transformedNormal)),
+        clamp(log2(shininess)/10.0, 0.0, 1.0), 1.0);
+}
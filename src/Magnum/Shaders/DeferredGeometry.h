@@ -0,0 +1,232 @@
+#ifndef Magnum_Shaders_DeferredGeometry_h
+#define Magnum_Shaders_DeferredGeometry_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::DeferredGeometry
+ */
+
+#include "Magnum/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Geometry pass shader for deferred shading
+
+Writes surface properties into a @ref GBuffer instead of computing any
+lighting. You need to provide @ref Position and @ref Normal attributes in your
+triangle mesh, the same mesh setup as with @ref Phong can be reused. Call at
+least @ref setTransformationMatrix(), @ref setNormalMatrix() and
+@ref setProjectionMatrix().
+
+Compared to @ref Phong, the material is described only by diffuse color
+(or texture), grayscale specular intensity and shininess. Shininess is stored
+with logarithmic precision and clamped to range @f$ [1, 1024] @f$.
+
+See @ref DeferredLighting for a complete example.
+@requires_gl30 Extension @extension{ARB,framebuffer_object}
+@requires_gles30 Multiple render targets are not available in OpenGL ES 2.0.
+@see @ref shaders
+*/
+class MAGNUM_SHADERS_EXPORT DeferredGeometry: public AbstractShaderProgram {
+    public:
+        /**
+         * @brief Vertex position
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector3.
+         */
+        typedef Generic3D::Position Position;
+
+        /**
+         * @brief Normal direction
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector3.
+         */
+        typedef Generic3D::Normal Normal;
+
+        /**
+         * @brief 2D texture coordinates
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector2. Used only
+         * if @ref Flag::DiffuseTexture is set.
+         */
+        typedef Generic3D::TextureCoordinates TextureCoordinates;
+
+        /**
+         * @brief Per-instance transformation matrix
+         *
+         * @ref shaders-generic "Generic attribute", @ref Matrix4. Used only if
+         * @ref Flag::InstancedTransformation is set.
+         */
+        typedef Generic3D::TransformationMatrix TransformationMatrix;
+
+        /**
+         * @brief Per-instance normal matrix
+         *
+         * @ref shaders-generic "Generic attribute", @ref Matrix3x3. Used only
+         * if @ref Flag::InstancedTransformation is set.
+         */
+        typedef Generic3D::NormalMatrix NormalMatrix;
+
+        enum: UnsignedInt {
+            /** Diffuse color and specular intensity output */
+            AlbedoOutput = 0,
+
+            /** Encoded normal and shininess output */
+            NormalOutput = 1
+        };
+
+        /**
+         * @brief Flag
+         *
+         * @see @ref Flags, @ref flags()
+         */
+        enum class Flag: UnsignedByte {
+            DiffuseTexture = 1 << 0,    /**< The shader uses diffuse texture instead of color */
+
+            /**
+             * The transformation and normal matrix is multiplied with
+             * per-instance @ref TransformationMatrix and @ref NormalMatrix
+             * attributes.
+             */
+            InstancedTransformation = 1 << 1
+        };
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref flags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+
+        /**
+         * @brief Constructor
+         * @param flags     Flags
+         */
+        explicit DeferredGeometry(Flags flags = Flags());
+
+        /** @brief Flags */
+        Flags flags() const { return _flags; }
+
+        /**
+         * @brief Set transformation matrix
+         * @return Reference to self (for method chaining)
+         */
+        DeferredGeometry& setTransformationMatrix(const Matrix4& matrix) {
+            setUniform(transformationMatrixUniform, matrix);
+            return *this;
+        }
+
+        /**
+         * @brief Set normal matrix
+         * @return Reference to self (for method chaining)
+         *
+         * The resulting normals are expected to be in view space.
+         */
+        DeferredGeometry& setNormalMatrix(const Matrix3x3& matrix) {
+            setUniform(normalMatrixUniform, matrix);
+            return *this;
+        }
+
+        /**
+         * @brief Set projection matrix
+         * @return Reference to self (for method chaining)
+         */
+        DeferredGeometry& setProjectionMatrix(const Matrix4& matrix) {
+            setUniform(projectionMatrixUniform, matrix);
+            return *this;
+        }
+
+        /**
+         * @brief Set diffuse color
+         * @return Reference to self (for method chaining)
+         *
+         * If not set, default value is `{1.0f, 1.0f, 1.0f}`. Has no effect if
+         * @ref Flag::DiffuseTexture is set.
+         * @see @ref setDiffuseTexture()
+         */
+        DeferredGeometry& setDiffuseColor(const Color3& color) {
+            setUniform(diffuseColorUniform, color);
+            return *this;
+        }
+
+        /**
+         * @brief Set diffuse texture
+         * @return Reference to self (for method chaining)
+         *
+         * Has effect only if @ref Flag::DiffuseTexture is set.
+         * @see @ref setDiffuseColor()
+         */
+        DeferredGeometry& setDiffuseTexture(Texture2D& texture);
+
+        /**
+         * @brief Set specular intensity
+         * @return Reference to self (for method chaining)
+         *
+         * Multiplies color of the lights in the specular highlight. If not
+         * set, default value is `1.0f`.
+         */
+        DeferredGeometry& setSpecularIntensity(Float intensity) {
+            setUniform(specularIntensityUniform, intensity);
+            return *this;
+        }
+
+        /**
+         * @brief Set shininess
+         * @return Reference to self (for method chaining)
+         *
+         * The larger value, the harder surface (smaller specular highlight).
+         * If not set, default value is `80.0f`.
+         */
+        DeferredGeometry& setShininess(Float shininess) {
+            setUniform(shininessUniform, shininess);
+            return *this;
+        }
+
+    private:
+        Int transformationMatrixUniform,
+            projectionMatrixUniform,
+            normalMatrixUniform,
+            diffuseColorUniform,
+            specularIntensityUniform,
+            shininessUniform;
+
+        Flags _flags;
+};
+
+CORRADE_ENUMSET_OPERATORS(DeferredGeometry::Flags)
+
+}}
+#else
+#error this header is not available on OpenGL ES 2.0 build
+#endif
+
+#endif
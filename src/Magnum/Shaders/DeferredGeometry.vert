@@ -0,0 +1,77 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 0) uniform mat4 transformationMatrix;
+layout(location = 1) uniform mat4 projectionMatrix;
+layout(location = 2) uniform mat3 normalMatrix;
+#else
+uniform highp mat4 transformationMatrix;
+uniform highp mat4 projectionMatrix;
+uniform mediump mat3 normalMatrix;
+#endif
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = POSITION_ATTRIBUTE_LOCATION) in highp vec4 position;
+layout(location = NORMAL_ATTRIBUTE_LOCATION) in mediump vec3 normal;
+#else
+in highp vec4 position;
+in mediump vec3 normal;
+#endif
+
+#ifdef INSTANCED_TRANSFORMATION
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TRANSFORMATION_MATRIX_ATTRIBUTE_LOCATION) in highp mat4 instancedTransformationMatrix;
+layout(location = NORMAL_MATRIX_ATTRIBUTE_LOCATION) in mediump mat3 instancedNormalMatrix;
+#else
+in highp mat4 instancedTransformationMatrix;
+in mediump mat3 instancedNormalMatrix;
+#endif
+#endif
+
+#ifdef DIFFUSE_TEXTURE
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TEXTURECOORDINATES_ATTRIBUTE_LOCATION) in mediump vec2 textureCoordinates;
+#else
+in mediump vec2 textureCoordinates;
+#endif
+out mediump vec2 interpolatedTextureCoordinates;
+#endif
+
+out mediump vec3 transformedNormal;
+
+void main() {
+    #ifdef INSTANCED_TRANSFORMATION
+    gl_Position = projectionMatrix*transformationMatrix*instancedTransformationMatrix*position;
+    transformedNormal = normalMatrix*instancedNormalMatrix*normal;
+    #else
+    gl_Position = projectionMatrix*transformationMatrix*position;
+    transformedNormal = normalMatrix*normal;
+    #endif
+
+    #ifdef DIFFUSE_TEXTURE
+    interpolatedTextureCoordinates = textureCoordinates;
+    #endif
+}
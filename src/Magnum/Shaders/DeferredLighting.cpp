@@ -0,0 +1,181 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "DeferredLighting.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <cmath>
+#include <Corrade/Utility/Resource.h>
+
+#ifndef MAGNUM_TARGET_GLES
+#include "Magnum/BufferTexture.h"
+#endif
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Shader.h"
+#include "Magnum/Texture.h"
+#include "Magnum/Shaders/GBuffer.h"
+
+#include "Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    enum: Int {
+        AlbedoTextureLayer = 0,
+        NormalTextureLayer = 1,
+        DepthTextureLayer = 2,
+        #ifndef MAGNUM_TARGET_GLES
+        LightDataTextureLayer = 3,
+        LightClusterTextureLayer = 4,
+        LightIndexTextureLayer = 5
+        #endif
+    };
+}
+
+DeferredLighting::DeferredLighting(const Flags flags): projectionMatrixUniform(-1), inverseProjectionMatrixUniform(-1), ambientColorUniform(-1), lightDirectionUniform(-1), lightColorUniform(-1),
+    #ifndef MAGNUM_TARGET_GLES
+    clusterCountUniform(-1), clusterScaleUniform(-1), clusterDepthUniform(-1),
+    #endif
+    _flags(flags)
+{
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(flags & Flag::LightVolumes) || !(flags & Flag::ClusteredLights),
+        "Shaders::DeferredLighting: light volumes can't be combined with clustered lights", );
+    #endif
+
+    Utility::Resource rs("MagnumShaders");
+
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL300);
+    if(flags & Flag::ClusteredLights)
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL310);
+    const Version version = Context::current()->supportedVersion({Version::GL320, Version::GL310, Version::GL300});
+    #else
+    const Version version = Version::GLES300;
+    #endif
+
+    Shader vert = Implementation::createCompatibilityShader(rs, version, Shader::Type::Vertex);
+    Shader frag = Implementation::createCompatibilityShader(rs, version, Shader::Type::Fragment);
+
+    if(flags & Flag::LightVolumes) {
+        vert.addSource("#define LIGHT_VOLUMES\n")
+            .addSource(rs.get("generic.glsl"));
+    } else vert.addSource(rs.get("FullScreenTriangle.glsl"));
+    vert.addSource(rs.get("DeferredLighting.vert"));
+    frag.addSource(flags & Flag::LightVolumes ? "#define LIGHT_VOLUMES\n" : "")
+        #ifndef MAGNUM_TARGET_GLES
+        .addSource(flags & Flag::ClusteredLights ? "#define CLUSTERED_LIGHTS\n" : "")
+        #endif
+        .addSource(rs.get("DeferredLighting.frag"));
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+
+    attachShaders({vert, frag});
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & Flag::LightVolumes && !Context::current()->isExtensionSupported<Extensions::GL::ARB::explicit_attrib_location>(version)) {
+        bindAttributeLocation(Position::Location, "position");
+        bindAttributeLocation(LightPositionRange::Location, "lightPositionRange");
+        bindAttributeLocation(LightColor::Location, "lightColor");
+    }
+    #endif
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+    inverseProjectionMatrixUniform = uniformLocation("inverseProjectionMatrix");
+    if(flags & Flag::LightVolumes)
+        projectionMatrixUniform = uniformLocation("projectionMatrix");
+    else {
+        ambientColorUniform = uniformLocation("ambientColor");
+        lightDirectionUniform = uniformLocation("lightDirection");
+        lightColorUniform = uniformLocation("lightColor");
+    }
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & Flag::ClusteredLights) {
+        clusterCountUniform = uniformLocation("clusterCount");
+        clusterScaleUniform = uniformLocation("clusterScale");
+        clusterDepthUniform = uniformLocation("clusterDepth");
+    }
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
+    #endif
+    {
+        setUniform(uniformLocation("albedoTexture"), AlbedoTextureLayer);
+        setUniform(uniformLocation("normalTexture"), NormalTextureLayer);
+        setUniform(uniformLocation("depthTexture"), DepthTextureLayer);
+        #ifndef MAGNUM_TARGET_GLES
+        if(flags & Flag::ClusteredLights) {
+            setUniform(uniformLocation("lightData"), LightDataTextureLayer);
+            setUniform(uniformLocation("lightClusters"), LightClusterTextureLayer);
+            setUniform(uniformLocation("lightIndices"), LightIndexTextureLayer);
+        }
+        #endif
+    }
+
+    /* Set defaults in OpenGL ES (for desktop they are set in shader code itself) */
+    #ifdef MAGNUM_TARGET_GLES
+    if(!(flags & Flag::LightVolumes)) {
+        setAmbientColor(Color3{0.0f});
+        setLightDirection(Vector3::zAxis());
+        setLightColor(Color3{1.0f});
+    }
+    #endif
+}
+
+DeferredLighting& DeferredLighting::setGBuffer(GBuffer& gbuffer) {
+    AbstractTexture::bind(AlbedoTextureLayer, {&gbuffer.albedoTexture(), &gbuffer.normalTexture(), &gbuffer.depthTexture()});
+    return *this;
+}
+
+DeferredLighting& DeferredLighting::setProjectionMatrix(const Matrix4& matrix) {
+    setUniform(projectionMatrixUniform, matrix);
+    setUniform(inverseProjectionMatrixUniform, matrix.inverted());
+    return *this;
+}
+
+#ifndef MAGNUM_TARGET_GLES
+DeferredLighting& DeferredLighting::setLightClusters(BufferTexture& lights, BufferTexture& clusters, BufferTexture& lightIndices) {
+    CORRADE_ASSERT(_flags & Flag::ClusteredLights,
+        "Shaders::DeferredLighting::setLightClusters(): the shader was not created with clustered lights enabled", *this);
+    AbstractTexture::bind(LightDataTextureLayer, {&lights, &clusters, &lightIndices});
+    return *this;
+}
+
+DeferredLighting& DeferredLighting::setLightClusterParameters(const Vector3ui& clusterCount, const Vector2& viewportSize, const Float near, const Float far) {
+    CORRADE_ASSERT(_flags & Flag::ClusteredLights,
+        "Shaders::DeferredLighting::setLightClusterParameters(): the shader was not created with clustered lights enabled", *this);
+    setUniform(clusterCountUniform, clusterCount);
+    setUniform(clusterScaleUniform, Vector2{clusterCount.xy()}/viewportSize);
+    setUniform(clusterDepthUniform, Vector2{near, clusterCount.z()/std::log(far/near)});
+    return *this;
+}
+#endif
+
+}}
+#endif
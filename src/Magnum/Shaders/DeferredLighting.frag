@@ -0,0 +1,143 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 0) uniform lowp sampler2D albedoTexture;
+layout(binding = 1) uniform mediump sampler2D normalTexture;
+layout(binding = 2) uniform highp sampler2D depthTexture;
+#else
+uniform lowp sampler2D albedoTexture;
+uniform mediump sampler2D normalTexture;
+uniform highp sampler2D depthTexture;
+#endif
+
+uniform highp mat4 inverseProjectionMatrix;
+
+#ifdef LIGHT_VOLUMES
+flat in highp vec4 interpolatedLightPositionRange;
+flat in lowp vec3 interpolatedLightColor;
+#elif !defined(GL_ES)
+uniform vec3 ambientColor = vec3(0.0, 0.0, 0.0);
+uniform vec3 lightDirection = vec3(0.0, 0.0, 1.0);
+uniform vec3 lightColor = vec3(1.0, 1.0, 1.0);
+#else
+uniform lowp vec3 ambientColor;
+uniform highp vec3 lightDirection;
+uniform lowp vec3 lightColor;
+#endif
+
+#ifdef CLUSTERED_LIGHTS
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 3) uniform highp samplerBuffer lightData;
+layout(binding = 4) uniform highp usamplerBuffer lightClusters;
+layout(binding = 5) uniform highp usamplerBuffer lightIndices;
+#else
+uniform highp samplerBuffer lightData;
+uniform highp usamplerBuffer lightClusters;
+uniform highp usamplerBuffer lightIndices;
+#endif
+uniform highp uvec3 clusterCount;
+uniform highp vec2 clusterScale;
+uniform highp vec2 clusterDepth;
+#endif
+
+out lowp vec4 color;
+
+/* Inverse of encodeNormal() in DeferredGeometry.frag */
+mediump vec2 signNotZero(mediump vec2 v) {
+    return vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+}
+
+mediump vec3 decodeNormal(mediump vec2 e) {
+    e = e*2.0 - 1.0;
+    mediump vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if(n.z < 0.0) n.xy = (1.0 - abs(n.yx))*signNotZero(n.xy);
+    return normalize(n);
+}
+
+/* Diffuse and specular contribution of a light in given direction */
+lowp vec3 shade(lowp vec4 albedo, mediump vec3 normal, mediump float shininess, highp vec3 cameraDirection, highp vec3 toLightDirection, lowp vec3 lightColor) {
+    lowp float intensity = max(0.0, dot(normal, toLightDirection));
+    lowp vec3 result = albedo.rgb*lightColor*intensity;
+    if(intensity > 0.001) {
+        highp vec3 reflection = reflect(-toLightDirection, normal);
+        mediump float specularity = pow(max(0.0, dot(cameraDirection, reflection)), shininess);
+        result += albedo.a*lightColor*specularity;
+    }
+    return result;
+}
+
+/* Contribution of a point light, falling off quadratically to zero at the
+   range */
+lowp vec3 shadePointLight(lowp vec4 albedo, mediump vec3 normal, mediump float shininess, highp vec3 position, highp vec3 cameraDirection, highp vec4 lightPositionRange, lowp vec3 lightColor) {
+    highp vec3 toLight = lightPositionRange.xyz - position;
+    highp float lightDistance = length(toLight);
+    lowp float attenuation = clamp(1.0 - lightDistance/lightPositionRange.w, 0.0, 1.0);
+    attenuation *= attenuation;
+    if(attenuation == 0.0) return vec3(0.0);
+
+    return shade(albedo, normal, shininess, cameraDirection, toLight/lightDistance, lightColor)*attenuation;
+}
+
+void main() {
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    highp float depth = texelFetch(depthTexture, pixel, 0).r;
+
+    /* No geometry was rendered there */
+    if(depth == 1.0) discard;
+
+    lowp vec4 albedo = texelFetch(albedoTexture, pixel, 0);
+    mediump vec4 normalShininess = texelFetch(normalTexture, pixel, 0);
+    mediump vec3 normal = decodeNormal(normalShininess.xy);
+    mediump float shininess = exp2(normalShininess.z*10.0);
+
+    /* View-space position reconstructed from the depth */
+    highp vec4 position4 = inverseProjectionMatrix*vec4(vec3(gl_FragCoord.xy/vec2(textureSize(depthTexture, 0)), depth)*2.0 - 1.0, 1.0);
+    highp vec3 position = position4.xyz/position4.w;
+    highp vec3 cameraDirection = normalize(-position);
+
+    #ifdef LIGHT_VOLUMES
+    /* Alpha is zero so additive blending leaves it unchanged */
+    color = vec4(shadePointLight(albedo, normal, shininess, position, cameraDirection, interpolatedLightPositionRange, interpolatedLightColor), 0.0);
+    #else
+    color.rgb = albedo.rgb*ambientColor + shade(albedo, normal, shininess, cameraDirection, normalize(lightDirection), lightColor);
+
+    #ifdef CLUSTERED_LIGHTS
+    /* Find cluster of the pixel, the depth slices are exponential */
+    uvec3 cluster = uvec3(uvec2(gl_FragCoord.xy*clusterScale),
+        uint(max(0.0, log(-position.z/clusterDepth.x)*clusterDepth.y)));
+    cluster = min(cluster, clusterCount - uvec3(1u));
+    uvec2 range = texelFetch(lightClusters, int((cluster.z*clusterCount.y + cluster.y)*clusterCount.x + cluster.x)).xy;
+
+    /* Add contribution of all lights in the cluster */
+    for(uint i = 0u; i != range.y; ++i) {
+        int light = int(texelFetch(lightIndices, int(range.x + i)).x);
+        color.rgb += shadePointLight(albedo, normal, shininess, position, cameraDirection, texelFetch(lightData, 2*light), texelFetch(lightData, 2*light + 1).rgb);
+    }
+    #endif
+
+    color.a = 1.0;
+    #endif
+}
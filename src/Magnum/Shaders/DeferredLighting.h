@@ -0,0 +1,303 @@
+#ifndef Magnum_Shaders_DeferredLighting_h
+#define Magnum_Shaders_DeferredLighting_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::DeferredLighting
+ */
+
+#include "Magnum/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Lighting pass shader for deferred shading
+
+Computes lighting of surfaces stored in a @ref GBuffer filled by
+@ref DeferredGeometry. View-space position of each pixel is reconstructed
+from the depth, so the G-buffer is expected to have the same size as the
+viewport and the default depth range. The shading model is the same as in
+@ref Phong, with point light contribution falling off quadratically to zero at
+the light range. The lighting cost depends only on the count of lit pixels,
+not on the count of draws in the geometry pass.
+
+The shader has three modes:
+
+-   By default the shader is drawn over the whole viewport using a mesh
+    from @ref MeshTools::fullScreenTriangle(). It writes ambient color
+    multiplied with diffuse color and adds contribution of one directional
+    light set with @ref setLightDirection() and @ref setLightColor(). Pixels
+    with no geometry are discarded.
+-   With @ref Flag::ClusteredLights the full-screen pass adds also
+    contribution of arbitrary count of point lights assigned to view frustum
+    tiles by @ref LightClusterGrid, same as @ref Phong::Flag::ClusteredLights.
+-   With @ref Flag::LightVolumes each instance of the mesh is a point light
+    described by @ref LightPositionRange and @ref LightColor attributes. The
+    mesh is expected to be a coarse sphere of unit radius, which is scaled to
+    the light range, so only pixels near each light are shaded. The output is
+    meant to be added to result of the full-screen pass.
+
+## Example usage
+
+The per-instance light data have the same layout as
+@ref LightClusterGrid::lightData(), so light volumes can be fed directly from
+it or from any array of pairs of @ref Vector4 with view-space position and
+range in the first and color in the second:
+@code
+Shaders::GBuffer gbuffer{defaultFramebuffer.viewport().size()};
+Shaders::DeferredGeometry geometryShader;
+Shaders::DeferredLighting lightingShader;
+Shaders::DeferredLighting volumeShader{Shaders::DeferredLighting::Flag::LightVolumes};
+
+Mesh fullScreenTriangle;
+std::unique_ptr<Buffer> fullScreenTriangleBuffer;
+std::tie(fullScreenTriangleBuffer, fullScreenTriangle) = MeshTools::fullScreenTriangle();
+
+Buffer lights;
+Mesh volumes;
+std::unique_ptr<Buffer> volumeIndices, volumeVertices;
+std::tie(volumes, volumeIndices, volumeVertices) = MeshTools::compile(Primitives::Icosphere::solid(1), BufferUsage::StaticDraw);
+volumes.addVertexBufferInstanced(lights, 1, 0,
+    Shaders::DeferredLighting::LightPositionRange{},
+    Shaders::DeferredLighting::LightColor{}, 4);
+
+// Each frame
+lights.setData(viewSpaceLightData, BufferUsage::StreamDraw);
+volumes.setInstanceCount(viewSpaceLightData.size()/2);
+
+gbuffer.bindForWriting();
+geometryShader.setProjectionMatrix(projectionMatrix);
+for(const Drawable& drawable: drawables) {
+    geometryShader.setTransformationMatrix(drawable.transformationMatrix())
+        .setNormalMatrix(drawable.transformationMatrix().rotation())
+        .setDiffuseColor(drawable.color());
+    drawable.mesh().draw(geometryShader);
+}
+
+defaultFramebuffer.clear(FramebufferClear::Color)
+    .bind(FramebufferTarget::Draw);
+Renderer::disable(Renderer::Feature::DepthTest);
+lightingShader.setGBuffer(gbuffer)
+    .setProjectionMatrix(projectionMatrix)
+    .setAmbientColor(Color3{0.1f})
+    .setLightDirection(cameraMatrix.transformVector(sunDirection))
+    .setLightColor(Color3{0.8f});
+fullScreenTriangle.draw(lightingShader);
+
+// Light volumes are added on top, back faces only so the volumes containing
+// the camera are not clipped away
+Renderer::enable(Renderer::Feature::Blending);
+Renderer::setBlendFunction(Renderer::BlendFunction::One, Renderer::BlendFunction::One);
+Renderer::enable(Renderer::Feature::FaceCulling);
+Renderer::setFaceCullingMode(Renderer::PolygonFacing::Front);
+volumeShader.setGBuffer(gbuffer)
+    .setProjectionMatrix(projectionMatrix);
+volumes.draw(volumeShader);
+@endcode
+
+For hundreds of lights covering large parts of the screen, the clustered
+full-screen pass is usually cheaper than overlapping light volumes, as each
+pixel reads the G-buffer only once. See
+@ref Shaders-Phong-clustered-lights "Phong documentation" for setting up the
+cluster data.
+@requires_gl30 Extension @extension{ARB,framebuffer_object}
+@requires_gles30 Multiple render targets are not available in OpenGL ES 2.0.
+@see @ref shaders
+*/
+class MAGNUM_SHADERS_EXPORT DeferredLighting: public AbstractShaderProgram {
+    public:
+        /**
+         * @brief Vertex position of light volume mesh
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector3. Used only
+         * if @ref Flag::LightVolumes is set.
+         */
+        typedef Generic3D::Position Position;
+
+        /**
+         * @brief Per-instance light position and range
+         *
+         * @ref Vector4, view-space position in XYZ and range in W. Used
+         * only if @ref Flag::LightVolumes is set.
+         */
+        typedef Attribute<4, Vector4> LightPositionRange;
+
+        /**
+         * @brief Per-instance light color
+         *
+         * @ref Vector3. Used only if @ref Flag::LightVolumes is set.
+         */
+        typedef Attribute<5, Vector3> LightColor;
+
+        /**
+         * @brief Flag
+         *
+         * @see @ref Flags, @ref flags()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * Render point light volumes instead of a full-screen pass. See
+             * @ref DeferredLighting "class documentation" for more
+             * information.
+             */
+            LightVolumes = 1 << 0,
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * Add contribution of point lights assigned to view frustum
+             * clusters by @ref LightClusterGrid in the full-screen pass.
+             * Can't be combined with @ref Flag::LightVolumes.
+             * @requires_gl31 Extension @extension{ARB,texture_buffer_object}
+             * @requires_gl Buffer textures are not available in OpenGL ES.
+             */
+            ClusteredLights = 1 << 1
+            #endif
+        };
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref flags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+
+        /**
+         * @brief Constructor
+         * @param flags     Flags
+         */
+        explicit DeferredLighting(Flags flags = Flags());
+
+        /** @brief Flags */
+        Flags flags() const { return _flags; }
+
+        /**
+         * @brief Set G-buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Binds all textures of the G-buffer.
+         */
+        DeferredLighting& setGBuffer(GBuffer& gbuffer);
+
+        /**
+         * @brief Set projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Needs to be the same projection used in the geometry pass. Used
+         * for reconstructing view-space positions from depth and for
+         * projecting the light volumes.
+         */
+        DeferredLighting& setProjectionMatrix(const Matrix4& matrix);
+
+        /**
+         * @brief Set ambient color
+         * @return Reference to self (for method chaining)
+         *
+         * Multiplied with diffuse color of each pixel. If not set, default
+         * value is `{0.0f, 0.0f, 0.0f}`. Has no effect if
+         * @ref Flag::LightVolumes is set.
+         */
+        DeferredLighting& setAmbientColor(const Color3& color) {
+            setUniform(ambientColorUniform, color);
+            return *this;
+        }
+
+        /**
+         * @brief Set directional light direction
+         * @return Reference to self (for method chaining)
+         *
+         * Direction towards the light in view space, doesn't need to be
+         * normalized. If not set, default value is `{0.0f, 0.0f, 1.0f}`.
+         * Has no effect if @ref Flag::LightVolumes is set.
+         */
+        DeferredLighting& setLightDirection(const Vector3& direction) {
+            setUniform(lightDirectionUniform, direction);
+            return *this;
+        }
+
+        /**
+         * @brief Set directional light color
+         * @return Reference to self (for method chaining)
+         *
+         * If not set, default value is `{1.0f, 1.0f, 1.0f}`. Has no effect if
+         * @ref Flag::LightVolumes is set.
+         */
+        DeferredLighting& setLightColor(const Color3& color) {
+            setUniform(lightColorUniform, color);
+            return *this;
+        }
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set light cluster data
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @ref Flag::ClusteredLights is set. See
+         * @ref Phong::setLightClusters() for more information.
+         * @requires_gl31 Extension @extension{ARB,texture_buffer_object}
+         * @requires_gl Buffer textures are not available in OpenGL ES.
+         */
+        DeferredLighting& setLightClusters(BufferTexture& lights, BufferTexture& clusters, BufferTexture& lightIndices);
+
+        /**
+         * @brief Set light cluster grid parameters
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @ref Flag::ClusteredLights is set. See
+         * @ref Phong::setLightClusterParameters() for more information.
+         * @requires_gl31 Extension @extension{ARB,texture_buffer_object}
+         * @requires_gl Buffer textures are not available in OpenGL ES.
+         */
+        DeferredLighting& setLightClusterParameters(const Vector3ui& clusterCount, const Vector2& viewportSize, Float near, Float far);
+        #endif
+
+    private:
+        Int projectionMatrixUniform,
+            inverseProjectionMatrixUniform,
+            ambientColorUniform,
+            lightDirectionUniform,
+            lightColorUniform;
+        #ifndef MAGNUM_TARGET_GLES
+        Int clusterCountUniform,
+            clusterScaleUniform,
+            clusterDepthUniform;
+        #endif
+
+        Flags _flags;
+};
+
+CORRADE_ENUMSET_OPERATORS(DeferredLighting::Flags)
+
+}}
+#else
+#error this header is not available on OpenGL ES 2.0 build
+#endif
+
+#endif
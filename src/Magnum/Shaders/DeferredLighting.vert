@@ -0,0 +1,55 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifdef LIGHT_VOLUMES
+uniform highp mat4 projectionMatrix;
+
+#define LIGHT_POSITION_RANGE_ATTRIBUTE_LOCATION 4
+#define LIGHT_COLOR_ATTRIBUTE_LOCATION 5
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = POSITION_ATTRIBUTE_LOCATION) in highp vec4 position;
+layout(location = LIGHT_POSITION_RANGE_ATTRIBUTE_LOCATION) in highp vec4 lightPositionRange;
+layout(location = LIGHT_COLOR_ATTRIBUTE_LOCATION) in lowp vec3 lightColor;
+#else
+in highp vec4 position;
+in highp vec4 lightPositionRange;
+in lowp vec3 lightColor;
+#endif
+
+flat out highp vec4 interpolatedLightPositionRange;
+flat out lowp vec3 interpolatedLightColor;
+#endif
+
+void main() {
+    #ifdef LIGHT_VOLUMES
+    /* Scale the unit volume to the light range */
+    gl_Position = projectionMatrix*vec4(lightPositionRange.xyz + position.xyz*lightPositionRange.w, 1.0);
+    interpolatedLightPositionRange = lightPositionRange;
+    interpolatedLightColor = lightColor;
+    #else
+    fullScreenTriangle();
+    #endif
+}
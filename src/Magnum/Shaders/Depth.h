@@ -0,0 +1,134 @@
+#ifndef Magnum_Shaders_Depth_h
+#define Magnum_Shaders_Depth_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::Depth
+ */
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Depth-only shader
+
+Writes only depth, with no color output. Meant for filling shadow maps, see
+@ref CascadedShadowMap, or for a depth pre-pass. You need to provide
+@ref Position attribute in your triangle mesh and call
+@ref setTransformationProjectionMatrix(). As the fragment shader does nothing,
+the same mesh setup as with @ref Phong or @ref Flat3D can be reused.
+
+## Example usage
+
+@code
+Shaders::Depth shader;
+shader.setTransformationProjectionMatrix(lightMatrix*transformationMatrix);
+
+mesh.draw(shader);
+@endcode
+
+@see @ref shaders
+*/
+class MAGNUM_SHADERS_EXPORT Depth: public AbstractShaderProgram {
+    public:
+        /**
+         * @brief Vertex position
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector3.
+         */
+        typedef Generic3D::Position Position;
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Per-instance transformation matrix
+         *
+         * @ref shaders-generic "Generic attribute", @ref Matrix4. Used only if
+         * @ref Flag::InstancedTransformation is set.
+         * @requires_gles30 Instanced attributes are not available in OpenGL
+         *      ES 2.0.
+         */
+        typedef Generic3D::TransformationMatrix TransformationMatrix;
+        #endif
+
+        /**
+         * @brief Flag
+         *
+         * @see @ref Flags, @ref flags()
+         */
+        enum class Flag: UnsignedByte {
+            #ifndef MAGNUM_TARGET_GLES2
+            /**
+             * The transformation matrix is multiplied with per-instance
+             * @ref TransformationMatrix attribute.
+             * @requires_gles30 Instanced attributes are not available in
+             *      OpenGL ES 2.0.
+             */
+            InstancedTransformation = 1 << 0
+            #endif
+        };
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref flags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+
+        /**
+         * @brief Constructor
+         * @param flags     Flags
+         */
+        explicit Depth(Flags flags = Flags());
+
+        /** @brief Flags */
+        Flags flags() const { return _flags; }
+
+        /**
+         * @brief Set transformation and projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Default is identity matrix.
+         */
+        Depth& setTransformationProjectionMatrix(const Matrix4& matrix) {
+            setUniform(transformationProjectionMatrixUniform, matrix);
+            return *this;
+        }
+
+    private:
+        Int transformationProjectionMatrixUniform;
+
+        Flags _flags;
+};
+
+CORRADE_ENUMSET_OPERATORS(Depth::Flags)
+
+}}
+
+#endif
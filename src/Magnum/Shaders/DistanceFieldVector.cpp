@@ -41,7 +41,7 @@ namespace {
     template<> constexpr const char* vertexShaderName<3>() { return "AbstractVector3D.vert"; }
 }
 
-template<UnsignedInt dimensions> DistanceFieldVector<dimensions>::DistanceFieldVector(): transformationProjectionMatrixUniform(0), colorUniform(1), outlineColorUniform(2), outlineRangeUniform(3), smoothnessUniform(4) {
+template<UnsignedInt dimensions> DistanceFieldVector<dimensions>::DistanceFieldVector(const typename AbstractVector<dimensions>::Flags flags): AbstractVector<dimensions>{flags}, transformationProjectionMatrixUniform(0), colorUniform(1), outlineColorUniform(2), outlineRangeUniform(3), smoothnessUniform(4) {
     Utility::Resource rs("MagnumShaders");
 
     #ifndef MAGNUM_TARGET_GLES
@@ -53,9 +53,12 @@ template<UnsignedInt dimensions> DistanceFieldVector<dimensions>::DistanceFieldV
     Shader frag = Implementation::createCompatibilityShader(rs, version, Shader::Type::Vertex);
     Shader vert = Implementation::createCompatibilityShader(rs, version, Shader::Type::Fragment);
 
-    frag.addSource(rs.get("generic.glsl"))
+    frag.addSource(flags & AbstractVector<dimensions>::Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
+        .addSource(rs.get("generic.glsl"))
         .addSource(rs.get(vertexShaderName<dimensions>()));
-    vert.addSource(rs.get("DistanceFieldVector.frag"));
+    vert.addSource(flags & AbstractVector<dimensions>::Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
+        .addSource(flags & AbstractVector<dimensions>::Flag::Multichannel ? "#define MULTICHANNEL\n" : "")
+        .addSource(rs.get("DistanceFieldVector.frag"));
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({frag, vert}));
 
@@ -69,6 +72,8 @@ template<UnsignedInt dimensions> DistanceFieldVector<dimensions>::DistanceFieldV
     {
         AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::Position::Location, "position");
         AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::TextureCoordinates::Location, "textureCoordinates");
+        if(flags & AbstractVector<dimensions>::Flag::VertexColor)
+            AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::Color::Location, "vertexColor");
     }
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(AbstractShaderProgram::link());
@@ -56,15 +56,28 @@ uniform lowp sampler2D vectorTexture;
 
 in mediump vec2 fragmentTextureCoordinates;
 
+#ifdef VERTEX_COLOR
+in lowp vec4 interpolatedVertexColor;
+#endif
+
 #ifdef NEW_GLSL
 out lowp vec4 fragmentColor;
 #endif
 
 void main() {
+    #ifdef MULTICHANNEL
+    /* Median of the three channels */
+    lowp vec3 channels = texture(vectorTexture, fragmentTextureCoordinates).rgb;
+    lowp float intensity = max(min(channels.r, channels.g), min(max(channels.r, channels.g), channels.b));
+    #else
     lowp float intensity = texture(vectorTexture, fragmentTextureCoordinates).r;
+    #endif
 
     /* Fill color */
     fragmentColor = smoothstep(outlineRange.x-smoothness, outlineRange.x+smoothness, intensity)*color;
+    #ifdef VERTEX_COLOR
+    fragmentColor *= interpolatedVertexColor;
+    #endif
 
     /* Outline */
     if(outlineRange.x > outlineRange.y) {
@@ -49,6 +49,10 @@ value passed to @ref setSmoothness(). You need to provide @ref Position and
 @ref setTransformationProjectionMatrix(), @ref setColor() and
 @ref setVectorTexture().
 
+With @ref Flag::Multichannel the texture is expected to contain multichannel
+distance field created with @ref TextureTools::multichannelDistanceField(),
+which keeps sharp corners even with much smaller textures.
+
 @image html shaders-distancefieldvector.png
 @image latex shaders-distancefieldvector.png
 
@@ -93,7 +97,11 @@ mesh.draw(shader);
 */
 template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT DistanceFieldVector: public AbstractVector<dimensions> {
     public:
-        DistanceFieldVector();
+        /**
+         * @brief Constructor
+         * @param flags     Flags
+         */
+        explicit DistanceFieldVector(typename AbstractVector<dimensions>::Flags flags = typename AbstractVector<dimensions>::Flags());
 
         /**
          * @brief Set transformation and projection matrix
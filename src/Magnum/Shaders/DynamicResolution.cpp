@@ -0,0 +1,240 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "DynamicResolution.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/QueryPool.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/RenderTargetPool.h"
+#include "Magnum/Shader.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TimeQuery.h"
+
+#include "Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    enum: Int { InputTextureLayer = 0 };
+
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr Version ShaderVersion = Version::GL300;
+    #else
+    constexpr Version ShaderVersion = Version::GLES300;
+    #endif
+
+    /* How far toward the scale computed from the last measurement the
+       current scale moves each time */
+    constexpr Float Damping = 0.25f;
+
+    /* Results older than this are waited for */
+    constexpr UnsignedInt MaxQueryLatency = 4;
+
+    Vector2i scaledSize(const Vector2i& size, const Float scale) {
+        return Math::max(Vector2i{Vector2{size}*scale}, Vector2i{1});
+    }
+}
+
+class DynamicResolution::Upscale: public AbstractShaderProgram {
+    public:
+        explicit Upscale() {
+            Utility::Resource rs("MagnumShaders");
+
+            Shader vert = Implementation::createCompatibilityShader(rs, ShaderVersion, Shader::Type::Vertex);
+            Shader frag = Implementation::createCompatibilityShader(rs, ShaderVersion, Shader::Type::Fragment);
+            vert.addSource(rs.get("FullScreenTriangle.glsl"))
+                .addSource(rs.get("DynamicResolution.vert"));
+            frag.addSource(rs.get("DynamicResolution.frag"));
+
+            CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+
+            attachShaders({vert, frag});
+            CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+            textureScaleUniform = uniformLocation("textureScale");
+            sharpnessUniform = uniformLocation("sharpness");
+
+            #ifndef MAGNUM_TARGET_GLES
+            if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(ShaderVersion))
+            #endif
+            {
+                setUniform(uniformLocation("inputTexture"), InputTextureLayer);
+            }
+        }
+
+        Upscale& setTextureScale(const Vector2& scale) {
+            setUniform(textureScaleUniform, scale);
+            return *this;
+        }
+
+        Upscale& setSharpness(Float sharpness) {
+            setUniform(sharpnessUniform, sharpness);
+            return *this;
+        }
+
+    private:
+        Int textureScaleUniform,
+            sharpnessUniform;
+};
+
+DynamicResolution::DynamicResolution(const Vector2i& outputSize, const Float targetFrameTime): _outputSize{outputSize}, _targetFrameTime{targetFrameTime}, _minScale{0.5f}, _maxScale{1.0f}, _scale{1.0f}, _gpuFrameTime{0.0f}, _sharpness{0.0f}, _colorFormat{TextureFormat::RGBA8}, _upscale{new Upscale}, _color{}, _depth{}, _framebuffer{}, _query{} {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::framebuffer_object);
+    #else
+    MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GLES300);
+    #endif
+
+    /* Without timer queries the scale is driven only manually */
+    #ifndef MAGNUM_TARGET_GLES
+    if(Context::current()->isExtensionSupported<Extensions::GL::ARB::timer_query>())
+    #else
+    if(Context::current()->isExtensionSupported<Extensions::GL::EXT::disjoint_timer_query>())
+    #endif
+    {
+        _queries.reset(new QueryPool<TimeQuery>{TimeQuery::Target::TimeElapsed, MaxQueryLatency});
+    }
+
+    /* The vertex positions are generated from gl_VertexID */
+    _fullScreenTriangle.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(3);
+}
+
+DynamicResolution::~DynamicResolution() = default;
+
+DynamicResolution& DynamicResolution::setOutputSize(const Vector2i& size) {
+    CORRADE_ASSERT(!_framebuffer, "Shaders::DynamicResolution::setOutputSize(): can't be called between begin() and end()", *this);
+    _outputSize = size;
+    return *this;
+}
+
+DynamicResolution& DynamicResolution::setTargetFrameTime(const Float milliseconds) {
+    _targetFrameTime = milliseconds;
+    return *this;
+}
+
+DynamicResolution& DynamicResolution::setScaleRange(const Float min, const Float max) {
+    CORRADE_ASSERT(!_framebuffer, "Shaders::DynamicResolution::setScaleRange(): can't be called between begin() and end()", *this);
+    CORRADE_ASSERT(min > 0.0f && min <= max,
+        "Shaders::DynamicResolution::setScaleRange(): expected positive range, got" << min << max, *this);
+    _minScale = min;
+    _maxScale = max;
+    _scale = Math::clamp(_scale, min, max);
+    return *this;
+}
+
+DynamicResolution& DynamicResolution::setScale(const Float scale) {
+    _scale = Math::clamp(scale, _minScale, _maxScale);
+    return *this;
+}
+
+DynamicResolution& DynamicResolution::setSharpness(const Float sharpness) {
+    _sharpness = sharpness;
+    return *this;
+}
+
+Vector2i DynamicResolution::renderSize() const {
+    return scaledSize(_outputSize, _scale);
+}
+
+Framebuffer& DynamicResolution::begin(RenderTargetPool& pool) {
+    CORRADE_ASSERT(!_framebuffer, "Shaders::DynamicResolution::begin(): end() was not called", *_framebuffer);
+
+    /* Always acquire the targets for the maximal scale so the pool doesn't
+       allocate new ones when the scale changes */
+    const Vector2i textureSize = scaledSize(_outputSize, _maxScale);
+    _color = &pool.texture(textureSize, _colorFormat);
+    _depth = &pool.renderbuffer(textureSize, RenderbufferFormat::DepthComponent24);
+    _framebuffer = &pool.framebuffer(textureSize);
+    _framebuffer->attachTexture(Framebuffer::ColorAttachment(0), *_color, 0)
+        .attachRenderbuffer(Framebuffer::BufferAttachment::Depth, *_depth)
+        .setViewport({{}, renderSize()})
+        .bind(FramebufferTarget::Draw);
+
+    /* The result arrives a few frames later, remember the scale it was
+       measured with */
+    if(_queries) {
+        const Float scale = _scale;
+        _query = &_queries->acquire([this, scale](UnsignedLong, QueryPool<TimeQuery>::ResultType nanoseconds) {
+            addFrameTime(scale, nanoseconds/1.0e6f);
+        });
+        _query->begin();
+    }
+
+    return *_framebuffer;
+}
+
+void DynamicResolution::end(AbstractFramebuffer& output, RenderTargetPool& pool) {
+    CORRADE_ASSERT(_framebuffer, "Shaders::DynamicResolution::end(): begin() was not called", );
+
+    if(_query) {
+        _query->end();
+        _query = nullptr;
+    }
+
+    const Vector2i textureSize = scaledSize(_outputSize, _maxScale);
+    const Vector2 textureScale = Vector2{_framebuffer->viewport().size()}/Vector2{textureSize};
+
+    output.bind(FramebufferTarget::Draw);
+    _color->bind(InputTextureLayer);
+    _fullScreenTriangle.draw(_upscale->setTextureScale(textureScale)
+        .setSharpness(_sharpness));
+
+    /* Released framebuffers are expected to have viewport covering the
+       whole size */
+    _framebuffer->setViewport({{}, textureSize});
+    pool.release(*_framebuffer);
+    pool.release(*_depth);
+    pool.release(*_color);
+    _framebuffer = nullptr;
+    _depth = nullptr;
+    _color = nullptr;
+
+    /* Updates the scale with results that are available */
+    if(_queries) _queries->nextFrame();
+}
+
+void DynamicResolution::addFrameTime(const Float scale, const Float milliseconds) {
+    _gpuFrameTime = milliseconds;
+    if(milliseconds <= 0.0f) return;
+
+    /* The time is roughly proportional to pixel count, i.e. to square of the
+       scale */
+    const Float desired = scale*std::sqrt(_targetFrameTime/milliseconds);
+    _scale = Math::clamp(Math::lerp(_scale, desired, Damping), _minScale, _maxScale);
+}
+
+}}
+#endif
@@ -0,0 +1,59 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 0) uniform mediump sampler2D inputTexture;
+#else
+uniform mediump sampler2D inputTexture;
+#endif
+
+uniform mediump vec2 textureScale;
+uniform lowp float sharpness;
+
+in mediump vec2 textureCoordinates;
+
+out lowp vec4 fragmentColor;
+
+void main() {
+    /* Don't let the bilinear filter bleed in the unused part of the texture
+       outside of the rendered scene */
+    mediump vec2 texelSize = 1.0/vec2(textureSize(inputTexture, 0));
+    mediump vec2 coordinates = clamp(textureCoordinates, 0.5*texelSize, textureScale - 0.5*texelSize);
+
+    mediump vec4 color = texture(inputTexture, coordinates);
+
+    /* Unsharp mask with the four direct neighbors, clamped so dark edges
+       don't go negative */
+    if(sharpness > 0.0) {
+        mediump vec4 neighbors =
+            texture(inputTexture, clamp(coordinates + vec2(texelSize.x, 0.0), 0.5*texelSize, textureScale - 0.5*texelSize)) +
+            texture(inputTexture, clamp(coordinates - vec2(texelSize.x, 0.0), 0.5*texelSize, textureScale - 0.5*texelSize)) +
+            texture(inputTexture, clamp(coordinates + vec2(0.0, texelSize.y), 0.5*texelSize, textureScale - 0.5*texelSize)) +
+            texture(inputTexture, clamp(coordinates - vec2(0.0, texelSize.y), 0.5*texelSize, textureScale - 0.5*texelSize));
+        color = max(color + (color - 0.25*neighbors)*sharpness*2.0, vec4(0.0));
+    }
+
+    fragmentColor = color;
+}
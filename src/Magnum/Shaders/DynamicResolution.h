@@ -0,0 +1,281 @@
+#ifndef Magnum_Shaders_DynamicResolution_h
+#define Magnum_Shaders_DynamicResolution_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::DynamicResolution
+ */
+#endif
+
+#include <memory>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Dynamic resolution scaling
+
+Renders the scene into an offscreen framebuffer with resolution scaled down
+from the output size and upscales it into the output framebuffer, adjusting
+the scale each frame so GPU time spent on the scene stays around given
+target:
+@code
+RenderTargetPool pool;
+Shaders::DynamicResolution resolution{defaultFramebuffer.viewport().size(), 12.0f};
+resolution.setScaleRange(0.5f, 1.0f)
+    .setSharpness(0.3f);
+
+// Each frame
+Framebuffer& framebuffer = resolution.begin(pool);
+framebuffer.clear(FramebufferClear::Color|FramebufferClear::Depth);
+// render the scene...
+
+Renderer::disable(Renderer::Feature::DepthTest);
+resolution.end(defaultFramebuffer, pool);
+Renderer::enable(Renderer::Feature::DepthTest);
+// draw the UI in full resolution...
+pool.nextFrame();
+@endcode
+
+The color texture, depth renderbuffer and framebuffer are acquired from
+given @ref RenderTargetPool in @ref begin() and released in @ref end(). They
+are always sized for the maximal scale and only the viewport is changed with
+the scale, so the scaling itself never reallocates any GPU memory.
+
+@section Shaders-DynamicResolution-controller Scale controller
+
+GPU time of everything drawn between @ref begin() and @ref end() is measured
+with a @ref TimeQuery from an internal @ref QueryPool. The results arrive a
+few frames later, each together with the scale it was measured at. As the
+fragment work is roughly proportional to pixel count, the scale which would
+hit the target is @f$ s \sqrt{t_\text{target} / t} @f$. The current scale is
+moved only part of the way toward it to avoid oscillation on noisy timings
+and is then clamped to range set by @ref setScaleRange(). The upscale itself
+and anything drawn after @ref end() are not part of the measured time, so
+leave a margin for them in the target.
+
+If timer queries are not supported (@extension{ARB,timer_query} on desktop,
+@extension{EXT,disjoint_timer_query} on ES), the scale stays at the maximum
+of the range and can be only driven manually with @ref setScale().
+
+@section Shaders-DynamicResolution-upscale Upscaling
+
+The upscale is a bilinear filter, optionally followed by a sharpening
+filter set with @ref setSharpness() recovering some of the detail lost by
+the lower resolution. It is drawn with a single triangle covering the whole
+viewport of the output, the depth test is expected to be disabled and
+blending is not changed.
+
+@requires_gl30 Extension @extension{ARB,framebuffer_object}
+@requires_gles30 Not available in OpenGL ES 2.0.
+@see @ref PostProcessingChain, @ref DebugTools::Profiler
+*/
+class MAGNUM_SHADERS_EXPORT DynamicResolution {
+    public:
+        /**
+         * @brief Constructor
+         * @param outputSize        Size of output framebuffer viewport
+         * @param targetFrameTime   Target GPU time of the scene in
+         *      milliseconds
+         *
+         * The initial scale is `1.0f`.
+         */
+        explicit DynamicResolution(const Vector2i& outputSize, Float targetFrameTime);
+
+        /** @brief Copying is not allowed */
+        DynamicResolution(const DynamicResolution&) = delete;
+
+        /**
+         * @brief Moving is not allowed
+         *
+         * Pending timer query results refer to the instance.
+         */
+        DynamicResolution(DynamicResolution&&) = delete;
+
+        ~DynamicResolution();
+
+        /** @brief Copying is not allowed */
+        DynamicResolution& operator=(const DynamicResolution&) = delete;
+
+        /** @brief Moving is not allowed */
+        DynamicResolution& operator=(DynamicResolution&&) = delete;
+
+        /** @brief Output size */
+        Vector2i outputSize() const { return _outputSize; }
+
+        /**
+         * @brief Set output size
+         * @return Reference to self (for method chaining)
+         *
+         * Call on viewport resize. Expects that @ref begin() wasn't called
+         * without matching @ref end().
+         */
+        DynamicResolution& setOutputSize(const Vector2i& size);
+
+        /** @brief Target GPU frame time in milliseconds */
+        Float targetFrameTime() const { return _targetFrameTime; }
+
+        /**
+         * @brief Set target GPU frame time
+         * @return Reference to self (for method chaining)
+         *
+         * In milliseconds.
+         */
+        DynamicResolution& setTargetFrameTime(Float milliseconds);
+
+        /** @brief Minimal scale */
+        Float minScale() const { return _minScale; }
+
+        /** @brief Maximal scale */
+        Float maxScale() const { return _maxScale; }
+
+        /**
+         * @brief Set scale range
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @p min is positive and not larger than @p max.
+         * Values above `1.0f` render the scene in higher resolution than
+         * the output. Default is `0.5f` and `1.0f`. Expects that
+         * @ref begin() wasn't called without matching @ref end().
+         */
+        DynamicResolution& setScaleRange(Float min, Float max);
+
+        /**
+         * @brief Current scale
+         *
+         * Ratio of @ref renderSize() and @ref outputSize() used in the next
+         * @ref begin().
+         */
+        Float scale() const { return _scale; }
+
+        /**
+         * @brief Set scale
+         * @return Reference to self (for method chaining)
+         *
+         * Clamped to range set by @ref setScaleRange(). The scale is
+         * overwritten with the next measured GPU time, if timer queries are
+         * supported.
+         */
+        DynamicResolution& setScale(Float scale);
+
+        /** @brief Size of the scene rendered with current scale */
+        Vector2i renderSize() const;
+
+        /**
+         * @brief Last measured GPU frame time
+         *
+         * In milliseconds, `0.0f` if nothing was measured yet or timer
+         * queries are not supported.
+         */
+        Float gpuFrameTime() const { return _gpuFrameTime; }
+
+        /** @brief Sharpness */
+        Float sharpness() const { return _sharpness; }
+
+        /**
+         * @brief Set sharpness of the upscale
+         * @return Reference to self (for method chaining)
+         *
+         * `0.0f` is plain bilinear upscale, `1.0f` is the strongest
+         * sharpening. Default is `0.0f`.
+         */
+        DynamicResolution& setSharpness(Float sharpness);
+
+        /**
+         * @brief Set color format
+         * @return Reference to self (for method chaining)
+         *
+         * Format of the texture the scene is rendered into. Default is
+         * @ref TextureFormat::RGBA8.
+         */
+        DynamicResolution& setColorFormat(TextureFormat format) {
+            _colorFormat = format;
+            return *this;
+        }
+
+        /**
+         * @brief Begin rendering the scene
+         * @param pool      Pool for the scaled color texture, depth
+         *      renderbuffer and framebuffer
+         *
+         * Acquires the targets, sets framebuffer viewport to
+         * @ref renderSize(), binds it for drawing, begins the GPU time
+         * measurement and returns the framebuffer. Color is attached to
+         * @ref Framebuffer::ColorAttachment "ColorAttachment(0)", depth to
+         * @ref Framebuffer::BufferAttachment::Depth. Contents of both are
+         * undefined, clear them before rendering.
+         */
+        Framebuffer& begin(RenderTargetPool& pool);
+
+        /**
+         * @brief End rendering the scene and upscale it
+         * @param output    Output framebuffer
+         * @param pool      The same pool as passed to @ref begin()
+         *
+         * Ends the GPU time measurement, upscales the scene into viewport of
+         * @p output, releases the targets back to @p pool and updates
+         * @ref scale() with GPU times which became available. The scaled
+         * color texture is bound to texture unit `0`.
+         */
+        void end(AbstractFramebuffer& output, RenderTargetPool& pool);
+
+    private:
+        class Upscale;
+
+        void addFrameTime(Float scale, Float milliseconds);
+
+        Vector2i _outputSize;
+        Float _targetFrameTime,
+            _minScale,
+            _maxScale,
+            _scale,
+            _gpuFrameTime,
+            _sharpness;
+        TextureFormat _colorFormat;
+
+        std::unique_ptr<Upscale> _upscale;
+        std::unique_ptr<QueryPool<TimeQuery>> _queries;
+        Mesh _fullScreenTriangle;
+
+        Texture2D* _color;
+        Renderbuffer* _depth;
+        Framebuffer* _framebuffer;
+        TimeQuery* _query;
+};
+
+}}
+#else
+#error this header is not available on OpenGL ES 2.0 build
+#endif
+
+#endif
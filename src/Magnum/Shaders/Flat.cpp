@@ -25,12 +25,18 @@
 
 #include "Flat.h"
 
+#include <string>
+
 #include <Corrade/Utility/Resource.h>
 
+#include "Magnum/Buffer.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Shader.h"
 #include "Magnum/Texture.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/Shaders/TransparencyBuffer.h"
+#endif
 
 #include "Implementation/CreateCompatibilityShader.h"
 
@@ -42,9 +48,47 @@ namespace {
     template<UnsignedInt> constexpr const char* vertexShaderName();
     template<> constexpr const char* vertexShaderName<2>() { return "Flat2D.vert"; }
     template<> constexpr const char* vertexShaderName<3>() { return "Flat3D.vert"; }
+
+    #ifndef MAGNUM_TARGET_GLES
+    /* Count of layers rendered in a single pass */
+    UnsignedInt layerCount(const Implementation::FlatFlags flags) {
+        return flags & Implementation::FlatFlag::CubeMap ? 6 : 2;
+    }
+    #endif
+}
+
+template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags, const UnsignedInt jointCount): Flat{flags, jointCount, false} {
+    finalize();
 }
 
-template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): transformationProjectionMatrixUniform(0), colorUniform(1), _flags(flags) {
+template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags, const UnsignedInt jointCount, const bool async): transformationProjectionMatrixUniform(0), colorUniform(1),
+    #ifndef MAGNUM_TARGET_GLES
+    textureHandleUniform(-1),
+    viewProjectionMatricesUniform(3),
+    #endif
+    #ifndef MAGNUM_TARGET_GLES2
+    objectIdUniform(2),
+    _jointCount(flags & Flag::Skinning ? jointCount : 0),
+    #endif
+    _flags(flags)
+{
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_ASSERT(!(flags & Flag::Skinning) || (dimensions == 3 && jointCount),
+        "Shaders::Flat: skinning is available only in 3D with non-zero joint count", );
+    #else
+    static_cast<void>(jointCount);
+    #endif
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_ASSERT(!(flags & Flag::ObjectId) || !(flags & Flag::WeightedBlendedTransparency),
+        "Shaders::Flat: object ID can't be combined with weighted blended transparency", );
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_ASSERT(!(flags & (Flag::Stereo|Flag::CubeMap)) || dimensions == 3,
+        "Shaders::Flat: layered rendering is available only in 3D", );
+    CORRADE_ASSERT(!(flags & Flag::Stereo) || !(flags & Flag::CubeMap),
+        "Shaders::Flat: stereo and cube map rendering are mutually exclusive", );
+    #endif
+
     Utility::Resource rs("MagnumShaders");
 
     #ifndef MAGNUM_TARGET_GLES
@@ -53,16 +97,61 @@ template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): tran
     const Version version = Context::current()->supportedVersion({Version::GLES300, Version::GLES200});
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & Flag::UniformBuffers)
+        MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::uniform_buffer_object);
+    const bool bindless = (flags & Flag::Textured) && (flags & Flag::BindlessTexture);
+    if(bindless)
+        MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::bindless_texture);
+    if(flags & (Flag::Stereo|Flag::CubeMap)) {
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL320);
+        MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::AMD::vertex_shader_layer);
+    }
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES2
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & (Flag::ObjectId|Flag::Skinning|Flag::WeightedBlendedTransparency))
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL300);
+    if(flags & Flag::Skinning)
+        MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::uniform_buffer_object);
+    #else
+    if(flags & (Flag::ObjectId|Flag::Skinning|Flag::WeightedBlendedTransparency))
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GLES300);
+    #endif
+    #endif
+
     Shader vert = Implementation::createCompatibilityShader(rs, version, Shader::Type::Vertex);
     Shader frag = Implementation::createCompatibilityShader(rs, version, Shader::Type::Fragment);
 
     vert.addSource(flags & Flag::Textured ? "#define TEXTURED\n" : "")
+        #ifndef MAGNUM_TARGET_GLES2
+        .addSource(flags & Flag::UniformBuffers ? "#define UNIFORM_BUFFERS\n" : "")
+        .addSource(flags & Flag::InstancedTransformation ? "#define INSTANCED_TRANSFORMATION\n" : "")
+        .addSource(flags & Flag::InstancedColor ? "#define INSTANCED_COLOR\n" : "")
+        .addSource(flags & Flag::Skinning ? "#define SKINNING\n#define JOINT_COUNT " + std::to_string(jointCount) + "\n" : "")
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        .addSource(flags & (Flag::Stereo|Flag::CubeMap) ? "#extension GL_AMD_vertex_shader_layer: require\n#define LAYER_COUNT " + std::to_string(layerCount(flags)) + "\n" : "")
+        #endif
         .addSource(rs.get("generic.glsl"))
         .addSource(rs.get(vertexShaderName<dimensions>()));
     frag.addSource(flags & Flag::Textured ? "#define TEXTURED\n" : "")
+        #ifndef MAGNUM_TARGET_GLES2
+        .addSource(flags & Flag::UniformBuffers ? "#define UNIFORM_BUFFERS\n" : "")
+        .addSource(flags & Flag::InstancedColor ? "#define INSTANCED_COLOR\n" : "")
+        .addSource(flags & Flag::ObjectId ? "#define OBJECT_ID\n" : "")
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        .addSource(bindless ? "#extension GL_ARB_bindless_texture: require\n#define BINDLESS_TEXTURE\n" : "")
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        .addSource(flags & Flag::WeightedBlendedTransparency ? "#define WEIGHTED_BLENDED_TRANSPARENCY\n" + rs.get("WeightedBlendedTransparency.glsl") : "")
+        #endif
         .addSource(rs.get("Flat.frag"));
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+    Shader::submitCompile({vert, frag});
+    if(!async) CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::checkCompile({vert, frag}));
 
     attachShaders({vert, frag});
 
@@ -74,10 +163,52 @@ template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): tran
     {
         bindAttributeLocation(Position::Location, "position");
         if(flags & Flag::Textured) bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+        #ifndef MAGNUM_TARGET_GLES2
+        if(flags & Flag::InstancedTransformation) bindAttributeLocation(TransformationMatrix::Location, "instancedTransformationMatrix");
+        if(flags & Flag::InstancedColor) bindAttributeLocation(Color::Location, "instancedColor");
+        if(flags & Flag::Skinning) {
+            bindAttributeLocation(JointIds::Location, "jointIds");
+            bindAttributeLocation(Weights::Location, "weights");
+        }
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        if(flags & Flag::WeightedBlendedTransparency) {
+            bindFragmentDataLocation(TransparencyBuffer::AccumulationOutput, "accumulation");
+            bindFragmentDataLocation(TransparencyBuffer::RevealageOutput, "revealage");
+        }
+        #endif
     }
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+    /* Linking is only submitted here, so multiple programs can be linked
+       in parallel. It is finished in finalize(). */
+    submitLink({*this});
+}
+
+template<UnsignedInt dimensions> void Flat<dimensions>::finalize() {
+    const Flags flags = _flags;
+
+    /* Only the extension checks on desktop GL need these */
+    #ifndef MAGNUM_TARGET_GLES
+    const Version version = Context::current()->supportedVersion({Version::GL320, Version::GL310, Version::GL300, Version::GL210});
+    const bool bindless = (flags & Flag::Textured) && (flags & Flag::BindlessTexture);
+    #endif
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(checkLink({*this}));
+
+    #ifndef MAGNUM_TARGET_GLES2
+    /* The joint palette is in a uniform block even without uniform buffers
+       enabled */
+    if(flags & Flag::Skinning)
+        setUniformBlockBinding(uniformBlockIndex("Joints"), Generic<dimensions>::JointBufferBinding);
+
+    if(flags & Flag::UniformBuffers) {
+        setUniformBlockBinding(uniformBlockIndex("Transformation"), Generic<dimensions>::TransformationBufferBinding);
+        setUniformBlockBinding(uniformBlockIndex("Material"), Generic<dimensions>::MaterialBufferBinding);
 
+        /* The plain uniforms are not present at all, make the setters no-op */
+        transformationProjectionMatrixUniform = colorUniform = -1;
+    } else
+    #endif
     #ifndef MAGNUM_TARGET_GLES
     if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::explicit_uniform_location>(version))
     #endif
@@ -86,8 +217,32 @@ template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): tran
         colorUniform = uniformLocation("color");
     }
 
+    #ifndef MAGNUM_TARGET_GLES2
+    /* The object ID is a plain uniform even with uniform buffers enabled */
+    if(!(flags & Flag::ObjectId))
+        objectIdUniform = -1;
     #ifndef MAGNUM_TARGET_GLES
-    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
+    else if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::explicit_uniform_location>(version))
+    #else
+    else
+    #endif
+        objectIdUniform = uniformLocation("objectId");
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    /* The view projection matrices are plain uniforms even with uniform
+       buffers enabled */
+    if(!(flags & (Flag::Stereo|Flag::CubeMap)))
+        viewProjectionMatricesUniform = -1;
+    else if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::explicit_uniform_location>(version))
+        viewProjectionMatricesUniform = uniformLocation("viewProjectionMatrices");
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    if(bindless) {
+        if(!(flags & Flag::UniformBuffers))
+            textureHandleUniform = uniformLocation("textureData");
+    } else if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
     #endif
     {
         if(flags & Flag::Textured) setUniform(uniformLocation("textureData"), TextureLayer);
@@ -100,10 +255,59 @@ template<UnsignedInt dimensions> Flat<dimensions>::Flat(const Flags flags): tran
 }
 
 template<UnsignedInt dimensions> Flat<dimensions>& Flat<dimensions>::setTexture(Texture2D& texture) {
+    #ifndef MAGNUM_TARGET_GLES
+    if(_flags & Flag::BindlessTexture) return *this;
+    #endif
     if(_flags & Flag::Textured)  texture.bind(TextureLayer);
     return *this;
 }
 
+#ifndef MAGNUM_TARGET_GLES
+template<UnsignedInt dimensions> Flat<dimensions>& Flat<dimensions>::setViewProjectionMatrices(const MatrixTypeFor<dimensions, Float>& first, const MatrixTypeFor<dimensions, Float>& second) {
+    const MatrixTypeFor<dimensions, Float> matrices[]{first, second};
+    return setViewProjectionMatrices(matrices);
+}
+
+template<UnsignedInt dimensions> Flat<dimensions>& Flat<dimensions>::setViewProjectionMatrices(const Containers::ArrayReference<const MatrixTypeFor<dimensions, Float>> matrices) {
+    if(!(_flags & (Flag::Stereo|Flag::CubeMap))) return *this;
+    CORRADE_ASSERT(matrices.size() == layerCount(_flags),
+        "Shaders::Flat::setViewProjectionMatrices(): expected" << layerCount(_flags) << "matrices but got" << matrices.size(), *this);
+    setUniform(viewProjectionMatricesUniform, matrices.size(), matrices.data());
+    return *this;
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+template<UnsignedInt dimensions> Flat<dimensions>& Flat<dimensions>::bindTransformationBuffer(Buffer& buffer, const GLintptr offset) {
+    CORRADE_ASSERT(_flags & Flag::UniformBuffers,
+        "Shaders::Flat::bindTransformationBuffer(): the shader was not created with uniform buffers enabled", *this);
+    buffer.bind(Buffer::Target::Uniform, Generic<dimensions>::TransformationBufferBinding, offset, sizeof(TransformationUniform));
+    return *this;
+}
+
+template<UnsignedInt dimensions> Flat<dimensions>& Flat<dimensions>::bindMaterialBuffer(Buffer& buffer, const GLintptr offset) {
+    CORRADE_ASSERT(_flags & Flag::UniformBuffers,
+        "Shaders::Flat::bindMaterialBuffer(): the shader was not created with uniform buffers enabled", *this);
+    buffer.bind(Buffer::Target::Uniform, Generic<dimensions>::MaterialBufferBinding, offset, sizeof(MaterialUniform));
+    return *this;
+}
+
+template<UnsignedInt dimensions> Flat<dimensions>& Flat<dimensions>::bindJointBuffer(Buffer& buffer, const GLintptr offset) {
+    CORRADE_ASSERT(_flags & Flag::Skinning,
+        "Shaders::Flat::bindJointBuffer(): the shader was not created with skinning enabled", *this);
+    buffer.bind(Buffer::Target::Uniform, Generic<dimensions>::JointBufferBinding, offset, _jointCount*sizeof(Matrix4));
+    return *this;
+}
+
+static_assert(sizeof(Flat2D::TransformationUniform) == 48 && sizeof(Flat3D::TransformationUniform) == 64,
+    "Improper size of transformation uniform block");
+#ifndef MAGNUM_TARGET_GLES
+static_assert(sizeof(Flat3D::MaterialUniform) == 32, "Improper size of material uniform block");
+#else
+static_assert(sizeof(Flat3D::MaterialUniform) == 16, "Improper size of material uniform block");
+#endif
+#endif
+
 template class Flat<2>;
 template class Flat<3>;
 
@@ -23,6 +23,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+/* The GL_ARB_bindless_texture extension is enabled in Flat.cpp, as it has
+   to come before WeightedBlendedTransparency.glsl */
+
 #ifndef NEW_GLSL
 #define fragmentColor gl_FragColor
 #define texture texture2D
@@ -30,14 +33,28 @@
 #endif
 
 #ifdef TEXTURED
-#ifdef EXPLICIT_TEXTURE_LAYER
+#ifdef BINDLESS_TEXTURE
+#ifndef UNIFORM_BUFFERS
+layout(bindless_sampler) uniform sampler2D textureData;
+#endif
+#elif defined(EXPLICIT_TEXTURE_LAYER)
 layout(binding = 0) uniform sampler2D textureData;
 #else
 uniform sampler2D textureData;
 #endif
 #endif
 
-#ifdef EXPLICIT_UNIFORM_LOCATION
+#ifdef UNIFORM_BUFFERS
+layout(std140) uniform Material {
+    lowp vec4 color;
+    #ifdef BINDLESS_TEXTURE
+    uvec2 textureHandle;
+    #endif
+};
+#ifdef BINDLESS_TEXTURE
+#define textureData sampler2D(textureHandle)
+#endif
+#elif defined(EXPLICIT_UNIFORM_LOCATION)
 #   ifndef GL_ES
 layout(location = 1) uniform vec4 color = vec4(1.0f, 1.0f, 1.0f, 1.0f);
 #   else
@@ -55,14 +72,42 @@ uniform lowp vec4 color;
 in mediump vec2 interpolatedTextureCoordinates;
 #endif
 
-#ifdef NEW_GLSL
+#ifdef INSTANCED_COLOR
+in lowp vec4 interpolatedInstancedColor;
+#endif
+
+#ifdef OBJECT_ID
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 2) uniform highp uint objectId;
+#else
+uniform highp uint objectId;
+#endif
+#endif
+
+#ifdef OBJECT_ID
+out highp uint fragmentObjectId;
+#elif defined(WEIGHTED_BLENDED_TRANSPARENCY)
+lowp vec4 fragmentColor;
+#elif defined(NEW_GLSL)
 out lowp vec4 fragmentColor;
 #endif
 
 void main() {
+    #ifdef OBJECT_ID
+    fragmentObjectId = objectId;
+    #else
     #ifdef TEXTURED
     fragmentColor = color * texture(textureData, interpolatedTextureCoordinates);
     #else
     fragmentColor = color;
     #endif
+
+    #ifdef INSTANCED_COLOR
+    fragmentColor *= interpolatedInstancedColor;
+    #endif
+
+    #ifdef WEIGHTED_BLENDED_TRANSPARENCY
+    writeWeightedBlended(fragmentColor);
+    #endif
+    #endif
 }
@@ -29,17 +29,41 @@
  * @brief Class @ref Magnum::Shaders::Flat, typedef @ref Magnum::Shaders::Flat2D, @ref Magnum::Shaders::Flat3D
  */
 
+#include <Corrade/Containers/ArrayReference.h>
+
 #include "Magnum/Color.h"
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/Shaders.h"
 #include "Magnum/Shaders/visibility.h"
 
 namespace Magnum { namespace Shaders {
 
 namespace Implementation {
-    enum class FlatFlag: UnsignedByte { Textured = 1 << 0 };
+    enum class FlatFlag: UnsignedShort {
+        Textured = 1 << 0,
+        #ifndef MAGNUM_TARGET_GLES2
+        UniformBuffers = 1 << 1,
+        InstancedTransformation = 1 << 2,
+        InstancedColor = 1 << 3,
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        BindlessTexture = 1 << 4,
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        ObjectId = 1 << 5,
+        Skinning = 1 << 6,
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        Stereo = 1 << 7,
+        CubeMap = 1 << 8,
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        WeightedBlendedTransparency = 1 << 9
+        #endif
+    };
     typedef Containers::EnumSet<FlatFlag> FlatFlags;
 }
 
@@ -122,6 +146,143 @@ shader.setTransformationProjectionMatrix(projectionMatrix*transformationMatrix)
 mesh.draw(shader);
 @endcode
 
+@anchor Shaders-Flat-instancing
+### Instanced rendering
+
+With @ref Flag::InstancedTransformation the transformation and projection
+matrix is multiplied with per-instance @ref TransformationMatrix attribute,
+with @ref Flag::InstancedColor the color is multiplied with per-instance
+@ref Color attribute. Many copies of the same mesh can be then drawn in a
+single call:
+@code
+struct Instance {
+    Matrix4 transformation;
+    Color4 color;
+};
+std::vector<Instance> instanceData = ...;
+
+Buffer instances;
+instances.setData(instanceData, BufferUsage::DynamicDraw);
+
+mesh.addVertexBufferInstanced(instances, 1, 0,
+    Shaders::Flat3D::TransformationMatrix{},
+    Shaders::Flat3D::Color{})
+    .setInstanceCount(instanceData.size());
+
+Shaders::Flat3D shader{Shaders::Flat3D::Flag::InstancedTransformation|
+                       Shaders::Flat3D::Flag::InstancedColor};
+shader.setTransformationProjectionMatrix(projectionMatrix*cameraMatrix);
+
+mesh.draw(shader);
+@endcode
+
+@anchor Shaders-Flat-uniform-buffers
+### Uniform buffers
+
+With @ref Flag::UniformBuffers the transformation and color are taken from
+`Transformation` and `Material` uniform blocks instead of being set via
+@ref setTransformationProjectionMatrix() and @ref setColor(). Data for many
+draws can be uploaded into a single buffer at once and each draw then only
+selects its range:
+@code
+const Int alignment = Buffer::uniformOffsetAlignment();
+const GLintptr stride = (sizeof(Shaders::Flat3D::TransformationUniform) + alignment - 1)/alignment*alignment;
+
+std::vector<char> data(stride*drawables.size());
+for(std::size_t i = 0; i != drawables.size(); ++i)
+    *reinterpret_cast<Shaders::Flat3D::TransformationUniform*>(data.data() + i*stride) =
+        Shaders::Flat3D::TransformationUniform{}
+            .setTransformationProjectionMatrix(drawables[i].transformationProjectionMatrix());
+
+Buffer transformations;
+transformations.setData({data.data(), data.size()}, BufferUsage::DynamicDraw);
+
+Shaders::Flat3D shader{Shaders::Flat3D::Flag::UniformBuffers};
+shader.bindMaterialBuffer(materials);
+for(std::size_t i = 0; i != drawables.size(); ++i) {
+    shader.bindTransformationBuffer(transformations, i*stride);
+    drawables[i].mesh().draw(shader);
+}
+@endcode
+
+@anchor Shaders-Flat-skinning
+### Skinning
+
+With @ref Flag::Skinning, available only in 3D, each vertex is transformed by
+a weighted sum of up to four matrices from a joint matrix palette before
+applying the transformation and projection matrix. The mesh needs to supply
+@ref JointIds and @ref Weights attributes and the palette is taken from the
+`Joints` uniform block, containing as many @ref Matrix4 as specified in the
+constructor:
+@code
+mesh.addVertexBuffer(vertices, 0,
+    Shaders::Flat3D::Position{},
+    Shaders::Flat3D::JointIds{},
+    Shaders::Flat3D::Weights{});
+
+std::vector<Matrix4> jointMatrices(skeleton.jointCount());
+// for each joint, absolute joint transformation multiplied with inverse
+// bind matrix
+Buffer joints;
+joints.setData(jointMatrices, BufferUsage::StreamDraw);
+
+Shaders::Flat3D shader{Shaders::Flat3D::Flag::Skinning, UnsignedInt(jointMatrices.size())};
+shader.setTransformationProjectionMatrix(projectionMatrix*transformationMatrix)
+    .bindJointBuffer(joints);
+
+mesh.draw(shader);
+@endcode
+
+@anchor Shaders-Flat-stereo
+### Stereo rendering
+
+With @ref Flag::Stereo, available only in 3D, both eyes are rendered with a
+single draw call. Each mesh instance is rendered into the framebuffer layer
+given by parity of its instance ID, using the view projection matrix set for
+that layer. The transformation matrix is then expected to be relative to the
+camera, without the projection. Render into a framebuffer with
+@ref Texture2DArray attached using @ref Framebuffer::attachLayeredTexture(),
+see @ref SceneGraph::BasicStereoCamera3D for a complete example:
+@code
+Shaders::Flat3D shader{Shaders::Flat3D::Flag::Stereo};
+shader.setTransformationProjectionMatrix(transformationMatrix)
+    .setViewProjectionMatrices(leftViewProjection, rightViewProjection);
+
+mesh.setInstanceCount(2)
+    .draw(shader);
+@endcode
+
+With @ref Flag::CubeMap the same is done for six layers, each rendering one
+face of a cube map attached with @ref Framebuffer::attachLayeredTexture(),
+see @ref SceneGraph::BasicCubeMapCamera3D for a complete example:
+@code
+Shaders::Flat3D shader{Shaders::Flat3D::Flag::CubeMap};
+shader.setTransformationProjectionMatrix(transformationMatrix)
+    .setViewProjectionMatrices(faceViewProjections);
+
+mesh.setInstanceCount(6)
+    .draw(shader);
+@endcode
+
+Together with @ref Flag::InstancedTransformation, set the instance divisor of
+the per-instance attributes to the layer count and multiply the instance count
+by it.
+
+@anchor Shaders-Flat-transparency
+### Order-independent transparency
+
+With @ref Flag::WeightedBlendedTransparency the shader writes into a
+@ref TransparencyBuffer instead of a single color output, using alpha of the
+final color as opacity. The transparent geometry can then be drawn in any
+order together with other geometry sharing the same render state and
+composited over the opaque result with @ref TransparencyCompositing, see
+@ref TransparencyBuffer for a complete example.
+@code
+Shaders::Flat3D shader{Shaders::Flat3D::Flag::WeightedBlendedTransparency};
+shader.setTransformationProjectionMatrix(transformationProjectionMatrix)
+    .setColor(Color4{1.0f, 0.5f, 0.0f, 0.3f});
+@endcode
+
 @see @ref shaders, @ref Flat2D, @ref Flat3D
 */
 template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public AbstractShaderProgram {
@@ -142,6 +303,49 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public Abstra
          */
         typedef typename Generic<dimensions>::TextureCoordinates TextureCoordinates;
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Per-instance transformation matrix
+         *
+         * @ref shaders-generic "Generic attribute", @ref Matrix3 in 2D,
+         * @ref Matrix4 in 3D. Used only if @ref Flag::InstancedTransformation
+         * is set.
+         * @requires_gles30 Instanced attributes are not available in OpenGL
+         *      ES 2.0.
+         */
+        typedef typename Generic<dimensions>::TransformationMatrix TransformationMatrix;
+
+        /**
+         * @brief Per-instance color
+         *
+         * @ref shaders-generic "Generic attribute", @ref Color4. Used only if
+         * @ref Flag::InstancedColor is set.
+         * @requires_gles30 Instanced attributes are not available in OpenGL
+         *      ES 2.0.
+         */
+        typedef typename Generic<dimensions>::Color Color;
+
+        /**
+         * @brief Joint IDs
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector4ui. Used only
+         * if @ref Flag::Skinning is set.
+         * @requires_gl30 Extension @extension{EXT,gpu_shader4}
+         * @requires_gles30 Integer attributes are not available in OpenGL
+         *      ES 2.0.
+         */
+        typedef typename Generic<dimensions>::JointIds JointIds;
+
+        /**
+         * @brief Joint weights
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector4. Used only
+         * if @ref Flag::Skinning is set.
+         * @requires_gles30 Skinning is not available in OpenGL ES 2.0.
+         */
+        typedef typename Generic<dimensions>::Weights Weights;
+        #endif
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         enum: Int {
             /**
@@ -159,8 +363,110 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public Abstra
          *
          * @see @ref Flags, @ref flags()
          */
-        enum class Flag: UnsignedByte {
-            Textured = 1 << 0   /**< The shader uses texture instead of color */
+        enum class Flag: UnsignedShort {
+            Textured = 1 << 0,  /**< The shader uses texture instead of color */
+
+            /**
+             * The shader takes transformation and color from uniform
+             * buffers instead of plain uniforms. See
+             * @ref Shaders-Flat-uniform-buffers "class documentation" for
+             * more information.
+             * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+             * @requires_gles30 Uniform buffers are not available in OpenGL
+             *      ES 2.0.
+             */
+            UniformBuffers = 1 << 1,
+
+            /**
+             * The transformation is multiplied with per-instance
+             * @ref TransformationMatrix attribute. See
+             * @ref Shaders-Flat-instancing "class documentation" for more
+             * information.
+             * @requires_gles30 Instanced attributes are not available in
+             *      OpenGL ES 2.0.
+             */
+            InstancedTransformation = 1 << 2,
+
+            /**
+             * The color is multiplied with per-instance @ref Color
+             * attribute.
+             * @requires_gles30 Instanced attributes are not available in
+             *      OpenGL ES 2.0.
+             */
+            InstancedColor = 1 << 3,
+
+            /**
+             * The texture is accessed through bindless handle set via
+             * @ref setTextureHandle() or @ref MaterialUniform::setTextureHandle()
+             * instead of being bound to a texture unit. Has effect only
+             * together with @ref Flag::Textured.
+             * @requires_extension Extension @extension{ARB,bindless_texture}
+             * @requires_gl Bindless textures are not available in OpenGL ES.
+             */
+            BindlessTexture = 1 << 4,
+
+            /**
+             * Instead of color the shader writes value set via
+             * @ref setObjectId() into a single unsigned integer output,
+             * color and texture are ignored. Meant for rendering into
+             * @ref RenderbufferFormat::R32UI attachment for object picking,
+             * see @ref DebugTools::ObjectPicker.
+             * @requires_gl30 Extension @extension{EXT,gpu_shader4}
+             * @requires_gles30 Integer outputs are not available in OpenGL
+             *      ES 2.0.
+             */
+            ObjectId = 1 << 5,
+
+            /**
+             * Vertex positions are transformed with joint matrices given by
+             * @ref JointIds and @ref Weights attributes. Available only in
+             * 3D. See @ref Shaders-Flat-skinning "class documentation" for
+             * more information.
+             * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+             *      and @extension{EXT,gpu_shader4}
+             * @requires_gles30 Skinning is not available in OpenGL ES 2.0.
+             */
+            Skinning = 1 << 6,
+
+            /**
+             * Each mesh instance is rendered into one of two layers of a
+             * layered framebuffer, even instances into the first, odd
+             * instances into the second, with view projection matrix set
+             * for given layer using @ref setViewProjectionMatrices().
+             * Available only in 3D. See @ref Shaders-Flat-stereo "class documentation"
+             * for more information.
+             * @requires_gl32 Extension @extension{ARB,geometry_shader4}
+             *      and @extension{AMD,vertex_shader_layer}
+             * @requires_gl Layered rendering is not available in OpenGL ES.
+             */
+            Stereo = 1 << 7,
+
+            /**
+             * Each mesh instance is rendered into one of six layers of a
+             * layered framebuffer, instance with ID `i` into layer `i % 6`,
+             * with view projection matrix set for given layer using
+             * @ref setViewProjectionMatrices(). Meant for rendering all faces
+             * of a cube map in a single pass. Available only in 3D, can't
+             * be combined with @ref Flag::Stereo. See
+             * @ref Shaders-Flat-stereo "class documentation" for more
+             * information.
+             * @requires_gl32 Extension @extension{ARB,geometry_shader4}
+             *      and @extension{AMD,vertex_shader_layer}
+             * @requires_gl Layered rendering is not available in OpenGL ES.
+             */
+            CubeMap = 1 << 8,
+
+            /**
+             * Write weighted color and revealage into a
+             * @ref TransparencyBuffer for order-independent transparency
+             * instead of a single color output. Can't be combined with
+             * @ref Flag::ObjectId. See @ref Shaders-Flat-transparency "class documentation"
+             * for more information.
+             * @requires_gl30 Extension @extension{ARB,color_buffer_float}
+             * @requires_gles30 Multiple render targets are not available in
+             *      OpenGL ES 2.0.
+             */
+            WeightedBlendedTransparency = 1 << 9
         };
 
         /**
@@ -174,18 +480,107 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public Abstra
         typedef Implementation::FlatFlags Flags;
         #endif
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Transformation uniform block
+         *
+         * Used only if @ref Flag::UniformBuffers is set.
+         * @see @ref bindTransformationBuffer()
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         */
+        typedef TransformationProjectionUniform<dimensions> TransformationUniform;
+
+        /**
+         * @brief Material uniform block
+         *
+         * Data of the `Material` uniform block, used only if
+         * @ref Flag::UniformBuffers is set.
+         * @see @ref bindMaterialBuffer()
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         */
+        class MaterialUniform {
+            public:
+                /**
+                 * @brief Constructor
+                 *
+                 * The color is set to fully opaque white.
+                 */
+                /*implicit*/ MaterialUniform(): _color{1.0f}
+                    #ifndef MAGNUM_TARGET_GLES
+                    , _textureHandle{}, _padding{}
+                    #endif
+                    {}
+
+                /**
+                 * @brief Set color
+                 * @return Reference to self (for method chaining)
+                 *
+                 * @see @ref Flat::setColor()
+                 */
+                MaterialUniform& setColor(const Color4& color) {
+                    _color = color;
+                    return *this;
+                }
+
+                #ifndef MAGNUM_TARGET_GLES
+                /**
+                 * @brief Set bindless texture handle
+                 * @return Reference to self (for method chaining)
+                 *
+                 * Used only if @ref Flag::Textured and
+                 * @ref Flag::BindlessTexture is set.
+                 * @see @ref AbstractTexture::handle()
+                 * @requires_extension Extension @extension{ARB,bindless_texture}
+                 * @requires_gl Bindless textures are not available in
+                 *      OpenGL ES.
+                 */
+                MaterialUniform& setTextureHandle(GLuint64 handle) {
+                    _textureHandle = handle;
+                    return *this;
+                }
+                #endif
+
+            private:
+                Color4 _color;
+                #ifndef MAGNUM_TARGET_GLES
+                GLuint64 _textureHandle;
+                GLuint64 _padding;
+                #endif
+        };
+        #endif
+
         /**
          * @brief Constructor
-         * @param flags     Flags
+         * @param flags         Flags
+         * @param jointCount    Size of joint matrix palette. Used only if
+         *      @ref Flag::Skinning is set, in which case it is expected to
+         *      be non-zero.
          */
-        explicit Flat(Flags flags = Flags());
+        explicit Flat(Flags flags = Flags(), UnsignedInt jointCount = 0);
 
         /** @brief Flags */
         Flags flags() const { return _flags; }
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Size of joint matrix palette
+         *
+         * Zero if @ref Flag::Skinning is not set.
+         * @requires_gles30 Skinning is not available in OpenGL ES 2.0.
+         */
+        UnsignedInt jointCount() const { return _jointCount; }
+        #endif
+
         /**
          * @brief Set transformation and projection matrix
          * @return Reference to self (for method chaining)
+         *
+         * Has no effect if @ref Flag::UniformBuffers is set.
+         * @see @ref bindTransformationBuffer()
          */
         Flat<dimensions>& setTransformationProjectionMatrix(const MatrixTypeFor<dimensions, Float>& matrix) {
             setUniform(transformationProjectionMatrixUniform, matrix);
@@ -197,8 +592,9 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public Abstra
          * @return Reference to self (for method chaining)
          *
          * If not set, default value is fully opaque white. Color will be
-         * multiplied with texture if @ref Flag::Textured is set.
-         * @see @ref setTexture()
+         * multiplied with texture if @ref Flag::Textured is set. Has no
+         * effect if @ref Flag::UniformBuffers is set.
+         * @see @ref setTexture(), @ref bindMaterialBuffer()
          */
         Flat<dimensions>& setColor(const Color4& color);
 
@@ -206,14 +602,150 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Flat: public Abstra
          * @brief Set texture
          * @return Reference to self (for method chaining)
          *
-         * Has effect only if @ref Flag::Textured is set.
+         * Has effect only if @ref Flag::Textured is set and
+         * @ref Flag::BindlessTexture is not set.
          * @see @ref setColor()
          */
         Flat<dimensions>& setTexture(Texture2D& texture);
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Set object ID
+         * @return Reference to self (for method chaining)
+         *
+         * Has effect only if @ref Flag::ObjectId is set. Default is `0`.
+         * @requires_gl30 Extension @extension{EXT,gpu_shader4}
+         * @requires_gles30 Integer outputs are not available in OpenGL ES
+         *      2.0.
+         */
+        Flat<dimensions>& setObjectId(UnsignedInt id) {
+            setUniform(objectIdUniform, id);
+            return *this;
+        }
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set view projection matrices for stereo rendering
+         * @return Reference to self (for method chaining)
+         *
+         * The matrices are applied after the matrix set by
+         * @ref setTransformationProjectionMatrix(), which should then
+         * contain only the transformation relative to the camera. Has
+         * effect only if @ref Flag::Stereo is set.
+         * @see @ref SceneGraph::BasicStereoCamera3D::eyeViewProjectionMatrix()
+         * @requires_gl32 Extension @extension{ARB,geometry_shader4}
+         *      and @extension{AMD,vertex_shader_layer}
+         * @requires_gl Layered rendering is not available in OpenGL ES.
+         */
+        Flat<dimensions>& setViewProjectionMatrices(const MatrixTypeFor<dimensions, Float>& first, const MatrixTypeFor<dimensions, Float>& second);
+
+        /**
+         * @brief Set view projection matrices for layered rendering
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that the count of matrices is `2` if @ref Flag::Stereo is
+         * set and `6` if @ref Flag::CubeMap is set. Has no effect
+         * otherwise.
+         * @see @ref SceneGraph::BasicCubeMapCamera3D::faceViewProjectionMatrix()
+         * @requires_gl32 Extension @extension{ARB,geometry_shader4}
+         *      and @extension{AMD,vertex_shader_layer}
+         * @requires_gl Layered rendering is not available in OpenGL ES.
+         */
+        Flat<dimensions>& setViewProjectionMatrices(Containers::ArrayReference<const MatrixTypeFor<dimensions, Float>> matrices);
+
+        /**
+         * @brief Set bindless texture handle
+         * @return Reference to self (for method chaining)
+         *
+         * Has effect only if @ref Flag::Textured and
+         * @ref Flag::BindlessTexture is set and @ref Flag::UniformBuffers is
+         * not set. The handle must be resident, see
+         * @ref AbstractTexture::makeResident().
+         * @see @ref AbstractTexture::handle(),
+         *      @ref MaterialUniform::setTextureHandle()
+         * @requires_extension Extension @extension{ARB,bindless_texture}
+         * @requires_gl Bindless textures are not available in OpenGL ES.
+         */
+        Flat<dimensions>& setTextureHandle(GLuint64 handle) {
+            setUniformHandle(textureHandleUniform, handle);
+            return *this;
+        }
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Bind transformation uniform buffer
+         * @param buffer    Buffer with @ref TransformationUniform data
+         * @param offset    Offset of the data in the buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Binds given range of the buffer to
+         * @ref Generic::TransformationBufferBinding. Expects that
+         * @ref Flag::UniformBuffers is set. The @p offset must be a multiple
+         * of @ref Buffer::uniformOffsetAlignment().
+         * @see @ref Buffer::bind(Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr)
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         */
+        Flat<dimensions>& bindTransformationBuffer(Buffer& buffer, GLintptr offset = 0);
+
+        /**
+         * @brief Bind material uniform buffer
+         * @param buffer    Buffer with @ref MaterialUniform data
+         * @param offset    Offset of the data in the buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Binds given range of the buffer to
+         * @ref Generic::MaterialBufferBinding. Expects that
+         * @ref Flag::UniformBuffers is set. The @p offset must be a multiple
+         * of @ref Buffer::uniformOffsetAlignment().
+         * @see @ref Buffer::bind(Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr)
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         */
+        Flat<dimensions>& bindMaterialBuffer(Buffer& buffer, GLintptr offset = 0);
+
+        /**
+         * @brief Bind joint matrix uniform buffer
+         * @param buffer    Buffer with @ref jointCount() @ref Matrix4 values
+         * @param offset    Offset of the data in the buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Binds given range of the buffer to
+         * @ref Generic::JointBufferBinding. Expects that @ref Flag::Skinning
+         * is set. The @p offset must be a multiple of
+         * @ref Buffer::uniformOffsetAlignment().
+         * @see @ref Buffer::bind(Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr)
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         */
+        Flat<dimensions>& bindJointBuffer(Buffer& buffer, GLintptr offset = 0);
+        #endif
+
     private:
+        friend ShaderCache;
+
+        /* Submits compilation and linking of the program without waiting
+           for the result, the setup is done in finalize(). If `async` is
+           `false`, waits for compilation to report errors early. */
+        explicit Flat(Flags flags, UnsignedInt jointCount, bool async);
+
+        void finalize();
+
         Int transformationProjectionMatrixUniform,
             colorUniform;
+        #ifndef MAGNUM_TARGET_GLES
+        Int textureHandleUniform,
+            viewProjectionMatricesUniform;
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        Int objectIdUniform;
+        UnsignedInt _jointCount;
+        #endif
 
         Flags _flags;
 };
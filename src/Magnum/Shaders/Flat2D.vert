@@ -28,7 +28,11 @@
 #define out varying
 #endif
 
-#ifdef EXPLICIT_UNIFORM_LOCATION
+#ifdef UNIFORM_BUFFERS
+layout(std140) uniform Transformation {
+    highp mat3 transformationProjectionMatrix;
+};
+#elif defined(EXPLICIT_UNIFORM_LOCATION)
 layout(location = 0) uniform mat3 transformationProjectionMatrix;
 #else
 uniform highp mat3 transformationProjectionMatrix;
@@ -40,6 +44,23 @@ layout(location = POSITION_ATTRIBUTE_LOCATION) in highp vec2 position;
 in highp vec2 position;
 #endif
 
+#ifdef INSTANCED_TRANSFORMATION
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TRANSFORMATION_MATRIX_ATTRIBUTE_LOCATION) in highp mat3 instancedTransformationMatrix;
+#else
+in highp mat3 instancedTransformationMatrix;
+#endif
+#endif
+
+#ifdef INSTANCED_COLOR
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = COLOR_ATTRIBUTE_LOCATION) in lowp vec4 instancedColor;
+#else
+in lowp vec4 instancedColor;
+#endif
+out lowp vec4 interpolatedInstancedColor;
+#endif
+
 #ifdef TEXTURED
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = TEXTURECOORDINATES_ATTRIBUTE_LOCATION) in mediump vec2 textureCoordinates;
@@ -50,10 +71,19 @@ out mediump vec2 interpolatedTextureCoordinates;
 #endif
 
 void main() {
+    #ifdef INSTANCED_TRANSFORMATION
+    gl_Position.xywz = vec4(transformationProjectionMatrix*instancedTransformationMatrix*vec3(position, 1.0), 0.0);
+    #else
     gl_Position.xywz = vec4(transformationProjectionMatrix*vec3(position, 1.0), 0.0);
+    #endif
 
     #ifdef TEXTURED
     /* Texture coordinates, if needed */
     interpolatedTextureCoordinates = textureCoordinates;
     #endif
+
+    #ifdef INSTANCED_COLOR
+    /* Per-instance color, if needed */
+    interpolatedInstancedColor = instancedColor;
+    #endif
 }
@@ -28,18 +28,61 @@
 #define out varying
 #endif
 
-#ifdef EXPLICIT_UNIFORM_LOCATION
+#ifdef UNIFORM_BUFFERS
+layout(std140) uniform Transformation {
+    highp mat4 transformationProjectionMatrix;
+};
+#elif defined(EXPLICIT_UNIFORM_LOCATION)
 layout(location = 0) uniform mat4 transformationProjectionMatrix;
 #else
 uniform highp mat4 transformationProjectionMatrix;
 #endif
 
+#ifdef LAYER_COUNT
+#ifdef EXPLICIT_UNIFORM_LOCATION
+layout(location = 3) uniform highp mat4 viewProjectionMatrices[LAYER_COUNT];
+#else
+uniform highp mat4 viewProjectionMatrices[LAYER_COUNT];
+#endif
+#endif
+
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = POSITION_ATTRIBUTE_LOCATION) in highp vec4 position;
 #else
 in highp vec4 position;
 #endif
 
+#ifdef INSTANCED_TRANSFORMATION
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TRANSFORMATION_MATRIX_ATTRIBUTE_LOCATION) in highp mat4 instancedTransformationMatrix;
+#else
+in highp mat4 instancedTransformationMatrix;
+#endif
+#endif
+
+#ifdef SKINNING
+layout(std140) uniform Joints {
+    highp mat4 jointMatrices[JOINT_COUNT];
+};
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = JOINT_IDS_ATTRIBUTE_LOCATION) in mediump uvec4 jointIds;
+layout(location = WEIGHTS_ATTRIBUTE_LOCATION) in mediump vec4 weights;
+#else
+in mediump uvec4 jointIds;
+in mediump vec4 weights;
+#endif
+#endif
+
+#ifdef INSTANCED_COLOR
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = COLOR_ATTRIBUTE_LOCATION) in lowp vec4 instancedColor;
+#else
+in lowp vec4 instancedColor;
+#endif
+out lowp vec4 interpolatedInstancedColor;
+#endif
+
 #ifdef TEXTURED
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = TEXTURECOORDINATES_ATTRIBUTE_LOCATION) in mediump vec2 textureCoordinates;
@@ -50,10 +93,37 @@ out mediump vec2 interpolatedTextureCoordinates;
 #endif
 
 void main() {
-    gl_Position = transformationProjectionMatrix*position;
+    #ifdef SKINNING
+    /* Blend the joint matrices, if needed */
+    highp vec4 skinnedPosition = (
+        weights.x*jointMatrices[jointIds.x] +
+        weights.y*jointMatrices[jointIds.y] +
+        weights.z*jointMatrices[jointIds.z] +
+        weights.w*jointMatrices[jointIds.w])*position;
+    #else
+    highp vec4 skinnedPosition = position;
+    #endif
+
+    #ifdef INSTANCED_TRANSFORMATION
+    gl_Position = transformationProjectionMatrix*instancedTransformationMatrix*skinnedPosition;
+    #else
+    gl_Position = transformationProjectionMatrix*skinnedPosition;
+    #endif
+
+    #ifdef LAYER_COUNT
+    /* Consecutive instances go to consecutive layers */
+    highp int layer = gl_InstanceID % LAYER_COUNT;
+    gl_Layer = layer;
+    gl_Position = viewProjectionMatrices[layer]*gl_Position;
+    #endif
 
     #ifdef TEXTURED
     /* Texture coordinates, if needed */
     interpolatedTextureCoordinates = textureCoordinates;
     #endif
+
+    #ifdef INSTANCED_COLOR
+    /* Per-instance color, if needed */
+    interpolatedInstancedColor = instancedColor;
+    #endif
 }
@@ -0,0 +1,59 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GBuffer.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Shaders/DeferredGeometry.h"
+
+namespace Magnum { namespace Shaders {
+
+GBuffer::GBuffer(const Vector2i& size): _size{size}, _framebuffer{Range2Di{{}, size}} {
+    /* The lighting pass fetches exactly one texel per pixel, no filtering
+       or mipmaps needed */
+    for(Texture2D* texture: {&_albedo, &_normal, &_depth})
+        texture->setMinificationFilter(Sampler::Filter::Nearest)
+            .setMagnificationFilter(Sampler::Filter::Nearest)
+            .setWrapping(Sampler::Wrapping::ClampToEdge);
+    _albedo.setStorage(1, TextureFormat::RGBA8, size);
+    _normal.setStorage(1, TextureFormat::RGB10A2, size);
+    _depth.setStorage(1, TextureFormat::DepthComponent24, size);
+
+    _framebuffer.attachTexture(Framebuffer::ColorAttachment{0}, _albedo, 0)
+        .attachTexture(Framebuffer::ColorAttachment{1}, _normal, 0)
+        .attachTexture(Framebuffer::BufferAttachment::Depth, _depth, 0)
+        .mapForDraw({{DeferredGeometry::AlbedoOutput, Framebuffer::ColorAttachment{0}},
+                     {DeferredGeometry::NormalOutput, Framebuffer::ColorAttachment{1}}});
+}
+
+GBuffer& GBuffer::bindForWriting() {
+    _framebuffer.clear(FramebufferClear::Color|FramebufferClear::Depth)
+        .bind(FramebufferTarget::Draw);
+    return *this;
+}
+
+}}
+#endif
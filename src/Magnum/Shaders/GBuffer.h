@@ -0,0 +1,111 @@
+#ifndef Magnum_Shaders_GBuffer_h
+#define Magnum_Shaders_GBuffer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::GBuffer
+ */
+
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Texture.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Geometry buffer for deferred shading
+
+Framebuffer with textures filled by @ref DeferredGeometry and read by
+@ref DeferredLighting. Surface properties are packed into two color
+attachments:
+
+-   @ref albedoTexture() in @ref TextureFormat::RGBA8 contains diffuse color
+    in RGB and specular intensity in alpha
+-   @ref normalTexture() in @ref TextureFormat::RGB10A2 contains
+    octahedron-encoded view-space normal in RG, logarithmically encoded
+    shininess in B and `1.0` in alpha for pixels covered by geometry
+
+The @ref depthTexture() in @ref TextureFormat::DepthComponent24 is used to
+reconstruct view-space position of each pixel, so no position attachment is
+needed. The lighting pass then costs the same regardless of how many draws
+filled the buffer.
+
+See @ref DeferredLighting for a complete example.
+@requires_gl30 Extension @extension{ARB,framebuffer_object}
+@requires_gles30 Multiple render targets are not available in OpenGL ES 2.0.
+*/
+class MAGNUM_SHADERS_EXPORT GBuffer {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Size of all attachments
+         */
+        explicit GBuffer(const Vector2i& size);
+
+        /** @brief Size of all attachments */
+        Vector2i size() const { return _size; }
+
+        /** @brief Diffuse color and specular intensity texture */
+        Texture2D& albedoTexture() { return _albedo; }
+
+        /** @brief Normal and shininess texture */
+        Texture2D& normalTexture() { return _normal; }
+
+        /** @brief Depth texture */
+        Texture2D& depthTexture() { return _depth; }
+
+        /**
+         * @brief Framebuffer
+         *
+         * Color outputs @ref DeferredGeometry::AlbedoOutput and
+         * @ref DeferredGeometry::NormalOutput are mapped to
+         * @ref albedoTexture() and @ref normalTexture(), respectively.
+         * @see @ref bindForWriting()
+         */
+        Framebuffer& framebuffer() { return _framebuffer; }
+
+        /**
+         * @brief Bind for writing
+         * @return Reference to self (for method chaining)
+         *
+         * Clears all attachments and binds the framebuffer for drawing.
+         */
+        GBuffer& bindForWriting();
+
+    private:
+        Vector2i _size;
+        Texture2D _albedo, _normal, _depth;
+        Framebuffer _framebuffer;
+};
+
+}}
+#else
+#error this header is not available on OpenGL ES 2.0 build
+#endif
+
+#endif
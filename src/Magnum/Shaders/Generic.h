@@ -26,10 +26,14 @@
 */
 
 /** @file
- * @brief Struct @ref Magnum::Shaders::Generic, typedef @ref Magnum::Shaders::Generic2D, @ref Magnum::Shaders::Generic3D
+ * @brief Struct @ref Magnum::Shaders::Generic, class @ref Magnum::Shaders::TransformationProjectionUniform, typedef @ref Magnum::Shaders::Generic2D, @ref Magnum::Shaders::Generic3D, @ref Magnum::Shaders::TransformationProjectionUniform2D, @ref Magnum::Shaders::TransformationProjectionUniform3D
  */
 
 #include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Color.h"
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
 
 namespace Magnum { namespace Shaders {
 
@@ -66,6 +70,98 @@ template<UnsignedInt dimensions> struct Generic {
      * @ref Vector3, defined only in 3D.
      */
     typedef Attribute<2, Vector3> Normal;
+
+    /**
+     * @brief Per-instance color
+     *
+     * @ref Color4. Used by shaders with instanced color enabled, the mesh
+     * is expected to supply it via @ref Mesh::addVertexBufferInstanced().
+     * @requires_gles30 Instanced attributes are not available in OpenGL ES
+     *      2.0.
+     */
+    typedef Attribute<3, Color4> Color;
+
+    /**
+     * @brief Per-instance transformation matrix
+     *
+     * @ref Matrix3 in 2D and @ref Matrix4 in 3D, occupying three or four
+     * consecutive locations. Used by shaders with instanced transformation
+     * enabled, the mesh is expected to supply it via
+     * @ref Mesh::addVertexBufferInstanced().
+     * @requires_gles30 Instanced attributes are not available in OpenGL ES
+     *      2.0.
+     */
+    typedef Attribute<4, T> TransformationMatrix;
+
+    /**
+     * @brief Per-instance normal matrix
+     *
+     * @ref Matrix3x3, occupying three consecutive locations, defined only in
+     * 3D. Used by shaders with instanced transformation enabled.
+     * @requires_gles30 Instanced attributes are not available in OpenGL ES
+     *      2.0.
+     */
+    typedef Attribute<8, Matrix3x3> NormalMatrix;
+
+    /**
+     * @brief Joint IDs
+     *
+     * @ref Vector4ui, indices of up to four joints affecting the vertex
+     * into the joint matrix palette. Used by shaders with skinning enabled.
+     * @requires_gl30 Extension @extension{EXT,gpu_shader4}
+     * @requires_gles30 Integer attributes are not available in OpenGL ES
+     *      2.0.
+     */
+    typedef Attribute<11, Vector4ui> JointIds;
+
+    /**
+     * @brief Joint weights
+     *
+     * @ref Vector4, weight of each joint in @ref JointIds. The weights are
+     * expected to sum up to `1.0f`, unused joints should have zero weight.
+     * Used by shaders with skinning enabled.
+     * @requires_gles30 Skinning is not available in OpenGL ES 2.0.
+     */
+    typedef Attribute<12, Vector4> Weights;
+
+    /**
+     * @brief Texture array layer
+     *
+     * @ref Float, layer of a texture array to sample from, either
+     * per-vertex or per-instance. Used by shaders with texture arrays
+     * enabled.
+     * @requires_gles30 Texture arrays are not available in OpenGL ES 2.0.
+     */
+    typedef Attribute<13, Float> TextureLayer;
+
+    enum: UnsignedInt {
+        /**
+         * Uniform buffer binding point of the `Transformation` block, used
+         * by shaders created with uniform buffers enabled.
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         */
+        TransformationBufferBinding = 0,
+
+        /**
+         * Uniform buffer binding point of the `Material` block, used by
+         * shaders created with uniform buffers enabled.
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         */
+        MaterialBufferBinding = 1,
+
+        /**
+         * Uniform buffer binding point of the `Joints` block with joint
+         * matrix palette, used by shaders created with skinning enabled.
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         */
+        JointBufferBinding = 2
+    };
 };
 #endif
 
@@ -78,18 +174,93 @@ typedef Generic<3> Generic3D;
 #ifndef DOXYGEN_GENERATING_OUTPUT
 struct BaseGeneric {
     typedef Attribute<1, Vector2> TextureCoordinates;
+
+    #ifndef MAGNUM_TARGET_GLES2
+    typedef Attribute<3, Color4> Color;
+    typedef Attribute<11, Vector4ui> JointIds;
+    typedef Attribute<12, Vector4> Weights;
+    typedef Attribute<13, Float> TextureLayer;
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES2
+    enum: UnsignedInt {
+        TransformationBufferBinding = 0,
+        MaterialBufferBinding = 1,
+        JointBufferBinding = 2
+    };
+    #endif
 };
 
 template<> struct Generic<2>: BaseGeneric {
     typedef Attribute<0, Vector2> Position;
+
+    #ifndef MAGNUM_TARGET_GLES2
+    typedef Attribute<4, Matrix3> TransformationMatrix;
+    #endif
 };
 
 template<> struct Generic<3>: BaseGeneric {
     typedef Attribute<0, Vector3> Position;
     typedef Attribute<2, Vector3> Normal;
+
+    #ifndef MAGNUM_TARGET_GLES2
+    typedef Attribute<4, Matrix4> TransformationMatrix;
+    typedef Attribute<8, Matrix3x3> NormalMatrix;
+    #endif
 };
 #endif
 
+#ifndef MAGNUM_TARGET_GLES2
+/**
+@brief Transformation and projection uniform block
+
+Data of the `Transformation` uniform block used by @ref Flat and
+@ref VertexColor created with uniform buffers enabled. The stored matrix is
+padded to match `std140` layout rules, so an array of these can be uploaded
+directly into a @ref Buffer and each draw then only binds different range of
+it. Note that the stride between consecutive blocks needs to be a multiple of
+@ref Buffer::uniformOffsetAlignment().
+@see @ref TransformationProjectionUniform2D,
+    @ref TransformationProjectionUniform3D
+@requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+@requires_gles30 Uniform buffers are not available in OpenGL ES 2.0.
+*/
+template<UnsignedInt dimensions> class TransformationProjectionUniform {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * The matrix is set to identity.
+         */
+        /*implicit*/ TransformationProjectionUniform() {
+            setTransformationProjectionMatrix({});
+        }
+
+        /**
+         * @brief Set transformation and projection matrix
+         * @return Reference to self (for method chaining)
+         */
+        TransformationProjectionUniform<dimensions>& setTransformationProjectionMatrix(const MatrixTypeFor<dimensions, Float>& matrix);
+
+    private:
+        /* std140 layout of mat3 is three vec4 columns */
+        Math::RectangularMatrix<dimensions + 1, 4, Float> _transformationProjectionMatrix;
+};
+
+/** @brief 2D transformation and projection uniform block */
+typedef TransformationProjectionUniform<2> TransformationProjectionUniform2D;
+
+/** @brief 3D transformation and projection uniform block */
+typedef TransformationProjectionUniform<3> TransformationProjectionUniform3D;
+
+template<UnsignedInt dimensions> inline TransformationProjectionUniform<dimensions>& TransformationProjectionUniform<dimensions>::setTransformationProjectionMatrix(const MatrixTypeFor<dimensions, Float>& matrix) {
+    for(std::size_t i = 0; i != dimensions + 1; ++i)
+        for(std::size_t j = 0; j != 4; ++j)
+            _transformationProjectionMatrix[i][j] = j < dimensions + 1 ? matrix[i][j] : 0.0f;
+    return *this;
+}
+#endif
+
 }}
 
 #endif
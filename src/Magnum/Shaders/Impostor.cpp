@@ -0,0 +1,237 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Impostor.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/Shader.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Shaders/DeferredGeometry.h"
+
+#include "Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    typedef Attribute<0, Vector4> PositionRadius;
+    typedef Attribute<1, Float> View;
+
+    enum: Int {
+        AlbedoTextureLayer = 0,
+        NormalTextureLayer = 1
+    };
+
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr Version ShaderVersion = Version::GL300;
+    #else
+    constexpr Version ShaderVersion = Version::GLES300;
+    #endif
+}
+
+class Impostor::DrawShader: public AbstractShaderProgram {
+    public:
+        explicit DrawShader() {
+            Utility::Resource rs("MagnumShaders");
+
+            Shader vert = Implementation::createCompatibilityShader(rs, ShaderVersion, Shader::Type::Vertex);
+            Shader frag = Implementation::createCompatibilityShader(rs, ShaderVersion, Shader::Type::Fragment);
+            vert.addSource(rs.get("Impostor.vert"));
+            frag.addSource(rs.get("Impostor.frag"));
+            CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+
+            attachShaders({vert, frag});
+            bindAttributeLocation(PositionRadius::Location, "positionRadius");
+            bindAttributeLocation(View::Location, "view");
+            CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+            projectionMatrixUniform = uniformLocation("projectionMatrix");
+            lightDirectionUniform = uniformLocation("lightDirection");
+            lightColorUniform = uniformLocation("lightColor");
+            ambientColorUniform = uniformLocation("ambientColor");
+
+            setUniform(uniformLocation("albedoTexture"), AlbedoTextureLayer);
+            setUniform(uniformLocation("normalTexture"), NormalTextureLayer);
+        }
+
+        DrawShader& setProjectionMatrix(const Matrix4& matrix) {
+            setUniform(projectionMatrixUniform, matrix);
+            return *this;
+        }
+
+        DrawShader& setLight(const Vector3& direction, const Color3& color, const Color3& ambientColor) {
+            setUniform(lightDirectionUniform, direction);
+            setUniform(lightColorUniform, color);
+            setUniform(ambientColorUniform, ambientColor);
+            return *this;
+        }
+
+    private:
+        Int projectionMatrixUniform,
+            lightDirectionUniform,
+            lightColorUniform,
+            ambientColorUniform;
+};
+
+Impostor::Impostor(const Vector2i& viewSize, const UnsignedInt viewCount): _viewSize{viewSize}, _radius{1.0f}, _distance{100.0f}, _lightDirection{0.0f, 0.0f, 1.0f}, _lightColor{1.0f}, _ambientColor{0.0f} {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::EXT::texture_array);
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::instanced_arrays);
+    #else
+    MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GLES300);
+    #endif
+    CORRADE_ASSERT(viewCount, "Shaders::Impostor: view count can't be zero", );
+
+    /* Same layout as GBuffer, so the views can be captured with
+       DeferredGeometry */
+    for(Texture2DArray* texture: {&_albedo, &_normal})
+        texture->setMinificationFilter(Sampler::Filter::Linear)
+            .setMagnificationFilter(Sampler::Filter::Linear)
+            .setWrapping(Sampler::Wrapping::ClampToEdge);
+    _albedo.setStorage(1, TextureFormat::RGBA8, {viewSize, Int(viewCount)});
+    _normal.setStorage(1, TextureFormat::RGB10A2, {viewSize, Int(viewCount)});
+
+    /* Depth is needed only while capturing a view, so it's shared by all of
+       them */
+    _depth.setStorage(RenderbufferFormat::DepthComponent24, viewSize);
+
+    _framebuffers.reserve(viewCount);
+    for(UnsignedInt i = 0; i != viewCount; ++i) {
+        _framebuffers.emplace_back(Range2Di{{}, viewSize});
+        _framebuffers.back().attachTextureLayer(Framebuffer::ColorAttachment{0}, _albedo, 0, i)
+            .attachTextureLayer(Framebuffer::ColorAttachment{1}, _normal, 0, i)
+            .attachRenderbuffer(Framebuffer::BufferAttachment::Depth, _depth)
+            .mapForDraw({{DeferredGeometry::AlbedoOutput, Framebuffer::ColorAttachment{0}},
+                         {DeferredGeometry::NormalOutput, Framebuffer::ColorAttachment{1}}});
+    }
+
+    /* Quad corners are generated from gl_VertexID in the shader, so the
+       only attributes are the per-instance data */
+    _mesh.setPrimitive(MeshPrimitive::TriangleStrip)
+        .setCount(4)
+        .setInstanceCount(0)
+        .addVertexBufferInstanced(_instanceBuffer, 1, 0, PositionRadius{}, View{});
+
+    _shader.reset(new DrawShader);
+}
+
+Impostor::Impostor(Impostor&&) noexcept = default;
+
+Impostor::~Impostor() = default;
+
+Impostor& Impostor::operator=(Impostor&&) noexcept = default;
+
+Impostor& Impostor::setBoundingSphere(const Vector3& center, const Float radius) {
+    CORRADE_ASSERT(radius > 0.0f,
+        "Shaders::Impostor::setBoundingSphere(): expected positive radius, got" << radius, *this);
+    _center = center;
+    _radius = radius;
+    return *this;
+}
+
+Vector3 Impostor::viewDirection(const UnsignedInt view) const {
+    CORRADE_ASSERT(view < _framebuffers.size(),
+        "Shaders::Impostor::viewDirection(): index" << view << "out of range for" << _framebuffers.size() << "views", {});
+    const Rad angle = Rad(Constants::tau())*Float(view)/Float(_framebuffers.size());
+    return {Math::sin(angle), 0.0f, Math::cos(angle)};
+}
+
+Matrix4 Impostor::viewMatrix(const UnsignedInt view) const {
+    CORRADE_ASSERT(view < _framebuffers.size(),
+        "Shaders::Impostor::viewMatrix(): index" << view << "out of range for" << _framebuffers.size() << "views", {});
+
+    /* Rotate the view direction to +Z and move the sphere in front of the
+       camera */
+    const Rad angle = Rad(Constants::tau())*Float(view)/Float(_framebuffers.size());
+    return Matrix4::translation(Vector3::zAxis(-2.0f*_radius))*
+        Matrix4::rotationY(-angle)*
+        Matrix4::translation(-_center);
+}
+
+Matrix4 Impostor::projectionMatrix() const {
+    return Matrix4::orthographicProjection(Vector2{2.0f*_radius}, _radius, 3.0f*_radius);
+}
+
+Framebuffer& Impostor::framebuffer(const UnsignedInt view) {
+    CORRADE_ASSERT(view < _framebuffers.size(),
+        "Shaders::Impostor::framebuffer(): index" << view << "out of range for" << _framebuffers.size() << "views", _framebuffers.front());
+    return _framebuffers[view];
+}
+
+Impostor& Impostor::bindView(const UnsignedInt view) {
+    CORRADE_ASSERT(view < _framebuffers.size(),
+        "Shaders::Impostor::bindView(): index" << view << "out of range for" << _framebuffers.size() << "views", *this);
+
+    /* Zero alpha in the normal texture marks texels not covered by the
+       object */
+    _framebuffers[view].clear(FramebufferClear::Color|FramebufferClear::Depth)
+        .bind(FramebufferTarget::Draw);
+    return *this;
+}
+
+bool Impostor::isImpostor(const Matrix4& transformationMatrix) const {
+    return transformationMatrix.transformPoint(_center).dot() >= _distance*_distance;
+}
+
+Impostor& Impostor::add(const Matrix4& transformationMatrix) {
+    const Vector3 position = transformationMatrix.transformPoint(_center);
+
+    /* The transformation has only rotation and uniform scaling, so its
+       inverse is proportional to its transpose. Direction to the camera in
+       object space thus doesn't need the full inverse. */
+    const Vector3 direction = transformationMatrix.rotationScaling().transposed()*-position;
+    const Float viewCount = _framebuffers.size();
+    Float view = Math::round(Float(std::atan2(direction.x(), direction.z()))*viewCount/Constants::tau());
+    if(view < 0.0f) view += viewCount;
+    if(view >= viewCount) view -= viewCount;
+
+    _instances.push_back({position, _radius*transformationMatrix.uniformScaling(), view});
+    return *this;
+}
+
+void Impostor::draw(const Matrix4& projectionMatrix) {
+    if(_instances.empty()) return;
+
+    _instanceBuffer.setData(_instances, BufferUsage::StreamDraw);
+    _mesh.setInstanceCount(_instances.size());
+
+    _albedo.bind(AlbedoTextureLayer);
+    _normal.bind(NormalTextureLayer);
+    _shader->setProjectionMatrix(projectionMatrix)
+        .setLight(_lightDirection, _lightColor, _ambientColor);
+    _mesh.draw(*_shader);
+
+    _instances.clear();
+}
+
+}}
+#endif
@@ -0,0 +1,57 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+uniform lowp sampler2DArray albedoTexture;
+uniform mediump sampler2DArray normalTexture;
+
+uniform mediump vec3 lightDirection;
+uniform lowp vec3 lightColor;
+uniform lowp vec3 ambientColor;
+
+in mediump vec3 textureCoordinates;
+
+out lowp vec4 color;
+
+/* Octahedron normal decoding, matches DeferredGeometry.frag */
+mediump vec2 signNotZero(mediump vec2 v) {
+    return vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+}
+
+mediump vec3 decodeNormal(mediump vec2 e) {
+    e = e*2.0 - 1.0;
+    mediump vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if(n.z < 0.0) n.xy = (1.0 - abs(n.yx))*signNotZero(n.xy);
+    return normalize(n);
+}
+
+void main() {
+    /* Texels not covered by the object have zero alpha */
+    mediump vec4 normalCoverage = texture(normalTexture, textureCoordinates);
+    if(normalCoverage.a < 0.5) discard;
+
+    lowp vec3 albedo = texture(albedoTexture, textureCoordinates).rgb;
+    mediump vec3 normal = decodeNormal(normalCoverage.xy);
+    color = vec4(albedo*(ambientColor + lightColor*max(dot(normal, lightDirection), 0.0)), 1.0);
+}
@@ -0,0 +1,349 @@
+#ifndef Magnum_Shaders_Impostor_h
+#define Magnum_Shaders_Impostor_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::Impostor
+ */
+
+#include <memory>
+#include <vector>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Color.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/TextureArray.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Billboard impostors for distant objects
+
+Replaces distant instances of one object with camera-facing quads textured
+with pre-rendered views of the object, all drawn in a single instanced draw
+call.
+
+## Capturing the views
+
+The object is rendered from @ref viewCount() directions evenly spaced around
+the Y axis into layers of two texture arrays, @ref albedoTexture() and
+@ref normalTexture(), with the same layout as in @ref GBuffer. Set the
+bounding sphere of the object, then for each view bind its framebuffer and
+draw the object with @ref DeferredGeometry using @ref viewMatrix() and
+@ref projectionMatrix():
+@code
+Shaders::Impostor impostor{{128, 128}, 8};
+impostor.setBoundingSphere({0.0f, 4.0f, 0.0f}, 5.0f);
+
+Shaders::DeferredGeometry geometry{Shaders::DeferredGeometry::Flag::DiffuseTexture};
+geometry.setDiffuseTexture(barkTexture)
+    .setProjectionMatrix(impostor.projectionMatrix());
+for(UnsignedInt i = 0; i != impostor.viewCount(); ++i) {
+    impostor.bindView(i);
+    geometry.setTransformationMatrix(impostor.viewMatrix(i))
+        .setNormalMatrix(impostor.viewMatrix(i).rotationScaling());
+    treeMesh.draw(geometry);
+}
+@endcode
+
+Texels not covered by the object have zero alpha in @ref normalTexture() and
+are discarded when drawing the impostors.
+
+## Drawing
+
+The drawables decide whether to draw the full mesh or the impostor while
+being culled and drawn by the camera, based on distance of the object from
+the camera. The impostor instances are collected with @ref add() and drawn
+all at once after the scene:
+@code
+void Tree::draw(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) {
+    if(_impostor.isImpostor(transformationMatrix)) {
+        _impostor.add(transformationMatrix);
+        return;
+    }
+
+    // draw the full tree mesh ...
+}
+
+// Each frame
+impostor.setDistance(150.0f);
+camera.draw(drawables);
+impostor.draw(camera.projectionMatrix());
+@endcode
+
+Each instance picks the view which was captured from the direction nearest
+to the current direction from the object to the camera. The objects are
+expected to have only rotation around the Y axis and uniform scaling in
+their transformation, e.g. trees or buildings on a terrain. The impostor is
+lit by a single directional light, using the captured normal as if the view
+was facing the camera exactly.
+
+@requires_gl30 Extension @extension{EXT,texture_array}
+@requires_gl33 Extension @extension{ARB,instanced_arrays}
+@requires_gles30 Texture arrays and instancing are not available in OpenGL
+    ES 2.0.
+@see @ref SceneGraph::LodDrawable
+*/
+class MAGNUM_SHADERS_EXPORT Impostor {
+    public:
+        /**
+         * @brief Impostor instance
+         *
+         * Layout of one instance in GPU memory.
+         * @see @ref add()
+         */
+        struct Instance {
+            Vector3 position;   /**< @brief Bounding sphere center in camera space */
+            Float radius;       /**< @brief Bounding sphere radius in camera space */
+            Float view;         /**< @brief View layer */
+        };
+
+        /**
+         * @brief Constructor
+         * @param viewSize      Size of each view
+         * @param viewCount     Count of captured views around the Y axis
+         *
+         * Allocates the texture arrays with @p viewCount layers. Expects
+         * that @p viewCount is not zero.
+         */
+        explicit Impostor(const Vector2i& viewSize, UnsignedInt viewCount = 8);
+
+        /** @brief Copying is not allowed */
+        Impostor(const Impostor&) = delete;
+
+        /** @brief Move constructor */
+        Impostor(Impostor&&) noexcept;
+
+        ~Impostor();
+
+        /** @brief Copying is not allowed */
+        Impostor& operator=(const Impostor&) = delete;
+
+        /** @brief Move assignment */
+        Impostor& operator=(Impostor&&) noexcept;
+
+        /** @brief Size of each view */
+        Vector2i viewSize() const { return _viewSize; }
+
+        /** @brief Count of captured views */
+        UnsignedInt viewCount() const { return _framebuffers.size(); }
+
+        /** @brief Albedo texture array */
+        Texture2DArray& albedoTexture() { return _albedo; }
+
+        /** @brief Normal texture array */
+        Texture2DArray& normalTexture() { return _normal; }
+
+        /** @brief Bounding sphere center */
+        Vector3 boundingSphereCenter() const { return _center; }
+
+        /** @brief Bounding sphere radius */
+        Float boundingSphereRadius() const { return _radius; }
+
+        /**
+         * @brief Set bounding sphere of the object
+         * @return Reference to self (for method chaining)
+         *
+         * The views are centered on the bounding sphere and the impostor
+         * quads cover it. Default is a unit sphere at origin.
+         */
+        Impostor& setBoundingSphere(const Vector3& center, Float radius);
+
+        /**
+         * @brief View direction
+         *
+         * Unit direction from the bounding sphere center to the capturing
+         * camera for given view. View `0` looks from the +Z direction, the
+         * following views continue counterclockwise around the Y axis.
+         */
+        Vector3 viewDirection(UnsignedInt view) const;
+
+        /**
+         * @brief View matrix
+         *
+         * Transformation of the object relative to the capturing camera for
+         * given view, i.e. the object transformation matrix for capturing.
+         */
+        Matrix4 viewMatrix(UnsignedInt view) const;
+
+        /**
+         * @brief Projection matrix
+         *
+         * Orthographic projection tightly enclosing the bounding sphere.
+         */
+        Matrix4 projectionMatrix() const;
+
+        /**
+         * @brief Framebuffer for rendering into given view
+         *
+         * @see @ref bindView()
+         */
+        Framebuffer& framebuffer(UnsignedInt view);
+
+        /**
+         * @brief Bind given view for rendering
+         * @return Reference to self (for method chaining)
+         *
+         * Clears color and depth of given view layer and binds its
+         * framebuffer for drawing. Color outputs are mapped to
+         * @ref DeferredGeometry::AlbedoOutput and
+         * @ref DeferredGeometry::NormalOutput.
+         */
+        Impostor& bindView(UnsignedInt view);
+
+        /** @brief Impostor distance */
+        Float distance() const { return _distance; }
+
+        /**
+         * @brief Set impostor distance
+         * @return Reference to self (for method chaining)
+         *
+         * Objects with bounding sphere center at least this far from the
+         * camera are drawn as impostors. Default is `100.0f`.
+         * @see @ref isImpostor()
+         */
+        Impostor& setDistance(Float distance) {
+            _distance = distance;
+            return *this;
+        }
+
+        /**
+         * @brief Whether given object should be drawn as impostor
+         * @param transformationMatrix  Object transformation relative to
+         *      camera
+         */
+        bool isImpostor(const Matrix4& transformationMatrix) const;
+
+        /** @brief Light direction */
+        Vector3 lightDirection() const { return _lightDirection; }
+
+        /**
+         * @brief Set light direction
+         * @return Reference to self (for method chaining)
+         *
+         * Direction towards the light in camera space, expected to be
+         * normalized. Default is `{0.0f, 0.0f, 1.0f}`, i.e. light coming
+         * from the camera.
+         */
+        Impostor& setLightDirection(const Vector3& direction) {
+            _lightDirection = direction;
+            return *this;
+        }
+
+        /** @brief Light color */
+        Color3 lightColor() const { return _lightColor; }
+
+        /**
+         * @brief Set light color
+         * @return Reference to self (for method chaining)
+         *
+         * Default is `{1.0f, 1.0f, 1.0f}`.
+         */
+        Impostor& setLightColor(const Color3& color) {
+            _lightColor = color;
+            return *this;
+        }
+
+        /** @brief Ambient color */
+        Color3 ambientColor() const { return _ambientColor; }
+
+        /**
+         * @brief Set ambient color
+         * @return Reference to self (for method chaining)
+         *
+         * Default is `{0.0f, 0.0f, 0.0f}`.
+         */
+        Impostor& setAmbientColor(const Color3& color) {
+            _ambientColor = color;
+            return *this;
+        }
+
+        /** @brief Count of instances added since last @ref draw() */
+        std::size_t size() const { return _instances.size(); }
+
+        /** @brief Instances added since last @ref draw() */
+        const std::vector<Instance>& instances() const { return _instances; }
+
+        /**
+         * @brief Add an impostor instance
+         * @param transformationMatrix  Object transformation relative to
+         *      camera
+         * @return Reference to self (for method chaining)
+         *
+         * Selects the view nearest to direction from the object to the
+         * camera.
+         */
+        Impostor& add(const Matrix4& transformationMatrix);
+
+        /**
+         * @brief Draw the impostors
+         * @param projectionMatrix      Camera projection matrix
+         *
+         * Uploads all instances added since last call, draws them in a
+         * single instanced draw call and clears the instance list. Does
+         * nothing if there are no instances.
+         */
+        void draw(const Matrix4& projectionMatrix);
+
+        /**
+         * @brief Clear the instances
+         *
+         * Discards all instances added since last @ref draw(). Called
+         * implicitly from @ref draw().
+         */
+        void clear() { _instances.clear(); }
+
+    private:
+        class DrawShader;
+
+        Vector2i _viewSize;
+        Texture2DArray _albedo, _normal;
+        Renderbuffer _depth;
+        std::vector<Framebuffer> _framebuffers;
+
+        Vector3 _center;
+        Float _radius, _distance;
+        Vector3 _lightDirection;
+        Color3 _lightColor, _ambientColor;
+
+        std::vector<Instance> _instances;
+        Buffer _instanceBuffer;
+        Mesh _mesh;
+        std::unique_ptr<DrawShader> _shader;
+};
+
+}}
+#else
+#error this header is not available on OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -0,0 +1,42 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+uniform highp mat4 projectionMatrix;
+
+in highp vec4 positionRadius;
+in highp float view;
+
+out mediump vec3 textureCoordinates;
+
+void main() {
+    /* Quad corner from vertex ID, drawn as a four-vertex triangle strip */
+    mediump vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+    textureCoordinates = vec3(corner, view);
+
+    /* The quad is expanded in view space so it always faces the camera */
+    highp vec3 viewPosition = positionRadius.xyz;
+    viewPosition.xy += (corner*2.0 - vec2(1.0))*positionRadius.w;
+    gl_Position = projectionMatrix*vec4(viewPosition, 1.0);
+}
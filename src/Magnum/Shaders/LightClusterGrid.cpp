@@ -0,0 +1,173 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "LightClusterGrid.h"
+
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/TaskScheduler.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    /* Squared distance of a point to an axis-aligned box */
+    Float distanceSquared(const Range3D& box, const Vector3& point) {
+        const Vector3 d = Math::max(Math::max(box.min() - point, point - box.max()), Vector3{0.0f});
+        return Math::dot(d, d);
+    }
+
+    struct ThreadResult {
+        std::vector<Vector2ui> clusters;
+        std::vector<UnsignedInt> lightIndices;
+    };
+
+    void cullRange(const Vector3ui& clusterCount, const std::vector<Range3D>& bounds, const std::vector<LightClusterGrid::Light>& lights, ThreadResult& out, const UnsignedInt zBegin, const UnsignedInt zEnd) {
+        const std::size_t sliceSize = clusterCount.x()*clusterCount.y();
+        std::vector<UnsignedInt> candidates;
+        for(UnsignedInt z = zBegin; z != zEnd; ++z) {
+            /* Skip lights not touching the depth slice at all */
+            const Float sliceNear = -bounds[z*sliceSize].max().z();
+            const Float sliceFar = -bounds[z*sliceSize].min().z();
+            candidates.clear();
+            for(std::size_t i = 0; i != lights.size(); ++i) {
+                const Float depth = -lights[i].position.z();
+                if(depth + lights[i].range >= sliceNear && depth - lights[i].range <= sliceFar)
+                    candidates.push_back(i);
+            }
+
+            for(std::size_t i = z*sliceSize, end = (z + 1)*sliceSize; i != end; ++i) {
+                const UnsignedInt offset = out.lightIndices.size();
+                for(const UnsignedInt candidate: candidates) {
+                    const LightClusterGrid::Light& light = lights[candidate];
+                    if(distanceSquared(bounds[i], light.position) <= light.range*light.range)
+                        out.lightIndices.push_back(candidate);
+                }
+                out.clusters.emplace_back(offset, out.lightIndices.size() - offset);
+            }
+        }
+    }
+}
+
+LightClusterGrid::LightClusterGrid(const Vector3ui& clusterCount): _clusterCount{clusterCount}, _near{}, _far{} {
+    CORRADE_ASSERT(clusterCount.product(),
+        "Shaders::LightClusterGrid: expected non-zero cluster count", );
+}
+
+LightClusterGrid& LightClusterGrid::setProjection(const Matrix4& projection, const Float near, const Float far) {
+    CORRADE_ASSERT(near > 0.0f && near < far,
+        "Shaders::LightClusterGrid::setProjection(): expected 0 < near < far but got" << near << "and" << far, *this);
+
+    _near = near;
+    _far = far;
+
+    /* Direction of the rays through the corners of all tiles, scaled to have
+       unit depth */
+    const Matrix4 inverted = projection.inverted();
+    std::vector<Vector3> rays;
+    rays.reserve((_clusterCount.x() + 1)*(_clusterCount.y() + 1));
+    for(UnsignedInt y = 0; y <= _clusterCount.y(); ++y) {
+        for(UnsignedInt x = 0; x <= _clusterCount.x(); ++x) {
+            const Vector4 point = inverted*Vector4{
+                -1.0f + 2.0f*x/_clusterCount.x(),
+                -1.0f + 2.0f*y/_clusterCount.y(), -1.0f, 1.0f};
+            const Vector3 ray = point.xyz()/point.w();
+            rays.push_back(ray/-ray.z());
+        }
+    }
+
+    _bounds.clear();
+    _bounds.reserve(_clusterCount.product());
+    const UnsignedInt rowSize = _clusterCount.x() + 1;
+    for(UnsignedInt z = 0; z != _clusterCount.z(); ++z) {
+        const Float sliceNear = near*std::pow(far/near, Float(z)/_clusterCount.z());
+        const Float sliceFar = near*std::pow(far/near, Float(z + 1)/_clusterCount.z());
+        for(UnsignedInt y = 0; y != _clusterCount.y(); ++y) {
+            for(UnsignedInt x = 0; x != _clusterCount.x(); ++x) {
+                const Vector3 corners[]{
+                    rays[y*rowSize + x],
+                    rays[y*rowSize + x + 1],
+                    rays[(y + 1)*rowSize + x],
+                    rays[(y + 1)*rowSize + x + 1]
+                };
+                Vector3 min{Constants::inf()}, max{-Constants::inf()};
+                for(const Vector3& corner: corners) {
+                    for(const Float depth: {sliceNear, sliceFar}) {
+                        min = Math::min(min, corner*depth);
+                        max = Math::max(max, corner*depth);
+                    }
+                }
+                _bounds.emplace_back(min, max);
+            }
+        }
+    }
+
+    return *this;
+}
+
+Range3D LightClusterGrid::clusterBounds(const Vector3ui& cluster) const {
+    CORRADE_ASSERT(!_bounds.empty(),
+        "Shaders::LightClusterGrid::clusterBounds(): no projection set", {});
+    CORRADE_ASSERT((cluster < _clusterCount).all(),
+        "Shaders::LightClusterGrid::clusterBounds(): cluster" << cluster << "out of range for" << _clusterCount << "clusters", {});
+    return _bounds[(cluster.z()*_clusterCount.y() + cluster.y())*_clusterCount.x() + cluster.x()];
+}
+
+void LightClusterGrid::cull(const std::vector<Light>& lights, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(!_bounds.empty(),
+        "Shaders::LightClusterGrid::cull(): no projection set", );
+    CORRADE_ASSERT(threadCount,
+        "Shaders::LightClusterGrid::cull(): expected at least one thread", );
+
+    _lightData.clear();
+    _lightData.reserve(lights.size()*2);
+    for(const Light& light: lights) {
+        _lightData.emplace_back(light.position, light.range);
+        _lightData.emplace_back(light.color, 0.0f);
+    }
+
+    /* Split the depth slices into contiguous ranges, each processed as a
+       separate part on the global scheduler */
+    const UnsignedInt sliceCount = _clusterCount.z();
+    const UnsignedInt chunk = (sliceCount + threadCount - 1)/threadCount;
+    std::vector<ThreadResult> results((sliceCount + chunk - 1)/chunk);
+    TaskScheduler::global().parallelFor(results.size(), 1, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            cullRange(_clusterCount, _bounds, lights, results[i], i*chunk, Math::min((i + 1)*chunk, std::size_t(sliceCount)));
+    });
+
+    /* Concatenate the per-part results, offsetting the light ranges */
+    _clusters.clear();
+    _clusters.reserve(_clusterCount.product());
+    _lightIndices.clear();
+    for(const ThreadResult& result: results) {
+        const UnsignedInt offset = _lightIndices.size();
+        for(const Vector2ui& cluster: result.clusters)
+            _clusters.emplace_back(cluster.x() + offset, cluster.y());
+        _lightIndices.insert(_lightIndices.end(), result.lightIndices.begin(), result.lightIndices.end());
+    }
+}
+
+}}
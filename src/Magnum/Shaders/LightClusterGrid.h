@@ -0,0 +1,173 @@
+#ifndef Magnum_Shaders_LightClusterGrid_h
+#define Magnum_Shaders_LightClusterGrid_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::LightClusterGrid
+ */
+
+#include <vector>
+
+#include "Magnum/Color.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifdef CORRADE_TARGET_WINDOWS /* I so HATE windef.h */
+#undef near
+#undef far
+#endif
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Light cluster grid
+
+Divides the view frustum into a 3D grid of clusters and assigns point lights
+to the clusters they affect. The result is meant to be consumed by
+@ref Phong with @ref Phong::Flag::ClusteredLights enabled, which then for each
+fragment iterates only the lights in its cluster.
+
+The grid is uniformly divided in screen space and exponentially in depth,
+so near clusters are thinner than far ones. All lights are expected to be in
+view space. Example usage:
+@code
+Shaders::LightClusterGrid grid{{16, 9, 24}};
+grid.setProjection(projectionMatrix, 0.1f, 100.0f);
+
+std::vector<Shaders::LightClusterGrid::Light> lights;
+for(const PointLight& light: sceneLights)
+    lights.push_back({cameraMatrix.transformPoint(light.position), light.range, light.color});
+grid.cull(lights, 4);
+
+lightBuffer.setData(grid.lightData(), BufferUsage::StreamDraw);
+clusterBuffer.setData(grid.clusters(), BufferUsage::StreamDraw);
+lightIndexBuffer.setData(grid.lightIndices(), BufferUsage::StreamDraw);
+@endcode
+
+See @ref Phong::setLightClusters() for how to use the data in the shader.
+*/
+class MAGNUM_SHADERS_EXPORT LightClusterGrid {
+    public:
+        /** @brief Point light */
+        struct Light {
+            Vector3 position;   /**< @brief Position in view space */
+            Float range;        /**< @brief Distance at which the light stops affecting anything */
+            Color3 color;       /**< @brief Light color */
+        };
+
+        /**
+         * @brief Constructor
+         * @param clusterCount  Cluster count in X, Y and depth. Expected to
+         *      be non-zero in all dimensions.
+         *
+         * Call @ref setProjection() before @ref cull().
+         */
+        explicit LightClusterGrid(const Vector3ui& clusterCount = {16, 9, 24});
+
+        /** @brief Cluster count */
+        Vector3ui clusterCount() const { return _clusterCount; }
+
+        /** @brief Near plane distance */
+        Float near() const { return _near; }
+
+        /** @brief Far plane distance */
+        Float far() const { return _far; }
+
+        /**
+         * @brief Set projection
+         * @param projection    Perspective projection matrix
+         * @param near          Near plane distance
+         * @param far           Far plane distance
+         * @return Reference to self (for method chaining)
+         *
+         * Computes view-space bounds of all clusters. Needs to be called
+         * again only when the projection changes. Expects that
+         * @f$ 0 < near < far @f$.
+         */
+        LightClusterGrid& setProjection(const Matrix4& projection, Float near, Float far);
+
+        /**
+         * @brief Bounds of given cluster in view space
+         *
+         * Axis-aligned bounding box of the cluster frustum.
+         */
+        Range3D clusterBounds(const Vector3ui& cluster) const;
+
+        /**
+         * @brief Assign lights to clusters
+         * @param lights        Lights in view space
+         * @param threadCount   Count of parts to split the work into
+         *
+         * Replaces the previous result. If @p threadCount is larger than
+         * `1`, the depth slices of the grid are split into equally large
+         * contiguous ranges processed in parallel on
+         * @ref TaskScheduler::global(). Expects that
+         * @ref setProjection() was called and @p threadCount is not zero.
+         */
+        void cull(const std::vector<Light>& lights, UnsignedInt threadCount = 1);
+
+        /**
+         * @brief Light data
+         *
+         * Two items for each light passed to @ref cull(). The first is
+         * view-space position and range, the second is color with unused
+         * alpha. Meant to be uploaded into a buffer texture with
+         * @ref BufferTextureFormat::RGBA32F.
+         */
+        const std::vector<Vector4>& lightData() const { return _lightData; }
+
+        /**
+         * @brief Clusters
+         *
+         * Offset into @ref lightIndices() and light count for each cluster,
+         * clusters are ordered by X first, then Y and depth last. Meant to be
+         * uploaded into a buffer texture with
+         * @ref BufferTextureFormat::RG32UI.
+         */
+        const std::vector<Vector2ui>& clusters() const { return _clusters; }
+
+        /**
+         * @brief Light indices
+         *
+         * Indices of lights affecting each cluster. Meant to be uploaded into
+         * a buffer texture with @ref BufferTextureFormat::R32UI.
+         */
+        const std::vector<UnsignedInt>& lightIndices() const { return _lightIndices; }
+
+    private:
+        Vector3ui _clusterCount;
+        Float _near, _far;
+        std::vector<Range3D> _bounds;
+        std::vector<Vector4> _lightData;
+        std::vector<Vector2ui> _clusters;
+        std::vector<UnsignedInt> _lightIndices;
+};
+
+}}
+
+#endif
@@ -37,6 +37,9 @@
 namespace Magnum { namespace Shaders {
 
 MeshVisualizer::MeshVisualizer(const Flags flags): flags(flags), transformationProjectionMatrixUniform(0), viewportSizeUniform(1), colorUniform(2), wireframeColorUniform(3), wireframeWidthUniform(4), smoothnessUniform(5) {
+    CORRADE_ASSERT(!(flags & Flag::VertexIndexAttribute) || flags & Flag::NoGeometryShader,
+        "Shaders::MeshVisualizer: vertex index attribute can be used only without geometry shader", );
+
     #ifndef MAGNUM_TARGET_GLES
     if(flags & Flag::Wireframe && !(flags & Flag::NoGeometryShader)) {
         MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL320);
@@ -61,6 +64,7 @@ MeshVisualizer::MeshVisualizer(const Flags flags): flags(flags), transformationP
 
     vert.addSource(flags & Flag::Wireframe ? "#define WIREFRAME_RENDERING\n" : "")
         .addSource(flags & Flag::NoGeometryShader ? "#define NO_GEOMETRY_SHADER\n" : "")
+        .addSource(flags & Flag::VertexIndexAttribute ? "#define VERTEX_INDEX_ATTRIBUTE\n" : "")
         #ifdef MAGNUM_TARGET_WEBGL
         .addSource("#define SUBSCRIPTING_WORKAROUND\n")
         #elif defined(MAGNUM_TARGET_GLES2)
@@ -101,7 +105,7 @@ MeshVisualizer::MeshVisualizer(const Flags flags): flags(flags), transformationP
         bindAttributeLocation(Position::Location, "position");
 
         #ifndef MAGNUM_TARGET_GLES
-        if(!Context::current()->isVersionSupported(Version::GL310))
+        if(flags & Flag::VertexIndexAttribute || !Context::current()->isVersionSupported(Version::GL310))
         #endif
         {
             bindAttributeLocation(VertexIndex::Location, "vertexIndex");
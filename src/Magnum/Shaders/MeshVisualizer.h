@@ -128,7 +128,41 @@ mesh.draw(shader);
 
 ### Wireframe visualization of indexed meshes without geometry shader
 
-The vertices must be converted to non-indexed array. Mesh setup:
+@anchor Shaders-MeshVisualizer-indexed-no-geometry-shader
+Converting the mesh to non-indexed one triples the vertex count, which gets
+slow with large meshes. Instead, use @ref MeshTools::generateWireframeVertexIndices()
+to assign a triangle corner to each vertex, duplicating only the few vertices
+that can't be shared, pass the result in the @ref VertexIndex attribute and
+enable @ref Flag::VertexIndexAttribute. This needs to be done only once per
+mesh. Mesh setup:
+@code
+std::vector<UnsignedInt> indices{ ... };
+std::vector<Vector3> positions{ ... };
+
+std::vector<UnsignedInt> vertexMapping;
+std::vector<Float> vertexIndex;
+std::tie(vertexMapping, vertexIndex) = MeshTools::generateWireframeVertexIndices(indices, positions.size());
+
+Buffer vertices, vertexIndices, indexBuffer;
+vertices.setData(MeshTools::duplicate(vertexMapping, positions), BufferUsage::StaticDraw);
+vertexIndices.setData(vertexIndex, BufferUsage::StaticDraw);
+indexBuffer.setData(indices, BufferUsage::StaticDraw);
+
+Mesh mesh;
+mesh.setCount(indices.size())
+    .addVertexBuffer(vertices, 0, Shaders::MeshVisualizer::Position{})
+    .addVertexBuffer(vertexIndices, 0, Shaders::MeshVisualizer::VertexIndex{})
+    .setIndexBuffer(indexBuffer, 0, Mesh::IndexType::UnsignedInt);
+@endcode
+
+Rendering setup:
+@code
+Shaders::MeshVisualizer shader{Shaders::MeshVisualizer::Flag::Wireframe|
+                               Shaders::MeshVisualizer::Flag::NoGeometryShader|
+                               Shaders::MeshVisualizer::Flag::VertexIndexAttribute};
+@endcode
+
+Alternatively, the vertices can be converted to non-indexed array. Mesh setup:
 @code
 std::vector<UnsignedInt> indices{ ... };
 std::vector<Vector3> indexedPositions{ ... };
@@ -141,7 +175,7 @@ Mesh mesh;
 mesh.addVertexBuffer(vertices, 0, Shaders::MeshVisualizer::Position{});
 @endcode
 
-Rendering setup the same as above.
+Rendering setup is the same as for the non-indexed mesh above.
 
 @see @ref shaders
 @todo Understand and add support wireframe width/smoothness without GS
@@ -163,7 +197,7 @@ class MAGNUM_SHADERS_EXPORT MeshVisualizer: public AbstractShaderProgram {
          * specifies index of given vertex in triangle, i.e. `0` for first, `1`
          * for second, `2` for third. In OpenGL 3.1, OpenGL ES 3.0 and newer
          * this value is provided by the shader itself, so the attribute is not
-         * needed.
+         * needed, unless @ref Flag::VertexIndexAttribute is enabled.
          */
         typedef Attribute<3, Float> VertexIndex;
 
@@ -189,7 +223,17 @@ class MAGNUM_SHADERS_EXPORT MeshVisualizer: public AbstractShaderProgram {
              * attribute in the mesh. In OpenGL ES enabled alongside
              * @ref Flag::Wireframe.
              */
-            NoGeometryShader = 1 << 1
+            NoGeometryShader = 1 << 1,
+
+            /**
+             * Always take the triangle corner from the @ref VertexIndex
+             * attribute, even if it could be derived from `gl_VertexID`.
+             * This allows rendering wireframe of indexed meshes without a
+             * geometry shader, see @ref Shaders-MeshVisualizer-indexed-no-geometry-shader
+             * for more information. Expects that @ref Flag::NoGeometryShader
+             * is enabled as well.
+             */
+            VertexIndexAttribute = 1 << 2
         };
 
         /** @brief Flags */
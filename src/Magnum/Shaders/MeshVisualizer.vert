@@ -41,13 +41,15 @@ in highp vec4 position;
 #endif
 
 #if defined(WIREFRAME_RENDERING) && defined(NO_GEOMETRY_SHADER)
-#if (!defined(GL_ES) && __VERSION__ < 140) || (defined(GL_ES) && __VERSION__ < 300)
+#if (!defined(GL_ES) && __VERSION__ < 140) || (defined(GL_ES) && __VERSION__ < 300) || defined(VERTEX_INDEX_ATTRIBUTE)
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = 3) in lowp float vertexIndex;
 #else
 in lowp float vertexIndex;
 #endif
-#define gl_VertexID int(vertexIndex)
+#define VERTEX_CORNER int(vertexIndex)
+#else
+#define VERTEX_CORNER gl_VertexID
 #endif
 
 out vec3 barycentric;
@@ -67,7 +69,7 @@ void main() {
     #elif !defined(NEW_GLSL)
     barycentric[int(mod(vertexIndex, 3.0))] = 1.0;
     #else
-    barycentric[gl_VertexID % 3] = 1.0;
+    barycentric[VERTEX_CORNER % 3] = 1.0;
     #endif
 
     #endif
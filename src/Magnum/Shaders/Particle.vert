@@ -0,0 +1,54 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+uniform highp mat4 transformationMatrix;
+uniform highp mat4 projectionMatrix;
+uniform highp float particleSize;
+
+in highp vec4 positionAge;
+in highp vec4 velocityLifetime;
+
+out mediump vec2 quadPosition;
+out lowp float fade;
+
+void main() {
+    /* Collapse dead particles into a degenerate quad */
+    if(positionAge.w >= velocityLifetime.w) {
+        gl_Position = vec4(0.0);
+        quadPosition = vec2(0.0);
+        fade = 0.0;
+        return;
+    }
+
+    /* Quad corner from vertex ID, drawn as a four-vertex triangle strip */
+    quadPosition = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1))*2.0 - vec2(1.0);
+
+    /* Billboard is expanded in view space so it always faces the camera */
+    highp vec4 viewPosition = transformationMatrix*vec4(positionAge.xyz, 1.0);
+    viewPosition.xy += quadPosition*particleSize*0.5;
+    gl_Position = projectionMatrix*viewPosition;
+
+    fade = 1.0 - positionAge.w/velocityLifetime.w;
+}
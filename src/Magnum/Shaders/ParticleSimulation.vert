@@ -0,0 +1,50 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Particle state is passed through transform feedback, the shader advances
+   each alive particle by one time step */
+
+uniform highp float timeDelta;
+uniform highp vec3 gravity;
+uniform highp float drag;
+
+in highp vec4 positionAge;
+in highp vec4 velocityLifetime;
+
+out highp vec4 outPositionAge;
+out highp vec4 outVelocityLifetime;
+
+void main() {
+    /* Dead particles are passed through unchanged */
+    if(positionAge.w >= velocityLifetime.w) {
+        outPositionAge = positionAge;
+        outVelocityLifetime = velocityLifetime;
+        return;
+    }
+
+    highp vec3 velocity = velocityLifetime.xyz*max(0.0, 1.0 - drag*timeDelta) + gravity*timeDelta;
+    outPositionAge = vec4(positionAge.xyz + velocity*timeDelta, positionAge.w + timeDelta);
+    outVelocityLifetime = vec4(velocity, velocityLifetime.w);
+}
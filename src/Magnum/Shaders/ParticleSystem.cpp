@@ -0,0 +1,236 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ParticleSystem.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/Shader.h"
+#include "Magnum/TransformFeedback.h"
+#include "Magnum/Math/Matrix4.h"
+
+#include "Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    typedef Attribute<0, Vector4> PositionAge;
+    typedef Attribute<1, Vector4> VelocityLifetime;
+
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr Version ShaderVersion = Version::GL300;
+    #else
+    constexpr Version ShaderVersion = Version::GLES300;
+    #endif
+}
+
+class ParticleSystem::SimulationShader: public AbstractShaderProgram {
+    public:
+        explicit SimulationShader() {
+            Utility::Resource rs("MagnumShaders");
+
+            Shader vert = Implementation::createCompatibilityShader(rs, ShaderVersion, Shader::Type::Vertex);
+            vert.addSource(rs.get("ParticleSimulation.vert"));
+
+            #ifndef MAGNUM_TARGET_GLES
+            CORRADE_INTERNAL_ASSERT_OUTPUT(vert.compile());
+            attachShader(vert);
+            #else
+            /* OpenGL ES requires a fragment shader even with rasterization
+               disabled, reuse the empty one */
+            Shader frag = Implementation::createCompatibilityShader(rs, ShaderVersion, Shader::Type::Fragment);
+            frag.addSource(rs.get("Depth.frag"));
+            CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+            attachShaders({vert, frag});
+            #endif
+
+            bindAttributeLocation(PositionAge::Location, "positionAge");
+            bindAttributeLocation(VelocityLifetime::Location, "velocityLifetime");
+            setTransformFeedbackOutputs({"outPositionAge", "outVelocityLifetime"}, TransformFeedbackBufferMode::InterleavedAttributes);
+            CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+            timeDeltaUniform = uniformLocation("timeDelta");
+            gravityUniform = uniformLocation("gravity");
+            dragUniform = uniformLocation("drag");
+        }
+
+        SimulationShader& setTimeDelta(Float timeDelta) {
+            setUniform(timeDeltaUniform, timeDelta);
+            return *this;
+        }
+
+        SimulationShader& setGravity(const Vector3& gravity) {
+            setUniform(gravityUniform, gravity);
+            return *this;
+        }
+
+        SimulationShader& setDrag(Float drag) {
+            setUniform(dragUniform, drag);
+            return *this;
+        }
+
+    private:
+        Int timeDeltaUniform,
+            gravityUniform,
+            dragUniform;
+};
+
+class ParticleSystem::RenderShader: public AbstractShaderProgram {
+    public:
+        explicit RenderShader() {
+            Utility::Resource rs("MagnumShaders");
+
+            Shader vert = Implementation::createCompatibilityShader(rs, ShaderVersion, Shader::Type::Vertex);
+            Shader frag = Implementation::createCompatibilityShader(rs, ShaderVersion, Shader::Type::Fragment);
+            vert.addSource(rs.get("Particle.vert"));
+            frag.addSource(rs.get("Particle.frag"));
+            CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+
+            attachShaders({vert, frag});
+            bindAttributeLocation(PositionAge::Location, "positionAge");
+            bindAttributeLocation(VelocityLifetime::Location, "velocityLifetime");
+            CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+            transformationMatrixUniform = uniformLocation("transformationMatrix");
+            projectionMatrixUniform = uniformLocation("projectionMatrix");
+            particleSizeUniform = uniformLocation("particleSize");
+            colorUniform = uniformLocation("color");
+        }
+
+        RenderShader& setTransformationMatrix(const Matrix4& matrix) {
+            setUniform(transformationMatrixUniform, matrix);
+            return *this;
+        }
+
+        RenderShader& setProjectionMatrix(const Matrix4& matrix) {
+            setUniform(projectionMatrixUniform, matrix);
+            return *this;
+        }
+
+        RenderShader& setParticleSize(Float size) {
+            setUniform(particleSizeUniform, size);
+            return *this;
+        }
+
+        RenderShader& setColor(const Color4& color) {
+            setUniform(colorUniform, color);
+            return *this;
+        }
+
+    private:
+        Int transformationMatrixUniform,
+            projectionMatrixUniform,
+            particleSizeUniform,
+            colorUniform;
+};
+
+ParticleSystem::ParticleSystem(const UnsignedInt capacity): _capacity{capacity}, _current{0}, _emitOffset{0}, _drag{0.0f}, _particleSize{1.0f}, _color{1.0f} {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::transform_feedback2);
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::instanced_arrays);
+    #else
+    MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GLES300);
+    #endif
+    CORRADE_ASSERT(capacity, "Shaders::ParticleSystem: capacity can't be zero", );
+
+    /* Zero-filled particles have age equal to lifetime, thus are all dead */
+    const std::vector<Particle> initial(capacity, Particle{});
+    for(std::size_t i = 0; i != 2; ++i) {
+        _buffers[i].setData(initial, BufferUsage::DynamicCopy);
+
+        _simulationMeshes[i].setPrimitive(MeshPrimitive::Points)
+            .setCount(capacity)
+            .addVertexBuffer(_buffers[i], 0, PositionAge{}, VelocityLifetime{});
+
+        /* Quad corners are generated from gl_VertexID in the shader, so
+           the only attributes are the per-instance particle data */
+        _renderMeshes[i].setPrimitive(MeshPrimitive::TriangleStrip)
+            .setCount(4)
+            .setInstanceCount(capacity)
+            .addVertexBufferInstanced(_buffers[i], 1, 0, PositionAge{}, VelocityLifetime{});
+    }
+
+    _simulationShader.reset(new SimulationShader);
+    _renderShader.reset(new RenderShader);
+    _feedback.reset(new TransformFeedback);
+}
+
+ParticleSystem::ParticleSystem(ParticleSystem&&) noexcept = default;
+
+ParticleSystem::~ParticleSystem() = default;
+
+ParticleSystem& ParticleSystem::operator=(ParticleSystem&&) noexcept = default;
+
+ParticleSystem& ParticleSystem::emit(Containers::ArrayReference<const Particle> particles) {
+    /* Only the last particles would survive anyway */
+    if(particles.size() > _capacity)
+        particles = {particles.data() + particles.size() - _capacity, _capacity};
+    if(!particles.size()) return *this;
+
+    /* Upload in at most two parts if the range wraps around the ring end */
+    Buffer& buffer = _buffers[_current];
+    const std::size_t first = Math::min(std::size_t(_capacity - _emitOffset), particles.size());
+    buffer.setSubData(_emitOffset*sizeof(Particle), Containers::ArrayReference<const Particle>{particles.data(), first});
+    if(first != particles.size())
+        buffer.setSubData(0, Containers::ArrayReference<const Particle>{particles.data() + first, particles.size() - first});
+
+    _emitOffset = (_emitOffset + particles.size()) % _capacity;
+    return *this;
+}
+
+ParticleSystem& ParticleSystem::update(const Float timeDelta) {
+    const UnsignedInt next = _current ^ 1;
+
+    _simulationShader->setTimeDelta(timeDelta)
+        .setGravity(_gravity)
+        .setDrag(_drag);
+
+    Renderer::enable(Renderer::Feature::RasterizerDiscard);
+    _feedback->attachBuffer(0, _buffers[next]);
+    _feedback->begin(*_simulationShader, TransformFeedback::PrimitiveMode::Points);
+    _simulationMeshes[_current].draw(*_simulationShader);
+    _feedback->end();
+    Renderer::disable(Renderer::Feature::RasterizerDiscard);
+
+    _current = next;
+    return *this;
+}
+
+void ParticleSystem::draw(const Matrix4& transformationMatrix, const Matrix4& projectionMatrix) {
+    _renderShader->setTransformationMatrix(transformationMatrix)
+        .setProjectionMatrix(projectionMatrix)
+        .setParticleSize(_particleSize)
+        .setColor(_color);
+    _renderMeshes[_current].draw(*_renderShader);
+}
+
+}}
+#endif
@@ -0,0 +1,252 @@
+#ifndef Magnum_Shaders_ParticleSystem_h
+#define Magnum_Shaders_ParticleSystem_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::ParticleSystem
+ */
+
+#include <memory>
+#include <vector>
+#include <Corrade/Containers/ArrayReference.h>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Color.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief GPU particle system
+
+Particle state lives entirely in GPU memory. It is kept in two buffers that
+are swapped on every @ref update() --- a vertex shader reads the particles
+from one buffer, integrates velocity and position and writes the result into
+the other one using @ref TransformFeedback, with rasterization disabled. The
+CPU never reads the state back.
+
+New particles are uploaded with @ref emit() using @ref Buffer::setSubData().
+The buffer is used as a ring, so when more particles are emitted than the
+@ref capacity(), the oldest slots are overwritten. A particle is dead once its
+age reaches its lifetime and it is then skipped by both the simulation and
+the rendering.
+
+@ref draw() renders all particles in a single instanced draw call as
+camera-facing quads with soft round edges, faded out with increasing age.
+Blending is not set up by the system, enable it for example like this:
+@code
+Shaders::ParticleSystem particles{16384};
+particles.setGravity({0.0f, -9.81f, 0.0f})
+    .setParticleSize(0.1f)
+    .setColor(Color4{1.0f, 0.5f, 0.1f, 1.0f});
+
+// Each frame
+particles.emit(newParticles);
+particles.update(timeDelta);
+
+Renderer::enable(Renderer::Feature::Blending);
+Renderer::setBlendFunction(Renderer::BlendFunction::SourceAlpha, Renderer::BlendFunction::One);
+Renderer::setDepthMask(false);
+particles.draw(camera.cameraMatrix(), camera.projectionMatrix());
+Renderer::setDepthMask(true);
+Renderer::disable(Renderer::Feature::Blending);
+@endcode
+
+@requires_gl40 Extension @extension{ARB,transform_feedback2}
+@requires_gl33 Extension @extension{ARB,instanced_arrays}
+@requires_gles30 Transform feedback and instancing are not available in
+    OpenGL ES 2.0.
+*/
+class MAGNUM_SHADERS_EXPORT ParticleSystem {
+    public:
+        /**
+         * @brief Particle
+         *
+         * Layout of particle state in GPU memory.
+         * @see @ref emit()
+         */
+        struct Particle {
+            Vector3 position;   /**< @brief Position */
+            Float age;          /**< @brief Age in seconds */
+            Vector3 velocity;   /**< @brief Velocity */
+            Float lifetime;     /**< @brief Lifetime in seconds */
+        };
+
+        /**
+         * @brief Constructor
+         * @param capacity      Max count of particles alive at once
+         *
+         * All particles are initially dead.
+         */
+        explicit ParticleSystem(UnsignedInt capacity);
+
+        /** @brief Copying is not allowed */
+        ParticleSystem(const ParticleSystem&) = delete;
+
+        /** @brief Move constructor */
+        ParticleSystem(ParticleSystem&&) noexcept;
+
+        ~ParticleSystem();
+
+        /** @brief Copying is not allowed */
+        ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+        /** @brief Move assignment */
+        ParticleSystem& operator=(ParticleSystem&&) noexcept;
+
+        /** @brief Max count of particles alive at once */
+        UnsignedInt capacity() const { return _capacity; }
+
+        /** @brief Gravity */
+        Vector3 gravity() const { return _gravity; }
+
+        /**
+         * @brief Set gravity
+         * @return Reference to self (for method chaining)
+         *
+         * Acceleration applied to all particles. Default is zero vector.
+         */
+        ParticleSystem& setGravity(const Vector3& gravity) {
+            _gravity = gravity;
+            return *this;
+        }
+
+        /** @brief Drag */
+        Float drag() const { return _drag; }
+
+        /**
+         * @brief Set drag
+         * @return Reference to self (for method chaining)
+         *
+         * Fraction of velocity lost per second. Default is `0.0f`.
+         */
+        ParticleSystem& setDrag(Float drag) {
+            _drag = drag;
+            return *this;
+        }
+
+        /** @brief Particle size */
+        Float particleSize() const { return _particleSize; }
+
+        /**
+         * @brief Set particle size
+         * @return Reference to self (for method chaining)
+         *
+         * Edge length of the rendered quad in world units. Default is
+         * `1.0f`.
+         */
+        ParticleSystem& setParticleSize(Float size) {
+            _particleSize = size;
+            return *this;
+        }
+
+        /** @brief Particle color */
+        Color4 color() const { return _color; }
+
+        /**
+         * @brief Set particle color
+         * @return Reference to self (for method chaining)
+         *
+         * Alpha is multiplied with edge falloff and remaining particle
+         * lifetime. Default is `{1.0f, 1.0f, 1.0f, 1.0f}`.
+         */
+        ParticleSystem& setColor(const Color4& color) {
+            _color = color;
+            return *this;
+        }
+
+        /**
+         * @brief Emit particles
+         * @return Reference to self (for method chaining)
+         *
+         * Uploads the particles into next free slots of the ring. If there
+         * are more particles than @ref capacity(), only the last
+         * @ref capacity() particles are uploaded.
+         */
+        ParticleSystem& emit(Containers::ArrayReference<const Particle> particles);
+
+        /** @overload */
+        ParticleSystem& emit(const std::vector<Particle>& particles) {
+            return emit(Containers::ArrayReference<const Particle>{particles.data(), particles.size()});
+        }
+
+        /**
+         * @brief Advance the simulation
+         * @return Reference to self (for method chaining)
+         *
+         * Integrates all alive particles by @p timeDelta seconds on the GPU
+         * and swaps the state buffers.
+         */
+        ParticleSystem& update(Float timeDelta);
+
+        /**
+         * @brief Draw the particles
+         * @param transformationMatrix  Camera matrix
+         * @param projectionMatrix      Projection matrix
+         *
+         * Draws all alive particles as camera-facing quads in a single
+         * instanced draw call.
+         */
+        void draw(const Matrix4& transformationMatrix, const Matrix4& projectionMatrix);
+
+        /**
+         * @brief Buffer with current particle state
+         *
+         * Contains @ref capacity() tightly packed @ref Particle instances.
+         * The returned buffer changes with every @ref update() call.
+         */
+        Buffer& buffer() { return _buffers[_current]; }
+
+    private:
+        class SimulationShader;
+        class RenderShader;
+
+        UnsignedInt _capacity,
+            _current,
+            _emitOffset;
+        Vector3 _gravity;
+        Float _drag,
+            _particleSize;
+        Color4 _color;
+
+        Buffer _buffers[2];
+        Mesh _simulationMeshes[2],
+            _renderMeshes[2];
+        std::unique_ptr<SimulationShader> _simulationShader;
+        std::unique_ptr<RenderShader> _renderShader;
+        std::unique_ptr<TransformFeedback> _feedback;
+};
+
+}}
+#else
+#error this header is not available on OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -25,12 +25,24 @@
 
 #include "Phong.h"
 
+#include <cmath>
+#include <string>
+
 #include <Corrade/Utility/Resource.h>
 
+#include "Magnum/Buffer.h"
+#ifndef MAGNUM_TARGET_GLES
+#include "Magnum/BufferTexture.h"
+#endif
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Shader.h"
 #include "Magnum/Texture.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/TextureArray.h"
+#include "Magnum/Shaders/ShadowCascades.h"
+#include "Magnum/Shaders/TransparencyBuffer.h"
+#endif
 
 #include "Implementation/CreateCompatibilityShader.h"
 
@@ -40,11 +52,39 @@ namespace {
     enum: Int {
         AmbientTextureLayer = 0,
         DiffuseTextureLayer = 1,
-        SpecularTextureLayer = 2
+        SpecularTextureLayer = 2,
+        #ifndef MAGNUM_TARGET_GLES
+        LightDataTextureLayer = 3,
+        LightClusterTextureLayer = 4,
+        LightIndexTextureLayer = 5,
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        ShadowMapTextureLayer = 6
+        #endif
     };
 }
 
-Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatrixUniform(1), normalMatrixUniform(2), lightUniform(3), diffuseColorUniform(4), ambientColorUniform(5), specularColorUniform(6), lightColorUniform(7), shininessUniform(8), _flags(flags) {
+Phong::Phong(const Flags flags, const UnsignedInt jointCount): Phong{flags, jointCount, false} {
+    finalize();
+}
+
+Phong::Phong(const Flags flags, const UnsignedInt jointCount, const bool async): transformationMatrixUniform(0), projectionMatrixUniform(1), normalMatrixUniform(2), lightUniform(3), diffuseColorUniform(4), ambientColorUniform(5), specularColorUniform(6), lightColorUniform(7), shininessUniform(8),
+    #ifndef MAGNUM_TARGET_GLES
+    clusterCountUniform(-1), clusterScaleUniform(-1), clusterDepthUniform(-1),
+    #endif
+    #ifndef MAGNUM_TARGET_GLES2
+    shadowMatricesUniform(-1), shadowSplitDepthsUniform(-1), shadowCascadeCountUniform(-1), shadowBiasUniform(-1), textureLayerUniform(-1), alphaUniform(-1),
+    _jointCount(flags & Flag::Skinning ? jointCount : 0),
+    #endif
+    _flags(flags)
+{
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_ASSERT(!(flags & Flag::Skinning) || jointCount,
+        "Shaders::Phong: expected non-zero joint count for skinning", );
+    #else
+    static_cast<void>(jointCount);
+    #endif
+
     Utility::Resource rs("MagnumShaders");
 
     #ifndef MAGNUM_TARGET_GLES
@@ -53,18 +93,61 @@ Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatri
     const Version version = Context::current()->supportedVersion({Version::GLES300, Version::GLES200});
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & (Flag::UniformBuffers|Flag::Skinning))
+        MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::uniform_buffer_object);
+    if(flags & Flag::Skinning)
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL300);
+    if(flags & Flag::ClusteredLights)
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL310);
+    if(flags & (Flag::Shadows|Flag::TextureArrays|Flag::WeightedBlendedTransparency))
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GL300);
+    #elif !defined(MAGNUM_TARGET_GLES2)
+    if(flags & (Flag::Skinning|Flag::Shadows|Flag::TextureArrays|Flag::WeightedBlendedTransparency))
+        MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GLES300);
+    #else
+    if(flags & Flag::FlatShading)
+        MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::OES::standard_derivatives);
+    #endif
+
+    const bool textured = !!(flags & (Flag::AmbientTexture|Flag::DiffuseTexture|Flag::SpecularTexture));
+    #ifndef MAGNUM_TARGET_GLES2
+    const bool textureArrays = textured && (flags & Flag::TextureArrays);
+    #endif
+
     Shader vert = Implementation::createCompatibilityShader(rs, version, Shader::Type::Vertex);
     Shader frag = Implementation::createCompatibilityShader(rs, version, Shader::Type::Fragment);
 
-    vert.addSource(flags ? "#define TEXTURED\n" : "")
+    vert.addSource(textured ? "#define TEXTURED\n" : "")
+        .addSource(flags & Flag::FlatShading ? "#define FLAT_SHADING\n" : "")
+        #ifndef MAGNUM_TARGET_GLES2
+        .addSource(flags & Flag::UniformBuffers ? "#define UNIFORM_BUFFERS\n" : "")
+        .addSource(flags & Flag::InstancedTransformation ? "#define INSTANCED_TRANSFORMATION\n" : "")
+        .addSource(flags & Flag::InstancedColor ? "#define INSTANCED_COLOR\n" : "")
+        .addSource(flags & Flag::Skinning ? "#define SKINNING\n#define JOINT_COUNT " + std::to_string(jointCount) + "\n" : "")
+        .addSource(textureArrays ? "#define TEXTURE_ARRAYS\n" : "")
+        .addSource(textureArrays && (flags & Flag::InstancedTextureLayer) ? "#define INSTANCED_TEXTURE_LAYER\n" : "")
+        #endif
         .addSource(rs.get("generic.glsl"))
         .addSource(rs.get("Phong.vert"));
     frag.addSource(flags & Flag::AmbientTexture ? "#define AMBIENT_TEXTURE\n" : "")
         .addSource(flags & Flag::DiffuseTexture ? "#define DIFFUSE_TEXTURE\n" : "")
         .addSource(flags & Flag::SpecularTexture ? "#define SPECULAR_TEXTURE\n" : "")
+        .addSource(flags & Flag::FlatShading ? "#define FLAT_SHADING\n" : "")
+        #ifndef MAGNUM_TARGET_GLES2
+        .addSource(flags & Flag::UniformBuffers ? "#define UNIFORM_BUFFERS\n" : "")
+        .addSource(flags & Flag::InstancedColor ? "#define INSTANCED_COLOR\n" : "")
+        .addSource(flags & Flag::Shadows ? "#define SHADOWS\n" : "")
+        .addSource(textureArrays ? "#define TEXTURE_ARRAYS\n" : "")
+        .addSource(flags & Flag::WeightedBlendedTransparency ? "#define WEIGHTED_BLENDED_TRANSPARENCY\n" + rs.get("WeightedBlendedTransparency.glsl") : "")
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        .addSource(flags & Flag::ClusteredLights ? "#define CLUSTERED_LIGHTS\n" : "")
+        #endif
         .addSource(rs.get("Phong.frag"));
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+    Shader::submitCompile({vert, frag});
+    if(!async) CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::checkCompile({vert, frag}));
 
     attachShaders({vert, frag});
 
@@ -75,12 +158,62 @@ Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatri
     #endif
     {
         bindAttributeLocation(Position::Location, "position");
-        bindAttributeLocation(Normal::Location, "normal");
-        if(flags) bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+        if(!(flags & Flag::FlatShading)) bindAttributeLocation(Normal::Location, "normal");
+        if(textured) bindAttributeLocation(TextureCoordinates::Location, "textureCoordinates");
+        #ifndef MAGNUM_TARGET_GLES2
+        if(flags & Flag::InstancedTransformation) {
+            bindAttributeLocation(TransformationMatrix::Location, "instancedTransformationMatrix");
+            bindAttributeLocation(NormalMatrix::Location, "instancedNormalMatrix");
+        }
+        if(flags & Flag::InstancedColor) bindAttributeLocation(Color::Location, "instancedColor");
+        if(flags & Flag::Skinning) {
+            bindAttributeLocation(JointIds::Location, "jointIds");
+            bindAttributeLocation(Weights::Location, "weights");
+        }
+        if(textureArrays && (flags & Flag::InstancedTextureLayer))
+            bindAttributeLocation(TextureLayer::Location, "instancedTextureLayer");
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        if(flags & Flag::WeightedBlendedTransparency) {
+            bindFragmentDataLocation(TransparencyBuffer::AccumulationOutput, "accumulation");
+            bindFragmentDataLocation(TransparencyBuffer::RevealageOutput, "revealage");
+        }
+        #endif
     }
 
-    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+    /* Linking is only submitted here, so multiple programs can be linked
+       in parallel. It is finished in finalize(). */
+    submitLink({*this});
+}
+
+void Phong::finalize() {
+    const Flags flags = _flags;
 
+    /* Only the extension checks on desktop GL need these */
+    #ifndef MAGNUM_TARGET_GLES
+    const Version version = Context::current()->supportedVersion({Version::GL320, Version::GL310, Version::GL300, Version::GL210});
+    const bool textured = !!(flags & (Flag::AmbientTexture|Flag::DiffuseTexture|Flag::SpecularTexture));
+    #endif
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(checkLink({*this}));
+
+    #ifndef MAGNUM_TARGET_GLES2
+    /* The joint palette is in a uniform block even without uniform buffers
+       enabled */
+    if(flags & Flag::Skinning)
+        setUniformBlockBinding(uniformBlockIndex("Joints"), Generic3D::JointBufferBinding);
+
+    if(flags & Flag::UniformBuffers) {
+        setUniformBlockBinding(uniformBlockIndex("Transformation"), Generic3D::TransformationBufferBinding);
+        setUniformBlockBinding(uniformBlockIndex("Material"), Generic3D::MaterialBufferBinding);
+
+        /* The plain uniforms are not present at all, make the setters no-op */
+        transformationMatrixUniform = projectionMatrixUniform =
+            normalMatrixUniform = lightUniform = diffuseColorUniform =
+            ambientColorUniform = specularColorUniform = lightColorUniform =
+            shininessUniform = -1;
+    } else
+    #endif
     #ifndef MAGNUM_TARGET_GLES
     if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::explicit_uniform_location>(version))
     #endif
@@ -97,7 +230,7 @@ Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatri
     }
 
     #ifndef MAGNUM_TARGET_GLES
-    if(flags && !Context::current()->isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
+    if(textured && !Context::current()->isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
     #endif
     {
         if(flags & Flag::AmbientTexture) setUniform(uniformLocation("ambientTexture"), AmbientTextureLayer);
@@ -105,6 +238,56 @@ Phong::Phong(const Flags flags): transformationMatrixUniform(0), projectionMatri
         if(flags & Flag::SpecularTexture) setUniform(uniformLocation("specularTexture"), SpecularTextureLayer);
     }
 
+    #ifndef MAGNUM_TARGET_GLES
+    /* The cluster parameters are always plain uniforms */
+    if(flags & Flag::ClusteredLights) {
+        clusterCountUniform = uniformLocation("clusterCount");
+        clusterScaleUniform = uniformLocation("clusterScale");
+        clusterDepthUniform = uniformLocation("clusterDepth");
+        if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version)) {
+            setUniform(uniformLocation("lightData"), LightDataTextureLayer);
+            setUniform(uniformLocation("lightClusters"), LightClusterTextureLayer);
+            setUniform(uniformLocation("lightIndices"), LightIndexTextureLayer);
+        }
+    }
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES2
+    /* The shadow parameters are always plain uniforms as well */
+    if(flags & Flag::Shadows) {
+        shadowMatricesUniform = uniformLocation("shadowMatrices");
+        shadowSplitDepthsUniform = uniformLocation("shadowSplitDepths");
+        shadowCascadeCountUniform = uniformLocation("shadowCascadeCount");
+        shadowBiasUniform = uniformLocation("shadowBias");
+        #ifndef MAGNUM_TARGET_GLES
+        if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(version))
+        #endif
+        {
+            setUniform(uniformLocation("shadowMap"), ShadowMapTextureLayer);
+        }
+        #ifdef MAGNUM_TARGET_GLES
+        setUniform(shadowCascadeCountUniform, 0);
+        setShadowBias(0.002f);
+        #endif
+    }
+
+    /* And the texture layer too */
+    if((flags & Flag::TextureArrays) && (flags & (Flag::AmbientTexture|Flag::DiffuseTexture|Flag::SpecularTexture))) {
+        textureLayerUniform = uniformLocation("textureLayer");
+        #ifdef MAGNUM_TARGET_GLES
+        setTextureLayer(0);
+        #endif
+    }
+
+    /* And the alpha as well */
+    if(flags & Flag::WeightedBlendedTransparency) {
+        alphaUniform = uniformLocation("alpha");
+        #ifdef MAGNUM_TARGET_GLES
+        setAlpha(1.0f);
+        #endif
+    }
+    #endif
+
     /* Set defaults in OpenGL ES (for desktop they are set in shader code itself) */
     #ifdef MAGNUM_TARGET_GLES
     setAmbientColor({});
@@ -134,4 +317,121 @@ Phong& Phong::setTextures(Texture2D* ambient, Texture2D* diffuse, Texture2D* spe
     return *this;
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+Phong& Phong::setAmbientTexture(Texture2DArray& texture) {
+    CORRADE_ASSERT(_flags & Flag::TextureArrays,
+        "Shaders::Phong::setAmbientTexture(): the shader was not created with texture arrays enabled", *this);
+    if(_flags & Flag::AmbientTexture) texture.bind(AmbientTextureLayer);
+    return *this;
+}
+
+Phong& Phong::setDiffuseTexture(Texture2DArray& texture) {
+    CORRADE_ASSERT(_flags & Flag::TextureArrays,
+        "Shaders::Phong::setDiffuseTexture(): the shader was not created with texture arrays enabled", *this);
+    if(_flags & Flag::DiffuseTexture) texture.bind(DiffuseTextureLayer);
+    return *this;
+}
+
+Phong& Phong::setSpecularTexture(Texture2DArray& texture) {
+    CORRADE_ASSERT(_flags & Flag::TextureArrays,
+        "Shaders::Phong::setSpecularTexture(): the shader was not created with texture arrays enabled", *this);
+    if(_flags & Flag::SpecularTexture) texture.bind(SpecularTextureLayer);
+    return *this;
+}
+
+Phong& Phong::setTextures(Texture2DArray* ambient, Texture2DArray* diffuse, Texture2DArray* specular) {
+    CORRADE_ASSERT(_flags & Flag::TextureArrays,
+        "Shaders::Phong::setTextures(): the shader was not created with texture arrays enabled", *this);
+    AbstractTexture::bind(AmbientTextureLayer, {ambient, diffuse, specular});
+    return *this;
+}
+
+Phong& Phong::setTextureLayer(const UnsignedInt layer) {
+    CORRADE_ASSERT(_flags & Flag::TextureArrays,
+        "Shaders::Phong::setTextureLayer(): the shader was not created with texture arrays enabled", *this);
+    setUniform(textureLayerUniform, layer);
+    return *this;
+}
+
+Phong& Phong::setAlpha(const Float alpha) {
+    CORRADE_ASSERT(_flags & Flag::WeightedBlendedTransparency,
+        "Shaders::Phong::setAlpha(): the shader was not created with weighted blended transparency enabled", *this);
+    setUniform(alphaUniform, alpha);
+    return *this;
+}
+
+Phong& Phong::bindTransformationBuffer(Buffer& buffer, const GLintptr offset) {
+    CORRADE_ASSERT(_flags & Flag::UniformBuffers,
+        "Shaders::Phong::bindTransformationBuffer(): the shader was not created with uniform buffers enabled", *this);
+    buffer.bind(Buffer::Target::Uniform, Generic3D::TransformationBufferBinding, offset, sizeof(TransformationUniform));
+    return *this;
+}
+
+Phong& Phong::bindMaterialBuffer(Buffer& buffer, const GLintptr offset) {
+    CORRADE_ASSERT(_flags & Flag::UniformBuffers,
+        "Shaders::Phong::bindMaterialBuffer(): the shader was not created with uniform buffers enabled", *this);
+    buffer.bind(Buffer::Target::Uniform, Generic3D::MaterialBufferBinding, offset, sizeof(MaterialUniform));
+    return *this;
+}
+
+Phong& Phong::bindJointBuffer(Buffer& buffer, const GLintptr offset) {
+    CORRADE_ASSERT(_flags & Flag::Skinning,
+        "Shaders::Phong::bindJointBuffer(): the shader was not created with skinning enabled", *this);
+    buffer.bind(Buffer::Target::Uniform, Generic3D::JointBufferBinding, offset, _jointCount*sizeof(Matrix4));
+    return *this;
+}
+
+#ifndef MAGNUM_TARGET_GLES
+Phong& Phong::setLightClusters(BufferTexture& lights, BufferTexture& clusters, BufferTexture& lightIndices) {
+    CORRADE_ASSERT(_flags & Flag::ClusteredLights,
+        "Shaders::Phong::setLightClusters(): the shader was not created with clustered lights enabled", *this);
+    AbstractTexture::bind(LightDataTextureLayer, {&lights, &clusters, &lightIndices});
+    return *this;
+}
+
+Phong& Phong::setLightClusterParameters(const Vector3ui& clusterCount, const Vector2& viewportSize, const Float near, const Float far) {
+    CORRADE_ASSERT(_flags & Flag::ClusteredLights,
+        "Shaders::Phong::setLightClusterParameters(): the shader was not created with clustered lights enabled", *this);
+    setUniform(clusterCountUniform, clusterCount);
+    setUniform(clusterScaleUniform, Vector2{clusterCount.xy()}/viewportSize);
+    setUniform(clusterDepthUniform, Vector2{near, clusterCount.z()/std::log(far/near)});
+    return *this;
+}
+#endif
+
+Phong& Phong::setShadowMap(Texture2DArray& texture) {
+    CORRADE_ASSERT(_flags & Flag::Shadows,
+        "Shaders::Phong::setShadowMap(): the shader was not created with shadows enabled", *this);
+    texture.bind(ShadowMapTextureLayer);
+    return *this;
+}
+
+Phong& Phong::setShadowMatrices(const std::vector<Matrix4>& matrices) {
+    CORRADE_ASSERT(_flags & Flag::Shadows,
+        "Shaders::Phong::setShadowMatrices(): the shader was not created with shadows enabled", *this);
+    CORRADE_ASSERT(matrices.size() <= ShadowCascades::MaxCascadeCount,
+        "Shaders::Phong::setShadowMatrices(): expected at most 4 matrices, got" << matrices.size(), *this);
+    if(!matrices.empty()) setUniform(shadowMatricesUniform, matrices.size(), matrices.data());
+    setUniform(shadowCascadeCountUniform, Int(matrices.size()));
+    return *this;
+}
+
+Phong& Phong::setShadowSplitDepths(const Vector4& depths) {
+    CORRADE_ASSERT(_flags & Flag::Shadows,
+        "Shaders::Phong::setShadowSplitDepths(): the shader was not created with shadows enabled", *this);
+    setUniform(shadowSplitDepthsUniform, depths);
+    return *this;
+}
+
+Phong& Phong::setShadowBias(const Float bias) {
+    CORRADE_ASSERT(_flags & Flag::Shadows,
+        "Shaders::Phong::setShadowBias(): the shader was not created with shadows enabled", *this);
+    setUniform(shadowBiasUniform, bias);
+    return *this;
+}
+
+static_assert(sizeof(Phong::TransformationUniform) == 192, "Improper size of transformation uniform block");
+static_assert(sizeof(Phong::MaterialUniform) == 64, "Improper size of material uniform block");
+#endif
+
 }}
@@ -33,7 +33,19 @@
 #define const
 #endif
 
-#ifndef GL_ES
+#if defined(FLAT_SHADING) && defined(GL_ES) && __VERSION__ < 300
+#extension GL_OES_standard_derivatives : enable
+#endif
+
+#ifdef UNIFORM_BUFFERS
+layout(std140) uniform Material {
+    lowp vec3 ambientMaterialColor;
+    lowp vec3 diffuseMaterialColor;
+    lowp vec3 specularMaterialColor;
+    mediump float shininess;
+    lowp vec3 lightColor;
+};
+#elif !defined(GL_ES)
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 7) uniform vec3 lightColor = vec3(1.0, 1.0, 1.0);
 layout(location = 8) uniform float shininess = 80.0;
@@ -47,11 +59,21 @@ uniform mediump float shininess;
 #endif
 
 #ifdef AMBIENT_TEXTURE
+#ifdef TEXTURE_ARRAYS
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 0) uniform mediump sampler2DArray ambientTexture;
+#else
+uniform mediump sampler2DArray ambientTexture;
+#endif
+#else
 #ifdef EXPLICIT_TEXTURE_LAYER
 layout(binding = 0) uniform sampler2D ambientTexture;
 #else
 uniform sampler2D ambientTexture;
 #endif
+#endif
+#elif defined(UNIFORM_BUFFERS)
+#define ambientColor ambientMaterialColor
 #else
 #ifndef GL_ES
 #ifdef EXPLICIT_UNIFORM_LOCATION
@@ -65,11 +87,21 @@ uniform lowp vec3 ambientColor;
 #endif
 
 #ifdef DIFFUSE_TEXTURE
+#ifdef TEXTURE_ARRAYS
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 1) uniform mediump sampler2DArray diffuseTexture;
+#else
+uniform mediump sampler2DArray diffuseTexture;
+#endif
+#else
 #ifdef EXPLICIT_TEXTURE_LAYER
 layout(binding = 1) uniform sampler2D diffuseTexture;
 #else
 uniform sampler2D diffuseTexture;
 #endif
+#endif
+#elif defined(UNIFORM_BUFFERS)
+#define diffuseColor diffuseMaterialColor
 #else
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 4) uniform vec3 diffuseColor;
@@ -79,11 +111,21 @@ uniform lowp vec3 diffuseColor;
 #endif
 
 #ifdef SPECULAR_TEXTURE
+#ifdef TEXTURE_ARRAYS
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 2) uniform mediump sampler2DArray specularTexture;
+#else
+uniform mediump sampler2DArray specularTexture;
+#endif
+#else
 #ifdef EXPLICIT_TEXTURE_LAYER
 layout(binding = 2) uniform sampler2D specularTexture;
 #else
 uniform sampler2D specularTexture;
 #endif
+#endif
+#elif defined(UNIFORM_BUFFERS)
+#define specularColor specularMaterialColor
 #else
 #ifndef GL_ES
 #ifdef EXPLICIT_UNIFORM_LOCATION
@@ -96,15 +138,82 @@ uniform lowp vec3 specularColor;
 #endif
 #endif
 
+#ifdef CLUSTERED_LIGHTS
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 3) uniform highp samplerBuffer lightData;
+layout(binding = 4) uniform highp usamplerBuffer lightClusters;
+layout(binding = 5) uniform highp usamplerBuffer lightIndices;
+#else
+uniform highp samplerBuffer lightData;
+uniform highp usamplerBuffer lightClusters;
+uniform highp usamplerBuffer lightIndices;
+#endif
+uniform highp uvec3 clusterCount;
+uniform highp vec2 clusterScale;
+uniform highp vec2 clusterDepth;
+#endif
+
+#ifdef SHADOWS
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 6) uniform highp sampler2DArrayShadow shadowMap;
+#else
+uniform highp sampler2DArrayShadow shadowMap;
+#endif
+uniform highp mat4 shadowMatrices[4];
+uniform highp vec4 shadowSplitDepths;
+#ifndef GL_ES
+uniform int shadowCascadeCount = 0;
+uniform float shadowBias = 0.002;
+#else
+uniform lowp int shadowCascadeCount;
+uniform highp float shadowBias;
+#endif
+
+/* Visibility of the light for given view-space position, with 3x3 samples
+   from the first cascade the position is in front of the far end of */
+lowp float shadowVisibility(highp vec3 position) {
+    for(int i = 0; i < shadowCascadeCount; ++i) {
+        if(-position.z > shadowSplitDepths[i]) continue;
+
+        highp vec4 shadowCoordinates = shadowMatrices[i]*vec4(position, 1.0);
+        highp vec2 texelSize = 1.0/vec2(textureSize(shadowMap, 0).xy);
+        lowp float visibility = 0.0;
+        for(int x = -1; x <= 1; ++x) for(int y = -1; y <= 1; ++y)
+            visibility += texture(shadowMap, vec4(shadowCoordinates.xy + vec2(x, y)*texelSize, float(i), shadowCoordinates.z - shadowBias));
+        return visibility/9.0;
+    }
+
+    return 1.0;
+}
+#endif
+
+#ifndef FLAT_SHADING
 in mediump vec3 transformedNormal;
+#endif
 in highp vec3 lightDirection;
 in highp vec3 cameraDirection;
 
 #if defined(AMBIENT_TEXTURE) || defined(DIFFUSE_TEXTURE) || defined(SPECULAR_TEXTURE)
+#ifdef TEXTURE_ARRAYS
+in mediump vec3 interpolatedTextureCoords;
+#else
 in mediump vec2 interpolatedTextureCoords;
 #endif
+#endif
+
+#ifdef INSTANCED_COLOR
+in lowp vec3 interpolatedInstancedColor;
+#endif
+
+#ifdef WEIGHTED_BLENDED_TRANSPARENCY
+#ifndef GL_ES
+uniform float alpha = 1.0;
+#else
+uniform lowp float alpha;
+#endif
 
-#ifdef NEW_GLSL
+lowp vec4 color;
+#elif defined(NEW_GLSL)
 out lowp vec4 color;
 #endif
 
@@ -122,20 +231,80 @@ void main() {
     /* Ambient color */
     color.rgb = ambientColor;
 
+    #ifdef FLAT_SHADING
+    /* Face normal from derivatives of the view-space position, which is
+       -cameraDirection. Negating both derivatives doesn't change the cross
+       product. */
+    mediump vec3 normalizedTransformedNormal = normalize(cross(dFdx(cameraDirection), dFdy(cameraDirection)));
+    #else
     mediump vec3 normalizedTransformedNormal = normalize(transformedNormal);
+    #endif
     highp vec3 normalizedLightDirection = normalize(lightDirection);
 
     /* Add diffuse color */
     lowp float intensity = max(0.0, dot(normalizedTransformedNormal, normalizedLightDirection));
+    #ifdef SHADOWS
+    lowp float visibility = shadowVisibility(-cameraDirection);
+    intensity *= visibility;
+    #endif
+    #ifdef INSTANCED_COLOR
+    color.rgb += diffuseColor*interpolatedInstancedColor*lightColor*intensity;
+    #else
     color.rgb += diffuseColor*lightColor*intensity;
+    #endif
 
     /* Add specular color, if needed */
     if(intensity > 0.001) {
         highp vec3 reflection = reflect(-normalizedLightDirection, normalizedTransformedNormal);
         mediump float specularity = pow(max(0.0, dot(normalize(cameraDirection), reflection)), shininess);
+        #ifdef SHADOWS
+        specularity *= visibility;
+        #endif
         color.rgb += specularColor*specularity;
     }
 
+    #ifdef CLUSTERED_LIGHTS
+    /* Find cluster of the fragment, the depth slices are exponential */
+    highp vec3 position = -cameraDirection;
+    highp vec3 normalizedCameraDirection = normalize(cameraDirection);
+    uvec3 cluster = uvec3(uvec2(gl_FragCoord.xy*clusterScale),
+        uint(max(0.0, log(-position.z/clusterDepth.x)*clusterDepth.y)));
+    cluster = min(cluster, clusterCount - uvec3(1u));
+    uvec2 range = texelFetch(lightClusters, int((cluster.z*clusterCount.y + cluster.y)*clusterCount.x + cluster.x)).xy;
+
+    /* Add diffuse and specular color of all lights in the cluster */
+    for(uint i = 0u; i != range.y; ++i) {
+        int light = int(texelFetch(lightIndices, int(range.x + i)).x);
+        highp vec4 clusteredLightPositionRange = texelFetch(lightData, 2*light);
+        lowp vec3 clusteredLightColor = texelFetch(lightData, 2*light + 1).rgb;
+
+        highp vec3 toLight = clusteredLightPositionRange.xyz - position;
+        highp float lightDistance = length(toLight);
+        lowp float attenuation = clamp(1.0 - lightDistance/clusteredLightPositionRange.w, 0.0, 1.0);
+        attenuation *= attenuation;
+        if(attenuation == 0.0) continue;
+
+        highp vec3 clusteredLightDirection = toLight/lightDistance;
+        lowp float clusteredIntensity = max(0.0, dot(normalizedTransformedNormal, clusteredLightDirection));
+        #ifdef INSTANCED_COLOR
+        color.rgb += diffuseColor*interpolatedInstancedColor*clusteredLightColor*clusteredIntensity*attenuation;
+        #else
+        color.rgb += diffuseColor*clusteredLightColor*clusteredIntensity*attenuation;
+        #endif
+
+        if(clusteredIntensity > 0.001) {
+            highp vec3 reflection = reflect(-clusteredLightDirection, normalizedTransformedNormal);
+            mediump float specularity = pow(max(0.0, dot(normalizedCameraDirection, reflection)), shininess);
+            color.rgb += specularColor*clusteredLightColor*specularity*attenuation;
+        }
+    }
+    #endif
+
+    #ifdef WEIGHTED_BLENDED_TRANSPARENCY
+    color.a = alpha;
+    writeWeightedBlended(color);
+    #else
     /* Force alpha to 1 */
     color.a = 1.0;
+    #endif
 }
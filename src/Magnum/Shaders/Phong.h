@@ -29,9 +29,12 @@
  * @brief Class @ref Magnum::Shaders::Phong
  */
 
+#include <vector>
+
 #include "Magnum/Color.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/Shaders.h"
 #include "Magnum/Shaders/visibility.h"
 
 namespace Magnum { namespace Shaders {
@@ -126,6 +129,212 @@ shader.setTextures(nullptr, &diffuseTexture, &specularTexture)
 mesh.draw(shader);
 @endcode
 
+@anchor Shaders-Phong-instancing
+### Instanced rendering
+
+With @ref Flag::InstancedTransformation the transformation and normal matrix
+set via @ref setTransformationMatrix() and @ref setNormalMatrix() is
+multiplied with per-instance @ref TransformationMatrix and @ref NormalMatrix
+attributes, with @ref Flag::InstancedColor the diffuse color is multiplied
+with per-instance @ref Color attribute. The uniforms then usually contain
+just the camera transformation and many copies of the same mesh can be drawn
+in a single call:
+@code
+struct Instance {
+    Matrix4 transformation;
+    Matrix3x3 normal;
+    Color3 color;
+};
+std::vector<Instance> instanceData = ...;
+
+Buffer instances;
+instances.setData(instanceData, BufferUsage::DynamicDraw);
+
+mesh.addVertexBufferInstanced(instances, 1, 0,
+    Shaders::Phong::TransformationMatrix{},
+    Shaders::Phong::NormalMatrix{},
+    Shaders::Phong::Color{Shaders::Phong::Color::Components::Three})
+    .setInstanceCount(instanceData.size());
+
+Shaders::Phong shader{Shaders::Phong::Flag::InstancedTransformation|
+                      Shaders::Phong::Flag::InstancedColor};
+shader.setDiffuseColor(Color3{1.0f})
+    .setTransformationMatrix(cameraMatrix)
+    .setNormalMatrix(cameraMatrix.rotation())
+    .setProjectionMatrix(projectionMatrix);
+
+mesh.draw(shader);
+@endcode
+
+@anchor Shaders-Phong-uniform-buffers
+### Uniform buffers
+
+With @ref Flag::UniformBuffers the transformation and material parameters are
+taken from `Transformation` and `Material` uniform blocks, described by
+@ref TransformationUniform and @ref MaterialUniform, instead of being set with
+the `set*()` functions above. Data for thousands of draws can be uploaded
+into one buffer at once and each draw then just binds its range:
+@code
+const Int alignment = Buffer::uniformOffsetAlignment();
+const GLintptr stride = (sizeof(Shaders::Phong::TransformationUniform) + alignment - 1)/alignment*alignment;
+
+Buffer transformations, materials;
+// fill the buffers with Shaders::Phong::TransformationUniform and
+// Shaders::Phong::MaterialUniform data, each at a multiple of the alignment
+
+Shaders::Phong shader{Shaders::Phong::Flag::UniformBuffers};
+for(std::size_t i = 0; i != drawables.size(); ++i) {
+    shader.bindTransformationBuffer(transformations, i*stride)
+        .bindMaterialBuffer(materials, drawables[i].materialId()*materialStride);
+    drawables[i].mesh().draw(shader);
+}
+@endcode
+
+@anchor Shaders-Phong-skinning
+### Skinning
+
+With @ref Flag::Skinning the position and normal of each vertex is
+transformed by a weighted sum of up to four matrices from a joint matrix
+palette before applying the transformation matrix. The mesh needs to supply
+@ref JointIds and @ref Weights attributes, the palette is taken from the
+`Joints` uniform block bound with @ref bindJointBuffer(). The normal is
+transformed with upper-left 3x3 part of the blended matrix, so the joint
+matrices are expected to contain only rotation, translation and uniform
+scaling.
+@code
+Shaders::Phong shader{Shaders::Phong::Flag::Skinning, UnsignedInt(jointMatrices.size())};
+shader.setTransformationMatrix(transformationMatrix)
+    .setNormalMatrix(transformationMatrix.rotation())
+    .setProjectionMatrix(projectionMatrix)
+    .bindJointBuffer(joints);
+
+mesh.draw(shader);
+@endcode
+
+See also @ref Shaders-Flat-skinning "Flat shader documentation" for mesh and
+palette setup.
+
+@anchor Shaders-Phong-clustered-lights
+### Clustered lights
+
+With @ref Flag::ClusteredLights the shader adds contribution of arbitrary
+count of point lights on top of the light set with @ref setLightPosition().
+The lights are assigned to clusters of the view frustum on the CPU using
+@ref LightClusterGrid and each fragment then iterates only the lights in its
+own cluster. The light contribution falls off quadratically to zero at the
+light range. Supply the culled data in buffer textures with
+@ref setLightClusters() and the grid layout with
+@ref setLightClusterParameters():
+@code
+Shaders::LightClusterGrid grid{{16, 9, 24}};
+grid.setProjection(projectionMatrix, 0.1f, 100.0f);
+
+Buffer lightBuffer, clusterBuffer, lightIndexBuffer;
+BufferTexture lightTexture, clusterTexture, lightIndexTexture;
+lightTexture.setBuffer(BufferTextureFormat::RGBA32F, lightBuffer);
+clusterTexture.setBuffer(BufferTextureFormat::RG32UI, clusterBuffer);
+lightIndexTexture.setBuffer(BufferTextureFormat::R32UI, lightIndexBuffer);
+
+// Each frame
+grid.cull(viewSpaceLights);
+lightBuffer.setData(grid.lightData(), BufferUsage::StreamDraw);
+clusterBuffer.setData(grid.clusters(), BufferUsage::StreamDraw);
+lightIndexBuffer.setData(grid.lightIndices(), BufferUsage::StreamDraw);
+
+Shaders::Phong shader{Shaders::Phong::Flag::ClusteredLights};
+shader.setLightClusters(lightTexture, clusterTexture, lightIndexTexture)
+    .setLightClusterParameters(grid.clusterCount(), Vector2{defaultFramebuffer.viewport().size()}, grid.near(), grid.far());
+@endcode
+
+@anchor Shaders-Phong-shadows
+### Shadows
+
+With @ref Flag::Shadows the diffuse and specular contribution of the light set
+with @ref setLightPosition() is multiplied by a visibility factor sampled from
+a cascaded shadow map. The light is expected to be directional, placed far
+away along the direction used to fit @ref ShadowCascades. Each fragment picks
+the first cascade whose split depth it lies in front of and takes 3x3
+depth-compared samples from it. Fragments past the last cascade are not
+shadowed. See @ref CascadedShadowMap for rendering the shadow map:
+@code
+Shaders::Phong shader{Shaders::Phong::Flag::Shadows};
+shader.setLightPosition(camera.cameraMatrix().transformVector(-sunDirection*1000.0f))
+    .setShadowMap(shadowMap.texture())
+    .setShadowMatrices(cascades.shadowMatrices())
+    .setShadowSplitDepths(cascades.splitDepths());
+@endcode
+
+@anchor Shaders-Phong-texture-arrays
+### Texture arrays
+
+With @ref Flag::TextureArrays the ambient, diffuse and specular textures are
+@ref Texture2DArray instances and the layer to sample from is set with
+@ref setTextureLayer(). Together with @ref Flag::InstancedTextureLayer the
+@ref TextureLayer attribute is added to it, so draws that differ only in the
+texture can be merged into one. The attribute can be either per-instance or
+per-vertex, the latter allowing to concatenate distinct meshes into a single
+one. Textures of the same size can be packed into one array with
+@ref TextureTools::arrayAtlas():
+@code
+Texture2DArray diffuse = TextureTools::arrayAtlas(TextureFormat::RGBA8, images);
+
+struct Instance {
+    Matrix4 transformation;
+    Matrix3x3 normal;
+    Float layer;
+};
+std::vector<Instance> instanceData = ...;
+
+Buffer instances;
+instances.setData(instanceData, BufferUsage::DynamicDraw);
+
+mesh.addVertexBufferInstanced(instances, 1, 0,
+    Shaders::Phong::TransformationMatrix{},
+    Shaders::Phong::NormalMatrix{},
+    Shaders::Phong::TextureLayer{})
+    .setInstanceCount(instanceData.size());
+
+Shaders::Phong shader{Shaders::Phong::Flag::DiffuseTexture|
+                      Shaders::Phong::Flag::TextureArrays|
+                      Shaders::Phong::Flag::InstancedTransformation|
+                      Shaders::Phong::Flag::InstancedTextureLayer};
+shader.setDiffuseTexture(diffuse);
+@endcode
+
+@anchor Shaders-Phong-flat-shading
+### Flat shading
+
+With @ref Flag::FlatShading the normal of each fragment is calculated from
+screen-space derivatives of its position, so all fragments of a triangle are
+lit with the face normal. The @ref Normal attribute is not used at all, which
+means faceted meshes can keep vertices shared among neighboring faces instead
+of duplicating them for each face with @ref MeshTools::generateFlatNormals()
+and @ref MeshTools::combineIndexedArrays(), saving roughly two thirds of
+vertex memory. The faces are expected to have counterclockwise winding when
+seen from the front.
+@code
+Mesh mesh;
+mesh.addVertexBuffer(vertices, 0, Shaders::Phong::Position{})
+    .setIndexBuffer(indices, 0, Mesh::IndexType::UnsignedInt);
+
+Shaders::Phong shader{Shaders::Phong::Flag::FlatShading};
+@endcode
+
+@anchor Shaders-Phong-transparency
+### Order-independent transparency
+
+With @ref Flag::WeightedBlendedTransparency the shader writes into a
+@ref TransparencyBuffer instead of a single color output, with opacity of
+the whole surface given by @ref setAlpha(). The lighting is the same as for
+opaque surfaces. Transparent drawables then don't need to be sorted
+back-to-front and can be batched by render state the same way as opaque
+ones, see @ref TransparencyBuffer for a complete example.
+@code
+Shaders::Phong shader{Shaders::Phong::Flag::WeightedBlendedTransparency};
+shader.setDiffuseColor(Color3::fromHSV(216.0_degf, 0.85f, 1.0f))
+    .setAlpha(0.4f);
+@endcode
+
 @see @ref shaders
 */
 class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
@@ -153,6 +362,68 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
          */
         typedef Generic3D::TextureCoordinates TextureCoordinates;
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Per-instance transformation matrix
+         *
+         * @ref shaders-generic "Generic attribute", @ref Matrix4. Used only if
+         * @ref Flag::InstancedTransformation is set.
+         * @requires_gles30 Instanced attributes are not available in OpenGL
+         *      ES 2.0.
+         */
+        typedef Generic3D::TransformationMatrix TransformationMatrix;
+
+        /**
+         * @brief Per-instance normal matrix
+         *
+         * @ref shaders-generic "Generic attribute", @ref Matrix3x3. Used only
+         * if @ref Flag::InstancedTransformation is set.
+         * @requires_gles30 Instanced attributes are not available in OpenGL
+         *      ES 2.0.
+         */
+        typedef Generic3D::NormalMatrix NormalMatrix;
+
+        /**
+         * @brief Per-instance color
+         *
+         * @ref shaders-generic "Generic attribute", @ref Color4, only the RGB
+         * part is used. Used only if @ref Flag::InstancedColor is set.
+         * @requires_gles30 Instanced attributes are not available in OpenGL
+         *      ES 2.0.
+         */
+        typedef Generic3D::Color Color;
+
+        /**
+         * @brief Joint IDs
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector4ui. Used only
+         * if @ref Flag::Skinning is set.
+         * @requires_gl30 Extension @extension{EXT,gpu_shader4}
+         * @requires_gles30 Integer attributes are not available in OpenGL
+         *      ES 2.0.
+         */
+        typedef Generic3D::JointIds JointIds;
+
+        /**
+         * @brief Joint weights
+         *
+         * @ref shaders-generic "Generic attribute", @ref Vector4. Used only
+         * if @ref Flag::Skinning is set.
+         * @requires_gles30 Skinning is not available in OpenGL ES 2.0.
+         */
+        typedef Generic3D::Weights Weights;
+
+        /**
+         * @brief Texture array layer
+         *
+         * @ref shaders-generic "Generic attribute", @ref Float. Used only if
+         * @ref Flag::InstancedTextureLayer is set.
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         */
+        typedef Generic3D::TextureLayer TextureLayer;
+        #endif
+
         #ifdef MAGNUM_BUILD_DEPRECATED
         enum: Int {
             /**
@@ -186,10 +457,123 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
          *
          * @see @ref Flags, @ref flags()
          */
-        enum class Flag: UnsignedByte {
+        enum class Flag: UnsignedShort {
             AmbientTexture = 1 << 0,    /**< The shader uses ambient texture instead of color */
             DiffuseTexture = 1 << 1,    /**< The shader uses diffuse texture instead of color */
-            SpecularTexture = 1 << 2    /**< The shader uses specular texture instead of color */
+            SpecularTexture = 1 << 2,   /**< The shader uses specular texture instead of color */
+
+            #ifndef MAGNUM_TARGET_GLES2
+            /**
+             * The shader takes transformation and material parameters from
+             * uniform buffers instead of plain uniforms. See
+             * @ref Shaders-Phong-uniform-buffers "class documentation" for
+             * more information.
+             * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+             * @requires_gles30 Uniform buffers are not available in OpenGL
+             *      ES 2.0.
+             */
+            UniformBuffers = 1 << 3,
+
+            /**
+             * The transformation and normal matrix is multiplied with
+             * per-instance @ref TransformationMatrix and @ref NormalMatrix
+             * attributes. See @ref Shaders-Phong-instancing "class documentation"
+             * for more information.
+             * @requires_gles30 Instanced attributes are not available in
+             *      OpenGL ES 2.0.
+             */
+            InstancedTransformation = 1 << 4,
+
+            /**
+             * The diffuse color is multiplied with per-instance @ref Color
+             * attribute.
+             * @requires_gles30 Instanced attributes are not available in
+             *      OpenGL ES 2.0.
+             */
+            InstancedColor = 1 << 5,
+
+            /**
+             * Vertex positions and normals are transformed with joint
+             * matrices given by @ref JointIds and @ref Weights attributes.
+             * See @ref Shaders-Phong-skinning "class documentation" for
+             * more information.
+             * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+             *      and @extension{EXT,gpu_shader4}
+             * @requires_gles30 Skinning is not available in OpenGL ES 2.0.
+             */
+            Skinning = 1 << 6,
+            #endif
+
+            #ifndef MAGNUM_TARGET_GLES
+            /**
+             * Add contribution of point lights assigned to view frustum
+             * clusters by @ref LightClusterGrid. See
+             * @ref Shaders-Phong-clustered-lights "class documentation" for
+             * more information.
+             * @requires_gl31 Extension @extension{ARB,texture_buffer_object}
+             * @requires_gl Buffer textures are not available in OpenGL ES.
+             */
+            ClusteredLights = 1 << 7,
+            #endif
+
+            #ifndef MAGNUM_TARGET_GLES2
+            /**
+             * Diffuse and specular contribution of the light set with
+             * @ref setLightPosition() is attenuated by a cascaded shadow map.
+             * See @ref Shaders-Phong-shadows "class documentation" for more
+             * information.
+             * @requires_gl30 Extension @extension{EXT,texture_array}
+             * @requires_gles30 Texture arrays are not available in OpenGL ES
+             *      2.0.
+             */
+            Shadows = 1 << 8,
+
+            /**
+             * The ambient, diffuse and specular textures are texture arrays,
+             * sampled at layer set with @ref setTextureLayer(). See
+             * @ref Shaders-Phong-texture-arrays "class documentation" for
+             * more information.
+             * @requires_gl30 Extension @extension{EXT,texture_array}
+             * @requires_gles30 Texture arrays are not available in OpenGL ES
+             *      2.0.
+             */
+            TextureArrays = 1 << 9,
+
+            /**
+             * The per-instance or per-vertex @ref TextureLayer attribute is
+             * added to the texture layer set with @ref setTextureLayer().
+             * Has effect only if @ref Flag::TextureArrays is set.
+             * @requires_gl30 Extension @extension{EXT,texture_array}
+             * @requires_gles30 Texture arrays are not available in OpenGL ES
+             *      2.0.
+             */
+            InstancedTextureLayer = 1 << 10,
+            #endif
+
+            /**
+             * Shade each triangle with a single normal computed from
+             * screen-space derivatives of the fragment position instead of
+             * using the @ref Normal attribute. See
+             * @ref Shaders-Phong-flat-shading "class documentation" for more
+             * information.
+             * @requires_es_extension Extension @extension{OES,standard_derivatives}
+             *      in OpenGL ES 2.0.
+             */
+            FlatShading = 1 << 11,
+
+            #ifndef MAGNUM_TARGET_GLES2
+            /**
+             * Write weighted color and revealage into a
+             * @ref TransparencyBuffer for order-independent transparency
+             * instead of a single color output, with opacity set via
+             * @ref setAlpha(). See @ref Shaders-Phong-transparency "class documentation"
+             * for more information.
+             * @requires_gl30 Extension @extension{ARB,color_buffer_float}
+             * @requires_gles30 Multiple render targets are not available in
+             *      OpenGL ES 2.0.
+             */
+            WeightedBlendedTransparency = 1 << 12
+            #endif
         };
 
         /**
@@ -199,22 +583,40 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
          */
         typedef Containers::EnumSet<Flag> Flags;
 
+        #ifndef MAGNUM_TARGET_GLES2
+        class TransformationUniform;
+        class MaterialUniform;
+        #endif
+
         /**
          * @brief Constructor
-         * @param flags     Flags
+         * @param flags         Flags
+         * @param jointCount    Size of joint matrix palette. Used only if
+         *      @ref Flag::Skinning is set, in which case it is expected to
+         *      be non-zero.
          */
-        explicit Phong(Flags flags = Flags());
+        explicit Phong(Flags flags = Flags(), UnsignedInt jointCount = 0);
 
         /** @brief Flags */
         Flags flags() const { return _flags; }
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Size of joint matrix palette
+         *
+         * Zero if @ref Flag::Skinning is not set.
+         * @requires_gles30 Skinning is not available in OpenGL ES 2.0.
+         */
+        UnsignedInt jointCount() const { return _jointCount; }
+        #endif
+
         /**
          * @brief Set ambient color
          * @return Reference to self (for method chaining)
          *
          * If not set, default value is `{0.0f, 0.0f, 0.0f}`. Has no effect if
-         * @ref Flag::AmbientTexture is set.
-         * @see @ref setAmbientTexture()
+         * @ref Flag::AmbientTexture or @ref Flag::UniformBuffers is set.
+         * @see @ref setAmbientTexture(), @ref bindMaterialBuffer()
          */
         Phong& setAmbientColor(const Color3& color);
 
@@ -231,8 +633,9 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
          * @brief Set diffuse color
          * @return Reference to self (for method chaining)
          *
-         * Has no effect if @ref Flag::DiffuseTexture is used.
-         * @see @ref setDiffuseTexture()
+         * Has no effect if @ref Flag::DiffuseTexture or
+         * @ref Flag::UniformBuffers is used.
+         * @see @ref setDiffuseTexture(), @ref bindMaterialBuffer()
          */
         Phong& setDiffuseColor(const Color3& color);
 
@@ -250,8 +653,8 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
          * @return Reference to self (for method chaining)
          *
          * If not set, default value is `{1.0f, 1.0f, 1.0f}`. Has no effect if
-         * @ref Flag::SpecularTexture is set.
-         * @see @ref setSpecularTexture()
+         * @ref Flag::SpecularTexture or @ref Flag::UniformBuffers is set.
+         * @see @ref setSpecularTexture(), @ref bindMaterialBuffer()
          */
         Phong& setSpecularColor(const Color3& color);
 
@@ -276,12 +679,81 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
          */
         Phong& setTextures(Texture2D* ambient, Texture2D* diffuse, Texture2D* specular);
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Set ambient texture array
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @ref Flag::TextureArrays is set. Has effect only if
+         * @ref Flag::AmbientTexture is set.
+         * @see @ref setTextureLayer()
+         * @requires_gl30 Extension @extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         */
+        Phong& setAmbientTexture(Texture2DArray& texture);
+
+        /**
+         * @brief Set diffuse texture array
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @ref Flag::TextureArrays is set. Has effect only if
+         * @ref Flag::DiffuseTexture is set.
+         * @see @ref setTextureLayer()
+         * @requires_gl30 Extension @extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         */
+        Phong& setDiffuseTexture(Texture2DArray& texture);
+
+        /**
+         * @brief Set specular texture array
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @ref Flag::TextureArrays is set. Has effect only if
+         * @ref Flag::SpecularTexture is set.
+         * @see @ref setTextureLayer()
+         * @requires_gl30 Extension @extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         */
+        Phong& setSpecularTexture(Texture2DArray& texture);
+
+        /**
+         * @brief Set texture arrays
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @ref Flag::TextureArrays is set. A particular texture
+         * has effect only if particular texture flag from
+         * @ref Phong::Flag "Flag" is set, you can use `nullptr` for the rest.
+         * @requires_gl30 Extension @extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         */
+        Phong& setTextures(Texture2DArray* ambient, Texture2DArray* diffuse, Texture2DArray* specular);
+
+        /**
+         * @brief Set texture array layer
+         * @return Reference to self (for method chaining)
+         *
+         * If @ref Flag::InstancedTextureLayer is set, the @ref TextureLayer
+         * attribute is added to it. If not set, default value is `0`.
+         * Expects that @ref Flag::TextureArrays is set.
+         * @requires_gl30 Extension @extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         */
+        Phong& setTextureLayer(UnsignedInt layer);
+        #endif
+
         /**
          * @brief Set shininess
          * @return Reference to self (for method chaining)
          *
          * The larger value, the harder surface (smaller specular highlight).
-         * If not set, default value is `80.0f`.
+         * If not set, default value is `80.0f`. Has no effect if
+         * @ref Flag::UniformBuffers is set.
+         * @see @ref bindMaterialBuffer()
          */
         Phong& setShininess(Float shininess) {
             setUniform(shininessUniform, shininess);
@@ -291,6 +763,9 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
         /**
          * @brief Set transformation matrix
          * @return Reference to self (for method chaining)
+         *
+         * Has no effect if @ref Flag::UniformBuffers is set.
+         * @see @ref bindTransformationBuffer()
          */
         Phong& setTransformationMatrix(const Matrix4& matrix) {
             setUniform(transformationMatrixUniform, matrix);
@@ -302,7 +777,9 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
          * @return Reference to self (for method chaining)
          *
          * The matrix doesn't need to be normalized, as the renormalization
-         * must be done in the shader anyway.
+         * must be done in the shader anyway. Has no effect if
+         * @ref Flag::UniformBuffers is set.
+         * @see @ref bindTransformationBuffer()
          */
         Phong& setNormalMatrix(const Matrix3x3& matrix) {
             setUniform(normalMatrixUniform, matrix);
@@ -312,6 +789,9 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
         /**
          * @brief Set projection matrix
          * @return Reference to self (for method chaining)
+         *
+         * Has no effect if @ref Flag::UniformBuffers is set.
+         * @see @ref bindTransformationBuffer()
          */
         Phong& setProjectionMatrix(const Matrix4& matrix) {
             setUniform(projectionMatrixUniform, matrix);
@@ -321,6 +801,9 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
         /**
          * @brief Set light position
          * @return Reference to self (for method chaining)
+         *
+         * Has no effect if @ref Flag::UniformBuffers is set.
+         * @see @ref bindTransformationBuffer()
          */
         Phong& setLightPosition(const Vector3& light) {
             setUniform(lightUniform, light);
@@ -331,14 +814,184 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
          * @brief Set light color
          * @return Reference to self (for method chaining)
          *
-         * If not set, default value is `{1.0f, 1.0f, 1.0f}`.
+         * If not set, default value is `{1.0f, 1.0f, 1.0f}`. Has no effect
+         * if @ref Flag::UniformBuffers is set.
+         * @see @ref bindMaterialBuffer()
          */
         Phong& setLightColor(const Color3& color) {
             setUniform(lightColorUniform, color);
             return *this;
         }
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Bind transformation uniform buffer
+         * @param buffer    Buffer with @ref TransformationUniform data
+         * @param offset    Offset of the data in the buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Binds given range of the buffer to
+         * @ref Generic::TransformationBufferBinding. Expects that
+         * @ref Flag::UniformBuffers is set. The @p offset must be a multiple
+         * of @ref Buffer::uniformOffsetAlignment().
+         * @see @ref Buffer::bind(Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr)
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         */
+        Phong& bindTransformationBuffer(Buffer& buffer, GLintptr offset = 0);
+
+        /**
+         * @brief Bind material uniform buffer
+         * @param buffer    Buffer with @ref MaterialUniform data
+         * @param offset    Offset of the data in the buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Binds given range of the buffer to
+         * @ref Generic::MaterialBufferBinding. Expects that
+         * @ref Flag::UniformBuffers is set. The @p offset must be a multiple
+         * of @ref Buffer::uniformOffsetAlignment().
+         * @see @ref Buffer::bind(Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr)
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         */
+        Phong& bindMaterialBuffer(Buffer& buffer, GLintptr offset = 0);
+
+        /**
+         * @brief Bind joint matrix uniform buffer
+         * @param buffer    Buffer with @ref jointCount() @ref Matrix4 values
+         * @param offset    Offset of the data in the buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Binds given range of the buffer to
+         * @ref Generic::JointBufferBinding. Expects that @ref Flag::Skinning
+         * is set. The @p offset must be a multiple of
+         * @ref Buffer::uniformOffsetAlignment().
+         * @see @ref Buffer::bind(Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr)
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         */
+        Phong& bindJointBuffer(Buffer& buffer, GLintptr offset = 0);
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Set light cluster data
+         * @param lights        Texture with @ref LightClusterGrid::lightData()
+         *      in @ref BufferTextureFormat::RGBA32F
+         * @param clusters      Texture with @ref LightClusterGrid::clusters()
+         *      in @ref BufferTextureFormat::RG32UI
+         * @param lightIndices  Texture with @ref LightClusterGrid::lightIndices()
+         *      in @ref BufferTextureFormat::R32UI
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @ref Flag::ClusteredLights is set.
+         * @see @ref setLightClusterParameters()
+         * @requires_gl31 Extension @extension{ARB,texture_buffer_object}
+         * @requires_gl Buffer textures are not available in OpenGL ES.
+         */
+        Phong& setLightClusters(BufferTexture& lights, BufferTexture& clusters, BufferTexture& lightIndices);
+
+        /**
+         * @brief Set light cluster grid parameters
+         * @param clusterCount  Cluster count, see
+         *      @ref LightClusterGrid::clusterCount()
+         * @param viewportSize  Viewport size in pixels
+         * @param near          Near plane distance of the grid
+         * @param far           Far plane distance of the grid
+         * @return Reference to self (for method chaining)
+         *
+         * Needs to match the grid used to produce data passed to
+         * @ref setLightClusters(). Expects that @ref Flag::ClusteredLights is
+         * set.
+         * @requires_gl31 Extension @extension{ARB,texture_buffer_object}
+         * @requires_gl Buffer textures are not available in OpenGL ES.
+         */
+        Phong& setLightClusterParameters(const Vector3ui& clusterCount, const Vector2& viewportSize, Float near, Float far);
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Set shadow map
+         * @param texture   Depth texture array with depth comparison
+         *      enabled, see @ref CascadedShadowMap::texture()
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that @ref Flag::Shadows is set.
+         * @requires_gl30 Extension @extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         */
+        Phong& setShadowMap(Texture2DArray& texture);
+
+        /**
+         * @brief Set shadow matrices
+         * @return Reference to self (for method chaining)
+         *
+         * Matrices transforming view-space position to shadow map texture
+         * coordinates and depth, one for each layer of the shadow map, see
+         * @ref ShadowCascades::shadowMatrices(). Their count is used as
+         * cascade count. Expects that @ref Flag::Shadows is set and there's
+         * at most @ref ShadowCascades::MaxCascadeCount matrices. If not set,
+         * no cascades are used and nothing is shadowed.
+         * @requires_gl30 Extension @extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         */
+        Phong& setShadowMatrices(const std::vector<Matrix4>& matrices);
+
+        /**
+         * @brief Set shadow split depths
+         * @return Reference to self (for method chaining)
+         *
+         * View-space distance of the far end of each cascade, see
+         * @ref ShadowCascades::splitDepths(). Expects that
+         * @ref Flag::Shadows is set.
+         * @requires_gl30 Extension @extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         */
+        Phong& setShadowSplitDepths(const Vector4& depths);
+
+        /**
+         * @brief Set shadow depth bias
+         * @return Reference to self (for method chaining)
+         *
+         * Subtracted from the fragment depth in shadow map space before the
+         * comparison to avoid shadow acne. If not set, default value is
+         * `0.002f`. Expects that @ref Flag::Shadows is set.
+         * @requires_gl30 Extension @extension{EXT,texture_array}
+         * @requires_gles30 Texture arrays are not available in OpenGL ES
+         *      2.0.
+         */
+        Phong& setShadowBias(Float bias);
+
+        /**
+         * @brief Set surface opacity
+         * @return Reference to self (for method chaining)
+         *
+         * If not set, default value is `1.0f`. It's a plain uniform even if
+         * @ref Flag::UniformBuffers is set. Expects that
+         * @ref Flag::WeightedBlendedTransparency is set.
+         * @requires_gl30 Extension @extension{ARB,color_buffer_float}
+         * @requires_gles30 Multiple render targets are not available in
+         *      OpenGL ES 2.0.
+         */
+        Phong& setAlpha(Float alpha);
+        #endif
+
     private:
+        friend ShaderCache;
+
+        /* Submits compilation and linking of the program without waiting
+           for the result, the setup is done in finalize(). If `async` is
+           `false`, waits for compilation to report errors early. */
+        explicit Phong(Flags flags, UnsignedInt jointCount, bool async);
+
+        void finalize();
+
         Int transformationMatrixUniform,
             projectionMatrixUniform,
             normalMatrixUniform,
@@ -348,12 +1001,188 @@ class MAGNUM_SHADERS_EXPORT Phong: public AbstractShaderProgram {
             specularColorUniform,
             lightColorUniform,
             shininessUniform;
+        #ifndef MAGNUM_TARGET_GLES
+        Int clusterCountUniform,
+            clusterScaleUniform,
+            clusterDepthUniform;
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        Int shadowMatricesUniform,
+            shadowSplitDepthsUniform,
+            shadowCascadeCountUniform,
+            shadowBiasUniform,
+            textureLayerUniform,
+            alphaUniform;
+        UnsignedInt _jointCount;
+        #endif
 
         Flags _flags;
 };
 
 CORRADE_ENUMSET_OPERATORS(Phong::Flags)
 
+#ifndef MAGNUM_TARGET_GLES2
+/**
+@brief Phong transformation uniform block
+
+Data of the `Transformation` uniform block, used only if
+@ref Phong::Flag::UniformBuffers is set. The normal matrix is padded to match
+`std140` layout rules.
+@see @ref Phong::bindTransformationBuffer()
+@requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+@requires_gles30 Uniform buffers are not available in OpenGL ES 2.0.
+*/
+class Phong::TransformationUniform {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * All matrices are set to identity and light position to origin.
+         */
+        /*implicit*/ TransformationUniform(): _padding{} {
+            setNormalMatrix({});
+        }
+
+        /**
+         * @brief Set transformation matrix
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Phong::setTransformationMatrix()
+         */
+        TransformationUniform& setTransformationMatrix(const Matrix4& matrix) {
+            _transformationMatrix = matrix;
+            return *this;
+        }
+
+        /**
+         * @brief Set projection matrix
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Phong::setProjectionMatrix()
+         */
+        TransformationUniform& setProjectionMatrix(const Matrix4& matrix) {
+            _projectionMatrix = matrix;
+            return *this;
+        }
+
+        /**
+         * @brief Set normal matrix
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Phong::setNormalMatrix()
+         */
+        TransformationUniform& setNormalMatrix(const Matrix3x3& matrix) {
+            for(std::size_t i = 0; i != 3; ++i)
+                _normalMatrix[i] = Vector4{matrix[i], 0.0f};
+            return *this;
+        }
+
+        /**
+         * @brief Set light position
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Phong::setLightPosition()
+         */
+        TransformationUniform& setLightPosition(const Vector3& light) {
+            _light = light;
+            return *this;
+        }
+
+    private:
+        Matrix4 _transformationMatrix;
+        Matrix4 _projectionMatrix;
+        Matrix3x4 _normalMatrix;
+        Vector3 _light;
+        Float _padding;
+};
+
+/**
+@brief Phong material uniform block
+
+Data of the `Material` uniform block, used only if
+@ref Phong::Flag::UniformBuffers is set. Colors for which the corresponding
+texture flag is set are ignored.
+@see @ref Phong::bindMaterialBuffer()
+@requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+@requires_gles30 Uniform buffers are not available in OpenGL ES 2.0.
+*/
+class Phong::MaterialUniform {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * The values are set to the same defaults as with plain uniforms.
+         */
+        /*implicit*/ MaterialUniform(): _padding0{}, _padding1{}, _specularColor{1.0f}, _shininess{80.0f}, _lightColor{1.0f}, _padding2{} {}
+
+        /**
+         * @brief Set ambient color
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Phong::setAmbientColor()
+         */
+        MaterialUniform& setAmbientColor(const Color3& color) {
+            _ambientColor = color;
+            return *this;
+        }
+
+        /**
+         * @brief Set diffuse color
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Phong::setDiffuseColor()
+         */
+        MaterialUniform& setDiffuseColor(const Color3& color) {
+            _diffuseColor = color;
+            return *this;
+        }
+
+        /**
+         * @brief Set specular color
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Phong::setSpecularColor()
+         */
+        MaterialUniform& setSpecularColor(const Color3& color) {
+            _specularColor = color;
+            return *this;
+        }
+
+        /**
+         * @brief Set shininess
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Phong::setShininess()
+         */
+        MaterialUniform& setShininess(Float shininess) {
+            _shininess = shininess;
+            return *this;
+        }
+
+        /**
+         * @brief Set light color
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref Phong::setLightColor()
+         */
+        MaterialUniform& setLightColor(const Color3& color) {
+            _lightColor = color;
+            return *this;
+        }
+
+    private:
+        /* std140 puts the scalar into the padding after preceding vec3 */
+        Color3 _ambientColor;
+        Float _padding0;
+        Color3 _diffuseColor;
+        Float _padding1;
+        Color3 _specularColor;
+        Float _shininess;
+        Color3 _lightColor;
+        Float _padding2;
+};
+#endif
+
 inline Phong& Phong::setAmbientColor(const Color3& color) {
     if(!(_flags & Flag::AmbientTexture)) setUniform(ambientColorUniform, color);
     return *this;
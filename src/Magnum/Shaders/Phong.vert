@@ -28,7 +28,14 @@
 #define out varying
 #endif
 
-#ifdef EXPLICIT_UNIFORM_LOCATION
+#ifdef UNIFORM_BUFFERS
+layout(std140) uniform Transformation {
+    highp mat4 transformationMatrix;
+    highp mat4 projectionMatrix;
+    mediump mat3 normalMatrix;
+    highp vec3 light;
+};
+#elif defined(EXPLICIT_UNIFORM_LOCATION)
 layout(location = 0) uniform mat4 transformationMatrix;
 layout(location = 1) uniform mat4 projectionMatrix;
 layout(location = 2) uniform mat3 normalMatrix;
@@ -42,11 +49,50 @@ uniform highp vec3 light;
 
 #ifdef EXPLICIT_ATTRIB_LOCATION
 layout(location = POSITION_ATTRIBUTE_LOCATION) in highp vec4 position;
-layout(location = NORMAL_ATTRIBUTE_LOCATION) in mediump vec3 normal;
 #else
 in highp vec4 position;
+#endif
+
+#ifndef FLAT_SHADING
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = NORMAL_ATTRIBUTE_LOCATION) in mediump vec3 normal;
+#else
 in mediump vec3 normal;
 #endif
+#endif
+
+#ifdef INSTANCED_TRANSFORMATION
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TRANSFORMATION_MATRIX_ATTRIBUTE_LOCATION) in highp mat4 instancedTransformationMatrix;
+layout(location = NORMAL_MATRIX_ATTRIBUTE_LOCATION) in mediump mat3 instancedNormalMatrix;
+#else
+in highp mat4 instancedTransformationMatrix;
+in mediump mat3 instancedNormalMatrix;
+#endif
+#endif
+
+#ifdef SKINNING
+layout(std140) uniform Joints {
+    highp mat4 jointMatrices[JOINT_COUNT];
+};
+
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = JOINT_IDS_ATTRIBUTE_LOCATION) in mediump uvec4 jointIds;
+layout(location = WEIGHTS_ATTRIBUTE_LOCATION) in mediump vec4 weights;
+#else
+in mediump uvec4 jointIds;
+in mediump vec4 weights;
+#endif
+#endif
+
+#ifdef INSTANCED_COLOR
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = COLOR_ATTRIBUTE_LOCATION) in lowp vec4 instancedColor;
+#else
+in lowp vec4 instancedColor;
+#endif
+out lowp vec3 interpolatedInstancedColor;
+#endif
 
 #ifdef TEXTURED
 #ifdef EXPLICIT_ATTRIB_LOCATION
@@ -54,20 +100,73 @@ layout(location = TEXTURECOORDINATES_ATTRIBUTE_LOCATION) in mediump vec2 texture
 #else
 in mediump vec2 textureCoords;
 #endif
+#ifdef TEXTURE_ARRAYS
+/* Layer is passed in the third component, it's the same for all vertices of
+   a triangle so the interpolation doesn't change it */
+out mediump vec3 interpolatedTextureCoords;
+#else
 out mediump vec2 interpolatedTextureCoords;
 #endif
+#endif
+
+#ifdef TEXTURE_ARRAYS
+#ifndef GL_ES
+uniform uint textureLayer = 0u;
+#else
+uniform mediump uint textureLayer;
+#endif
+
+#ifdef INSTANCED_TEXTURE_LAYER
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TEXTURE_LAYER_ATTRIBUTE_LOCATION) in mediump float instancedTextureLayer;
+#else
+in mediump float instancedTextureLayer;
+#endif
+#endif
+#endif
 
+#ifndef FLAT_SHADING
 out mediump vec3 transformedNormal;
+#endif
 out highp vec3 lightDirection;
 out highp vec3 cameraDirection;
 
 void main() {
+    /* Blend the joint matrices, if needed */
+    #ifdef SKINNING
+    highp mat4 skinMatrix =
+        weights.x*jointMatrices[jointIds.x] +
+        weights.y*jointMatrices[jointIds.y] +
+        weights.z*jointMatrices[jointIds.z] +
+        weights.w*jointMatrices[jointIds.w];
+    highp vec4 skinnedPosition = skinMatrix*position;
+    #ifndef FLAT_SHADING
+    mediump vec3 skinnedNormal = mat3(skinMatrix)*normal;
+    #endif
+    #else
+    highp vec4 skinnedPosition = position;
+    #ifndef FLAT_SHADING
+    mediump vec3 skinnedNormal = normal;
+    #endif
+    #endif
+
     /* Transformed vertex position */
-    highp vec4 transformedPosition4 = transformationMatrix*position;
+    #ifdef INSTANCED_TRANSFORMATION
+    highp vec4 transformedPosition4 = transformationMatrix*instancedTransformationMatrix*skinnedPosition;
+    #else
+    highp vec4 transformedPosition4 = transformationMatrix*skinnedPosition;
+    #endif
     highp vec3 transformedPosition = transformedPosition4.xyz/transformedPosition4.w;
 
-    /* Transformed normal vector */
-    transformedNormal = normalMatrix*normal;
+    /* Transformed normal vector, with flat shading it's calculated in the
+       fragment shader */
+    #ifndef FLAT_SHADING
+    #ifdef INSTANCED_TRANSFORMATION
+    transformedNormal = normalMatrix*instancedNormalMatrix*skinnedNormal;
+    #else
+    transformedNormal = normalMatrix*skinnedNormal;
+    #endif
+    #endif
 
     /* Direction to the light */
     lightDirection = normalize(light - transformedPosition);
@@ -80,6 +179,19 @@ void main() {
 
     #ifdef TEXTURED
     /* Texture coordinates, if needed */
+    #ifdef TEXTURE_ARRAYS
+    #ifdef INSTANCED_TEXTURE_LAYER
+    interpolatedTextureCoords = vec3(textureCoords, float(textureLayer) + instancedTextureLayer);
+    #else
+    interpolatedTextureCoords = vec3(textureCoords, float(textureLayer));
+    #endif
+    #else
     interpolatedTextureCoords = textureCoords;
     #endif
+    #endif
+
+    #ifdef INSTANCED_COLOR
+    /* Per-instance color, if needed */
+    interpolatedInstancedColor = instancedColor.rgb;
+    #endif
 }
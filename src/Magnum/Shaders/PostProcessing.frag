@@ -0,0 +1,118 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Functions of all effects, main() calling the effects of given pass in order
+   is generated by PostProcessingChain */
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 0) uniform mediump sampler2D inputTexture;
+#else
+uniform mediump sampler2D inputTexture;
+#endif
+
+#ifdef TONEMAP
+uniform mediump float exposure;
+#endif
+
+#ifdef COLOR_GRADE
+uniform lowp mat3 colorMatrix;
+uniform lowp vec3 colorOffset;
+#endif
+
+#ifdef VIGNETTE
+uniform lowp float vignetteIntensity;
+uniform lowp float vignetteRadius;
+#endif
+
+out lowp vec4 fragmentColor;
+
+mediump vec4 fetchInput() {
+    return texelFetch(inputTexture, ivec2(gl_FragCoord.xy), 0);
+}
+
+#ifdef TONEMAP
+/* Fit of the ACES filmic curve by Krzysztof Narkowicz */
+mediump vec4 tonemap(mediump vec4 color) {
+    mediump vec3 x = color.rgb*exposure;
+    return vec4(clamp((x*(2.51*x + 0.03))/(x*(2.43*x + 0.59) + 0.14), 0.0, 1.0), color.a);
+}
+#endif
+
+#ifdef COLOR_GRADE
+mediump vec4 colorGrade(mediump vec4 color) {
+    return vec4(colorMatrix*color.rgb + colorOffset, color.a);
+}
+#endif
+
+#ifdef VIGNETTE
+mediump vec4 vignette(mediump vec4 color) {
+    /* Distance from center, 1.0 in the corners */
+    mediump float centerDistance = length(gl_FragCoord.xy/vec2(textureSize(inputTexture, 0)) - vec2(0.5))*1.41421356;
+    return vec4(color.rgb*(1.0 - vignetteIntensity*smoothstep(vignetteRadius, 1.0, centerDistance)), color.a);
+}
+#endif
+
+#ifdef FXAA
+/* Simplified FXAA by Timothy Lottes, blurs along the edge direction estimated
+   from luma of the diagonal neighbors. Reads neighboring pixels, so it is
+   always the first effect of a pass. */
+#define FXAA_REDUCE_MIN (1.0/128.0)
+#define FXAA_REDUCE_MUL (1.0/8.0)
+#define FXAA_SPAN_MAX 8.0
+
+mediump vec4 fxaa() {
+    const mediump vec3 lumaWeights = vec3(0.299, 0.587, 0.114);
+    mediump vec2 inverseSize = 1.0/vec2(textureSize(inputTexture, 0));
+    mediump vec2 position = gl_FragCoord.xy*inverseSize;
+
+    mediump float lumaNW = dot(texture(inputTexture, position + vec2(-1.0, -1.0)*inverseSize).rgb, lumaWeights);
+    mediump float lumaNE = dot(texture(inputTexture, position + vec2(1.0, -1.0)*inverseSize).rgb, lumaWeights);
+    mediump float lumaSW = dot(texture(inputTexture, position + vec2(-1.0, 1.0)*inverseSize).rgb, lumaWeights);
+    mediump float lumaSE = dot(texture(inputTexture, position + vec2(1.0, 1.0)*inverseSize).rgb, lumaWeights);
+    mediump vec4 colorM = texture(inputTexture, position);
+    mediump float lumaM = dot(colorM.rgb, lumaWeights);
+    mediump float lumaMin = min(lumaM, min(min(lumaNW, lumaNE), min(lumaSW, lumaSE)));
+    mediump float lumaMax = max(lumaM, max(max(lumaNW, lumaNE), max(lumaSW, lumaSE)));
+
+    mediump vec2 direction = vec2(-((lumaNW + lumaNE) - (lumaSW + lumaSE)),
+                                    (lumaNW + lumaSW) - (lumaNE + lumaSE));
+    mediump float directionReduce = max((lumaNW + lumaNE + lumaSW + lumaSE)*(0.25*FXAA_REDUCE_MUL), FXAA_REDUCE_MIN);
+    mediump float inverseDirectionMin = 1.0/(min(abs(direction.x), abs(direction.y)) + directionReduce);
+    direction = clamp(direction*inverseDirectionMin, vec2(-FXAA_SPAN_MAX), vec2(FXAA_SPAN_MAX))*inverseSize;
+
+    mediump vec4 colorA = 0.5*(
+        texture(inputTexture, position + direction*(1.0/3.0 - 0.5)) +
+        texture(inputTexture, position + direction*(2.0/3.0 - 0.5)));
+    mediump vec4 colorB = colorA*0.5 + 0.25*(
+        texture(inputTexture, position - direction*0.5) +
+        texture(inputTexture, position + direction*0.5));
+    mediump float lumaB = dot(colorB.rgb, lumaWeights);
+
+    /* The wider blur went outside of the local luma range, it's crossing
+       another edge */
+    if(lumaB < lumaMin || lumaB > lumaMax) return vec4(colorA.rgb, colorM.a);
+    return vec4(colorB.rgb, colorM.a);
+}
+#endif
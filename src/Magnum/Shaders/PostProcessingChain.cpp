@@ -0,0 +1,223 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PostProcessingChain.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Resource.h>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/RenderTargetPool.h"
+#include "Magnum/Shader.h"
+#include "Magnum/Texture.h"
+
+#include "Implementation/CreateCompatibilityShader.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    enum: Int { InputTextureLayer = 0 };
+
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr Version ShaderVersion = Version::GL300;
+    #else
+    constexpr Version ShaderVersion = Version::GLES300;
+    #endif
+
+    /* Effects which read neighboring pixels of their input */
+    bool readsNeighbors(const PostProcessingChain::Effect effect) {
+        return effect == PostProcessingChain::Effect::Fxaa;
+    }
+}
+
+class PostProcessingChain::Pass: public AbstractShaderProgram {
+    public:
+        explicit Pass(const Effect* const effects, const std::size_t count): exposureUniform{-1}, colorMatrixUniform{-1}, colorOffsetUniform{-1}, vignetteIntensityUniform{-1}, vignetteRadiusUniform{-1} {
+            Utility::Resource rs("MagnumShaders");
+
+            Shader vert = Implementation::createCompatibilityShader(rs, ShaderVersion, Shader::Type::Vertex);
+            Shader frag = Implementation::createCompatibilityShader(rs, ShaderVersion, Shader::Type::Fragment);
+            vert.addSource(rs.get("FullScreenTriangle.glsl"))
+                .addSource(rs.get("PostProcessing.vert"));
+
+            /* Enable only the functions used in this pass and generate main()
+               calling them in order. The first effect reads the input,
+               the others transform the color of the previous one. */
+            std::string defines, mainSource = "void main() {\n    mediump vec4 color = ";
+            for(std::size_t i = 0; i != count; ++i) {
+                const char* define = nullptr;
+                const char* function = nullptr;
+                switch(effects[i]) {
+                    case Effect::Tonemap:
+                        define = "TONEMAP";
+                        function = "tonemap";
+                        break;
+                    case Effect::ColorGrade:
+                        define = "COLOR_GRADE";
+                        function = "colorGrade";
+                        break;
+                    case Effect::Vignette:
+                        define = "VIGNETTE";
+                        function = "vignette";
+                        break;
+                    case Effect::Fxaa:
+                        define = "FXAA";
+                        function = "fxaa";
+                        break;
+                }
+
+                defines += std::string{"#ifndef "} + define + "\n#define " + define + "\n#endif\n";
+                if(i == 0) {
+                    if(readsNeighbors(effects[i]))
+                        mainSource += std::string{function} + "();\n";
+                    else
+                        mainSource += std::string{function} + "(fetchInput());\n";
+                } else {
+                    CORRADE_INTERNAL_ASSERT(!readsNeighbors(effects[i]));
+                    mainSource += std::string{"    color = "} + function + "(color);\n";
+                }
+            }
+            mainSource += "    fragmentColor = color;\n}\n";
+
+            frag.addSource(defines)
+                .addSource(rs.get("PostProcessing.frag"))
+                .addSource(mainSource);
+
+            CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+
+            attachShaders({vert, frag});
+            CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+
+            for(std::size_t i = 0; i != count; ++i) switch(effects[i]) {
+                case Effect::Tonemap:
+                    exposureUniform = uniformLocation("exposure");
+                    break;
+                case Effect::ColorGrade:
+                    colorMatrixUniform = uniformLocation("colorMatrix");
+                    colorOffsetUniform = uniformLocation("colorOffset");
+                    break;
+                case Effect::Vignette:
+                    vignetteIntensityUniform = uniformLocation("vignetteIntensity");
+                    vignetteRadiusUniform = uniformLocation("vignetteRadius");
+                    break;
+                case Effect::Fxaa:
+                    break;
+            }
+
+            #ifndef MAGNUM_TARGET_GLES
+            if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::shading_language_420pack>(ShaderVersion))
+            #endif
+            {
+                setUniform(uniformLocation("inputTexture"), InputTextureLayer);
+            }
+        }
+
+        /* Uniforms of effects which are not in this pass are -1, for which
+           setUniform() is a no-op */
+        Pass& setParameters(const PostProcessingChain& chain) {
+            if(exposureUniform != -1)
+                setUniform(exposureUniform, chain._exposure);
+            if(colorMatrixUniform != -1) {
+                setUniform(colorMatrixUniform, chain._colorMatrix);
+                setUniform(colorOffsetUniform, chain._colorOffset);
+            }
+            if(vignetteIntensityUniform != -1) {
+                setUniform(vignetteIntensityUniform, chain._vignetteIntensity);
+                setUniform(vignetteRadiusUniform, chain._vignetteRadius);
+            }
+            return *this;
+        }
+
+    private:
+        Int exposureUniform,
+            colorMatrixUniform,
+            colorOffsetUniform,
+            vignetteIntensityUniform,
+            vignetteRadiusUniform;
+};
+
+PostProcessingChain::PostProcessingChain(std::vector<Effect> effects): _effects{std::move(effects)}, _exposure{1.0f}, _colorMatrix{Matrix3x3::Identity}, _colorOffset{0.0f}, _vignetteIntensity{0.5f}, _vignetteRadius{0.5f}, _intermediateFormat{TextureFormat::RGBA8} {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::framebuffer_object);
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::EXT::gpu_shader4);
+    #else
+    MAGNUM_ASSERT_VERSION_SUPPORTED(Version::GLES300);
+    #endif
+    CORRADE_ASSERT(!_effects.empty(), "Shaders::PostProcessingChain: no effects specified", );
+
+    /* Fuse each effect into the current pass, unless it needs to read
+       neighboring pixels of the previous result, which has to be rendered
+       into a texture first */
+    std::size_t begin = 0;
+    for(std::size_t i = 1; i <= _effects.size(); ++i) {
+        if(i != _effects.size() && !readsNeighbors(_effects[i])) continue;
+        _passes.emplace_back(new Pass{_effects.data() + begin, i - begin});
+        begin = i;
+    }
+
+    /* The vertex positions are generated from gl_VertexID */
+    _fullScreenTriangle.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(3);
+}
+
+PostProcessingChain::PostProcessingChain(PostProcessingChain&&) noexcept = default;
+
+PostProcessingChain::~PostProcessingChain() = default;
+
+PostProcessingChain& PostProcessingChain::operator=(PostProcessingChain&&) noexcept = default;
+
+void PostProcessingChain::draw(Texture2D& input, AbstractFramebuffer& output, RenderTargetPool& pool) {
+    const Vector2i size = output.viewport().size();
+
+    Texture2D* source = &input;
+    for(std::size_t i = 0; i != _passes.size(); ++i) {
+        /* All passes except the last one render into an intermediate
+           texture */
+        Texture2D* target = nullptr;
+        Framebuffer* framebuffer = nullptr;
+        if(i + 1 != _passes.size()) {
+            target = &pool.texture(size, _intermediateFormat);
+            framebuffer = &pool.framebuffer(size);
+            framebuffer->attachTexture(Framebuffer::ColorAttachment(0), *target, 0);
+            framebuffer->bind(FramebufferTarget::Draw);
+        } else output.bind(FramebufferTarget::Draw);
+
+        source->bind(InputTextureLayer);
+        _fullScreenTriangle.draw(_passes[i]->setParameters(*this));
+
+        /* The previous intermediate result is not needed anymore, so the
+           following passes can reuse it */
+        if(framebuffer) pool.release(*framebuffer);
+        if(source != &input) pool.release(*source);
+        source = target;
+    }
+}
+
+}}
+#endif
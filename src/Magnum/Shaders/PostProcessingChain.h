@@ -0,0 +1,257 @@
+#ifndef Magnum_Shaders_PostProcessingChain_h
+#define Magnum_Shaders_PostProcessingChain_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::PostProcessingChain
+ */
+#endif
+
+#include <memory>
+#include <vector>
+
+#include "Magnum/Color.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Math/Matrix.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Post-processing chain
+
+Applies a sequence of full-screen effects to a texture and writes the result
+into a framebuffer. Instead of drawing each effect in a separate pass with
+its own framebuffer round trip, effects which need only the current pixel
+of their input are fused together with the preceding effect into a single
+generated shader. A new pass is started only before an effect that reads
+neighboring pixels, such as @ref Effect::Fxaa, so the chain below is drawn
+in two passes instead of four:
+@code
+Shaders::PostProcessingChain postprocessing{{
+    Shaders::PostProcessingChain::Effect::Tonemap,
+    Shaders::PostProcessingChain::Effect::ColorGrade,
+    Shaders::PostProcessingChain::Effect::Fxaa,
+    Shaders::PostProcessingChain::Effect::Vignette}};
+postprocessing.setExposure(1.5f)
+    .setColorMatrix(Matrix3x3{Matrix3x3::Identity, 1.1f})
+    .setVignette(0.3f, 0.6f);
+
+RenderTargetPool pool;
+
+// Each frame, after the scene is rendered into hdrColor
+Renderer::disable(Renderer::Feature::DepthTest);
+postprocessing.draw(hdrColor, defaultFramebuffer, pool);
+pool.nextFrame();
+@endcode
+
+Intermediate results between passes are rendered into textures acquired from
+given @ref RenderTargetPool, which are released as soon as the following
+pass is drawn, so they can be reused by subsequent passes and other users of
+the pool. The input texture is expected to have the same size as the output
+framebuffer viewport, intermediate textures have the same size and format
+set with @ref setIntermediateFormat(). The passes are drawn with a single
+triangle covering the whole viewport, the depth test is expected to be
+disabled and blending is not changed.
+
+@requires_gl30 Extension @extension{ARB,framebuffer_object} and
+    @extension{EXT,gpu_shader4}
+@requires_gles30 Texel fetch in shaders is not available in OpenGL ES
+    2.0.
+@see @ref MeshTools::fullScreenTriangle()
+*/
+class MAGNUM_SHADERS_EXPORT PostProcessingChain {
+    public:
+        /**
+         * @brief Effect
+         *
+         * @see @ref PostProcessingChain()
+         */
+        enum class Effect: UnsignedByte {
+            /**
+             * Filmic tone mapping of HDR input to the @f$ [0, 1] @f$ range,
+             * after multiplying it with exposure set by @ref setExposure().
+             * Doesn't do any gamma correction.
+             */
+            Tonemap,
+
+            /**
+             * Color transformation with matrix and offset set by
+             * @ref setColorMatrix() and @ref setColorOffset(), for
+             * adjusting saturation, contrast, white balance etc.
+             */
+            ColorGrade,
+
+            /**
+             * Darkening of the image toward its corners, see
+             * @ref setVignette().
+             */
+            Vignette,
+
+            /**
+             * Fast approximate antialiasing of color edges. Reads
+             * neighboring pixels of its input, thus it always begins a new
+             * pass, unless it is the first effect in the chain. Expects the
+             * input in range @f$ [0, 1] @f$, so it is usually placed after
+             * @ref Effect::Tonemap. The texture passed to @ref draw() should
+             * have linear filtering if this is the first effect.
+             */
+            Fxaa
+        };
+
+        /**
+         * @brief Constructor
+         * @param effects   Effects in order in which they are applied
+         *
+         * Splits the effects into passes and compiles a shader for each of
+         * them. Expects that @p effects is not empty.
+         */
+        explicit PostProcessingChain(std::vector<Effect> effects);
+
+        /** @brief Copying is not allowed */
+        PostProcessingChain(const PostProcessingChain&) = delete;
+
+        /** @brief Move constructor */
+        PostProcessingChain(PostProcessingChain&&) noexcept;
+
+        ~PostProcessingChain();
+
+        /** @brief Copying is not allowed */
+        PostProcessingChain& operator=(const PostProcessingChain&) = delete;
+
+        /** @brief Move assignment */
+        PostProcessingChain& operator=(PostProcessingChain&&) noexcept;
+
+        /** @brief Effects */
+        const std::vector<Effect>& effects() const { return _effects; }
+
+        /**
+         * @brief Count of passes
+         *
+         * Count of full-screen draws done in @ref draw().
+         */
+        std::size_t passCount() const { return _passes.size(); }
+
+        /**
+         * @brief Set exposure
+         * @return Reference to self (for method chaining)
+         *
+         * Used by @ref Effect::Tonemap. Default is `1.0f`.
+         */
+        PostProcessingChain& setExposure(Float exposure) {
+            _exposure = exposure;
+            return *this;
+        }
+
+        /**
+         * @brief Set color grading matrix
+         * @return Reference to self (for method chaining)
+         *
+         * Used by @ref Effect::ColorGrade. Default is identity.
+         */
+        PostProcessingChain& setColorMatrix(const Matrix3x3& matrix) {
+            _colorMatrix = matrix;
+            return *this;
+        }
+
+        /**
+         * @brief Set color grading offset
+         * @return Reference to self (for method chaining)
+         *
+         * Added after transforming the color with @ref setColorMatrix().
+         * Used by @ref Effect::ColorGrade. Default is black.
+         */
+        PostProcessingChain& setColorOffset(const Color3& offset) {
+            _colorOffset = offset;
+            return *this;
+        }
+
+        /**
+         * @brief Set vignette parameters
+         * @param intensity     How much the corners are darkened, `0.0f`
+         *      disables the effect, `1.0f` makes the corners black
+         * @param radius        Distance from the center where the darkening
+         *      starts, `1.0f` is the corner
+         * @return Reference to self (for method chaining)
+         *
+         * Used by @ref Effect::Vignette. Default is `0.5f` for intensity and
+         * `0.5f` for radius.
+         */
+        PostProcessingChain& setVignette(Float intensity, Float radius) {
+            _vignetteIntensity = intensity;
+            _vignetteRadius = radius;
+            return *this;
+        }
+
+        /**
+         * @brief Set intermediate texture format
+         * @return Reference to self (for method chaining)
+         *
+         * Format of textures between passes. Default is
+         * @ref TextureFormat::RGBA8, use a floating-point format if the
+         * values between passes are not in range @f$ [0, 1] @f$.
+         */
+        PostProcessingChain& setIntermediateFormat(TextureFormat format) {
+            _intermediateFormat = format;
+            return *this;
+        }
+
+        /**
+         * @brief Draw the chain
+         * @param input     Input texture
+         * @param output    Output framebuffer
+         * @param pool      Pool for intermediate textures and framebuffers
+         *
+         * Draws all passes, the last one into viewport of @p output. The
+         * input texture is bound to texture unit `0`.
+         */
+        void draw(Texture2D& input, AbstractFramebuffer& output, RenderTargetPool& pool);
+
+    private:
+        class Pass;
+
+        std::vector<Effect> _effects;
+        std::vector<std::unique_ptr<Pass>> _passes;
+        Mesh _fullScreenTriangle;
+
+        Float _exposure;
+        Matrix3x3 _colorMatrix;
+        Color3 _colorOffset;
+        Float _vignetteIntensity,
+            _vignetteRadius;
+        TextureFormat _intermediateFormat;
+};
+
+}}
+#else
+#error this header is not available on OpenGL ES 2.0 build
+#endif
+
+#endif
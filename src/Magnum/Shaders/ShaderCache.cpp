@@ -0,0 +1,157 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ShaderCache.h"
+
+#include <map>
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    ShaderCache* currentInstance = nullptr;
+
+    template<class T> struct Variant {
+        std::shared_ptr<T> shader;
+        bool pending;
+    };
+
+    /* Key is flags and joint count */
+    template<class T> using Variants = std::map<std::pair<UnsignedInt, UnsignedInt>, Variant<T>>;
+
+    template<class T> bool isFinished(const Variants<T>& variants) {
+        for(const auto& v: variants)
+            if(v.second.pending && !v.second.shader->isLinkFinished()) return false;
+        return true;
+    }
+
+    template<class T> std::size_t freeUnused(Variants<T>& variants) {
+        std::size_t count = 0;
+        for(auto it = variants.begin(); it != variants.end(); ) {
+            if(!it->second.pending && it->second.shader.use_count() == 1) {
+                it = variants.erase(it);
+                ++count;
+            } else ++it;
+        }
+        return count;
+    }
+}
+
+struct ShaderCache::State {
+    Variants<Flat2D> flat2D;
+    Variants<Flat3D> flat3D;
+    Variants<Phong> phong;
+};
+
+ShaderCache& ShaderCache::instance() {
+    CORRADE_ASSERT(currentInstance, "Shaders::ShaderCache::instance(): no instance exists", *currentInstance);
+    return *currentInstance;
+}
+
+ShaderCache::ShaderCache(): _state{new State} {
+    CORRADE_ASSERT(!currentInstance, "Shaders::ShaderCache::ShaderCache(): another instance is already created", );
+    currentInstance = this;
+}
+
+ShaderCache::~ShaderCache() {
+    CORRADE_INTERNAL_ASSERT(currentInstance == this);
+    currentInstance = nullptr;
+}
+
+std::size_t ShaderCache::count() const {
+    return _state->flat2D.size() + _state->flat3D.size() + _state->phong.size();
+}
+
+template<class T, class Variants> std::shared_ptr<T> ShaderCache::variant(Variants& variants, const typename T::Flags flags, UnsignedInt jointCount, const bool precompile) {
+    #ifndef MAGNUM_TARGET_GLES2
+    if(!(flags & T::Flag::Skinning)) jointCount = 0;
+    #else
+    jointCount = 0;
+    #endif
+
+    const std::pair<UnsignedInt, UnsignedInt> key{UnsignedInt(typename T::Flags::UnderlyingType(flags)), jointCount};
+    auto found = variants.find(key);
+
+    /* Not cached yet. If precompiling, only submit the linking, otherwise
+       wait for the compilation to get the errors reported early */
+    if(found == variants.end()) {
+        found = variants.emplace(key, Variant<T>{std::shared_ptr<T>{new T{flags, jointCount, precompile}}, true}).first;
+        if(precompile) return found->second.shader;
+    } else if(precompile || !found->second.pending) return found->second.shader;
+
+    found->second.shader->finalize();
+    found->second.pending = false;
+    return found->second.shader;
+}
+
+template<class Variants> void ShaderCache::finish(Variants& variants) {
+    for(auto& v: variants) {
+        if(!v.second.pending) continue;
+        v.second.shader->finalize();
+        v.second.pending = false;
+    }
+}
+
+std::shared_ptr<Flat2D> ShaderCache::flat2D(const Flat2D::Flags flags) {
+    return variant<Flat2D>(_state->flat2D, flags, 0, false);
+}
+
+std::shared_ptr<Flat3D> ShaderCache::flat3D(const Flat3D::Flags flags, const UnsignedInt jointCount) {
+    return variant<Flat3D>(_state->flat3D, flags, jointCount, false);
+}
+
+std::shared_ptr<Phong> ShaderCache::phong(const Phong::Flags flags, const UnsignedInt jointCount) {
+    return variant<Phong>(_state->phong, flags, jointCount, false);
+}
+
+ShaderCache& ShaderCache::precompileFlat2D(const Flat2D::Flags flags) {
+    variant<Flat2D>(_state->flat2D, flags, 0, true);
+    return *this;
+}
+
+ShaderCache& ShaderCache::precompileFlat3D(const Flat3D::Flags flags, const UnsignedInt jointCount) {
+    variant<Flat3D>(_state->flat3D, flags, jointCount, true);
+    return *this;
+}
+
+ShaderCache& ShaderCache::precompilePhong(const Phong::Flags flags, const UnsignedInt jointCount) {
+    variant<Phong>(_state->phong, flags, jointCount, true);
+    return *this;
+}
+
+bool ShaderCache::isPrecompilationFinished() const {
+    return isFinished(_state->flat2D) && isFinished(_state->flat3D) && isFinished(_state->phong);
+}
+
+void ShaderCache::finishPrecompilation() {
+    finish(_state->flat2D);
+    finish(_state->flat3D);
+    finish(_state->phong);
+}
+
+std::size_t ShaderCache::free() {
+    return freeUnused(_state->flat2D) + freeUnused(_state->flat3D) + freeUnused(_state->phong);
+}
+
+}}
@@ -0,0 +1,220 @@
+#ifndef Magnum_Shaders_ShaderCache_h
+#define Magnum_Shaders_ShaderCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::ShaderCache
+ */
+
+#include <memory>
+
+#include "Magnum/Shaders/Flat.h"
+#include "Magnum/Shaders/Phong.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Shader variant cache
+
+Hands out shared instances of @ref Flat and @ref Phong shaders, so each
+combination of shader class, flags and joint count is compiled and linked only
+once. The cache is meant to be created once in the application; the
+instance is then accessible through @ref instance(), similarly to
+@ref ResourceManager.
+@code
+Shaders::ShaderCache cache;
+
+// ...
+
+std::shared_ptr<Shaders::Phong> shader = Shaders::ShaderCache::instance()
+    .phong(Shaders::Phong::Flag::DiffuseTexture);
+@endcode
+
+@section Shaders-ShaderCache-precompilation Precompilation
+
+Variants that are known to be needed can be declared upfront. Compilation and
+linking of all of them is then submitted without waiting for the result, which
+allows the driver to process them in parallel if
+@extension{KHR,parallel_shader_compile} is supported. Poll
+@ref isPrecompilationFinished() e.g. from a loading screen and call
+@ref finishPrecompilation() afterwards. Retrieving a variant that is still
+being precompiled waits only for the variant itself.
+@code
+cache.precompilePhong({})
+    .precompilePhong(Shaders::Phong::Flag::DiffuseTexture)
+    .precompileFlat3D(Shaders::Flat3D::Flag::Textured);
+
+while(!cache.isPrecompilationFinished()) drawLoadingScreen();
+cache.finishPrecompilation();
+@endcode
+
+If the @ref AbstractShaderProgram::setBinaryCacheDirectory() "program binary cache"
+is enabled, the precompiled programs are loaded from it on subsequent runs
+instead of being linked again.
+
+The cached variants are kept alive until the cache is destroyed, use
+@ref free() to release the variants that are not used anywhere else.
+*/
+class MAGNUM_SHADERS_EXPORT ShaderCache {
+    public:
+        /**
+         * @brief Global instance
+         *
+         * Expects that the instance exists.
+         */
+        static ShaderCache& instance();
+
+        /**
+         * @brief Constructor
+         *
+         * Sets global instance pointer to itself.
+         * @attention Only one instance can be created at a time.
+         * @see @ref instance()
+         */
+        explicit ShaderCache();
+
+        /** @brief Copying is not allowed */
+        ShaderCache(const ShaderCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        ShaderCache(ShaderCache&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Sets global instance pointer to `nullptr`. Shader instances that
+         * are still shared elsewhere stay valid.
+         */
+        ~ShaderCache();
+
+        /** @brief Copying is not allowed */
+        ShaderCache& operator=(const ShaderCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        ShaderCache& operator=(ShaderCache&&) = delete;
+
+        /**
+         * @brief Count of cached variants
+         *
+         * Including variants that are still being precompiled.
+         */
+        std::size_t count() const;
+
+        /**
+         * @brief 2D flat shader variant
+         *
+         * Creates the variant if it's not cached yet, waits for its
+         * precompilation if it's still in progress.
+         * @see @ref precompileFlat2D()
+         */
+        std::shared_ptr<Flat2D> flat2D(Flat2D::Flags flags = Flat2D::Flags());
+
+        /**
+         * @brief 3D flat shader variant
+         *
+         * Creates the variant if it's not cached yet, waits for its
+         * precompilation if it's still in progress. The @p jointCount is
+         * ignored if @ref Flat3D::Flag::Skinning is not set.
+         * @see @ref precompileFlat3D()
+         */
+        std::shared_ptr<Flat3D> flat3D(Flat3D::Flags flags = Flat3D::Flags(), UnsignedInt jointCount = 0);
+
+        /**
+         * @brief Phong shader variant
+         *
+         * Creates the variant if it's not cached yet, waits for its
+         * precompilation if it's still in progress. The @p jointCount is
+         * ignored if @ref Phong::Flag::Skinning is not set.
+         * @see @ref precompilePhong()
+         */
+        std::shared_ptr<Phong> phong(Phong::Flags flags = Phong::Flags(), UnsignedInt jointCount = 0);
+
+        /**
+         * @brief Precompile 2D flat shader variant
+         * @return Reference to self (for method chaining)
+         *
+         * Submits compilation and linking of the variant if it's not cached
+         * yet, does nothing otherwise.
+         * @see @ref isPrecompilationFinished(), @ref finishPrecompilation()
+         */
+        ShaderCache& precompileFlat2D(Flat2D::Flags flags);
+
+        /**
+         * @brief Precompile 3D flat shader variant
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref precompileFlat2D() for more information.
+         */
+        ShaderCache& precompileFlat3D(Flat3D::Flags flags, UnsignedInt jointCount = 0);
+
+        /**
+         * @brief Precompile Phong shader variant
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref precompileFlat2D() for more information.
+         */
+        ShaderCache& precompilePhong(Phong::Flags flags, UnsignedInt jointCount = 0);
+
+        /**
+         * @brief Whether precompilation of all variants is finished
+         *
+         * Never blocks. Without @extension{KHR,parallel_shader_compile}
+         * always returns `true`.
+         * @see @ref AbstractShaderProgram::isLinkFinished()
+         */
+        bool isPrecompilationFinished() const;
+
+        /**
+         * @brief Finish precompilation of all variants
+         *
+         * Waits for all variants submitted with @ref precompileFlat2D(),
+         * @ref precompileFlat3D() and @ref precompilePhong() to finish
+         * linking and sets them up.
+         */
+        void finishPrecompilation();
+
+        /**
+         * @brief Free unused variants
+         * @return Count of freed variants
+         *
+         * Removes all variants that are not referenced outside of the cache.
+         * Variants that are still being precompiled are kept.
+         */
+        std::size_t free();
+
+    private:
+        struct State;
+
+        template<class T, class Variants> static std::shared_ptr<T> variant(Variants& variants, typename T::Flags flags, UnsignedInt jointCount, bool precompile);
+        template<class Variants> static void finish(Variants& variants);
+
+        std::unique_ptr<State> _state;
+};
+
+}}
+
+#endif
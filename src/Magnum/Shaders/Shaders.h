@@ -48,8 +48,39 @@ typedef Flat<3> Flat3D;
 
 /* Generic is used only statically */
 
+#ifndef MAGNUM_TARGET_GLES2
+class CascadedShadowMap;
+class DeferredGeometry;
+class DeferredLighting;
+#endif
+class Depth;
+#ifndef MAGNUM_TARGET_GLES2
+class DynamicResolution;
+class GBuffer;
+class Impostor;
+#endif
+class LightClusterGrid;
 class MeshVisualizer;
+#ifndef MAGNUM_TARGET_GLES2
+class ParticleSystem;
+#endif
 class Phong;
+#ifndef MAGNUM_TARGET_GLES2
+class PostProcessingChain;
+#endif
+class ShaderCache;
+class ShadowCascades;
+#ifndef MAGNUM_TARGET_GLES2
+class SpriteBatch;
+class TransparencyBuffer;
+class TransparencyCompositing;
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+template<UnsignedInt> class TransformationProjectionUniform;
+typedef TransformationProjectionUniform<2> TransformationProjectionUniform2D;
+typedef TransformationProjectionUniform<3> TransformationProjectionUniform3D;
+#endif
 
 template<UnsignedInt> class Vector;
 typedef Vector<2> Vector2D;
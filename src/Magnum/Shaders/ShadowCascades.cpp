@@ -0,0 +1,130 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ShadowCascades.h"
+
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace Shaders {
+
+ShadowCascades::ShadowCascades(const UnsignedInt cascadeCount, const Float splitLambda): _cascadeCount{cascadeCount}, _splitLambda{splitLambda}, _shadowDistance{}, _casterExtension{} {
+    CORRADE_ASSERT(cascadeCount && cascadeCount <= MaxCascadeCount,
+        "Shaders::ShadowCascades: expected cascade count in range [1, 4], got" << cascadeCount, );
+}
+
+void ShadowCascades::fit(const Matrix4& cameraMatrix, const Matrix4& projectionMatrix, const Vector3& lightDirection, const Int resolution) {
+    CORRADE_ASSERT(resolution > 0,
+        "Shaders::ShadowCascades::fit(): expected positive resolution", );
+
+    /* Near and far plane of Matrix4::perspectiveProjection() */
+    const Float near = projectionMatrix[3][2]/(projectionMatrix[2][2] - 1.0f);
+    const Float frustumFar = projectionMatrix[3][2]/(projectionMatrix[2][2] + 1.0f);
+    const Float far = _shadowDistance > 0.0f ? Math::min(_shadowDistance, frustumFar) : frustumFar;
+
+    /* World-space corners of the frustum on near and far plane. View depth
+       is linear along the line between matching corners. */
+    const Matrix4 inverseCameraMatrix = cameraMatrix.invertedRigid();
+    const Matrix4 unprojection = inverseCameraMatrix*projectionMatrix.inverted();
+    Vector3 nearCorners[4], farCorners[4];
+    for(std::size_t i = 0; i != 4; ++i) {
+        const Vector2 xy{i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f};
+        const Vector4 nearCorner = unprojection*Vector4{Vector3{xy, -1.0f}, 1.0f};
+        const Vector4 farCorner = unprojection*Vector4{Vector3{xy, 1.0f}, 1.0f};
+        nearCorners[i] = nearCorner.xyz()/nearCorner.w();
+        farCorners[i] = farCorner.xyz()/farCorner.w();
+    }
+
+    /* Rotation-only light frame, the light shines along -Z. Choose a
+       different up vector if the light is close to vertical. */
+    const Vector3 direction = lightDirection.normalized();
+    const Vector3 up = std::abs(direction.y()) > 0.99f ? Vector3::xAxis() : Vector3::yAxis();
+    const Matrix4 lightRotation = Matrix4::lookAt({}, direction, up).invertedRigid();
+
+    /* Maps [-1, 1] clip coordinates to [0, 1] texture coordinates */
+    const Matrix4 bias = Matrix4::translation(Vector3{0.5f})*Matrix4::scaling(Vector3{0.5f});
+
+    _lightViewMatrices.resize(_cascadeCount);
+    _lightProjectionMatrices.resize(_cascadeCount);
+    _shadowMatrices.resize(_cascadeCount);
+
+    Float splitNear = near;
+    for(UnsignedInt i = 0; i != _cascadeCount; ++i) {
+        /* Practical split scheme, blending uniform and logarithmic split */
+        const Float t = Float(i + 1)/_cascadeCount;
+        const Float splitFar = Math::lerp(near + (far - near)*t, near*std::pow(far/near, t), _splitLambda);
+
+        /* Bounding sphere of the slice corners, the radius is rounded to
+           avoid size changes from precision issues as the camera rotates */
+        Vector3 corners[8];
+        Vector3 center;
+        for(std::size_t j = 0; j != 4; ++j) {
+            corners[2*j] = Math::lerp(nearCorners[j], farCorners[j], (splitNear - near)/(frustumFar - near));
+            corners[2*j + 1] = Math::lerp(nearCorners[j], farCorners[j], (splitFar - near)/(frustumFar - near));
+            center += corners[2*j] + corners[2*j + 1];
+        }
+        center /= 8.0f;
+        Float radius = 0.0f;
+        for(const Vector3& corner: corners)
+            radius = Math::max(radius, (corner - center).length());
+        radius = std::ceil(radius*16.0f)/16.0f;
+
+        /* Snap the center to shadow map texels in the light frame, so the
+           shadow edges don't shimmer when the camera moves */
+        const Float texelSize = 2.0f*radius/Float(resolution);
+        Vector3 lightCenter = lightRotation.transformPoint(center);
+        lightCenter.x() = std::floor(lightCenter.x()/texelSize)*texelSize;
+        lightCenter.y() = std::floor(lightCenter.y()/texelSize)*texelSize;
+
+        /* Place the light just behind the sphere and extend the range
+           towards the light */
+        const Float depthRange = 2.0f*radius + _casterExtension;
+        _lightViewMatrices[i] = Matrix4::translation(-lightCenter - Vector3::zAxis(radius + _casterExtension))*lightRotation;
+        _lightProjectionMatrices[i] = Matrix4::orthographicProjection(Vector2{2.0f*radius}, 0.0f, depthRange);
+        _shadowMatrices[i] = bias*_lightProjectionMatrices[i]*_lightViewMatrices[i]*inverseCameraMatrix;
+        _splitDepths[i] = splitFar;
+
+        splitNear = splitFar;
+    }
+
+    for(UnsignedInt i = _cascadeCount; i != MaxCascadeCount; ++i)
+        _splitDepths[i] = _splitDepths[_cascadeCount - 1];
+}
+
+Matrix4 ShadowCascades::lightViewMatrix(const UnsignedInt cascade) const {
+    CORRADE_ASSERT(cascade < _lightViewMatrices.size(),
+        "Shaders::ShadowCascades::lightViewMatrix(): index" << cascade << "out of range for" << _lightViewMatrices.size() << "fitted cascades", {});
+    return _lightViewMatrices[cascade];
+}
+
+Matrix4 ShadowCascades::lightProjectionMatrix(const UnsignedInt cascade) const {
+    CORRADE_ASSERT(cascade < _lightProjectionMatrices.size(),
+        "Shaders::ShadowCascades::lightProjectionMatrix(): index" << cascade << "out of range for" << _lightProjectionMatrices.size() << "fitted cascades", {});
+    return _lightProjectionMatrices[cascade];
+}
+
+}}
@@ -0,0 +1,187 @@
+#ifndef Magnum_Shaders_ShadowCascades_h
+#define Magnum_Shaders_ShadowCascades_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shaders::ShadowCascades
+ */
+
+#include <vector>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Shadow cascades
+
+Splits the view frustum of a perspective camera into depth ranges and fits an
+orthographic directional light projection to each of them. The result is
+meant to be rendered into with @ref CascadedShadowMap and consumed by
+@ref Phong with @ref Phong::Flag::Shadows enabled.
+
+The split distances are a blend between uniform and logarithmic distribution
+controlled by @ref splitLambda(). Each cascade projection encloses a bounding
+sphere of its frustum slice and is snapped to shadow map texels, so the
+shadows don't shimmer when the camera moves or rotates. Example usage with
+@ref SceneGraph::Camera3D "SceneGraph::Camera3D":
+@code
+Shaders::ShadowCascades cascades{4};
+cascades.setShadowDistance(200.0f);
+
+// Each frame
+cascades.fit(camera.cameraMatrix(), camera.projectionMatrix(), sunDirection, 2048);
+@endcode
+*/
+class MAGNUM_SHADERS_EXPORT ShadowCascades {
+    public:
+        /** @brief Max supported cascade count */
+        enum: UnsignedInt { MaxCascadeCount = 4 };
+
+        /**
+         * @brief Constructor
+         * @param cascadeCount  Cascade count. Expected to be in range
+         *      @f$ [1, 4] @f$.
+         * @param splitLambda   Blend factor between uniform (`0.0f`) and
+         *      logarithmic (`1.0f`) split distribution
+         */
+        explicit ShadowCascades(UnsignedInt cascadeCount = 4, Float splitLambda = 0.75f);
+
+        /** @brief Cascade count */
+        UnsignedInt cascadeCount() const { return _cascadeCount; }
+
+        /** @brief Split distribution blend factor */
+        Float splitLambda() const { return _splitLambda; }
+
+        /** @brief Max shadow distance */
+        Float shadowDistance() const { return _shadowDistance; }
+
+        /**
+         * @brief Set max shadow distance
+         * @return Reference to self (for method chaining)
+         *
+         * Only the part of view frustum closer than @p distance is covered
+         * by the cascades, the rest is not shadowed. If set to `0.0f`, the
+         * whole frustum up to the far plane is covered. Default is `0.0f`.
+         */
+        ShadowCascades& setShadowDistance(Float distance) {
+            _shadowDistance = distance;
+            return *this;
+        }
+
+        /** @brief Caster extension */
+        Float casterExtension() const { return _casterExtension; }
+
+        /**
+         * @brief Set caster extension
+         * @return Reference to self (for method chaining)
+         *
+         * Distance by which the light projection of each cascade is extended
+         * towards the light, so objects outside of the view frustum can
+         * still cast shadows into it. Default is `0.0f`.
+         */
+        ShadowCascades& setCasterExtension(Float distance) {
+            _casterExtension = distance;
+            return *this;
+        }
+
+        /**
+         * @brief Fit the cascades to a camera frustum
+         * @param cameraMatrix      Camera matrix, transforming from world to
+         *      view space
+         * @param projectionMatrix  Perspective projection matrix
+         * @param lightDirection    Direction in which the light shines, in
+         *      world space. Doesn't need to be normalized.
+         * @param resolution        Resolution of the shadow map, used for
+         *      texel snapping
+         *
+         * Near and far plane distance are extracted from the projection
+         * matrix, which is expected to be created with
+         * @ref Matrix4::perspectiveProjection(). Needs to be called again
+         * every time the camera or light changes.
+         */
+        void fit(const Matrix4& cameraMatrix, const Matrix4& projectionMatrix, const Vector3& lightDirection, Int resolution);
+
+        /**
+         * @brief Split depths
+         *
+         * View-space distance of the far end of each cascade. Items after
+         * @ref cascadeCount() are set to the same value as the last cascade.
+         */
+        Vector4 splitDepths() const { return _splitDepths; }
+
+        /**
+         * @brief Light view matrix of given cascade
+         *
+         * Transforms from world space to light space.
+         * @see @ref lightProjectionMatrix(), @ref lightMatrix()
+         */
+        Matrix4 lightViewMatrix(UnsignedInt cascade) const;
+
+        /**
+         * @brief Light projection matrix of given cascade
+         *
+         * Orthographic projection enclosing the cascade.
+         * @see @ref lightViewMatrix(), @ref lightMatrix()
+         */
+        Matrix4 lightProjectionMatrix(UnsignedInt cascade) const;
+
+        /**
+         * @brief Light matrix of given cascade
+         *
+         * Combined @ref lightProjectionMatrix() and @ref lightViewMatrix(),
+         * meant to be multiplied with object transformation and passed to
+         * @ref Depth::setTransformationProjectionMatrix() when rendering the
+         * shadow map.
+         */
+        Matrix4 lightMatrix(UnsignedInt cascade) const {
+            return lightProjectionMatrix(cascade)*lightViewMatrix(cascade);
+        }
+
+        /**
+         * @brief Shadow matrices
+         *
+         * One matrix for each cascade, transforming view-space position of
+         * the camera passed to @ref fit() to shadow map texture coordinates
+         * and depth in range @f$ [0, 1] @f$. Meant to be passed to
+         * @ref Phong::setShadowMatrices().
+         */
+        const std::vector<Matrix4>& shadowMatrices() const { return _shadowMatrices; }
+
+    private:
+        UnsignedInt _cascadeCount;
+        Float _splitLambda, _shadowDistance, _casterExtension;
+        Vector4 _splitDepths;
+        std::vector<Matrix4> _lightViewMatrices,
+            _lightProjectionMatrices,
+            _shadowMatrices;
+};
+
+}}
+
+#endif
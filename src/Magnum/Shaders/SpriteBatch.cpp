@@ -0,0 +1,177 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include "SpriteBatch.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/BufferRing.h"
+#include "Magnum/MeshView.h"
+#include "Magnum/Texture.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Shaders/Flat.h"
+#include "Magnum/Shaders/Generic.h"
+#include "Magnum/Shaders/Vector.h"
+
+namespace Magnum { namespace Shaders {
+
+namespace {
+    enum: std::size_t { QuadSize = 4*sizeof(SpriteBatch::Vertex) };
+}
+
+SpriteBatch::SpriteBatch(const UnsignedInt capacity, const UnsignedInt frameCount): _capacity{capacity}, _sorting{Sorting::None}, _ring{new BufferRing{Buffer::TargetHint::Array, GLsizeiptr(capacity*QuadSize), frameCount}}, _indexBuffer{Buffer::TargetHint::ElementArray} {
+    CORRADE_ASSERT(capacity, "Shaders::SpriteBatch: capacity can't be zero", );
+
+    /* The index buffer covers all frame regions of the ring, so the quads
+       can be drawn directly at the offset where they were allocated, without
+       rebinding the vertex buffer */
+    const UnsignedInt quadCount = capacity*frameCount;
+    std::vector<UnsignedInt> indices(quadCount*6);
+    for(UnsignedInt i = 0; i != quadCount; ++i) {
+        UnsignedInt* const quad = &indices[i*6];
+        quad[0] = i*4 + 0;
+        quad[1] = i*4 + 1;
+        quad[2] = i*4 + 2;
+        quad[3] = i*4 + 0;
+        quad[4] = i*4 + 2;
+        quad[5] = i*4 + 3;
+    }
+    _indexBuffer.setData(indices, BufferUsage::StaticDraw);
+
+    _mesh.setPrimitive(MeshPrimitive::Triangles)
+        .addVertexBuffer(_ring->buffer(), 0,
+            Generic2D::Position{},
+            Generic2D::TextureCoordinates{},
+            Generic2D::Color{Generic2D::Color::Components::Four, Generic2D::Color::DataType::UnsignedByte, Generic2D::Color::DataOption::Normalized})
+        .setIndexBuffer(_indexBuffer, 0, Mesh::IndexType::UnsignedInt, 0, quadCount*4 - 1);
+}
+
+SpriteBatch::~SpriteBatch() = default;
+
+SpriteBatch& SpriteBatch::add(Texture2D& texture, const Vector2& position, const Vector2& size, const Rad rotation, const Range2D& textureRectangle, const Color4& color) {
+    const Vector2 halfSize = size*0.5f;
+    const Float cosine = Math::cos(rotation);
+    const Float sine = Math::sin(rotation);
+    const Vector2 x = Vector2{cosine, sine}*halfSize.x();
+    const Vector2 y = Vector2{-sine, cosine}*halfSize.y();
+    const Color4ub c = Math::denormalize<Color4ub>(color);
+
+    _vertices.push_back({position - x - y, textureRectangle.bottomLeft(), c});
+    _vertices.push_back({position + x - y, textureRectangle.bottomRight(), c});
+    _vertices.push_back({position + x + y, textureRectangle.topRight(), c});
+    _vertices.push_back({position - x + y, textureRectangle.topLeft(), c});
+    _textures.push_back(&texture);
+    return *this;
+}
+
+SpriteBatch& SpriteBatch::add(Texture2D& texture, const Range2D& rectangle, const Range2D& textureRectangle, const Color4& color) {
+    const Color4ub c = Math::denormalize<Color4ub>(color);
+
+    _vertices.push_back({rectangle.bottomLeft(), textureRectangle.bottomLeft(), c});
+    _vertices.push_back({rectangle.bottomRight(), textureRectangle.bottomRight(), c});
+    _vertices.push_back({rectangle.topRight(), textureRectangle.topRight(), c});
+    _vertices.push_back({rectangle.topLeft(), textureRectangle.topLeft(), c});
+    _textures.push_back(&texture);
+    return *this;
+}
+
+void SpriteBatch::draw(Flat2D& shader) {
+    CORRADE_ASSERT((shader.flags() & (Flat2D::Flag::Textured|Flat2D::Flag::InstancedColor)) == (Flat2D::Flag::Textured|Flat2D::Flag::InstancedColor),
+        "Shaders::SpriteBatch::draw(): the shader needs to be textured and with instanced color", );
+    drawInternal<Flat2D>(shader, &Flat2D::setTexture);
+}
+
+void SpriteBatch::draw(Vector2D& shader) {
+    drawInternal<Vector2D>(shader, &Vector2D::setVectorTexture);
+}
+
+template<class Shader> void SpriteBatch::drawInternal(Shader& shader, Shader&(Shader::*setTexture)(Texture2D&)) {
+    const std::size_t count = _textures.size();
+    if(!count) return;
+
+    /* Group the sprites by texture, if requested. The sort is stable so the
+       sprites sharing a texture are still drawn in order. */
+    std::vector<UnsignedInt> order;
+    if(_sorting == Sorting::Texture) {
+        order.reserve(count);
+        for(std::size_t i = 0; i != count; ++i) order.push_back(i);
+        std::stable_sort(order.begin(), order.end(), [this](UnsignedInt a, UnsignedInt b) {
+            return std::less<Texture2D*>()(_textures[a], _textures[b]);
+        });
+    }
+    auto sprite = [&order](std::size_t i) -> std::size_t {
+        return order.empty() ? i : order[i];
+    };
+
+    /* Upload and draw at most capacity() sprites at a time */
+    for(std::size_t chunkBegin = 0; chunkBegin < count; chunkBegin += _capacity) {
+        const std::size_t chunkEnd = std::min(count, chunkBegin + _capacity);
+
+        _ring->beginFrame();
+        const BufferRing::Allocation allocation = _ring->allocate((chunkEnd - chunkBegin)*QuadSize, QuadSize);
+        if(order.empty())
+            std::memcpy(allocation.data, _vertices.data() + chunkBegin*4, (chunkEnd - chunkBegin)*QuadSize);
+        else {
+            char* out = static_cast<char*>(allocation.data);
+            for(std::size_t i = chunkBegin; i != chunkEnd; ++i, out += QuadSize)
+                std::memcpy(out, _vertices.data() + order[i]*4, QuadSize);
+        }
+        _ring->flush();
+
+        /* One draw call for each run of sprites with the same texture */
+        const UnsignedInt firstQuad = allocation.offset/QuadSize;
+        MeshView view{_mesh};
+        for(std::size_t runBegin = chunkBegin; runBegin != chunkEnd; ) {
+            Texture2D* const texture = _textures[sprite(runBegin)];
+            std::size_t runEnd = runBegin + 1;
+            while(runEnd != chunkEnd && _textures[sprite(runEnd)] == texture)
+                ++runEnd;
+
+            const UnsignedInt first = firstQuad + (runBegin - chunkBegin);
+            const UnsignedInt runSize = runEnd - runBegin;
+            view.setCount(runSize*6)
+                .setIndexRange(first*6, first*4, (first + runSize)*4 - 1);
+            (shader.*setTexture)(*texture);
+            view.draw(shader);
+
+            runBegin = runEnd;
+        }
+
+        _ring->endFrame();
+    }
+
+    clear();
+}
+
+void SpriteBatch::clear() {
+    _vertices.clear();
+    _textures.clear();
+}
+
+}}
+#endif
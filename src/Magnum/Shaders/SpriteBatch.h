@@ -0,0 +1,244 @@
+#ifndef Magnum_Shaders_SpriteBatch_h
+#define Magnum_Shaders_SpriteBatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::SpriteBatch
+ */
+
+#include <memory>
+#include <vector>
+
+#include "Magnum/Buffer.h"
+#include "Magnum/Color.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Batched 2D sprite renderer
+
+Accumulates textured quads and draws them with as few draw calls as there
+are texture changes, instead of having a separate mesh and set of uniforms
+for each sprite. Each sprite is described by its center, size, rotation,
+rectangle in the texture (e.g. one of rectangles returned from
+@ref TextureTools::atlas(), normalized to texture size) and color. The quads
+are transformed on the CPU and streamed into a @ref BufferRing, sharing one
+static index buffer.
+
+The batch can be drawn either with @ref Flat2D created with
+@ref Flat2D::Flag::Textured and @ref Flat2D::Flag::InstancedColor, in which
+case the sprite color is multiplied with the texture, or with @ref Vector2D,
+which ignores the sprite color and uses its own. Transformation, projection
+and shader color are not touched by the batch, set them before drawing:
+@code
+Shaders::SpriteBatch batch{100000};
+Shaders::Flat2D shader{Shaders::Flat2D::Flag::Textured|Shaders::Flat2D::Flag::InstancedColor};
+
+// 32x32 tile of a 512x512 atlas
+const Range2Di tile = atlas[12];
+const Range2D textureRectangle{Vector2{tile.min()}/512.0f, Vector2{tile.max()}/512.0f};
+
+// Each frame
+for(const Enemy& enemy: enemies)
+    batch.add(atlasTexture, enemy.position, {32.0f, 32.0f}, enemy.rotation, textureRectangle, enemy.tint);
+
+shader.setTransformationProjectionMatrix(projection);
+batch.draw(shader);
+@endcode
+
+## Draw order
+
+With @ref Sorting::None (the default) the sprites are drawn in the order they
+were added and a new draw call is issued each time the texture changes. With
+@ref Sorting::Texture the sprites are grouped by texture, so there is exactly
+one draw call per texture, but only the order of sprites sharing the same
+texture is preserved. Use it when the sprites don't overlap or when the
+overlap is resolved by depth test.
+
+If more sprites than @ref capacity() are added, @ref draw() splits them into
+multiple uploads. Each upload occupies one frame region of the ring buffer,
+so the GPU can still read previous uploads while next ones are written.
+
+@requires_gl30 Extension @extension{ARB,map_buffer_range}
+@requires_gles30 Buffer mapping is not available in OpenGL ES 2.0.
+@requires_webgl20 Buffer mapping is not available in WebGL.
+@see @ref BufferRing
+*/
+class MAGNUM_SHADERS_EXPORT SpriteBatch {
+    public:
+        /**
+         * @brief Sprite sorting
+         *
+         * @see @ref setSorting()
+         */
+        enum class Sorting: UnsignedByte {
+            /** Draw the sprites in order they were added */
+            None,
+
+            /** Group the sprites by texture */
+            Texture
+        };
+
+        /**
+         * @brief Vertex layout
+         *
+         * Layout of one vertex in the vertex buffer, four vertices per
+         * sprite. Position and texture coordinates are bound to
+         * @ref Generic2D::Position and @ref Generic2D::TextureCoordinates,
+         * color to normalized @ref Generic2D::Color.
+         */
+        struct Vertex {
+            Vector2 position;           /**< @brief Position */
+            Vector2 textureCoordinates; /**< @brief Texture coordinates */
+            Color4ub color;             /**< @brief Color */
+        };
+
+        /**
+         * @brief Constructor
+         * @param capacity      Max count of sprites uploaded at once
+         * @param frameCount    Count of uploads in flight
+         *
+         * Allocates a ring buffer of @p capacity*@p frameCount sprites and
+         * the corresponding index buffer.
+         */
+        explicit SpriteBatch(UnsignedInt capacity, UnsignedInt frameCount = 3);
+
+        /** @brief Copying is not allowed */
+        SpriteBatch(const SpriteBatch&) = delete;
+
+        /** @brief Moving is not allowed */
+        SpriteBatch(SpriteBatch&&) = delete;
+
+        ~SpriteBatch();
+
+        /** @brief Copying is not allowed */
+        SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+        /** @brief Moving is not allowed */
+        SpriteBatch& operator=(SpriteBatch&&) = delete;
+
+        /** @brief Max count of sprites uploaded at once */
+        UnsignedInt capacity() const { return _capacity; }
+
+        /** @brief Sprite sorting */
+        Sorting sorting() const { return _sorting; }
+
+        /**
+         * @brief Set sprite sorting
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref Sorting::None.
+         */
+        SpriteBatch& setSorting(Sorting sorting) {
+            _sorting = sorting;
+            return *this;
+        }
+
+        /** @brief Count of sprites added since last @ref draw() */
+        std::size_t size() const { return _textures.size(); }
+
+        /**
+         * @brief Add a sprite
+         * @param texture           Sprite texture
+         * @param position          Sprite center
+         * @param size              Sprite size
+         * @param rotation          Counterclockwise rotation around the
+         *      center
+         * @param textureRectangle  Rectangle in normalized texture
+         *      coordinates
+         * @param color             Sprite color
+         * @return Reference to self (for method chaining)
+         *
+         * The texture is expected to be alive until @ref draw() is called.
+         */
+        SpriteBatch& add(Texture2D& texture, const Vector2& position, const Vector2& size, Rad rotation, const Range2D& textureRectangle = {{}, Vector2{1.0f}}, const Color4& color = Color4{1.0f});
+
+        /**
+         * @brief Add an axis-aligned sprite
+         * @param texture           Sprite texture
+         * @param rectangle         Sprite rectangle
+         * @param textureRectangle  Rectangle in normalized texture
+         *      coordinates
+         * @param color             Sprite color
+         * @return Reference to self (for method chaining)
+         *
+         * Faster alternative to the above for sprites without any rotation.
+         */
+        SpriteBatch& add(Texture2D& texture, const Range2D& rectangle, const Range2D& textureRectangle = {{}, Vector2{1.0f}}, const Color4& color = Color4{1.0f});
+
+        /**
+         * @brief Draw the sprites with flat shader
+         *
+         * Expects that the shader was created with
+         * @ref Flat2D::Flag::Textured and @ref Flat2D::Flag::InstancedColor.
+         * Uploads all sprites added since last call, draws them and clears
+         * the batch.
+         */
+        void draw(Flat2D& shader);
+
+        /**
+         * @brief Draw the sprites with vector shader
+         *
+         * Sprite colors are ignored, the color is taken from the shader.
+         * Uploads all sprites added since last call, draws them and clears
+         * the batch.
+         */
+        void draw(Vector2D& shader);
+
+        /**
+         * @brief Clear the batch
+         *
+         * Discards all sprites added since last @ref draw(). Called
+         * implicitly from @ref draw().
+         */
+        void clear();
+
+    private:
+        template<class Shader> void drawInternal(Shader& shader, Shader&(Shader::*setTexture)(Texture2D&));
+
+        UnsignedInt _capacity;
+        Sorting _sorting;
+
+        std::vector<Vertex> _vertices;
+        std::vector<Texture2D*> _textures;
+
+        std::unique_ptr<BufferRing> _ring;
+        Buffer _indexBuffer;
+        Mesh _mesh;
+};
+
+}}
+#else
+#error this header is not available on OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -0,0 +1,121 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Shaders/DeferredGeometry.h"
+#include "Magnum/Shaders/DeferredLighting.h"
+#include "Magnum/Shaders/GBuffer.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+#include "Magnum/Shaders/resourceImport.hpp"
+#endif
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct DeferredGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit DeferredGLTest();
+
+    void gbuffer();
+
+    void compileGeometry();
+    void compileGeometryDiffuseTexture();
+    void compileGeometryInstanced();
+
+    void compileLighting();
+    void compileLightingVolumes();
+    #ifndef MAGNUM_TARGET_GLES
+    void compileLightingClustered();
+    #endif
+};
+
+DeferredGLTest::DeferredGLTest() {
+    addTests({&DeferredGLTest::gbuffer,
+
+              &DeferredGLTest::compileGeometry,
+              &DeferredGLTest::compileGeometryDiffuseTexture,
+              &DeferredGLTest::compileGeometryInstanced,
+
+              &DeferredGLTest::compileLighting,
+              &DeferredGLTest::compileLightingVolumes,
+              #ifndef MAGNUM_TARGET_GLES
+              &DeferredGLTest::compileLightingClustered
+              #endif
+              });
+}
+
+void DeferredGLTest::gbuffer() {
+    Shaders::GBuffer gbuffer{{128, 64}};
+    CORRADE_COMPARE(gbuffer.size(), (Vector2i{128, 64}));
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(gbuffer.albedoTexture().imageSize(0), (Vector2i{128, 64}));
+    CORRADE_COMPARE(gbuffer.depthTexture().imageSize(0), (Vector2i{128, 64}));
+    #endif
+    CORRADE_COMPARE(gbuffer.framebuffer().checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+
+    gbuffer.bindForWriting();
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void DeferredGLTest::compileGeometry() {
+    Shaders::DeferredGeometry shader;
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void DeferredGLTest::compileGeometryDiffuseTexture() {
+    Shaders::DeferredGeometry shader{Shaders::DeferredGeometry::Flag::DiffuseTexture};
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void DeferredGLTest::compileGeometryInstanced() {
+    Shaders::DeferredGeometry shader{Shaders::DeferredGeometry::Flag::InstancedTransformation};
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void DeferredGLTest::compileLighting() {
+    Shaders::DeferredLighting shader;
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void DeferredGLTest::compileLightingVolumes() {
+    Shaders::DeferredLighting shader{Shaders::DeferredLighting::Flag::LightVolumes};
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void DeferredGLTest::compileLightingClustered() {
+    if(!Context::current()->isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 is not supported.");
+
+    Shaders::DeferredLighting shader{Shaders::DeferredLighting::Flag::ClusteredLights};
+    CORRADE_VERIFY(shader.validate().first);
+}
+#endif
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::DeferredGLTest)
@@ -0,0 +1,95 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Shaders/Depth.h"
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/Shaders/CascadedShadowMap.h"
+#endif
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+#include "Magnum/Shaders/resourceImport.hpp"
+#endif
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct DepthGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit DepthGLTest();
+
+    void compile();
+    #ifndef MAGNUM_TARGET_GLES2
+    void compileInstanced();
+    void cascadedShadowMap();
+    #endif
+};
+
+DepthGLTest::DepthGLTest() {
+    addTests({&DepthGLTest::compile});
+
+    #ifndef MAGNUM_TARGET_GLES2
+    addTests({&DepthGLTest::compileInstanced,
+              &DepthGLTest::cascadedShadowMap});
+    #endif
+}
+
+void DepthGLTest::compile() {
+    Shaders::Depth shader;
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void DepthGLTest::compileInstanced() {
+    Shaders::Depth shader(Shaders::Depth::Flag::InstancedTransformation);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void DepthGLTest::cascadedShadowMap() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::EXT::texture_array>())
+        CORRADE_SKIP(Extensions::GL::EXT::texture_array::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::CascadedShadowMap shadowMap{{256, 256}, 3};
+    CORRADE_COMPARE(shadowMap.size(), (Vector2i{256, 256}));
+    CORRADE_COMPARE(shadowMap.cascadeCount(), 3);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(shadowMap.texture().imageSize(0), (Vector3i{256, 256, 3}));
+    #endif
+
+    for(UnsignedInt i = 0; i != 3; ++i) {
+        CORRADE_COMPARE(shadowMap.framebuffer(i).checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+        shadowMap.bindCascade(i);
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+#endif
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::DepthGLTest)
@@ -37,11 +37,19 @@ struct DistanceFieldVectorGLTest: Magnum::Test::AbstractOpenGLTester {
 
     void compile2D();
     void compile3D();
+    void compile2DVertexColor();
+    void compile3DVertexColor();
+    void compile2DMultichannel();
+    void compile3DMultichannel();
 };
 
 DistanceFieldVectorGLTest::DistanceFieldVectorGLTest() {
     addTests({&DistanceFieldVectorGLTest::compile2D,
-              &DistanceFieldVectorGLTest::compile3D});
+              &DistanceFieldVectorGLTest::compile3D,
+              &DistanceFieldVectorGLTest::compile2DVertexColor,
+              &DistanceFieldVectorGLTest::compile3DVertexColor,
+              &DistanceFieldVectorGLTest::compile2DMultichannel,
+              &DistanceFieldVectorGLTest::compile3DMultichannel});
 }
 
 void DistanceFieldVectorGLTest::compile2D() {
@@ -54,6 +62,26 @@ void DistanceFieldVectorGLTest::compile3D() {
     CORRADE_VERIFY(shader.validate().first);
 }
 
+void DistanceFieldVectorGLTest::compile2DVertexColor() {
+    Shaders::DistanceFieldVector2D shader(Shaders::DistanceFieldVector2D::Flag::VertexColor);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void DistanceFieldVectorGLTest::compile3DVertexColor() {
+    Shaders::DistanceFieldVector3D shader(Shaders::DistanceFieldVector3D::Flag::VertexColor);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void DistanceFieldVectorGLTest::compile2DMultichannel() {
+    Shaders::DistanceFieldVector2D shader(Shaders::DistanceFieldVector2D::Flag::Multichannel);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void DistanceFieldVectorGLTest::compile3DMultichannel() {
+    Shaders::DistanceFieldVector3D shader(Shaders::DistanceFieldVector3D::Flag::Multichannel);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::DistanceFieldVectorGLTest)
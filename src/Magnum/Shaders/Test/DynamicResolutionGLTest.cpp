@@ -0,0 +1,122 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Color.h"
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Image.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/RenderTargetPool.h"
+#include "Magnum/Shaders/DynamicResolution.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+#include "Magnum/Shaders/resourceImport.hpp"
+#endif
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct DynamicResolutionGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit DynamicResolutionGLTest();
+
+    void construct();
+    void scale();
+    void draw();
+};
+
+DynamicResolutionGLTest::DynamicResolutionGLTest() {
+    addTests({&DynamicResolutionGLTest::construct,
+              &DynamicResolutionGLTest::scale,
+              &DynamicResolutionGLTest::draw});
+}
+
+void DynamicResolutionGLTest::construct() {
+    DynamicResolution resolution{{640, 480}, 10.0f};
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(resolution.outputSize(), (Vector2i{640, 480}));
+    CORRADE_COMPARE(resolution.targetFrameTime(), 10.0f);
+    CORRADE_COMPARE(resolution.scale(), 1.0f);
+    CORRADE_COMPARE(resolution.renderSize(), (Vector2i{640, 480}));
+    CORRADE_COMPARE(resolution.gpuFrameTime(), 0.0f);
+}
+
+void DynamicResolutionGLTest::scale() {
+    DynamicResolution resolution{{640, 480}, 10.0f};
+    resolution.setScaleRange(0.25f, 0.75f);
+
+    /* Current scale is clamped to the new range */
+    CORRADE_COMPARE(resolution.scale(), 0.75f);
+    CORRADE_COMPARE(resolution.renderSize(), (Vector2i{480, 360}));
+
+    resolution.setScale(0.1f);
+    CORRADE_COMPARE(resolution.scale(), 0.25f);
+    CORRADE_COMPARE(resolution.renderSize(), (Vector2i{160, 120}));
+
+    /* Never zero */
+    resolution.setOutputSize({2, 2});
+    CORRADE_COMPARE(resolution.renderSize(), (Vector2i{1, 1}));
+}
+
+void DynamicResolutionGLTest::draw() {
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{4});
+    Framebuffer output{{{}, Vector2i{4}}};
+    output.attachRenderbuffer(Framebuffer::ColorAttachment(0), color);
+
+    RenderTargetPool pool;
+    DynamicResolution resolution{Vector2i{4}, 10.0f};
+    resolution.setScale(0.5f)
+        .setSharpness(0.5f);
+
+    Framebuffer& framebuffer = resolution.begin(pool);
+    CORRADE_COMPARE(framebuffer.viewport(), (Range2Di{{}, Vector2i{2}}));
+    Renderer::setClearColor(Color4{0.5f, 0.25f, 1.0f, 1.0f});
+    framebuffer.clear(FramebufferClear::Color|FramebufferClear::Depth);
+
+    Renderer::disable(Renderer::Feature::DepthTest);
+    resolution.end(output, pool);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* The targets are sized for the maximal scale and released */
+    CORRADE_COMPARE(pool.textureCount(), 1);
+    CORRADE_COMPARE(pool.renderbufferCount(), 1);
+    CORRADE_COMPARE(pool.framebufferCount(), 1);
+
+    /* Constant color isn't changed by the upscale nor by sharpening and
+       nothing outside of the rendered part leaks in */
+    Image2D image = output.read({{}, Vector2i{4}}, {ColorFormat::RGBA, ColorType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(image.data<Color4ub>()[0], (Color4ub{128, 64, 255, 255}));
+    CORRADE_COMPARE(image.data<Color4ub>()[15], (Color4ub{128, 64, 255, 255}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::DynamicResolutionGLTest)
@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
 #include "Magnum/Shaders/Flat.h"
 #include "Magnum/Test/AbstractOpenGLTester.h"
 
@@ -39,6 +41,25 @@ struct FlatGLTest: Magnum::Test::AbstractOpenGLTester {
     void compile3D();
     void compile2DTextured();
     void compile3DTextured();
+    #ifndef MAGNUM_TARGET_GLES2
+    void compile2DUniformBuffers();
+    void compile3DUniformBuffers();
+    void compile3DTexturedUniformBuffers();
+    void compile2DInstanced();
+    void compile3DInstanced();
+    void compile3DTexturedInstanced();
+    void compile2DObjectId();
+    void compile3DObjectId();
+    void compile3DSkinned();
+    void compile3DTexturedSkinnedInstanced();
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    void compile3DTexturedBindless();
+    void compile3DTexturedBindlessUniformBuffers();
+    void compile3DStereo();
+    void compile3DStereoInstanced();
+    void compile3DCubeMap();
+    #endif
 };
 
 FlatGLTest::FlatGLTest() {
@@ -46,6 +67,27 @@ FlatGLTest::FlatGLTest() {
               &FlatGLTest::compile3D,
               &FlatGLTest::compile2DTextured,
               &FlatGLTest::compile3DTextured});
+
+    #ifndef MAGNUM_TARGET_GLES2
+    addTests({&FlatGLTest::compile2DUniformBuffers,
+              &FlatGLTest::compile3DUniformBuffers,
+              &FlatGLTest::compile3DTexturedUniformBuffers,
+              &FlatGLTest::compile2DInstanced,
+              &FlatGLTest::compile3DInstanced,
+              &FlatGLTest::compile3DTexturedInstanced,
+              &FlatGLTest::compile2DObjectId,
+              &FlatGLTest::compile3DObjectId,
+              &FlatGLTest::compile3DSkinned,
+              &FlatGLTest::compile3DTexturedSkinnedInstanced});
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    addTests({&FlatGLTest::compile3DTexturedBindless,
+              &FlatGLTest::compile3DTexturedBindlessUniformBuffers,
+              &FlatGLTest::compile3DStereo,
+              &FlatGLTest::compile3DStereoInstanced,
+              &FlatGLTest::compile3DCubeMap});
+    #endif
 }
 
 void FlatGLTest::compile2D() {
@@ -68,6 +110,126 @@ void FlatGLTest::compile3DTextured() {
     CORRADE_VERIFY(shader.validate().first);
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+void FlatGLTest::compile2DUniformBuffers() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Flat2D shader(Shaders::Flat2D::Flag::UniformBuffers);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void FlatGLTest::compile3DUniformBuffers() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::UniformBuffers);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void FlatGLTest::compile3DTexturedUniformBuffers() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::Textured|Shaders::Flat3D::Flag::UniformBuffers);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void FlatGLTest::compile2DInstanced() {
+    Shaders::Flat2D shader(Shaders::Flat2D::Flag::InstancedTransformation|Shaders::Flat2D::Flag::InstancedColor);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void FlatGLTest::compile3DInstanced() {
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::InstancedTransformation|Shaders::Flat3D::Flag::InstancedColor);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void FlatGLTest::compile3DTexturedInstanced() {
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::Textured|Shaders::Flat3D::Flag::InstancedTransformation);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void FlatGLTest::compile2DObjectId() {
+    Shaders::Flat2D shader(Shaders::Flat2D::Flag::ObjectId);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void FlatGLTest::compile3DObjectId() {
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::ObjectId|Shaders::Flat3D::Flag::UniformBuffers);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void FlatGLTest::compile3DSkinned() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::Skinning, 32);
+    CORRADE_COMPARE(shader.jointCount(), 32);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void FlatGLTest::compile3DTexturedSkinnedInstanced() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::Textured|Shaders::Flat3D::Flag::Skinning|Shaders::Flat3D::Flag::InstancedTransformation, 64);
+    CORRADE_VERIFY(shader.validate().first);
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES
+void FlatGLTest::compile3DTexturedBindless() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::bindless_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::bindless_texture::string() + std::string(" is not supported."));
+
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::Textured|Shaders::Flat3D::Flag::BindlessTexture);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void FlatGLTest::compile3DTexturedBindlessUniformBuffers() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::bindless_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::bindless_texture::string() + std::string(" is not supported."));
+
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::Textured|Shaders::Flat3D::Flag::BindlessTexture|Shaders::Flat3D::Flag::UniformBuffers);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void FlatGLTest::compile3DStereo() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::AMD::vertex_shader_layer>())
+        CORRADE_SKIP(Extensions::GL::AMD::vertex_shader_layer::string() + std::string(" is not supported."));
+
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::Stereo);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void FlatGLTest::compile3DStereoInstanced() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::AMD::vertex_shader_layer>())
+        CORRADE_SKIP(Extensions::GL::AMD::vertex_shader_layer::string() + std::string(" is not supported."));
+
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::Stereo|Shaders::Flat3D::Flag::InstancedTransformation|Shaders::Flat3D::Flag::UniformBuffers);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void FlatGLTest::compile3DCubeMap() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::AMD::vertex_shader_layer>())
+        CORRADE_SKIP(Extensions::GL::AMD::vertex_shader_layer::string() + std::string(" is not supported."));
+
+    Shaders::Flat3D shader(Shaders::Flat3D::Flag::CubeMap|Shaders::Flat3D::Flag::Textured);
+    CORRADE_VERIFY(shader.validate().first);
+}
+#endif
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::FlatGLTest)
@@ -0,0 +1,142 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/Impostor.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+#include "Magnum/Shaders/resourceImport.hpp"
+#endif
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct ImpostorGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit ImpostorGLTest();
+
+    void construct();
+    void viewMatrix();
+    void isImpostor();
+    void add();
+    void draw();
+};
+
+ImpostorGLTest::ImpostorGLTest() {
+    addTests({&ImpostorGLTest::construct,
+              &ImpostorGLTest::viewMatrix,
+              &ImpostorGLTest::isImpostor,
+              &ImpostorGLTest::add,
+              &ImpostorGLTest::draw});
+}
+
+namespace {
+    bool isSupported() {
+        #ifndef MAGNUM_TARGET_GLES
+        return Context::current()->isExtensionSupported<Extensions::GL::EXT::texture_array>() &&
+            Context::current()->isExtensionSupported<Extensions::GL::ARB::instanced_arrays>();
+        #else
+        return Context::current()->isVersionSupported(Version::GLES300);
+        #endif
+    }
+}
+
+void ImpostorGLTest::construct() {
+    if(!isSupported()) CORRADE_SKIP("Texture arrays or instancing are not supported.");
+
+    Impostor impostor{{32, 32}, 6};
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(impostor.viewSize(), (Vector2i{32, 32}));
+    CORRADE_COMPARE(impostor.viewCount(), 6);
+    CORRADE_COMPARE(impostor.albedoTexture().imageSize(0), (Vector3i{32, 32, 6}));
+    CORRADE_COMPARE(impostor.framebuffer(5).checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+}
+
+void ImpostorGLTest::viewMatrix() {
+    if(!isSupported()) CORRADE_SKIP("Texture arrays or instancing are not supported.");
+
+    Impostor impostor{{32, 32}, 4};
+    impostor.setBoundingSphere({1.0f, 2.0f, 3.0f}, 0.5f);
+
+    /* View 1 looks from +X */
+    CORRADE_COMPARE(impostor.viewDirection(0), Vector3::zAxis());
+    CORRADE_COMPARE(impostor.viewDirection(1), Vector3::xAxis());
+
+    /* Sphere center is in the middle of the depth range, the point on the
+       sphere nearest to the camera at the near plane */
+    CORRADE_COMPARE(impostor.viewMatrix(1).transformPoint({1.0f, 2.0f, 3.0f}), (Vector3{0.0f, 0.0f, -1.0f}));
+    CORRADE_COMPARE(impostor.viewMatrix(1).transformPoint({1.5f, 2.0f, 3.0f}), (Vector3{0.0f, 0.0f, -0.5f}));
+    CORRADE_COMPARE((impostor.projectionMatrix()*impostor.viewMatrix(1)).transformPoint({1.5f, 2.0f, 3.0f}).z(), -1.0f);
+    CORRADE_COMPARE((impostor.projectionMatrix()*impostor.viewMatrix(1)).transformPoint({1.0f, 2.5f, 3.0f}).y(), 1.0f);
+}
+
+void ImpostorGLTest::isImpostor() {
+    if(!isSupported()) CORRADE_SKIP("Texture arrays or instancing are not supported.");
+
+    Impostor impostor{{32, 32}};
+    impostor.setDistance(10.0f);
+
+    CORRADE_VERIFY(!impostor.isImpostor(Matrix4::translation(Vector3::zAxis(-9.5f))));
+    CORRADE_VERIFY(impostor.isImpostor(Matrix4::translation(Vector3::zAxis(-10.5f))));
+}
+
+void ImpostorGLTest::add() {
+    if(!isSupported()) CORRADE_SKIP("Texture arrays or instancing are not supported.");
+
+    Impostor impostor{{32, 32}, 4};
+    impostor.setBoundingSphere({0.0f, 1.0f, 0.0f}, 2.0f);
+
+    /* Object in front of the camera rotated by 90° to the right, camera is
+       thus on the +X side of the object, which is view 1 */
+    impostor.add(Matrix4::translation(Vector3::zAxis(-20.0f))*Matrix4::rotationY(Deg(-90.0f))*Matrix4::scaling(Vector3{3.0f}));
+    CORRADE_COMPARE(impostor.size(), 1);
+    CORRADE_COMPARE(impostor.instances()[0].position, (Vector3{0.0f, 3.0f, -20.0f}));
+    CORRADE_COMPARE(impostor.instances()[0].radius, 6.0f);
+    CORRADE_COMPARE(impostor.instances()[0].view, 1.0f);
+
+    impostor.clear();
+    CORRADE_COMPARE(impostor.size(), 0);
+}
+
+void ImpostorGLTest::draw() {
+    if(!isSupported()) CORRADE_SKIP("Texture arrays or instancing are not supported.");
+
+    Impostor impostor{{32, 32}, 4};
+    for(UnsignedInt i = 0; i != impostor.viewCount(); ++i)
+        impostor.bindView(i);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    impostor.add(Matrix4::translation(Vector3::zAxis(-5.0f)))
+        .add(Matrix4::translation({1.0f, 0.0f, -5.0f}))
+        .draw(Matrix4::perspectiveProjection(Deg(35.0f), 1.0f, 0.1f, 100.0f));
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(impostor.size(), 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::ImpostorGLTest)
@@ -0,0 +1,117 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Shaders/LightClusterGrid.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct LightClusterGridTest: TestSuite::Tester {
+    explicit LightClusterGridTest();
+
+    void bounds();
+    void cull();
+    void cullMultipleThreads();
+};
+
+LightClusterGridTest::LightClusterGridTest() {
+    addTests({&LightClusterGridTest::bounds,
+              &LightClusterGridTest::cull,
+              &LightClusterGridTest::cullMultipleThreads});
+}
+
+namespace {
+    /* Depth slices at 1, 10 and 100 */
+    LightClusterGrid grid() {
+        LightClusterGrid grid{{2, 2, 2}};
+        grid.setProjection(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f), 1.0f, 100.0f);
+        return grid;
+    }
+}
+
+void LightClusterGridTest::bounds() {
+    LightClusterGrid grid = Test::grid();
+    CORRADE_COMPARE(grid.clusterCount(), (Vector3ui{2, 2, 2}));
+    CORRADE_COMPARE(grid.near(), 1.0f);
+    CORRADE_COMPARE(grid.far(), 100.0f);
+
+    /* Bottom left near cluster, with 90 degree FoV the frustum spans the
+       same distance in X and Y as in depth */
+    CORRADE_COMPARE(grid.clusterBounds({0, 0, 0}), (Range3D{{-10.0f, -10.0f, -10.0f}, {0.0f, 0.0f, -1.0f}}));
+
+    /* Top right far cluster */
+    CORRADE_COMPARE(grid.clusterBounds({1, 1, 1}), (Range3D{{0.0f, 0.0f, -100.0f}, {100.0f, 100.0f, -10.0f}}));
+}
+
+void LightClusterGridTest::cull() {
+    LightClusterGrid grid = Test::grid();
+    grid.cull({
+        /* Near top right cluster only */
+        {{2.0f, 2.0f, -5.0f}, 1.0f, {1.0f, 0.0f, 0.0f}},
+        /* Crossing the depth boundary, in all near and far clusters */
+        {{0.0f, 0.0f, -10.0f}, 2.0f, {0.0f, 1.0f, 0.0f}},
+        /* Behind the camera, in no cluster */
+        {{0.0f, 0.0f, 5.0f}, 1.0f, {0.0f, 0.0f, 1.0f}}
+    });
+
+    CORRADE_COMPARE(grid.lightData(), (std::vector<Vector4>{
+        {2.0f, 2.0f, -5.0f, 1.0f}, {1.0f, 0.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, -10.0f, 2.0f}, {0.0f, 1.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 5.0f, 1.0f}, {0.0f, 0.0f, 1.0f, 0.0f}
+    }));
+    CORRADE_COMPARE(grid.clusters(), (std::vector<Vector2ui>{
+        {0, 1}, {1, 1}, {2, 1}, {3, 2},
+        {5, 1}, {6, 1}, {7, 1}, {8, 1}
+    }));
+    CORRADE_COMPARE(grid.lightIndices(), (std::vector<UnsignedInt>{
+        1, 1, 1, 0, 1,
+        1, 1, 1, 1
+    }));
+}
+
+void LightClusterGridTest::cullMultipleThreads() {
+    std::vector<LightClusterGrid::Light> lights;
+    for(Int i = 0; i != 64; ++i)
+        lights.push_back({{Float(i%8)*10.0f - 40.0f, Float(i/8)*10.0f - 40.0f, -Float(i)*1.5f}, Float(1 + i%5), {}});
+
+    LightClusterGrid grid{{8, 4, 16}};
+    grid.setProjection(Matrix4::perspectiveProjection(Deg(60.0f), 2.0f, 0.5f, 100.0f), 0.5f, 100.0f);
+    grid.cull(lights);
+    const std::vector<Vector2ui> clusters = grid.clusters();
+    const std::vector<UnsignedInt> lightIndices = grid.lightIndices();
+
+    /* More threads than slices, some threads get no work */
+    for(UnsignedInt threadCount: {3, 16, 32}) {
+        grid.cull(lights, threadCount);
+        CORRADE_COMPARE(grid.clusters(), clusters);
+        CORRADE_COMPARE(grid.lightIndices(), lightIndices);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::LightClusterGridTest)
@@ -40,12 +40,14 @@ struct MeshVisualizerGLTest: Magnum::Test::AbstractOpenGLTester {
     void compile();
     void compileWireframeGeometryShader();
     void compileWireframeNoGeometryShader();
+    void compileWireframeVertexIndexAttribute();
 };
 
 MeshVisualizerGLTest::MeshVisualizerGLTest() {
     addTests({&MeshVisualizerGLTest::compile,
               &MeshVisualizerGLTest::compileWireframeGeometryShader,
-              &MeshVisualizerGLTest::compileWireframeNoGeometryShader});
+              &MeshVisualizerGLTest::compileWireframeNoGeometryShader,
+              &MeshVisualizerGLTest::compileWireframeVertexIndexAttribute});
 }
 
 void MeshVisualizerGLTest::compile() {
@@ -70,6 +72,11 @@ void MeshVisualizerGLTest::compileWireframeNoGeometryShader() {
     CORRADE_VERIFY(shader.validate().first);
 }
 
+void MeshVisualizerGLTest::compileWireframeVertexIndexAttribute() {
+    Shaders::MeshVisualizer shader(Shaders::MeshVisualizer::Flag::Wireframe|Shaders::MeshVisualizer::Flag::NoGeometryShader|Shaders::MeshVisualizer::Flag::VertexIndexAttribute);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::MeshVisualizerGLTest)
@@ -0,0 +1,136 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shaders/ParticleSystem.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+#include "Magnum/Shaders/resourceImport.hpp"
+#endif
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct ParticleSystemGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit ParticleSystemGLTest();
+
+    void construct();
+    void emitWrapAround();
+    void update();
+    void draw();
+};
+
+ParticleSystemGLTest::ParticleSystemGLTest() {
+    addTests({&ParticleSystemGLTest::construct,
+              &ParticleSystemGLTest::emitWrapAround,
+              &ParticleSystemGLTest::update,
+              &ParticleSystemGLTest::draw});
+}
+
+namespace {
+    bool isSupported() {
+        #ifndef MAGNUM_TARGET_GLES
+        return Context::current()->isExtensionSupported<Extensions::GL::ARB::transform_feedback2>() &&
+            Context::current()->isExtensionSupported<Extensions::GL::ARB::instanced_arrays>();
+        #else
+        return Context::current()->isVersionSupported(Version::GLES300);
+        #endif
+    }
+}
+
+void ParticleSystemGLTest::construct() {
+    if(!isSupported()) CORRADE_SKIP("Transform feedback or instancing is not supported.");
+
+    ParticleSystem particles{128};
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(particles.capacity(), 128);
+    CORRADE_COMPARE(particles.buffer().size(), Int(128*sizeof(ParticleSystem::Particle)));
+}
+
+void ParticleSystemGLTest::emitWrapAround() {
+    if(!isSupported()) CORRADE_SKIP("Transform feedback or instancing is not supported.");
+
+    ParticleSystem particles{3};
+    particles.emit(std::vector<ParticleSystem::Particle>{
+        {{1.0f, 0.0f, 0.0f}, 0.0f, {}, 1.0f},
+        {{2.0f, 0.0f, 0.0f}, 0.0f, {}, 1.0f}});
+    particles.emit(std::vector<ParticleSystem::Particle>{
+        {{3.0f, 0.0f, 0.0f}, 0.0f, {}, 1.0f},
+        {{4.0f, 0.0f, 0.0f}, 0.0f, {}, 1.0f}});
+    MAGNUM_VERIFY_NO_ERROR();
+
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<ParticleSystem::Particle> data = particles.buffer().data<ParticleSystem::Particle>();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(data.size(), 3);
+    CORRADE_COMPARE(data[0].position, (Vector3{4.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(data[1].position, (Vector3{2.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(data[2].position, (Vector3{3.0f, 0.0f, 0.0f}));
+    #endif
+}
+
+void ParticleSystemGLTest::update() {
+    if(!isSupported()) CORRADE_SKIP("Transform feedback or instancing is not supported.");
+
+    ParticleSystem particles{3};
+    particles.setGravity({0.0f, -2.0f, 0.0f})
+        .emit(std::vector<ParticleSystem::Particle>{
+            {{}, 0.0f, {1.0f, 0.0f, 0.0f}, 2.0f},
+            /* Already dead, shouldn't move */
+            {{5.0f, 0.0f, 0.0f}, 1.0f, {1.0f, 0.0f, 0.0f}, 1.0f}})
+        .update(0.5f);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<ParticleSystem::Particle> data = particles.buffer().data<ParticleSystem::Particle>();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(data[0].position, (Vector3{0.5f, -0.5f, 0.0f}));
+    CORRADE_COMPARE(data[0].velocity, (Vector3{1.0f, -1.0f, 0.0f}));
+    CORRADE_COMPARE(data[0].age, 0.5f);
+    CORRADE_COMPARE(data[0].lifetime, 2.0f);
+    CORRADE_COMPARE(data[1].position, (Vector3{5.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(data[1].age, 1.0f);
+    #endif
+}
+
+void ParticleSystemGLTest::draw() {
+    if(!isSupported()) CORRADE_SKIP("Transform feedback or instancing is not supported.");
+
+    ParticleSystem particles{16};
+    particles.emit(std::vector<ParticleSystem::Particle>{
+            {{}, 0.0f, {0.0f, 1.0f, 0.0f}, 1.0f}})
+        .update(0.1f)
+        .draw(Matrix4::translation(Vector3::zAxis(-5.0f)), Matrix4::perspectiveProjection(Deg(35.0f), 1.0f, 0.1f, 100.0f));
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::ParticleSystemGLTest)
@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
 #include "Magnum/Shaders/Phong.h"
 #include "Magnum/Test/AbstractOpenGLTester.h"
 
@@ -43,6 +45,23 @@ struct PhongGLTest: Magnum::Test::AbstractOpenGLTester {
     void compileAmbientSpecularTexture();
     void compileDiffuseSpecularTexture();
     void compileAmbientDiffuseSpecularTexture();
+    void compileFlatShading();
+    #ifndef MAGNUM_TARGET_GLES2
+    void compileFlatShadingSkinnedInstanced();
+    void compileUniformBuffers();
+    void compileAmbientDiffuseSpecularTextureUniformBuffers();
+    void compileInstanced();
+    void compileDiffuseTextureInstanced();
+    void compileSkinned();
+    void compileSkinnedInstanced();
+    void compileShadows();
+    void compileTextureArrays();
+    void compileTextureArraysInstanced();
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    void compileClusteredLights();
+    void compileDiffuseTextureClusteredLightsInstanced();
+    #endif
 };
 
 PhongGLTest::PhongGLTest() {
@@ -53,7 +72,26 @@ PhongGLTest::PhongGLTest() {
               &PhongGLTest::compileAmbientDiffuseTexture,
               &PhongGLTest::compileAmbientSpecularTexture,
               &PhongGLTest::compileDiffuseSpecularTexture,
-              &PhongGLTest::compileAmbientDiffuseSpecularTexture});
+              &PhongGLTest::compileAmbientDiffuseSpecularTexture,
+              &PhongGLTest::compileFlatShading});
+
+    #ifndef MAGNUM_TARGET_GLES2
+    addTests({&PhongGLTest::compileFlatShadingSkinnedInstanced,
+              &PhongGLTest::compileUniformBuffers,
+              &PhongGLTest::compileAmbientDiffuseSpecularTextureUniformBuffers,
+              &PhongGLTest::compileInstanced,
+              &PhongGLTest::compileDiffuseTextureInstanced,
+              &PhongGLTest::compileSkinned,
+              &PhongGLTest::compileSkinnedInstanced,
+              &PhongGLTest::compileShadows,
+              &PhongGLTest::compileTextureArrays,
+              &PhongGLTest::compileTextureArraysInstanced});
+    #endif
+
+    #ifndef MAGNUM_TARGET_GLES
+    addTests({&PhongGLTest::compileClusteredLights,
+              &PhongGLTest::compileDiffuseTextureClusteredLightsInstanced});
+    #endif
 }
 
 void PhongGLTest::compile() {
@@ -96,6 +134,138 @@ void PhongGLTest::compileAmbientDiffuseSpecularTexture() {
     CORRADE_VERIFY(shader.validate().first);
 }
 
+void PhongGLTest::compileFlatShading() {
+    #ifdef MAGNUM_TARGET_GLES2
+    if(!Context::current()->isExtensionSupported<Extensions::GL::OES::standard_derivatives>())
+        CORRADE_SKIP(Extensions::GL::OES::standard_derivatives::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::DiffuseTexture|Shaders::Phong::Flag::FlatShading);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void PhongGLTest::compileFlatShadingSkinnedInstanced() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::FlatShading|Shaders::Phong::Flag::Skinning|Shaders::Phong::Flag::InstancedTransformation, 16);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void PhongGLTest::compileUniformBuffers() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::UniformBuffers);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void PhongGLTest::compileAmbientDiffuseSpecularTextureUniformBuffers() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::AmbientTexture|Shaders::Phong::Flag::DiffuseTexture|Shaders::Phong::Flag::SpecularTexture|Shaders::Phong::Flag::UniformBuffers);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void PhongGLTest::compileInstanced() {
+    Shaders::Phong shader(Shaders::Phong::Flag::InstancedTransformation|Shaders::Phong::Flag::InstancedColor);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void PhongGLTest::compileDiffuseTextureInstanced() {
+    Shaders::Phong shader(Shaders::Phong::Flag::DiffuseTexture|Shaders::Phong::Flag::InstancedTransformation);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void PhongGLTest::compileSkinned() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::Skinning, 32);
+    CORRADE_COMPARE(shader.jointCount(), 32);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void PhongGLTest::compileSkinnedInstanced() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::Skinning|Shaders::Phong::Flag::InstancedTransformation|Shaders::Phong::Flag::UniformBuffers, 64);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void PhongGLTest::compileShadows() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 not supported.");
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::DiffuseTexture|Shaders::Phong::Flag::Shadows);
+    shader.setShadowMatrices({Matrix4{}, Matrix4{}})
+        .setShadowSplitDepths({10.0f, 100.0f, 100.0f, 100.0f})
+        .setShadowBias(0.001f);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void PhongGLTest::compileTextureArrays() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 not supported.");
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::AmbientTexture|Shaders::Phong::Flag::DiffuseTexture|Shaders::Phong::Flag::SpecularTexture|Shaders::Phong::Flag::TextureArrays);
+    shader.setTextureLayer(3);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void PhongGLTest::compileTextureArraysInstanced() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 not supported.");
+    #endif
+
+    Shaders::Phong shader(Shaders::Phong::Flag::DiffuseTexture|Shaders::Phong::Flag::TextureArrays|Shaders::Phong::Flag::InstancedTransformation|Shaders::Phong::Flag::InstancedTextureLayer);
+    CORRADE_VERIFY(shader.validate().first);
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES
+void PhongGLTest::compileClusteredLights() {
+    if(!Context::current()->isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 not supported.");
+
+    Shaders::Phong shader(Shaders::Phong::Flag::ClusteredLights);
+    shader.setLightClusterParameters({16, 9, 24}, {1280.0f, 720.0f}, 0.1f, 100.0f);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void PhongGLTest::compileDiffuseTextureClusteredLightsInstanced() {
+    if(!Context::current()->isVersionSupported(Version::GL310))
+        CORRADE_SKIP("OpenGL 3.1 not supported.");
+
+    Shaders::Phong shader(Shaders::Phong::Flag::DiffuseTexture|Shaders::Phong::Flag::ClusteredLights|Shaders::Phong::Flag::InstancedTransformation|Shaders::Phong::Flag::InstancedColor);
+    CORRADE_VERIFY(shader.validate().first);
+}
+#endif
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::PhongGLTest)
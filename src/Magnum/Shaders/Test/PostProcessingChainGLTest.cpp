@@ -0,0 +1,153 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Color.h"
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Image.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/RenderTargetPool.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Shaders/PostProcessingChain.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+#include "Magnum/Shaders/resourceImport.hpp"
+#endif
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct PostProcessingChainGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit PostProcessingChainGLTest();
+
+    void fusion();
+    void draw();
+    void drawMultiplePasses();
+};
+
+PostProcessingChainGLTest::PostProcessingChainGLTest() {
+    addTests({&PostProcessingChainGLTest::fusion,
+              &PostProcessingChainGLTest::draw,
+              &PostProcessingChainGLTest::drawMultiplePasses});
+}
+
+typedef PostProcessingChain::Effect Effect;
+
+namespace {
+    constexpr Color4ub InputData[]{
+        {128, 64, 32, 255}, {128, 64, 32, 255}, {128, 64, 32, 255}, {128, 64, 32, 255},
+        {128, 64, 32, 255}, {128, 64, 32, 255}, {128, 64, 32, 255}, {128, 64, 32, 255},
+        {128, 64, 32, 255}, {128, 64, 32, 255}, {128, 64, 32, 255}, {128, 64, 32, 255},
+        {128, 64, 32, 255}, {128, 64, 32, 255}, {128, 64, 32, 255}, {128, 64, 32, 255}
+    };
+}
+
+void PostProcessingChainGLTest::fusion() {
+    /* Per-pixel effects are all fused into one pass */
+    PostProcessingChain a{{Effect::Tonemap, Effect::ColorGrade, Effect::Vignette}};
+    CORRADE_COMPARE(a.passCount(), 1);
+
+    /* FXAA needs the previous result in a texture */
+    PostProcessingChain b{{Effect::Tonemap, Effect::Fxaa, Effect::Vignette}};
+    CORRADE_COMPARE(b.passCount(), 2);
+
+    /* ... unless it is the first */
+    PostProcessingChain c{{Effect::Fxaa, Effect::ColorGrade}};
+    CORRADE_COMPARE(c.passCount(), 1);
+
+    PostProcessingChain d{{Effect::Fxaa, Effect::Tonemap, Effect::Fxaa, Effect::Fxaa}};
+    CORRADE_COMPARE(d.passCount(), 3);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void PostProcessingChainGLTest::draw() {
+    Texture2D input;
+    input.setMinificationFilter(Sampler::Filter::Linear)
+        .setMagnificationFilter(Sampler::Filter::Linear)
+        .setStorage(1, TextureFormat::RGBA8, Vector2i{4})
+        .setSubImage(0, {}, ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, Vector2i{4}, InputData});
+
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{4});
+    Framebuffer output{{{}, Vector2i{4}}};
+    output.attachRenderbuffer(Framebuffer::ColorAttachment(0), color);
+
+    RenderTargetPool pool;
+    PostProcessingChain chain{{Effect::ColorGrade}};
+    chain.setColorMatrix(Matrix3x3{Matrix3x3::Identity, 0.5f})
+        .setColorOffset(Color3{0.25f});
+    chain.draw(input, output, pool);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* No intermediate targets for a single pass */
+    CORRADE_COMPARE(pool.textureCount(), 0);
+
+    Image2D image = output.read({{}, Vector2i{1}}, {ColorFormat::RGBA, ColorType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(image.data<Color4ub>()[0], (Color4ub{128, 96, 80, 255}));
+}
+
+void PostProcessingChainGLTest::drawMultiplePasses() {
+    Texture2D input;
+    input.setMinificationFilter(Sampler::Filter::Linear)
+        .setMagnificationFilter(Sampler::Filter::Linear)
+        .setStorage(1, TextureFormat::RGBA8, Vector2i{4})
+        .setSubImage(0, {}, ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, Vector2i{4}, InputData});
+
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{4});
+    Framebuffer output{{{}, Vector2i{4}}};
+    output.attachRenderbuffer(Framebuffer::ColorAttachment(0), color);
+
+    /* FXAA doesn't change a constant image */
+    RenderTargetPool pool;
+    PostProcessingChain chain{{Effect::ColorGrade, Effect::Fxaa, Effect::Fxaa}};
+    CORRADE_COMPARE(chain.passCount(), 3);
+    chain.setColorMatrix(Matrix3x3{Matrix3x3::Identity, 0.5f})
+        .setColorOffset(Color3{0.25f});
+    chain.draw(input, output, pool);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* The first intermediate texture is released before the last pass, but
+       the second one is acquired while the first is still read from */
+    CORRADE_COMPARE(pool.textureCount(), 2);
+    CORRADE_COMPARE(pool.framebufferCount(), 1);
+
+    Image2D image = output.read({{}, Vector2i{1}}, {ColorFormat::RGBA, ColorType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(image.data<Color4ub>()[0], (Color4ub{128, 96, 80, 255}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::PostProcessingChainGLTest)
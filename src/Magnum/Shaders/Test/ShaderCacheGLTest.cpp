@@ -0,0 +1,130 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Shaders/ShaderCache.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+#include "Magnum/Shaders/resourceImport.hpp"
+#endif
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct ShaderCacheGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit ShaderCacheGLTest();
+
+    void shared();
+    void differentFlags();
+    void precompile();
+    void free();
+};
+
+ShaderCacheGLTest::ShaderCacheGLTest() {
+    addTests({&ShaderCacheGLTest::shared,
+              &ShaderCacheGLTest::differentFlags,
+              &ShaderCacheGLTest::precompile,
+              &ShaderCacheGLTest::free});
+}
+
+void ShaderCacheGLTest::shared() {
+    ShaderCache cache;
+    CORRADE_VERIFY(&ShaderCache::instance() == &cache);
+
+    std::shared_ptr<Phong> a = cache.phong(Phong::Flag::DiffuseTexture);
+    std::shared_ptr<Phong> b = ShaderCache::instance().phong(Phong::Flag::DiffuseTexture);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(a == b);
+    CORRADE_VERIFY(a->flags() == Phong::Flag::DiffuseTexture);
+    CORRADE_VERIFY(a->validate().first);
+    CORRADE_COMPARE(cache.count(), 1);
+}
+
+void ShaderCacheGLTest::differentFlags() {
+    ShaderCache cache;
+
+    std::shared_ptr<Flat2D> flat2D = cache.flat2D(Flat2D::Flag::Textured);
+    std::shared_ptr<Flat3D> flat3D = cache.flat3D(Flat3D::Flag::Textured);
+    std::shared_ptr<Flat3D> flat3DColored = cache.flat3D();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(flat3D != flat3DColored);
+    CORRADE_VERIFY(flat2D->flags() == Flat2D::Flag::Textured);
+    CORRADE_VERIFY(flat3D->flags() == Flat3D::Flag::Textured);
+    CORRADE_VERIFY(flat3DColored->flags() == Flat3D::Flags{});
+
+    /* Joint count is ignored without skinning */
+    CORRADE_VERIFY(cache.flat3D({}, 16) == flat3DColored);
+    CORRADE_COMPARE(cache.count(), 3);
+}
+
+void ShaderCacheGLTest::precompile() {
+    ShaderCache cache;
+    cache.precompilePhong({})
+        .precompilePhong(Phong::Flag::SpecularTexture)
+        .precompileFlat3D({});
+    CORRADE_COMPARE(cache.count(), 3);
+
+    /* Retrieving a variant that's still pending finishes it */
+    std::shared_ptr<Phong> specular = cache.phong(Phong::Flag::SpecularTexture);
+    CORRADE_VERIFY(specular->validate().first);
+
+    while(!cache.isPrecompilationFinished()) {}
+    cache.finishPrecompilation();
+
+    /* The precompiled variants are reused */
+    std::shared_ptr<Phong> phong = cache.phong();
+    std::shared_ptr<Flat3D> flat = cache.flat3D();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(phong->validate().first);
+    CORRADE_VERIFY(flat->validate().first);
+    CORRADE_COMPARE(cache.count(), 3);
+}
+
+void ShaderCacheGLTest::free() {
+    ShaderCache cache;
+
+    std::shared_ptr<Flat2D> used = cache.flat2D();
+    cache.flat2D(Flat2D::Flag::Textured);
+    cache.precompileFlat3D({});
+    CORRADE_COMPARE(cache.count(), 3);
+
+    /* The pending and the externally referenced variant are kept */
+    CORRADE_COMPARE(cache.free(), 1);
+    CORRADE_COMPARE(cache.count(), 2);
+    CORRADE_VERIFY(cache.flat2D() == used);
+
+    cache.finishPrecompilation();
+    CORRADE_COMPARE(cache.free(), 1);
+    CORRADE_COMPARE(cache.count(), 1);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::ShaderCacheGLTest)
@@ -0,0 +1,113 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Shaders/ShadowCascades.h"
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct ShadowCascadesTest: TestSuite::Tester {
+    explicit ShadowCascadesTest();
+
+    void splitUniform();
+    void splitLogarithmic();
+    void splitShadowDistance();
+    void splitFewerCascades();
+    void enclosesFrustum();
+};
+
+ShadowCascadesTest::ShadowCascadesTest() {
+    addTests({&ShadowCascadesTest::splitUniform,
+              &ShadowCascadesTest::splitLogarithmic,
+              &ShadowCascadesTest::splitShadowDistance,
+              &ShadowCascadesTest::splitFewerCascades,
+              &ShadowCascadesTest::enclosesFrustum});
+}
+
+void ShadowCascadesTest::splitUniform() {
+    ShadowCascades cascades{4, 0.0f};
+    cascades.fit({}, Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 101.0f), {0.0f, -1.0f, 0.0f}, 1024);
+    CORRADE_COMPARE(cascades.splitDepths(), (Vector4{26.0f, 51.0f, 76.0f, 101.0f}));
+    CORRADE_COMPARE(cascades.shadowMatrices().size(), 4);
+}
+
+void ShadowCascadesTest::splitLogarithmic() {
+    ShadowCascades cascades{4, 1.0f};
+    cascades.fit({}, Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f), {0.0f, -1.0f, 0.0f}, 1024);
+    CORRADE_COMPARE(cascades.splitDepths(), (Vector4{3.162278f, 10.0f, 31.62278f, 100.0f}));
+}
+
+void ShadowCascadesTest::splitShadowDistance() {
+    ShadowCascades cascades{2, 0.0f};
+    cascades.setShadowDistance(100.0f);
+    cascades.fit({}, Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 1000.0f), {0.0f, -1.0f, 0.0f}, 1024);
+    CORRADE_COMPARE(cascades.splitDepths(), (Vector4{50.5f, 100.0f, 100.0f, 100.0f}));
+}
+
+void ShadowCascadesTest::splitFewerCascades() {
+    ShadowCascades cascades{1};
+    cascades.fit({}, Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 50.0f), {0.0f, -1.0f, 0.0f}, 1024);
+    CORRADE_COMPARE(cascades.cascadeCount(), 1);
+    CORRADE_COMPARE(cascades.splitDepths(), Vector4{50.0f});
+    CORRADE_COMPARE(cascades.shadowMatrices().size(), 1);
+}
+
+void ShadowCascadesTest::enclosesFrustum() {
+    /* Camera somewhere in the world, light shining diagonally down */
+    const Matrix4 cameraMatrix = (Matrix4::translation({5.0f, 2.0f, -3.0f})*Matrix4::rotationY(Deg(30.0f))).invertedRigid();
+    ShadowCascades cascades{3};
+    cascades.setCasterExtension(20.0f);
+    cascades.fit(cameraMatrix, Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.5f, 80.0f), {1.0f, -2.0f, 0.5f}, 2048);
+
+    /* Points close to the corners of each slice land inside the shadow map
+       of given cascade */
+    Float splitNear = 0.5f;
+    for(UnsignedInt i = 0; i != cascades.cascadeCount(); ++i) {
+        const Float splitFar = cascades.splitDepths()[i];
+        for(const Float depth: {splitNear*1.01f, splitFar*0.99f}) {
+            for(const Vector2& xy: {Vector2{-0.99f, -0.99f}, Vector2{0.99f, 0.99f}, Vector2{-0.99f, 0.99f}}) {
+                const Vector4 coordinates = cascades.shadowMatrices()[i]*Vector4{Vector3{xy*depth, -depth}, 1.0f};
+                CORRADE_VERIFY(coordinates.x() > 0.0f && coordinates.x() < 1.0f);
+                CORRADE_VERIFY(coordinates.y() > 0.0f && coordinates.y() < 1.0f);
+                CORRADE_VERIFY(coordinates.z() > 0.0f && coordinates.z() < 1.0f);
+            }
+        }
+
+        /* The light matrix is the shadow matrix without bias and camera */
+        const Vector3 point = cameraMatrix.invertedRigid().transformPoint({0.0f, 0.0f, -splitFar*0.99f});
+        const Vector4 clip = cascades.lightMatrix(i)*Vector4{point, 1.0f};
+        const Vector4 coordinates = cascades.shadowMatrices()[i]*Vector4{0.0f, 0.0f, -splitFar*0.99f, 1.0f};
+        CORRADE_COMPARE(coordinates.xyz(), clip.xyz()*0.5f + Vector3{0.5f});
+
+        splitNear = splitFar;
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::ShadowCascadesTest)
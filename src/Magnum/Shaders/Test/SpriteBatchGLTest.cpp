@@ -0,0 +1,171 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Shaders/Flat.h"
+#include "Magnum/Shaders/SpriteBatch.h"
+#include "Magnum/Shaders/Vector.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+#include "Magnum/Shaders/resourceImport.hpp"
+#endif
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct SpriteBatchGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit SpriteBatchGLTest();
+
+    void construct();
+    void addClear();
+    void drawFlat();
+    void drawFlatSorted();
+    void drawVectorMultipleUploads();
+};
+
+SpriteBatchGLTest::SpriteBatchGLTest() {
+    addTests({&SpriteBatchGLTest::construct,
+              &SpriteBatchGLTest::addClear,
+              &SpriteBatchGLTest::drawFlat,
+              &SpriteBatchGLTest::drawFlatSorted,
+              &SpriteBatchGLTest::drawVectorMultipleUploads});
+}
+
+namespace {
+    void setupTexture(Texture2D& texture) {
+        const UnsignedByte data[]{0xff, 0xff, 0xff, 0xff};
+        texture.setMinificationFilter(Sampler::Filter::Linear)
+            .setMagnificationFilter(Sampler::Filter::Linear)
+            .setImage(0, TextureFormat::RGBA8, ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {1, 1}, data});
+    }
+}
+
+void SpriteBatchGLTest::construct() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported."));
+    #endif
+
+    SpriteBatch batch{128};
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(batch.capacity(), 128);
+    CORRADE_COMPARE(batch.sorting(), SpriteBatch::Sorting::None);
+    CORRADE_COMPARE(batch.size(), 0);
+}
+
+void SpriteBatchGLTest::addClear() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported."));
+    #endif
+
+    Texture2D texture;
+    SpriteBatch batch{16};
+    batch.add(texture, {0.5f, 0.5f}, {0.25f, 0.25f}, Rad(0.5f))
+        .add(texture, Range2D{{-1.0f, -1.0f}, {0.0f, 0.0f}});
+    CORRADE_COMPARE(batch.size(), 2);
+
+    batch.clear();
+    CORRADE_COMPARE(batch.size(), 0);
+}
+
+void SpriteBatchGLTest::drawFlat() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported."));
+    #endif
+
+    Texture2D a, b;
+    setupTexture(a);
+    setupTexture(b);
+
+    Flat2D shader{Flat2D::Flag::Textured|Flat2D::Flag::InstancedColor};
+    shader.setTransformationProjectionMatrix(Matrix3::projection({2.0f, 2.0f}));
+
+    SpriteBatch batch{16};
+    batch.add(a, {-0.5f, 0.0f}, {0.5f, 0.5f}, Rad(0.0f), {{}, Vector2{1.0f}}, Color4{1.0f, 0.0f, 0.0f})
+        .add(b, {0.5f, 0.0f}, {0.5f, 0.5f}, Rad(1.0f))
+        .add(a, Range2D{{0.0f, 0.5f}, {0.5f, 1.0f}})
+        .draw(shader);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* The batch is cleared after drawing */
+    CORRADE_COMPARE(batch.size(), 0);
+}
+
+void SpriteBatchGLTest::drawFlatSorted() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported."));
+    #endif
+
+    Texture2D a, b;
+    setupTexture(a);
+    setupTexture(b);
+
+    Flat2D shader{Flat2D::Flag::Textured|Flat2D::Flag::InstancedColor};
+
+    SpriteBatch batch{16};
+    batch.setSorting(SpriteBatch::Sorting::Texture);
+    for(Int i = 0; i != 8; ++i)
+        batch.add(i % 2 ? a : b, {Float(i)*0.1f, 0.0f}, {0.1f, 0.1f}, Rad(0.0f));
+    batch.draw(shader);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(batch.size(), 0);
+}
+
+void SpriteBatchGLTest::drawVectorMultipleUploads() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported."));
+    #endif
+
+    Texture2D texture;
+    setupTexture(texture);
+
+    Vector2D shader;
+    shader.setColor(Color4{0.0f, 1.0f, 0.0f});
+
+    /* More sprites than the capacity and more uploads than frames in
+       flight, the ring has to wrap around */
+    SpriteBatch batch{2, 2};
+    for(Int i = 0; i != 7; ++i)
+        batch.add(texture, Range2D{{Float(i)*0.1f, 0.0f}, {Float(i)*0.1f + 0.1f, 0.1f}});
+    batch.draw(shader);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(batch.size(), 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::SpriteBatchGLTest)
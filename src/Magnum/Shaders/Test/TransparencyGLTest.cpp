@@ -0,0 +1,125 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Shaders/Flat.h"
+#include "Magnum/Shaders/Phong.h"
+#include "Magnum/Shaders/TransparencyBuffer.h"
+#include "Magnum/Shaders/TransparencyCompositing.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+#ifdef MAGNUM_BUILD_STATIC
+#include "Magnum/Shaders/resourceImport.hpp"
+#endif
+
+namespace Magnum { namespace Shaders { namespace Test {
+
+struct TransparencyGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit TransparencyGLTest();
+
+    void buffer();
+
+    void compileFlat2D();
+    void compileFlat3D();
+    void compilePhong();
+    void compilePhongUniformBuffers();
+
+    void compileCompositing();
+};
+
+TransparencyGLTest::TransparencyGLTest() {
+    addTests({&TransparencyGLTest::buffer,
+
+              &TransparencyGLTest::compileFlat2D,
+              &TransparencyGLTest::compileFlat3D,
+              &TransparencyGLTest::compilePhong,
+              &TransparencyGLTest::compilePhongUniformBuffers,
+
+              &TransparencyGLTest::compileCompositing});
+}
+
+void TransparencyGLTest::buffer() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::color_buffer_float>())
+        CORRADE_SKIP(Extensions::GL::ARB::color_buffer_float::string() + std::string(" is not supported."));
+    #endif
+
+    Texture2D depth;
+    depth.setStorage(1, TextureFormat::DepthComponent24, {128, 64});
+
+    Shaders::TransparencyBuffer transparency{depth, {128, 64}};
+    CORRADE_COMPARE(transparency.size(), (Vector2i{128, 64}));
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(transparency.accumulationTexture().imageSize(0), (Vector2i{128, 64}));
+    CORRADE_COMPARE(transparency.revealageTexture().imageSize(0), (Vector2i{128, 64}));
+    #endif
+    CORRADE_COMPARE(transparency.framebuffer().checkStatus(FramebufferTarget::Draw), Framebuffer::Status::Complete);
+
+    transparency.bindForWriting();
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void TransparencyGLTest::compileFlat2D() {
+    Shaders::Flat2D shader{Shaders::Flat2D::Flag::WeightedBlendedTransparency};
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void TransparencyGLTest::compileFlat3D() {
+    Shaders::Flat3D shader{Shaders::Flat3D::Flag::WeightedBlendedTransparency|Shaders::Flat3D::Flag::Textured};
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void TransparencyGLTest::compilePhong() {
+    Shaders::Phong shader{Shaders::Phong::Flag::WeightedBlendedTransparency};
+    shader.setAlpha(0.5f);
+    CORRADE_VERIFY(shader.validate().first);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void TransparencyGLTest::compilePhongUniformBuffers() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::Phong shader{Shaders::Phong::Flag::WeightedBlendedTransparency|Shaders::Phong::Flag::UniformBuffers};
+    shader.setAlpha(0.5f);
+    CORRADE_VERIFY(shader.validate().first);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void TransparencyGLTest::compileCompositing() {
+    Shaders::TransparencyCompositing shader;
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shaders::Test::TransparencyGLTest)
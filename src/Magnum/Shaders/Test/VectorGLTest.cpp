@@ -37,11 +37,15 @@ struct VectorGLTest: Magnum::Test::AbstractOpenGLTester {
 
     void compile2D();
     void compile3D();
+    void compile2DVertexColor();
+    void compile3DVertexColor();
 };
 
 VectorGLTest::VectorGLTest() {
     addTests({&VectorGLTest::compile2D,
-              &VectorGLTest::compile3D});
+              &VectorGLTest::compile3D,
+              &VectorGLTest::compile2DVertexColor,
+              &VectorGLTest::compile3DVertexColor});
 }
 
 void VectorGLTest::compile2D() {
@@ -54,6 +58,16 @@ void VectorGLTest::compile3D() {
     CORRADE_VERIFY(shader.validate().first);
 }
 
+void VectorGLTest::compile2DVertexColor() {
+    Shaders::Vector2D shader(Shaders::Vector2D::Flag::VertexColor);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void VectorGLTest::compile3DVertexColor() {
+    Shaders::Vector3D shader(Shaders::Vector3D::Flag::VertexColor);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::VectorGLTest)
@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
 #include "Magnum/Shaders/VertexColor.h"
 #include "Magnum/Test/AbstractOpenGLTester.h"
 
@@ -37,11 +39,24 @@ struct VertexColorGLTest: Magnum::Test::AbstractOpenGLTester {
 
     void compile2D();
     void compile3D();
+    #ifndef MAGNUM_TARGET_GLES2
+    void compile2DUniformBuffers();
+    void compile3DUniformBuffers();
+    void compile2DInstanced();
+    void compile3DInstanced();
+    #endif
 };
 
 VertexColorGLTest::VertexColorGLTest() {
     addTests({&VertexColorGLTest::compile2D,
               &VertexColorGLTest::compile3D});
+
+    #ifndef MAGNUM_TARGET_GLES2
+    addTests({&VertexColorGLTest::compile2DUniformBuffers,
+              &VertexColorGLTest::compile3DUniformBuffers,
+              &VertexColorGLTest::compile2DInstanced,
+              &VertexColorGLTest::compile3DInstanced});
+    #endif
 }
 
 void VertexColorGLTest::compile2D() {
@@ -54,6 +69,38 @@ void VertexColorGLTest::compile3D() {
     CORRADE_VERIFY(shader.validate().first);
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+void VertexColorGLTest::compile2DUniformBuffers() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::VertexColor2D shader(Shaders::VertexColor2D::Flag::UniformBuffers);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void VertexColorGLTest::compile3DUniformBuffers() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::uniform_buffer_object::string() + std::string(" is not supported."));
+    #endif
+
+    Shaders::VertexColor3D shader(Shaders::VertexColor3D::Flag::UniformBuffers);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void VertexColorGLTest::compile2DInstanced() {
+    Shaders::VertexColor2D shader(Shaders::VertexColor2D::Flag::InstancedTransformation);
+    CORRADE_VERIFY(shader.validate().first);
+}
+
+void VertexColorGLTest::compile3DInstanced() {
+    Shaders::VertexColor3D shader(Shaders::VertexColor3D::Flag::InstancedTransformation);
+    CORRADE_VERIFY(shader.validate().first);
+}
+#endif
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shaders::Test::VertexColorGLTest)
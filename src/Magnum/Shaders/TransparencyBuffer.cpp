@@ -0,0 +1,63 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TransparencyBuffer.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/Color.h"
+#include "Magnum/TextureFormat.h"
+
+namespace Magnum { namespace Shaders {
+
+TransparencyBuffer::TransparencyBuffer(Texture2D& depth, const Vector2i& size): _size{size}, _framebuffer{Range2Di{{}, size}} {
+    /* The compositing pass fetches exactly one texel per pixel, no filtering
+       or mipmaps needed */
+    for(Texture2D* texture: {&_accumulation, &_revealage})
+        texture->setMinificationFilter(Sampler::Filter::Nearest)
+            .setMagnificationFilter(Sampler::Filter::Nearest)
+            .setWrapping(Sampler::Wrapping::ClampToEdge);
+    _accumulation.setStorage(1, TextureFormat::RGBA16F, size);
+    _revealage.setStorage(1, TextureFormat::R16F, size);
+
+    _framebuffer.attachTexture(Framebuffer::ColorAttachment{0}, _accumulation, 0)
+        .attachTexture(Framebuffer::ColorAttachment{1}, _revealage, 0)
+        .attachTexture(Framebuffer::BufferAttachment::Depth, depth, 0)
+        .mapForDraw({{AccumulationOutput, Framebuffer::ColorAttachment{0}},
+                     {RevealageOutput, Framebuffer::ColorAttachment{1}}});
+}
+
+TransparencyBuffer& TransparencyBuffer::bindForWriting() {
+    /* Both attachments are sums, so they have to start from zero. Revealage
+       is stored as -log(revealage), so zero there means fully revealed.
+       Clearing each attachment separately leaves the global clear color
+       untouched. */
+    _framebuffer.clearColor(AccumulationOutput, Color4{})
+        .clearColor(RevealageOutput, Color4{})
+        .bind(FramebufferTarget::Draw);
+    return *this;
+}
+
+}}
+#endif
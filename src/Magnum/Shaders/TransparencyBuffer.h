@@ -0,0 +1,165 @@
+#ifndef Magnum_Shaders_TransparencyBuffer_h
+#define Magnum_Shaders_TransparencyBuffer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::TransparencyBuffer
+ */
+
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Texture.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Accumulation buffer for weighted blended order-independent transparency
+
+Framebuffer with textures filled by @ref Flat and @ref Phong with
+@ref Flat::Flag::WeightedBlendedTransparency "Flag::WeightedBlendedTransparency"
+enabled and resolved by @ref TransparencyCompositing. Transparent surfaces
+are accumulated into two color attachments:
+
+-   @ref accumulationTexture() in @ref TextureFormat::RGBA16F contains sum of
+    premultiplied colors in RGB and sum of alphas in alpha, both weighted by
+    a function of alpha and depth
+-   @ref revealageTexture() in @ref TextureFormat::R16F contains sum of
+    @f$ -\log(1 - \alpha) @f$, from which the compositing pass computes how
+    much of the background is visible through all surfaces
+
+Both attachments are accumulated with the same additive blending, so
+transparent geometry can be drawn in any order. There's no need to sort it
+back-to-front on the CPU and it can be batched by render state the same way
+as opaque geometry. The result is an approximation, which is exact for
+surfaces of the same color and works well for particles, glass and other
+surfaces with low to medium opacity.
+
+The framebuffer uses depth texture of the opaque pass for depth testing, for
+example @ref GBuffer::depthTexture(), so transparent surfaces behind opaque
+ones are discarded. Depth writes are expected to be disabled while drawing
+transparent geometry.
+
+## Example usage
+
+@code
+Shaders::TransparencyBuffer transparency{gbuffer.depthTexture(), gbuffer.size()};
+Shaders::Phong transparentShader{Shaders::Phong::Flag::WeightedBlendedTransparency};
+Shaders::TransparencyCompositing compositingShader;
+
+// Opaque geometry and lighting pass into the default framebuffer ...
+
+// Transparent pass, in any order
+transparency.bindForWriting();
+Renderer::setDepthMask(false);
+Renderer::enable(Renderer::Feature::Blending);
+Renderer::setBlendFunction(Renderer::BlendFunction::One, Renderer::BlendFunction::One);
+transparentShader.setAlpha(0.4f)
+    ...;
+camera.draw(transparentDrawables);
+
+// Composite over the opaque result
+defaultFramebuffer.bind(FramebufferTarget::Draw);
+Renderer::disable(Renderer::Feature::DepthTest);
+Renderer::setBlendFunction(Renderer::BlendFunction::OneMinusSourceAlpha, Renderer::BlendFunction::SourceAlpha);
+compositingShader.setTransparencyBuffer(transparency);
+fullScreenTriangle.draw(compositingShader);
+
+Renderer::disable(Renderer::Feature::Blending);
+Renderer::enable(Renderer::Feature::DepthTest);
+Renderer::setDepthMask(true);
+@endcode
+
+@requires_gl30 Extension @extension{ARB,framebuffer_object} and
+    @extension{ARB,color_buffer_float}
+@requires_gles30 Multiple render targets are not available in OpenGL ES 2.0.
+    Rendering to float attachments requires @es_extension{EXT,color_buffer_half_float}
+    or @es_extension{EXT,color_buffer_float} in OpenGL ES 3.0.
+*/
+class MAGNUM_SHADERS_EXPORT TransparencyBuffer {
+    public:
+        enum: UnsignedInt {
+            /** Weighted premultiplied color and alpha output */
+            AccumulationOutput = 0,
+
+            /** Revealage output */
+            RevealageOutput = 1
+        };
+
+        /**
+         * @brief Constructor
+         * @param depth     Depth texture of the opaque pass
+         * @param size      Size of all attachments
+         *
+         * The @p depth texture is expected to have the same size.
+         */
+        explicit TransparencyBuffer(Texture2D& depth, const Vector2i& size);
+
+        /** @brief Size of all attachments */
+        Vector2i size() const { return _size; }
+
+        /** @brief Weighted color and alpha accumulation texture */
+        Texture2D& accumulationTexture() { return _accumulation; }
+
+        /** @brief Revealage texture */
+        Texture2D& revealageTexture() { return _revealage; }
+
+        /**
+         * @brief Framebuffer
+         *
+         * Color outputs @ref AccumulationOutput and @ref RevealageOutput are
+         * mapped to @ref accumulationTexture() and @ref revealageTexture(),
+         * respectively.
+         * @see @ref bindForWriting()
+         */
+        Framebuffer& framebuffer() { return _framebuffer; }
+
+        /**
+         * @brief Bind for writing
+         * @return Reference to self (for method chaining)
+         *
+         * Clears both color attachments to zero using
+         * @ref Framebuffer::clearColor(Int, const Color4&) and binds the
+         * framebuffer for drawing. Besides the framebuffer binding no global
+         * state is changed, in particular the clear color set by
+         * @ref Renderer::setClearColor() is left untouched. Depth is not
+         * cleared.
+         */
+        TransparencyBuffer& bindForWriting();
+
+    private:
+        Vector2i _size;
+        Texture2D _accumulation, _revealage;
+        Framebuffer _framebuffer;
+};
+
+}}
+#else
+#error this header is not available on OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -0,0 +1,50 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifdef EXPLICIT_TEXTURE_LAYER
+layout(binding = 0) uniform mediump sampler2D accumulationTexture;
+layout(binding = 1) uniform mediump sampler2D revealageTexture;
+#else
+uniform mediump sampler2D accumulationTexture;
+uniform mediump sampler2D revealageTexture;
+#endif
+
+out lowp vec4 color;
+
+void main() {
+    /* The revealage is a sum of -log(1 - alpha), see
+       WeightedBlendedTransparency.glsl */
+    ivec2 position = ivec2(gl_FragCoord.xy);
+    mediump float revealage = exp(-texelFetch(revealageTexture, position, 0).r);
+
+    /* Nothing transparent covers this pixel */
+    if(revealage >= 1.0) discard;
+
+    mediump vec4 accumulation = texelFetch(accumulationTexture, position, 0);
+
+    /* Weighted average color, blended over the opaque result with
+       OneMinusSourceAlpha, SourceAlpha */
+    color = vec4(accumulation.rgb/max(accumulation.a, 1.0e-5), revealage);
+}
@@ -0,0 +1,73 @@
+#ifndef Magnum_Shaders_TransparencyCompositing_h
+#define Magnum_Shaders_TransparencyCompositing_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Class @ref Magnum::Shaders::TransparencyCompositing
+ */
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Shaders/Shaders.h"
+#include "Magnum/Shaders/visibility.h"
+
+namespace Magnum { namespace Shaders {
+
+/**
+@brief Compositing pass shader for weighted blended transparency
+
+Resolves transparent surfaces accumulated in a @ref TransparencyBuffer and
+outputs their weighted average color with alpha equal to fraction of the
+background visible through them. The shader is drawn over the whole viewport
+using a mesh from @ref MeshTools::fullScreenTriangle() and expects blending
+with @ref Renderer::BlendFunction::OneMinusSourceAlpha as source and
+@ref Renderer::BlendFunction::SourceAlpha as destination factor. Pixels not
+covered by any transparent surface are discarded. The transparency buffer is
+expected to have the same size as the viewport. See
+@ref TransparencyBuffer for a complete example.
+@requires_gl30 Extension @extension{ARB,framebuffer_object}
+@requires_gles30 Multiple render targets are not available in OpenGL ES 2.0.
+@see @ref shaders
+*/
+class MAGNUM_SHADERS_EXPORT TransparencyCompositing: public AbstractShaderProgram {
+    public:
+        explicit TransparencyCompositing();
+
+        /**
+         * @brief Set transparency buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Binds both textures of the transparency buffer.
+         */
+        TransparencyCompositing& setTransparencyBuffer(TransparencyBuffer& buffer);
+};
+
+}}
+#else
+#error this header is not available on OpenGL ES 2.0 build
+#endif
+
+#endif
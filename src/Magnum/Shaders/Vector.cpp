@@ -41,7 +41,7 @@ namespace {
     template<> constexpr const char* vertexShaderName<3>() { return "AbstractVector3D.vert"; }
 }
 
-template<UnsignedInt dimensions> Vector<dimensions>::Vector(): transformationProjectionMatrixUniform(0), backgroundColorUniform(1), colorUniform(2) {
+template<UnsignedInt dimensions> Vector<dimensions>::Vector(const typename AbstractVector<dimensions>::Flags flags): AbstractVector<dimensions>{flags}, transformationProjectionMatrixUniform(0), backgroundColorUniform(1), colorUniform(2) {
     Utility::Resource rs("MagnumShaders");
 
     #ifndef MAGNUM_TARGET_GLES
@@ -53,9 +53,11 @@ template<UnsignedInt dimensions> Vector<dimensions>::Vector(): transformationPro
     Shader vert = Implementation::createCompatibilityShader(rs, version, Shader::Type::Vertex);
     Shader frag = Implementation::createCompatibilityShader(rs, version, Shader::Type::Fragment);
 
-    vert.addSource(rs.get("generic.glsl"))
+    vert.addSource(flags & AbstractVector<dimensions>::Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
+        .addSource(rs.get("generic.glsl"))
         .addSource(rs.get(vertexShaderName<dimensions>()));
-    frag.addSource(rs.get("Vector.frag"));
+    frag.addSource(flags & AbstractVector<dimensions>::Flag::VertexColor ? "#define VERTEX_COLOR\n" : "")
+        .addSource(rs.get("Vector.frag"));
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
 
@@ -69,6 +71,8 @@ template<UnsignedInt dimensions> Vector<dimensions>::Vector(): transformationPro
     {
         AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::Position::Location, "position");
         AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::TextureCoordinates::Location, "textureCoordinates");
+        if(flags & AbstractVector<dimensions>::Flag::VertexColor)
+            AbstractShaderProgram::bindAttributeLocation(AbstractVector<dimensions>::Color::Location, "vertexColor");
     }
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(AbstractShaderProgram::link());
@@ -45,11 +45,19 @@ uniform lowp sampler2D vectorTexture;
 
 in mediump vec2 fragmentTextureCoordinates;
 
+#ifdef VERTEX_COLOR
+in lowp vec4 interpolatedVertexColor;
+#endif
+
 #ifdef NEW_GLSL
 out lowp vec4 fragmentColor;
 #endif
 
 void main() {
     lowp float intensity = texture(vectorTexture, fragmentTextureCoordinates).r;
+    #ifndef VERTEX_COLOR
     fragmentColor = mix(backgroundColor, color, intensity);
+    #else
+    fragmentColor = mix(backgroundColor, color*interpolatedVertexColor, intensity);
+    #endif
 }
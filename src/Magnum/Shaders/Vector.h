@@ -87,7 +87,11 @@ mesh.draw(shader);
 */
 template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT Vector: public AbstractVector<dimensions> {
     public:
-        Vector();
+        /**
+         * @brief Constructor
+         * @param flags     Flags
+         */
+        explicit Vector(typename AbstractVector<dimensions>::Flags flags = typename AbstractVector<dimensions>::Flags());
 
         /**
          * @brief Set transformation and projection matrix
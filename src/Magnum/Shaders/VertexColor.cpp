@@ -27,6 +27,7 @@
 
 #include <Corrade/Utility/Resource.h>
 
+#include "Magnum/Buffer.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Shader.h"
@@ -41,7 +42,7 @@ namespace {
     template<> constexpr const char* vertexShaderName<3>() { return "VertexColor3D.vert"; }
 }
 
-template<UnsignedInt dimensions> VertexColor<dimensions>::VertexColor(): transformationProjectionMatrixUniform(0) {
+template<UnsignedInt dimensions> VertexColor<dimensions>::VertexColor(const Flags flags): transformationProjectionMatrixUniform(0), _flags(flags) {
     Utility::Resource rs("MagnumShaders");
 
     #ifndef MAGNUM_TARGET_GLES
@@ -50,9 +51,18 @@ template<UnsignedInt dimensions> VertexColor<dimensions>::VertexColor(): transfo
     const Version version = Context::current()->supportedVersion({Version::GLES300, Version::GLES200});
     #endif
 
+    #ifndef MAGNUM_TARGET_GLES
+    if(flags & Flag::UniformBuffers)
+        MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::uniform_buffer_object);
+    #endif
+
     Shader vert = Implementation::createCompatibilityShader(rs, version, Shader::Type::Vertex);
     Shader frag = Implementation::createCompatibilityShader(rs, version, Shader::Type::Fragment);
 
+    #ifndef MAGNUM_TARGET_GLES2
+    vert.addSource(flags & Flag::UniformBuffers ? "#define UNIFORM_BUFFERS\n" : "")
+        .addSource(flags & Flag::InstancedTransformation ? "#define INSTANCED_TRANSFORMATION\n" : "");
+    #endif
     vert.addSource(rs.get("generic.glsl"))
         .addSource(rs.get(vertexShaderName<dimensions>()));
     frag.addSource(rs.get("VertexColor.frag"));
@@ -69,10 +79,21 @@ template<UnsignedInt dimensions> VertexColor<dimensions>::VertexColor(): transfo
     {
         bindAttributeLocation(Position::Location, "position");
         bindAttributeLocation(Color::Location, "color");
+        #ifndef MAGNUM_TARGET_GLES2
+        if(flags & Flag::InstancedTransformation) bindAttributeLocation(TransformationMatrix::Location, "instancedTransformationMatrix");
+        #endif
     }
 
     CORRADE_INTERNAL_ASSERT_OUTPUT(link());
 
+    #ifndef MAGNUM_TARGET_GLES2
+    if(flags & Flag::UniformBuffers) {
+        setUniformBlockBinding(uniformBlockIndex("Transformation"), Generic<dimensions>::TransformationBufferBinding);
+
+        /* The plain uniform is not present at all, make the setter no-op */
+        transformationProjectionMatrixUniform = -1;
+    } else
+    #endif
     #ifndef MAGNUM_TARGET_GLES
     if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::explicit_uniform_location>(version))
     #endif
@@ -86,6 +107,15 @@ template<UnsignedInt dimensions> VertexColor<dimensions>::VertexColor(): transfo
     #endif
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+template<UnsignedInt dimensions> VertexColor<dimensions>& VertexColor<dimensions>::bindTransformationBuffer(Buffer& buffer, const GLintptr offset) {
+    CORRADE_ASSERT(_flags & Flag::UniformBuffers,
+        "Shaders::VertexColor::bindTransformationBuffer(): the shader was not created with uniform buffers enabled", *this);
+    buffer.bind(Buffer::Target::Uniform, Generic<dimensions>::TransformationBufferBinding, offset, sizeof(TransformationUniform));
+    return *this;
+}
+#endif
+
 template class VertexColor<2>;
 template class VertexColor<3>;
 
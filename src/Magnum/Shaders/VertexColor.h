@@ -38,6 +38,16 @@
 
 namespace Magnum { namespace Shaders {
 
+namespace Implementation {
+    enum class VertexColorFlag: UnsignedByte {
+        #ifndef MAGNUM_TARGET_GLES2
+        UniformBuffers = 1 << 0,
+        InstancedTransformation = 1 << 1
+        #endif
+    };
+    typedef Containers::EnumSet<VertexColorFlag> VertexColorFlags;
+}
+
 /**
 @brief Vertex color shader
 
@@ -97,21 +107,117 @@ template<UnsignedInt dimensions> class MAGNUM_SHADERS_EXPORT VertexColor: public
          */
         typedef Attribute<3, Color3> Color;
 
-        explicit VertexColor();
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Per-instance transformation matrix
+         *
+         * @ref shaders-generic "Generic attribute", @ref Matrix3 in 2D,
+         * @ref Matrix4 in 3D. Used only if @ref Flag::InstancedTransformation
+         * is set.
+         * @requires_gles30 Instanced attributes are not available in OpenGL
+         *      ES 2.0.
+         */
+        typedef typename Generic<dimensions>::TransformationMatrix TransformationMatrix;
+        #endif
+
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        /**
+         * @brief Flag
+         *
+         * @see @ref Flags, @ref flags()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * The shader takes transformation from uniform buffer instead of
+             * plain uniform.
+             * @see @ref bindTransformationBuffer()
+             * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+             * @requires_gles30 Uniform buffers are not available in OpenGL
+             *      ES 2.0.
+             */
+            UniformBuffers = 1 << 0,
+
+            /**
+             * The transformation is multiplied with per-instance
+             * @ref TransformationMatrix attribute, similarly to
+             * @ref Shaders-Flat-instancing "Flat shader".
+             * @requires_gles30 Instanced attributes are not available in
+             *      OpenGL ES 2.0.
+             */
+            InstancedTransformation = 1 << 1
+        };
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref flags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+        #else
+        typedef Implementation::VertexColorFlag Flag;
+        typedef Implementation::VertexColorFlags Flags;
+        #endif
+
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Transformation uniform block
+         *
+         * Used only if @ref Flag::UniformBuffers is set.
+         * @see @ref bindTransformationBuffer()
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         */
+        typedef TransformationProjectionUniform<dimensions> TransformationUniform;
+        #endif
+
+        /**
+         * @brief Constructor
+         * @param flags     Flags
+         */
+        explicit VertexColor(Flags flags = Flags());
+
+        /** @brief Flags */
+        Flags flags() const { return _flags; }
 
         /**
          * @brief Set transformation and projection matrix
          * @return Reference to self (for method chaining)
          *
-         * Default is identity matrix.
+         * Default is identity matrix. Has no effect if
+         * @ref Flag::UniformBuffers is set.
+         * @see @ref bindTransformationBuffer()
          */
         VertexColor<dimensions>& setTransformationProjectionMatrix(const MatrixTypeFor<dimensions, Float>& matrix) {
             setUniform(transformationProjectionMatrixUniform, matrix);
             return *this;
         }
 
+        #ifndef MAGNUM_TARGET_GLES2
+        /**
+         * @brief Bind transformation uniform buffer
+         * @param buffer    Buffer with @ref TransformationUniform data
+         * @param offset    Offset of the data in the buffer
+         * @return Reference to self (for method chaining)
+         *
+         * Binds given range of the buffer to
+         * @ref Generic::TransformationBufferBinding. Expects that
+         * @ref Flag::UniformBuffers is set. The @p offset must be a multiple
+         * of @ref Buffer::uniformOffsetAlignment(). See
+         * @ref Shaders-Flat-uniform-buffers "Flat shader documentation" for
+         * an example.
+         * @see @ref Buffer::bind(Buffer::Target, UnsignedInt, GLintptr, GLsizeiptr)
+         * @requires_gl31 Extension @extension{ARB,uniform_buffer_object}
+         * @requires_gles30 Uniform buffers are not available in OpenGL ES
+         *      2.0.
+         */
+        VertexColor<dimensions>& bindTransformationBuffer(Buffer& buffer, GLintptr offset = 0);
+        #endif
+
     private:
         Int transformationProjectionMatrixUniform;
+
+        Flags _flags;
 };
 
 /** @brief 2D vertex color shader */
@@ -120,6 +226,8 @@ typedef VertexColor<2> VertexColor2D;
 /** @brief 3D vertex color shader */
 typedef VertexColor<3> VertexColor3D;
 
+CORRADE_ENUMSET_OPERATORS(Implementation::VertexColorFlags)
+
 }}
 
 #endif
@@ -28,7 +28,11 @@
 #define out varying
 #endif
 
-#ifndef GL_ES
+#ifdef UNIFORM_BUFFERS
+layout(std140) uniform Transformation {
+    highp mat3 transformationProjectionMatrix;
+};
+#elif !defined(GL_ES)
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 0) uniform mat3 transformationProjectionMatrix = mat3(1.0);
 #else
@@ -46,9 +50,21 @@ in highp vec2 position;
 in lowp vec3 color;
 #endif
 
+#ifdef INSTANCED_TRANSFORMATION
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TRANSFORMATION_MATRIX_ATTRIBUTE_LOCATION) in highp mat3 instancedTransformationMatrix;
+#else
+in highp mat3 instancedTransformationMatrix;
+#endif
+#endif
+
 out lowp vec3 interpolatedColor;
 
 void main() {
+    #ifdef INSTANCED_TRANSFORMATION
+    gl_Position.xywz = vec4(transformationProjectionMatrix*instancedTransformationMatrix*vec3(position, 1.0), 0.0);
+    #else
     gl_Position.xywz = vec4(transformationProjectionMatrix*vec3(position, 1.0), 0.0);
+    #endif
     interpolatedColor = color;
 }
@@ -28,7 +28,11 @@
 #define out varying
 #endif
 
-#ifndef GL_ES
+#ifdef UNIFORM_BUFFERS
+layout(std140) uniform Transformation {
+    highp mat4 transformationProjectionMatrix;
+};
+#elif !defined(GL_ES)
 #ifdef EXPLICIT_UNIFORM_LOCATION
 layout(location = 0) uniform mat4 transformationProjectionMatrix = mat4(1.0);
 #else
@@ -46,9 +50,21 @@ in highp vec4 position;
 in lowp vec3 color;
 #endif
 
+#ifdef INSTANCED_TRANSFORMATION
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = TRANSFORMATION_MATRIX_ATTRIBUTE_LOCATION) in highp mat4 instancedTransformationMatrix;
+#else
+in highp mat4 instancedTransformationMatrix;
+#endif
+#endif
+
 out lowp vec3 interpolatedColor;
 
 void main() {
+    #ifdef INSTANCED_TRANSFORMATION
+    gl_Position = transformationProjectionMatrix*instancedTransformationMatrix*position;
+    #else
     gl_Position = transformationProjectionMatrix*position;
+    #endif
     interpolatedColor = color;
 }
@@ -0,0 +1,46 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/* Weighted blended order-independent transparency by McGuire and Bavoil.
+   Both outputs are accumulated with additive blending. Revealage, which is
+   a product of (1 - alpha) of all surfaces, is stored as a sum of
+   -log(1 - alpha) instead, so the same blend function can be used for both
+   attachments. Locations match TransparencyBuffer::AccumulationOutput and
+   RevealageOutput. */
+#ifdef EXPLICIT_ATTRIB_LOCATION
+layout(location = 0) out mediump vec4 accumulation;
+layout(location = 1) out mediump float revealage;
+#else
+out mediump vec4 accumulation;
+out mediump float revealage;
+#endif
+
+void writeWeightedBlended(lowp vec4 color) {
+    /* Depth weight, equation (10) from the paper, using window-space depth */
+    highp float depth = 1.0 - gl_FragCoord.z;
+    mediump float weight = clamp(color.a*max(1.0e-2, 3.0e3*depth*depth*depth), 1.0e-2, 3.0e3);
+    accumulation = vec4(color.rgb*color.a, color.a)*weight;
+    revealage = -log(max(1.0 - color.a, 1.0e-4));
+}
@@ -26,3 +26,9 @@
 #define POSITION_ATTRIBUTE_LOCATION 0
 #define TEXTURECOORDINATES_ATTRIBUTE_LOCATION 1
 #define NORMAL_ATTRIBUTE_LOCATION 2
+#define COLOR_ATTRIBUTE_LOCATION 3
+#define TRANSFORMATION_MATRIX_ATTRIBUTE_LOCATION 4
+#define NORMAL_MATRIX_ATTRIBUTE_LOCATION 8
+#define JOINT_IDS_ATTRIBUTE_LOCATION 11
+#define WEIGHTS_ATTRIBUTE_LOCATION 12
+#define TEXTURE_LAYER_ATTRIBUTE_LOCATION 13
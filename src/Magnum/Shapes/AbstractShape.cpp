@@ -28,13 +28,22 @@
 #include <Corrade/Utility/Debug.h>
 
 #include "Magnum/Shapes/Collision.h"
+#include "Magnum/Shapes/RaycastHit.h"
 #include "Magnum/Shapes/ShapeGroup.h"
 #include "Magnum/Shapes/Implementation/CollisionDispatch.h"
+#include "Magnum/Shapes/Implementation/RaycastDispatch.h"
 
 namespace Magnum { namespace Shapes {
 
-template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float>(object, group) {
+template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float>(object, group), _proxy{-1}, _queued{false}, _unbounded{false} {
     SceneGraph::AbstractFeature<dimensions, Float>::setCachedTransformations(SceneGraph::CachedTransformation::Absolute);
+
+    /* The object might be dirty already, so markDirty() won't be called */
+    if(group) group->enqueue(*this);
+}
+
+template<UnsignedInt dimensions> AbstractShape<dimensions>::~AbstractShape() {
+    if(group()) group()->untrack(*this);
 }
 
 template<UnsignedInt dimensions> ShapeGroup<dimensions>* AbstractShape<dimensions>::group() {
@@ -57,8 +66,16 @@ template<UnsignedInt dimensions> Collision<dimensions> AbstractShape<dimensions>
     return Implementation::collision(abstractTransformedShape(), other.abstractTransformedShape());
 }
 
+template<UnsignedInt dimensions> RaycastHit<dimensions> AbstractShape<dimensions>::raycast(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, const Float maxDistance) const {
+    return Implementation::raycast(abstractTransformedShape(), origin, direction, maxDistance);
+}
+
+template<UnsignedInt dimensions> RaycastHit<dimensions> AbstractShape<dimensions>::sweep(const Sphere<dimensions>& sphere, const VectorTypeFor<dimensions, Float>& displacement, const Float maxDistance) const {
+    return Implementation::sweep(abstractTransformedShape(), sphere, displacement, maxDistance);
+}
+
 template<UnsignedInt dimensions> void AbstractShape<dimensions>::markDirty() {
-    if(group()) group()->setDirty();
+    if(group()) group()->enqueue(*this);
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
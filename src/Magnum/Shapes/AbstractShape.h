@@ -31,6 +31,7 @@
 
 #include "Magnum/Magnum.h"
 #include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Constants.h"
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
 #include "Magnum/Shapes/shapeImplementation.h"
 #include "Magnum/Shapes/visibility.h"
@@ -52,6 +53,7 @@ This class is not directly instantiable, use @ref Shape instead. See
 */
 template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: public SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float> {
     friend const Implementation::AbstractShape<dimensions>& Implementation::getAbstractShape<>(const AbstractShape<dimensions>&);
+    friend ShapeGroup<dimensions>;
 
     public:
         enum: UnsignedInt {
@@ -82,6 +84,13 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
          */
         explicit AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group = nullptr);
 
+        /**
+         * @brief Destructor
+         *
+         * Removes the shape from acceleration structure of its group.
+         */
+        ~AbstractShape();
+
         /**
          * @brief Shape group containing this shape
          *
@@ -107,12 +116,50 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
          */
         Collision<dimensions> collision(const AbstractShape<dimensions>& other) const;
 
+        /**
+         * @brief Raycast the shape
+         * @param origin        Ray origin
+         * @param direction     Ray direction
+         * @param maxDistance   Maximal hit distance, in units of direction
+         *      length
+         *
+         * Returns the nearest hit of the ray with the shape, see
+         * @ref RaycastHit for more information. Points, lines, line
+         * segments and compositions are never hit, planes are two-sided.
+         * @see @ref ShapeGroup::raycast()
+         */
+        RaycastHit<dimensions> raycast(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, Float maxDistance = Constants::inf()) const;
+
+        /**
+         * @brief Sweep a sphere against the shape
+         * @param sphere        Moving sphere at its initial position
+         * @param displacement  Sphere displacement
+         * @param maxDistance   Maximal distance, in units of displacement
+         *      length
+         *
+         * Returns the first contact of the sphere moving along given
+         * displacement with the shape. Hit distance is the time of impact
+         * in units of the displacement, i.e. in range @f$ [0, 1] @f$ for the
+         * default @p maxDistance, hit normal is surface normal of the shape
+         * enlarged by the sphere radius. If the sphere overlaps the shape at
+         * the initial position, the distance is `0`. Unlike discrete
+         * collision detection using @ref collides(), fast moving spheres
+         * can't tunnel through thin shapes. Compositions are never hit,
+         * boxes are expected to not have any shear in their transformation.
+         * @see @ref ShapeGroup::sweep()
+         */
+        RaycastHit<dimensions> sweep(const Sphere<dimensions>& sphere, const VectorTypeFor<dimensions, Float>& displacement, Float maxDistance = 1.0f) const;
+
     protected:
         /** Marks also the group as dirty */
         void markDirty() override;
 
     private:
         virtual const Implementation::AbstractShape<dimensions> MAGNUM_SHAPES_LOCAL & abstractTransformedShape() const = 0;
+
+        /* Broad-phase bookkeeping, managed by ShapeGroup */
+        Int _proxy;
+        bool _queued, _unbounded;
 };
 
 /** @brief Base class for two-dimensional object shapes */
@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::Shapes::Composition, typedef @ref Magnum::Shapes::Composition2D, @ref Magnum::Shapes::Composition3D, enum @ref Magnum::Shapes::CompositionOperation
+ * @brief Class @ref Magnum::Shapes::Composition, @ref Magnum::Shapes::CompositionExpression, typedef @ref Magnum::Shapes::Composition2D, @ref Magnum::Shapes::Composition3D, enum @ref Magnum::Shapes::CompositionOperation
  */
 
 #include <type_traits>
@@ -59,10 +59,35 @@ enum class CompositionOperation: UnsignedByte {
     Or      /**< Boolean OR */
 };
 
+template<CompositionOperation operation, class T, class U = void> class CompositionExpression;
+
+namespace Implementation {
+    /* Whether given type can be an operand of logical operations on shapes,
+       i.e. it is either a shape or composition expression */
+    template<class T> std::true_type isCompositionOperand(decltype(TypeOf<T>::type())*);
+    template<class> std::false_type isCompositionOperand(...);
+    template<class T> struct IsCompositionOperand: decltype(isCompositionOperand<T>(nullptr)) {};
+    template<CompositionOperation operation, class T, class U> struct IsCompositionOperand<CompositionExpression<operation, T, U>>: std::true_type {};
+
+    /* Statically dispatched collision test, combinations which don't have
+       any collision test implemented never collide, consistently with the
+       runtime dispatch */
+    template<class T, class U> inline auto collidesStatic(const T& a, const U& b, int) -> decltype(bool(a % b)) {
+        return a % b;
+    }
+    template<class T, class U> inline bool collidesStatic(const T&, const U&, ...) {
+        return false;
+    }
+}
+
 /**
 @brief Composition of shapes
 
-Result of logical operations on shapes. See @ref shapes for brief introduction.
+Result of logical operations on shapes. The structure is stored at runtime,
+thus the composition can be stored in @ref Shape and its structure can be
+changed without changing its type. The logical operators produce
+@ref CompositionExpression, which is implicitly convertible to this class.
+See @ref shapes for brief introduction.
 */
 template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT Composition {
     friend Implementation::AbstractShape<dimensions>& Implementation::getAbstractShape<>(Composition<dimensions>&, std::size_t);
@@ -209,13 +234,140 @@ template<UnsignedInt dimensions, class T> inline auto operator%(const T& a, cons
     return b % a;
 }
 
+/**
+@brief Composition expression
+
+Result of logical operations on shapes. Unlike @ref Composition the whole
+structure is known at compile time, so the collision tests are dispatched
+statically and the whole expression can be inlined. Short-circuit evaluation
+is preserved. The expression is implicitly convertible to @ref Composition,
+which can be stored in @ref Shape. Example:
+@code
+Shapes::Sphere3D sphere;
+Shapes::AxisAlignedBox3D box;
+
+auto expression = sphere && !box;
+bool collides = expression % Shapes::Point3D{{0.5f, 1.0f, 0.0f}};
+
+Shapes::Composition3D composition = expression;
+@endcode
+
+This is the binary operation variant, @p operation is either
+@ref CompositionOperation::And or @ref CompositionOperation::Or.
+@see @ref CompositionExpression<CompositionOperation::Not, T, void>
+*/
+template<CompositionOperation operation, class T, class U> class CompositionExpression {
+    static_assert(operation != CompositionOperation::Not, "Shapes::CompositionExpression: binary operation expected");
+    static_assert(UnsignedInt(T::Dimensions) == UnsignedInt(U::Dimensions), "Shapes::CompositionExpression: operands must have the same dimension count");
+
+    public:
+        enum: UnsignedInt {
+            Dimensions = T::Dimensions /**< Dimension count */
+        };
+
+        /**
+         * @brief Constructor
+         * @param first     Left operand
+         * @param second    Right operand
+         */
+        explicit CompositionExpression(T first, U second): _first(std::move(first)), _second(std::move(second)) {}
+
+        /** @brief Left operand */
+        const T& first() const { return _first; }
+
+        /** @brief Right operand */
+        const U& second() const { return _second; }
+
+        /** @brief Transformed expression */
+        CompositionExpression<operation, T, U> transformed(const MatrixTypeFor<Dimensions, Float>& matrix) const {
+            return CompositionExpression<operation, T, U>{_first.transformed(matrix), _second.transformed(matrix)};
+        }
+
+        /** @brief Convert to runtime composition */
+        operator Composition<Dimensions>() const;
+
+        /** @brief Collision with another shape */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        template<class V> bool operator%(const V& other) const {
+        #else
+        template<class V> auto operator%(const V& other) const -> typename std::enable_if<std::is_same<decltype(Implementation::TypeOf<V>::type()), typename Implementation::ShapeDimensionTraits<Dimensions>::Type>::value, bool>::type {
+        #endif
+            /* Short-circuit evaluation for AND/OR */
+            const bool collidesFirst = Implementation::collidesStatic(_first, other, 0);
+            if((operation == CompositionOperation::Or) == collidesFirst)
+                return collidesFirst;
+
+            return Implementation::collidesStatic(_second, other, 0);
+        }
+
+    private:
+        T _first;
+        U _second;
+};
+
+/**
+@brief Negation composition expression
+
+Unary variant of @ref CompositionExpression, see its documentation for more
+information.
+*/
+template<class T> class CompositionExpression<CompositionOperation::Not, T, void> {
+    public:
+        enum: UnsignedInt {
+            Dimensions = T::Dimensions /**< Dimension count */
+        };
+
+        /**
+         * @brief Constructor
+         * @param first     Operand
+         */
+        explicit CompositionExpression(T first): _first(std::move(first)) {}
+
+        /** @brief Operand */
+        const T& first() const { return _first; }
+
+        /** @brief Transformed expression */
+        CompositionExpression<CompositionOperation::Not, T, void> transformed(const MatrixTypeFor<Dimensions, Float>& matrix) const {
+            return CompositionExpression<CompositionOperation::Not, T, void>{_first.transformed(matrix)};
+        }
+
+        /** @brief Convert to runtime composition */
+        operator Composition<Dimensions>() const;
+
+        /** @brief Collision with another shape */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        template<class V> bool operator%(const V& other) const {
+        #else
+        template<class V> auto operator%(const V& other) const -> typename std::enable_if<std::is_same<decltype(Implementation::TypeOf<V>::type()), typename Implementation::ShapeDimensionTraits<Dimensions>::Type>::value, bool>::type {
+        #endif
+            return !Implementation::collidesStatic(_first, other, 0);
+        }
+
+    private:
+        T _first;
+};
+
+/** @relates CompositionExpression
+@brief Collision occurence of shape with composition expression
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T, CompositionOperation operation, class U, class V> inline bool operator%(const T& a, const CompositionExpression<operation, U, V>& b) {
+#else
+template<class T, CompositionOperation operation, class U, class V> inline auto operator%(const T& a, const CompositionExpression<operation, U, V>& b) -> decltype(b % a) {
+#endif
+    return b % a;
+}
+
 #ifdef DOXYGEN_GENERATING_OUTPUT
-/** @relates Composition
+/** @relates CompositionExpression
 @brief Logical NOT of shape
+
+The operand can be a shape, @ref Composition or another
+@ref CompositionExpression.
 */
-template<class T> inline Composition<T::Dimensions> operator!(T a);
+template<class T> inline CompositionExpression<CompositionOperation::Not, T> operator!(T a);
 
-/** @relates Composition
+/** @relates CompositionExpression
 @brief Logical AND of two shapes
 
 [Short-circuit evaluation](http://en.wikipedia.org/wiki/Short-circuit_evaluation)
@@ -223,39 +375,53 @@ is used here, so this operation can be used for providing simplified shape
 version, because collision with @p b is computed only if @p a collides.
 See @ref shapes-simplification for an example.
 */
-template<class T> inline Composition<T::Dimensions> operator&&(T a, T b);
+template<class T, class U> inline CompositionExpression<CompositionOperation::And, T, U> operator&&(T a, U b);
 
-/** @relates Composition
+/** @relates CompositionExpression
 @brief Logical OR of two shapes
 
 [Short-circuit evaluation](http://en.wikipedia.org/wiki/Short-circuit_evaluation)
 is used, so if collision with @p a is detected, collision with @p b is not
 computed.
 */
-template<class T> inline Composition<T::Dimensions> operator||(T a, T b);
+template<class T, class U> inline CompositionExpression<CompositionOperation::Or, T, U> operator||(T a, U b);
 #endif
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
-#define enableIfIsShapeType typename std::enable_if< \
-    std::is_same<decltype(Implementation::TypeOf<T>::type()), typename Implementation::ShapeDimensionTraits<T::Dimensions>::Type>::value, \
-    Composition<T::Dimensions>>::type
-#define enableIfAreShapeType typename std::enable_if< \
-    std::is_same<decltype(Implementation::TypeOf<T>::type()), typename Implementation::ShapeDimensionTraits<T::Dimensions>::Type>::value && \
-    std::is_same<decltype(Implementation::TypeOf<U>::type()), typename Implementation::ShapeDimensionTraits<T::Dimensions>::Type>::value, \
-    Composition<T::Dimensions>>::type
-template<class T> inline auto operator!(T&& a) -> enableIfIsShapeType {
-    return Composition<T::Dimensions>(CompositionOperation::Not, std::forward<T>(a));
+#define enableIfIsOperand(operation) typename std::enable_if< \
+    Implementation::IsCompositionOperand<typename std::decay<T>::type>::value, \
+    CompositionExpression<operation, typename std::decay<T>::type>>::type
+#define enableIfAreOperands(operation) typename std::enable_if< \
+    Implementation::IsCompositionOperand<typename std::decay<T>::type>::value && \
+    Implementation::IsCompositionOperand<typename std::decay<U>::type>::value, \
+    CompositionExpression<operation, typename std::decay<T>::type, typename std::decay<U>::type>>::type
+template<class T> inline auto operator!(T&& a) -> enableIfIsOperand(CompositionOperation::Not) {
+    return CompositionExpression<CompositionOperation::Not, typename std::decay<T>::type>{std::forward<T>(a)};
 }
-template<class T, class U> inline auto operator&&(T&& a, U&& b) -> enableIfAreShapeType {
-    return Composition<T::Dimensions>(CompositionOperation::And, std::forward<T>(a), std::forward<U>(b));
+template<class T, class U> inline auto operator&&(T&& a, U&& b) -> enableIfAreOperands(CompositionOperation::And) {
+    return CompositionExpression<CompositionOperation::And, typename std::decay<T>::type, typename std::decay<U>::type>{std::forward<T>(a), std::forward<U>(b)};
 }
-template<class T, class U> inline auto operator||(T&& a, U&& b) -> enableIfAreShapeType {
-    return Composition<T::Dimensions>(CompositionOperation::Or, std::forward<T>(a), std::forward<U>(b));
+template<class T, class U> inline auto operator||(T&& a, U&& b) -> enableIfAreOperands(CompositionOperation::Or) {
+    return CompositionExpression<CompositionOperation::Or, typename std::decay<T>::type, typename std::decay<U>::type>{std::forward<T>(a), std::forward<U>(b)};
 }
-#undef enableIfIsShapeType
-#undef enableIfAreShapeType
+#undef enableIfIsOperand
+#undef enableIfAreOperands
 #endif
 
+namespace Implementation {
+    /* Operands of runtime composition, expressions are converted */
+    template<class T> inline const T& compositionOperand(const T& a) { return a; }
+    template<CompositionOperation operation, class T, class U> inline Composition<T::Dimensions> compositionOperand(const CompositionExpression<operation, T, U>& a) { return a; }
+}
+
+template<CompositionOperation operation, class T, class U> CompositionExpression<operation, T, U>::operator Composition<Dimensions>() const {
+    return Composition<Dimensions>{operation, Implementation::compositionOperand(_first), Implementation::compositionOperand(_second)};
+}
+
+template<class T> CompositionExpression<CompositionOperation::Not, T, void>::operator Composition<Dimensions>() const {
+    return Composition<Dimensions>{CompositionOperation::Not, Implementation::compositionOperand(_first)};
+}
+
 template<UnsignedInt dimensions> template<class T> Composition<dimensions>::Composition(CompositionOperation operation, T&& a): _shapes(shapeCount(a)), _nodes(nodeCount(a)+1) {
     CORRADE_ASSERT(operation == CompositionOperation::Not,
         "Shapes::Composition::Composition(): unary operation expected", );
@@ -35,95 +35,147 @@
 #include "Magnum/Shapes/Sphere.h"
 #include "Magnum/Shapes/shapeImplementation.h"
 
+#include <algorithm>
+
 namespace Magnum { namespace Shapes { namespace Implementation {
 
-template<> bool collides(const AbstractShape<2>& a, const AbstractShape<2>& b) {
-    if(a.type() < b.type()) return collides(b, a);
+namespace {
+    /* Dense index of each shape type. The type numbers are primes, so they
+       are too sparse to index the tables directly. */
+    enum: std::size_t { TypeCount = 11 };
+    constexpr UnsignedByte TypeIndex[]{
+        0xff,  0,  1,  2, 0xff,  3, 0xff,  4, 0xff, 0xff,   /*  0 -  9 */
+        0xff,  5, 0xff,  6, 0xff, 0xff, 0xff,  7, 0xff,  8, /* 10 - 19 */
+        0xff, 0xff, 0xff,  9, 0xff, 0xff, 0xff, 0xff, 0xff, 10 /* 20 - 29 */
+    };
+
+    template<class T> constexpr std::size_t typeIndex() {
+        return TypeIndex[UnsignedInt(TypeOf<T>::type())];
+    }
 
-    switch(UnsignedInt(a.type())*UnsignedInt(b.type())) {
-        #define _c(aType, aClass, bType, bClass) \
-            case UnsignedInt(ShapeDimensionTraits<2>::Type::aType)*UnsignedInt(ShapeDimensionTraits<2>::Type::bType): \
-                return static_cast<const Shape<aClass>&>(a).shape % static_cast<const Shape<bClass>&>(b).shape;
-        _c(Sphere, Sphere2D, Point, Point2D)
-        _c(Sphere, Sphere2D, Line, Line2D)
-        _c(Sphere, Sphere2D, LineSegment, LineSegment2D)
-        _c(Sphere, Sphere2D, Sphere, Sphere2D)
+    template<UnsignedInt dimensions> inline std::size_t typeIndex(const AbstractShape<dimensions>& shape) {
+        return TypeIndex[UnsignedInt(shape.type())];
+    }
 
-        _c(InvertedSphere, InvertedSphere2D, Point, Point2D)
-        _c(InvertedSphere, InvertedSphere2D, Sphere, Sphere2D)
+    template<class A, class B> bool collidesPair(const AbstractShape<A::Dimensions>& a, const AbstractShape<A::Dimensions>& b) {
+        return static_cast<const Shape<A>&>(a).shape % static_cast<const Shape<B>&>(b).shape;
+    }
 
-        _c(Cylinder, Cylinder2D, Point, Point2D)
-        _c(Cylinder, Cylinder2D, Sphere, Sphere2D)
+    template<class A, class B> void collidesBatch(const Containers::ArrayReference<const ShapePair<A::Dimensions>> pairs, bool* const results) {
+        for(std::size_t i = 0; i != pairs.size(); ++i)
+            results[i] = static_cast<const Shape<A>&>(*pairs[i].first).shape % static_cast<const Shape<B>&>(*pairs[i].second).shape;
+    }
 
-        _c(Capsule, Capsule2D, Point, Point2D)
-        _c(Capsule, Capsule2D, Sphere, Sphere2D)
+    template<class A, class B> Collision<A::Dimensions> collisionPair(const AbstractShape<A::Dimensions>& a, const AbstractShape<A::Dimensions>& b) {
+        return static_cast<const Shape<A>&>(a).shape / static_cast<const Shape<B>&>(b).shape;
+    }
 
-        _c(AxisAlignedBox, AxisAlignedBox2D, Point, Point2D)
-        #undef _c
+    /* Same as above, with the shapes passed in reverse order. The collision
+       is computed with the shape with higher type number first regardless
+       of the order. */
+    template<class A, class B> Collision<A::Dimensions> collisionPairReversed(const AbstractShape<A::Dimensions>& b, const AbstractShape<A::Dimensions>& a) {
+        return collisionPair<A, B>(a, b);
     }
 
-    return false;
-}
+    /* Type pair function tables, nullptr entries are combinations without
+       any implementation. The collides() table is filled in both orders, so
+       the shapes don't need to be sorted before the lookup. */
+    template<UnsignedInt dimensions> struct DispatchTable {
+        explicit DispatchTable();
+
+        template<class A, class B> void add() {
+            collides[typeIndex<A>()][typeIndex<B>()] = collidesPair<A, B>;
+            collides[typeIndex<B>()][typeIndex<A>()] = collidesPair<B, A>;
+            collidesBatch[typeIndex<A>()][typeIndex<B>()] = Implementation::collidesBatch<A, B>;
+        }
+
+        template<class A, class B> void addCollision() {
+            collision[typeIndex<A>()][typeIndex<B>()] = collisionPair<A, B>;
+            collision[typeIndex<B>()][typeIndex<A>()] = collisionPairReversed<A, B>;
+        }
+
+        bool(*collides[TypeCount][TypeCount])(const AbstractShape<dimensions>&, const AbstractShape<dimensions>&);
+        void(*collidesBatch[TypeCount][TypeCount])(Containers::ArrayReference<const ShapePair<dimensions>>, bool*);
+        Collision<dimensions>(*collision[TypeCount][TypeCount])(const AbstractShape<dimensions>&, const AbstractShape<dimensions>&);
+    };
+
+    template<> DispatchTable<2>::DispatchTable(): collides{}, collidesBatch{}, collision{} {
+        add<Sphere2D, Point2D>();
+        add<Sphere2D, Line2D>();
+        add<Sphere2D, LineSegment2D>();
+        add<Sphere2D, Sphere2D>();
 
-template<> Collision<2> collision(const AbstractShape<2>& a, const AbstractShape<2>& b) {
-    if(a.type() < b.type()) return collision(b, a);
+        add<InvertedSphere2D, Point2D>();
+        add<InvertedSphere2D, Sphere2D>();
 
-    switch(UnsignedInt(a.type())*UnsignedInt(b.type())) {
-        #define _c(aType, aClass, bType, bClass) \
-            case UnsignedInt(ShapeDimensionTraits<2>::Type::aType)*UnsignedInt(ShapeDimensionTraits<2>::Type::bType): \
-                return static_cast<const Shape<aClass>&>(a).shape / static_cast<const Shape<bClass>&>(b).shape;
-        _c(Sphere, Sphere2D, Point, Point2D)
-        _c(Sphere, Sphere2D, Sphere, Sphere2D)
-        #undef _c
+        add<Cylinder2D, Point2D>();
+        add<Cylinder2D, Sphere2D>();
+
+        add<Capsule2D, Point2D>();
+        add<Capsule2D, Sphere2D>();
+
+        add<AxisAlignedBox2D, Point2D>();
+
+        addCollision<Sphere2D, Point2D>();
+        addCollision<Sphere2D, Sphere2D>();
     }
 
-    return {};
-}
+    template<> DispatchTable<3>::DispatchTable(): collides{}, collidesBatch{}, collision{} {
+        add<Sphere3D, Point3D>();
+        add<Sphere3D, Line3D>();
+        add<Sphere3D, LineSegment3D>();
+        add<Sphere3D, Sphere3D>();
 
-template<> bool collides(const AbstractShape<3>& a, const AbstractShape<3>& b) {
-    if(a.type() < b.type()) return collides(b, a);
+        add<InvertedSphere3D, Point3D>();
+        add<InvertedSphere3D, Sphere3D>();
 
-    switch(UnsignedInt(a.type())*UnsignedInt(b.type())) {
-        #define _c(aType, aClass, bType, bClass) \
-            case UnsignedInt(ShapeDimensionTraits<3>::Type::aType)*UnsignedInt(ShapeDimensionTraits<3>::Type::bType): \
-                return static_cast<const Shape<aClass>&>(a).shape % static_cast<const Shape<bClass>&>(b).shape;
-        _c(Sphere, Sphere3D, Point, Point3D)
-        _c(Sphere, Sphere3D, Line, Line3D)
-        _c(Sphere, Sphere3D, LineSegment, LineSegment3D)
-        _c(Sphere, Sphere3D, Sphere, Sphere3D)
+        add<Cylinder3D, Point3D>();
+        add<Cylinder3D, Sphere3D>();
 
-        _c(InvertedSphere, InvertedSphere3D, Point, Point3D)
-        _c(InvertedSphere, InvertedSphere3D, Sphere, Sphere3D)
+        add<Capsule3D, Point3D>();
+        add<Capsule3D, Sphere3D>();
 
-        _c(Cylinder, Cylinder3D, Point, Point3D)
-        _c(Cylinder, Cylinder3D, Sphere, Sphere3D)
+        add<AxisAlignedBox3D, Point3D>();
 
-        _c(Capsule, Capsule3D, Point, Point3D)
-        _c(Capsule, Capsule3D, Sphere, Sphere3D)
+        add<Plane, Line3D>();
+        add<Plane, LineSegment3D>();
 
-        _c(AxisAlignedBox, AxisAlignedBox3D, Point, Point3D)
+        addCollision<Sphere3D, Point3D>();
+        addCollision<Sphere3D, Sphere3D>();
+    }
 
-        _c(Plane, Plane, Line, Line3D)
-        _c(Plane, Plane, LineSegment, LineSegment3D)
-        #undef _c
+    template<UnsignedInt dimensions> const DispatchTable<dimensions>& dispatchTable() {
+        static const DispatchTable<dimensions> table;
+        return table;
     }
+}
 
-    return false;
+template<UnsignedInt dimensions> bool collides(const AbstractShape<dimensions>& a, const AbstractShape<dimensions>& b) {
+    const auto f = dispatchTable<dimensions>().collides[typeIndex(a)][typeIndex(b)];
+    return f && f(a, b);
 }
 
-template<> Collision<3> collision(const AbstractShape<3>& a, const AbstractShape<3>& b) {
-    if(a.type() < b.type()) return collision(b, a);
+template<UnsignedInt dimensions> void collides(const Containers::ArrayReference<const ShapePair<dimensions>> pairs, bool* const results) {
+    if(!pairs.size()) return;
 
-    switch(UnsignedInt(a.type())*UnsignedInt(b.type())) {
-        #define _c(aType, aClass, bType, bClass) \
-            case UnsignedInt(ShapeDimensionTraits<3>::Type::aType)*UnsignedInt(ShapeDimensionTraits<3>::Type::bType): \
-                return static_cast<const Shape<aClass>&>(a).shape / static_cast<const Shape<bClass>&>(b).shape;
-        _c(Sphere, Sphere3D, Point, Point3D)
-        _c(Sphere, Sphere3D, Sphere, Sphere3D)
-        #undef _c
-    }
+    const ShapePair<dimensions>& first = pairs[0];
+    CORRADE_INTERNAL_ASSERT(first.first->type() >= first.second->type());
 
-    return {};
+    const auto f = dispatchTable<dimensions>().collidesBatch[typeIndex(*first.first)][typeIndex(*first.second)];
+    if(f) f(pairs, results);
+    else std::fill_n(results, pairs.size(), false);
 }
 
+template<UnsignedInt dimensions> Collision<dimensions> collision(const AbstractShape<dimensions>& a, const AbstractShape<dimensions>& b) {
+    const auto f = dispatchTable<dimensions>().collision[typeIndex(a)][typeIndex(b)];
+    return f ? f(a, b) : Collision<dimensions>{};
+}
+
+template bool collides(const AbstractShape<2>&, const AbstractShape<2>&);
+template bool collides(const AbstractShape<3>&, const AbstractShape<3>&);
+template void collides(Containers::ArrayReference<const ShapePair<2>>, bool*);
+template void collides(Containers::ArrayReference<const ShapePair<3>>, bool*);
+template Collision<2> collision(const AbstractShape<2>&, const AbstractShape<2>&);
+template Collision<3> collision(const AbstractShape<3>&, const AbstractShape<3>&);
+
 }}}
@@ -25,6 +25,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <utility>
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/Types.h"
 #include "Magnum/Shapes/Shapes.h"
 
@@ -36,16 +39,27 @@ template<UnsignedInt> struct AbstractShape;
 Shape collision double-dispatch:
 
 The collision is symmetric, i.e. it doesn't matter if we test Point vs. Sphere
-or Sphere vs. Point. Each type is specified by unique prime number. Then we
-multiply the two numbers together and switch() on the result. Because of
-multiplying two prime numbers, there is no ambiguity (the result is unique for
-each combination).
+or Sphere vs. Point. Each type is mapped to a dense index and the test is
+looked up in a two-dimensional function table indexed by the two types, which
+has entries for both orders. Unimplemented combinations have no entry and
+result in no collision.
 */
 
 template<UnsignedInt dimensions> bool collides(const AbstractShape<dimensions>& a, const AbstractShape<dimensions>& b);
 
 template<UnsignedInt dimensions> Collision<dimensions> collision(const AbstractShape<dimensions>& a, const AbstractShape<dimensions>& b);
 
+template<UnsignedInt dimensions> using ShapePair = std::pair<const AbstractShape<dimensions>*, const AbstractShape<dimensions>*>;
+
+/*
+Batched collision detection:
+
+All pairs must have the same type combination and the first shape in each
+pair must have the higher type number. The dispatch is done once for the whole
+batch, so the loop calls the same test for all pairs.
+*/
+template<UnsignedInt dimensions> void collides(Containers::ArrayReference<const ShapePair<dimensions>> pairs, bool* results);
+
 }}}
 
 #endif
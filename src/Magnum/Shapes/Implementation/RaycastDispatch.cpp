@@ -0,0 +1,357 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "RaycastDispatch.h"
+
+#include <utility>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Geometry/Distance.h"
+#include "Magnum/Math/Geometry/Intersection.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/Cylinder.h"
+#include "Magnum/Shapes/Line.h"
+#include "Magnum/Shapes/LineSegment.h"
+#include "Magnum/Shapes/Plane.h"
+#include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/RaycastHit.h"
+#include "Magnum/Shapes/Sphere.h"
+#include "Magnum/Shapes/shapeImplementation.h"
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+namespace {
+
+/* Hit for ray starting inside a solid shape */
+template<UnsignedInt dimensions> inline RaycastHit<dimensions> insideHit(const VectorTypeFor<dimensions, Float>& direction) {
+    return RaycastHit<dimensions>{0.0f, -direction.normalized()};
+}
+
+/* Nearest hit of the ray with sphere of given radius around the origin, the
+   ray origin is relative to the sphere center. If `inverted` is set, the
+   solid is outside of the sphere. */
+template<UnsignedInt dimensions> RaycastHit<dimensions> raycastSphere(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, const Float radius, const Float maxDistance, const bool inverted) {
+    const Float a = direction.dot();
+    const Float b = Math::dot(origin, direction);
+    const Float c = origin.dot() - radius*radius;
+
+    /* Origin inside the solid */
+    if(inverted ? c >= 0.0f : c <= 0.0f) return insideHit<dimensions>(direction);
+
+    const Float discriminant = b*b - a*c;
+    if(a == 0.0f || discriminant < 0.0f) return {};
+
+    /* Entering the sphere or exiting it if inverted */
+    const Float t = (-b + (inverted ? 1.0f : -1.0f)*std::sqrt(discriminant))/a;
+    if(t < 0.0f || t > maxDistance) return {};
+
+    const VectorTypeFor<dimensions, Float> normal = (origin + t*direction).normalized();
+    return RaycastHit<dimensions>{t, inverted ? -normal : normal};
+}
+
+/* Nearest hit of the ray with infinite cylinder around line a-b. The returned
+   pair contains also the hit position projected onto the axis, in units of
+   the axis length. */
+template<UnsignedInt dimensions> std::pair<RaycastHit<dimensions>, Float> raycastCylinder(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, const VectorTypeFor<dimensions, Float>& a, const VectorTypeFor<dimensions, Float>& b, const Float radius, const Float maxDistance) {
+    /* Remove the axis component from both origin and direction, then it's
+       the same as sphere */
+    const VectorTypeFor<dimensions, Float> axis = b - a;
+    const Float axisLengthSquared = axis.dot();
+    const VectorTypeFor<dimensions, Float> relativeOrigin = origin - a;
+    const VectorTypeFor<dimensions, Float> o = relativeOrigin - axis*(Math::dot(relativeOrigin, axis)/axisLengthSquared);
+    const VectorTypeFor<dimensions, Float> d = direction - axis*(Math::dot(direction, axis)/axisLengthSquared);
+
+    if(o.dot() <= radius*radius)
+        return {insideHit<dimensions>(direction), Math::dot(relativeOrigin, axis)/axisLengthSquared};
+
+    /* Ray parallel to the axis and outside */
+    if(d.dot() == 0.0f) return {};
+
+    /* The hit normal is perpendicular to the axis, thus it's the same as
+       the normal of the sphere hit */
+    const RaycastHit<dimensions> hit = raycastSphere<dimensions>(o, d, radius, maxDistance, false);
+    if(!hit) return {};
+
+    return {hit, Math::dot(relativeOrigin + hit.distance()*direction, axis)/axisLengthSquared};
+}
+
+template<UnsignedInt dimensions> RaycastHit<dimensions> raycastCapsule(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, const VectorTypeFor<dimensions, Float>& a, const VectorTypeFor<dimensions, Float>& b, const Float radius, const Float maxDistance) {
+    if(Math::Geometry::Distance::lineSegmentPointSquared(a, b, origin) <= radius*radius)
+        return insideHit<dimensions>(direction);
+
+    /* Hit on the cylindric part is always the nearest, the flat caps of the
+       cylinder are inside the end spheres */
+    const std::pair<RaycastHit<dimensions>, Float> cylinder = raycastCylinder<dimensions>(origin, direction, a, b, radius, maxDistance);
+    if(cylinder.first && cylinder.second >= 0.0f && cylinder.second <= 1.0f)
+        return cylinder.first;
+
+    /* Otherwise the nearest hit of the end spheres */
+    const RaycastHit<dimensions> hitA = raycastSphere<dimensions>(origin - a, direction, radius, maxDistance, false);
+    const RaycastHit<dimensions> hitB = raycastSphere<dimensions>(origin - b, direction, radius, maxDistance, false);
+    return hitA.distance() < hitB.distance() ? hitA : hitB;
+}
+
+template<UnsignedInt dimensions> RaycastHit<dimensions> raycastBox(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, const VectorTypeFor<dimensions, Float>& min, const VectorTypeFor<dimensions, Float>& max, const Float maxDistance) {
+    /* Intersection of the slabs, remembering which slab was entered last */
+    Float entryDistance = 0.0f, exitDistance = maxDistance;
+    Int axis = -1;
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        if(direction[i] == 0.0f) {
+            if(origin[i] < min[i] || origin[i] > max[i]) return {};
+            continue;
+        }
+
+        Float t1 = (min[i] - origin[i])/direction[i];
+        Float t2 = (max[i] - origin[i])/direction[i];
+        if(t1 > t2) std::swap(t1, t2);
+        if(t1 > entryDistance) {
+            entryDistance = t1;
+            axis = i;
+        }
+        exitDistance = Math::min(exitDistance, t2);
+        if(entryDistance > exitDistance) return {};
+    }
+
+    /* No slab entered, the origin is inside */
+    if(axis == -1) return insideHit<dimensions>(direction);
+
+    VectorTypeFor<dimensions, Float> normal;
+    normal[axis] = direction[axis] > 0.0f ? -1.0f : 1.0f;
+    return RaycastHit<dimensions>{entryDistance, normal};
+}
+
+template<UnsignedInt dimensions> RaycastHit<dimensions> raycastOrientedBox(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, const MatrixTypeFor<dimensions, Float>& transformation, const Float maxDistance) {
+    /* The transformation is affine, so the hit distance in the unit box
+       space is the same */
+    const MatrixTypeFor<dimensions, Float> inverted = transformation.inverted();
+    const RaycastHit<dimensions> hit = raycastBox<dimensions>(inverted.transformPoint(origin), inverted.transformVector(direction), VectorTypeFor<dimensions, Float>{-1.0f}, VectorTypeFor<dimensions, Float>{1.0f}, maxDistance);
+    if(!hit) return {};
+    if(hit.distance() == 0.0f) return insideHit<dimensions>(direction);
+
+    /* Normals are transformed with inverse transpose */
+    return RaycastHit<dimensions>{hit.distance(), (inverted.rotationScaling().transposed()*hit.normal()).normalized()};
+}
+
+/* Sphere with given radius swept against axis-aligned box, i.e. ray against
+   box with rounded edges and corners */
+template<UnsignedInt dimensions> RaycastHit<dimensions> sweepBox(const VectorTypeFor<dimensions, Float>& center, const VectorTypeFor<dimensions, Float>& displacement, const Float radius, const VectorTypeFor<dimensions, Float>& min, const VectorTypeFor<dimensions, Float>& max, const Float maxDistance) {
+    if((Math::min(Math::max(center, min), max) - center).dot() <= radius*radius)
+        return insideHit<dimensions>(displacement);
+
+    /* Hit on a face of the box enlarged by the radius. If the hit is in
+       the face region, it's the nearest one. */
+    const RaycastHit<dimensions> hit = raycastBox<dimensions>(center, displacement, min - VectorTypeFor<dimensions, Float>{radius}, max + VectorTypeFor<dimensions, Float>{radius}, maxDistance);
+    if(!hit) return {};
+    if(hit.distance() != 0.0f) {
+        const VectorTypeFor<dimensions, Float> position = center + hit.distance()*displacement;
+        UnsignedInt outside = 0;
+        for(UnsignedInt i = 0; i != dimensions; ++i)
+            if(position[i] < min[i] || position[i] > max[i]) ++outside;
+        if(outside <= 1) return hit;
+    }
+
+    /* Otherwise the hit is on the rounded part -- spheres around corners in
+       2D, capsules around edges in 3D */
+    RaycastHit<dimensions> nearest;
+    for(UnsignedInt corner = 0; corner != 1u << dimensions; ++corner) {
+        VectorTypeFor<dimensions, Float> a;
+        for(UnsignedInt i = 0; i != dimensions; ++i)
+            a[i] = corner & (1u << i) ? max[i] : min[i];
+
+        if(dimensions == 2) {
+            const RaycastHit<dimensions> cornerHit = raycastSphere<dimensions>(center - a, displacement, radius, maxDistance, false);
+            if(cornerHit.distance() < nearest.distance()) nearest = cornerHit;
+            continue;
+        }
+
+        for(UnsignedInt i = 0; i != dimensions; ++i) {
+            if(corner & (1u << i)) continue;
+
+            VectorTypeFor<dimensions, Float> b = a;
+            b[i] = max[i];
+            const RaycastHit<dimensions> edgeHit = raycastCapsule<dimensions>(center, displacement, a, b, radius, maxDistance);
+            if(edgeHit.distance() < nearest.distance()) nearest = edgeHit;
+        }
+    }
+
+    return nearest;
+}
+
+/* Sphere swept against oriented box. The box transformation is expected to
+   have orthogonal axes (i.e. no shear), so the sphere stays a sphere in the
+   rotated box space. */
+template<UnsignedInt dimensions> RaycastHit<dimensions> sweepOrientedBox(const VectorTypeFor<dimensions, Float>& center, const VectorTypeFor<dimensions, Float>& displacement, const Float radius, const MatrixTypeFor<dimensions, Float>& transformation, const Float maxDistance) {
+    /* Rotation and half-size of the box */
+    Math::Matrix<dimensions, Float> rotation = transformation.rotationScaling();
+    VectorTypeFor<dimensions, Float> size;
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        size[i] = rotation[i].length();
+        rotation[i] /= size[i];
+    }
+
+    const Math::Matrix<dimensions, Float> inverseRotation = rotation.transposed();
+    const RaycastHit<dimensions> hit = sweepBox<dimensions>(inverseRotation*(center - transformation.translation()), inverseRotation*displacement, radius, -size, size, maxDistance);
+    if(!hit) return {};
+    if(hit.distance() == 0.0f) return insideHit<dimensions>(displacement);
+
+    return RaycastHit<dimensions>{hit.distance(), rotation*hit.normal()};
+}
+
+/* Plane exists only in 3D */
+inline RaycastHit<2> raycastOther(const AbstractShape<2>&, const Vector2&, const Vector2&, Float) {
+    return {};
+}
+
+inline RaycastHit<3> raycastOther(const AbstractShape<3>& shape, const Vector3& origin, const Vector3& direction, const Float maxDistance) {
+    if(shape.type() != ShapeDimensionTraits<3>::Type::Plane) return {};
+
+    /* Two-sided plane, the normal faces against the ray */
+    const Shapes::Plane& plane = static_cast<const Shape<Shapes::Plane>&>(shape).shape;
+    const Float t = Math::Geometry::Intersection::planeLine(plane.position(), plane.normal(), origin, direction);
+    if(!(t >= 0.0f && t <= maxDistance)) return {};
+
+    const Vector3 normal = plane.normal().normalized();
+    return RaycastHit<3>{t, Math::dot(normal, direction) > 0.0f ? -normal : normal};
+}
+
+}
+
+template<UnsignedInt dimensions> RaycastHit<dimensions> raycast(const AbstractShape<dimensions>& shape, const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, const Float maxDistance) {
+    typedef typename ShapeDimensionTraits<dimensions>::Type Type;
+
+    switch(shape.type()) {
+        case Type::Sphere: {
+            const auto& s = static_cast<const Shape<Shapes::Sphere<dimensions>>&>(shape).shape;
+            return raycastSphere<dimensions>(origin - s.position(), direction, s.radius(), maxDistance, false);
+        }
+        case Type::InvertedSphere: {
+            const auto& s = static_cast<const Shape<Shapes::InvertedSphere<dimensions>>&>(shape).shape;
+            return raycastSphere<dimensions>(origin - s.position(), direction, s.radius(), maxDistance, true);
+        }
+        case Type::Cylinder: {
+            const auto& s = static_cast<const Shape<Shapes::Cylinder<dimensions>>&>(shape).shape;
+            return raycastCylinder<dimensions>(origin, direction, s.a(), s.b(), s.radius(), maxDistance).first;
+        }
+        case Type::Capsule: {
+            const auto& s = static_cast<const Shape<Shapes::Capsule<dimensions>>&>(shape).shape;
+            return raycastCapsule<dimensions>(origin, direction, s.a(), s.b(), s.radius(), maxDistance);
+        }
+        case Type::AxisAlignedBox: {
+            const auto& s = static_cast<const Shape<Shapes::AxisAlignedBox<dimensions>>&>(shape).shape;
+            return raycastBox<dimensions>(origin, direction, s.min(), s.max(), maxDistance);
+        }
+        case Type::Box:
+            return raycastOrientedBox<dimensions>(origin, direction, static_cast<const Shape<Shapes::Box<dimensions>>&>(shape).shape.transformation(), maxDistance);
+
+        /* Points, lines, line segments, compositions and planes */
+        default: return raycastOther(shape, origin, direction, maxDistance);
+    }
+}
+
+template RaycastHit<2> raycast(const AbstractShape<2>&, const Vector2&, const Vector2&, Float);
+template RaycastHit<3> raycast(const AbstractShape<3>&, const Vector3&, const Vector3&, Float);
+
+namespace {
+
+inline RaycastHit<2> sweepOther(const AbstractShape<2>&, const Sphere2D&, const Vector2&, Float) {
+    return {};
+}
+
+inline RaycastHit<3> sweepOther(const AbstractShape<3>& shape, const Sphere3D& sphere, const Vector3& displacement, const Float maxDistance) {
+    if(shape.type() != ShapeDimensionTraits<3>::Type::Plane) return {};
+
+    /* Two-sided plane, offset by the radius towards the sphere */
+    const Shapes::Plane& plane = static_cast<const Shape<Shapes::Plane>&>(shape).shape;
+    const Vector3 normal = plane.normal().normalized();
+    const Float distance = Math::dot(sphere.position() - plane.position(), normal);
+    if(std::abs(distance) <= sphere.radius()) return insideHit<3>(displacement);
+
+    const Vector3 facingNormal = distance > 0.0f ? normal : -normal;
+    const Float speed = -Math::dot(displacement, facingNormal);
+    if(speed <= 0.0f) return {};
+
+    const Float t = (std::abs(distance) - sphere.radius())/speed;
+    if(t > maxDistance) return {};
+
+    return RaycastHit<3>{t, facingNormal};
+}
+
+}
+
+template<UnsignedInt dimensions> RaycastHit<dimensions> sweep(const AbstractShape<dimensions>& shape, const Sphere<dimensions>& sphere, const VectorTypeFor<dimensions, Float>& displacement, const Float maxDistance) {
+    typedef typename ShapeDimensionTraits<dimensions>::Type Type;
+
+    /* The sphere is shrunk to a point and the shape enlarged by its radius,
+       the sweep is then a raycast from the sphere center */
+    const VectorTypeFor<dimensions, Float>& center = sphere.position();
+    const Float radius = sphere.radius();
+    switch(shape.type()) {
+        case Type::Point:
+            return raycastSphere<dimensions>(center - static_cast<const Shape<Shapes::Point<dimensions>>&>(shape).shape.position(), displacement, radius, maxDistance, false);
+        case Type::Line: {
+            const auto& s = static_cast<const Shape<Shapes::Line<dimensions>>&>(shape).shape;
+            return raycastCylinder<dimensions>(center, displacement, s.a(), s.b(), radius, maxDistance).first;
+        }
+        case Type::LineSegment: {
+            const auto& s = static_cast<const Shape<Shapes::LineSegment<dimensions>>&>(shape).shape;
+            return raycastCapsule<dimensions>(center, displacement, s.a(), s.b(), radius, maxDistance);
+        }
+        case Type::Sphere: {
+            const auto& s = static_cast<const Shape<Shapes::Sphere<dimensions>>&>(shape).shape;
+            return raycastSphere<dimensions>(center - s.position(), displacement, s.radius() + radius, maxDistance, false);
+        }
+        case Type::InvertedSphere: {
+            const auto& s = static_cast<const Shape<Shapes::InvertedSphere<dimensions>>&>(shape).shape;
+            if(s.radius() <= radius) return insideHit<dimensions>(displacement);
+            return raycastSphere<dimensions>(center - s.position(), displacement, s.radius() - radius, maxDistance, true);
+        }
+        case Type::Cylinder: {
+            const auto& s = static_cast<const Shape<Shapes::Cylinder<dimensions>>&>(shape).shape;
+            return raycastCylinder<dimensions>(center, displacement, s.a(), s.b(), s.radius() + radius, maxDistance).first;
+        }
+        case Type::Capsule: {
+            const auto& s = static_cast<const Shape<Shapes::Capsule<dimensions>>&>(shape).shape;
+            return raycastCapsule<dimensions>(center, displacement, s.a(), s.b(), s.radius() + radius, maxDistance);
+        }
+        case Type::AxisAlignedBox: {
+            const auto& s = static_cast<const Shape<Shapes::AxisAlignedBox<dimensions>>&>(shape).shape;
+            return sweepBox<dimensions>(center, displacement, radius, s.min(), s.max(), maxDistance);
+        }
+        case Type::Box:
+            return sweepOrientedBox<dimensions>(center, displacement, radius, static_cast<const Shape<Shapes::Box<dimensions>>&>(shape).shape.transformation(), maxDistance);
+
+        /* Compositions and planes */
+        default: return sweepOther(shape, sphere, displacement, maxDistance);
+    }
+}
+
+template RaycastHit<2> sweep(const AbstractShape<2>&, const Sphere2D&, const Vector2&, Float);
+template RaycastHit<3> sweep(const AbstractShape<3>&, const Sphere3D&, const Vector3&, Float);
+
+}}}
@@ -0,0 +1,56 @@
+#ifndef Magnum_Shapes_Implementation_RaycastDispatch_h
+#define Magnum_Shapes_Implementation_RaycastDispatch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Shapes/Shapes.h"
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+template<UnsignedInt> struct AbstractShape;
+
+/*
+Shape raycast dispatch:
+
+Switches on the shape type and computes the nearest hit of the ray with the
+shape not further than given distance. Points, lines and line segments are
+never hit, compositions are not supported yet.
+*/
+template<UnsignedInt dimensions> RaycastHit<dimensions> raycast(const AbstractShape<dimensions>& shape, const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, Float maxDistance);
+
+/*
+Swept sphere dispatch:
+
+Computes the first contact of sphere moving along given displacement with the
+shape, in units of the displacement. The shape is enlarged by the sphere
+radius and a ray is cast from the sphere center. Compositions are not
+supported yet.
+*/
+template<UnsignedInt dimensions> RaycastHit<dimensions> sweep(const AbstractShape<dimensions>& shape, const Sphere<dimensions>& sphere, const VectorTypeFor<dimensions, Float>& displacement, Float maxDistance);
+
+}}}
+
+#endif
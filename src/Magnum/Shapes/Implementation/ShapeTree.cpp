@@ -0,0 +1,350 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "ShapeTree.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/LineSegment.h"
+#include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
+#include "Magnum/Shapes/shapeImplementation.h"
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+namespace {
+
+template<UnsignedInt dimensions> RangeTypeFor<dimensions, Float> pointBounds(const VectorTypeFor<dimensions, Float>& a, const VectorTypeFor<dimensions, Float>& b, const Float radius) {
+    const VectorTypeFor<dimensions, Float> r{radius};
+    return {Math::min(a, b) - r, Math::max(a, b) + r};
+}
+
+template<UnsignedInt dimensions> RangeTypeFor<dimensions, Float> boxBounds(const MatrixTypeFor<dimensions, Float>& transformation) {
+    /* Transform all corners of the [-1, 1] box */
+    VectorTypeFor<dimensions, Float> min{Constants::inf()}, max{-Constants::inf()};
+    for(UnsignedInt i = 0; i != 1 << dimensions; ++i) {
+        VectorTypeFor<dimensions, Float> corner;
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            corner[j] = i & (1 << j) ? 1.0f : -1.0f;
+
+        const VectorTypeFor<dimensions, Float> transformed = transformation.transformPoint(corner);
+        min = Math::min(min, transformed);
+        max = Math::max(max, transformed);
+    }
+
+    return {min, max};
+}
+
+template<UnsignedInt dimensions> RangeTypeFor<dimensions, Float> join(const RangeTypeFor<dimensions, Float>& a, const RangeTypeFor<dimensions, Float>& b) {
+    return {Math::min(a.min(), b.min()), Math::max(a.max(), b.max())};
+}
+
+/* Perimeter in 2D, surface area in 3D (both without the constant factor) */
+template<UnsignedInt dimensions> Float area(const RangeTypeFor<dimensions, Float>& range) {
+    const VectorTypeFor<dimensions, Float> size = range.size();
+    if(dimensions == 2) return size[0] + size[1];
+
+    Float area = 0.0f;
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        for(UnsignedInt j = i + 1; j != dimensions; ++j)
+            area += size[i]*size[j];
+    return area;
+}
+
+}
+
+template<UnsignedInt dimensions> bool bounds(const AbstractShape<dimensions>& shape, RangeTypeFor<dimensions, Float>& out) {
+    typedef typename ShapeDimensionTraits<dimensions>::Type Type;
+
+    switch(shape.type()) {
+        case Type::Point: {
+            const auto& s = static_cast<const Shape<Shapes::Point<dimensions>>&>(shape).shape;
+            out = pointBounds<dimensions>(s.position(), s.position(), 0.0f);
+            return true;
+        }
+        case Type::LineSegment: {
+            const auto& s = static_cast<const Shape<Shapes::LineSegment<dimensions>>&>(shape).shape;
+            out = pointBounds<dimensions>(s.a(), s.b(), 0.0f);
+            return true;
+        }
+        case Type::Sphere: {
+            const auto& s = static_cast<const Shape<Shapes::Sphere<dimensions>>&>(shape).shape;
+            out = pointBounds<dimensions>(s.position(), s.position(), s.radius());
+            return true;
+        }
+        case Type::Capsule: {
+            const auto& s = static_cast<const Shape<Shapes::Capsule<dimensions>>&>(shape).shape;
+            out = pointBounds<dimensions>(s.a(), s.b(), s.radius());
+            return true;
+        }
+        case Type::AxisAlignedBox: {
+            const auto& s = static_cast<const Shape<Shapes::AxisAlignedBox<dimensions>>&>(shape).shape;
+            out = {s.min(), s.max()};
+            return true;
+        }
+        case Type::Box:
+            out = boxBounds<dimensions>(static_cast<const Shape<Shapes::Box<dimensions>>&>(shape).shape.transformation());
+            return true;
+
+        /* Lines, inverted spheres, infinite cylinders, planes and
+           compositions */
+        default: return false;
+    }
+}
+
+template<UnsignedInt dimensions> ShapeTree<dimensions>::ShapeTree(): _root{Null}, _free{Null} {}
+
+template<UnsignedInt dimensions> Int ShapeTree<dimensions>::allocate() {
+    /* Reuse a free node, if any */
+    if(_free != Null) {
+        const Int node = _free;
+        _free = _nodes[node].parent;
+        return node;
+    }
+
+    _nodes.emplace_back();
+    return Int(_nodes.size() - 1);
+}
+
+template<UnsignedInt dimensions> void ShapeTree<dimensions>::free(const Int node) {
+    _nodes[node].shape = nullptr;
+    _nodes[node].parent = _free;
+    _nodes[node].height = -1;
+    _free = node;
+}
+
+template<UnsignedInt dimensions> Int ShapeTree<dimensions>::insert(const RangeType& bounds, Shapes::AbstractShape<dimensions>* const shape) {
+    const Int leaf = allocate();
+    Node& node = _nodes[leaf];
+    node.bounds = bounds;
+    node.shape = shape;
+    node.parent = Null;
+    node.children[0] = node.children[1] = Null;
+    node.height = 0;
+
+    insertLeaf(leaf);
+    return leaf;
+}
+
+template<UnsignedInt dimensions> void ShapeTree<dimensions>::remove(const Int leaf) {
+    CORRADE_INTERNAL_ASSERT(_nodes[leaf].isLeaf() && _nodes[leaf].height == 0);
+    removeLeaf(leaf);
+    free(leaf);
+}
+
+template<UnsignedInt dimensions> void ShapeTree<dimensions>::insertLeaf(const Int leaf) {
+    if(_root == Null) {
+        _root = leaf;
+        _nodes[leaf].parent = Null;
+        return;
+    }
+
+    /* Find the best sibling, descend while it's cheaper than creating a new
+       parent here */
+    const RangeType leafBounds = _nodes[leaf].bounds;
+    Int index = _root;
+    while(!_nodes[index].isLeaf()) {
+        const Node& node = _nodes[index];
+        const Float combinedArea = area<dimensions>(join<dimensions>(node.bounds, leafBounds));
+
+        /* Cost of creating a new parent for this node and the leaf, minimum
+           cost of pushing the leaf further down */
+        const Float cost = 2.0f*combinedArea;
+        const Float inheritanceCost = 2.0f*(combinedArea - area<dimensions>(node.bounds));
+
+        Float childCost[2];
+        for(std::size_t i = 0; i != 2; ++i) {
+            const Node& child = _nodes[node.children[i]];
+            childCost[i] = area<dimensions>(join<dimensions>(leafBounds, child.bounds)) + inheritanceCost;
+            if(!child.isLeaf()) childCost[i] -= area<dimensions>(child.bounds);
+        }
+
+        if(cost < childCost[0] && cost < childCost[1]) break;
+
+        index = node.children[childCost[0] < childCost[1] ? 0 : 1];
+    }
+
+    /* Create a new parent for the sibling and the leaf. The allocation may
+       reallocate the node storage, so no references are kept across it. */
+    const Int sibling = index;
+    const Int oldParent = _nodes[sibling].parent;
+    const Int newParent = allocate();
+    {
+        Node& node = _nodes[newParent];
+        node.parent = oldParent;
+        node.shape = nullptr;
+        node.bounds = join<dimensions>(leafBounds, _nodes[sibling].bounds);
+        node.height = _nodes[sibling].height + 1;
+        node.children[0] = sibling;
+        node.children[1] = leaf;
+    }
+
+    if(oldParent != Null) {
+        Node& node = _nodes[oldParent];
+        node.children[node.children[0] == sibling ? 0 : 1] = newParent;
+    } else _root = newParent;
+
+    _nodes[sibling].parent = newParent;
+    _nodes[leaf].parent = newParent;
+
+    fixUpwards(newParent);
+}
+
+template<UnsignedInt dimensions> void ShapeTree<dimensions>::removeLeaf(const Int leaf) {
+    if(leaf == _root) {
+        _root = Null;
+        return;
+    }
+
+    const Int parent = _nodes[leaf].parent;
+    const Int grandParent = _nodes[parent].parent;
+    const Int sibling = _nodes[parent].children[_nodes[parent].children[0] == leaf ? 1 : 0];
+
+    /* Replace the parent with the sibling */
+    if(grandParent != Null) {
+        Node& node = _nodes[grandParent];
+        node.children[node.children[0] == parent ? 0 : 1] = sibling;
+        _nodes[sibling].parent = grandParent;
+        free(parent);
+        fixUpwards(grandParent);
+    } else {
+        _root = sibling;
+        _nodes[sibling].parent = Null;
+        free(parent);
+    }
+}
+
+template<UnsignedInt dimensions> void ShapeTree<dimensions>::fixUpwards(Int index) {
+    while(index != Null) {
+        index = balance(index);
+
+        Node& node = _nodes[index];
+        const Node& a = _nodes[node.children[0]];
+        const Node& b = _nodes[node.children[1]];
+        node.height = 1 + Math::max(a.height, b.height);
+        node.bounds = join<dimensions>(a.bounds, b.bounds);
+
+        index = node.parent;
+    }
+}
+
+template<UnsignedInt dimensions> Int ShapeTree<dimensions>::balance(const Int iA) {
+    Node& a = _nodes[iA];
+    if(a.isLeaf() || a.height < 2) return iA;
+
+    const Int iB = a.children[0];
+    const Int iC = a.children[1];
+    Node& b = _nodes[iB];
+    Node& c = _nodes[iC];
+    const Int difference = c.height - b.height;
+
+    /* Rotate C up */
+    if(difference > 1) {
+        const Int iF = c.children[0];
+        const Int iG = c.children[1];
+        Node& f = _nodes[iF];
+        Node& g = _nodes[iG];
+
+        c.children[0] = iA;
+        c.parent = a.parent;
+        a.parent = iC;
+
+        if(c.parent != Null) {
+            Node& parent = _nodes[c.parent];
+            parent.children[parent.children[0] == iA ? 0 : 1] = iC;
+        } else _root = iC;
+
+        if(f.height > g.height) {
+            c.children[1] = iF;
+            a.children[1] = iG;
+            g.parent = iA;
+            a.bounds = join<dimensions>(b.bounds, g.bounds);
+            c.bounds = join<dimensions>(a.bounds, f.bounds);
+            a.height = 1 + Math::max(b.height, g.height);
+            c.height = 1 + Math::max(a.height, f.height);
+        } else {
+            c.children[1] = iG;
+            a.children[1] = iF;
+            f.parent = iA;
+            a.bounds = join<dimensions>(b.bounds, f.bounds);
+            c.bounds = join<dimensions>(a.bounds, g.bounds);
+            a.height = 1 + Math::max(b.height, f.height);
+            c.height = 1 + Math::max(a.height, g.height);
+        }
+
+        return iC;
+    }
+
+    /* Rotate B up */
+    if(difference < -1) {
+        const Int iD = b.children[0];
+        const Int iE = b.children[1];
+        Node& d = _nodes[iD];
+        Node& e = _nodes[iE];
+
+        b.children[0] = iA;
+        b.parent = a.parent;
+        a.parent = iB;
+
+        if(b.parent != Null) {
+            Node& parent = _nodes[b.parent];
+            parent.children[parent.children[0] == iA ? 0 : 1] = iB;
+        } else _root = iB;
+
+        if(d.height > e.height) {
+            b.children[1] = iD;
+            a.children[0] = iE;
+            e.parent = iA;
+            a.bounds = join<dimensions>(c.bounds, e.bounds);
+            b.bounds = join<dimensions>(a.bounds, d.bounds);
+            a.height = 1 + Math::max(c.height, e.height);
+            b.height = 1 + Math::max(a.height, d.height);
+        } else {
+            b.children[1] = iE;
+            a.children[0] = iD;
+            d.parent = iA;
+            a.bounds = join<dimensions>(c.bounds, d.bounds);
+            b.bounds = join<dimensions>(a.bounds, e.bounds);
+            a.height = 1 + Math::max(c.height, d.height);
+            b.height = 1 + Math::max(a.height, e.height);
+        }
+
+        return iB;
+    }
+
+    return iA;
+}
+
+template bool bounds(const AbstractShape<2>&, Range2D&);
+template bool bounds(const AbstractShape<3>&, Range3D&);
+template class ShapeTree<2>;
+template class ShapeTree<3>;
+
+}}}
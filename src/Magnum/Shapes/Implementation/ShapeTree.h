@@ -0,0 +1,198 @@
+#ifndef Magnum_Shapes_Implementation_ShapeTree_h
+#define Magnum_Shapes_Implementation_ShapeTree_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Shapes/Shapes.h"
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+template<UnsignedInt> struct AbstractShape;
+
+/* Bounding range of given shape. Returns false if the shape is unbounded
+   (lines, planes, inverted spheres, infinite cylinders) or if the bounds are
+   not cheaply computable (compositions). */
+template<UnsignedInt dimensions> bool bounds(const AbstractShape<dimensions>& shape, RangeTypeFor<dimensions, Float>& out);
+
+template<UnsignedInt dimensions> inline bool overlaps(const RangeTypeFor<dimensions, Float>& a, const RangeTypeFor<dimensions, Float>& b) {
+    return (a.min() <= b.max()).all() && (b.min() <= a.max()).all();
+}
+
+/* Distance at which the ray enters given range, infinity if it misses the
+   range or enters it further than maxDistance. Zero if the origin is inside.
+   The inverse direction is 1/direction, possibly with infinite components. */
+template<UnsignedInt dimensions> inline Float rayEntry(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& inverseDirection, const RangeTypeFor<dimensions, Float>& range, const Float maxDistance) {
+    const VectorTypeFor<dimensions, Float> a = (range.min() - origin)*inverseDirection;
+    const VectorTypeFor<dimensions, Float> b = (range.max() - origin)*inverseDirection;
+    const Float entryDistance = Math::max(Math::min(a, b).max(), 0.0f);
+    const Float exitDistance = Math::min(Math::max(a, b).min(), maxDistance);
+    return entryDistance <= exitDistance ? entryDistance : Constants::inf();
+}
+
+template<UnsignedInt dimensions> inline bool contains(const RangeTypeFor<dimensions, Float>& outer, const RangeTypeFor<dimensions, Float>& inner) {
+    return (outer.min() <= inner.min()).all() && (inner.max() <= outer.max()).all();
+}
+
+/*
+Dynamic bounding volume hierarchy of shape bounds:
+
+Leaves hold enlarged ("fat") bounds of the shapes, so small movements don't
+require any tree update. Insertion picks the sibling with the least surface
+area increase and the tree is kept balanced with AVL-like rotations, so both
+updates and queries are logarithmic.
+*/
+template<UnsignedInt dimensions> class ShapeTree {
+    public:
+        typedef RangeTypeFor<dimensions, Float> RangeType;
+
+        enum: Int { Null = -1 };
+
+        explicit ShapeTree();
+
+        /* Inserts a leaf with given bounds, returns its ID */
+        Int insert(const RangeType& bounds, Shapes::AbstractShape<dimensions>* shape);
+
+        /* Removes a leaf */
+        void remove(Int leaf);
+
+        const RangeType& bounds(Int leaf) const { return _nodes[leaf].bounds; }
+
+        /* Calls the callback with every shape whose bounds overlap given
+           range, stops if the callback returns false */
+        template<class Callback> void query(const RangeType& range, Callback callback) const;
+
+        /* Calls the callback with every pair of shapes whose bounds overlap,
+           each pair is reported once */
+        template<class Callback> void overlappingPairs(Callback callback) const;
+
+        /* Calls the callback with every shape whose bounds are hit by the
+           ray nearer than the maximal distance, nearer nodes first. The
+           callback returns the new maximal distance, so the traversal can
+           skip nodes behind the nearest hit found so far. */
+        template<class Callback> void raycast(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, Float maxDistance, Callback callback) const;
+
+    private:
+        struct Node {
+            RangeType bounds;
+            Shapes::AbstractShape<dimensions>* shape;
+
+            /* Next free node if the node is not used */
+            Int parent;
+            Int children[2];
+            Int height;
+
+            bool isLeaf() const { return children[0] == Null; }
+        };
+
+        Int allocate();
+        void free(Int node);
+        void insertLeaf(Int leaf);
+        void removeLeaf(Int leaf);
+        void fixUpwards(Int node);
+        Int balance(Int node);
+
+        std::vector<Node> _nodes;
+        Int _root, _free;
+};
+
+template<UnsignedInt dimensions> template<class Callback> void ShapeTree<dimensions>::query(const RangeType& range, Callback callback) const {
+    if(_root == Null) return;
+
+    std::vector<Int> stack;
+    stack.reserve(64);
+    stack.push_back(_root);
+    while(!stack.empty()) {
+        const Node& node = _nodes[stack.back()];
+        stack.pop_back();
+
+        if(!overlaps<dimensions>(node.bounds, range)) continue;
+
+        if(node.isLeaf()) {
+            if(!callback(node.shape)) return;
+        } else {
+            stack.push_back(node.children[0]);
+            stack.push_back(node.children[1]);
+        }
+    }
+}
+
+template<UnsignedInt dimensions> template<class Callback> void ShapeTree<dimensions>::overlappingPairs(Callback callback) const {
+    for(const Node& node: _nodes) {
+        /* Skip internal and free nodes */
+        if(node.height != 0) continue;
+
+        Shapes::AbstractShape<dimensions>* const shape = node.shape;
+        query(node.bounds, [shape, &callback](Shapes::AbstractShape<dimensions>* other) -> bool {
+            if(std::less<Shapes::AbstractShape<dimensions>*>()(shape, other))
+                callback(shape, other);
+            return true;
+        });
+    }
+}
+
+template<UnsignedInt dimensions> template<class Callback> void ShapeTree<dimensions>::raycast(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, Float maxDistance, Callback callback) const {
+    if(_root == Null) return;
+
+    const VectorTypeFor<dimensions, Float> inverseDirection = VectorTypeFor<dimensions, Float>{1.0f}/direction;
+    const Float rootEntry = rayEntry<dimensions>(origin, inverseDirection, _nodes[_root].bounds, maxDistance);
+    if(rootEntry == Constants::inf()) return;
+
+    std::vector<std::pair<Int, Float>> stack;
+    stack.reserve(64);
+    stack.emplace_back(_root, rootEntry);
+    while(!stack.empty()) {
+        const std::pair<Int, Float> top = stack.back();
+        stack.pop_back();
+
+        /* Entered further than the nearest hit found so far */
+        if(top.second > maxDistance) continue;
+
+        const Node& node = _nodes[top.first];
+        if(node.isLeaf()) {
+            maxDistance = callback(node.shape, maxDistance);
+            continue;
+        }
+
+        /* Push the farther child first so the nearer one is processed
+           first */
+        std::pair<Int, Float> nearChild{node.children[0], rayEntry<dimensions>(origin, inverseDirection, _nodes[node.children[0]].bounds, maxDistance)};
+        std::pair<Int, Float> farChild{node.children[1], rayEntry<dimensions>(origin, inverseDirection, _nodes[node.children[1]].bounds, maxDistance)};
+        if(farChild.second < nearChild.second) std::swap(nearChild, farChild);
+        if(farChild.second != Constants::inf()) stack.push_back(farChild);
+        if(nearChild.second != Constants::inf()) stack.push_back(nearChild);
+    }
+}
+
+}}}
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef Magnum_Shapes_RaycastHit_h
+#define Magnum_Shapes_RaycastHit_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shapes::RaycastHit, typedef @ref Magnum::Shapes::RaycastHit2D, @ref Magnum::Shapes::RaycastHit3D
+ */
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Shapes {
+
+/**
+@brief Raycast hit data
+
+Describes the nearest intersection of a ray with a shape or a mesh. The ray
+is defined by its origin and direction, the hit is at
+`origin + distance*direction`, thus the distance is in units of the direction
+length. If the direction is normalized, the distance is the actual distance
+from the origin.
+
+If the ray hit anything, the normal is *normalized* surface normal at the hit
+position, facing against the ray. If the ray origin is inside a solid shape,
+the hit is reported at zero distance with normal opposite to the ray
+direction. If the ray didn't hit anything, the distance is infinite and the
+normal is undefined.
+@see @ref RaycastHit2D, @ref RaycastHit3D, @ref AbstractShape::raycast(),
+    @ref ShapeGroup::raycast(), @ref TriangleMesh::raycast()
+*/
+template<UnsignedInt dimensions> class RaycastHit {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Sets the distance to infinity, as if nothing was hit.
+         */
+        /*implicit*/ RaycastHit(): _distance(Constants::inf()) {}
+
+        /**
+         * @brief Constructor
+         *
+         * The normal is expected to be normalized.
+         */
+        explicit RaycastHit(Float distance, const VectorTypeFor<dimensions, Float>& normal) noexcept: _normal(normal), _distance(distance) {
+            CORRADE_ASSERT(normal.isNormalized(), "Shapes::RaycastHit::RaycastHit: normal is not normalized", );
+        }
+
+        /**
+         * @brief Whether the ray hit anything
+         *
+         * Infinite distance means that nothing was hit.
+         * @see @ref distance()
+         */
+        operator bool() const { return _distance != Constants::inf(); }
+
+        /**
+         * @brief Hit distance
+         *
+         * In units of ray direction length.
+         * @see @ref operator bool()
+         */
+        Float distance() const { return _distance; }
+
+        /** @brief Surface normal at hit position */
+        VectorTypeFor<dimensions, Float> normal() const { return _normal; }
+
+    private:
+        VectorTypeFor<dimensions, Float> _normal;
+        Float _distance;
+};
+
+/** @brief Two-dimensional raycast hit data */
+typedef RaycastHit<2> RaycastHit2D;
+
+/** @brief Three-dimensional raycast hit data */
+typedef RaycastHit<3> RaycastHit3D;
+
+}}
+
+#endif
@@ -25,33 +25,329 @@
 
 #include "ShapeGroup.h"
 
+#include <algorithm>
+
+#include "Magnum/AllocationTracker.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/SceneGraph/Threading.h"
 #include "Magnum/Shapes/AbstractShape.h"
+#include "Magnum/Shapes/Sphere.h"
+#include "Magnum/Shapes/Implementation/CollisionDispatch.h"
+#include "Magnum/Shapes/Implementation/ShapeTree.h"
 
 namespace Magnum { namespace Shapes {
 
+template<UnsignedInt dimensions> ShapeGroup<dimensions>::ShapeGroup(): dirty(true), _updateAll(false), _tree{new Implementation::ShapeTree<dimensions>} {}
+
+template<UnsignedInt dimensions> ShapeGroup<dimensions>::~ShapeGroup() {
+    /* The shapes stay alive, reset their bookkeeping so they can be added to
+       another group */
+    for(std::size_t i = 0; i != this->size(); ++i) {
+        AbstractShape<dimensions>& shape = (*this)[i];
+        shape._proxy = Implementation::ShapeTree<dimensions>::Null;
+        shape._queued = shape._unbounded = false;
+    }
+}
+
+template<UnsignedInt dimensions> ShapeGroup<dimensions>& ShapeGroup<dimensions>::add(AbstractShape<dimensions>& shape) {
+    /* Remove from previous group through its own interface, so its
+       acceleration structure is updated too */
+    if(shape.group()) shape.group()->remove(shape);
+
+    SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>, Float>::add(shape);
+    enqueue(shape);
+    return *this;
+}
+
+template<UnsignedInt dimensions> ShapeGroup<dimensions>& ShapeGroup<dimensions>::remove(AbstractShape<dimensions>& shape) {
+    CORRADE_ASSERT(shape.group() == this,
+        "Shapes::ShapeGroup::remove(): shape is not part of this group", *this);
+
+    untrack(shape);
+    SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>, Float>::remove(shape);
+    return *this;
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::enqueue(AbstractShape<dimensions>& shape) {
+    dirty = true;
+    if(shape._queued) return;
+
+    shape._queued = true;
+    _queue.push_back(&shape);
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::untrack(AbstractShape<dimensions>& shape) {
+    if(shape._queued) {
+        _queue.erase(std::find(_queue.begin(), _queue.end(), &shape));
+        shape._queued = false;
+    }
+
+    if(shape._unbounded) {
+        _unbounded.erase(std::find(_unbounded.begin(), _unbounded.end(), &shape));
+        shape._unbounded = false;
+    }
+
+    if(shape._proxy != Implementation::ShapeTree<dimensions>::Null) {
+        _tree->remove(shape._proxy);
+        shape._proxy = Implementation::ShapeTree<dimensions>::Null;
+    }
+}
+
 template<UnsignedInt dimensions> void ShapeGroup<dimensions>::setClean() {
-    /* Clean all objects */
-    if(!this->isEmpty()) {
-        std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>> objects;
-        objects.reserve(this->size());
+    MAGNUM_ALLOCATION_SCOPE(Shapes);
+
+    if(!dirty) return;
+
+    cleanObjects();
+    updateBounds();
+
+    dirty = false;
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::setClean(const std::vector<std::reference_wrapper<ShapeGroup<dimensions>>>& groups) {
+    MAGNUM_ALLOCATION_SCOPE(Shapes);
+
+    /* The objects might be shared among the groups and cleaning them touches
+       the whole hierarchy, so it can't be done concurrently. The hierarchy
+       update is parallelized internally if it's large enough. */
+    std::vector<ShapeGroup<dimensions>*> dirtyGroups;
+    for(ShapeGroup<dimensions>& group: groups) {
+        if(!group.dirty) continue;
+
+        group.cleanObjects();
+        dirtyGroups.push_back(&group);
+    }
+
+    /* Acceleration structures are independent for each group */
+    SceneGraph::Implementation::parallelFor(dirtyGroups.size(), 1, [&dirtyGroups](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            dirtyGroups[i]->updateBounds();
+            dirtyGroups[i]->dirty = false;
+        }
+    });
+}
+
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::cleanObjects() {
+    /* Explicit setDirty(), update everything */
+    if(_updateAll) {
         for(std::size_t i = 0; i != this->size(); ++i)
-            objects.push_back((*this)[i].object());
+            enqueue((*this)[i]);
+        _updateAll = false;
+    }
+
+    /* Clean all objects of dirty shapes */
+    if(!_queue.empty()) {
+        std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>> objects;
+        objects.reserve(_queue.size());
+        for(AbstractShape<dimensions>* shape: _queue)
+            objects.push_back(shape->object());
 
         SceneGraph::AbstractObject<dimensions, Float>::setClean(objects);
     }
+}
 
-    dirty = false;
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::updateBounds() {
+    typedef typename Implementation::ShapeTree<dimensions>::RangeType RangeType;
+
+    for(AbstractShape<dimensions>* shape: _queue) {
+        shape->_queued = false;
+
+        /* Unbounded shape, will be tested against everything */
+        RangeType bounds;
+        if(!Implementation::bounds(shape->abstractTransformedShape(), bounds)) {
+            if(shape->_proxy != Implementation::ShapeTree<dimensions>::Null) {
+                _tree->remove(shape->_proxy);
+                shape->_proxy = Implementation::ShapeTree<dimensions>::Null;
+            }
+
+            if(!shape->_unbounded) {
+                shape->_unbounded = true;
+                _unbounded.push_back(shape);
+            }
+
+            continue;
+        }
+
+        if(shape->_unbounded) {
+            _unbounded.erase(std::find(_unbounded.begin(), _unbounded.end(), shape));
+            shape->_unbounded = false;
+        }
+
+        /* Still inside the enlarged bounds, nothing to do */
+        if(shape->_proxy != Implementation::ShapeTree<dimensions>::Null) {
+            if(Implementation::contains<dimensions>(_tree->bounds(shape->_proxy), bounds))
+                continue;
+
+            _tree->remove(shape->_proxy);
+        }
+
+        /* Enlarge the bounds by 10% of the size and a tiny constant to
+           accommodate movement */
+        const typename RangeType::VectorType margin = bounds.size()*0.1f + typename RangeType::VectorType{Math::TypeTraits<Float>::epsilon()};
+        shape->_proxy = _tree->insert(bounds.padded(margin), shape);
+    }
+
+    _queue.clear();
 }
 
 template<UnsignedInt dimensions> AbstractShape<dimensions>* ShapeGroup<dimensions>::firstCollision(const AbstractShape<dimensions>& shape) {
     setClean();
-    for(std::size_t i = 0; i != this->size(); ++i)
-        if(&(*this)[i] != &shape && (*this)[i].collides(shape))
-            return &(*this)[i];
+
+    /* Unbounded query shape, test against everything */
+    typename Implementation::ShapeTree<dimensions>::RangeType bounds;
+    if(!Implementation::bounds(shape.abstractTransformedShape(), bounds)) {
+        for(std::size_t i = 0; i != this->size(); ++i)
+            if(&(*this)[i] != &shape && (*this)[i].collides(shape))
+                return &(*this)[i];
+
+        return nullptr;
+    }
+
+    AbstractShape<dimensions>* found = nullptr;
+    _tree->query(bounds, [&shape, &found](AbstractShape<dimensions>* candidate) -> bool {
+        if(candidate == &shape || !candidate->collides(shape)) return true;
+        found = candidate;
+        return false;
+    });
+    if(found) return found;
+
+    for(AbstractShape<dimensions>* candidate: _unbounded)
+        if(candidate != &shape && candidate->collides(shape))
+            return candidate;
 
     return nullptr;
 }
 
+template<UnsignedInt dimensions> std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> ShapeGroup<dimensions>::collisions() {
+    MAGNUM_ALLOCATION_SCOPE(Shapes);
+
+    setClean();
+
+    /* Broad phase. Each candidate pair is ordered so the shape with higher
+       type number is first, as the collision dispatch expects. */
+    struct Candidate {
+        UnsignedInt types;
+        AbstractShape<dimensions>* a;
+        AbstractShape<dimensions>* b;
+    };
+    std::vector<Candidate> candidates;
+    const auto addCandidate = [&candidates](AbstractShape<dimensions>* a, AbstractShape<dimensions>* b) {
+        if(a->type() < b->type()) std::swap(a, b);
+        candidates.push_back({UnsignedInt(a->type())*UnsignedInt(b->type()), a, b});
+    };
+
+    _tree->overlappingPairs(addCandidate);
+
+    /* Unbounded shapes against everything, pairs of two unbounded shapes
+       only once */
+    for(AbstractShape<dimensions>* unbounded: _unbounded) {
+        for(std::size_t i = 0; i != this->size(); ++i) {
+            AbstractShape<dimensions>* const other = &(*this)[i];
+            if(other == unbounded || (other->_unbounded && !std::less<AbstractShape<dimensions>*>()(unbounded, other)))
+                continue;
+
+            addCandidate(unbounded, other);
+        }
+    }
+
+    /* Group the candidates by type combination */
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        return a.types < b.types;
+    });
+
+    Containers::Array<Implementation::ShapePair<dimensions>> pairs{candidates.size()};
+    for(std::size_t i = 0; i != candidates.size(); ++i)
+        pairs[i] = {&candidates[i].a->abstractTransformedShape(), &candidates[i].b->abstractTransformedShape()};
+
+    /* Narrow phase, one batch per type combination. Long candidate lists
+       are split into chunks processed in parallel, batches crossing chunk
+       boundaries are split as well. */
+    Containers::Array<bool> results{candidates.size()};
+    SceneGraph::Implementation::parallelFor(candidates.size(), 4096, [&candidates, &pairs, &results](const std::size_t chunkBegin, const std::size_t chunkEnd) {
+        for(std::size_t begin = chunkBegin, end; begin != chunkEnd; begin = end) {
+            for(end = begin + 1; end != chunkEnd && candidates[end].types == candidates[begin].types; ++end);
+
+            Implementation::collides<dimensions>({pairs + begin, end - begin}, results + begin);
+        }
+    });
+
+    std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> out;
+    for(std::size_t i = 0; i != candidates.size(); ++i)
+        if(results[i]) out.emplace_back(candidates[i].a, candidates[i].b);
+
+    return out;
+}
+
+template<UnsignedInt dimensions> std::vector<std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>>> ShapeGroup<dimensions>::collisions(const std::vector<std::reference_wrapper<ShapeGroup<dimensions>>>& groups) {
+    MAGNUM_ALLOCATION_SCOPE(Shapes);
+
+    setClean(groups);
+
+    /* The groups are clean now, so the queries only read the shared state.
+       The narrow phase inside is done serially, as the thread pool is
+       busy with the groups. */
+    std::vector<std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>>> out(groups.size());
+    SceneGraph::Implementation::parallelFor(groups.size(), 1, [&groups, &out](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            out[i] = groups[i].get().collisions();
+    });
+
+    return out;
+}
+
+template<UnsignedInt dimensions> std::pair<AbstractShape<dimensions>*, RaycastHit<dimensions>> ShapeGroup<dimensions>::raycast(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, const Float maxDistance) {
+    MAGNUM_ALLOCATION_SCOPE(Shapes);
+
+    setClean();
+
+    std::pair<AbstractShape<dimensions>*, RaycastHit<dimensions>> nearest{nullptr, {}};
+    const auto test = [&origin, &direction, &nearest](AbstractShape<dimensions>* candidate, const Float maxDistance) -> Float {
+        const RaycastHit<dimensions> hit = candidate->raycast(origin, direction, maxDistance);
+        if(!hit || hit.distance() >= nearest.second.distance()) return maxDistance;
+
+        nearest = {candidate, hit};
+        return hit.distance();
+    };
+
+    _tree->raycast(origin, direction, maxDistance, test);
+
+    for(AbstractShape<dimensions>* candidate: _unbounded)
+        test(candidate, Math::min(maxDistance, nearest.second.distance()));
+
+    return nearest;
+}
+
+template<UnsignedInt dimensions> std::pair<AbstractShape<dimensions>*, RaycastHit<dimensions>> ShapeGroup<dimensions>::sweep(const Sphere<dimensions>& sphere, const VectorTypeFor<dimensions, Float>& displacement, const Float maxDistance) {
+    MAGNUM_ALLOCATION_SCOPE(Shapes);
+
+    CORRADE_ASSERT(maxDistance != Constants::inf(),
+        "Shapes::ShapeGroup::sweep(): the maximal distance must be finite", {});
+
+    setClean();
+
+    std::pair<AbstractShape<dimensions>*, RaycastHit<dimensions>> nearest{nullptr, {}};
+    const auto test = [&sphere, &displacement, maxDistance, &nearest](AbstractShape<dimensions>* candidate) {
+        const RaycastHit<dimensions> hit = candidate->sweep(sphere, displacement, Math::min(maxDistance, nearest.second.distance()));
+        if(hit && hit.distance() < nearest.second.distance()) nearest = {candidate, hit};
+    };
+
+    /* Bounds of the sphere along the whole sweep */
+    typedef typename Implementation::ShapeTree<dimensions>::RangeType RangeType;
+    const VectorTypeFor<dimensions, Float> radius{sphere.radius()};
+    const VectorTypeFor<dimensions, Float> end = sphere.position() + displacement*maxDistance;
+    const RangeType bounds{Math::min(sphere.position(), end) - radius, Math::max(sphere.position(), end) + radius};
+
+    _tree->query(bounds, [&test](AbstractShape<dimensions>* candidate) -> bool {
+        test(candidate);
+        return true;
+    });
+
+    for(AbstractShape<dimensions>* candidate: _unbounded)
+        test(candidate);
+
+    return nearest;
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT ShapeGroup<2>;
 template class MAGNUM_SHAPES_EXPORT ShapeGroup<3>;
@@ -29,18 +29,49 @@
  * @brief Class @ref Magnum::Shapes::ShapeGroup, typedef @ref Magnum::Shapes::ShapeGroup2D, @ref Magnum::Shapes::ShapeGroup3D
  */
 
+#include <functional>
+#include <memory>
 #include <vector>
 
 #include "Magnum/SceneGraph/FeatureGroup.h"
 #include "Magnum/Shapes/AbstractShape.h"
+#include "Magnum/Shapes/RaycastHit.h"
 #include "Magnum/Shapes/visibility.h"
 
 namespace Magnum { namespace Shapes {
 
+namespace Implementation { template<UnsignedInt> class ShapeTree; }
+
 /**
 @brief Group of shapes
 
 See @ref Shape for more information. See @ref shapes for brief introduction.
+
+@anchor Shapes-ShapeGroup-broad-phase
+## Broad phase
+
+The group maintains a dynamic bounding volume hierarchy of shape bounds, so
+collision queries don't need to test every shape in the group. The hierarchy
+is updated incrementally only for shapes whose objects became dirty since the
+last query. Bounds are enlarged by a small margin, so shapes moving only a bit
+don't cause any hierarchy update at all.
+
+Lines, planes, inverted spheres, (infinite) cylinders and compositions don't
+have cheaply computable bounds, these are tested against every query. Shapes
+should be added to and removed from the group either with the constructor
+parameter or using @ref add() and @ref remove() of this class, not through
+the base @ref SceneGraph::FeatureGroup interface.
+
+@anchor Shapes-ShapeGroup-multithreading
+## Multithreading
+
+Multiple independent groups can be cleaned and queried at once using
+@ref setClean(const std::vector<std::reference_wrapper<ShapeGroup<dimensions>>>&)
+and @ref collisions(const std::vector<std::reference_wrapper<ShapeGroup<dimensions>>>&).
+The groups are then processed in parallel on the thread pool configured with
+@ref SceneGraph::setThreadCount(). Narrow phase of @ref collisions() on large
+groups is split across the thread pool as well. With the default thread count
+of `1` everything is done on the calling thread.
 @see @ref scenegraph, @ref ShapeGroup2D, @ref ShapeGroup3D
 */
 template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>, Float> {
@@ -52,7 +83,26 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          *
          * Marks the group as dirty.
          */
-        explicit ShapeGroup(): dirty(true) {}
+        explicit ShapeGroup();
+
+        ~ShapeGroup();
+
+        /**
+         * @brief Add shape to the group
+         * @return Reference to self (for method chaining)
+         *
+         * If the shape is part of another group, it is removed from it
+         * first.
+         */
+        ShapeGroup<dimensions>& add(AbstractShape<dimensions>& shape);
+
+        /**
+         * @brief Remove shape from the group
+         * @return Reference to self (for method chaining)
+         *
+         * The shape must be part of the group.
+         */
+        ShapeGroup<dimensions>& remove(AbstractShape<dimensions>& shape);
 
         /**
          * @brief Whether the group is dirty
@@ -66,29 +116,120 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          * If some body in the group changes its transformation, it sets dirty
          * status also on the group to indicate that the body and maybe also
          * group state needs to be cleaned before computing collisions.
+         * Calling this function explicitly causes all shapes to be cleaned
+         * and their bounds updated on next @ref setClean().
          * @see @ref setClean()
          */
-        void setDirty() { dirty = true; }
+        void setDirty() { dirty = _updateAll = true; }
 
         /**
          * @brief Set the group and all bodies as clean
          *
          * This function is called before computing any collisions to ensure
-         * all objects are cleaned.
+         * all objects are cleaned. Only objects of shapes that were marked
+         * dirty are cleaned, if the group is not dirty, the function is a
+         * no-op.
          */
         void setClean();
 
+        /**
+         * @brief Set multiple groups clean
+         *
+         * Equivalent to calling @ref setClean() on each group, but the
+         * acceleration structures of the groups are updated in parallel.
+         * The objects can be shared among the groups, so their
+         * transformations are cleaned serially on the calling thread, see
+         * @ref SceneGraph::Object::setClean() for information about
+         * parallelism of the hierarchy update itself. Each group must be in
+         * the list at most once.
+         * @see @ref Shapes-ShapeGroup-multithreading "Multithreading"
+         */
+        static void setClean(const std::vector<std::reference_wrapper<ShapeGroup<dimensions>>>& groups);
+
         /**
          * @brief First collision of given shape with other shapes in the group
          *
-         * Returns first shape colliding with given one. If there aren't any
+         * Returns a shape colliding with given one. If there aren't any
          * collisions, returns `nullptr`. Calls @ref setClean() before the
-         * operation.
+         * operation. Only shapes whose bounds overlap bounds of given shape
+         * are tested, see @ref Shapes-ShapeGroup-broad-phase "Broad phase"
+         * for more information. If multiple shapes collide with given one,
+         * it is not specified which of them is returned.
          */
         AbstractShape<dimensions>* firstCollision(const AbstractShape<dimensions>& shape);
 
+        /**
+         * @brief All collisions in the group
+         *
+         * Returns all pairs of colliding shapes in the group, each pair only
+         * once and in unspecified order. Calls @ref setClean() before the
+         * operation. Candidate pairs are found using the
+         * @ref Shapes-ShapeGroup-broad-phase "broad phase", then sorted by
+         * combination of shape types and tested in batches, so each batch
+         * runs the same collision test for all its pairs. The batches are
+         * split across threads if there is a lot of them, see
+         * @ref Shapes-ShapeGroup-multithreading "Multithreading".
+         */
+        std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> collisions();
+
+        /**
+         * @brief All collisions in multiple groups
+         *
+         * Returns collisions of each group in the same order as the groups
+         * were passed, as if @ref collisions() was called on each of them.
+         * Calls @ref setClean(const std::vector<std::reference_wrapper<ShapeGroup<dimensions>>>&)
+         * before the operation, the groups are then processed in parallel.
+         * Each group must be in the list at most once.
+         * @see @ref Shapes-ShapeGroup-multithreading "Multithreading"
+         */
+        static std::vector<std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>>> collisions(const std::vector<std::reference_wrapper<ShapeGroup<dimensions>>>& groups);
+
+        /**
+         * @brief Raycast the group
+         * @param origin        Ray origin
+         * @param direction     Ray direction
+         * @param maxDistance   Maximal hit distance, in units of direction
+         *      length
+         *
+         * Returns the shape nearest to the ray origin hit by the ray together
+         * with the hit data, or `nullptr` and empty hit if the ray doesn't
+         * hit anything. Calls @ref setClean() before the operation. The
+         * @ref Shapes-ShapeGroup-broad-phase "broad phase" hierarchy is
+         * traversed from the nearest nodes and nodes further than the
+         * nearest hit found so far are skipped. Useful e.g. for picking or
+         * line-of-sight checks. See @ref AbstractShape::raycast() for more
+         * information.
+         */
+        std::pair<AbstractShape<dimensions>*, RaycastHit<dimensions>> raycast(const VectorTypeFor<dimensions, Float>& origin, const VectorTypeFor<dimensions, Float>& direction, Float maxDistance = Constants::inf());
+
+        /**
+         * @brief Sweep a sphere against the group
+         * @param sphere        Moving sphere at its initial position
+         * @param displacement  Sphere displacement
+         * @param maxDistance   Maximal distance, in units of displacement
+         *      length, expected to be finite
+         *
+         * Returns the shape first touched by the sphere moving along given
+         * displacement together with the time of impact and contact normal,
+         * or `nullptr` and empty hit if the sphere doesn't touch anything.
+         * Calls @ref setClean() before the operation. Only shapes whose
+         * bounds overlap the bounds of the whole sweep are tested, see
+         * @ref Shapes-ShapeGroup-broad-phase "Broad phase". Useful for fast
+         * moving objects, which would otherwise tunnel through thin shapes
+         * with large simulation steps. See @ref AbstractShape::sweep() for
+         * more information.
+         */
+        std::pair<AbstractShape<dimensions>*, RaycastHit<dimensions>> sweep(const Sphere<dimensions>& sphere, const VectorTypeFor<dimensions, Float>& displacement, Float maxDistance = 1.0f);
+
     private:
-        bool dirty;
+        void MAGNUM_SHAPES_LOCAL enqueue(AbstractShape<dimensions>& shape);
+        void MAGNUM_SHAPES_LOCAL untrack(AbstractShape<dimensions>& shape);
+        void MAGNUM_SHAPES_LOCAL cleanObjects();
+        void MAGNUM_SHAPES_LOCAL updateBounds();
+
+        bool dirty, _updateAll;
+        std::vector<AbstractShape<dimensions>*> _queue, _unbounded;
+        std::unique_ptr<Implementation::ShapeTree<dimensions>> _tree;
 };
 
 /**
@@ -70,6 +70,10 @@ template<UnsignedInt> class LineSegment;
 typedef LineSegment<2> LineSegment2D;
 typedef LineSegment<3> LineSegment3D;
 
+template<UnsignedInt> class RaycastHit;
+typedef RaycastHit<2> RaycastHit2D;
+typedef RaycastHit<3> RaycastHit3D;
+
 template<class> class Shape;
 
 template<UnsignedInt> class ShapeGroup;
@@ -89,6 +93,8 @@ class Plane;
 template<UnsignedInt> class Point;
 typedef Point<2> Point2D;
 typedef Point<3> Point3D;
+
+class TriangleMesh;
 #endif
 
 }}
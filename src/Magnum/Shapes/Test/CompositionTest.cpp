@@ -27,6 +27,7 @@
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Shapes/Point.h"
 #include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
 #include "Magnum/Shapes/Composition.h"
 #include "Magnum/Shapes/Sphere.h"
 
@@ -47,6 +48,12 @@ struct CompositionTest: TestSuite::Tester {
     void copy();
     void move();
     void transformed();
+
+    void expression();
+    void expressionCollides();
+    void expressionUnimplemented();
+    void expressionConvert();
+    void expressionTransformed();
 };
 
 CompositionTest::CompositionTest() {
@@ -59,7 +66,13 @@ CompositionTest::CompositionTest() {
 
               &CompositionTest::copy,
               &CompositionTest::move,
-              &CompositionTest::transformed});
+              &CompositionTest::transformed,
+
+              &CompositionTest::expression,
+              &CompositionTest::expressionCollides,
+              &CompositionTest::expressionUnimplemented,
+              &CompositionTest::expressionConvert,
+              &CompositionTest::expressionTransformed});
 }
 
 void CompositionTest::negated() {
@@ -183,6 +196,69 @@ void CompositionTest::transformed() {
     CORRADE_COMPARE(b.get<Shapes::AxisAlignedBox2D>(2).max(), Vector2(2.0f, -6.5f));
 }
 
+void CompositionTest::expression() {
+    const Shapes::Sphere2D sphere({}, 1.0f);
+    const auto a = sphere && !Shapes::Point2D(Vector2::xAxis(0.5f));
+
+    CORRADE_VERIFY((std::is_same<decltype(a), const CompositionExpression<CompositionOperation::And, Shapes::Sphere2D, CompositionExpression<CompositionOperation::Not, Shapes::Point2D>>>::value));
+    CORRADE_COMPARE(a.first().radius(), 1.0f);
+    CORRADE_COMPARE(a.second().first().position(), Vector2::xAxis(0.5f));
+}
+
+void CompositionTest::expressionCollides() {
+    const auto a = Shapes::Sphere3D({}, 1.0f) &&
+        (Shapes::Point3D(Vector3::xAxis(1.5f)) || !Shapes::AxisAlignedBox3D({}, Vector3(0.5f)));
+
+    VERIFY_COLLIDES(a, Shapes::Sphere3D(Vector3::xAxis(1.5f), 0.6f));
+    VERIFY_NOT_COLLIDES(a, Shapes::Point3D(Vector3(0.25f)));
+    VERIFY_COLLIDES(a, Shapes::Point3D(Vector3(-0.25f)));
+
+    const auto b = Shapes::Sphere2D({}, 1.0f) || Shapes::Point2D(Vector2::xAxis(1.5f));
+    VERIFY_COLLIDES(b, Shapes::Point2D());
+    VERIFY_COLLIDES(b, Shapes::Sphere2D(Vector2::xAxis(1.5f), 0.25f));
+    VERIFY_NOT_COLLIDES(b, Shapes::Point2D(Vector2::yAxis(1.5f)));
+
+    const auto c = !!!!Shapes::Point2D(Vector2::xAxis(0.5f));
+    VERIFY_COLLIDES(c, Shapes::Sphere2D({}, 1.0f));
+}
+
+void CompositionTest::expressionUnimplemented() {
+    /* Box vs. point collision is not implemented, the expression should
+       behave the same as the runtime composition */
+    const auto a = !Shapes::Box2D(Matrix3());
+    const Shapes::Composition2D b = a;
+
+    CORRADE_VERIFY(a % Shapes::Point2D());
+    CORRADE_VERIFY(b % Shapes::Point2D());
+}
+
+void CompositionTest::expressionConvert() {
+    const Shapes::Composition3D simplified = !Shapes::AxisAlignedBox3D({}, Vector3(0.5f));
+    const Shapes::Composition3D a = Shapes::Sphere3D({}, 1.0f) &&
+        (Shapes::Point3D(Vector3::xAxis(1.5f)) || simplified);
+
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.type(0), Composition3D::Type::Sphere);
+    CORRADE_COMPARE(a.type(1), Composition3D::Type::Point);
+    CORRADE_COMPARE(a.type(2), Composition3D::Type::AxisAlignedBox);
+    CORRADE_COMPARE(a.get<Shapes::AxisAlignedBox3D>(2).max(), Vector3(0.5f));
+
+    VERIFY_COLLIDES(a, Shapes::Sphere3D(Vector3::xAxis(1.5f), 0.6f));
+    VERIFY_NOT_COLLIDES(a, Shapes::Point3D(Vector3(0.25f)));
+}
+
+void CompositionTest::expressionTransformed() {
+    const auto a = Shapes::Sphere2D({}, 1.0f) &&
+        (Shapes::Point2D(Vector2::xAxis(1.5f)) || !Shapes::AxisAlignedBox2D({}, Vector2(0.5f)));
+
+    const auto b = a.transformed(Matrix3::translation({1.5f, -7.0f}));
+    CORRADE_COMPARE(b.first().position(), Vector2(1.5f, -7.0f));
+    CORRADE_COMPARE(b.first().radius(), 1.0f);
+    CORRADE_COMPARE(b.second().first().position(), Vector2(3.0f, -7.0f));
+    CORRADE_COMPARE(b.second().second().first().min(), Vector2(1.5f, -7.0f));
+    CORRADE_COMPARE(b.second().second().first().max(), Vector2(2.0f, -6.5f));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::CompositionTest)
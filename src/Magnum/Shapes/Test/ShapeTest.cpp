@@ -23,16 +23,26 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <memory>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
 #include "Magnum/Shapes/Composition.h"
+#include "Magnum/Shapes/Line.h"
+#include "Magnum/Shapes/Plane.h"
 #include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/RaycastHit.h"
 #include "Magnum/Shapes/Shape.h"
 #include "Magnum/Shapes/ShapeGroup.h"
 #include "Magnum/Shapes/Sphere.h"
 #include "Magnum/SceneGraph/MatrixTransformation2D.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/Threading.h"
 
 namespace Magnum { namespace Shapes { namespace Test {
 
@@ -40,9 +50,22 @@ struct ShapeTest: TestSuite::Tester {
     explicit ShapeTest();
 
     void clean();
+    void cleanMultiple();
     void collides();
     void collision();
     void firstCollision();
+    void firstCollisionMany();
+    void firstCollisionUnbounded();
+    void firstCollisionRemoved();
+    void collisions();
+    void collisionsMultiple();
+    void collisionsParallel();
+    void raycast();
+    void raycastInside();
+    void raycastGroup();
+    void raycastGroupUnbounded();
+    void sweep();
+    void sweepGroup();
     void shapeGroup();
 };
 
@@ -53,9 +76,22 @@ typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
 
 ShapeTest::ShapeTest() {
     addTests({&ShapeTest::clean,
+              &ShapeTest::cleanMultiple,
               &ShapeTest::collides,
               &ShapeTest::collision,
               &ShapeTest::firstCollision,
+              &ShapeTest::firstCollisionMany,
+              &ShapeTest::firstCollisionUnbounded,
+              &ShapeTest::firstCollisionRemoved,
+              &ShapeTest::collisions,
+              &ShapeTest::collisionsMultiple,
+              &ShapeTest::collisionsParallel,
+              &ShapeTest::raycast,
+              &ShapeTest::raycastInside,
+              &ShapeTest::raycastGroup,
+              &ShapeTest::raycastGroupUnbounded,
+              &ShapeTest::sweep,
+              &ShapeTest::sweepGroup,
               &ShapeTest::shapeGroup});
 }
 
@@ -99,6 +135,36 @@ void ShapeTest::clean() {
     CORRADE_VERIFY(b.isDirty());
 }
 
+void ShapeTest::cleanMultiple() {
+    Scene3D scene;
+    ShapeGroup3D shapes1, shapes2, shapes3;
+
+    Object3D a(&scene);
+    Shape<Shapes::Point3D> aShape(a, {{1.0f, -2.0f, 3.0f}}, &shapes1);
+    a.scale(Vector3(-2.0f));
+
+    /* Object shared between two groups */
+    Object3D b(&scene);
+    Shape<Shapes::Point3D> bShape1(b, {{1.0f, 0.0f, 0.0f}}, &shapes1);
+    Shape<Shapes::Point3D> bShape2(b, {{0.0f, 1.0f, 0.0f}}, &shapes2);
+    b.translate(Vector3::zAxis(1.0f));
+
+    shapes3.setClean();
+    CORRADE_VERIFY(shapes1.isDirty());
+    CORRADE_VERIFY(shapes2.isDirty());
+    CORRADE_VERIFY(!shapes3.isDirty());
+
+    ShapeGroup3D::setClean({shapes1, shapes2, shapes3});
+    CORRADE_VERIFY(!shapes1.isDirty());
+    CORRADE_VERIFY(!shapes2.isDirty());
+    CORRADE_VERIFY(!shapes3.isDirty());
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_COMPARE(aShape.transformedShape().position(), Vector3(-2.0f, 4.0f, -6.0f));
+    CORRADE_COMPARE(bShape1.transformedShape().position(), Vector3(1.0f, 0.0f, 1.0f));
+    CORRADE_COMPARE(bShape2.transformedShape().position(), Vector3(0.0f, 1.0f, 1.0f));
+}
+
 void ShapeTest::collides() {
     Scene3D scene;
     ShapeGroup3D shapes;
@@ -206,6 +272,368 @@ void ShapeTest::firstCollision() {
     CORRADE_VERIFY(!shapes.isDirty());
 }
 
+void ShapeTest::firstCollisionMany() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    /* Grid of non-overlapping spheres, enough to have a non-trivial tree */
+    std::vector<std::unique_ptr<Object2D>> objects;
+    std::vector<std::unique_ptr<Shape<Shapes::Sphere2D>>> spheres;
+    for(Int i = 0; i != 16; ++i) for(Int j = 0; j != 16; ++j) {
+        objects.emplace_back(new Object2D{&scene});
+        objects.back()->translate({Float(i), Float(j)});
+        spheres.emplace_back(new Shape<Shapes::Sphere2D>{*objects.back(), {{}, 0.25f}, &shapes});
+    }
+
+    Object2D queryObject(&scene);
+    queryObject.translate({3.0f, 7.0f});
+    Shape<Shapes::Point2D> query(queryObject, {{0.1f, 0.1f}});
+    queryObject.setClean();
+
+    /* Point near the sphere at (3, 7) */
+    CORRADE_VERIFY(shapes.firstCollision(query) == spheres[3*16 + 7].get());
+
+    /* Move the point between the spheres */
+    queryObject.translate({0.4f, 0.4f});
+    queryObject.setClean();
+    CORRADE_VERIFY(!shapes.firstCollision(query));
+
+    /* Move one sphere far away under the point, the tree needs updating */
+    objects[15*16 + 15]->translate({-11.5f, -7.5f});
+    CORRADE_VERIFY(shapes.firstCollision(query) == spheres[15*16 + 15].get());
+    CORRADE_VERIFY(!shapes.isDirty());
+}
+
+void ShapeTest::firstCollisionUnbounded() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    Shape<Shapes::Line3D> line(a, {{}, Vector3::xAxis()}, &shapes);
+
+    Object3D b(&scene);
+    Shape<Shapes::Sphere3D> sphere(b, {Vector3::yAxis(10.0f), 1.0f}, &shapes);
+
+    /* Unbounded shapes are tested with every query */
+    Object3D c(&scene);
+    Shape<Shapes::Sphere3D> querySphere(c, {{100.0f, 0.5f, 0.0f}, 1.0f});
+    c.setClean();
+    CORRADE_VERIFY(shapes.firstCollision(querySphere) == &line);
+
+    /* Unbounded query shapes are tested against everything */
+    Object3D d(&scene);
+    Shape<Shapes::Line3D> queryLine(d, {Vector3::yAxis(10.0f), {1.0f, 10.0f, 0.0f}});
+    d.setClean();
+    CORRADE_VERIFY(shapes.firstCollision(queryLine) == &sphere);
+}
+
+void ShapeTest::firstCollisionRemoved() {
+    Scene3D scene;
+    ShapeGroup3D shapes, shapes2;
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> aShape(a, {{}, 1.0f}, &shapes);
+
+    Object3D b(&scene);
+    Shape<Shapes::Point3D> bShape(b, {{0.5f, 0.0f, 0.0f}});
+    b.setClean();
+
+    {
+        Shape<Shapes::Sphere3D> cShape(a, {{}, 2.0f}, &shapes);
+        CORRADE_VERIFY(shapes.firstCollision(bShape));
+    }
+
+    /* Destruction and moving to another group removes it from the tree */
+    shapes2.add(aShape);
+    CORRADE_VERIFY(!shapes.firstCollision(bShape));
+    CORRADE_VERIFY(shapes2.firstCollision(bShape) == &aShape);
+
+    shapes2.remove(aShape);
+    CORRADE_VERIFY(!shapes2.firstCollision(bShape));
+}
+
+void ShapeTest::collisions() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> aShape(a, {{}, 1.0f}, &shapes);
+    Shape<Shapes::Point3D> bShape(a, {{0.25f, 0.0f, 0.0f}}, &shapes);
+    Shape<Shapes::Sphere3D> cShape(a, {{1.5f, 0.0f, 0.0f}, 1.0f}, &shapes);
+    Shape<Shapes::Line3D> dShape(a, {{0.0f, 5.0f, 0.0f}, {0.0f, 5.0f, 1.0f}}, &shapes);
+
+    Object3D b(&scene);
+    Shape<Shapes::Sphere3D> eShape(b, {{100.0f, 0.0f, 0.0f}, 1.0f}, &shapes);
+
+    /* Order the pairs to make the comparison easy, types are ordered already */
+    auto collisions = shapes.collisions();
+    std::sort(collisions.begin(), collisions.end(), [](const std::pair<AbstractShape3D*, AbstractShape3D*>& p, const std::pair<AbstractShape3D*, AbstractShape3D*>& q) {
+        return std::make_pair(p.first->type(), p.second->type()) < std::make_pair(q.first->type(), q.second->type());
+    });
+
+    /* Sphere--point, sphere--sphere */
+    CORRADE_COMPARE(collisions.size(), 2);
+    CORRADE_VERIFY(collisions[0].first == &aShape);
+    CORRADE_VERIFY(collisions[0].second == &bShape);
+    CORRADE_VERIFY((collisions[1].first == &aShape && collisions[1].second == &cShape) ||
+                   (collisions[1].first == &cShape && collisions[1].second == &aShape));
+
+    /* Move the far sphere onto the line */
+    b.translate({-100.0f, 5.0f, 0.5f});
+    collisions = shapes.collisions();
+    CORRADE_COMPARE(collisions.size(), 3);
+    CORRADE_COMPARE(std::count_if(collisions.begin(), collisions.end(), [&](const std::pair<AbstractShape3D*, AbstractShape3D*>& p) {
+        return p.first == &eShape && p.second == &dShape;
+    }), 1);
+}
+
+void ShapeTest::collisionsMultiple() {
+    Scene3D scene;
+    ShapeGroup3D shapes1, shapes2, shapes3;
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> aShape(a, {{}, 1.0f}, &shapes1);
+    Shape<Shapes::Point3D> bShape(a, {{0.25f, 0.0f, 0.0f}}, &shapes1);
+    Shape<Shapes::Sphere3D> cShape(a, {{5.0f, 0.0f, 0.0f}, 1.0f}, &shapes2);
+    Shape<Shapes::Point3D> dShape(a, {{0.0f, 5.0f, 0.0f}}, &shapes2);
+
+    Object3D b(&scene);
+    Shape<Shapes::Point3D> eShape(b, {{5.0f, 0.5f, 0.0f}}, &shapes2);
+
+    const std::vector<std::vector<std::pair<AbstractShape3D*, AbstractShape3D*>>> collisions = ShapeGroup3D::collisions({shapes1, shapes2, shapes3});
+    CORRADE_COMPARE(collisions.size(), 3);
+    CORRADE_COMPARE(collisions[0].size(), 1);
+    CORRADE_VERIFY(collisions[0][0].first == &aShape);
+    CORRADE_VERIFY(collisions[0][0].second == &bShape);
+    CORRADE_COMPARE(collisions[1].size(), 1);
+    CORRADE_VERIFY(collisions[1][0].first == &cShape);
+    CORRADE_VERIFY(collisions[1][0].second == &eShape);
+    CORRADE_VERIFY(collisions[2].empty());
+
+    /* Moving the object affects only the second group */
+    b.translate(Vector3::yAxis(4.5f));
+    CORRADE_VERIFY(!shapes1.isDirty());
+    CORRADE_VERIFY(shapes2.isDirty());
+    const std::vector<std::vector<std::pair<AbstractShape3D*, AbstractShape3D*>>> collisions2 = ShapeGroup3D::collisions({shapes1, shapes2});
+    CORRADE_COMPARE(collisions2.size(), 2);
+    CORRADE_COMPARE(collisions2[0].size(), 1);
+    CORRADE_VERIFY(collisions2[1].empty());
+}
+
+void ShapeTest::collisionsParallel() {
+    Scene3D scene;
+    ShapeGroup3D shapes[4];
+    Object3D a(&scene);
+
+    /* Enough overlapping spheres to have the narrow phase split into more
+       chunks, every sixth one is disjoint with the others */
+    for(std::size_t i = 0; i != 4; ++i) for(Int j = 0; j != 120; ++j)
+        new Shape<Shapes::Sphere3D>(a, {{j%6 ? 0.0f : (j + 1)*100.0f, 0.0f, 0.0f}, 1.0f}, &shapes[i]);
+
+    SceneGraph::setThreadCount(4);
+    const std::vector<std::vector<std::pair<AbstractShape3D*, AbstractShape3D*>>> collisions = ShapeGroup3D::collisions({shapes[0], shapes[1], shapes[2], shapes[3]});
+    CORRADE_COMPARE(collisions.size(), 4);
+    for(std::size_t i = 0; i != 4; ++i)
+        CORRADE_COMPARE(collisions[i].size(), 100*99/2);
+
+    /* Single group, the narrow phase is parallelized */
+    CORRADE_COMPARE(shapes[0].collisions().size(), 100*99/2);
+    SceneGraph::setThreadCount(1);
+}
+
+void ShapeTest::raycast() {
+    Scene3D scene;
+    Object3D a(&scene);
+    a.translate(Vector3::zAxis(5.0f));
+
+    Shape<Shapes::Sphere3D> sphere(a, {{}, 1.0f});
+    Shape<Shapes::Capsule3D> capsule(a, {{}, Vector3::zAxis(2.0f), 1.0f});
+    Shape<Shapes::AxisAlignedBox3D> box(a, {{-1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 2.0f}});
+    Shape<Shapes::Box3D> rotatedBox(a, {Matrix4::rotationZ(Deg(45.0f))});
+    Shape<Shapes::Plane> plane(a, {{}, Vector3::zAxis()});
+    Shape<Shapes::Point3D> point(a, {{}});
+    a.setClean();
+
+    RaycastHit3D hit = sphere.raycast({}, Vector3::zAxis());
+    CORRADE_VERIFY(hit);
+    CORRADE_COMPARE(hit.distance(), 4.0f);
+    CORRADE_COMPARE(hit.normal(), -Vector3::zAxis());
+
+    /* Distance is in units of direction length */
+    CORRADE_COMPARE(sphere.raycast({}, Vector3::zAxis(2.0f)).distance(), 2.0f);
+
+    /* Too far, pointing away */
+    CORRADE_VERIFY(!sphere.raycast({}, Vector3::zAxis(), 3.5f));
+    CORRADE_VERIFY(!sphere.raycast({}, -Vector3::zAxis()));
+
+    /* Side of the capsule, the cap */
+    hit = capsule.raycast({-5.0f, 0.0f, 6.0f}, Vector3::xAxis());
+    CORRADE_COMPARE(hit.distance(), 4.0f);
+    CORRADE_COMPARE(hit.normal(), -Vector3::xAxis());
+    hit = capsule.raycast({}, Vector3::zAxis());
+    CORRADE_COMPARE(hit.distance(), 4.0f);
+    CORRADE_COMPARE(hit.normal(), -Vector3::zAxis());
+
+    hit = box.raycast({0.5f, 0.5f, 10.0f}, -Vector3::zAxis());
+    CORRADE_COMPARE(hit.distance(), 3.0f);
+    CORRADE_COMPARE(hit.normal(), Vector3::zAxis());
+
+    /* Edge of the rotated box is at sqrt(2) */
+    hit = rotatedBox.raycast({-5.0f, 0.0f, 5.5f}, Vector3::xAxis());
+    CORRADE_COMPARE(hit.distance(), 5.0f - Constants::sqrt2());
+
+    /* Planes are two-sided */
+    hit = plane.raycast({1.0f, 2.0f, 8.0f}, -Vector3::zAxis());
+    CORRADE_COMPARE(hit.distance(), 3.0f);
+    CORRADE_COMPARE(hit.normal(), Vector3::zAxis());
+    hit = plane.raycast({1.0f, 2.0f, 2.0f}, Vector3::zAxis());
+    CORRADE_COMPARE(hit.distance(), 3.0f);
+    CORRADE_COMPARE(hit.normal(), -Vector3::zAxis());
+
+    /* Points are never hit */
+    CORRADE_VERIFY(!point.raycast({}, Vector3::zAxis()));
+}
+
+void ShapeTest::raycastInside() {
+    Scene3D scene;
+    Object3D a(&scene);
+
+    Shape<Shapes::Sphere3D> sphere(a, {{}, 1.0f});
+    Shape<Shapes::InvertedSphere3D> invertedSphere(a, {{}, 2.0f});
+    a.setClean();
+
+    RaycastHit3D hit = sphere.raycast({0.5f, 0.0f, 0.0f}, Vector3::xAxis(2.0f));
+    CORRADE_VERIFY(hit);
+    CORRADE_COMPARE(hit.distance(), 0.0f);
+    CORRADE_COMPARE(hit.normal(), -Vector3::xAxis());
+
+    /* Inside of the inverted sphere is empty, the hit is from inside */
+    hit = invertedSphere.raycast({}, Vector3::xAxis());
+    CORRADE_COMPARE(hit.distance(), 2.0f);
+    CORRADE_COMPARE(hit.normal(), -Vector3::xAxis());
+    CORRADE_COMPARE(invertedSphere.raycast({3.0f, 0.0f, 0.0f}, Vector3::xAxis()).distance(), 0.0f);
+}
+
+void ShapeTest::raycastGroup() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> nearSphere(a, {Vector3::zAxis(5.0f), 1.0f}, &shapes);
+    Shape<Shapes::Sphere3D> farSphere(a, {Vector3::zAxis(10.0f), 1.0f}, &shapes);
+    Shape<Shapes::Sphere3D> asideSphere(a, {{5.0f, 0.0f, 2.0f}, 1.0f}, &shapes);
+
+    std::pair<AbstractShape3D*, RaycastHit3D> hit = shapes.raycast({}, Vector3::zAxis());
+    CORRADE_VERIFY(hit.first == &nearSphere);
+    CORRADE_COMPARE(hit.second.distance(), 4.0f);
+
+    /* Move the object, the group is updated */
+    a.translate(Vector3::xAxis(-5.0f));
+    hit = shapes.raycast({}, Vector3::zAxis());
+    CORRADE_VERIFY(hit.first == &asideSphere);
+    CORRADE_COMPARE(hit.second.distance(), 1.0f);
+
+    /* Nothing in given distance */
+    hit = shapes.raycast({}, -Vector3::zAxis(), 100.0f);
+    CORRADE_VERIFY(!hit.first);
+    CORRADE_VERIFY(!hit.second);
+}
+
+void ShapeTest::raycastGroupUnbounded() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> sphere(a, {Vector3::zAxis(5.0f), 1.0f}, &shapes);
+    Shape<Shapes::Plane> plane(a, {Vector3::zAxis(3.0f), Vector3::zAxis()}, &shapes);
+
+    /* Unbounded shapes are tested with every query */
+    std::pair<AbstractShape3D*, RaycastHit3D> hit = shapes.raycast({}, Vector3::zAxis());
+    CORRADE_VERIFY(hit.first == &plane);
+    CORRADE_COMPARE(hit.second.distance(), 3.0f);
+
+    hit = shapes.raycast({0.0f, 0.0f, 10.0f}, -Vector3::zAxis());
+    CORRADE_VERIFY(hit.first == &sphere);
+    CORRADE_COMPARE(hit.second.distance(), 4.0f);
+}
+
+void ShapeTest::sweep() {
+    Scene3D scene;
+    Object3D a(&scene);
+    a.translate(Vector3::xAxis(5.0f));
+
+    Shape<Shapes::Sphere3D> sphere(a, {{}, 1.0f});
+    Shape<Shapes::Point3D> point(a, {{}});
+    Shape<Shapes::AxisAlignedBox3D> box(a, {{-0.05f, -1.0f, -1.0f}, {0.05f, 1.0f, 1.0f}});
+    Shape<Shapes::Plane> plane(a, {{}, Vector3::xAxis()});
+    a.setClean();
+
+    /* Sphere moving through, the time of impact is when the surfaces touch */
+    const Shapes::Sphere3D projectile{{}, 0.5f};
+    RaycastHit3D hit = sphere.sweep(projectile, Vector3::xAxis(10.0f));
+    CORRADE_VERIFY(hit);
+    CORRADE_COMPARE(hit.distance(), 0.35f);
+    CORRADE_COMPARE(hit.normal(), -Vector3::xAxis());
+
+    hit = point.sweep(projectile, Vector3::xAxis(10.0f));
+    CORRADE_COMPARE(hit.distance(), 0.45f);
+    CORRADE_COMPARE(hit.normal(), -Vector3::xAxis());
+
+    /* Thin box would be missed by discrete tests at both ends of the
+       displacement */
+    CORRADE_VERIFY(!box.sweep(projectile, Vector3::xAxis(10.0f), 0.4f));
+    hit = box.sweep(projectile, Vector3::xAxis(10.0f));
+    CORRADE_COMPARE(hit.distance(), 0.445f);
+    CORRADE_COMPARE(hit.normal(), -Vector3::xAxis());
+
+    /* Box edge touched by the rounded part */
+    hit = box.sweep({{0.0f, 1.5f, 1.5f}, 0.5f}, Vector3::xAxis(10.0f));
+    CORRADE_VERIFY(!hit);
+    hit = box.sweep({{0.0f, 1.25f, 0.0f}, 0.5f}, Vector3::xAxis(10.0f));
+    CORRADE_VERIFY(hit);
+    CORRADE_COMPARE(hit.normal(), Vector3(-0.866025f, 0.5f, 0.0f));
+
+    /* Two-sided plane */
+    hit = plane.sweep({{10.0f, 0.0f, 0.0f}, 0.5f}, Vector3::xAxis(-10.0f));
+    CORRADE_COMPARE(hit.distance(), 0.45f);
+    CORRADE_COMPARE(hit.normal(), Vector3::xAxis());
+    CORRADE_VERIFY(!plane.sweep({{10.0f, 0.0f, 0.0f}, 0.5f}, Vector3::xAxis(10.0f)));
+
+    /* Overlapping at the beginning */
+    hit = sphere.sweep({{4.0f, 0.0f, 0.0f}, 0.5f}, Vector3::yAxis());
+    CORRADE_COMPARE(hit.distance(), 0.0f);
+    CORRADE_COMPARE(hit.normal(), -Vector3::yAxis());
+}
+
+void ShapeTest::sweepGroup() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    Shape<Shapes::AxisAlignedBox3D> wall(a, {{4.95f, -1.0f, -1.0f}, {5.05f, 1.0f, 1.0f}}, &shapes);
+    Shape<Shapes::Sphere3D> sphere(a, {{8.0f, 0.0f, 0.0f}, 1.0f}, &shapes);
+    Shape<Shapes::Sphere3D> distant(a, {{0.0f, 100.0f, 0.0f}, 1.0f}, &shapes);
+    Shape<Shapes::Plane> plane(a, {{20.0f, 0.0f, 0.0f}, Vector3::xAxis()}, &shapes);
+
+    /* The wall is nearer */
+    std::pair<AbstractShape3D*, RaycastHit3D> hit = shapes.sweep({{}, 0.5f}, Vector3::xAxis(10.0f));
+    CORRADE_VERIFY(hit.first == &wall);
+    CORRADE_COMPARE(hit.second.distance(), 0.445f);
+
+    /* From behind the wall, the unbounded plane is hit after the sphere */
+    hit = shapes.sweep({{6.0f, 0.0f, 0.0f}, 0.5f}, Vector3::xAxis(20.0f));
+    CORRADE_VERIFY(hit.first == &sphere);
+    CORRADE_COMPARE(hit.second.distance(), 0.025f);
+    hit = shapes.sweep({{10.0f, 0.0f, 0.0f}, 0.5f}, Vector3::xAxis(20.0f));
+    CORRADE_VERIFY(hit.first == &plane);
+    CORRADE_COMPARE(hit.second.distance(), 0.475f);
+
+    /* Nothing in the way */
+    hit = shapes.sweep({{0.0f, 0.0f, 10.0f}, 0.5f}, Vector3::xAxis(10.0f));
+    CORRADE_VERIFY(!hit.first);
+    CORRADE_VERIFY(!hit.second);
+}
+
 void ShapeTest::shapeGroup() {
     Scene2D scene;
     ShapeGroup2D shapes;
@@ -0,0 +1,179 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Shapes/TriangleMesh.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+struct TriangleMeshTest: TestSuite::Tester {
+    explicit TriangleMeshTest();
+
+    void construct();
+    void constructMeshData();
+    void constructEmpty();
+
+    void raycast();
+    void raycastNearest();
+    void raycastMaxDistance();
+    void raycastGrid();
+};
+
+TriangleMeshTest::TriangleMeshTest() {
+    addTests({&TriangleMeshTest::construct,
+              &TriangleMeshTest::constructMeshData,
+              &TriangleMeshTest::constructEmpty,
+
+              &TriangleMeshTest::raycast,
+              &TriangleMeshTest::raycastNearest,
+              &TriangleMeshTest::raycastMaxDistance,
+              &TriangleMeshTest::raycastGrid});
+}
+
+namespace {
+
+/* Flat grid of size*size quads at given height, the quad at (x, y) consists
+   of triangles with IDs 2*(y*size + x) and 2*(y*size + x) + 1, the first
+   has local X larger than local Y */
+void addGrid(std::vector<Vector3>& positions, std::vector<UnsignedInt>& indices, const UnsignedInt size, const Float z) {
+    const UnsignedInt offset = positions.size();
+    for(UnsignedInt y = 0; y != size + 1; ++y)
+        for(UnsignedInt x = 0; x != size + 1; ++x)
+            positions.emplace_back(Float(x), Float(y), z);
+
+    for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+        const UnsignedInt i = offset + y*(size + 1) + x;
+        indices.insert(indices.end(), {i, i + 1, i + size + 2,
+                                       i, i + size + 2, i + size + 1});
+    }
+}
+
+}
+
+void TriangleMeshTest::construct() {
+    std::vector<Vector3> positions;
+    std::vector<UnsignedInt> indices;
+    addGrid(positions, indices, 4, 1.5f);
+
+    TriangleMesh mesh{positions, indices};
+    CORRADE_COMPARE(mesh.triangleCount(), 32);
+    CORRADE_COMPARE(mesh.bounds(), Range3D({0.0f, 0.0f, 1.5f}, {4.0f, 4.0f, 1.5f}));
+}
+
+void TriangleMeshTest::constructMeshData() {
+    /* Non-indexed mesh */
+    TriangleMesh mesh{Trade::MeshData3D{MeshPrimitive::Triangles, {}, {{
+        {-1.0f, -1.0f, 0.0f}, {1.0f, -1.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+        {-1.0f, -1.0f, 1.0f}, {1.0f, -1.0f, 1.0f}, {0.0f, 1.0f, 1.0f}
+    }}, {}, {}}};
+    CORRADE_COMPARE(mesh.triangleCount(), 2);
+    CORRADE_COMPARE(mesh.bounds(), Range3D({-1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}));
+
+    const std::pair<Int, RaycastHit3D> hit = mesh.raycast({0.0f, 0.0f, 5.0f}, -Vector3::zAxis());
+    CORRADE_COMPARE(hit.first, 1);
+    CORRADE_COMPARE(hit.second.distance(), 4.0f);
+}
+
+void TriangleMeshTest::constructEmpty() {
+    TriangleMesh mesh{{}, {}};
+    CORRADE_COMPARE(mesh.triangleCount(), 0);
+    CORRADE_COMPARE(mesh.bounds(), Range3D());
+
+    const std::pair<Int, RaycastHit3D> hit = mesh.raycast({}, Vector3::zAxis());
+    CORRADE_COMPARE(hit.first, -1);
+    CORRADE_VERIFY(!hit.second);
+}
+
+void TriangleMeshTest::raycast() {
+    TriangleMesh mesh{{{-1.0f, -1.0f, 0.0f}, {1.0f, -1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}, {0, 1, 2}};
+
+    /* Triangles are two-sided, normal faces against the ray */
+    std::pair<Int, RaycastHit3D> hit = mesh.raycast({0.0f, 0.0f, 2.0f}, Vector3::zAxis(-0.5f));
+    CORRADE_COMPARE(hit.first, 0);
+    CORRADE_COMPARE(hit.second.distance(), 4.0f);
+    CORRADE_COMPARE(hit.second.normal(), Vector3::zAxis());
+
+    hit = mesh.raycast({0.0f, 0.0f, -2.0f}, Vector3::zAxis());
+    CORRADE_COMPARE(hit.first, 0);
+    CORRADE_COMPARE(hit.second.distance(), 2.0f);
+    CORRADE_COMPARE(hit.second.normal(), -Vector3::zAxis());
+
+    /* Outside of the triangle, pointing away */
+    CORRADE_COMPARE(mesh.raycast({0.9f, 0.9f, 2.0f}, -Vector3::zAxis()).first, -1);
+    CORRADE_COMPARE(mesh.raycast({0.0f, 0.0f, 2.0f}, Vector3::zAxis()).first, -1);
+}
+
+void TriangleMeshTest::raycastNearest() {
+    std::vector<Vector3> positions;
+    std::vector<UnsignedInt> indices;
+    addGrid(positions, indices, 8, 3.0f);
+    addGrid(positions, indices, 8, 1.0f);
+    addGrid(positions, indices, 8, 2.0f);
+
+    TriangleMesh mesh{positions, indices};
+    std::pair<Int, RaycastHit3D> hit = mesh.raycast({2.75f, 5.25f, 0.0f}, Vector3::zAxis());
+    CORRADE_COMPARE(hit.first, 128 + 2*(5*8 + 2));
+    CORRADE_COMPARE(hit.second.distance(), 1.0f);
+
+    hit = mesh.raycast({2.25f, 5.75f, 10.0f}, -Vector3::zAxis());
+    CORRADE_COMPARE(hit.first, 2*(5*8 + 2) + 1);
+    CORRADE_COMPARE(hit.second.distance(), 7.0f);
+}
+
+void TriangleMeshTest::raycastMaxDistance() {
+    std::vector<Vector3> positions;
+    std::vector<UnsignedInt> indices;
+    addGrid(positions, indices, 8, 3.0f);
+    addGrid(positions, indices, 8, 1.0f);
+
+    TriangleMesh mesh{positions, indices};
+    CORRADE_COMPARE(mesh.raycast({0.25f, 0.75f, 0.0f}, Vector3::zAxis(), 2.0f).first, 128 + 1);
+    CORRADE_COMPARE(mesh.raycast({0.25f, 0.75f, 0.0f}, Vector3::zAxis(), 0.5f).first, -1);
+}
+
+void TriangleMeshTest::raycastGrid() {
+    /* Large enough to have a deep hierarchy, every quad hit in both
+       triangles */
+    std::vector<Vector3> positions;
+    std::vector<UnsignedInt> indices;
+    addGrid(positions, indices, 32, 0.0f);
+
+    TriangleMesh mesh{positions, indices};
+    for(UnsignedInt y = 0; y != 32; ++y) for(UnsignedInt x = 0; x != 32; ++x) {
+        const std::pair<Int, RaycastHit3D> a = mesh.raycast({x + 0.75f, y + 0.25f, 1.0f}, -Vector3::zAxis());
+        const std::pair<Int, RaycastHit3D> b = mesh.raycast({x + 0.25f, y + 0.75f, 1.0f}, {0.1f, 0.0f, -1.0f});
+        CORRADE_COMPARE(a.first, 2*(y*32 + x));
+        CORRADE_COMPARE(b.first, 2*(y*32 + x) + 1);
+        CORRADE_COMPARE(a.second.distance(), 1.0f);
+        CORRADE_COMPARE(b.second.distance(), 1.0f);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::TriangleMeshTest)
@@ -0,0 +1,266 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TriangleMesh.h"
+
+#include <algorithm>
+#include <numeric>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Implementation/Simd.h"
+#include "Magnum/Shapes/Implementation/ShapeTree.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Shapes {
+
+TriangleMesh::TriangleMesh(const Trade::MeshData3D& data, const UnsignedInt positionArray): _triangleCount{} {
+    CORRADE_ASSERT(data.primitive() == MeshPrimitive::Triangles,
+        "Shapes::TriangleMesh: expected triangle mesh", );
+
+    if(data.isIndexed()) {
+        build(data.positions(positionArray), data.indices());
+        return;
+    }
+
+    std::vector<UnsignedInt> indices(data.positions(positionArray).size()/3*3);
+    std::iota(indices.begin(), indices.end(), 0);
+    build(data.positions(positionArray), indices);
+}
+
+TriangleMesh::TriangleMesh(const std::vector<Vector3>& positions, const std::vector<UnsignedInt>& indices): _triangleCount{} {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "Shapes::TriangleMesh: index count is not divisible by three", );
+
+    build(positions, indices);
+}
+
+Range3D TriangleMesh::bounds() const {
+    return _nodes.empty() ? Range3D{} : _nodes.front().bounds;
+}
+
+void TriangleMesh::build(const std::vector<Vector3>& positions, const std::vector<UnsignedInt>& indices) {
+    _triangleCount = indices.size()/3;
+    if(!_triangleCount) return;
+
+    std::vector<Vector3> centroids(_triangleCount);
+    for(std::size_t i = 0; i != _triangleCount; ++i)
+        centroids[i] = (positions[indices[i*3]] + positions[indices[i*3 + 1]] + positions[indices[i*3 + 2]])/3.0f;
+
+    /* The tree is balanced, so there's roughly twice as many nodes as
+       leaves */
+    const std::size_t leafCount = (_triangleCount + 3)/4;
+    _nodes.reserve(2*leafCount);
+    _packets.reserve(leafCount);
+
+    std::vector<UnsignedInt> triangles(_triangleCount);
+    std::iota(triangles.begin(), triangles.end(), 0);
+    buildNode(positions, indices, centroids, triangles.begin(), triangles.end());
+}
+
+UnsignedInt TriangleMesh::buildNode(const std::vector<Vector3>& positions, const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& centroids, const std::vector<UnsignedInt>::iterator begin, const std::vector<UnsignedInt>::iterator end) {
+    const UnsignedInt node = _nodes.size();
+    _nodes.emplace_back();
+
+    /* Bounds of the triangles and of their centroids */
+    Vector3 min{Constants::inf()}, max{-Constants::inf()};
+    Vector3 centroidMin{Constants::inf()}, centroidMax{-Constants::inf()};
+    for(auto it = begin; it != end; ++it) {
+        for(std::size_t i = 0; i != 3; ++i) {
+            const Vector3& position = positions[indices[*it*3 + i]];
+            min = Math::min(min, position);
+            max = Math::max(max, position);
+        }
+        centroidMin = Math::min(centroidMin, centroids[*it]);
+        centroidMax = Math::max(centroidMax, centroids[*it]);
+    }
+    _nodes[node].bounds = {min, max};
+
+    /* Few enough triangles, make a leaf */
+    if(end - begin <= 4) {
+        Packet packet{};
+        for(std::size_t i = 0; i != 4; ++i) packet.ids[i] = -1;
+        for(auto it = begin; it != end; ++it) {
+            const std::size_t lane = it - begin;
+            const Vector3& v0 = positions[indices[*it*3]];
+            const Vector3 edge1 = positions[indices[*it*3 + 1]] - v0;
+            const Vector3 edge2 = positions[indices[*it*3 + 2]] - v0;
+            for(std::size_t i = 0; i != 3; ++i) {
+                packet.v0[i][lane] = v0[i];
+                packet.edge1[i][lane] = edge1[i];
+                packet.edge2[i][lane] = edge2[i];
+            }
+            packet.ids[lane] = *it;
+        }
+
+        _nodes[node].index = _packets.size();
+        _nodes[node].triangleCount = end - begin;
+        _packets.push_back(packet);
+        return node;
+    }
+
+    /* Split the triangles in half along the longest axis of centroid
+       bounds, the left child is built right after this node */
+    const Vector3 size = centroidMax - centroidMin;
+    const std::size_t axis = size.x() >= size.y() && size.x() >= size.z() ? 0 : size.y() >= size.z() ? 1 : 2;
+    const auto middle = begin + (end - begin)/2;
+    std::nth_element(begin, middle, end, [&centroids, axis](UnsignedInt a, UnsignedInt b) {
+        return centroids[a][axis] < centroids[b][axis];
+    });
+
+    buildNode(positions, indices, centroids, begin, middle);
+    const UnsignedInt right = buildNode(positions, indices, centroids, middle, end);
+    _nodes[node].index = right;
+    _nodes[node].triangleCount = 0;
+    return node;
+}
+
+Int TriangleMesh::raycastPacket(const Packet& packet, const Vector3& origin, const Vector3& direction, Float& distance) {
+    /* Möller-Trumbore test of four triangles at once. Unused lanes have zero
+       edges and thus zero determinant. */
+    Float t[4];
+    Int mask;
+    #ifdef MAGNUM_MATH_SSE
+    const __m128 dx = _mm_set1_ps(direction.x());
+    const __m128 dy = _mm_set1_ps(direction.y());
+    const __m128 dz = _mm_set1_ps(direction.z());
+    const __m128 e1x = _mm_loadu_ps(packet.edge1[0]);
+    const __m128 e1y = _mm_loadu_ps(packet.edge1[1]);
+    const __m128 e1z = _mm_loadu_ps(packet.edge1[2]);
+    const __m128 e2x = _mm_loadu_ps(packet.edge2[0]);
+    const __m128 e2y = _mm_loadu_ps(packet.edge2[1]);
+    const __m128 e2z = _mm_loadu_ps(packet.edge2[2]);
+
+    /* p = direction × edge2, determinant = edge1 · p */
+    const __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+    const __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+    const __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+    const __m128 determinant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+    const __m128 inverseDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), determinant);
+
+    /* s = origin - v0, u = (s · p)/determinant */
+    const __m128 sx = _mm_sub_ps(_mm_set1_ps(origin.x()), _mm_loadu_ps(packet.v0[0]));
+    const __m128 sy = _mm_sub_ps(_mm_set1_ps(origin.y()), _mm_loadu_ps(packet.v0[1]));
+    const __m128 sz = _mm_sub_ps(_mm_set1_ps(origin.z()), _mm_loadu_ps(packet.v0[2]));
+    const __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)), inverseDeterminant);
+
+    /* q = s × edge1, v = (direction · q)/determinant,
+       t = (edge2 · q)/determinant */
+    const __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+    const __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+    const __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+    const __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), inverseDeterminant);
+    const __m128 tv = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), inverseDeterminant);
+
+    const __m128 zero = _mm_setzero_ps();
+    __m128 hit = _mm_cmpneq_ps(determinant, zero);
+    hit = _mm_and_ps(hit, _mm_cmpge_ps(u, zero));
+    hit = _mm_and_ps(hit, _mm_cmpge_ps(v, zero));
+    hit = _mm_and_ps(hit, _mm_cmple_ps(_mm_add_ps(u, v), _mm_set1_ps(1.0f)));
+    hit = _mm_and_ps(hit, _mm_cmpge_ps(tv, zero));
+    hit = _mm_and_ps(hit, _mm_cmplt_ps(tv, _mm_set1_ps(distance)));
+    mask = _mm_movemask_ps(hit);
+    _mm_storeu_ps(t, tv);
+    #else
+    mask = 0;
+    for(std::size_t i = 0; i != 4; ++i) {
+        const Vector3 edge1{packet.edge1[0][i], packet.edge1[1][i], packet.edge1[2][i]};
+        const Vector3 edge2{packet.edge2[0][i], packet.edge2[1][i], packet.edge2[2][i]};
+        const Vector3 p = Math::cross(direction, edge2);
+        const Float determinant = Math::dot(edge1, p);
+        if(determinant == 0.0f) continue;
+
+        const Float inverseDeterminant = 1.0f/determinant;
+        const Vector3 s = origin - Vector3{packet.v0[0][i], packet.v0[1][i], packet.v0[2][i]};
+        const Float u = Math::dot(s, p)*inverseDeterminant;
+        const Vector3 q = Math::cross(s, edge1);
+        const Float v = Math::dot(direction, q)*inverseDeterminant;
+        t[i] = Math::dot(edge2, q)*inverseDeterminant;
+        if(u >= 0.0f && v >= 0.0f && u + v <= 1.0f && t[i] >= 0.0f && t[i] < distance)
+            mask |= 1 << i;
+    }
+    #endif
+
+    /* Nearest of the hit triangles */
+    Int lane = -1;
+    for(Int i = 0; i != 4; ++i) if(mask & (1 << i) && t[i] < distance) {
+        distance = t[i];
+        lane = i;
+    }
+
+    return lane;
+}
+
+std::pair<Int, RaycastHit3D> TriangleMesh::raycast(const Vector3& origin, const Vector3& direction, Float maxDistance) const {
+    if(_nodes.empty()) return {-1, {}};
+
+    const Vector3 inverseDirection = Vector3{1.0f}/direction;
+    const Float rootEntry = Implementation::rayEntry<3>(origin, inverseDirection, _nodes.front().bounds, maxDistance);
+    if(rootEntry == Constants::inf()) return {-1, {}};
+
+    /* The tree is balanced, so the depth is logarithmic */
+    std::pair<UnsignedInt, Float> stack[64];
+    std::size_t stackSize = 0;
+    stack[stackSize++] = {0, rootEntry};
+
+    const Packet* hitPacket = nullptr;
+    Int hitLane = -1;
+    while(stackSize) {
+        const std::pair<UnsignedInt, Float> top = stack[--stackSize];
+
+        /* Entered further than the nearest hit found so far */
+        if(top.second > maxDistance) continue;
+
+        const Node& node = _nodes[top.first];
+        if(node.triangleCount) {
+            const Int lane = raycastPacket(_packets[node.index], origin, direction, maxDistance);
+            if(lane != -1) {
+                hitPacket = &_packets[node.index];
+                hitLane = lane;
+            }
+            continue;
+        }
+
+        /* Push the farther child first so the nearer one is processed
+           first */
+        std::pair<UnsignedInt, Float> nearChild{top.first + 1, Implementation::rayEntry<3>(origin, inverseDirection, _nodes[top.first + 1].bounds, maxDistance)};
+        std::pair<UnsignedInt, Float> farChild{node.index, Implementation::rayEntry<3>(origin, inverseDirection, _nodes[node.index].bounds, maxDistance)};
+        if(farChild.second < nearChild.second) std::swap(nearChild, farChild);
+        CORRADE_INTERNAL_ASSERT(stackSize + 2 <= 64);
+        if(farChild.second != Constants::inf()) stack[stackSize++] = farChild;
+        if(nearChild.second != Constants::inf()) stack[stackSize++] = nearChild;
+    }
+
+    if(!hitPacket) return {-1, {}};
+
+    /* Two-sided triangles, the normal faces against the ray */
+    const Vector3 edge1{hitPacket->edge1[0][hitLane], hitPacket->edge1[1][hitLane], hitPacket->edge1[2][hitLane]};
+    const Vector3 edge2{hitPacket->edge2[0][hitLane], hitPacket->edge2[1][hitLane], hitPacket->edge2[2][hitLane]};
+    const Vector3 normal = Math::cross(edge1, edge2).normalized();
+    return {hitPacket->ids[hitLane], RaycastHit3D{maxDistance, Math::dot(normal, direction) > 0.0f ? -normal : normal}};
+}
+
+}}
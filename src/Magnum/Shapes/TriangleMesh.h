@@ -0,0 +1,132 @@
+#ifndef Magnum_Shapes_TriangleMesh_h
+#define Magnum_Shapes_TriangleMesh_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shapes::TriangleMesh
+ */
+
+#include <utility>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Shapes/RaycastHit.h"
+#include "Magnum/Shapes/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace Shapes {
+
+/**
+@brief Triangle mesh with acceleration structure for ray queries
+
+Builds a bounding volume hierarchy over triangles of given mesh, so ray
+queries need to test only a small fraction of the triangles. Useful e.g. for
+picking or line-of-sight checks on detailed geometry, which can't be
+reasonably approximated with simple shapes. The mesh is not a shape and
+can't be added to @ref ShapeGroup.
+
+The hierarchy is built once in the constructor by splitting the triangles
+along the longest axis of their centroid bounds. Each leaf holds up to four
+triangles, which are tested against the ray at once using SSE if the target
+supports it.
+
+The mesh has its own coordinate system. To query a transformed mesh,
+transform the ray origin and direction with inverted transformation, the hit
+distance is then the same as in the original space.
+@see @ref RaycastHit3D
+*/
+class MAGNUM_SHAPES_EXPORT TriangleMesh {
+    public:
+        /**
+         * @brief Construct from mesh data
+         * @param data          Mesh data
+         * @param positionArray Position array to use
+         *
+         * Expects that the mesh is made of triangles. If the mesh is not
+         * indexed, each three consecutive positions form a triangle.
+         */
+        explicit TriangleMesh(const Trade::MeshData3D& data, UnsignedInt positionArray = 0);
+
+        /**
+         * @brief Construct from positions and indices
+         *
+         * Expects that index count is divisible by three.
+         */
+        explicit TriangleMesh(const std::vector<Vector3>& positions, const std::vector<UnsignedInt>& indices);
+
+        /** @brief Triangle count */
+        std::size_t triangleCount() const { return _triangleCount; }
+
+        /** @brief Bounds of the mesh */
+        Range3D bounds() const;
+
+        /**
+         * @brief Raycast the mesh
+         * @param origin        Ray origin
+         * @param direction     Ray direction
+         * @param maxDistance   Maximal hit distance, in units of direction
+         *      length
+         *
+         * Returns ID of the nearest triangle hit by the ray together with
+         * the hit data, or `-1` and empty hit if the ray doesn't hit
+         * anything. The triangles are two-sided, the hit normal is
+         * the triangle normal facing against the ray. See @ref RaycastHit
+         * for more information.
+         */
+        std::pair<Int, RaycastHit3D> raycast(const Vector3& origin, const Vector3& direction, Float maxDistance = Constants::inf()) const;
+
+    private:
+        /* Internal node has the left child right after itself and right
+           child at given index, leaf holds one triangle packet */
+        struct Node {
+            Range3D bounds;
+            UnsignedInt index;
+            UnsignedInt triangleCount; /* zero for internal nodes */
+        };
+
+        /* Up to four triangles in a SoA layout with first vertex and both
+           edges, unused triangles are degenerate and never hit */
+        struct Packet {
+            Float v0[3][4];
+            Float edge1[3][4];
+            Float edge2[3][4];
+            Int ids[4];
+        };
+
+        void MAGNUM_SHAPES_LOCAL build(const std::vector<Vector3>& positions, const std::vector<UnsignedInt>& indices);
+        static Int MAGNUM_SHAPES_LOCAL raycastPacket(const Packet& packet, const Vector3& origin, const Vector3& direction, Float& distance);
+        UnsignedInt MAGNUM_SHAPES_LOCAL buildNode(const std::vector<Vector3>& positions, const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& centroids, std::vector<UnsignedInt>::iterator begin, std::vector<UnsignedInt>::iterator end);
+
+        std::size_t _triangleCount;
+        std::vector<Node> _nodes;
+        std::vector<Packet> _packets;
+};
+
+}}
+
+#endif
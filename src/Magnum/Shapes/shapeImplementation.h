@@ -39,7 +39,8 @@ namespace Magnum { namespace Shapes { namespace Implementation {
     Adding new collision type:
 
     1.  Add the type into the 2D/3D enums below, pick new prime number and
-        preserve complexity ordering
+        preserve complexity ordering, add it to the type index table in
+        Implementation/CollisionDispatch.cpp
     2.  Update debug output operators for changed enums
     3.  Add TypeOf struct specialization (either for both 2D/3D or for only one
         of them)
@@ -48,8 +49,8 @@ namespace Magnum { namespace Shapes { namespace Implementation {
 
     Adding new collision detection implementation:
 
-    1.  Update Implementation/CollisionDispatch.cpp with newly implemented
-        2D/3D pair
+    1.  Register the newly implemented 2D/3D pair in the dispatch table in
+        Implementation/CollisionDispatch.cpp
 */
 
 /* Shape type for given dimension count */
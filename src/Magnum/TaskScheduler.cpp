@@ -0,0 +1,397 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TaskScheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <Corrade/configure.h>
+#include <Corrade/Utility/Assert.h>
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+namespace Magnum {
+
+namespace Implementation {
+
+struct TaskData {
+    explicit TaskData(TaskScheduler::State& scheduler, std::function<void()>&& function, const TaskAffinity affinity): scheduler(scheduler), function{std::move(function)}, affinity{affinity}, dependencies{1}, done{false} {}
+
+    TaskScheduler::State& scheduler;
+    std::function<void()> function;
+    TaskAffinity affinity;
+
+    /* Count of unfinished dependencies, plus one until the submission is
+       done */
+    std::atomic<UnsignedInt> dependencies;
+    std::atomic<bool> done;
+
+    /* Guards the continuations and the transition to done */
+    std::mutex mutex;
+    std::vector<std::shared_ptr<TaskData>> continuations;
+};
+
+}
+
+namespace {
+
+typedef std::shared_ptr<Implementation::TaskData> TaskPointer;
+
+struct Queue {
+    std::mutex mutex;
+    std::deque<TaskPointer> tasks;
+};
+
+#ifdef MAGNUM_BUILD_MULTITHREADED
+/* Scheduler and queue index of the current worker thread, so tasks submitted
+   from inside a task go to the queue of the worker */
+thread_local const void* currentScheduler = nullptr;
+thread_local std::size_t currentWorkerIndex = 0;
+#endif
+
+UnsignedInt resolveThreadCount(const UnsignedInt count) {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    return count ? count : std::max(std::thread::hardware_concurrency(), 1u);
+    #else
+    static_cast<void>(count);
+    return 1;
+    #endif
+}
+
+}
+
+struct TaskScheduler::State {
+    std::size_t currentWorker() const;
+    void schedule(TaskPointer task);
+    TaskPointer find(std::size_t worker, bool mainThread);
+    void execute(TaskPointer& task);
+    void startWorkers(UnsignedInt count);
+    void stopWorkers();
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void work(std::size_t worker);
+    #endif
+
+    /* First queue is for tasks submitted from other than worker threads, the
+       rest is one queue per worker */
+    std::vector<std::unique_ptr<Queue>> queues;
+    Queue mainThreadQueue;
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::vector<std::thread> workers;
+    std::thread::id mainThread;
+    #endif
+
+    /* Sleeping workers and waiters wait for changes of these, they are
+       incremented under the mutex */
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::atomic<std::size_t> queued{0}, mainThreadQueued{0};
+    std::size_t sleepingWaiters{};
+    bool stop{};
+};
+
+std::size_t TaskScheduler::State::currentWorker() const {
+    /* Without thread-local storage all tasks go through the shared queue */
+    #ifdef MAGNUM_BUILD_MULTITHREADED
+    return currentScheduler == this ? currentWorkerIndex : 0;
+    #else
+    return 0;
+    #endif
+}
+
+void TaskScheduler::State::schedule(TaskPointer task) {
+    const bool mainThread = task->affinity == TaskAffinity::MainThread;
+    Queue& queue = mainThread ? mainThreadQueue : *queues[currentWorker()];
+    {
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        queue.tasks.push_back(std::move(task));
+    }
+
+    bool notifyAll;
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        ++(mainThread ? mainThreadQueued : queued);
+        notifyAll = mainThread || sleepingWaiters;
+    }
+    if(notifyAll) wake.notify_all();
+    else wake.notify_one();
+}
+
+TaskPointer TaskScheduler::State::find(const std::size_t worker, const bool mainThread) {
+    auto pop = [](Queue& queue, std::atomic<std::size_t>& counter, const bool back) {
+        TaskPointer task;
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if(!queue.tasks.empty()) {
+            if(back) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+            } else {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            --counter;
+        }
+        return task;
+    };
+
+    /* Main thread tasks have priority, as nobody else can execute them */
+    if(mainThread && mainThreadQueued)
+        if(TaskPointer task = pop(mainThreadQueue, mainThreadQueued, false)) return task;
+
+    if(!queued) return nullptr;
+
+    /* Newest task from own queue, as its data are most probably still in
+       cache */
+    if(worker)
+        if(TaskPointer task = pop(*queues[worker], queued, true)) return task;
+
+    /* Oldest task from the shared queue and then from other workers */
+    for(std::size_t i = 0; i != queues.size(); ++i) {
+        const std::size_t victim = (worker + i)%queues.size();
+        if(victim == worker && worker) continue;
+        if(TaskPointer task = pop(*queues[victim], queued, false)) return task;
+    }
+
+    return nullptr;
+}
+
+void TaskScheduler::State::execute(TaskPointer& task) {
+    task->function();
+    task->function = nullptr;
+
+    std::vector<TaskPointer> continuations;
+    {
+        std::lock_guard<std::mutex> lock{task->mutex};
+        task->done = true;
+        std::swap(continuations, task->continuations);
+    }
+
+    for(TaskPointer& continuation: continuations)
+        if(--continuation->dependencies == 0)
+            continuation->scheduler.schedule(std::move(continuation));
+
+    std::lock_guard<std::mutex> lock{mutex};
+    if(sleepingWaiters) wake.notify_all();
+}
+
+void TaskScheduler::State::startWorkers(const UnsignedInt count) {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    for(UnsignedInt i = 1; i < count; ++i)
+        queues.emplace_back(new Queue);
+    workers.reserve(count - 1);
+    for(UnsignedInt i = 1; i < count; ++i)
+        workers.emplace_back(&State::work, this, i);
+    #else
+    static_cast<void>(count);
+    #endif
+}
+
+void TaskScheduler::State::stopWorkers() {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    /* The workers finish all scheduled tasks before exiting */
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        stop = true;
+    }
+    wake.notify_all();
+    for(std::thread& worker: workers) worker.join();
+    workers.clear();
+    stop = false;
+
+    /* Execute whatever was scheduled while the last workers were exiting */
+    while(TaskPointer task = find(0, false)) execute(task);
+    queues.resize(1);
+    #endif
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void TaskScheduler::State::work(const std::size_t worker) {
+    #ifdef MAGNUM_BUILD_MULTITHREADED
+    currentScheduler = this;
+    currentWorkerIndex = worker;
+    #endif
+
+    for(;;) {
+        if(TaskPointer task = find(worker, false)) {
+            execute(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{mutex};
+        if(stop) return;
+        wake.wait(lock, [this]() { return stop || queued; });
+    }
+}
+#endif
+
+Task::Task() noexcept = default;
+
+bool Task::isDone() const { return !_data || _data->done; }
+
+namespace {
+    TaskScheduler* globalScheduler = nullptr;
+}
+
+TaskScheduler& TaskScheduler::global() {
+    if(globalScheduler) return *globalScheduler;
+
+    static TaskScheduler builtin{1};
+    return builtin;
+}
+
+void TaskScheduler::setGlobal(TaskScheduler* const scheduler) {
+    globalScheduler = scheduler;
+}
+
+TaskScheduler::TaskScheduler(const UnsignedInt threadCount): _state{new State} {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    _state->mainThread = std::this_thread::get_id();
+    #endif
+    _state->queues.emplace_back(new Queue);
+    _state->startWorkers(resolveThreadCount(threadCount));
+}
+
+TaskScheduler::~TaskScheduler() {
+    _state->stopWorkers();
+    while(TaskPointer task = _state->find(0, true)) _state->execute(task);
+}
+
+UnsignedInt TaskScheduler::threadCount() const {
+    return _state->queues.size();
+}
+
+void TaskScheduler::setThreadCount(const UnsignedInt count) {
+    _state->stopWorkers();
+    _state->startWorkers(resolveThreadCount(count));
+}
+
+bool TaskScheduler::isMainThread() const {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    return std::this_thread::get_id() == _state->mainThread;
+    #else
+    return true;
+    #endif
+}
+
+Task TaskScheduler::submit(std::function<void()> function, const std::vector<Task>& dependencies, const TaskAffinity affinity) {
+    CORRADE_ASSERT(function, "TaskScheduler::submit(): the function is empty", Task{});
+
+    Task task;
+    task._data = std::make_shared<Implementation::TaskData>(*_state, std::move(function), affinity);
+    for(const Task& dependency: dependencies) {
+        if(!dependency._data) continue;
+
+        std::lock_guard<std::mutex> lock{dependency._data->mutex};
+        if(dependency._data->done) continue;
+        ++task._data->dependencies;
+        dependency._data->continuations.push_back(task._data);
+    }
+
+    if(--task._data->dependencies == 0) _state->schedule(task._data);
+    return task;
+}
+
+void TaskScheduler::wait(const Task& task) {
+    if(!task._data) return;
+    CORRADE_ASSERT(&task._data->scheduler == _state.get(),
+        "TaskScheduler::wait(): the task was submitted to another scheduler", );
+
+    State& state = *_state;
+    const std::size_t worker = state.currentWorker();
+    const bool mainThread = isMainThread();
+    const Implementation::TaskData& data = *task._data;
+
+    while(!data.done) {
+        if(TaskPointer other = state.find(worker, mainThread)) {
+            state.execute(other);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{state.mutex};
+        ++state.sleepingWaiters;
+        state.wake.wait(lock, [&]() {
+            return data.done || state.queued || (mainThread && state.mainThreadQueued);
+        });
+        --state.sleepingWaiters;
+    }
+}
+
+void TaskScheduler::parallelFor(const std::size_t count, std::size_t grainSize, const std::function<void(std::size_t, std::size_t)>& function) {
+    if(!grainSize) grainSize = 1;
+
+    /* Not worth waking up the workers */
+    const std::size_t chunkCount = (count + grainSize - 1)/grainSize;
+    if(_state->queues.size() == 1 || chunkCount <= 1) {
+        function(0, count);
+        return;
+    }
+
+    /* Each thread grabs next chunk until there's nothing left, so threads
+       which finished early take over the rest of the work */
+    std::atomic<std::size_t> next{0};
+    auto process = [&]() {
+        for(;;) {
+            const std::size_t begin = next.fetch_add(grainSize);
+            if(begin >= count) return;
+            function(begin, std::min(begin + grainSize, count));
+        }
+    };
+
+    /* At most one helper per worker, the calling thread participates too.
+       The helpers which didn't get to any chunk finish immediately. */
+    std::vector<Task> helpers;
+    const std::size_t helperCount = std::min<std::size_t>(_state->queues.size() - 1, chunkCount - 1);
+    helpers.reserve(helperCount);
+    for(std::size_t i = 0; i != helperCount; ++i)
+        helpers.push_back(submit(process));
+
+    process();
+    for(const Task& helper: helpers) wait(helper);
+}
+
+std::size_t TaskScheduler::runMainThreadTasks() {
+    CORRADE_ASSERT(isMainThread(), "TaskScheduler::runMainThreadTasks(): not called from the main thread", 0);
+
+    std::size_t count = 0;
+    while(_state->mainThreadQueued) {
+        TaskPointer task;
+        {
+            std::lock_guard<std::mutex> lock{_state->mainThreadQueue.mutex};
+            if(_state->mainThreadQueue.tasks.empty()) break;
+            task = std::move(_state->mainThreadQueue.tasks.front());
+            _state->mainThreadQueue.tasks.pop_front();
+            --_state->mainThreadQueued;
+        }
+        _state->execute(task);
+        ++count;
+    }
+    return count;
+}
+
+}
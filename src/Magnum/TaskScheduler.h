@@ -0,0 +1,278 @@
+#ifndef Magnum_TaskScheduler_h
+#define Magnum_TaskScheduler_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::TaskScheduler, @ref Magnum::Task, enum @ref Magnum::TaskAffinity
+ */
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+namespace Implementation { struct TaskData; }
+
+/**
+@brief Task affinity
+
+@see @ref TaskScheduler::submit()
+*/
+enum class TaskAffinity: UnsignedByte {
+    /** The task can be executed on any thread */
+    Any,
+
+    /**
+     * The task is executed only on the main thread, either from
+     * @ref TaskScheduler::runMainThreadTasks() or while the main thread waits
+     * in @ref TaskScheduler::wait(). Useful for work that needs the OpenGL
+     * context, such as uploading data prepared by other tasks.
+     */
+    MainThread
+};
+
+/**
+@brief Task handle
+
+Returned from @ref TaskScheduler::submit(), can be used to wait for the task
+or as a dependency of other tasks. Copies refer to the same task. Default
+constructed instance doesn't refer to any task and is treated as already
+finished.
+*/
+class MAGNUM_EXPORT Task {
+    friend TaskScheduler;
+
+    public:
+        /** @brief Constructor */
+        explicit Task() noexcept;
+
+        /**
+         * @brief Whether the task is finished
+         *
+         * Returns `true` also for default-constructed instance.
+         */
+        bool isDone() const;
+
+    private:
+        std::shared_ptr<Implementation::TaskData> _data;
+};
+
+/**
+@brief Task scheduler
+
+Thread pool shared by all subsystems that need to run work in parallel, so
+each of them doesn't spawn its own set of threads. Each worker thread has its
+own task queue, tasks submitted from a worker are put to its own queue and
+processed in LIFO order for better cache locality, idle workers steal the
+oldest tasks from queues of other workers. Tasks submitted from other threads
+go to a shared queue. Remembering the worker of the calling thread needs
+thread-local storage, so if Magnum is built without `BUILD_MULTITHREADED`,
+also tasks submitted from workers go to the shared queue.
+
+## Basic usage
+
+Submit a function using @ref submit(), optionally with a list of tasks that
+need to finish before it's executed. The returned @ref Task handle can be used
+to wait for the function to finish. Threads waiting in @ref wait() are not
+blocked, but execute other scheduled tasks in the meantime, so it's possible
+to wait also from inside a task.
+@code
+TaskScheduler& scheduler = TaskScheduler::global();
+
+Task load = scheduler.submit([&]() { image = importer.image2D(0); });
+Task process = scheduler.submit([&]() { generateMipmaps(*image); }, {load});
+Task upload = scheduler.submit([&]() {
+    texture.setSubImage(0, {}, *image);
+}, {process}, TaskAffinity::MainThread);
+
+// ...
+
+scheduler.wait(upload);
+@endcode
+
+For data-parallel loops there's @ref parallelFor(), which splits the range
+into grain-sized chunks and hands them out to the calling thread and the
+workers dynamically.
+
+## Main thread tasks
+
+Tasks with @ref TaskAffinity::MainThread are executed only on the thread that
+created the scheduler, either during a call to @ref runMainThreadTasks() (for
+example once per frame in the draw event) or while that thread waits for some
+task in @ref wait(). Waiting for such task from a different thread while the
+main thread isn't processing them results in a deadlock.
+
+## Global instance
+
+Magnum subsystems such as @ref SceneGraph, @ref Shapes or @ref MeshTools use
+the instance returned by @ref global(). By default it has no worker threads,
+size it with @ref setThreadCount() on application startup or replace it with
+a custom instance using @ref setGlobal().
+
+On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" no threads are created and
+everything is executed on the calling thread.
+*/
+class MAGNUM_EXPORT TaskScheduler {
+    friend Implementation::TaskData;
+
+    public:
+        /**
+         * @brief Global instance
+         *
+         * If no instance was set using @ref setGlobal(), returns a built-in
+         * instance, lazily created with thread count `1`. The main thread of
+         * the built-in instance is the thread that first called this
+         * function.
+         */
+        static TaskScheduler& global();
+
+        /**
+         * @brief Set global instance
+         *
+         * The instance is expected to be alive for as long as it's used.
+         * Passing `nullptr` restores the built-in instance. Not allowed to
+         * be called while there are tasks running on the previous global
+         * instance.
+         */
+        static void setGlobal(TaskScheduler* scheduler);
+
+        /**
+         * @brief Constructor
+         * @param threadCount   Thread count including the calling thread. If
+         *      `0`, the count of hardware threads is used.
+         *
+         * The calling thread becomes the main thread of the scheduler.
+         */
+        explicit TaskScheduler(UnsignedInt threadCount = 0);
+
+        /** @brief Copying is not allowed */
+        TaskScheduler(const TaskScheduler&) = delete;
+
+        /** @brief Moving is not allowed */
+        TaskScheduler(TaskScheduler&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Lets the workers finish all scheduled tasks, joins them and then
+         * executes remaining main thread tasks on the calling thread. Tasks
+         * with unfinished dependencies on tasks from other schedulers are
+         * never executed.
+         */
+        ~TaskScheduler();
+
+        /** @brief Copying is not allowed */
+        TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+        /** @brief Moving is not allowed */
+        TaskScheduler& operator=(TaskScheduler&&) = delete;
+
+        /** @brief Thread count including the main thread */
+        UnsignedInt threadCount() const;
+
+        /**
+         * @brief Set thread count
+         *
+         * If @p count is `0`, the count of hardware threads is used. The
+         * existing workers finish all scheduled tasks first. Not allowed to
+         * be called while other threads are submitting or waiting for tasks.
+         */
+        void setThreadCount(UnsignedInt count);
+
+        /** @brief Whether the calling thread is the main thread */
+        bool isMainThread() const;
+
+        /**
+         * @brief Submit a task
+         * @param function      Function to execute
+         * @param dependencies  Tasks that need to finish before the
+         *      function is executed
+         * @param affinity      Task affinity
+         *
+         * The function is scheduled right away if all dependencies are
+         * already finished, otherwise after the last of them finishes. The
+         * dependencies can be from other schedulers, the task is always
+         * executed by this one.
+         */
+        Task submit(std::function<void()> function, const std::vector<Task>& dependencies, TaskAffinity affinity = TaskAffinity::Any);
+
+        /** @overload */
+        Task submit(std::function<void()> function, std::initializer_list<Task> dependencies, TaskAffinity affinity = TaskAffinity::Any) {
+            return submit(std::move(function), std::vector<Task>{dependencies}, affinity);
+        }
+
+        /** @overload */
+        Task submit(std::function<void()> function, TaskAffinity affinity = TaskAffinity::Any) {
+            return submit(std::move(function), std::vector<Task>{}, affinity);
+        }
+
+        /**
+         * @brief Wait for a task to finish
+         *
+         * Executes other scheduled tasks while waiting, on the main thread
+         * including the tasks with @ref TaskAffinity::MainThread. Expects
+         * that the task was submitted to this scheduler.
+         */
+        void wait(const Task& task);
+
+        /**
+         * @brief Execute a loop in parallel
+         *
+         * Calls `function(begin, end)` on disjoint contiguous ranges of at
+         * most @p grainSize items covering @f$ [0, count) @f$, returns after
+         * all of them are processed. The ranges are handed out to the
+         * calling thread and the workers dynamically, so unevenly expensive
+         * ranges don't stall the loop. If there are no workers or the count
+         * is not larger than @p grainSize, the function is called just once
+         * on the calling thread. Can be called from inside other tasks or
+         * other parallel loops.
+         */
+        void parallelFor(std::size_t count, std::size_t grainSize, const std::function<void(std::size_t, std::size_t)>& function);
+
+        /**
+         * @brief Execute scheduled main thread tasks
+         * @return Count of executed tasks
+         *
+         * Expects to be called from the main thread.
+         * @see @ref isMainThread()
+         */
+        std::size_t runMainThreadTasks();
+
+    private:
+        struct State;
+
+        std::unique_ptr<State> _state;
+};
+
+}
+
+#endif
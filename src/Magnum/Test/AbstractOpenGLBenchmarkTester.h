@@ -0,0 +1,93 @@
+#ifndef Magnum_Test_AbstractOpenGLBenchmarkTester_h
+#define Magnum_Test_AbstractOpenGLBenchmarkTester_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Renderer.h"
+#include "Magnum/TimeQuery.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+/*
+GL counterpart to BenchmarkTester. Each benchmark() call runs given function
+the specified number of times and prints average CPU time spent submitting
+one operation and, if timer queries are available, also average GPU time
+per operation. The CPU time doesn't include waiting for the GPU, so the two
+numbers together show whether given code path is driver- or GPU-bound.
+*/
+class AbstractOpenGLBenchmarkTester: public AbstractOpenGLTester {
+    public:
+        explicit AbstractOpenGLBenchmarkTester();
+
+    protected:
+        /*
+        Runs @p function once to warm up the driver and then @p repeats more
+        times. @p operationCount is the number of operations done in one
+        @p function call, used to calculate per-operation values. The GPU is
+        drained before the measurement starts, so work from the previous
+        benchmarks doesn't affect the results.
+        */
+        template<class F> void benchmark(const char* name, std::size_t operationCount, std::size_t repeats, F function);
+
+    private:
+        bool _timerQuerySupported;
+};
+
+inline AbstractOpenGLBenchmarkTester::AbstractOpenGLBenchmarkTester(): _timerQuerySupported{
+    #ifndef MAGNUM_TARGET_GLES
+    Context::current()->isExtensionSupported<Extensions::GL::ARB::timer_query>()
+    #else
+    Context::current()->isExtensionSupported<Extensions::GL::EXT::disjoint_timer_query>()
+    #endif
+    } {}
+
+template<class F> void AbstractOpenGLBenchmarkTester::benchmark(const char* const name, const std::size_t operationCount, const std::size_t repeats, F function) {
+    function();
+    Renderer::finish();
+
+    TimeQuery query{TimeQuery::Target::TimeElapsed};
+    if(_timerQuerySupported) query.begin();
+
+    const auto begin = std::chrono::high_resolution_clock::now();
+    for(std::size_t repeat = 0; repeat != repeats; ++repeat) function();
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    const double count = double(operationCount*repeats);
+    Corrade::Utility::Debug d;
+    d << name << std::chrono::duration<double, std::nano>(end - begin).count()/count << "ns/op CPU";
+
+    if(_timerQuerySupported) {
+        query.end();
+        d << query.result<UnsignedLong>()/count << "ns/op GPU";
+    }
+}
+
+}}
+
+#endif
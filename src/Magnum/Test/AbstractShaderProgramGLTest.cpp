@@ -27,13 +27,17 @@
 #include <Corrade/Utility/Resource.h>
 
 #include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Buffer.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
+#include "Magnum/Renderer.h"
 #include "Magnum/Shader.h"
 #include "Magnum/Math/Matrix.h"
 #include "Magnum/Math/Vector4.h"
 #include "Magnum/Test/AbstractOpenGLTester.h"
 
+#include "configure.h"
+
 namespace Magnum { namespace Test {
 
 struct AbstractShaderProgramGLTest: AbstractOpenGLTester {
@@ -47,15 +51,24 @@ struct AbstractShaderProgramGLTest: AbstractOpenGLTester {
 
     void create();
     void createMultipleOutputs();
+    void createAsync();
     #ifndef MAGNUM_TARGET_GLES
     void createMultipleOutputsIndexed();
     #endif
+    #ifndef MAGNUM_TARGET_GLES2
+    void binaryCache();
+    #endif
 
     void uniformLocationOptimizedOut();
     void uniform();
     void uniformVector();
     void uniformMatrix();
     void uniformArray();
+    void uniformCache();
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+    void compute();
+    #endif
 };
 
 AbstractShaderProgramGLTest::AbstractShaderProgramGLTest() {
@@ -67,15 +80,25 @@ AbstractShaderProgramGLTest::AbstractShaderProgramGLTest() {
 
               &AbstractShaderProgramGLTest::create,
               &AbstractShaderProgramGLTest::createMultipleOutputs,
+              &AbstractShaderProgramGLTest::createAsync,
               #ifndef MAGNUM_TARGET_GLES
               &AbstractShaderProgramGLTest::createMultipleOutputsIndexed,
               #endif
+              #ifndef MAGNUM_TARGET_GLES2
+              &AbstractShaderProgramGLTest::binaryCache,
+              #endif
 
               &AbstractShaderProgramGLTest::uniformLocationOptimizedOut,
               &AbstractShaderProgramGLTest::uniform,
               &AbstractShaderProgramGLTest::uniformVector,
               &AbstractShaderProgramGLTest::uniformMatrix,
-              &AbstractShaderProgramGLTest::uniformArray});
+              &AbstractShaderProgramGLTest::uniformArray,
+              &AbstractShaderProgramGLTest::uniformCache,
+
+              #if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+              &AbstractShaderProgramGLTest::compute
+              #endif
+              });
 }
 
 namespace {
@@ -147,6 +170,8 @@ namespace {
         using AbstractShaderProgram::bindFragmentDataLocation;
         #endif
         using AbstractShaderProgram::link;
+        using AbstractShaderProgram::submitLink;
+        using AbstractShaderProgram::checkLink;
         using AbstractShaderProgram::uniformLocation;
     };
 }
@@ -199,6 +224,84 @@ void AbstractShaderProgramGLTest::create() {
     CORRADE_VERIFY(additionsUniform >= 0);
 }
 
+#ifndef MAGNUM_TARGET_GLES2
+void AbstractShaderProgramGLTest::binaryCache() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::get_program_binary>())
+        CORRADE_SKIP(Extensions::GL::ARB::get_program_binary::string() + std::string(" is not supported."));
+    #endif
+
+    if(!AbstractShaderProgram::setBinaryCacheDirectory(ABSTRACTSHADERPROGRAMGLTEST_CACHE_DIR))
+        CORRADE_SKIP("No program binary formats are supported.");
+
+    CORRADE_COMPARE(AbstractShaderProgram::binaryCacheDirectory(), ABSTRACTSHADERPROGRAMGLTEST_CACHE_DIR);
+
+    Utility::Resource rs("AbstractShaderProgramGLTest");
+
+    /* First iteration links the program and saves it to the cache (unless
+       it's already there from previous run), second loads it */
+    for(std::size_t i = 0; i != 2; ++i) {
+        #ifndef MAGNUM_TARGET_GLES
+        Shader vert(Version::GL210, Shader::Type::Vertex);
+        Shader frag(Version::GL210, Shader::Type::Fragment);
+        #else
+        Shader vert(Version::GLES200, Shader::Type::Vertex);
+        Shader frag(Version::GLES200, Shader::Type::Fragment);
+        #endif
+        vert.addSource(rs.get("MyShader.vert"));
+        frag.addSource(rs.get("MyShader.frag"));
+        CORRADE_VERIFY(Shader::compile({vert, frag}));
+
+        MyPublicShader program;
+        program.attachShaders({vert, frag});
+        program.bindAttributeLocation(0, "position");
+        const bool linked = program.link();
+        const bool valid = program.validate().first;
+
+        MAGNUM_VERIFY_NO_ERROR();
+        CORRADE_VERIFY(linked);
+        CORRADE_VERIFY(valid);
+        CORRADE_VERIFY(program.uniformLocation("matrix") >= 0);
+        CORRADE_VERIFY(program.uniformLocation("color") >= 0);
+    }
+
+    CORRADE_VERIFY(AbstractShaderProgram::setBinaryCacheDirectory({}));
+    CORRADE_COMPARE(AbstractShaderProgram::binaryCacheDirectory(), "");
+}
+#endif
+
+void AbstractShaderProgramGLTest::createAsync() {
+    Utility::Resource rs("AbstractShaderProgramGLTest");
+
+    #ifndef MAGNUM_TARGET_GLES
+    Shader vert(Version::GL210, Shader::Type::Vertex);
+    Shader frag(Version::GL210, Shader::Type::Fragment);
+    #else
+    Shader vert(Version::GLES200, Shader::Type::Vertex);
+    Shader frag(Version::GLES200, Shader::Type::Fragment);
+    #endif
+    vert.addSource(rs.get("MyShader.vert"));
+    frag.addSource(rs.get("MyShader.frag"));
+    Shader::submitCompile({vert, frag});
+
+    MyPublicShader program;
+    program.attachShaders({vert, frag});
+    program.bindAttributeLocation(0, "position");
+    program.submitLink();
+
+    /* Without KHR_parallel_shader_compile this is always true, otherwise
+       the linking eventually finishes */
+    while(!program.isLinkFinished()) {}
+
+    const bool compiled = Shader::checkCompile({vert, frag});
+    const bool linked = program.checkLink();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(compiled);
+    CORRADE_VERIFY(linked);
+    CORRADE_VERIFY(program.uniformLocation("matrix") >= 0);
+}
+
 void AbstractShaderProgramGLTest::createMultipleOutputs() {
     #ifndef MAGNUM_TARGET_GLES
     Utility::Resource rs("AbstractShaderProgramGLTest");
@@ -299,6 +402,7 @@ namespace {
     struct MyShader: AbstractShaderProgram {
         explicit MyShader();
 
+        using AbstractShaderProgram::link;
         using AbstractShaderProgram::setUniform;
 
         Int matrixUniform,
@@ -381,6 +485,104 @@ void AbstractShaderProgramGLTest::uniformArray() {
     MAGNUM_VERIFY_NO_ERROR();
 }
 
+void AbstractShaderProgramGLTest::uniformCache() {
+    MyShader shader;
+    CORRADE_VERIFY(!shader.isUniformCacheEnabled());
+
+    shader.setUniformCacheEnabled(true);
+    CORRADE_VERIFY(shader.isUniformCacheEnabled());
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    const Matrix4x4 matrix = Matrix4x4::fromDiagonal({0.3f, 0.7f, 1.0f, 0.25f});
+    shader.setUniform(shader.matrixUniform, matrix);
+    shader.setUniform(shader.multiplierUniform, 0.35f);
+
+    /* Setting the same values again is elided, including the implicit
+       glUseProgram() */
+    UnsignedLong elided = Context::current()->elidedStateChangeCount();
+    shader.setUniform(shader.matrixUniform, matrix);
+    shader.setUniform(shader.multiplierUniform, 0.35f);
+    CORRADE_COMPARE(Context::current()->elidedStateChangeCount(), elided + 2);
+
+    /* Changed value is uploaded and cached */
+    shader.setUniform(shader.multiplierUniform, 0.5f);
+    elided = Context::current()->elidedStateChangeCount();
+    shader.setUniform(shader.multiplierUniform, 0.5f);
+    CORRADE_COMPARE(Context::current()->elidedStateChangeCount(), elided + 1);
+
+    /* Relinking resets the uniforms and thus also the cache */
+    CORRADE_VERIFY(shader.link());
+    shader.setUniform(shader.multiplierUniform, 0.5f);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+#if !defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_WEBGL)
+namespace {
+    struct DoublingShader: AbstractShaderProgram {
+        explicit DoublingShader();
+    };
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+DoublingShader::DoublingShader() {
+    #ifndef MAGNUM_TARGET_GLES
+    Shader compute(Version::GL430, Shader::Type::Compute);
+    #else
+    Shader compute(Version::GLES310, Shader::Type::Compute);
+    #endif
+    compute.addSource(
+        "layout(local_size_x = 4) in;\n"
+        "layout(std430, binding = 0) buffer Data {\n"
+        "    int values[];\n"
+        "};\n"
+        "void main() {\n"
+        "    values[gl_GlobalInvocationID.x] *= 2;\n"
+        "}\n");
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(compute.compile());
+
+    attachShader(compute);
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+}
+#endif
+
+void AbstractShaderProgramGLTest::compute() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::compute_shader>())
+        CORRADE_SKIP(Extensions::GL::ARB::compute_shader::string() + std::string(" is not supported."));
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::shader_storage_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::shader_storage_buffer_object::string() + std::string(" is not supported."));
+    #else
+    if(!Context::current()->isVersionSupported(Version::GLES310))
+        CORRADE_SKIP("OpenGL ES 3.1 is not supported.");
+    #endif
+
+    CORRADE_VERIFY((AbstractShaderProgram::maxComputeWorkGroupCount() >= Vector3i{65535}).all());
+    CORRADE_VERIFY((AbstractShaderProgram::maxComputeWorkGroupSize() >= Vector3i{128, 128, 64}).all());
+
+    DoublingShader shader;
+
+    constexpr Int data[]{1, 2, 3, 4, 5, 6, 7, 8};
+    Buffer buffer;
+    buffer.setData(data, BufferUsage::DynamicCopy);
+    buffer.bind(Buffer::Target::ShaderStorage, 0);
+
+    shader.dispatchCompute({2, 1, 1});
+    Renderer::setMemoryBarrier(Renderer::MemoryBarrier::BufferUpdate);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    const Int* result = static_cast<const Int*>(buffer.map(0, sizeof(data), Buffer::MapFlag::Read));
+    CORRADE_VERIFY(result);
+    CORRADE_COMPARE(result[0], 2);
+    CORRADE_COMPARE(result[3], 8);
+    CORRADE_COMPARE(result[7], 16);
+    CORRADE_VERIFY(buffer.unmap());
+}
+#endif
+
 }}
 
 CORRADE_TEST_MAIN(Magnum::Test::AbstractShaderProgramGLTest)
@@ -0,0 +1,122 @@
+#ifndef Magnum_Test_BenchmarkTester_h
+#define Magnum_Test_BenchmarkTester_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Debug.h>
+
+#if defined(__linux__) && !defined(CORRADE_TARGET_ANDROID)
+#include <cstring>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#define MAGNUM_BENCHMARK_CACHE_MISSES
+#endif
+
+namespace Magnum { namespace Test {
+
+/*
+Tester with a minimal benchmark facility. Each benchmark() call runs given
+function the specified number of times and prints average time per operation
+and, where the platform allows it (Linux with perf events available to the
+current user), also average count of last-level cache misses per operation.
+*/
+class BenchmarkTester: public Corrade::TestSuite::Tester {
+    public:
+        explicit BenchmarkTester();
+        ~BenchmarkTester();
+
+    protected:
+        /*
+        Runs @p function once to warm up the caches and then @p repeats more
+        times. @p operationCount is the number of operations done in one
+        @p function call, used to calculate per-operation values.
+        */
+        template<class F> void benchmark(const char* name, std::size_t operationCount, std::size_t repeats, F function);
+
+    private:
+        #ifdef MAGNUM_BENCHMARK_CACHE_MISSES
+        int _cacheMisses;
+        #endif
+};
+
+#ifdef MAGNUM_BENCHMARK_CACHE_MISSES
+inline BenchmarkTester::BenchmarkTester() {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(perf_event_attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(perf_event_attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    /* Fails if perf events are not available (e.g. in virtual machines) or
+       not allowed, cache misses are then not reported */
+    _cacheMisses = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+inline BenchmarkTester::~BenchmarkTester() {
+    if(_cacheMisses != -1) close(_cacheMisses);
+}
+#else
+inline BenchmarkTester::BenchmarkTester() = default;
+inline BenchmarkTester::~BenchmarkTester() = default;
+#endif
+
+template<class F> void BenchmarkTester::benchmark(const char* const name, const std::size_t operationCount, const std::size_t repeats, F function) {
+    function();
+
+    #ifdef MAGNUM_BENCHMARK_CACHE_MISSES
+    if(_cacheMisses != -1) {
+        ioctl(_cacheMisses, PERF_EVENT_IOC_RESET, 0);
+        ioctl(_cacheMisses, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    #endif
+
+    const auto begin = std::chrono::high_resolution_clock::now();
+    for(std::size_t repeat = 0; repeat != repeats; ++repeat) function();
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    const double count = double(operationCount*repeats);
+    Corrade::Utility::Debug d;
+    d << name << std::chrono::duration<double, std::nano>(end - begin).count()/count << "ns/op";
+
+    #ifdef MAGNUM_BENCHMARK_CACHE_MISSES
+    long long cacheMisses;
+    if(_cacheMisses != -1) {
+        ioctl(_cacheMisses, PERF_EVENT_IOC_DISABLE, 0);
+        if(read(_cacheMisses, &cacheMisses, sizeof(long long)) == sizeof(long long))
+            d << cacheMisses/count << "cache misses/op";
+    }
+    #endif
+}
+
+}}
+
+#endif
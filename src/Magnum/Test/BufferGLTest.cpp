@@ -49,6 +49,9 @@ struct BufferGLTest: AbstractOpenGLTester {
     #endif
 
     void data();
+    #ifndef MAGNUM_TARGET_GLES
+    void storage();
+    #endif
     void map();
     #ifdef MAGNUM_TARGET_GLES2
     void mapSub();
@@ -74,6 +77,9 @@ BufferGLTest::BufferGLTest() {
               #endif
 
               &BufferGLTest::data,
+              #ifndef MAGNUM_TARGET_GLES
+              &BufferGLTest::storage,
+              #endif
               &BufferGLTest::map,
               #ifdef MAGNUM_TARGET_GLES2
               &BufferGLTest::mapSub,
@@ -254,6 +260,26 @@ void BufferGLTest::data() {
     #endif
 }
 
+#ifndef MAGNUM_TARGET_GLES
+void BufferGLTest::storage() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::buffer_storage>())
+        CORRADE_SKIP(Extensions::GL::ARB::buffer_storage::string() + std::string{" is not supported."});
+
+    Buffer buffer;
+    constexpr Int data[] = {2, 7, 5, 13, 25};
+    buffer.setStorage({data, 5}, Buffer::StorageFlag::MapRead|Buffer::StorageFlag::MapPersistent);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(buffer.size(), 5*4);
+
+    const Int* contents = static_cast<const Int*>(buffer.map(0, 5*4, Buffer::MapFlag::Read|Buffer::MapFlag::Persistent));
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(contents);
+    CORRADE_COMPARE(contents[2], 5);
+    CORRADE_VERIFY(buffer.unmap());
+}
+#endif
+
 void BufferGLTest::map() {
     #ifdef MAGNUM_TARGET_GLES
     if(!Context::current()->isExtensionSupported<Extensions::GL::OES::mapbuffer>())
@@ -35,18 +35,22 @@ struct BufferImageGLTest: AbstractOpenGLTester {
     explicit BufferImageGLTest();
 
     void construct();
+    void constructBuffer();
     void constructCopy();
     void constructMove();
 
     void setData();
+    void release();
 };
 
 BufferImageGLTest::BufferImageGLTest() {
     addTests({&BufferImageGLTest::construct,
+              &BufferImageGLTest::constructBuffer,
               &BufferImageGLTest::constructCopy,
               &BufferImageGLTest::constructMove,
 
-              &BufferImageGLTest::setData});
+              &BufferImageGLTest::setData,
+              &BufferImageGLTest::release});
 }
 
 void BufferImageGLTest::construct() {
@@ -71,6 +75,23 @@ void BufferImageGLTest::construct() {
     #endif
 }
 
+void BufferImageGLTest::constructBuffer() {
+    const char data[] = { 'a', 0, 0, 0, 'b', 0, 0, 0, 'c', 0, 0, 0 };
+    Buffer buffer;
+    buffer.setData({data, 12}, BufferUsage::StaticDraw);
+    const Int id = buffer.id();
+
+    BufferImage2D a(ColorFormat::Red, ColorType::UnsignedByte, {1, 3}, std::move(buffer));
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(a.format(), ColorFormat::Red);
+    CORRADE_COMPARE(a.type(), ColorType::UnsignedByte);
+    CORRADE_COMPARE(a.size(), Vector2i(1, 3));
+    CORRADE_COMPARE(a.buffer().id(), id);
+    CORRADE_COMPARE(buffer.id(), 0);
+}
+
 void BufferImageGLTest::constructCopy() {
     CORRADE_VERIFY(!(std::is_constructible<BufferImage2D, const BufferImage2D&>{}));
     CORRADE_VERIFY(!(std::is_assignable<BufferImage2D, const BufferImage2D&>{}));
@@ -136,6 +157,20 @@ void BufferImageGLTest::setData() {
     #endif
 }
 
+void BufferImageGLTest::release() {
+    const char data[4] = { 'a', 'b', 'c', 'd' };
+    BufferImage2D a(ColorFormat::Red, ColorType::UnsignedByte, {4, 1}, data, BufferUsage::StaticDraw);
+    const Int id = a.buffer().id();
+
+    Buffer buffer = a.release();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(buffer.id(), id);
+    CORRADE_COMPARE(a.size(), Vector2i());
+    CORRADE_VERIFY(a.buffer().id() != id);
+}
+
 }}
 
 CORRADE_TEST_MAIN(Magnum::Test::BufferImageGLTest)
@@ -0,0 +1,142 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Buffer.h"
+#include "Magnum/BufferReadbackQueue.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct BufferReadbackQueueGLTest: AbstractOpenGLTester {
+    explicit BufferReadbackQueueGLTest();
+
+    void read();
+    void full();
+    void get();
+};
+
+BufferReadbackQueueGLTest::BufferReadbackQueueGLTest() {
+    addTests({&BufferReadbackQueueGLTest::read,
+              &BufferReadbackQueueGLTest::full,
+              &BufferReadbackQueueGLTest::get});
+}
+
+namespace {
+    constexpr Int Data[] = {2, 7, -1, 15, 3};
+}
+
+void BufferReadbackQueueGLTest::read() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::copy_buffer>())
+        CORRADE_SKIP(Extensions::GL::ARB::copy_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    Buffer buffer;
+    buffer.setData({Data, 5}, BufferUsage::StaticDraw);
+
+    BufferReadbackQueue queue{2};
+    CORRADE_COMPARE(queue.frameCount(), 2);
+    CORRADE_COMPARE(queue.pendingSize(), 0);
+    CORRADE_VERIFY(queue.read(buffer, 4, 12));
+    CORRADE_COMPARE(queue.pendingCount(), 1);
+    CORRADE_COMPARE(queue.pendingSize(), 12);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Make sure the readback is done */
+    Renderer::finish();
+    Int out[3]{};
+    if(!queue.tryGet({reinterpret_cast<char*>(out), sizeof(out)})) {
+        /* Without fences the readback is done only when all frames are in
+           flight */
+        CORRADE_VERIFY(queue.read(buffer, 4, 12));
+        Renderer::finish();
+        CORRADE_VERIFY(queue.tryGet({reinterpret_cast<char*>(out), sizeof(out)}));
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(out[0], 7);
+    CORRADE_COMPARE(out[1], -1);
+    CORRADE_COMPARE(out[2], 15);
+}
+
+void BufferReadbackQueueGLTest::full() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::copy_buffer>())
+        CORRADE_SKIP(Extensions::GL::ARB::copy_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    Buffer buffer;
+    buffer.setData({Data, 5}, BufferUsage::StaticDraw);
+
+    BufferReadbackQueue queue{2};
+    CORRADE_VERIFY(queue.read(buffer, 0, sizeof(Data)));
+    CORRADE_VERIFY(queue.read(buffer, 0, sizeof(Data)));
+    CORRADE_VERIFY(!queue.read(buffer, 0, sizeof(Data)));
+    CORRADE_COMPARE(queue.pendingCount(), 2);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Getting the oldest makes room for next one */
+    Renderer::finish();
+    Int out[5];
+    CORRADE_VERIFY(queue.tryGet({reinterpret_cast<char*>(out), sizeof(out)}));
+    CORRADE_COMPARE(queue.pendingCount(), 1);
+    CORRADE_VERIFY(queue.read(buffer, 0, sizeof(Data)));
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void BufferReadbackQueueGLTest::get() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::copy_buffer>())
+        CORRADE_SKIP(Extensions::GL::ARB::copy_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    Buffer buffer;
+    buffer.setData({Data, 5}, BufferUsage::StaticDraw);
+
+    BufferReadbackQueue queue{3};
+    Int out[5]{};
+
+    /* Nothing pending */
+    CORRADE_VERIFY(!queue.get({reinterpret_cast<char*>(out), sizeof(out)}));
+
+    /* Waits for the readback even if not all frames are in flight */
+    CORRADE_VERIFY(queue.read(buffer, 0, sizeof(Data)));
+    CORRADE_VERIFY(queue.get({reinterpret_cast<char*>(out), sizeof(out)}));
+    CORRADE_COMPARE(queue.pendingCount(), 0);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(out[0], 2);
+    CORRADE_COMPARE(out[4], 3);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::BufferReadbackQueueGLTest)
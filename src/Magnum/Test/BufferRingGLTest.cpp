@@ -0,0 +1,139 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/BufferRing.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct BufferRingGLTest: AbstractOpenGLTester {
+    explicit BufferRingGLTest();
+
+    void construct();
+    void allocate();
+    void wrapAround();
+    void alignUnalignedSize();
+};
+
+BufferRingGLTest::BufferRingGLTest() {
+    addTests({&BufferRingGLTest::construct,
+              &BufferRingGLTest::allocate,
+              &BufferRingGLTest::wrapAround,
+              &BufferRingGLTest::alignUnalignedSize});
+}
+
+void BufferRingGLTest::construct() {
+    {
+        BufferRing ring{Buffer::TargetHint::Array, 1024, 3};
+
+        MAGNUM_VERIFY_NO_ERROR();
+        CORRADE_VERIFY(ring.buffer().id() > 0);
+        CORRADE_COMPARE(ring.size(), 1024);
+        CORRADE_COMPARE(ring.frameCount(), 3);
+        CORRADE_COMPARE(ring.buffer().size(), 3072);
+        #ifndef MAGNUM_TARGET_GLES
+        CORRADE_COMPARE(ring.isPersistent(), Context::current()->isExtensionSupported<Extensions::GL::ARB::buffer_storage>());
+        #else
+        CORRADE_VERIFY(!ring.isPersistent());
+        #endif
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void BufferRingGLTest::allocate() {
+    BufferRing ring{Buffer::TargetHint::Array, 1024, 2};
+
+    CORRADE_VERIFY(ring.beginFrame());
+    BufferRing::Allocation a = ring.allocate(3);
+    BufferRing::Allocation b = ring.allocate(16, 256);
+    CORRADE_VERIFY(a.data);
+    CORRADE_COMPARE(a.offset, 0);
+    CORRADE_COMPARE(b.offset, 256);
+    CORRADE_COMPARE(static_cast<char*>(b.data) - static_cast<char*>(a.data), 256);
+
+    constexpr char data[] = {2, 7, 5};
+    std::copy(data, data + 3, static_cast<char*>(a.data));
+    ring.endFrame();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /** @todo How to verify the contents in ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    const Containers::Array<char> contents = ring.buffer().subData<char>(0, 3);
+    CORRADE_COMPARE(contents[0], 2);
+    CORRADE_COMPARE(contents[1], 7);
+    CORRADE_COMPARE(contents[2], 5);
+    #endif
+}
+
+void BufferRingGLTest::wrapAround() {
+    BufferRing ring{Buffer::TargetHint::Array, 256, 2};
+
+    CORRADE_VERIFY(ring.beginFrame());
+    CORRADE_COMPARE(ring.allocate(16).offset, 0);
+    ring.endFrame();
+
+    CORRADE_VERIFY(ring.beginFrame());
+    CORRADE_COMPARE(ring.allocate(16).offset, 256);
+    ring.endFrame();
+
+    CORRADE_VERIFY(ring.beginFrame());
+    CORRADE_COMPARE(ring.allocate(16).offset, 0);
+    ring.endFrame();
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void BufferRingGLTest::alignUnalignedSize() {
+    /* Region size is not a multiple of the alignment, the offsets should be
+       aligned in the whole buffer */
+    BufferRing ring{Buffer::TargetHint::Array, 100, 3};
+
+    CORRADE_VERIFY(ring.beginFrame());
+    CORRADE_COMPARE(ring.allocate(16, 64).offset, 0);
+    CORRADE_COMPARE(ring.allocate(16, 64).offset, 64);
+    ring.endFrame();
+
+    CORRADE_VERIFY(ring.beginFrame());
+    CORRADE_COMPARE(ring.available(64), 72);
+    CORRADE_COMPARE(ring.allocate(16, 64).offset, 128);
+    ring.endFrame();
+
+    CORRADE_VERIFY(ring.beginFrame());
+    CORRADE_COMPARE(ring.allocate(16, 64).offset, 256);
+    ring.endFrame();
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::BufferRingGLTest)
@@ -23,8 +23,15 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <vector>
+
+#include "Magnum/Buffer.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/Texture.h"
 #include "Magnum/Test/AbstractOpenGLTester.h"
 
 namespace Magnum { namespace Test {
@@ -36,13 +43,25 @@ struct ContextGLTest: AbstractOpenGLTester {
     void supportedVersion();
     void isExtensionSupported();
     void isExtensionDisabled();
+
+    void elidedStateChanges();
+    void statistics();
+
+    void deferredDeletion();
+    void namePool();
 };
 
 ContextGLTest::ContextGLTest() {
     addTests({&ContextGLTest::isVersionSupported,
               &ContextGLTest::supportedVersion,
               &ContextGLTest::isExtensionSupported,
-              &ContextGLTest::isExtensionDisabled});
+              &ContextGLTest::isExtensionDisabled,
+
+              &ContextGLTest::elidedStateChanges,
+              &ContextGLTest::statistics,
+
+              &ContextGLTest::deferredDeletion,
+              &ContextGLTest::namePool});
 }
 
 void ContextGLTest::isVersionSupported() {
@@ -107,6 +126,147 @@ void ContextGLTest::isExtensionDisabled() {
     #endif
 }
 
+void ContextGLTest::elidedStateChanges() {
+    Context::current()->resetState(Context::State::Renderer);
+    const UnsignedLong before = Context::current()->elidedStateChangeCount();
+
+    /* First calls go through, as the state is unknown after reset */
+    Renderer::enable(Renderer::Feature::Blending);
+    Renderer::setBlendFunction(Renderer::BlendFunction::One, Renderer::BlendFunction::Zero);
+    Renderer::setDepthFunction(Renderer::DepthFunction::LessOrEqual);
+    Renderer::setStencilFunction(Renderer::StencilFunction::Always, 0, 0xff);
+    CORRADE_COMPARE(Context::current()->elidedStateChangeCount(), before);
+
+    /* Repeated calls are elided */
+    Renderer::enable(Renderer::Feature::Blending);
+    Renderer::setBlendFunction(Renderer::BlendFunction::One, Renderer::BlendFunction::Zero);
+    Renderer::setDepthFunction(Renderer::DepthFunction::LessOrEqual);
+    Renderer::setStencilFunction(Renderer::PolygonFacing::Front, Renderer::StencilFunction::Always, 0, 0xff);
+    CORRADE_COMPARE(Context::current()->elidedStateChangeCount(), before + 4);
+
+    /* Changed state goes through again */
+    Renderer::disable(Renderer::Feature::Blending);
+    Renderer::setStencilFunction(Renderer::PolygonFacing::Back, Renderer::StencilFunction::Never, 0, 0xff);
+    CORRADE_COMPARE(Context::current()->elidedStateChangeCount(), before + 4);
+
+    /* Reset forgets everything */
+    Context::current()->resetState(Context::State::Renderer);
+    Renderer::setDepthFunction(Renderer::DepthFunction::LessOrEqual);
+    CORRADE_COMPARE(Context::current()->elidedStateChangeCount(), before + 4);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Restore the defaults */
+    Renderer::setDepthFunction(Renderer::DepthFunction::Less);
+    Renderer::setStencilFunction(Renderer::StencilFunction::Always, 0, ~0u);
+}
+
+void ContextGLTest::statistics() {
+    Context& context = *Context::current();
+    CORRADE_VERIFY(!context.isStatisticsEnabled());
+
+    Buffer buffer;
+    constexpr Int data[] = {2, 3, 4, 5};
+
+    /* Nothing is counted when disabled */
+    context.resetStatistics();
+    buffer.setData(data, BufferUsage::StaticDraw);
+    CORRADE_COMPARE(context.statistics().bufferUploadBytes, 0);
+
+    context.setStatisticsEnabled(true);
+    CORRADE_VERIFY(context.isStatisticsEnabled());
+
+    buffer.setData(data, BufferUsage::StaticDraw);
+    buffer.setSubData(4, {data, 2});
+    CORRADE_COMPARE(context.statistics().bufferUploadBytes, 24);
+
+    /* Redundant binds are not counted */
+    Texture2D texture;
+    texture.bind(7);
+    texture.bind(7);
+    CORRADE_COMPARE(context.statistics().textureBinds, 1);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    context.resetStatistics();
+    CORRADE_COMPARE(context.statistics().bufferUploadBytes, 0);
+    CORRADE_COMPARE(context.statistics().textureBinds, 0);
+
+    context.setStatisticsEnabled(false);
+}
+
+void ContextGLTest::deferredDeletion() {
+    Context& context = *Context::current();
+    CORRADE_VERIFY(!context.isDeferredDeletionEnabled());
+
+    context.setDeferredDeletionEnabled(true);
+    CORRADE_VERIFY(context.isDeferredDeletionEnabled());
+
+    GLuint bufferId, textureId;
+    {
+        Buffer buffer;
+        Texture2D texture;
+        Renderbuffer renderbuffer;
+        Framebuffer framebuffer{{{}, {4, 4}}};
+        buffer.setData({nullptr, 16}, BufferUsage::StaticDraw);
+        texture.bind(0);
+        bufferId = buffer.id();
+        textureId = texture.id();
+    }
+
+    /* The names are still alive until the queue is flushed */
+    CORRADE_COMPARE(context.deferredDeletionCount(), 4);
+    CORRADE_VERIFY(glIsBuffer(bufferId));
+    CORRADE_VERIFY(glIsTexture(textureId));
+
+    context.flushDeferredDeletions();
+    CORRADE_COMPARE(context.deferredDeletionCount(), 0);
+    CORRADE_VERIFY(!glIsBuffer(bufferId));
+    CORRADE_VERIFY(!glIsTexture(textureId));
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    context.setDeferredDeletionEnabled(false);
+}
+
+void ContextGLTest::namePool() {
+    Context& context = *Context::current();
+    CORRADE_COMPARE(context.namePoolSize(), 0);
+
+    context.setNamePoolSize(16);
+    CORRADE_COMPARE(context.namePoolSize(), 16);
+
+    std::vector<Texture2D> textures;
+    for(std::size_t i = 0; i != 40; ++i) textures.emplace_back();
+    for(std::size_t i = 1; i != textures.size(); ++i)
+        CORRADE_VERIFY(textures[i].id() != textures[i - 1].id());
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Unused name is recycled, buffers created with DSA are always used */
+    #ifndef MAGNUM_TARGET_GLES
+    if(!context.isExtensionSupported<Extensions::GL::ARB::direct_state_access>())
+    #endif
+    {
+        GLuint id;
+        {
+            Buffer buffer;
+            id = buffer.id();
+        } {
+            Buffer buffer;
+            CORRADE_COMPARE(buffer.id(), id);
+            buffer.setData({nullptr, 16}, BufferUsage::StaticDraw);
+        } {
+            Buffer buffer;
+            CORRADE_VERIFY(buffer.id() != id);
+        }
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    context.setNamePoolSize(0);
+}
+
 }}
 
 CORRADE_TEST_MAIN(Magnum::Test::ContextGLTest)
@@ -27,7 +27,9 @@
 
 #include "Magnum/Context.h"
 #include "Magnum/DebugOutput.h"
+#include "Magnum/DebugOutputQueue.h"
 #include "Magnum/Extensions.h"
+#include "Magnum/Renderer.h"
 #include "Magnum/Test/AbstractOpenGLTester.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -45,6 +47,7 @@ struct DebugOutputGLTest: AbstractOpenGLTester {
     void messageNoOp();
     void message();
     void messageFallback();
+    void messageQueue();
 
     void groupNoOp();
     void group();
@@ -62,6 +65,7 @@ DebugOutputGLTest::DebugOutputGLTest() {
               &DebugOutputGLTest::messageNoOp,
               &DebugOutputGLTest::message,
               &DebugOutputGLTest::messageFallback,
+              &DebugOutputGLTest::messageQueue,
 
               &DebugOutputGLTest::groupNoOp,
               &DebugOutputGLTest::group,
@@ -140,6 +144,36 @@ void DebugOutputGLTest::messageFallback() {
     MAGNUM_VERIFY_NO_ERROR();
 }
 
+void DebugOutputGLTest::messageQueue() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::KHR::debug>())
+        CORRADE_SKIP(Extensions::GL::KHR::debug::string() + std::string(" is not supported"));
+
+    Renderer::enable(Renderer::Feature::DebugOutputSynchronous);
+
+    DebugOutputQueue queue;
+    queue.install();
+    CORRADE_VERIFY(queue.isInstalled());
+
+    for(std::size_t i = 0; i != 3; ++i)
+        DebugMessage::insert(DebugMessage::Source::Application, DebugMessage::Type::Marker,
+            1337, DebugOutput::Severity::High, "Hello from OpenGL command stream!");
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(queue.suppressedCount(), 2);
+
+    std::ostringstream out;
+    Debug::setOutput(&out);
+    CORRADE_COMPARE(queue.drain(), 1);
+    CORRADE_COMPARE(out.str(),
+        "Debug output: high severity application marker (1337): Hello from OpenGL command stream! (3 times)\n");
+
+    /* Setting another callback uninstalls the queue */
+    DebugOutput::setDefaultCallback();
+    CORRADE_VERIFY(!queue.isInstalled());
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
 void DebugOutputGLTest::groupNoOp() {
     if(Context::current()->isExtensionSupported<Extensions::GL::KHR::debug>() ||
        Context::current()->isExtensionSupported<Extensions::GL::EXT::debug_marker>())
@@ -162,8 +196,12 @@ void DebugOutputGLTest::group() {
     {
         DebugGroup g1{DebugGroup::Source::Application, 42, "Automatic debug group"};
         DebugGroup g2;
+        CORRADE_VERIFY(g1.isActive());
+        CORRADE_VERIFY(!g2.isActive());
         g2.push(DebugGroup::Source::ThirdParty, 1337, "Manual debug group");
+        CORRADE_VERIFY(g2.isActive());
         g2.pop();
+        CORRADE_VERIFY(!g2.isActive());
     }
 
     MAGNUM_VERIFY_NO_ERROR();
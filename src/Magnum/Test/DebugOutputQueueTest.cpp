@@ -0,0 +1,150 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/DebugOutputQueue.h"
+
+namespace Magnum { namespace Test {
+
+struct DebugOutputQueueTest: TestSuite::Tester {
+    explicit DebugOutputQueueTest();
+
+    void construct();
+    void drain();
+    void drainDefault();
+    void rateLimit();
+    void full();
+    void truncate();
+};
+
+DebugOutputQueueTest::DebugOutputQueueTest() {
+    addTests({&DebugOutputQueueTest::construct,
+              &DebugOutputQueueTest::drain,
+              &DebugOutputQueueTest::drainDefault,
+              &DebugOutputQueueTest::rateLimit,
+              &DebugOutputQueueTest::full,
+              &DebugOutputQueueTest::truncate});
+}
+
+namespace {
+    void collect(const DebugOutputQueue::Message& message, const void* userParam) {
+        static_cast<std::vector<std::string>*>(const_cast<void*>(userParam))->push_back(std::to_string(message.id) + ':' + std::to_string(message.count) + ':' + message.message);
+    }
+
+    void push(DebugOutputQueue& queue, UnsignedInt id, const std::string& message) {
+        queue.push(DebugOutput::Source::Api, DebugOutput::Type::Performance, id, DebugOutput::Severity::Medium, message.data(), message.size());
+    }
+}
+
+void DebugOutputQueueTest::construct() {
+    DebugOutputQueue queue{100, 64};
+    CORRADE_COMPARE(queue.capacity(), 128);
+    CORRADE_COMPARE(queue.maxMessageLength(), 64);
+    CORRADE_COMPARE(queue.rateLimit(), 1);
+    CORRADE_COMPARE(queue.droppedCount(), 0);
+    CORRADE_COMPARE(queue.suppressedCount(), 0);
+}
+
+void DebugOutputQueueTest::drain() {
+    DebugOutputQueue queue;
+    push(queue, 1, "first");
+    push(queue, 2, "second");
+
+    std::vector<std::string> messages;
+    CORRADE_COMPARE(queue.drain(collect, &messages), 2);
+    CORRADE_COMPARE(messages, (std::vector<std::string>{"1:1:first", "2:1:second"}));
+
+    /* Nothing left */
+    messages.clear();
+    CORRADE_COMPARE(queue.drain(collect, &messages), 0);
+    CORRADE_VERIFY(messages.empty());
+}
+
+void DebugOutputQueueTest::drainDefault() {
+    DebugOutputQueue queue;
+    push(queue, 1337, "Slow path");
+    push(queue, 1337, "Slow path");
+    push(queue, 42, "Fast path");
+
+    std::ostringstream out;
+    Debug::setOutput(&out);
+    CORRADE_COMPARE(queue.drain(), 2);
+    CORRADE_COMPARE(out.str(),
+        "Debug output: medium severity API performance note (1337): Slow path (2 times)\n"
+        "Debug output: medium severity API performance note (42): Fast path\n");
+}
+
+void DebugOutputQueueTest::rateLimit() {
+    DebugOutputQueue queue;
+    queue.setRateLimit(2);
+    for(std::size_t i = 0; i != 5; ++i) push(queue, 7, "spam");
+    push(queue, 8, "other");
+
+    std::vector<std::string> messages;
+    CORRADE_COMPARE(queue.drain(collect, &messages), 3);
+    CORRADE_COMPARE(queue.suppressedCount(), 3);
+    CORRADE_COMPARE(messages, (std::vector<std::string>{"7:5:spam", "7:5:spam", "8:1:other"}));
+
+    /* The limit is reset after drain */
+    messages.clear();
+    push(queue, 7, "spam");
+    CORRADE_COMPARE(queue.drain(collect, &messages), 1);
+    CORRADE_COMPARE(messages, (std::vector<std::string>{"7:1:spam"}));
+}
+
+void DebugOutputQueueTest::full() {
+    DebugOutputQueue queue{2};
+    push(queue, 1, "a");
+    push(queue, 2, "b");
+    push(queue, 3, "c");
+    CORRADE_COMPARE(queue.droppedCount(), 1);
+
+    std::vector<std::string> messages;
+    CORRADE_COMPARE(queue.drain(collect, &messages), 2);
+    CORRADE_COMPARE(messages, (std::vector<std::string>{"1:1:a", "2:1:b"}));
+
+    /* There's space again, also after the counters wrap around the ring */
+    messages.clear();
+    push(queue, 4, "d");
+    push(queue, 5, "e");
+    CORRADE_COMPARE(queue.drain(collect, &messages), 2);
+    CORRADE_COMPARE(messages, (std::vector<std::string>{"4:1:d", "5:1:e"}));
+}
+
+void DebugOutputQueueTest::truncate() {
+    DebugOutputQueue queue{4, 5};
+    push(queue, 1, "truncated message");
+
+    std::vector<std::string> messages;
+    queue.drain(collect, &messages);
+    CORRADE_COMPARE(messages, (std::vector<std::string>{"1:1:trunc"}));
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::DebugOutputQueueTest)
@@ -0,0 +1,334 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <thread>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Buffer.h"
+#include "Magnum/Context.h"
+#include "Magnum/DrawList.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/MeshView.h"
+#include "Magnum/Shader.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct DrawListGLTest: AbstractOpenGLTester {
+    explicit DrawListGLTest();
+
+    void construct();
+    void record();
+    void recordThreaded();
+
+    void mergeSortState();
+    void mergeSortKey();
+    void mergeSortNone();
+
+    void replay();
+    void clear();
+};
+
+DrawListGLTest::DrawListGLTest() {
+    addTests({&DrawListGLTest::construct,
+              &DrawListGLTest::record,
+              &DrawListGLTest::recordThreaded,
+
+              &DrawListGLTest::mergeSortState,
+              &DrawListGLTest::mergeSortKey,
+              &DrawListGLTest::mergeSortNone,
+
+              &DrawListGLTest::replay,
+              &DrawListGLTest::clear});
+}
+
+namespace {
+    struct TestShader: AbstractShaderProgram {
+        explicit TestShader();
+    };
+}
+
+TestShader::TestShader() {
+    #ifndef MAGNUM_TARGET_GLES
+    Shader vert(Version::GL300, Shader::Type::Vertex);
+    Shader frag(Version::GL300, Shader::Type::Fragment);
+    #else
+    Shader vert(Version::GLES300, Shader::Type::Vertex);
+    Shader frag(Version::GLES300, Shader::Type::Fragment);
+    #endif
+
+    vert.addSource("void main() { gl_Position = vec4(0.0, 0.0, 0.0, 1.0); }\n");
+    frag.addSource("out mediump vec4 result;\n"
+                   "void main() { result = vec4(1.0); }\n");
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+
+    attachShaders({vert, frag});
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+}
+
+void DrawListGLTest::construct() {
+    DrawList list{3};
+
+    CORRADE_COMPARE(list.recorderCount(), 3);
+    CORRADE_COMPARE(list.sorting(), DrawList::Sorting::State);
+    CORRADE_VERIFY(list.commands().empty());
+}
+
+void DrawListGLTest::record() {
+    Mesh mesh;
+    TestShader shader;
+    Texture2D texture;
+
+    DrawList list{1};
+    const UnsignedShort meshId = list.addMesh(mesh);
+    const UnsignedShort shaderId = list.addShader(shader);
+    const UnsignedShort textureId = list.addTexture(texture);
+
+    CORRADE_COMPARE(meshId, 0);
+    CORRADE_COMPARE(shaderId, 0);
+    CORRADE_COMPARE(textureId, 0);
+
+    list.recorder(0).draw(meshId, shaderId, {textureId}, {256, 512}, 17);
+    CORRADE_COMPARE(list.recorder(0).size(), 1);
+
+    list.merge();
+    CORRADE_COMPARE(list.recorder(0).size(), 0);
+    CORRADE_COMPARE(list.commands().size(), 1);
+
+    const DrawList::Command& command = list.commands()[0];
+    CORRADE_COMPARE(command.key, 17);
+    CORRADE_COMPARE(command.mesh, meshId);
+    CORRADE_COMPARE(command.shader, shaderId);
+    CORRADE_COMPARE(command.textures[0], textureId);
+    CORRADE_COMPARE(command.textures[1], DrawList::NoTexture);
+    CORRADE_COMPARE(command.uniformOffsets[0], 256);
+    CORRADE_COMPARE(command.uniformOffsets[1], 512);
+    CORRADE_COMPARE(command.uniformOffsets[2], 0);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void DrawListGLTest::recordThreaded() {
+    Mesh a, b;
+    TestShader shader;
+
+    DrawList list{2};
+    list.setSorting(DrawList::Sorting::None);
+    const UnsignedShort meshA = list.addMesh(a);
+    const UnsignedShort meshB = list.addMesh(b);
+    const UnsignedShort shaderId = list.addShader(shader);
+
+    /* No OpenGL calls are done in the workers */
+    std::thread first{[&]() {
+        for(std::size_t i = 0; i != 1000; ++i)
+            list.recorder(0).draw(meshA, shaderId);
+    }};
+    std::thread second{[&]() {
+        for(std::size_t i = 0; i != 500; ++i)
+            list.recorder(1).draw(meshB, shaderId);
+    }};
+    first.join();
+    second.join();
+
+    CORRADE_COMPARE(list.recorder(0).size(), 1000);
+    CORRADE_COMPARE(list.recorder(1).size(), 500);
+
+    /* Unsorted commands are in recorder order */
+    list.merge();
+    CORRADE_COMPARE(list.commands().size(), 1500);
+    CORRADE_COMPARE(list.commands()[999].mesh, meshA);
+    CORRADE_COMPARE(list.commands()[1000].mesh, meshB);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void DrawListGLTest::mergeSortState() {
+    Mesh a, b;
+    TestShader shaderA, shaderB;
+    Texture2D textureA, textureB;
+
+    DrawList list{2};
+    list.addMesh(a);
+    list.addMesh(b);
+    list.addShader(shaderA);
+    list.addShader(shaderB);
+    list.addTexture(textureA);
+    list.addTexture(textureB);
+
+    list.recorder(0).draw(1, 1, {0})
+        .draw(0, 0, {1});
+    list.recorder(1).draw(1, 0, {1})
+        .draw(1, 0, {0})
+        .draw(0, 1, {0});
+
+    list.merge();
+    CORRADE_COMPARE(list.commands().size(), 5);
+    CORRADE_COMPARE(list.commands()[0].shader, 0);
+    CORRADE_COMPARE(list.commands()[0].textures[0], 0);
+    CORRADE_COMPARE(list.commands()[1].shader, 0);
+    CORRADE_COMPARE(list.commands()[1].textures[0], 1);
+    CORRADE_COMPARE(list.commands()[1].mesh, 0);
+    CORRADE_COMPARE(list.commands()[2].shader, 0);
+    CORRADE_COMPARE(list.commands()[2].textures[0], 1);
+    CORRADE_COMPARE(list.commands()[2].mesh, 1);
+    CORRADE_COMPARE(list.commands()[3].shader, 1);
+    CORRADE_COMPARE(list.commands()[3].mesh, 0);
+    CORRADE_COMPARE(list.commands()[4].shader, 1);
+    CORRADE_COMPARE(list.commands()[4].mesh, 1);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void DrawListGLTest::mergeSortKey() {
+    Mesh mesh;
+    TestShader shader;
+
+    DrawList list{2};
+    list.setSorting(DrawList::Sorting::Key);
+    list.addMesh(mesh);
+    list.addShader(shader);
+
+    list.recorder(0).draw(0, 0, {}, {}, 30)
+        .draw(0, 0, {}, {0}, 10);
+    list.recorder(1).draw(0, 0, {}, {}, 20)
+        .draw(0, 0, {}, {1}, 10);
+
+    list.merge();
+    CORRADE_COMPARE(list.commands().size(), 4);
+    CORRADE_COMPARE(list.commands()[0].key, 10);
+    CORRADE_COMPARE(list.commands()[0].uniformOffsets[0], 0);
+    CORRADE_COMPARE(list.commands()[1].key, 10);
+    CORRADE_COMPARE(list.commands()[1].uniformOffsets[0], 1);
+    CORRADE_COMPARE(list.commands()[2].key, 20);
+    CORRADE_COMPARE(list.commands()[3].key, 30);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void DrawListGLTest::mergeSortNone() {
+    Mesh mesh;
+    TestShader shader;
+
+    DrawList list{2};
+    list.setSorting(DrawList::Sorting::None);
+    list.addMesh(mesh);
+    list.addShader(shader);
+
+    list.recorder(1).draw(0, 0, {}, {}, 30);
+    list.recorder(0).draw(0, 0, {}, {}, 20)
+        .draw(0, 0, {}, {}, 10);
+
+    list.merge();
+    CORRADE_COMPARE(list.commands().size(), 3);
+    CORRADE_COMPARE(list.commands()[0].key, 20);
+    CORRADE_COMPARE(list.commands()[1].key, 10);
+    CORRADE_COMPARE(list.commands()[2].key, 30);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void DrawListGLTest::replay() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::uniform_buffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::uniform_buffer_object::string() + std::string(" is not available."));
+    #endif
+
+    Mesh mesh;
+    mesh.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(3);
+    MeshView view{mesh};
+    view.setCount(3);
+
+    TestShader shaderA, shaderB;
+
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, {4, 4});
+
+    const Int alignment = Buffer::uniformOffsetAlignment();
+    Buffer uniforms;
+    uniforms.setData({nullptr, std::size_t(alignment*2)}, BufferUsage::DynamicDraw);
+
+    DrawList list{2};
+    const UnsignedShort meshId = list.addMesh(mesh);
+    const UnsignedShort viewId = list.addMesh(view);
+    const UnsignedShort a = list.addShader(shaderA);
+    const UnsignedShort b = list.addShader(shaderB);
+    const UnsignedShort textureId = list.addTexture(texture);
+    list.addUniformBuffer(uniforms, 0, 16);
+
+    list.recorder(0).draw(meshId, a, {textureId}, {0})
+        .draw(viewId, b, {}, {UnsignedInt(alignment)});
+    list.recorder(1).draw(viewId, a, {textureId}, {UnsignedInt(alignment)})
+        .draw(meshId, b);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Make sure neither shader is currently used */
+    TestShader other;
+    Mesh{}.setCount(3).draw(other);
+
+    Context::current()->setStatisticsEnabled(true);
+    Context::current()->resetStatistics();
+
+    list.replay();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(Context::current()->statistics().drawCalls, 4);
+    CORRADE_COMPARE(Context::current()->statistics().programSwitches, 2);
+    CORRADE_VERIFY(list.commands().empty());
+    CORRADE_COMPARE(list.recorder(0).size(), 0);
+    CORRADE_COMPARE(list.recorder(1).size(), 0);
+
+    Context::current()->setStatisticsEnabled(false);
+}
+
+void DrawListGLTest::clear() {
+    Mesh mesh;
+    TestShader shader;
+
+    DrawList list{2};
+    list.addMesh(mesh);
+    list.addShader(shader);
+
+    list.recorder(0).draw(0, 0);
+    list.merge();
+    list.recorder(1).draw(0, 0);
+    list.clear();
+
+    CORRADE_VERIFY(list.commands().empty());
+    CORRADE_COMPARE(list.recorder(0).size(), 0);
+    CORRADE_COMPARE(list.recorder(1).size(), 0);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::DrawListGLTest)
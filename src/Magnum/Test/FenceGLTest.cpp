@@ -0,0 +1,119 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Fence.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct FenceGLTest: AbstractOpenGLTester {
+    explicit FenceGLTest();
+
+    void construct();
+    void constructMove();
+    void clientWait();
+    void wait();
+};
+
+FenceGLTest::FenceGLTest() {
+    addTests({&FenceGLTest::construct,
+              &FenceGLTest::constructMove,
+              &FenceGLTest::clientWait,
+              &FenceGLTest::wait});
+}
+
+void FenceGLTest::construct() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::sync>())
+        CORRADE_SKIP(Extensions::GL::ARB::sync::string() + std::string(" is not available"));
+    #endif
+
+    {
+        Fence fence;
+
+        MAGNUM_VERIFY_NO_ERROR();
+        CORRADE_VERIFY(fence.id());
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void FenceGLTest::constructMove() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::sync>())
+        CORRADE_SKIP(Extensions::GL::ARB::sync::string() + std::string(" is not available"));
+    #endif
+
+    Fence a;
+    const GLsync id = a.id();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(id);
+
+    Fence b{std::move(a)};
+
+    CORRADE_VERIFY(!a.id());
+    CORRADE_COMPARE(b.id(), id);
+
+    Fence c;
+    const GLsync cId = c.id();
+    c = std::move(b);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(cId);
+    CORRADE_COMPARE(b.id(), cId);
+    CORRADE_COMPARE(c.id(), id);
+}
+
+void FenceGLTest::clientWait() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::sync>())
+        CORRADE_SKIP(Extensions::GL::ARB::sync::string() + std::string(" is not available"));
+    #endif
+
+    Fence fence;
+    CORRADE_VERIFY(fence.clientWait(std::chrono::seconds{1}));
+    CORRADE_VERIFY(fence.isSignaled());
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void FenceGLTest::wait() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::sync>())
+        CORRADE_SKIP(Extensions::GL::ARB::sync::string() + std::string(" is not available"));
+    #endif
+
+    Fence fence;
+    fence.wait();
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::FenceGLTest)
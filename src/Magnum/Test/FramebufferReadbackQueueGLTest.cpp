@@ -0,0 +1,142 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Color.h"
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/FramebufferReadbackQueue.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct FramebufferReadbackQueueGLTest: AbstractOpenGLTester {
+    explicit FramebufferReadbackQueueGLTest();
+
+    void read();
+    void full();
+    void get();
+};
+
+FramebufferReadbackQueueGLTest::FramebufferReadbackQueueGLTest() {
+    addTests({&FramebufferReadbackQueueGLTest::read,
+              &FramebufferReadbackQueueGLTest::full,
+              &FramebufferReadbackQueueGLTest::get});
+}
+
+void FramebufferReadbackQueueGLTest::read() {
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{4});
+    Framebuffer framebuffer{{{}, Vector2i{4}}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color);
+
+    Renderer::setClearColor(Color4{1.0f, 0.0f, 1.0f, 1.0f});
+    framebuffer.clear(FramebufferClear::Color);
+
+    FramebufferReadbackQueue queue{ColorFormat::RGBA, ColorType::UnsignedByte, 2};
+    CORRADE_COMPARE(queue.frameCount(), 2);
+    CORRADE_VERIFY(queue.read(framebuffer, {{1, 1}, {3, 3}}));
+    CORRADE_COMPARE(queue.pendingCount(), 1);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Make sure the readback is done */
+    Renderer::finish();
+    ImageReference2D image = queue.tryGet();
+    if(!image.data()) {
+        /* Without fences the readback is done only when all frames are in
+           flight */
+        CORRADE_VERIFY(queue.read(framebuffer, {{1, 1}, {3, 3}}));
+        Renderer::finish();
+        image = queue.tryGet();
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(image.data());
+    CORRADE_COMPARE(image.size(), Vector2i{2});
+    CORRADE_COMPARE(image.data<Color4ub>()[3], (Color4ub{0xff, 0x00, 0xff, 0xff}));
+
+    const UnsignedInt pending = queue.pendingCount();
+    queue.release();
+    CORRADE_COMPARE(queue.pendingCount(), pending - 1);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void FramebufferReadbackQueueGLTest::full() {
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{4});
+    Framebuffer framebuffer{{{}, Vector2i{4}}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color);
+
+    FramebufferReadbackQueue queue{ColorFormat::RGBA, ColorType::UnsignedByte, 2};
+    CORRADE_VERIFY(queue.read(framebuffer, {{}, Vector2i{4}}));
+    CORRADE_VERIFY(queue.read(framebuffer, {{}, Vector2i{4}}));
+    CORRADE_VERIFY(!queue.read(framebuffer, {{}, Vector2i{4}}));
+    CORRADE_COMPARE(queue.pendingCount(), 2);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Releasing the oldest makes room for next one */
+    Renderer::finish();
+    CORRADE_VERIFY(queue.tryGet().data());
+    queue.release();
+    CORRADE_VERIFY(queue.read(framebuffer, {{}, Vector2i{4}}));
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void FramebufferReadbackQueueGLTest::get() {
+    Renderbuffer color;
+    color.setStorage(RenderbufferFormat::RGBA8, Vector2i{4});
+    Framebuffer framebuffer{{{}, Vector2i{4}}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment{0}, color);
+
+    Renderer::setClearColor(Color4{0.0f, 1.0f, 0.0f, 1.0f});
+    framebuffer.clear(FramebufferClear::Color);
+
+    FramebufferReadbackQueue queue{ColorFormat::RGBA, ColorType::UnsignedByte, 3};
+
+    /* Nothing pending */
+    CORRADE_VERIFY(!queue.get().data());
+
+    /* Waits for the readback even if not all frames are in flight */
+    CORRADE_VERIFY(queue.read(framebuffer, {{}, Vector2i{4}}));
+    ImageReference2D image = queue.get();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(image.data());
+    CORRADE_COMPARE(image.data<Color4ub>()[5], (Color4ub{0x00, 0xff, 0x00, 0xff}));
+
+    queue.release();
+    CORRADE_COMPARE(queue.pendingCount(), 0);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::FramebufferReadbackQueueGLTest)
@@ -0,0 +1,294 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <vector>
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/Buffer.h"
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Image.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/Shader.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Test/AbstractOpenGLBenchmarkTester.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/BufferImage.h"
+#endif
+
+namespace Magnum { namespace Test {
+
+struct GLBenchmark: AbstractOpenGLBenchmarkTester {
+    explicit GLBenchmark();
+
+    void bufferSetData();
+    void bufferSetSubData();
+    #ifndef MAGNUM_TARGET_GLES2
+    void bufferMap();
+    #endif
+    #ifndef MAGNUM_TARGET_GLES
+    void bufferMapPersistent();
+    #endif
+
+    void meshDraw();
+
+    void textureSetImage();
+    void textureSetSubImage();
+
+    void framebufferRead();
+    #ifndef MAGNUM_TARGET_GLES2
+    void framebufferReadBuffer();
+    #endif
+
+    private:
+        std::vector<char> _data;
+};
+
+namespace {
+    /* 64 kB per buffer upload, which is in the range of a typical streamed
+       vertex or uniform buffer */
+    constexpr std::size_t BufferSize = 64*1024;
+    constexpr std::size_t BufferUploads = 64;
+
+    constexpr std::size_t DrawCount = 1024;
+
+    /* 256x256 RGBA8 images, 256 kB each */
+    constexpr Int ImageSize = 256;
+    constexpr std::size_t ImageUploads = 16;
+
+    constexpr std::size_t Repeats = 16;
+
+    struct PointShader: AbstractShaderProgram {
+        typedef Attribute<0, Vector2> Position;
+
+        explicit PointShader();
+    };
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+PointShader::PointShader() {
+    #ifndef MAGNUM_TARGET_GLES
+    Shader vert(Version::GL210, Shader::Type::Vertex);
+    Shader frag(Version::GL210, Shader::Type::Fragment);
+    #else
+    Shader vert(Version::GLES200, Shader::Type::Vertex);
+    Shader frag(Version::GLES200, Shader::Type::Fragment);
+    #endif
+
+    vert.addSource("attribute mediump vec2 position;\n"
+                   "void main() { gl_Position = vec4(position, 0.0, 1.0); }\n");
+    frag.addSource("void main() { gl_FragColor = vec4(1.0); }\n");
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Shader::compile({vert, frag}));
+
+    attachShaders({vert, frag});
+
+    bindAttributeLocation(Position::Location, "position");
+
+    CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+}
+#endif
+
+GLBenchmark::GLBenchmark(): _data(ImageSize*ImageSize*4) {
+    addTests({&GLBenchmark::bufferSetData,
+              &GLBenchmark::bufferSetSubData,
+              #ifndef MAGNUM_TARGET_GLES2
+              &GLBenchmark::bufferMap,
+              #endif
+              #ifndef MAGNUM_TARGET_GLES
+              &GLBenchmark::bufferMapPersistent,
+              #endif
+
+              &GLBenchmark::meshDraw,
+
+              &GLBenchmark::textureSetImage,
+              &GLBenchmark::textureSetSubImage,
+
+              &GLBenchmark::framebufferRead,
+              #ifndef MAGNUM_TARGET_GLES2
+              &GLBenchmark::framebufferReadBuffer
+              #endif
+              });
+
+    for(std::size_t i = 0; i != _data.size(); ++i)
+        _data[i] = char(i*7);
+}
+
+void GLBenchmark::bufferSetData() {
+    Buffer buffer;
+    const Containers::ArrayReference<const void> data{_data.data(), BufferSize};
+    benchmark("Buffer::setData():", BufferUploads, Repeats, [&buffer, data]() {
+        for(std::size_t i = 0; i != BufferUploads; ++i)
+            buffer.setData(data, BufferUsage::StreamDraw);
+    });
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void GLBenchmark::bufferSetSubData() {
+    Buffer buffer;
+    buffer.setData({nullptr, BufferSize*BufferUploads}, BufferUsage::StreamDraw);
+    const Containers::ArrayReference<const void> data{_data.data(), BufferSize};
+    benchmark("Buffer::setSubData():", BufferUploads, Repeats, [&buffer, data]() {
+        for(std::size_t i = 0; i != BufferUploads; ++i)
+            buffer.setSubData(i*BufferSize, data);
+    });
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void GLBenchmark::bufferMap() {
+    Buffer buffer;
+    buffer.setData({nullptr, BufferSize*BufferUploads}, BufferUsage::StreamDraw);
+    const char* const data = _data.data();
+    benchmark("Buffer::map() with invalidation:", BufferUploads, Repeats, [&buffer, data]() {
+        for(std::size_t i = 0; i != BufferUploads; ++i) {
+            void* const mapped = buffer.map(i*BufferSize, BufferSize, Buffer::MapFlag::Write|Buffer::MapFlag::InvalidateRange);
+            std::memcpy(mapped, data, BufferSize);
+            buffer.unmap();
+        }
+    });
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES
+void GLBenchmark::bufferMapPersistent() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::buffer_storage>())
+        CORRADE_SKIP(Extensions::GL::ARB::buffer_storage::string() + std::string(" is not supported"));
+
+    Buffer buffer;
+    buffer.setStorage({nullptr, BufferSize*BufferUploads}, Buffer::StorageFlag::MapWrite|Buffer::StorageFlag::MapPersistent|Buffer::StorageFlag::MapCoherent);
+    char* const mapped = static_cast<char*>(buffer.map(0, BufferSize*BufferUploads, Buffer::MapFlag::Write|Buffer::MapFlag::Persistent|Buffer::MapFlag::Coherent));
+    CORRADE_VERIFY(mapped);
+
+    /* No synchronization with the GPU, as nothing is reading the buffer */
+    const char* const data = _data.data();
+    benchmark("Buffer::map() persistent and coherent:", BufferUploads, Repeats, [mapped, data]() {
+        for(std::size_t i = 0; i != BufferUploads; ++i)
+            std::memcpy(mapped + i*BufferSize, data, BufferSize);
+    });
+
+    CORRADE_VERIFY(buffer.unmap());
+    MAGNUM_VERIFY_NO_ERROR();
+}
+#endif
+
+void GLBenchmark::meshDraw() {
+    Renderbuffer renderbuffer;
+    renderbuffer.setStorage(RenderbufferFormat::RGBA8, Vector2i{1});
+    Framebuffer framebuffer{{{}, Vector2i{1}}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment(0), renderbuffer)
+        .bind(FramebufferTarget::ReadDraw);
+
+    constexpr Vector2 positions[]{{-0.5f, -0.5f}, {0.5f, -0.5f}, {0.0f, 0.5f}};
+    Buffer buffer;
+    buffer.setData(positions, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(3)
+        .addVertexBuffer(buffer, 0, PointShader::Position{});
+
+    PointShader shader;
+    benchmark("Mesh::draw():", DrawCount, Repeats, [&mesh, &shader]() {
+        for(std::size_t i = 0; i != DrawCount; ++i)
+            mesh.draw(shader);
+    });
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void GLBenchmark::textureSetImage() {
+    Texture2D texture;
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, Vector2i{ImageSize}, _data.data()};
+    benchmark("Texture2D::setImage():", ImageUploads, Repeats, [&texture, &image]() {
+        for(std::size_t i = 0; i != ImageUploads; ++i)
+            texture.setImage(0, TextureFormat::RGBA8, image);
+    });
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void GLBenchmark::textureSetSubImage() {
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, Vector2i{ImageSize});
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, Vector2i{ImageSize}, _data.data()};
+    benchmark("Texture2D::setSubImage():", ImageUploads, Repeats, [&texture, &image]() {
+        for(std::size_t i = 0; i != ImageUploads; ++i)
+            texture.setSubImage(0, {}, image);
+    });
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void GLBenchmark::framebufferRead() {
+    Renderbuffer renderbuffer;
+    renderbuffer.setStorage(RenderbufferFormat::RGBA8, Vector2i{ImageSize});
+    Framebuffer framebuffer{{{}, Vector2i{ImageSize}}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment(0), renderbuffer);
+
+    Image2D image{ColorFormat::RGBA, ColorType::UnsignedByte};
+    benchmark("Framebuffer::read() into Image:", ImageUploads, Repeats, [&framebuffer, &image]() {
+        for(std::size_t i = 0; i != ImageUploads; ++i)
+            framebuffer.read({{}, Vector2i{ImageSize}}, image);
+    });
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(image.size(), Vector2i{ImageSize});
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void GLBenchmark::framebufferReadBuffer() {
+    Renderbuffer renderbuffer;
+    renderbuffer.setStorage(RenderbufferFormat::RGBA8, Vector2i{ImageSize});
+    Framebuffer framebuffer{{{}, Vector2i{ImageSize}}};
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment(0), renderbuffer);
+
+    /* Only the asynchronous part of the readback is measured, mapping the
+       buffer afterwards would stall on the transfer */
+    BufferImage2D image{ColorFormat::RGBA, ColorType::UnsignedByte};
+    benchmark("Framebuffer::read() into BufferImage:", ImageUploads, Repeats, [&framebuffer, &image]() {
+        for(std::size_t i = 0; i != ImageUploads; ++i)
+            framebuffer.read({{}, Vector2i{ImageSize}}, image, BufferUsage::StreamRead);
+    });
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(image.size(), Vector2i{ImageSize});
+}
+#endif
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::GLBenchmark)
@@ -0,0 +1,169 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/GeometryPool.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct GeometryPoolGLTest: AbstractOpenGLTester {
+    explicit GeometryPoolGLTest();
+
+    void construct();
+    void allocate();
+    void allocateFull();
+    void freeMerge();
+    void defragment();
+};
+
+GeometryPoolGLTest::GeometryPoolGLTest() {
+    addTests({&GeometryPoolGLTest::construct,
+              &GeometryPoolGLTest::allocate,
+              &GeometryPoolGLTest::allocateFull,
+              &GeometryPoolGLTest::freeMerge,
+              &GeometryPoolGLTest::defragment});
+}
+
+void GeometryPoolGLTest::construct() {
+    {
+        GeometryPool pool{12, 100, Mesh::IndexType::UnsignedShort, 300};
+
+        MAGNUM_VERIFY_NO_ERROR();
+        CORRADE_VERIFY(pool.vertexBuffer().id() > 0);
+        CORRADE_VERIFY(pool.indexBuffer().id() > 0);
+        CORRADE_COMPARE(pool.vertexStride(), 12);
+        CORRADE_COMPARE(pool.vertexCapacity(), 100);
+        CORRADE_COMPARE(pool.indexCapacity(), 300);
+        CORRADE_COMPARE(pool.vertexBuffer().size(), 1200);
+        CORRADE_COMPARE(pool.indexBuffer().size(), 600);
+        CORRADE_COMPARE(pool.vertexCount(), 0);
+        CORRADE_COMPARE(pool.allocationCount(), std::size_t(0));
+        CORRADE_COMPARE(pool.mesh().indexSize(), std::size_t(2));
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void GeometryPoolGLTest::allocate() {
+    GeometryPool pool{4, 100, Mesh::IndexType::UnsignedShort, 300};
+
+    const GeometryPool::Handle a = pool.allocate(10, 30);
+    const GeometryPool::Handle b = pool.allocate(20, 60);
+    CORRADE_COMPARE(a, 0);
+    CORRADE_COMPARE(b, 1);
+    CORRADE_COMPARE(pool.allocation(b).vertexOffset, 10);
+    CORRADE_COMPARE(pool.allocation(b).vertexCount, 20);
+    CORRADE_COMPARE(pool.allocation(b).indexOffset, 30);
+    CORRADE_COMPARE(pool.allocation(b).indexCount, 60);
+    CORRADE_COMPARE(pool.vertexCount(), 30);
+    CORRADE_COMPARE(pool.indexCount(), 90);
+
+    constexpr UnsignedInt vertices[]{0xdeadbeef, 0xcafebabe};
+    pool.setVertexData(b, vertices);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<UnsignedInt> data = pool.vertexBuffer().subData<UnsignedInt>(40, 2);
+    CORRADE_COMPARE(data[0], 0xdeadbeef);
+    CORRADE_COMPARE(data[1], 0xcafebabe);
+    #endif
+
+    /* Freed handles are reused */
+    pool.free(a);
+    CORRADE_COMPARE(pool.allocationCount(), std::size_t(1));
+    CORRADE_COMPARE(pool.allocate(5, 15), a);
+    CORRADE_COMPARE(pool.allocation(a).vertexOffset, 0);
+}
+
+void GeometryPoolGLTest::allocateFull() {
+    GeometryPool pool{4, 100};
+
+    CORRADE_VERIFY(pool.allocate(60) != GeometryPool::invalidHandle);
+    CORRADE_COMPARE(pool.allocate(50), GeometryPool::invalidHandle);
+    CORRADE_VERIFY(pool.allocate(40) != GeometryPool::invalidHandle);
+    CORRADE_COMPARE(pool.allocate(1), GeometryPool::invalidHandle);
+}
+
+void GeometryPoolGLTest::freeMerge() {
+    GeometryPool pool{4, 90};
+
+    const GeometryPool::Handle a = pool.allocate(30);
+    const GeometryPool::Handle b = pool.allocate(30);
+    const GeometryPool::Handle c = pool.allocate(30);
+
+    /* Freeing the outer ones and then the middle one merges all three */
+    pool.free(a);
+    pool.free(c);
+    pool.free(b);
+    const GeometryPool::Handle d = pool.allocate(90);
+    CORRADE_VERIFY(d != GeometryPool::invalidHandle);
+    CORRADE_COMPARE(pool.allocation(d).vertexOffset, 0);
+}
+
+void GeometryPoolGLTest::defragment() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::copy_buffer>())
+        CORRADE_SKIP(Extensions::GL::ARB::copy_buffer::string() + std::string(" is not supported."));
+    #endif
+
+    GeometryPool pool{4, 4};
+    const GeometryPool::Handle a = pool.allocate(1);
+    const GeometryPool::Handle b = pool.allocate(1);
+    const GeometryPool::Handle c = pool.allocate(1);
+    const GeometryPool::Handle d = pool.allocate(1);
+
+    constexpr UnsignedInt dataB[]{0xbbbbbbbb};
+    constexpr UnsignedInt dataD[]{0xdddddddd};
+    pool.setVertexData(b, dataB)
+        .setVertexData(d, dataD);
+    const GLuint id = pool.vertexBuffer().id();
+
+    /* Two free vertices, but not contiguous */
+    pool.free(a);
+    pool.free(c);
+    const GeometryPool::Handle e = pool.allocate(2);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(e != GeometryPool::invalidHandle);
+
+    /* The buffer stays the same, the ranges are moved to the beginning */
+    CORRADE_COMPARE(pool.vertexBuffer().id(), id);
+    CORRADE_COMPARE(pool.allocation(b).vertexOffset, 0);
+    CORRADE_COMPARE(pool.allocation(d).vertexOffset, 1);
+    CORRADE_COMPARE(pool.allocation(e).vertexOffset, 2);
+
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<UnsignedInt> data = pool.vertexBuffer().subData<UnsignedInt>(0, 2);
+    CORRADE_COMPARE(data[0], 0xbbbbbbbb);
+    CORRADE_COMPARE(data[1], 0xdddddddd);
+    #endif
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::GeometryPoolGLTest)
@@ -34,12 +34,18 @@ struct ImageReferenceTest: TestSuite::Tester {
     explicit ImageReferenceTest();
 
     void construct();
+    void constructStorage();
     void setData();
+    void constructCompressed();
+    void setDataCompressed();
 };
 
 ImageReferenceTest::ImageReferenceTest() {
     addTests({&ImageReferenceTest::construct,
-              &ImageReferenceTest::setData});
+              &ImageReferenceTest::constructStorage,
+              &ImageReferenceTest::setData,
+              &ImageReferenceTest::constructCompressed,
+              &ImageReferenceTest::setDataCompressed});
 }
 
 void ImageReferenceTest::construct() {
@@ -52,6 +58,19 @@ void ImageReferenceTest::construct() {
     CORRADE_COMPARE(a.data(), data);
 }
 
+void ImageReferenceTest::constructStorage() {
+    const char data[12] = {};
+    ImageReference2D a{PixelStorage{}.setAlignment(1),
+        ColorFormat::Red, ColorType::UnsignedByte, {3, 4}, data};
+
+    CORRADE_COMPARE(a.storage().alignment(), 1);
+    CORRADE_COMPARE(a.format(), ColorFormat::Red);
+    CORRADE_COMPARE(a.type(), ColorType::UnsignedByte);
+    CORRADE_COMPARE(a.size(), Vector2i(3, 4));
+    CORRADE_COMPARE(a.data(), data);
+    CORRADE_COMPARE(a.dataSize(a.size()), 12);
+}
+
 void ImageReferenceTest::setData() {
     const char data[3] = {};
     ImageReference2D a(ColorFormat::Red, ColorType::UnsignedByte, {1, 3}, data);
@@ -64,6 +83,28 @@ void ImageReferenceTest::setData() {
     CORRADE_COMPARE(a.data(), data2);
 }
 
+void ImageReferenceTest::constructCompressed() {
+    const char data[8] = {};
+    CompressedImageReference2D a(CompressedColorFormat::RGBAS3tcDxt1, {4, 4}, data);
+
+    CORRADE_COMPARE(a.format(), CompressedColorFormat::RGBAS3tcDxt1);
+    CORRADE_COMPARE(a.size(), Vector2i(4, 4));
+    CORRADE_COMPARE(a.data().data(), data);
+    CORRADE_COMPARE(a.data().size(), 8);
+}
+
+void ImageReferenceTest::setDataCompressed() {
+    const char data[8] = {};
+    CompressedImageReference2D a(CompressedColorFormat::RGBAS3tcDxt1, {4, 4}, data);
+    const char data2[16] = {};
+    a.setData(data2);
+
+    CORRADE_COMPARE(a.format(), CompressedColorFormat::RGBAS3tcDxt1);
+    CORRADE_COMPARE(a.size(), Vector2i(4, 4));
+    CORRADE_COMPARE(a.data().data(), data2);
+    CORRADE_COMPARE(a.data().size(), 16);
+}
+
 }}
 
 CORRADE_TEST_MAIN(Magnum::Test::ImageReferenceTest)
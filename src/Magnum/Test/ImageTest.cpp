@@ -34,20 +34,24 @@ struct ImageTest: TestSuite::Tester {
     explicit ImageTest();
 
     void construct();
+    void constructCustomDeleter();
     void constructCopy();
     void constructMove();
 
     void setData();
+    void setDataCustomDeleter();
     void toReference();
     void release();
 };
 
 ImageTest::ImageTest() {
     addTests({&ImageTest::construct,
+              &ImageTest::constructCustomDeleter,
               &ImageTest::constructCopy,
               &ImageTest::constructMove,
 
               &ImageTest::setData,
+              &ImageTest::setDataCustomDeleter,
               &ImageTest::toReference,
               &ImageTest::release});
 }
@@ -62,6 +66,36 @@ void ImageTest::construct() {
     CORRADE_COMPARE(a.data(), data);
 }
 
+namespace {
+    char* deletedData;
+    std::size_t deletedSize;
+
+    void deleter(char* data, std::size_t size) {
+        deletedData = data;
+        deletedSize = size;
+    }
+}
+
+void ImageTest::constructCustomDeleter() {
+    deletedData = nullptr;
+    deletedSize = 0;
+
+    char data[4*2];
+    {
+        Image2D a(ColorFormat::RG, ColorType::UnsignedByte, {2, 2}, data, deleter);
+        CORRADE_COMPARE(a.data(), data);
+        CORRADE_VERIFY(a.deleter() == deleter);
+
+        /* Moving should transfer the deleter as well */
+        Image2D b(std::move(a));
+        CORRADE_VERIFY(!a.deleter());
+        CORRADE_VERIFY(b.deleter() == deleter);
+    }
+
+    CORRADE_VERIFY(deletedData == data);
+    CORRADE_COMPARE(deletedSize, std::size_t(4*2));
+}
+
 void ImageTest::constructCopy() {
     CORRADE_VERIFY(!(std::is_constructible<Image2D, const Image2D&>{}));
     CORRADE_VERIFY(!(std::is_assignable<Image2D, const Image2D&>{}));
@@ -105,6 +139,20 @@ void ImageTest::setData() {
     CORRADE_COMPARE(a.data(), data2);
 }
 
+void ImageTest::setDataCustomDeleter() {
+    deletedData = nullptr;
+    deletedSize = 0;
+
+    char data[3*4];
+    Image2D a(ColorFormat::RGB, ColorType::UnsignedByte, {1, 3}, data, deleter);
+
+    /* Previous data should be freed using previous deleter */
+    a.setData(ColorFormat::Red, ColorType::UnsignedByte, {1, 1}, new char[4]);
+    CORRADE_VERIFY(deletedData == data);
+    CORRADE_COMPARE(deletedSize, std::size_t(3*4));
+    CORRADE_VERIFY(!a.deleter());
+}
+
 void ImageTest::toReference() {
     auto data = new char[3];
     const Image2D a(ColorFormat::Red, ColorType::UnsignedByte, {1, 3}, data);
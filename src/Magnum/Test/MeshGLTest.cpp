@@ -127,11 +127,14 @@ struct MeshGLTest: AbstractOpenGLTester {
     #ifndef MAGNUM_TARGET_GLES
     void addVertexBufferInstancedDouble();
     #endif
+    void drawAfterInstanced();
 
     void multiDraw();
     void multiDrawIndexed();
     #ifndef MAGNUM_TARGET_GLES
     void multiDrawBaseVertex();
+    void multiDrawIndirect();
+    void multiDrawIndirectIndexed();
     #endif
 };
 
@@ -217,11 +220,14 @@ MeshGLTest::MeshGLTest() {
               #ifndef MAGNUM_TARGET_GLES
               &MeshGLTest::addVertexBufferInstancedDouble,
               #endif
+              &MeshGLTest::drawAfterInstanced,
 
               &MeshGLTest::multiDraw,
               &MeshGLTest::multiDrawIndexed,
               #ifndef MAGNUM_TARGET_GLES
-              &MeshGLTest::multiDrawBaseVertex
+              &MeshGLTest::multiDrawBaseVertex,
+              &MeshGLTest::multiDrawIndirect,
+              &MeshGLTest::multiDrawIndirectIndexed
               #endif
               });
 }
@@ -1706,7 +1712,7 @@ void MeshGLTest::addVertexBufferInstancedDouble() {
 
 namespace {
     struct MultiChecker {
-        MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh);
+        MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh, bool indirect = false);
 
         template<class T> T get(ColorFormat format, ColorType type);
 
@@ -1716,7 +1722,7 @@ namespace {
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
-MultiChecker::MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh): framebuffer({{}, Vector2i(1)}) {
+MultiChecker::MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh, const bool indirect): framebuffer({{}, Vector2i(1)}) {
     renderbuffer.setStorage(
         #ifndef MAGNUM_TARGET_GLES2
         RenderbufferFormat::RGBA8,
@@ -1742,7 +1748,17 @@ MultiChecker::MultiChecker(AbstractShaderProgram&& shader, Mesh& mesh): framebuf
          .setIndexRange(1);
     } else b.setBaseVertex(1);
 
-    MeshView::draw(shader, {a, b});
+    #ifndef MAGNUM_TARGET_GLES
+    if(indirect) {
+        Buffer indirectBuffer{Buffer::TargetHint::DrawIndirect};
+        MeshView::drawIndirect(shader, {a, b}, indirectBuffer);
+    } else
+    #else
+    static_cast<void>(indirect);
+    #endif
+    {
+        MeshView::draw(shader, {a, b});
+    }
 }
 
 template<class T> T MultiChecker::get(ColorFormat format, ColorType type) {
@@ -1750,6 +1766,58 @@ template<class T> T MultiChecker::get(ColorFormat format, ColorType type) {
 }
 #endif
 
+void MeshGLTest::drawAfterInstanced() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::draw_instanced>())
+        CORRADE_SKIP(Extensions::GL::ARB::draw_instanced::string() + std::string(" is not available."));
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::instanced_arrays>())
+        CORRADE_SKIP(Extensions::GL::ARB::instanced_arrays::string() + std::string(" is not available."));
+    #elif defined(MAGNUM_TARGET_GLES2)
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ANGLE::instanced_arrays>() && !Context::current()->isExtensionSupported<Extensions::GL::EXT::instanced_arrays>() && !Context::current()->isExtensionSupported<Extensions::GL::NV::instanced_arrays>())
+        CORRADE_SKIP("Required instancing extension is not available.");
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ANGLE::instanced_arrays>() && !Context::current()->isExtensionSupported<Extensions::GL::EXT::draw_instanced>() && !Context::current()->isExtensionSupported<Extensions::GL::NV::draw_instanced>())
+        CORRADE_SKIP("Required drawing extension is not available.");
+    #endif
+
+    typedef Attribute<0, Float> Attribute;
+
+    const Float data[] = { 0.0f, -0.7f, Math::normalize<Float, UnsignedByte>(96) };
+    Buffer buffer;
+    buffer.setData(data, BufferUsage::StaticDraw);
+
+    /* Draw an instanced mesh first, so the attribute at the same location has
+       a divisor set */
+    Mesh instanced;
+    instanced.setInstanceCount(2)
+        .addVertexBufferInstanced(buffer, 1, 4, Attribute{});
+    Checker(FloatShader("float", "vec4(valueInterpolated, 0.0, 0.0, 0.0)"),
+        #ifndef MAGNUM_TARGET_GLES2
+        RenderbufferFormat::RGBA8,
+        #else
+        RenderbufferFormat::RGBA4,
+        #endif
+        instanced);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* The divisor must not leak into non-instanced mesh using the same
+       buffer and location */
+    Mesh mesh;
+    mesh.setBaseVertex(1)
+        .addVertexBuffer(buffer, 4, Attribute{});
+
+    const auto value = Checker(FloatShader("float", "vec4(valueInterpolated, 0.0, 0.0, 0.0)"),
+        #ifndef MAGNUM_TARGET_GLES2
+        RenderbufferFormat::RGBA8,
+        #else
+        RenderbufferFormat::RGBA4,
+        #endif
+        mesh).get<UnsignedByte>(ColorFormat::RGBA, ColorType::UnsignedByte);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(value, 96);
+}
+
 void MeshGLTest::multiDraw() {
     #ifdef MAGNUM_TARGET_GLES
     if(!Context::current()->isExtensionSupported<Extensions::GL::EXT::multi_draw_arrays>())
@@ -1825,6 +1893,52 @@ void MeshGLTest::multiDrawBaseVertex() {
     MAGNUM_VERIFY_NO_ERROR();
     CORRADE_COMPARE(value, indexedResult);
 }
+
+void MeshGLTest::multiDrawIndirect() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::multi_draw_indirect>())
+        Debug() << Extensions::GL::ARB::multi_draw_indirect::string() << "not supported, using fallback implementation";
+
+    typedef Attribute<0, Float> Attribute;
+
+    const Float data[] = { 0.0f, -0.7f, Math::normalize<Float, UnsignedByte>(96) };
+    Buffer buffer;
+    buffer.setData(data, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.addVertexBuffer(buffer, 4, Attribute());
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    const auto value = MultiChecker(FloatShader("float", "vec4(valueInterpolated, 0.0, 0.0, 0.0)"),
+        mesh, true).get<UnsignedByte>(ColorFormat::RGBA, ColorType::UnsignedByte);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(value, 96);
+}
+
+void MeshGLTest::multiDrawIndirectIndexed() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::multi_draw_indirect>())
+        Debug() << Extensions::GL::ARB::multi_draw_indirect::string() << "not supported, using fallback implementation";
+
+    Buffer vertices;
+    vertices.setData(indexedVertexData, BufferUsage::StaticDraw);
+
+    constexpr UnsignedShort indexData[] = { 2, 1, 0 };
+    Buffer indices{Buffer::TargetHint::ElementArray};
+    indices.setData(indexData, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.addVertexBuffer(vertices, 1*4,  MultipleShader::Position(),
+                         MultipleShader::Normal(), MultipleShader::TextureCoordinates())
+        .setIndexBuffer(indices, 2, Mesh::IndexType::UnsignedShort);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    const auto value = MultiChecker(MultipleShader{}, mesh, true).get<Color4ub>(ColorFormat::RGBA, ColorType::UnsignedByte);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(value, indexedResult);
+}
 #endif
 
 }}
@@ -0,0 +1,155 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/AbstractShaderProgram.h"
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Image.h"
+#include "Magnum/OcclusionCuller.h"
+#include "Magnum/PrimitiveQuery.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/Shader.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct OcclusionCullerGLTest: AbstractOpenGLTester {
+    explicit OcclusionCullerGLTest();
+
+    void depthPyramid();
+    void cull();
+};
+
+OcclusionCullerGLTest::OcclusionCullerGLTest() {
+    addTests({&OcclusionCullerGLTest::depthPyramid,
+              &OcclusionCullerGLTest::cull});
+}
+
+namespace {
+    struct PointShader: AbstractShaderProgram {
+        typedef Attribute<0, Vector3> Position;
+
+        explicit PointShader() {
+            Shader vert{Version::GL300, Shader::Type::Vertex};
+            CORRADE_INTERNAL_ASSERT_OUTPUT(vert.addSource(
+                "in vec3 position;\n"
+                "void main() {\n"
+                "    gl_Position = vec4(position, 1.0);\n"
+                "}\n").compile());
+            attachShader(vert);
+            bindAttributeLocation(Position::Location, "position");
+            CORRADE_INTERNAL_ASSERT_OUTPUT(link());
+        }
+    };
+
+    /* Odd size to test the conservative reduction */
+    constexpr Vector2i Size{33, 17};
+
+    void clearDepth(Texture2D& depth, Float value) {
+        depth.setStorage(1, TextureFormat::DepthComponent32F, Size);
+        Framebuffer framebuffer{{{}, Size}};
+        framebuffer.attachTexture(Framebuffer::BufferAttachment::Depth, depth, 0);
+        Renderer::setClearDepth(value);
+        framebuffer.clear(FramebufferClear::Depth);
+    }
+}
+
+void OcclusionCullerGLTest::depthPyramid() {
+    if(!Context::current()->isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported.");
+
+    OcclusionCuller culler{Size};
+    if(culler.isQueryFallback())
+        CORRADE_SKIP("The culler uses sample query fallback.");
+
+    CORRADE_COMPARE(culler.depthPyramidLevelCount(), 6);
+
+    Texture2D depth;
+    clearDepth(depth, 0.75f);
+    culler.buildDepthPyramid(depth);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    Image2D image = culler.depthPyramid().image(5, {ColorFormat::Red, ColorType::Float});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(image.size(), Vector2i(1));
+    CORRADE_COMPARE(image.data<Float>()[0], 0.75f);
+}
+
+void OcclusionCullerGLTest::cull() {
+    if(!Context::current()->isVersionSupported(Version::GL300))
+        CORRADE_SKIP("OpenGL 3.0 is not supported.");
+
+    OcclusionCuller culler{Size};
+    if(culler.isQueryFallback())
+        CORRADE_SKIP("The culler uses sample query fallback.");
+
+    Texture2D depth;
+    clearDepth(depth, 0.5f);
+    culler.buildDepthPyramid(depth);
+
+    const Vector3 data[]{{}, {}};
+    Buffer vertices;
+    vertices.setData(data, BufferUsage::StaticDraw);
+
+    Mesh mesh;
+    mesh.setPrimitive(MeshPrimitive::Points)
+        .addVertexBuffer(vertices, 0, PointShader::Position{});
+
+    MeshView a{mesh}, b{mesh};
+    a.setCount(1);
+    b.setCount(1).setBaseVertex(1);
+
+    /* The first box is in front of the depth buffer contents, the second
+       behind */
+    const Range3D boxes[]{
+        {{-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, -0.2f}},
+        {{-0.5f, -0.5f, 0.4f}, {0.5f, 0.5f, 0.6f}}
+    };
+    culler.setMeshes({a, b}, boxes);
+    culler.cull(Matrix4{});
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    PointShader shader;
+    PrimitiveQuery q{PrimitiveQuery::Target::PrimitivesGenerated};
+    Renderer::enable(Renderer::Feature::RasterizerDiscard);
+    q.begin();
+    culler.draw(shader);
+    q.end();
+    Renderer::disable(Renderer::Feature::RasterizerDiscard);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(q.result<UnsignedInt>(), 1);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::OcclusionCullerGLTest)
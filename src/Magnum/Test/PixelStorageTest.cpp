@@ -0,0 +1,162 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/PixelStorage.h"
+
+namespace Magnum { namespace Test {
+
+struct PixelStorageTest: TestSuite::Tester {
+    explicit PixelStorageTest();
+
+    void construct();
+    void compare();
+    void setAlignmentInvalid();
+
+    void dataPropertiesAlignment();
+    #ifndef MAGNUM_TARGET_GLES2
+    void dataPropertiesRowLength();
+    void dataPropertiesImageHeight();
+    void dataPropertiesSkip();
+    #endif
+
+    void dataSize();
+    void dataSizeEmpty();
+    #ifndef MAGNUM_TARGET_GLES2
+    void dataSizeSkip();
+    #endif
+};
+
+typedef Math::Vector2<std::size_t> Vector2st;
+
+PixelStorageTest::PixelStorageTest() {
+    addTests({&PixelStorageTest::construct,
+              &PixelStorageTest::compare,
+              &PixelStorageTest::setAlignmentInvalid,
+
+              &PixelStorageTest::dataPropertiesAlignment,
+              #ifndef MAGNUM_TARGET_GLES2
+              &PixelStorageTest::dataPropertiesRowLength,
+              &PixelStorageTest::dataPropertiesImageHeight,
+              &PixelStorageTest::dataPropertiesSkip,
+              #endif
+
+              &PixelStorageTest::dataSize,
+              &PixelStorageTest::dataSizeEmpty,
+              #ifndef MAGNUM_TARGET_GLES2
+              &PixelStorageTest::dataSizeSkip
+              #endif
+              });
+}
+
+void PixelStorageTest::construct() {
+    constexpr PixelStorage storage;
+
+    constexpr Int alignment = storage.alignment();
+    CORRADE_COMPARE(alignment, 4);
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_COMPARE(storage.rowLength(), 0);
+    CORRADE_COMPARE(storage.imageHeight(), 0);
+    CORRADE_COMPARE(storage.skip(), Vector3i{});
+    #endif
+}
+
+void PixelStorageTest::compare() {
+    CORRADE_VERIFY(PixelStorage{} == PixelStorage{});
+    CORRADE_VERIFY(PixelStorage{}.setAlignment(1) != PixelStorage{});
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_VERIFY(PixelStorage{}.setRowLength(15) != PixelStorage{});
+    CORRADE_VERIFY(PixelStorage{}.setSkip({1, 0, 0}) != PixelStorage{});
+    #endif
+}
+
+void PixelStorageTest::setAlignmentInvalid() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    PixelStorage storage;
+    storage.setAlignment(3);
+    CORRADE_COMPARE(storage.alignment(), 4);
+    CORRADE_COMPARE(out.str(), "PixelStorage::setAlignment(): expected 1, 2, 4 or 8, got 3\n");
+}
+
+void PixelStorageTest::dataPropertiesAlignment() {
+    /* Three-byte pixels, row of 3 pixels padded from 9 to 12 bytes */
+    CORRADE_COMPARE(PixelStorage{}.dataProperties(3, {3, 2, 1}),
+        (std::pair<std::size_t, Vector2st>{0, {12, 24}}));
+
+    /* No padding with alignment 1 */
+    CORRADE_COMPARE(PixelStorage{}.setAlignment(1).dataProperties(3, {3, 2, 1}),
+        (std::pair<std::size_t, Vector2st>{0, {9, 18}}));
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void PixelStorageTest::dataPropertiesRowLength() {
+    CORRADE_COMPARE(PixelStorage{}.setRowLength(15).dataProperties(4, {3, 2, 1}),
+        (std::pair<std::size_t, Vector2st>{0, {60, 120}}));
+}
+
+void PixelStorageTest::dataPropertiesImageHeight() {
+    CORRADE_COMPARE(PixelStorage{}.setImageHeight(7).dataProperties(4, {3, 2, 2}),
+        (std::pair<std::size_t, Vector2st>{0, {12, 84}}));
+}
+
+void PixelStorageTest::dataPropertiesSkip() {
+    CORRADE_COMPARE(PixelStorage{}
+        .setRowLength(16)
+        .setImageHeight(8)
+        .setSkip({2, 3, 1}).dataProperties(4, {3, 2, 2}),
+        (std::pair<std::size_t, Vector2st>{512 + 3*64 + 2*4, {64, 512}}));
+}
+#endif
+
+void PixelStorageTest::dataSize() {
+    CORRADE_COMPARE(PixelStorage{}.dataSize(3, {3, 2, 1}), 24);
+    CORRADE_COMPARE(PixelStorage{}.dataSize(3, {3, 2, 3}), 72);
+    CORRADE_COMPARE(PixelStorage{}.setAlignment(1).dataSize(3, {3, 2, 1}), 18);
+}
+
+void PixelStorageTest::dataSizeEmpty() {
+    CORRADE_COMPARE(PixelStorage{}.dataSize(4, {0, 2, 1}), 0);
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void PixelStorageTest::dataSizeSkip() {
+    /* 3x2 tile at (2, 3) of a 16 pixel wide image, the last row is counted
+       whole */
+    CORRADE_COMPARE(PixelStorage{}
+        .setRowLength(16)
+        .setSkip({2, 3, 0}).dataSize(4, {3, 2, 1}), 4*64 + 64);
+
+    /* Skip going past the row length extends the last row */
+    CORRADE_COMPARE(PixelStorage{}
+        .setSkip({4, 0, 0}).dataSize(1, {4, 2, 1}), 4 + 8);
+}
+#endif
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::PixelStorageTest)
@@ -0,0 +1,171 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <vector>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/QueryPool.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/TimeQuery.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct QueryPoolGLTest: AbstractOpenGLTester {
+    explicit QueryPoolGLTest();
+
+    void deliver();
+    void recycle();
+    void maxLatency();
+    void discardPending();
+};
+
+QueryPoolGLTest::QueryPoolGLTest() {
+    addTests({&QueryPoolGLTest::deliver,
+              &QueryPoolGLTest::recycle,
+              &QueryPoolGLTest::maxLatency,
+              &QueryPoolGLTest::discardPending});
+}
+
+namespace {
+    bool timerQuerySupported() {
+        #ifndef MAGNUM_TARGET_GLES
+        return Context::current()->isExtensionSupported<Extensions::GL::ARB::timer_query>();
+        #else
+        return Context::current()->isExtensionSupported<Extensions::GL::EXT::disjoint_timer_query>();
+        #endif
+    }
+}
+
+void QueryPoolGLTest::deliver() {
+    if(!timerQuerySupported())
+        CORRADE_SKIP("Timer queries are not available");
+
+    QueryPool<TimeQuery> pool{TimeQuery::Target::TimeElapsed};
+    std::vector<UnsignedLong> frames;
+    std::vector<Int> delivered;
+
+    for(Int i = 0; i != 2; ++i) {
+        TimeQuery& q = pool.acquire([&frames, &delivered, i](UnsignedLong frame, QueryPool<TimeQuery>::ResultType) {
+            frames.push_back(frame);
+            delivered.push_back(i);
+        });
+        q.begin();
+        Renderer::finish();
+        q.end();
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.size(), 2);
+    CORRADE_COMPARE(pool.pendingCount(), 2);
+
+    /* Nothing from current frame is delivered */
+    CORRADE_COMPARE(pool.poll(), 0);
+    CORRADE_VERIFY(delivered.empty());
+
+    /* Results of previous frame are delivered in order once available */
+    pool.nextFrame();
+    CORRADE_COMPARE(pool.frame(), 1);
+    pool.finish();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.pendingCount(), 0);
+    CORRADE_COMPARE(frames, (std::vector<UnsignedLong>{0, 0}));
+    CORRADE_COMPARE(delivered, (std::vector<Int>{0, 1}));
+}
+
+void QueryPoolGLTest::recycle() {
+    if(!timerQuerySupported())
+        CORRADE_SKIP("Timer queries are not available");
+
+    QueryPool<TimeQuery> pool{TimeQuery::Target::TimeElapsed};
+    Int delivered = 0;
+
+    for(Int frame = 0; frame != 5; ++frame) {
+        TimeQuery& q = pool.acquire([&delivered](UnsignedLong, QueryPool<TimeQuery>::ResultType) { ++delivered; });
+        q.begin();
+        q.end();
+        pool.finish();
+        pool.nextFrame();
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(delivered, 5);
+
+    /* The same query object is reused every frame */
+    CORRADE_COMPARE(pool.size(), 1);
+}
+
+void QueryPoolGLTest::maxLatency() {
+    if(!timerQuerySupported())
+        CORRADE_SKIP("Timer queries are not available");
+
+    QueryPool<TimeQuery> pool{TimeQuery::Target::TimeElapsed, 1};
+    CORRADE_COMPARE(pool.maxLatency(), 1);
+    bool delivered = false;
+
+    TimeQuery& q = pool.acquire([&delivered](UnsignedLong, QueryPool<TimeQuery>::ResultType) { delivered = true; });
+    q.begin();
+    q.end();
+
+    /* One frame later the result is waited for */
+    CORRADE_COMPARE(pool.nextFrame(), 1);
+    CORRADE_VERIFY(delivered);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void QueryPoolGLTest::discardPending() {
+    if(!timerQuerySupported())
+        CORRADE_SKIP("Timer queries are not available");
+
+    QueryPool<TimeQuery> pool{TimeQuery::Target::TimeElapsed};
+    bool delivered = false;
+
+    TimeQuery& q = pool.acquire([&delivered](UnsignedLong, QueryPool<TimeQuery>::ResultType) { delivered = true; });
+    q.begin();
+    q.end();
+    pool.discardPending();
+    CORRADE_COMPARE(pool.pendingCount(), 0);
+
+    pool.nextFrame();
+    CORRADE_COMPARE(pool.finish(), 0);
+    CORRADE_VERIFY(!delivered);
+
+    /* The query is reused */
+    TimeQuery& q2 = pool.acquire({});
+    q2.begin();
+    q2.end();
+    CORRADE_COMPARE(pool.size(), 1);
+    CORRADE_COMPARE(pool.finish(), 1);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::QueryPoolGLTest)
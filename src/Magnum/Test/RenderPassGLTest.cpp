@@ -0,0 +1,164 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Color.h"
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Image.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/Renderer.h"
+#include "Magnum/RenderPass.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct RenderPassGLTest: AbstractOpenGLTester {
+    explicit RenderPassGLTest();
+
+    void clear();
+    void load();
+    #ifndef MAGNUM_TARGET_GLES2
+    void resolve();
+    #endif
+};
+
+RenderPassGLTest::RenderPassGLTest() {
+    addTests({&RenderPassGLTest::clear,
+              &RenderPassGLTest::load,
+              #ifndef MAGNUM_TARGET_GLES2
+              &RenderPassGLTest::resolve
+              #endif
+              });
+}
+
+namespace {
+    #ifndef MAGNUM_TARGET_GLES2
+    constexpr RenderbufferFormat RenderbufferColorFormat = RenderbufferFormat::RGBA8;
+    #else
+    constexpr RenderbufferFormat RenderbufferColorFormat = RenderbufferFormat::RGBA4;
+    #endif
+}
+
+void RenderPassGLTest::clear() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    Renderbuffer color, depth;
+    color.setStorage(RenderbufferColorFormat, Vector2i(32));
+    depth.setStorage(RenderbufferFormat::DepthComponent16, Vector2i(32));
+
+    Framebuffer framebuffer({{}, Vector2i(32)});
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment(0), color)
+               .attachRenderbuffer(Framebuffer::BufferAttachment::Depth, depth);
+
+    Renderer::setClearColor(Color4(1.0f, 0.0f, 1.0f, 1.0f));
+
+    RenderPass pass{framebuffer};
+    pass.setColor(RenderPassLoad::Clear, RenderPassStore::Store)
+        .setDepth(RenderPassLoad::Clear, RenderPassStore::DontCare);
+    CORRADE_VERIFY(&pass.framebuffer() == &framebuffer);
+
+    pass.begin();
+    pass.end();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    Image2D image = framebuffer.read({{}, Vector2i{1}}, {ColorFormat::RGBA, ColorType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(image.data<Color4ub>()[0], Color4ub(255, 0, 255, 255));
+}
+
+void RenderPassGLTest::load() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    Renderbuffer color;
+    color.setStorage(RenderbufferColorFormat, Vector2i(32));
+
+    Framebuffer framebuffer({{}, Vector2i(32)});
+    framebuffer.attachRenderbuffer(Framebuffer::ColorAttachment(0), color);
+
+    Renderer::setClearColor(Color4(0.0f, 1.0f, 0.0f, 1.0f));
+    framebuffer.clear(FramebufferClear::Color);
+
+    /* Loading the contents and invalidating nonexistent depth buffer should
+       keep everything as it was */
+    Renderer::setClearColor(Color4(1.0f, 0.0f, 1.0f, 1.0f));
+    RenderPass pass{framebuffer};
+    pass.setDepth(RenderPassLoad::DontCare, RenderPassStore::DontCare);
+    pass.begin();
+    pass.end();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    Image2D image = framebuffer.read({{}, Vector2i{1}}, {ColorFormat::RGBA, ColorType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(image.data<Color4ub>()[0], Color4ub(0, 255, 0, 255));
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void RenderPassGLTest::resolve() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    Renderbuffer multisampled, resolved;
+    multisampled.setStorageMultisample(4, RenderbufferFormat::RGBA8, Vector2i(32));
+    resolved.setStorage(RenderbufferFormat::RGBA8, Vector2i(32));
+
+    Framebuffer source({{}, Vector2i(32)}), destination({{}, Vector2i(32)});
+    source.attachRenderbuffer(Framebuffer::ColorAttachment(0), multisampled);
+    destination.attachRenderbuffer(Framebuffer::ColorAttachment(0), resolved);
+
+    Renderer::setClearColor(Color4(0.0f, 0.0f, 1.0f, 1.0f));
+
+    RenderPass pass{source};
+    pass.setColor(RenderPassLoad::Clear, RenderPassStore::DontCare)
+        .setResolve(destination);
+    pass.begin();
+    pass.end();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    Image2D image = destination.read({{}, Vector2i{1}}, {ColorFormat::RGBA, ColorType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(image.data<Color4ub>()[0], Color4ub(0, 0, 255, 255));
+}
+#endif
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::RenderPassGLTest)
@@ -0,0 +1,210 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Renderbuffer.h"
+#include "Magnum/RenderbufferFormat.h"
+#include "Magnum/RenderTargetPool.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct RenderTargetPoolGLTest: AbstractOpenGLTester {
+    explicit RenderTargetPoolGLTest();
+
+    void texture();
+    void textureDifferent();
+    void renderbuffer();
+    void framebuffer();
+    void release();
+    void nextFrame();
+    void clear();
+};
+
+RenderTargetPoolGLTest::RenderTargetPoolGLTest() {
+    addTests({&RenderTargetPoolGLTest::texture,
+              &RenderTargetPoolGLTest::textureDifferent,
+              &RenderTargetPoolGLTest::renderbuffer,
+              &RenderTargetPoolGLTest::framebuffer,
+              &RenderTargetPoolGLTest::release,
+              &RenderTargetPoolGLTest::nextFrame,
+              &RenderTargetPoolGLTest::clear});
+}
+
+namespace {
+    #ifndef MAGNUM_TARGET_GLES2
+    constexpr TextureFormat ColorTextureFormat = TextureFormat::RGBA8;
+    constexpr RenderbufferFormat RenderbufferColorFormat = RenderbufferFormat::RGBA8;
+    #else
+    constexpr TextureFormat ColorTextureFormat = TextureFormat::RGBA;
+    constexpr RenderbufferFormat RenderbufferColorFormat = RenderbufferFormat::RGBA4;
+    #endif
+}
+
+void RenderTargetPoolGLTest::texture() {
+    RenderTargetPool pool;
+    CORRADE_COMPARE(pool.textureCount(), 0);
+    CORRADE_COMPARE(pool.memoryUsage(), 0);
+
+    Texture2D& a = pool.texture(Vector2i(32), ColorTextureFormat);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.textureCount(), 1);
+    CORRADE_VERIFY(a.id() > 0);
+    CORRADE_COMPARE(a.memoryUsage(), 32*32*4);
+    CORRADE_COMPARE(pool.memoryUsage(), 32*32*4);
+
+    /* The first one is still used, a new one is created */
+    Texture2D& b = pool.texture(Vector2i(32), ColorTextureFormat);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.textureCount(), 2);
+    CORRADE_VERIFY(&a != &b);
+}
+
+void RenderTargetPoolGLTest::textureDifferent() {
+    RenderTargetPool pool;
+
+    Texture2D& a = pool.texture(Vector2i(32), ColorTextureFormat);
+    pool.release(a);
+
+    /* Different size, the released one is not reused */
+    Texture2D& b = pool.texture(Vector2i(16), ColorTextureFormat);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.textureCount(), 2);
+    CORRADE_VERIFY(&a != &b);
+
+    /* Same size, reused */
+    Texture2D& c = pool.texture(Vector2i(32), ColorTextureFormat);
+    CORRADE_COMPARE(pool.textureCount(), 2);
+    CORRADE_COMPARE(&c, &a);
+}
+
+void RenderTargetPoolGLTest::renderbuffer() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    RenderTargetPool pool;
+
+    Renderbuffer& a = pool.renderbuffer(Vector2i(32), RenderbufferColorFormat);
+    pool.release(a);
+    Renderbuffer& b = pool.renderbuffer(Vector2i(32), RenderbufferFormat::DepthComponent16);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.renderbufferCount(), 2);
+    CORRADE_VERIFY(&a != &b);
+
+    Renderbuffer& c = pool.renderbuffer(Vector2i(32), RenderbufferColorFormat);
+    CORRADE_COMPARE(pool.renderbufferCount(), 2);
+    CORRADE_COMPARE(&c, &a);
+    CORRADE_COMPARE(pool.memoryUsage(), a.memoryUsage() + b.memoryUsage());
+}
+
+void RenderTargetPoolGLTest::framebuffer() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    RenderTargetPool pool;
+
+    Framebuffer& framebuffer = pool.framebuffer(Vector2i(32));
+    framebuffer.attachTexture(Framebuffer::ColorAttachment(0), pool.texture(Vector2i(32), ColorTextureFormat), 0)
+        .attachRenderbuffer(Framebuffer::BufferAttachment::Depth, pool.renderbuffer(Vector2i(32), RenderbufferFormat::DepthComponent16));
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.framebufferCount(), 1);
+    CORRADE_COMPARE(framebuffer.viewport(), Range2Di({}, Vector2i(32)));
+    CORRADE_COMPARE(framebuffer.checkStatus(FramebufferTarget::ReadDraw), Framebuffer::Status::Complete);
+}
+
+void RenderTargetPoolGLTest::release() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::framebuffer_object>())
+        CORRADE_SKIP(Extensions::GL::ARB::framebuffer_object::string() + std::string(" is not available."));
+    #endif
+
+    RenderTargetPool pool;
+
+    /* Two passes not overlapping in time share the same targets */
+    Texture2D& a = pool.texture(Vector2i(32), ColorTextureFormat);
+    Framebuffer& fa = pool.framebuffer(Vector2i(32));
+    pool.release(a);
+    pool.release(fa);
+
+    Texture2D& b = pool.texture(Vector2i(32), ColorTextureFormat);
+    Framebuffer& fb = pool.framebuffer(Vector2i(32));
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(&b, &a);
+    CORRADE_COMPARE(&fb, &fa);
+    CORRADE_COMPARE(pool.textureCount(), 1);
+    CORRADE_COMPARE(pool.framebufferCount(), 1);
+}
+
+void RenderTargetPoolGLTest::nextFrame() {
+    RenderTargetPool pool{1};
+
+    Texture2D& a = pool.texture(Vector2i(32), ColorTextureFormat);
+    pool.nextFrame();
+
+    /* Released at the end of the frame, reused */
+    Texture2D& b = pool.texture(Vector2i(32), ColorTextureFormat);
+    CORRADE_COMPARE(&b, &a);
+    pool.nextFrame();
+
+    /* Resized, the old texture is kept for one more frame */
+    pool.texture(Vector2i(16), ColorTextureFormat);
+    pool.nextFrame();
+    CORRADE_COMPARE(pool.textureCount(), 2);
+
+    pool.texture(Vector2i(16), ColorTextureFormat);
+    pool.nextFrame();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.textureCount(), 1);
+    CORRADE_COMPARE(pool.memoryUsage(), 16*16*4);
+}
+
+void RenderTargetPoolGLTest::clear() {
+    RenderTargetPool pool;
+    pool.texture(Vector2i(32), ColorTextureFormat);
+    pool.clear();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(pool.textureCount(), 0);
+    CORRADE_COMPARE(pool.memoryUsage(), 0);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::RenderTargetPoolGLTest)
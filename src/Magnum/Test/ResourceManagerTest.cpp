@@ -23,9 +23,16 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <atomic>
 #include <sstream>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+#include "Magnum/AbstractAsyncResourceLoader.h"
 #include "Magnum/AbstractResourceLoader.h"
 #include "Magnum/ResourceManager.h"
 
@@ -44,7 +51,17 @@ struct ResourceManagerTest: TestSuite::Tester {
     void defaults();
     void clear();
     void clearWhileReferenced();
+    void manyResources();
+    void memoryBudget();
+    void memoryBudgetPriority();
+    void memoryBudgetReferenced();
+    void memoryBudgetLoader();
     void loader();
+    void asyncLoader();
+    void asyncLoaderStop();
+
+    void concurrentAccess();
+    void replaceReferenced();
 };
 
 struct Data {
@@ -69,7 +86,17 @@ ResourceManagerTest::ResourceManagerTest() {
               &ResourceManagerTest::defaults,
               &ResourceManagerTest::clear,
               &ResourceManagerTest::clearWhileReferenced,
-              &ResourceManagerTest::loader});
+              &ResourceManagerTest::manyResources,
+              &ResourceManagerTest::memoryBudget,
+              &ResourceManagerTest::memoryBudgetPriority,
+              &ResourceManagerTest::memoryBudgetReferenced,
+              &ResourceManagerTest::memoryBudgetLoader,
+              &ResourceManagerTest::loader,
+              &ResourceManagerTest::asyncLoader,
+              &ResourceManagerTest::asyncLoaderStop,
+
+              &ResourceManagerTest::concurrentAccess,
+              &ResourceManagerTest::replaceReferenced});
 }
 
 void ResourceManagerTest::state() {
@@ -263,6 +290,158 @@ void ResourceManagerTest::clearWhileReferenced() {
     CORRADE_COMPARE(out.str(), "ResourceManager: cleared/destroyed while data are still referenced\n");
 }
 
+void ResourceManagerTest::manyResources() {
+    ResourceManager rm;
+
+    /* Add enough resources to grow the table a few times, keep references
+       to every tenth of them */
+    std::vector<Resource<Int>> referenced;
+    for(Int i = 0; i != 1000; ++i) {
+        const std::string key = "resource" + std::to_string(i);
+        if(i % 10 == 0) referenced.push_back(rm.get<Int>(key));
+        rm.set(key, i, ResourceDataState::Mutable, ResourcePolicy::Manual);
+    }
+    CORRADE_COMPARE(rm.count<Int>(), 1000);
+
+    /* Free everything that's not referenced, the references stay valid */
+    rm.free<Int>();
+    CORRADE_COMPARE(rm.count<Int>(), 100);
+    for(std::size_t i = 0; i != referenced.size(); ++i)
+        CORRADE_COMPARE(*referenced[i], Int(i*10));
+    CORRADE_COMPARE(rm.state<Int>("resource1"), ResourceState::NotLoaded);
+    CORRADE_COMPARE(rm.state<Int>("resource990"), ResourceState::Mutable);
+
+    /* Reuse the freed entries, updates are visible through the references */
+    for(Int i = 0; i != 1000; ++i)
+        rm.set("resource" + std::to_string(i), -i, ResourceDataState::Final, ResourcePolicy::Manual);
+    CORRADE_COMPARE(rm.count<Int>(), 1000);
+    for(std::size_t i = 0; i != referenced.size(); ++i)
+        CORRADE_COMPARE(*referenced[i], -Int(i*10));
+    CORRADE_COMPARE(*rm.get<Int>("resource537"), -537);
+
+    referenced.clear();
+    rm.free<Int>();
+    CORRADE_COMPARE(rm.count<Int>(), 0);
+}
+
+void ResourceManagerTest::memoryBudget() {
+    ResourceManager rm;
+    CORRADE_COMPARE(rm.memoryBudget<Int>(), 0);
+
+    rm.set("a", 1, ResourceDataState::Final, ResourcePolicy::Manual, 10)
+      .set("b", 2, ResourceDataState::Final, ResourcePolicy::Manual, 20)
+      .set("resident", 3, ResourceDataState::Final, ResourcePolicy::Resident, 30);
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 60);
+
+    /* No budget, nothing evicted */
+    rm.set("c", 4, ResourceDataState::Final, ResourcePolicy::Manual, 40);
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 100);
+    CORRADE_COMPARE(rm.count<Int>(), 4);
+
+    /* Least recently used are evicted first, resident never */
+    rm.setMemoryBudget<Int>(75);
+    CORRADE_COMPARE(rm.memoryBudget<Int>(), 75);
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 70);
+    CORRADE_COMPARE(rm.count<Int>(), 2);
+    CORRADE_COMPARE(rm.state<Int>("a"), ResourceState::NotLoaded);
+    CORRADE_COMPARE(rm.state<Int>("b"), ResourceState::NotLoaded);
+    CORRADE_COMPARE(rm.state<Int>("resident"), ResourceState::Final);
+    CORRADE_COMPARE(rm.state<Int>("c"), ResourceState::Final);
+
+    /* Newly added resource is never evicted right away */
+    rm.set("d", 5, ResourceDataState::Final, ResourcePolicy::Manual, 30);
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 60);
+    CORRADE_COMPARE(rm.state<Int>("c"), ResourceState::NotLoaded);
+    CORRADE_COMPARE(rm.state<Int>("d"), ResourceState::Final);
+
+    /* Freeing updates the usage */
+    rm.free<Int>();
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 30);
+    rm.clear<Int>();
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 0);
+}
+
+void ResourceManagerTest::memoryBudgetPriority() {
+    ResourceManager rm;
+    rm.setMemoryBudget<Int>(30);
+
+    rm.set("important", 1, ResourceDataState::Final, ResourcePolicy::Manual, 10, 1)
+      .set("a", 2, ResourceDataState::Final, ResourcePolicy::Manual, 10)
+      .set("background", 3, ResourceDataState::Final, ResourcePolicy::Manual, 10, -1)
+      .set("b", 4, ResourceDataState::Final, ResourcePolicy::Manual, 10);
+
+    /* Lower priority evicted before more recently used */
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 30);
+    CORRADE_COMPARE(rm.state<Int>("background"), ResourceState::NotLoaded);
+
+    /* Then least recently used of default priority */
+    rm.set("c", 5, ResourceDataState::Mutable, ResourcePolicy::Manual, 10);
+    CORRADE_COMPARE(rm.state<Int>("a"), ResourceState::NotLoaded);
+    CORRADE_COMPARE(rm.state<Int>("important"), ResourceState::Final);
+    CORRADE_COMPARE(rm.state<Int>("b"), ResourceState::Final);
+    CORRADE_COMPARE(rm.state<Int>("c"), ResourceState::Mutable);
+
+    /* Replacing the data updates the size */
+    rm.set("c", 6, ResourceDataState::Final, ResourcePolicy::Manual, 20);
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 30);
+    CORRADE_COMPARE(rm.state<Int>("b"), ResourceState::NotLoaded);
+    CORRADE_COMPARE(rm.state<Int>("important"), ResourceState::Final);
+}
+
+void ResourceManagerTest::memoryBudgetReferenced() {
+    ResourceManager rm;
+    rm.setMemoryBudget<Int>(20);
+
+    {
+        Resource<Int> a = rm.get<Int>("a");
+        rm.set("a", 1, ResourceDataState::Final, ResourcePolicy::Manual, 10)
+          .set("b", 2, ResourceDataState::Final, ResourcePolicy::Manual, 10)
+          .set("c", 3, ResourceDataState::Final, ResourcePolicy::Manual, 10);
+
+        /* Referenced resources are not evicted, even though least recently
+           used */
+        CORRADE_COMPARE(rm.memoryUsage<Int>(), 20);
+        CORRADE_COMPARE(*a, 1);
+        CORRADE_COMPARE(rm.state<Int>("b"), ResourceState::NotLoaded);
+
+        /* Over budget while everything is referenced */
+        Resource<Int> c = rm.get<Int>("c");
+        rm.set("d", 4, ResourceDataState::Final, ResourcePolicy::Manual, 10);
+        CORRADE_COMPARE(rm.memoryUsage<Int>(), 30);
+        CORRADE_COMPARE(*c, 3);
+    }
+
+    /* Released resources are evicted until fitting into the budget again */
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 20);
+    CORRADE_COMPARE(rm.count<Int>(), 2);
+}
+
+void ResourceManagerTest::memoryBudgetLoader() {
+    class IntResourceLoader: public AbstractResourceLoader<Int> {
+        private:
+            void doLoad(ResourceKey key) override {
+                set(key, 42, ResourceDataState::Final, ResourcePolicy::Manual, 10);
+            }
+    };
+
+    ResourceManager rm;
+    auto loader = new IntResourceLoader;
+    rm.setLoader(loader);
+    rm.setMemoryBudget<Int>(10);
+
+    CORRADE_COMPARE(*rm.get<Int>("a"), 42);
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 10);
+    CORRADE_COMPARE(*rm.get<Int>("b"), 42);
+    CORRADE_COMPARE(rm.memoryUsage<Int>(), 10);
+    CORRADE_COMPARE(rm.state<Int>("a"), ResourceState::NotLoaded);
+
+    /* Evicted resource is loaded again on next request */
+    CORRADE_COMPARE(*rm.get<Int>("a"), 42);
+    CORRADE_COMPARE(rm.state<Int>("b"), ResourceState::NotLoaded);
+    CORRADE_COMPARE(loader->requestedCount(), 3);
+    CORRADE_COMPARE(loader->loadedCount(), 3);
+}
+
 void ResourceManagerTest::loader() {
     class IntResourceLoader: public AbstractResourceLoader<Int> {
         public:
@@ -321,6 +500,146 @@ void ResourceManagerTest::loader() {
     CORRADE_COMPARE(Data::count, 0);
 }
 
+namespace {
+    class AsyncIntResourceLoader: public AbstractAsyncResourceLoader<Int, Int> {
+        public:
+            explicit AsyncIntResourceLoader(): AbstractAsyncResourceLoader<Int, Int>{3} {}
+
+            ~AsyncIntResourceLoader() { stop(); }
+
+        private:
+            std::optional<Int> doLoadData(ResourceKey key) override {
+                if(key == ResourceKey("hello")) return 773;
+                if(key == ResourceKey("bye")) return 42;
+                return std::nullopt;
+            }
+
+            void doUpload(ResourceKey key, Int&& data) override {
+                set(key, data*2, ResourceDataState::Final, ResourcePolicy::Resident);
+            }
+    };
+}
+
+void ResourceManagerTest::asyncLoader() {
+    auto rm = new ResourceManager;
+    auto loader = new AsyncIntResourceLoader;
+    rm->setLoader(loader);
+    CORRADE_COMPARE(loader->threadCount(), 3);
+
+    {
+        Resource<Int> hello = rm->get<Int>("hello");
+        Resource<Int> bye = rm->get<Int>("bye");
+        Resource<Int> world = rm->get<Int>("world");
+        CORRADE_COMPARE(hello.state(), ResourceState::Loading);
+        CORRADE_COMPARE(world.state(), ResourceState::Loading);
+        CORRADE_COMPARE(loader->requestedCount(), 3);
+        CORRADE_COMPARE(loader->pendingCount(), 3);
+
+        /* Deliver the resources one by one as they get loaded */
+        std::size_t delivered = 0;
+        while(loader->pendingCount()) {
+            const std::size_t count = loader->update(1);
+            CORRADE_VERIFY(count <= 1);
+            delivered += count;
+        }
+        CORRADE_COMPARE(delivered, 3);
+
+        CORRADE_COMPARE(hello.state(), ResourceState::Final);
+        CORRADE_COMPARE(*hello, 1546);
+        CORRADE_COMPARE(bye.state(), ResourceState::Final);
+        CORRADE_COMPARE(*bye, 84);
+        CORRADE_COMPARE(world.state(), ResourceState::NotFound);
+
+        CORRADE_COMPARE(loader->loadedCount(), 2);
+        CORRADE_COMPARE(loader->notFoundCount(), 1);
+        CORRADE_COMPARE(loader->update(), 0);
+    }
+
+    delete rm;
+}
+
+void ResourceManagerTest::asyncLoaderStop() {
+    ResourceManager rm;
+    AsyncIntResourceLoader loader;
+    rm.setLoader(&loader);
+
+    Resource<Int> hello = rm.get<Int>("hello");
+    loader.stop();
+
+    /* Stopping either loaded the resource or discarded the request, but the
+       resource gets delivered only in update() */
+    CORRADE_COMPARE(hello.state(), ResourceState::Loading);
+    CORRADE_VERIFY(loader.pendingCount() <= 1);
+    while(loader.pendingCount()) loader.update();
+    CORRADE_VERIFY(hello.state() == ResourceState::Loading || hello.state() == ResourceState::Final);
+
+    /* Subsequent requests start the threads again */
+    Resource<Int> bye = rm.get<Int>("bye");
+    while(loader.pendingCount()) loader.update();
+    CORRADE_COMPARE(bye.state(), ResourceState::Final);
+    CORRADE_COMPARE(*bye, 84);
+}
+
+void ResourceManagerTest::concurrentAccess() {
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_SKIP("Threads are not available on Emscripten.");
+    #else
+    ResourceManager rm;
+    for(Int i = 0; i != 100; ++i)
+        rm.set("resource" + std::to_string(i), i, ResourceDataState::Mutable, ResourcePolicy::Manual);
+
+    /* Look up existing resources and add new ones from multiple threads
+       while the data are being replaced. Every thread sees either the
+       original or the replaced value. */
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> threads;
+    for(Int t = 0; t != 4; ++t) threads.emplace_back([&rm, &failed, t]() {
+        for(Int j = 0; j != 1000; ++j) {
+            const Int i = j % 100;
+            Resource<Int> existing = rm.get<Int>("resource" + std::to_string(i));
+            if(!existing || (*existing != i && *existing != -i)) failed = true;
+
+            Resource<Int> added = rm.get<Int>("thread" + std::to_string(t) + "-" + std::to_string(j % 50));
+            if(added.state() != ResourceState::NotLoaded) failed = true;
+        }
+    });
+    for(Int i = 0; i != 100; ++i)
+        rm.set("resource" + std::to_string(i), -i, ResourceDataState::Final, ResourcePolicy::Manual);
+    for(std::thread& thread: threads) thread.join();
+
+    CORRADE_VERIFY(!failed);
+    CORRADE_COMPARE(rm.count<Int>(), 300);
+    for(Int i = 0; i != 100; ++i)
+        CORRADE_COMPARE(*rm.get<Int>("resource" + std::to_string(i)), -i);
+
+    /* Nothing is referenced anymore, everything gets freed */
+    rm.free<Int>();
+    CORRADE_COMPARE(rm.count<Int>(), 0);
+    #endif
+}
+
+void ResourceManagerTest::replaceReferenced() {
+    ResourceManager rm;
+    rm.set("data", new Data, ResourceDataState::Mutable, ResourcePolicy::Resident);
+
+    /* Unreferenced data are deleted right away */
+    rm.set("data", new Data, ResourceDataState::Mutable, ResourcePolicy::Resident);
+    CORRADE_COMPARE(Data::count, 1);
+
+    /* Referenced data are kept until free(), as other threads might be
+       accessing them */
+    {
+        Resource<Data> data = rm.get<Data>("data");
+        const Data* const previous = &*data;
+        rm.set("data", new Data, ResourceDataState::Final, ResourcePolicy::Resident);
+        CORRADE_COMPARE(Data::count, 2);
+        CORRADE_VERIFY(&*data != previous);
+    }
+
+    rm.free();
+    CORRADE_COMPARE(Data::count, 1);
+}
+
 }}
 
 CORRADE_TEST_MAIN(Magnum::Test::ResourceManagerTest)
@@ -0,0 +1,238 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/SamplerCache.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct SamplerCacheGLTest: AbstractOpenGLTester {
+    explicit SamplerCacheGLTest();
+
+    void constructSampler();
+    void constructSamplerMove();
+    void samplerParameters();
+    void samplerBind();
+    void samplerBindMulti();
+
+    void get();
+    void getDifferent();
+    void clear();
+};
+
+SamplerCacheGLTest::SamplerCacheGLTest() {
+    addTests({&SamplerCacheGLTest::constructSampler,
+              &SamplerCacheGLTest::constructSamplerMove,
+              &SamplerCacheGLTest::samplerParameters,
+              &SamplerCacheGLTest::samplerBind,
+              &SamplerCacheGLTest::samplerBindMulti,
+
+              &SamplerCacheGLTest::get,
+              &SamplerCacheGLTest::getDifferent,
+              &SamplerCacheGLTest::clear});
+}
+
+#ifndef MAGNUM_TARGET_GLES
+#define SKIP_IF_NO_SAMPLER_OBJECTS()                                        \
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::sampler_objects>()) \
+        CORRADE_SKIP(Extensions::GL::ARB::sampler_objects::string() + std::string(" is not available"));
+#else
+#define SKIP_IF_NO_SAMPLER_OBJECTS()
+#endif
+
+void SamplerCacheGLTest::constructSampler() {
+    SKIP_IF_NO_SAMPLER_OBJECTS()
+
+    {
+        Sampler sampler;
+
+        MAGNUM_VERIFY_NO_ERROR();
+        CORRADE_VERIFY(sampler.id() > 0);
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void SamplerCacheGLTest::constructSamplerMove() {
+    SKIP_IF_NO_SAMPLER_OBJECTS()
+
+    Sampler a;
+    const GLuint id = a.id();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(id > 0);
+
+    Sampler b{std::move(a)};
+
+    CORRADE_COMPARE(a.id(), 0);
+    CORRADE_COMPARE(b.id(), id);
+
+    Sampler c;
+    const GLuint cId = c.id();
+    c = std::move(b);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(cId > 0);
+    CORRADE_COMPARE(b.id(), cId);
+    CORRADE_COMPARE(c.id(), id);
+}
+
+void SamplerCacheGLTest::samplerParameters() {
+    SKIP_IF_NO_SAMPLER_OBJECTS()
+
+    Sampler sampler;
+    sampler.setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Linear)
+        .setMagnificationFilter(Sampler::Filter::Linear)
+        .setWrapping(Sampler::Wrapping::ClampToEdge)
+        .setMinLod(-750.0f)
+        .setMaxLod(750.0f)
+        #ifndef MAGNUM_TARGET_GLES
+        .setLodBias(0.5f)
+        .setBorderColor(Color4{0.5f})
+        #endif
+        .setMaxAnisotropy(Sampler::maxMaxAnisotropy())
+        .setCompareMode(Sampler::CompareMode::CompareRefToTexture)
+        .setCompareFunction(Sampler::CompareFunction::GreaterOrEqual);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    GLint value;
+    glGetSamplerParameteriv(sampler.id(), GL_TEXTURE_MIN_FILTER, &value);
+    CORRADE_COMPARE(value, GL_LINEAR_MIPMAP_LINEAR);
+    glGetSamplerParameteriv(sampler.id(), GL_TEXTURE_WRAP_R, &value);
+    CORRADE_COMPARE(value, GL_CLAMP_TO_EDGE);
+    glGetSamplerParameteriv(sampler.id(), GL_TEXTURE_COMPARE_FUNC, &value);
+    CORRADE_COMPARE(value, GL_GEQUAL);
+}
+
+void SamplerCacheGLTest::samplerBind() {
+    SKIP_IF_NO_SAMPLER_OBJECTS()
+
+    Sampler sampler;
+    sampler.bind(3);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    Context::current()->setStatisticsEnabled(true);
+    Context::current()->resetStatistics();
+
+    /* Binding again is a no-op */
+    sampler.bind(3);
+    CORRADE_COMPARE(Context::current()->statistics().samplerBinds, 0);
+
+    Sampler::unbind(3);
+    CORRADE_COMPARE(Context::current()->statistics().samplerBinds, 1);
+
+    Context::current()->setStatisticsEnabled(false);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void SamplerCacheGLTest::samplerBindMulti() {
+    SKIP_IF_NO_SAMPLER_OBJECTS()
+
+    Sampler a, b;
+    Sampler::bind(4, {&a, nullptr, &b});
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    GLint value;
+    glActiveTexture(GL_TEXTURE6);
+    glGetIntegerv(GL_SAMPLER_BINDING, &value);
+    CORRADE_COMPARE(GLuint(value), b.id());
+
+    Sampler::unbind(4, 3);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    glGetIntegerv(GL_SAMPLER_BINDING, &value);
+    CORRADE_COMPARE(value, 0);
+
+    /* The active texture unit is tracked, reset the state */
+    Context::current()->resetState(Context::State::Textures);
+}
+
+void SamplerCacheGLTest::get() {
+    SKIP_IF_NO_SAMPLER_OBJECTS()
+
+    SamplerCache cache;
+    CORRADE_COMPARE(cache.size(), 0);
+
+    SamplerCache::Parameters parameters;
+    parameters.minificationFilter = Sampler::Filter::Linear;
+    parameters.wrapping = Sampler::Wrapping::ClampToEdge;
+
+    Sampler& a = cache.get(parameters);
+    Sampler& b = cache.get(parameters);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(cache.size(), 1);
+    CORRADE_COMPARE(&a, &b);
+
+    GLint value;
+    glGetSamplerParameteriv(a.id(), GL_TEXTURE_WRAP_S, &value);
+    CORRADE_COMPARE(value, GL_CLAMP_TO_EDGE);
+}
+
+void SamplerCacheGLTest::getDifferent() {
+    SKIP_IF_NO_SAMPLER_OBJECTS()
+
+    SamplerCache cache;
+
+    SamplerCache::Parameters a;
+    SamplerCache::Parameters b;
+    b.maxLod = 4.0f;
+    SamplerCache::Parameters c;
+    c.wrapping = {Sampler::Wrapping::Repeat, Sampler::Wrapping::Repeat, Sampler::Wrapping::ClampToEdge};
+
+    CORRADE_VERIFY(a != b);
+    CORRADE_VERIFY(a != c);
+
+    cache.bind(0, a).bind(1, b).bind(2, c).bind(3, a);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(cache.size(), 3);
+    CORRADE_VERIFY(&cache.get(a) != &cache.get(b));
+    CORRADE_VERIFY(&cache.get(b) != &cache.get(c));
+}
+
+void SamplerCacheGLTest::clear() {
+    SKIP_IF_NO_SAMPLER_OBJECTS()
+
+    SamplerCache cache;
+    cache.bind(0, {});
+    CORRADE_COMPARE(cache.size(), 1);
+
+    cache.clear();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(cache.size(), 0);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::SamplerCacheGLTest)
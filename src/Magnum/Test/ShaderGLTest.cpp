@@ -47,6 +47,7 @@ struct ShaderGLTest: AbstractOpenGLTester {
     void addSource();
     void addFile();
     void compile();
+    void compileAsync();
 };
 
 ShaderGLTest::ShaderGLTest() {
@@ -59,7 +60,8 @@ ShaderGLTest::ShaderGLTest() {
 
               &ShaderGLTest::addSource,
               &ShaderGLTest::addFile,
-              &ShaderGLTest::compile});
+              &ShaderGLTest::compile,
+              &ShaderGLTest::compileAsync});
 }
 
 void ShaderGLTest::construct() {
@@ -223,6 +225,28 @@ void ShaderGLTest::compile() {
     CORRADE_VERIFY(!shader2.compile());
 }
 
+void ShaderGLTest::compileAsync() {
+    #ifndef MAGNUM_TARGET_GLES
+    constexpr Version v = Version::GL210;
+    #else
+    constexpr Version v = Version::GLES200;
+    #endif
+
+    Shader shader(v, Shader::Type::Fragment);
+    shader.addSource("void main() {}\n");
+    Shader shader2(v, Shader::Type::Fragment);
+    shader2.addSource("[fu] bleh error #:! stuff\n");
+    Shader::submitCompile({shader, shader2});
+
+    /* Without KHR_parallel_shader_compile this is always true, otherwise
+       the compilation eventually finishes */
+    while(!shader.isCompileFinished() || !shader2.isCompileFinished()) {}
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(shader.checkCompile());
+    CORRADE_VERIFY(!shader2.checkCompile());
+}
+
 }}
 
 CORRADE_TEST_MAIN(Magnum::Test::ShaderGLTest)
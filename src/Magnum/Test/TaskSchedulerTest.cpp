@@ -0,0 +1,353 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <thread>
+#endif
+
+#include "Magnum/TaskScheduler.h"
+
+namespace Magnum { namespace Test {
+
+struct TaskSchedulerTest: TestSuite::Tester {
+    explicit TaskSchedulerTest();
+
+    void construct();
+    void setThreadCount();
+    void submit();
+    void submitEmpty();
+    void dependencies();
+    void dependencyFinished();
+    void dependencyOtherScheduler();
+    void waitOtherScheduler();
+    void waitDefault();
+    void parallelFor();
+    void parallelForSerial();
+    void parallelForNested();
+    void mainThreadTask();
+    void mainThreadTaskWait();
+    void mainThreadTaskNotMainThread();
+    void destructorExecutesRemaining();
+    void global();
+};
+
+TaskSchedulerTest::TaskSchedulerTest() {
+    addTests({&TaskSchedulerTest::construct,
+              &TaskSchedulerTest::setThreadCount,
+              &TaskSchedulerTest::submit,
+              &TaskSchedulerTest::submitEmpty,
+              &TaskSchedulerTest::dependencies,
+              &TaskSchedulerTest::dependencyFinished,
+              &TaskSchedulerTest::dependencyOtherScheduler,
+              &TaskSchedulerTest::waitOtherScheduler,
+              &TaskSchedulerTest::waitDefault,
+              &TaskSchedulerTest::parallelFor,
+              &TaskSchedulerTest::parallelForSerial,
+              &TaskSchedulerTest::parallelForNested,
+              &TaskSchedulerTest::mainThreadTask,
+              &TaskSchedulerTest::mainThreadTaskWait,
+              &TaskSchedulerTest::mainThreadTaskNotMainThread,
+              &TaskSchedulerTest::destructorExecutesRemaining,
+              &TaskSchedulerTest::global});
+}
+
+void TaskSchedulerTest::construct() {
+    TaskScheduler scheduler{4};
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_COMPARE(scheduler.threadCount(), 4);
+    #else
+    CORRADE_COMPARE(scheduler.threadCount(), 1);
+    #endif
+    CORRADE_VERIFY(scheduler.isMainThread());
+
+    TaskScheduler hardware;
+    CORRADE_VERIFY(hardware.threadCount() >= 1);
+}
+
+void TaskSchedulerTest::setThreadCount() {
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_SKIP("Threads are not supported on this platform.");
+    #else
+    TaskScheduler scheduler{1};
+    CORRADE_COMPARE(scheduler.threadCount(), 1);
+
+    scheduler.setThreadCount(3);
+    CORRADE_COMPARE(scheduler.threadCount(), 3);
+
+    std::atomic<Int> sum{0};
+    std::vector<Task> tasks;
+    for(Int i = 1; i <= 100; ++i)
+        tasks.push_back(scheduler.submit([&sum, i]() { sum += i; }));
+
+    /* The existing workers finish all scheduled tasks */
+    scheduler.setThreadCount(2);
+    CORRADE_COMPARE(scheduler.threadCount(), 2);
+    for(const Task& task: tasks) CORRADE_VERIFY(task.isDone());
+    CORRADE_COMPARE(sum, 5050);
+    #endif
+}
+
+void TaskSchedulerTest::submit() {
+    TaskScheduler scheduler{4};
+
+    std::atomic<Int> sum{0};
+    std::vector<Task> tasks;
+    for(Int i = 1; i <= 1000; ++i)
+        tasks.push_back(scheduler.submit([&sum, i]() { sum += i; }));
+
+    for(const Task& task: tasks) scheduler.wait(task);
+    for(const Task& task: tasks) CORRADE_VERIFY(task.isDone());
+    CORRADE_COMPARE(sum, 500500);
+}
+
+void TaskSchedulerTest::submitEmpty() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    TaskScheduler scheduler{1};
+    scheduler.submit(nullptr);
+    CORRADE_COMPARE(out.str(), "TaskScheduler::submit(): the function is empty\n");
+}
+
+void TaskSchedulerTest::dependencies() {
+    TaskScheduler scheduler{4};
+
+    std::mutex mutex;
+    std::vector<Int> order;
+    auto record = [&mutex, &order](Int id) {
+        return [&mutex, &order, id]() {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(id);
+        };
+    };
+
+    /* Diamond: 0 -> {1, 2} -> 3 */
+    Task first = scheduler.submit(record(0));
+    Task second = scheduler.submit(record(1), {first});
+    Task third = scheduler.submit(record(2), {first});
+    Task fourth = scheduler.submit(record(3), {second, third});
+
+    scheduler.wait(fourth);
+    CORRADE_VERIFY(first.isDone());
+    CORRADE_VERIFY(second.isDone());
+    CORRADE_VERIFY(third.isDone());
+    CORRADE_COMPARE(order.size(), 4);
+    CORRADE_COMPARE(order.front(), 0);
+    CORRADE_COMPARE(order.back(), 3);
+}
+
+void TaskSchedulerTest::dependencyFinished() {
+    TaskScheduler scheduler{2};
+
+    Task first = scheduler.submit([]() {});
+    scheduler.wait(first);
+    CORRADE_VERIFY(first.isDone());
+
+    /* Default-constructed and already finished dependencies are ignored */
+    bool executed = false;
+    Task second = scheduler.submit([&executed]() { executed = true; }, {first, Task{}});
+    scheduler.wait(second);
+    CORRADE_VERIFY(executed);
+}
+
+void TaskSchedulerTest::dependencyOtherScheduler() {
+    TaskScheduler a{2}, b{2};
+
+    Int value = 0;
+    Task first = a.submit([&value]() { value = 3; });
+    Task second = b.submit([&value]() { value *= 5; }, {first});
+
+    b.wait(second);
+    CORRADE_VERIFY(first.isDone());
+    CORRADE_COMPARE(value, 15);
+}
+
+void TaskSchedulerTest::waitOtherScheduler() {
+    TaskScheduler a{1}, b{1};
+
+    Task task = a.submit([]() {});
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    b.wait(task);
+    CORRADE_COMPARE(out.str(), "TaskScheduler::wait(): the task was submitted to another scheduler\n");
+
+    a.wait(task);
+}
+
+void TaskSchedulerTest::waitDefault() {
+    TaskScheduler scheduler{2};
+
+    Task task;
+    CORRADE_VERIFY(task.isDone());
+
+    /* Shouldn't block */
+    scheduler.wait(task);
+}
+
+void TaskSchedulerTest::parallelFor() {
+    TaskScheduler scheduler{4};
+
+    std::vector<Int> data(100001);
+    std::atomic<bool> rangesValid{true};
+    scheduler.parallelFor(data.size(), 1000, [&data, &rangesValid](const std::size_t begin, const std::size_t end) {
+        if(begin >= end || end - begin > 1000) rangesValid = false;
+        for(std::size_t i = begin; i != end; ++i) data[i] += Int(i);
+    });
+    CORRADE_VERIFY(rangesValid);
+
+    /* Every item processed exactly once */
+    bool same = true;
+    for(std::size_t i = 0; i != data.size(); ++i)
+        same = same && data[i] == Int(i);
+    CORRADE_VERIFY(same);
+}
+
+void TaskSchedulerTest::parallelForSerial() {
+    TaskScheduler scheduler{4};
+
+    /* Not larger than grain size, processed at once */
+    std::vector<std::pair<std::size_t, std::size_t>> ranges;
+    scheduler.parallelFor(100, 100, [&ranges](const std::size_t begin, const std::size_t end) {
+        ranges.emplace_back(begin, end);
+    });
+    CORRADE_COMPARE(ranges.size(), 1);
+    CORRADE_COMPARE(ranges[0].first, 0);
+    CORRADE_COMPARE(ranges[0].second, 100);
+
+    /* No workers, processed at once */
+    ranges.clear();
+    TaskScheduler serial{1};
+    serial.parallelFor(1000, 10, [&ranges](const std::size_t begin, const std::size_t end) {
+        ranges.emplace_back(begin, end);
+    });
+    CORRADE_COMPARE(ranges.size(), 1);
+    CORRADE_COMPARE(ranges[0].first, 0);
+    CORRADE_COMPARE(ranges[0].second, 1000);
+}
+
+void TaskSchedulerTest::parallelForNested() {
+    TaskScheduler scheduler{4};
+
+    std::atomic<std::size_t> sum{0};
+    scheduler.parallelFor(64, 1, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            scheduler.parallelFor(1000, 10, [&sum](const std::size_t innerBegin, const std::size_t innerEnd) {
+                sum += innerEnd - innerBegin;
+            });
+    });
+
+    CORRADE_COMPARE(sum, 64000);
+}
+
+void TaskSchedulerTest::mainThreadTask() {
+    TaskScheduler scheduler{4};
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    const std::thread::id mainThread = std::this_thread::get_id();
+    std::thread::id executedOn;
+    #endif
+    bool executed = false;
+
+    /* Scheduled from a worker after the dependency finishes */
+    Task first = scheduler.submit([]() {});
+    Task second = scheduler.submit([&]() {
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        executedOn = std::this_thread::get_id();
+        #endif
+        executed = true;
+    }, {first}, TaskAffinity::MainThread);
+
+    std::size_t count = 0;
+    while(!second.isDone()) count += scheduler.runMainThreadTasks();
+
+    CORRADE_VERIFY(executed);
+    CORRADE_COMPARE(count, 1);
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_VERIFY(executedOn == mainThread);
+    #endif
+
+    /* Nothing left */
+    CORRADE_COMPARE(scheduler.runMainThreadTasks(), 0);
+}
+
+void TaskSchedulerTest::mainThreadTaskWait() {
+    TaskScheduler scheduler{4};
+
+    /* Waiting on the main thread executes the main thread tasks as well */
+    Int value = 0;
+    Task first = scheduler.submit([&value]() { value = 7; }, TaskAffinity::MainThread);
+    Task second = scheduler.submit([&value]() { value *= 6; }, {first});
+    scheduler.wait(second);
+    CORRADE_COMPARE(value, 42);
+}
+
+void TaskSchedulerTest::mainThreadTaskNotMainThread() {
+    #ifdef CORRADE_TARGET_EMSCRIPTEN
+    CORRADE_SKIP("Threads are not supported on this platform.");
+    #else
+    TaskScheduler scheduler{1};
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    std::thread thread{[&scheduler]() { scheduler.runMainThreadTasks(); }};
+    thread.join();
+    CORRADE_COMPARE(out.str(), "TaskScheduler::runMainThreadTasks(): not called from the main thread\n");
+    #endif
+}
+
+void TaskSchedulerTest::destructorExecutesRemaining() {
+    std::atomic<Int> count{0};
+    {
+        TaskScheduler scheduler{3};
+        for(Int i = 0; i != 100; ++i)
+            scheduler.submit([&count]() { ++count; });
+        scheduler.submit([&count]() { ++count; }, TaskAffinity::MainThread);
+    }
+
+    CORRADE_COMPARE(count, 101);
+}
+
+void TaskSchedulerTest::global() {
+    TaskScheduler& builtin = TaskScheduler::global();
+    CORRADE_COMPARE(builtin.threadCount(), 1);
+
+    TaskScheduler custom{2};
+    TaskScheduler::setGlobal(&custom);
+    CORRADE_VERIFY(&TaskScheduler::global() == &custom);
+
+    TaskScheduler::setGlobal(nullptr);
+    CORRADE_VERIFY(&TaskScheduler::global() == &builtin);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::TaskSchedulerTest)
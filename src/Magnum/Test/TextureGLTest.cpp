@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <vector>
 #include <Corrade/TestSuite/Compare/Container.h>
 
 #include "Magnum/configure.h"
@@ -52,8 +53,14 @@ struct TextureGLTest: AbstractOpenGLTester {
     void bind1D();
     #endif
     void bind2D();
+    void bind2DMultiRedundant();
     void bind3D();
 
+    #ifndef MAGNUM_TARGET_GLES
+    void bindlessHandle2D();
+    void sparse2D();
+    #endif
+
     #ifndef MAGNUM_TARGET_GLES
     void sampling1D();
     #endif
@@ -167,8 +174,14 @@ TextureGLTest::TextureGLTest() {
         &TextureGLTest::bind1D,
         #endif
         &TextureGLTest::bind2D,
+        &TextureGLTest::bind2DMultiRedundant,
         &TextureGLTest::bind3D,
 
+        #ifndef MAGNUM_TARGET_GLES
+        &TextureGLTest::bindlessHandle2D,
+        &TextureGLTest::sparse2D,
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES
         &TextureGLTest::sampling1D,
         #endif
@@ -349,6 +362,29 @@ void TextureGLTest::bind2D() {
     MAGNUM_VERIFY_NO_ERROR();
 }
 
+void TextureGLTest::bind2DMultiRedundant() {
+    Texture2D a, b, c;
+    AbstractTexture::bind(7, {&a, &b, &c});
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Only the middle unit changes, the others are already bound */
+    AbstractTexture::bind(7, {&a, nullptr, &c});
+    AbstractTexture::bind(7, {&a, nullptr, &c});
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Single-unit unbind after multi-bind needs the cached texture target */
+    AbstractTexture::unbind(9);
+    a.bind(7);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    AbstractTexture::unbind(7, 3);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
 void TextureGLTest::bind3D() {
     #ifdef MAGNUM_TARGET_GLES2
     if(!Context::current()->isExtensionSupported<Extensions::GL::OES::texture_3D>())
@@ -373,6 +409,60 @@ void TextureGLTest::bind3D() {
     MAGNUM_VERIFY_NO_ERROR();
 }
 
+#ifndef MAGNUM_TARGET_GLES
+void TextureGLTest::bindlessHandle2D() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::bindless_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::bindless_texture::string() + std::string(" is not supported."));
+
+    Texture2D texture;
+    texture.setMinificationFilter(Sampler::Filter::Linear)
+        .setMagnificationFilter(Sampler::Filter::Linear)
+        .setStorage(1, TextureFormat::RGBA8, Vector2i(32));
+
+    const GLuint64 handle = texture.handle();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(handle != 0);
+    CORRADE_COMPARE(texture.handle(), handle);
+    CORRADE_VERIFY(!texture.isResident());
+
+    texture.makeResident();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(texture.isResident());
+
+    texture.makeNonResident();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(!texture.isResident());
+}
+
+void TextureGLTest::sparse2D() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::sparse_texture::string() + std::string(" is not supported."));
+
+    CORRADE_VERIFY(Texture2D::sparsePageSizeCount(TextureFormat::RGBA8) > 0);
+    const Vector2i pageSize = Texture2D::sparsePageSize(TextureFormat::RGBA8);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(pageSize.x() > 0 && pageSize.y() > 0);
+
+    Texture2D texture;
+    texture.setSparse(true)
+        .setStorage(1, TextureFormat::RGBA8, pageSize*4);
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_VERIFY(texture.sparseLevelCount() > 0);
+
+    const std::vector<char> data(pageSize.product()*4);
+    texture.setPageCommitment(0, Range2Di::fromSize(pageSize, pageSize), true)
+        .setSubImage(0, pageSize, ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, pageSize, data.data()})
+        .setPageCommitment(0, Range2Di::fromSize(pageSize, pageSize), false);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+#endif
+
 #ifndef MAGNUM_TARGET_GLES
 void TextureGLTest::sampling1D() {
     Texture1D texture;
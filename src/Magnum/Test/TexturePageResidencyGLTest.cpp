@@ -0,0 +1,154 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/TexturePageResidency.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct TexturePageResidencyGLTest: AbstractOpenGLTester {
+    explicit TexturePageResidencyGLTest();
+
+    void construct();
+    void request();
+    void evict();
+    void budget();
+};
+
+TexturePageResidencyGLTest::TexturePageResidencyGLTest() {
+    addTests({&TexturePageResidencyGLTest::construct,
+              &TexturePageResidencyGLTest::request,
+              &TexturePageResidencyGLTest::evict,
+              &TexturePageResidencyGLTest::budget});
+}
+
+namespace {
+    Vector2i setupSparse(Texture2D& texture) {
+        const Vector2i pageSize = Texture2D::sparsePageSize(TextureFormat::RGBA8);
+        texture.setSparse(true)
+            .setStorage(1, TextureFormat::RGBA8, pageSize*4);
+        return pageSize;
+    }
+}
+
+void TexturePageResidencyGLTest::construct() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::sparse_texture::string() + std::string(" is not supported."));
+
+    Texture2D texture;
+    const Vector2i pageSize = setupSparse(texture);
+
+    {
+        TexturePageResidency residency{texture, 1, pageSize*4, pageSize};
+        CORRADE_COMPARE(residency.pageSize(), pageSize);
+        CORRADE_COMPARE(residency.pageCount(0), Vector2i{4});
+        CORRADE_COMPARE(residency.committedPageCount(), 0);
+    }
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void TexturePageResidencyGLTest::request() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::sparse_texture::string() + std::string(" is not supported."));
+
+    Texture2D texture;
+    const Vector2i pageSize = setupSparse(texture);
+    TexturePageResidency residency{texture, 1, pageSize*4, pageSize};
+
+    /* Touching two pages horizontally */
+    residency.request(0, {pageSize/2, pageSize/2 + Vector2i::xAxis(pageSize.x())});
+    std::vector<TexturePageResidency::Page> pages = residency.update();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(pages.size(), 2);
+    CORRADE_COMPARE(residency.committedPageCount(), 2);
+    CORRADE_VERIFY(residency.isCommitted({0, {0, 0}}));
+    CORRADE_VERIFY(residency.isCommitted({0, {1, 0}}));
+    CORRADE_VERIFY(!residency.isCommitted({0, {0, 1}}));
+    CORRADE_COMPARE(residency.pageRange({0, {1, 0}}), Range2Di::fromSize({pageSize.x(), 0}, pageSize));
+
+    /* Requesting again doesn't commit anything new */
+    residency.request(0, {{}, pageSize});
+    CORRADE_VERIFY(residency.update().empty());
+    CORRADE_COMPARE(residency.committedPageCount(), 2);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void TexturePageResidencyGLTest::evict() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::sparse_texture::string() + std::string(" is not supported."));
+
+    Texture2D texture;
+    const Vector2i pageSize = setupSparse(texture);
+    TexturePageResidency residency{texture, 1, pageSize*4, pageSize};
+    residency.setEvictionDelay(1);
+
+    residency.request(0, {{}, pageSize});
+    residency.update();
+    CORRADE_COMPARE(residency.committedPageCount(), 1);
+
+    /* Still kept for one frame */
+    residency.update();
+    CORRADE_COMPARE(residency.committedPageCount(), 1);
+
+    residency.update();
+    CORRADE_COMPARE(residency.committedPageCount(), 0);
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void TexturePageResidencyGLTest::budget() {
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::sparse_texture>())
+        CORRADE_SKIP(Extensions::GL::ARB::sparse_texture::string() + std::string(" is not supported."));
+
+    Texture2D texture;
+    const Vector2i pageSize = setupSparse(texture);
+    TexturePageResidency residency{texture, 1, pageSize*4, pageSize};
+    residency.setPageBudget(3);
+
+    residency.request(0, {{}, pageSize*2});
+    CORRADE_COMPARE(residency.update().size(), 3);
+    CORRADE_COMPARE(residency.committedPageCount(), 3);
+
+    /* Requesting a different page evicts the least recently used one */
+    residency.request(0, {pageSize*3, pageSize*4});
+    CORRADE_COMPARE(residency.update().size(), 1);
+    CORRADE_COMPARE(residency.committedPageCount(), 3);
+    CORRADE_VERIFY(residency.isCommitted({0, {3, 3}}));
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::TexturePageResidencyGLTest)
@@ -0,0 +1,179 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <limits>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/TextureStreamer.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct TextureStreamerGLTest: AbstractOpenGLTester {
+    explicit TextureStreamerGLTest();
+
+    void levelSize();
+    void levelForScreenSize();
+    void screenSize();
+
+    void add();
+    void stream();
+    void budget();
+};
+
+TextureStreamerGLTest::TextureStreamerGLTest() {
+    addTests({&TextureStreamerGLTest::levelSize,
+              &TextureStreamerGLTest::levelForScreenSize,
+              &TextureStreamerGLTest::screenSize,
+
+              &TextureStreamerGLTest::add,
+              &TextureStreamerGLTest::stream,
+              &TextureStreamerGLTest::budget});
+}
+
+namespace {
+    struct Loader {
+        explicit Loader(std::vector<Int>& loaded): loaded(loaded) {}
+
+        Image2D operator()(Int level) {
+            loaded.push_back(level);
+            const Vector2i size = TextureStreamer::levelSize({64, 32}, level);
+            return Image2D{ColorFormat::RGBA, ColorType::UnsignedByte, size, new char[size.product()*4]()};
+        }
+
+        std::vector<Int>& loaded;
+    };
+}
+
+void TextureStreamerGLTest::levelSize() {
+    CORRADE_COMPARE(TextureStreamer::levelSize({64, 32}, 0), (Vector2i{64, 32}));
+    CORRADE_COMPARE(TextureStreamer::levelSize({64, 32}, 2), (Vector2i{16, 8}));
+    CORRADE_COMPARE(TextureStreamer::levelSize({64, 32}, 6), (Vector2i{1, 1}));
+}
+
+void TextureStreamerGLTest::levelForScreenSize() {
+    CORRADE_COMPARE(TextureStreamer::levelForScreenSize({1024, 512}, 2000.0f), 0);
+    CORRADE_COMPARE(TextureStreamer::levelForScreenSize({1024, 512}, 1024.0f), 0);
+    CORRADE_COMPARE(TextureStreamer::levelForScreenSize({1024, 512}, 300.0f), 1);
+    CORRADE_COMPARE(TextureStreamer::levelForScreenSize({1024, 512}, 256.0f), 2);
+    CORRADE_COMPARE(TextureStreamer::levelForScreenSize({1024, 512}, 0.5f), 10);
+    CORRADE_COMPARE(TextureStreamer::levelForScreenSize({1024, 512}, std::numeric_limits<Float>::infinity()), 0);
+}
+
+void TextureStreamerGLTest::screenSize() {
+    const Matrix4 projection = Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f);
+
+    /* Sphere of radius 1 at distance 10 with 90° FoV is 1/10 of the view */
+    CORRADE_COMPARE(TextureStreamer::screenSize(projection, {800, 600}, {0.0f, 0.0f, -10.0f}, 1.0f), 60.0f);
+
+    /* Intersecting the camera */
+    CORRADE_COMPARE(TextureStreamer::screenSize(projection, {800, 600}, {0.0f, 0.0f, -0.5f}, 1.0f), std::numeric_limits<Float>::infinity());
+
+    /* Orthographic projection doesn't depend on distance */
+    const Matrix4 ortho = Matrix4::orthographicProjection({20.0f, 20.0f}, 0.1f, 100.0f);
+    CORRADE_COMPARE(TextureStreamer::screenSize(ortho, {800, 600}, {0.0f, 0.0f, -50.0f}, 1.0f), 60.0f);
+}
+
+void TextureStreamerGLTest::add() {
+    std::vector<Int> loaded;
+    TextureStreamer streamer{1024*1024, 3};
+    const TextureStreamer::Handle a = streamer.add(TextureFormat::RGBA8, {64, 32}, 7, Loader{loaded});
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(a, 0);
+    CORRADE_COMPARE(streamer.textureCount(), std::size_t(1));
+
+    /* Smallest levels first, not counted into the budget */
+    CORRADE_COMPARE(loaded, (std::vector<Int>{6, 5, 4}));
+    CORRADE_COMPARE(streamer.residentLevel(a), 4);
+    CORRADE_COMPARE(streamer.memoryUsage(), std::size_t(0));
+}
+
+void TextureStreamerGLTest::stream() {
+    std::vector<Int> loaded;
+    TextureStreamer streamer{1024*1024, 3, 2};
+    const TextureStreamer::Handle a = streamer.add(TextureFormat::RGBA8, {64, 32}, 7, Loader{loaded});
+    loaded.clear();
+
+    /* Nothing requested, nothing streamed */
+    streamer.update();
+    CORRADE_VERIFY(loaded.empty());
+
+    /* One level per update */
+    streamer.requestLevel(a, 1);
+    streamer.update();
+    CORRADE_COMPARE(streamer.requestedLevel(a), 1);
+    CORRADE_COMPARE(streamer.residentLevel(a), 3);
+
+    streamer.requestLevel(a, 1);
+    streamer.update();
+    CORRADE_COMPARE(streamer.residentLevel(a), 2);
+
+    streamer.requestLevel(a, 1);
+    streamer.update();
+    streamer.requestLevel(a, 1);
+    streamer.update();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(loaded, (std::vector<Int>{3, 2, 1}));
+    CORRADE_COMPARE(streamer.residentLevel(a), 1);
+    CORRADE_COMPARE(streamer.memoryUsage(), std::size_t((32*16 + 16*8 + 8*4)*4));
+}
+
+void TextureStreamerGLTest::budget() {
+    std::vector<Int> loaded;
+
+    /* Enough for levels 3 and 2 of one texture */
+    TextureStreamer streamer{(16*8 + 8*4)*4, 3, 4};
+    const TextureStreamer::Handle a = streamer.add(TextureFormat::RGBA8, {64, 32}, 7, Loader{loaded});
+    const TextureStreamer::Handle b = streamer.add(TextureFormat::RGBA8, {64, 32}, 7, Loader{loaded});
+
+    streamer.requestLevel(a, 2);
+    streamer.update();
+    streamer.requestLevel(a, 2);
+    streamer.update();
+    CORRADE_COMPARE(streamer.residentLevel(a), 2);
+    CORRADE_COMPARE(streamer.memoryUsage(), streamer.memoryBudget());
+
+    /* A is not needed anymore, its levels get evicted to make room for B */
+    streamer.requestLevel(b, 3);
+    streamer.update();
+
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(streamer.residentLevel(b), 3);
+    CORRADE_COMPARE(streamer.residentLevel(a), 3);
+    CORRADE_COMPARE(streamer.memoryUsage(), std::size_t(2*8*4*4));
+
+    /* Nothing to evict, the upload is postponed */
+    streamer.requestLevel(a, 3);
+    streamer.requestLevel(b, 0);
+    streamer.update();
+    CORRADE_COMPARE(streamer.residentLevel(b), 3);
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::TextureStreamerGLTest)
@@ -0,0 +1,128 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/Texture.h"
+#include "Magnum/TextureArray.h"
+#include "Magnum/TextureFormat.h"
+#include "Magnum/TextureUploadQueue.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+
+namespace Magnum { namespace Test {
+
+struct TextureUploadQueueGLTest: AbstractOpenGLTester {
+    explicit TextureUploadQueueGLTest();
+
+    void upload2D();
+    void upload3D();
+    void notEnoughSpace();
+};
+
+TextureUploadQueueGLTest::TextureUploadQueueGLTest() {
+    addTests({&TextureUploadQueueGLTest::upload2D,
+              &TextureUploadQueueGLTest::upload3D,
+              &TextureUploadQueueGLTest::notEnoughSpace});
+}
+
+namespace {
+    constexpr UnsignedByte Data[] = { 0x00, 0x01, 0x02, 0x03,
+                                      0x04, 0x05, 0x06, 0x07,
+                                      0x08, 0x09, 0x0a, 0x0b,
+                                      0x0c, 0x0d, 0x0e, 0x0f };
+}
+
+void TextureUploadQueueGLTest::upload2D() {
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, Vector2i{2});
+
+    TextureUploadQueue queue{1024};
+    queue.beginFrame();
+    CORRADE_VERIFY(queue.setSubImage(texture, 0, {}, ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, Vector2i{2}, Data}));
+    CORRADE_COMPARE(queue.pendingCount(), 1);
+    queue.endFrame();
+    CORRADE_COMPARE(queue.pendingCount(), 0);
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /** @todo How to test this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Image2D image = texture.image(0, {ColorFormat::RGBA, ColorType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(image.size(), Vector2i{2});
+    CORRADE_COMPARE_AS(Containers::ArrayReference<const UnsignedByte>(image.data<UnsignedByte>(), image.pixelSize()*image.size().product()),
+        Containers::ArrayReference<const UnsignedByte>{Data}, TestSuite::Compare::Container);
+    #endif
+}
+
+void TextureUploadQueueGLTest::upload3D() {
+    Texture2DArray texture;
+    texture.setStorage(1, TextureFormat::RGBA8, {1, 2, 2});
+
+    TextureUploadQueue queue{1024};
+    queue.beginFrame();
+    CORRADE_VERIFY(queue.setSubImage(texture, 0, {}, ImageReference3D{ColorFormat::RGBA, ColorType::UnsignedByte, {1, 2, 2}, Data}));
+    queue.endFrame();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    #ifndef MAGNUM_TARGET_GLES
+    Image3D image = texture.image(0, {ColorFormat::RGBA, ColorType::UnsignedByte});
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(image.size(), (Vector3i{1, 2, 2}));
+    CORRADE_COMPARE_AS(Containers::ArrayReference<const UnsignedByte>(image.data<UnsignedByte>(), image.pixelSize()*image.size().product()),
+        Containers::ArrayReference<const UnsignedByte>{Data}, TestSuite::Compare::Container);
+    #endif
+}
+
+void TextureUploadQueueGLTest::notEnoughSpace() {
+    Texture2D texture;
+    texture.setStorage(1, TextureFormat::RGBA8, Vector2i{2});
+
+    TextureUploadQueue queue{16, 2};
+    queue.beginFrame();
+    CORRADE_VERIFY(queue.setSubImage(texture, 0, {}, ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, Vector2i{2}, Data}));
+    CORRADE_VERIFY(!queue.setSubImage(texture, 0, {}, ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, Vector2i{1}, Data}));
+    CORRADE_COMPARE(queue.pendingCount(), 1);
+    queue.endFrame();
+
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Next frame has space again */
+    queue.beginFrame();
+    CORRADE_VERIFY(queue.setSubImage(texture, 0, {1, 1}, ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, Vector2i{1}, Data}));
+    queue.endFrame();
+
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::TextureUploadQueueGLTest)
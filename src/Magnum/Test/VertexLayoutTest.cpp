@@ -0,0 +1,163 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/VertexLayout.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Test {
+
+struct VertexLayoutTest: TestSuite::Tester {
+    explicit VertexLayoutTest();
+
+    void strideOffset();
+    void attributes();
+    void attributesMatrix();
+    #ifndef MAGNUM_TARGET_GLES2
+    void attributesInteger();
+    #endif
+    void interleave();
+    void interleaveDifferentSize();
+    void interleaveBufferTooSmall();
+};
+
+typedef Attribute<0, Vector3> Position;
+typedef Attribute<1, Vector2> TextureCoordinates;
+typedef Attribute<2, Float> Weight;
+typedef Attribute<3, Matrix3> Transformation;
+typedef VertexLayout<Position, TextureCoordinates, Weight> Layout;
+
+VertexLayoutTest::VertexLayoutTest() {
+    addTests({&VertexLayoutTest::strideOffset,
+              &VertexLayoutTest::attributes,
+              &VertexLayoutTest::attributesMatrix,
+              #ifndef MAGNUM_TARGET_GLES2
+              &VertexLayoutTest::attributesInteger,
+              #endif
+              &VertexLayoutTest::interleave,
+              &VertexLayoutTest::interleaveDifferentSize,
+              &VertexLayoutTest::interleaveBufferTooSmall});
+}
+
+void VertexLayoutTest::strideOffset() {
+    constexpr std::size_t stride = Layout::Stride;
+    constexpr std::size_t offset0 = Layout::offset<0>();
+    constexpr std::size_t offset1 = Layout::offset<1>();
+    constexpr std::size_t offset2 = Layout::offset<2>();
+    CORRADE_COMPARE(Layout::AttributeCount, 3);
+    CORRADE_COMPARE(stride, 24);
+    CORRADE_COMPARE(offset0, 0);
+    CORRADE_COMPARE(offset1, 12);
+    CORRADE_COMPARE(offset2, 20);
+}
+
+void VertexLayoutTest::attributes() {
+    const Implementation::VertexLayoutAttribute* const attributes = Layout::attributes();
+
+    CORRADE_COMPARE(attributes[0].location, 0);
+    CORRADE_COMPARE(attributes[0].components, 3);
+    CORRADE_COMPARE(attributes[0].type, GL_FLOAT);
+    CORRADE_VERIFY(attributes[0].kind == Implementation::VertexLayoutAttributeKind::Generic);
+    CORRADE_COMPARE(attributes[0].vectorCount, 1);
+    CORRADE_COMPARE(attributes[0].vectorSize, 12);
+    CORRADE_COMPARE(attributes[0].offset, 0);
+
+    CORRADE_COMPARE(attributes[1].location, 1);
+    CORRADE_COMPARE(attributes[1].components, 2);
+    CORRADE_COMPARE(attributes[1].offset, 12);
+
+    CORRADE_COMPARE(attributes[2].location, 2);
+    CORRADE_COMPARE(attributes[2].components, 1);
+    CORRADE_COMPARE(attributes[2].offset, 20);
+}
+
+void VertexLayoutTest::attributesMatrix() {
+    typedef VertexLayout<Weight, Transformation> MatrixLayout;
+    CORRADE_COMPARE(MatrixLayout::Stride, 40);
+
+    /* Each column is a separate location, split by the mesh */
+    const Implementation::VertexLayoutAttribute& attribute = MatrixLayout::attributes()[1];
+    CORRADE_COMPARE(attribute.location, 3);
+    CORRADE_COMPARE(attribute.components, 3);
+    CORRADE_COMPARE(attribute.vectorCount, 3);
+    CORRADE_COMPARE(attribute.vectorSize, 12);
+    CORRADE_COMPARE(attribute.offset, 4);
+}
+
+#ifndef MAGNUM_TARGET_GLES2
+void VertexLayoutTest::attributesInteger() {
+    typedef VertexLayout<Position, Attribute<4, Vector2ui>> IntegerLayout;
+    CORRADE_COMPARE(IntegerLayout::Stride, 20);
+
+    const Implementation::VertexLayoutAttribute& attribute = IntegerLayout::attributes()[1];
+    CORRADE_VERIFY(attribute.kind == Implementation::VertexLayoutAttributeKind::Integer);
+    CORRADE_COMPARE(attribute.type, GL_UNSIGNED_INT);
+    CORRADE_COMPARE(attribute.offset, 12);
+}
+#endif
+
+void VertexLayoutTest::interleave() {
+    const std::vector<Vector3> positions{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}};
+    const std::vector<Vector2> textureCoordinates{{0.25f, 0.5f}, {0.75f, 1.0f}};
+    const std::vector<Float> weights{0.125f, 0.375f};
+
+    const Containers::Array<char> data = Layout::interleave(positions, textureCoordinates, weights);
+    CORRADE_COMPARE(data.size(), 48);
+
+    const Float* floats = reinterpret_cast<const Float*>(data.data());
+    CORRADE_COMPARE((std::vector<Float>{floats, floats + 12}), (std::vector<Float>{
+        1.0f, 2.0f, 3.0f, 0.25f, 0.5f, 0.125f,
+        4.0f, 5.0f, 6.0f, 0.75f, 1.0f, 0.375f}));
+}
+
+void VertexLayoutTest::interleaveDifferentSize() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    char data[72];
+    const std::size_t count = Layout::interleaveInto(data,
+        std::vector<Vector3>(3), std::vector<Vector2>(3), std::vector<Float>(2));
+    CORRADE_COMPARE(count, 0);
+    CORRADE_COMPARE(out.str(), "VertexLayout::interleaveInto(): attribute arrays don't have the same length, expected 3 but got 2\n");
+}
+
+void VertexLayoutTest::interleaveBufferTooSmall() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    char data[47];
+    const std::size_t count = Layout::interleaveInto(data,
+        std::vector<Vector3>(2), std::vector<Vector2>(2), std::vector<Float>(2));
+    CORRADE_COMPARE(count, 0);
+    CORRADE_COMPARE(out.str(), "VertexLayout::interleaveInto(): the data buffer is too small, expected 48 but got 47\n");
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::VertexLayoutTest)
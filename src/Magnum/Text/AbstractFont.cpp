@@ -25,6 +25,8 @@
 
 #include "AbstractFont.h"
 
+#include <list>
+#include <unordered_map>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Directory.h>
 #include <Corrade/Utility/Unicode.h>
@@ -34,10 +36,68 @@
 
 namespace Magnum { namespace Text {
 
+namespace {
+
+/* Quad position, texture coordinates and advance for each glyph */
+typedef std::vector<std::tuple<Range2D, Range2D, Vector2>> CachedGlyphs;
+
+class CachedLayouter: public AbstractLayouter {
+    public:
+        explicit CachedLayouter(std::shared_ptr<const CachedGlyphs> glyphs): AbstractLayouter(glyphs->size()), _glyphs{std::move(glyphs)} {}
+
+    private:
+        std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(const UnsignedInt i) override {
+            return (*_glyphs)[i];
+        }
+
+        /* Shared with the cache, so evicting the entry doesn't invalidate
+           layouters which are still alive */
+        std::shared_ptr<const CachedGlyphs> _glyphs;
+};
+
+}
+
+struct AbstractFont::LayoutCache {
+    struct Key {
+        const GlyphCache* cache;
+        Float size;
+        std::string text;
+
+        bool operator==(const Key& other) const {
+            return cache == other.cache && size == other.size && text == other.text;
+        }
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const {
+            return std::hash<std::string>{}(key.text) ^
+                (std::hash<const GlyphCache*>{}(key.cache) << 1) ^
+                (std::hash<Float>{}(key.size) << 2);
+        }
+    };
+
+    struct Entry {
+        UnsignedInt revision;
+        std::shared_ptr<const CachedGlyphs> glyphs;
+        std::list<Key>::iterator usage;
+    };
+
+    explicit LayoutCache(std::size_t size): size{size} {}
+
+    std::size_t size;
+    Key lookup;
+
+    /* Keys ordered from the most recently used */
+    std::list<Key> usage;
+    std::unordered_map<Key, Entry, KeyHash> entries;
+};
+
 AbstractFont::AbstractFont(): _size(0.0f) {}
 
 AbstractFont::AbstractFont(PluginManager::AbstractManager& manager, std::string plugin): AbstractPlugin(manager, std::move(plugin)), _size(0.0f), _lineHeight(0.0f) {}
 
+AbstractFont::~AbstractFont() = default;
+
 bool AbstractFont::openData(const std::vector<std::pair<std::string, Containers::ArrayReference<const char>>>& data, const Float size) {
     CORRADE_ASSERT(features() & Feature::OpenData,
         "Text::AbstractFont::openData(): feature not supported", false);
@@ -97,6 +157,8 @@ std::pair<Float, Float> AbstractFont::doOpenFile(const std::string& filename, co
 }
 
 void AbstractFont::close() {
+    clearLayoutCache();
+
     if(isOpened()) {
         doClose();
         _size = 0.0f;
@@ -151,7 +213,76 @@ std::unique_ptr<GlyphCache> AbstractFont::doCreateGlyphCache() {
 std::unique_ptr<AbstractLayouter> AbstractFont::layout(const GlyphCache& cache, const Float size, const std::string& text) {
     CORRADE_ASSERT(isOpened(), "Text::AbstractFont::layout(): no font opened", nullptr);
 
-    return doLayout(cache, size, text);
+    if(!_layoutCache) return doLayout(cache, size, text);
+
+    /* Cached and up-to-date, mark as most recently used. The lookup key is
+       reused so the text doesn't need to be copied to a new string. */
+    LayoutCache::Key& key = _layoutCache->lookup;
+    key.cache = &cache;
+    key.size = size;
+    key.text.assign(text);
+    auto found = _layoutCache->entries.find(key);
+    if(found != _layoutCache->entries.end() && found->second.revision == cache.revision()) {
+        _layoutCache->usage.splice(_layoutCache->usage.begin(), _layoutCache->usage, found->second.usage);
+        return std::unique_ptr<AbstractLayouter>(new CachedLayouter(found->second.glyphs));
+    }
+
+    /* Layout the text and record all glyphs relative to zero cursor
+       position */
+    std::unique_ptr<AbstractLayouter> layouter = doLayout(cache, size, text);
+    std::shared_ptr<CachedGlyphs> glyphs = std::make_shared<CachedGlyphs>();
+    glyphs->reserve(layouter->glyphCount());
+    for(UnsignedInt i = 0; i != layouter->glyphCount(); ++i) {
+        Vector2 advance;
+        Range2D rectangle, quadPosition, textureCoordinates;
+        std::tie(quadPosition, textureCoordinates) = layouter->renderGlyph(i, advance, rectangle);
+        glyphs->emplace_back(quadPosition, textureCoordinates, advance);
+    }
+
+    /* Outdated entry, update it in place */
+    if(found != _layoutCache->entries.end()) {
+        found->second.revision = cache.revision();
+        found->second.glyphs = glyphs;
+        _layoutCache->usage.splice(_layoutCache->usage.begin(), _layoutCache->usage, found->second.usage);
+
+    /* New entry, discard the least recently used one if the cache is full */
+    } else {
+        if(_layoutCache->entries.size() == _layoutCache->size) {
+            _layoutCache->entries.erase(_layoutCache->usage.back());
+            _layoutCache->usage.pop_back();
+        }
+
+        _layoutCache->usage.push_front(key);
+        _layoutCache->entries.insert({key, {cache.revision(), glyphs, _layoutCache->usage.begin()}});
+    }
+
+    return std::unique_ptr<AbstractLayouter>(new CachedLayouter(std::move(glyphs)));
+}
+
+std::size_t AbstractFont::layoutCacheSize() const {
+    return _layoutCache ? _layoutCache->size : 0;
+}
+
+void AbstractFont::setLayoutCacheSize(const std::size_t size) {
+    if(!size) {
+        _layoutCache = nullptr;
+        return;
+    }
+
+    /* Discard the least recently used entries that don't fit anymore */
+    if(!_layoutCache) _layoutCache.reset(new LayoutCache{size});
+    else while(_layoutCache->entries.size() > size) {
+        _layoutCache->entries.erase(_layoutCache->usage.back());
+        _layoutCache->usage.pop_back();
+    }
+    _layoutCache->size = size;
+}
+
+void AbstractFont::clearLayoutCache() {
+    if(!_layoutCache) return;
+
+    _layoutCache->entries.clear();
+    _layoutCache->usage.clear();
 }
 
 AbstractLayouter::AbstractLayouter(UnsignedInt glyphCount): _glyphCount(glyphCount) {}
@@ -72,10 +72,10 @@ checked by the implementation:
 -   All `do*()` implementations working on opened file are called only if
     there is any file opened.
 
-Plugin interface string is `"cz.mosra.magnum.Text.AbstractFont/0.2.3"`.
+Plugin interface string is `"cz.mosra.magnum.Text.AbstractFont/0.2.4"`.
 */
 class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
-    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Text.AbstractFont/0.2.3")
+    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Text.AbstractFont/0.2.4")
 
     public:
         /**
@@ -110,6 +110,8 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
         /** @brief Plugin manager constructor */
         explicit AbstractFont(PluginManager::AbstractManager& manager, std::string plugin);
 
+        ~AbstractFont();
+
         /** @brief Features supported by this font */
         Features features() const { return doFeatures(); }
 
@@ -225,6 +227,39 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
          */
         std::unique_ptr<AbstractLayouter> layout(const GlyphCache& cache, Float size, const std::string& text);
 
+        /**
+         * @brief Layout cache size
+         *
+         * @see @ref setLayoutCacheSize()
+         */
+        std::size_t layoutCacheSize() const;
+
+        /**
+         * @brief Set layout cache size
+         *
+         * If set to non-zero value, @ref layout() remembers glyph quads of
+         * up to @p size most recently laid out texts, keyed by the glyph
+         * cache, font size and the text itself. Subsequent layouts of the
+         * same text then don't need to call the plugin layouter and look up
+         * all the glyphs again. Cached layouts are recalculated when
+         * @ref GlyphCache::revision() changes, the least recently used ones
+         * are discarded if the cache is full. Closing the font clears the
+         * cache. Setting the size to `0` disables the caching, which is the
+         * default.
+         * @see @ref clearLayoutCache()
+         */
+        void setLayoutCacheSize(std::size_t size);
+
+        /**
+         * @brief Clear layout cache
+         *
+         * Needs to be called when a glyph cache used for layouting is
+         * destroyed, otherwise a new cache allocated on the same address
+         * could get outdated layouts.
+         * @see @ref setLayoutCacheSize()
+         */
+        void clearLayoutCache();
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     protected:
     #else
@@ -296,7 +331,10 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
     #ifdef DOXYGEN_GENERATING_OUTPUT
     private:
     #endif
+        struct LayoutCache;
+
         Float _size, _lineHeight;
+        std::unique_ptr<LayoutCache> _layoutCache;
 };
 
 CORRADE_ENUMSET_OPERATORS(AbstractFont::Features)
@@ -320,7 +358,7 @@ class MAGNUM_TEXT_EXPORT AbstractLayouter {
         /** @brief Moving is not allowed */
         AbstractLayouter(AbstractLayouter&&) = delete;
 
-        ~AbstractLayouter();
+        virtual ~AbstractLayouter();
 
         /** @brief Copying is not allowed */
         AbstractLayouter& operator=(const AbstractLayouter&) = delete;
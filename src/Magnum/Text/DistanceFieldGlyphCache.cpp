@@ -25,27 +25,33 @@
 
 #include "DistanceFieldGlyphCache.h"
 
-#ifndef CORRADE_NO_ASSERT
+#include <algorithm>
+#include <memory>
+
 #include "Magnum/ColorFormat.h"
-#endif
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
+#include "Magnum/Image.h"
 #include "Magnum/ImageReference.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/TextureFormat.h"
 #include "Magnum/TextureTools/DistanceField.h"
 
 namespace Magnum { namespace Text {
 
-DistanceFieldGlyphCache::DistanceFieldGlyphCache(const Vector2i& originalSize, const Vector2i& size, const UnsignedInt radius):
+DistanceFieldGlyphCache::DistanceFieldGlyphCache(const Vector2i& originalSize, const Vector2i& size, const UnsignedInt radius, const Flags flags):
     #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES3)
-    GlyphCache(TextureFormat::R8, originalSize, size, Vector2i(radius)),
+    GlyphCache(flags & Flag::Multichannel ? TextureFormat::RGB8 : TextureFormat::R8, originalSize, size, Vector2i(radius)),
     #else
     /* Luminance is not renderable in most cases */
-    GlyphCache(Context::current()->isExtensionSupported<Extensions::GL::EXT::texture_rg>() ?
+    GlyphCache(!(flags & Flag::Multichannel) && Context::current()->isExtensionSupported<Extensions::GL::EXT::texture_rg>() ?
         TextureFormat::Red : TextureFormat::RGB, originalSize, size, Vector2i(radius)),
     #endif
-    scale(Vector2(size)/Vector2(originalSize)), radius(radius)
+    scale(Vector2(size)/Vector2(originalSize)), radius(radius), _distanceFieldSize(size), _flags(flags), _threadCount(0)
 {
+    /* Multichannel cache is filled on the CPU, no need for RG textures */
+    if(flags & Flag::Multichannel) return;
+
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::texture_rg);
     #endif
@@ -57,6 +63,8 @@ DistanceFieldGlyphCache::DistanceFieldGlyphCache(const Vector2i& originalSize, c
     #endif
 }
 
+DistanceFieldGlyphCache::~DistanceFieldGlyphCache() = default;
+
 void DistanceFieldGlyphCache::setImage(const Vector2i& offset, const ImageReference2D& image) {
     #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES3)
     const TextureFormat internalFormat = TextureFormat::R8;
@@ -75,28 +83,102 @@ void DistanceFieldGlyphCache::setImage(const Vector2i& offset, const ImageRefere
     }
     #endif
 
-    Texture2D input;
-    input.setWrapping(Sampler::Wrapping::ClampToEdge)
-        .setMinificationFilter(Sampler::Filter::Linear)
-        .setMagnificationFilter(Sampler::Filter::Linear)
-        .setImage(0, internalFormat, image);
+    /* Distance field computed on the CPU. Binary image has no corner
+       information, so all channels of multichannel cache are filled with the
+       same value. */
+    if(_threadCount || _flags & Flag::Multichannel) {
+        const Vector2i size = image.size()*scale;
+        Image2D distanceField = TextureTools::distanceField(image, size, radius, Math::max(_threadCount, 1u));
+
+        #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES3)
+        if(!(_flags & Flag::Multichannel))
+        #else
+        if(!(_flags & Flag::Multichannel) && internalFormat != TextureFormat::Luminance)
+        #endif
+        {
+            texture().setSubImage(0, offset*scale, distanceField);
+            return;
+        }
+
+        /* Expand to RGB texture */
+        const std::size_t inputRowSize = ((size.x() + 3)/4)*4;
+        const std::size_t outputRowSize = ((size.x()*3 + 3)/4)*4;
+        std::unique_ptr<char[]> data{new char[outputRowSize*size.y()]()};
+        for(Int y = 0; y != size.y(); ++y) for(Int x = 0; x != size.x(); ++x)
+            for(std::size_t i = 0; i != 3; ++i)
+                data[y*outputRowSize + x*3 + i] = distanceField.data()[y*inputRowSize + x];
+
+        texture().setSubImage(0, offset*scale, ImageReference2D{ColorFormat::RGB, ColorType::UnsignedByte, size, data.get()});
+        return;
+    }
+
+    /* The binary images are kept in a texture of the original size, so the
+       neighborhood of changed areas can be looked up when converting them.
+       Its storage has undefined contents, so it's cleared first. */
+    if(!_input) {
+        _input.reset(new Texture2D);
+        _input->setWrapping(Sampler::Wrapping::ClampToEdge)
+            .setMinificationFilter(Sampler::Filter::Linear)
+            .setMagnificationFilter(Sampler::Filter::Linear)
+            .setStorage(1, internalFormat, textureSize());
+
+        const std::size_t rowSize = ((textureSize().x()*image.pixelSize() + 3)/4)*4;
+        std::unique_ptr<char[]> zeros{new char[rowSize*textureSize().y()]()};
+        _input->setSubImage(0, {}, ImageReference2D{image.format(), image.type(), textureSize(), zeros.get()});
+    }
+
+    _input->setSubImage(0, offset, image);
+    _dirty.push_back(Range2Di::fromSize(offset, image.size()));
+
+    if(!(_flags & Flag::DeferredUpdate)) flush();
+}
+
+void DistanceFieldGlyphCache::flush() {
+    if(_dirty.empty()) return;
+
+    if(!_distanceField)
+        _distanceField.reset(new TextureTools::DistanceField{Int(radius)});
+
+    /* Distance of output pixels up to radius around the changed area depends
+       on it as well. Merge the enlarged areas that overlap so no pixel is
+       converted twice. */
+    std::vector<Range2Di> areas;
+    areas.reserve(_dirty.size());
+    for(const Range2Di& dirty: _dirty) {
+        Range2Di area{Math::max(dirty.min() - Vector2i(radius), Vector2i{}),
+                      Math::min(dirty.max() + Vector2i(radius), textureSize())};
+        for(auto it = areas.begin(); it != areas.end(); ) {
+            if((it->min() < area.max()).all() && (area.min() < it->max()).all()) {
+                area = Range2Di{Math::min(area.min(), it->min()), Math::max(area.max(), it->max())};
+                areas.erase(it);
+                it = areas.begin();
+            } else ++it;
+        }
+        areas.push_back(area);
+    }
+    _dirty.clear();
 
-    /* Create distance field from input texture */
-    TextureTools::distanceField(input, texture(), Range2Di::fromSize(offset*scale, image.size()*scale), radius, image.size());
+    for(const Range2Di& area: areas) {
+        const Range2Di rectangle{
+            Math::max(Vector2i(Math::floor(Vector2(area.min())*scale)), Vector2i{}),
+            Math::min(Vector2i(Math::ceil(Vector2(area.max())*scale)), _distanceFieldSize)};
+        (*_distanceField)(*_input, texture(), rectangle, textureSize(), _distanceFieldSize);
+    }
 }
 
 void DistanceFieldGlyphCache::setDistanceFieldImage(const Vector2i& offset, const ImageReference2D& image) {
+    #ifndef CORRADE_NO_ASSERT
+    ColorFormat expected;
+    if(_flags & Flag::Multichannel) expected = ColorFormat::RGB;
     #if !defined(MAGNUM_TARGET_GLES) || defined(MAGNUM_TARGET_GLES3)
-    CORRADE_ASSERT(image.format() == ColorFormat::Red,
-        "Text::DistanceFieldGlyphCache::setDistanceFieldImage(): expected" << ColorFormat::Red << "but got" << image.format(), );
+    else expected = ColorFormat::Red;
     #else
-    if(Context::current()->isExtensionSupported<Extensions::GL::EXT::texture_rg>())
-        CORRADE_ASSERT(image.format() == ColorFormat::Red,
-            "Text::DistanceFieldGlyphCache::setDistanceFieldImage(): expected" << ColorFormat::Red << "but got" << image.format(), );
-
     /* Luminance is not renderable in most cases */
-    else CORRADE_ASSERT(image.format() == ColorFormat::RGB,
-            "Text::DistanceFieldGlyphCache::setDistanceFieldImage(): expected" << ColorFormat::RGB << "but got" << image.format(), );
+    else expected = Context::current()->isExtensionSupported<Extensions::GL::EXT::texture_rg>() ?
+        ColorFormat::Red : ColorFormat::RGB;
+    #endif
+    CORRADE_ASSERT(image.format() == expected,
+        "Text::DistanceFieldGlyphCache::setDistanceFieldImage(): expected" << expected << "but got" << image.format(), );
     #endif
 
     texture().setSubImage(0, offset, image);
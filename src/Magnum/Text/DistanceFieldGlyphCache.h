@@ -29,9 +29,17 @@
  * @brief Class @ref Magnum::Text::DistanceFieldGlyphCache
  */
 
+#include <memory>
+#include <vector>
+#include <Corrade/Containers/EnumSet.h>
+
 #include "Magnum/Text/GlyphCache.h"
 
-namespace Magnum { namespace Text {
+namespace Magnum {
+
+namespace TextureTools { class DistanceField; }
+
+namespace Text {
 
 /**
 @brief Glyph cache with distance field rendering
@@ -52,18 +60,82 @@ font->createGlyphCache(cache, "abcdefghijklmnopqrstuvwxyz"
                               "0123456789?!:;,. ");
 @endcode
 
+@anchor Text-DistanceFieldGlyphCache-incremental
+## Incremental updates
+
+On the GPU the binary images are uploaded into a persistent input texture of
+the original cache size and only the changed areas, enlarged by the radius,
+are converted, using a @ref TextureTools::DistanceField instance that's kept
+for the whole lifetime of the cache. Adding glyphs at runtime thus doesn't
+recompile any shader nor convert glyphs that are already in the cache. With
+@ref Flag::DeferredUpdate the changed areas are only recorded in
+@ref setImage() and converted all at once in @ref flush(), so filling the
+cache glyph by glyph doesn't issue a draw for every one of them:
+@code
+Text::DistanceFieldGlyphCache cache{Vector2i(2048), Vector2i(384), 16,
+    Text::DistanceFieldGlyphCache::Flag::DeferredUpdate};
+
+// Each time new glyphs are needed
+font->fillGlyphCache(cache, newCharacters);
+cache.flush();
+@endcode
+
+@anchor Text-DistanceFieldGlyphCache-multichannel
+## Multichannel distance field
+
+With @ref Flag::Multichannel the cache texture is RGB and is meant to be filled
+with multichannel distance field using @ref setDistanceFieldImage(),
+generated from glyph outlines with @ref TextureTools::multichannelDistanceField().
+The sharp corners are then preserved even with much smaller texture, render
+it with @ref Shaders::DistanceFieldVector with
+@ref Shaders::AbstractVector::Flag::Multichannel "Flag::Multichannel" enabled.
+Binary images passed to @ref setImage() don't have any corner information, so
+all three channels are filled with the same single-channel distance field.
+
 @see @ref TextureTools::distanceField()
 */
 class MAGNUM_TEXT_EXPORT DistanceFieldGlyphCache: public GlyphCache {
     public:
+        /**
+         * @brief Flag
+         *
+         * @see @ref Flags, @ref flags()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * Multichannel distance field. The cache texture is
+             * @ref TextureFormat::RGB8 (@ref TextureFormat::RGB in OpenGL ES
+             * 2.0), see @ref Text-DistanceFieldGlyphCache-multichannel "above"
+             * for more information.
+             */
+            Multichannel = 1 << 0,
+
+            /**
+             * Don't convert the images passed to @ref setImage() on the GPU
+             * immediately, only after calling @ref flush(). See
+             * @ref Text-DistanceFieldGlyphCache-incremental "above" for more
+             * information.
+             */
+            DeferredUpdate = 1 << 1
+        };
+
+        /**
+         * @brief Flags
+         *
+         * @see @ref flags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+
         /**
          * @brief Constructor
          * @param originalSize      Unscaled glyph cache texture size
          * @param size              Actual glyph cache texture size
          * @param radius            Distance field computation radius
+         * @param flags             Flags
          *
          * See @ref TextureTools::distanceField() for more information about
-         * the parameters. Sets internal texture format to red channel only. On
+         * the parameters. Unless @ref Flag::Multichannel is set, sets internal
+         * texture format to red channel only. On
          * desktop OpenGL requires @extension{ARB,texture_rg} (also part of
          * OpenGL ES 3.0), in ES2 uses @es_extension{EXT,texture_rg} if
          * available or @ref TextureFormat::RGB as fallback.
@@ -71,29 +143,81 @@ class MAGNUM_TEXT_EXPORT DistanceFieldGlyphCache: public GlyphCache {
          *      possible to convert the RGB texture to Luminance after it has
          *      been rendered when blitting is not supported to save memory?
          */
-        explicit DistanceFieldGlyphCache(const Vector2i& originalSize, const Vector2i& size, UnsignedInt radius);
+        explicit DistanceFieldGlyphCache(const Vector2i& originalSize, const Vector2i& size, UnsignedInt radius, Flags flags = Flags());
+
+        ~DistanceFieldGlyphCache();
+
+        /** @brief Flags */
+        Flags flags() const { return _flags; }
+
+        /** @brief Count of threads for CPU distance field computation */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Compute distance field on the CPU
+         * @return Reference to self (for method chaining)
+         *
+         * If set to non-zero value, images passed to @ref setImage() are
+         * converted using @ref TextureTools::distanceField(const ImageReference2D&, const Vector2i&, Int, UnsignedInt)
+         * in given count of threads instead of on the GPU. That is faster
+         * for large radii, which are costly on the GPU. Default is `0`, i.e.
+         * computation on the GPU, except for @ref Flag::Multichannel, which
+         * is always done on the CPU, in one thread if set to `0`.
+         */
+        DistanceFieldGlyphCache& setThreadCount(UnsignedInt count) {
+            _threadCount = count;
+            return *this;
+        }
 
         /**
          * @brief Set cache image
          *
          * Uploads image for one or more glyphs to given offset in original
-         * cache texture. The texture is then converted to distance field.
+         * cache texture. The texture is then converted to distance field. If
+         * @ref Flag::Multichannel is set, the distance field is computed on
+         * the CPU and copied to all three channels. If the conversion is done
+         * on the GPU and @ref Flag::DeferredUpdate is set, the conversion is
+         * postponed until @ref flush().
+         * @see @ref setThreadCount()
          */
         void setImage(const Vector2i& offset, const ImageReference2D& image) override;
 
+        /**
+         * @brief Convert changed areas to distance field
+         *
+         * Converts all areas changed by @ref setImage() since last call on
+         * the GPU. Overlapping areas are converted only once. Called
+         * implicitly from @ref setImage() unless @ref Flag::DeferredUpdate
+         * is set. Does nothing if there are no changes.
+         */
+        void flush();
+
         /**
          * @brief Set distance field cache image
          *
          * Uploads already computed distance field image to given offset in
-         * distance field texture.
+         * distance field texture. If @ref Flag::Multichannel is set, expects
+         * @ref ColorFormat::RGB image, e.g. created with
+         * @ref TextureTools::multichannelDistanceField(). To match the range
+         * of distance fields created by @ref setImage(), pass
+         * `(radius + 1)*size.x()/originalSize.x()` as its radius.
          */
         void setDistanceFieldImage(const Vector2i& offset, const ImageReference2D& image);
 
     private:
         const Vector2 scale;
         const UnsignedInt radius;
+        const Vector2i _distanceFieldSize;
+        const Flags _flags;
+        UnsignedInt _threadCount;
+
+        std::unique_ptr<Texture2D> _input;
+        std::unique_ptr<TextureTools::DistanceField> _distanceField;
+        std::vector<Range2Di> _dirty;
 };
 
+CORRADE_ENUMSET_OPERATORS(DistanceFieldGlyphCache::Flags)
+
 }}
 
 #endif
@@ -0,0 +1,263 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "DynamicGlyphCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+#include <Corrade/Utility/Unicode.h>
+
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Text/AbstractFont.h"
+
+namespace Magnum { namespace Text {
+
+DynamicGlyphCache::DynamicGlyphCache(const TextureFormat internalFormat, const Vector2i& initialSize, const Vector2i& maxSize, const Vector2i& padding): GlyphCache{internalFormat, initialSize, initialSize, padding}, _maxSize{Math::max(initialSize, maxSize)}, _generation{}, _frame{}, _format{}, _type{}, _pixelSize{}, _fullUpload{} {}
+
+DynamicGlyphCache::DynamicGlyphCache(const Vector2i& initialSize, const Vector2i& maxSize, const Vector2i& padding): GlyphCache{initialSize, initialSize, padding}, _maxSize{Math::max(initialSize, maxSize)}, _generation{}, _frame{}, _format{}, _type{}, _pixelSize{}, _fullUpload{} {}
+
+DynamicGlyphCache::~DynamicGlyphCache() = default;
+
+bool DynamicGlyphCache::update(AbstractFont& font, const std::string& characters) {
+    /* Mark present glyphs as used, collect characters with missing glyphs.
+       Each missing glyph is requested only once. */
+    std::string missing;
+    std::vector<UnsignedInt> missingGlyphs;
+    for(std::size_t i = 0; i < characters.size(); ) {
+        const std::size_t begin = i;
+        char32_t character;
+        std::tie(character, i) = Utility::Unicode::nextChar(characters, i);
+
+        const UnsignedInt glyph = font.glyphId(character);
+        if(!glyph) continue;
+
+        if(glyphs.find(glyph) != glyphs.end()) {
+            _lastUsed[glyph] = _frame;
+            continue;
+        }
+
+        if(std::find(missingGlyphs.begin(), missingGlyphs.end(), glyph) != missingGlyphs.end())
+            continue;
+
+        missingGlyphs.push_back(glyph);
+        missing.append(characters, begin, i - begin);
+    }
+
+    /* Rasterize the missing glyphs and upload changed parts of the texture */
+    if(!missing.empty()) {
+        font.fillGlyphCache(*this, missing);
+        flush();
+    }
+
+    bool success = true;
+    for(const UnsignedInt glyph: missingGlyphs) {
+        if(glyphs.find(glyph) == glyphs.end()) success = false;
+        else _lastUsed[glyph] = _frame;
+    }
+
+    return success;
+}
+
+std::vector<Range2Di> DynamicGlyphCache::doReserve(const std::vector<Vector2i>& sizes) {
+    /* Try to fit into remaining space first */
+    std::vector<TextureTools::AtlasPacker::Placement> placements = _packer.add(sizes);
+    if(!placements.empty()) {
+        std::vector<Range2Di> rectangles;
+        rectangles.reserve(placements.size());
+        for(const TextureTools::AtlasPacker::Placement& placement: placements)
+            rectangles.push_back(placement.rectangle);
+        return rectangles;
+    }
+
+    /* Existing glyphs ordered from most recently used. Glyphs used in
+       current frame and the "Not Found" glyph, if set, are never evicted. */
+    std::vector<std::pair<UnsignedInt, UnsignedInt>> candidates;
+    candidates.reserve(glyphs.size());
+    for(const auto& glyph: glyphs) {
+        if(glyph.first == 0) {
+            if(glyph.second.second.size() != Vector2i{})
+                candidates.emplace_back(~UnsignedInt{}, 0);
+            continue;
+        }
+
+        const auto found = _lastUsed.find(glyph.first);
+        candidates.emplace_back(found == _lastUsed.end() ? 0 : found->second, glyph.first);
+    }
+    std::stable_sort(candidates.begin(), candidates.end(), [](const std::pair<UnsignedInt, UnsignedInt>& a, const std::pair<UnsignedInt, UnsignedInt>& b) {
+        return a.first > b.first;
+    });
+    const std::size_t required = std::count_if(candidates.begin(), candidates.end(), [this](const std::pair<UnsignedInt, UnsignedInt>& a) {
+        return a.first >= _frame;
+    });
+
+    /* Enlarge the texture while possible, then evict half of the
+       evictable glyphs repeatedly until everything fits */
+    Vector2i size = _size;
+    std::size_t keep = candidates.size();
+    std::vector<UnsignedInt> kept;
+    std::vector<Range2Di> rectangles;
+    for(;;) {
+        kept.clear();
+        for(std::size_t i = 0; i != keep; ++i)
+            kept.push_back(candidates[i].second);
+
+        if(repack(size, kept, sizes, rectangles)) return rectangles;
+
+        if((size < _maxSize).any())
+            size = Math::min(size*2, _maxSize);
+        else if(keep > required)
+            keep = required + (keep - required)/2;
+        else {
+            Error() << "Text::DynamicGlyphCache::reserve(): cannot fit" << sizes.size()
+                    << "glyphs into cache with maximal size" << _maxSize;
+            return {};
+        }
+    }
+}
+
+bool DynamicGlyphCache::repack(const Vector2i& size, const std::vector<UnsignedInt>& kept, const std::vector<Vector2i>& sizes, std::vector<Range2Di>& rectangles) {
+    /* Pack kept glyphs together with the new ones */
+    std::vector<Vector2i> allSizes;
+    allSizes.reserve(kept.size() + sizes.size());
+    for(const UnsignedInt glyph: kept)
+        allSizes.push_back(glyphs.at(glyph).second.size() - 2*_padding);
+    allSizes.insert(allSizes.end(), sizes.begin(), sizes.end());
+
+    TextureTools::AtlasPacker packer{size, _padding};
+    const std::vector<TextureTools::AtlasPacker::Placement> placements = packer.add(allSizes);
+    if(placements.empty()) return false;
+
+    /* Move kept glyphs to new positions in the in-memory copy, evict the
+       rest */
+    Containers::Array<char> data{_pixelSize ? rowSize(size.x())*size.y() : 0};
+    if(data.size()) std::memset(data.data(), 0, data.size());
+    std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>> newGlyphs;
+    newGlyphs.reserve(glyphs.size());
+    newGlyphs.insert({0, glyphs.at(0)});
+    for(std::size_t i = 0; i != kept.size(); ++i) {
+        const std::pair<Vector2i, Range2Di>& glyph = glyphs.at(kept[i]);
+        const Range2Di rectangle = placements[i].rectangle.padded(_padding);
+
+        if(_pixelSize) for(Int y = 0; y != rectangle.sizeY(); ++y) {
+            std::memcpy(data.data() + rowSize(size.x())*(rectangle.bottom() + y) + _pixelSize*rectangle.left(),
+                _data.data() + rowSize(_size.x())*(glyph.second.bottom() + y) + _pixelSize*glyph.second.left(),
+                _pixelSize*rectangle.sizeX());
+        }
+
+        newGlyphs[kept[i]] = {glyph.first, rectangle};
+    }
+
+    for(auto it = _lastUsed.begin(); it != _lastUsed.end(); ) {
+        if(newGlyphs.find(it->first) == newGlyphs.end()) it = _lastUsed.erase(it);
+        else ++it;
+    }
+
+    /* Enlarge the texture, if needed */
+    if(size != _size) {
+        _texture = Texture2D{};
+        createTexture(_internalFormat, size);
+        _size = size;
+    }
+
+    glyphs = std::move(newGlyphs);
+    _data = std::move(data);
+    _packer = std::move(packer);
+    _dirty.clear();
+    _fullUpload = true;
+    ++_generation;
+    ++_revision;
+
+    rectangles.clear();
+    rectangles.reserve(sizes.size());
+    for(std::size_t i = kept.size(); i != placements.size(); ++i)
+        rectangles.push_back(placements[i].rectangle);
+    return true;
+}
+
+void DynamicGlyphCache::setImage(const Vector2i& offset, const ImageReference2D& image) {
+    /* Allocate the in-memory copy on first use */
+    if(!_pixelSize) {
+        _format = image.format();
+        _type = image.type();
+        _pixelSize = image.pixelSize();
+        _data = Containers::Array<char>{rowSize(_size.x())*_size.y()};
+        std::memset(_data.data(), 0, _data.size());
+    }
+
+    CORRADE_ASSERT(image.format() == _format && image.type() == _type,
+        "Text::DynamicGlyphCache::setImage(): expected" << _format << "and" << _type << "but got" << image.format() << "and" << image.type(), );
+
+    const Range2Di rectangle = Range2Di::fromSize(offset, image.size());
+    CORRADE_ASSERT((rectangle.min() >= Vector2i{}).all() && (rectangle.max() <= _size).all(),
+        "Text::DynamicGlyphCache::setImage(): image doesn't fit into the cache", );
+
+    const std::size_t imageRowSize = rowSize(image.size().x());
+    for(Int y = 0; y != image.size().y(); ++y) {
+        std::memcpy(_data.data() + rowSize(_size.x())*(offset.y() + y) + _pixelSize*offset.x(),
+            image.data() + imageRowSize*y, _pixelSize*image.size().x());
+    }
+
+    _dirty.push_back(rectangle);
+}
+
+void DynamicGlyphCache::flush() {
+    if(!_pixelSize) return;
+
+    /* Upload everything after repacking */
+    if(_fullUpload) {
+        GlyphCache::setImage({}, ImageReference2D{_format, _type, _size, _data.data()});
+        _fullUpload = false;
+        _dirty.clear();
+        return;
+    }
+
+    /* Upload only the changed rectangles */
+    Containers::Array<char> data;
+    for(const Range2Di& rectangle: _dirty) {
+        const std::size_t dataRowSize = rowSize(rectangle.sizeX());
+        if(data.size() < dataRowSize*rectangle.sizeY())
+            data = Containers::Array<char>{dataRowSize*rectangle.sizeY()};
+
+        for(Int y = 0; y != rectangle.sizeY(); ++y) {
+            std::memcpy(data.data() + dataRowSize*y,
+                _data.data() + rowSize(_size.x())*(rectangle.bottom() + y) + _pixelSize*rectangle.left(),
+                _pixelSize*rectangle.sizeX());
+        }
+
+        GlyphCache::setImage(rectangle.min(), ImageReference2D{_format, _type, rectangle.size(), data.data()});
+    }
+
+    _dirty.clear();
+}
+
+std::size_t DynamicGlyphCache::rowSize(const Int width) const {
+    /* Rows are aligned to four bytes, same as in Image */
+    return ((width*_pixelSize + 3)/4)*4;
+}
+
+}}
@@ -0,0 +1,171 @@
+#ifndef Magnum_Text_DynamicGlyphCache_h
+#define Magnum_Text_DynamicGlyphCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Class @ref Magnum::Text::DynamicGlyphCache
+ */
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Text/GlyphCache.h"
+#include "Magnum/Text/Text.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Dynamically growing glyph cache
+
+Unlike @ref GlyphCache, which is filled once with a fixed set of glyphs, this
+cache rasterizes glyphs on demand, so it can be used for rendering arbitrary
+Unicode text. When the texture is full, it is enlarged up to the maximal
+size. If even that is not enough, least recently used glyphs are evicted.
+
+## Usage
+
+Call @ref update() with text before rendering it. Only glyphs which are not
+yet in the cache are rasterized and only the changed parts of the texture are
+uploaded. Call @ref nextFrame() after everything is rendered --- glyphs used in
+current frame are never evicted.
+@code
+Text::AbstractFont* font;
+Text::DynamicGlyphCache cache{Vector2i(256), Vector2i(2048)};
+
+cache.update(*font, text);
+if(cache.generation() != textGeneration) {
+    // re-render all text, glyphs were moved
+}
+// render the text ...
+cache.nextFrame();
+@endcode
+
+When the texture is enlarged or glyphs are evicted, all glyphs are repacked
+and their positions in the texture change. Text rendered before that has
+invalid texture coordinates and needs to be rendered again, check
+@ref generation() to detect that.
+
+The cache keeps a copy of the texture data in memory, which is used for
+moving the glyphs around when repacking without rasterizing them again and
+without reading the texture back. The glyph images are expected to be all in
+the same format.
+
+@note Enlarging the texture into @ref Texture2DArray layers would require
+    support in the layouters and shaders, which work with 2D textures only,
+    so the texture is enlarged in place instead.
+@see @ref AbstractFont::fillGlyphCache()
+*/
+class MAGNUM_TEXT_EXPORT DynamicGlyphCache: public GlyphCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param internalFormat    Internal texture format
+         * @param initialSize       Initial texture size
+         * @param maxSize           Maximal texture size
+         * @param padding           Padding around every glyph
+         */
+        explicit DynamicGlyphCache(TextureFormat internalFormat, const Vector2i& initialSize, const Vector2i& maxSize, const Vector2i& padding = Vector2i());
+
+        /**
+         * @brief Constructor
+         *
+         * Sets internal texture format to red channel only, see
+         * @ref GlyphCache::GlyphCache(const Vector2i&, const Vector2i&) for
+         * more information.
+         */
+        explicit DynamicGlyphCache(const Vector2i& initialSize, const Vector2i& maxSize, const Vector2i& padding = Vector2i());
+
+        ~DynamicGlyphCache();
+
+        /** @brief Maximal texture size */
+        Vector2i maxTextureSize() const { return _maxSize; }
+
+        /**
+         * @brief Cache generation
+         *
+         * Incremented every time the glyphs are repacked, i.e. when the
+         * texture is enlarged or when some glyphs are evicted. All text
+         * rendered with previous generation needs to be rendered again.
+         */
+        UnsignedInt generation() const { return _generation; }
+
+        /** @brief Current frame */
+        UnsignedInt frame() const { return _frame; }
+
+        /**
+         * @brief Ensure that glyphs for given characters are in the cache
+         *
+         * Marks all glyphs for given UTF-8 @p characters as used in
+         * current frame and rasterizes these which are not yet in the cache
+         * using @ref AbstractFont::fillGlyphCache(). Changed parts of the
+         * texture are then uploaded. Characters which are not in the font
+         * are ignored. Returns `false` if the glyphs don't fit into the cache
+         * even with maximal texture size and all glyphs not used in current
+         * frame evicted, `true` otherwise.
+         */
+        bool update(AbstractFont& font, const std::string& characters);
+
+        /**
+         * @brief Advance to next frame
+         *
+         * Glyphs not used since then can be evicted.
+         */
+        void nextFrame() { ++_frame; }
+
+        /**
+         * @brief Set cache image
+         *
+         * Copies the image into in-memory copy of the texture and marks the
+         * area for upload in next @ref update().
+         */
+        void setImage(const Vector2i& offset, const ImageReference2D& image) override;
+
+    private:
+        std::vector<Range2Di> doReserve(const std::vector<Vector2i>& sizes) override;
+
+        bool MAGNUM_LOCAL repack(const Vector2i& size, const std::vector<UnsignedInt>& kept, const std::vector<Vector2i>& sizes, std::vector<Range2Di>& rectangles);
+        void MAGNUM_LOCAL flush();
+        std::size_t MAGNUM_LOCAL rowSize(Int width) const;
+
+        Vector2i _maxSize;
+        UnsignedInt _generation, _frame;
+        std::unordered_map<UnsignedInt, UnsignedInt> _lastUsed;
+
+        ColorFormat _format;
+        ColorType _type;
+        std::size_t _pixelSize;
+        Containers::Array<char> _data;
+        std::vector<Range2Di> _dirty;
+        bool _fullUpload;
+};
+
+}}
+
+#endif
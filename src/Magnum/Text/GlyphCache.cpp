@@ -29,19 +29,18 @@
 #include "Magnum/Extensions.h"
 #include "Magnum/Image.h"
 #include "Magnum/TextureFormat.h"
-#include "Magnum/TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
 GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& size, const Vector2i& padding): GlyphCache{internalFormat, size, size, padding} {}
 
-GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding) {
+GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding), _packer{originalSize, padding} {
     initialize(internalFormat, size);
 }
 
 GlyphCache::GlyphCache(const Vector2i& size, const Vector2i& padding): GlyphCache{size, size, padding} {}
 
-GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding) {
+GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding), _packer{originalSize, padding} {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::texture_rg);
     #endif
@@ -63,21 +62,43 @@ GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const
 GlyphCache::~GlyphCache() = default;
 
 void GlyphCache::initialize(const TextureFormat internalFormat, const Vector2i& size) {
-    /* Initialize texture */
+    _revision = 0;
+    createTexture(internalFormat, size);
+
+    /* Default "Not Found" glyph */
+    glyphs.insert({0, {}});
+}
+
+void GlyphCache::createTexture(const TextureFormat internalFormat, const Vector2i& size) {
+    _internalFormat = internalFormat;
     _texture.setWrapping(Sampler::Wrapping::ClampToEdge)
         .setMinificationFilter(Sampler::Filter::Linear)
         .setMagnificationFilter(Sampler::Filter::Linear)
         .setStorage(1, internalFormat, size);
-
-    /* Default "Not Found" glyph */
-    glyphs.insert({0, {}});
 }
 
 std::vector<Range2Di> GlyphCache::reserve(const std::vector<Vector2i>& sizes) {
-    CORRADE_ASSERT((glyphs.size() == 1 && glyphs.at(0) == std::pair<Vector2i, Range2Di>()),
-        "Text::GlyphCache::reserve(): reserving space in non-empty cache is not yet implemented", {});
+    if(sizes.empty()) return {};
+
+    return doReserve(sizes);
+}
+
+std::vector<Range2Di> GlyphCache::doReserve(const std::vector<Vector2i>& sizes) {
+
+    const std::vector<TextureTools::AtlasPacker::Placement> placements = _packer.add(sizes);
+    if(placements.empty()) {
+        Error() << "Text::GlyphCache::reserve(): cannot fit" << sizes.size()
+                << "glyphs into remaining space of cache with size" << _size;
+        return {};
+    }
+
     glyphs.reserve(glyphs.size() + sizes.size());
-    return TextureTools::atlas(_size, sizes, _padding);
+
+    std::vector<Range2Di> rectangles;
+    rectangles.reserve(placements.size());
+    for(const TextureTools::AtlasPacker::Placement& placement: placements)
+        rectangles.push_back(placement.rectangle);
+    return rectangles;
 }
 
 void GlyphCache::insert(const UnsignedInt glyph, const Vector2i& position, const Range2Di& rectangle) {
@@ -88,6 +109,8 @@ void GlyphCache::insert(const UnsignedInt glyph, const Vector2i& position, const
 
     /* Inserting new glyph */
     else CORRADE_INTERNAL_ASSERT_OUTPUT(glyphs.insert({glyph, glyphData}).second);
+
+    ++_revision;
 }
 
 void GlyphCache::setImage(const Vector2i& offset, const ImageReference2D& image) {
@@ -35,6 +35,7 @@
 #include "Magnum/Math/Range.h"
 #include "Magnum/Texture.h"
 #include "Magnum/Text/visibility.h"
+#include "Magnum/TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
@@ -114,6 +115,17 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         /** @brief Count of glyphs in the cache */
         std::size_t glyphCount() const { return glyphs.size(); }
 
+        /**
+         * @brief Cache revision
+         *
+         * Incremented every time a glyph is inserted or the glyphs are moved
+         * in the texture. Text laid out with previous revision might have
+         * outdated texture coordinates. Used by @ref AbstractFont to
+         * invalidate its layout cache.
+         * @see @ref AbstractFont::setLayoutCacheSize()
+         */
+        UnsignedInt revision() const { return _revision; }
+
         /** @brief Cache texture */
         Texture2D& texture() { return _texture; }
 
@@ -149,15 +161,16 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         /**
          * @brief Layout glyphs with given sizes to the cache
          *
-         * Returns non-overlapping regions in cache texture to store glyphs.
-         * The reserved space is reused on next call to @ref reserve() if no
-         * glyph was stored there, use @ref insert() to store actual glyph on
-         * given position and @ref setImage() to upload glyph image.
+         * Returns non-overlapping regions in cache texture to store glyphs,
+         * use @ref insert() to store actual glyph on given position and
+         * @ref setImage() to upload glyph image. The space is packed using
+         * @ref TextureTools::AtlasPacker and subsequent calls reserve space
+         * next to already reserved regions, so the cache can be filled
+         * incrementally. If the glyphs don't fit into remaining space, empty
+         * vector is returned and nothing is reserved.
          *
          * Glyph @p sizes are expected to be without padding.
          *
-         * @attention Cache size must be large enough to contain all rendered
-         *      glyphs.
          * @see @ref padding()
          */
         std::vector<Range2Di> reserve(const std::vector<Vector2i>& sizes);
@@ -188,10 +201,20 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         virtual void setImage(const Vector2i& offset, const ImageReference2D& image);
 
     private:
+        friend class DynamicGlyphCache;
+
+        /* Implementation for reserve(), default packs the sizes into
+           remaining space */
+        virtual std::vector<Range2Di> doReserve(const std::vector<Vector2i>& sizes);
+
         void MAGNUM_LOCAL initialize(TextureFormat internalFormat, const Vector2i& size);
+        void MAGNUM_LOCAL createTexture(TextureFormat internalFormat, const Vector2i& size);
 
         Vector2i _size, _padding;
+        UnsignedInt _revision;
+        TextureFormat _internalFormat;
         Texture2D _texture;
+        TextureTools::AtlasPacker _packer;
 
         std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>> glyphs;
 };
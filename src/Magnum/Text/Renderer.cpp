@@ -25,10 +25,15 @@
 
 #include "Renderer.h"
 
+#include <algorithm>
+
+#include "Magnum/AllocationTracker.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Mesh.h"
 #include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/Shaders/AbstractVector.h"
 #include "Magnum/Text/AbstractFont.h"
 
@@ -60,12 +65,69 @@ struct Vertex {
     Vector2 position, textureCoordinates;
 };
 
-std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const Alignment alignment) {
-    /* Output data, reserve memory as when the text would be ASCII-only. In
-       reality the actual vertex count will be smaller, but allocating more at
-       once is better than reallocating many times later. */
-    std::vector<Vertex> vertices;
-    vertices.reserve(text.size()*4);
+/* Horizontal alignment offset of a line with given bounds */
+Float alignmentOffsetX(const Range2D& rectangle, const Alignment alignment) {
+    Float offset = 0.0f;
+    if((UnsignedByte(alignment) & Implementation::AlignmentHorizontal) == Implementation::AlignmentCenter)
+        offset = -rectangle.centerX();
+    else if((UnsignedByte(alignment) & Implementation::AlignmentHorizontal) == Implementation::AlignmentRight)
+        offset = -rectangle.right();
+
+    /* Integer alignment */
+    if(UnsignedByte(alignment) & Implementation::AlignmentIntegral)
+        offset = Math::round(offset);
+
+    return offset;
+}
+
+/* Vertical alignment offset of a text with given bounds */
+Float alignmentOffsetY(const Range2D& rectangle, const Alignment alignment) {
+    Float offset = 0.0f;
+    if((UnsignedByte(alignment) & Implementation::AlignmentVertical) == Implementation::AlignmentMiddle)
+        offset = -rectangle.centerY();
+    else if((UnsignedByte(alignment) & Implementation::AlignmentVertical) == Implementation::AlignmentTop)
+        offset = -rectangle.top();
+
+    /* Integer alignment */
+    if(UnsignedByte(alignment) & Implementation::AlignmentIntegral)
+        offset = Math::round(offset);
+
+    return offset;
+}
+
+/* Extends the bounds with another non-empty bounds, similarly to
+   AbstractLayouter::renderGlyph() */
+void extendRectangle(Range2D& rectangle, const Range2D& other) {
+    if(other.size().isZero()) return;
+
+    if(!rectangle.size().isZero()) {
+        rectangle.bottomLeft() = Math::min(rectangle.bottomLeft(), other.bottomLeft());
+        rectangle.topRight() = Math::max(rectangle.topRight(), other.topRight());
+    } else rectangle = other;
+}
+
+/* Renders all glyphs of the layouter as quads and appends them to the
+   output */
+template<class T> void renderGlyphs(AbstractLayouter& layouter, Vector2& cursorPosition, Range2D& rectangle, std::vector<T>& out) {
+    for(UnsignedInt i = 0; i != layouter.glyphCount(); ++i) {
+        Range2D quadPosition, textureCoordinates;
+        std::tie(quadPosition, textureCoordinates) = layouter.renderGlyph(i, cursorPosition, rectangle);
+
+        out.push_back({quadPosition.topLeft(), textureCoordinates.topLeft()});
+        out.push_back({quadPosition.bottomLeft(), textureCoordinates.bottomLeft()});
+        out.push_back({quadPosition.topRight(), textureCoordinates.topRight()});
+        out.push_back({quadPosition.bottomRight(), textureCoordinates.bottomRight()});
+    }
+}
+
+/* Lays out the text into given vertex memory, using `line` as a temporary
+   buffer so nothing is allocated for each new line. Returns total count of
+   vertices needed for the text and its bounds. If the count is larger than
+   size of the output, the lines that don't fit are only counted, not
+   rendered. */
+std::pair<std::size_t, Range2D> renderVerticesInto(AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const Alignment alignment, std::string& line, const Containers::ArrayReference<Vertex> output) {
+    Vertex* const vertices = output.data();
+    std::size_t vertexCount = 0;
 
     /* Total rendered bounds, intial line position, line increment, last+1
        vertex on previous line */
@@ -74,15 +136,10 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
     const Vector2 lineAdvance = Vector2::yAxis(font.lineHeight()*size/font.size());
     std::size_t lastLineLastVertex = 0;
 
-    /* Temp buffer so we don't allocate for each new line */
+    /* Render each line separately and align it horizontally */
     /**
-     * @todo C++1z: use std::string_view to avoid the one allocation and all
-     *      the copying altogether
+     * @todo C++1z: use std::string_view to avoid all the copying altogether
      */
-    std::string line;
-    line.reserve(text.size());
-
-    /* Render each line separately and align it horizontally */
     std::size_t pos, prevPos = 0;
     do {
         /* Empty line, nothing to do (the rest is done below in while expression) */
@@ -93,13 +150,14 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
 
         /* Layout the line */
         const auto layouter = font.layout(cache, size, line);
-        const UnsignedInt vertexCount = layouter->glyphCount()*4;
+        const std::size_t lineVertexCount = layouter->glyphCount()*4;
 
-        /* Verify that we don't reallocate anything. The only problem might
-           arise when the layouter decides to compose one character from more
-           than one glyph (i.e. accents). Will remove the assert when this
-           issue arises. */
-        CORRADE_INTERNAL_ASSERT(vertices.size()+vertexCount <= vertices.capacity());
+        /* The line doesn't fit into the output, just count the vertices so
+           the caller knows how much it needs */
+        if(vertexCount + lineVertexCount > output.size()) {
+            vertexCount += lineVertexCount;
+            continue;
+        }
 
         /* Bounds of rendered line */
         Range2D lineRectangle;
@@ -116,31 +174,21 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
                |   |
                1---3 */
 
-            vertices.insert(vertices.end(), {
-                {quadPosition.topLeft(), textureCoordinates.topLeft()},
-                {quadPosition.bottomLeft(), textureCoordinates.bottomLeft()},
-                {quadPosition.topRight(), textureCoordinates.topRight()},
-                {quadPosition.bottomRight(), textureCoordinates.bottomRight()}
-            });
+            vertices[vertexCount++] = {quadPosition.topLeft(), textureCoordinates.topLeft()};
+            vertices[vertexCount++] = {quadPosition.bottomLeft(), textureCoordinates.bottomLeft()};
+            vertices[vertexCount++] = {quadPosition.topRight(), textureCoordinates.topRight()};
+            vertices[vertexCount++] = {quadPosition.bottomRight(), textureCoordinates.bottomRight()};
         }
 
         /** @todo What about top-down text? */
 
         /* Horizontally align the rendered line */
-        Float alignmentOffsetX = 0.0f;
-        if((UnsignedByte(alignment) & Implementation::AlignmentHorizontal) == Implementation::AlignmentCenter)
-            alignmentOffsetX = -lineRectangle.centerX();
-        else if((UnsignedByte(alignment) & Implementation::AlignmentHorizontal) == Implementation::AlignmentRight)
-            alignmentOffsetX = -lineRectangle.right();
-
-        /* Integer alignment */
-        if(UnsignedByte(alignment) & Implementation::AlignmentIntegral)
-            alignmentOffsetX = Math::round(alignmentOffsetX);
+        const Float offsetX = alignmentOffsetX(lineRectangle, alignment);
 
         /* Align positions and bounds on current line */
-        lineRectangle = lineRectangle.translated(Vector2::xAxis(alignmentOffsetX));
-        for(auto it = vertices.begin()+lastLineLastVertex; it != vertices.end(); ++it)
-            it->position.x() += alignmentOffsetX;
+        lineRectangle = lineRectangle.translated(Vector2::xAxis(offsetX));
+        for(std::size_t i = lastLineLastVertex; i != vertexCount; ++i)
+            vertices[i].position.x() += offsetX;
 
         /* Add final line bounds to total bounds, similarly to AbstractFont::renderGlyph() */
         if(!rectangle.size().isZero()) {
@@ -151,24 +199,42 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
     /* Move to next line */
     } while(prevPos = pos+1,
             linePosition -= lineAdvance,
-            lastLineLastVertex = vertices.size(),
+            lastLineLastVertex = vertexCount,
             pos != std::string::npos);
 
     /* Vertically align the rendered text */
-    Float alignmentOffsetY = 0.0f;
-    if((UnsignedByte(alignment) & Implementation::AlignmentVertical) == Implementation::AlignmentMiddle)
-        alignmentOffsetY = -rectangle.centerY();
-    else if((UnsignedByte(alignment) & Implementation::AlignmentVertical) == Implementation::AlignmentTop)
-        alignmentOffsetY = -rectangle.top();
-
-    /* Integer alignment */
-    if(UnsignedByte(alignment) & Implementation::AlignmentIntegral)
-        alignmentOffsetY = Math::round(alignmentOffsetY);
+    const Float offsetY = alignmentOffsetY(rectangle, alignment);
 
     /* Align positions and bounds */
-    rectangle = rectangle.translated(Vector2::yAxis(alignmentOffsetY));
-    for(auto& v: vertices) v.position.y() += alignmentOffsetY;
+    rectangle = rectangle.translated(Vector2::yAxis(offsetY));
+    for(std::size_t i = 0, end = std::min(vertexCount, output.size()); i != end; ++i)
+        vertices[i].position.y() += offsetY;
 
+    return {vertexCount, rectangle};
+}
+
+std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const Alignment alignment) {
+    /* Output data, allocate memory as when the text would be ASCII-only. In
+       reality the actual vertex count will be smaller, but allocating more at
+       once is better than reallocating many times later. */
+    std::vector<Vertex> vertices(text.size()*4);
+
+    /* Temp buffer so we don't allocate for each new line */
+    std::string line;
+    line.reserve(text.size());
+
+    std::size_t vertexCount;
+    Range2D rectangle;
+    std::tie(vertexCount, rectangle) = renderVerticesInto(font, cache, size, text, alignment, line, {vertices.data(), vertices.size()});
+
+    /* The layouter composed some characters from more than one glyph (i.e.
+       accents), render again with enough memory */
+    if(vertexCount > vertices.size()) {
+        vertices.resize(vertexCount);
+        std::tie(vertexCount, rectangle) = renderVerticesInto(font, cache, size, text, alignment, line, {vertices.data(), vertices.size()});
+    }
+
+    vertices.resize(vertexCount);
     return std::make_tuple(std::move(vertices), rectangle);
 }
 
@@ -195,6 +261,15 @@ std::pair<Containers::Array<char>, Mesh::IndexType> renderIndicesInternal(const
     return {std::move(indices), indexType};
 }
 
+/* Texts in 3D batch are laid out on the XY plane */
+inline Vector2 transformPosition(const Matrix3& transformation, const Vector2& position) {
+    return transformation.transformPoint(position);
+}
+
+inline Vector3 transformPosition(const Matrix4& transformation, const Vector2& position) {
+    return transformation.transformPoint({position, 0.0f});
+}
+
 std::tuple<Mesh, Range2D> renderInternal(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment) {
     /* Render vertices and upload them */
     std::vector<Vertex> vertices;
@@ -224,6 +299,8 @@ std::tuple<Mesh, Range2D> renderInternal(AbstractFont& font, const GlyphCache& c
 }
 
 std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> AbstractRenderer::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment) {
+    MAGNUM_ALLOCATION_SCOPE(Text);
+
     /* Render vertices */
     std::vector<Vertex> vertices;
     Range2D rectangle;
@@ -247,6 +324,8 @@ std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>,
 }
 
 template<UnsignedInt dimensions> std::tuple<Mesh, Range2D> Renderer<dimensions>::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment) {
+    MAGNUM_ALLOCATION_SCOPE(Text);
+
     /* Finalize mesh configuration and return the result */
     auto r = renderInternal(font, cache, size, text, vertexBuffer, indexBuffer, usage, alignment);
     Mesh& mesh = std::get<0>(r);
@@ -274,32 +353,27 @@ void AbstractRenderer::bufferUnmapImplementationSub(Buffer& buffer) {
 }
 #endif
 
-#if !defined(MAGNUM_TARGET_GLES2) || defined(CORRADE_TARGET_EMSCRIPTEN)
+/* Buffer mapping is not available in WebGL, the data are uploaded directly
+   from the scratch memory there */
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#ifndef MAGNUM_TARGET_GLES2
 inline void* AbstractRenderer::bufferMapImplementation(Buffer& buffer, GLsizeiptr length)
 #else
 void* AbstractRenderer::bufferMapImplementationRange(Buffer& buffer, GLsizeiptr length)
 #endif
 {
-    #ifndef CORRADE_TARGET_EMSCRIPTEN
     return buffer.map(0, length, Buffer::MapFlag::InvalidateBuffer|Buffer::MapFlag::Write);
-    #else
-    static_cast<void>(length);
-    return &buffer == &_indexBuffer ? _indexBufferData : _vertexBufferData;
-    #endif
 }
 
-#if !defined(MAGNUM_TARGET_GLES2) || defined(CORRADE_TARGET_EMSCRIPTEN)
+#ifndef MAGNUM_TARGET_GLES2
 inline void AbstractRenderer::bufferUnmapImplementation(Buffer& buffer)
 #else
 void AbstractRenderer::bufferUnmapImplementationDefault(Buffer& buffer)
 #endif
 {
-    #ifndef CORRADE_TARGET_EMSCRIPTEN
     buffer.unmap();
-    #else
-    buffer.setSubData(0, &buffer == &_indexBuffer ? _indexBufferData : _vertexBufferData);
-    #endif
 }
+#endif
 
 AbstractRenderer::AbstractRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment): _vertexBuffer{Buffer::TargetHint::Array}, _indexBuffer{Buffer::TargetHint::ElementArray}, font(font), cache(cache), size(size), _alignment(alignment), _capacity(0) {
     #ifndef MAGNUM_TARGET_GLES
@@ -339,59 +413,381 @@ void AbstractRenderer::reserve(const uint32_t glyphCount, const BufferUsage vert
 
     /* Allocate vertex buffer, reset vertex count */
     _vertexBuffer.setData({nullptr, vertexCount*sizeof(Vertex)}, vertexBufferUsage);
-    #ifdef CORRADE_TARGET_EMSCRIPTEN
-    _vertexBufferData = Containers::Array<UnsignedByte>(vertexCount*sizeof(Vertex));
-    #endif
     _mesh.setCount(0);
 
+    /* Allocate scratch memory for render(), assuming at most four bytes of
+       UTF-8 per glyph for the line buffer */
+    _vertexScratch = Containers::Array<UnsignedByte>(vertexCount*sizeof(Vertex));
+    _lineScratch.reserve(glyphCount*4);
+
     /* Render indices */
     Containers::Array<char> indexData;
     Mesh::IndexType indexType;
     std::tie(indexData, indexType) = renderIndicesInternal(glyphCount);
 
-    /* Allocate index buffer, reset index count and reconfigure buffer binding */
+    /* Allocate and prefill index buffer, reset index count and reconfigure
+       buffer binding */
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
     _indexBuffer.setData({nullptr, indexData.size()}, indexBufferUsage);
-    #ifdef CORRADE_TARGET_EMSCRIPTEN
-    _indexBufferData = Containers::Array<UnsignedByte>(indexData.size());
-    #endif
-    _mesh.setCount(0)
-        .setIndexBuffer(_indexBuffer, 0, indexType, 0, vertexCount);
-
-    /* Prefill index buffer */
     char* const indices = static_cast<char*>(bufferMapImplementation(_indexBuffer, indexData.size()));
     CORRADE_INTERNAL_ASSERT(indices);
-    /** @todo Emscripten: it can be done without this copying altogether */
     std::copy(indexData.begin(), indexData.end(), indices);
     bufferUnmapImplementation(_indexBuffer);
+    #else
+    _indexBuffer.setData(indexData, indexBufferUsage);
+    #endif
+    _mesh.setCount(0)
+        .setIndexBuffer(_indexBuffer, 0, indexType, 0, vertexCount);
 }
 
 void AbstractRenderer::render(const std::string& text) {
-    /* Render vertex data */
-    std::vector<Vertex> vertexData;
-    _rectangle = {};
-    std::tie(vertexData, _rectangle) = renderVerticesInternal(font, cache, size, text, _alignment);
+    MAGNUM_ALLOCATION_SCOPE(Text);
 
-    const UnsignedInt glyphCount = vertexData.size()/4;
-    const UnsignedInt vertexCount = glyphCount*4;
+    /* Render vertex data into scratch memory allocated in reserve(), so
+       nothing is allocated here */
+    std::size_t vertexCount;
+    std::tie(vertexCount, _rectangle) = renderVerticesInto(font, cache, size, text, _alignment, _lineScratch, {reinterpret_cast<Vertex*>(_vertexScratch.data()), _capacity*4});
+
+    const UnsignedInt glyphCount = vertexCount/4;
     const UnsignedInt indexCount = glyphCount*6;
 
     CORRADE_ASSERT(glyphCount <= _capacity,
         "Text::Renderer::render(): capacity" << _capacity << "too small to render" << glyphCount << "glyphs", );
 
-    /* Interleave the data into mapped buffer*/
-    Containers::ArrayReference<Vertex> vertices(static_cast<Vertex*>(bufferMapImplementation(_vertexBuffer,
-        vertexCount*sizeof(Vertex))), vertexCount);
-    CORRADE_INTERNAL_ASSERT_OUTPUT(vertices);
-    std::copy(vertexData.begin(), vertexData.end(), vertices.begin());
-    bufferUnmapImplementation(_vertexBuffer);
+    /* Copy the data into mapped buffer. Zero-length mapping is an error, so
+       skip it for empty text. In WebGL upload just the used part of the
+       scratch memory in a single call instead. */
+    if(vertexCount) {
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        Vertex* const vertices = static_cast<Vertex*>(bufferMapImplementation(_vertexBuffer, vertexCount*sizeof(Vertex)));
+        CORRADE_INTERNAL_ASSERT(vertices);
+        const Vertex* const scratch = reinterpret_cast<const Vertex*>(_vertexScratch.data());
+        std::copy(scratch, scratch + vertexCount, vertices);
+        bufferUnmapImplementation(_vertexBuffer);
+        #else
+        _vertexBuffer.setSubData(0, {_vertexScratch.data(), vertexCount*sizeof(Vertex)});
+        #endif
+    }
 
     /* Update index count */
     _mesh.setCount(indexCount);
 }
 
+template<UnsignedInt dimensions> BatchRenderer<dimensions>::BatchRenderer(AbstractFont& font, const GlyphCache& cache, const Float size): _vertexBuffer{Buffer::TargetHint::Array}, _indexBuffer{Buffer::TargetHint::ElementArray}, _font(font), _cache(cache), _size(size), _capacity(0) {
+    _mesh.setPrimitive(MeshPrimitive::Triangles)
+        .addVertexBuffer(_vertexBuffer, 0,
+            typename Shaders::AbstractVector<dimensions>::Position(),
+            typename Shaders::AbstractVector<dimensions>::TextureCoordinates(),
+            typename Shaders::AbstractVector<dimensions>::Color());
+}
+
+template<UnsignedInt dimensions> void BatchRenderer<dimensions>::reserve(const UnsignedInt glyphCount, const BufferUsage vertexBufferUsage, const BufferUsage indexBufferUsage) {
+    _capacity = glyphCount;
+
+    const UnsignedInt vertexCount = glyphCount*4;
+
+    /* Allocate vertex buffer, remove all texts */
+    _vertexBuffer.setData({nullptr, vertexCount*sizeof(Vertex)}, vertexBufferUsage);
+    _vertices.clear();
+    _vertices.reserve(vertexCount);
+
+    /* Render indices, upload them and reconfigure buffer binding */
+    Containers::Array<char> indexData;
+    Mesh::IndexType indexType;
+    std::tie(indexData, indexType) = renderIndicesInternal(glyphCount);
+    _indexBuffer.setData(indexData, indexBufferUsage);
+    _mesh.setCount(0)
+        .setIndexBuffer(_indexBuffer, 0, indexType, 0, vertexCount);
+
+    /* Allocate scratch memory for add(), assuming at most four bytes of UTF-8
+       per glyph for the line buffer */
+    _layoutScratch = Containers::Array<UnsignedByte>(vertexCount*sizeof(Text::Vertex));
+    _lineScratch.reserve(glyphCount*4);
+}
+
+template<UnsignedInt dimensions> Range2D BatchRenderer<dimensions>::add(const std::string& text, const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color, const Alignment alignment) {
+    MAGNUM_ALLOCATION_SCOPE(Text);
+
+    /* Lay out the text into the part of scratch memory corresponding to
+       remaining capacity */
+    const std::size_t remainingVertexCount = _capacity*4 - _vertices.size();
+    const Text::Vertex* const layouted = reinterpret_cast<const Text::Vertex*>(_layoutScratch.data());
+    std::size_t vertexCount;
+    Range2D rectangle;
+    std::tie(vertexCount, rectangle) = renderVerticesInto(_font, _cache, _size, text, alignment, _lineScratch, {reinterpret_cast<Text::Vertex*>(_layoutScratch.data()), remainingVertexCount});
+
+    CORRADE_ASSERT(vertexCount <= remainingVertexCount,
+        "Text::BatchRenderer::add(): capacity" << _capacity << "too small to add" << vertexCount/4 << "glyphs to" << glyphCount() << "glyphs already in the batch", {});
+
+    /* Transform the vertices and append them to the batch */
+    for(std::size_t i = 0; i != vertexCount; ++i)
+        _vertices.push_back({transformPosition(transformation, layouted[i].position), layouted[i].textureCoordinates, color});
+
+    return rectangle;
+}
+
+template<UnsignedInt dimensions> void BatchRenderer<dimensions>::update() {
+    MAGNUM_ALLOCATION_SCOPE(Text);
+
+    if(!_vertices.empty()) _vertexBuffer.setSubData(0, _vertices);
+    _mesh.setCount(glyphCount()*6);
+}
+
+template<UnsignedInt dimensions> ParagraphRenderer<dimensions>::ParagraphRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment): _vertexBuffer{Buffer::TargetHint::Array}, _indexBuffer{Buffer::TargetHint::ElementArray}, _font(font), _cache(cache), _size(size), _wrapWidth(0.0f), _verticalOffset(0.0f), _alignment(alignment), _capacity(0), _glyphCount(0), _rowCount(1), _lines(1, Line{0, {}, 1, {}}) {
+    #ifndef MAGNUM_TARGET_GLES
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::map_buffer_range);
+    #endif
+
+    _mesh.setPrimitive(MeshPrimitive::Triangles)
+        .addVertexBuffer(_vertexBuffer, 0,
+            typename Shaders::AbstractVector<dimensions>::Position(Shaders::AbstractVector<dimensions>::Position::Components::Two),
+            typename Shaders::AbstractVector<dimensions>::TextureCoordinates());
+}
+
+template<UnsignedInt dimensions> ParagraphRenderer<dimensions>& ParagraphRenderer<dimensions>::setWrapWidth(const Float width) {
+    _wrapWidth = width;
+
+    /* Lay out and upload everything */
+    std::size_t position = 0;
+    for(Line& line: _lines) {
+        layoutLine(line, _text, position);
+        position += line.size + 1;
+    }
+    upload(0, _lines.size());
+    return *this;
+}
+
+template<UnsignedInt dimensions> void ParagraphRenderer<dimensions>::reserve(const UnsignedInt glyphCount, const BufferUsage vertexBufferUsage, const BufferUsage indexBufferUsage) {
+    _capacity = glyphCount;
+
+    const UnsignedInt vertexCount = glyphCount*4;
+
+    /* Allocate vertex buffer */
+    _vertexBuffer.setData({nullptr, vertexCount*sizeof(Vertex)}, vertexBufferUsage);
+    #if defined(MAGNUM_TARGET_GLES2) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    _uploadScratch.resize(vertexCount);
+    #endif
+
+    /* Render indices, upload them and reconfigure buffer binding */
+    Containers::Array<char> indexData;
+    Mesh::IndexType indexType;
+    std::tie(indexData, indexType) = renderIndicesInternal(glyphCount);
+    _indexBuffer.setData(indexData, indexBufferUsage);
+    _mesh.setCount(0)
+        .setIndexBuffer(_indexBuffer, 0, indexType, 0, vertexCount);
+
+    /* The previous buffer contents are gone, upload everything again */
+    upload(0, _lines.size());
+}
+
+template<UnsignedInt dimensions> ParagraphRenderer<dimensions>& ParagraphRenderer<dimensions>::setText(const std::string& text) {
+    return replace(0, _text.size(), text);
+}
+
+template<UnsignedInt dimensions> ParagraphRenderer<dimensions>& ParagraphRenderer<dimensions>::replace(const std::size_t position, const std::size_t length, const std::string& text) {
+    MAGNUM_ALLOCATION_SCOPE(Text);
+
+    CORRADE_ASSERT(position <= _text.size() && length <= _text.size() - position,
+        "Text::ParagraphRenderer::replace(): range" << position << "+" << length << "out of bounds for text of" << _text.size() << "bytes", *this);
+
+    /* Find lines touched by the replaced range, including the line
+       containing its end. The position right before `\n` still belongs to
+       the line. */
+    std::size_t first = 0, firstPosition = 0;
+    while(position > firstPosition + _lines[first].size)
+        firstPosition += _lines[first++].size + 1;
+    std::size_t last = first, lastEnd = firstPosition + _lines[first].size;
+    while(position + length > lastEnd)
+        lastEnd += _lines[++last].size + 1;
+
+    UnsignedInt oldGlyphCount = 0;
+    std::size_t oldRowCount = 0;
+    for(std::size_t i = first; i <= last; ++i) {
+        oldGlyphCount += _lines[i].vertices.size()/4;
+        oldRowCount += _lines[i].rowCount;
+    }
+
+    /* Replace the text and make space for the new lines */
+    _text.replace(position, length, text);
+    const std::size_t end = lastEnd - length + text.size();
+    const std::size_t oldCount = last - first + 1;
+    const std::size_t count = 1 + std::count(_text.begin() + firstPosition, _text.begin() + end, '\n');
+    if(count > oldCount)
+        _lines.insert(_lines.begin() + last + 1, count - oldCount, Line{0, {}, 1, {}});
+    else if(count < oldCount)
+        _lines.erase(_lines.begin() + first + count, _lines.begin() + last + 1);
+
+    /* Lay out only the new lines */
+    UnsignedInt glyphCount = 0;
+    std::size_t rowCount = 0;
+    for(std::size_t i = first, linePosition = firstPosition; i != first + count; ++i) {
+        Line& line = _lines[i];
+        line.size = std::min(_text.find('\n', linePosition), end) - linePosition;
+        layoutLine(line, _text, linePosition);
+        linePosition += line.size + 1;
+
+        glyphCount += line.vertices.size()/4;
+        rowCount += line.rowCount;
+    }
+
+    /* If the glyph or row count changed, all following lines moved and need
+       to be uploaded too */
+    upload(first, count == oldCount && glyphCount == oldGlyphCount && rowCount == oldRowCount ? first + count : _lines.size());
+    return *this;
+}
+
+template<UnsignedInt dimensions> void ParagraphRenderer<dimensions>::layoutLine(Line& line, const std::string& text, const std::size_t position) {
+    line.vertices.clear();
+    line.rowCount = 1;
+    line.rectangle = {};
+
+    const Float lineAdvance = _font.lineHeight()*_size/_font.size();
+    Vector2 cursorPosition;
+    Range2D rowRectangle;
+    std::size_t rowFirstVertex = 0;
+    bool rowEmpty = true;
+
+    /* Spaces after last word, rendered only if the next word is on the same
+       row */
+    Range2D spaceRectangle;
+    std::size_t spaceFirstVertex = 0;
+
+    /* Aligns current row horizontally and adds it to line bounds */
+    auto finishRow = [&](const std::size_t rowEndVertex) {
+        const Float offsetX = alignmentOffsetX(rowRectangle, _alignment);
+        for(std::size_t i = rowFirstVertex; i != rowEndVertex; ++i)
+            line.vertices[i].position.x() += offsetX;
+        extendRectangle(line.rectangle, rowRectangle.translated(Vector2::xAxis(offsetX)));
+    };
+
+    const std::size_t end = position + line.size;
+    for(std::size_t wordBegin = position; wordBegin != end; ) {
+        /* Without wrapping the whole line is laid out at once */
+        std::size_t wordEnd = end, spaceEnd = end;
+        if(_wrapWidth) {
+            wordEnd = std::min(text.find(' ', wordBegin), end);
+            spaceEnd = std::min(text.find_first_not_of(' ', wordEnd), end);
+        }
+
+        /* Lay out the word */
+        if(wordEnd != wordBegin) {
+            _lineScratch.assign(text, wordBegin, wordEnd - wordBegin);
+            const auto layouter = _font.layout(_cache, _size, _lineScratch);
+            const Vector2 wordPosition = cursorPosition;
+            std::size_t wordFirstVertex = line.vertices.size();
+            Range2D wordRectangle;
+            renderGlyphs(*layouter, cursorPosition, wordRectangle, line.vertices);
+
+            /* The word doesn't fit, drop spaces before it and put it on a new
+               row */
+            if(_wrapWidth && !rowEmpty && cursorPosition.x() > _wrapWidth) {
+                line.vertices.erase(line.vertices.begin() + spaceFirstVertex, line.vertices.begin() + wordFirstVertex);
+                wordFirstVertex = spaceFirstVertex;
+                finishRow(wordFirstVertex);
+
+                const Vector2 offset{-wordPosition.x(), -Float(line.rowCount++)*lineAdvance - wordPosition.y()};
+                for(std::size_t i = wordFirstVertex; i != line.vertices.size(); ++i)
+                    line.vertices[i].position += offset;
+                cursorPosition += offset;
+                rowRectangle = wordRectangle.translated(offset);
+                rowFirstVertex = wordFirstVertex;
+
+            /* Otherwise add it to the row, together with the spaces */
+            } else {
+                extendRectangle(rowRectangle, spaceRectangle);
+                extendRectangle(rowRectangle, wordRectangle);
+            }
+
+            rowEmpty = false;
+        }
+
+        /* Lay out spaces after it */
+        spaceRectangle = {};
+        spaceFirstVertex = line.vertices.size();
+        if(spaceEnd != wordEnd) {
+            _lineScratch.assign(text, wordEnd, spaceEnd - wordEnd);
+            const auto layouter = _font.layout(_cache, _size, _lineScratch);
+            renderGlyphs(*layouter, cursorPosition, spaceRectangle, line.vertices);
+        }
+
+        wordBegin = spaceEnd;
+    }
+
+    /* Trailing spaces at the end of the line are kept */
+    extendRectangle(rowRectangle, spaceRectangle);
+    finishRow(line.vertices.size());
+}
+
+template<UnsignedInt dimensions> void ParagraphRenderer<dimensions>::upload(std::size_t firstLine, std::size_t lastLine) {
+    const Float lineAdvance = _font.lineHeight()*_size/_font.size();
+
+    /* Total bounds and glyph count */
+    Range2D rectangle;
+    UnsignedInt glyphCount = 0;
+    std::size_t rowCount = 0;
+    for(const Line& line: _lines) {
+        extendRectangle(rectangle, line.rectangle.translated(Vector2::yAxis(-Float(rowCount)*lineAdvance)));
+        glyphCount += line.vertices.size()/4;
+        rowCount += line.rowCount;
+    }
+
+    CORRADE_ASSERT(glyphCount <= _capacity,
+        "Text::ParagraphRenderer: capacity" << _capacity << "too small to render" << glyphCount << "glyphs", );
+
+    /* Vertical alignment changed, everything needs to be moved */
+    const Float verticalOffset = alignmentOffsetY(rectangle, _alignment);
+    if(verticalOffset != _verticalOffset) {
+        _verticalOffset = verticalOffset;
+        firstLine = 0;
+        lastLine = _lines.size();
+    }
+
+    _rectangle = rectangle.translated(Vector2::yAxis(verticalOffset));
+    _glyphCount = glyphCount;
+    _rowCount = rowCount;
+    _mesh.setCount(glyphCount*6);
+
+    /* Range of uploaded vertices */
+    std::size_t vertexOffset = 0, vertexCount = 0, rowOffset = 0;
+    for(std::size_t i = 0; i != firstLine; ++i) {
+        vertexOffset += _lines[i].vertices.size();
+        rowOffset += _lines[i].rowCount;
+    }
+    for(std::size_t i = firstLine; i != lastLine; ++i)
+        vertexCount += _lines[i].vertices.size();
+
+    /* Zero-length mapping is an error */
+    if(!vertexCount) return;
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+    Vertex* out = static_cast<Vertex*>(_vertexBuffer.map(vertexOffset*sizeof(Vertex), vertexCount*sizeof(Vertex), Buffer::MapFlag::InvalidateRange|Buffer::MapFlag::Write));
+    CORRADE_INTERNAL_ASSERT(out);
+    #else
+    Vertex* out = _uploadScratch.data();
+    #endif
+
+    /* Move the lines to their rows */
+    for(std::size_t i = firstLine; i != lastLine; ++i) {
+        const Vector2 offset = Vector2::yAxis(verticalOffset - Float(rowOffset)*lineAdvance);
+        for(const Vertex& vertex: _lines[i].vertices)
+            *out++ = {vertex.position + offset, vertex.textureCoordinates};
+        rowOffset += _lines[i].rowCount;
+    }
+
+    #if !defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+    _vertexBuffer.unmap();
+    #else
+    _vertexBuffer.setSubData(vertexOffset*sizeof(Vertex), {_uploadScratch.data(), vertexCount});
+    #endif
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_TEXT_EXPORT Renderer<2>;
 template class MAGNUM_TEXT_EXPORT Renderer<3>;
+template class MAGNUM_TEXT_EXPORT BatchRenderer<2>;
+template class MAGNUM_TEXT_EXPORT BatchRenderer<3>;
+template class MAGNUM_TEXT_EXPORT ParagraphRenderer<2>;
+template class MAGNUM_TEXT_EXPORT ParagraphRenderer<3>;
 #endif
 
 }}
@@ -26,7 +26,7 @@
 */
 
 /** @file Text/Renderer.h
- * @brief Class @ref Magnum::Text::AbstractRenderer, @ref Magnum::Text::Renderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D
+ * @brief Class @ref Magnum::Text::AbstractRenderer, @ref Magnum::Text::Renderer, @ref Magnum::Text::BatchRenderer, @ref Magnum::Text::ParagraphRenderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D, @ref Magnum::Text::BatchRenderer2D, @ref Magnum::Text::BatchRenderer3D, @ref Magnum::Text::ParagraphRenderer2D, @ref Magnum::Text::ParagraphRenderer3D
  */
 
 #include <string>
@@ -35,6 +35,7 @@
 
 #include "Magnum/Math/Range.h"
 #include "Magnum/Buffer.h"
+#include "Magnum/Color.h"
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/Mesh.h"
 #include "Magnum/Text/Text.h"
@@ -87,7 +88,9 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
          * @brief Reserve capacity for rendered glyphs
          *
          * Reallocates memory in buffers to hold @p glyphCount glyphs and
-         * prefills index buffer. Consider using appropriate @p vertexBufferUsage
+         * prefills index buffer. Also allocates scratch memory used by
+         * @ref render(), so the rendering itself doesn't need to allocate.
+         * Consider using appropriate @p vertexBufferUsage
          * if the text will be changed frequently. Index buffer is changed
          * only by calling this function, thus @p indexBufferUsage generally
          * doesn't need to be so dynamic if the capacity won't be changed much.
@@ -102,7 +105,10 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
          *
          * Renders the text to vertex buffer, reusing index buffer already
          * filled with @ref reserve(). Rectangle spanning the rendered text is
-         * available through @ref rectangle().
+         * available through @ref rectangle(). The text is laid out into
+         * scratch memory allocated in @ref reserve() and then copied into the
+         * mapped buffer, thus apart from what the font layouter itself
+         * allocates, no memory allocations are done.
          *
          * Initially no text is rendered.
          * @attention The capacity must be large enough to contain all glyphs,
@@ -121,9 +127,6 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
 
         Mesh _mesh;
         Buffer _vertexBuffer, _indexBuffer;
-        #ifdef CORRADE_TARGET_EMSCRIPTEN
-        Containers::Array<UnsignedByte> _vertexBufferData, _indexBufferData;
-        #endif
 
     private:
         AbstractFont& font;
@@ -132,6 +135,8 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         Alignment _alignment;
         UnsignedInt _capacity;
         Range2D _rectangle;
+        Containers::Array<UnsignedByte> _vertexScratch;
+        std::string _lineScratch;
 
         #if defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
         typedef void*(*BufferMapImplementation)(Buffer&, GLsizeiptr);
@@ -139,13 +144,8 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         static MAGNUM_TEXT_LOCAL void* bufferMapImplementationSub(Buffer& buffer, GLsizeiptr length);
         static MAGNUM_TEXT_LOCAL void* bufferMapImplementationRange(Buffer& buffer, GLsizeiptr length);
         static BufferMapImplementation bufferMapImplementation;
-        #else
-        #ifndef CORRADE_TARGET_EMSCRIPTEN
-        static
-        #else
-        MAGNUM_TEXT_LOCAL
-        #endif
-        void* bufferMapImplementation(Buffer& buffer, GLsizeiptr length);
+        #elif !defined(CORRADE_TARGET_EMSCRIPTEN)
+        static void* bufferMapImplementation(Buffer& buffer, GLsizeiptr length);
         #endif
 
         #if defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
@@ -153,13 +153,8 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         static MAGNUM_TEXT_LOCAL void bufferUnmapImplementationDefault(Buffer& buffer);
         static MAGNUM_TEXT_LOCAL void bufferUnmapImplementationSub(Buffer& buffer);
         static MAGNUM_TEXT_LOCAL BufferUnmapImplementation bufferUnmapImplementation;
-        #else
-        #ifndef CORRADE_TARGET_EMSCRIPTEN
-        static
-        #else
-        MAGNUM_TEXT_LOCAL
-        #endif
-        void bufferUnmapImplementation(Buffer& buffer);
+        #elif !defined(CORRADE_TARGET_EMSCRIPTEN)
+        static void bufferUnmapImplementation(Buffer& buffer);
         #endif
 };
 
@@ -271,6 +266,353 @@ typedef Renderer<2> Renderer2D;
 /** @brief Three-dimensional text renderer */
 typedef Renderer<3> Renderer3D;
 
+/**
+@brief Batch text renderer
+
+Accumulates many texts, each with its own transformation, color and alignment,
+into one vertex buffer sharing one index buffer, so all of them can be drawn
+with a single draw call. All texts use the same font, glyph cache and size.
+
+## Usage
+
+Reserve capacity for all glyphs in the batch, add the texts, upload them with
+@ref update() and draw the mesh with @ref Shaders::Vector or
+@ref Shaders::DistanceFieldVector created with
+@ref Shaders::AbstractVector::Flag::VertexColor "Flag::VertexColor". The
+per-text color is multiplied with the color set on the shader:
+@code
+std::unique_ptr<Text::AbstractFont> font;
+Text::GlyphCache cache;
+Shaders::Vector2D shader{Shaders::Vector2D::Flag::VertexColor};
+
+Text::BatchRenderer2D batch{*font, cache, 0.15f};
+batch.reserve(1024, BufferUsage::DynamicDraw, BufferUsage::StaticDraw);
+
+for(const Label& label: labels)
+    batch.add(label.text, Matrix3::translation(label.position), label.color,
+        Text::Alignment::MiddleCenter);
+batch.update();
+
+shader.setTransformationProjectionMatrix(projection)
+    .setColor(Color3(1.0f))
+    .setVectorTexture(cache.texture());
+batch.mesh().draw(shader);
+@endcode
+
+The texts are kept until @ref clear() or @ref reserve() is called, so static
+labels need to be laid out only once.
+
+## Required OpenGL functionality
+
+The shader needs to be created with
+@ref Shaders::AbstractVector::Flag::VertexColor "Flag::VertexColor". No
+buffer mapping is needed, the data are uploaded with @ref Buffer::setSubData().
+
+@see @ref BatchRenderer2D, @ref BatchRenderer3D, @ref Renderer
+*/
+template<UnsignedInt dimensions> class MAGNUM_TEXT_EXPORT BatchRenderer {
+    public:
+        /**
+         * @brief Constructor
+         * @param font          Font
+         * @param cache         Glyph cache
+         * @param size          Font size
+         */
+        explicit BatchRenderer(AbstractFont& font, const GlyphCache& cache, Float size);
+        BatchRenderer(AbstractFont&, GlyphCache&&, Float) = delete; /**< @overload */
+
+        /**
+         * @brief Capacity for rendered glyphs
+         *
+         * @see @ref reserve()
+         */
+        UnsignedInt capacity() const { return _capacity; }
+
+        /** @brief Count of glyphs added to the batch */
+        UnsignedInt glyphCount() const { return _vertices.size()/4; }
+
+        /** @brief Vertex buffer */
+        Buffer& vertexBuffer() { return _vertexBuffer; }
+
+        /** @brief Index buffer */
+        Buffer& indexBuffer() { return _indexBuffer; }
+
+        /**
+         * @brief Mesh
+         *
+         * Draws all glyphs uploaded with the last @ref update() call.
+         */
+        Mesh& mesh() { return _mesh; }
+
+        /**
+         * @brief Reserve capacity for rendered glyphs
+         *
+         * Reallocates memory in buffers to hold @p glyphCount glyphs, fills
+         * index buffer and removes all texts from the batch. Index buffer is
+         * changed only by calling this function, thus @p indexBufferUsage
+         * generally doesn't need to be dynamic.
+         *
+         * Initially zero capacity is reserved.
+         * @see @ref capacity()
+         */
+        void reserve(UnsignedInt glyphCount, BufferUsage vertexBufferUsage, BufferUsage indexBufferUsage);
+
+        /**
+         * @brief Add text to the batch
+         * @param text              Text to render
+         * @param transformation    Text transformation
+         * @param color             Text color
+         * @param alignment         Text alignment
+         *
+         * Lays out the text, aligns it, transforms it with @p transformation
+         * and appends it to the batch. In 3D the text is laid out on the XY
+         * plane. Returns rectangle spanning the text before the
+         * transformation is applied. The data are uploaded to the vertex
+         * buffer on next @ref update() call.
+         * @attention The remaining capacity must be large enough to contain
+         *      all glyphs, see @ref reserve() for more information.
+         */
+        Range2D add(const std::string& text, const MatrixTypeFor<dimensions, Float>& transformation, const Color4& color = Color4(1.0f), Alignment alignment = Alignment::LineLeft);
+
+        /**
+         * @brief Remove all texts from the batch
+         *
+         * The mesh is updated on next @ref update() call.
+         */
+        void clear() { _vertices.clear(); }
+
+        /**
+         * @brief Upload added texts to the vertex buffer
+         *
+         * Uploads all texts in one call and updates index count of
+         * @ref mesh().
+         */
+        void update();
+
+    private:
+        struct Vertex {
+            VectorTypeFor<dimensions, Float> position;
+            Vector2 textureCoordinates;
+            Color4 color;
+        };
+
+        Mesh _mesh;
+        Buffer _vertexBuffer, _indexBuffer;
+        AbstractFont& _font;
+        const GlyphCache& _cache;
+        Float _size;
+        UnsignedInt _capacity;
+        std::vector<Vertex> _vertices;
+        Containers::Array<UnsignedByte> _layoutScratch;
+        std::string _lineScratch;
+};
+
+/** @brief Two-dimensional batch text renderer */
+typedef BatchRenderer<2> BatchRenderer2D;
+
+/** @brief Three-dimensional batch text renderer */
+typedef BatchRenderer<3> BatchRenderer3D;
+
+/**
+@brief Paragraph text renderer
+
+Renders mutable multi-line text, optionally wrapped to given width, and
+updates it incrementally. While @ref Renderer::render() lays out the whole
+text again on every change, this renderer splits the text into lines at `\n`
+and keeps laid out glyphs of each line, so an edit done with @ref replace()
+lays out only the lines it touches. Only vertices of these lines are then
+uploaded to the mapped vertex buffer, unless the edit changes their glyph or
+row count --- in that case vertices of all following lines are uploaded as
+well, as they moved, but they are still not laid out again. The same holds
+if the vertical alignment offset changes, e.g. when middle-aligned text
+changes its height.
+
+## Usage
+
+Reserve capacity for all glyphs of the text, set the text and then edit it
+as needed. The mesh is drawn the same way as with @ref Renderer:
+@code
+std::unique_ptr<Text::AbstractFont> font;
+Text::GlyphCache cache;
+Shaders::Vector2D shader;
+
+Text::ParagraphRenderer2D paragraph{*font, cache, 0.15f, Text::Alignment::TopLeft};
+paragraph.reserve(4096, BufferUsage::DynamicDraw, BufferUsage::StaticDraw);
+paragraph.setWrapWidth(12.0f)
+    .setText(document);
+
+// The user typed a character at the cursor position
+paragraph.replace(cursor, 0, "a");
+
+shader.setTransformationProjectionMatrix(projection)
+    .setColor(Color3(1.0f))
+    .setVectorTexture(cache.texture());
+paragraph.mesh().draw(shader);
+@endcode
+
+## Word wrapping
+
+If wrap width is set, each line is broken into rows at spaces so the cursor
+doesn't advance past the wrap width. Words are laid out separately in this
+case, so kerning or ligatures across spaces are not done. Spaces at the place
+where the line is wrapped are dropped, words wider than the wrap width are not
+broken and are put on a row of their own. Horizontal alignment is applied to
+each row separately.
+
+## Required OpenGL functionality
+
+Buffer updates require @extension{ARB,map_buffer_range} on desktop OpenGL.
+On OpenGL ES 2.0 and WebGL the data are uploaded with
+@ref Buffer::setSubData() instead.
+
+@see @ref ParagraphRenderer2D, @ref ParagraphRenderer3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_TEXT_EXPORT ParagraphRenderer {
+    public:
+        /**
+         * @brief Constructor
+         * @param font          Font
+         * @param cache         Glyph cache
+         * @param size          Font size
+         * @param alignment     Text alignment
+         *
+         * Initially the text is empty and no wrap width is set.
+         */
+        explicit ParagraphRenderer(AbstractFont& font, const GlyphCache& cache, Float size, Alignment alignment = Alignment::LineLeft);
+        ParagraphRenderer(AbstractFont&, GlyphCache&&, Float, Alignment alignment = Alignment::LineLeft) = delete; /**< @overload */
+
+        /**
+         * @brief Capacity for rendered glyphs
+         *
+         * @see @ref reserve()
+         */
+        UnsignedInt capacity() const { return _capacity; }
+
+        /** @brief Count of rendered glyphs */
+        UnsignedInt glyphCount() const { return _glyphCount; }
+
+        /** @brief Text */
+        const std::string& text() const { return _text; }
+
+        /**
+         * @brief Count of lines
+         *
+         * Count of lines separated with `\n`, empty text has one line.
+         * @see @ref rowCount()
+         */
+        std::size_t lineCount() const { return _lines.size(); }
+
+        /**
+         * @brief Count of rows
+         *
+         * Count of rendered rows, i.e. @ref lineCount() plus count of rows
+         * created by word wrapping.
+         */
+        std::size_t rowCount() const { return _rowCount; }
+
+        /** @brief Rectangle spanning the rendered text */
+        Range2D rectangle() const { return _rectangle; }
+
+        /** @brief Wrap width */
+        Float wrapWidth() const { return _wrapWidth; }
+
+        /**
+         * @brief Set wrap width
+         * @return Reference to self (for method chaining)
+         *
+         * The text is wrapped so no row is wider than @p width, in units of
+         * the font size. Set to `0.0f` to disable wrapping. Lays out and
+         * uploads the whole text.
+         */
+        ParagraphRenderer<dimensions>& setWrapWidth(Float width);
+
+        /** @brief Vertex buffer */
+        Buffer& vertexBuffer() { return _vertexBuffer; }
+
+        /** @brief Index buffer */
+        Buffer& indexBuffer() { return _indexBuffer; }
+
+        /** @brief Mesh */
+        Mesh& mesh() { return _mesh; }
+
+        /**
+         * @brief Reserve capacity for rendered glyphs
+         *
+         * Reallocates memory in buffers to hold @p glyphCount glyphs, fills
+         * index buffer and uploads the current text again. Index buffer is
+         * changed only by calling this function, thus @p indexBufferUsage
+         * generally doesn't need to be dynamic.
+         *
+         * Initially zero capacity is reserved.
+         * @see @ref capacity()
+         */
+        void reserve(UnsignedInt glyphCount, BufferUsage vertexBufferUsage, BufferUsage indexBufferUsage);
+
+        /**
+         * @brief Set text
+         * @return Reference to self (for method chaining)
+         *
+         * Lays out and uploads the whole text. Equivalent to calling
+         * @ref replace() on the whole text.
+         * @attention The capacity must be large enough to contain all glyphs,
+         *      see @ref reserve() for more information.
+         */
+        ParagraphRenderer<dimensions>& setText(const std::string& text);
+
+        /**
+         * @brief Replace part of the text
+         * @param position  Byte position of the replaced part
+         * @param length    Byte length of the replaced part
+         * @param text      Replacement
+         * @return Reference to self (for method chaining)
+         *
+         * Lays out only the lines touched by the replaced part and the
+         * replacement, see class documentation for information about which
+         * data are uploaded. Use zero @p length for insertion and empty
+         * @p text for removal.
+         * @attention The capacity must be large enough to contain all glyphs,
+         *      see @ref reserve() for more information.
+         */
+        ParagraphRenderer<dimensions>& replace(std::size_t position, std::size_t length, const std::string& text);
+
+    private:
+        struct Vertex {
+            Vector2 position, textureCoordinates;
+        };
+
+        /* Line laid out at origin, aligned horizontally */
+        struct Line {
+            std::size_t size;
+            std::vector<Vertex> vertices;
+            UnsignedInt rowCount;
+            Range2D rectangle;
+        };
+
+        MAGNUM_TEXT_LOCAL void layoutLine(Line& line, const std::string& text, std::size_t position);
+        MAGNUM_TEXT_LOCAL void upload(std::size_t firstLine, std::size_t lastLine);
+
+        Mesh _mesh;
+        Buffer _vertexBuffer, _indexBuffer;
+        AbstractFont& _font;
+        const GlyphCache& _cache;
+        Float _size, _wrapWidth, _verticalOffset;
+        Alignment _alignment;
+        UnsignedInt _capacity, _glyphCount;
+        std::size_t _rowCount;
+        Range2D _rectangle;
+        std::string _text, _lineScratch;
+        std::vector<Line> _lines;
+        #if defined(MAGNUM_TARGET_GLES2) || defined(CORRADE_TARGET_EMSCRIPTEN)
+        std::vector<Vertex> _uploadScratch;
+        #endif
+};
+
+/** @brief Two-dimensional paragraph text renderer */
+typedef ParagraphRenderer<2> ParagraphRenderer2D;
+
+/** @brief Three-dimensional paragraph text renderer */
+typedef ParagraphRenderer<3> ParagraphRenderer3D;
+
 }}
 
 #endif
@@ -0,0 +1,130 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Image.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+#include "Magnum/Text/DistanceFieldGlyphCache.h"
+#include "Magnum/TextureTools/DistanceField.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct DistanceFieldGlyphCacheGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit DistanceFieldGlyphCacheGLTest();
+
+    void cpu();
+    void gpuIncremental();
+    void multichannel();
+    void multichannelWrongFormat();
+};
+
+DistanceFieldGlyphCacheGLTest::DistanceFieldGlyphCacheGLTest() {
+    addTests({&DistanceFieldGlyphCacheGLTest::cpu,
+              &DistanceFieldGlyphCacheGLTest::gpuIncremental,
+              &DistanceFieldGlyphCacheGLTest::multichannel,
+              &DistanceFieldGlyphCacheGLTest::multichannelWrongFormat});
+}
+
+void DistanceFieldGlyphCacheGLTest::cpu() {
+    DistanceFieldGlyphCache cache{Vector2i(64), Vector2i(16), 4};
+    CORRADE_COMPARE(cache.threadCount(), 0);
+    cache.setThreadCount(3);
+    CORRADE_COMPARE(cache.threadCount(), 3);
+
+    #ifndef MAGNUM_TARGET_GLES2
+    const ColorFormat format = ColorFormat::Red;
+    #else
+    const ColorFormat format = Context::current()->isExtensionSupported<Extensions::GL::EXT::texture_rg>() ?
+        ColorFormat::Red : ColorFormat::Luminance;
+    #endif
+    const UnsignedByte binary[32*32]{};
+    cache.setImage({}, ImageReference2D{format, ColorType::UnsignedByte, Vector2i(32), binary});
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void DistanceFieldGlyphCacheGLTest::gpuIncremental() {
+    DistanceFieldGlyphCache cache{Vector2i(64), Vector2i(16), 4, DistanceFieldGlyphCache::Flag::DeferredUpdate};
+    CORRADE_VERIFY(cache.flags() & DistanceFieldGlyphCache::Flag::DeferredUpdate);
+
+    #ifndef MAGNUM_TARGET_GLES2
+    const ColorFormat format = ColorFormat::Red;
+    #else
+    const ColorFormat format = Context::current()->isExtensionSupported<Extensions::GL::EXT::texture_rg>() ?
+        ColorFormat::Red : ColorFormat::Luminance;
+    #endif
+
+    /* Nothing to convert yet */
+    cache.flush();
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Two overlapping areas and one separate, converted at once */
+    const UnsignedByte binary[16*16]{};
+    cache.setImage({}, ImageReference2D{format, ColorType::UnsignedByte, Vector2i(16), binary});
+    cache.setImage({8, 8}, ImageReference2D{format, ColorType::UnsignedByte, Vector2i(16), binary});
+    cache.setImage({48, 48}, ImageReference2D{format, ColorType::UnsignedByte, Vector2i(16), binary});
+    MAGNUM_VERIFY_NO_ERROR();
+    cache.flush();
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Adding another glyph later converts only its area */
+    cache.setImage({32, 0}, ImageReference2D{format, ColorType::UnsignedByte, Vector2i(16), binary});
+    cache.flush();
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void DistanceFieldGlyphCacheGLTest::multichannel() {
+    DistanceFieldGlyphCache cache{Vector2i(64), Vector2i(16), 4, DistanceFieldGlyphCache::Flag::Multichannel};
+    CORRADE_VERIFY(cache.flags() & DistanceFieldGlyphCache::Flag::Multichannel);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Binary image */
+    const UnsignedByte binary[32*32]{};
+    cache.setImage({}, ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, Vector2i(32), binary});
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Precomputed multichannel distance field */
+    const Image2D distanceField = TextureTools::multichannelDistanceField({{{2.0f, 2.0f}, {6.0f, 2.0f}, {4.0f, 6.0f}}}, Vector2i(8), 1.25f);
+    cache.setDistanceFieldImage(Vector2i(8), distanceField);
+    MAGNUM_VERIFY_NO_ERROR();
+}
+
+void DistanceFieldGlyphCacheGLTest::multichannelWrongFormat() {
+    DistanceFieldGlyphCache cache{Vector2i(64), Vector2i(16), 4, DistanceFieldGlyphCache::Flag::Multichannel};
+
+    const UnsignedByte data[16]{};
+    std::ostringstream out;
+    Error::setOutput(&out);
+    cache.setDistanceFieldImage({}, ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, Vector2i(4), data});
+    CORRADE_COMPARE(out.str(), "Text::DistanceFieldGlyphCache::setDistanceFieldImage(): expected ColorFormat::RGB but got ColorFormat::Red\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::DistanceFieldGlyphCacheGLTest)
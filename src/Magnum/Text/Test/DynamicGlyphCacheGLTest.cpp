@@ -0,0 +1,220 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <tuple>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Test/AbstractOpenGLTester.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/DynamicGlyphCache.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct DynamicGlyphCacheGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit DynamicGlyphCacheGLTest();
+
+    void construct();
+    void update();
+    void updateAlreadyPresent();
+    void grow();
+    void evict();
+    void evictCurrentFrame();
+};
+
+DynamicGlyphCacheGLTest::DynamicGlyphCacheGLTest() {
+    addTests({&DynamicGlyphCacheGLTest::construct,
+              &DynamicGlyphCacheGLTest::update,
+              &DynamicGlyphCacheGLTest::updateAlreadyPresent,
+              &DynamicGlyphCacheGLTest::grow,
+              &DynamicGlyphCacheGLTest::evict,
+              &DynamicGlyphCacheGLTest::evictCurrentFrame});
+}
+
+namespace {
+
+/* Each lowercase letter is a 8x8 glyph, everything else is not in the font */
+class TestFont: public Text::AbstractFont {
+    public:
+        std::size_t rasterized = 0;
+
+    private:
+        Features doFeatures() const override { return Feature::OpenData; }
+
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(char32_t character) override {
+            return character >= U'a' && character <= U'z' ? character - U'a' + 1 : 0;
+        }
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        #ifndef __MINGW32__
+        void doFillGlyphCache(GlyphCache& cache, const std::u32string& characters) override
+        #else
+        void doFillGlyphCache(GlyphCache& cache, const std::vector<char32_t>& characters) override
+        #endif
+        {
+            const std::vector<Range2Di> rectangles = cache.reserve(std::vector<Vector2i>(characters.size(), Vector2i{8}));
+            if(rectangles.empty()) return;
+
+            char data[8*8];
+            for(std::size_t i = 0; i != characters.size(); ++i) {
+                const UnsignedInt glyph = doGlyphId(characters[i]);
+                cache.insert(glyph, {}, rectangles[i]);
+                std::fill_n(data, 8*8, char(glyph));
+                cache.setImage(rectangles[i].min(), ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, Vector2i{8}, data});
+                ++rasterized;
+            }
+        }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string&) override {
+            return nullptr;
+        }
+};
+
+}
+
+void DynamicGlyphCacheGLTest::construct() {
+    DynamicGlyphCache cache{Vector2i{16}, Vector2i{64}, Vector2i{1}};
+    MAGNUM_VERIFY_NO_ERROR();
+
+    CORRADE_COMPARE(cache.textureSize(), Vector2i{16});
+    CORRADE_COMPARE(cache.maxTextureSize(), Vector2i{64});
+    CORRADE_COMPARE(cache.padding(), Vector2i{1});
+    CORRADE_COMPARE(cache.glyphCount(), 1);
+    CORRADE_COMPARE(cache.generation(), 0);
+    CORRADE_COMPARE(cache.frame(), 0);
+}
+
+void DynamicGlyphCacheGLTest::update() {
+    TestFont font;
+    DynamicGlyphCache cache{Vector2i{32}, Vector2i{32}};
+
+    /* Unknown characters and duplicates are ignored */
+    CORRADE_VERIFY(cache.update(font, "abba?!"));
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(font.rasterized, 2);
+    CORRADE_COMPARE(cache.glyphCount(), 3);
+    CORRADE_COMPARE(cache.generation(), 0);
+
+    Range2Di a, b;
+    std::tie(std::ignore, a) = cache[1];
+    std::tie(std::ignore, b) = cache[2];
+    CORRADE_COMPARE(a.size(), Vector2i{8});
+    CORRADE_COMPARE(b.size(), Vector2i{8});
+    CORRADE_VERIFY(a != b);
+}
+
+void DynamicGlyphCacheGLTest::updateAlreadyPresent() {
+    TestFont font;
+    DynamicGlyphCache cache{Vector2i{32}, Vector2i{32}};
+
+    CORRADE_VERIFY(cache.update(font, "abc"));
+    CORRADE_VERIFY(cache.update(font, "cab"));
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(font.rasterized, 3);
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+}
+
+void DynamicGlyphCacheGLTest::grow() {
+    TestFont font;
+    DynamicGlyphCache cache{Vector2i{16}, Vector2i{64}};
+
+    /* Four glyphs fill the initial size */
+    CORRADE_VERIFY(cache.update(font, "abcd"));
+    CORRADE_COMPARE(cache.textureSize(), Vector2i{16});
+    CORRADE_COMPARE(cache.generation(), 0);
+
+    /* Fifth doesn't fit, the texture is enlarged and no glyph is lost */
+    CORRADE_VERIFY(cache.update(font, "e"));
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(cache.textureSize(), Vector2i{32});
+    CORRADE_COMPARE(cache.generation(), 1);
+    CORRADE_COMPARE(cache.glyphCount(), 6);
+    CORRADE_COMPARE(font.rasterized, 5);
+
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(cache.texture().imageSize(0), Vector2i{32});
+    #endif
+}
+
+void DynamicGlyphCacheGLTest::evict() {
+    TestFont font;
+    DynamicGlyphCache cache{Vector2i{16}, Vector2i{16}};
+
+    CORRADE_VERIFY(cache.update(font, "ab"));
+    cache.nextFrame();
+    CORRADE_VERIFY(cache.update(font, "cd"));
+    cache.nextFrame();
+
+    /* Touch "a" so "b" is the least recently used one */
+    CORRADE_VERIFY(cache.update(font, "a"));
+    CORRADE_VERIFY(cache.update(font, "e"));
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(cache.textureSize(), Vector2i{16});
+    CORRADE_COMPARE(cache.generation(), 1);
+
+    /* Evictable glyphs are evicted by halves, starting with the oldest,
+       until the new glyph fits. Either "c" or "d" stays. */
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+    std::size_t present = 0;
+    for(UnsignedInt glyph: {1, 2, 3, 4, 5}) {
+        Range2Di rectangle;
+        std::tie(std::ignore, rectangle) = cache[glyph];
+        if(rectangle.size() != Vector2i{}) ++present;
+    }
+    CORRADE_COMPARE(present, 3);
+    Range2Di a, b, e;
+    std::tie(std::ignore, a) = cache[1];
+    std::tie(std::ignore, b) = cache[2];
+    std::tie(std::ignore, e) = cache[5];
+    CORRADE_COMPARE(a.size(), Vector2i{8});
+    CORRADE_COMPARE(b.size(), Vector2i{});
+    CORRADE_COMPARE(e.size(), Vector2i{8});
+
+    /* Evicted glyph is rasterized again when needed */
+    CORRADE_VERIFY(cache.update(font, "b"));
+    CORRADE_COMPARE(font.rasterized, 6);
+}
+
+void DynamicGlyphCacheGLTest::evictCurrentFrame() {
+    TestFont font;
+    DynamicGlyphCache cache{Vector2i{16}, Vector2i{16}};
+
+    /* Glyphs used in current frame can't be evicted */
+    std::ostringstream out;
+    Error::setOutput(&out);
+    CORRADE_VERIFY(cache.update(font, "abcd"));
+    CORRADE_VERIFY(!cache.update(font, "e"));
+    CORRADE_COMPARE(cache.glyphCount(), 5);
+    CORRADE_COMPARE(cache.generation(), 0);
+    CORRADE_COMPARE(out.str(), "Text::DynamicGlyphCache::reserve(): cannot fit 1 glyphs into cache with maximal size Vector(16, 16)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Text::Test::DynamicGlyphCacheGLTest)
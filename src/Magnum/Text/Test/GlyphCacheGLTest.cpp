@@ -23,9 +23,11 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <tuple>
 
 #include "Magnum/Test/AbstractOpenGLTester.h"
+#include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/GlyphCache.h"
 
 namespace Magnum { namespace Text { namespace Test {
@@ -36,12 +38,54 @@ struct GlyphCacheGLTest: Magnum::Test::AbstractOpenGLTester {
     void initialize();
     void access();
     void reserve();
+    void reserveIncremental();
+
+    void layoutCache();
 };
 
 GlyphCacheGLTest::GlyphCacheGLTest() {
     addTests({&GlyphCacheGLTest::initialize,
               &GlyphCacheGLTest::access,
-              &GlyphCacheGLTest::reserve});
+              &GlyphCacheGLTest::reserve,
+              &GlyphCacheGLTest::reserveIncremental,
+
+              &GlyphCacheGLTest::layoutCache});
+}
+
+namespace {
+
+class TestLayouter: public AbstractLayouter {
+    public:
+        explicit TestLayouter(UnsignedInt glyphCount): AbstractLayouter(glyphCount) {}
+
+    private:
+        std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(const UnsignedInt i) override {
+            return std::make_tuple(Range2D({}, Vector2(i + 1.0f)),
+                Range2D::fromSize({i*0.25f, 0.0f}, {0.25f, 1.0f}),
+                Vector2::xAxis(2.0f));
+        }
+};
+
+class TestFont: public AbstractFont {
+    public:
+        explicit TestFont(): layoutCount{} {}
+
+        std::size_t layoutCount;
+
+    private:
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(char32_t) override { return 0; }
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string& text) override {
+            ++layoutCount;
+            return std::unique_ptr<AbstractLayouter>(new TestLayouter(text.size()));
+        }
+};
+
 }
 
 void GlyphCacheGLTest::initialize() {
@@ -91,6 +135,75 @@ void GlyphCacheGLTest::reserve() {
     CORRADE_VERIFY(!cache.reserve({{5, 3}}).empty());
 }
 
+void GlyphCacheGLTest::reserveIncremental() {
+    Text::GlyphCache cache(Vector2i(16));
+
+    /* Subsequent calls don't reuse already reserved space */
+    const std::vector<Range2Di> a = cache.reserve({{16, 8}});
+    const std::vector<Range2Di> b = cache.reserve({{8, 8}});
+    CORRADE_COMPARE(a, std::vector<Range2Di>{Range2Di::fromSize({0, 0}, {16, 8})});
+    CORRADE_COMPARE(b, std::vector<Range2Di>{Range2Di::fromSize({0, 8}, {8, 8})});
+
+    /* Doesn't fit into remaining space */
+    std::ostringstream out;
+    Error::setOutput(&out);
+    CORRADE_VERIFY(cache.reserve({{8, 8}, {1, 1}}).empty());
+    CORRADE_COMPARE(out.str(), "Text::GlyphCache::reserve(): cannot fit 2 glyphs into remaining space of cache with size Vector(16, 16)\n");
+}
+
+void GlyphCacheGLTest::layoutCache() {
+    Text::GlyphCache cache(Vector2i(16));
+    TestFont font;
+    CORRADE_COMPARE(font.layoutCacheSize(), 0);
+
+    /* Not cached by default */
+    font.layout(cache, 1.0f, "ab");
+    font.layout(cache, 1.0f, "ab");
+    CORRADE_COMPARE(font.layoutCount, 2);
+
+    font.setLayoutCacheSize(2);
+    CORRADE_COMPARE(font.layoutCacheSize(), 2);
+
+    /* Second layout is replayed from the cache with the same results */
+    font.layout(cache, 1.0f, "ab");
+    CORRADE_COMPARE(font.layoutCount, 3);
+    std::unique_ptr<AbstractLayouter> layouter = font.layout(cache, 1.0f, "ab");
+    CORRADE_COMPARE(font.layoutCount, 3);
+    CORRADE_COMPARE(layouter->glyphCount(), 2);
+    Vector2 cursorPosition{1.0f, 0.0f};
+    Range2D rectangle;
+    Range2D quadPosition, textureCoordinates;
+    std::tie(quadPosition, textureCoordinates) = layouter->renderGlyph(1, cursorPosition, rectangle);
+    CORRADE_COMPARE(quadPosition, Range2D({1.0f, 0.0f}, {3.0f, 2.0f}));
+    CORRADE_COMPARE(textureCoordinates, Range2D({0.25f, 0.0f}, {0.5f, 1.0f}));
+    CORRADE_COMPARE(cursorPosition, Vector2(3.0f, 0.0f));
+
+    /* Different size is a different entry, the least recently used entry is
+       discarded when the cache is full */
+    font.layout(cache, 2.0f, "ab");
+    font.layout(cache, 1.0f, "cd");
+    CORRADE_COMPARE(font.layoutCount, 5);
+    font.layout(cache, 2.0f, "ab");
+    CORRADE_COMPARE(font.layoutCount, 5);
+    font.layout(cache, 1.0f, "ab");
+    CORRADE_COMPARE(font.layoutCount, 6);
+
+    /* The layout is still valid after its entry was discarded */
+    CORRADE_COMPARE(layouter->renderGlyph(0, cursorPosition, rectangle).first, Range2D({3.0f, 0.0f}, {4.0f, 1.0f}));
+
+    /* Changing the glyph cache invalidates the layouts */
+    cache.insert(1, {}, {});
+    font.layout(cache, 1.0f, "ab");
+    CORRADE_COMPARE(font.layoutCount, 7);
+    font.layout(cache, 1.0f, "ab");
+    CORRADE_COMPARE(font.layoutCount, 7);
+
+    /* Clearing */
+    font.clearLayoutCache();
+    font.layout(cache, 1.0f, "ab");
+    CORRADE_COMPARE(font.layoutCount, 8);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Text::Test::GlyphCacheGLTest)
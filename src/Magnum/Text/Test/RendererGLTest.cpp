@@ -23,6 +23,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
+
+#include "Magnum/Math/Matrix3.h"
 #include "Magnum/Test/AbstractOpenGLTester.h"
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/Renderer.h"
@@ -36,8 +39,18 @@ struct RendererGLTest: Magnum::Test::AbstractOpenGLTester {
     void renderMesh();
     void renderMeshIndexType();
     void mutableText();
+    void mutableTextRerender();
+
+    void batch();
+    void batchTooSmall();
 
     void multiline();
+
+    void paragraph();
+    void paragraphReplace();
+    void paragraphWrap();
+    void paragraphAlignment();
+    void paragraphTooSmall();
 };
 
 RendererGLTest::RendererGLTest() {
@@ -45,8 +58,18 @@ RendererGLTest::RendererGLTest() {
               &RendererGLTest::renderMesh,
               &RendererGLTest::renderMeshIndexType,
               &RendererGLTest::mutableText,
+              &RendererGLTest::mutableTextRerender,
+
+              &RendererGLTest::batch,
+              &RendererGLTest::batchTooSmall,
+
+              &RendererGLTest::multiline,
 
-              &RendererGLTest::multiline});
+              &RendererGLTest::paragraph,
+              &RendererGLTest::paragraphReplace,
+              &RendererGLTest::paragraphWrap,
+              &RendererGLTest::paragraphAlignment,
+              &RendererGLTest::paragraphTooSmall});
 }
 
 namespace {
@@ -81,6 +104,41 @@ class TestFont: public Text::AbstractFont {
     }
 };
 
+class MultilineLayouter: public Text::AbstractLayouter {
+    public:
+        explicit MultilineLayouter(UnsignedInt glyphCount): AbstractLayouter(glyphCount) {}
+
+    private:
+        std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt) override {
+            return std::make_tuple(Range2D({}, Vector2(1.0f)), Range2D({}, Vector2(1.0f)), Vector2::xAxis(2.0f));
+        }
+};
+
+class MultilineFont: public Text::AbstractFont {
+    public:
+        explicit MultilineFont(): _opened(false) {}
+
+    private:
+        Features doFeatures() const override { return {};  }
+
+        bool doIsOpened() const override { return _opened; }
+        void doClose() override { _opened = false; }
+
+        std::pair<Float, Float> doOpenFile(const std::string&, Float) {
+            _opened = true;
+            return {0.5f, 0.75f};
+        }
+
+        UnsignedInt doGlyphId(char32_t) override { return 0; }
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string& text) override {
+            return std::unique_ptr<AbstractLayouter>(new MultilineLayouter(text.size()));
+        }
+
+        bool _opened;
+};
+
 /* *static_cast<GlyphCache*>(nullptr) makes Clang Analyzer grumpy */
 char glyphCacheData;
 GlyphCache& nullGlyphCache = *reinterpret_cast<GlyphCache*>(&glyphCacheData);
@@ -320,43 +378,114 @@ void RendererGLTest::mutableText() {
     #endif
 }
 
-void RendererGLTest::multiline() {
-    class Layouter: public Text::AbstractLayouter {
-        public:
-            explicit Layouter(UnsignedInt glyphCount): AbstractLayouter(glyphCount) {}
+void RendererGLTest::mutableTextRerender() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_EMSCRIPTEN)
+    if(!Context::current()->isExtensionSupported<Extensions::GL::EXT::map_buffer_range>() &&
+       !Context::current()->isExtensionSupported<Extensions::GL::OES::mapbuffer>() &&
+       !Context::current()->isExtensionSupported<Extensions::GL::CHROMIUM::map_sub>()) {
+        CORRADE_SKIP("No required extension is supported");
+    }
+    #endif
+
+    TestFont font;
+    Text::Renderer2D renderer(font, nullGlyphCache, 0.25f, Alignment::LineRight);
+    renderer.reserve(4, BufferUsage::DynamicDraw, BufferUsage::DynamicDraw);
+    MAGNUM_VERIFY_NO_ERROR();
 
-        private:
-            std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt) override {
-                return std::make_tuple(Range2D({}, Vector2(1.0f)), Range2D({}, Vector2(1.0f)), Vector2::xAxis(2.0f));
-            }
-    };
+    /* Fill the whole capacity first */
+    renderer.render("abcd");
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.mesh().count(), 24);
 
-    class Font: public Text::AbstractFont {
-        public:
-            explicit Font(): _opened(false) {}
+    /* Shorter text reuses the same memory, the bounds and index count are
+       updated and the remaining data are unaffected by previous render */
+    renderer.render("ab");
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.mesh().count(), 12);
+    CORRADE_COMPARE(renderer.rectangle(), Range2D({-2.5f, -0.25f}, {0.0f, 0.75f}));
 
-        private:
-            Features doFeatures() const override { return {};  }
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<Float> vertices = renderer.vertexBuffer().subData<Float>(0, 32);
+    CORRADE_COMPARE(std::vector<Float>(vertices.begin(), vertices.end()), (std::vector<Float>{
+        -2.5f,  0.5f, 0.0f, 10.0f,
+        -2.5f,  0.0f, 0.0f,  0.0f,
+        -1.75f, 0.5f, 6.0f, 10.0f,
+        -1.75f, 0.0f, 6.0f,  0.0f,
+
+        -1.5f,  0.75f,  6.0f, 10.0f,
+        -1.5f, -0.25f,  6.0f,  0.0f,
+         0.0f,  0.75f, 12.0f, 10.0f,
+         0.0f, -0.25f, 12.0f,  0.0f
+    }));
+    #endif
 
-            bool doIsOpened() const override { return _opened; }
-            void doClose() override { _opened = false; }
+    /* Empty text renders nothing */
+    renderer.render("");
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.mesh().count(), 0);
+    CORRADE_COMPARE(renderer.rectangle(), Range2D());
+}
 
-            std::pair<Float, Float> doOpenFile(const std::string&, Float) {
-                _opened = true;
-                return {0.5f, 0.75f};
-            }
+void RendererGLTest::batch() {
+    TestFont font;
+    Text::BatchRenderer2D batch(font, nullGlyphCache, 0.25f);
+    batch.reserve(4, BufferUsage::DynamicDraw, BufferUsage::StaticDraw);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(batch.capacity(), 4);
+    CORRADE_COMPARE(batch.glyphCount(), 0);
+
+    /* Returned bounds are before transformation */
+    CORRADE_COMPARE(batch.add("ab", Matrix3::translation({10.0f, 20.0f}), {1.0f, 0.0f, 0.0f}),
+        Range2D({0.0f, -0.25f}, {2.5f, 0.75f}));
+    CORRADE_COMPARE(batch.add("c", Matrix3::translation({-1.0f, 0.0f}), {0.0f, 1.0f, 0.0f}, Alignment::LineRight),
+        Range2D({-0.75f, 0.0f}, {0.0f, 0.5f}));
+    CORRADE_COMPARE(batch.glyphCount(), 3);
+
+    /* Nothing is drawn until update */
+    CORRADE_COMPARE(batch.mesh().count(), 0);
+    batch.update();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(batch.mesh().count(), 18);
 
-            UnsignedInt doGlyphId(char32_t) override { return 0; }
-            Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    /* First vertex of each text: position, texture coordinates, color */
+    Containers::Array<Float> first = batch.vertexBuffer().subData<Float>(0, 8);
+    CORRADE_COMPARE(std::vector<Float>(first.begin(), first.end()), (std::vector<Float>{
+        10.0f, 20.5f, 0.0f, 10.0f, 1.0f, 0.0f, 0.0f, 1.0f
+    }));
+    Containers::Array<Float> second = batch.vertexBuffer().subData<Float>(8*8*4, 8);
+    CORRADE_COMPARE(std::vector<Float>(second.begin(), second.end()), (std::vector<Float>{
+        -1.75f, 0.5f, 0.0f, 10.0f, 0.0f, 1.0f, 0.0f, 1.0f
+    }));
+    #endif
 
-            std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string& text) override {
-                return std::unique_ptr<AbstractLayouter>(new Layouter(text.size()));
-            }
+    /* Clearing the batch */
+    batch.clear();
+    batch.update();
+    CORRADE_COMPARE(batch.glyphCount(), 0);
+    CORRADE_COMPARE(batch.mesh().count(), 0);
+}
 
-            bool _opened;
-    };
+void RendererGLTest::batchTooSmall() {
+    TestFont font;
+    Text::BatchRenderer2D batch(font, nullGlyphCache, 0.25f);
+    batch.reserve(4, BufferUsage::DynamicDraw, BufferUsage::StaticDraw);
+    batch.add("ab", {});
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    batch.add("abc", {});
+    CORRADE_COMPARE(out.str(), "Text::BatchRenderer::add(): capacity 4 too small to add 3 glyphs to 2 glyphs already in the batch\n");
+    CORRADE_COMPARE(batch.glyphCount(), 2);
+}
 
-    Font font;
+void RendererGLTest::multiline() {
+    MultilineFont font;
     font.openFile({}, 0.0f);
     Range2D rectangle;
     std::vector<UnsignedInt> indices;
@@ -425,6 +554,216 @@ void RendererGLTest::multiline() {
     }));
 }
 
+void RendererGLTest::paragraph() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    /* Each glyph is a 1x1 quad with advance 2, line advance is 3 */
+    MultilineFont font;
+    font.openFile({}, 0.0f);
+    Text::ParagraphRenderer2D paragraph(font, nullGlyphCache, 2.0f);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(paragraph.capacity(), 0);
+    CORRADE_COMPARE(paragraph.text(), "");
+    CORRADE_COMPARE(paragraph.lineCount(), 1);
+    CORRADE_COMPARE(paragraph.rowCount(), 1);
+    CORRADE_COMPARE(paragraph.glyphCount(), 0);
+    CORRADE_COMPARE(paragraph.rectangle(), Range2D());
+
+    paragraph.reserve(16, BufferUsage::DynamicDraw, BufferUsage::StaticDraw);
+    paragraph.setText("abcd\nef\n\nghi");
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(paragraph.capacity(), 16);
+    CORRADE_COMPARE(paragraph.lineCount(), 4);
+    CORRADE_COMPARE(paragraph.rowCount(), 4);
+    CORRADE_COMPARE(paragraph.glyphCount(), 9);
+    CORRADE_COMPARE(paragraph.mesh().count(), 54);
+    CORRADE_COMPARE(paragraph.rectangle(), Range2D({0.0f, -9.0f}, {7.0f, 1.0f}));
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    /* First vertex of 'e' and 'g' */
+    Containers::Array<Float> e = paragraph.vertexBuffer().subData<Float>(4*4*4*4, 4);
+    CORRADE_COMPARE(std::vector<Float>(e.begin(), e.end()), (std::vector<Float>{
+        0.0f, -2.0f, 0.0f, 1.0f
+    }));
+    Containers::Array<Float> g = paragraph.vertexBuffer().subData<Float>(6*4*4*4, 4);
+    CORRADE_COMPARE(std::vector<Float>(g.begin(), g.end()), (std::vector<Float>{
+        0.0f, -8.0f, 0.0f, 1.0f
+    }));
+    #endif
+}
+
+void RendererGLTest::paragraphReplace() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    MultilineFont font;
+    font.openFile({}, 0.0f);
+    Text::ParagraphRenderer2D paragraph(font, nullGlyphCache, 2.0f);
+    paragraph.reserve(16, BufferUsage::DynamicDraw, BufferUsage::StaticDraw);
+    paragraph.setText("abcd\nef\n\nghi");
+
+    /* Replacing inside a line, the following lines are moved in the buffer */
+    paragraph.replace(5, 1, "xyz");
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(paragraph.text(), "abcd\nxyzf\n\nghi");
+    CORRADE_COMPARE(paragraph.lineCount(), 4);
+    CORRADE_COMPARE(paragraph.glyphCount(), 11);
+    CORRADE_COMPARE(paragraph.mesh().count(), 66);
+    CORRADE_COMPARE(paragraph.rectangle(), Range2D({0.0f, -9.0f}, {7.0f, 1.0f}));
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    /* First vertex of 'f' and 'g' */
+    Containers::Array<Float> f = paragraph.vertexBuffer().subData<Float>(7*4*4*4, 4);
+    CORRADE_COMPARE(std::vector<Float>(f.begin(), f.end()), (std::vector<Float>{
+        6.0f, -2.0f, 0.0f, 1.0f
+    }));
+    Containers::Array<Float> g = paragraph.vertexBuffer().subData<Float>(8*4*4*4, 4);
+    CORRADE_COMPARE(std::vector<Float>(g.begin(), g.end()), (std::vector<Float>{
+        0.0f, -8.0f, 0.0f, 1.0f
+    }));
+    #endif
+
+    /* Replacing a newline joins the lines */
+    paragraph.replace(4, 1, " ");
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(paragraph.text(), "abcd xyzf\n\nghi");
+    CORRADE_COMPARE(paragraph.lineCount(), 3);
+    CORRADE_COMPARE(paragraph.rowCount(), 3);
+    CORRADE_COMPARE(paragraph.glyphCount(), 12);
+    CORRADE_COMPARE(paragraph.rectangle(), Range2D({0.0f, -6.0f}, {17.0f, 1.0f}));
+
+    /* Inserting a newline splits the line */
+    paragraph.replace(14, 0, "\njk");
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(paragraph.text(), "abcd xyzf\n\nghi\njk");
+    CORRADE_COMPARE(paragraph.lineCount(), 4);
+    CORRADE_COMPARE(paragraph.glyphCount(), 14);
+    CORRADE_COMPARE(paragraph.rectangle(), Range2D({0.0f, -9.0f}, {17.0f, 1.0f}));
+
+    /* Removing everything */
+    paragraph.replace(0, paragraph.text().size(), {});
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(paragraph.lineCount(), 1);
+    CORRADE_COMPARE(paragraph.glyphCount(), 0);
+    CORRADE_COMPARE(paragraph.mesh().count(), 0);
+    CORRADE_COMPARE(paragraph.rectangle(), Range2D());
+}
+
+void RendererGLTest::paragraphWrap() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    MultilineFont font;
+    font.openFile({}, 0.0f);
+    Text::ParagraphRenderer2D paragraph(font, nullGlyphCache, 2.0f);
+    paragraph.reserve(16, BufferUsage::DynamicDraw, BufferUsage::StaticDraw);
+    paragraph.setText("abcd xyzf\n\nghi");
+    CORRADE_COMPARE(paragraph.rowCount(), 3);
+
+    /* The space where the line is wrapped is dropped */
+    paragraph.setWrapWidth(8.0f);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(paragraph.wrapWidth(), 8.0f);
+    CORRADE_COMPARE(paragraph.lineCount(), 3);
+    CORRADE_COMPARE(paragraph.rowCount(), 4);
+    CORRADE_COMPARE(paragraph.glyphCount(), 11);
+    CORRADE_COMPARE(paragraph.rectangle(), Range2D({0.0f, -9.0f}, {7.0f, 1.0f}));
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    /* First vertex of 'x' */
+    Containers::Array<Float> x = paragraph.vertexBuffer().subData<Float>(4*4*4*4, 4);
+    CORRADE_COMPARE(std::vector<Float>(x.begin(), x.end()), (std::vector<Float>{
+        0.0f, -2.0f, 0.0f, 1.0f
+    }));
+    #endif
+
+    /* Shortening the first word makes the second fit on the first row */
+    paragraph.replace(0, 2, {});
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(paragraph.text(), "cd xyzf\n\nghi");
+    CORRADE_COMPARE(paragraph.rowCount(), 4);
+    paragraph.replace(4, 3, {});
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(paragraph.text(), "cd x\n\nghi");
+    CORRADE_COMPARE(paragraph.rowCount(), 3);
+    CORRADE_COMPARE(paragraph.glyphCount(), 7);
+    CORRADE_COMPARE(paragraph.rectangle(), Range2D({0.0f, -6.0f}, {7.0f, 1.0f}));
+
+    /* Disabling the wrapping */
+    paragraph.setWrapWidth(0.0f);
+    CORRADE_COMPARE(paragraph.rowCount(), 3);
+}
+
+void RendererGLTest::paragraphAlignment() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    MultilineFont font;
+    font.openFile({}, 0.0f);
+    Text::ParagraphRenderer2D paragraph(font, nullGlyphCache, 2.0f, Alignment::MiddleCenter);
+    paragraph.reserve(16, BufferUsage::DynamicDraw, BufferUsage::StaticDraw);
+
+    /* Same as in multiline() */
+    paragraph.setText("abcd\nef\n\nghi");
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(paragraph.rectangle(), Range2D({-3.5f, -5.0f}, {3.5f, 5.0f}));
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    /* First vertex of 'a' and 'g' */
+    Containers::Array<Float> a = paragraph.vertexBuffer().subData<Float>(0, 4);
+    CORRADE_COMPARE(std::vector<Float>(a.begin(), a.end()), (std::vector<Float>{
+        -3.5f, 5.0f, 0.0f, 1.0f
+    }));
+    Containers::Array<Float> g = paragraph.vertexBuffer().subData<Float>(6*4*4*4, 4);
+    CORRADE_COMPARE(std::vector<Float>(g.begin(), g.end()), (std::vector<Float>{
+        -2.5f, -4.0f, 0.0f, 1.0f
+    }));
+    #endif
+
+    /* Adding a line at the end changes vertical offset of all lines */
+    paragraph.replace(paragraph.text().size(), 0, "\njk");
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(paragraph.rectangle(), Range2D({-3.5f, -6.5f}, {3.5f, 6.5f}));
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    a = paragraph.vertexBuffer().subData<Float>(0, 4);
+    CORRADE_COMPARE(std::vector<Float>(a.begin(), a.end()), (std::vector<Float>{
+        -3.5f, 6.5f, 0.0f, 1.0f
+    }));
+    #endif
+}
+
+void RendererGLTest::paragraphTooSmall() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #endif
+
+    MultilineFont font;
+    font.openFile({}, 0.0f);
+    Text::ParagraphRenderer2D paragraph(font, nullGlyphCache, 2.0f);
+    paragraph.reserve(4, BufferUsage::DynamicDraw, BufferUsage::StaticDraw);
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    paragraph.setText("abcde");
+    CORRADE_COMPARE(out.str(), "Text::ParagraphRenderer: capacity 4 too small to render 5 glyphs\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Text::Test::RendererGLTest)
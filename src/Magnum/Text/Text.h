@@ -39,6 +39,7 @@ class AbstractFont;
 class AbstractFontConverter;
 class AbstractLayouter;
 class DistanceFieldGlyphCache;
+class DynamicGlyphCache;
 class GlyphCache;
 
 enum class Alignment: UnsignedByte;
@@ -47,6 +48,12 @@ class AbstractRenderer;
 template<UnsignedInt> class Renderer;
 typedef Renderer<2> Renderer2D;
 typedef Renderer<3> Renderer3D;
+template<UnsignedInt> class BatchRenderer;
+typedef BatchRenderer<2> BatchRenderer2D;
+typedef BatchRenderer<3> BatchRenderer3D;
+template<UnsignedInt> class ParagraphRenderer;
+typedef ParagraphRenderer<2> ParagraphRenderer2D;
+typedef ParagraphRenderer<3> ParagraphRenderer3D;
 
 #ifdef MAGNUM_BUILD_DEPRECATED
 typedef Renderer<2> TextRenderer2D;
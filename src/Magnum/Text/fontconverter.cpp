@@ -44,6 +44,25 @@
 
 #include "fontconverterConfigure.h"
 
+#ifdef MAGNUM_BUILD_UTILITIES_STATIC_PLUGINS
+/* The bundled plugins are linked in statically and need to be imported from
+   the global namespace */
+static void importStaticPlugins() {
+    #ifdef MAGNUM_WITH_MAGNUMFONT
+    CORRADE_PLUGIN_IMPORT(MagnumFont)
+    #endif
+    #ifdef MAGNUM_WITH_MAGNUMFONTCONVERTER
+    CORRADE_PLUGIN_IMPORT(MagnumFontConverter)
+    #endif
+    #ifdef MAGNUM_WITH_TGAIMPORTER
+    CORRADE_PLUGIN_IMPORT(TgaImporter)
+    #endif
+    #ifdef MAGNUM_WITH_TGAIMAGECONVERTER
+    CORRADE_PLUGIN_IMPORT(TgaImageConverter)
+    #endif
+}
+#endif
+
 namespace Magnum {
 
 /**
@@ -52,7 +71,7 @@ namespace Magnum {
 
 @section magnum-fontconverter-usage Usage
 
-    magnum-fontconverter [-h|--help] --font FONT --converter CONVERTER [--plugin-dir DIR] [--characters CHARACTERS] [--font-size N] [--atlas-size "X Y"] [--output-size "X Y"] [--radius N] [--] input output
+    magnum-fontconverter [-h|--help] --font FONT --converter CONVERTER [--plugin-dir DIR] [--characters CHARACTERS] [--font-size N] [--atlas-size "X Y"] [--output-size "X Y"] [--radius N] [--threads N] [--] input output
 
 Arguments:
 
@@ -62,7 +81,9 @@ Arguments:
 -   `--font FONT` -- font plugin
 -   `--converter CONVERTER` -- font converter plugin
 -   `--plugin-dir DIR` -- base plugin dir (defaults to plugin directory in
-    Magnum install location)
+    Magnum install location). If Magnum is built with
+    `BUILD_UTILITIES_STATIC_PLUGINS`, the bundled plugins are linked in
+    statically and no directory is scanned unless this option is set.
 -   `--characters CHARACTERS` -- characters to include in the output (default:
     `abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789?!:;,.&nbsp;`)
 -   `--font-size N` -- input font size (default: `128`)
@@ -70,6 +91,9 @@ Arguments:
 -   `--output-size "X Y"` -- output atlas size. If set to zero size, distance
     field computation will not be used. (default: `"256 256"`)
 -   `--radius N` -- distance field computation radius (default: `24`)
+-   `--threads N` -- compute distance field on the CPU, split among given
+    count of threads. If set to `0`, the computation is done on the GPU.
+    (default: `0`)
 
 The resulting font files can be then used as specified in the documentation of
 `converter` plugin.
@@ -112,6 +136,7 @@ FontConverter::FontConverter(const Arguments& arguments): Platform::WindowlessAp
         .addOption("atlas-size", "2048 2048").setHelpKey("atlas-size", "\"X Y\"").setHelp("atlas-size", "glyph atlas size")
         .addOption("output-size", "256 256").setHelpKey("output-size", "\"X Y\"").setHelp("output-size", "output atlas size. If set to zero size, distance field computation will not be used.")
         .addOption("radius", "24").setHelpKey("radius", "N").setHelp("radius", "distance field computation radius")
+        .addOption("threads", "0").setHelpKey("threads", "N").setHelp("threads", "compute distance field on the CPU in given count of threads, 0 uses the GPU")
         .setHelp("Converts font to raster one of given atlas size.")
         .parse(arguments.argc, arguments.argv);
 
@@ -119,18 +144,28 @@ FontConverter::FontConverter(const Arguments& arguments): Platform::WindowlessAp
 }
 
 int FontConverter::exec() {
+    #ifdef MAGNUM_BUILD_UTILITIES_STATIC_PLUGINS
+    importStaticPlugins();
+    #endif
+
+    /* Don't scan any directory if the plugin dir is empty */
+    const std::string pluginDir = args.value("plugin-dir");
+    auto pluginSubdir = [&pluginDir](const std::string& subdir) {
+        return pluginDir.empty() ? std::string{} : Utility::Directory::join(pluginDir, subdir);
+    };
+
     /* Font converter dependencies */
-    PluginManager::Manager<Trade::AbstractImageConverter> imageConverterManager(Utility::Directory::join(args.value("plugin-dir"), "imageconverters/"));
+    PluginManager::Manager<Trade::AbstractImageConverter> imageConverterManager(pluginSubdir("imageconverters/"));
 
     /* Load font */
-    PluginManager::Manager<Text::AbstractFont> fontManager(Utility::Directory::join(args.value("plugin-dir"), "fonts/"));
-    if(!(fontManager.load(args.value("font")) & PluginManager::LoadState::Loaded))
+    PluginManager::Manager<Text::AbstractFont> fontManager(pluginSubdir("fonts/"));
+    if(!(fontManager.load(args.value("font")) & (PluginManager::LoadState::Loaded|PluginManager::LoadState::Static)))
         std::exit(1);
     std::unique_ptr<Text::AbstractFont> font = fontManager.instance(args.value("font"));
 
     /* Load font converter */
-    PluginManager::Manager<Text::AbstractFontConverter> converterManager(Utility::Directory::join(args.value("plugin-dir"), "fontconverters/"));
-    if(!(converterManager.load(args.value("converter")) & PluginManager::LoadState::Loaded))
+    PluginManager::Manager<Text::AbstractFontConverter> converterManager(pluginSubdir("fontconverters/"));
+    if(!(converterManager.load(args.value("converter")) & (PluginManager::LoadState::Loaded|PluginManager::LoadState::Static)))
         std::exit(1);
     std::unique_ptr<Text::AbstractFontConverter> converter = converterManager.instance(args.value("converter"));
 
@@ -145,10 +180,12 @@ int FontConverter::exec() {
     if(!args.value<Vector2i>("output-size").isZero()) {
         Debug() << "Populating distance field glyph cache...";
 
-        cache.reset(new Text::DistanceFieldGlyphCache(
+        auto distanceFieldCache = new Text::DistanceFieldGlyphCache(
             args.value<Vector2i>("atlas-size"),
             args.value<Vector2i>("output-size"),
-            args.value<Int>("radius")));
+            args.value<Int>("radius"));
+        distanceFieldCache->setThreadCount(args.value<UnsignedInt>("threads"));
+        cache.reset(distanceFieldCache);
 
     /* Otherwise use normal cache */
     } else {
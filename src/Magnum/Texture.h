@@ -600,6 +600,92 @@ template<UnsignedInt dimensions> class Texture: public AbstractTexture {
             return *this;
         }
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @brief Count of available sparse page sizes for given format
+         *
+         * If @extension{ARB,sparse_texture} is not available, returns `0`.
+         * Not available for one-dimensional textures.
+         * @see @ref sparsePageSize(), @fn_gl{GetInternalformat} with
+         *      @def_gl{NUM_VIRTUAL_PAGE_SIZES_ARB}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        static Int sparsePageSizeCount(TextureFormat format) {
+            return sparsePageSizeCountInternal(Implementation::textureTarget<dimensions>(), format);
+        }
+
+        /**
+         * @brief Sparse page size for given format
+         * @param format            Internal format
+         * @param index             Page size index, expected to be less than
+         *      @ref sparsePageSizeCount()
+         *
+         * Offsets and sizes passed to @ref setPageCommitment() must be
+         * multiples of this size. Not available for one-dimensional textures.
+         * @see @fn_gl{GetInternalformat} with @def_gl{VIRTUAL_PAGE_SIZE_X_ARB},
+         *      @def_gl{VIRTUAL_PAGE_SIZE_Y_ARB}, @def_gl{VIRTUAL_PAGE_SIZE_Z_ARB}
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        static VectorTypeFor<dimensions, Int> sparsePageSize(TextureFormat format, Int index = 0) {
+            return DataHelper<dimensions>::sparsePageSize(Implementation::textureTarget<dimensions>(), format, index);
+        }
+
+        /**
+         * @brief Make the texture sparse
+         * @param sparse            Whether the texture is sparse
+         * @param pageSizeIndex     Page size index, see @ref sparsePageSize()
+         * @return Reference to self (for method chaining)
+         *
+         * Must be called before @ref setStorage(). Storage of sparse textures
+         * is only virtual, physical memory is allocated using
+         * @ref setPageCommitment(). Not available for one-dimensional
+         * textures. See also @ref TexturePageResidency for on-demand
+         * commitment management.
+         * @see @ref sparseLevelCount(), @fn_gl{TexParameter} with
+         *      @def_gl{TEXTURE_SPARSE_ARB}, @def_gl{VIRTUAL_PAGE_SIZE_INDEX_ARB}
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        Texture<dimensions>& setSparse(bool sparse, Int pageSizeIndex = 0) {
+            setSparseInternal(sparse, pageSizeIndex);
+            return *this;
+        }
+
+        /**
+         * @brief Count of sparse mip levels
+         *
+         * Levels above this count form a mip tail which has to be committed
+         * as a whole. Expects that the texture is sparse and has storage
+         * allocated. The result is not cached in any way. The texture is
+         * bound before the operation (if not already).
+         * @see @fn_gl{GetTexParameter} with @def_gl{NUM_SPARSE_LEVELS_ARB}
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        Int sparseLevelCount() { return sparseLevelCountInternal(); }
+
+        /**
+         * @brief Commit or decommit sparse texture pages
+         * @param level             Mip level
+         * @param range             Range of texels, must be aligned to
+         *      @ref sparsePageSize()
+         * @param commit            Whether to allocate or free physical memory
+         * @return Reference to self (for method chaining)
+         *
+         * Contents of newly committed pages are undefined. The texture is
+         * bound before the operation (if not already). Not available for
+         * one-dimensional textures.
+         * @see @fn_gl_extension{TexPageCommitment,ARB,sparse_texture}
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        Texture<dimensions>& setPageCommitment(Int level, const RangeTypeFor<dimensions, Int>& range, bool commit) {
+            DataHelper<dimensions>::setPageCommitment(*this, level, range, commit);
+            return *this;
+        }
+        #endif
+
         #ifndef MAGNUM_TARGET_GLES2
         /**
          * @brief Image size in given mip level
@@ -801,7 +887,9 @@ template<UnsignedInt dimensions> class Texture: public AbstractTexture {
          *
          * If on OpenGL ES or neither @extension{ARB,direct_state_access} (part
          * of OpenGL 4.5) nor @extension{EXT,direct_state_access} is available,
-         * the texture is bound before the operation (if not already).
+         * the texture is bound before the operation (if not already). For
+         * streaming large amounts of data every frame without stalls see
+         * @ref TextureUploadQueue.
          *
          * @attention In @ref MAGNUM_TARGET_WEBGL "WebGL" the @ref ColorType of
          *      data passed in @p image must match the original one specified
@@ -840,6 +928,56 @@ template<UnsignedInt dimensions> class Texture: public AbstractTexture {
         }
         #endif
 
+        /**
+         * @brief Set compressed image data
+         * @param level             Mip level
+         * @param image             @ref CompressedImageReference or
+         *      @ref Trade::CompressedImageData of the same dimension count
+         * @return Reference to self (for method chaining)
+         *
+         * The data are uploaded as-is, without any decompression on the CPU.
+         * The internal format of the texture is the compressed format of
+         * @p image. This call has no equivalent in
+         * @extension{ARB,direct_state_access}, thus the texture needs to be
+         * bound to some texture unit before the operation.
+         * @see @ref maxSize(), @fn_gl{ActiveTexture}, @fn_gl{BindTexture} and
+         *      @fn_gl{CompressedTexImage1D} / @fn_gl{CompressedTexImage2D} /
+         *      @fn_gl{CompressedTexImage3D}
+         */
+        Texture<dimensions>& setCompressedImage(Int level, const CompressedImageReference<dimensions>& image) {
+            DataHelper<dimensions>::setCompressedImage(*this, level, image);
+            return *this;
+        }
+
+        /**
+         * @brief Set compressed image subdata
+         * @param level             Mip level
+         * @param offset            Offset where to put data in the texture
+         * @param image             @ref CompressedImageReference or
+         *      @ref Trade::CompressedImageData of the same dimension count
+         * @return Reference to self (for method chaining)
+         *
+         * The format of @p image must match the internal format of the
+         * texture, offset and size must be aligned to the compression block
+         * size. If on OpenGL ES or neither @extension{ARB,direct_state_access}
+         * (part of OpenGL 4.5) nor @extension{EXT,direct_state_access} is
+         * available, the texture is bound before the operation (if not
+         * already).
+         * @see @ref setStorage(), @fn_gl2{CompressedTextureSubImage1D,CompressedTexSubImage1D} /
+         *      @fn_gl2{CompressedTextureSubImage2D,CompressedTexSubImage2D} /
+         *      @fn_gl2{CompressedTextureSubImage3D,CompressedTexSubImage3D},
+         *      @fn_gl_extension{CompressedTextureSubImage1D,EXT,direct_state_access} /
+         *      @fn_gl_extension{CompressedTextureSubImage2D,EXT,direct_state_access} /
+         *      @fn_gl_extension{CompressedTextureSubImage3D,EXT,direct_state_access},
+         *      eventually @fn_gl{ActiveTexture}, @fn_gl{BindTexture} and
+         *      @fn_gl{CompressedTexSubImage1D} / @fn_gl{CompressedTexSubImage2D} /
+         *      @fn_gl{CompressedTexSubImage3D}
+         */
+        Texture<dimensions>& setCompressedSubImage(Int level, const VectorTypeFor<dimensions, Int>& offset, const CompressedImageReference<dimensions>& image) {
+            DataHelper<Dimensions>::setCompressedSubImage(*this, level, offset, image);
+            return *this;
+        }
+
         /**
          * @brief Generate mipmap
          * @return Reference to self (for method chaining)
@@ -334,6 +334,65 @@ template<UnsignedInt dimensions> class TextureArray: public AbstractTexture {
             return *this;
         }
 
+        #ifndef MAGNUM_TARGET_GLES
+        /**
+         * @copybrief Texture::sparsePageSizeCount()
+         *
+         * See @ref Texture::sparsePageSizeCount() for more information.
+         * Sparse one-dimensional array textures are not supported.
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        static Int sparsePageSizeCount(TextureFormat format) {
+            return sparsePageSizeCountInternal(Implementation::textureArrayTarget<dimensions>(), format);
+        }
+
+        /**
+         * @copybrief Texture::sparsePageSize()
+         *
+         * See @ref Texture::sparsePageSize() for more information.
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        static VectorTypeFor<dimensions+1, Int> sparsePageSize(TextureFormat format, Int index = 0) {
+            return DataHelper<dimensions+1>::sparsePageSize(Implementation::textureArrayTarget<dimensions>(), format, index);
+        }
+
+        /**
+         * @copybrief Texture::setSparse()
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Texture::setSparse() for more information.
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        TextureArray<dimensions>& setSparse(bool sparse, Int pageSizeIndex = 0) {
+            setSparseInternal(sparse, pageSizeIndex);
+            return *this;
+        }
+
+        /**
+         * @copybrief Texture::sparseLevelCount()
+         *
+         * See @ref Texture::sparseLevelCount() for more information.
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        Int sparseLevelCount() { return sparseLevelCountInternal(); }
+
+        /**
+         * @copybrief Texture::setPageCommitment()
+         * @return Reference to self (for method chaining)
+         *
+         * See @ref Texture::setPageCommitment() for more information.
+         * @requires_extension Extension @extension{ARB,sparse_texture}
+         * @requires_gl Sparse textures are not available in OpenGL ES.
+         */
+        TextureArray<dimensions>& setPageCommitment(Int level, const RangeTypeFor<dimensions+1, Int>& range, bool commit) {
+            DataHelper<dimensions+1>::setPageCommitment(*this, level, range, commit);
+            return *this;
+        }
+        #endif
+
         /**
          * @copybrief Texture::imageSize()
          *
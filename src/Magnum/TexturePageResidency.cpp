@@ -0,0 +1,174 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TexturePageResidency.h"
+
+#include <algorithm>
+
+#include "Magnum/Texture.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+
+namespace Magnum {
+
+TexturePageResidency::TexturePageResidency(Texture2D& texture, const Int levels, const Vector2i& size, const Vector2i& pageSize): _texture(texture), _pageSize{pageSize}, _levels(levels), _committedCount{0}, _pageBudget{~std::size_t{}}, _frame{1}, _evictionDelay{8} {
+    CORRADE_ASSERT(pageSize.x() > 0 && pageSize.y() > 0,
+        "TexturePageResidency::TexturePageResidency(): invalid page size" << pageSize, );
+
+    for(Int i = 0; i != levels; ++i) {
+        Level& level = _levels[i];
+        level.size = Math::max(size/(1 << i), Vector2i{1});
+        level.pageCount = (level.size + pageSize - Vector2i{1})/pageSize;
+        level.lastRequested.assign(level.pageCount.product(), 0);
+        level.committed.assign(level.pageCount.product(), false);
+    }
+}
+
+TexturePageResidency::~TexturePageResidency() {
+    for(std::size_t i = 0; i != _levels.size(); ++i) {
+        const Level& level = _levels[i];
+        for(Int y = 0; y != level.pageCount.y(); ++y) for(Int x = 0; x != level.pageCount.x(); ++x) {
+            if(!level.committed[y*level.pageCount.x() + x]) continue;
+
+            /* Find the end of committed run */
+            Int end = x + 1;
+            while(end != level.pageCount.x() && level.committed[y*level.pageCount.x() + end]) ++end;
+            commitRun(i, y, x, end, false);
+            x = end - 1;
+        }
+    }
+}
+
+Vector2i TexturePageResidency::pageCount(const Int level) const {
+    CORRADE_ASSERT(std::size_t(level) < _levels.size(),
+        "TexturePageResidency::pageCount(): level" << level << "out of range for" << _levels.size() << "levels", {});
+    return _levels[level].pageCount;
+}
+
+void TexturePageResidency::request(const Int level, const Range2Di& range) {
+    CORRADE_ASSERT(std::size_t(level) < _levels.size(),
+        "TexturePageResidency::request(): level" << level << "out of range for" << _levels.size() << "levels", );
+
+    Level& l = _levels[level];
+    const Vector2i min = Math::max(range.min()/_pageSize, Vector2i{0});
+    const Vector2i max = Math::min((range.max() + _pageSize - Vector2i{1})/_pageSize, l.pageCount);
+    for(Int y = min.y(); y < max.y(); ++y)
+        for(Int x = min.x(); x < max.x(); ++x)
+            l.lastRequested[y*l.pageCount.x() + x] = _frame;
+}
+
+bool TexturePageResidency::isCommitted(const Page& page) const {
+    const Level& level = _levels[page.level];
+    return level.committed[page.coordinates.y()*level.pageCount.x() + page.coordinates.x()];
+}
+
+Range2Di TexturePageResidency::pageRange(const Page& page) const {
+    const Level& level = _levels[page.level];
+    const Vector2i min = page.coordinates*_pageSize;
+    return {min, Math::min(min + _pageSize, level.size)};
+}
+
+void TexturePageResidency::commitRun(const Int level, const Int y, const Int begin, const Int end, const bool commit) {
+    /* Pages at the level edge can be smaller than the page size, the
+       commitment has to be clipped to the level size */
+    const Range2Di range{{begin*_pageSize.x(), y*_pageSize.y()},
+        Math::min(Vector2i{end*_pageSize.x(), (y + 1)*_pageSize.y()}, _levels[level].size)};
+    _texture.setPageCommitment(level, range, commit);
+
+    Level& l = _levels[level];
+    for(Int x = begin; x != end; ++x) l.committed[y*l.pageCount.x() + x] = commit;
+    if(commit) _committedCount += end - begin;
+    else _committedCount -= end - begin;
+}
+
+std::vector<TexturePageResidency::Page> TexturePageResidency::update() {
+    /* Decommit stale pages first to make room for the new ones */
+    for(std::size_t i = 0; i != _levels.size(); ++i) {
+        const Level& level = _levels[i];
+        for(Int y = 0; y != level.pageCount.y(); ++y) for(Int x = 0; x != level.pageCount.x(); ++x) {
+            auto stale = [&](Int column) {
+                const std::size_t id = y*level.pageCount.x() + column;
+                return level.committed[id] && _frame - level.lastRequested[id] > _evictionDelay;
+            };
+            if(!stale(x)) continue;
+
+            Int end = x + 1;
+            while(end != level.pageCount.x() && stale(end)) ++end;
+            commitRun(i, y, x, end, false);
+            x = end - 1;
+        }
+    }
+
+    /* Collect pages requested in this frame which are not committed yet */
+    std::vector<Page> pages;
+    for(std::size_t i = 0; i != _levels.size(); ++i) {
+        const Level& level = _levels[i];
+        for(Int y = 0; y != level.pageCount.y(); ++y) for(Int x = 0; x != level.pageCount.x(); ++x) {
+            const std::size_t id = y*level.pageCount.x() + x;
+            if(level.lastRequested[id] == _frame && !level.committed[id])
+                pages.push_back({Int(i), {x, y}});
+        }
+    }
+
+    /* Over budget, evict least recently requested pages that are not needed
+       in this frame. If that's still not enough, postpone the rest. */
+    if(_committedCount + pages.size() > _pageBudget) {
+        std::vector<std::pair<UnsignedInt, Page>> candidates;
+        for(std::size_t i = 0; i != _levels.size(); ++i) {
+            const Level& level = _levels[i];
+            for(Int y = 0; y != level.pageCount.y(); ++y) for(Int x = 0; x != level.pageCount.x(); ++x) {
+                const std::size_t id = y*level.pageCount.x() + x;
+                if(level.committed[id] && level.lastRequested[id] != _frame)
+                    candidates.push_back({level.lastRequested[id], Page{Int(i), {x, y}}});
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const std::pair<UnsignedInt, Page>& a, const std::pair<UnsignedInt, Page>& b) {
+            return a.first < b.first;
+        });
+
+        for(std::size_t i = 0; i != candidates.size() && _committedCount + pages.size() > _pageBudget; ++i) {
+            const Page& page = candidates[i].second;
+            commitRun(page.level, page.coordinates.y(), page.coordinates.x(), page.coordinates.x() + 1, false);
+        }
+
+        if(_committedCount + pages.size() > _pageBudget)
+            pages.resize(_pageBudget > _committedCount ? _pageBudget - _committedCount : 0);
+    }
+
+    /* Commit the new pages, merging adjacent pages in a row */
+    for(std::size_t i = 0; i != pages.size(); ) {
+        std::size_t end = i + 1;
+        while(end != pages.size() && pages[end].level == pages[i].level &&
+              pages[end].coordinates.y() == pages[i].coordinates.y() &&
+              pages[end].coordinates.x() == pages[end - 1].coordinates.x() + 1) ++end;
+        commitRun(pages[i].level, pages[i].coordinates.y(), pages[i].coordinates.x(), pages[end - 1].coordinates.x() + 1, true);
+        i = end;
+    }
+
+    ++_frame;
+    return pages;
+}
+
+}
@@ -0,0 +1,205 @@
+#ifndef Magnum_TexturePageResidency_h
+#define Magnum_TexturePageResidency_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Class @ref Magnum::TexturePageResidency
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES
+namespace Magnum {
+
+/**
+@brief Page residency manager for sparse textures
+
+Tracks which pages of a sparse @ref Texture2D are needed and commits or
+decommits them on demand, so the physical memory use corresponds to what is
+actually visible instead of the full texture size. Each frame, mark the texel
+ranges that will be sampled using @ref request() and then call @ref update(),
+which commits the newly requested pages and decommits pages that weren't
+requested for more than @ref evictionDelay() frames. Pages returned from
+@ref update() have undefined contents and need to be filled, for example
+through @ref TextureUploadQueue. Example usage:
+@code
+Texture2D texture;
+texture.setSparse(true)
+    .setStorage(levels, TextureFormat::RGBA8, {16384, 16384});
+
+TexturePageResidency residency{texture, texture.sparseLevelCount(), {16384, 16384},
+    Texture2D::sparsePageSize(TextureFormat::RGBA8)};
+
+// each frame
+for(const Range2Di& tile: visibleTiles) residency.request(0, tile);
+for(const TexturePageResidency::Page& page: residency.update())
+    streamTile(page.level, residency.pageRange(page));
+@endcode
+
+Only the sparse levels are managed, the mip tail (levels starting at
+@ref Texture2D::sparseLevelCount()) has to be committed by the user as a
+whole. Adjacent pages in a row are committed or decommitted with a single
+call.
+@requires_extension Extension @extension{ARB,sparse_texture}
+@requires_gl Sparse textures are not available in OpenGL ES.
+*/
+class MAGNUM_EXPORT TexturePageResidency {
+    public:
+        /** @brief Page */
+        struct Page {
+            Int level;              /**< @brief Mip level */
+            Vector2i coordinates;   /**< @brief Page coordinates in the level */
+        };
+
+        /**
+         * @brief Constructor
+         * @param texture       Sparse texture with allocated storage
+         * @param levels        Count of managed levels, usually
+         *      @ref Texture2D::sparseLevelCount()
+         * @param size          Size of the base level
+         * @param pageSize      Page size, see @ref Texture2D::sparsePageSize()
+         *
+         * No pages are committed initially.
+         */
+        explicit TexturePageResidency(Texture2D& texture, Int levels, const Vector2i& size, const Vector2i& pageSize);
+
+        /** @brief Copying is not allowed */
+        TexturePageResidency(const TexturePageResidency&) = delete;
+
+        /** @brief Moving is not allowed */
+        TexturePageResidency(TexturePageResidency&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Decommits all pages.
+         */
+        ~TexturePageResidency();
+
+        /** @brief Copying is not allowed */
+        TexturePageResidency& operator=(const TexturePageResidency&) = delete;
+
+        /** @brief Moving is not allowed */
+        TexturePageResidency& operator=(TexturePageResidency&&) = delete;
+
+        /** @brief Page size */
+        Vector2i pageSize() const { return _pageSize; }
+
+        /** @brief Page count in given level */
+        Vector2i pageCount(Int level) const;
+
+        /** @brief Count of currently committed pages */
+        std::size_t committedPageCount() const { return _committedCount; }
+
+        /** @brief Eviction delay in frames */
+        UnsignedInt evictionDelay() const { return _evictionDelay; }
+
+        /**
+         * @brief Set eviction delay
+         * @return Reference to self (for method chaining)
+         *
+         * Pages not requested for more than @p frames are decommitted. Default
+         * is `8`. A non-zero delay prevents pages on the view boundary from
+         * being repeatedly committed and decommitted.
+         */
+        TexturePageResidency& setEvictionDelay(UnsignedInt frames) {
+            _evictionDelay = frames;
+            return *this;
+        }
+
+        /**
+         * @brief Page budget
+         *
+         * @see @ref setPageBudget()
+         */
+        std::size_t pageBudget() const { return _pageBudget; }
+
+        /**
+         * @brief Set page budget
+         * @return Reference to self (for method chaining)
+         *
+         * If committing all requested pages would exceed the budget, the
+         * least recently requested committed pages are decommitted first and
+         * the remaining requests are postponed to later frames. Default is
+         * unlimited.
+         */
+        TexturePageResidency& setPageBudget(std::size_t pages) {
+            _pageBudget = pages;
+            return *this;
+        }
+
+        /**
+         * @brief Request texel range in given level
+         *
+         * Marks all pages touching given range as needed in current frame.
+         * Parts of the range outside of the level are ignored.
+         */
+        void request(Int level, const Range2Di& range);
+
+        /** @brief Whether given page is committed */
+        bool isCommitted(const Page& page) const;
+
+        /** @brief Texel range of given page */
+        Range2Di pageRange(const Page& page) const;
+
+        /**
+         * @brief Update page commitment
+         * @return Pages committed in this call
+         *
+         * Commits pages requested since last call, decommits stale pages and
+         * advances to next frame.
+         * @see @ref Texture2D::setPageCommitment()
+         */
+        std::vector<Page> update();
+
+    private:
+        struct Level {
+            Vector2i size, pageCount;
+            /* Frame in which the page was last requested, 0 if never */
+            std::vector<UnsignedInt> lastRequested;
+            std::vector<bool> committed;
+        };
+
+        void commitRun(Int level, Int y, Int begin, Int end, bool commit);
+
+        Texture2D& _texture;
+        Vector2i _pageSize;
+        std::vector<Level> _levels;
+        std::size_t _committedCount, _pageBudget;
+        UnsignedInt _frame, _evictionDelay;
+};
+
+}
+#else
+#error this header is available only on desktop OpenGL build
+#endif
+
+#endif
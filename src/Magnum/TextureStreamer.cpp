@@ -0,0 +1,201 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TextureStreamer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/ImageReference.h"
+#include "Magnum/TextureFormat.h"
+
+namespace Magnum {
+
+struct TextureStreamer::Entry {
+    explicit Entry(TextureFormat format, const Vector2i& size, Int levelCount, Int minResident, Loader loader): format{format}, size{size}, levelCount{levelCount}, minResident{minResident}, resident{levelCount}, requested{minResident}, request{minResident}, loader{std::move(loader)}, levelData(levelCount, 0) {}
+
+    Texture2D texture;
+    TextureFormat format;
+    Vector2i size;
+    Int levelCount,
+        minResident,    /* levels from this one are never evicted */
+        resident,       /* finest resident level */
+        requested,      /* level requested in last update() */
+        request;        /* finest level requested since last update() */
+    ColorFormat colorFormat;
+    ColorType colorType;
+    Loader loader;
+    std::vector<std::size_t> levelData;
+};
+
+Vector2i TextureStreamer::levelSize(const Vector2i& size, const Int level) {
+    return Math::max(size/(1 << level), Vector2i{1});
+}
+
+Int TextureStreamer::levelForScreenSize(const Vector2i& size, const Float screenSize) {
+    const Float maxSize = Float(size.max());
+    if(!(screenSize < maxSize)) return 0;
+    if(screenSize <= 1.0f) return Int(std::ceil(std::log2(maxSize)));
+    return Int(std::floor(std::log2(maxSize/screenSize)));
+}
+
+Float TextureStreamer::screenSize(const Matrix4& projectionMatrix, const Vector2i& viewport, const Vector3& center, const Float radius) {
+    /* Homogeneous W of the center, -z for perspective and 1 for orthographic
+       projection */
+    const Float w = projectionMatrix[0][3]*center.x() + projectionMatrix[1][3]*center.y() + projectionMatrix[2][3]*center.z() + projectionMatrix[3][3];
+
+    /* The sphere intersects the near plane or is behind the camera */
+    if(w - radius*std::abs(projectionMatrix[2][3]) <= 0.0f)
+        return std::numeric_limits<Float>::infinity();
+
+    return radius*std::abs(projectionMatrix[1][1])*viewport.y()/w;
+}
+
+TextureStreamer::TextureStreamer(const std::size_t memoryBudget, const Int residentLevels, const UnsignedInt uploadsPerFrame): _memoryBudget{memoryBudget}, _memoryUsage{0}, _residentLevels{residentLevels}, _uploadsPerFrame{uploadsPerFrame} {
+    CORRADE_ASSERT(residentLevels > 0, "TextureStreamer::TextureStreamer(): at least one level must be always resident", );
+}
+
+TextureStreamer::~TextureStreamer() = default;
+
+auto TextureStreamer::add(const TextureFormat format, const Vector2i& size, const Int levelCount, Loader loader) -> Handle {
+    CORRADE_ASSERT(levelCount > 0, "TextureStreamer::add(): level count must be positive", {});
+
+    const Int minResident = std::max(0, levelCount - _residentLevels);
+    _textures.emplace_back(new Entry{format, size, levelCount, minResident, std::move(loader)});
+    Entry& entry = *_textures.back();
+    entry.texture.setMaxLevel(levelCount - 1);
+
+    /* Upload the smallest levels first, so the texture is complete after
+       each step */
+    for(Int level = levelCount - 1; level >= minResident; --level)
+        upload(entry, level);
+
+    return _textures.size() - 1;
+}
+
+Texture2D& TextureStreamer::texture(const Handle handle) {
+    return _textures[handle]->texture;
+}
+
+Int TextureStreamer::residentLevel(const Handle handle) const {
+    CORRADE_ASSERT(handle < _textures.size(), "TextureStreamer::residentLevel(): invalid handle" << handle, {});
+    return _textures[handle]->resident;
+}
+
+Int TextureStreamer::requestedLevel(const Handle handle) const {
+    CORRADE_ASSERT(handle < _textures.size(), "TextureStreamer::requestedLevel(): invalid handle" << handle, {});
+    return _textures[handle]->requested;
+}
+
+void TextureStreamer::requestLevel(const Handle handle, const Int level) {
+    CORRADE_ASSERT(handle < _textures.size(), "TextureStreamer::requestLevel(): invalid handle" << handle, );
+    Entry& entry = *_textures[handle];
+    entry.request = std::min(entry.request, std::max(level, 0));
+}
+
+void TextureStreamer::requestScreenSize(const Handle handle, const Float screenSize) {
+    CORRADE_ASSERT(handle < _textures.size(), "TextureStreamer::requestScreenSize(): invalid handle" << handle, );
+    requestLevel(handle, levelForScreenSize(_textures[handle]->size, screenSize));
+}
+
+void TextureStreamer::update() {
+    /* Take the requests, textures not requested need only the resident
+       levels */
+    std::vector<Entry*> candidates;
+    for(std::unique_ptr<Entry>& entry: _textures) {
+        entry->requested = entry->request;
+        entry->request = entry->minResident;
+        if(entry->requested < entry->resident) candidates.push_back(entry.get());
+    }
+
+    /* Largest difference first */
+    std::stable_sort(candidates.begin(), candidates.end(), [](const Entry* a, const Entry* b) {
+        return a->resident - a->requested > b->resident - b->requested;
+    });
+
+    UnsignedInt uploads = 0;
+    for(Entry* entry: candidates) {
+        if(uploads == _uploadsPerFrame) break;
+
+        /* Estimate size of the next level from the current one */
+        const Int level = entry->resident - 1;
+        const Vector2i current = levelSize(entry->size, entry->resident);
+        const Vector2i next = levelSize(entry->size, level);
+        const std::size_t estimate = entry->levelData[entry->resident]*next.product()/current.product();
+
+        if(!makeRoom(estimate, *entry)) continue;
+
+        upload(*entry, level);
+        ++uploads;
+    }
+}
+
+void TextureStreamer::upload(Entry& entry, const Int level) {
+    Image2D image = entry.loader(level);
+    CORRADE_ASSERT(image.size() == levelSize(entry.size, level),
+        "TextureStreamer: expected level" << level << "of size" << levelSize(entry.size, level) << "but got" << image.size(), );
+
+    entry.texture.setImage(level, entry.format, image)
+        .setBaseLevel(level);
+    entry.resident = level;
+    entry.colorFormat = image.format();
+    entry.colorType = image.type();
+    entry.levelData[level] = image.dataSize(image.size());
+    if(level < entry.minResident) _memoryUsage += entry.levelData[level];
+}
+
+void TextureStreamer::evict(Entry& entry) {
+    const Int level = entry.resident;
+    CORRADE_INTERNAL_ASSERT(level < entry.minResident);
+
+    /* Make the texture complete without the level first, then release its
+       memory by specifying it with zero size */
+    entry.texture.setBaseLevel(level + 1)
+        .setImage(level, entry.format, ImageReference2D{entry.colorFormat, entry.colorType, {}});
+    entry.resident = level + 1;
+    _memoryUsage -= entry.levelData[level];
+    entry.levelData[level] = 0;
+}
+
+bool TextureStreamer::makeRoom(const std::size_t size, const Entry& except) {
+    while(_memoryUsage + size > _memoryBudget) {
+        /* Evict from the texture having most levels finer than requested */
+        Entry* victim = nullptr;
+        for(std::unique_ptr<Entry>& entry: _textures) {
+            if(entry.get() == &except || entry->resident >= entry->requested) continue;
+            if(!victim || entry->requested - entry->resident > victim->requested - victim->resident)
+                victim = entry.get();
+        }
+
+        if(!victim) return false;
+        evict(*victim);
+    }
+
+    return true;
+}
+
+}
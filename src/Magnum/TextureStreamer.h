@@ -0,0 +1,250 @@
+#ifndef Magnum_TextureStreamer_h
+#define Magnum_TextureStreamer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::TextureStreamer
+ */
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "Magnum/Image.h"
+#include "Magnum/Texture.h"
+#include "Magnum/Math/Matrix4.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+/**
+@brief Mip level streaming for two-dimensional textures
+
+Instead of uploading whole mip chains at startup, the textures added with
+@ref add() get only their smallest levels uploaded right away. The finer levels
+are loaded on demand, based on screen size requested each frame, and evicted
+again when no longer needed and the memory budget is exceeded. Example usage:
+@code
+TextureStreamer streamer{256*1024*1024};
+
+TextureStreamer::Handle rock = streamer.add(TextureFormat::RGBA8, {2048, 2048}, 12,
+    [](Int level) { return loadMipLevel("rock.dds", level); });
+streamer.texture(rock).setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Linear);
+
+// during culling, for each visible drawable using the texture
+streamer.requestScreenSize(rock, TextureStreamer::screenSize(projection, viewport, center, radius));
+
+// once per frame
+streamer.update();
+@endcode
+
+## Residency
+
+The textures have mutable storage and each level is allocated separately with
+@ref Texture::setImage() "Texture2D::setImage()", so levels that aren't
+resident don't take any memory. @ref AbstractTexture::setBaseLevel() "Base level"
+of the texture is always set to the finest resident level, so the texture is
+complete and can be sampled at any time.
+
+In each @ref update(), the requested level for each texture is computed from
+the largest screen size requested since previous update. At most
+@ref uploadsPerFrame() levels are uploaded, one level per texture at a time,
+textures with the largest difference between requested and resident level
+first. If the upload would exceed the memory budget, levels finer than
+requested are evicted from other textures first. If there's nothing to evict,
+the upload is postponed. Textures not requested since previous update are
+treated as needing only the smallest levels, so their finer levels are the
+first to go, but they are kept resident until the memory is needed.
+
+The level data are provided by a loader function, which is called synchronously
+from @ref add() and @ref update(). It's expected to return image of size
+@ref levelSize() in format matching the internal texture format.
+@requires_gles30 Base level specification is not available in OpenGL ES 2.0.
+@requires_webgl20 Base level specification is not available in WebGL 1.0.
+*/
+class MAGNUM_EXPORT TextureStreamer {
+    public:
+        /**
+         * @brief Handle
+         *
+         * @see @ref add()
+         */
+        typedef UnsignedInt Handle;
+
+        /**
+         * @brief Level loader
+         *
+         * Returns image data for given mip level.
+         */
+        typedef std::function<Image2D(Int)> Loader;
+
+        /**
+         * @brief Size of given mip level
+         *
+         * Each dimension is halved per level, but never less than `1`.
+         */
+        static Vector2i levelSize(const Vector2i& size, Int level);
+
+        /**
+         * @brief Mip level for given screen size
+         * @param size          Texture size
+         * @param screenSize    Size of the textured surface on screen in
+         *      pixels
+         *
+         * Returns the finest level that still has at least one texel per
+         * pixel, i.e. `log2(max(size)/screenSize)` clamped to valid range.
+         */
+        static Int levelForScreenSize(const Vector2i& size, Float screenSize);
+
+        /**
+         * @brief Projected screen size of a bounding sphere
+         * @param projectionMatrix  Camera projection matrix
+         * @param viewport          Viewport size
+         * @param center            Sphere center in camera space
+         * @param radius            Sphere radius
+         *
+         * Returns approximate diameter of the sphere on screen in pixels,
+         * suitable for @ref requestScreenSize(). Useful to call during frustum
+         * culling, where the camera-space bounding spheres are available. If
+         * the sphere intersects the near plane, returns infinity.
+         */
+        static Float screenSize(const Matrix4& projectionMatrix, const Vector2i& viewport, const Vector3& center, Float radius);
+
+        /**
+         * @brief Constructor
+         * @param memoryBudget      Memory budget in bytes for streamed levels
+         * @param residentLevels    Count of smallest levels that are uploaded
+         *      right away and never evicted
+         * @param uploadsPerFrame   Maximal count of levels uploaded in one
+         *      @ref update()
+         *
+         * The memory taken by the always-resident levels is not counted into
+         * the budget.
+         */
+        explicit TextureStreamer(std::size_t memoryBudget, Int residentLevels = 4, UnsignedInt uploadsPerFrame = 4);
+
+        /** @brief Copying is not allowed */
+        TextureStreamer(const TextureStreamer&) = delete;
+
+        /** @brief Moving is not allowed */
+        TextureStreamer(TextureStreamer&&) = delete;
+
+        ~TextureStreamer();
+
+        /** @brief Copying is not allowed */
+        TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+        /** @brief Moving is not allowed */
+        TextureStreamer& operator=(TextureStreamer&&) = delete;
+
+        /** @brief Memory budget in bytes */
+        std::size_t memoryBudget() const { return _memoryBudget; }
+
+        /**
+         * @brief Set memory budget
+         *
+         * Takes effect on next @ref update(). Lowering the budget doesn't
+         * evict anything by itself, it only makes room for further uploads
+         * harder.
+         */
+        void setMemoryBudget(std::size_t budget) { _memoryBudget = budget; }
+
+        /** @brief Memory taken by streamed levels in bytes */
+        std::size_t memoryUsage() const { return _memoryUsage; }
+
+        /** @brief Maximal count of levels uploaded per frame */
+        UnsignedInt uploadsPerFrame() const { return _uploadsPerFrame; }
+
+        /** @brief Count of streamed textures */
+        std::size_t textureCount() const { return _textures.size(); }
+
+        /**
+         * @brief Add a texture
+         * @param format        Internal texture format
+         * @param size          Size of level `0`
+         * @param levelCount    Level count
+         * @param loader        Level loader
+         *
+         * Uploads the smallest levels passed in constructor right away and
+         * sets base and max level accordingly.
+         */
+        Handle add(TextureFormat format, const Vector2i& size, Int levelCount, Loader loader);
+
+        /** @brief Texture */
+        Texture2D& texture(Handle handle);
+
+        /**
+         * @brief Finest resident level
+         *
+         * Equal to current base level of the texture.
+         */
+        Int residentLevel(Handle handle) const;
+
+        /** @brief Level requested in last @ref update() */
+        Int requestedLevel(Handle handle) const;
+
+        /**
+         * @brief Request given level for next update
+         *
+         * If requested more than once before @ref update(), the finest level
+         * is used.
+         */
+        void requestLevel(Handle handle, Int level);
+
+        /**
+         * @brief Request level for given screen size
+         *
+         * Same as calling @ref requestLevel() with
+         * @ref levelForScreenSize().
+         */
+        void requestScreenSize(Handle handle, Float screenSize);
+
+        /**
+         * @brief Stream the levels
+         *
+         * Call once per frame, after all requests were made.
+         */
+        void update();
+
+    private:
+        struct Entry;
+
+        void upload(Entry& entry, Int level);
+        void evict(Entry& entry);
+        bool makeRoom(std::size_t size, const Entry& except);
+
+        std::size_t _memoryBudget, _memoryUsage;
+        Int _residentLevels;
+        UnsignedInt _uploadsPerFrame;
+        std::vector<std::unique_ptr<Entry>> _textures;
+};
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
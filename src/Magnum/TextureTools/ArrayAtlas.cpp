@@ -0,0 +1,57 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ArrayAtlas.h"
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/TextureFormat.h"
+
+namespace Magnum { namespace TextureTools {
+
+Texture2DArray arrayAtlas(const TextureFormat internalFormat, const std::vector<ImageReference2D>& images, const Int levelCount) {
+    Texture2DArray texture;
+
+    CORRADE_ASSERT(!images.empty(),
+        "TextureTools::arrayAtlas(): expected at least one image", texture);
+
+    const Vector2i size = images.front().size();
+    texture.setStorage(levelCount, internalFormat, {size, Int(images.size())});
+
+    for(std::size_t i = 0; i != images.size(); ++i) {
+        const ImageReference2D& image = images[i];
+        CORRADE_ASSERT(image.size() == size,
+            "TextureTools::arrayAtlas(): expected image" << i << "to have size" << size << "but got" << image.size(), texture);
+
+        /* Upload the image as a single layer */
+        texture.setSubImage(0, {0, 0, Int(i)}, ImageReference3D{image.format(), image.type(), {size, 1}, image.data()});
+    }
+
+    if(levelCount > 1) texture.generateMipmap();
+
+    return texture;
+}
+
+}}
@@ -0,0 +1,81 @@
+#ifndef Magnum_TextureTools_ArrayAtlas_h
+#define Magnum_TextureTools_ArrayAtlas_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAGNUM_TARGET_GLES2
+/** @file
+ * @brief Function @ref Magnum::TextureTools::arrayAtlas()
+ */
+#endif
+
+#include <vector>
+
+#include "Magnum/ImageReference.h"
+#include "Magnum/TextureTools/visibility.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+#include "Magnum/TextureArray.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Pack same-sized images into layers of a texture array
+@param internalFormat   Internal format of the texture
+@param images           Images to pack
+@param levelCount       Count of mip levels to allocate
+
+Allocates a @ref Texture2DArray with one layer for each image in @p images
+and uploads the image into it, layer index is the same as index of the image.
+If @p levelCount is larger than `1`, the remaining levels are filled with
+@ref Texture2DArray::generateMipmap() "generateMipmap()". Expects that
+@p images is not empty and all images have the same size. Sampler parameters
+are left at their defaults, configure them on the returned texture.
+
+Unlike @ref atlas(), the images don't need to be placed into rectangles of a
+single large texture, so there's no bleeding between neighbors, wrapping
+works and mip levels can go down to `1x1`. Meshes that differ only in their
+texture can then be drawn with a single shader setup or even merged into a
+single draw using @ref Shaders::Phong::Flag::TextureArrays :
+@code
+std::vector<ImageReference2D> images;
+for(const Material& material: materials) images.push_back(material.image());
+
+Texture2DArray textures = TextureTools::arrayAtlas(TextureFormat::RGBA8, images, 9);
+textures.setMinificationFilter(Sampler::Filter::Linear, Sampler::Mipmap::Linear)
+    .setMagnificationFilter(Sampler::Filter::Linear);
+@endcode
+@attention This is GPU implementation, so it expects active context.
+@requires_gl30 Extension @extension{EXT,texture_array}
+@requires_gles30 Texture arrays are not available in OpenGL ES 2.0.
+*/
+Texture2DArray MAGNUM_TEXTURETOOLS_EXPORT arrayAtlas(TextureFormat internalFormat, const std::vector<ImageReference2D>& images, Int levelCount = 1);
+
+}}
+#else
+#error this header is not available on OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -25,36 +25,186 @@
 
 #include "Atlas.h"
 
+#include <algorithm>
+#include <numeric>
+#include <Corrade/Utility/Debug.h>
+
 #include "Magnum/Math/Functions.h"
-#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Vector3.h"
 
 namespace Magnum { namespace TextureTools {
 
+namespace {
+
+inline Vector2i flipped(const Vector2i& size) { return {size.y(), size.x()}; }
+
+/* Tries to place rectangle of given size with left edge at skyline segment
+   `i`, returns resulting Y position or -1 if it doesn't fit */
+Int fitSkyline(const std::vector<Vector3i>& skyline, const std::size_t i, const Vector2i& pageSize, const Vector2i& size) {
+    const Int x = skyline[i].x();
+    if(x + size.x() > pageSize.x()) return -1;
+
+    /* Find the highest segment below the rectangle */
+    Int y = 0;
+    Int widthLeft = size.x();
+    for(std::size_t j = i; widthLeft > 0; ++j) {
+        y = Math::max(y, skyline[j].y());
+        if(y + size.y() > pageSize.y()) return -1;
+        widthLeft -= skyline[j].z();
+    }
+
+    return y;
+}
+
+/* Places rectangle of given size at skyline segment `i` and updates the
+   skyline */
+void placeSkyline(std::vector<Vector3i>& skyline, const std::size_t i, const Vector2i& position, const Vector2i& size) {
+    skyline.insert(skyline.begin() + i, {position.x(), position.y() + size.y(), size.x()});
+
+    /* Shrink or remove segments covered by the new one */
+    const Int right = position.x() + size.x();
+    for(std::size_t j = i + 1; j < skyline.size(); ) {
+        if(skyline[j].x() >= right) break;
+
+        const Int segmentRight = skyline[j].x() + skyline[j].z();
+        if(segmentRight <= right) {
+            skyline.erase(skyline.begin() + j);
+            continue;
+        }
+
+        skyline[j].z() = segmentRight - right;
+        skyline[j].x() = right;
+        break;
+    }
+
+    /* Merge neighboring segments of the same height */
+    for(std::size_t j = 1; j < skyline.size(); ) {
+        if(skyline[j - 1].y() == skyline[j].y()) {
+            skyline[j - 1].z() += skyline[j].z();
+            skyline.erase(skyline.begin() + j);
+        } else ++j;
+    }
+}
+
+}
+
+AtlasPacker::AtlasPacker(const Vector2i& pageSize, const Vector2i& padding, const Flags flags): _pageSize{pageSize}, _padding{padding}, _flags{flags}, _usedArea{} {}
+
+Float AtlasPacker::fillRatio() const {
+    if(_pages.empty()) return 0.0f;
+    return Float(Double(_usedArea)/(Double(_pageSize.product())*_pages.size()));
+}
+
+std::optional<AtlasPacker::Placement> AtlasPacker::add(const Vector2i& size) {
+    return addInternal(size);
+}
+
+std::vector<AtlasPacker::Placement> AtlasPacker::add(const std::vector<Vector2i>& sizes) {
+    /* Place the tallest rectangles first */
+    const bool allowRotation = !!(_flags & Flag::AllowRotation);
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes, allowRotation](std::size_t a, std::size_t b) {
+        const Vector2i& sa = sizes[a];
+        const Vector2i& sb = sizes[b];
+        if(allowRotation) return Math::max(sa.x(), sa.y()) > Math::max(sb.x(), sb.y());
+        return sa.y() != sb.y() ? sa.y() > sb.y() : sa.x() > sb.x();
+    });
+
+    /* Save the state so it can be restored if anything doesn't fit */
+    std::vector<std::vector<Vector3i>> pages = _pages;
+    const Long usedArea = _usedArea;
+
+    std::vector<Placement> placements(sizes.size());
+    for(const std::size_t i: order) {
+        std::optional<Placement> placement = addInternal(sizes[i]);
+        if(!placement) {
+            _pages = std::move(pages);
+            _usedArea = usedArea;
+            return {};
+        }
+
+        placements[i] = *placement;
+    }
+
+    return placements;
+}
+
+std::optional<AtlasPacker::Placement> AtlasPacker::addInternal(const Vector2i& size) {
+    /* Padding stays the same even if the rectangle is rotated */
+    const Vector2i paddedSize = size + 2*_padding;
+    const Vector2i paddedRotatedSize = flipped(size) + 2*_padding;
+    const bool allowRotation = !!(_flags & Flag::AllowRotation);
+
+    /* Find the placement with lowest top edge (and leftmost, if equal) in
+       the first page where the rectangle fits */
+    for(UnsignedInt page = 0; ; ++page) {
+        /* Open new page if the rectangle doesn't fit into any existing one */
+        if(page == _pages.size()) {
+            if(!_pages.empty() && !(_flags & Flag::MultiplePages)) return std::nullopt;
+
+            const bool fits = (paddedSize <= _pageSize).all() ||
+                (allowRotation && (paddedRotatedSize <= _pageSize).all());
+            if(!fits) return std::nullopt;
+
+            _pages.push_back({{0, 0, _pageSize.x()}});
+        }
+
+        std::vector<Vector3i>& skyline = _pages[page];
+        std::size_t bestSegment = ~std::size_t{};
+        Vector2i bestPosition;
+        Int bestTop = _pageSize.y() + 1;
+        bool bestRotated = false;
+        for(std::size_t i = 0; i != skyline.size(); ++i) {
+            for(const bool rotated: {false, true}) {
+                if(rotated && !allowRotation) break;
+
+                const Vector2i s = rotated ? paddedRotatedSize : paddedSize;
+                const Int y = fitSkyline(skyline, i, _pageSize, s);
+                if(y < 0 || y + s.y() >= bestTop) continue;
+
+                bestSegment = i;
+                bestPosition = {skyline[i].x(), y};
+                bestTop = y + s.y();
+                bestRotated = rotated;
+            }
+        }
+
+        if(bestSegment == ~std::size_t{}) continue;
+
+        const Vector2i placedSize = bestRotated ? paddedRotatedSize : paddedSize;
+        placeSkyline(skyline, bestSegment, bestPosition, placedSize);
+        _usedArea += Long(placedSize.x())*placedSize.y();
+        return Placement{page, Range2Di::fromSize(bestPosition + _padding, bestRotated ? flipped(size) : size), bestRotated};
+    }
+}
+
+void AtlasPacker::clear() {
+    _pages.clear();
+    _usedArea = 0;
+}
+
 std::vector<Range2Di> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
     if(sizes.empty()) return {};
 
-    /* Size of largest texture */
-    Vector2i maxSize;
-    for(const Vector2i& size: sizes)
-        maxSize = Math::max(maxSize, size);
-
-    std::vector<Range2Di> atlas;
+    AtlasPacker packer{atlasSize, padding};
+    const std::vector<AtlasPacker::Placement> placements = packer.add(sizes);
+    if(placements.empty()) {
+        /* Size of largest texture, for the diagnostic */
+        Vector2i maxSize;
+        for(const Vector2i& size: sizes)
+            maxSize = Math::max(maxSize, size);
 
-    /* Columns and rows */
-    const Vector2i paddedSize = maxSize+2*padding;
-    const Vector2i gridSize = atlasSize/paddedSize;
-    if(std::size_t(gridSize.product()) < sizes.size()) {
         Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
-                << "is too small to fit" << sizes.size() << paddedSize
+                << "is too small to fit" << sizes.size() << maxSize + 2*padding
                 << "textures. Generated atlas will be empty.";
-        return atlas;
+        return {};
     }
 
-    /** @todo actual magic implementation, not this joke */
-
-    atlas.reserve(sizes.size());
-    for(std::size_t i = 0; i != sizes.size(); ++i)
-        atlas.push_back(Range2Di::fromSize(Vector2i(i%gridSize.x(), i/gridSize.x())*paddedSize+padding, sizes[i]));
+    std::vector<Range2Di> atlas;
+    atlas.reserve(placements.size());
+    for(const AtlasPacker::Placement& placement: placements)
+        atlas.push_back(placement.rectangle);
 
     return atlas;
 }
@@ -26,25 +26,162 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::TextureTools::atlas()
+ * @brief Class @ref Magnum::TextureTools::AtlasPacker, function @ref Magnum::TextureTools::atlas()
  */
 
 #include <vector>
+#include <Corrade/Containers/EnumSet.h>
 
 #include "Magnum/Magnum.h"
-#include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/TextureTools/visibility.h"
+#include "MagnumExternal/Optional/optional.hpp"
 
 namespace Magnum { namespace TextureTools {
 
+/**
+@brief Texture atlas packer
+
+Incrementally packs rectangles of arbitrary sizes into one or more atlas
+pages. Uses the skyline bottom-left algorithm --- each page keeps track of
+the top edge of already placed rectangles and a new rectangle is placed at the
+position where its top edge ends lowest. Compared to placing all rectangles in
+a uniform grid this wastes considerably less space when the sizes vary, which
+is usually the case for font glyphs and sprites.
+
+Padding is added twice to each size and the rectangles are laid out so the
+padding doesn't overlap. Returned rectangles are without the padding.
+
+Example usage:
+@code
+TextureTools::AtlasPacker packer{{1024, 1024}, {1, 1},
+    TextureTools::AtlasPacker::Flag::AllowRotation|
+    TextureTools::AtlasPacker::Flag::MultiplePages};
+for(const Sprite& sprite: sprites) {
+    std::optional<TextureTools::AtlasPacker::Placement> p = packer.add(sprite.size());
+    // upload the sprite to p->rectangle on page p->page ...
+}
+@endcode
+@see @ref atlas()
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT AtlasPacker {
+    public:
+        /**
+         * @brief Packing flag
+         *
+         * @see @ref Flags, @ref flags()
+         */
+        enum class Flag: UnsignedByte {
+            /**
+             * Allow rotating the rectangles by 90 degrees if that results in
+             * better placement. Check @ref Placement::rotated to see whether
+             * given rectangle was rotated.
+             */
+            AllowRotation = 1 << 0,
+
+            /**
+             * Open a new page if the rectangle doesn't fit into any existing
+             * one. If not set, only one page is used and @ref add() fails if
+             * the page is full.
+             */
+            MultiplePages = 1 << 1
+        };
+
+        /**
+         * @brief Packing flags
+         *
+         * @see @ref flags()
+         */
+        typedef Containers::EnumSet<Flag> Flags;
+
+        /** @brief Rectangle placement */
+        struct Placement {
+            /** @brief Page index */
+            UnsignedInt page;
+
+            /**
+             * @brief Rectangle in the page
+             *
+             * Without padding. If @ref rotated is `true`, the size is the
+             * original size with swapped components.
+             */
+            Range2Di rectangle;
+
+            /** @brief Whether the rectangle was rotated by 90 degrees */
+            bool rotated;
+        };
+
+        /**
+         * @brief Constructor
+         * @param pageSize      Size of each atlas page
+         * @param padding       Padding around each rectangle
+         * @param flags         Packing flags
+         */
+        explicit AtlasPacker(const Vector2i& pageSize, const Vector2i& padding = {}, Flags flags = {});
+
+        /** @brief Page size */
+        Vector2i pageSize() const { return _pageSize; }
+
+        /** @brief Padding around each rectangle */
+        Vector2i padding() const { return _padding; }
+
+        /** @brief Packing flags */
+        Flags flags() const { return _flags; }
+
+        /** @brief Count of used pages */
+        UnsignedInt pageCount() const { return _pages.size(); }
+
+        /**
+         * @brief Ratio of occupied area
+         *
+         * Area of all added rectangles including padding divided by area of
+         * all used pages. Returns `0.0f` if no page is used.
+         */
+        Float fillRatio() const;
+
+        /**
+         * @brief Add rectangle
+         *
+         * Returns placement of the rectangle or `std::nullopt` if it doesn't
+         * fit into any page.
+         */
+        std::optional<Placement> add(const Vector2i& size);
+
+        /**
+         * @brief Add more rectangles at once
+         *
+         * The rectangles are placed in order of decreasing height, which
+         * results in tighter packing than adding them one by one. Returns
+         * placements in the same order as @p sizes. If any of the rectangles
+         * doesn't fit, no rectangle is added and empty vector is returned.
+         */
+        std::vector<Placement> add(const std::vector<Vector2i>& sizes);
+
+        /** @brief Remove all rectangles and pages */
+        void clear();
+
+    private:
+        std::optional<Placement> addInternal(const Vector2i& size);
+
+        Vector2i _pageSize, _padding;
+        Flags _flags;
+        Long _usedArea;
+
+        /* For each page, skyline segments sorted by X. Each segment is X
+           position, height of the skyline and width of the segment. */
+        std::vector<std::vector<Vector3i>> _pages;
+};
+
+CORRADE_ENUMSET_OPERATORS(AtlasPacker::Flags)
+
 /**
 @brief Pack textures into texture atlas
 @param atlasSize    Size of resulting atlas
 @param sizes        Sizes of all textures in the atlas
 @param padding      Padding around each texture
 
-Packs many small textures into one larger. If the textures cannot be packed
-into required size, empty vector is returned.
+Packs many small textures into one larger using @ref AtlasPacker. If the
+textures cannot be packed into required size, empty vector is returned.
 
 Padding is added twice to each size and the atlas is laid out so the padding
 don't overlap. Returned sizes are the same as original sizes, i.e. without the
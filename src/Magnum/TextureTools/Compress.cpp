@@ -0,0 +1,711 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Compress.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Implementation/Simd.h"
+#include "Magnum/TextureTools/Implementation/PixelLayout.h"
+
+#if defined(MAGNUM_MATH_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MAGNUM_TEXTURETOOLS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Block of 4x4 RGBA pixels, in row-major order */
+typedef UnsignedByte Block[16][4];
+
+std::size_t blockSize(const CompressedColorFormat format) {
+    switch(format) {
+        case CompressedColorFormat::RGBS3tcDxt1:
+        case CompressedColorFormat::RGBAS3tcDxt1:
+        #ifndef MAGNUM_TARGET_GLES
+        case CompressedColorFormat::RedRgtc1:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        case CompressedColorFormat::RGB8Etc2:
+        case CompressedColorFormat::SRGB8Etc2:
+        #endif
+            return 8;
+        case CompressedColorFormat::RGBAS3tcDxt5:
+        #ifndef MAGNUM_TARGET_GLES
+        case CompressedColorFormat::RGRgtc2:
+        case CompressedColorFormat::RGBABptcUnorm:
+        case CompressedColorFormat::SRGBAlphaBptcUnorm:
+        #endif
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+/* Pixels outside of the image repeat the last row and column */
+void loadBlock(const ImageReference2D& image, const Implementation::Layout& layout, const std::size_t stride, const Int blockX, const Int blockY, Block& block) {
+    for(Int y = 0; y != 4; ++y) {
+        const Int sourceY = std::min(blockY*4 + y, image.size().y() - 1);
+        const UnsignedByte* const row = reinterpret_cast<const UnsignedByte*>(image.data()) + sourceY*stride;
+        for(Int x = 0; x != 4; ++x) {
+            const Int sourceX = std::min(blockX*4 + x, image.size().x() - 1);
+            const UnsignedByte* const pixel = row + sourceX*layout.channels;
+            for(Int c = 0; c != 4; ++c) {
+                const Int index = layout.index[c];
+                block[y*4 + x][c] = index == -1 ? (c == 3 ? 255 : 0) : pixel[index];
+            }
+        }
+    }
+}
+
+/* Endpoints at the extremes of the principal axis of pixel values, found by
+   a power iteration on the covariance matrix. Pixels not in the mask are
+   ignored. */
+template<std::size_t channels> void principalEndpoints(const Float(&pixels)[channels][16], const bool(&mask)[16], Float(&first)[channels], Float(&second)[channels]) {
+    Float mean[channels]{};
+    Int count = 0;
+    for(std::size_t i = 0; i != 16; ++i) {
+        if(!mask[i]) continue;
+        for(std::size_t c = 0; c != channels; ++c) mean[c] += pixels[c][i];
+        ++count;
+    }
+    for(std::size_t c = 0; c != channels; ++c) mean[c] /= Float(count);
+
+    Float covariance[channels][channels]{};
+    for(std::size_t i = 0; i != 16; ++i) {
+        if(!mask[i]) continue;
+        for(std::size_t a = 0; a != channels; ++a)
+            for(std::size_t b = 0; b != channels; ++b)
+                covariance[a][b] += (pixels[a][i] - mean[a])*(pixels[b][i] - mean[b]);
+    }
+
+    /* Start with the column of the most varying channel, so the iteration
+       doesn't start orthogonal to the principal axis */
+    std::size_t largest = 0;
+    for(std::size_t c = 1; c != channels; ++c)
+        if(covariance[c][c] > covariance[largest][largest]) largest = c;
+    Float axis[channels];
+    for(std::size_t c = 0; c != channels; ++c) axis[c] = covariance[c][largest];
+
+    for(Int iteration = 0; iteration != 8; ++iteration) {
+        Float next[channels]{};
+        Float maxComponent = 0.0f;
+        for(std::size_t a = 0; a != channels; ++a) {
+            for(std::size_t b = 0; b != channels; ++b)
+                next[a] += covariance[a][b]*axis[b];
+            maxComponent = std::max(maxComponent, std::abs(next[a]));
+        }
+        if(maxComponent == 0.0f) break;
+        for(std::size_t c = 0; c != channels; ++c) axis[c] = next[c]/maxComponent;
+    }
+
+    Float axisLength = 0.0f;
+    for(std::size_t c = 0; c != channels; ++c) axisLength += axis[c]*axis[c];
+
+    /* Uniform block */
+    if(axisLength < 1.0e-6f) {
+        for(std::size_t c = 0; c != channels; ++c) first[c] = second[c] = mean[c];
+        return;
+    }
+
+    Float min = std::numeric_limits<Float>::max(), max = -min;
+    for(std::size_t i = 0; i != 16; ++i) {
+        if(!mask[i]) continue;
+        Float t = 0.0f;
+        for(std::size_t c = 0; c != channels; ++c) t += (pixels[c][i] - mean[c])*axis[c];
+        min = std::min(min, t);
+        max = std::max(max, t);
+    }
+
+    for(std::size_t c = 0; c != channels; ++c) {
+        first[c] = Math::clamp(mean[c] + axis[c]*max/axisLength, 0.0f, 255.0f);
+        second[c] = Math::clamp(mean[c] + axis[c]*min/axisLength, 0.0f, 255.0f);
+    }
+}
+
+/* Least-squares fit of the endpoints for given indices, `weights[index]` is
+   the weight of the first endpoint. Keeps the endpoints untouched if the
+   system is singular, i.e. all pixels have the same index. */
+template<std::size_t channels> void fitEndpoints(const Float(&pixels)[channels][16], const bool(&mask)[16], const UnsignedByte(&indices)[16], const Float* const weights, Float(&first)[channels], Float(&second)[channels]) {
+    Float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+    Float ax[channels]{}, bx[channels]{};
+    for(std::size_t i = 0; i != 16; ++i) {
+        if(!mask[i]) continue;
+        const Float a = weights[indices[i]], b = 1.0f - a;
+        aa += a*a;
+        ab += a*b;
+        bb += b*b;
+        for(std::size_t c = 0; c != channels; ++c) {
+            ax[c] += a*pixels[c][i];
+            bx[c] += b*pixels[c][i];
+        }
+    }
+
+    const Float determinant = aa*bb - ab*ab;
+    if(std::abs(determinant) < 1.0e-6f) return;
+
+    for(std::size_t c = 0; c != channels; ++c) {
+        first[c] = Math::clamp((ax[c]*bb - bx[c]*ab)/determinant, 0.0f, 255.0f);
+        second[c] = Math::clamp((bx[c]*aa - ax[c]*ab)/determinant, 0.0f, 255.0f);
+    }
+}
+
+/* Finds the nearest of four palette colors for each pixel, returns the total
+   squared error */
+Float nearestIndices(const Float(&pixels)[3][16], const Float(&palette)[4][3], UnsignedByte(&indices)[16]) {
+    #ifdef MAGNUM_TEXTURETOOLS_SSE2
+    __m128 total = _mm_setzero_ps();
+    for(std::size_t i = 0; i != 16; i += 4) {
+        const __m128 r = _mm_loadu_ps(pixels[0] + i);
+        const __m128 g = _mm_loadu_ps(pixels[1] + i);
+        const __m128 b = _mm_loadu_ps(pixels[2] + i);
+
+        __m128 best = _mm_set1_ps(std::numeric_limits<Float>::max());
+        __m128i bestIndex = _mm_setzero_si128();
+        for(Int j = 0; j != 4; ++j) {
+            const __m128 dr = _mm_sub_ps(r, _mm_set1_ps(palette[j][0]));
+            const __m128 dg = _mm_sub_ps(g, _mm_set1_ps(palette[j][1]));
+            const __m128 db = _mm_sub_ps(b, _mm_set1_ps(palette[j][2]));
+            const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)), _mm_mul_ps(db, db));
+            const __m128i closer = _mm_castps_si128(_mm_cmplt_ps(distance, best));
+            best = _mm_min_ps(best, distance);
+            bestIndex = _mm_or_si128(_mm_andnot_si128(closer, bestIndex), _mm_and_si128(closer, _mm_set1_epi32(j)));
+        }
+
+        total = _mm_add_ps(total, best);
+        Int out[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), bestIndex);
+        for(std::size_t k = 0; k != 4; ++k) indices[i + k] = UnsignedByte(out[k]);
+    }
+
+    Float sums[4];
+    _mm_storeu_ps(sums, total);
+    return sums[0] + sums[1] + sums[2] + sums[3];
+    #else
+    Float total = 0.0f;
+    for(std::size_t i = 0; i != 16; ++i) {
+        Float best = std::numeric_limits<Float>::max();
+        for(UnsignedByte j = 0; j != 4; ++j) {
+            Float distance = 0.0f;
+            for(std::size_t c = 0; c != 3; ++c) {
+                const Float d = pixels[c][i] - palette[j][c];
+                distance += d*d;
+            }
+            if(distance < best) {
+                best = distance;
+                indices[i] = j;
+            }
+        }
+        total += best;
+    }
+    return total;
+    #endif
+}
+
+UnsignedShort pack565(const Float(&color)[3]) {
+    const Int r = Math::clamp(Int(color[0]*31.0f/255.0f + 0.5f), 0, 31);
+    const Int g = Math::clamp(Int(color[1]*63.0f/255.0f + 0.5f), 0, 63);
+    const Int b = Math::clamp(Int(color[2]*31.0f/255.0f + 0.5f), 0, 31);
+    return UnsignedShort(r << 11 | g << 5 | b);
+}
+
+void unpack565(const UnsignedShort color, Float(&out)[3]) {
+    const Int r = color >> 11, g = (color >> 5) & 0x3f, b = color & 0x1f;
+    out[0] = Float(r << 3 | r >> 2);
+    out[1] = Float(g << 2 | g >> 4);
+    out[2] = Float(b << 3 | b >> 2);
+}
+
+/* BC1 color block. With punch-through alpha, blocks containing pixels with
+   alpha below 0.5 use the three-color mode with the fourth index being
+   transparent black, otherwise the four-color mode is used. */
+void encodeBc1(const Block& block, const bool punchThrough, UnsignedByte* const out) {
+    bool opaque[16];
+    Int opaqueCount = 0;
+    for(std::size_t i = 0; i != 16; ++i)
+        if((opaque[i] = !punchThrough || block[i][3] >= 128)) ++opaqueCount;
+
+    UnsignedShort first = 0, second = 0;
+    UnsignedByte indices[16];
+
+    /* Fully transparent block */
+    if(!opaqueCount) {
+        std::fill_n(indices, 16, 3);
+
+    } else {
+        /* Transparent pixels get the color of the first opaque pixel so they
+           don't affect the index search */
+        const std::size_t firstOpaque = std::find(opaque, opaque + 16, true) - opaque;
+        Float pixels[3][16];
+        for(std::size_t i = 0; i != 16; ++i)
+            for(std::size_t c = 0; c != 3; ++c)
+                pixels[c][i] = block[opaque[i] ? i : firstOpaque][c];
+
+        const bool threeColor = opaqueCount != 16;
+        const Float weights[]{1.0f, 0.0f, threeColor ? 0.5f : 2.0f/3.0f, 1.0f/3.0f};
+
+        Float firstEndpoint[3], secondEndpoint[3];
+        principalEndpoints(pixels, opaque, firstEndpoint, secondEndpoint);
+
+        /* Alternate between index search and endpoint fit, keep the best */
+        Float bestError = std::numeric_limits<Float>::max();
+        for(Int iteration = 0; iteration != 3; ++iteration) {
+            const UnsignedShort a = pack565(firstEndpoint), b = pack565(secondEndpoint);
+
+            Float palette[4][3];
+            unpack565(a, palette[0]);
+            unpack565(b, palette[1]);
+            for(std::size_t c = 0; c != 3; ++c) {
+                if(threeColor) {
+                    palette[2][c] = (palette[0][c] + palette[1][c])*0.5f;
+                    palette[3][c] = 1.0e9f;
+                } else {
+                    palette[2][c] = (2.0f*palette[0][c] + palette[1][c])/3.0f;
+                    palette[3][c] = (palette[0][c] + 2.0f*palette[1][c])/3.0f;
+                }
+            }
+
+            UnsignedByte candidate[16];
+            const Float error = nearestIndices(pixels, palette, candidate);
+            if(error < bestError) {
+                bestError = error;
+                first = a;
+                second = b;
+                std::copy_n(candidate, 16, indices);
+            }
+
+            fitEndpoints(pixels, opaque, candidate, weights, firstEndpoint, secondEndpoint);
+        }
+
+        for(std::size_t i = 0; i != 16; ++i) if(!opaque[i]) indices[i] = 3;
+
+        /* Four-color mode needs the first endpoint larger, three-color mode
+           not larger. Swapping the endpoints swaps also the indices. */
+        if(first == second) {
+            for(std::size_t i = 0; i != 16; ++i) if(opaque[i]) indices[i] = 0;
+        } else if(threeColor ? first > second : first < second) {
+            std::swap(first, second);
+            for(UnsignedByte& index: indices) {
+                if(index < 2) index ^= 1;
+                else if(!threeColor) index ^= 1;
+            }
+        }
+    }
+
+    UnsignedInt bits = 0;
+    for(std::size_t i = 0; i != 16; ++i) bits |= UnsignedInt(indices[i]) << (2*i);
+    out[0] = UnsignedByte(first);
+    out[1] = UnsignedByte(first >> 8);
+    out[2] = UnsignedByte(second);
+    out[3] = UnsignedByte(second >> 8);
+    for(std::size_t i = 0; i != 4; ++i) out[4 + i] = UnsignedByte(bits >> (8*i));
+}
+
+/* Palette of a BC4 block */
+void bc4Palette(const Int first, const Int second, Float(&palette)[8]) {
+    palette[0] = Float(first);
+    palette[1] = Float(second);
+    if(first > second) {
+        for(Int i = 2; i != 8; ++i)
+            palette[i] = Float((8 - i)*first + (i - 1)*second)/7.0f;
+    } else {
+        for(Int i = 2; i != 6; ++i)
+            palette[i] = Float((6 - i)*first + (i - 1)*second)/5.0f;
+        palette[6] = 0.0f;
+        palette[7] = 255.0f;
+    }
+}
+
+Float bc4Indices(const UnsignedByte(&values)[16], const Float(&palette)[8], UnsignedByte(&indices)[16]) {
+    Float total = 0.0f;
+    for(std::size_t i = 0; i != 16; ++i) {
+        Float best = std::numeric_limits<Float>::max();
+        for(UnsignedByte j = 0; j != 8; ++j) {
+            const Float d = values[i] - palette[j];
+            if(d*d < best) {
+                best = d*d;
+                indices[i] = j;
+            }
+        }
+        total += best;
+    }
+    return total;
+}
+
+/* BC4 single-channel block, used also for BC3 alpha and BC5. Tries both the
+   eight-value mode spanning the whole range and the six-value mode spanning
+   values except 0 and 255, which are then represented exactly. */
+void encodeBc4(const UnsignedByte(&values)[16], UnsignedByte* const out) {
+    Int min = 255, max = 0, innerMin = 255, innerMax = 0;
+    for(const UnsignedByte value: values) {
+        min = std::min<Int>(min, value);
+        max = std::max<Int>(max, value);
+        if(value != 0 && value != 255) {
+            innerMin = std::min<Int>(innerMin, value);
+            innerMax = std::max<Int>(innerMax, value);
+        }
+    }
+    if(innerMin > innerMax) innerMin = innerMax = 0;
+
+    Int first = max, second = min;
+    Float palette[8];
+    UnsignedByte indices[16];
+    bc4Palette(first, second, palette);
+    Float error = bc4Indices(values, palette, indices);
+
+    if(error > 0.0f) {
+        UnsignedByte candidate[16];
+        bc4Palette(innerMin, innerMax, palette);
+        if(bc4Indices(values, palette, candidate) < error) {
+            first = innerMin;
+            second = innerMax;
+            std::copy_n(candidate, 16, indices);
+        }
+    }
+
+    out[0] = UnsignedByte(first);
+    out[1] = UnsignedByte(second);
+    UnsignedLong bits = 0;
+    for(std::size_t i = 0; i != 16; ++i) bits |= UnsignedLong(indices[i]) << (3*i);
+    for(std::size_t i = 0; i != 6; ++i) out[2 + i] = UnsignedByte(bits >> (8*i));
+}
+
+void encodeBc4Channel(const Block& block, const std::size_t channel, UnsignedByte* const out) {
+    UnsignedByte values[16];
+    for(std::size_t i = 0; i != 16; ++i) values[i] = block[i][channel];
+    encodeBc4(values, out);
+}
+
+#ifndef MAGNUM_TARGET_GLES
+/* Writes bits to a zero-initialized little-endian bit stream */
+struct BitWriter {
+    UnsignedByte* data;
+    UnsignedInt position;
+
+    void write(const UnsignedInt value, const UnsignedInt bits) {
+        for(UnsignedInt i = 0; i != bits; ++i, ++position)
+            if(value >> i & 1) data[position/8] |= UnsignedByte(1 << position%8);
+    }
+};
+
+constexpr Int Bc7Weights[]{0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+/* Quantizes a BC7 mode 6 endpoint to seven bits per channel with a shared
+   p-bit, picking the p-bit with lower error */
+void quantizeBc7Endpoint(const Float(&endpoint)[4], UnsignedByte(&quantized)[4], UnsignedByte& pBit) {
+    Float bestError = std::numeric_limits<Float>::max();
+    for(UnsignedByte p = 0; p != 2; ++p) {
+        UnsignedByte candidate[4];
+        Float error = 0.0f;
+        for(std::size_t c = 0; c != 4; ++c) {
+            candidate[c] = UnsignedByte(Math::clamp(Int((endpoint[c] - p)*0.5f + 0.5f), 0, 127));
+            const Float d = Float(candidate[c] << 1 | p) - endpoint[c];
+            error += d*d;
+        }
+        if(error < bestError) {
+            bestError = error;
+            pBit = p;
+            std::copy_n(candidate, 4, quantized);
+        }
+    }
+}
+
+/* BC7 mode 6 block, i.e. one subset with RGBA endpoints and 4-bit indices */
+void encodeBc7(const Block& block, UnsignedByte* const out) {
+    Float pixels[4][16];
+    bool mask[16];
+    for(std::size_t i = 0; i != 16; ++i) {
+        for(std::size_t c = 0; c != 4; ++c) pixels[c][i] = block[i][c];
+        mask[i] = true;
+    }
+
+    Float weights[16];
+    for(std::size_t i = 0; i != 16; ++i) weights[i] = 1.0f - Bc7Weights[i]/64.0f;
+
+    Float firstEndpoint[4], secondEndpoint[4];
+    principalEndpoints(pixels, mask, firstEndpoint, secondEndpoint);
+
+    UnsignedByte endpoints[2][4], pBits[2], indices[16];
+    Float bestError = std::numeric_limits<Float>::max();
+    for(Int iteration = 0; iteration != 3; ++iteration) {
+        UnsignedByte quantized[2][4], p[2];
+        quantizeBc7Endpoint(firstEndpoint, quantized[0], p[0]);
+        quantizeBc7Endpoint(secondEndpoint, quantized[1], p[1]);
+
+        Int a[4], b[4];
+        for(std::size_t c = 0; c != 4; ++c) {
+            a[c] = quantized[0][c] << 1 | p[0];
+            b[c] = quantized[1][c] << 1 | p[1];
+        }
+        Int palette[16][4];
+        for(std::size_t i = 0; i != 16; ++i)
+            for(std::size_t c = 0; c != 4; ++c)
+                palette[i][c] = ((64 - Bc7Weights[i])*a[c] + Bc7Weights[i]*b[c] + 32) >> 6;
+
+        UnsignedByte candidate[16];
+        Float error = 0.0f;
+        for(std::size_t i = 0; i != 16; ++i) {
+            Int best = std::numeric_limits<Int>::max();
+            for(UnsignedByte j = 0; j != 16; ++j) {
+                Int distance = 0;
+                for(std::size_t c = 0; c != 4; ++c) {
+                    const Int d = block[i][c] - palette[j][c];
+                    distance += d*d;
+                }
+                if(distance < best) {
+                    best = distance;
+                    candidate[i] = j;
+                }
+            }
+            error += Float(best);
+        }
+
+        if(error < bestError) {
+            bestError = error;
+            std::copy_n(quantized[0], 4, endpoints[0]);
+            std::copy_n(quantized[1], 4, endpoints[1]);
+            pBits[0] = p[0];
+            pBits[1] = p[1];
+            std::copy_n(candidate, 16, indices);
+        }
+
+        fitEndpoints(pixels, mask, candidate, weights, firstEndpoint, secondEndpoint);
+    }
+
+    /* Most significant bit of the first index is implicitly zero */
+    if(indices[0] & 8) {
+        std::swap(endpoints[0], endpoints[1]);
+        std::swap(pBits[0], pBits[1]);
+        for(UnsignedByte& index: indices) index = 15 - index;
+    }
+
+    std::memset(out, 0, 16);
+    BitWriter writer{out, 0};
+    writer.write(1 << 6, 7);
+    for(std::size_t c = 0; c != 4; ++c) {
+        writer.write(endpoints[0][c], 7);
+        writer.write(endpoints[1][c], 7);
+    }
+    writer.write(pBits[0], 1);
+    writer.write(pBits[1], 1);
+    writer.write(indices[0], 3);
+    for(std::size_t i = 1; i != 16; ++i) writer.write(indices[i], 4);
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+constexpr Int EtcModifiers[8][2]{
+    {2, 8}, {5, 17}, {9, 29}, {13, 42},
+    {18, 60}, {24, 80}, {33, 106}, {47, 183}};
+
+/* Finds the best modifier table and pixel selectors for a subblock with
+   given base color, returns the error */
+Int etcSubblock(const Block& block, const Int(&pixels)[8], const Int(&base)[3], UnsignedByte& table, UnsignedByte(&selectors)[8]) {
+    Int bestError = std::numeric_limits<Int>::max();
+    for(UnsignedByte t = 0; t != 8; ++t) {
+        const Int modifiers[]{EtcModifiers[t][0], EtcModifiers[t][1], -EtcModifiers[t][0], -EtcModifiers[t][1]};
+
+        Int error = 0;
+        UnsignedByte candidate[8];
+        for(std::size_t i = 0; i != 8; ++i) {
+            Int best = std::numeric_limits<Int>::max();
+            for(UnsignedByte s = 0; s != 4; ++s) {
+                Int distance = 0;
+                for(std::size_t c = 0; c != 3; ++c) {
+                    const Int d = block[pixels[i]][c] - Math::clamp(base[c] + modifiers[s], 0, 255);
+                    distance += d*d;
+                }
+                if(distance < best) {
+                    best = distance;
+                    candidate[i] = s;
+                }
+            }
+            error += best;
+        }
+
+        if(error < bestError) {
+            bestError = error;
+            table = t;
+            std::copy_n(candidate, 8, selectors);
+        }
+    }
+
+    return bestError;
+}
+
+/* ETC1 block in individual or differential mode, which is a valid ETC2 RGB
+   block as long as the differential mode doesn't overflow */
+void encodeEtc(const Block& block, UnsignedByte* const out) {
+    UnsignedInt bestHigh = 0, bestLow = 0;
+    Int bestError = std::numeric_limits<Int>::max();
+
+    for(UnsignedInt flip = 0; flip != 2; ++flip) {
+        /* Left and right 2x4 halves or top and bottom 4x2 halves */
+        Int pixels[2][8];
+        Float average[2][3]{};
+        for(Int y = 0; y != 4; ++y) for(Int x = 0; x != 4; ++x) {
+            const Int subblock = flip ? y/2 : x/2;
+            const Int position = flip ? (y%2)*4 + x : y*2 + x%2;
+            pixels[subblock][position] = y*4 + x;
+            for(std::size_t c = 0; c != 3; ++c)
+                average[subblock][c] += block[y*4 + x][c]/8.0f;
+        }
+
+        for(UnsignedInt differential = 0; differential != 2; ++differential) {
+            Int quantized[2][3], base[2][3];
+            for(std::size_t c = 0; c != 3; ++c) {
+                if(differential) {
+                    /* Clamping the difference keeps the second color between
+                       the first and the ideal one, so it never overflows */
+                    quantized[0][c] = Math::clamp(Int(average[0][c]*31.0f/255.0f + 0.5f), 0, 31);
+                    const Int ideal = Math::clamp(Int(average[1][c]*31.0f/255.0f + 0.5f), 0, 31);
+                    quantized[1][c] = quantized[0][c] + Math::clamp(ideal - quantized[0][c], -4, 3);
+                    for(std::size_t s = 0; s != 2; ++s)
+                        base[s][c] = quantized[s][c] << 3 | quantized[s][c] >> 2;
+                } else for(std::size_t s = 0; s != 2; ++s) {
+                    quantized[s][c] = Math::clamp(Int(average[s][c]*15.0f/255.0f + 0.5f), 0, 15);
+                    base[s][c] = quantized[s][c] << 4 | quantized[s][c];
+                }
+            }
+
+            UnsignedByte tables[2], selectors[2][8];
+            const Int error = etcSubblock(block, pixels[0], base[0], tables[0], selectors[0]) +
+                etcSubblock(block, pixels[1], base[1], tables[1], selectors[1]);
+            if(error >= bestError) continue;
+            bestError = error;
+
+            bestHigh = tables[0] << 5 | tables[1] << 2 | differential << 1 | flip;
+            for(std::size_t c = 0; c != 3; ++c) {
+                const UnsignedInt shift = 27 - c*8;
+                if(differential)
+                    bestHigh |= UnsignedInt(quantized[0][c]) << shift | UnsignedInt((quantized[1][c] - quantized[0][c]) & 7) << (shift - 3);
+                else
+                    bestHigh |= UnsignedInt(quantized[0][c]) << (shift + 1) | UnsignedInt(quantized[1][c]) << (shift - 3);
+            }
+
+            /* Selector bits are in column-major order, most significant bits
+               in the upper half */
+            bestLow = 0;
+            for(std::size_t s = 0; s != 2; ++s) for(std::size_t i = 0; i != 8; ++i) {
+                const Int pixel = pixels[s][i];
+                const UnsignedInt position = (pixel%4)*4 + pixel/4;
+                bestLow |= UnsignedInt(selectors[s][i] >> 1) << (position + 16) | UnsignedInt(selectors[s][i] & 1) << position;
+            }
+        }
+    }
+
+    for(std::size_t i = 0; i != 4; ++i) {
+        out[i] = UnsignedByte(bestHigh >> (24 - 8*i));
+        out[4 + i] = UnsignedByte(bestLow >> (24 - 8*i));
+    }
+}
+#endif
+
+void encodeBlock(const CompressedColorFormat format, const Block& block, UnsignedByte* const out) {
+    switch(format) {
+        case CompressedColorFormat::RGBS3tcDxt1:
+            encodeBc1(block, false, out);
+            return;
+        case CompressedColorFormat::RGBAS3tcDxt1:
+            encodeBc1(block, true, out);
+            return;
+        case CompressedColorFormat::RGBAS3tcDxt5:
+            encodeBc4Channel(block, 3, out);
+            encodeBc1(block, false, out + 8);
+            return;
+        #ifndef MAGNUM_TARGET_GLES
+        case CompressedColorFormat::RedRgtc1:
+            encodeBc4Channel(block, 0, out);
+            return;
+        case CompressedColorFormat::RGRgtc2:
+            encodeBc4Channel(block, 0, out);
+            encodeBc4Channel(block, 1, out + 8);
+            return;
+        case CompressedColorFormat::RGBABptcUnorm:
+        case CompressedColorFormat::SRGBAlphaBptcUnorm:
+            encodeBc7(block, out);
+            return;
+        #endif
+        #ifndef MAGNUM_TARGET_GLES2
+        case CompressedColorFormat::RGB8Etc2:
+        case CompressedColorFormat::SRGB8Etc2:
+            encodeEtc(block, out);
+            return;
+        #endif
+        default: CORRADE_ASSERT_UNREACHABLE();
+    }
+}
+
+}
+
+bool isCompressionSupported(const CompressedColorFormat format) {
+    return blockSize(format) != 0;
+}
+
+bool isCompressionSupported(const ColorFormat format, const ColorType type) {
+    Implementation::Layout layout;
+    return type == ColorType::UnsignedByte && Implementation::layout(format, layout);
+}
+
+std::size_t compressedDataSize(const CompressedColorFormat format, const Vector2i& size) {
+    const std::size_t size_ = blockSize(format);
+    CORRADE_ASSERT(size_, "TextureTools::compressedDataSize(): unsupported format" << format, 0);
+    return ((size.x() + 3)/4)*((size.y() + 3)/4)*size_;
+}
+
+void compress(const ImageReference2D& image, const CompressedColorFormat format, char* const output, TaskScheduler& scheduler) {
+    Implementation::Layout layout;
+    CORRADE_ASSERT(image.type() == ColorType::UnsignedByte && Implementation::layout(image.format(), layout),
+        "TextureTools::compress(): unsupported image format" << image.format() << image.type(), );
+    const std::size_t size = blockSize(format);
+    CORRADE_ASSERT(size,
+        "TextureTools::compress(): unsupported compressed format" << format, );
+
+    const Vector2i blockCount = (image.size() + Vector2i{3})/4;
+    const std::size_t stride = Implementation::rowStride(image.size().x(), layout.channels);
+    scheduler.parallelFor(blockCount.y(), 1, [&](const std::size_t begin, const std::size_t end) {
+        Block block;
+        for(std::size_t y = begin; y != end; ++y) for(Int x = 0; x != blockCount.x(); ++x) {
+            loadBlock(image, layout, stride, x, Int(y), block);
+            encodeBlock(format, block, reinterpret_cast<UnsignedByte*>(output) + (y*blockCount.x() + x)*size);
+        }
+    });
+}
+
+Trade::CompressedImageData2D compress(const ImageReference2D& image, const CompressedColorFormat format, TaskScheduler& scheduler) {
+    Containers::Array<char> data{compressedDataSize(format, image.size())};
+    compress(image, format, data, scheduler);
+    return Trade::CompressedImageData2D{format, image.size(), std::move(data)};
+}
+
+}}
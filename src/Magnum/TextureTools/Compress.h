@@ -0,0 +1,115 @@
+#ifndef Magnum_TextureTools_Compress_h
+#define Magnum_TextureTools_Compress_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::compress(), @ref Magnum::TextureTools::isCompressionSupported(), @ref Magnum::TextureTools::compressedDataSize()
+ */
+
+#include "Magnum/ImageReference.h"
+#include "Magnum/TaskScheduler.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Whether given format can be produced by @ref compress()
+
+Returns `true` for @ref CompressedColorFormat::RGBS3tcDxt1,
+@ref CompressedColorFormat::RGBAS3tcDxt1, @ref CompressedColorFormat::RGBAS3tcDxt5,
+@ref CompressedColorFormat::RedRgtc1, @ref CompressedColorFormat::RGRgtc2,
+@ref CompressedColorFormat::RGBABptcUnorm, @ref CompressedColorFormat::SRGBAlphaBptcUnorm,
+@ref CompressedColorFormat::RGB8Etc2 and @ref CompressedColorFormat::SRGB8Etc2,
+`false` otherwise.
+*/
+bool MAGNUM_TEXTURETOOLS_EXPORT isCompressionSupported(CompressedColorFormat format);
+
+/**
+@brief Whether an image of given format and type can be passed to @ref compress()
+
+Returns `true` if @p type is @ref ColorType::UnsignedByte and @p format is
+one of the formats supported by @ref convertPixels(), `false` otherwise.
+*/
+bool MAGNUM_TEXTURETOOLS_EXPORT isCompressionSupported(ColorFormat format, ColorType type);
+
+/**
+@brief Size of compressed image data
+
+Size of blocks covering the whole image, in row-major order. Expects that
+@p format is supported by @ref compress().
+*/
+std::size_t MAGNUM_TEXTURETOOLS_EXPORT compressedDataSize(CompressedColorFormat format, const Vector2i& size);
+
+/**
+@brief Compress an image into given memory
+@param image        Input image
+@param format       Output compressed format
+@param output       Output memory
+@param scheduler    Task scheduler to split the work on
+
+The image is expected to have @ref ColorType::UnsignedByte type and one of
+the formats supported by @ref convertPixels(), missing color channels are
+treated as `0`, missing alpha as `1`. Edge blocks of images with size not
+divisible by four are padded by repeating the last row and column. The
+output is expected to be at least @ref compressedDataSize() bytes large.
+
+The blocks are encoded with a fast single-pass encoder aimed at asset
+pipelines --- endpoints are found along the principal axis of the block
+colors and refined with a least-squares fit, with the index search done with
+SSE2 instructions, if available on the target:
+
+-   @ref CompressedColorFormat::RGBS3tcDxt1 (BC1) uses four-color blocks,
+    @ref CompressedColorFormat::RGBAS3tcDxt1 switches to three-color blocks
+    with punch-through alpha for blocks having alpha below `0.5`.
+-   @ref CompressedColorFormat::RGBAS3tcDxt5 (BC3),
+    @ref CompressedColorFormat::RedRgtc1 (BC4) and
+    @ref CompressedColorFormat::RGRgtc2 (BC5) encode single-channel blocks
+    using whichever of the eight-value and six-value modes is more precise.
+-   @ref CompressedColorFormat::RGBABptcUnorm and
+    @ref CompressedColorFormat::SRGBAlphaBptcUnorm (BC7) use mode 6, i.e.
+    a single RGBA endpoint pair with 4-bit indices.
+-   @ref CompressedColorFormat::RGB8Etc2 and @ref CompressedColorFormat::SRGB8Etc2
+    use the individual and differential modes shared with ETC1.
+
+The sRGB variants are encoded directly from the sRGB-encoded input. Rows of
+blocks are split among threads of @p scheduler, the result is the same
+regardless of thread count.
+@see @ref isCompressionSupported(),
+    @ref Trade::AbstractImageConverter::exportToCompressedImage()
+*/
+void MAGNUM_TEXTURETOOLS_EXPORT compress(const ImageReference2D& image, CompressedColorFormat format, char* output, TaskScheduler& scheduler = TaskScheduler::global());
+
+/**
+@brief Compress an image
+
+Allocates the output and calls @ref compress(const ImageReference2D&, CompressedColorFormat, char*, TaskScheduler&).
+*/
+Trade::CompressedImageData2D MAGNUM_TEXTURETOOLS_EXPORT compress(const ImageReference2D& image, CompressedColorFormat format, TaskScheduler& scheduler = TaskScheduler::global());
+
+}}
+
+#endif
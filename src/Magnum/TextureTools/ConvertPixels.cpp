@@ -0,0 +1,299 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ConvertPixels.h"
+
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Implementation/Simd.h"
+#include "Magnum/TaskScheduler.h"
+#include "Magnum/TextureTools/Implementation/PixelLayout.h"
+#include "Magnum/TextureTools/Implementation/Srgb.h"
+
+#if defined(MAGNUM_MATH_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MAGNUM_TEXTURETOOLS_SSE2
+#include <emmintrin.h>
+#ifdef __SSSE3__
+#define MAGNUM_TEXTURETOOLS_SSSE3
+#include <tmmintrin.h>
+#endif
+#endif
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+using Implementation::Layout;
+using Implementation::layout;
+using Implementation::rowStride;
+
+/* Rounded x/255 for x up to 255*255, exact for all products of two bytes */
+inline UnsignedByte divide255(const UnsignedInt x) {
+    const UnsignedInt y = x + 128;
+    return UnsignedByte((y + (y >> 8)) >> 8);
+}
+
+/* Swaps first and third byte of four-byte pixels, returns count of processed
+   pixels, the rest is done by the scalar loop */
+std::size_t swizzleRowRB4(const UnsignedByte* const in, UnsignedByte* const out, const std::size_t width) {
+    std::size_t x = 0;
+    #if defined(MAGNUM_TEXTURETOOLS_SSE2)
+    const __m128i greenAlpha = _mm_set1_epi32(Int(0xff00ff00));
+    for(; x + 4 <= width; x += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + x*4));
+        const __m128i redBlue = _mm_andnot_si128(greenAlpha, v);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x*4), _mm_or_si128(_mm_and_si128(v, greenAlpha),
+            _mm_or_si128(_mm_srli_epi32(redBlue, 16), _mm_slli_epi32(redBlue, 16))));
+    }
+    #elif defined(MAGNUM_MATH_NEON)
+    for(; x + 16 <= width; x += 16) {
+        uint8x16x4_t v = vld4q_u8(in + x*4);
+        const uint8x16_t red = v.val[0];
+        v.val[0] = v.val[2];
+        v.val[2] = red;
+        vst4q_u8(out + x*4, v);
+    }
+    #else
+    static_cast<void>(in);
+    static_cast<void>(out);
+    static_cast<void>(width);
+    #endif
+    return x;
+}
+
+/* Expands three-byte pixels to four-byte with alpha set to 255, returns count
+   of processed pixels */
+std::size_t expandRow34(const UnsignedByte* const in, UnsignedByte* const out, const std::size_t width) {
+    std::size_t x = 0;
+    #if defined(MAGNUM_TEXTURETOOLS_SSSE3)
+    /* Loads sixteen bytes for four pixels, so stop early enough to not read
+       past the row end */
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alpha = _mm_set1_epi32(Int(0xff000000));
+    for(; x + 6 <= width; x += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + x*3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x*4), _mm_or_si128(_mm_shuffle_epi8(v, shuffle), alpha));
+    }
+    #elif defined(MAGNUM_MATH_NEON)
+    for(; x + 16 <= width; x += 16) {
+        const uint8x16x3_t v = vld3q_u8(in + x*3);
+        uint8x16x4_t result;
+        result.val[0] = v.val[0];
+        result.val[1] = v.val[1];
+        result.val[2] = v.val[2];
+        result.val[3] = vdupq_n_u8(255);
+        vst4q_u8(out + x*4, result);
+    }
+    #else
+    static_cast<void>(in);
+    static_cast<void>(out);
+    static_cast<void>(width);
+    #endif
+    return x;
+}
+
+#ifdef MAGNUM_TEXTURETOOLS_SSE2
+/* Two pixels in 16-bit lanes, alpha is multiplied by 255 so it stays
+   unchanged */
+inline __m128i premultiply2(const __m128i pixels) {
+    const __m128i colorMask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i alphaMax = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    const __m128i alpha = _mm_or_si128(_mm_and_si128(
+        _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3)),
+        colorMask), alphaMax);
+    const __m128i y = _mm_add_epi16(_mm_mullo_epi16(pixels, alpha), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(y, _mm_srli_epi16(y, 8)), 8);
+}
+#elif defined(MAGNUM_MATH_NEON)
+inline uint8x8_t premultiply8(const uint8x8_t color, const uint8x8_t alpha) {
+    const uint16x8_t x = vmull_u8(color, alpha);
+    return vrshrn_n_u16(vrsraq_n_u16(x, x, 8), 8);
+}
+#endif
+
+/* Multiplies color of four-byte pixels with alpha in the last byte in place,
+   returns count of processed pixels. Gives the same results as divide255(). */
+std::size_t premultiplyRow4(UnsignedByte* const data, const std::size_t width) {
+    std::size_t x = 0;
+    #if defined(MAGNUM_TEXTURETOOLS_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for(; x + 4 <= width; x += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + x*4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + x*4), _mm_packus_epi16(
+            premultiply2(_mm_unpacklo_epi8(v, zero)),
+            premultiply2(_mm_unpackhi_epi8(v, zero))));
+    }
+    #elif defined(MAGNUM_MATH_NEON)
+    for(; x + 16 <= width; x += 16) {
+        uint8x16x4_t v = vld4q_u8(data + x*4);
+        for(std::size_t c = 0; c != 3; ++c)
+            v.val[c] = vcombine_u8(
+                premultiply8(vget_low_u8(v.val[c]), vget_low_u8(v.val[3])),
+                premultiply8(vget_high_u8(v.val[c]), vget_high_u8(v.val[3])));
+        vst4q_u8(data + x*4, v);
+    }
+    #else
+    static_cast<void>(data);
+    static_cast<void>(width);
+    #endif
+    return x;
+}
+
+/* If the tables are not null, color values are converted from or to sRGB */
+template<class T> Float load(T value, const Implementation::SrgbTables* tables);
+template<> inline Float load(const UnsignedByte value, const Implementation::SrgbTables* const tables) {
+    return tables ? tables->toLinear[value] : value/255.0f;
+}
+template<> inline Float load(const Float value, const Implementation::SrgbTables* const tables) {
+    return tables ? Implementation::srgbToLinear(value) : value;
+}
+
+template<class T> T store(Float value, const Implementation::SrgbTables* tables);
+template<> inline UnsignedByte store(const Float value, const Implementation::SrgbTables* const tables) {
+    return tables ? tables->encode(value) : UnsignedByte(Math::clamp(value, 0.0f, 1.0f)*255.0f + 0.5f);
+}
+template<> inline Float store(const Float value, const Implementation::SrgbTables* const tables) {
+    return tables ? Implementation::linearToSrgb(value) : value;
+}
+
+/* Generic conversion of one row. All channels of a pixel are loaded before
+   any is stored, so it works in place if the pixel sizes are the same. */
+template<class In, class Out> void convertRowGeneric(const char* const inRow, const Layout& inLayout, char* const outRow, const Layout& outLayout, const std::size_t width, const PixelConversions conversions) {
+    const In* const in = reinterpret_cast<const In*>(inRow);
+    Out* const out = reinterpret_cast<Out*>(outRow);
+    const Implementation::SrgbTables* const toLinear = conversions & PixelConversion::SrgbToLinear ? &Implementation::srgbTables() : nullptr;
+    const Implementation::SrgbTables* const toSrgb = conversions & PixelConversion::LinearToSrgb ? &Implementation::srgbTables() : nullptr;
+    const bool premultiply = !!(conversions & PixelConversion::Premultiply);
+
+    for(std::size_t x = 0; x != width; ++x) {
+        const In* const inPixel = in + x*inLayout.channels;
+        Float rgba[4];
+        for(std::size_t c = 0; c != 4; ++c) {
+            const Int index = inLayout.index[c];
+            if(index == -1) rgba[c] = c == 3 ? 1.0f : 0.0f;
+            else rgba[c] = load<In>(inPixel[index], c != 3 ? toLinear : nullptr);
+        }
+
+        if(premultiply) for(std::size_t c = 0; c != 3; ++c)
+            rgba[c] *= rgba[3];
+
+        Out* const outPixel = out + x*outLayout.channels;
+        for(std::size_t c = 0; c != 4; ++c) {
+            const Int index = outLayout.index[c];
+            /* Luminance is stored from the red channel */
+            if(index == -1 || (c != 0 && index == outLayout.index[0])) continue;
+            outPixel[index] = store<Out>(rgba[c], c != 3 ? toSrgb : nullptr);
+        }
+    }
+}
+
+}
+
+void convertPixels(const ImageReference2D& image, const ColorFormat format, const ColorType type, char* const output, const PixelConversions conversions, const UnsignedInt threadCount) {
+    Layout inLayout, outLayout;
+    CORRADE_ASSERT(layout(image.format(), inLayout) && (image.type() == ColorType::UnsignedByte || image.type() == ColorType::Float),
+        "TextureTools::convertPixels(): unsupported input format" << image.format() << image.type(), );
+    CORRADE_ASSERT(layout(format, outLayout) && (type == ColorType::UnsignedByte || type == ColorType::Float),
+        "TextureTools::convertPixels(): unsupported output format" << format << type, );
+    CORRADE_ASSERT(threadCount,
+        "TextureTools::convertPixels(): expected at least one thread", );
+
+    const std::size_t inPixelSize = image.pixelSize();
+    const std::size_t outPixelSize = AbstractImage::pixelSize(format, type);
+    CORRADE_ASSERT(image.data() != output || inPixelSize == outPixelSize,
+        "TextureTools::convertPixels(): in-place conversion requires the same pixel size", );
+
+    const std::size_t width = image.size().x();
+    const std::size_t inStride = rowStride(image.size().x(), inPixelSize);
+    const std::size_t outStride = rowStride(image.size().x(), outPixelSize);
+    const bool bytes = image.type() == ColorType::UnsignedByte && type == ColorType::UnsignedByte;
+    const bool premultiply = !!(conversions & PixelConversion::Premultiply);
+    const bool srgb = !!(conversions & (PixelConversion::SrgbToLinear|PixelConversion::LinearToSrgb));
+    const bool sameFormat = image.format() == format;
+
+    /* Four-byte pixels with possibly swapped red and blue */
+    const bool fast4 = bytes && !srgb && inLayout.channels == 4 && outLayout.channels == 4;
+    const bool swizzle = fast4 && inLayout.index[0] != outLayout.index[0];
+
+    /* Three-byte pixels expanded to four-byte in the same channel order.
+       Alpha is 1 so premultiplication doesn't change anything. */
+    const bool expand = bytes && !srgb && inLayout.channels == 3 && outLayout.channels == 4 && inLayout.index[0] == outLayout.index[0];
+
+    /* Plain copy */
+    const bool copy = sameFormat && image.type() == type && !srgb && !premultiply;
+
+    TaskScheduler::global().parallelFor(image.size().y(), (image.size().y() + threadCount - 1)/threadCount, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t y = begin; y != end; ++y) {
+            const char* const in = image.data() + y*inStride;
+            char* const out = output + y*outStride;
+
+            if(copy) {
+                if(in != out) std::memcpy(out, in, width*inPixelSize);
+
+            } else if(fast4) {
+                const auto inBytes = reinterpret_cast<const UnsignedByte*>(in);
+                const auto outBytes = reinterpret_cast<UnsignedByte*>(out);
+                if(swizzle) {
+                    for(std::size_t x = swizzleRowRB4(inBytes, outBytes, width); x != width; ++x) {
+                        const UnsignedByte pixel[]{inBytes[x*4 + 2], inBytes[x*4 + 1], inBytes[x*4], inBytes[x*4 + 3]};
+                        std::memcpy(outBytes + x*4, pixel, 4);
+                    }
+                } else if(in != out) std::memcpy(out, in, width*4);
+
+                if(premultiply) for(std::size_t x = premultiplyRow4(outBytes, width); x != width; ++x)
+                    for(std::size_t c = 0; c != 3; ++c)
+                        outBytes[x*4 + c] = divide255(outBytes[x*4 + c]*outBytes[x*4 + 3]);
+
+            } else if(expand) {
+                const auto inBytes = reinterpret_cast<const UnsignedByte*>(in);
+                const auto outBytes = reinterpret_cast<UnsignedByte*>(out);
+                for(std::size_t x = expandRow34(inBytes, outBytes, width); x != width; ++x) {
+                    const UnsignedByte pixel[]{inBytes[x*3], inBytes[x*3 + 1], inBytes[x*3 + 2], 255};
+                    std::memcpy(outBytes + x*4, pixel, 4);
+                }
+
+            } else if(image.type() == ColorType::UnsignedByte) {
+                if(type == ColorType::UnsignedByte)
+                    convertRowGeneric<UnsignedByte, UnsignedByte>(in, inLayout, out, outLayout, width, conversions);
+                else convertRowGeneric<UnsignedByte, Float>(in, inLayout, out, outLayout, width, conversions);
+            } else {
+                if(type == ColorType::UnsignedByte)
+                    convertRowGeneric<Float, UnsignedByte>(in, inLayout, out, outLayout, width, conversions);
+                else convertRowGeneric<Float, Float>(in, inLayout, out, outLayout, width, conversions);
+            }
+        }
+    });
+}
+
+Image2D convertPixels(const ImageReference2D& image, const ColorFormat format, const ColorType type, const PixelConversions conversions, const UnsignedInt threadCount) {
+    Image2D output{format, type, image.size(), new char[rowStride(image.size().x(), AbstractImage::pixelSize(format, type))*image.size().y()]};
+    convertPixels(image, format, type, output.data(), conversions, threadCount);
+    return output;
+}
+
+}}
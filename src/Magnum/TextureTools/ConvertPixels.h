@@ -0,0 +1,115 @@
+#ifndef Magnum_TextureTools_ConvertPixels_h
+#define Magnum_TextureTools_ConvertPixels_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::convertPixels(), enum @ref Magnum::TextureTools::PixelConversion, enum set @ref Magnum::TextureTools::PixelConversions
+ */
+
+#include <Corrade/Containers/EnumSet.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Pixel value conversion
+
+@see @ref PixelConversions, @ref convertPixels()
+*/
+enum class PixelConversion: UnsignedByte {
+    /**
+     * Decode sRGB-encoded color channels to linear space. Done before
+     * @ref PixelConversion::Premultiply.
+     */
+    SrgbToLinear = 1 << 0,
+
+    /** Multiply color channels with alpha */
+    Premultiply = 1 << 1,
+
+    /**
+     * Encode linear color channels to sRGB. Done after
+     * @ref PixelConversion::Premultiply.
+     */
+    LinearToSrgb = 1 << 2
+};
+
+/**
+@brief Pixel value conversions
+
+@see @ref convertPixels()
+*/
+typedef Containers::EnumSet<PixelConversion> PixelConversions;
+
+CORRADE_ENUMSET_OPERATORS(PixelConversions)
+
+/**
+@brief Convert pixels to another format into given memory
+@param image        Input image
+@param format       Output color format
+@param type         Output color type
+@param output       Output memory
+@param conversions  Value conversions to perform
+@param threadCount  Count of parts to split the work into
+
+Converts between @ref ColorFormat::Red, @ref ColorFormat::RG,
+@ref ColorFormat::RGB, @ref ColorFormat::RGBA, @ref ColorFormat::BGR,
+@ref ColorFormat::BGRA (and @ref ColorFormat::Luminance,
+@ref ColorFormat::LuminanceAlpha on OpenGL ES 2.0) in either
+@ref ColorType::UnsignedByte or @ref ColorType::Float. Missing color
+channels are set to `0` (or replicated from luminance), missing alpha to
+`1`. Unsigned byte values are normalized to @f$ [0, 1] @f$ when converting to
+floats and clamped when converting back. Alpha channel is never affected by
+sRGB conversion.
+
+The output is expected to be large enough to contain the image in given
+format, i.e. @ref AbstractImage::dataSize() "Image2D::dataSize()" bytes with
+rows aligned to four bytes, which makes it possible to convert directly into
+mapped buffer memory, e.g. for a subsequent upload using
+@ref BufferImage2D. If the input and output pixel sizes are the same,
+@p output can be the same as @p image data and the conversion is done in
+place.
+
+RGBA/BGRA swizzle and premultiplication of four-channel unsigned byte images
+are done with SSE2 or NEON instructions and RGB to RGBA expansion with SSSE3
+or NEON instructions, if available on the target. Everything else is done by
+a generic scalar loop. If @p threadCount is larger than `1`, the rows are
+split into equally large ranges processed in parallel on
+@ref TaskScheduler::global().
+*/
+void MAGNUM_TEXTURETOOLS_EXPORT convertPixels(const ImageReference2D& image, ColorFormat format, ColorType type, char* output, PixelConversions conversions = {}, UnsignedInt threadCount = 1);
+
+/**
+@brief Convert pixels to another format
+
+Allocates the output image and calls @ref convertPixels(const ImageReference2D&, ColorFormat, ColorType, char*, PixelConversions, UnsignedInt).
+*/
+Image2D MAGNUM_TEXTURETOOLS_EXPORT convertPixels(const ImageReference2D& image, ColorFormat format, ColorType type, PixelConversions conversions = {}, UnsignedInt threadCount = 1);
+
+}}
+
+#endif
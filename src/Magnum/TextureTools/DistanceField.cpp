@@ -25,8 +25,12 @@
 
 #include "DistanceField.h"
 
+#include <cmath>
+#include <vector>
 #include <Corrade/Utility/Resource.h>
 
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/AbstractShaderProgram.h"
 #include "Magnum/Buffer.h"
@@ -35,6 +39,7 @@
 #include "Magnum/Framebuffer.h"
 #include "Magnum/Mesh.h"
 #include "Magnum/Shader.h"
+#include "Magnum/TaskScheduler.h"
 #include "Magnum/Texture.h"
 #include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
 
@@ -134,26 +139,60 @@ DistanceFieldShader::DistanceFieldShader(): radiusUniform(0), scalingUniform(1)
 }
 
 }
-#ifndef MAGNUM_TARGET_GLES
-void distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangle, const Int radius, const Vector2i&)
-#else
-void distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangle, const Int radius, const Vector2i& imageSize)
-#endif
-{
+struct DistanceField::State {
+    explicit State();
+
+    DistanceFieldShader shader;
+    Framebuffer framebuffer;
+    Mesh mesh;
+    Buffer buffer;
+};
+
+DistanceField::State::State(): framebuffer{Range2Di{}} {
+    mesh.setPrimitive(MeshPrimitive::Triangles)
+        .setCount(3);
+
+    /* Older GLSL doesn't have gl_VertexID, vertices must be supplied explicitly */
     #ifndef MAGNUM_TARGET_GLES
-    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::framebuffer_object);
+    if(!Context::current()->isVersionSupported(Version::GL300))
+    #else
+    if(!Context::current()->isVersionSupported(Version::GLES300))
     #endif
+    {
+        constexpr Vector2 triangle[] = {
+            Vector2(-1.0,  1.0),
+            Vector2(-1.0, -3.0),
+            Vector2( 3.0,  1.0)
+        };
+        buffer.setData(triangle, BufferUsage::StaticDraw);
+        mesh.addVertexBuffer(buffer, 0, DistanceFieldShader::Position());
+    }
+}
 
-    /** @todo Disable depth test, blending and then enable it back (if was previously) */
-
+DistanceField::DistanceField(const Int radius): _radius{radius} {
     #ifndef MAGNUM_TARGET_GLES
-    Vector2i imageSize = input.imageSize(0);
+    MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::framebuffer_object);
     #endif
 
-    Framebuffer framebuffer(rectangle);
-    framebuffer.attachTexture(Framebuffer::ColorAttachment(0), output, 0);
+    _state.reset(new State);
+    _state->shader.setRadius(radius);
+}
+
+DistanceField::DistanceField(DistanceField&&) noexcept = default;
+
+DistanceField::~DistanceField() = default;
+
+DistanceField& DistanceField::operator=(DistanceField&&) noexcept = default;
+
+void DistanceField::operator()(Texture2D& input, Texture2D& output, const Range2Di& rectangle, const Vector2i& imageSize, const Vector2i& outputSize) {
+    /** @todo Disable depth test, blending and then enable it back (if was previously) */
+
+    /* The output texture may be a different one each time, so it's always
+       attached again. That's cheap compared to creating the framebuffer. */
+    Framebuffer& framebuffer = _state->framebuffer;
+    framebuffer.attachTexture(Framebuffer::ColorAttachment(0), output, 0)
+        .setViewport(rectangle);
     framebuffer.bind(FramebufferTarget::Draw);
-    framebuffer.clear(FramebufferClear::Color);
 
     const Framebuffer::Status status = framebuffer.checkStatus(FramebufferTarget::Draw);
     if(status != Framebuffer::Status::Complete) {
@@ -162,9 +201,8 @@ void distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangl
         return;
     }
 
-    DistanceFieldShader shader;
-    shader.setRadius(radius)
-        .setScaling(Vector2(imageSize)/Vector2(rectangle.size()))
+    DistanceFieldShader& shader = _state->shader;
+    shader.setScaling(Vector2(imageSize)/Vector2(outputSize))
         .setTexture(input);
 
     #ifndef MAGNUM_TARGET_GLES
@@ -176,29 +214,280 @@ void distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangl
         shader.setImageSizeInverted(1.0f/Vector2(imageSize));
     }
 
-    Mesh mesh;
-    mesh.setPrimitive(MeshPrimitive::Triangles)
-        .setCount(3);
+    /* Draw the mesh */
+    _state->mesh.draw(shader);
+}
 
-    /* Older GLSL doesn't have gl_VertexID, vertices must be supplied explicitly */
-    Buffer buffer;
+#ifndef MAGNUM_TARGET_GLES
+void distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangle, const Int radius, const Vector2i&)
+#else
+void distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangle, const Int radius, const Vector2i& imageSize)
+#endif
+{
     #ifndef MAGNUM_TARGET_GLES
-    if(!Context::current()->isVersionSupported(Version::GL300))
-    #else
-    if(!Context::current()->isVersionSupported(Version::GLES300))
+    const Vector2i imageSize = input.imageSize(0);
     #endif
-    {
-        constexpr Vector2 triangle[] = {
-            Vector2(-1.0,  1.0),
-            Vector2(-1.0, -3.0),
-            Vector2( 3.0,  1.0)
-        };
-        buffer.setData(triangle, BufferUsage::StaticDraw);
-        mesh.addVertexBuffer(buffer, 0, DistanceFieldShader::Position());
+
+    /* The input covers only the rectangle */
+    DistanceField{radius}(input, output, rectangle, imageSize, rectangle.size());
+}
+
+namespace {
+
+/* Squared distances along one row, evaluated only at sampled positions.
+   Lower envelope of parabolas rooted at each position with height f[q], see
+   the Felzenszwalb paper. All values are finite as the distances are clamped
+   to radius+1 beforehand. */
+void distanceTransformRow(const Int* const f, const Int size, const Int* const samples, const Int sampleCount, Int* const v, Float* const z, Float* const output) {
+    Int k = 0;
+    v[0] = 0;
+    z[0] = -Constants::inf();
+    z[1] = Constants::inf();
+    for(Int q = 1; q != size; ++q) {
+        /* Remove parabolas hidden by the new one. The first one is never
+           removed as z[0] is infinity. */
+        Float s;
+        for(;;) {
+            const Int p = v[k];
+            s = Float((f[q] + q*q) - (f[p] + p*p))/Float(2*(q - p));
+            if(s > z[k]) break;
+            --k;
+        }
+
+        ++k;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = Constants::inf();
     }
 
-    /* Draw the mesh */
-    mesh.draw(shader);
+    k = 0;
+    for(Int i = 0; i != sampleCount; ++i) {
+        const Int x = samples[i];
+        while(z[k + 1] < x) ++k;
+        output[i] = Float((x - v[k])*(x - v[k]) + f[v[k]]);
+    }
+}
+
+}
+
+Image2D distanceField(const ImageReference2D& input, const Vector2i& outputSize, const Int radius, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(input.type() == ColorType::UnsignedByte,
+        "TextureTools::distanceField(): expected image with" << ColorType::UnsignedByte << "components but got" << input.type(), (Image2D{ColorFormat::Red, ColorType::UnsignedByte}));
+    CORRADE_ASSERT(threadCount,
+        "TextureTools::distanceField(): expected at least one thread", (Image2D{ColorFormat::Red, ColorType::UnsignedByte}));
+
+    const Vector2i inputSize = input.size();
+    const std::size_t pixelSize = input.pixelSize();
+    const std::size_t inputRowSize = ((inputSize.x()*pixelSize + 3)/4)*4;
+    const char* const inputData = input.data<char>();
+    auto inside = [&](const Int x, const Int y) {
+        return UnsignedByte(inputData[y*inputRowSize + x*pixelSize]) > 127;
+    };
+
+    /* Positions in input corresponding to output pixels, the same as in the
+       shader */
+    const Vector2 scaling = Vector2(inputSize)/Vector2(outputSize);
+    std::vector<Int> samplesX(outputSize.x()), samplesY(outputSize.y());
+    for(Int i = 0; i != outputSize.x(); ++i)
+        samplesX[i] = Math::min(Int(i*scaling.x()), inputSize.x() - 1);
+    for(Int i = 0; i != outputSize.y(); ++i)
+        samplesY[i] = Math::min(Int(i*scaling.y()), inputSize.y() - 1);
+
+    /* Vertical distance to nearest inside and outside pixel in each column,
+       clamped to radius+1 and stored only for sampled rows. Distances larger
+       than that don't affect the result, as it's clamped the same way. */
+    const Int maxDistance = radius + 1;
+    std::vector<Int> columnToInside(std::size_t(outputSize.y())*inputSize.x()),
+        columnToOutside(std::size_t(outputSize.y())*inputSize.x());
+    TaskScheduler::global().parallelFor(inputSize.x(), (inputSize.x() + threadCount - 1)/threadCount, [&](const std::size_t begin, const std::size_t end) {
+        std::vector<Int> toInside(inputSize.y()), toOutside(inputSize.y());
+        for(Int x = begin; x != Int(end); ++x) {
+            /* Downwards, then upwards sweep */
+            Int distanceInside = maxDistance, distanceOutside = maxDistance;
+            for(Int y = 0; y != inputSize.y(); ++y) {
+                if(inside(x, y)) distanceInside = 0;
+                else distanceOutside = 0;
+                toInside[y] = distanceInside;
+                toOutside[y] = distanceOutside;
+                distanceInside = Math::min(distanceInside + 1, maxDistance);
+                distanceOutside = Math::min(distanceOutside + 1, maxDistance);
+            }
+            distanceInside = distanceOutside = maxDistance;
+            for(Int y = inputSize.y() - 1; y >= 0; --y) {
+                toInside[y] = Math::min(toInside[y], distanceInside);
+                toOutside[y] = Math::min(toOutside[y], distanceOutside);
+                distanceInside = Math::min(toInside[y] + 1, maxDistance);
+                distanceOutside = Math::min(toOutside[y] + 1, maxDistance);
+            }
+
+            for(Int i = 0; i != outputSize.y(); ++i) {
+                columnToInside[std::size_t(i)*inputSize.x() + x] = toInside[samplesY[i]]*toInside[samplesY[i]];
+                columnToOutside[std::size_t(i)*inputSize.x() + x] = toOutside[samplesY[i]]*toOutside[samplesY[i]];
+            }
+        }
+    });
+
+    /* Horizontal pass on sampled rows, combining both distances into the
+       output. Rows are aligned to four bytes. */
+    const std::size_t outputRowSize = ((outputSize.x() + 3)/4)*4;
+    char* const outputData = new char[outputRowSize*outputSize.y()]();
+    TaskScheduler::global().parallelFor(outputSize.y(), (outputSize.y() + threadCount - 1)/threadCount, [&](const std::size_t begin, const std::size_t end) {
+        std::vector<Int> v(inputSize.x());
+        std::vector<Float> z(inputSize.x() + 1);
+        std::vector<Float> distanceToInside(outputSize.x()), distanceToOutside(outputSize.x());
+        for(std::size_t i = begin; i != end; ++i) {
+            distanceTransformRow(columnToInside.data() + i*inputSize.x(), inputSize.x(), samplesX.data(), outputSize.x(), v.data(), z.data(), distanceToInside.data());
+            distanceTransformRow(columnToOutside.data() + i*inputSize.x(), inputSize.x(), samplesX.data(), outputSize.x(), v.data(), z.data(), distanceToOutside.data());
+
+            /* Signed distance, normalized from [-radius-1, radius+1] to
+               [0, 1] */
+            for(Int j = 0; j != outputSize.x(); ++j) {
+                const bool isInside = inside(samplesX[j], samplesY[i]);
+                const Float distance = Math::min(std::sqrt(isInside ? distanceToOutside[j] : distanceToInside[j]), Float(maxDistance));
+                const Float value = (isInside ? distance : -distance)/Float(2*maxDistance) + 0.5f;
+                outputData[i*outputRowSize + j] = UnsignedByte(Math::round(value*255.0f));
+            }
+        }
+    });
+
+    return Image2D{ColorFormat::Red, ColorType::UnsignedByte, outputSize, outputData};
+}
+
+namespace {
+
+/* Channel masks for edge coloring */
+enum: UnsignedByte {
+    Red = 1 << 0,
+    Green = 1 << 1,
+    Blue = 1 << 2,
+    White = Red|Green|Blue
+};
+
+struct Edge {
+    Vector2 a, b;
+    UnsignedByte color;
+};
+
+/* Colors the edges so that the two edges meeting in a corner always share
+   only one channel, see the Chlumský thesis */
+void colorContour(const std::vector<Vector2>& contour, std::vector<Edge>& edges) {
+    const std::size_t count = contour.size();
+    if(count < 2) return;
+
+    /* Corner is where direction changes by more than ~8° (or turns back) */
+    std::vector<std::size_t> corners;
+    for(std::size_t i = 0; i != count; ++i) {
+        const Vector2 previous = (contour[i] - contour[(i + count - 1)%count]).normalized();
+        const Vector2 next = (contour[(i + 1)%count] - contour[i]).normalized();
+        if(Math::dot(previous, next) <= 0.0f || std::abs(Math::cross(previous, next)) > 0.14f)
+            corners.push_back(i);
+    }
+
+    const std::size_t first = edges.size();
+    for(std::size_t i = 0; i != count; ++i)
+        edges.push_back({contour[i], contour[(i + 1)%count], White});
+
+    /* Smooth contour, all channels have the same distance */
+    if(corners.empty()) return;
+
+    /* Single corner, split the contour into three parts starting at the
+       corner so both edges meeting in the corner have different colors */
+    constexpr const UnsignedByte colors[]{Green|Blue, Red|Blue, Red|Green};
+    if(corners.size() == 1) {
+        for(std::size_t i = 0; i != count; ++i) {
+            const std::size_t third = 3*i/count;
+            edges[first + (corners[0] + i)%count].color =
+                third == 0 ? colors[0] : third == 1 ? UnsignedByte(White) : colors[1];
+        }
+        return;
+    }
+
+    /* Switch colors at each corner. If the last run would end up with the
+       same color as the first, pick the remaining one. */
+    for(std::size_t run = 0; run != corners.size(); ++run) {
+        UnsignedByte color = colors[run%3];
+        if(run + 1 == corners.size() && run%3 == 0) color = colors[1];
+        const std::size_t end = run + 1 == corners.size() ? corners[0] + count : corners[run + 1];
+        for(std::size_t i = corners[run]; i != end; ++i)
+            edges[first + i%count].color = color;
+    }
+}
+
+}
+
+Image2D multichannelDistanceField(const std::vector<std::vector<Vector2>>& contours, const Vector2i& outputSize, const Float radius, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(threadCount,
+        "TextureTools::multichannelDistanceField(): expected at least one thread", (Image2D{ColorFormat::RGB, ColorType::UnsignedByte}));
+
+    std::vector<Edge> edges;
+    for(const std::vector<Vector2>& contour: contours)
+        colorContour(contour, edges);
+
+    /* Rows are aligned to four bytes */
+    const std::size_t outputRowSize = ((outputSize.x()*3 + 3)/4)*4;
+    char* const outputData = new char[outputRowSize*outputSize.y()]();
+    TaskScheduler::global().parallelFor(outputSize.y(), (outputSize.y() + threadCount - 1)/threadCount, [&](const std::size_t begin, const std::size_t end) {
+        for(Int y = begin; y != Int(end); ++y) for(Int x = 0; x != outputSize.x(); ++x) {
+            const Vector2 point{x + 0.5f, y + 0.5f};
+
+            /* Nearest edge overall and for each channel. Edges of equal
+               distance (meeting in the same endpoint) are ordered by how
+               orthogonal they are to the point. */
+            Float minDistance[4]{Constants::inf(), Constants::inf(), Constants::inf(), Constants::inf()};
+            Float minDot[4]{1.0f, 1.0f, 1.0f, 1.0f};
+            Float pseudoDistance[4]{};
+            Int winding = 0;
+            for(const Edge& edge: edges) {
+                const Vector2 ab = edge.b - edge.a;
+                const Vector2 aq = point - edge.a;
+                const Float lengthSquared = ab.dot();
+                if(lengthSquared == 0.0f) continue;
+
+                /* Non-zero winding rule for inside test */
+                if(edge.a.y() <= point.y()) {
+                    if(edge.b.y() > point.y() && Math::cross(ab, aq) > 0.0f) ++winding;
+                } else if(edge.b.y() <= point.y() && Math::cross(ab, aq) < 0.0f) --winding;
+
+                const Float t = Math::clamp(Math::dot(aq, ab)/lengthSquared, 0.0f, 1.0f);
+                const Vector2 toNearest = point - (edge.a + ab*t);
+                const Float distance = toNearest.length();
+                const Float dot = distance == 0.0f ? 0.0f :
+                    std::abs(Math::dot(ab, toNearest))/(std::sqrt(lengthSquared)*distance);
+
+                /* Signed pseudo-distance, i.e. distance to the edge extended
+                   to infinite line. Positive on the left (inside). */
+                const Float perpendicular = Math::cross(ab, aq)/std::sqrt(lengthSquared);
+
+                for(UnsignedByte i = 0; i != 4; ++i) {
+                    if(i != 3 && !(edge.color & (1 << i))) continue;
+                    if(distance < minDistance[i] || (distance == minDistance[i] && dot < minDot[i])) {
+                        minDistance[i] = distance;
+                        minDot[i] = dot;
+                        pseudoDistance[i] = perpendicular;
+                    }
+                }
+            }
+
+            const bool inside = winding != 0;
+            const Float singleChannel = inside ? minDistance[3] : -minDistance[3];
+            Float channels[3];
+            for(std::size_t i = 0; i != 3; ++i)
+                channels[i] = minDistance[i] == Constants::inf() ? singleChannel : pseudoDistance[i];
+
+            /* Replace the pixel with single-channel distance if the median
+               disagrees with the actual inside test */
+            const Float median = Math::max(Math::min(channels[0], channels[1]), Math::min(Math::max(channels[0], channels[1]), channels[2]));
+            if((median > 0.0f) != inside)
+                channels[0] = channels[1] = channels[2] = singleChannel;
+
+            for(std::size_t i = 0; i != 3; ++i) {
+                const Float value = Math::clamp(channels[i]/(2.0f*radius) + 0.5f, 0.0f, 1.0f);
+                outputData[y*outputRowSize + x*3 + i] = UnsignedByte(Math::round(value*255.0f));
+            }
+        }
+    });
+
+    return Image2D{ColorFormat::RGB, ColorType::UnsignedByte, outputSize, outputData};
 }
 
 }}
@@ -26,13 +26,14 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::TextureTools::distanceField()
+ * @brief Class @ref Magnum::TextureTools::DistanceField, function @ref Magnum::TextureTools::distanceField(), @ref Magnum::TextureTools::multichannelDistanceField()
  */
 
-#ifndef MAGNUM_TARGET_GLES
+#include <memory>
+#include <vector>
+
 #include "Magnum/Math/Vector2.h"
-#endif
-#include "Magnum/Magnum.h"
+#include "Magnum/Image.h"
 
 #include "Magnum/TextureTools/visibility.h"
 
@@ -80,7 +81,11 @@ Based on: *Chris Green - Improved Alpha-Tested Magnification for Vector Textures
 and Special Effects, SIGGRAPH 2007,
 http://www.valvesoftware.com/publications/2007/SIGGRAPH2007_AlphaTestedMagnification.pdf*
 
-@attention This is GPU-only implementation, so it expects active context.
+@attention This is GPU implementation, so it expects active context. Its
+    complexity is @f$ \mathcal{O}(r^2) @f$ per output pixel. See
+    @ref distanceField(const ImageReference2D&, const Vector2i&, Int, UnsignedInt)
+    for an exact linear-time CPU implementation, better suited for large
+    radii.
 
 @note If internal format of @p output texture is not renderable, this function
     prints message to error output and does nothing. In desktop OpenGL and
@@ -99,6 +104,141 @@ void MAGNUM_TEXTURETOOLS_EXPORT distanceField(Texture2D& input, Texture2D& outpu
 void MAGNUM_TEXTURETOOLS_EXPORT distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangle, Int radius, const Vector2i& imageSize);
 #endif
 
+/**
+@brief Reusable GPU distance field converter
+
+Same as @ref distanceField(Texture2D&, Texture2D&, const Range2Di&, Int, const Vector2i&),
+but the shader, the framebuffer and the mesh are created only once and kept
+for subsequent conversions, so converting many small rectangles (e.g. glyphs
+added to a cache at runtime) doesn't recompile the shader on every call.
+
+Only pixels inside the rectangle are written, the rest of the output texture
+is preserved. The input
+texture is expected to cover the whole output texture (scaled by ratio of
+@p imageSize and output texture size), so the output rectangle can be placed
+anywhere.
+@see @ref Text::DistanceFieldGlyphCache
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT DistanceField {
+    public:
+        /**
+         * @brief Constructor
+         * @param radius    Max lookup radius in input texture
+         *
+         * Compiles the shader.
+         */
+        explicit DistanceField(Int radius);
+
+        /** @brief Copying is not allowed */
+        DistanceField(const DistanceField&) = delete;
+
+        /** @brief Move constructor */
+        DistanceField(DistanceField&&) noexcept;
+
+        ~DistanceField();
+
+        /** @brief Copying is not allowed */
+        DistanceField& operator=(const DistanceField&) = delete;
+
+        /** @brief Move assignment */
+        DistanceField& operator=(DistanceField&&) noexcept;
+
+        /** @brief Max lookup radius */
+        Int radius() const { return _radius; }
+
+        /**
+         * @brief Convert given rectangle
+         * @param input         Input texture
+         * @param output        Output texture
+         * @param rectangle     Rectangle in output texture where to render
+         * @param imageSize     Input texture size
+         * @param outputSize    Output texture size
+         *
+         * Pixel at position @f$ \boldsymbol{p} @f$ in @p output is computed
+         * from neighborhood of pixel at
+         * @f$ \boldsymbol{p} \frac{imageSize}{outputSize} @f$ in @p input.
+         * If internal format of @p output is not renderable, prints message
+         * to error output and does nothing.
+         */
+        void operator()(Texture2D& input, Texture2D& output, const Range2Di& rectangle, const Vector2i& imageSize, const Vector2i& outputSize);
+
+    private:
+        struct State;
+
+        Int _radius;
+        std::unique_ptr<State> _state;
+};
+
+/**
+@brief Create signed distance field on the CPU
+@param input        Input image
+@param outputSize   Output image size
+@param radius       Max lookup radius in input image
+@param threadCount  Count of parts to split the work into
+
+CPU counterpart to @ref distanceField(Texture2D&, Texture2D&, const Range2Di&, Int, const Vector2i&),
+producing the same values without the need for an OpenGL context. Expects
+that @p input is in @ref ColorType::UnsignedByte, the first channel of each
+pixel is treated as the binary image (values larger than `127` are "inside").
+Returns @ref ColorFormat::Red / @ref ColorType::UnsignedByte image of
+@p outputSize.
+
+Instead of looking for nearest pixel of opposite color in the whole @p radius
+for each output pixel, exact Euclidean distance transform is calculated in two
+separable passes --- first computing vertical distances in each column of
+@p input, then the lower envelope of parabolas along each output row.
+Complexity is thus linear in input size regardless of @p radius. If
+@p threadCount is larger than `1`, the columns and rows are split into equally
+large ranges processed in parallel on @ref TaskScheduler::global().
+
+Based on: *Pedro F. Felzenszwalb and Daniel P. Huttenlocher - Distance
+Transforms of Sampled Functions, Theory of Computing 8, 2012,
+http://cs.brown.edu/~pff/papers/dt-final.pdf*
+*/
+Image2D MAGNUM_TEXTURETOOLS_EXPORT distanceField(const ImageReference2D& input, const Vector2i& outputSize, Int radius, UnsignedInt threadCount = 1);
+
+/**
+@brief Create multichannel signed distance field
+@param contours     Shape outline
+@param outputSize   Output image size
+@param radius       Distance range in output pixels
+@param threadCount  Count of parts to split the work into
+
+Single-channel distance field rounds off sharp corners when magnified, as
+bilinear interpolation of distance to the nearest edge can't represent them.
+This function instead stores distance to differently colored edges in each of
+red, green and blue channel, and the shape is reconstructed from median of the
+three channels. Corners then stay sharp even at low resolutions, allowing for
+much smaller textures with equivalent quality. Use
+@ref Shaders::DistanceFieldVector with
+@ref Shaders::AbstractVector::Flag::Multichannel "Flag::Multichannel" for
+rendering.
+
+Unlike @ref distanceField(), which works on binary images, the corner
+information is available only in the original vector outline. The
+@p contours are closed polygons in output pixel coordinates (pixel centers
+are at half-integer positions, Y up), with outer contours in counterclockwise
+order and holes in clockwise order --- i.e., inside of the shape is always on
+the left side. Curves are expected to be flattened into line segments, vertices
+where direction changes by more than approximately `8°` are treated as
+corners. Signed distance in range @f$ [-r, r] @f$ is mapped to @f$ [0, 1] @f$,
+with values around `0.5` being on edges, the same as in @ref distanceField().
+Returns @ref ColorFormat::RGB / @ref ColorType::UnsignedByte image of
+@p outputSize.
+
+Complexity is @f$ \mathcal{O}(n) @f$ per output pixel, where @f$ n @f$ is
+count of edges. If @p threadCount is larger than `1`, output rows are split
+into equally large ranges processed in parallel on
+@ref TaskScheduler::global(). Pixels where the median would
+give wrong inside/outside information (happens around edges meeting at very
+acute angles) are replaced with single-channel distance.
+
+Based on: *Viktor Chlumský - Shape Decomposition for Multi-channel Distance
+Fields, Master's thesis, Czech Technical University in Prague, 2015,
+https://github.com/Chlumsky/msdfgen*
+*/
+Image2D MAGNUM_TEXTURETOOLS_EXPORT multichannelDistanceField(const std::vector<std::vector<Vector2>>& contours, const Vector2i& outputSize, Float radius, UnsignedInt threadCount = 1);
+
 }}
 
 #endif
@@ -0,0 +1,230 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Downsample.h"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Framebuffer.h"
+#include "Magnum/Texture.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Implementation/Simd.h"
+#include "Magnum/TextureTools/Implementation/Srgb.h"
+
+#if defined(MAGNUM_MATH_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MAGNUM_TEXTURETOOLS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* Rows of images are aligned to four bytes, see AbstractImage::dataSize() */
+std::size_t rowStride(const Int width, const std::size_t pixelSize) {
+    return ((width*pixelSize + 3)/4)*4;
+}
+
+bool hasAlpha(const ColorFormat format) {
+    return format == ColorFormat::RGBA || format == ColorFormat::BGRA
+        #ifdef MAGNUM_TARGET_GLES2
+        || format == ColorFormat::LuminanceAlpha
+        #endif
+        ;
+}
+
+/* 2x2 average of four-channel 8-bit pixels, returns count of processed output
+   pixels, the rest is done by the scalar loop */
+std::size_t downsampleRowRgba8(const UnsignedByte* const row0, const UnsignedByte* const row1, UnsignedByte* const out, const std::size_t outWidth) {
+    std::size_t x = 0;
+    #if defined(MAGNUM_TEXTURETOOLS_SSE2)
+    /* Four input pixels to two output pixels */
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i two = _mm_set1_epi16(2);
+    for(; x + 2 <= outWidth; x += 2) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x*8));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x*8));
+
+        /* Vertical sums, pixels 0, 1 in the low and 2, 3 in the high half */
+        const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+        const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+
+        /* Horizontal sums of neighboring pixels */
+        const __m128i sum = _mm_unpacklo_epi64(
+            _mm_add_epi16(lo, _mm_srli_si128(lo, 8)),
+            _mm_add_epi16(hi, _mm_srli_si128(hi, 8)));
+
+        const __m128i average = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + x*4), _mm_packus_epi16(average, average));
+    }
+    #elif defined(MAGNUM_MATH_NEON)
+    /* Sixteen input pixels to eight output pixels, deinterleaved so the
+       pairwise add sums neighboring pixels */
+    for(; x + 8 <= outWidth; x += 8) {
+        const uint8x16x4_t a = vld4q_u8(row0 + x*8);
+        const uint8x16x4_t b = vld4q_u8(row1 + x*8);
+        uint8x8x4_t result;
+        for(std::size_t c = 0; c != 4; ++c)
+            result.val[c] = vrshrn_n_u16(vaddq_u16(vpaddlq_u8(a.val[c]), vpaddlq_u8(b.val[c])), 2);
+        vst4_u8(out + x*4, result);
+    }
+    #else
+    static_cast<void>(row0);
+    static_cast<void>(row1);
+    static_cast<void>(out);
+    static_cast<void>(outWidth);
+    #endif
+    return x;
+}
+
+/* Input pixels covered by one output pixel along one dimension, with weights
+   summing to one */
+struct Tap {
+    Int index;
+    Float weight;
+};
+
+std::vector<std::vector<Tap>> taps(const Int inputSize, const Int outputSize) {
+    std::vector<std::vector<Tap>> out(outputSize);
+    const Float scale = Float(inputSize)/outputSize;
+    for(Int i = 0; i != outputSize; ++i) {
+        const Float begin = i*scale, end = (i + 1)*scale;
+        for(Int j = Int(begin); j < inputSize && j < end; ++j) {
+            const Float weight = (std::min(end, Float(j + 1)) - std::max(begin, Float(j)))/scale;
+            if(weight > 0.0f) out[i].push_back({j, weight});
+        }
+    }
+    return out;
+}
+
+template<class T> void downsampleGeneric(const char* const input, const Vector2i& inputSize, char* const output, const Vector2i& outputSize, const std::size_t channels, const std::size_t alphaChannel, const bool srgb) {
+    const std::size_t pixelSize = channels*sizeof(T);
+    const std::size_t inputStride = rowStride(inputSize.x(), pixelSize);
+    const std::size_t outputStride = rowStride(outputSize.x(), pixelSize);
+    const std::vector<std::vector<Tap>> xTaps = taps(inputSize.x(), outputSize.x());
+    const std::vector<std::vector<Tap>> yTaps = taps(inputSize.y(), outputSize.y());
+    const Implementation::SrgbTables* const tables = srgb ? &Implementation::srgbTables() : nullptr;
+
+    std::vector<Float> sum(channels);
+    for(Int y = 0; y != outputSize.y(); ++y) {
+        T* const outRow = reinterpret_cast<T*>(output + y*outputStride);
+        for(Int x = 0; x != outputSize.x(); ++x) {
+            std::fill(sum.begin(), sum.end(), 0.0f);
+            for(const Tap& ty: yTaps[y]) {
+                const T* const inRow = reinterpret_cast<const T*>(input + ty.index*inputStride);
+                for(const Tap& tx: xTaps[x]) {
+                    const Float weight = ty.weight*tx.weight;
+                    const T* const pixel = inRow + tx.index*channels;
+                    for(std::size_t c = 0; c != channels; ++c) {
+                        Float value = Float(pixel[c]);
+                        if(tables && c != alphaChannel)
+                            value = tables->toLinear[std::size_t(pixel[c])]*255.0f;
+                        sum[c] += value*weight;
+                    }
+                }
+            }
+
+            T* const pixel = outRow + x*channels;
+            for(std::size_t c = 0; c != channels; ++c) {
+                if(std::is_integral<T>::value) {
+                    if(tables && c != alphaChannel)
+                        pixel[c] = T(tables->encode(sum[c]/255.0f));
+                    else pixel[c] = T(Math::clamp(sum[c] + 0.5f, 0.0f, 255.0f));
+                } else pixel[c] = T(sum[c]);
+            }
+        }
+    }
+}
+
+}
+
+Image2D downsample(const ImageReference2D& image, const bool srgb) {
+    CORRADE_ASSERT(image.type() == ColorType::UnsignedByte || image.type() == ColorType::Float,
+        "TextureTools::downsample(): expected unsigned byte or float image, got" << image.type(), (Image2D{image.format(), image.type()}));
+
+    const Vector2i inputSize = image.size();
+    const Vector2i outputSize = Math::max(inputSize/2, Vector2i{1});
+    const std::size_t pixelSize = image.pixelSize();
+    const std::size_t channels = image.type() == ColorType::Float ? pixelSize/4 : pixelSize;
+    const std::size_t alphaChannel = hasAlpha(image.format()) ? channels - 1 : ~std::size_t{};
+    const bool byte = image.type() == ColorType::UnsignedByte;
+
+    Image2D output{image.format(), image.type(), outputSize, new char[image.dataSize(outputSize)]};
+
+    /* Fast path for even four-channel byte images without sRGB conversion */
+    if(byte && !srgb && channels == 4 && inputSize.x() % 2 == 0 && inputSize.y() % 2 == 0) {
+        const std::size_t inputStride = rowStride(inputSize.x(), 4);
+        const std::size_t outputStride = rowStride(outputSize.x(), 4);
+        for(Int y = 0; y != outputSize.y(); ++y) {
+            const auto row0 = reinterpret_cast<const UnsignedByte*>(image.data()) + 2*y*inputStride;
+            const auto row1 = row0 + inputStride;
+            const auto out = reinterpret_cast<UnsignedByte*>(output.data()) + y*outputStride;
+
+            for(std::size_t x = downsampleRowRgba8(row0, row1, out, outputSize.x()); x != std::size_t(outputSize.x()); ++x)
+                for(std::size_t c = 0; c != 4; ++c)
+                    out[x*4 + c] = UnsignedByte((row0[x*8 + c] + row0[x*8 + 4 + c] + row1[x*8 + c] + row1[x*8 + 4 + c] + 2)/4);
+        }
+
+        return output;
+    }
+
+    if(byte) downsampleGeneric<UnsignedByte>(image.data(), inputSize, output.data(), outputSize, channels, alphaChannel, srgb);
+    else downsampleGeneric<Float>(image.data(), inputSize, output.data(), outputSize, channels, alphaChannel, false);
+
+    return output;
+}
+
+std::vector<Image2D> mipmap(const ImageReference2D& image, const bool srgb) {
+    std::vector<Image2D> levels;
+    if(image.size() == Vector2i{1}) return levels;
+
+    levels.push_back(downsample(image, srgb));
+    while(levels.back().size() != Vector2i{1}) {
+        const ImageReference2D previous = levels.back();
+        levels.push_back(downsample(previous, srgb));
+    }
+
+    return levels;
+}
+
+void blitMipmap(Texture2D& texture, const Vector2i& size, const Int levelCount) {
+    Framebuffer read{{{}, size}}, draw{{{}, size}};
+
+    for(Int level = 1; level < levelCount; ++level) {
+        const Vector2i sourceSize = Math::max(size/(1 << (level - 1)), Vector2i{1});
+        const Vector2i destinationSize = Math::max(size/(1 << level), Vector2i{1});
+
+        read.attachTexture(Framebuffer::ColorAttachment(0), texture, level - 1);
+        draw.attachTexture(Framebuffer::ColorAttachment(0), texture, level);
+        AbstractFramebuffer::blit(read, draw, {{}, sourceSize}, {{}, destinationSize}, FramebufferBlit::Color, FramebufferBlitFilter::Linear);
+    }
+}
+
+}}
@@ -0,0 +1,99 @@
+#ifndef Magnum_TextureTools_Downsample_h
+#define Magnum_TextureTools_Downsample_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::downsample(), @ref Magnum::TextureTools::mipmap(), @ref Magnum::TextureTools::blitMipmap()
+ */
+
+#include <vector>
+
+#include "Magnum/Image.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Downsample an image to next mip level
+@param image    Input image
+@param srgb     Whether the color channels are sRGB-encoded
+
+Returns image of half the size (rounded down, but at least `1`) in the same
+format as @p image, filtered with a box filter. Expects that @p image is in
+@ref ColorType::UnsignedByte or @ref ColorType::Float. If @p srgb is `true`,
+the color channels of @ref ColorType::UnsignedByte images are converted to
+linear space before averaging and back after, the alpha channel (last channel
+of @ref ColorFormat::RGBA and @ref ColorFormat::BGRA images) is always
+averaged linearly.
+
+If both dimensions are even (or equal to `1`), each output pixel is average of
+2x2 input pixels. Four-channel @ref ColorType::UnsignedByte images are then
+processed with SSE2 or NEON instructions, if available on the target. For odd
+sizes, each output pixel is weighted average of the input pixels it covers,
+so no input pixels are skipped and the result has consistent brightness
+regardless of the size.
+@see @ref mipmap()
+*/
+Image2D MAGNUM_TEXTURETOOLS_EXPORT downsample(const ImageReference2D& image, bool srgb = false);
+
+/**
+@brief Create full mip chain of an image
+@param image    Input image
+@param srgb     Whether the color channels are sRGB-encoded
+
+Calls @ref downsample() repeatedly until the image size is `1x1`. Returned
+images start at mip level `1`, the level `0` is @p image itself. Useful for
+prebuilding mip chains in asset pipelines, so they can be uploaded directly
+without @ref AbstractTexture::generateMipmap() "Texture::generateMipmap()" at
+runtime.
+*/
+std::vector<Image2D> MAGNUM_TEXTURETOOLS_EXPORT mipmap(const ImageReference2D& image, bool srgb = false);
+
+/**
+@brief Generate mip levels of a texture using framebuffer blit
+@param texture      Texture
+@param size         Size of level `0`
+@param levelCount   Count of levels to fill, including level `0`
+
+GPU counterpart to @ref mipmap(). Fills levels `1` to @p levelCount - `1` of
+@p texture by blitting each level to the next one with
+@ref FramebufferBlitFilter::Linear, which for even sizes is equivalent to 2x2
+box filter. Unlike @ref AbstractTexture::generateMipmap() "Texture::generateMipmap()",
+the filtering is fully specified and doesn't depend on the driver. Expects
+that the levels are already allocated (e.g. using
+@ref Texture::setStorage() "Texture2D::setStorage()") and that the texture
+format is color-renderable. For sRGB formats, the blit is done in linear space
+only if @ref Renderer::Feature::FramebufferSRGB is enabled on desktop.
+@attention This is GPU implementation, so it expects active context.
+@requires_gl30 Extension @extension{ARB,framebuffer_object}
+@requires_gles30 Extension @es_extension{ANGLE,framebuffer_blit} or
+    @es_extension{NV,framebuffer_blit} in OpenGL ES 2.0
+*/
+void MAGNUM_TEXTURETOOLS_EXPORT blitMipmap(Texture2D& texture, const Vector2i& size, Int levelCount);
+
+}}
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef Magnum_TextureTools_Implementation_PixelLayout_h
+#define Magnum_TextureTools_Implementation_PixelLayout_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+
+#include "Magnum/ColorFormat.h"
+
+namespace Magnum { namespace TextureTools { namespace Implementation {
+
+/* Rows of images are aligned to four bytes, see AbstractImage::dataSize() */
+inline std::size_t rowStride(const Int width, const std::size_t pixelSize) {
+    return ((width*pixelSize + 3)/4)*4;
+}
+
+/* Position of red, green, blue and alpha in a pixel, -1 if not present */
+struct Layout {
+    Int channels;
+    Int index[4];
+};
+
+inline bool layout(const ColorFormat format, Layout& out) {
+    switch(format) {
+        case ColorFormat::Red:
+            out = {1, {0, -1, -1, -1}};
+            return true;
+        case ColorFormat::RG:
+            out = {2, {0, 1, -1, -1}};
+            return true;
+        #ifdef MAGNUM_TARGET_GLES2
+        case ColorFormat::Luminance:
+            out = {1, {0, 0, 0, -1}};
+            return true;
+        case ColorFormat::LuminanceAlpha:
+            out = {2, {0, 0, 0, 1}};
+            return true;
+        #endif
+        case ColorFormat::RGB:
+            out = {3, {0, 1, 2, -1}};
+            return true;
+        case ColorFormat::RGBA:
+            out = {4, {0, 1, 2, 3}};
+            return true;
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorFormat::BGR:
+            out = {3, {2, 1, 0, -1}};
+            return true;
+        #endif
+        case ColorFormat::BGRA:
+            out = {4, {2, 1, 0, 3}};
+            return true;
+        default:
+            return false;
+    }
+}
+
+}}}
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef Magnum_TextureTools_Implementation_Srgb_h
+#define Magnum_TextureTools_Implementation_Srgb_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+
+#include "Magnum/Types.h"
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum { namespace TextureTools { namespace Implementation {
+
+inline Float srgbToLinear(const Float value) {
+    return value <= 0.04045f ? value/12.92f : std::pow((value + 0.055f)/1.055f, 2.4f);
+}
+
+inline Float linearToSrgb(const Float value) {
+    return value <= 0.0031308f ? value*12.92f : 1.055f*std::pow(value, 1.0f/2.4f) - 0.055f;
+}
+
+/* Conversion tables for 8-bit sRGB, the inverse one has enough entries to
+   round-trip all 256 values exactly */
+struct SrgbTables {
+    enum: std::size_t { InverseSize = 4096 };
+
+    SrgbTables() {
+        for(std::size_t i = 0; i != 256; ++i)
+            toLinear[i] = srgbToLinear(i/255.0f);
+        for(std::size_t i = 0; i != InverseSize; ++i)
+            fromLinear[i] = UnsignedByte(linearToSrgb(i/Float(InverseSize - 1))*255.0f + 0.5f);
+    }
+
+    UnsignedByte encode(const Float value) const {
+        return fromLinear[std::size_t(Math::clamp(value, 0.0f, 1.0f)*(InverseSize - 1) + 0.5f)];
+    }
+
+    Float toLinear[256];
+    UnsignedByte fromLinear[InverseSize];
+};
+
+inline const SrgbTables& srgbTables() {
+    static const SrgbTables tables;
+    return tables;
+}
+
+}}}
+
+#endif
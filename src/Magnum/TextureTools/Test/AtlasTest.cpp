@@ -38,13 +38,29 @@ struct AtlasTest: TestSuite::Tester {
     void createPadding();
     void createEmpty();
     void createTooSmall();
+
+    void packerAdd();
+    void packerAddTooLarge();
+    void packerRotation();
+    void packerMultiplePages();
+    void packerBatchRollback();
+    void packerNoOverlap();
+    void packerClear();
 };
 
 AtlasTest::AtlasTest() {
     addTests({&AtlasTest::create,
               &AtlasTest::createPadding,
               &AtlasTest::createEmpty,
-              &AtlasTest::createTooSmall});
+              &AtlasTest::createTooSmall,
+
+              &AtlasTest::packerAdd,
+              &AtlasTest::packerAddTooLarge,
+              &AtlasTest::packerRotation,
+              &AtlasTest::packerMultiplePages,
+              &AtlasTest::packerBatchRollback,
+              &AtlasTest::packerNoOverlap,
+              &AtlasTest::packerClear});
 }
 
 void AtlasTest::create() {
@@ -56,9 +72,9 @@ void AtlasTest::create() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
-        Range2Di::fromSize({0, 0}, {12, 18}),
-        Range2Di::fromSize({32, 0}, {32, 15}),
-        Range2Di::fromSize({0, 25}, {23, 25})}));
+        Range2Di::fromSize({23, 0}, {12, 18}),
+        Range2Di::fromSize({23, 18}, {32, 15}),
+        Range2Di::fromSize({0, 0}, {23, 25})}));
 }
 
 void AtlasTest::createPadding() {
@@ -70,9 +86,9 @@ void AtlasTest::createPadding() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
-        Range2Di::fromSize({2, 1}, {8, 16}),
-        Range2Di::fromSize({34, 1}, {28, 13}),
-        Range2Di::fromSize({2, 26}, {19, 23})}));
+        Range2Di::fromSize({25, 1}, {8, 16}),
+        Range2Di::fromSize({25, 19}, {28, 13}),
+        Range2Di::fromSize({2, 1}, {19, 23})}));
 }
 
 void AtlasTest::createEmpty() {
@@ -86,11 +102,135 @@ void AtlasTest::createTooSmall() {
 
     std::vector<Range2Di> atlas = TextureTools::atlas({64, 32}, {
         {8, 16},
-        {21, 13},
+        {31, 13},
         {19, 29}
     }, {2, 1});
     CORRADE_VERIFY(atlas.empty());
-    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(64, 32) is too small to fit 3 Vector(25, 31) textures. Generated atlas will be empty.\n");
+    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(64, 32) is too small to fit 3 Vector(35, 31) textures. Generated atlas will be empty.\n");
+}
+
+void AtlasTest::packerAdd() {
+    AtlasPacker packer{{64, 64}};
+    CORRADE_COMPARE(packer.pageCount(), 0);
+    CORRADE_COMPARE(packer.fillRatio(), 0.0f);
+
+    /* Incremental insertion fills the space next to previous rectangles */
+    std::optional<AtlasPacker::Placement> a = packer.add({32, 16});
+    std::optional<AtlasPacker::Placement> b = packer.add({16, 32});
+    std::optional<AtlasPacker::Placement> c = packer.add({32, 8});
+    CORRADE_VERIFY(a && b && c);
+
+    CORRADE_COMPARE(a->page, 0);
+    CORRADE_COMPARE(a->rectangle, Range2Di::fromSize({0, 0}, {32, 16}));
+    CORRADE_VERIFY(!a->rotated);
+    CORRADE_COMPARE(b->rectangle, Range2Di::fromSize({32, 0}, {16, 32}));
+    CORRADE_COMPARE(c->rectangle, Range2Di::fromSize({0, 16}, {32, 8}));
+
+    CORRADE_COMPARE(packer.pageCount(), 1);
+    CORRADE_COMPARE(packer.fillRatio(), 0.3125f);
+}
+
+void AtlasTest::packerAddTooLarge() {
+    AtlasPacker packer{{64, 64}, {1, 1}};
+    CORRADE_VERIFY(!packer.add({63, 10}));
+    CORRADE_VERIFY(!packer.add({10, 70}));
+    CORRADE_COMPARE(packer.pageCount(), 0);
+
+    CORRADE_VERIFY(packer.add({62, 62}));
+
+    /* Single page only */
+    CORRADE_VERIFY(!packer.add({1, 1}));
+    CORRADE_COMPARE(packer.pageCount(), 1);
+}
+
+void AtlasTest::packerRotation() {
+    AtlasPacker packer{{64, 32}, {}, AtlasPacker::Flag::AllowRotation};
+
+    /* Doesn't fit without rotation */
+    std::optional<AtlasPacker::Placement> a = packer.add({16, 48});
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(a->rotated);
+    CORRADE_COMPARE(a->rectangle, Range2Di::fromSize({0, 0}, {48, 16}));
+
+    /* Rotated placement ends lower */
+    std::optional<AtlasPacker::Placement> b = packer.add({20, 10});
+    CORRADE_VERIFY(b);
+    CORRADE_VERIFY(b->rotated);
+    CORRADE_COMPARE(b->rectangle, Range2Di::fromSize({48, 0}, {10, 20}));
+
+    /* Not rotated if it doesn't help */
+    std::optional<AtlasPacker::Placement> c = packer.add({6, 4});
+    CORRADE_VERIFY(c);
+    CORRADE_VERIFY(!c->rotated);
+    CORRADE_COMPARE(c->rectangle, Range2Di::fromSize({58, 0}, {6, 4}));
+}
+
+void AtlasTest::packerMultiplePages() {
+    AtlasPacker packer{{32, 32}, {}, AtlasPacker::Flag::MultiplePages};
+
+    std::optional<AtlasPacker::Placement> a = packer.add({32, 24});
+    std::optional<AtlasPacker::Placement> b = packer.add({16, 16});
+    std::optional<AtlasPacker::Placement> c = packer.add({16, 8});
+    CORRADE_VERIFY(a && b && c);
+
+    CORRADE_COMPARE(a->page, 0);
+    CORRADE_COMPARE(b->page, 1);
+    CORRADE_COMPARE(b->rectangle, Range2Di::fromSize({0, 0}, {16, 16}));
+
+    /* Earlier pages are filled first */
+    CORRADE_COMPARE(c->page, 0);
+    CORRADE_COMPARE(c->rectangle, Range2Di::fromSize({0, 24}, {16, 8}));
+
+    CORRADE_COMPARE(packer.pageCount(), 2);
+    CORRADE_VERIFY(!packer.add({33, 1}));
+    CORRADE_COMPARE(packer.pageCount(), 2);
+}
+
+void AtlasTest::packerBatchRollback() {
+    AtlasPacker packer{{32, 32}};
+    CORRADE_VERIFY(packer.add({16, 16}));
+
+    /* The second one doesn't fit, nothing is added */
+    CORRADE_VERIFY(packer.add(std::vector<Vector2i>{{16, 16}, {32, 32}}).empty());
+    CORRADE_COMPARE(packer.fillRatio(), 0.25f);
+
+    std::optional<AtlasPacker::Placement> a = packer.add({16, 16});
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a->rectangle, Range2Di::fromSize({16, 0}, {16, 16}));
+}
+
+void AtlasTest::packerNoOverlap() {
+    std::vector<Vector2i> sizes;
+    for(Int i = 0; i != 200; ++i)
+        sizes.push_back({1 + (i*37)%23, 1 + (i*53)%29});
+
+    AtlasPacker packer{{256, 256}, {1, 2}, AtlasPacker::Flag::AllowRotation|AtlasPacker::Flag::MultiplePages};
+    const std::vector<AtlasPacker::Placement> placements = packer.add(sizes);
+    CORRADE_COMPARE(placements.size(), sizes.size());
+
+    for(std::size_t i = 0; i != placements.size(); ++i) {
+        const Range2Di a = placements[i].rectangle.padded({1, 2});
+        CORRADE_VERIFY((a.min() >= Vector2i{}).all());
+        CORRADE_VERIFY((a.max() <= Vector2i{256}).all());
+        CORRADE_COMPARE(placements[i].rectangle.size(), placements[i].rotated ?
+            Vector2i(sizes[i].y(), sizes[i].x()) : sizes[i]);
+
+        for(std::size_t j = 0; j != i; ++j) {
+            if(placements[i].page != placements[j].page) continue;
+            const Range2Di b = placements[j].rectangle.padded({1, 2});
+            CORRADE_VERIFY(!((a.min() < b.max()).all() && (b.min() < a.max()).all()));
+        }
+    }
+}
+
+void AtlasTest::packerClear() {
+    AtlasPacker packer{{32, 32}};
+    CORRADE_VERIFY(packer.add({32, 32}));
+    CORRADE_VERIFY(!packer.add({1, 1}));
+
+    packer.clear();
+    CORRADE_COMPARE(packer.pageCount(), 0);
+    CORRADE_VERIFY(packer.add({1, 1}));
 }
 
 }}}
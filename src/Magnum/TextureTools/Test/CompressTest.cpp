@@ -0,0 +1,472 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/TextureTools/Compress.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct CompressTest: TestSuite::Tester {
+    explicit CompressTest();
+
+    void dataSize();
+    void bc1Solid();
+    void bc1Gradient();
+    void bc1PunchThrough();
+    void bc3();
+    #ifndef MAGNUM_TARGET_GLES
+    void bc4();
+    void bc5();
+    void bc7();
+    #endif
+    #ifndef MAGNUM_TARGET_GLES2
+    void etc2();
+    #endif
+    void edgePadding();
+    void parallel();
+    void unsupported();
+};
+
+CompressTest::CompressTest() {
+    addTests({&CompressTest::dataSize,
+              &CompressTest::bc1Solid,
+              &CompressTest::bc1Gradient,
+              &CompressTest::bc1PunchThrough,
+              &CompressTest::bc3,
+              #ifndef MAGNUM_TARGET_GLES
+              &CompressTest::bc4,
+              &CompressTest::bc5,
+              &CompressTest::bc7,
+              #endif
+              #ifndef MAGNUM_TARGET_GLES2
+              &CompressTest::etc2,
+              #endif
+              &CompressTest::edgePadding,
+              &CompressTest::parallel,
+              &CompressTest::unsupported});
+}
+
+namespace {
+
+/* Reference decoders producing 4x4 RGBA blocks in row-major order, written
+   from the format specifications independently of the encoders */
+
+typedef UnsignedByte Block[16][4];
+
+void decodeBc1(const UnsignedByte* data, Block& out) {
+    const Int color0 = data[0] | data[1] << 8, color1 = data[2] | data[3] << 8;
+    Int palette[4][4];
+    const Int colors[]{color0, color1};
+    for(std::size_t i = 0; i != 2; ++i) {
+        const Int r = colors[i] >> 11, g = (colors[i] >> 5) & 0x3f, b = colors[i] & 0x1f;
+        palette[i][0] = r << 3 | r >> 2;
+        palette[i][1] = g << 2 | g >> 4;
+        palette[i][2] = b << 3 | b >> 2;
+        palette[i][3] = 255;
+    }
+    for(std::size_t c = 0; c != 3; ++c) {
+        if(color0 > color1) {
+            palette[2][c] = (2*palette[0][c] + palette[1][c])/3;
+            palette[3][c] = (palette[0][c] + 2*palette[1][c])/3;
+        } else {
+            palette[2][c] = (palette[0][c] + palette[1][c])/2;
+            palette[3][c] = 0;
+        }
+    }
+    palette[2][3] = 255;
+    palette[3][3] = color0 > color1 ? 255 : 0;
+
+    for(std::size_t i = 0; i != 16; ++i) {
+        const Int index = (data[4 + i/4] >> (2*(i%4))) & 3;
+        for(std::size_t c = 0; c != 4; ++c) out[i][c] = UnsignedByte(palette[index][c]);
+    }
+}
+
+void decodeBc4(const UnsignedByte* data, Block& out, const std::size_t channel) {
+    const Int a0 = data[0], a1 = data[1];
+    Int palette[8]{a0, a1};
+    if(a0 > a1) {
+        for(Int i = 2; i != 8; ++i) palette[i] = ((8 - i)*a0 + (i - 1)*a1)/7;
+    } else {
+        for(Int i = 2; i != 6; ++i) palette[i] = ((6 - i)*a0 + (i - 1)*a1)/5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    UnsignedLong bits = 0;
+    for(std::size_t i = 0; i != 6; ++i) bits |= UnsignedLong(data[2 + i]) << (8*i);
+    for(std::size_t i = 0; i != 16; ++i)
+        out[i][channel] = UnsignedByte(palette[(bits >> (3*i)) & 7]);
+}
+
+#ifndef MAGNUM_TARGET_GLES
+UnsignedInt readBits(const UnsignedByte* data, UnsignedInt& position, const UnsignedInt count) {
+    UnsignedInt value = 0;
+    for(UnsignedInt i = 0; i != count; ++i, ++position)
+        value |= UnsignedInt(data[position/8] >> (position%8) & 1) << i;
+    return value;
+}
+
+/* Only mode 6 */
+bool decodeBc7(const UnsignedByte* data, Block& out) {
+    UnsignedInt position = 0;
+    if(readBits(data, position, 7) != 1 << 6) return false;
+
+    Int endpoints[2][4];
+    for(std::size_t c = 0; c != 4; ++c) {
+        endpoints[0][c] = readBits(data, position, 7) << 1;
+        endpoints[1][c] = readBits(data, position, 7) << 1;
+    }
+    const UnsignedInt p0 = readBits(data, position, 1), p1 = readBits(data, position, 1);
+    for(std::size_t c = 0; c != 4; ++c) {
+        endpoints[0][c] |= p0;
+        endpoints[1][c] |= p1;
+    }
+
+    constexpr Int weights[]{0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+    for(std::size_t i = 0; i != 16; ++i) {
+        const UnsignedInt index = readBits(data, position, i ? 4 : 3);
+        for(std::size_t c = 0; c != 4; ++c)
+            out[i][c] = UnsignedByte(((64 - weights[index])*endpoints[0][c] + weights[index]*endpoints[1][c] + 32) >> 6);
+    }
+
+    return true;
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+/* Only the individual and differential modes */
+bool decodeEtc(const UnsignedByte* data, Block& out) {
+    const UnsignedInt high = UnsignedInt(data[0]) << 24 | data[1] << 16 | data[2] << 8 | data[3];
+    const UnsignedInt low = UnsignedInt(data[4]) << 24 | data[5] << 16 | data[6] << 8 | data[7];
+    const bool differential = high >> 1 & 1, flip = high & 1;
+
+    Int base[2][3];
+    for(std::size_t c = 0; c != 3; ++c) {
+        const UnsignedInt shift = 27 - c*8;
+        if(differential) {
+            const Int first = high >> shift & 0x1f;
+            Int delta = high >> (shift - 3) & 7;
+            if(delta >= 4) delta -= 8;
+            const Int second = first + delta;
+            /* Overflow would mean one of the ETC2 T, H or planar modes */
+            if(second < 0 || second > 31) return false;
+            base[0][c] = first << 3 | first >> 2;
+            base[1][c] = second << 3 | second >> 2;
+        } else {
+            const Int first = high >> (shift + 1) & 0xf, second = high >> (shift - 3) & 0xf;
+            base[0][c] = first << 4 | first;
+            base[1][c] = second << 4 | second;
+        }
+    }
+
+    constexpr Int modifiers[8][2]{
+        {2, 8}, {5, 17}, {9, 29}, {13, 42},
+        {18, 60}, {24, 80}, {33, 106}, {47, 183}};
+    const UnsignedInt tables[]{high >> 5 & 7, high >> 2 & 7};
+    for(Int y = 0; y != 4; ++y) for(Int x = 0; x != 4; ++x) {
+        const std::size_t subblock = flip ? y/2 : x/2;
+        const UnsignedInt k = x*4 + y;
+        const UnsignedInt selector = (low >> (k + 16) & 1) << 1 | (low >> k & 1);
+        const Int magnitude = modifiers[tables[subblock]][selector & 1];
+        const Int modifier = selector & 2 ? -magnitude : magnitude;
+        for(std::size_t c = 0; c != 3; ++c)
+            out[y*4 + x][c] = UnsignedByte(Math::clamp(base[subblock][c] + modifier, 0, 255));
+        out[y*4 + x][3] = 255;
+    }
+
+    return true;
+}
+#endif
+
+/* Maximal difference of given channels of a decoded block against RGBA
+   input image of given width */
+Int maxError(const Block& decoded, const UnsignedByte* image, const Int width, const Int blockX, const Int blockY, const std::size_t channelBegin, const std::size_t channelEnd) {
+    Int error = 0;
+    for(Int y = 0; y != 4; ++y) for(Int x = 0; x != 4; ++x) {
+        const UnsignedByte* pixel = image + ((blockY*4 + y)*width + blockX*4 + x)*4;
+        for(std::size_t c = channelBegin; c != channelEnd; ++c)
+            error = std::max(error, std::abs(Int(decoded[y*4 + x][c]) - Int(pixel[c])));
+    }
+    return error;
+}
+
+/* 8x8 RGBA image with each 4x4 block being a differently oriented gradient */
+std::vector<UnsignedByte> gradientImage() {
+    std::vector<UnsignedByte> data(8*8*4);
+    for(Int y = 0; y != 8; ++y) for(Int x = 0; x != 8; ++x) {
+        UnsignedByte* pixel = data.data() + (y*8 + x)*4;
+        const Int t = (x%4)*3 + (y%4)*2 + (x/4)*((y%4) - (x%4));
+        pixel[0] = UnsignedByte(40 + t*12);
+        pixel[1] = UnsignedByte(200 - t*9);
+        pixel[2] = UnsignedByte(90 + t*5 + (y/4)*30);
+        pixel[3] = UnsignedByte(255 - t*14);
+    }
+    return data;
+}
+
+}
+
+void CompressTest::dataSize() {
+    CORRADE_VERIFY(isCompressionSupported(CompressedColorFormat::RGBS3tcDxt1));
+    CORRADE_VERIFY(!isCompressionSupported(CompressedColorFormat::RGBAS3tcDxt3));
+    CORRADE_VERIFY(isCompressionSupported(ColorFormat::RGBA, ColorType::UnsignedByte));
+    CORRADE_VERIFY(!isCompressionSupported(ColorFormat::RGBA, ColorType::Float));
+    CORRADE_VERIFY(!isCompressionSupported(ColorFormat::DepthComponent, ColorType::UnsignedByte));
+
+    CORRADE_COMPARE(compressedDataSize(CompressedColorFormat::RGBS3tcDxt1, {8, 8}), 32);
+    CORRADE_COMPARE(compressedDataSize(CompressedColorFormat::RGBAS3tcDxt5, {8, 8}), 64);
+    CORRADE_COMPARE(compressedDataSize(CompressedColorFormat::RGBS3tcDxt1, {5, 9}), 48);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(compressedDataSize(CompressedColorFormat::RedRgtc1, {4, 4}), 8);
+    CORRADE_COMPARE(compressedDataSize(CompressedColorFormat::RGRgtc2, {4, 4}), 16);
+    CORRADE_COMPARE(compressedDataSize(CompressedColorFormat::RGBABptcUnorm, {4, 4}), 16);
+    #endif
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_COMPARE(compressedDataSize(CompressedColorFormat::RGB8Etc2, {4, 4}), 8);
+    #endif
+}
+
+void CompressTest::bc1Solid() {
+    /* Exactly representable in 5:6:5 */
+    UnsignedByte data[16*3];
+    for(std::size_t i = 0; i != 16; ++i) {
+        data[i*3 + 0] = 0x84;
+        data[i*3 + 1] = 0x41;
+        data[i*3 + 2] = 0xff;
+    }
+
+    Trade::CompressedImageData2D out = compress(ImageReference2D{ColorFormat::RGB, ColorType::UnsignedByte, {4, 4}, data}, CompressedColorFormat::RGBS3tcDxt1);
+    CORRADE_COMPARE(out.format(), CompressedColorFormat::RGBS3tcDxt1);
+    CORRADE_COMPARE(out.size(), Vector2i(4, 4));
+    CORRADE_COMPARE(out.data().size(), 8);
+
+    Block decoded;
+    decodeBc1(reinterpret_cast<const UnsignedByte*>(out.data().data()), decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_COMPARE(Int(decoded[i][0]), 0x84);
+        CORRADE_COMPARE(Int(decoded[i][1]), 0x41);
+        CORRADE_COMPARE(Int(decoded[i][2]), 0xff);
+    }
+}
+
+void CompressTest::bc1Gradient() {
+    const std::vector<UnsignedByte> data = gradientImage();
+    Trade::CompressedImageData2D out = compress(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {8, 8}, data.data()}, CompressedColorFormat::RGBS3tcDxt1);
+    CORRADE_COMPARE(out.data().size(), 32);
+
+    const auto blocks = reinterpret_cast<const UnsignedByte*>(out.data().data());
+    for(Int y = 0; y != 2; ++y) for(Int x = 0; x != 2; ++x) {
+        Block decoded;
+        decodeBc1(blocks + (y*2 + x)*8, decoded);
+        CORRADE_VERIFY(maxError(decoded, data.data(), 8, x, y, 0, 3) <= 32);
+        for(std::size_t i = 0; i != 16; ++i)
+            CORRADE_COMPARE(Int(decoded[i][3]), 255);
+    }
+}
+
+void CompressTest::bc1PunchThrough() {
+    UnsignedByte data[16*4];
+    for(std::size_t i = 0; i != 16; ++i) {
+        data[i*4 + 0] = UnsignedByte(i*16);
+        data[i*4 + 1] = 0x80;
+        data[i*4 + 2] = UnsignedByte(255 - i*16);
+        data[i*4 + 3] = i%3 ? 255 : 0;
+    }
+
+    Trade::CompressedImageData2D out = compress(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {4, 4}, data}, CompressedColorFormat::RGBAS3tcDxt1);
+
+    Block decoded;
+    decodeBc1(reinterpret_cast<const UnsignedByte*>(out.data().data()), decoded);
+    for(std::size_t i = 0; i != 16; ++i)
+        CORRADE_COMPARE(Int(decoded[i][3]), Int(data[i*4 + 3]));
+
+    /* Fully transparent block */
+    for(std::size_t i = 0; i != 16; ++i) data[i*4 + 3] = 0;
+    out = compress(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {4, 4}, data}, CompressedColorFormat::RGBAS3tcDxt1);
+    decodeBc1(reinterpret_cast<const UnsignedByte*>(out.data().data()), decoded);
+    for(std::size_t i = 0; i != 16; ++i)
+        CORRADE_COMPARE(Int(decoded[i][3]), 0);
+}
+
+void CompressTest::bc3() {
+    const std::vector<UnsignedByte> data = gradientImage();
+    Trade::CompressedImageData2D out = compress(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {8, 8}, data.data()}, CompressedColorFormat::RGBAS3tcDxt5);
+    CORRADE_COMPARE(out.data().size(), 64);
+
+    const auto blocks = reinterpret_cast<const UnsignedByte*>(out.data().data());
+    for(Int y = 0; y != 2; ++y) for(Int x = 0; x != 2; ++x) {
+        Block decoded;
+        decodeBc1(blocks + (y*2 + x)*16 + 8, decoded);
+        decodeBc4(blocks + (y*2 + x)*16, decoded, 3);
+        CORRADE_VERIFY(maxError(decoded, data.data(), 8, x, y, 0, 3) <= 32);
+        CORRADE_VERIFY(maxError(decoded, data.data(), 8, x, y, 3, 4) <= 12);
+    }
+}
+
+#ifndef MAGNUM_TARGET_GLES
+void CompressTest::bc4() {
+    /* Contains both extremes, so the six-value mode represents these
+       exactly */
+    UnsignedByte data[16];
+    for(std::size_t i = 0; i != 16; ++i) data[i] = UnsignedByte(100 + i*5);
+    data[3] = 0;
+    data[12] = 255;
+
+    Trade::CompressedImageData2D out = compress(ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, {4, 4}, data}, CompressedColorFormat::RedRgtc1);
+    CORRADE_COMPARE(out.data().size(), 8);
+
+    Block decoded;
+    decodeBc4(reinterpret_cast<const UnsignedByte*>(out.data().data()), decoded, 0);
+    CORRADE_COMPARE(Int(decoded[3][0]), 0);
+    CORRADE_COMPARE(Int(decoded[12][0]), 255);
+    for(std::size_t i = 0; i != 16; ++i)
+        CORRADE_VERIFY(std::abs(Int(decoded[i][0]) - Int(data[i])) <= 8);
+}
+
+void CompressTest::bc5() {
+    const std::vector<UnsignedByte> data = gradientImage();
+    Trade::CompressedImageData2D out = compress(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {8, 8}, data.data()}, CompressedColorFormat::RGRgtc2);
+    CORRADE_COMPARE(out.data().size(), 64);
+
+    const auto blocks = reinterpret_cast<const UnsignedByte*>(out.data().data());
+    for(Int y = 0; y != 2; ++y) for(Int x = 0; x != 2; ++x) {
+        Block decoded;
+        decodeBc4(blocks + (y*2 + x)*16, decoded, 0);
+        decodeBc4(blocks + (y*2 + x)*16 + 8, decoded, 1);
+        CORRADE_VERIFY(maxError(decoded, data.data(), 8, x, y, 0, 2) <= 12);
+    }
+}
+
+void CompressTest::bc7() {
+    const std::vector<UnsignedByte> data = gradientImage();
+    Trade::CompressedImageData2D out = compress(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {8, 8}, data.data()}, CompressedColorFormat::RGBABptcUnorm);
+    CORRADE_COMPARE(out.data().size(), 64);
+
+    const auto blocks = reinterpret_cast<const UnsignedByte*>(out.data().data());
+    for(Int y = 0; y != 2; ++y) for(Int x = 0; x != 2; ++x) {
+        Block decoded;
+        CORRADE_VERIFY(decodeBc7(blocks + (y*2 + x)*16, decoded));
+        CORRADE_VERIFY(maxError(decoded, data.data(), 8, x, y, 0, 4) <= 12);
+    }
+}
+#endif
+
+#ifndef MAGNUM_TARGET_GLES2
+void CompressTest::etc2() {
+    /* ETC modifies all channels by the same amount, so the gradients go
+       along the luminance axis */
+    std::vector<UnsignedByte> data(8*8*3);
+    for(Int y = 0; y != 8; ++y) for(Int x = 0; x != 8; ++x) {
+        UnsignedByte* pixel = data.data() + (y*8 + x)*3;
+        const Int t = (x/4 ? y%4 : x%4)*12 + (y/4)*40;
+        pixel[0] = UnsignedByte(30 + t);
+        pixel[1] = UnsignedByte(90 + t);
+        pixel[2] = UnsignedByte(60 + t);
+    }
+
+    Trade::CompressedImageData2D out = compress(ImageReference2D{ColorFormat::RGB, ColorType::UnsignedByte, {8, 8}, data.data()}, CompressedColorFormat::RGB8Etc2);
+    CORRADE_COMPARE(out.data().size(), 32);
+
+    const auto blocks = reinterpret_cast<const UnsignedByte*>(out.data().data());
+    for(Int y = 0; y != 2; ++y) for(Int x = 0; x != 2; ++x) {
+        Block decoded;
+        CORRADE_VERIFY(decodeEtc(blocks + (y*2 + x)*8, decoded));
+        for(Int i = 0; i != 16; ++i) {
+            const UnsignedByte* pixel = data.data() + ((y*4 + i/4)*8 + x*4 + i%4)*3;
+            for(std::size_t c = 0; c != 3; ++c)
+                CORRADE_VERIFY(std::abs(Int(decoded[i][c]) - Int(pixel[c])) <= 12);
+        }
+    }
+}
+#endif
+
+void CompressTest::edgePadding() {
+    /* 5x3 image, the second block column contains only the last image column
+       and all blocks lack the last row */
+    UnsignedByte data[5*3*4];
+    for(std::size_t i = 0; i != 5*3; ++i) {
+        data[i*4 + 0] = i%5 == 4 ? 255 : 0;
+        data[i*4 + 1] = i%5 == 4 ? 0 : 255;
+        data[i*4 + 2] = 0;
+        data[i*4 + 3] = 255;
+    }
+
+    Trade::CompressedImageData2D out = compress(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {5, 3}, data}, CompressedColorFormat::RGBS3tcDxt1);
+    CORRADE_COMPARE(out.size(), Vector2i(5, 3));
+    CORRADE_COMPARE(out.data().size(), 16);
+
+    /* Padding repeats the edge pixels, so both blocks are uniform */
+    Block decoded;
+    decodeBc1(reinterpret_cast<const UnsignedByte*>(out.data().data()), decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_COMPARE(Int(decoded[i][0]), 0);
+        CORRADE_COMPARE(Int(decoded[i][1]), 255);
+    }
+    decodeBc1(reinterpret_cast<const UnsignedByte*>(out.data().data()) + 8, decoded);
+    for(std::size_t i = 0; i != 16; ++i) {
+        CORRADE_COMPARE(Int(decoded[i][0]), 255);
+        CORRADE_COMPARE(Int(decoded[i][1]), 0);
+    }
+}
+
+void CompressTest::parallel() {
+    std::vector<UnsignedByte> data(37*29*4);
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = UnsignedByte(i*7 + i/97);
+    const ImageReference2D image{ColorFormat::RGBA, ColorType::UnsignedByte, {37, 29}, data.data()};
+
+    TaskScheduler serial{1}, threaded{4};
+    Trade::CompressedImageData2D a = compress(image, CompressedColorFormat::RGBAS3tcDxt5, serial);
+    Trade::CompressedImageData2D b = compress(image, CompressedColorFormat::RGBAS3tcDxt5, threaded);
+    CORRADE_COMPARE(a.data().size(), 10*8*16);
+    CORRADE_COMPARE(b.data().size(), a.data().size());
+    for(std::size_t i = 0; i != a.data().size(); ++i)
+        CORRADE_COMPARE(Int(b.data()[i]), Int(a.data()[i]));
+}
+
+void CompressTest::unsupported() {
+    const Float floats[16]{};
+    const UnsignedByte bytes[16*4]{};
+    char output[16];
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    compress(ImageReference2D{ColorFormat::Red, ColorType::Float, {4, 4}, floats}, CompressedColorFormat::RGBS3tcDxt1, output);
+    compress(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {4, 4}, bytes}, CompressedColorFormat::RGBAS3tcDxt3, output);
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::compress(): unsupported image format ColorFormat::Red ColorType::Float\n"
+        "TextureTools::compress(): unsupported compressed format CompressedColorFormat::RGBAS3tcDxt3\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::CompressTest)
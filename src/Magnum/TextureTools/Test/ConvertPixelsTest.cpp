@@ -0,0 +1,208 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/TextureTools/ConvertPixels.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct ConvertPixelsTest: TestSuite::Tester {
+    explicit ConvertPixelsTest();
+
+    void copy();
+    void swizzle();
+    void swizzleInPlace();
+    void expand();
+    void premultiply();
+    void premultiplySwizzle();
+    void missingChannels();
+    void srgbToLinearFloat();
+    void linearFloatToSrgb();
+    void threaded();
+};
+
+ConvertPixelsTest::ConvertPixelsTest() {
+    addTests({&ConvertPixelsTest::copy,
+              &ConvertPixelsTest::swizzle,
+              &ConvertPixelsTest::swizzleInPlace,
+              &ConvertPixelsTest::expand,
+              &ConvertPixelsTest::premultiply,
+              &ConvertPixelsTest::premultiplySwizzle,
+              &ConvertPixelsTest::missingChannels,
+              &ConvertPixelsTest::srgbToLinearFloat,
+              &ConvertPixelsTest::linearFloatToSrgb,
+              &ConvertPixelsTest::threaded});
+}
+
+/* Wide enough to go through both the SIMD and the scalar code for both SSE
+   and NEON */
+enum: std::size_t { Width = 19 };
+
+void ConvertPixelsTest::copy() {
+    UnsignedByte data[Width*4];
+    for(std::size_t i = 0; i != Width*4; ++i) data[i] = UnsignedByte(i*3);
+
+    Image2D out = convertPixels(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {Width, 1}, data}, ColorFormat::RGBA, ColorType::UnsignedByte);
+    CORRADE_COMPARE(out.size(), Vector2i(Width, 1));
+    CORRADE_COMPARE(out.format(), ColorFormat::RGBA);
+    CORRADE_COMPARE(out.type(), ColorType::UnsignedByte);
+
+    const auto result = reinterpret_cast<const UnsignedByte*>(out.data());
+    for(std::size_t i = 0; i != Width*4; ++i)
+        CORRADE_COMPARE(Int(result[i]), Int(data[i]));
+}
+
+void ConvertPixelsTest::swizzle() {
+    UnsignedByte data[Width*4];
+    for(std::size_t i = 0; i != Width*4; ++i) data[i] = UnsignedByte(i*3);
+
+    Image2D out = convertPixels(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {Width, 1}, data}, ColorFormat::BGRA, ColorType::UnsignedByte);
+    CORRADE_COMPARE(out.format(), ColorFormat::BGRA);
+
+    const auto result = reinterpret_cast<const UnsignedByte*>(out.data());
+    for(std::size_t x = 0; x != Width; ++x) {
+        CORRADE_COMPARE(Int(result[x*4 + 0]), Int(data[x*4 + 2]));
+        CORRADE_COMPARE(Int(result[x*4 + 1]), Int(data[x*4 + 1]));
+        CORRADE_COMPARE(Int(result[x*4 + 2]), Int(data[x*4 + 0]));
+        CORRADE_COMPARE(Int(result[x*4 + 3]), Int(data[x*4 + 3]));
+    }
+}
+
+void ConvertPixelsTest::swizzleInPlace() {
+    UnsignedByte data[Width*4];
+    for(std::size_t i = 0; i != Width*4; ++i) data[i] = UnsignedByte(i*3);
+
+    convertPixels(ImageReference2D{ColorFormat::BGRA, ColorType::UnsignedByte, {Width, 1}, data}, ColorFormat::RGBA, ColorType::UnsignedByte, reinterpret_cast<char*>(data));
+
+    for(std::size_t x = 0; x != Width; ++x) {
+        CORRADE_COMPARE(Int(data[x*4 + 0]), Int(UnsignedByte((x*4 + 2)*3)));
+        CORRADE_COMPARE(Int(data[x*4 + 1]), Int(UnsignedByte((x*4 + 1)*3)));
+        CORRADE_COMPARE(Int(data[x*4 + 2]), Int(UnsignedByte((x*4 + 0)*3)));
+        CORRADE_COMPARE(Int(data[x*4 + 3]), Int(UnsignedByte((x*4 + 3)*3)));
+    }
+}
+
+void ConvertPixelsTest::expand() {
+    /* Rows of the input are padded to 60 bytes */
+    UnsignedByte data[60*2]{};
+    for(std::size_t y = 0; y != 2; ++y)
+        for(std::size_t i = 0; i != Width*3; ++i)
+            data[y*60 + i] = UnsignedByte(y*100 + i);
+
+    Image2D out = convertPixels(ImageReference2D{ColorFormat::RGB, ColorType::UnsignedByte, {Width, 2}, data}, ColorFormat::RGBA, ColorType::UnsignedByte);
+
+    const auto result = reinterpret_cast<const UnsignedByte*>(out.data());
+    for(std::size_t y = 0; y != 2; ++y) for(std::size_t x = 0; x != Width; ++x) {
+        CORRADE_COMPARE(Int(result[(y*Width + x)*4 + 0]), Int(data[y*60 + x*3 + 0]));
+        CORRADE_COMPARE(Int(result[(y*Width + x)*4 + 1]), Int(data[y*60 + x*3 + 1]));
+        CORRADE_COMPARE(Int(result[(y*Width + x)*4 + 2]), Int(data[y*60 + x*3 + 2]));
+        CORRADE_COMPARE(Int(result[(y*Width + x)*4 + 3]), 255);
+    }
+}
+
+void ConvertPixelsTest::premultiply() {
+    UnsignedByte data[Width*4];
+    for(std::size_t i = 0; i != Width*4; ++i) data[i] = UnsignedByte(i*13 + 7);
+
+    Image2D out = convertPixels(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {Width, 1}, data}, ColorFormat::RGBA, ColorType::UnsignedByte, PixelConversion::Premultiply);
+
+    const auto result = reinterpret_cast<const UnsignedByte*>(out.data());
+    for(std::size_t x = 0; x != Width; ++x) {
+        for(std::size_t c = 0; c != 3; ++c)
+            CORRADE_COMPARE(Int(result[x*4 + c]), Int(std::round(data[x*4 + c]*data[x*4 + 3]/255.0)));
+        CORRADE_COMPARE(Int(result[x*4 + 3]), Int(data[x*4 + 3]));
+    }
+}
+
+void ConvertPixelsTest::premultiplySwizzle() {
+    const UnsignedByte data[] = {255, 128, 0, 128};
+
+    Image2D out = convertPixels(ImageReference2D{ColorFormat::BGRA, ColorType::UnsignedByte, {1, 1}, data}, ColorFormat::RGBA, ColorType::UnsignedByte, PixelConversion::Premultiply);
+
+    const auto result = reinterpret_cast<const UnsignedByte*>(out.data());
+    CORRADE_COMPARE(Int(result[0]), 0);
+    CORRADE_COMPARE(Int(result[1]), 64);
+    CORRADE_COMPARE(Int(result[2]), 128);
+    CORRADE_COMPARE(Int(result[3]), 128);
+}
+
+void ConvertPixelsTest::missingChannels() {
+    const UnsignedByte data[] = {51, 102, 0, 0};
+
+    Image2D out = convertPixels(ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, {2, 1}, data}, ColorFormat::RGBA, ColorType::Float);
+
+    const auto result = reinterpret_cast<const Float*>(out.data());
+    CORRADE_COMPARE(result[0], 0.2f);
+    CORRADE_COMPARE(result[1], 0.0f);
+    CORRADE_COMPARE(result[2], 0.0f);
+    CORRADE_COMPARE(result[3], 1.0f);
+    CORRADE_COMPARE(result[4], 0.4f);
+}
+
+void ConvertPixelsTest::srgbToLinearFloat() {
+    const UnsignedByte data[] = {0, 188, 255, 188};
+
+    Image2D out = convertPixels(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {1, 1}, data}, ColorFormat::RGBA, ColorType::Float, PixelConversion::SrgbToLinear);
+
+    /* Alpha is not affected */
+    const auto result = reinterpret_cast<const Float*>(out.data());
+    CORRADE_COMPARE(result[0], 0.0f);
+    CORRADE_VERIFY(std::abs(result[1] - 0.5f) < 0.01f);
+    CORRADE_COMPARE(result[2], 1.0f);
+    CORRADE_COMPARE(result[3], 188/255.0f);
+}
+
+void ConvertPixelsTest::linearFloatToSrgb() {
+    const Float data[] = {0.0f, 0.5f, 1.0f, 0.5f};
+
+    Image2D out = convertPixels(ImageReference2D{ColorFormat::RGBA, ColorType::Float, {1, 1}, data}, ColorFormat::RGBA, ColorType::UnsignedByte, PixelConversion::LinearToSrgb);
+
+    const auto result = reinterpret_cast<const UnsignedByte*>(out.data());
+    CORRADE_COMPARE(Int(result[0]), 0);
+    CORRADE_COMPARE(Int(result[1]), 188);
+    CORRADE_COMPARE(Int(result[2]), 255);
+    CORRADE_COMPARE(Int(result[3]), 128);
+}
+
+void ConvertPixelsTest::threaded() {
+    std::vector<UnsignedByte> data(Width*37*4);
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = UnsignedByte(i*7);
+    const ImageReference2D image{ColorFormat::BGRA, ColorType::UnsignedByte, {Width, 37}, data.data()};
+
+    Image2D single = convertPixels(image, ColorFormat::RGBA, ColorType::UnsignedByte, PixelConversion::Premultiply);
+    Image2D threaded = convertPixels(image, ColorFormat::RGBA, ColorType::UnsignedByte, PixelConversion::Premultiply, 4);
+
+    const auto a = reinterpret_cast<const UnsignedByte*>(single.data());
+    const auto b = reinterpret_cast<const UnsignedByte*>(threaded.data());
+    for(std::size_t i = 0; i != data.size(); ++i)
+        CORRADE_COMPARE(Int(b[i]), Int(a[i]));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::ConvertPixelsTest)
@@ -0,0 +1,271 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/ImageReference.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/TextureTools/DistanceField.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct DistanceFieldTest: TestSuite::Tester {
+    explicit DistanceFieldTest();
+
+    void cpu();
+    void cpuDownscale();
+    void cpuMultipleChannels();
+    void cpuMultithreaded();
+    void cpuWrongType();
+
+    void multichannel();
+    void multichannelSharpCorners();
+    void multichannelHole();
+    void multichannelMultithreaded();
+};
+
+DistanceFieldTest::DistanceFieldTest() {
+    addTests({&DistanceFieldTest::cpu,
+              &DistanceFieldTest::cpuDownscale,
+              &DistanceFieldTest::cpuMultipleChannels,
+              &DistanceFieldTest::cpuMultithreaded,
+              &DistanceFieldTest::cpuWrongType,
+
+              &DistanceFieldTest::multichannel,
+              &DistanceFieldTest::multichannelSharpCorners,
+              &DistanceFieldTest::multichannelHole,
+              &DistanceFieldTest::multichannelMultithreaded});
+}
+
+namespace {
+
+/* Circle and a rectangle, rows aligned to four bytes */
+std::vector<UnsignedByte> binaryImage(const Vector2i& size, const std::size_t pixelSize) {
+    const std::size_t rowSize = ((size.x()*pixelSize + 3)/4)*4;
+    std::vector<UnsignedByte> data(rowSize*size.y());
+    for(Int y = 0; y != size.y(); ++y) for(Int x = 0; x != size.x(); ++x) {
+        const Vector2 position = Vector2(x, y)/Vector2(size);
+        const bool inside = (position - Vector2{0.35f, 0.4f}).dot() < 0.06f ||
+            (position.x() > 0.6f && position.x() < 0.9f && position.y() > 0.2f && position.y() < 0.85f);
+        data[y*rowSize + x*pixelSize] = inside ? 255 : 0;
+    }
+    return data;
+}
+
+/* Brute-force lookup, the same as the GPU implementation does */
+std::vector<UnsignedByte> bruteForce(const std::vector<UnsignedByte>& input, const Vector2i& inputSize, const std::size_t pixelSize, const Vector2i& outputSize, const Int radius) {
+    const std::size_t inputRowSize = ((inputSize.x()*pixelSize + 3)/4)*4;
+    const std::size_t outputRowSize = ((outputSize.x() + 3)/4)*4;
+    const Vector2 scaling = Vector2(inputSize)/Vector2(outputSize);
+    auto inside = [&](Int x, Int y) { return input[y*inputRowSize + x*pixelSize] > 127; };
+
+    std::vector<UnsignedByte> output(outputRowSize*outputSize.y());
+    for(Int j = 0; j != outputSize.y(); ++j) for(Int i = 0; i != outputSize.x(); ++i) {
+        const Int x = Int(i*scaling.x()), y = Int(j*scaling.y());
+        const bool isInside = inside(x, y);
+        Int minDistanceSquared = (radius + 1)*(radius + 1);
+        for(Int v = 0; v != inputSize.y(); ++v) for(Int u = 0; u != inputSize.x(); ++u)
+            if(inside(u, v) != isInside)
+                minDistanceSquared = Math::min(minDistanceSquared, (u - x)*(u - x) + (v - y)*(v - y));
+
+        const Float distance = std::sqrt(Float(minDistanceSquared));
+        const Float value = (isInside ? distance : -distance)/Float(radius*2 + 2) + 0.5f;
+        output[j*outputRowSize + i] = UnsignedByte(Math::round(value*255.0f));
+    }
+
+    return output;
+}
+
+std::vector<UnsignedByte> imageData(const Image2D& image) {
+    return std::vector<UnsignedByte>(image.data<UnsignedByte>(), image.data<UnsignedByte>() + image.dataSize(image.size()));
+}
+
+/* Square with sharp corners, counterclockwise */
+const std::vector<std::vector<Vector2>> square{{{5.0f, 4.0f}, {19.0f, 4.0f}, {19.0f, 18.0f}, {5.0f, 18.0f}}};
+
+Float median(const Vector3& value) {
+    return Math::max(Math::min(value.x(), value.y()), Math::min(Math::max(value.x(), value.y()), value.z()));
+}
+
+/* Bilinearly interpolated RGB value at given position in pixel coordinates */
+Vector3 sample(const Image2D& image, const Vector2& position) {
+    const std::size_t rowSize = ((image.size().x()*3 + 3)/4)*4;
+    auto pixel = [&](Int x, Int y) {
+        x = Math::clamp(x, 0, image.size().x() - 1);
+        y = Math::clamp(y, 0, image.size().y() - 1);
+        const UnsignedByte* const data = image.data<UnsignedByte>() + y*rowSize + x*3;
+        return Vector3(data[0], data[1], data[2])/255.0f;
+    };
+
+    const Vector2 p = position - Vector2{0.5f};
+    const Int x = Int(std::floor(p.x())), y = Int(std::floor(p.y()));
+    const Vector2 t = p - Vector2(x, y);
+    return Math::lerp(Math::lerp(pixel(x, y), pixel(x + 1, y), t.x()),
+                      Math::lerp(pixel(x, y + 1), pixel(x + 1, y + 1), t.x()), t.y());
+}
+
+}
+
+void DistanceFieldTest::cpu() {
+    const Vector2i size{23, 17};
+    const std::vector<UnsignedByte> input = binaryImage(size, 1);
+
+    const Image2D output = distanceField(ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, size, input.data()}, size, 4);
+    CORRADE_COMPARE(output.format(), ColorFormat::Red);
+    CORRADE_COMPARE(output.type(), ColorType::UnsignedByte);
+    CORRADE_COMPARE(output.size(), size);
+    CORRADE_COMPARE(imageData(output), bruteForce(input, size, 1, size, 4));
+}
+
+void DistanceFieldTest::cpuDownscale() {
+    const Vector2i size{64, 48};
+    const std::vector<UnsignedByte> input = binaryImage(size, 1);
+
+    const Image2D output = distanceField(ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, size, input.data()}, {13, 12}, 10);
+    CORRADE_COMPARE(output.size(), Vector2i(13, 12));
+    CORRADE_COMPARE(imageData(output), bruteForce(input, size, 1, {13, 12}, 10));
+}
+
+void DistanceFieldTest::cpuMultipleChannels() {
+    /* Only the red channel is taken into account */
+    const Vector2i size{21, 16};
+    const std::vector<UnsignedByte> input = binaryImage(size, 3);
+
+    const Image2D output = distanceField(ImageReference2D{ColorFormat::RGB, ColorType::UnsignedByte, size, input.data()}, size, 3);
+    CORRADE_COMPARE(imageData(output), bruteForce(input, size, 3, size, 3));
+}
+
+void DistanceFieldTest::cpuMultithreaded() {
+    const Vector2i size{64, 48};
+    const std::vector<UnsignedByte> input = binaryImage(size, 1);
+    const ImageReference2D image{ColorFormat::Red, ColorType::UnsignedByte, size, input.data()};
+
+    /* More threads than rows shouldn't be a problem either */
+    CORRADE_COMPARE(imageData(distanceField(image, {32, 24}, 6, 3)),
+        imageData(distanceField(image, {32, 24}, 6)));
+    CORRADE_COMPARE(imageData(distanceField(image, {32, 24}, 6, 100)),
+        imageData(distanceField(image, {32, 24}, 6)));
+}
+
+void DistanceFieldTest::cpuWrongType() {
+    const Float data[4]{};
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    distanceField(ImageReference2D{ColorFormat::Red, ColorType::Float, {2, 2}, data}, {2, 2}, 1);
+    distanceField(ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, {2, 2}, data}, {2, 2}, 1, 0);
+    CORRADE_COMPARE(out.str(),
+        "TextureTools::distanceField(): expected image with ColorType::UnsignedByte components but got ColorType::Float\n"
+        "TextureTools::distanceField(): expected at least one thread\n");
+}
+
+void DistanceFieldTest::multichannel() {
+    const Image2D output = multichannelDistanceField(square, {24, 22}, 3.0f);
+    CORRADE_COMPARE(output.format(), ColorFormat::RGB);
+    CORRADE_COMPARE(output.type(), ColorType::UnsignedByte);
+    CORRADE_COMPARE(output.size(), Vector2i(24, 22));
+
+    /* Median gives correct inside information for every pixel, far inside
+       and outside the values are saturated */
+    Int wrong = 0;
+    for(Int y = 0; y != 22; ++y) for(Int x = 0; x != 24; ++x) {
+        const bool inside = x >= 5 && x < 19 && y >= 4 && y < 18;
+        if((median(sample(output, {x + 0.5f, y + 0.5f})) > 0.5f) != inside)
+            ++wrong;
+    }
+    CORRADE_COMPARE(wrong, 0);
+    CORRADE_COMPARE(sample(output, {12.0f, 11.0f}), Vector3(1.0f));
+    CORRADE_COMPARE(sample(output, {0.5f, 21.5f}), Vector3(0.0f));
+}
+
+void DistanceFieldTest::multichannelSharpCorners() {
+    /* Four times lower resolution, the corners are inside a pixel */
+    const Float scaling = 0.25f;
+    std::vector<std::vector<Vector2>> contours{{}};
+    for(const Vector2& point: square[0]) contours[0].push_back(point*scaling);
+    const Image2D output = multichannelDistanceField(contours, {6, 6}, 1.0f);
+
+    /* Exact signed distance to the same square, i.e. what single-channel
+       distance field stores, at the same resolution */
+    const std::size_t rowSize = ((6*3 + 3)/4)*4;
+    std::vector<UnsignedByte> singleChannelData(rowSize*6);
+    for(Int y = 0; y != 6; ++y) for(Int x = 0; x != 6; ++x) {
+        const Vector2 p{x + 0.5f, y + 0.5f};
+        const Vector2 min = square[0][0]*scaling, max = square[0][2]*scaling;
+        const Vector2 outside = Math::max(Math::max(min - p, p - max), Vector2{0.0f});
+        const Float inside = Math::min(Math::min(p - min, max - p).min(), 0.0f);
+        const Float distance = outside.dot() > 0.0f ? -outside.length() : -inside;
+        const Float value = Math::clamp(distance/2.0f + 0.5f, 0.0f, 1.0f);
+        for(std::size_t i = 0; i != 3; ++i)
+            singleChannelData[y*rowSize + x*3 + i] = UnsignedByte(Math::round(value*255.0f));
+    }
+    Image2D singleChannel{ColorFormat::RGB, ColorType::UnsignedByte, {6, 6}, new char[rowSize*6]};
+    std::copy(singleChannelData.begin(), singleChannelData.end(), singleChannel.data<UnsignedByte>());
+
+    /* Reconstruct the shape at the original resolution. Single-channel field
+       rounds the corners, multichannel preserves them. */
+    Int wrongMultichannel = 0, wrongSingleChannel = 0;
+    for(Int y = 0; y != 22; ++y) for(Int x = 0; x != 24; ++x) {
+        const Vector2 position = Vector2{x + 0.5f, y + 0.5f}*scaling;
+        const bool inside = x >= 5 && x < 19 && y >= 4 && y < 18;
+        if((median(sample(output, position)) > 0.5f) != inside)
+            ++wrongMultichannel;
+        if((median(sample(singleChannel, position)) > 0.5f) != inside)
+            ++wrongSingleChannel;
+    }
+    CORRADE_COMPARE(wrongMultichannel, 0);
+    CORRADE_VERIFY(wrongSingleChannel > 0);
+}
+
+void DistanceFieldTest::multichannelHole() {
+    /* Square with a clockwise hole in the middle */
+    std::vector<std::vector<Vector2>> contours = square;
+    contours.push_back({{9.0f, 8.0f}, {9.0f, 14.0f}, {15.0f, 14.0f}, {15.0f, 8.0f}});
+    const Image2D output = multichannelDistanceField(contours, {24, 22}, 2.0f);
+
+    Int wrong = 0;
+    for(Int y = 0; y != 22; ++y) for(Int x = 0; x != 24; ++x) {
+        const bool inside = x >= 5 && x < 19 && y >= 4 && y < 18 &&
+            !(x >= 9 && x < 15 && y >= 8 && y < 14);
+        if((median(sample(output, {x + 0.5f, y + 0.5f})) > 0.5f) != inside)
+            ++wrong;
+    }
+    CORRADE_COMPARE(wrong, 0);
+    CORRADE_COMPARE(sample(output, {12.0f, 11.0f}), Vector3(0.0f));
+}
+
+void DistanceFieldTest::multichannelMultithreaded() {
+    CORRADE_COMPARE(imageData(multichannelDistanceField(square, {24, 22}, 3.0f, 4)),
+        imageData(multichannelDistanceField(square, {24, 22}, 3.0f)));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DistanceFieldTest)
@@ -0,0 +1,148 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/TextureTools/Downsample.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct DownsampleTest: TestSuite::Tester {
+    explicit DownsampleTest();
+
+    void even();
+    void evenPadded();
+    void odd();
+    void srgb();
+    void floatingPoint();
+    void mipmap();
+};
+
+DownsampleTest::DownsampleTest() {
+    addTests({&DownsampleTest::even,
+              &DownsampleTest::evenPadded,
+              &DownsampleTest::odd,
+              &DownsampleTest::srgb,
+              &DownsampleTest::floatingPoint,
+              &DownsampleTest::mipmap});
+}
+
+void DownsampleTest::even() {
+    /* Wide enough to go through both the SIMD and the scalar code */
+    UnsignedByte data[6*2*4];
+    for(std::size_t i = 0; i != 6*4; ++i) {
+        data[i] = UnsignedByte(i*10);
+        data[6*4 + i] = UnsignedByte(i*10 + 1);
+    }
+
+    Image2D out = downsample(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {6, 2}, data});
+    CORRADE_COMPARE(out.size(), Vector2i(3, 1));
+    CORRADE_COMPARE(out.format(), ColorFormat::RGBA);
+
+    const auto result = reinterpret_cast<const UnsignedByte*>(out.data());
+    for(std::size_t x = 0; x != 3; ++x) for(std::size_t c = 0; c != 4; ++c) {
+        const Int expected = (data[x*8 + c] + data[x*8 + 4 + c] + data[6*4 + x*8 + c] + data[6*4 + x*8 + 4 + c] + 2)/4;
+        CORRADE_COMPARE(Int(result[x*4 + c]), expected);
+    }
+}
+
+void DownsampleTest::evenPadded() {
+    /* 2x2 RGB input has rows padded to 8 bytes, 1x1 output to 4 bytes */
+    const UnsignedByte data[] = {
+        10, 20, 30, 50, 60, 70, 0, 0,
+        90, 100, 110, 130, 140, 150, 0, 0
+    };
+
+    Image2D out = downsample(ImageReference2D{ColorFormat::RGB, ColorType::UnsignedByte, {2, 2}, data});
+    CORRADE_COMPARE(out.size(), Vector2i(1, 1));
+
+    const auto result = reinterpret_cast<const UnsignedByte*>(out.data());
+    CORRADE_COMPARE(Int(result[0]), 70);
+    CORRADE_COMPARE(Int(result[1]), 80);
+    CORRADE_COMPARE(Int(result[2]), 90);
+}
+
+void DownsampleTest::odd() {
+    /* Each of the three input pixels contributes, the middle one to both
+       output pixels */
+    const UnsignedByte data[] = {0, 90, 180, 0};
+
+    Image2D out = downsample(ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, {3, 1}, data});
+    CORRADE_COMPARE(out.size(), Vector2i(1, 1));
+    CORRADE_COMPARE(Int(reinterpret_cast<const UnsignedByte*>(out.data())[0]), 90);
+
+    const UnsignedByte data2[] = {30, 90, 150, 0, 60, 120, 180, 0};
+    Image2D out2 = downsample(ImageReference2D{ColorFormat::Red, ColorType::UnsignedByte, {3, 2}, data2});
+    CORRADE_COMPARE(out2.size(), Vector2i(1, 1));
+    CORRADE_COMPARE(Int(reinterpret_cast<const UnsignedByte*>(out2.data())[0]), 105);
+}
+
+void DownsampleTest::srgb() {
+    /* Black and white average to ~188 in sRGB, not 128, alpha is linear */
+    const UnsignedByte data[] = {
+        0, 0, 0, 0, 255, 255, 255, 255,
+        0, 0, 0, 0, 255, 255, 255, 255
+    };
+
+    Image2D out = downsample(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {2, 2}, data}, true);
+    const auto result = reinterpret_cast<const UnsignedByte*>(out.data());
+    CORRADE_COMPARE(Int(result[0]), 188);
+    CORRADE_COMPARE(Int(result[1]), 188);
+    CORRADE_COMPARE(Int(result[2]), 188);
+    CORRADE_COMPARE(Int(result[3]), 128);
+
+    Image2D linear = downsample(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {2, 2}, data});
+    CORRADE_COMPARE(Int(reinterpret_cast<const UnsignedByte*>(linear.data())[0]), 128);
+}
+
+void DownsampleTest::floatingPoint() {
+    const Float data[] = {
+        0.0f, 1.0f, 2.0f, 3.0f, 4.0f,
+        5.0f, 6.0f, 7.0f, 8.0f, 9.0f
+    };
+
+    Image2D out = downsample(ImageReference2D{ColorFormat::Red, ColorType::Float, {5, 2}, data});
+    CORRADE_COMPARE(out.size(), Vector2i(2, 1));
+
+    /* Coverage of 2.5 input pixels per output pixel */
+    const auto result = reinterpret_cast<const Float*>(out.data());
+    CORRADE_COMPARE(result[0], (0.0f + 1.0f + 0.5f*2.0f + 5.0f + 6.0f + 0.5f*7.0f)/5.0f);
+    CORRADE_COMPARE(result[1], (0.5f*2.0f + 3.0f + 4.0f + 0.5f*7.0f + 8.0f + 9.0f)/5.0f);
+}
+
+void DownsampleTest::mipmap() {
+    UnsignedByte data[8*4*4]{};
+    std::vector<Image2D> levels = TextureTools::mipmap(ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {8, 4}, data});
+
+    CORRADE_COMPARE(levels.size(), 3);
+    CORRADE_COMPARE(levels[0].size(), Vector2i(4, 2));
+    CORRADE_COMPARE(levels[1].size(), Vector2i(2, 1));
+    CORRADE_COMPARE(levels[2].size(), Vector2i(1, 1));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DownsampleTest)
@@ -27,6 +27,7 @@
 #include <Corrade/Utility/Directory.h>
 #include <Corrade/PluginManager/Manager.h>
 
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/ColorFormat.h"
 #include "Magnum/Image.h"
@@ -50,6 +51,19 @@
 
 #include "distancefieldconverterConfigure.h"
 
+#ifdef MAGNUM_BUILD_UTILITIES_STATIC_PLUGINS
+/* The bundled plugins are linked in statically and need to be imported from
+   the global namespace */
+static void importStaticPlugins() {
+    #ifdef MAGNUM_WITH_TGAIMPORTER
+    CORRADE_PLUGIN_IMPORT(TgaImporter)
+    #endif
+    #ifdef MAGNUM_WITH_TGAIMAGECONVERTER
+    CORRADE_PLUGIN_IMPORT(TgaImageConverter)
+    #endif
+}
+#endif
+
 namespace Magnum {
 
 /** @page magnum-distancefieldconverter Distance Field conversion utility
@@ -57,7 +71,7 @@ namespace Magnum {
 
 @section magnum-distancefieldconverter-usage Usage
 
-    magnum-distancefieldconverter [-h|--help] [--importer IMPORTER] [--converter CONVERTER] [--plugin-dir DIR] --output-size "X Y" --radius N [--] input output
+    magnum-distancefieldconverter [-h|--help] [--importer IMPORTER] [--converter CONVERTER] [--plugin-dir DIR] [--cpu] [--threads N] --output-size "X Y" --radius N [--] input output
 
 Arguments:
 
@@ -67,7 +81,12 @@ Arguments:
 -   `--importer IMPORTER` -- image importer plugin (default: @ref Trade::TgaImporter "TgaImporter")
 -   `--converter CONVERTER` -- image converter plugin (default: @ref Trade::TgaImageConverter "TgaImageConverter")
 -   `--plugin-dir DIR` -- base plugin dir (defaults to plugin directory in
-    Magnum install location)
+    Magnum install location). If Magnum is built with
+    `BUILD_UTILITIES_STATIC_PLUGINS`, the bundled plugins are linked in
+    statically and no directory is scanned unless this option is set.
+-   `--cpu` -- compute the distance field on the CPU, without creating
+    OpenGL context
+-   `--threads N` -- count of threads used for CPU computation (default: `1`)
 -   `--output-size "X Y"` -- size of output image
 -   `--radius N` -- distance field computation radius
 
@@ -106,24 +125,37 @@ DistanceFieldConverter::DistanceFieldConverter(const Arguments& arguments): Plat
         .addOption("importer", "TgaImporter").setHelp("importer", "image importer plugin")
         .addOption("converter", "TgaImageConverter").setHelp("converter", "image converter plugin")
         .addOption("plugin-dir", MAGNUM_PLUGINS_DIR).setHelpKey("plugin-dir", "DIR").setHelp("plugin-dir", "base plugin dir")
+        .addBooleanOption("cpu").setHelp("cpu", "compute the distance field on the CPU")
+        .addOption("threads", "1").setHelpKey("threads", "N").setHelp("threads", "count of threads used for CPU computation")
         .addNamedArgument("output-size").setHelpKey("output-size", "\"X Y\"").setHelp("output-size", "size of output image")
         .addNamedArgument("radius").setHelpKey("radius", "N").setHelp("radius", "distance field computation radius")
         .setHelp("Converts red channel of an image to distance field representation.")
         .parse(arguments.argc, arguments.argv);
 
-    createContext();
+    /* The CPU implementation doesn't need any context */
+    if(!args.isSet("cpu")) createContext();
 }
 
 int DistanceFieldConverter::exec() {
+    #ifdef MAGNUM_BUILD_UTILITIES_STATIC_PLUGINS
+    importStaticPlugins();
+    #endif
+
+    /* Don't scan any directory if the plugin dir is empty */
+    const std::string pluginDir = args.value("plugin-dir");
+    auto pluginSubdir = [&pluginDir](const std::string& subdir) {
+        return pluginDir.empty() ? std::string{} : Utility::Directory::join(pluginDir, subdir);
+    };
+
     /* Load importer plugin */
-    PluginManager::Manager<Trade::AbstractImporter> importerManager(Utility::Directory::join(args.value("plugin-dir"), "importers/"));
-    if(!(importerManager.load(args.value("importer")) & PluginManager::LoadState::Loaded))
+    PluginManager::Manager<Trade::AbstractImporter> importerManager(pluginSubdir("importers/"));
+    if(!(importerManager.load(args.value("importer")) & (PluginManager::LoadState::Loaded|PluginManager::LoadState::Static)))
         return 1;
     std::unique_ptr<Trade::AbstractImporter> importer = importerManager.instance(args.value("importer"));
 
     /* Load converter plugin */
-    PluginManager::Manager<Trade::AbstractImageConverter> converterManager(Utility::Directory::join(args.value("plugin-dir"), "imageconverters/"));
-    if(!(converterManager.load(args.value("converter")) & PluginManager::LoadState::Loaded))
+    PluginManager::Manager<Trade::AbstractImageConverter> converterManager(pluginSubdir("imageconverters/"));
+    if(!(converterManager.load(args.value("converter")) & (PluginManager::LoadState::Loaded|PluginManager::LoadState::Static)))
         return 1;
     std::unique_ptr<Trade::AbstractImageConverter> converter = converterManager.instance(args.value("converter"));
 
@@ -134,6 +166,18 @@ int DistanceFieldConverter::exec() {
         return 1;
     }
 
+    /* Compute on the CPU, if requested */
+    if(args.isSet("cpu")) {
+        Debug() << "Converting image of size" << image->size() << "to distance field on the CPU...";
+        const Image2D result = TextureTools::distanceField(*image, args.value<Vector2i>("output-size"), args.value<Int>("radius"), Math::max(args.value<UnsignedInt>("threads"), 1u));
+        if(!converter->exportToFile(result, args.value("output"))) {
+            Error() << "Cannot save file" << args.value("output");
+            return 1;
+        }
+
+        return 0;
+    }
+
     /* Decide about internal format */
     TextureFormat internalFormat;
     if(image->format() == ColorFormat::Red) internalFormat = TextureFormat::R8;
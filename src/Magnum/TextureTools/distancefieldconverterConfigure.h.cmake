@@ -23,7 +23,14 @@
     DEALINGS IN THE SOFTWARE.
 */
 
-#ifdef CORRADE_IS_DEBUG_BUILD
+#cmakedefine MAGNUM_BUILD_UTILITIES_STATIC_PLUGINS
+#cmakedefine MAGNUM_WITH_TGAIMPORTER
+#cmakedefine MAGNUM_WITH_TGAIMAGECONVERTER
+
+/* Statically linked plugins don't need any plugin directory to be scanned */
+#ifdef MAGNUM_BUILD_UTILITIES_STATIC_PLUGINS
+#define MAGNUM_PLUGINS_DIR ""
+#elif defined(CORRADE_IS_DEBUG_BUILD)
 #define MAGNUM_PLUGINS_DIR "${MAGNUM_PLUGINS_DEBUG_INSTALL_DIR}"
 #else
 #define MAGNUM_PLUGINS_DIR "${MAGNUM_PLUGINS_INSTALL_DIR}"
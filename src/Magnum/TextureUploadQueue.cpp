@@ -0,0 +1,90 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "TextureUploadQueue.h"
+
+#include <cstring>
+
+#include "Magnum/AbstractTexture.h"
+#include "Magnum/Context.h"
+#include "Implementation/State.h"
+#include "Implementation/TextureState.h"
+
+namespace Magnum {
+
+TextureUploadQueue::TextureUploadQueue(const GLsizeiptr size, const UnsignedInt frameCount): _ring{Buffer::TargetHint::PixelUnpack, size, frameCount} {}
+
+void TextureUploadQueue::beginFrame() {
+    _ring.beginFrame();
+}
+
+bool TextureUploadQueue::setSubImage(AbstractTexture& texture, const Int level, const Vector2i& offset, const ImageReference2D& image) {
+    return stage(texture, 2, level, {offset, 0}, {image.size(), 1}, image, image.data(), image.dataSize(image.size()));
+}
+
+bool TextureUploadQueue::setSubImage(AbstractTexture& texture, const Int level, const Vector3i& offset, const ImageReference3D& image) {
+    return stage(texture, 3, level, offset, image.size(), image, image.data(), image.dataSize(image.size()));
+}
+
+bool TextureUploadQueue::stage(AbstractTexture& texture, const UnsignedInt dimensions, const Int level, const Vector3i& offset, const Vector3i& size, const AbstractImage& image, const char* const data, const std::size_t dataSize) {
+    CORRADE_ASSERT(texture._target != GL_TEXTURE_CUBE_MAP,
+        "TextureUploadQueue::setSubImage(): cube map textures are not supported", false);
+
+    /* Rows in the image are aligned to four bytes, keep the same alignment
+       in the buffer. The image pixel storage is applied when uploading, so
+       the whole data including any skipped pixels are copied. */
+    if(_ring.available(4) < GLsizeiptr(dataSize)) return false;
+
+    const BufferRing::Allocation allocation = _ring.allocate(dataSize, 4);
+    std::memcpy(allocation.data, data, dataSize);
+    _uploads.push_back({&texture, dimensions, level, offset, size, image.storage(), image.format(), image.type(), allocation.offset});
+    return true;
+}
+
+void TextureUploadQueue::endFrame() {
+    /* Unmap the region so GL can read from it */
+    _ring.flush();
+
+    if(!_uploads.empty()) {
+        Implementation::TextureState& textureState = *Context::current()->state().texture;
+        _ring.buffer().bindInternal(Buffer::TargetHint::PixelUnpack);
+
+        for(const Upload& upload: _uploads) {
+            const GLvoid* const data = reinterpret_cast<const GLvoid*>(upload.bufferOffset);
+            upload.storage.applyUnpack();
+            if(upload.dimensions == 2)
+                (upload.texture->*textureState.subImage2DImplementation)(upload.level, upload.offset.xy(), upload.size.xy(), upload.format, upload.type, data);
+            else
+                (upload.texture->*textureState.subImage3DImplementation)(upload.level, upload.offset, upload.size, upload.format, upload.type, data);
+        }
+
+        _uploads.clear();
+    }
+
+    /* Fence the region after the uploads */
+    _ring.endFrame();
+}
+
+}
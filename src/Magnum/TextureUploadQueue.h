@@ -0,0 +1,163 @@
+#ifndef Magnum_TextureUploadQueue_h
+#define Magnum_TextureUploadQueue_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Class @ref Magnum::TextureUploadQueue
+ */
+
+#include <vector>
+
+#include "Magnum/BufferRing.h"
+#include "Magnum/ImageReference.h"
+
+#ifndef MAGNUM_TARGET_GLES2
+namespace Magnum {
+
+/**
+@brief Asynchronous texture upload queue
+
+Streams pixel data to textures through a @ref BufferRing bound as pixel unpack
+buffer. Image data passed to @ref setSubImage() are copied into the mapped
+ring region right away and the actual texture uploads are issued from the
+buffer in @ref endFrame(), after which the region is guarded with a fence.
+The driver can thus perform the transfer asynchronously and the CPU never
+waits on the GPU unless all regions are still in flight. Example usage:
+@code
+TextureUploadQueue queue{4096*2160*4};
+
+// each frame
+queue.beginFrame();
+if(!queue.setSubImage(videoTexture, 0, {}, frame)) {
+    // not enough space, try again next frame
+}
+// ...
+queue.endFrame();
+@endcode
+
+The textures are expected to have immutable storage allocated with
+@ref Texture::setStorage() "*Texture::setStorage()" beforehand and must not
+be destroyed before the next call to @ref endFrame(). Cube map textures are
+not supported, use @ref CubeMapTexture::setSubImage() for these.
+
+Size of one frame region should be large enough to hold all data uploaded in
+a frame, the frame count then specifies how many frames can be in flight
+before @ref beginFrame() has to wait for the GPU. See @ref BufferRing for more
+information about the mapping strategies.
+@requires_gl30 Extension @extension{ARB,map_buffer_range}
+@requires_gles30 Pixel buffer objects are not available in OpenGL ES 2.0.
+@requires_webgl20 Buffer mapping is not available in WebGL.
+*/
+class MAGNUM_EXPORT TextureUploadQueue {
+    public:
+        /**
+         * @brief Constructor
+         * @param size          Size of one frame region in bytes
+         * @param frameCount    Count of frames in flight
+         *
+         * @see @ref BufferRing::BufferRing()
+         */
+        explicit TextureUploadQueue(GLsizeiptr size, UnsignedInt frameCount = 3);
+
+        /** @brief Underlying buffer ring */
+        BufferRing& ring() { return _ring; }
+
+        /** @brief Count of uploads queued in current frame */
+        std::size_t pendingCount() const { return _uploads.size(); }
+
+        /**
+         * @brief Begin a frame
+         *
+         * @see @ref BufferRing::beginFrame()
+         */
+        void beginFrame();
+
+        /**
+         * @brief Queue two-dimensional texture subimage upload
+         * @param texture   Two-dimensional texture, one-dimensional texture
+         *      array or rectangle texture
+         * @param level     Mip level
+         * @param offset    Offset where to put data in the texture
+         * @param image     Image
+         * @return `False` if there is not enough space left in current frame
+         *      region, `true` otherwise
+         *
+         * Copies the data into the ring buffer, the upload itself is done in
+         * @ref endFrame(). Expects that @ref beginFrame() was called.
+         * @see @ref Texture::setSubImage()
+         */
+        bool setSubImage(AbstractTexture& texture, Int level, const Vector2i& offset, const ImageReference2D& image);
+
+        /**
+         * @brief Queue three-dimensional texture subimage upload
+         * @param texture   Three-dimensional texture, two-dimensional texture
+         *      array or cube map texture array
+         * @param level     Mip level
+         * @param offset    Offset where to put data in the texture
+         * @param image     Image
+         *
+         * See @ref setSubImage(AbstractTexture&, Int, const Vector2i&, const ImageReference2D&)
+         * for more information.
+         */
+        bool setSubImage(AbstractTexture& texture, Int level, const Vector3i& offset, const ImageReference3D& image);
+
+        /**
+         * @brief End a frame
+         *
+         * Flushes the ring, issues all queued uploads from it and inserts a
+         * fence guarding the region.
+         * @see @ref BufferRing::flush(), @ref BufferRing::endFrame(),
+         *      @fn_gl{BindBuffer} with @def_gl{PIXEL_UNPACK_BUFFER},
+         *      @fn_gl{TexSubImage2D} / @fn_gl{TexSubImage3D} or their DSA
+         *      equivalents
+         */
+        void endFrame();
+
+    private:
+        struct Upload {
+            AbstractTexture* texture;
+            UnsignedInt dimensions;
+            Int level;
+            Vector3i offset, size;
+            PixelStorage storage;
+            ColorFormat format;
+            ColorType type;
+            GLintptr bufferOffset;
+        };
+
+        bool stage(AbstractTexture& texture, UnsignedInt dimensions, Int level, const Vector3i& offset, const Vector3i& size, const AbstractImage& image, const char* data, std::size_t dataSize);
+
+        BufferRing _ring;
+        std::vector<Upload> _uploads;
+};
+
+}
+#else
+#error this header is not available in OpenGL ES 2.0 build
+#endif
+
+#endif
@@ -25,10 +25,13 @@
 
 #include "Timeline.h"
 
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/utilities.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
 
 using namespace std::chrono;
 
@@ -39,6 +42,9 @@ void Timeline::start() {
     _startTime = high_resolution_clock::now();
     _previousFrameTime = _startTime;
     _previousFrameDuration = 0;
+    _fixedStepAccumulator = 0;
+    _fixedStepCount = 0;
+    _fixedStepIndex = 0;
 }
 
 void Timeline::stop() {
@@ -46,6 +52,18 @@ void Timeline::stop() {
     _startTime = high_resolution_clock::time_point();
     _previousFrameTime = _startTime;
     _previousFrameDuration = 0;
+    _fixedStepAccumulator = 0;
+    _fixedStepCount = 0;
+    _fixedStepIndex = 0;
+}
+
+Timeline& Timeline::setFixedStepDuration(const Float seconds) {
+    CORRADE_ASSERT(seconds >= 0.0f,
+        "Timeline::setFixedStepDuration(): expected non-negative duration, got" << seconds, *this);
+    _fixedStepDuration = seconds;
+    _fixedStepAccumulator = 0;
+    _fixedStepCount = 0;
+    return *this;
 }
 
 void Timeline::nextFrame() {
@@ -56,12 +74,61 @@ void Timeline::nextFrame() {
     _previousFrameDuration = duration/1e6f;
 
     if(_previousFrameDuration < _minimalFrameTime) {
-        Utility::sleep(std::size_t(_minimalFrameTime*1000) - duration/1000);
-        now = high_resolution_clock::now();
+        /* Sleep for whole milliseconds except the last one, as the sleep is
+           usually longer than requested, then spin until the deadline */
+        const auto deadline = _previousFrameTime + microseconds{std::size_t(_minimalFrameTime*1e6f)};
+        const auto remaining = duration_cast<milliseconds>(deadline - now).count();
+        if(remaining > 1) Utility::sleep(remaining - 1);
+        while((now = high_resolution_clock::now()) < deadline) {}
         _previousFrameDuration = duration_cast<microseconds>(now-_previousFrameTime).count()/1e6f;
     }
 
     _previousFrameTime = now;
+    advanceFixedSteps(_previousFrameDuration);
+}
+
+void Timeline::advanceFixedSteps(const Float duration) {
+    if(!_fixedStepDuration) {
+        _fixedStepCount = 0;
+        return;
+    }
+
+    _fixedStepAccumulator += duration;
+    const Float count = std::floor(_fixedStepAccumulator/_fixedStepDuration);
+    _fixedStepAccumulator = Math::max(_fixedStepAccumulator - count*_fixedStepDuration, 0.0f);
+
+    /* If the application can't keep up, drop the steps which don't fit into
+       the max count so the next frames don't need to catch up with them */
+    _fixedStepCount = Math::min(UnsignedInt(count), _maxFixedStepCount);
+
+    _fixedStepIndex += _fixedStepCount;
+}
+
+void Timeline::bufferSwapped() {
+    const auto now = high_resolution_clock::now();
+    if(_previousSwapTime != high_resolution_clock::time_point()) {
+        const Float interval = duration_cast<microseconds>(now - _previousSwapTime).count()/1e6f;
+
+        /* First estimate or the previous one was too long (e.g. missed
+           refresh during startup), take the interval directly. Otherwise
+           smooth out jitter, longer intervals are missed refreshes or idle
+           time and are ignored. */
+        if(!_refreshPeriod || interval < _refreshPeriod*0.8f)
+            _refreshPeriod = interval;
+        else if(interval < _refreshPeriod*1.2f)
+            _refreshPeriod += (interval - _refreshPeriod)*0.1f;
+    }
+
+    _previousSwapTime = now;
+}
+
+Float Timeline::timeToDeadline(const Float frameDuration) const {
+    if(!_refreshPeriod) return 0.0f;
+
+    /* First refresh after the frame would be finished if started now */
+    const Float elapsed = duration_cast<microseconds>(high_resolution_clock::now() - _previousSwapTime).count()/1e6f;
+    const Float refresh = Math::max(std::ceil((elapsed + frameDuration)/_refreshPeriod), 1.0f)*_refreshPeriod;
+    return Math::max(refresh - frameDuration - elapsed, 0.0f);
 }
 
 Float Timeline::previousFrameTime() const {
@@ -78,9 +78,51 @@ void MyApplication::drawEvent() {
     timeline.nextFrame();
 }
 @endcode
-@todo FPS should be governed by Application (imagine more than one simultaneous
-    timeline and the harm it could do, also vsync etc. can't be handled in
-    platform-independent way here)
+
+## Frame pacing
+
+Limiting the framerate with @ref setMinimalFrameTime() alone only delays the
+frame end and doesn't know anything about display refresh. If you call
+@ref bufferSwapped() right after each buffer swap with enabled vertical sync,
+the timeline estimates the refresh period from the swap timing and
+@ref timeToDeadline() then tells how long the drawing can be postponed so it
+still finishes before the next vertical sync. Starting the frame as late as
+possible means it is drawn with the most recent input. This is done
+automatically by @ref Platform::Sdl2Application::setFramePacing().
+
+## Fixed time step
+
+Simulation driven by @ref previousFrameDuration() costs more the faster the
+application renders and behaves differently at different framerates. With
+@ref setFixedStepDuration() the timeline accumulates the frame durations and
+@ref fixedStepCount() then tells how many steps of fixed duration should be
+simulated in current frame. If the application can't keep up, at most
+@ref maxFixedStepCount() steps are done and the rest of the time is dropped,
+so the simulation slows down instead of spiralling into ever longer frames.
+
+The simulation state is then generally somewhere between two fixed steps
+when rendering. @ref fixedStepInterpolation() gives the position in the
+interval, which can be used to interpolate between the last two simulated
+states using @ref SceneGraph::Interpolable to get smooth motion:
+@code
+timeline.setFixedStepDuration(1/60.0f)
+    .start();
+
+void MyApplication::drawEvent() {
+    for(UnsignedInt i = 0; i != timeline.fixedStepCount(); ++i) {
+        // Move objects, resolve collisions ...
+        shapes.setClean();
+        interpolables.capture();
+    }
+    animables.step(timeline);
+    interpolables.interpolate(timeline.fixedStepInterpolation());
+
+    // Draw using Interpolable::interpolatedTransformationMatrix() ...
+    swapBuffers();
+    redraw();
+    timeline.nextFrame();
+}
+@endcode
 */
 class MAGNUM_EXPORT Timeline {
     public:
@@ -90,7 +132,7 @@ class MAGNUM_EXPORT Timeline {
          * Creates stopped timeline.
          * @see @ref start()
          */
-        explicit Timeline(): _minimalFrameTime(0), _previousFrameDuration(0), running(false) {}
+        explicit Timeline(): _minimalFrameTime(0), _previousFrameDuration(0), _refreshPeriod(0), _fixedStepDuration(0), _fixedStepAccumulator(0), _maxFixedStepCount(5), _fixedStepCount(0), _fixedStepIndex(0), running(false) {}
 
         /** @brief Minimal frame time (in seconds) */
         Float minimalFrameTime() const { return _minimalFrameTime; }
@@ -107,10 +149,39 @@ class MAGNUM_EXPORT Timeline {
             return *this;
         }
 
+        /** @brief Fixed step duration (in seconds) */
+        Float fixedStepDuration() const { return _fixedStepDuration; }
+
+        /**
+         * @brief Set fixed step duration
+         * @return Reference to self (for method chaining)
+         *
+         * Default value is `0`, which disables the fixed stepping.
+         * @see @ref fixedStepCount(), @ref fixedStepInterpolation()
+         */
+        Timeline& setFixedStepDuration(Float seconds);
+
+        /** @brief Max fixed step count per frame */
+        UnsignedInt maxFixedStepCount() const { return _maxFixedStepCount; }
+
+        /**
+         * @brief Set max fixed step count per frame
+         * @return Reference to self (for method chaining)
+         *
+         * If the accumulated time exceeds given count of fixed steps, the
+         * remaining time is dropped. Default value is `5`.
+         * @see @ref fixedStepCount()
+         */
+        Timeline& setMaxFixedStepCount(UnsignedInt count) {
+            _maxFixedStepCount = count;
+            return *this;
+        }
+
         /**
          * @brief Start timeline
          *
-         * Sets previous frame time and duration to `0`.
+         * Sets previous frame time and duration to `0` and resets the fixed
+         * step accumulator.
          * @see @ref stop(), @ref previousFrameDuration()
          */
         void start();
@@ -126,7 +197,9 @@ class MAGNUM_EXPORT Timeline {
          * @brief Advance to next frame
          *
          * If current frame time is smaller than minimal frame time, pauses
-         * the execution for remaining time.
+         * the execution until the end of the minimal frame time. The pause
+         * ends at given point in time and not after given duration, so the
+         * frame time doesn't depend on sleep granularity of the system.
          * @note This function does nothing if the timeline is stopped.
          * @see @ref setMinimalFrameTime(), @ref stop()
          */
@@ -147,11 +220,85 @@ class MAGNUM_EXPORT Timeline {
          */
         Float previousFrameDuration() const { return _previousFrameDuration; }
 
+        /**
+         * @brief Count of fixed steps to simulate in current frame
+         *
+         * Computed in @ref nextFrame() from the duration of previous frame,
+         * never larger than @ref maxFixedStepCount(). Returns `0` if the
+         * timeline is stopped or the fixed step duration is not set.
+         * @see @ref setFixedStepDuration()
+         */
+        UnsignedInt fixedStepCount() const { return _fixedStepCount; }
+
+        /**
+         * @brief Time at last fixed step of current frame (in seconds)
+         *
+         * Simulated time after all @ref fixedStepCount() steps of current
+         * frame are done, i.e. total count of fixed steps since
+         * @ref start() multiplied by @ref fixedStepDuration(). Lags behind
+         * @ref previousFrameTime() if some time was dropped.
+         */
+        Float fixedStepTime() const { return _fixedStepIndex*_fixedStepDuration; }
+
+        /**
+         * @brief Interpolation factor between last two fixed steps
+         *
+         * Remaining accumulated time divided by @ref fixedStepDuration(), in
+         * range @f$ [0; 1) @f$. Returns `0.0f` if the fixed step duration is
+         * not set.
+         * @see @ref SceneGraph::InterpolableGroup::interpolate()
+         */
+        Float fixedStepInterpolation() const {
+            return _fixedStepDuration ? _fixedStepAccumulator/_fixedStepDuration : 0.0f;
+        }
+
+        /**
+         * @brief Record buffer swap
+         *
+         * Call right after buffer swap returns to track the display refresh.
+         * Works also if the timeline is stopped. Useful only with enabled
+         * vertical sync, as the swap then waits for the refresh.
+         * @see @ref refreshPeriod(), @ref timeToDeadline()
+         */
+        void bufferSwapped();
+
+        /**
+         * @brief Estimated display refresh period (in seconds)
+         *
+         * Estimated from intervals between @ref bufferSwapped() calls.
+         * Intervals longer than the current estimate (missed refreshes, no
+         * redraw needed) are ignored. Returns `0.0f` if
+         * @ref bufferSwapped() wasn't called at least twice.
+         */
+        Float refreshPeriod() const { return _refreshPeriod; }
+
+        /**
+         * @brief Time until the latest start of next frame (in seconds)
+         * @param frameDuration     Expected duration of the frame including
+         *      GPU work
+         *
+         * Predicts the next display refresh from the last
+         * @ref bufferSwapped() call and @ref refreshPeriod() and returns how
+         * long the frame can be postponed so it is still finished and swapped
+         * before the refresh. Returns `0.0f` if the refresh period is not
+         * known yet.
+         */
+        Float timeToDeadline(Float frameDuration) const;
+
     private:
+        void advanceFixedSteps(Float duration);
+
         std::chrono::high_resolution_clock::time_point _startTime;
         std::chrono::high_resolution_clock::time_point _previousFrameTime;
+        std::chrono::high_resolution_clock::time_point _previousSwapTime;
         Float _minimalFrameTime;
         Float _previousFrameDuration;
+        Float _refreshPeriod;
+        Float _fixedStepDuration;
+        Float _fixedStepAccumulator;
+        UnsignedInt _maxFixedStepCount;
+        UnsignedInt _fixedStepCount;
+        UnsignedLong _fixedStepIndex;
 
         bool running;
 };
@@ -29,6 +29,8 @@
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Directory.h>
 
+#include "Magnum/Trade/ImageData.h"
+
 namespace Magnum { namespace Trade {
 
 AbstractImageConverter::AbstractImageConverter() = default;
@@ -46,6 +48,17 @@ Image2D* AbstractImageConverter::doExportToImage(const ImageReference2D&) const
     CORRADE_ASSERT(false, "Trade::AbstractImageConverter::exportToImage(): feature advertised but not implemented", nullptr);
 }
 
+std::optional<CompressedImageData2D> AbstractImageConverter::exportToCompressedImage(const ImageReference2D& image) const {
+    CORRADE_ASSERT(features() & Feature::ConvertCompressedImage,
+        "Trade::AbstractImageConverter::exportToCompressedImage(): feature not supported", std::nullopt);
+
+    return doExportToCompressedImage(image);
+}
+
+std::optional<CompressedImageData2D> AbstractImageConverter::doExportToCompressedImage(const ImageReference2D&) const {
+    CORRADE_ASSERT(false, "Trade::AbstractImageConverter::exportToCompressedImage(): feature advertised but not implemented", std::nullopt);
+}
+
 Containers::Array<char> AbstractImageConverter::exportToData(const ImageReference2D& image) const {
     CORRADE_ASSERT(features() & Feature::ConvertData,
         "Trade::AbstractImageConverter::exportToData(): feature not supported", nullptr);
@@ -57,6 +70,21 @@ Containers::Array<char> AbstractImageConverter::doExportToData(const ImageRefere
     CORRADE_ASSERT(false, "Trade::AbstractImageConverter::exportToData(): feature advertised but not implemented", nullptr);
 }
 
+bool AbstractImageConverter::exportToData(const ImageReference2D& image, std::vector<char>& data) const {
+    CORRADE_ASSERT(features() & Feature::ConvertData,
+        "Trade::AbstractImageConverter::exportToData(): feature not supported", false);
+
+    return doExportToDataInto(image, data);
+}
+
+bool AbstractImageConverter::doExportToDataInto(const ImageReference2D& image, std::vector<char>& data) const {
+    const auto out = doExportToData(image);
+    if(!out) return false;
+
+    data.assign(out.begin(), out.end());
+    return true;
+}
+
 bool AbstractImageConverter::exportToFile(const ImageReference2D& image, const std::string& filename) const {
     return doExportToFile(image, filename);
 }
@@ -29,11 +29,14 @@
  * @brief Class @ref Magnum::Trade::AbstractImageConverter
  */
 
+#include <vector>
 #include <Corrade/PluginManager/AbstractPlugin.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/visibility.h"
 #include "Magnum/Text/Text.h"
+#include "Magnum/Trade/Trade.h"
+#include "MagnumExternal/Optional/optional.hpp"
 
 namespace Magnum { namespace Trade {
 
@@ -56,10 +59,10 @@ checked by the implementation:
 -   Functions @ref doExportToImage() or @ref doExportToData() are called only
     if @ref Feature::ConvertImage or @ref Feature::ConvertData is supported.
 
-Plugin interface string is `"cz.mosra.magnum.Trade.AbstractImageConverter/0.2.1"`.
+Plugin interface string is `"cz.mosra.magnum.Trade.AbstractImageConverter/0.2.3"`.
 */
 class MAGNUM_EXPORT AbstractImageConverter: public PluginManager::AbstractPlugin {
-    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Trade.AbstractImageConverter/0.2.1")
+    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Trade.AbstractImageConverter/0.2.3")
 
     public:
         /**
@@ -72,7 +75,13 @@ class MAGNUM_EXPORT AbstractImageConverter: public PluginManager::AbstractPlugin
             ConvertImage = 1 << 0,
 
             /** Exporting to raw data with @ref exportToData() */
-            ConvertData = 1 << 1
+            ConvertData = 1 << 1,
+
+            /**
+             * Conversion to GPU-compressed image with
+             * @ref exportToCompressedImage()
+             */
+            ConvertCompressedImage = 1 << 2
         };
 
         /**
@@ -100,6 +109,16 @@ class MAGNUM_EXPORT AbstractImageConverter: public PluginManager::AbstractPlugin
          */
         Image2D* exportToImage(const ImageReference2D& image) const;
 
+        /**
+         * @brief Convert image to GPU-compressed format
+         *
+         * Available only if @ref Feature::ConvertCompressedImage is
+         * supported. Returns compressed image on success, `std::nullopt`
+         * otherwise.
+         * @see @ref features(), @ref exportToImage()
+         */
+        std::optional<CompressedImageData2D> exportToCompressedImage(const ImageReference2D& image) const;
+
         /**
          * @brief Export image to raw data
          *
@@ -109,6 +128,17 @@ class MAGNUM_EXPORT AbstractImageConverter: public PluginManager::AbstractPlugin
          */
         Containers::Array<char> exportToData(const ImageReference2D& image) const;
 
+        /**
+         * @brief Export image to reusable buffer
+         *
+         * Like @ref exportToData(const ImageReference2D&) const, but puts
+         * the result into @p data, replacing its previous contents. The
+         * buffer capacity is reused, so repeated exports of same-sized
+         * images don't allocate. Returns `true` on success, `false`
+         * otherwise.
+         */
+        bool exportToData(const ImageReference2D& image, std::vector<char>& data) const;
+
         /**
          * @brief Export image to file
          *
@@ -128,9 +158,20 @@ class MAGNUM_EXPORT AbstractImageConverter: public PluginManager::AbstractPlugin
         /** @brief Implementation of @ref exportToImage() */
         virtual Image2D* doExportToImage(const ImageReference2D& image) const;
 
+        /** @brief Implementation of @ref exportToCompressedImage() */
+        virtual std::optional<CompressedImageData2D> doExportToCompressedImage(const ImageReference2D& image) const;
+
         /** @brief Implementation of @ref exportToData() */
         virtual Containers::Array<char> doExportToData(const ImageReference2D& image) const;
 
+        /**
+         * @brief Implementation of @ref exportToData(const ImageReference2D&, std::vector<char>&) const
+         *
+         * Default implementation calls @ref doExportToData() and copies the
+         * result to @p data.
+         */
+        virtual bool doExportToDataInto(const ImageReference2D& image, std::vector<char>& data) const;
+
         /**
          * @brief Implementation of @ref exportToFile()
          *
@@ -32,6 +32,7 @@
 
 #include "Magnum/Trade/AbstractMaterialData.h"
 #include "Magnum/Trade/CameraData.h"
+#include "Magnum/Trade/FlatSceneData3D.h"
 #include "Magnum/Trade/ImageData.h"
 #include "Magnum/Trade/LightData.h"
 #include "Magnum/Trade/MeshData2D.h"
@@ -41,20 +42,39 @@
 #include "Magnum/Trade/SceneData.h"
 #include "Magnum/Trade/TextureData.h"
 
+#if defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#define MAGNUM_TRADE_USE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 namespace Magnum { namespace Trade {
 
+struct AbstractImporter::MappedFile {
+    #ifdef MAGNUM_TRADE_USE_MMAP
+    ~MappedFile() { if(mapped) munmap(mapped, size); }
+
+    void* mapped{};
+    std::size_t size{};
+    #endif
+};
+
 AbstractImporter::AbstractImporter() = default;
 
 AbstractImporter::AbstractImporter(PluginManager::Manager<AbstractImporter>& manager): PluginManager::AbstractManagingPlugin<AbstractImporter>{manager} {}
 
 AbstractImporter::AbstractImporter(PluginManager::AbstractManager& manager, std::string plugin): PluginManager::AbstractManagingPlugin<AbstractImporter>(manager, std::move(plugin)) {}
 
+AbstractImporter::~AbstractImporter() = default;
+
 bool AbstractImporter::openData(Containers::ArrayReference<const char> data) {
     CORRADE_ASSERT(features() & Feature::OpenData,
         "Trade::AbstractImporter::openData(): feature not supported", nullptr);
 
     close();
-    doOpenData(data);
+    doOpenData(data, {});
     return isOpened();
 }
 
@@ -62,22 +82,60 @@ void AbstractImporter::doOpenData(Containers::ArrayReference<const char>) {
     CORRADE_ASSERT(false, "Trade::AbstractImporter::openData(): feature advertised but not implemented", );
 }
 
+void AbstractImporter::doOpenData(const Containers::ArrayReference<const char> data, DataFlags) {
+    doOpenData(data);
+}
+
 bool AbstractImporter::openFile(const std::string& filename) {
     close();
     doOpenFile(filename);
+
+    /* The mapping is not needed if the opening failed */
+    if(!isOpened()) _mappedFile = nullptr;
     return isOpened();
 }
 
 void AbstractImporter::doOpenFile(const std::string& filename) {
     CORRADE_ASSERT(features() & Feature::OpenData, "Trade::AbstractImporter::openFile(): not implemented", );
 
+    #ifdef MAGNUM_TRADE_USE_MMAP
+    /* Map the file to memory, the pages are loaded on demand and the plugin
+       can reference them until the file is closed */
+    const int fd = ::open(filename.data(), O_RDONLY);
+    struct stat st;
+    if(fd == -1 || fstat(fd, &st) == -1) {
+        if(fd != -1) ::close(fd);
+        Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+
+    std::unique_ptr<MappedFile> file{new MappedFile};
+    if(st.st_size) {
+        void* const mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapped == MAP_FAILED) {
+            ::close(fd);
+            Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
+            return;
+        }
+        file->mapped = mapped;
+        file->size = st.st_size;
+    }
+    ::close(fd);
+
+    /* Keep the mapping alive before calling the plugin so it's released
+       only after doClose() */
+    const Containers::ArrayReference<const char> data{static_cast<const char*>(file->mapped), file->size};
+    _mappedFile = std::move(file);
+    doOpenData(data, DataFlag::Persistent);
+    #else
     /* Open file */
     if(!Utility::Directory::fileExists(filename)) {
         Error() << "Trade::AbstractImporter::openFile(): cannot open file" << filename;
         return;
     }
 
-    doOpenData(Utility::Directory::read(filename));
+    doOpenData(Utility::Directory::read(filename), {});
+    #endif
 }
 
 void AbstractImporter::close() {
@@ -85,6 +143,8 @@ void AbstractImporter::close() {
         doClose();
         CORRADE_INTERNAL_ASSERT(!isOpened());
     }
+
+    _mappedFile = nullptr;
 }
 
 Int AbstractImporter::defaultScene() {
@@ -124,6 +184,48 @@ std::optional<SceneData> AbstractImporter::scene(const UnsignedInt id) {
 
 std::optional<SceneData> AbstractImporter::doScene(UnsignedInt) { return std::nullopt; }
 
+std::optional<FlatSceneData3D> AbstractImporter::flatScene3D(const UnsignedInt id) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::flatScene3D(): no file opened", {});
+    CORRADE_ASSERT(id < doSceneCount(), "Trade::AbstractImporter::flatScene3D(): index out of range", {});
+    return doFlatScene3D(id);
+}
+
+std::optional<FlatSceneData3D> AbstractImporter::doFlatScene3D(const UnsignedInt id) {
+    std::optional<SceneData> scene = doScene(id);
+    if(!scene) return std::nullopt;
+
+    std::vector<Int> parents;
+    std::vector<Matrix4> transformations;
+    std::vector<ObjectInstanceType3D> instanceTypes;
+    std::vector<Int> instances;
+    std::vector<UnsignedInt> objectIds;
+
+    /* Depth-first traversal, so parents are always before their children.
+       Pairs of object ID and index of its parent in the output. */
+    std::vector<std::pair<UnsignedInt, Int>> stack;
+    for(auto it = scene->children3D().rbegin(); it != scene->children3D().rend(); ++it)
+        stack.emplace_back(*it, -1);
+    while(!stack.empty()) {
+        const std::pair<UnsignedInt, Int> item = stack.back();
+        stack.pop_back();
+
+        std::unique_ptr<ObjectData3D> object = item.first < doObject3DCount() ? doObject3D(item.first) : nullptr;
+        if(!object) return std::nullopt;
+
+        const Int index = parents.size();
+        parents.push_back(item.second);
+        transformations.push_back(object->transformation());
+        instanceTypes.push_back(object->instanceType());
+        instances.push_back(object->instance());
+        objectIds.push_back(item.first);
+
+        for(auto it = object->children().rbegin(); it != object->children().rend(); ++it)
+            stack.emplace_back(*it, index);
+    }
+
+    return FlatSceneData3D{std::move(parents), std::move(transformations), std::move(instanceTypes), std::move(instances), std::move(objectIds)};
+}
+
 UnsignedInt AbstractImporter::lightCount() const {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::lightCount(): no file opened", {});
     return doLightCount();
@@ -424,6 +526,21 @@ std::optional<ImageData2D> AbstractImporter::image2D(const UnsignedInt id) {
 
 std::optional<ImageData2D> AbstractImporter::doImage2D(UnsignedInt) { return std::nullopt; }
 
+UnsignedInt AbstractImporter::compressedImage2DCount() const {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::compressedImage2DCount(): no file opened", {});
+    return doCompressedImage2DCount();
+}
+
+UnsignedInt AbstractImporter::doCompressedImage2DCount() const { return 0; }
+
+std::optional<CompressedImageData2D> AbstractImporter::compressedImage2D(const UnsignedInt id) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::compressedImage2D(): no file opened", {});
+    CORRADE_ASSERT(id < doCompressedImage2DCount(), "Trade::AbstractImporter::compressedImage2D(): index out of range", {});
+    return doCompressedImage2D(id);
+}
+
+std::optional<CompressedImageData2D> AbstractImporter::doCompressedImage2D(UnsignedInt) { return std::nullopt; }
+
 UnsignedInt AbstractImporter::image3DCount() const {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::image3DCount(): no file opened", {});
     return doImage3DCount();
@@ -67,17 +67,19 @@ checked by the implementation:
     is any file opened.
 -   Function @ref doOpenData() is called only if @ref Feature::OpenData is
     supported.
+-   Memory passed to @ref doOpenData() with @ref DataFlag::Persistent is
+    kept valid until @ref doClose() is called, unless the opening fails.
 -   All `do*()` implementations working on opened file are called only if there
     is any file opened.
 -   All `do*()` implementations taking data ID as parameter are called only if
     the ID is from valid range.
 
-Plugin interface string is `"cz.mosra.magnum.Trade.AbstractImporter/0.3"`.
+Plugin interface string is `"cz.mosra.magnum.Trade.AbstractImporter/0.3.1"`.
 
 @todo How to handle casting from std::unique_ptr<> in more convenient way?
 */
 class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlugin<AbstractImporter> {
-    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Trade.AbstractImporter/0.3")
+    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Trade.AbstractImporter/0.3.1")
 
     public:
         /**
@@ -93,6 +95,27 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
         /** @brief Set of features supported by this importer */
         typedef Containers::EnumSet<Feature> Features;
 
+        /**
+         * @brief Data flag
+         *
+         * @see @ref DataFlags, @ref doOpenData()
+         */
+        enum class DataFlag: UnsignedByte {
+            /**
+             * The data are guaranteed to stay valid and unchanged until
+             * @ref doClose() is called, so the implementation can reference
+             * them directly instead of making a copy.
+             */
+            Persistent = 1 << 0
+        };
+
+        /**
+         * @brief Data flags
+         *
+         * @see @ref doOpenData()
+         */
+        typedef Containers::EnumSet<DataFlag> DataFlags;
+
         /** @brief Default constructor */
         explicit AbstractImporter();
 
@@ -102,6 +125,8 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
         /** @brief Plugin manager constructor */
         explicit AbstractImporter(PluginManager::AbstractManager& manager, std::string plugin);
 
+        ~AbstractImporter();
+
         /** @brief Features supported by this importer */
         Features features() const { return doFeatures(); }
 
@@ -122,7 +147,10 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
          * @brief Open file
          *
          * Closes previous file, if it was opened, and tries to open given
-         * file. Returns `true` on success, `false` otherwise.
+         * file. Returns `true` on success, `false` otherwise. If the plugin
+         * doesn't implement file opening on its own, the file is
+         * memory-mapped on platforms that support it and the mapping is kept
+         * until the file is closed.
          * @see @ref features(), @ref openData()
          */
         bool openFile(const std::string& filename);
@@ -172,6 +200,19 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
          */
         std::optional<SceneData> scene(UnsignedInt id);
 
+        /**
+         * @brief Flattened three-dimensional scene
+         * @param id        Scene ID, from range [0, @ref sceneCount()).
+         *
+         * Returns whole three-dimensional object hierarchy of given scene in
+         * contiguous arrays or `std::nullopt` if import failed. Compared to
+         * walking @ref SceneData::children3D() and calling @ref object3D()
+         * for each object, this doesn't allocate anything per object, which
+         * makes a difference for scenes with many objects.
+         * @see @ref SceneGraph::instantiate()
+         */
+        std::optional<FlatSceneData3D> flatScene3D(UnsignedInt id);
+
         /** @brief Light count */
         UnsignedInt lightCount() const;
 
@@ -442,6 +483,19 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
          */
         std::optional<ImageData2D> image2D(UnsignedInt id);
 
+        /** @brief Two-dimensional compressed image count */
+        UnsignedInt compressedImage2DCount() const;
+
+        /**
+         * @brief Two-dimensional compressed image
+         * @param id        Image ID, from range [0, @ref compressedImage2DCount()).
+         *
+         * Returns given image with data in GPU-compressed format or
+         * `std::nullopt` if importing failed. The data can be uploaded
+         * directly using @ref Texture::setCompressedImage().
+         */
+        std::optional<CompressedImageData2D> compressedImage2D(UnsignedInt id);
+
         /** @brief Three-dimensional image count */
         UnsignedInt image3DCount() const;
 
@@ -476,9 +530,13 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
          * @brief Implementation for @ref openFile()
          *
          * If @ref Feature::OpenData is supported, default implementation opens
-         * the file and calls @ref doOpenData() with its contents. It is
-         * allowed to call this function from your @ref doOpenFile()
-         * implementation.
+         * the file and calls @ref doOpenData(Containers::ArrayReference<const char>, DataFlags)
+         * with its contents. On Unix (except Emscripten) the file is
+         * memory-mapped instead of read, the mapping is passed with
+         * @ref DataFlag::Persistent and released after @ref doClose(). On
+         * other platforms the contents are read into a temporary array and
+         * passed without any flags. It is allowed to call this function from
+         * your @ref doOpenFile() implementation.
          */
         virtual void doOpenFile(const std::string& filename);
 
@@ -496,6 +554,18 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
         /** @brief Implementation for @ref openData() */
         virtual void doOpenData(Containers::ArrayReference<const char> data);
 
+        /**
+         * @brief Implementation for @ref openData() and @ref openFile()
+         *
+         * Data passed from @ref openData() have no flags set, data passed
+         * from the default implementation of @ref doOpenFile() may have
+         * @ref DataFlag::Persistent set. Default implementation calls
+         * @ref doOpenData(Containers::ArrayReference<const char>), which
+         * should copy the data if it needs them after it returns. Override
+         * this function instead if the plugin can make use of the flags.
+         */
+        virtual void doOpenData(Containers::ArrayReference<const char> data, DataFlags flags);
+
         /** @brief Implementation for @ref close() */
         virtual void doClose() = 0;
 
@@ -530,6 +600,15 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
         /** @brief Implementation for @ref scene() */
         virtual std::optional<SceneData> doScene(UnsignedInt id);
 
+        /**
+         * @brief Implementation for @ref flatScene3D()
+         *
+         * Default implementation builds the data from @ref doScene() and
+         * @ref doObject3D(). Importers which can produce the flat
+         * representation directly should reimplement this function.
+         */
+        virtual std::optional<FlatSceneData3D> doFlatScene3D(UnsignedInt id);
+
         /**
          * @brief Implementation for @ref lightCount()
          *
@@ -770,6 +849,16 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
         /** @brief Implementation for @ref image2D() */
         virtual std::optional<ImageData2D> doImage2D(UnsignedInt id);
 
+        /**
+         * @brief Implementation for @ref compressedImage2DCount()
+         *
+         * Default implementation returns `0`.
+         */
+        virtual UnsignedInt doCompressedImage2DCount() const;
+
+        /** @brief Implementation for @ref compressedImage2D() */
+        virtual std::optional<CompressedImageData2D> doCompressedImage2D(UnsignedInt id);
+
         /**
          * @brief Implementation for @ref image3DCount()
          *
@@ -793,9 +882,15 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
 
         /** @brief Implementation for @ref image3D() */
         virtual std::optional<ImageData3D> doImage3D(UnsignedInt id);
+
+    private:
+        struct MappedFile;
+
+        std::unique_ptr<MappedFile> _mappedFile;
 };
 
 CORRADE_ENUMSET_OPERATORS(AbstractImporter::Features)
+CORRADE_ENUMSET_OPERATORS(AbstractImporter::DataFlags)
 
 }}
 
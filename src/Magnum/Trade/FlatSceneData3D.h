@@ -0,0 +1,120 @@
+#ifndef Magnum_Trade_FlatSceneData3D_h
+#define Magnum_Trade_FlatSceneData3D_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::FlatSceneData3D
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Trade/ObjectData3D.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Flattened three-dimensional scene data
+
+Whole object hierarchy of a scene stored in a few contiguous arrays instead of
+separate @ref ObjectData3D instances, one item for each object. Objects are
+ordered so that parent always comes before its children, thus the hierarchy
+can be recreated in a single linear pass, e.g. using
+@ref SceneGraph::instantiate().
+@see @ref AbstractImporter::flatScene3D()
+*/
+class MAGNUM_EXPORT FlatSceneData3D {
+    public:
+        /**
+         * @brief Constructor
+         * @param parents           Parent indices
+         * @param transformations   Transformations (relative to parent)
+         * @param instanceTypes     Instance types
+         * @param instances         Instance IDs
+         * @param objectIds         Object IDs in the importer
+         *
+         * All arrays are expected to have the same size. Parent of each
+         * object is expected to be `-1` or lower than index of the object.
+         */
+        explicit FlatSceneData3D(std::vector<Int> parents, std::vector<Matrix4> transformations, std::vector<ObjectInstanceType3D> instanceTypes, std::vector<Int> instances, std::vector<UnsignedInt> objectIds);
+
+        /** @brief Copying is not allowed */
+        FlatSceneData3D(const FlatSceneData3D&) = delete;
+
+        /** @brief Move constructor */
+        FlatSceneData3D(FlatSceneData3D&&);
+
+        /** @brief Copying is not allowed */
+        FlatSceneData3D& operator=(const FlatSceneData3D&) = delete;
+
+        /** @brief Move assignment */
+        FlatSceneData3D& operator=(FlatSceneData3D&&);
+
+        /** @brief Object count */
+        std::size_t objectCount() const { return _parents.size(); }
+
+        /**
+         * @brief Parent indices
+         *
+         * Index of parent object in this array or `-1` for objects directly
+         * in the scene.
+         */
+        const std::vector<Int>& parents() const { return _parents; }
+
+        /** @brief Transformations (relative to parent) */
+        const std::vector<Matrix4>& transformations() const { return _transformations; }
+
+        /** @brief Instance types */
+        const std::vector<ObjectInstanceType3D>& instanceTypes() const { return _instanceTypes; }
+
+        /**
+         * @brief Instance IDs
+         *
+         * ID of given camera / light / mesh etc., specified by
+         * @ref instanceTypes(), or `-1` for empty objects.
+         */
+        const std::vector<Int>& instances() const { return _instances; }
+
+        /**
+         * @brief Object IDs
+         *
+         * ID of each object for use with @ref AbstractImporter::object3D(),
+         * e.g. to retrieve more information about mesh instances.
+         */
+        const std::vector<UnsignedInt>& objectIds() const { return _objectIds; }
+
+    private:
+        std::vector<Int> _parents;
+        std::vector<Matrix4> _transformations;
+        std::vector<ObjectInstanceType3D> _instanceTypes;
+        std::vector<Int> _instances;
+        std::vector<UnsignedInt> _objectIds;
+};
+
+}}
+
+#endif
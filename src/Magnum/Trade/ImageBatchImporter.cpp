@@ -0,0 +1,177 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImageBatchImporter.h"
+
+#include <deque>
+#include <mutex>
+#include <Corrade/PluginManager/Manager.h>
+
+#include "Magnum/TaskScheduler.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+std::optional<ImageData2D> import(AbstractImporter& importer, const std::string& filename) {
+    if(!importer.openFile(filename)) return std::nullopt;
+
+    std::optional<ImageData2D> image;
+    if(importer.image2DCount()) image = importer.image2D(0);
+    importer.close();
+    return image;
+}
+
+std::vector<std::unique_ptr<AbstractImporter>> instances(PluginManager::Manager<AbstractImporter>& manager, const std::string& plugin, const UnsignedInt threadCount) {
+    std::vector<std::unique_ptr<AbstractImporter>> importers;
+    importers.reserve(threadCount);
+    for(UnsignedInt i = 0; i != threadCount; ++i)
+        importers.push_back(manager.instance(plugin));
+    return importers;
+}
+
+}
+
+struct ImageBatchImporter::State {
+    explicit State(std::vector<std::unique_ptr<AbstractImporter>> importers, std::size_t maxInFlight): scheduler(TaskScheduler::global()), importers{std::move(importers)}, maxInFlight{maxInFlight} {
+        for(std::unique_ptr<AbstractImporter>& importer: this->importers)
+            freeImporters.push_back(importer.get());
+    }
+
+    /* Submits import tasks while there are free importers and slots,
+       expects that the mutex is locked */
+    void dispatch();
+
+    TaskScheduler& scheduler;
+    std::vector<std::unique_ptr<AbstractImporter>> importers;
+    const std::size_t maxInFlight;
+
+    /* The pending count is touched only from the calling thread, everything
+       else is guarded by the mutex */
+    std::size_t pendingCount{};
+    std::mutex mutex;
+
+    /* Files waiting for import, imported images waiting for next() and
+       handles of submitted tasks, which may already be finished */
+    std::deque<std::string> queue;
+    std::deque<std::pair<std::string, std::optional<ImageData2D>>> done;
+    std::deque<Task> tasks;
+
+    /* Importers not used by any task, images which are being imported or
+       are in the done queue */
+    std::vector<AbstractImporter*> freeImporters;
+    std::size_t inFlight{};
+    bool stopping{};
+};
+
+void ImageBatchImporter::State::dispatch() {
+    while(!tasks.empty() && tasks.front().isDone()) tasks.pop_front();
+
+    while(!stopping && !queue.empty() && !freeImporters.empty() && inFlight < maxInFlight) {
+        AbstractImporter* const importer = freeImporters.back();
+        freeImporters.pop_back();
+        std::string filename = std::move(queue.front());
+        queue.pop_front();
+        ++inFlight;
+
+        tasks.push_back(scheduler.submit([this, importer, filename]() mutable {
+            std::optional<ImageData2D> image = import(*importer, filename);
+
+            std::lock_guard<std::mutex> lock{mutex};
+            done.emplace_back(std::move(filename), std::move(image));
+            freeImporters.push_back(importer);
+            dispatch();
+        }));
+    }
+}
+
+ImageBatchImporter::ImageBatchImporter(PluginManager::Manager<AbstractImporter>& manager, const std::string& plugin, const UnsignedInt threadCount, const std::size_t maxInFlight): ImageBatchImporter{instances(manager, plugin, threadCount), maxInFlight} {}
+
+ImageBatchImporter::ImageBatchImporter(std::vector<std::unique_ptr<AbstractImporter>> importers, const std::size_t maxInFlight) {
+    CORRADE_ASSERT(!importers.empty(),
+        "Trade::ImageBatchImporter: at least one importer expected", );
+    CORRADE_ASSERT(maxInFlight >= importers.size(),
+        "Trade::ImageBatchImporter: max in-flight image count" << maxInFlight << "is smaller than thread count" << importers.size(), );
+    _state.reset(new State{std::move(importers), maxInFlight});
+}
+
+ImageBatchImporter::~ImageBatchImporter() {
+    if(!_state) return;
+
+    /* No new tasks are submitted after this, wait for the running ones */
+    std::deque<Task> tasks;
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->stopping = true;
+        tasks = std::move(_state->tasks);
+    }
+    for(const Task& task: tasks) _state->scheduler.wait(task);
+}
+
+UnsignedInt ImageBatchImporter::threadCount() const { return _state->importers.size(); }
+
+std::size_t ImageBatchImporter::maxInFlight() const { return _state->maxInFlight; }
+
+std::size_t ImageBatchImporter::pendingCount() const { return _state->pendingCount; }
+
+ImageBatchImporter& ImageBatchImporter::add(std::string filename) {
+    State& state = *_state;
+    ++state.pendingCount;
+
+    std::lock_guard<std::mutex> lock{state.mutex};
+    state.queue.push_back(std::move(filename));
+    state.dispatch();
+
+    return *this;
+}
+
+std::pair<std::string, std::optional<ImageData2D>> ImageBatchImporter::next() {
+    State& state = *_state;
+    CORRADE_ASSERT(state.pendingCount,
+        "Trade::ImageBatchImporter::next(): no images pending", {});
+    --state.pendingCount;
+
+    /* If nothing is done yet, some import is running. Waiting for the oldest
+       task also executes the tasks if the scheduler has no workers. */
+    std::unique_lock<std::mutex> lock{state.mutex};
+    while(state.done.empty()) {
+        const Task task = state.tasks.front();
+        state.tasks.pop_front();
+        lock.unlock();
+        state.scheduler.wait(task);
+        lock.lock();
+    }
+
+    std::pair<std::string, std::optional<ImageData2D>> out = std::move(state.done.front());
+    state.done.pop_front();
+    --state.inFlight;
+
+    /* A slot got freed */
+    state.dispatch();
+
+    return out;
+}
+
+}}
@@ -0,0 +1,158 @@
+#ifndef Magnum_Trade_ImageBatchImporter_h
+#define Magnum_Trade_ImageBatchImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::ImageBatchImporter
+ */
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Parallel batch image importer
+
+Imports large amount of image files in parallel in tasks submitted to
+@ref TaskScheduler::global(). Each task uses one of the importer instances
+that aren't used by any other task, the files are imported in order in which
+they were added, but delivered in order in which they finished decoding:
+@code
+PluginManager::Manager<Trade::AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_DIR};
+manager.load("PngImporter");
+
+Trade::ImageBatchImporter importer{manager, "PngImporter", 4};
+for(const std::string& file: files) importer.add(file);
+
+while(importer.pendingCount()) {
+    std::pair<std::string, std::optional<Trade::ImageData2D>> image = importer.next();
+    if(!image.second) continue;
+
+    // Upload the image...
+}
+@endcode
+
+To keep memory usage bounded, at most @ref maxInFlight() images are being
+decoded or waiting to be retrieved with @ref next() at the same time, the
+remaining files are submitted once a slot gets free.
+
+The importers are used concurrently, so their plugin must not use any shared
+global state. Error messages printed by the importers from different threads
+can be interleaved. If the scheduler has no worker threads, the files are
+imported while waiting in @ref next().
+*/
+class MAGNUM_EXPORT ImageBatchImporter {
+    public:
+        /**
+         * @brief Constructor
+         * @param manager       Importer plugin manager
+         * @param plugin        Importer plugin name
+         * @param threadCount   Max count of images decoded in parallel
+         * @param maxInFlight   Max count of images in flight
+         *
+         * Creates @p threadCount instances of @p plugin. Expects that
+         * @p plugin is loaded, @p threadCount is at least `1` and
+         * @p maxInFlight is not smaller than @p threadCount. The tasks are
+         * submitted to the scheduler that's global at construction time.
+         */
+        explicit ImageBatchImporter(PluginManager::Manager<AbstractImporter>& manager, const std::string& plugin, UnsignedInt threadCount = 1, std::size_t maxInFlight = 16);
+
+        /**
+         * @brief Construct with explicit importer instances
+         * @param importers     Importer instances, one for each image
+         *      decoded in parallel
+         * @param maxInFlight   Max count of images in flight
+         *
+         * Expects that @p importers is not empty and @p maxInFlight is not
+         * smaller than importer count.
+         */
+        explicit ImageBatchImporter(std::vector<std::unique_ptr<AbstractImporter>> importers, std::size_t maxInFlight = 16);
+
+        /** @brief Copying is not allowed */
+        ImageBatchImporter(const ImageBatchImporter&) = delete;
+
+        /** @brief Moving is not allowed */
+        ImageBatchImporter(ImageBatchImporter&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for the images which are being decoded. The remaining files
+         * are not imported.
+         */
+        ~ImageBatchImporter();
+
+        /** @brief Copying is not allowed */
+        ImageBatchImporter& operator=(const ImageBatchImporter&) = delete;
+
+        /** @brief Moving is not allowed */
+        ImageBatchImporter& operator=(ImageBatchImporter&&) = delete;
+
+        /** @brief Max count of images decoded in parallel */
+        UnsignedInt threadCount() const;
+
+        /** @brief Max count of images in flight */
+        std::size_t maxInFlight() const;
+
+        /**
+         * @brief Count of pending images
+         *
+         * Count of files added with @ref add(), but not yet retrieved with
+         * @ref next().
+         */
+        std::size_t pendingCount() const;
+
+        /**
+         * @brief Add file to import
+         * @return Reference to self (for method chaining)
+         */
+        ImageBatchImporter& add(std::string filename);
+
+        /**
+         * @brief Retrieve next imported image
+         *
+         * Waits until any pending file is imported and returns its filename
+         * together with first image in the file. If the file cannot be
+         * opened or doesn't contain any 2D image, the image is
+         * `std::nullopt`. Expects that @ref pendingCount() is not zero.
+         */
+        std::pair<std::string, std::optional<ImageData2D>> next();
+
+    private:
+        struct State;
+
+        std::unique_ptr<State> _state;
+};
+
+}}
+
+#endif
@@ -26,9 +26,11 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::Trade::ImageData, typedef @ref Magnum::Trade::ImageData1D, @ref Magnum::Trade::ImageData2D, @ref Magnum::Trade::ImageData3D
+ * @brief Class @ref Magnum::Trade::ImageData, @ref Magnum::Trade::CompressedImageData, typedef @ref Magnum::Trade::ImageData1D, @ref Magnum::Trade::ImageData2D, @ref Magnum::Trade::ImageData3D, @ref Magnum::Trade::CompressedImageData1D, @ref Magnum::Trade::CompressedImageData2D, @ref Magnum::Trade::CompressedImageData3D
  */
 
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/ImageReference.h"
 
 namespace Magnum { namespace Trade {
@@ -54,7 +56,20 @@ template<UnsignedInt dimensions> class ImageData: public AbstractImage {
          * Note that the image data are not copied on construction, but they
          * are deleted on class destruction.
          */
-        explicit ImageData(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, void* data): AbstractImage{format, type}, _size{size}, _data{reinterpret_cast<char*>(data)} {}
+        explicit ImageData(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, void* data): AbstractImage{format, type}, _size{size}, _data{reinterpret_cast<char*>(data)}, _deleter{} {}
+
+        /**
+         * @brief Construct with custom deleter
+         * @param format            Format of pixel data
+         * @param type              Data type of pixel data
+         * @param size              Image size
+         * @param data              Image data
+         * @param deleter           Data deleter
+         *
+         * The data are not copied on construction, on destruction they are
+         * passed to @p deleter instead of being deleted using `delete[]`.
+         */
+        explicit ImageData(ColorFormat format, ColorType type, const VectorTypeFor<dimensions, Int>& size, void* data, ImageDeleter deleter): AbstractImage{format, type}, _size{size}, _data{reinterpret_cast<char*>(data)}, _deleter{deleter} {}
 
         /** @brief Copying is not allowed */
         ImageData(const ImageData<dimensions>&) = delete;
@@ -69,7 +84,7 @@ template<UnsignedInt dimensions> class ImageData: public AbstractImage {
         ImageData<dimensions>& operator=(ImageData<dimensions>&& other) noexcept;
 
         /** @brief Destructor */
-        ~ImageData() { delete[] _data; }
+        ~ImageData() { deleteData(); }
 
         /** @brief Conversion to reference */
         /*implicit*/ operator ImageReference<dimensions>()
@@ -115,9 +130,24 @@ template<UnsignedInt dimensions> class ImageData: public AbstractImage {
          */
         char* release();
 
+        /**
+         * @brief Data deleter
+         *
+         * If `nullptr`, the data are deleted using `delete[]`. If the data
+         * are going to be taken over using @ref release(), query the deleter
+         * first and free the data using it afterwards.
+         */
+        ImageDeleter deleter() const { return _deleter; }
+
     private:
+        void deleteData() {
+            if(_deleter) _deleter(_data, dataSize(_size));
+            else delete[] _data;
+        }
+
         Math::Vector<Dimensions, Int> _size;
         char* _data;
+        ImageDeleter _deleter;
 };
 
 /** @brief One-dimensional image */
@@ -129,9 +159,89 @@ typedef ImageData<2> ImageData2D;
 /** @brief Three-dimensional image */
 typedef ImageData<3> ImageData3D;
 
-template<UnsignedInt dimensions> inline ImageData<dimensions>::ImageData(ImageData<dimensions>&& other) noexcept: AbstractImage(std::move(other)), _size(std::move(other._size)), _data(std::move(other._data)) {
+/**
+@brief Compressed image data
+
+Access to block-compressed image data provided by @ref AbstractImporter
+subclasses or produced by @ref AbstractImageConverter subclasses, owning the
+data. Interchangeable with @ref CompressedImageReference.
+@see @ref CompressedImageData1D, @ref CompressedImageData2D,
+    @ref CompressedImageData3D
+*/
+template<UnsignedInt dimensions> class CompressedImageData {
+    public:
+        const static UnsignedInt Dimensions = dimensions; /**< @brief Image dimension count */
+
+        /**
+         * @brief Constructor
+         * @param format            Format of compressed data
+         * @param size              Image size
+         * @param data              Image data
+         */
+        explicit CompressedImageData(CompressedColorFormat format, const VectorTypeFor<dimensions, Int>& size, Containers::Array<char>&& data) noexcept: _format{format}, _size{size}, _data{std::move(data)} {}
+
+        /** @brief Copying is not allowed */
+        CompressedImageData(const CompressedImageData<dimensions>&) = delete;
+
+        /** @brief Move constructor */
+        CompressedImageData(CompressedImageData<dimensions>&& other) noexcept;
+
+        /** @brief Copying is not allowed */
+        CompressedImageData<dimensions>& operator=(const CompressedImageData<dimensions>&) = delete;
+
+        /** @brief Move assignment */
+        CompressedImageData<dimensions>& operator=(CompressedImageData<dimensions>&& other) noexcept;
+
+        /** @brief Conversion to reference */
+        /*implicit*/ operator CompressedImageReference<dimensions>()
+        #ifndef CORRADE_GCC47_COMPATIBILITY
+        const &;
+        #else
+        const;
+        #endif
+
+        #ifndef CORRADE_GCC47_COMPATIBILITY
+        /** @overload */
+        /*implicit*/ operator CompressedImageReference<dimensions>() const && = delete;
+        #endif
+
+        /** @brief Format of compressed data */
+        CompressedColorFormat format() const { return _format; }
+
+        /** @brief Image size */
+        VectorTypeFor<dimensions, Int> size() const { return _size; }
+
+        /** @brief Raw data */
+        Containers::ArrayReference<const char> data() const {
+            return {_data.data(), _data.size()};
+        }
+
+        /**
+         * @brief Release data storage
+         *
+         * Releases the ownership of the data and resets the size to zero.
+         */
+        Containers::Array<char> release();
+
+    private:
+        CompressedColorFormat _format;
+        Math::Vector<Dimensions, Int> _size;
+        Containers::Array<char> _data;
+};
+
+/** @brief One-dimensional compressed image */
+typedef CompressedImageData<1> CompressedImageData1D;
+
+/** @brief Two-dimensional compressed image */
+typedef CompressedImageData<2> CompressedImageData2D;
+
+/** @brief Three-dimensional compressed image */
+typedef CompressedImageData<3> CompressedImageData3D;
+
+template<UnsignedInt dimensions> inline ImageData<dimensions>::ImageData(ImageData<dimensions>&& other) noexcept: AbstractImage(std::move(other)), _size(std::move(other._size)), _data(std::move(other._data)), _deleter(other._deleter) {
     other._size = {};
     other._data = nullptr;
+    other._deleter = nullptr;
 }
 
 template<UnsignedInt dimensions> inline ImageData<dimensions>& ImageData<dimensions>::operator=(ImageData<dimensions>&& other) noexcept {
@@ -139,6 +249,7 @@ template<UnsignedInt dimensions> inline ImageData<dimensions>& ImageData<dimensi
     using std::swap;
     swap(_size, other._size);
     swap(_data, other._data);
+    swap(_deleter, other._deleter);
     return *this;
 }
 
@@ -157,9 +268,37 @@ template<UnsignedInt dimensions> inline char* ImageData<dimensions>::release() {
     char* const data = _data;
     _size = {};
     _data = nullptr;
+    _deleter = nullptr;
     return data;
 }
 
+template<UnsignedInt dimensions> inline CompressedImageData<dimensions>::CompressedImageData(CompressedImageData<dimensions>&& other) noexcept: _format(other._format), _size(std::move(other._size)), _data(std::move(other._data)) {
+    other._size = {};
+}
+
+template<UnsignedInt dimensions> inline CompressedImageData<dimensions>& CompressedImageData<dimensions>::operator=(CompressedImageData<dimensions>&& other) noexcept {
+    using std::swap;
+    swap(_format, other._format);
+    swap(_size, other._size);
+    swap(_data, other._data);
+    return *this;
+}
+
+template<UnsignedInt dimensions> inline CompressedImageData<dimensions>::operator CompressedImageReference<dimensions>()
+#ifndef CORRADE_GCC47_COMPATIBILITY
+const &
+#else
+const
+#endif
+{
+    return CompressedImageReference<dimensions>{_format, _size, data()};
+}
+
+template<UnsignedInt dimensions> inline Containers::Array<char> CompressedImageData<dimensions>::release() {
+    _size = {};
+    return std::move(_data);
+}
+
 }}
 
 #endif
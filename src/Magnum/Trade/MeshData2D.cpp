@@ -26,6 +26,7 @@
 #include "MeshData2D.h"
 
 #include "Magnum/Math/Vector2.h"
+#include "Magnum/Trade/StridedMeshData.h"
 
 namespace Magnum { namespace Trade {
 
@@ -33,6 +34,10 @@ MeshData2D::MeshData2D(MeshPrimitive primitive, std::vector<UnsignedInt> indices
     CORRADE_ASSERT(!_positions.empty(), "Trade::MeshData2D: no position array specified", );
 }
 
+MeshData2D::MeshData2D(const StridedMeshData2D& data): _primitive(data.primitive()), _indices(data.indicesAsArray()), _positions{data.positions().toVector()} {
+    if(data.hasTextureCoords2D()) _textureCoords2D.push_back(data.textureCoords2D().toVector());
+}
+
 MeshData2D::MeshData2D(MeshData2D&&) = default;
 
 MeshData2D::~MeshData2D() = default;
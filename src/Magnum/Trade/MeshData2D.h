@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
 #include "Magnum/visibility.h"
 
 namespace Magnum { namespace Trade {
@@ -57,6 +58,14 @@ class MAGNUM_EXPORT MeshData2D {
          */
         explicit MeshData2D(MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector2>> positions, std::vector<std::vector<Vector2>> textureCoords2D);
 
+        /**
+         * @brief Construct from strided mesh data
+         *
+         * Copies the indices and all vertex attributes into separate arrays. Normals and
+         * colors are not copied.
+         */
+        explicit MeshData2D(const StridedMeshData2D& data);
+
         /** @brief Copying is not allowed */
         MeshData2D(const MeshData2D&) = delete;
 
@@ -25,7 +25,8 @@
 
 #include "MeshData3D.h"
 
-#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Trade/StridedMeshData.h"
 
 namespace Magnum { namespace Trade {
 
@@ -33,6 +34,18 @@ MeshData3D::MeshData3D(MeshPrimitive primitive, std::vector<UnsignedInt> indices
     CORRADE_ASSERT(!_positions.empty(), "Trade::MeshData3D: no position array specified", );
 }
 
+MeshData3D::MeshData3D(MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D, std::vector<Vector4ui> jointIds, std::vector<Vector4> jointWeights): MeshData3D{primitive, std::move(indices), std::move(positions), std::move(normals), std::move(textureCoords2D)} {
+    CORRADE_ASSERT(jointIds.empty() || (!_positions.empty() && jointIds.size() == _positions[0].size() && jointWeights.size() == jointIds.size()),
+        "Trade::MeshData3D: joint ID and weight arrays don't match vertex count", );
+    _jointIds = std::move(jointIds);
+    _jointWeights = std::move(jointWeights);
+}
+
+MeshData3D::MeshData3D(const StridedMeshData3D& data): _primitive(data.primitive()), _indices(data.indicesAsArray()), _positions{data.positions().toVector()} {
+    if(data.hasNormals()) _normals.push_back(data.normals().toVector());
+    if(data.hasTextureCoords2D()) _textureCoords2D.push_back(data.textureCoords2D().toVector());
+}
+
 MeshData3D::MeshData3D(MeshData3D&&) = default;
 
 MeshData3D::~MeshData3D() = default;
@@ -79,4 +92,24 @@ const std::vector<Vector2>& MeshData3D::textureCoords2D(const UnsignedInt id) co
     return _textureCoords2D[id];
 }
 
+std::vector<Vector4ui>& MeshData3D::jointIds() {
+    CORRADE_ASSERT(isSkinned(), "Trade::MeshData3D::jointIds(): the mesh is not skinned", _jointIds);
+    return _jointIds;
+}
+
+const std::vector<Vector4ui>& MeshData3D::jointIds() const {
+    CORRADE_ASSERT(isSkinned(), "Trade::MeshData3D::jointIds(): the mesh is not skinned", _jointIds);
+    return _jointIds;
+}
+
+std::vector<Vector4>& MeshData3D::jointWeights() {
+    CORRADE_ASSERT(isSkinned(), "Trade::MeshData3D::jointWeights(): the mesh is not skinned", _jointWeights);
+    return _jointWeights;
+}
+
+const std::vector<Vector4>& MeshData3D::jointWeights() const {
+    CORRADE_ASSERT(isSkinned(), "Trade::MeshData3D::jointWeights(): the mesh is not skinned", _jointWeights);
+    return _jointWeights;
+}
+
 }}
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
 #include "Magnum/visibility.h"
 
 namespace Magnum { namespace Trade {
@@ -58,6 +59,34 @@ class MAGNUM_EXPORT MeshData3D {
          */
         explicit MeshData3D(MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D);
 
+        /**
+         * @brief Construct skinned mesh data
+         * @param primitive         Primitive
+         * @param indices           Index array or empty array, if the mesh is
+         *      not indexed
+         * @param positions         Position arrays. At least one position
+         *      array should be present.
+         * @param normals           Normal arrays, if present
+         * @param textureCoords2D   Two-dimensional texture coordinate arrays,
+         *      if present
+         * @param jointIds          IDs of up to four joints affecting each
+         *      vertex or empty array, if the mesh is not skinned
+         * @param jointWeights      Weight of each joint in @p jointIds
+         *
+         * The joint ID and weight arrays are expected to have the same size
+         * as the first position array.
+         * @see @ref Shaders::Generic::JointIds, @ref Shaders::Generic::Weights
+         */
+        explicit MeshData3D(MeshPrimitive primitive, std::vector<UnsignedInt> indices, std::vector<std::vector<Vector3>> positions, std::vector<std::vector<Vector3>> normals, std::vector<std::vector<Vector2>> textureCoords2D, std::vector<Vector4ui> jointIds, std::vector<Vector4> jointWeights);
+
+        /**
+         * @brief Construct from strided mesh data
+         *
+         * Copies the indices and all vertex attributes into separate arrays. Colors are
+         * not copied.
+         */
+        explicit MeshData3D(const StridedMeshData3D& data);
+
         /** @brief Copying is not allowed */
         MeshData3D(const MeshData3D&) = delete;
 
@@ -132,12 +161,41 @@ class MAGNUM_EXPORT MeshData3D {
         std::vector<Vector2>& textureCoords2D(UnsignedInt id);
         const std::vector<Vector2>& textureCoords2D(UnsignedInt id) const; /**< @overload */
 
+        /**
+         * @brief Whether the mesh is skinned
+         *
+         * @see @ref jointIds(), @ref jointWeights()
+         */
+        bool isSkinned() const { return !_jointIds.empty(); }
+
+        /**
+         * @brief Joint IDs
+         *
+         * Indices of up to four joints affecting each vertex, referring to
+         * @ref MeshObjectData3D::joints().
+         * @see @ref isSkinned()
+         */
+        std::vector<Vector4ui>& jointIds();
+        const std::vector<Vector4ui>& jointIds() const; /**< @overload */
+
+        /**
+         * @brief Joint weights
+         *
+         * Weight of each joint in @ref jointIds(), unused joints have zero
+         * weight.
+         * @see @ref isSkinned()
+         */
+        std::vector<Vector4>& jointWeights();
+        const std::vector<Vector4>& jointWeights() const; /**< @overload */
+
     private:
         MeshPrimitive _primitive;
         std::vector<UnsignedInt> _indices;
         std::vector<std::vector<Vector3>> _positions;
         std::vector<std::vector<Vector3>> _normals;
         std::vector<std::vector<Vector2>> _textureCoords2D;
+        std::vector<Vector4ui> _jointIds;
+        std::vector<Vector4> _jointWeights;
 };
 
 }}
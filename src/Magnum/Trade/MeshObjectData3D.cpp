@@ -29,4 +29,9 @@ namespace Magnum { namespace Trade {
 
 MeshObjectData3D::MeshObjectData3D(std::vector<UnsignedInt> children, const Matrix4& transformation, UnsignedInt instance, Int material): ObjectData3D(std::move(children), transformation, ObjectInstanceType3D::Mesh, instance), _material(material) {}
 
+MeshObjectData3D::MeshObjectData3D(std::vector<UnsignedInt> children, const Matrix4& transformation, UnsignedInt instance, Int material, std::vector<UnsignedInt> joints, std::vector<Matrix4> inverseBindMatrices): ObjectData3D(std::move(children), transformation, ObjectInstanceType3D::Mesh, instance), _material(material), _joints(std::move(joints)), _inverseBindMatrices(std::move(inverseBindMatrices)) {
+    CORRADE_ASSERT(_joints.size() == _inverseBindMatrices.size(),
+        "Trade::MeshObjectData3D: expected" << _joints.size() << "inverse bind matrices but got" << _inverseBindMatrices.size(), );
+}
+
 }}
@@ -36,7 +36,8 @@ namespace Magnum { namespace Trade {
 /**
 @brief Three-dimensional mesh object data
 
-Provides access to material information for given mesh instance.
+Provides access to material information for given mesh instance and, for
+skinned meshes, to the skeleton the mesh is bound to.
 @see @ref MeshObjectData2D
 */
 class MAGNUM_EXPORT MeshObjectData3D: public ObjectData3D {
@@ -52,6 +53,22 @@ class MAGNUM_EXPORT MeshObjectData3D: public ObjectData3D {
          */
         explicit MeshObjectData3D(std::vector<UnsignedInt> children, const Matrix4& transformation, UnsignedInt instance, Int material);
 
+        /**
+         * @brief Construct skinned mesh object
+         * @param children          Child objects
+         * @param transformation    Transformation (relative to parent)
+         * @param instance          Instance ID
+         * @param material          Material ID or `-1`
+         * @param joints            Object IDs of skeleton joints, indexed by
+         *      @ref MeshData3D::jointIds()
+         * @param inverseBindMatrices Inverse of absolute joint
+         *      transformation in bind pose for each joint
+         *
+         * Creates object with mesh instance type. Expects that both arrays
+         * have the same size.
+         */
+        explicit MeshObjectData3D(std::vector<UnsignedInt> children, const Matrix4& transformation, UnsignedInt instance, Int material, std::vector<UnsignedInt> joints, std::vector<Matrix4> inverseBindMatrices);
+
         /** @brief Copying is not allowed */
         MeshObjectData3D(const MeshObjectData3D&) = delete;
 
@@ -71,8 +88,36 @@ class MAGNUM_EXPORT MeshObjectData3D: public ObjectData3D {
          */
         Int material() const { return _material; }
 
+        /**
+         * @brief Whether the mesh is skinned
+         *
+         * @see @ref joints(), @ref inverseBindMatrices()
+         */
+        bool isSkinned() const { return !_joints.empty(); }
+
+        /**
+         * @brief Skeleton joints
+         *
+         * Object IDs of joints. Matrix palette for
+         * @ref Shaders::Phong::Flag::Skinning "skinned rendering" is
+         * formed by multiplying absolute transformation of each joint with
+         * corresponding matrix from @ref inverseBindMatrices(). Empty if the
+         * mesh is not skinned.
+         */
+        const std::vector<UnsignedInt>& joints() const { return _joints; }
+
+        /**
+         * @brief Inverse bind matrices
+         *
+         * One for each joint in @ref joints(). Empty if the mesh is not
+         * skinned.
+         */
+        const std::vector<Matrix4>& inverseBindMatrices() const { return _inverseBindMatrices; }
+
     private:
         Int _material;
+        std::vector<UnsignedInt> _joints;
+        std::vector<Matrix4> _inverseBindMatrices;
 };
 
 }}
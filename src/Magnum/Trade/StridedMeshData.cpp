@@ -0,0 +1,158 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "StridedMeshData.h"
+
+#include <utility>
+
+#include "Magnum/Color.h"
+
+namespace Magnum { namespace Trade {
+
+template<UnsignedInt dimensions> StridedMeshData<dimensions>::StridedMeshData(const MeshPrimitive primitive, Containers::Array<char>&& data, const std::size_t vertexCount, const std::size_t positionOffset, const std::size_t positionStride): StridedMeshData{primitive, Containers::ArrayReference<const char>{data.data(), data.size()}, vertexCount, positionOffset, positionStride} {
+    _owned = std::move(data);
+}
+
+template<UnsignedInt dimensions> StridedMeshData<dimensions>::StridedMeshData(const MeshPrimitive primitive, const Containers::ArrayReference<const char> data, const std::size_t vertexCount, const std::size_t positionOffset, const std::size_t positionStride): _primitive{primitive}, _data{data}, _indexType{}, _indexOffset{}, _indexCount{}, _vertexCount{vertexCount}, _positions{}, _normals{}, _textureCoords2D{}, _colors{} {
+    CORRADE_ASSERT(fits(positionOffset, positionStride, sizeof(VectorTypeFor<dimensions, Float>)),
+        "Trade::StridedMeshData: positions out of data bounds", );
+    _positions = Attribute{positionOffset, positionStride, true};
+}
+
+template<UnsignedInt dimensions> StridedMeshData<dimensions>::StridedMeshData(StridedMeshData<dimensions>&& other) noexcept: _primitive{other._primitive}, _owned{std::move(other._owned)}, _data{other._data}, _indexType{other._indexType}, _indexOffset{other._indexOffset}, _indexCount{other._indexCount}, _vertexCount{other._vertexCount}, _positions(other._positions), _normals(other._normals), _textureCoords2D(other._textureCoords2D), _colors(other._colors) {
+    other._data = nullptr;
+    other._indexCount = other._vertexCount = 0;
+    other._positions = other._normals = other._textureCoords2D = other._colors = Attribute{};
+}
+
+template<UnsignedInt dimensions> StridedMeshData<dimensions>& StridedMeshData<dimensions>::operator=(StridedMeshData<dimensions>&& other) noexcept {
+    using std::swap;
+    swap(_primitive, other._primitive);
+    swap(_owned, other._owned);
+    swap(_data, other._data);
+    swap(_indexType, other._indexType);
+    swap(_indexOffset, other._indexOffset);
+    swap(_indexCount, other._indexCount);
+    swap(_vertexCount, other._vertexCount);
+    swap(_positions, other._positions);
+    swap(_normals, other._normals);
+    swap(_textureCoords2D, other._textureCoords2D);
+    swap(_colors, other._colors);
+    return *this;
+}
+
+template<UnsignedInt dimensions> StridedMeshData<dimensions>& StridedMeshData<dimensions>::setIndices(const Mesh::IndexType type, const std::size_t offset, const std::size_t count) {
+    const std::size_t size = Mesh::indexSize(type);
+    CORRADE_ASSERT(offset%size == 0,
+        "Trade::StridedMeshData::setIndices(): offset" << offset << "is not aligned to index size", *this);
+    CORRADE_ASSERT(offset <= _data.size() && count <= (_data.size() - offset)/size,
+        "Trade::StridedMeshData::setIndices(): indices out of data bounds", *this);
+    _indexType = type;
+    _indexOffset = offset;
+    _indexCount = count;
+    return *this;
+}
+
+template<UnsignedInt dimensions> Mesh::IndexType StridedMeshData<dimensions>::indexType() const {
+    CORRADE_ASSERT(isIndexed(), "Trade::StridedMeshData::indexType(): the mesh is not indexed", {});
+    return _indexType;
+}
+
+template<UnsignedInt dimensions> Containers::ArrayReference<const char> StridedMeshData<dimensions>::indexData() const {
+    if(!isIndexed()) return nullptr;
+    return {_data.data() + _indexOffset, _indexCount*Mesh::indexSize(_indexType)};
+}
+
+template<UnsignedInt dimensions> std::vector<UnsignedInt> StridedMeshData<dimensions>::indicesAsArray() const {
+    if(!isIndexed()) return {};
+
+    switch(_indexType) {
+        case Mesh::IndexType::UnsignedByte: {
+            const auto in = indices<UnsignedByte>();
+            return {in.begin(), in.end()};
+        }
+        case Mesh::IndexType::UnsignedShort: {
+            const auto in = indices<UnsignedShort>();
+            return {in.begin(), in.end()};
+        }
+        case Mesh::IndexType::UnsignedInt: {
+            const auto in = indices<UnsignedInt>();
+            return {in.begin(), in.end()};
+        }
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+template<UnsignedInt dimensions> Containers::ArrayReference<const char> StridedMeshData<dimensions>::vertexData() const {
+    if(!_vertexCount) return nullptr;
+
+    std::size_t begin = _positions.offset;
+    std::size_t end = _positions.offset + (_vertexCount - 1)*_positions.stride + sizeof(VectorTypeFor<dimensions, Float>);
+    auto extend = [&](const Attribute& attribute, const std::size_t size) {
+        if(!attribute.present) return;
+        begin = std::min(begin, attribute.offset);
+        end = std::max(end, attribute.offset + (_vertexCount - 1)*attribute.stride + size);
+    };
+    extend(_normals, sizeof(Vector3));
+    extend(_textureCoords2D, sizeof(Vector2));
+    extend(_colors, sizeof(Color4));
+
+    return {_data.data() + begin, end - begin};
+}
+
+template<UnsignedInt dimensions> StridedMeshData<dimensions>& StridedMeshData<dimensions>::setNormals(const std::size_t offset, const std::size_t stride) {
+    CORRADE_ASSERT(fits(offset, stride, sizeof(Vector3)),
+        "Trade::StridedMeshData::setNormals(): normals out of data bounds", *this);
+    _normals = Attribute{offset, stride, true};
+    return *this;
+}
+
+template<UnsignedInt dimensions> StridedMeshData<dimensions>& StridedMeshData<dimensions>::setTextureCoords2D(const std::size_t offset, const std::size_t stride) {
+    CORRADE_ASSERT(fits(offset, stride, sizeof(Vector2)),
+        "Trade::StridedMeshData::setTextureCoords2D(): texture coordinates out of data bounds", *this);
+    _textureCoords2D = Attribute{offset, stride, true};
+    return *this;
+}
+
+template<UnsignedInt dimensions> StridedMeshData<dimensions>& StridedMeshData<dimensions>::setColors(const std::size_t offset, const std::size_t stride) {
+    CORRADE_ASSERT(fits(offset, stride, sizeof(Color4)),
+        "Trade::StridedMeshData::setColors(): colors out of data bounds", *this);
+    _colors = Attribute{offset, stride, true};
+    return *this;
+}
+
+template<UnsignedInt dimensions> bool StridedMeshData<dimensions>::fits(const std::size_t offset, const std::size_t stride, const std::size_t size) const {
+    /* Empty attributes only need a valid offset, otherwise the last item has
+       to fit */
+    if(offset > _data.size()) return false;
+    if(!_vertexCount) return true;
+    return size <= _data.size() - offset && (!stride || _vertexCount - 1 <= (_data.size() - offset - size)/stride);
+}
+
+template class StridedMeshData<2>;
+template class StridedMeshData<3>;
+
+}}
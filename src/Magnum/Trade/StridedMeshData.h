@@ -0,0 +1,339 @@
+#ifndef Magnum_Trade_StridedMeshData_h
+#define Magnum_Trade_StridedMeshData_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::StridedArrayReference, @ref Magnum::Trade::StridedMeshData, typedef @ref Magnum::Trade::StridedMeshData2D, @ref Magnum::Trade::StridedMeshData3D
+ */
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Strided array reference
+
+Non-owning read-only view on @p size items of type @p T placed @p stride bytes
+apart in memory, such as one attribute in interleaved vertex data. The items
+are expected to be suitably aligned for type @p T.
+@see @ref StridedMeshData
+*/
+template<class T> class StridedArrayReference {
+    public:
+        typedef T value_type; /**< @brief Item type */
+
+        /** @brief Default constructor */
+        constexpr /*implicit*/ StridedArrayReference() noexcept: _data{}, _size{}, _stride{} {}
+
+        /**
+         * @brief Constructor
+         * @param data      Pointer to the first item
+         * @param size      Item count
+         * @param stride    Distance between two consecutive items in bytes
+         */
+        constexpr explicit StridedArrayReference(const char* data, std::size_t size, std::size_t stride) noexcept: _data{data}, _size{size}, _stride{stride} {}
+
+        /** @brief Pointer to the first item */
+        constexpr const char* data() const { return _data; }
+
+        /** @brief Item count */
+        constexpr std::size_t size() const { return _size; }
+
+        /** @brief Distance between two consecutive items in bytes */
+        constexpr std::size_t stride() const { return _stride; }
+
+        /** @brief Whether the view is empty */
+        constexpr bool empty() const { return !_size; }
+
+        /** @brief Item at given position */
+        const T& operator[](std::size_t i) const {
+            return *reinterpret_cast<const T*>(_data + i*_stride);
+        }
+
+        /** @brief Copy the items into a contiguous array */
+        std::vector<T> toVector() const {
+            std::vector<T> out;
+            out.reserve(_size);
+            for(std::size_t i = 0; i != _size; ++i) out.push_back((*this)[i]);
+            return out;
+        }
+
+    private:
+        const char* _data;
+        std::size_t _size, _stride;
+};
+
+/**
+@brief Mesh data with strided attribute views
+
+Unlike @ref MeshData2D and @ref MeshData3D, which store every attribute in a
+separate @ref std::vector, this class owns (or just references) a single
+contiguous block of memory and describes the index array and each vertex
+attribute as a view into it. An importer can thus pass its decoded (or
+memory-mapped) data through without any copy and the whole block can be
+uploaded to a single @ref Buffer:
+@code
+Trade::StridedMeshData3D data = ...;
+
+Buffer vertexBuffer, indexBuffer;
+vertexBuffer.setData(data.vertexData(), BufferUsage::StaticDraw);
+indexBuffer.setData(data.indexData(), BufferUsage::StaticDraw);
+
+Mesh mesh;
+mesh.setPrimitive(data.primitive())
+    .setCount(data.indexCount())
+    .addVertexBuffer(vertexBuffer, data.positions().data() - data.vertexData().data(), Shaders::Phong::Position{}, data.positions().stride() - sizeof(Vector3))
+    .setIndexBuffer(indexBuffer, 0, data.indexType());
+@endcode
+
+Position array is required, index array, normals, texture coordinates and
+colors are optional. Only one array of each attribute kind is supported.
+@see @ref StridedMeshData2D, @ref StridedMeshData3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_EXPORT StridedMeshData {
+    public:
+        const static UnsignedInt Dimensions = dimensions; /**< @brief Mesh dimension count */
+
+        /**
+         * @brief Constructor
+         * @param primitive         Primitive
+         * @param data              Index and vertex data
+         * @param vertexCount       Vertex count
+         * @param positionOffset    Offset of first vertex position in
+         *      @p data
+         * @param positionStride    Distance between two consecutive
+         *      positions in bytes
+         *
+         * The data are not copied. Use @ref setIndices(),
+         * @ref setNormals(), @ref setTextureCoords2D() and @ref setColors()
+         * to describe the remaining data.
+         */
+        explicit StridedMeshData(MeshPrimitive primitive, Containers::Array<char>&& data, std::size_t vertexCount, std::size_t positionOffset, std::size_t positionStride);
+
+        /**
+         * @brief Construct a non-owning instance
+         *
+         * Same as above, but the data are only referenced and the caller is
+         * responsible for keeping them alive for the whole lifetime of the
+         * instance, for example when they come from a memory-mapped file.
+         * @see @ref isOwning()
+         */
+        explicit StridedMeshData(MeshPrimitive primitive, Containers::ArrayReference<const char> data, std::size_t vertexCount, std::size_t positionOffset, std::size_t positionStride);
+
+        /** @brief Copying is not allowed */
+        StridedMeshData(const StridedMeshData<dimensions>&) = delete;
+
+        /** @brief Move constructor */
+        StridedMeshData(StridedMeshData<dimensions>&& other) noexcept;
+
+        /** @brief Copying is not allowed */
+        StridedMeshData<dimensions>& operator=(const StridedMeshData<dimensions>&) = delete;
+
+        /** @brief Move assignment */
+        StridedMeshData<dimensions>& operator=(StridedMeshData<dimensions>&& other) noexcept;
+
+        /** @brief Primitive */
+        MeshPrimitive primitive() const { return _primitive; }
+
+        /** @brief Whether the instance owns its data */
+        bool isOwning() const { return !_owned.empty(); }
+
+        /** @brief Whole data block */
+        Containers::ArrayReference<const char> data() const { return _data; }
+
+        /**
+         * @brief Set index array
+         * @param type      Index type
+         * @param offset    Offset of first index in @ref data()
+         * @param count     Index count
+         * @return Reference to self (for method chaining)
+         *
+         * The indices are expected to be tightly packed and to fit into the
+         * data.
+         */
+        StridedMeshData<dimensions>& setIndices(Mesh::IndexType type, std::size_t offset, std::size_t count);
+
+        /** @brief Whether the mesh is indexed */
+        bool isIndexed() const { return _indexCount; }
+
+        /**
+         * @brief Index type
+         *
+         * Expects that the mesh is indexed.
+         * @see @ref isIndexed()
+         */
+        Mesh::IndexType indexType() const;
+
+        /** @brief Index count or `0` if the mesh is not indexed */
+        std::size_t indexCount() const { return _indexCount; }
+
+        /**
+         * @brief Raw index data
+         *
+         * Empty if the mesh is not indexed.
+         */
+        Containers::ArrayReference<const char> indexData() const;
+
+        /**
+         * @brief Indices of given type
+         *
+         * Expects that the mesh is indexed and that size of @p T matches
+         * @ref indexType().
+         */
+        template<class T> Containers::ArrayReference<const T> indices() const;
+
+        /**
+         * @brief Indices converted to 32-bit
+         *
+         * Empty if the mesh is not indexed.
+         */
+        std::vector<UnsignedInt> indicesAsArray() const;
+
+        /** @brief Vertex count */
+        std::size_t vertexCount() const { return _vertexCount; }
+
+        /**
+         * @brief Raw vertex data
+         *
+         * Range of @ref data() spanning all vertex attributes.
+         */
+        Containers::ArrayReference<const char> vertexData() const;
+
+        /** @brief Positions */
+        StridedArrayReference<VectorTypeFor<dimensions, Float>> positions() const {
+            return attribute<VectorTypeFor<dimensions, Float>>(_positions);
+        }
+
+        /**
+         * @brief Set normals
+         * @param offset    Offset of first normal in @ref data()
+         * @param stride    Distance between two consecutive normals in
+         *      bytes
+         * @return Reference to self (for method chaining)
+         *
+         * Meaningful only for three-dimensional meshes. Expects that all
+         * @ref vertexCount() normals fit into the data.
+         */
+        StridedMeshData<dimensions>& setNormals(std::size_t offset, std::size_t stride);
+
+        /** @brief Whether the data contain normals */
+        bool hasNormals() const { return _normals.present; }
+
+        /**
+         * @brief Normals
+         *
+         * Empty if the data don't contain normals.
+         */
+        StridedArrayReference<Vector3> normals() const {
+            return attribute<Vector3>(_normals);
+        }
+
+        /**
+         * @brief Set 2D texture coordinates
+         * @param offset    Offset of first texture coordinate in @ref data()
+         * @param stride    Distance between two consecutive texture
+         *      coordinates in bytes
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that all @ref vertexCount() texture coordinates fit into
+         * the data.
+         */
+        StridedMeshData<dimensions>& setTextureCoords2D(std::size_t offset, std::size_t stride);
+
+        /** @brief Whether the data contain 2D texture coordinates */
+        bool hasTextureCoords2D() const { return _textureCoords2D.present; }
+
+        /**
+         * @brief 2D texture coordinates
+         *
+         * Empty if the data don't contain texture coordinates.
+         */
+        StridedArrayReference<Vector2> textureCoords2D() const {
+            return attribute<Vector2>(_textureCoords2D);
+        }
+
+        /**
+         * @brief Set vertex colors
+         * @param offset    Offset of first color in @ref data()
+         * @param stride    Distance between two consecutive colors in bytes
+         * @return Reference to self (for method chaining)
+         *
+         * Expects that all @ref vertexCount() colors fit into the data.
+         */
+        StridedMeshData<dimensions>& setColors(std::size_t offset, std::size_t stride);
+
+        /** @brief Whether the data contain vertex colors */
+        bool hasColors() const { return _colors.present; }
+
+        /**
+         * @brief Vertex colors
+         *
+         * Empty if the data don't contain colors.
+         */
+        StridedArrayReference<Color4> colors() const {
+            return attribute<Color4>(_colors);
+        }
+
+    private:
+        struct Attribute {
+            std::size_t offset, stride;
+            bool present;
+        };
+
+        template<class T> StridedArrayReference<T> attribute(const Attribute& attribute) const {
+            return attribute.present ? StridedArrayReference<T>{_data.data() + attribute.offset, _vertexCount, attribute.stride} : StridedArrayReference<T>{};
+        }
+
+        bool fits(std::size_t offset, std::size_t stride, std::size_t size) const;
+
+        MeshPrimitive _primitive;
+        Containers::Array<char> _owned;
+        Containers::ArrayReference<const char> _data;
+        Mesh::IndexType _indexType;
+        std::size_t _indexOffset, _indexCount, _vertexCount;
+        Attribute _positions, _normals, _textureCoords2D, _colors;
+};
+
+/** @brief Two-dimensional mesh data with strided attribute views */
+typedef StridedMeshData<2> StridedMeshData2D;
+
+/** @brief Three-dimensional mesh data with strided attribute views */
+typedef StridedMeshData<3> StridedMeshData3D;
+
+template<UnsignedInt dimensions> template<class T> Containers::ArrayReference<const T> StridedMeshData<dimensions>::indices() const {
+    CORRADE_ASSERT(isIndexed(), "Trade::StridedMeshData::indices(): the mesh is not indexed", {});
+    CORRADE_ASSERT(sizeof(T) == Mesh::indexSize(_indexType), "Trade::StridedMeshData::indices(): expected" << Mesh::indexSize(_indexType) << "byte type but got" << sizeof(T), {});
+    return {reinterpret_cast<const T*>(_data.data() + _indexOffset), _indexCount};
+}
+
+}}
+
+#endif
@@ -41,10 +41,12 @@ class AbstractImageConverterTest: public TestSuite::Tester {
         explicit AbstractImageConverterTest();
 
         void exportToFile();
+        void exportToDataInto();
 };
 
 AbstractImageConverterTest::AbstractImageConverterTest() {
-    addTests({&AbstractImageConverterTest::exportToFile});
+    addTests({&AbstractImageConverterTest::exportToFile,
+              &AbstractImageConverterTest::exportToDataInto});
 }
 
 void AbstractImageConverterTest::exportToFile() {
@@ -68,6 +70,25 @@ void AbstractImageConverterTest::exportToFile() {
         "\xFE\xED", TestSuite::Compare::FileToString);
 }
 
+void AbstractImageConverterTest::exportToDataInto() {
+    class DataExporter: public Trade::AbstractImageConverter {
+        private:
+            Features doFeatures() const override { return Feature::ConvertData; }
+
+            Containers::Array<char> doExportToData(const ImageReference2D& image) const override {
+                return Containers::Array<char>::from(char(image.size().x()), char(image.size().y()));
+            };
+    };
+
+    /* Default implementation should call doExportToData() and replace
+       previous buffer contents */
+    DataExporter exporter;
+    ImageReference2D image(ColorFormat::RGBA, ColorType::UnsignedByte, {0xfe, 0xed}, nullptr);
+    std::vector<char> data{'a', 'b', 'c'};
+    CORRADE_VERIFY(exporter.exportToData(image, data));
+    CORRADE_COMPARE(data, (std::vector<char>{'\xfe', '\xed'}));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::AbstractImageConverterTest)
@@ -28,6 +28,8 @@
 #include <Corrade/Utility/Directory.h>
 
 #include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/FlatSceneData3D.h"
+#include "Magnum/Trade/SceneData.h"
 
 #include "configure.h"
 
@@ -38,10 +40,42 @@ class AbstractImporterTest: public TestSuite::Tester {
         explicit AbstractImporterTest();
 
         void openFile();
+        void openFileDataFlags();
+        void flatScene3D();
+        void flatScene3DFailed();
 };
 
 AbstractImporterTest::AbstractImporterTest() {
-    addTests({&AbstractImporterTest::openFile});
+    addTests({&AbstractImporterTest::openFile,
+              &AbstractImporterTest::openFileDataFlags,
+              &AbstractImporterTest::flatScene3D,
+              &AbstractImporterTest::flatScene3DFailed});
+}
+
+namespace {
+    /* Scene with objects 3 and 0 in root, object 0 has children 2 and 1 */
+    class SceneImporter: public Trade::AbstractImporter {
+        public:
+            explicit SceneImporter(bool broken = false): broken(broken) {}
+
+        private:
+            Features doFeatures() const override { return {}; }
+            bool doIsOpened() const override { return true; }
+            void doClose() override {}
+
+            UnsignedInt doSceneCount() const override { return 1; }
+            std::optional<SceneData> doScene(UnsignedInt) override {
+                return SceneData{{}, {3, 0}};
+            }
+
+            UnsignedInt doObject3DCount() const override { return broken ? 3 : 4; }
+            std::unique_ptr<ObjectData3D> doObject3D(UnsignedInt id) override {
+                if(id == 0) return std::unique_ptr<ObjectData3D>{new ObjectData3D{{2, 1}, Matrix4::translation(Vector3::xAxis())}};
+                return std::unique_ptr<ObjectData3D>{new ObjectData3D{{}, Matrix4::scaling(Vector3{Float(id)}), ObjectInstanceType3D::Mesh, id*10}};
+            }
+
+            bool broken;
+    };
 }
 
 void AbstractImporterTest::openFile() {
@@ -68,6 +102,69 @@ void AbstractImporterTest::openFile() {
     CORRADE_VERIFY(importer.isOpened());
 }
 
+void AbstractImporterTest::openFileDataFlags() {
+    class DataImporter: public Trade::AbstractImporter {
+        public:
+            explicit DataImporter(): opened(false) {}
+
+            Containers::ArrayReference<const char> data;
+            DataFlags flags;
+
+        private:
+            Features doFeatures() const override { return Feature::OpenData; }
+            bool doIsOpened() const override { return opened; }
+            void doClose() override { opened = false; }
+
+            void doOpenData(Containers::ArrayReference<const char> data, DataFlags flags) override {
+                this->data = data;
+                this->flags = flags;
+                opened = true;
+            }
+
+            bool opened;
+    };
+
+    DataImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(TRADE_TEST_DIR, "file.bin")));
+
+    /* Memory-mapped data are accessible until close() */
+    #if defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+    CORRADE_VERIFY(importer.flags & AbstractImporter::DataFlag::Persistent);
+    CORRADE_COMPARE(importer.data.size(), 1);
+    CORRADE_COMPARE(importer.data[0], '\xa5');
+    #else
+    CORRADE_VERIFY(!(importer.flags & AbstractImporter::DataFlag::Persistent));
+    #endif
+
+    /* Data passed from openData() are never persistent */
+    const char data[]{'\xa5'};
+    CORRADE_VERIFY(importer.openData(data));
+    CORRADE_VERIFY(!(importer.flags & AbstractImporter::DataFlag::Persistent));
+}
+
+void AbstractImporterTest::flatScene3D() {
+    SceneImporter importer;
+    std::optional<FlatSceneData3D> scene = importer.flatScene3D(0);
+    CORRADE_VERIFY(scene);
+
+    /* Depth-first, parents before children, children in original order */
+    CORRADE_COMPARE(scene->objectCount(), 4);
+    CORRADE_COMPARE(scene->objectIds(), (std::vector<UnsignedInt>{3, 0, 2, 1}));
+    CORRADE_COMPARE(scene->parents(), (std::vector<Int>{-1, -1, 1, 1}));
+    CORRADE_COMPARE(scene->instanceTypes(), (std::vector<ObjectInstanceType3D>{
+        ObjectInstanceType3D::Mesh, ObjectInstanceType3D::Empty,
+        ObjectInstanceType3D::Mesh, ObjectInstanceType3D::Mesh}));
+    CORRADE_COMPARE(scene->instances(), (std::vector<Int>{30, -1, 20, 10}));
+    CORRADE_COMPARE(scene->transformations()[1], Matrix4::translation(Vector3::xAxis()));
+    CORRADE_COMPARE(scene->transformations()[2], Matrix4::scaling(Vector3{2.0f}));
+}
+
+void AbstractImporterTest::flatScene3DFailed() {
+    /* Object 3 is out of range */
+    SceneImporter importer{true};
+    CORRADE_VERIFY(!importer.flatScene3D(0));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::AbstractImporterTest)
@@ -0,0 +1,177 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <set>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/TaskScheduler.h"
+#include "Magnum/Trade/ImageBatchImporter.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class ImageBatchImporterTest: public TestSuite::Tester {
+    public:
+        explicit ImageBatchImporterTest();
+
+        void construct();
+        void import();
+        void importFailed();
+        void maxInFlight();
+        void destroyPending();
+};
+
+ImageBatchImporterTest::ImageBatchImporterTest() {
+    addTests({&ImageBatchImporterTest::construct,
+              &ImageBatchImporterTest::import,
+              &ImageBatchImporterTest::importFailed,
+              &ImageBatchImporterTest::maxInFlight,
+              &ImageBatchImporterTest::destroyPending});
+}
+
+namespace {
+
+/* "Opens" files with single-character names which don't start with `-`,
+   imports them as 1x1 image with the character as pixel value */
+class Importer: public AbstractImporter {
+    public:
+        explicit Importer(std::atomic<Int>* decoded = nullptr): _decoded{decoded} {}
+
+    private:
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return !_filename.empty(); }
+        void doClose() override { _filename = {}; }
+
+        void doOpenFile(const std::string& filename) override {
+            if(filename.size() == 1 && filename[0] != '-') _filename = filename;
+        }
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+
+        std::optional<ImageData2D> doImage2D(UnsignedInt) override {
+            if(_decoded) ++*_decoded;
+            return ImageData2D{ColorFormat::Red, ColorType::UnsignedByte, {1, 1}, new char[1]{_filename[0]}};
+        }
+
+        std::string _filename;
+        std::atomic<Int>* _decoded;
+};
+
+std::vector<std::unique_ptr<AbstractImporter>> importers(UnsignedInt count, std::atomic<Int>* decoded = nullptr) {
+    std::vector<std::unique_ptr<AbstractImporter>> importers;
+    for(UnsignedInt i = 0; i != count; ++i)
+        importers.emplace_back(new Importer{decoded});
+    return importers;
+}
+
+/* Makes a scheduler with worker threads global for the lifetime of the
+   instance, so the imports actually run in parallel */
+struct GlobalScheduler {
+    explicit GlobalScheduler(UnsignedInt threadCount): scheduler{threadCount} {
+        TaskScheduler::setGlobal(&scheduler);
+    }
+
+    ~GlobalScheduler() { TaskScheduler::setGlobal(nullptr); }
+
+    TaskScheduler scheduler;
+};
+
+}
+
+void ImageBatchImporterTest::construct() {
+    ImageBatchImporter importer{importers(3), 5};
+    CORRADE_COMPARE(importer.threadCount(), 3);
+    CORRADE_COMPARE(importer.maxInFlight(), 5);
+    CORRADE_COMPARE(importer.pendingCount(), 0);
+}
+
+void ImageBatchImporterTest::import() {
+    ImageBatchImporter importer{importers(4)};
+
+    const std::string files = "abcdefghijklmnopqrstuvwxyz0123456789";
+    for(char c: files) importer.add(std::string(1, c));
+    CORRADE_COMPARE(importer.pendingCount(), files.size());
+
+    /* The images are delivered in any order, but all of them */
+    std::set<char> imported;
+    while(importer.pendingCount()) {
+        std::pair<std::string, std::optional<ImageData2D>> image = importer.next();
+        CORRADE_VERIFY(image.second);
+        CORRADE_COMPARE(image.second->size(), Vector2i(1, 1));
+        CORRADE_COMPARE(image.second->data()[0], image.first[0]);
+        imported.insert(image.first[0]);
+    }
+
+    CORRADE_COMPARE(imported, (std::set<char>{files.begin(), files.end()}));
+}
+
+void ImageBatchImporterTest::importFailed() {
+    ImageBatchImporter importer{importers(2)};
+    importer.add("-")
+        .add("nonexistent");
+    CORRADE_COMPARE(importer.pendingCount(), 2);
+
+    std::set<std::string> failed;
+    while(importer.pendingCount()) {
+        std::pair<std::string, std::optional<ImageData2D>> image = importer.next();
+        CORRADE_VERIFY(!image.second);
+        failed.insert(image.first);
+    }
+
+    CORRADE_COMPARE(failed, (std::set<std::string>{"-", "nonexistent"}));
+}
+
+void ImageBatchImporterTest::maxInFlight() {
+    GlobalScheduler scheduler{4};
+    std::atomic<Int> decoded{0};
+    ImageBatchImporter importer{importers(4, &decoded), 4};
+
+    for(Int i = 0; i != 200; ++i) importer.add(std::string(1, 'a' + i%26));
+
+    /* Retrieve the images slowly so the workers have a chance to overshoot.
+       Before each retrieval, at most four images more than retrieved so far
+       can be decoded. */
+    for(Int retrieved = 0; importer.pendingCount(); ++retrieved) {
+        for(volatile Int i = 0; i != 100000; ++i);
+        CORRADE_VERIFY(decoded <= retrieved + 4);
+        CORRADE_VERIFY(importer.next().second);
+    }
+
+    CORRADE_COMPARE(decoded.load(), 200);
+}
+
+void ImageBatchImporterTest::destroyPending() {
+    /* Destroying the importer with files still pending shouldn't hang or
+       crash */
+    GlobalScheduler scheduler{2};
+    ImageBatchImporter importer{importers(2), 2};
+    for(Int i = 0; i != 100; ++i) importer.add("a");
+    CORRADE_VERIFY(importer.next().second);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ImageBatchImporterTest)
@@ -35,20 +35,32 @@ class ImageDataTest: public TestSuite::Tester {
         explicit ImageDataTest();
 
         void construct();
+        void constructCustomDeleter();
         void constructCopy();
         void constructMove();
 
         void toReference();
         void release();
+
+        void constructCompressed();
+        void constructMoveCompressed();
+        void toReferenceCompressed();
+        void releaseCompressed();
 };
 
 ImageDataTest::ImageDataTest() {
     addTests({&ImageDataTest::construct,
+              &ImageDataTest::constructCustomDeleter,
               &ImageDataTest::constructCopy,
               &ImageDataTest::constructMove,
 
               &ImageDataTest::toReference,
-              &ImageDataTest::release});
+              &ImageDataTest::release,
+
+              &ImageDataTest::constructCompressed,
+              &ImageDataTest::constructMoveCompressed,
+              &ImageDataTest::toReferenceCompressed,
+              &ImageDataTest::releaseCompressed});
 }
 
 void ImageDataTest::construct() {
@@ -61,6 +73,36 @@ void ImageDataTest::construct() {
     CORRADE_COMPARE(a.data(), data);
 }
 
+namespace {
+    char* deletedData;
+    std::size_t deletedSize;
+
+    void deleter(char* data, std::size_t size) {
+        deletedData = data;
+        deletedSize = size;
+    }
+}
+
+void ImageDataTest::constructCustomDeleter() {
+    deletedData = nullptr;
+    deletedSize = 0;
+
+    char data[4*2];
+    {
+        Trade::ImageData2D a(ColorFormat::RG, ColorType::UnsignedByte, {2, 2}, data, deleter);
+        CORRADE_COMPARE(a.data(), data);
+        CORRADE_VERIFY(a.deleter() == deleter);
+
+        /* Moving should transfer the deleter as well */
+        Trade::ImageData2D b(std::move(a));
+        CORRADE_VERIFY(!a.deleter());
+        CORRADE_VERIFY(b.deleter() == deleter);
+    }
+
+    CORRADE_VERIFY(deletedData == data);
+    CORRADE_COMPARE(deletedSize, std::size_t(4*2));
+}
+
 void ImageDataTest::constructCopy() {
     CORRADE_VERIFY(!(std::is_constructible<Trade::ImageData2D, const Trade::ImageData2D&>{}));
     CORRADE_VERIFY(!(std::is_assignable<Trade::ImageData2D, const Trade::ImageData2D&>{}));
@@ -122,6 +164,68 @@ void ImageDataTest::release() {
     CORRADE_COMPARE(a.size(), Vector2i());
 }
 
+void ImageDataTest::constructCompressed() {
+    Containers::Array<char> data{8};
+    const char* const pointer = data.data();
+    Trade::CompressedImageData2D a(CompressedColorFormat::RGBAS3tcDxt1, {4, 4}, std::move(data));
+
+    CORRADE_COMPARE(a.format(), CompressedColorFormat::RGBAS3tcDxt1);
+    CORRADE_COMPARE(a.size(), Vector2i(4, 4));
+    CORRADE_COMPARE(a.data().data(), pointer);
+    CORRADE_COMPARE(a.data().size(), 8);
+}
+
+void ImageDataTest::constructMoveCompressed() {
+    CORRADE_VERIFY(!(std::is_constructible<Trade::CompressedImageData2D, const Trade::CompressedImageData2D&>{}));
+
+    Containers::Array<char> data{8};
+    const char* const pointer = data.data();
+    Trade::CompressedImageData2D a(CompressedColorFormat::RGBAS3tcDxt1, {4, 4}, std::move(data));
+    Trade::CompressedImageData2D b(std::move(a));
+
+    CORRADE_COMPARE(a.data().data(), nullptr);
+    CORRADE_COMPARE(a.size(), Vector2i());
+
+    CORRADE_COMPARE(b.format(), CompressedColorFormat::RGBAS3tcDxt1);
+    CORRADE_COMPARE(b.size(), Vector2i(4, 4));
+    CORRADE_COMPARE(b.data().data(), pointer);
+
+    Containers::Array<char> data2{16};
+    const char* const pointer2 = data2.data();
+    Trade::CompressedImageData2D c(CompressedColorFormat::RGBAS3tcDxt5, {4, 4}, std::move(data2));
+    c = std::move(b);
+
+    CORRADE_COMPARE(b.format(), CompressedColorFormat::RGBAS3tcDxt5);
+    CORRADE_COMPARE(b.data().data(), pointer2);
+
+    CORRADE_COMPARE(c.format(), CompressedColorFormat::RGBAS3tcDxt1);
+    CORRADE_COMPARE(c.size(), Vector2i(4, 4));
+    CORRADE_COMPARE(c.data().data(), pointer);
+}
+
+void ImageDataTest::toReferenceCompressed() {
+    Containers::Array<char> data{8};
+    const char* const pointer = data.data();
+    const Trade::CompressedImageData2D a(CompressedColorFormat::RGBAS3tcDxt1, {4, 4}, std::move(data));
+    CompressedImageReference2D b = a;
+
+    CORRADE_COMPARE(b.format(), CompressedColorFormat::RGBAS3tcDxt1);
+    CORRADE_COMPARE(b.size(), Vector2i(4, 4));
+    CORRADE_COMPARE(b.data().data(), pointer);
+    CORRADE_COMPARE(b.data().size(), 8);
+}
+
+void ImageDataTest::releaseCompressed() {
+    Containers::Array<char> data{8};
+    const char* const pointer = data.data();
+    Trade::CompressedImageData2D a(CompressedColorFormat::RGBAS3tcDxt1, {4, 4}, std::move(data));
+    const Containers::Array<char> released = a.release();
+
+    CORRADE_COMPARE(released.data(), pointer);
+    CORRADE_COMPARE(a.data().data(), nullptr);
+    CORRADE_COMPARE(a.size(), Vector2i());
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::ImageDataTest)
@@ -26,7 +26,7 @@
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
-#include "Magnum/Trade/ObjectData3D.h"
+#include "Magnum/Trade/MeshObjectData3D.h"
 
 namespace Magnum { namespace Trade { namespace Test {
 
@@ -34,11 +34,27 @@ class ObjectData3DTest: public TestSuite::Tester {
     public:
         explicit ObjectData3DTest();
 
+        void meshSkinned();
         void debug();
 };
 
 ObjectData3DTest::ObjectData3DTest() {
-    addTests({&ObjectData3DTest::debug});
+    addTests({&ObjectData3DTest::meshSkinned,
+              &ObjectData3DTest::debug});
+}
+
+void ObjectData3DTest::meshSkinned() {
+    const MeshObjectData3D plain{{}, {}, 2, 1};
+    CORRADE_VERIFY(!plain.isSkinned());
+    CORRADE_VERIFY(plain.joints().empty());
+
+    const MeshObjectData3D skinned{{}, {}, 2, 1, {3, 4},
+        {Matrix4(), Matrix4::translation(Vector3::yAxis(-1.0f))}};
+    CORRADE_VERIFY(skinned.isSkinned());
+    CORRADE_COMPARE(skinned.instanceType(), ObjectInstanceType3D::Mesh);
+    CORRADE_COMPARE(skinned.joints(), (std::vector<UnsignedInt>{3, 4}));
+    CORRADE_COMPARE(skinned.inverseBindMatrices().size(), 2);
+    CORRADE_COMPARE(skinned.inverseBindMatrices()[1], Matrix4::translation(Vector3::yAxis(-1.0f)));
 }
 
 void ObjectData3DTest::debug() {
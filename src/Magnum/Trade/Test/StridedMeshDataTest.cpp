@@ -0,0 +1,241 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Color.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData2D.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/Trade/StridedMeshData.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class StridedMeshDataTest: public TestSuite::Tester {
+    public:
+        explicit StridedMeshDataTest();
+
+        void construct();
+        void constructNonOwning();
+        void constructCopy();
+        void constructMove();
+
+        void indices();
+        void notIndexed();
+
+        void attributes();
+
+        void toMeshData2D();
+        void toMeshData3D();
+};
+
+StridedMeshDataTest::StridedMeshDataTest() {
+    addTests({&StridedMeshDataTest::construct,
+              &StridedMeshDataTest::constructNonOwning,
+              &StridedMeshDataTest::constructCopy,
+              &StridedMeshDataTest::constructMove,
+
+              &StridedMeshDataTest::indices,
+              &StridedMeshDataTest::notIndexed,
+
+              &StridedMeshDataTest::attributes,
+
+              &StridedMeshDataTest::toMeshData2D,
+              &StridedMeshDataTest::toMeshData3D});
+}
+
+namespace {
+
+/* Six UnsignedShort indices followed by three vertices, each with position,
+   normal and texture coordinates */
+struct Vertex {
+    Vector3 position;
+    Vector3 normal;
+    Vector2 textureCoordinates;
+};
+
+struct Data {
+    UnsignedShort indices[6];
+    UnsignedShort padding[2];
+    Vertex vertices[3];
+};
+
+Containers::Array<char> data() {
+    const Data data{
+        {0, 1, 2, 2, 1, 0}, {},
+        {{{1.0f, 2.0f, 3.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.5f}},
+         {{4.0f, 5.0f, 6.0f}, {1.0f, 0.0f, 0.0f}, {0.5f, 1.0f}},
+         {{7.0f, 8.0f, 9.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f}}}
+    };
+
+    Containers::Array<char> out(sizeof(Data));
+    std::copy(reinterpret_cast<const char*>(&data), reinterpret_cast<const char*>(&data) + sizeof(Data), out.begin());
+    return out;
+}
+
+constexpr std::size_t VertexOffset = offsetof(Data, vertices);
+
+}
+
+void StridedMeshDataTest::construct() {
+    Containers::Array<char> a = data();
+    const char* const pointer = a.data();
+    StridedMeshData3D mesh{MeshPrimitive::Triangles, std::move(a), 3, VertexOffset, sizeof(Vertex)};
+
+    CORRADE_VERIFY(mesh.isOwning());
+    CORRADE_COMPARE(mesh.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh.data().data(), pointer);
+    CORRADE_COMPARE(mesh.data().size(), sizeof(Data));
+    CORRADE_VERIFY(!mesh.isIndexed());
+    CORRADE_COMPARE(mesh.vertexCount(), 3);
+    CORRADE_COMPARE(mesh.positions().size(), 3);
+    CORRADE_COMPARE(mesh.positions().stride(), sizeof(Vertex));
+    CORRADE_COMPARE(mesh.positions()[0], Vector3(1.0f, 2.0f, 3.0f));
+    CORRADE_COMPARE(mesh.positions()[2], Vector3(7.0f, 8.0f, 9.0f));
+    CORRADE_VERIFY(!mesh.hasNormals());
+    CORRADE_VERIFY(mesh.normals().empty());
+    CORRADE_VERIFY(!mesh.hasTextureCoords2D());
+    CORRADE_VERIFY(!mesh.hasColors());
+}
+
+void StridedMeshDataTest::constructNonOwning() {
+    const Containers::Array<char> a = data();
+    StridedMeshData3D mesh{MeshPrimitive::Triangles, a, 3, VertexOffset, sizeof(Vertex)};
+
+    CORRADE_VERIFY(!mesh.isOwning());
+    CORRADE_COMPARE(mesh.data().data(), a.data());
+    CORRADE_COMPARE(mesh.positions().data(), a.data() + VertexOffset);
+    CORRADE_COMPARE(mesh.positions()[1], Vector3(4.0f, 5.0f, 6.0f));
+}
+
+void StridedMeshDataTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<StridedMeshData3D, const StridedMeshData3D&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<StridedMeshData3D, const StridedMeshData3D&>{}));
+}
+
+void StridedMeshDataTest::constructMove() {
+    Containers::Array<char> a = data();
+    const char* const pointer = a.data();
+    StridedMeshData3D b{MeshPrimitive::Triangles, std::move(a), 3, VertexOffset, sizeof(Vertex)};
+    b.setIndices(Mesh::IndexType::UnsignedShort, 0, 6);
+
+    StridedMeshData3D c{std::move(b)};
+    CORRADE_COMPARE(b.data().data(), nullptr);
+    CORRADE_COMPARE(b.vertexCount(), 0);
+    CORRADE_VERIFY(!b.isIndexed());
+    CORRADE_VERIFY(!b.isOwning());
+    CORRADE_COMPARE(c.data().data(), pointer);
+    CORRADE_COMPARE(c.indexCount(), 6);
+    CORRADE_COMPARE(c.positions()[0], Vector3(1.0f, 2.0f, 3.0f));
+
+    Containers::Array<char> d(16);
+    StridedMeshData3D e{MeshPrimitive::Points, std::move(d), 1, 0, 12};
+    e = std::move(c);
+    CORRADE_COMPARE(e.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(e.data().data(), pointer);
+    CORRADE_COMPARE(e.indexCount(), 6);
+    CORRADE_COMPARE(c.primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE(c.vertexCount(), 1);
+}
+
+void StridedMeshDataTest::indices() {
+    const Containers::Array<char> a = data();
+    StridedMeshData3D mesh{MeshPrimitive::Triangles, a, 3, VertexOffset, sizeof(Vertex)};
+    mesh.setIndices(Mesh::IndexType::UnsignedShort, 0, 6);
+
+    CORRADE_VERIFY(mesh.isIndexed());
+    CORRADE_COMPARE(mesh.indexType(), Mesh::IndexType::UnsignedShort);
+    CORRADE_COMPARE(mesh.indexCount(), 6);
+    CORRADE_COMPARE(mesh.indexData().data(), a.data());
+    CORRADE_COMPARE(mesh.indexData().size(), 12);
+    CORRADE_COMPARE(mesh.indices<UnsignedShort>()[2], 2);
+    CORRADE_COMPARE(mesh.indices<UnsignedShort>()[5], 0);
+    CORRADE_COMPARE(mesh.indicesAsArray(), (std::vector<UnsignedInt>{0, 1, 2, 2, 1, 0}));
+}
+
+void StridedMeshDataTest::notIndexed() {
+    const Containers::Array<char> a = data();
+    StridedMeshData3D mesh{MeshPrimitive::Triangles, a, 3, VertexOffset, sizeof(Vertex)};
+    CORRADE_VERIFY(!mesh.isIndexed());
+    CORRADE_COMPARE(mesh.indexCount(), 0);
+    CORRADE_COMPARE(mesh.indexData().size(), 0);
+    CORRADE_VERIFY(mesh.indicesAsArray().empty());
+}
+
+void StridedMeshDataTest::attributes() {
+    const Containers::Array<char> a = data();
+    StridedMeshData3D mesh{MeshPrimitive::Triangles, a, 3, VertexOffset, sizeof(Vertex)};
+    mesh.setNormals(VertexOffset + offsetof(Vertex, normal), sizeof(Vertex))
+        .setTextureCoords2D(VertexOffset + offsetof(Vertex, textureCoordinates), sizeof(Vertex));
+
+    CORRADE_VERIFY(mesh.hasNormals());
+    CORRADE_COMPARE(mesh.normals().size(), 3);
+    CORRADE_COMPARE(mesh.normals()[1], Vector3(1.0f, 0.0f, 0.0f));
+    CORRADE_VERIFY(mesh.hasTextureCoords2D());
+    CORRADE_COMPARE(mesh.textureCoords2D()[2], Vector2(1.0f, 0.0f));
+    CORRADE_COMPARE(mesh.textureCoords2D().toVector(), (std::vector<Vector2>{{0.0f, 0.5f}, {0.5f, 1.0f}, {1.0f, 0.0f}}));
+
+    /* Vertex data span everything after the indices */
+    CORRADE_COMPARE(mesh.vertexData().data(), a.data() + VertexOffset);
+    CORRADE_COMPARE(mesh.vertexData().size(), 3*sizeof(Vertex));
+
+    /* Colors reinterpreting the normals and texture coordinates */
+    mesh.setColors(VertexOffset + offsetof(Vertex, normal), sizeof(Vertex));
+    CORRADE_VERIFY(mesh.hasColors());
+    CORRADE_COMPARE(mesh.colors()[0], Color4(0.0f, 1.0f, 0.0f, 0.0f));
+}
+
+void StridedMeshDataTest::toMeshData2D() {
+    const Containers::Array<char> a = data();
+    StridedMeshData2D mesh{MeshPrimitive::Triangles, a, 3, VertexOffset, sizeof(Vertex)};
+    mesh.setIndices(Mesh::IndexType::UnsignedShort, 0, 6)
+        .setTextureCoords2D(VertexOffset + offsetof(Vertex, textureCoordinates), sizeof(Vertex));
+
+    const MeshData2D data{mesh};
+    CORRADE_COMPARE(data.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(data.indices(), (std::vector<UnsignedInt>{0, 1, 2, 2, 1, 0}));
+    CORRADE_COMPARE(data.positionArrayCount(), 1);
+    CORRADE_COMPARE(data.positions(0), (std::vector<Vector2>{{1.0f, 2.0f}, {4.0f, 5.0f}, {7.0f, 8.0f}}));
+    CORRADE_COMPARE(data.textureCoords2DArrayCount(), 1);
+    CORRADE_COMPARE(data.textureCoords2D(0), (std::vector<Vector2>{{0.0f, 0.5f}, {0.5f, 1.0f}, {1.0f, 0.0f}}));
+}
+
+void StridedMeshDataTest::toMeshData3D() {
+    const Containers::Array<char> a = data();
+    StridedMeshData3D mesh{MeshPrimitive::Triangles, a, 3, VertexOffset, sizeof(Vertex)};
+    mesh.setNormals(VertexOffset + offsetof(Vertex, normal), sizeof(Vertex));
+
+    const MeshData3D data{mesh};
+    CORRADE_COMPARE(data.primitive(), MeshPrimitive::Triangles);
+    CORRADE_VERIFY(!data.isIndexed());
+    CORRADE_COMPARE(data.positions(0), (std::vector<Vector3>{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}}));
+    CORRADE_COMPARE(data.normalArrayCount(), 1);
+    CORRADE_COMPARE(data.normals(0), (std::vector<Vector3>{{0.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}));
+    CORRADE_VERIFY(!data.hasTextureCoords2D());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::StridedMeshDataTest)
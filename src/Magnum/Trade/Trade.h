@@ -39,6 +39,14 @@ class AbstractImporter;
 class AbstractMaterialData;
 class CameraData;
 
+template<UnsignedInt> class CompressedImageData;
+typedef CompressedImageData<1> CompressedImageData1D;
+typedef CompressedImageData<2> CompressedImageData2D;
+typedef CompressedImageData<3> CompressedImageData3D;
+
+class FlatSceneData3D;
+class ImageBatchImporter;
+
 template<UnsignedInt> class ImageData;
 typedef ImageData<1> ImageData1D;
 typedef ImageData<2> ImageData2D;
@@ -52,6 +60,12 @@ class MeshObjectData3D;
 class ObjectData2D;
 class ObjectData3D;
 class PhongMaterialData;
+
+template<class> class StridedArrayReference;
+template<UnsignedInt> class StridedMeshData;
+typedef StridedMeshData<2> StridedMeshData2D;
+typedef StridedMeshData<3> StridedMeshData3D;
+
 class TextureData;
 class SceneData;
 #endif
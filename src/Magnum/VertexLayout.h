@@ -0,0 +1,239 @@
+#ifndef Magnum_VertexLayout_h
+#define Magnum_VertexLayout_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::VertexLayout
+ */
+
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Attribute.h"
+#include "Magnum/Math/BoolVector.h"
+
+namespace Magnum {
+
+namespace Implementation {
+
+enum class VertexLayoutAttributeKind: UnsignedByte {
+    Generic,
+    #ifndef MAGNUM_TARGET_GLES2
+    Integer,
+    #ifndef MAGNUM_TARGET_GLES
+    Long
+    #endif
+    #endif
+};
+
+/* Precomputed setup of one attribute, matrix attributes are split into
+   per-column locations by Mesh */
+struct VertexLayoutAttribute {
+    GLuint location;
+    GLint components;
+    GLenum type;
+    VertexLayoutAttributeKind kind;
+    UnsignedInt vectorCount;
+    GLsizei vectorSize;
+    GLsizei offset;
+};
+
+template<class ...> struct VertexLayoutSize;
+template<> struct VertexLayoutSize<> {
+    enum: std::size_t { Value = 0 };
+};
+template<class T, class ...U> struct VertexLayoutSize<T, U...> {
+    enum: std::size_t { Value = sizeof(typename T::Type) + VertexLayoutSize<U...>::Value };
+};
+
+/* Offset of i-th attribute is the size of all attributes before it */
+template<std::size_t i, class ...T> struct VertexLayoutOffset;
+template<class T, class ...U> struct VertexLayoutOffset<0, T, U...> {
+    enum: std::size_t { Value = 0 };
+};
+template<std::size_t i, class T, class ...U> struct VertexLayoutOffset<i, T, U...> {
+    enum: std::size_t { Value = sizeof(typename T::Type) + VertexLayoutOffset<i - 1, U...>::Value };
+};
+
+template<class T> constexpr VertexLayoutAttributeKind vertexLayoutAttributeKind() {
+    #ifdef MAGNUM_TARGET_GLES2
+    static_assert(std::is_same<typename T::ScalarType, Float>::value,
+        "integer attributes are not available in OpenGL ES 2.0");
+    return VertexLayoutAttributeKind::Generic;
+    #elif defined(MAGNUM_TARGET_GLES)
+    static_assert(!std::is_same<typename T::ScalarType, double>::value,
+        "double attributes are not available in OpenGL ES");
+    return std::is_same<typename T::ScalarType, Float>::value ?
+        VertexLayoutAttributeKind::Generic : VertexLayoutAttributeKind::Integer;
+    #else
+    return std::is_same<typename T::ScalarType, Float>::value ?
+        VertexLayoutAttributeKind::Generic :
+        std::is_same<typename T::ScalarType, Double>::value ?
+            VertexLayoutAttributeKind::Long : VertexLayoutAttributeKind::Integer;
+    #endif
+}
+
+template<class T> constexpr VertexLayoutAttribute vertexLayoutAttribute(std::size_t offset) {
+    return VertexLayoutAttribute{
+        T::Location,
+        GLint(T{}.components()),
+        GLenum(T{}.dataType()),
+        vertexLayoutAttributeKind<T>(),
+        T::VectorCount,
+        GLsizei(sizeof(typename T::Type)/T::VectorCount),
+        GLsizei(offset)
+    };
+}
+
+template<bool ...> struct VertexLayoutBools {};
+
+template<class, class ...> struct VertexLayoutAttributes;
+template<std::size_t ...sequence, class ...T> struct VertexLayoutAttributes<Math::Implementation::Sequence<sequence...>, T...> {
+    static constexpr VertexLayoutAttribute Data[]{
+        vertexLayoutAttribute<T>(VertexLayoutOffset<sequence, T...>::Value)...
+    };
+};
+
+template<std::size_t ...sequence, class ...T> constexpr VertexLayoutAttribute VertexLayoutAttributes<Math::Implementation::Sequence<sequence...>, T...>::Data[];
+
+}
+
+/**
+@brief Compile-time vertex layout
+
+Describes interleaved vertex data consisting of given @ref Attribute types,
+each in its default configuration (i.e. with the same data type and component
+count as the type used in the shader), tightly packed in the order they are
+specified. Stride and attribute offsets are compile-time constants and the
+attribute setup is precomputed in a static table, so adding the layout to a
+mesh using @ref Mesh::addVertexBuffer(Buffer&, GLintptr, const VertexLayout<T...>&)
+doesn't need to compute anything and only walks the table. That makes a
+difference when configuring large amount of meshes with the same layout. The
+same layout is used to interleave the data with @ref interleave(), so the
+buffer contents always match the attribute setup:
+@code
+typedef VertexLayout<Shaders::Phong::Position, Shaders::Phong::Normal> Layout;
+static_assert(Layout::Stride == 24, "");
+static_assert(Layout::offset<1>() == 12, "");
+
+std::vector<Vector3> positions, normals;
+Buffer vertices;
+vertices.setData(Layout::interleave(positions, normals), BufferUsage::StaticDraw);
+
+Mesh mesh;
+mesh.setCount(positions.size())
+    .addVertexBuffer(vertices, 0, Layout{});
+@endcode
+
+For layouts with gaps, non-default data types, normalized data or data
+spread across more buffers use the runtime variant of
+@ref Mesh::addVertexBuffer() together with @ref MeshTools::interleave().
+*/
+template<class ...Attributes> class VertexLayout {
+    static_assert(sizeof...(Attributes) != 0, "VertexLayout: expected at least one attribute");
+
+    public:
+        enum: std::size_t {
+            /** Attribute count */
+            AttributeCount = sizeof...(Attributes),
+
+            /** Stride of one vertex in bytes */
+            Stride = Implementation::VertexLayoutSize<Attributes...>::Value
+        };
+
+        /** @brief Offset of attribute at given index in bytes */
+        template<std::size_t i> constexpr static std::size_t offset() {
+            return Implementation::VertexLayoutOffset<i, Attributes...>::Value;
+        }
+
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        /* Precomputed attribute setup, used by Mesh */
+        static const Implementation::VertexLayoutAttribute* attributes() {
+            return Implementation::VertexLayoutAttributes<typename Math::Implementation::GenerateSequence<sizeof...(Attributes)>::Type, Attributes...>::Data;
+        }
+        #endif
+
+        /**
+         * @brief Interleave attribute data into existing buffer
+         * @param buffer    Destination buffer
+         * @param data      Attribute arrays, one for each attribute
+         * @return Vertex count
+         *
+         * Each attribute array is expected to be a contiguous container
+         * (e.g. `std::vector` or `std::array`) of the attribute type and all
+         * arrays are expected to have the same size. The buffer is expected
+         * to have space for at least @ref Stride times vertex count bytes.
+         */
+        template<class ...T> static std::size_t interleaveInto(Containers::ArrayReference<char> buffer, const T&... data);
+
+        /**
+         * @brief Interleave attribute data
+         *
+         * Allocates an array of @ref Stride times vertex count bytes and
+         * interleaves the data into it using @ref interleaveInto().
+         */
+        template<class T, class ...U> static Containers::Array<char> interleave(const T& first, const U&... next) {
+            Containers::Array<char> out(Stride*first.size());
+            interleaveInto(out, first, next...);
+            return out;
+        }
+
+    private:
+        template<std::size_t ...sequence, class ...T> static void interleaveVertex(Math::Implementation::Sequence<sequence...>, char* out, std::size_t i, const T&... data) {
+            /* Unrolled copy of each attribute into its precomputed offset */
+            int dummy[]{(std::memcpy(out + offset<sequence>(), &data[i], sizeof(typename Attributes::Type)), 0)...};
+            static_cast<void>(dummy);
+        }
+};
+
+template<class ...Attributes> template<class ...T> std::size_t VertexLayout<Attributes...>::interleaveInto(Containers::ArrayReference<char> buffer, const T&... data) {
+    static_assert(sizeof...(T) == AttributeCount, "VertexLayout::interleaveInto(): expected one array for each attribute");
+    /* All element types match the attribute types */
+    static_assert(std::is_same<
+            Implementation::VertexLayoutBools<true, std::is_same<typename Attributes::Type, typename std::decay<decltype(std::declval<const T&>()[0])>::type>::value...>,
+            Implementation::VertexLayoutBools<std::is_same<typename Attributes::Type, typename std::decay<decltype(std::declval<const T&>()[0])>::type>::value..., true>>::value,
+        "VertexLayout::interleaveInto(): array types don't match the attribute types");
+
+    const std::size_t sizes[]{data.size()...};
+    const std::size_t count = sizes[0];
+    for(std::size_t size: sizes) {
+        CORRADE_ASSERT(size == count,
+            "VertexLayout::interleaveInto(): attribute arrays don't have the same length, expected" << count << "but got" << size, 0);
+    }
+    CORRADE_ASSERT(Stride*count <= buffer.size(),
+        "VertexLayout::interleaveInto(): the data buffer is too small, expected" << Stride*count << "but got" << buffer.size(), 0);
+
+    for(std::size_t i = 0; i != count; ++i)
+        interleaveVertex(typename Math::Implementation::GenerateSequence<sizeof...(Attributes)>::Type(), buffer.data() + i*Stride, i, data...);
+
+    return count;
+}
+
+}
+
+#endif
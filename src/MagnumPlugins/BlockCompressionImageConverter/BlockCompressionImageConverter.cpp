@@ -0,0 +1,63 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BlockCompressionImageConverter.h"
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/TextureTools/Compress.h"
+
+namespace Magnum { namespace Trade {
+
+BlockCompressionImageConverter::BlockCompressionImageConverter(): _format{CompressedColorFormat::RGBS3tcDxt1}, _scheduler{&TaskScheduler::global()} {}
+
+BlockCompressionImageConverter::BlockCompressionImageConverter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImageConverter(manager, std::move(plugin)), _format{CompressedColorFormat::RGBS3tcDxt1}, _scheduler{&TaskScheduler::global()} {}
+
+auto BlockCompressionImageConverter::doFeatures() const -> Features { return Feature::ConvertCompressedImage; }
+
+BlockCompressionImageConverter& BlockCompressionImageConverter::setFormat(const CompressedColorFormat format) {
+    _format = format;
+    return *this;
+}
+
+BlockCompressionImageConverter& BlockCompressionImageConverter::setScheduler(TaskScheduler& scheduler) {
+    _scheduler = &scheduler;
+    return *this;
+}
+
+std::optional<CompressedImageData2D> BlockCompressionImageConverter::doExportToCompressedImage(const ImageReference2D& image) const {
+    if(!TextureTools::isCompressionSupported(_format)) {
+        Error() << "Trade::BlockCompressionImageConverter::exportToCompressedImage(): unsupported output format" << _format;
+        return std::nullopt;
+    }
+
+    if(!TextureTools::isCompressionSupported(image.format(), image.type())) {
+        Error() << "Trade::BlockCompressionImageConverter::exportToCompressedImage(): unsupported image format" << image.format() << image.type();
+        return std::nullopt;
+    }
+
+    return TextureTools::compress(image, _format, *_scheduler);
+}
+
+}}
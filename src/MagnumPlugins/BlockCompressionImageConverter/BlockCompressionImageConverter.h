@@ -0,0 +1,117 @@
+#ifndef Magnum_Trade_BlockCompressionImageConverter_h
+#define Magnum_Trade_BlockCompressionImageConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::BlockCompressionImageConverter
+ */
+
+#include "Magnum/TaskScheduler.h"
+#include "Magnum/Trade/AbstractImageConverter.h"
+
+#include "MagnumPlugins/BlockCompressionImageConverter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_BLOCKCOMPRESSIONIMAGECONVERTER_BUILD_STATIC
+    #if defined(BlockCompressionImageConverter_EXPORTS) || defined(BlockCompressionImageConverterObjects_EXPORTS)
+        #define MAGNUM_TRADE_BLOCKCOMPRESSIONIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_TRADE_BLOCKCOMPRESSIONIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_TRADE_BLOCKCOMPRESSIONIMAGECONVERTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_TRADE_BLOCKCOMPRESSIONIMAGECONVERTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Block compression image converter plugin
+
+Compresses images using @ref TextureTools::compress(), see its documentation
+for the list of supported input and output formats. The output format is
+@ref CompressedColorFormat::RGBS3tcDxt1 by default, use @ref setFormat() to
+change it. The blocks are encoded in parallel on @ref TaskScheduler::global(),
+use @ref setScheduler() to use a different scheduler.
+
+Only @ref exportToCompressedImage() is supported, the output is meant to be
+uploaded directly using @ref Texture::setCompressedImage() or passed to a
+container format writer.
+
+This plugin is built if `WITH_BLOCKCOMPRESSIONIMAGECONVERTER` is enabled when
+building Magnum. To use dynamic plugin, you need to load
+`BlockCompressionImageConverter` plugin from
+`MAGNUM_PLUGINS_IMAGECONVERTER_DIR`. To use static plugin or use this as a
+dependency of another plugin, you need to request
+`BlockCompressionImageConverter` component of `Magnum` package in CMake and
+link to `${MAGNUM_BLOCKCOMPRESSIONIMAGECONVERTER_LIBRARIES}`. See
+@ref building, @ref cmake and @ref plugins for more information.
+*/
+class MAGNUM_TRADE_BLOCKCOMPRESSIONIMAGECONVERTER_EXPORT BlockCompressionImageConverter: public AbstractImageConverter {
+    public:
+        /** @brief Default constructor */
+        explicit BlockCompressionImageConverter();
+
+        /** @brief Plugin manager constructor */
+        explicit BlockCompressionImageConverter(PluginManager::AbstractManager& manager, std::string plugin);
+
+        /** @brief Output format */
+        CompressedColorFormat format() const { return _format; }
+
+        /**
+         * @brief Set output format
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref CompressedColorFormat::RGBS3tcDxt1. If the format
+         * is not supported by @ref TextureTools::compress(), export fails.
+         * @see @ref TextureTools::isCompressionSupported()
+         */
+        BlockCompressionImageConverter& setFormat(CompressedColorFormat format);
+
+        /** @brief Task scheduler */
+        TaskScheduler& scheduler() const { return *_scheduler; }
+
+        /**
+         * @brief Set task scheduler
+         * @return Reference to self (for method chaining)
+         *
+         * The scheduler is expected to outlive the converter. Default is
+         * @ref TaskScheduler::global().
+         */
+        BlockCompressionImageConverter& setScheduler(TaskScheduler& scheduler);
+
+    private:
+        Features MAGNUM_TRADE_BLOCKCOMPRESSIONIMAGECONVERTER_LOCAL doFeatures() const override;
+        std::optional<CompressedImageData2D> MAGNUM_TRADE_BLOCKCOMPRESSIONIMAGECONVERTER_LOCAL doExportToCompressedImage(const ImageReference2D& image) const override;
+
+        CompressedColorFormat _format;
+        TaskScheduler* _scheduler;
+};
+
+}}
+
+#endif
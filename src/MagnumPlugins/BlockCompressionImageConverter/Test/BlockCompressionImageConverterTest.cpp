@@ -0,0 +1,131 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/TextureTools/Compress.h"
+#include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/BlockCompressionImageConverter/BlockCompressionImageConverter.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class BlockCompressionImageConverterTest: public TestSuite::Tester {
+    public:
+        explicit BlockCompressionImageConverterTest();
+
+        void wrongFormat();
+        void wrongOutputFormat();
+
+        void defaultFormat();
+        void format();
+        void scheduler();
+};
+
+BlockCompressionImageConverterTest::BlockCompressionImageConverterTest() {
+    addTests({&BlockCompressionImageConverterTest::wrongFormat,
+              &BlockCompressionImageConverterTest::wrongOutputFormat,
+
+              &BlockCompressionImageConverterTest::defaultFormat,
+              &BlockCompressionImageConverterTest::format,
+              &BlockCompressionImageConverterTest::scheduler});
+}
+
+namespace {
+    /* 6x5 image, so there are incomplete blocks in both directions */
+    UnsignedByte originalData[6*5*4];
+
+    ImageReference2D original() {
+        for(std::size_t i = 0; i != sizeof(originalData); ++i)
+            originalData[i] = UnsignedByte(i*13);
+        return ImageReference2D{ColorFormat::RGBA, ColorType::UnsignedByte, {6, 5}, originalData};
+    }
+}
+
+void BlockCompressionImageConverterTest::wrongFormat() {
+    ImageReference2D image(ColorFormat::RGBA, ColorType::Float, {}, nullptr);
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    CORRADE_VERIFY(!BlockCompressionImageConverter().exportToCompressedImage(image));
+    CORRADE_COMPARE(out.str(), "Trade::BlockCompressionImageConverter::exportToCompressedImage(): unsupported image format ColorFormat::RGBA ColorType::Float\n");
+}
+
+void BlockCompressionImageConverterTest::wrongOutputFormat() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    BlockCompressionImageConverter converter;
+    converter.setFormat(CompressedColorFormat::RGBAS3tcDxt3);
+    CORRADE_VERIFY(!converter.exportToCompressedImage(original()));
+    CORRADE_COMPARE(out.str(), "Trade::BlockCompressionImageConverter::exportToCompressedImage(): unsupported output format CompressedColorFormat::RGBAS3tcDxt3\n");
+}
+
+void BlockCompressionImageConverterTest::defaultFormat() {
+    BlockCompressionImageConverter converter;
+    CORRADE_COMPARE(converter.format(), CompressedColorFormat::RGBS3tcDxt1);
+    CORRADE_VERIFY(converter.features() & AbstractImageConverter::Feature::ConvertCompressedImage);
+
+    std::optional<CompressedImageData2D> image = converter.exportToCompressedImage(original());
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), CompressedColorFormat::RGBS3tcDxt1);
+    CORRADE_COMPARE(image->size(), Vector2i(6, 5));
+    CORRADE_COMPARE(image->data().size(), 2*2*8);
+}
+
+void BlockCompressionImageConverterTest::format() {
+    BlockCompressionImageConverter converter;
+    converter.setFormat(CompressedColorFormat::RGBAS3tcDxt5);
+    CORRADE_COMPARE(converter.format(), CompressedColorFormat::RGBAS3tcDxt5);
+
+    std::optional<CompressedImageData2D> image = converter.exportToCompressedImage(original());
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), CompressedColorFormat::RGBAS3tcDxt5);
+
+    /* The plugin doesn't alter the output in any way */
+    Trade::CompressedImageData2D expected = TextureTools::compress(original(), CompressedColorFormat::RGBAS3tcDxt5);
+    CORRADE_COMPARE(image->data().size(), expected.data().size());
+    for(std::size_t i = 0; i != expected.data().size(); ++i)
+        CORRADE_COMPARE(image->data()[i], expected.data()[i]);
+}
+
+void BlockCompressionImageConverterTest::scheduler() {
+    TaskScheduler scheduler{3};
+
+    BlockCompressionImageConverter converter;
+    CORRADE_COMPARE(&converter.scheduler(), &TaskScheduler::global());
+    converter.setScheduler(scheduler);
+    CORRADE_COMPARE(&converter.scheduler(), &scheduler);
+
+    std::optional<CompressedImageData2D> image = converter.exportToCompressedImage(original());
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->data().size(), 2*2*8);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::BlockCompressionImageConverterTest)
@@ -25,37 +25,106 @@
 
 #include "MagnumFont.h"
 
+#include <cstring>
+#include <fstream>
 #include <sstream>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Directory.h>
+#include <Corrade/Utility/Endianness.h>
 #include <Corrade/Utility/Unicode.h>
 
+#include "Magnum/Math/Implementation/Simd.h"
 #include "Magnum/Text/GlyphCache.h"
 #include "Magnum/Trade/ImageData.h"
 #include "MagnumPlugins/TgaImporter/TgaImporter.h"
 
+#if defined(MAGNUM_MATH_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MAGNUM_MAGNUMFONT_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+#define MAGNUM_MAGNUMFONT_USE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 namespace Magnum { namespace Text {
 
 struct MagnumFont::Data {
-    Utility::Configuration conf;
-    Trade::ImageData2D image;
-    std::unordered_map<char32_t, UnsignedInt> glyphId;
-    std::vector<Vector2> glyphAdvance;
+    explicit Data(): glyphPages(256, 0) {}
+    ~Data();
+
+    std::optional<Trade::ImageData2D> image;
+    Vector2i originalImageSize, padding;
+
+    /* Glyph properties, pointing either into the binary file or to
+       ownedGlyphs */
+    Containers::ArrayReference<const MagnumFontGlyph> glyphs;
+    std::vector<MagnumFontGlyph> ownedGlyphs;
+
+    /* Binary file contents, either memory-mapped or copied */
+    Containers::ArrayReference<const char> binary;
+    Containers::Array<char> ownedBinary;
+    #ifdef MAGNUM_MAGNUMFONT_USE_MMAP
+    void* mapped{};
+    #endif
+
+    /* Two-level character->glyph table. Each block of 256 characters points
+       to a page in glyphPages, blocks without any glyph share the first
+       all-zero page. */
+    std::vector<UnsignedInt> glyphBlocks, glyphPages;
+
+    void setGlyphId(char32_t character, UnsignedInt glyph);
+
+    UnsignedInt glyphId(const char32_t character) const {
+        const std::size_t block = character >> 8;
+        return block < glyphBlocks.size() ? glyphPages[glyphBlocks[block] + (character & 0xff)] : 0;
+    }
 };
 
+MagnumFont::Data::~Data() {
+    #ifdef MAGNUM_MAGNUMFONT_USE_MMAP
+    if(mapped) munmap(mapped, binary.size());
+    #endif
+}
+
+void MagnumFont::Data::setGlyphId(const char32_t character, const UnsignedInt glyph) {
+    /* Only pages for blocks containing some characters are allocated */
+    const std::size_t block = character >> 8;
+    if(block >= glyphBlocks.size())
+        glyphBlocks.resize(block + 1, 0);
+    if(!glyphBlocks[block]) {
+        glyphBlocks[block] = glyphPages.size();
+        glyphPages.resize(glyphPages.size() + 256, 0);
+    }
+
+    glyphPages[glyphBlocks[block] + (character & 0xff)] = glyph;
+}
+
 namespace {
     class MagnumFontLayouter: public AbstractLayouter {
         public:
-            explicit MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, Float fontSize, Float textSize, std::vector<UnsignedInt>&& glyphs);
+            explicit MagnumFontLayouter(Containers::ArrayReference<const MagnumFontGlyph> glyphData, const GlyphCache& cache, Float fontSize, Float textSize, std::vector<UnsignedInt>&& glyphs);
 
         private:
             std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt i) override;
 
-            const std::vector<Vector2>& glyphAdvance;
+            const Containers::ArrayReference<const MagnumFontGlyph> glyphData;
             const GlyphCache& cache;
             const Float fontSize, textSize;
             const std::vector<UnsignedInt> glyphs;
     };
+
+    inline bool inBounds(const std::size_t fileSize, const UnsignedLong offset, const UnsignedLong size) {
+        return offset <= fileSize && size <= fileSize - offset;
+    }
+
+    inline bool isBinary(const Containers::ArrayReference<const char> data) {
+        return data.size() >= 4 && std::memcmp(data.begin(), "MGFT", 4) == 0;
+    }
 }
 
 MagnumFont::MagnumFont(): _opened(nullptr) {}
@@ -75,6 +144,40 @@ std::pair<Float, Float> MagnumFont::doOpenData(const std::vector<std::pair<std::
         return {};
     }
 
+    /* Binary file. The data are not guaranteed to be kept in scope, copy
+       them */
+    if(isBinary(data[0].second)) {
+        std::unique_ptr<Data> opened{new Data};
+        opened->ownedBinary = Containers::Array<char>(data[0].second.size());
+        std::copy(data[0].second.begin(), data[0].second.end(), opened->ownedBinary.begin());
+        opened->binary = {opened->ownedBinary.begin(), opened->ownedBinary.size()};
+
+        std::string imageName;
+        const MagnumFontHeader* const header = parseBinary("Text::MagnumFont::openData():", *opened, imageName);
+        if(!header) return {};
+
+        /* Check that we have also the image file */
+        if(imageName != data[1].first) {
+            Error() << "Text::MagnumFont::openData(): expected file"
+                    << imageName << "but got" << data[1].first;
+            return {};
+        }
+
+        /* Open and load image file */
+        Trade::TgaImporter importer;
+        if(!importer.openData(data[1].second)) {
+            Error() << "Text::MagnumFont::openData(): cannot open image file";
+            return {};
+        }
+        if(!(opened->image = importer.image2D(0))) {
+            Error() << "Text::MagnumFont::openData(): cannot load image file";
+            return {};
+        }
+
+        _opened = opened.release();
+        return {header->fontSize, header->lineHeight};
+    }
+
     /* Open the configuration file */
     std::istringstream in({data[0].second.begin(), data[0].second.size()});
     Utility::Configuration conf(in, Utility::Configuration::Flag::SkipComments);
@@ -113,6 +216,14 @@ std::pair<Float, Float> MagnumFont::doOpenData(const std::vector<std::pair<std::
 }
 
 std::pair<Float, Float> MagnumFont::doOpenFile(const std::string& filename, Float) {
+    /* Binary files are recognized by their signature */
+    {
+        char magic[4]{};
+        std::ifstream in{filename, std::ios::binary};
+        if(in.read(magic, 4) && isBinary({magic, 4}))
+            return openBinaryFile(filename);
+    }
+
     /* Open the configuration file */
     Utility::Configuration conf(filename, Utility::Configuration::Flag::ReadOnly|Utility::Configuration::Flag::SkipComments);
     if(!conf.isValid() || conf.isEmpty()) {
@@ -143,25 +254,152 @@ std::pair<Float, Float> MagnumFont::doOpenFile(const std::string& filename, Floa
     return openInternal(std::move(conf), std::move(*image));
 }
 
+std::pair<Float, Float> MagnumFont::openBinaryFile(const std::string& filename) {
+    std::unique_ptr<Data> opened{new Data};
+
+    #ifdef MAGNUM_MAGNUMFONT_USE_MMAP
+    /* Map the file to memory, the tables are then used directly from there */
+    const int fd = ::open(filename.data(), O_RDONLY);
+    struct stat st;
+    if(fd == -1 || fstat(fd, &st) == -1) {
+        if(fd != -1) ::close(fd);
+        Error() << "Text::MagnumFont::openFile(): cannot open file" << filename;
+        return {};
+    }
+
+    if(st.st_size) {
+        void* const mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapped == MAP_FAILED) {
+            ::close(fd);
+            Error() << "Text::MagnumFont::openFile(): cannot open file" << filename;
+            return {};
+        }
+        opened->mapped = mapped;
+        opened->binary = {static_cast<const char*>(mapped), std::size_t(st.st_size)};
+    }
+    ::close(fd);
+    #else
+    /* Read the whole file at once */
+    std::ifstream in{filename, std::ios::binary};
+    if(!in.good()) {
+        Error() << "Text::MagnumFont::openFile(): cannot open file" << filename;
+        return {};
+    }
+
+    in.seekg(0, std::ios::end);
+    opened->ownedBinary = Containers::Array<char>(std::size_t(in.tellg()));
+    in.seekg(0, std::ios::beg);
+    in.read(opened->ownedBinary.begin(), opened->ownedBinary.size());
+    opened->binary = {opened->ownedBinary.begin(), opened->ownedBinary.size()};
+    #endif
+
+    std::string imageName;
+    const MagnumFontHeader* const header = parseBinary("Text::MagnumFont::openFile():", *opened, imageName);
+    if(!header) return {};
+
+    /* Open and load image file */
+    const std::string imageFilename = Utility::Directory::join(Utility::Directory::path(filename), imageName);
+    Trade::TgaImporter importer;
+    if(!importer.openFile(imageFilename)) {
+        Error() << "Text::MagnumFont::openFile(): cannot open image file" << imageFilename;
+        return {};
+    }
+    if(!(opened->image = importer.image2D(0))) {
+        Error() << "Text::MagnumFont::openFile(): cannot load image file";
+        return {};
+    }
+
+    _opened = opened.release();
+    return {header->fontSize, header->lineHeight};
+}
+
+const MagnumFontHeader* MagnumFont::parseBinary(const char* const prefix, Data& data, std::string& imageName) {
+    const char* const bytes = data.binary.begin();
+    const std::size_t size = data.binary.size();
+
+    /* The data are used directly, no conversion is done */
+    if(Utility::Endianness::littleEndian(UnsignedInt(1)) != 1) {
+        Error() << prefix << "big-endian platforms are not supported";
+        return nullptr;
+    }
+
+    if(size < sizeof(MagnumFontHeader)) {
+        Error() << prefix << "the file is too short:" << size << "bytes";
+        return nullptr;
+    }
+
+    const auto* const header = reinterpret_cast<const MagnumFontHeader*>(bytes);
+    if(header->version != 1) {
+        Error() << prefix << "unsupported file version" << header->version;
+        return nullptr;
+    }
+
+    const UnsignedLong glyphOffset = sizeof(MagnumFontHeader) + UnsignedLong(header->characterCount)*sizeof(MagnumFontCharacter);
+    const UnsignedLong imageNameOffset = glyphOffset + UnsignedLong(header->glyphCount)*sizeof(MagnumFontGlyph);
+    if(!inBounds(size, sizeof(MagnumFontHeader), imageNameOffset - sizeof(MagnumFontHeader)) ||
+       !inBounds(size, imageNameOffset, header->imageNameSize)) {
+        Error() << prefix << "the file is too short for" << header->characterCount
+                << "characters and" << header->glyphCount << "glyphs";
+        return nullptr;
+    }
+
+    /* Validate the characters, so the lookups don't need any checks. The
+       table is sorted, so the pages are filled sequentially. */
+    const auto* const characters = reinterpret_cast<const MagnumFontCharacter*>(bytes + sizeof(MagnumFontHeader));
+    for(UnsignedInt i = 0; i != header->characterCount; ++i) {
+        const MagnumFontCharacter& c = characters[i];
+        if(c.character > 0x10ffff || (i && c.character <= characters[i - 1].character) || c.glyph >= header->glyphCount) {
+            Error() << prefix << "invalid character" << i;
+            return nullptr;
+        }
+
+        data.setGlyphId(c.character, c.glyph);
+    }
+
+    data.originalImageSize = Vector2i::from(header->originalImageSize);
+    data.padding = Vector2i::from(header->padding);
+    data.glyphs = {reinterpret_cast<const MagnumFontGlyph*>(bytes + glyphOffset), header->glyphCount};
+    imageName = {bytes + imageNameOffset, header->imageNameSize};
+    return header;
+}
+
 std::pair<Float, Float> MagnumFont::openInternal(Utility::Configuration&& conf, Trade::ImageData2D&& image) {
     /* Everything okay, save the data internally */
-    _opened = new Data{std::move(conf), std::move(image), std::unordered_map<char32_t, UnsignedInt>{}, {}};
+    _opened = new Data;
+    _opened->image = std::move(image);
+    _opened->originalImageSize = conf.value<Vector2i>("originalImageSize");
+    _opened->padding = conf.value<Vector2i>("padding");
+
+    /* Glyph properties */
+    const std::vector<Utility::ConfigurationGroup*> glyphs = conf.groups("glyph");
+    _opened->ownedGlyphs.resize(glyphs.size());
+    for(std::size_t i = 0; i != glyphs.size(); ++i) {
+        MagnumFontGlyph& glyph = _opened->ownedGlyphs[i];
+        const Vector2 advance = glyphs[i]->value<Vector2>("advance");
+        const Vector2i position = glyphs[i]->value<Vector2i>("position");
+        const Range2Di rectangle = glyphs[i]->value<Range2Di>("rectangle");
+        std::copy(advance.data(), advance.data() + 2, glyph.advance);
+        std::copy(position.data(), position.data() + 2, glyph.position);
+        std::copy(rectangle.min().data(), rectangle.min().data() + 2, glyph.rectangle);
+        std::copy(rectangle.max().data(), rectangle.max().data() + 2, glyph.rectangle + 2);
+    }
+    _opened->glyphs = {_opened->ownedGlyphs.data(), _opened->ownedGlyphs.size()};
 
-    /* Glyph advances */
-    const std::vector<Utility::ConfigurationGroup*> glyphs = _opened->conf.groups("glyph");
-    _opened->glyphAdvance.reserve(glyphs.size());
-    for(const Utility::ConfigurationGroup* const g: glyphs)
-        _opened->glyphAdvance.push_back(g->value<Vector2>("advance"));
+    /* Fill character->glyph table. Going backwards, so the first occurence
+       of duplicate characters wins. */
+    const std::vector<Utility::ConfigurationGroup*> chars = conf.groups("char");
+    for(auto c = chars.rbegin(); c != chars.rend(); ++c) {
+        const char32_t character = (*c)->value<char32_t>("unicode");
+        const UnsignedInt glyphId = (*c)->value<UnsignedInt>("glyph");
+        CORRADE_INTERNAL_ASSERT(glyphId < _opened->glyphs.size());
 
-    /* Fill character->glyph map */
-    const std::vector<Utility::ConfigurationGroup*> chars = _opened->conf.groups("char");
-    for(const Utility::ConfigurationGroup* const c: chars) {
-        const UnsignedInt glyphId = c->value<UnsignedInt>("glyph");
-        CORRADE_INTERNAL_ASSERT(glyphId < _opened->glyphAdvance.size());
-        _opened->glyphId.emplace(c->value<char32_t>("unicode"), glyphId);
+        /* Characters outside of Unicode range can't be ever decoded */
+        if(character > 0x10ffff) continue;
+
+        _opened->setGlyphId(character, glyphId);
     }
 
-    return {_opened->conf.value<Float>("fontSize"), _opened->conf.value<Float>("lineHeight")};
+    return {conf.value<Float>("fontSize"), conf.value<Float>("lineHeight")};
 }
 
 void MagnumFont::doClose() {
@@ -170,47 +408,69 @@ void MagnumFont::doClose() {
 }
 
 UnsignedInt MagnumFont::doGlyphId(const char32_t character) {
-    auto it = _opened->glyphId.find(character);
-    return it != _opened->glyphId.end() ? it->second : 0;
+    return _opened->glyphId(character);
 }
 
 Vector2 MagnumFont::doGlyphAdvance(const UnsignedInt glyph) {
-    return glyph < _opened->glyphAdvance.size() ? _opened->glyphAdvance[glyph] : Vector2();
+    return glyph < _opened->glyphs.size() ? Vector2::from(_opened->glyphs[glyph].advance) : Vector2();
 }
 
 std::unique_ptr<GlyphCache> MagnumFont::doCreateGlyphCache() {
     /* Set cache image */
     std::unique_ptr<GlyphCache> cache(new Text::GlyphCache(
-        _opened->conf.value<Vector2i>("originalImageSize"),
-        _opened->image.size(),
-        _opened->conf.value<Vector2i>("padding")));
-    cache->setImage({}, _opened->image);
+        _opened->originalImageSize,
+        _opened->image->size(),
+        _opened->padding));
+    cache->setImage({}, *_opened->image);
 
     /* Fill glyph map */
-    const std::vector<Utility::ConfigurationGroup*> glyphs = _opened->conf.groups("glyph");
-    for(std::size_t i = 0; i != glyphs.size(); ++i)
-        cache->insert(i, glyphs[i]->value<Vector2i>("position"), glyphs[i]->value<Range2Di>("rectangle"));
+    for(std::size_t i = 0; i != _opened->glyphs.size(); ++i) {
+        const MagnumFontGlyph& glyph = _opened->glyphs[i];
+        cache->insert(i, Vector2i::from(glyph.position), {Vector2i::from(glyph.rectangle), Vector2i::from(glyph.rectangle + 2)});
+    }
 
     return cache;
 }
 
 std::unique_ptr<AbstractLayouter> MagnumFont::doLayout(const GlyphCache& cache, Float size, const std::string& text) {
-    /* Get glyph codes from characters */
-    std::vector<UnsignedInt> glyphs;
-    glyphs.reserve(text.size());
+    /* Get glyph codes from characters. There's at most one glyph for each
+       byte. */
+    std::vector<UnsignedInt> glyphs(text.size());
+    const char* const data = text.data();
+    const UnsignedInt* const asciiPage = _opened->glyphPages.data() + (_opened->glyphBlocks.empty() ? 0 : _opened->glyphBlocks[0]);
+    std::size_t count = 0;
     for(std::size_t i = 0; i != text.size(); ) {
+        #ifdef MAGNUM_MAGNUMFONT_SSE2
+        /* Runs of ASCII characters, sixteen at a time. Characters with the
+           highest bit set are parts of multi-byte sequences. */
+        for(; i + 16 <= text.size(); i += 16, count += 16) {
+            if(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i))))
+                break;
+
+            for(std::size_t j = 0; j != 16; ++j)
+                glyphs[count + j] = asciiPage[UnsignedByte(data[i + j])];
+        }
+        if(i == text.size()) break;
+        #endif
+
+        /* Single ASCII character */
+        if(!(data[i] & 0x80)) {
+            glyphs[count++] = asciiPage[UnsignedByte(data[i++])];
+            continue;
+        }
+
         UnsignedInt codepoint;
         std::tie(codepoint, i) = Utility::Unicode::nextChar(text, i);
-        const auto it = _opened->glyphId.find(codepoint);
-        glyphs.push_back(it == _opened->glyphId.end() ? 0 : it->second);
+        glyphs[count++] = _opened->glyphId(codepoint);
     }
+    glyphs.resize(count);
 
-    return std::unique_ptr<MagnumFontLayouter>(new MagnumFontLayouter(_opened->glyphAdvance, cache, this->size(), size, std::move(glyphs)));
+    return std::unique_ptr<MagnumFontLayouter>(new MagnumFontLayouter(_opened->glyphs, cache, this->size(), size, std::move(glyphs)));
 }
 
 namespace {
 
-MagnumFontLayouter::MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, const Float fontSize, const Float textSize, std::vector<UnsignedInt>&& glyphs): AbstractLayouter(glyphs.size()), glyphAdvance(glyphAdvance), cache(cache), fontSize(fontSize), textSize(textSize), glyphs(std::move(glyphs)) {}
+MagnumFontLayouter::MagnumFontLayouter(const Containers::ArrayReference<const MagnumFontGlyph> glyphData, const GlyphCache& cache, const Float fontSize, const Float textSize, std::vector<UnsignedInt>&& glyphs): AbstractLayouter(glyphs.size()), glyphData(glyphData), cache(cache), fontSize(fontSize), textSize(textSize), glyphs(std::move(glyphs)) {}
 
 std::tuple<Range2D, Range2D, Vector2> MagnumFontLayouter::doRenderGlyph(const UnsignedInt i) {
     /* Position of the texture in the resulting glyph, texture coordinates */
@@ -226,7 +486,7 @@ std::tuple<Range2D, Range2D, Vector2> MagnumFontLayouter::doRenderGlyph(const Un
     const auto quadRectangle = Range2D(Range2Di::fromSize(position, rectangle.size())).scaled(Vector2(textSize/fontSize));
 
     /* Advance for given glyph, denormalized to requested text size */
-    const Vector2 advance = glyphAdvance[glyphs[i]]*(textSize/fontSize);
+    const Vector2 advance = Vector2::from(glyphData[glyphs[i]].advance)*(textSize/fontSize);
 
     return std::make_tuple(quadRectangle, textureCoordinates, advance);
 }
@@ -31,6 +31,7 @@
 
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Trade/Trade.h"
+#include "MagnumPlugins/MagnumFont/MagnumFontHeader.h"
 
 namespace Magnum { namespace Text {
 
@@ -101,6 +102,16 @@ The file syntax is as in following:
 
     # ...
 
+@section MagnumFont-binary Binary format
+
+Parsing the text file can take noticeable time for fonts with many glyphs. The
+font can be also stored in binary file, which is recognized by its signature
+and used directly without any parsing. On Unix platforms the file is
+memory-mapped. The file layout is described in @ref MagnumFontHeader,
+@ref MagnumFontCharacter and @ref MagnumFontGlyph, the TGA file is the same as
+for the text format. The binary file is created by MagnumFontConverter
+alongside the text one.
+
 @see Trade::TgaImporter
 */
 class MagnumFont: public AbstractFont {
@@ -136,6 +147,10 @@ class MagnumFont: public AbstractFont {
 
         std::pair<Float, Float> openInternal(Utility::Configuration&& conf, Trade::ImageData2D&& image);
 
+        std::pair<Float, Float> openBinaryFile(const std::string& filename);
+
+        static const MagnumFontHeader* parseBinary(const char* prefix, Data& data, std::string& imageName);
+
         Data* _opened;
 };
 
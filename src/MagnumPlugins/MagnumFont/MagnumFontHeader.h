@@ -0,0 +1,91 @@
+#ifndef Magnum_Text_MagnumFontHeader_h
+#define Magnum_Text_MagnumFontHeader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::Text::MagnumFontHeader, @ref Magnum::Text::MagnumFontCharacter, @ref Magnum::Text::MagnumFontGlyph
+ */
+
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace Text {
+
+#pragma pack(1)
+/**
+@brief Binary MagnumFont file header
+
+The file begins with this header, followed by
+@ref MagnumFontHeader::characterCount "characterCount" instances of
+@ref MagnumFontCharacter sorted by character, then
+@ref MagnumFontHeader::glyphCount "glyphCount" instances of
+@ref MagnumFontGlyph and then @ref MagnumFontHeader::imageNameSize "imageNameSize"
+bytes of font image filename. All values are little-endian.
+@see @ref MagnumFont
+*/
+/** @todoc Enable @c INLINE_SIMPLE_STRUCTS again when unclosed &lt;component&gt; in tagfile is fixed*/
+struct MagnumFontHeader {
+    char            magic[4];       /**< @brief File signature, `MGFT` */
+    UnsignedInt     version;        /**< @brief Format version (1) */
+    UnsignedInt     characterCount; /**< @brief Count of characters */
+    UnsignedInt     glyphCount;     /**< @brief Count of glyphs */
+    Int             originalImageSize[2]; /**< @brief Size of unscaled font image */
+    Int             padding[2];     /**< @brief Glyph padding */
+    Float           fontSize;       /**< @brief Font size */
+    Float           lineHeight;     /**< @brief Line height */
+    UnsignedInt     imageNameSize;  /**< @brief Size of font image filename */
+    UnsignedInt     reserved;       /**< @brief Reserved (0) */
+};
+
+/**
+@brief Binary MagnumFont character
+
+Characters are sorted by codepoint, each codepoint is present at most once.
+*/
+struct MagnumFontCharacter {
+    UnsignedInt     character;      /**< @brief UTF-32 codepoint */
+    UnsignedInt     glyph;          /**< @brief Glyph ID */
+};
+
+/**
+@brief Binary MagnumFont glyph
+
+Glyph ID is index of the glyph in the file, glyph `0` is the "Not Found"
+glyph.
+*/
+struct MagnumFontGlyph {
+    Float           advance[2];     /**< @brief Advance to next glyph in pixels */
+    Int             position[2];    /**< @brief Texture position relative to baseline in pixels */
+    Int             rectangle[4];   /**< @brief Rectangle in font image in pixels (left, bottom, right, top) */
+};
+#pragma pack()
+
+static_assert(sizeof(MagnumFontHeader) == 48, "MagnumFontHeader size is not 48 bytes");
+static_assert(sizeof(MagnumFontCharacter) == 8, "MagnumFontCharacter size is not 8 bytes");
+static_assert(sizeof(MagnumFontGlyph) == 32, "MagnumFontGlyph size is not 32 bytes");
+
+}}
+
+#endif
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Directory.h>
 
 #include "Magnum/Test/AbstractOpenGLTester.h"
@@ -39,12 +40,18 @@ class MagnumFontGLTest: public Magnum::Test::AbstractOpenGLTester {
 
         void properties();
         void layout();
+        void layoutUtf8();
+        void binary();
+        void binaryData();
         void createGlyphCache();
 };
 
 MagnumFontGLTest::MagnumFontGLTest() {
     addTests({&MagnumFontGLTest::properties,
               &MagnumFontGLTest::layout,
+              &MagnumFontGLTest::layoutUtf8,
+              &MagnumFontGLTest::binary,
+              &MagnumFontGLTest::binaryData,
               &MagnumFontGLTest::createGlyphCache});
 }
 
@@ -99,6 +106,74 @@ void MagnumFontGLTest::layout() {
     CORRADE_COMPARE(cursorPosition, Vector2(0.375f, 0.0f));
 }
 
+void MagnumFontGLTest::layoutUtf8() {
+    MagnumFont font;
+    CORRADE_VERIFY(font.openFile(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.conf"), 0.0f));
+
+    GlyphCache cache(Vector2i(256));
+
+    /* Sixteen ASCII characters, a two-byte character (not found) and some
+       ASCII characters after */
+    auto layouter = font.layout(cache, 0.5f, "WeWeWeWeWeWeWeWe\xc4\x9bWe");
+    CORRADE_VERIFY(layouter);
+    CORRADE_COMPARE(layouter->glyphCount(), 19);
+
+    Range2D rectangle;
+    Vector2 cursorPosition;
+    for(UnsignedInt i: {0, 14, 17}) {
+        layouter->renderGlyph(i, cursorPosition = {}, rectangle);
+        CORRADE_COMPARE(cursorPosition, Vector2(0.71875f, 0.0f));
+    }
+    for(UnsignedInt i: {1, 15, 18}) {
+        layouter->renderGlyph(i, cursorPosition = {}, rectangle);
+        CORRADE_COMPARE(cursorPosition, Vector2(0.375f, 0.0f));
+    }
+
+    /* 'ě' (not found) */
+    layouter->renderGlyph(16, cursorPosition = {}, rectangle);
+    CORRADE_COMPARE(cursorPosition, Vector2(0.25f, 0.0f));
+}
+
+void MagnumFontGLTest::binary() {
+    MagnumFont font;
+    CORRADE_VERIFY(font.openFile(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.magnumfont"), 0.0f));
+    CORRADE_COMPARE(font.size(), 16.0f);
+    CORRADE_COMPARE(font.lineHeight(), 39.7333f);
+    CORRADE_COMPARE(font.glyphId(U'W'), 2);
+    CORRADE_COMPARE(font.glyphId(U'e'), 1);
+    CORRADE_COMPARE(font.glyphId(U'a'), 0);
+    CORRADE_COMPARE(font.glyphId(U'x'), 0);
+    CORRADE_COMPARE(font.glyphAdvance(font.glyphId(U'W')), Vector2(23.0f, 0.0f));
+
+    GlyphCache cache(Vector2i(256));
+    cache.insert(font.glyphId(U'W'), {25, 34}, {{0, 8}, {16, 128}});
+
+    auto layouter = font.layout(cache, 0.5f, "Wave");
+    CORRADE_VERIFY(layouter);
+    CORRADE_COMPARE(layouter->glyphCount(), 4);
+
+    /* 'W' */
+    Range2D rectangle;
+    Vector2 cursorPosition;
+    Range2D position;
+    Range2D textureCoordinates;
+    std::tie(position, textureCoordinates) = layouter->renderGlyph(0, cursorPosition = {}, rectangle);
+    CORRADE_COMPARE(position, Range2D({0.78125f, 1.0625f}, {1.28125f, 4.8125f}));
+    CORRADE_COMPARE(cursorPosition, Vector2(0.71875f, 0.0f));
+}
+
+void MagnumFontGLTest::binaryData() {
+    const Containers::Array<char> data = Utility::Directory::read(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.magnumfont"));
+    const Containers::Array<char> image = Utility::Directory::read(Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.tga"));
+
+    MagnumFont font;
+    CORRADE_VERIFY(font.openData({{"font.magnumfont", data}, {"font.tga", image}}, 0.0f));
+    CORRADE_COMPARE(font.size(), 16.0f);
+    CORRADE_COMPARE(font.lineHeight(), 39.7333f);
+    CORRADE_COMPARE(font.glyphId(U'e'), 1);
+    CORRADE_COMPARE(font.glyphAdvance(font.glyphId(U'e')), Vector2(12.0f, 0.0f));
+}
+
 void MagnumFontGLTest::createGlyphCache() {
     /** @todo */
     CORRADE_SKIP("Not yet implemented");
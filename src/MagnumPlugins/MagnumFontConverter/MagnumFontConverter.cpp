@@ -25,6 +25,7 @@
 
 #include "MagnumFontConverter.h"
 
+#include <cstring>
 #include <sstream>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Directory.h>
@@ -33,6 +34,7 @@
 #include "Magnum/Image.h"
 #include "Magnum/Text/GlyphCache.h"
 #include "Magnum/Text/AbstractFont.h"
+#include "MagnumPlugins/MagnumFont/MagnumFontHeader.h"
 #include "MagnumPlugins/TgaImageConverter/TgaImageConverter.h"
 
 namespace Magnum { namespace Text {
@@ -51,10 +53,11 @@ std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter
 std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter::doExportFontToData(AbstractFont& font, GlyphCache& cache, const std::string& filename, const std::vector<char32_t>& characters) const
 #endif
 {
+    const std::string imageName = Utility::Directory::filename(filename) + ".tga";
     Utility::Configuration configuration;
 
     configuration.setValue("version", 1);
-    configuration.setValue("image", Utility::Directory::filename(filename) + ".tga");
+    configuration.setValue("image", imageName);
     configuration.setValue("originalImageSize", cache.textureSize());
     configuration.setValue("padding", cache.padding());
     configuration.setValue("fontSize", font.size());
@@ -75,26 +78,61 @@ std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter
     for(const std::pair<UnsignedInt, UnsignedInt>& map: glyphIdMap)
         inverseGlyphIdMap[map.second] = map.first;
 
+    /* Binary file, the characters are already sorted and unique */
+    const std::size_t glyphOffset = sizeof(MagnumFontHeader) + characters.size()*sizeof(MagnumFontCharacter);
+    const std::size_t imageNameOffset = glyphOffset + inverseGlyphIdMap.size()*sizeof(MagnumFontGlyph);
+    Containers::Array<char> binaryData{imageNameOffset + imageName.size()};
+    auto* const header = reinterpret_cast<MagnumFontHeader*>(binaryData.begin());
+    auto* const binaryCharacters = reinterpret_cast<MagnumFontCharacter*>(binaryData.begin() + sizeof(MagnumFontHeader));
+    auto* const binaryGlyphs = reinterpret_cast<MagnumFontGlyph*>(binaryData.begin() + glyphOffset);
+    std::memcpy(header->magic, "MGFT", 4);
+    header->version = 1;
+    header->characterCount = characters.size();
+    header->glyphCount = inverseGlyphIdMap.size();
+    header->originalImageSize[0] = cache.textureSize().x();
+    header->originalImageSize[1] = cache.textureSize().y();
+    header->padding[0] = cache.padding().x();
+    header->padding[1] = cache.padding().y();
+    header->fontSize = font.size();
+    header->lineHeight = font.lineHeight();
+    header->imageNameSize = imageName.size();
+    header->reserved = 0;
+    std::copy(imageName.begin(), imageName.end(), binaryData.begin() + imageNameOffset);
+
     /* Character->glyph map, map glyph IDs to new ones */
-    for(const char32_t c: characters) {
+    for(std::size_t i = 0; i != characters.size(); ++i) {
+        const char32_t c = characters[i];
         Utility::ConfigurationGroup* group = configuration.addGroup("char");
         const UnsignedInt glyphId = font.glyphId(c);
         group->setValue("unicode", c);
 
         /* Map old glyph ID to new, if not found, map to glyph 0 */
         auto found = glyphIdMap.find(glyphId);
-        group->setValue("glyph", found == glyphIdMap.end() ? 0 : glyphIdMap.at(glyphId));
+        const UnsignedInt newGlyphId = found == glyphIdMap.end() ? 0 : found->second;
+        group->setValue("glyph", newGlyphId);
+        binaryCharacters[i].character = c;
+        binaryCharacters[i].glyph = newGlyphId;
     }
 
     /* Save glyph properties in order which preserves their IDs, remove padding
        from the values so they aren't added twice when using the font later */
     /** @todo Some better way to handle this padding stuff */
-    for(UnsignedInt oldGlyphId: inverseGlyphIdMap) {
+    for(std::size_t i = 0; i != inverseGlyphIdMap.size(); ++i) {
+        const UnsignedInt oldGlyphId = inverseGlyphIdMap[i];
         std::pair<Vector2i, Range2Di> glyph = cache[oldGlyphId];
+        const Vector2 advance = font.glyphAdvance(oldGlyphId);
+        const Vector2i position = glyph.first+cache.padding();
+        const Range2Di rectangle = glyph.second.padded(-cache.padding());
         Utility::ConfigurationGroup* group = configuration.addGroup("glyph");
-        group->setValue("advance", font.glyphAdvance(oldGlyphId));
-        group->setValue("position", glyph.first+cache.padding());
-        group->setValue("rectangle", glyph.second.padded(-cache.padding()));
+        group->setValue("advance", advance);
+        group->setValue("position", position);
+        group->setValue("rectangle", rectangle);
+
+        MagnumFontGlyph& binaryGlyph = binaryGlyphs[i];
+        std::copy(advance.data(), advance.data() + 2, binaryGlyph.advance);
+        std::copy(position.data(), position.data() + 2, binaryGlyph.position);
+        std::copy(rectangle.min().data(), rectangle.min().data() + 2, binaryGlyph.rectangle);
+        std::copy(rectangle.max().data(), rectangle.max().data() + 2, binaryGlyph.rectangle + 2);
     }
 
     std::ostringstream confOut;
@@ -111,6 +149,7 @@ std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter
     std::vector<std::pair<std::string, Containers::Array<char>>> out;
     out.emplace_back(filename + ".conf", std::move(confData));
     out.emplace_back(filename + ".tga", std::move(tgaData));
+    out.emplace_back(filename + ".magnumfont", std::move(binaryData));
     return out;
 }
 
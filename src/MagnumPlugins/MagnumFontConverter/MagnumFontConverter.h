@@ -36,8 +36,9 @@ namespace Magnum { namespace Text {
 /**
 @brief MagnumFont converter plugin
 
-Expects filename prefix, creates two files, `prefix.conf` and `prefix.tga`. See
-@ref MagnumFont for more information about the font.
+Expects filename prefix, creates three files, `prefix.conf`, `prefix.tga` and
+binary `prefix.magnumfont`, which can be opened instead of the `*.conf` file
+for faster loading. See @ref MagnumFont for more information about the font.
 
 This plugin is available only on desktop OpenGL, as it uses @ref Texture::image()
 to read back the generated data. It depends on
@@ -56,6 +56,7 @@ void MagnumFontConverterGLTest::exportFont() {
     /* Remove previously created files */
     Utility::Directory::rm(Utility::Directory::join(MAGNUMFONTCONVERTER_TEST_WRITE_DIR, "font.conf"));
     Utility::Directory::rm(Utility::Directory::join(MAGNUMFONTCONVERTER_TEST_WRITE_DIR, "font.tga"));
+    Utility::Directory::rm(Utility::Directory::join(MAGNUMFONTCONVERTER_TEST_WRITE_DIR, "font.magnumfont"));
 
     /* Fake font with fake cache */
     class FakeFont: public Text::AbstractFont {
@@ -110,6 +111,9 @@ void MagnumFontConverterGLTest::exportFont() {
     CORRADE_COMPARE_AS(Utility::Directory::join(MAGNUMFONTCONVERTER_TEST_WRITE_DIR, "font.conf"),
                        Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.conf"),
                        TestSuite::Compare::File);
+    CORRADE_COMPARE_AS(Utility::Directory::join(MAGNUMFONTCONVERTER_TEST_WRITE_DIR, "font.magnumfont"),
+                       Utility::Directory::join(MAGNUMFONT_TEST_DIR, "font.magnumfont"),
+                       TestSuite::Compare::File);
 
     /* Verify font image, no need to test image contents, as the image is garbage anyway */
     Trade::TgaImporter importer;
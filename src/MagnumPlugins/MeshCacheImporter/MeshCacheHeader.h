@@ -0,0 +1,156 @@
+#ifndef Magnum_Trade_MeshCacheHeader_h
+#define Magnum_Trade_MeshCacheHeader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::Trade::MeshCacheHeader, @ref Magnum::Trade::MeshCacheSceneHeader, @ref Magnum::Trade::MeshCacheMeshHeader, @ref Magnum::Trade::MeshCacheImageHeader, @ref Magnum::Trade::MeshCacheObjectHeader
+ */
+
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Alignment of data in mesh cache files
+
+Mesh headers, names, index, vertex and image data are all aligned to this
+value relative to file start.
+*/
+enum: std::size_t { MeshCacheAlignment = 16 };
+
+/**
+@brief Value of mesh cache attribute offset denoting that the attribute is not present
+@see @ref MeshCacheMeshHeader::normalOffset,
+    @ref MeshCacheMeshHeader::textureCoordinateOffset
+*/
+enum: UnsignedInt { MeshCacheNoAttribute = 0xffffffffu };
+
+/**
+@brief Value of mesh cache object reference denoting no object or mesh
+@see @ref MeshCacheObjectHeader::parent, @ref MeshCacheObjectHeader::mesh
+*/
+enum: Int { MeshCacheNoReference = -1 };
+
+#pragma pack(1)
+/**
+@brief Mesh cache file header
+
+The file begins with this header. In version 1 it is followed by
+@ref MeshCacheHeader::meshCount "meshCount" instances of @ref MeshCacheMeshHeader.
+In version 2 it is followed by @ref MeshCacheSceneHeader, then
+@ref MeshCacheHeader::meshCount "meshCount" instances of @ref MeshCacheMeshHeader,
+@ref MeshCacheSceneHeader::imageCount "imageCount" instances of
+@ref MeshCacheImageHeader and @ref MeshCacheSceneHeader::objectCount "objectCount"
+instances of @ref MeshCacheObjectHeader. All values are little-endian.
+*/
+/** @todoc Enable @c INLINE_SIMPLE_STRUCTS again when unclosed &lt;component&gt; in tagfile is fixed*/
+struct MeshCacheHeader {
+    char            magic[4];       /**< @brief File signature, `MGMC` */
+    UnsignedInt     version;        /**< @brief Format version (1 or 2) */
+    UnsignedInt     meshCount;      /**< @brief Count of meshes in the file */
+    UnsignedInt     reserved;       /**< @brief Reserved (0) */
+};
+
+/**
+@brief Mesh cache scene header
+
+Present only in version 2 of the format, right after @ref MeshCacheHeader.
+*/
+struct MeshCacheSceneHeader {
+    UnsignedInt     imageCount;     /**< @brief Count of images in the file */
+    UnsignedInt     objectCount;    /**< @brief Count of objects in the file */
+    UnsignedInt     reserved[2];    /**< @brief Reserved (0) */
+};
+
+/**
+@brief Mesh cache mesh header
+
+Index data are in format produced by @ref MeshTools::compressIndices(), vertex
+data are interleaved positions (@ref Vector3), optional normals
+(@ref Vector3) and optional texture coordinates (@ref Vector2), as produced
+by @ref MeshTools::interleave(). All offsets are relative to file start.
+*/
+struct MeshCacheMeshHeader {
+    UnsignedInt     primitive;      /**< @brief Value of @ref MeshPrimitive */
+    UnsignedInt     indexType;      /**< @brief Value of @ref Mesh::IndexType or `0` if the mesh is not indexed */
+    UnsignedInt     indexCount;     /**< @brief Index count */
+    UnsignedInt     indexStart;     /**< @brief Minimal index value */
+    UnsignedInt     indexEnd;       /**< @brief Maximal index value */
+    UnsignedInt     vertexCount;    /**< @brief Vertex count */
+    UnsignedInt     vertexStride;   /**< @brief Size of one vertex in bytes */
+    UnsignedInt     normalOffset;   /**< @brief Normal offset in vertex or @ref MeshCacheNoAttribute */
+    UnsignedInt     textureCoordinateOffset; /**< @brief Texture coordinate offset in vertex or @ref MeshCacheNoAttribute */
+    UnsignedInt     nameSize;       /**< @brief Size of mesh name */
+    UnsignedLong    nameOffset;     /**< @brief Offset of mesh name */
+    UnsignedLong    indexDataOffset; /**< @brief Offset of index data */
+    UnsignedLong    vertexDataOffset; /**< @brief Offset of vertex data */
+};
+
+/**
+@brief Mesh cache image header
+
+Pixel data are stored in the same layout as in @ref Image2D, i.e. with rows
+aligned to four bytes, and can be passed directly to
+@ref Texture::setImage(). All offsets are relative to file start.
+*/
+struct MeshCacheImageHeader {
+    UnsignedInt     format;         /**< @brief Value of @ref ColorFormat */
+    UnsignedInt     type;           /**< @brief Value of @ref ColorType */
+    Int             size[2];        /**< @brief Image size */
+    UnsignedInt     nameSize;       /**< @brief Size of image name */
+    UnsignedInt     reserved;       /**< @brief Reserved (0) */
+    UnsignedLong    nameOffset;     /**< @brief Offset of image name */
+    UnsignedLong    dataOffset;     /**< @brief Offset of pixel data */
+    UnsignedLong    dataSize;       /**< @brief Size of pixel data */
+};
+
+/**
+@brief Mesh cache object header
+
+Objects form a scene hierarchy, parents are always stored before their
+children, so the hierarchy can be created in a single pass. All offsets are
+relative to file start.
+*/
+struct MeshCacheObjectHeader {
+    Int             parent;         /**< @brief Parent object index or @ref MeshCacheNoReference for root objects */
+    Int             mesh;           /**< @brief Mesh index or @ref MeshCacheNoReference for empty objects */
+    UnsignedInt     nameSize;       /**< @brief Size of object name */
+    UnsignedInt     reserved;       /**< @brief Reserved (0) */
+    Float           transformation[16]; /**< @brief Column-major transformation relative to parent */
+    UnsignedLong    nameOffset;     /**< @brief Offset of object name */
+    UnsignedLong    reserved2;      /**< @brief Reserved (0) */
+};
+#pragma pack()
+
+static_assert(sizeof(MeshCacheHeader) == 16, "MeshCacheHeader size is not 16 bytes");
+static_assert(sizeof(MeshCacheSceneHeader) == 16, "MeshCacheSceneHeader size is not 16 bytes");
+static_assert(sizeof(MeshCacheMeshHeader) == 64, "MeshCacheMeshHeader size is not 64 bytes");
+static_assert(sizeof(MeshCacheImageHeader) == 48, "MeshCacheImageHeader size is not 48 bytes");
+static_assert(sizeof(MeshCacheObjectHeader) == 96, "MeshCacheObjectHeader size is not 96 bytes");
+
+}}
+
+#endif
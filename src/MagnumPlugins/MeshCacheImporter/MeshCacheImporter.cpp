@@ -0,0 +1,472 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshCacheImporter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/Trade/MeshObjectData3D.h"
+#include "Magnum/Trade/SceneData.h"
+#include "Magnum/Trade/StridedMeshData.h"
+
+namespace Magnum { namespace Trade {
+
+struct MeshCacheImporter::File {
+    std::unordered_map<std::string, UnsignedInt> meshesForName,
+        imagesForName, objectsForName;
+
+    /* Object hierarchy, inverted from the parent references */
+    std::vector<UnsignedInt> rootObjects;
+    std::vector<std::vector<UnsignedInt>> objectChildren;
+
+    /* File contents, either referenced or copied */
+    Containers::ArrayReference<const char> data;
+    Containers::Array<char> ownedData;
+};
+
+namespace {
+
+inline bool inBounds(const std::size_t fileSize, const UnsignedLong offset, const UnsignedLong size) {
+    return offset <= fileSize && size <= fileSize - offset;
+}
+
+/* Unknown values would make AbstractImage::pixelSize() assert, returns zero
+   for them instead */
+std::size_t imagePixelSize(const UnsignedInt format, const UnsignedInt type) {
+    switch(ColorType(type)) {
+        case ColorType::UnsignedByte:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorType::Byte:
+        #endif
+        case ColorType::UnsignedShort:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorType::Short:
+        #endif
+        case ColorType::HalfFloat:
+        case ColorType::UnsignedInt:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorType::Int:
+        #endif
+        case ColorType::Float:
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorType::UnsignedByte332:
+        case ColorType::UnsignedByte233Rev:
+        #endif
+        case ColorType::UnsignedShort565:
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorType::UnsignedShort565Rev:
+        #endif
+        case ColorType::UnsignedShort4444:
+        case ColorType::UnsignedShort4444Rev:
+        case ColorType::UnsignedShort5551:
+        case ColorType::UnsignedShort1555Rev:
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorType::UnsignedInt8888:
+        case ColorType::UnsignedInt8888Rev:
+        case ColorType::UnsignedInt1010102:
+        #endif
+        case ColorType::UnsignedInt2101010Rev:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorType::UnsignedInt10F11F11FRev:
+        case ColorType::UnsignedInt5999Rev:
+        #endif
+        case ColorType::UnsignedInt248:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorType::Float32UnsignedInt248Rev:
+        #endif
+            break;
+        default:
+            return 0;
+    }
+
+    switch(ColorFormat(format)) {
+        case ColorFormat::Red:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorFormat::RedInteger:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorFormat::Green:
+        case ColorFormat::Blue:
+        case ColorFormat::GreenInteger:
+        case ColorFormat::BlueInteger:
+        #endif
+        #ifdef MAGNUM_TARGET_GLES2
+        case ColorFormat::Luminance:
+        #endif
+        case ColorFormat::DepthComponent:
+        case ColorFormat::StencilIndex:
+        case ColorFormat::RG:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorFormat::RGInteger:
+        #endif
+        #ifdef MAGNUM_TARGET_GLES2
+        case ColorFormat::LuminanceAlpha:
+        #endif
+        case ColorFormat::RGB:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorFormat::RGBInteger:
+        #endif
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorFormat::BGR:
+        case ColorFormat::BGRInteger:
+        #endif
+        case ColorFormat::RGBA:
+        #ifndef MAGNUM_TARGET_GLES2
+        case ColorFormat::RGBAInteger:
+        #endif
+        case ColorFormat::BGRA:
+        #ifndef MAGNUM_TARGET_GLES
+        case ColorFormat::BGRAInteger:
+        #endif
+            break;
+
+        /* Only packed types are allowed for depth/stencil */
+        case ColorFormat::DepthStencil:
+            if(ColorType(type) != ColorType::UnsignedInt248
+                #ifndef MAGNUM_TARGET_GLES2
+                && ColorType(type) != ColorType::Float32UnsignedInt248Rev
+                #endif
+            ) return 0;
+            break;
+
+        default:
+            return 0;
+    }
+
+    return AbstractImage::pixelSize(ColorFormat(format), ColorType(type));
+}
+
+}
+
+MeshCacheImporter::MeshCacheImporter() = default;
+
+MeshCacheImporter::MeshCacheImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)) {}
+
+MeshCacheImporter::~MeshCacheImporter() = default;
+
+auto MeshCacheImporter::doFeatures() const -> Features { return Feature::OpenData; }
+
+bool MeshCacheImporter::doIsOpened() const { return !!_file; }
+
+void MeshCacheImporter::doClose() {
+    _file.reset();
+    _data = nullptr;
+    _meshes = nullptr;
+    _images = nullptr;
+    _objects = nullptr;
+    _meshCount = _imageCount = _objectCount = 0;
+}
+
+void MeshCacheImporter::doOpenData(const Containers::ArrayReference<const char> data, const DataFlags flags) {
+    _file.reset(new File);
+
+    /* Memory-mapped files from openFile() are kept around until close(), use
+       them directly. Otherwise the data are not guaranteed to be kept in
+       scope, copy them. */
+    if(flags & DataFlag::Persistent) _file->data = data;
+    else {
+        _file->ownedData = Containers::Array<char>(data.size());
+        std::copy(data.begin(), data.end(), _file->ownedData.begin());
+        _file->data = {_file->ownedData.begin(), _file->ownedData.size()};
+    }
+
+    if(!parse("Trade::MeshCacheImporter::openData():")) doClose();
+}
+
+bool MeshCacheImporter::parse(const char* const prefix) {
+    const char* const data = _file->data.begin();
+    const std::size_t size = _file->data.size();
+
+    /* The data are used directly, no conversion is done */
+    if(Utility::Endianness::littleEndian(UnsignedInt(1)) != 1) {
+        Error() << prefix << "big-endian platforms are not supported";
+        return false;
+    }
+
+    if(size < sizeof(MeshCacheHeader)) {
+        Error() << prefix << "the file is too short:" << size << "bytes";
+        return false;
+    }
+
+    MeshCacheHeader header;
+    std::memcpy(&header, data, sizeof(MeshCacheHeader));
+    if(std::memcmp(header.magic, "MGMC", 4) != 0) {
+        Error() << prefix << "invalid file signature";
+        return false;
+    }
+    if(header.version != 1 && header.version != 2) {
+        Error() << prefix << "unsupported file version" << header.version;
+        return false;
+    }
+
+    /* Version 2 has also images and objects */
+    MeshCacheSceneHeader sceneHeader{};
+    std::size_t meshesOffset = sizeof(MeshCacheHeader);
+    if(header.version == 2) {
+        if(size < sizeof(MeshCacheHeader) + sizeof(MeshCacheSceneHeader)) {
+            Error() << prefix << "the file is too short:" << size << "bytes";
+            return false;
+        }
+
+        std::memcpy(&sceneHeader, data + sizeof(MeshCacheHeader), sizeof(MeshCacheSceneHeader));
+        meshesOffset += sizeof(MeshCacheSceneHeader);
+    }
+
+    if(!inBounds(size, meshesOffset, UnsignedLong(header.meshCount)*sizeof(MeshCacheMeshHeader))) {
+        Error() << prefix << "the file is too short for" << header.meshCount << "meshes";
+        return false;
+    }
+    const std::size_t imagesOffset = meshesOffset + std::size_t(header.meshCount)*sizeof(MeshCacheMeshHeader);
+    if(!inBounds(size, imagesOffset, UnsignedLong(sceneHeader.imageCount)*sizeof(MeshCacheImageHeader))) {
+        Error() << prefix << "the file is too short for" << sceneHeader.imageCount << "images";
+        return false;
+    }
+    const std::size_t objectsOffset = imagesOffset + std::size_t(sceneHeader.imageCount)*sizeof(MeshCacheImageHeader);
+    if(!inBounds(size, objectsOffset, UnsignedLong(sceneHeader.objectCount)*sizeof(MeshCacheObjectHeader))) {
+        Error() << prefix << "the file is too short for" << sceneHeader.objectCount << "objects";
+        return false;
+    }
+
+    /* Validate all meshes, so the accessors don't need to do any checks */
+    const auto* const meshes = reinterpret_cast<const MeshCacheMeshHeader*>(data + meshesOffset);
+    for(UnsignedInt i = 0; i != header.meshCount; ++i) {
+        const MeshCacheMeshHeader& mesh = meshes[i];
+
+        switch(MeshPrimitive(mesh.primitive)) {
+            case MeshPrimitive::Points:
+            case MeshPrimitive::LineStrip:
+            case MeshPrimitive::LineLoop:
+            case MeshPrimitive::Lines:
+            case MeshPrimitive::TriangleStrip:
+            case MeshPrimitive::TriangleFan:
+            case MeshPrimitive::Triangles:
+                break;
+            default:
+                Error() << prefix << "invalid primitive in mesh" << i;
+                return false;
+        }
+
+        std::size_t indexSize = 0;
+        if(mesh.indexType) switch(Mesh::IndexType(mesh.indexType)) {
+            case Mesh::IndexType::UnsignedByte:
+            case Mesh::IndexType::UnsignedShort:
+            case Mesh::IndexType::UnsignedInt:
+                indexSize = Mesh::indexSize(Mesh::IndexType(mesh.indexType));
+                break;
+            default:
+                Error() << prefix << "invalid index type in mesh" << i;
+                return false;
+        } else if(mesh.indexCount) {
+            Error() << prefix << "invalid index type in mesh" << i;
+            return false;
+        }
+
+        if(mesh.vertexStride < sizeof(Vector3) || mesh.vertexStride % 4 ||
+           (mesh.normalOffset != MeshCacheNoAttribute && mesh.normalOffset % 4) ||
+           (mesh.textureCoordinateOffset != MeshCacheNoAttribute && mesh.textureCoordinateOffset % 4) ||
+           (mesh.normalOffset != MeshCacheNoAttribute && (mesh.normalOffset > mesh.vertexStride || mesh.vertexStride - mesh.normalOffset < sizeof(Vector3))) ||
+           (mesh.textureCoordinateOffset != MeshCacheNoAttribute && (mesh.textureCoordinateOffset > mesh.vertexStride || mesh.vertexStride - mesh.textureCoordinateOffset < sizeof(Vector2)))) {
+            Error() << prefix << "invalid vertex layout in mesh" << i;
+            return false;
+        }
+
+        if(!inBounds(size, mesh.nameOffset, mesh.nameSize) ||
+           !inBounds(size, mesh.indexDataOffset, UnsignedLong(mesh.indexCount)*indexSize) ||
+           !inBounds(size, mesh.vertexDataOffset, UnsignedLong(mesh.vertexCount)*mesh.vertexStride)) {
+            Error() << prefix << "data of mesh" << i << "are out of file bounds";
+            return false;
+        }
+
+        /* Attribute views point directly into the data, so they need to be
+           properly aligned */
+        if((indexSize && mesh.indexDataOffset % indexSize) || mesh.vertexDataOffset % 4) {
+            Error() << prefix << "data of mesh" << i << "are not aligned";
+            return false;
+        }
+
+        if(mesh.nameSize)
+            _file->meshesForName.emplace(std::string{data + mesh.nameOffset, mesh.nameSize}, i);
+    }
+
+    /* Validate images */
+    const auto* const images = reinterpret_cast<const MeshCacheImageHeader*>(data + imagesOffset);
+    for(UnsignedInt i = 0; i != sceneHeader.imageCount; ++i) {
+        const MeshCacheImageHeader& image = images[i];
+
+        if(image.size[0] < 0 || image.size[1] < 0) {
+            Error() << prefix << "invalid size of image" << i;
+            return false;
+        }
+
+        const std::size_t pixelSize = imagePixelSize(image.format, image.type);
+        if(!pixelSize) {
+            Error() << prefix << "invalid format or type of image" << i;
+            return false;
+        }
+
+        if(!inBounds(size, image.nameOffset, image.nameSize) ||
+           !inBounds(size, image.dataOffset, image.dataSize)) {
+            Error() << prefix << "data of image" << i << "are out of file bounds";
+            return false;
+        }
+
+        /* The image is imported with default pixel storage, so the rows are
+           expected to be aligned the same way */
+        if(image.dataSize < PixelStorage{}.dataSize(pixelSize, {image.size[0], image.size[1], 1})) {
+            Error() << prefix << "data of image" << i << "are too short";
+            return false;
+        }
+
+        if(image.nameSize)
+            _file->imagesForName.emplace(std::string{data + image.nameOffset, image.nameSize}, i);
+    }
+
+    /* Validate objects and build the hierarchy. Parents are required to be
+       before children, so there can't be any cycles. */
+    const auto* const objects = reinterpret_cast<const MeshCacheObjectHeader*>(data + objectsOffset);
+    _file->objectChildren.resize(sceneHeader.objectCount);
+    for(UnsignedInt i = 0; i != sceneHeader.objectCount; ++i) {
+        const MeshCacheObjectHeader& object = objects[i];
+
+        if(object.parent != MeshCacheNoReference && (object.parent < 0 || UnsignedInt(object.parent) >= i)) {
+            Error() << prefix << "invalid parent of object" << i;
+            return false;
+        }
+
+        if(object.mesh != MeshCacheNoReference && (object.mesh < 0 || UnsignedInt(object.mesh) >= header.meshCount)) {
+            Error() << prefix << "invalid mesh of object" << i;
+            return false;
+        }
+
+        if(!inBounds(size, object.nameOffset, object.nameSize)) {
+            Error() << prefix << "data of object" << i << "are out of file bounds";
+            return false;
+        }
+
+        if(object.parent == MeshCacheNoReference)
+            _file->rootObjects.push_back(i);
+        else _file->objectChildren[object.parent].push_back(i);
+
+        if(object.nameSize)
+            _file->objectsForName.emplace(std::string{data + object.nameOffset, object.nameSize}, i);
+    }
+
+    _data = data;
+    _meshes = meshes;
+    _images = images;
+    _objects = objects;
+    _meshCount = header.meshCount;
+    _imageCount = sceneHeader.imageCount;
+    _objectCount = sceneHeader.objectCount;
+    return true;
+}
+
+Int MeshCacheImporter::doDefaultScene() { return _objectCount ? 0 : -1; }
+
+UnsignedInt MeshCacheImporter::doSceneCount() const { return _objectCount ? 1 : 0; }
+
+std::optional<SceneData> MeshCacheImporter::doScene(UnsignedInt) {
+    return SceneData{{}, _file->rootObjects};
+}
+
+UnsignedInt MeshCacheImporter::doObject3DCount() const { return _objectCount; }
+
+Int MeshCacheImporter::doObject3DForName(const std::string& name) {
+    const auto it = _file->objectsForName.find(name);
+    return it == _file->objectsForName.end() ? -1 : it->second;
+}
+
+std::string MeshCacheImporter::doObject3DName(const UnsignedInt id) {
+    return {_data + _objects[id].nameOffset, _objects[id].nameSize};
+}
+
+std::unique_ptr<ObjectData3D> MeshCacheImporter::doObject3D(const UnsignedInt id) {
+    const MeshCacheObjectHeader& header = _objects[id];
+
+    Matrix4 transformation;
+    std::memcpy(transformation.data(), header.transformation, sizeof(Matrix4));
+
+    if(header.mesh != MeshCacheNoReference)
+        return std::unique_ptr<ObjectData3D>{new MeshObjectData3D{_file->objectChildren[id], transformation, UnsignedInt(header.mesh), -1}};
+    return std::unique_ptr<ObjectData3D>{new ObjectData3D{_file->objectChildren[id], transformation}};
+}
+
+UnsignedInt MeshCacheImporter::doImage2DCount() const { return _imageCount; }
+
+Int MeshCacheImporter::doImage2DForName(const std::string& name) {
+    const auto it = _file->imagesForName.find(name);
+    return it == _file->imagesForName.end() ? -1 : it->second;
+}
+
+std::string MeshCacheImporter::doImage2DName(const UnsignedInt id) {
+    return {_data + _images[id].nameOffset, _images[id].nameSize};
+}
+
+std::optional<ImageData2D> MeshCacheImporter::doImage2D(const UnsignedInt id) {
+    const MeshCacheImageHeader& header = _images[id];
+
+    /* ImageData takes ownership of the data, so they have to be copied */
+    char* const data = new char[header.dataSize];
+    std::copy_n(_data + header.dataOffset, header.dataSize, data);
+    return ImageData2D{ColorFormat(header.format), ColorType(header.type), {header.size[0], header.size[1]}, data};
+}
+
+UnsignedInt MeshCacheImporter::doMesh3DCount() const { return _meshCount; }
+
+Int MeshCacheImporter::doMesh3DForName(const std::string& name) {
+    const auto it = _file->meshesForName.find(name);
+    return it == _file->meshesForName.end() ? -1 : it->second;
+}
+
+std::string MeshCacheImporter::doMesh3DName(const UnsignedInt id) {
+    return {_data + _meshes[id].nameOffset, _meshes[id].nameSize};
+}
+
+StridedMeshData3D MeshCacheImporter::stridedMesh3D(const UnsignedInt id) const {
+    const MeshCacheMeshHeader& header = meshHeader(id);
+
+    StridedMeshData3D mesh{MeshPrimitive(header.primitive), _file->data, header.vertexCount, std::size_t(header.vertexDataOffset), header.vertexStride};
+    if(header.indexType)
+        mesh.setIndices(Mesh::IndexType(header.indexType), header.indexDataOffset, header.indexCount);
+    if(header.normalOffset != MeshCacheNoAttribute)
+        mesh.setNormals(header.vertexDataOffset + header.normalOffset, header.vertexStride);
+    if(header.textureCoordinateOffset != MeshCacheNoAttribute)
+        mesh.setTextureCoords2D(header.vertexDataOffset + header.textureCoordinateOffset, header.vertexStride);
+    return mesh;
+}
+
+std::optional<MeshData3D> MeshCacheImporter::doMesh3D(const UnsignedInt id) {
+    return MeshData3D{stridedMesh3D(id)};
+}
+
+}}
@@ -0,0 +1,229 @@
+#ifndef Magnum_Trade_MeshCacheImporter_h
+#define Magnum_Trade_MeshCacheImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MeshCacheImporter
+ */
+
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/StridedMeshData.h"
+#include "MagnumPlugins/MeshCacheImporter/MeshCacheHeader.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh cache importer plugin
+
+Imports binary mesh cache files written by
+@ref magnum-meshcacheconverter "magnum-meshcacheconverter". Format of the file
+is described in @ref MeshCacheHeader, @ref MeshCacheSceneHeader,
+@ref MeshCacheMeshHeader, @ref MeshCacheImageHeader and
+@ref MeshCacheObjectHeader. The file contains already combined and compressed
+index data and interleaved vertex data, thus it is suitable for fast loading
+of meshes previously imported from slow-to-parse formats such as OBJ.
+
+Besides meshes, version 2 of the format contains also 2D images with
+uncompressed pixel data and a 3D scene hierarchy. The objects are exposed as
+a single scene, objects with a mesh are imported as @ref MeshObjectData3D
+with the mesh as instance and no material, other objects are imported as
+empty @ref ObjectData3D.
+
+This plugin is built if `WITH_MESHCACHEIMPORTER` is enabled when building
+Magnum. To use dynamic plugin, you need to load `MeshCacheImporter` plugin
+from `MAGNUM_PLUGINS_IMPORTER_DIR`. To use static plugin or use this as a
+dependency of another plugin, you need to request `MeshCacheImporter`
+component of `Magnum` package in CMake and link to
+`${MAGNUM_MESHCACHEIMPORTER_LIBRARIES}`. See @ref building, @ref cmake and
+@ref plugins for more information.
+
+@section MeshCacheImporter-zero-copy Zero-copy access
+
+The file is memory-mapped on Unix (or copied to memory, if opened from data
+or on other platforms). Besides the usual @ref mesh3D(), which unpacks the
+data into @ref MeshData3D, the index and vertex data can be accessed directly
+and uploaded to buffers without any processing:
+
+@code
+Trade::MeshCacheImporter importer;
+importer.openFile("scene.mesh");
+
+const Trade::MeshCacheMeshHeader& header = importer.meshHeader(0);
+Buffer indexBuffer, vertexBuffer;
+indexBuffer.setData(importer.indexData(0), BufferUsage::StaticDraw);
+vertexBuffer.setData(importer.vertexData(0), BufferUsage::StaticDraw);
+
+Mesh mesh;
+mesh.setPrimitive(MeshPrimitive(header.primitive))
+    .setCount(header.indexCount)
+    .addVertexBuffer(vertexBuffer, 0, Shaders::Phong::Position{},
+        Shaders::Phong::Normal{})
+    .setIndexBuffer(indexBuffer, 0, Mesh::IndexType(header.indexType),
+        header.indexStart, header.indexEnd);
+@endcode
+
+The same data are also available through @ref stridedMesh3D() as a
+@ref StridedMeshData3D view. Similarly, pixel data of images can be accessed
+using @ref imageHeader() and @ref imageData() and object hierarchy using
+@ref objectHeader(), without any copies.
+*/
+class MeshCacheImporter: public AbstractImporter {
+    public:
+        /** @brief Default constructor */
+        explicit MeshCacheImporter();
+
+        /** @brief Plugin manager constructor */
+        explicit MeshCacheImporter(PluginManager::AbstractManager& manager, std::string plugin);
+
+        ~MeshCacheImporter();
+
+        /**
+         * @brief Mesh header
+         *
+         * Expects that a file is opened and @p id is less than
+         * @ref mesh3DCount().
+         */
+        const MeshCacheMeshHeader& meshHeader(UnsignedInt id) const {
+            CORRADE_ASSERT(_meshes, "Trade::MeshCacheImporter::meshHeader(): no file opened", _meshes[0]);
+            CORRADE_ASSERT(id < _meshCount, "Trade::MeshCacheImporter::meshHeader(): index out of range", _meshes[0]);
+            return _meshes[id];
+        }
+
+        /**
+         * @brief Index data
+         *
+         * Pointing directly to the (memory-mapped) file contents, valid until
+         * the file is closed. Empty if the mesh is not indexed.
+         * @see @ref meshHeader()
+         */
+        Containers::ArrayReference<const char> indexData(UnsignedInt id) const {
+            const MeshCacheMeshHeader& header = meshHeader(id);
+            return {_data + header.indexDataOffset, header.indexType ? header.indexCount*Mesh::indexSize(Mesh::IndexType(header.indexType)) : 0};
+        }
+
+        /**
+         * @brief Interleaved vertex data
+         *
+         * Pointing directly to the (memory-mapped) file contents, valid until
+         * the file is closed.
+         * @see @ref meshHeader()
+         */
+        Containers::ArrayReference<const char> vertexData(UnsignedInt id) const {
+            const MeshCacheMeshHeader& header = meshHeader(id);
+            return {_data + header.vertexDataOffset, std::size_t(header.vertexCount)*header.vertexStride};
+        }
+
+        /**
+         * @brief Strided mesh data
+         *
+         * Non-owning view pointing directly to the (memory-mapped) file
+         * contents, valid until the file is closed. Expects that a file is
+         * opened and @p id is less than @ref mesh3DCount().
+         * @see @ref mesh3D()
+         */
+        StridedMeshData3D stridedMesh3D(UnsignedInt id) const;
+
+        /**
+         * @brief Image header
+         *
+         * Expects that a file is opened and @p id is less than
+         * @ref image2DCount().
+         */
+        const MeshCacheImageHeader& imageHeader(UnsignedInt id) const {
+            CORRADE_ASSERT(_data, "Trade::MeshCacheImporter::imageHeader(): no file opened", _images[0]);
+            CORRADE_ASSERT(id < _imageCount, "Trade::MeshCacheImporter::imageHeader(): index out of range", _images[0]);
+            return _images[id];
+        }
+
+        /**
+         * @brief Image pixel data
+         *
+         * Pointing directly to the (memory-mapped) file contents, valid until
+         * the file is closed.
+         * @see @ref imageHeader(), @ref image2D()
+         */
+        Containers::ArrayReference<const char> imageData(UnsignedInt id) const {
+            const MeshCacheImageHeader& header = imageHeader(id);
+            return {_data + header.dataOffset, std::size_t(header.dataSize)};
+        }
+
+        /**
+         * @brief Object header
+         *
+         * Expects that a file is opened and @p id is less than
+         * @ref object3DCount().
+         * @see @ref object3D()
+         */
+        const MeshCacheObjectHeader& objectHeader(UnsignedInt id) const {
+            CORRADE_ASSERT(_data, "Trade::MeshCacheImporter::objectHeader(): no file opened", _objects[0]);
+            CORRADE_ASSERT(id < _objectCount, "Trade::MeshCacheImporter::objectHeader(): index out of range", _objects[0]);
+            return _objects[id];
+        }
+
+    private:
+        struct File;
+
+        Features doFeatures() const override;
+
+        bool doIsOpened() const override;
+        void doOpenData(Containers::ArrayReference<const char> data, DataFlags flags) override;
+        void doClose() override;
+
+        UnsignedInt doMesh3DCount() const override;
+        Int doMesh3DForName(const std::string& name) override;
+        std::string doMesh3DName(UnsignedInt id) override;
+        std::optional<MeshData3D> doMesh3D(UnsignedInt id) override;
+
+        Int doDefaultScene() override;
+        UnsignedInt doSceneCount() const override;
+        std::optional<SceneData> doScene(UnsignedInt id) override;
+
+        UnsignedInt doObject3DCount() const override;
+        Int doObject3DForName(const std::string& name) override;
+        std::string doObject3DName(UnsignedInt id) override;
+        std::unique_ptr<ObjectData3D> doObject3D(UnsignedInt id) override;
+
+        UnsignedInt doImage2DCount() const override;
+        Int doImage2DForName(const std::string& name) override;
+        std::string doImage2DName(UnsignedInt id) override;
+        std::optional<ImageData2D> doImage2D(UnsignedInt id) override;
+
+        bool parse(const char* prefix);
+
+        std::unique_ptr<File> _file;
+        const char* _data{};
+        const MeshCacheMeshHeader* _meshes{};
+        const MeshCacheImageHeader* _images{};
+        const MeshCacheObjectHeader* _objects{};
+        UnsignedInt _meshCount{}, _imageCount{}, _objectCount{};
+};
+
+}}
+
+#endif
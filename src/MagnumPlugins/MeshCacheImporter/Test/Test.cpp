@@ -0,0 +1,612 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ColorFormat.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "Magnum/Trade/MeshObjectData3D.h"
+#include "Magnum/Trade/SceneData.h"
+#include "MagnumPlugins/MeshCacheImporter/MeshCacheImporter.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class MeshCacheImporterTest: public TestSuite::Tester {
+    public:
+        explicit MeshCacheImporterTest();
+
+        void fileTooShort();
+        void invalidSignature();
+        void unsupportedVersion();
+        void tooManyMeshes();
+        void invalidPrimitive();
+        void invalidIndexType();
+        void invalidVertexLayout();
+        void outOfBounds();
+        void notAligned();
+        void tooManyObjects();
+        void invalidImageSize();
+        void imageOutOfBounds();
+        void invalidImageFormat();
+        void invalidImageType();
+        void imageDataTooShort();
+        void invalidObjectParent();
+        void invalidObjectMesh();
+
+        void names();
+        void mesh();
+        void unindexedMesh();
+        void directAccess();
+        void stridedMesh();
+        void openFileNonexistent();
+
+        void scene();
+        void image();
+};
+
+MeshCacheImporterTest::MeshCacheImporterTest() {
+    addTests({&MeshCacheImporterTest::fileTooShort,
+              &MeshCacheImporterTest::invalidSignature,
+              &MeshCacheImporterTest::unsupportedVersion,
+              &MeshCacheImporterTest::tooManyMeshes,
+              &MeshCacheImporterTest::invalidPrimitive,
+              &MeshCacheImporterTest::invalidIndexType,
+              &MeshCacheImporterTest::invalidVertexLayout,
+              &MeshCacheImporterTest::outOfBounds,
+              &MeshCacheImporterTest::notAligned,
+              &MeshCacheImporterTest::tooManyObjects,
+              &MeshCacheImporterTest::invalidImageSize,
+              &MeshCacheImporterTest::imageOutOfBounds,
+              &MeshCacheImporterTest::invalidImageFormat,
+              &MeshCacheImporterTest::invalidImageType,
+              &MeshCacheImporterTest::imageDataTooShort,
+              &MeshCacheImporterTest::invalidObjectParent,
+              &MeshCacheImporterTest::invalidObjectMesh,
+
+              &MeshCacheImporterTest::names,
+              &MeshCacheImporterTest::mesh,
+              &MeshCacheImporterTest::unindexedMesh,
+              &MeshCacheImporterTest::directAccess,
+              &MeshCacheImporterTest::stridedMesh,
+              &MeshCacheImporterTest::openFileNonexistent,
+
+              &MeshCacheImporterTest::scene,
+              &MeshCacheImporterTest::image});
+}
+
+namespace {
+    struct Vertex {
+        Vector3 position;
+        Vector3 normal;
+        Vector2 textureCoordinates;
+    };
+
+    constexpr UnsignedByte Indices[]{0, 1, 2, 2, 1, 3};
+    constexpr Vertex Vertices[]{
+        {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f}},
+        {{1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f}},
+        {{0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 1.0f}},
+        {{1.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 1.0f}}
+    };
+    constexpr Vector3 Points[]{{0.5f, 2.0f, 3.0f}, {0.0f, 1.5f, 1.0f}};
+
+    /* File with one indexed named quad with all attributes and one unindexed
+       unnamed point mesh with just positions */
+    struct File {
+        MeshCacheHeader header;
+        MeshCacheMeshHeader meshes[2];
+        char name[16];
+        UnsignedByte indices[16];
+        Vertex vertices[4];
+        Vector3 points[2];
+    };
+
+    File file() {
+        File file{};
+        std::memcpy(file.header.magic, "MGMC", 4);
+        file.header.version = 1;
+        file.header.meshCount = 2;
+
+        MeshCacheMeshHeader& quad = file.meshes[0];
+        quad.primitive = UnsignedInt(MeshPrimitive::Triangles);
+        quad.indexType = UnsignedInt(Mesh::IndexType::UnsignedByte);
+        quad.indexCount = 6;
+        quad.indexStart = 0;
+        quad.indexEnd = 3;
+        quad.vertexCount = 4;
+        quad.vertexStride = sizeof(Vertex);
+        quad.normalOffset = sizeof(Vector3);
+        quad.textureCoordinateOffset = 2*sizeof(Vector3);
+        quad.nameSize = 4;
+        quad.nameOffset = offsetof(File, name);
+        quad.indexDataOffset = offsetof(File, indices);
+        quad.vertexDataOffset = offsetof(File, vertices);
+        std::memcpy(file.name, "quad", 4);
+        std::copy(std::begin(Indices), std::end(Indices), file.indices);
+        std::copy(std::begin(Vertices), std::end(Vertices), file.vertices);
+
+        MeshCacheMeshHeader& points = file.meshes[1];
+        points.primitive = UnsignedInt(MeshPrimitive::Points);
+        points.vertexCount = 2;
+        points.vertexStride = sizeof(Vector3);
+        points.normalOffset = MeshCacheNoAttribute;
+        points.textureCoordinateOffset = MeshCacheNoAttribute;
+        points.vertexDataOffset = offsetof(File, points);
+        std::copy(std::begin(Points), std::end(Points), file.points);
+
+        return file;
+    }
+
+    Containers::ArrayReference<const char> data(const File& file) {
+        return {reinterpret_cast<const char*>(&file), sizeof(File)};
+    }
+
+    constexpr UnsignedByte Pixels[]{0xff, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff};
+
+    /* Version 2 file with one point mesh, one 2x1 RGBA image and a hierarchy
+       of three objects, the second one instancing the mesh */
+    struct SceneFile {
+        MeshCacheHeader header;
+        MeshCacheSceneHeader sceneHeader;
+        MeshCacheMeshHeader meshes[1];
+        MeshCacheImageHeader images[1];
+        MeshCacheObjectHeader objects[3];
+        char names[16];
+        Vector3 points[2];
+        UnsignedByte pixels[8];
+    };
+
+    SceneFile sceneFile() {
+        SceneFile file{};
+        std::memcpy(file.header.magic, "MGMC", 4);
+        file.header.version = 2;
+        file.header.meshCount = 1;
+        file.sceneHeader.imageCount = 1;
+        file.sceneHeader.objectCount = 3;
+        std::memcpy(file.names, "texrootchild", 12);
+
+        MeshCacheMeshHeader& points = file.meshes[0];
+        points.primitive = UnsignedInt(MeshPrimitive::Points);
+        points.vertexCount = 2;
+        points.vertexStride = sizeof(Vector3);
+        points.normalOffset = MeshCacheNoAttribute;
+        points.textureCoordinateOffset = MeshCacheNoAttribute;
+        points.vertexDataOffset = offsetof(SceneFile, points);
+        std::copy(std::begin(Points), std::end(Points), file.points);
+
+        MeshCacheImageHeader& image = file.images[0];
+        image.format = UnsignedInt(ColorFormat::RGBA);
+        image.type = UnsignedInt(ColorType::UnsignedByte);
+        image.size[0] = 2;
+        image.size[1] = 1;
+        image.nameSize = 3;
+        image.nameOffset = offsetof(SceneFile, names);
+        image.dataOffset = offsetof(SceneFile, pixels);
+        image.dataSize = 8;
+        std::copy(std::begin(Pixels), std::end(Pixels), file.pixels);
+
+        const Matrix4 translation = Matrix4::translation({1.0f, 2.0f, 3.0f});
+        const Matrix4 identity;
+
+        MeshCacheObjectHeader& root = file.objects[0];
+        root.parent = MeshCacheNoReference;
+        root.mesh = MeshCacheNoReference;
+        root.nameSize = 4;
+        root.nameOffset = offsetof(SceneFile, names) + 3;
+        std::memcpy(root.transformation, translation.data(), sizeof(Matrix4));
+
+        MeshCacheObjectHeader& child = file.objects[1];
+        child.parent = 0;
+        child.mesh = 0;
+        child.nameSize = 5;
+        child.nameOffset = offsetof(SceneFile, names) + 7;
+        std::memcpy(child.transformation, identity.data(), sizeof(Matrix4));
+
+        MeshCacheObjectHeader& unnamed = file.objects[2];
+        unnamed.parent = MeshCacheNoReference;
+        unnamed.mesh = MeshCacheNoReference;
+        std::memcpy(unnamed.transformation, identity.data(), sizeof(Matrix4));
+
+        return file;
+    }
+
+    Containers::ArrayReference<const char> data(const SceneFile& file) {
+        return {reinterpret_cast<const char*>(&file), sizeof(SceneFile)};
+    }
+}
+
+void MeshCacheImporterTest::fileTooShort() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    const char data[]{'M', 'G', 'M', 'C'};
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): the file is too short: 4 bytes\n");
+}
+
+void MeshCacheImporterTest::invalidSignature() {
+    File f = file();
+    f.header.magic[3] = 'X';
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): invalid file signature\n");
+}
+
+void MeshCacheImporterTest::unsupportedVersion() {
+    File f = file();
+    f.header.version = 3;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): unsupported file version 3\n");
+}
+
+void MeshCacheImporterTest::tooManyMeshes() {
+    File f = file();
+    f.header.meshCount = 100;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): the file is too short for 100 meshes\n");
+}
+
+void MeshCacheImporterTest::invalidPrimitive() {
+    File f = file();
+    f.meshes[1].primitive = 0xdead;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): invalid primitive in mesh 1\n");
+}
+
+void MeshCacheImporterTest::invalidIndexType() {
+    File f = file();
+    f.meshes[0].indexType = 0xdead;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): invalid index type in mesh 0\n");
+}
+
+void MeshCacheImporterTest::invalidVertexLayout() {
+    File f = file();
+    f.meshes[0].textureCoordinateOffset = sizeof(Vertex) - 4;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): invalid vertex layout in mesh 0\n");
+}
+
+void MeshCacheImporterTest::outOfBounds() {
+    File f = file();
+    f.meshes[1].vertexCount = 3;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): data of mesh 1 are out of file bounds\n");
+}
+
+void MeshCacheImporterTest::notAligned() {
+    File f = file();
+    f.meshes[1].vertexDataOffset -= 2;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): data of mesh 1 are not aligned\n");
+}
+
+void MeshCacheImporterTest::tooManyObjects() {
+    SceneFile f = sceneFile();
+    f.sceneHeader.objectCount = 100;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): the file is too short for 100 objects\n");
+}
+
+void MeshCacheImporterTest::invalidImageSize() {
+    SceneFile f = sceneFile();
+    f.images[0].size[1] = -1;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): invalid size of image 0\n");
+}
+
+void MeshCacheImporterTest::imageOutOfBounds() {
+    SceneFile f = sceneFile();
+    f.images[0].dataSize = 1000;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): data of image 0 are out of file bounds\n");
+}
+
+void MeshCacheImporterTest::invalidImageFormat() {
+    SceneFile f = sceneFile();
+    f.images[0].format = 0xdead;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): invalid format or type of image 0\n");
+}
+
+void MeshCacheImporterTest::invalidImageType() {
+    SceneFile f = sceneFile();
+    f.images[0].type = 0xdead;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): invalid format or type of image 0\n");
+}
+
+void MeshCacheImporterTest::imageDataTooShort() {
+    /* 1x2 RGB image has the first row padded to four bytes, so it needs 7
+       bytes and not just 6 */
+    SceneFile f = sceneFile();
+    f.images[0].format = UnsignedInt(ColorFormat::RGB);
+    f.images[0].size[0] = 1;
+    f.images[0].size[1] = 2;
+    f.images[0].dataSize = 6;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): data of image 0 are too short\n");
+}
+
+void MeshCacheImporterTest::invalidObjectParent() {
+    SceneFile f = sceneFile();
+    f.objects[1].parent = 2;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): invalid parent of object 1\n");
+}
+
+void MeshCacheImporterTest::invalidObjectMesh() {
+    SceneFile f = sceneFile();
+    f.objects[1].mesh = 1;
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openData(data(f)));
+    CORRADE_COMPARE(out.str(), "Trade::MeshCacheImporter::openData(): invalid mesh of object 1\n");
+}
+
+void MeshCacheImporterTest::names() {
+    const File f = file();
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openData(data(f)));
+    CORRADE_COMPARE(importer.mesh3DCount(), 2);
+    CORRADE_COMPARE(importer.mesh3DName(0), "quad");
+    CORRADE_COMPARE(importer.mesh3DName(1), "");
+    CORRADE_COMPARE(importer.mesh3DForName("quad"), 0);
+    CORRADE_COMPARE(importer.mesh3DForName(""), -1);
+}
+
+void MeshCacheImporterTest::mesh() {
+    const File f = file();
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openData(data(f)));
+
+    const std::optional<MeshData3D> mesh = importer.mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh->indices(), (std::vector<UnsignedInt>{0, 1, 2, 2, 1, 3}));
+    CORRADE_COMPARE(mesh->positionArrayCount(), 1);
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{
+        {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}
+    }));
+    CORRADE_COMPARE(mesh->normalArrayCount(), 1);
+    CORRADE_COMPARE(mesh->normals(0), (std::vector<Vector3>(4, {0.0f, 0.0f, 1.0f})));
+    CORRADE_COMPARE(mesh->textureCoords2DArrayCount(), 1);
+    CORRADE_COMPARE(mesh->textureCoords2D(0), (std::vector<Vector2>{
+        {0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}, {1.0f, 1.0f}
+    }));
+}
+
+void MeshCacheImporterTest::unindexedMesh() {
+    const File f = file();
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openData(data(f)));
+
+    const std::optional<MeshData3D> mesh = importer.mesh3D(1);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Points);
+    CORRADE_VERIFY(!mesh->isIndexed());
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{
+        {0.5f, 2.0f, 3.0f}, {0.0f, 1.5f, 1.0f}
+    }));
+    CORRADE_VERIFY(!mesh->hasNormals());
+    CORRADE_VERIFY(!mesh->hasTextureCoords2D());
+}
+
+void MeshCacheImporterTest::directAccess() {
+    const File f = file();
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openData(data(f)));
+
+    const MeshCacheMeshHeader& header = importer.meshHeader(0);
+    CORRADE_COMPARE(header.indexCount, 6);
+    CORRADE_COMPARE(header.indexEnd, 3);
+
+    const Containers::ArrayReference<const char> indexData = importer.indexData(0);
+    CORRADE_COMPARE(indexData.size(), 6);
+    CORRADE_VERIFY(std::memcmp(indexData.data(), Indices, 6) == 0);
+
+    const Containers::ArrayReference<const char> vertexData = importer.vertexData(0);
+    CORRADE_COMPARE(vertexData.size(), sizeof(Vertices));
+    CORRADE_VERIFY(std::memcmp(vertexData.data(), Vertices, sizeof(Vertices)) == 0);
+
+    CORRADE_COMPARE(importer.indexData(1).size(), 0);
+    CORRADE_COMPARE(importer.vertexData(1).size(), sizeof(Points));
+}
+
+void MeshCacheImporterTest::stridedMesh() {
+    const File f = file();
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openData(data(f)));
+
+    const StridedMeshData3D mesh = importer.stridedMesh3D(0);
+    CORRADE_VERIFY(!mesh.isOwning());
+    CORRADE_COMPARE(mesh.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh.indexType(), Mesh::IndexType::UnsignedByte);
+    CORRADE_COMPARE(mesh.indexData().data(), importer.indexData(0).data());
+    CORRADE_COMPARE(mesh.indexData().size(), 6);
+    CORRADE_COMPARE(mesh.vertexData().data(), importer.vertexData(0).data());
+    CORRADE_COMPARE(mesh.vertexData().size(), sizeof(Vertices));
+    CORRADE_COMPARE(mesh.positions()[3], Vector3(1.0f, 1.0f, 0.0f));
+    CORRADE_COMPARE(mesh.normals()[2], Vector3(0.0f, 0.0f, 1.0f));
+    CORRADE_COMPARE(mesh.textureCoords2D()[1], Vector2(1.0f, 0.0f));
+
+    const StridedMeshData3D points = importer.stridedMesh3D(1);
+    CORRADE_VERIFY(!points.isIndexed());
+    CORRADE_COMPARE(points.positions().size(), 2);
+    CORRADE_COMPARE(points.positions()[1], Vector3(0.0f, 1.5f, 1.0f));
+    CORRADE_VERIFY(!points.hasNormals());
+}
+
+void MeshCacheImporterTest::openFileNonexistent() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(!importer.openFile("nonexistent.mesh"));
+    CORRADE_COMPARE(out.str(), "Trade::AbstractImporter::openFile(): cannot open file nonexistent.mesh\n");
+}
+
+void MeshCacheImporterTest::scene() {
+    const SceneFile f = sceneFile();
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openData(data(f)));
+    CORRADE_COMPARE(importer.mesh3DCount(), 1);
+    CORRADE_COMPARE(importer.defaultScene(), 0);
+    CORRADE_COMPARE(importer.sceneCount(), 1);
+
+    const std::optional<SceneData> scene = importer.scene(0);
+    CORRADE_VERIFY(scene);
+    CORRADE_VERIFY(scene->children2D().empty());
+    CORRADE_COMPARE(scene->children3D(), (std::vector<UnsignedInt>{0, 2}));
+
+    CORRADE_COMPARE(importer.object3DCount(), 3);
+    CORRADE_COMPARE(importer.object3DName(0), "root");
+    CORRADE_COMPARE(importer.object3DName(2), "");
+    CORRADE_COMPARE(importer.object3DForName("child"), 1);
+    CORRADE_COMPARE(importer.object3DForName("nonexistent"), -1);
+
+    const std::unique_ptr<ObjectData3D> root = importer.object3D(0);
+    CORRADE_VERIFY(root);
+    CORRADE_COMPARE(root->instanceType(), ObjectInstanceType3D::Empty);
+    CORRADE_COMPARE(root->children(), (std::vector<UnsignedInt>{1}));
+    CORRADE_COMPARE(root->transformation(), Matrix4::translation({1.0f, 2.0f, 3.0f}));
+
+    const std::unique_ptr<ObjectData3D> child = importer.object3D(1);
+    CORRADE_VERIFY(child);
+    CORRADE_COMPARE(child->instanceType(), ObjectInstanceType3D::Mesh);
+    CORRADE_COMPARE(child->instance(), 0);
+    CORRADE_COMPARE(static_cast<MeshObjectData3D&>(*child).material(), -1);
+    CORRADE_VERIFY(child->children().empty());
+
+    CORRADE_COMPARE(importer.objectHeader(1).parent, 0);
+}
+
+void MeshCacheImporterTest::image() {
+    const SceneFile f = sceneFile();
+    MeshCacheImporter importer;
+    CORRADE_VERIFY(importer.openData(data(f)));
+    CORRADE_COMPARE(importer.image2DCount(), 1);
+    CORRADE_COMPARE(importer.image2DName(0), "tex");
+    CORRADE_COMPARE(importer.image2DForName("tex"), 0);
+
+    const std::optional<ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), ColorFormat::RGBA);
+    CORRADE_COMPARE(image->type(), ColorType::UnsignedByte);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 1));
+    CORRADE_VERIFY(std::memcmp(image->data(), Pixels, 8) == 0);
+
+    CORRADE_COMPARE(importer.imageHeader(0).size[0], 2);
+    const Containers::ArrayReference<const char> imageData = importer.imageData(0);
+    CORRADE_COMPARE(imageData.size(), 8);
+    CORRADE_VERIFY(std::memcmp(imageData.data(), Pixels, 8) == 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshCacheImporterTest)
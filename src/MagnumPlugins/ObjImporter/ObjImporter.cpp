@@ -25,430 +25,494 @@
 
 #include "ObjImporter.h"
 
-#include <fstream>
-#include <limits>
-#include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <unordered_map>
 #include <Corrade/Containers/Array.h>
-#include <Corrade/Utility/String.h>
 
 #include "Magnum/Mesh.h"
+#include "Magnum/TaskScheduler.h"
 #include "Magnum/MeshTools/CombineIndexedArrays.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/Trade/MeshData3D.h"
 
-#if defined(CORRADE_TARGET_NACL_NEWLIB) || defined(CORRADE_TARGET_ANDROID)
-#include <sstream>
-#endif
-
 namespace Magnum { namespace Trade {
 
-struct ObjImporter::File {
-    std::unordered_map<std::string, UnsignedInt> meshesForName;
-    std::vector<std::string> meshNames;
-    std::vector<std::tuple<std::streampos, std::streampos, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
-    std::unique_ptr<std::istream> in;
-};
-
 namespace {
 
-void ignoreLine(std::istream& in) {
-    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-}
+struct MeshInfo {
+    /* Byte range in the file */
+    std::size_t begin, end;
 
-template<std::size_t size> Math::Vector<size, Float> extractFloatData(std::string str, Float* extra = nullptr) {
-    std::vector<std::string> data = Utility::String::splitWithoutEmptyParts(str, ' ');
-    if(data.size() < size || data.size() > size + (extra ? 1 : 0)) {
-        Error() << "Trade::ObjImporter::mesh3D(): invalid float array size";
-        throw 0;
-    }
+    /* Offsets to convert global OBJ indices to mesh-relative */
+    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
 
-    Math::Vector<size, Float> output;
+    /* Counts found during the initial scan, used for reserving memory */
+    std::size_t positionCount, textureCoordinateCount, normalCount, indexCount;
+};
 
-    #if defined(CORRADE_TARGET_NACL_NEWLIB) || defined(CORRADE_TARGET_ANDROID)
-    std::istringstream in;
-    #endif
+}
 
-    for(std::size_t i = 0; i != size; ++i) {
-        #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-        output[i] = std::stof(data[i]);
-        #else
-        in.str(data[i]);
-        in >> output[i];
-        #endif
-    }
+struct ObjImporter::File {
+    std::unordered_map<std::string, UnsignedInt> meshesForName;
+    std::vector<std::string> meshNames;
+    std::vector<MeshInfo> meshes;
 
-    if(data.size() == size+1) {
-        /* This should be obvious from the first if, but add this just to make
-           Clang Analyzer happy */
-        CORRADE_INTERNAL_ASSERT(extra);
-
-        #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-        *extra = std::stof(data.back());
-        #else
-        in.str(data.back());
-        in >> *extra;
-        #endif
-    }
+    /* File contents, either referenced or copied */
+    Containers::ArrayReference<const char> data;
+    Containers::Array<char> ownedData;
+};
 
-    return output;
-}
+namespace {
 
-template<class T> void reindex(const std::vector<UnsignedInt>& indices, std::vector<T>& data) {
-    /* Check that indices are in range */
-    for(UnsignedInt i: indices) if(i >= data.size()) {
-        Error() << "Trade::ObjImporter::mesh3D(): index out of range";
-        throw 0;
-    }
+/* Hand-written tokenizer working directly on the file contents, without any
+   allocations. Lines may end with \r\n. */
 
-    data = MeshTools::duplicate(indices, data);
+inline bool isSpace(const char c) {
+    return c == ' ' || c == '\t' || c == '\r';
 }
 
+inline const char* lineEnd(const char* const begin, const char* const end) {
+    const char* const found = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+    return found ? found : end;
 }
 
-ObjImporter::ObjImporter() = default;
-
-ObjImporter::ObjImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)) {}
-
-ObjImporter::~ObjImporter() = default;
-
-auto ObjImporter::doFeatures() const -> Features { return Feature::OpenData; }
-
-void ObjImporter::doClose() { _file.reset(); }
-
-bool ObjImporter::doIsOpened() const { return !!_file; }
-
-void ObjImporter::doOpenFile(const std::string& filename) {
-    /* Open file in *text* mode (to avoid \r handling) */
-    std::unique_ptr<std::istream> in{new std::ifstream{filename}};
-    if(!in->good()) {
-        Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
-        return;
-    }
-
-    _file.reset(new File);
-    _file->in = std::move(in);
-    parseMeshNames();
+inline const char* skipSpaces(const char* begin, const char* const end) {
+    while(begin != end && isSpace(*begin)) ++begin;
+    return begin;
 }
 
-void ObjImporter::doOpenData(Containers::ArrayReference<const char> data) {
-    /* Open file in *text* mode (to avoid \r handling) */
-    _file.reset(new File);
-    _file->in.reset(new std::istringstream{{data.begin(), data.size()}});
-
-    parseMeshNames();
+inline const char* tokenEnd(const char* begin, const char* const end) {
+    while(begin != end && !isSpace(*begin)) ++begin;
+    return begin;
 }
 
-void ObjImporter::parseMeshNames() {
-    /* First mesh starts at the beginning, its indices start from 1. The end
-       offset will be updated to proper value later. */
-    UnsignedInt positionIndexOffset = 1;
-    UnsignedInt normalIndexOffset = 1;
-    UnsignedInt textureCoordinateIndexOffset = 1;
-    _file->meshes.emplace_back(0, 0, positionIndexOffset, normalIndexOffset, textureCoordinateIndexOffset);
-
-    /* The first mesh doesn't have name by default but we might find it later,
-       so we need to track whether there are any data before first name */
-    bool thisIsFirstMeshAndItHasNoData = true;
-    _file->meshNames.emplace_back();
-
-    while(_file->in->good()) {
-        /* The previous object might end at the beginning of this line */
-        const std::streampos end = _file->in->tellg();
+inline bool equals(const char* const begin, const char* const end, const char* const string) {
+    const std::size_t size = std::strlen(string);
+    return std::size_t(end - begin) == size && std::memcmp(begin, string, size) == 0;
+}
 
-        /* Comment line */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
+/* Parses a decimal number with optional sign, fractional part and exponent.
+   The whole range has to be consumed. */
+bool parseFloat(const char* begin, const char* const end, Float& out) {
+    bool negative = false;
+    if(begin != end && (*begin == '-' || *begin == '+')) negative = *begin++ == '-';
+
+    /* Mantissa, digits over the 64-bit range only increase the exponent */
+    UnsignedLong mantissa = 0;
+    Int exponent = 0;
+    std::size_t digits = 0;
+    for(; begin != end && *begin >= '0' && *begin <= '9'; ++begin, ++digits) {
+        if(mantissa < 1000000000000000000ull) mantissa = mantissa*10 + (*begin - '0');
+        else ++exponent;
+    }
+    if(begin != end && *begin == '.') {
+        for(++begin; begin != end && *begin >= '0' && *begin <= '9'; ++begin, ++digits) {
+            if(mantissa < 1000000000000000000ull) {
+                mantissa = mantissa*10 + (*begin - '0');
+                --exponent;
+            }
         }
+    }
+    if(!digits) return false;
+
+    /* Exponent */
+    if(begin != end && (*begin == 'e' || *begin == 'E')) {
+        ++begin;
+        bool negativeExponent = false;
+        if(begin != end && (*begin == '-' || *begin == '+')) negativeExponent = *begin++ == '-';
+        if(begin == end) return false;
+        Int value = 0;
+        for(; begin != end && *begin >= '0' && *begin <= '9'; ++begin)
+            if(value < 10000) value = value*10 + (*begin - '0');
+        exponent += negativeExponent ? -value : value;
+    }
+    if(begin != end) return false;
+
+    /* Powers up to 22 are exact in double */
+    constexpr Double Powers[]{1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6,
+        1.0e7, 1.0e8, 1.0e9, 1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15,
+        1.0e16, 1.0e17, 1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22};
+    Double value = Double(mantissa);
+    const Int absExponent = exponent < 0 ? -exponent : exponent;
+    const Double scale = absExponent <= 22 ? Powers[absExponent] : std::pow(10.0, absExponent);
+    value = exponent < 0 ? value/scale : value*scale;
+
+    out = Float(negative ? -value : value);
+    return true;
+}
 
-        /* Parse the keyword */
-        std::string keyword;
-        *_file->in >> keyword;
-
-        /* Mesh name */
-        if(keyword == "o") {
-            std::string name;
-            std::getline(*_file->in, name);
-            name = Utility::String::trim(name);
-
-            /* This is the name of first mesh */
-            if(thisIsFirstMeshAndItHasNoData) {
-                thisIsFirstMeshAndItHasNoData = false;
+/* Parses unsigned decimal integer, the whole range has to be consumed */
+bool parseIndex(const char* begin, const char* const end, UnsignedInt& out) {
+    if(begin == end) return false;
 
-                /* Update its name and add it to name map */
-                if(!name.empty())
-                    _file->meshesForName.emplace(name, _file->meshes.size() - 1);
-                _file->meshNames.back() = std::move(name);
+    UnsignedLong value = 0;
+    for(; begin != end; ++begin) {
+        if(*begin < '0' || *begin > '9') return false;
+        value = value*10 + (*begin - '0');
+        if(value > 0xffffffffull) return false;
+    }
 
-                /* Update its begin offset to be more precise */
-                std::get<0>(_file->meshes.back()) = _file->in->tellg();
+    out = UnsignedInt(value);
+    return true;
+}
 
-            /* Otherwise this is a name of new mesh */
-            } else {
-                /* Set end of the previous one */
-                std::get<1>(_file->meshes.back()) = end;
+/* The parsing below may run on multiple threads, so the errors are not
+   printed directly but saved and printed later on the calling thread, in the
+   order in which they appear in the file */
+struct ParseError {
+    const char* message{};
 
-                /* Save name and offset of the new one. The end offset will be
-                   updated later. */
-                if(!name.empty())
-                    _file->meshesForName.emplace(name, _file->meshes.size());
-                _file->meshNames.emplace_back(std::move(name));
-                _file->meshes.emplace_back(_file->in->tellg(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
-            }
+    /* Line at which the error occured, if known */
+    const char* position{};
 
-            continue;
+    /* Unknown keyword */
+    const char* keywordBegin{};
+    const char* keywordEnd{};
 
-        /* If there are any data/indices before the first name, it means that
-           the first object is unnamed. We need to check for them. */
+    /* Mixed primitives */
+    bool mixedPrimitives{};
+    MeshPrimitive primitive, otherPrimitive;
+};
 
-        /* Vertex data, update index offset for the following meshes */
-        } else if(keyword == "v") {
-            ++positionIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vt") {
-            ++textureCoordinateIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vn") {
-            ++normalIndexOffset;
-            thisIsFirstMeshAndItHasNoData = false;
+void printError(const ParseError& error) {
+    if(error.keywordBegin)
+        Error() << "Trade::ObjImporter::mesh3D():" << error.message << std::string{error.keywordBegin, error.keywordEnd};
+    else if(error.mixedPrimitives)
+        Error() << "Trade::ObjImporter::mesh3D():" << error.message << error.primitive << "and" << error.otherPrimitive;
+    else
+        Error() << "Trade::ObjImporter::mesh3D():" << error.message;
+}
 
-        /* Index data, just mark that we found something for first unnamed
-           object */
-        } else if(thisIsFirstMeshAndItHasNoData) for(const std::string& data: {"p", "l", "f"}) {
-            if(keyword == data) {
-                thisIsFirstMeshAndItHasNoData = false;
-                break;
-            }
+template<std::size_t size> const char* extractFloatData(const char* begin, const char* const end, Math::Vector<size, Float>& output, Float* extra = nullptr) {
+    /* Find the tokens first to check the count before any conversion */
+    const char* tokens[size + 2][2];
+    std::size_t count = 0;
+    for(begin = skipSpaces(begin, end); begin != end; begin = skipSpaces(begin, end)) {
+        const char* const e = tokenEnd(begin, end);
+        if(count < size + 2) {
+            tokens[count][0] = begin;
+            tokens[count][1] = e;
         }
-
-        /* Ignore the rest of the line */
-        ignoreLine(*_file->in);
+        ++count;
+        begin = e;
     }
 
-    /* Set end of the last object */
-    _file->in->clear();
-    _file->in->seekg(0, std::ios::end);
-    std::get<1>(_file->meshes.back()) = _file->in->tellg();
-}
+    if(count < size || count > size + (extra ? 1 : 0))
+        return "invalid float array size";
 
-UnsignedInt ObjImporter::doMesh3DCount() const { return _file->meshes.size(); }
+    for(std::size_t i = 0; i != count; ++i)
+        if(!parseFloat(tokens[i][0], tokens[i][1], i == size ? *extra : output[i]))
+            return "error while converting numeric data";
 
-Int ObjImporter::doMesh3DForName(const std::string& name) {
-    const auto it = _file->meshesForName.find(name);
-    return it == _file->meshesForName.end() ? -1 : it->second;
+    return nullptr;
 }
 
-std::string ObjImporter::doMesh3DName(UnsignedInt id) {
-    return _file->meshNames[id];
+template<class T> bool reindex(const std::vector<UnsignedInt>& indices, std::vector<T>& data) {
+    /* Check that indices are in range */
+    for(UnsignedInt i: indices) if(i >= data.size()) return false;
+
+    data = MeshTools::duplicate(indices, data);
+    return true;
 }
 
-std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
-    /* Seek the file, set mesh parsing parameters */
-    std::streampos begin, end;
-    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
-    std::tie(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset) = _file->meshes[id];
-    _file->in->seekg(begin);
+/* Smallest chunk of a mesh that is worth parsing on a separate thread */
+constexpr std::size_t MinChunkSize = 64*1024;
 
+/* Data parsed from a line-aligned part of a mesh */
+struct Chunk {
     std::optional<MeshPrimitive> primitive;
+
+    /* First line with index data, used to order errors across chunks */
+    const char* primitivePosition{};
+
     std::vector<Vector3> positions;
-    std::vector<std::vector<Vector2>> textureCoordinates;
-    std::vector<std::vector<Vector3>> normals;
+    std::vector<Vector2> textureCoordinates;
+    std::vector<Vector3> normals;
     std::vector<UnsignedInt> positionIndices;
     std::vector<UnsignedInt> textureCoordinateIndices;
     std::vector<UnsignedInt> normalIndices;
 
-    try { while(_file->in->good() && _file->in->tellg() < end) {
-        /* Ignore comments */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
+    ParseError error;
+};
+
+/* Parses given range of lines. Returns false and fills the error on failure. */
+bool parseChunk(const char* line, const char* const end, const MeshInfo& mesh, Chunk& chunk) {
+    while(line < end) {
+        const char* lineE = lineEnd(line, end);
+        const char* const next = lineE == end ? end : lineE + 1;
+
+        /* Trim the line, ignore empty lines and comments */
+        line = skipSpaces(line, lineE);
+        while(lineE != line && isSpace(*(lineE - 1))) --lineE;
+        if(line == lineE || *line == '#') {
+            line = next;
             continue;
         }
 
-        /* Get the line */
-        std::string line;
-        std::getline(*_file->in, line);
-        line = Utility::String::trim(line);
-
-        /* Ignore empty lines */
-        if(line.empty()) continue;
-
         /* Split the line into keyword and contents */
-        const std::size_t keywordEnd = line.find(' ');
-        const std::string keyword = line.substr(0, keywordEnd);
-        const std::string contents = keywordEnd != std::string::npos ?
-            Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
+        const char* const keywordE = tokenEnd(line, lineE);
+        const char* const contents = skipSpaces(keywordE, lineE);
+        ParseError& error = chunk.error;
+        error.position = line;
 
         /* Vertex position */
-        if(keyword == "v") {
+        if(equals(line, keywordE, "v")) {
             Float extra{1.0f};
-            const Vector3 data = extractFloatData<3>(contents, &extra);
+            Vector3 position;
+            if((error.message = extractFloatData<3>(contents, lineE, position, &extra)))
+                return false;
             if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
-                Error() << "Trade::ObjImporter::mesh3D(): homogeneous coordinates are not supported";
-                return std::nullopt;
+                error.message = "homogeneous coordinates are not supported";
+                return false;
             }
 
-            positions.push_back(data);
+            chunk.positions.push_back(position);
 
         /* Texture coordinate */
-        } else if(keyword == "vt") {
+        } else if(equals(line, keywordE, "vt")) {
             Float extra{0.0f};
-            const auto data = extractFloatData<2>(contents, &extra);
+            Vector2 textureCoordinate;
+            if((error.message = extractFloatData<2>(contents, lineE, textureCoordinate, &extra)))
+                return false;
             if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
-                Error() << "Trade::ObjImporter::mesh3D(): 3D texture coordinates are not supported";
-                return std::nullopt;
+                error.message = "3D texture coordinates are not supported";
+                return false;
             }
 
-            if(textureCoordinates.empty()) textureCoordinates.push_back({});
-            textureCoordinates.front().push_back(data);
+            chunk.textureCoordinates.push_back(textureCoordinate);
 
         /* Normal */
-        } else if(keyword == "vn") {
-            if(normals.empty()) normals.push_back({});
-            normals.front().push_back(extractFloatData<3>(contents));
+        } else if(equals(line, keywordE, "vn")) {
+            Vector3 normal;
+            if((error.message = extractFloatData<3>(contents, lineE, normal)))
+                return false;
 
-        /* Indices */
-        } else if(keyword == "p" || keyword == "l" || keyword == "f") {
-            const std::vector<std::string> indexTuples = Utility::String::splitWithoutEmptyParts(contents, ' ');
-
-            /* Points */
-            if(keyword == "p") {
-                /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Points) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Points;
-                    return std::nullopt;
-                }
-
-                /* Check vertex count per primitive */
-                if(indexTuples.size() != 1) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for point";
-                    return std::nullopt;
-                }
+            chunk.normals.push_back(normal);
 
+        /* Indices */
+        } else if(equals(line, keywordE, "p") || equals(line, keywordE, "l") || equals(line, keywordE, "f")) {
+            /* Count the index tuples */
+            std::size_t tupleCount = 0;
+            for(const char* t = contents; t != lineE; t = skipSpaces(tokenEnd(t, lineE), lineE))
+                ++tupleCount;
+
+            MeshPrimitive primitive;
+            std::size_t expectedTupleCount;
+            const char* wrongCountMessage;
+            if(*line == 'p') {
                 primitive = MeshPrimitive::Points;
-
-            /* Lines */
-            } else if(keyword == "l") {
-                /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Lines) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Lines;
-                    return std::nullopt;
-                }
-
-                /* Check vertex count per primitive */
-                if(indexTuples.size() != 2) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for line";
-                    return std::nullopt;
-                }
-
+                expectedTupleCount = 1;
+                wrongCountMessage = "wrong index count for point";
+            } else if(*line == 'l') {
                 primitive = MeshPrimitive::Lines;
+                expectedTupleCount = 2;
+                wrongCountMessage = "wrong index count for line";
+            } else {
+                primitive = MeshPrimitive::Triangles;
+                expectedTupleCount = 3;
+                wrongCountMessage = "wrong index count for triangle";
+            }
 
-            /* Faces */
-            } else if(keyword == "f") {
-                /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Triangles) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Triangles;
-                    return std::nullopt;
-                }
-
-                /* Check vertex count per primitive */
-                if(indexTuples.size() < 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for triangle";
-                    return std::nullopt;
-                } else if(indexTuples.size() != 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): polygons are not supported";
-                    return std::nullopt;
-                }
+            /* Check that we don't mix the primitives in one mesh */
+            if(chunk.primitive && *chunk.primitive != primitive) {
+                error.message = "mixed primitive";
+                error.mixedPrimitives = true;
+                error.primitive = *chunk.primitive;
+                error.otherPrimitive = primitive;
+                return false;
+            }
 
-                primitive = MeshPrimitive::Triangles;
+            /* Check vertex count per primitive */
+            if(tupleCount < expectedTupleCount || (tupleCount > expectedTupleCount && primitive != MeshPrimitive::Triangles)) {
+                error.message = wrongCountMessage;
+                return false;
+            } else if(tupleCount != expectedTupleCount) {
+                error.message = "polygons are not supported";
+                return false;
+            }
 
-            } else CORRADE_ASSERT_UNREACHABLE();
+            if(!chunk.primitive) {
+                chunk.primitive = primitive;
+                chunk.primitivePosition = line;
+            }
 
-            for(const std::string& indexTuple: indexTuples) {
-                std::vector<std::string> indices = Utility::String::split(indexTuple, '/');
-                if(indices.size() > 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): invalid index data";
-                    return std::nullopt;
+            for(const char* tuple = contents; tuple != lineE; ) {
+                const char* const tupleE = tokenEnd(tuple, lineE);
+
+                /* Split the tuple by slashes */
+                const char* parts[3][2];
+                std::size_t partCount = 0;
+                for(const char* part = tuple; ; ++partCount) {
+                    const char* partE = part;
+                    while(partE != tupleE && *partE != '/') ++partE;
+                    if(partCount < 3) {
+                        parts[partCount][0] = part;
+                        parts[partCount][1] = partE;
+                    }
+                    if(partE == tupleE) break;
+                    part = partE + 1;
+                }
+                ++partCount;
+                if(partCount > 3) {
+                    error.message = "invalid index data";
+                    return false;
                 }
 
                 /* Position indices */
-                #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-                positionIndices.push_back(std::stoul(indices[0]) - positionIndexOffset);
-                #else
-                std::istringstream in(indices[0]);
                 UnsignedInt index;
-                in >> index;
-                positionIndices.push_back(index - positionIndexOffset);
-                #endif
+                if(!parseIndex(parts[0][0], parts[0][1], index)) {
+                    error.message = "error while converting numeric data";
+                    return false;
+                }
+                chunk.positionIndices.push_back(index - mesh.positionIndexOffset);
 
                 /* Texture coordinates */
-                if(indices.size() == 2 || (indices.size() == 3 && !indices[1].empty())) {
-                    #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-                    textureCoordinateIndices.push_back(std::stoul(indices[1]) - textureCoordinateIndexOffset);
-                    #else
-                    in.str(indices[1]);
-                    in >> index;
-                    textureCoordinateIndices.push_back(index - textureCoordinateIndexOffset);
-                    #endif
+                if(partCount == 2 || (partCount == 3 && parts[1][0] != parts[1][1])) {
+                    if(!parseIndex(parts[1][0], parts[1][1], index)) {
+                        error.message = "error while converting numeric data";
+                        return false;
+                    }
+                    chunk.textureCoordinateIndices.push_back(index - mesh.textureCoordinateIndexOffset);
                 }
 
                 /* Normal indices */
-                if(indices.size() == 3) {
-                    #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-                    normalIndices.push_back(std::stoul(indices[2]) - normalIndexOffset);
-                    #else
-                    in.str(indices[2]);
-                    in >> index;
-                    normalIndices.push_back(index - normalIndexOffset);
-                    #endif
+                if(partCount == 3) {
+                    if(!parseIndex(parts[2][0], parts[2][1], index)) {
+                        error.message = "error while converting numeric data";
+                        return false;
+                    }
+                    chunk.normalIndices.push_back(index - mesh.normalIndexOffset);
                 }
+
+                tuple = skipSpaces(tupleE, lineE);
             }
 
         /* Ignore unsupported keywords, error out on unknown keywords */
-        } else if(![&keyword](){
+        } else if(![&line, &keywordE](){
             /* Using lambda to emulate for-else construct like in Python */
-            for(const std::string expected: {"mtllib", "usemtl", "g", "s"})
-                if(keyword == expected) return true;
+            for(const char* expected: {"mtllib", "usemtl", "g", "s"})
+                if(equals(line, keywordE, expected)) return true;
             return false;
         }()) {
-            Error() << "Trade::ObjImporter::mesh3D(): unknown keyword" << keyword;
+            error.message = "unknown keyword";
+            error.keywordBegin = line;
+            error.keywordEnd = keywordE;
+            return false;
+        }
+
+        line = next;
+    }
+
+    chunk.error.position = nullptr;
+    return true;
+}
+
+template<class T> void append(std::vector<T>& destination, std::vector<T>& source) {
+    if(destination.empty()) destination = std::move(source);
+    else destination.insert(destination.end(), source.begin(), source.end());
+}
+
+/* Parses whole mesh, possibly splitting it into line-aligned chunks parsed in
+   parallel. Doesn't touch any shared state, so it's safe to call it from
+   multiple threads at once. */
+std::optional<MeshData3D> parseMesh(const char* const data, const MeshInfo& mesh, const UnsignedInt threadCount, ParseError& error) {
+    const char* const begin = data + mesh.begin;
+    const char* const end = data + mesh.end;
+
+    /* Split the mesh into chunks ending at line boundaries */
+    const std::size_t size = mesh.begin < mesh.end ? mesh.end - mesh.begin : 0;
+    const UnsignedInt chunkCount = std::max(1u, std::min(threadCount, UnsignedInt(size/MinChunkSize)));
+    std::vector<const char*> boundaries(chunkCount + 1);
+    boundaries[0] = begin;
+    for(UnsignedInt i = 1; i != chunkCount; ++i) {
+        const char* boundary = std::max(begin + size*i/chunkCount, boundaries[i - 1]);
+        if(boundary != end) boundary = lineEnd(boundary, end);
+        boundaries[i] = boundary == end ? end : boundary + 1;
+    }
+    boundaries[chunkCount] = end;
+
+    /* Parse the chunks, reserve memory based on the counts from initial
+       scan */
+    std::vector<Chunk> chunks(chunkCount);
+    std::vector<char> succeeded(chunkCount);
+    TaskScheduler::global().parallelFor(chunkCount, 1, [&](const std::size_t first, const std::size_t last) {
+        for(std::size_t i = first; i != last; ++i) {
+            Chunk& chunk = chunks[i];
+            chunk.positions.reserve(mesh.positionCount/chunkCount);
+            chunk.textureCoordinates.reserve(mesh.textureCoordinateCount/chunkCount);
+            chunk.normals.reserve(mesh.normalCount/chunkCount);
+            chunk.positionIndices.reserve(mesh.indexCount/chunkCount);
+            if(mesh.textureCoordinateCount)
+                chunk.textureCoordinateIndices.reserve(mesh.indexCount/chunkCount);
+            if(mesh.normalCount)
+                chunk.normalIndices.reserve(mesh.indexCount/chunkCount);
+            succeeded[i] = parseChunk(boundaries[i], boundaries[i + 1], mesh, chunk);
+        }
+    });
+
+    /* Concatenate the chunks in order, report the first error in the file */
+    std::optional<MeshPrimitive> primitive;
+    std::vector<Vector3> positions;
+    std::vector<Vector2> textureCoordinates;
+    std::vector<Vector3> normals;
+    std::vector<UnsignedInt> positionIndices;
+    std::vector<UnsignedInt> textureCoordinateIndices;
+    std::vector<UnsignedInt> normalIndices;
+    for(UnsignedInt i = 0; i != chunkCount; ++i) {
+        Chunk& chunk = chunks[i];
+
+        /* Primitive different from the previous chunks, unless the chunk
+           failed even before its first index data */
+        if(primitive && chunk.primitive && *primitive != *chunk.primitive && (succeeded[i] || chunk.primitivePosition <= chunk.error.position)) {
+            error.message = "mixed primitive";
+            error.mixedPrimitives = true;
+            error.primitive = *primitive;
+            error.otherPrimitive = *chunk.primitive;
             return std::nullopt;
         }
 
-    }} catch(std::exception) {
-        Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
-        return std::nullopt;
-    } catch(...) {
-        /* Error message already printed */
-        return std::nullopt;
+        if(!succeeded[i]) {
+            error = chunk.error;
+            return std::nullopt;
+        }
+
+        if(!primitive) primitive = chunk.primitive;
+        append(positions, chunk.positions);
+        append(textureCoordinates, chunk.textureCoordinates);
+        append(normals, chunk.normals);
+        append(positionIndices, chunk.positionIndices);
+        append(textureCoordinateIndices, chunk.textureCoordinateIndices);
+        append(normalIndices, chunk.normalIndices);
     }
 
     /* There should be at least indexed position data */
     if(positions.empty() || positionIndices.empty()) {
-        Error() << "Trade::ObjImporter::mesh3D(): incomplete position data";
+        error.message = "incomplete position data";
         return std::nullopt;
     }
 
     /* If there are index data, there should be also vertex data (and also the other way) */
     if(normals.empty() != normalIndices.empty()) {
-        Error() << "Trade::ObjImporter::mesh3D(): incomplete normal data";
+        error.message = "incomplete normal data";
         return std::nullopt;
     }
     if(textureCoordinates.empty() != textureCoordinateIndices.empty()) {
-        Error() << "Trade::ObjImporter::mesh3D(): incomplete texture coordinate data";
+        error.message = "incomplete texture coordinate data";
         return std::nullopt;
     }
 
     /* All index arrays should have the same length */
     if(!normalIndices.empty() && normalIndices.size() != positionIndices.size()) {
         CORRADE_INTERNAL_ASSERT(normalIndices.size() < positionIndices.size());
-        Error() << "Trade::ObjImporter::mesh3D(): some normal indices are missing";
+        error.message = "some normal indices are missing";
         return std::nullopt;
     }
     if(!textureCoordinates.empty() && textureCoordinateIndices.size() != positionIndices.size()) {
         CORRADE_INTERNAL_ASSERT(textureCoordinateIndices.size() < positionIndices.size());
-        Error() << "Trade::ObjImporter::mesh3D(): some texture coordinate indices are missing";
+        error.message = "some texture coordinate indices are missing";
         return std::nullopt;
     }
 
@@ -460,15 +524,13 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
         arrays.push_back(positionIndices);
         if(!normalIndices.empty()) arrays.push_back(normalIndices);
         if(!textureCoordinateIndices.empty()) arrays.push_back(textureCoordinateIndices);
-        indices = MeshTools::combineIndexArrays(arrays);
+        indices = MeshTools::combineIndexArrays(arrays, threadCount);
 
         /* Reindex data arrays */
-        try {
-            reindex(positionIndices, positions);
-            if(!normalIndices.empty()) reindex(normalIndices, normals.front());
-            if(!textureCoordinateIndices.empty()) reindex(textureCoordinateIndices, textureCoordinates.front());
-        } catch(...) {
-            /* Error message already printed */
+        if(!reindex(positionIndices, positions) ||
+           (!normalIndices.empty() && !reindex(normalIndices, normals)) ||
+           (!textureCoordinateIndices.empty() && !reindex(textureCoordinateIndices, textureCoordinates))) {
+            error.message = "index out of range";
             return std::nullopt;
         }
 
@@ -477,12 +539,198 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
     } else {
         indices = std::move(positionIndices);
         for(UnsignedInt i: indices) if(i >= positions.size()) {
-            Error() << "Trade::ObjImporter::mesh3D(): index out of range";
+            error.message = "index out of range";
             return std::nullopt;
         }
     }
 
-    return MeshData3D(*primitive, std::move(indices), {std::move(positions)}, std::move(normals), std::move(textureCoordinates));
+    std::vector<std::vector<Vector3>> normalArrays;
+    if(!normals.empty()) normalArrays.push_back(std::move(normals));
+    std::vector<std::vector<Vector2>> textureCoordinateArrays;
+    if(!textureCoordinates.empty()) textureCoordinateArrays.push_back(std::move(textureCoordinates));
+    return MeshData3D(*primitive, std::move(indices), {std::move(positions)}, std::move(normalArrays), std::move(textureCoordinateArrays));
+}
+
+}
+
+
+ObjImporter::ObjImporter() = default;
+
+ObjImporter::ObjImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)) {}
+
+ObjImporter::~ObjImporter() = default;
+
+auto ObjImporter::doFeatures() const -> Features { return Feature::OpenData; }
+
+void ObjImporter::doClose() { _file.reset(); }
+
+bool ObjImporter::doIsOpened() const { return !!_file; }
+
+void ObjImporter::doOpenData(const Containers::ArrayReference<const char> data, const DataFlags flags) {
+    _file.reset(new File);
+
+    /* Memory-mapped files from openFile() are kept around until close(), use
+       them directly. Otherwise the data are not guaranteed to be kept in
+       scope, copy them. */
+    if(flags & DataFlag::Persistent) _file->data = data;
+    else {
+        _file->ownedData = Containers::Array<char>(data.size());
+        std::copy(data.begin(), data.end(), _file->ownedData.begin());
+        _file->data = {_file->ownedData.begin(), _file->ownedData.size()};
+    }
+
+    parseMeshNames();
+}
+
+void ObjImporter::parseMeshNames() {
+    const char* const data = _file->data.begin();
+    const char* const end = _file->data.end();
+
+    /* First mesh starts at the beginning, its indices start from 1. The end
+       offset and counts will be updated to proper value later. */
+    UnsignedInt positionIndexOffset = 1;
+    UnsignedInt normalIndexOffset = 1;
+    UnsignedInt textureCoordinateIndexOffset = 1;
+    std::size_t indexCount = 0;
+    _file->meshes.push_back({0, 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0, 0, 0, 0});
+
+    /* Fill the counts of the last mesh and set its end */
+    auto finishMesh = [&](const std::size_t meshEnd) {
+        MeshInfo& mesh = _file->meshes.back();
+        mesh.end = meshEnd;
+        mesh.positionCount = positionIndexOffset - mesh.positionIndexOffset;
+        mesh.textureCoordinateCount = textureCoordinateIndexOffset - mesh.textureCoordinateIndexOffset;
+        mesh.normalCount = normalIndexOffset - mesh.normalIndexOffset;
+        mesh.indexCount = indexCount;
+        indexCount = 0;
+    };
+
+    /* The first mesh doesn't have name by default but we might find it later,
+       so we need to track whether there are any data before first name */
+    bool thisIsFirstMeshAndItHasNoData = true;
+    _file->meshNames.emplace_back();
+
+    for(const char* line = data; line != end; ) {
+        const char* const lineE = lineEnd(line, end);
+        const char* const next = lineE == end ? end : lineE + 1;
+
+        /* Parse the keyword, ignore comments and empty lines */
+        const char* const keyword = skipSpaces(line, lineE);
+        const char* const keywordE = tokenEnd(keyword, lineE);
+        if(keyword == keywordE || *keyword == '#') {
+            line = next;
+            continue;
+        }
+
+        /* Mesh name */
+        if(equals(keyword, keywordE, "o")) {
+            const char* const nameBegin = skipSpaces(keywordE, lineE);
+            const char* nameEnd = lineE;
+            while(nameEnd != nameBegin && isSpace(*(nameEnd - 1))) --nameEnd;
+            std::string name{nameBegin, nameEnd};
+
+            /* This is the name of first mesh */
+            if(thisIsFirstMeshAndItHasNoData) {
+                thisIsFirstMeshAndItHasNoData = false;
+
+                /* Update its name and add it to name map */
+                if(!name.empty())
+                    _file->meshesForName.emplace(name, _file->meshes.size() - 1);
+                _file->meshNames.back() = std::move(name);
+
+                /* Update its begin offset to be more precise */
+                _file->meshes.back().begin = next - data;
+
+            /* Otherwise this is a name of new mesh */
+            } else {
+                /* Set end of the previous one */
+                finishMesh(line - data);
+
+                /* Save name and offset of the new one. The end offset will be
+                   updated later. */
+                if(!name.empty())
+                    _file->meshesForName.emplace(name, _file->meshes.size());
+                _file->meshNames.emplace_back(std::move(name));
+                _file->meshes.push_back({std::size_t(next - data), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0, 0, 0, 0});
+            }
+
+        /* If there are any data/indices before the first name, it means that
+           the first object is unnamed. We need to check for them. */
+
+        /* Vertex data, update index offset for the following meshes */
+        } else if(equals(keyword, keywordE, "v")) {
+            ++positionIndexOffset;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(equals(keyword, keywordE, "vt")) {
+            ++textureCoordinateIndexOffset;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(equals(keyword, keywordE, "vn")) {
+            ++normalIndexOffset;
+            thisIsFirstMeshAndItHasNoData = false;
+
+        /* Index data, just mark that we found something for first unnamed
+           object and estimate the index count */
+        } else if(equals(keyword, keywordE, "p")) {
+            indexCount += 1;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(equals(keyword, keywordE, "l")) {
+            indexCount += 2;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(equals(keyword, keywordE, "f")) {
+            indexCount += 3;
+            thisIsFirstMeshAndItHasNoData = false;
+        }
+
+        line = next;
+    }
+
+    /* Set end of the last object */
+    finishMesh(end - data);
+}
+
+UnsignedInt ObjImporter::doMesh3DCount() const { return _file->meshes.size(); }
+
+Int ObjImporter::doMesh3DForName(const std::string& name) {
+    const auto it = _file->meshesForName.find(name);
+    return it == _file->meshesForName.end() ? -1 : it->second;
+}
+
+std::string ObjImporter::doMesh3DName(UnsignedInt id) {
+    return _file->meshNames[id];
+}
+
+ObjImporter& ObjImporter::setThreadCount(const UnsignedInt count) {
+    CORRADE_ASSERT(count, "Trade::ObjImporter::setThreadCount(): expected at least one thread", *this);
+    _threadCount = count;
+    return *this;
+}
+
+std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
+    ParseError error;
+    std::optional<MeshData3D> mesh = parseMesh(_file->data.begin(), _file->meshes[id], _threadCount, error);
+    if(!mesh) printError(error);
+    return mesh;
+}
+
+std::vector<std::optional<MeshData3D>> ObjImporter::meshes3D() {
+    CORRADE_ASSERT(_file, "Trade::ObjImporter::meshes3D(): no file opened", {});
+
+    /* Parse distinct meshes in parallel. If there is less meshes than
+       threads, the meshes are additionally split into chunks. */
+    const UnsignedInt meshCount = _file->meshes.size();
+    const UnsignedInt chunkThreadCount = std::max(1u, _threadCount/std::max(meshCount, 1u));
+    std::vector<std::optional<MeshData3D>> meshes(meshCount);
+    std::vector<ParseError> errors(meshCount);
+    TaskScheduler::global().parallelFor(meshCount, _threadCount > 1 ? 1 : meshCount, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t id = begin; id != end; ++id)
+            meshes[id] = parseMesh(_file->data.begin(), _file->meshes[id], chunkThreadCount, errors[id]);
+    });
+
+    /* Print the errors in mesh order */
+    for(UnsignedInt id = 0; id != meshCount; ++id)
+        if(!meshes[id]) printError(errors[id]);
+
+    return meshes;
 }
 
 }}
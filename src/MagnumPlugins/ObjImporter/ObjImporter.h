@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Trade::ObjImporter
  */
 
+#include <vector>
+
 #include "Magnum/Trade/AbstractImporter.h"
 
 namespace Magnum { namespace Trade {
@@ -44,6 +46,15 @@ Supported features:
 Polygons (quads etc.), automatic normal generation and material properties are
 currently not supported.
 
+The file is memory-mapped (or copied to memory, if opened from data) and the
+importer doesn't modify any internal state when importing the meshes, so
+@ref mesh3D() can be safely called from multiple threads at once. Setting
+@ref setThreadCount() to more than `1` makes the importer split large meshes
+into line-aligned chunks parsed in parallel, @ref meshes3D() additionally
+parses distinct meshes in parallel. The work is executed on
+@ref TaskScheduler::global(), which needs to have more than one thread for
+the parsing to be actually parallel.
+
 This plugin is built if `WITH_OBJIMPORTER` is enabled when building Magnum. To
 use dynamic plugin, you need to load `ObjImporter` plugin from
 `MAGNUM_PLUGINS_IMPORTER_DIR`. To use static plugin or use this as a dependency
@@ -61,14 +72,41 @@ class ObjImporter: public AbstractImporter {
 
         ~ObjImporter();
 
+        /** @brief Count of threads used for parsing */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set count of threads used for parsing
+         * @return Reference to self (for method chaining)
+         *
+         * If larger than `1`, meshes larger than some implementation-defined
+         * size are split into at most @p count line-aligned chunks which are
+         * parsed in parallel on @ref TaskScheduler::global() and then
+         * concatenated, so the actual parallelism is limited also by thread
+         * count of the scheduler. The result and printed errors are the same
+         * regardless of thread count. Expects that @p count is not zero.
+         * Default is `1`.
+         */
+        ObjImporter& setThreadCount(UnsignedInt count);
+
+        /**
+         * @brief Import all meshes
+         *
+         * Equivalent to calling @ref mesh3D() for all meshes in the file, but
+         * if @ref threadCount() is larger than `1`, parses the meshes in
+         * parallel on @ref TaskScheduler::global(). If there is less meshes
+         * than threads, the meshes are additionally split into chunks. Errors are printed in mesh order after
+         * all the meshes are parsed. Expects that a file is opened.
+         */
+        std::vector<std::optional<MeshData3D>> meshes3D();
+
     private:
         struct File;
 
         Features doFeatures() const override;
 
         bool doIsOpened() const override;
-        void doOpenData(Containers::ArrayReference<const char> data) override;
-        void doOpenFile(const std::string& filename) override;
+        void doOpenData(Containers::ArrayReference<const char> data, DataFlags flags) override;
         void doClose() override;
 
         UnsignedInt doMesh3DCount() const override;
@@ -79,6 +117,7 @@ class ObjImporter: public AbstractImporter {
         void parseMeshNames();
 
         std::unique_ptr<File> _file;
+        UnsignedInt _threadCount{1};
 };
 
 }}
@@ -29,6 +29,7 @@
 
 #include "Magnum/Mesh.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/TaskScheduler.h"
 #include "Magnum/Trade/MeshData3D.h"
 #include "MagnumPlugins/ObjImporter/ObjImporter.h"
 
@@ -36,6 +37,35 @@
 
 namespace Magnum { namespace Trade { namespace Test {
 
+namespace {
+    /* Grid large enough to be split into several chunks */
+    std::string grid(const bool pointAtTheEnd = false) {
+        std::ostringstream out;
+        out << "o grid\n";
+        for(Int y = 0; y != 64; ++y) for(Int x = 0; x != 64; ++x)
+            out << "v " << x << " " << y << " 0.25\nvt " << x/64.0f << " " << y/64.0f << "\nvn 0 0 1\n";
+        for(Int y = 0; y != 63; ++y) for(Int x = 0; x != 63; ++x) {
+            const Int i = y*64 + x + 1;
+            out << "f " << i << "/" << i << "/1 " << i + 1 << "/" << i + 1 << "/1 " << i + 64 << "/" << i + 64 << "/1\n";
+            if(pointAtTheEnd && x == 62 && y == 62) out << "p " << i + 1 << "/" << i + 1 << "/1\n";
+            else out << "f " << i + 1 << "/" << i + 1 << "/1 " << i + 65 << "/" << i + 65 << "/1 " << i + 64 << "/" << i + 64 << "/1\n";
+        }
+        return out.str();
+    }
+
+    /* Makes a scheduler with worker threads global for the lifetime of the
+       instance, so the parsing actually runs in parallel */
+    struct GlobalScheduler {
+        explicit GlobalScheduler(UnsignedInt threadCount): scheduler{threadCount} {
+            TaskScheduler::setGlobal(&scheduler);
+        }
+
+        ~GlobalScheduler() { TaskScheduler::setGlobal(nullptr); }
+
+        TaskScheduler scheduler;
+    };
+}
+
 class ObjImporterTest: public TestSuite::Tester {
     public:
         explicit ObjImporterTest();
@@ -89,6 +119,13 @@ class ObjImporterTest: public TestSuite::Tester {
 
         void unsupportedKeyword();
         void unknownKeyword();
+
+        void openData();
+        void crlfLineEndings();
+
+        void threadedChunks();
+        void threadedChunksMixedPrimitives();
+        void threadedMeshes();
 };
 
 ObjImporterTest::ObjImporterTest() {
@@ -139,7 +176,14 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::wrongNormalIndexCount,
 
               &ObjImporterTest::unsupportedKeyword,
-              &ObjImporterTest::unknownKeyword});
+              &ObjImporterTest::unknownKeyword,
+
+              &ObjImporterTest::openData,
+              &ObjImporterTest::crlfLineEndings,
+
+              &ObjImporterTest::threadedChunks,
+              &ObjImporterTest::threadedChunksMixedPrimitives,
+              &ObjImporterTest::threadedMeshes});
 }
 
 void ObjImporterTest::pointMesh() {
@@ -732,6 +776,105 @@ void ObjImporterTest::unknownKeyword() {
     CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh3D(): unknown keyword bleh\n");
 }
 
+void ObjImporterTest::openData() {
+    const char data[] = "o mesh\nv 1 2 3\nv 4 5 6\nl 1 2\n";
+
+    /* The data should be copied, so it's fine to destroy them after */
+    ObjImporter importer;
+    {
+        std::string copy{data};
+        CORRADE_VERIFY(importer.openData({copy.data(), copy.size()}));
+    }
+    CORRADE_COMPARE(importer.mesh3DCount(), 1);
+    CORRADE_COMPARE(importer.mesh3DName(0), "mesh");
+
+    const std::optional<MeshData3D> meshData = importer.mesh3D(0);
+    CORRADE_VERIFY(meshData);
+    CORRADE_COMPARE(meshData->primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE(meshData->positions(0), (std::vector<Vector3>{
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, 6.0f}
+    }));
+    CORRADE_COMPARE(meshData->indices(), (std::vector<UnsignedInt>{0, 1}));
+}
+
+void ObjImporterTest::crlfLineEndings() {
+    const char data[] = "o first\r\nv 1 2 3\r\np 1\r\no second \r\nvt 0.5 1.0\r\nv 4 5 6\r\np 2/1\r\n";
+
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.openData({data, sizeof(data) - 1}));
+    CORRADE_COMPARE(importer.mesh3DCount(), 2);
+    CORRADE_COMPARE(importer.mesh3DForName("second"), 1);
+
+    const std::optional<MeshData3D> meshData = importer.mesh3D(1);
+    CORRADE_VERIFY(meshData);
+    CORRADE_COMPARE(meshData->positions(0), (std::vector<Vector3>{
+        {4.0f, 5.0f, 6.0f}
+    }));
+    CORRADE_VERIFY(meshData->hasTextureCoords2D());
+    CORRADE_COMPARE(meshData->textureCoords2D(0), (std::vector<Vector2>{
+        {0.5f, 1.0f}
+    }));
+}
+
+void ObjImporterTest::threadedChunks() {
+    GlobalScheduler scheduler{4};
+    const std::string data = grid();
+
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.openData({data.data(), data.size()}));
+    const std::optional<MeshData3D> expected = importer.mesh3D(0);
+    CORRADE_VERIFY(expected);
+    CORRADE_COMPARE(expected->indices().size(), 63*63*6);
+
+    importer.setThreadCount(4);
+    CORRADE_COMPARE(importer.threadCount(), 4);
+    const std::optional<MeshData3D> threaded = importer.mesh3D(0);
+    CORRADE_VERIFY(threaded);
+    CORRADE_COMPARE(threaded->primitive(), expected->primitive());
+    CORRADE_COMPARE(threaded->indices(), expected->indices());
+    CORRADE_COMPARE(threaded->positions(0), expected->positions(0));
+    CORRADE_COMPARE(threaded->normals(0), expected->normals(0));
+    CORRADE_COMPARE(threaded->textureCoords2D(0), expected->textureCoords2D(0));
+}
+
+void ObjImporterTest::threadedChunksMixedPrimitives() {
+    /* The point is in the last chunk, the error should be the same as when
+       parsing on a single thread */
+    GlobalScheduler scheduler{4};
+    const std::string data = grid(true);
+
+    ObjImporter importer;
+    importer.setThreadCount(4);
+    CORRADE_VERIFY(importer.openData({data.data(), data.size()}));
+
+    std::ostringstream out;
+    Error::setOutput(&out);
+    CORRADE_VERIFY(!importer.mesh3D(0));
+    CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh3D(): mixed primitive MeshPrimitive::Triangles and MeshPrimitive::Points\n");
+}
+
+void ObjImporterTest::threadedMeshes() {
+    GlobalScheduler scheduler{3};
+
+    ObjImporter importer;
+    importer.setThreadCount(3);
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "moreMeshes.obj")));
+
+    const std::vector<std::optional<MeshData3D>> meshes = importer.meshes3D();
+    CORRADE_COMPARE(meshes.size(), 3);
+    for(UnsignedInt i = 0; i != meshes.size(); ++i) {
+        const std::optional<MeshData3D> expected = importer.mesh3D(i);
+        CORRADE_VERIFY(expected);
+        CORRADE_VERIFY(meshes[i]);
+        CORRADE_COMPARE(meshes[i]->primitive(), expected->primitive());
+        CORRADE_COMPARE(meshes[i]->indices(), expected->indices());
+        CORRADE_COMPARE(meshes[i]->positions(0), expected->positions(0));
+        CORRADE_COMPARE(meshes[i]->hasNormals(), expected->hasNormals());
+        CORRADE_COMPARE(meshes[i]->hasTextureCoords2D(), expected->hasTextureCoords2D());
+    }
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjImporterTest)
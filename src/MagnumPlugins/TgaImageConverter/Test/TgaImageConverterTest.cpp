@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
 #include <sstream>
 #include <tuple>
 #include <Corrade/Containers/Array.h>
@@ -47,6 +48,12 @@ class TgaImageConverterTest: public TestSuite::Tester {
         void wrongType();
 
         void data();
+        void dataInto();
+
+        void rle();
+        void rleDataInto();
+        void stream();
+        void file();
 };
 
 namespace {
@@ -61,13 +68,31 @@ namespace {
     #else
     const ImageReference2D original(ColorFormat::RGB, ColorType::UnsignedByte, {2, 3}, originalData);
     #endif
+
+    /* Runs, raw pixels and repeated pixels spanning the row boundary */
+    constexpr char repeatingData[] = {
+        1, 2, 3, 4, 1, 2, 3, 4, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2,
+        9, 0, 1, 2, 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 7, 8, 9, 0
+    };
+
+    #ifndef MAGNUM_TARGET_GLES
+    const ImageReference2D repeating(ColorFormat::BGRA, ColorType::UnsignedByte, {5, 2}, repeatingData);
+    #else
+    const ImageReference2D repeating(ColorFormat::RGBA, ColorType::UnsignedByte, {5, 2}, repeatingData);
+    #endif
 }
 
 TgaImageConverterTest::TgaImageConverterTest() {
     addTests({&TgaImageConverterTest::wrongFormat,
               &TgaImageConverterTest::wrongType,
 
-              &TgaImageConverterTest::data});
+              &TgaImageConverterTest::data,
+              &TgaImageConverterTest::dataInto,
+
+              &TgaImageConverterTest::rle,
+              &TgaImageConverterTest::rleDataInto,
+              &TgaImageConverterTest::stream,
+              &TgaImageConverterTest::file});
 }
 
 void TgaImageConverterTest::wrongFormat() {
@@ -111,6 +136,109 @@ void TgaImageConverterTest::data() {
                     (std::string{original.data(), 2*3*3}));
 }
 
+void TgaImageConverterTest::dataInto() {
+    const auto data = TgaImageConverter().exportToData(original);
+
+    /* Should give the same output and reuse the buffer capacity */
+    std::vector<char> reused;
+    reused.reserve(1024);
+    const char* const previous = reused.data();
+    CORRADE_VERIFY(TgaImageConverter().exportToData(original, reused));
+    CORRADE_VERIFY(reused.data() == previous);
+    CORRADE_COMPARE((std::string{reused.data(), reused.size()}),
+                    (std::string{data.begin(), data.size()}));
+
+    /* Failed export shouldn't touch the buffer */
+    std::ostringstream out;
+    Error::setOutput(&out);
+    ImageReference2D image(ColorFormat::Red, ColorType::Float, {}, nullptr);
+    CORRADE_VERIFY(!TgaImageConverter().exportToData(image, reused));
+    CORRADE_COMPARE(reused.size(), data.size());
+}
+
+void TgaImageConverterTest::rle() {
+    const auto uncompressed = TgaImageConverter().exportToData(repeating);
+    const auto data = TgaImageConverter().setRleCompression(true).exportToData(repeating);
+
+    /* Header, run of 3, raw packet of 2, run of 2 (not crossing the row),
+       raw packet of 1, run of 2 */
+    CORRADE_COMPARE(data.size(), 18 + 5 + 9 + 5 + 5 + 5);
+    CORRADE_VERIFY(data.size() < uncompressed.size());
+
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+    std::optional<Trade::ImageData2D> converted = importer.image2D(0);
+    CORRADE_VERIFY(converted);
+
+    CORRADE_COMPARE(converted->size(), Vector2i(5, 2));
+    CORRADE_COMPARE(converted->format(), repeating.format());
+    CORRADE_COMPARE((std::string{converted->data(), 5*2*4}),
+                    (std::string{repeating.data(), 5*2*4}));
+
+    /* Grayscale image with a run longer than a single packet */
+    char grayscaleData[300*2];
+    std::fill_n(grayscaleData, 300, 7);
+    for(std::size_t i = 300; i != 600; ++i) grayscaleData[i] = char(i);
+    const ImageReference2D grayscale(ColorFormat::Red, ColorType::UnsignedByte, {300, 2}, grayscaleData);
+    CORRADE_VERIFY(importer.openData(TgaImageConverter().setRleCompression(true).exportToData(grayscale)));
+    converted = importer.image2D(0);
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->size(), Vector2i(300, 2));
+    CORRADE_COMPARE((std::string{converted->data(), 600}),
+                    (std::string{grayscaleData, 600}));
+}
+
+void TgaImageConverterTest::rleDataInto() {
+    TgaImageConverter converter;
+    converter.setRleCompression(true);
+    const auto data = converter.exportToData(repeating);
+
+    std::vector<char> reused;
+    reused.reserve(1024);
+    const char* const previous = reused.data();
+    CORRADE_VERIFY(converter.exportToData(repeating, reused));
+    CORRADE_VERIFY(reused.data() == previous);
+    CORRADE_COMPARE((std::string{reused.data(), reused.size()}),
+                    (std::string{data.begin(), data.size()}));
+}
+
+void TgaImageConverterTest::stream() {
+    TgaImageConverter converter;
+    for(bool rle: {false, true}) {
+        converter.setRleCompression(rle);
+        const auto data = converter.exportToData(repeating);
+
+        std::ostringstream out;
+        CORRADE_VERIFY(converter.exportToStream(repeating, out));
+        CORRADE_COMPARE(out.str(), (std::string{data.begin(), data.size()}));
+    }
+
+    /* Failed stream */
+    std::ostringstream out;
+    Error::setOutput(&out);
+    std::ostringstream failed;
+    failed.setstate(std::ios::badbit);
+    CORRADE_VERIFY(!converter.exportToStream(repeating, failed));
+    CORRADE_COMPARE(out.str(), "Trade::TgaImageConverter::exportToStream(): cannot write to the stream\n");
+}
+
+void TgaImageConverterTest::file() {
+    const std::string filename = Utility::Directory::join(TGAIMAGECONVERTER_TEST_DIR, "file.tga");
+    TgaImageConverter converter;
+    converter.setRleCompression(true);
+    CORRADE_VERIFY(converter.exportToFile(repeating, filename));
+
+    TgaImporter importer;
+    CORRADE_VERIFY(importer.openFile(filename));
+    std::optional<Trade::ImageData2D> converted = importer.image2D(0);
+    CORRADE_VERIFY(converted);
+    CORRADE_COMPARE(converted->size(), Vector2i(5, 2));
+    CORRADE_COMPARE((std::string{converted->data(), 5*2*4}),
+                    (std::string{repeating.data(), 5*2*4}));
+
+    Utility::Directory::rm(filename);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::TgaImageConverterTest)
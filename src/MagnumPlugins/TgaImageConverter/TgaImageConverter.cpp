@@ -25,8 +25,9 @@
 
 #include "TgaImageConverter.h"
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
-#include <tuple>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Endianness.h>
 
@@ -34,12 +35,6 @@
 #include "Magnum/Image.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
 
-#ifdef MAGNUM_TARGET_GLES
-#include <algorithm>
-#include "Magnum/Math/Swizzle.h"
-#include "Magnum/Math/Vector4.h"
-#endif
-
 namespace Magnum { namespace Trade {
 
 TgaImageConverter::TgaImageConverter() = default;
@@ -48,7 +43,54 @@ TgaImageConverter::TgaImageConverter(PluginManager::AbstractManager& manager, st
 
 auto TgaImageConverter::doFeatures() const -> Features { return Feature::ConvertData; }
 
-Containers::Array<char> TgaImageConverter::doExportToData(const ImageReference2D& image) const {
+TgaImageConverter& TgaImageConverter::setRleCompression(const bool enabled) {
+    _rle = enabled;
+    return *this;
+}
+
+namespace {
+
+/* In OpenGL ES RGB(A) is converted to BGR(A) while writing the pixels */
+#ifndef MAGNUM_TARGET_GLES
+constexpr bool Swizzle = false;
+#else
+constexpr bool Swizzle = true;
+#endif
+
+/* Size of the buffer in which the swizzled or compressed output is collected
+   before passing it further */
+constexpr std::size_t ChunkSize = 64*1024;
+
+template<std::size_t pixelSize, bool swizzle> struct Pixels {
+    static void copy(const char* const in, char* const out, const std::size_t count) {
+        std::memcpy(out, in, count*pixelSize);
+    }
+};
+
+template<> struct Pixels<3, true> {
+    static void copy(const char* const in, char* const out, const std::size_t count) {
+        for(std::size_t i = 0; i != count*3; i += 3) {
+            out[i + 0] = in[i + 2];
+            out[i + 1] = in[i + 1];
+            out[i + 2] = in[i + 0];
+        }
+    }
+};
+
+template<> struct Pixels<4, true> {
+    /* Swap the channels in whole 32-bit words, which the compiler can
+       vectorize */
+    static void copy(const char* const in, char* const out, const std::size_t count) {
+        for(std::size_t i = 0; i != count; ++i) {
+            UnsignedInt pixel;
+            std::memcpy(&pixel, in + i*4, 4);
+            pixel = (pixel & 0xff00ff00u)|((pixel >> 16) & 0x000000ffu)|((pixel & 0x000000ffu) << 16);
+            std::memcpy(out + i*4, &pixel, 4);
+        }
+    }
+};
+
+bool checkFormat(const char* const prefix, const ImageReference2D& image) {
     #ifndef MAGNUM_TARGET_GLES
     if(image.format() != ColorFormat::BGR &&
        image.format() != ColorFormat::BGRA &&
@@ -59,42 +101,184 @@ Containers::Array<char> TgaImageConverter::doExportToData(const ImageReference2D
        image.format() != ColorFormat::Red)
     #endif
     {
-        Error() << "Trade::TgaImageConverter::exportToData(): unsupported color format" << image.format();
-        return nullptr;
+        Error() << prefix << "unsupported color format" << image.format();
+        return false;
     }
 
     if(image.type() != ColorType::UnsignedByte) {
-        Error() << "Trade::TgaImageConverter::exportToData(): unsupported color type" << image.type();
-        return nullptr;
+        Error() << prefix << "unsupported color type" << image.type();
+        return false;
+    }
+
+    return true;
+}
+
+std::size_t dataSize(const ImageReference2D& image) {
+    return sizeof(TgaHeader) + image.pixelSize()*image.size().product();
+}
+
+/* Without swizzling the pixels are passed to the sink directly from the
+   image */
+template<std::size_t pixelSize, class Sink> bool writeRaw(const char* const in, const std::size_t count, Sink& sink) {
+    if(!Swizzle) return sink(in, count*pixelSize);
+
+    char buffer[ChunkSize];
+    constexpr std::size_t chunkPixels = ChunkSize/pixelSize;
+    for(std::size_t i = 0; i < count; i += chunkPixels) {
+        const std::size_t n = std::min(chunkPixels, count - i);
+        Pixels<pixelSize, Swizzle>::copy(in + i*pixelSize, buffer, n);
+        if(!sink(buffer, n*pixelSize)) return false;
     }
 
-    /* Initialize data buffer */
+    return true;
+}
+
+/* Run-length packets don't cross scanlines, as recommended by the TGA
+   specification. Two or more repeated pixels form a run-length packet, the
+   rest is put into raw packets. */
+template<std::size_t pixelSize, class Sink> bool writeRle(const char* const in, const Vector2i& size, Sink& sink) {
+    char buffer[ChunkSize];
+    std::size_t used = 0;
+    /* Flushes the buffer if there isn't enough space for the packet */
+    auto reserve = [&](const std::size_t packetSize) {
+        if(used + packetSize <= ChunkSize) return true;
+        const bool written = sink(buffer, used);
+        used = 0;
+        return written;
+    };
+    auto equal = [](const char* const a, const char* const b) {
+        return std::memcmp(a, b, pixelSize) == 0;
+    };
+
+    const std::size_t width = size.x();
+    for(std::size_t y = 0; y != std::size_t(size.y()); ++y) {
+        const char* const row = in + y*width*pixelSize;
+        for(std::size_t x = 0; x != width; ) {
+            const char* const pixel = row + x*pixelSize;
+
+            std::size_t count = 1;
+            while(x + count != width && count != 128 && equal(pixel + count*pixelSize, pixel))
+                ++count;
+
+            if(count > 1) {
+                if(!reserve(1 + pixelSize)) return false;
+                buffer[used] = char(0x80|(count - 1));
+                Pixels<pixelSize, Swizzle>::copy(pixel, buffer + used + 1, 1);
+                used += 1 + pixelSize;
+
+            /* Extend the raw packet until the next run begins */
+            } else {
+                while(x + count != width && count != 128 && !(x + count + 1 != width && equal(pixel + count*pixelSize, pixel + (count + 1)*pixelSize)))
+                    ++count;
+
+                if(!reserve(1 + count*pixelSize)) return false;
+                buffer[used] = char(count - 1);
+                Pixels<pixelSize, Swizzle>::copy(pixel, buffer + used + 1, count);
+                used += 1 + count*pixelSize;
+            }
+
+            x += count;
+        }
+    }
+
+    return !used || sink(buffer, used);
+}
+
+/* Passes the header and pixel data to the sink, which is called with
+   pointer and size of each chunk and returns false on failure */
+template<class Sink> bool write(const ImageReference2D& image, const bool rle, Sink sink) {
     const auto pixelSize = UnsignedByte(image.pixelSize());
-    auto data = Containers::Array<char>::zeroInitialized(sizeof(TgaHeader) + pixelSize*image.size().product());
-
-    /* Fill header */
-    auto header = reinterpret_cast<TgaHeader*>(data.begin());
-    header->imageType = image.format() == ColorFormat::Red ? 3 : 2;
-    header->bpp = pixelSize*8;
-    header->width = UnsignedShort(Utility::Endianness::littleEndian(image.size().x()));
-    header->height = UnsignedShort(Utility::Endianness::littleEndian(image.size().y()));
-
-    /* Fill data */
-    std::copy(image.data(), image.data()+pixelSize*image.size().product(), data.begin()+sizeof(TgaHeader));
-
-    #ifdef MAGNUM_TARGET_GLES
-    if(image.format() == ColorFormat::RGB) {
-        auto pixels = reinterpret_cast<Math::Vector3<UnsignedByte>*>(data.begin()+sizeof(TgaHeader));
-        std::transform(pixels, pixels + image.size().product(), pixels,
-            [](Math::Vector3<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r'>(pixel); });
-    } else if(image.format() == ColorFormat::RGBA) {
-        auto pixels = reinterpret_cast<Math::Vector4<UnsignedByte>*>(data.begin()+sizeof(TgaHeader));
-        std::transform(pixels, pixels + image.size().product(), pixels,
-            [](Math::Vector4<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r', 'a'>(pixel); });
+    TgaHeader header{};
+    header.imageType = (image.format() == ColorFormat::Red ? 3 : 2) + (rle ? 8 : 0);
+    header.bpp = pixelSize*8;
+    header.width = UnsignedShort(Utility::Endianness::littleEndian(image.size().x()));
+    header.height = UnsignedShort(Utility::Endianness::littleEndian(image.size().y()));
+    if(!sink(reinterpret_cast<const char*>(&header), sizeof(TgaHeader)))
+        return false;
+
+    const std::size_t count = image.size().product();
+    switch(pixelSize) {
+        case 1: return rle ? writeRle<1>(image.data(), image.size(), sink) : writeRaw<1>(image.data(), count, sink);
+        case 3: return rle ? writeRle<3>(image.data(), image.size(), sink) : writeRaw<3>(image.data(), count, sink);
+        case 4: return rle ? writeRle<4>(image.data(), image.size(), sink) : writeRaw<4>(image.data(), count, sink);
     }
-    #endif
 
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+/* Uncompressed size is known upfront, so the output is written directly into
+   a preallocated memory, compressed output is appended to a vector */
+void writeUncompressedInto(const ImageReference2D& image, char* out) {
+    write(image, false, [&out](const char* const data, const std::size_t size) {
+        std::memcpy(out, data, size);
+        out += size;
+        return true;
+    });
+}
+
+void writeCompressedInto(const ImageReference2D& image, std::vector<char>& out) {
+    out.clear();
+    write(image, true, [&out](const char* const data, const std::size_t size) {
+        out.insert(out.end(), data, data + size);
+        return true;
+    });
+}
+
+}
+
+Containers::Array<char> TgaImageConverter::doExportToData(const ImageReference2D& image) const {
+    if(!checkFormat("Trade::TgaImageConverter::exportToData():", image)) return nullptr;
+
+    if(!_rle) {
+        Containers::Array<char> data(dataSize(image));
+        writeUncompressedInto(image, data.begin());
+        return data;
+    }
+
+    std::vector<char> compressed;
+    writeCompressedInto(image, compressed);
+    Containers::Array<char> data(compressed.size());
+    std::copy(compressed.begin(), compressed.end(), data.begin());
     return data;
 }
 
+bool TgaImageConverter::doExportToDataInto(const ImageReference2D& image, std::vector<char>& data) const {
+    if(!checkFormat("Trade::TgaImageConverter::exportToData():", image)) return false;
+
+    /* Resizing to the same size as previous export doesn't reallocate,
+       clearing keeps the capacity */
+    if(!_rle) {
+        data.resize(dataSize(image));
+        writeUncompressedInto(image, data.data());
+    } else writeCompressedInto(image, data);
+    return true;
+}
+
+bool TgaImageConverter::exportToStream(const ImageReference2D& image, std::ostream& out) const {
+    if(!checkFormat("Trade::TgaImageConverter::exportToStream():", image)) return false;
+
+    if(!write(image, _rle, [&out](const char* const data, const std::size_t size) {
+        return !!out.write(data, size);
+    })) {
+        Error() << "Trade::TgaImageConverter::exportToStream(): cannot write to the stream";
+        return false;
+    }
+
+    return true;
+}
+
+bool TgaImageConverter::doExportToFile(const ImageReference2D& image, const std::string& filename) const {
+    if(!checkFormat("Trade::TgaImageConverter::exportToFile():", image)) return false;
+
+    std::ofstream out(filename, std::ofstream::binary);
+    if(!out.good() || !write(image, _rle, [&out](const char* const data, const std::size_t size) {
+        return !!out.write(data, size);
+    })) {
+        Error() << "Trade::TgaImageConverter::exportToFile(): cannot write to file" << filename;
+        return false;
+    }
+
+    return true;
+}
+
 }}
@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Trade::TgaImageConverter
  */
 
+#include <iosfwd>
+
 #include "Magnum/Trade/AbstractImageConverter.h"
 
 #include "MagnumPlugins/TgaImageConverter/configure.h"
@@ -55,6 +57,11 @@ Supports images with format @ref ColorFormat::BGR, @ref ColorFormat::BGRA
 (@ref ColorFormat::RGB/@ref ColorFormat::RGBA on OpenGL ES) or
 @ref ColorFormat::Red and type @ref ColorType::UnsignedByte.
 
+The output is uncompressed by default, RLE compression can be enabled with
+@ref setRleCompression(). The pixels are written in chunks without any
+intermediate copy of the whole image, use @ref exportToFile() or
+@ref exportToStream() to write them directly to disk.
+
 This plugin is built if `WITH_TGAIMAGECONVERTER` is enabled when building
 Magnum. To use dynamic plugin, you need to load `TgaImageConverter` plugin
 from `MAGNUM_PLUGINS_IMAGECONVERTER_DIR`. To use static plugin or use this as a
@@ -71,9 +78,38 @@ class MAGNUM_TRADE_TGAIMAGECONVERTER_EXPORT TgaImageConverter: public AbstractIm
         /** @brief Plugin manager constructor */
         explicit TgaImageConverter(PluginManager::AbstractManager& manager, std::string plugin);
 
+        /** @brief Whether RLE compression is enabled */
+        bool rleCompression() const { return _rle; }
+
+        /**
+         * @brief Enable or disable RLE compression
+         * @return Reference to self (for method chaining)
+         *
+         * Run-length packets don't cross scanlines. Images with large areas
+         * of the same color (such as screenshots of user interfaces) are
+         * considerably smaller, noisy images may end up slightly larger than
+         * uncompressed. Disabled by default.
+         */
+        TgaImageConverter& setRleCompression(bool enabled);
+
+        /**
+         * @brief Export image to a stream
+         *
+         * Writes the output in chunks of implementation-defined size, with
+         * the channel swizzling on OpenGL ES and RLE compression done on the
+         * fly. Returns `false` and prints a message to error output if the
+         * image format is not supported or the stream can't be written to.
+         * @see @ref exportToFile()
+         */
+        bool exportToStream(const ImageReference2D& image, std::ostream& out) const;
+
     private:
         Features MAGNUM_TRADE_TGAIMAGECONVERTER_LOCAL doFeatures() const override;
         Containers::Array<char> MAGNUM_TRADE_TGAIMAGECONVERTER_LOCAL doExportToData(const ImageReference2D& image) const override;
+        bool MAGNUM_TRADE_TGAIMAGECONVERTER_LOCAL doExportToDataInto(const ImageReference2D& image, std::vector<char>& data) const override;
+        bool MAGNUM_TRADE_TGAIMAGECONVERTER_LOCAL doExportToFile(const ImageReference2D& image, const std::string& filename) const override;
+
+        bool _rle{};
 };
 
 }}
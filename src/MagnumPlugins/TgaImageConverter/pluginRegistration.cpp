@@ -26,4 +26,4 @@
 #include "MagnumPlugins/TgaImageConverter/TgaImageConverter.h"
 
 CORRADE_PLUGIN_REGISTER(TgaImageConverter, Magnum::Trade::TgaImageConverter,
-    "cz.mosra.magnum.Trade.AbstractImageConverter/0.2.1")
+    "cz.mosra.magnum.Trade.AbstractImageConverter/0.2.3")
@@ -52,6 +52,16 @@ class TgaImporterTest: public TestSuite::Tester {
         void grayscaleBits8();
         void grayscaleBits16();
 
+        void colorBits24Rle();
+        void grayscaleBits8Rle();
+        void rleTruncated();
+        void dataTooShort();
+        void identField();
+
+        void properties();
+        void into();
+        void intoTooSmall();
+
         void file();
 };
 
@@ -68,6 +78,16 @@ TgaImporterTest::TgaImporterTest() {
               &TgaImporterTest::grayscaleBits8,
               &TgaImporterTest::grayscaleBits16,
 
+              &TgaImporterTest::colorBits24Rle,
+              &TgaImporterTest::grayscaleBits8Rle,
+              &TgaImporterTest::rleTruncated,
+              &TgaImporterTest::dataTooShort,
+              &TgaImporterTest::identField,
+
+              &TgaImporterTest::properties,
+              &TgaImporterTest::into,
+              &TgaImporterTest::intoTooSmall,
+
               &TgaImporterTest::file});
 }
 
@@ -222,6 +242,175 @@ void TgaImporterTest::grayscaleBits16() {
     CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): unsupported grayscale bits-per-pixel: 16\n");
 }
 
+void TgaImporterTest::colorBits24Rle() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 24, 0,
+        /* Three repeated pixels, three raw pixels */
+        '\x82', 1, 2, 3,
+        2, 3, 4, 5, 5, 6, 7, 6, 7, 8
+    };
+    #ifndef MAGNUM_TARGET_GLES
+    const char pixels[] = {
+        1, 2, 3, 1, 2, 3,
+        1, 2, 3, 3, 4, 5,
+        5, 6, 7, 6, 7, 8
+    };
+    #else
+    const char pixels[] = {
+        3, 2, 1, 3, 2, 1,
+        3, 2, 1, 5, 4, 3,
+        7, 6, 5, 8, 7, 6
+    };
+    #endif
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(image->format(), ColorFormat::BGR);
+    #else
+    CORRADE_COMPARE(image->format(), ColorFormat::RGB);
+    #endif
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE(image->type(), ColorType::UnsignedByte);
+    CORRADE_COMPARE((std::string{image->data(), 2*3*3}),
+                    (std::string{pixels, 2*3*3}));
+}
+
+void TgaImporterTest::grayscaleBits8Rle() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        /* Two raw pixels, four repeated pixels */
+        1, 1, 2,
+        '\x83', 3
+    };
+    const char pixels[] = {
+        1, 2,
+        3, 3,
+        3, 3
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    #ifndef MAGNUM_TARGET_GLES2
+    CORRADE_COMPARE(image->format(), ColorFormat::Red);
+    #else
+    CORRADE_COMPARE(image->format(), ColorFormat::Luminance);
+    #endif
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE((std::string{image->data(), 2*3}),
+                    (std::string{pixels, 2*3}));
+}
+
+void TgaImporterTest::rleTruncated() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        /* Only four pixels out of six */
+        1, 1, 2,
+        '\x81', 3
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+    CORRADE_VERIFY(!importer.image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): RLE data are truncated or corrupted\n");
+}
+
+void TgaImporterTest::dataTooShort() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        1, 2,
+        3, 4
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+    CORRADE_VERIFY(!importer.image2D(0));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2D(): the file is too short for the image data\n");
+}
+
+void TgaImporterTest::identField() {
+    TgaImporter importer;
+    const char data[] = {
+        3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        'a', 'b', 'c',
+        1, 2,
+        3, 4,
+        5, 6
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<Trade::ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE((std::string{image->data(), 2*3}),
+                    (std::string{data + 21, 2*3}));
+}
+
+void TgaImporterTest::properties() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 32, 0
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    /* The pixel data aren't touched, so the truncated file doesn't matter */
+    std::optional<ImageReference2D> image = importer.image2DProperties();
+    CORRADE_VERIFY(image);
+    #ifndef MAGNUM_TARGET_GLES
+    CORRADE_COMPARE(image->format(), ColorFormat::BGRA);
+    #else
+    CORRADE_COMPARE(image->format(), ColorFormat::RGBA);
+    #endif
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE(image->type(), ColorType::UnsignedByte);
+    CORRADE_VERIFY(!image->data());
+    CORRADE_COMPARE(image->dataSize(image->size()), 2*3*4);
+}
+
+void TgaImporterTest::into() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        1, 2,
+        3, 4,
+        5, 6
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    char out[8]{};
+    std::optional<ImageReference2D> image = importer.image2DInto(out);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_VERIFY(image->data() == out);
+    CORRADE_COMPARE((std::string{out, 8}),
+                    (std::string{"\x01\x02\x03\x04\x05\x06\x00\x00", 8}));
+}
+
+void TgaImporterTest::intoTooSmall() {
+    TgaImporter importer;
+    const char data[] = {
+        0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 8, 0,
+        1, 2,
+        3, 4,
+        5, 6
+    };
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::ostringstream debug;
+    Error::setOutput(&debug);
+    char out[5];
+    CORRADE_VERIFY(!importer.image2DInto(out));
+    CORRADE_COMPARE(debug.str(), "Trade::TgaImporter::image2DInto(): expected at least 6 bytes of memory but got 5\n");
+}
+
 void TgaImporterTest::file() {
     TgaImporter importer;
     const char data[] = {
@@ -25,21 +25,14 @@
 
 #include "TgaImporter.h"
 
+#include <cstring>
 #include <fstream>
-#include <sstream>
 #include <Corrade/Utility/Endianness.h>
-#include <Corrade/Containers/Array.h>
 
 #include "Magnum/ColorFormat.h"
 #include "Magnum/Trade/ImageData.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
 
-#ifdef MAGNUM_TARGET_GLES
-#include <algorithm>
-#include "Magnum/Math/Swizzle.h"
-#include "Magnum/Math/Vector4.h"
-#endif
-
 #ifdef MAGNUM_TARGET_GLES2
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
@@ -47,47 +40,153 @@
 
 namespace Magnum { namespace Trade {
 
-TgaImporter::TgaImporter(): in(nullptr) {}
+namespace {
+
+/* In OpenGL ES BGR(A) is converted to RGB(A) while copying the pixels */
+#ifndef MAGNUM_TARGET_GLES
+constexpr bool Swizzle = false;
+#else
+constexpr bool Swizzle = true;
+#endif
+
+template<std::size_t pixelSize, bool swizzle> struct Pixels {
+    static void copy(const char* const in, char* const out, const std::size_t count) {
+        std::memcpy(out, in, count*pixelSize);
+    }
+};
+
+template<> struct Pixels<3, true> {
+    static void copy(const char* const in, char* const out, const std::size_t count) {
+        for(std::size_t i = 0; i != count*3; i += 3) {
+            out[i + 0] = in[i + 2];
+            out[i + 1] = in[i + 1];
+            out[i + 2] = in[i + 0];
+        }
+    }
+};
+
+template<> struct Pixels<4, true> {
+    /* Swap the channels in whole 32-bit words, which the compiler can
+       vectorize. The byte order of the words doesn't matter, as red and blue
+       are two bytes apart either way. */
+    static void copy(const char* const in, char* const out, const std::size_t count) {
+        for(std::size_t i = 0; i != count; ++i) {
+            UnsignedInt pixel;
+            std::memcpy(&pixel, in + i*4, 4);
+            pixel = (pixel & 0xff00ff00u)|((pixel >> 16) & 0x000000ffu)|((pixel & 0x000000ffu) << 16);
+            std::memcpy(out + i*4, &pixel, 4);
+        }
+    }
+};
+
+template<std::size_t pixelSize> bool decodeRle(const char* in, const char* const end, char* out, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ) {
+        if(in == end) return false;
+        const UnsignedByte packet = *in++;
+        const std::size_t packetCount = (packet & 0x7f) + 1;
+        if(packetCount > count - i) return false;
+
+        /* Run-length packet, a single pixel repeated */
+        if(packet & 0x80) {
+            if(std::size_t(end - in) < pixelSize) return false;
+            Pixels<pixelSize, Swizzle>::copy(in, out, 1);
+            for(std::size_t j = 1; j != packetCount; ++j)
+                std::memcpy(out + j*pixelSize, out, pixelSize);
+            in += pixelSize;
+
+        /* Raw packet */
+        } else {
+            if(std::size_t(end - in) < packetCount*pixelSize) return false;
+            Pixels<pixelSize, Swizzle>::copy(in, out, packetCount);
+            in += packetCount*pixelSize;
+        }
+
+        out += packetCount*pixelSize;
+        i += packetCount;
+    }
+
+    return true;
+}
+
+template<std::size_t pixelSize> bool decodePixels(const char* const in, const char* const end, char* const out, const std::size_t count, const bool rle) {
+    if(rle) return decodeRle<pixelSize>(in, end, out, count);
+
+    if(std::size_t(end - in) < count*pixelSize) return false;
+    Pixels<pixelSize, Swizzle>::copy(in, out, count);
+    return true;
+}
+
+}
+
+TgaImporter::TgaImporter() = default;
 
-TgaImporter::TgaImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)), in(nullptr) {}
+TgaImporter::TgaImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)) {}
 
 TgaImporter::~TgaImporter() { close(); }
 
 auto TgaImporter::doFeatures() const -> Features { return Feature::OpenData; }
 
-bool TgaImporter::doIsOpened() const { return in; }
+bool TgaImporter::doIsOpened() const { return !!_in; }
 
 void TgaImporter::doOpenData(const Containers::ArrayReference<const char> data) {
-    in = new std::istringstream{{data, data.size()}};
+    _in = Containers::Array<char>(data.size());
+    std::copy(data.begin(), data.end(), _in->begin());
 }
 
 void TgaImporter::doOpenFile(const std::string& filename) {
-    in = new std::ifstream(filename, std::ifstream::binary);
-    if(in->good()) return;
+    /* Read the whole file at once, the pixels are then decoded directly from
+       memory */
+    std::ifstream in(filename, std::ifstream::binary);
+    if(!in.good()) {
+        Error() << "Trade::TgaImporter::openFile(): cannot open file" << filename;
+        return;
+    }
 
-    Error() << "Trade::TgaImporter::openFile(): cannot open file" << filename;
-    close();
+    in.seekg(0, std::istream::end);
+    Containers::Array<char> data(std::size_t(in.tellg()));
+    in.seekg(0, std::istream::beg);
+    in.read(data.data(), data.size());
+    _in = std::move(data);
 }
 
-void TgaImporter::doClose() {
-    delete in;
-    in = nullptr;
-}
+void TgaImporter::doClose() { _in = std::nullopt; }
 
 UnsignedInt TgaImporter::doImage2DCount() const { return 1; }
 
+std::optional<ImageReference2D> TgaImporter::image2DProperties() {
+    CORRADE_ASSERT(isOpened(), "Trade::TgaImporter::image2DProperties(): no file opened", {});
+    return decode("Trade::TgaImporter::image2DProperties():", nullptr, 0);
+}
+
+std::optional<ImageReference2D> TgaImporter::image2DInto(const Containers::ArrayReference<char> data) {
+    CORRADE_ASSERT(isOpened(), "Trade::TgaImporter::image2DInto(): no file opened", {});
+    CORRADE_ASSERT(!data.empty(), "Trade::TgaImporter::image2DInto(): no memory to decode into", {});
+    return decode("Trade::TgaImporter::image2DInto():", data.data(), data.size());
+}
+
 std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
+    const std::optional<ImageReference2D> properties = decode("Trade::TgaImporter::image2D():", nullptr, 0);
+    if(!properties) return std::nullopt;
+
+    const std::size_t dataSize = properties->pixelSize()*properties->size().product();
+    char* const data = new char[dataSize];
+    if(!decode("Trade::TgaImporter::image2D():", data, dataSize)) {
+        delete[] data;
+        return std::nullopt;
+    }
+
+    return ImageData2D(properties->format(), properties->type(), properties->size(), data);
+}
+
+std::optional<ImageReference2D> TgaImporter::decode(const char* const prefix, char* const data, const std::size_t size) {
     /* Check if the file is long enough */
-    in->seekg(0, std::istream::end);
-    std::streamoff filesize = in->tellg();
-    in->seekg(0, std::istream::beg);
-    if(filesize < std::streamoff(sizeof(TgaHeader))) {
-        Error() << "Trade::TgaImporter::image2D(): the file is too short:" << filesize << "bytes";
+    if(_in->size() < std::size_t(sizeof(TgaHeader))) {
+        Error() << prefix << "the file is too short:" << _in->size() << "bytes";
         return std::nullopt;
     }
 
     TgaHeader header;
-    in->read(reinterpret_cast<char*>(&header), sizeof(TgaHeader));
+    std::memcpy(&header, _in->data(), sizeof(TgaHeader));
 
     /* Convert to machine endian */
     header.width = Utility::Endianness::littleEndian(header.width);
@@ -96,12 +195,12 @@ std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
     /* Image format */
     ColorFormat format;
     if(header.colorMapType != 0) {
-        Error() << "Trade::TgaImporter::image2D(): paletted files are not supported";
+        Error() << prefix << "paletted files are not supported";
         return std::nullopt;
     }
 
-    /* Color */
-    if(header.imageType == 2) {
+    /* Color, possibly RLE-compressed */
+    if(header.imageType == 2 || header.imageType == 10) {
         switch(header.bpp) {
             case 24:
                 #ifndef MAGNUM_TARGET_GLES
@@ -118,12 +217,12 @@ std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
                 #endif
                 break;
             default:
-                Error() << "Trade::TgaImporter::image2D(): unsupported color bits-per-pixel:" << header.bpp;
+                Error() << prefix << "unsupported color bits-per-pixel:" << header.bpp;
                 return std::nullopt;
         }
 
-    /* Grayscale */
-    } else if(header.imageType == 3) {
+    /* Grayscale, possibly RLE-compressed */
+    } else if(header.imageType == 3 || header.imageType == 11) {
         #ifdef MAGNUM_TARGET_GLES2
         format = Context::current() && Context::current()->isExtensionSupported<Extensions::GL::EXT::texture_rg>() ?
             ColorFormat::Red : ColorFormat::Luminance;
@@ -131,35 +230,42 @@ std::optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt) {
         format = ColorFormat::Red;
         #endif
         if(header.bpp != 8) {
-            Error() << "Trade::TgaImporter::image2D(): unsupported grayscale bits-per-pixel:" << header.bpp;
+            Error() << prefix << "unsupported grayscale bits-per-pixel:" << header.bpp;
             return std::nullopt;
         }
 
-    /* Compressed files */
+    /* Other compressed files */
     } else {
-        Error() << "Trade::TgaImporter::image2D(): unsupported (compressed?) image type:" << header.imageType;
+        Error() << prefix << "unsupported (compressed?) image type:" << header.imageType;
         return std::nullopt;
     }
 
-    const std::size_t dataSize = header.width*header.height*header.bpp/8;
-    char* const data = new char[dataSize];
-    in->read(data, dataSize);
-
-    Vector2i size(header.width, header.height);
-
-    #ifdef MAGNUM_TARGET_GLES
-    if(format == ColorFormat::RGB) {
-        auto pixels = reinterpret_cast<Math::Vector3<UnsignedByte>*>(data);
-        std::transform(pixels, pixels + size.product(), pixels,
-            [](Math::Vector3<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r'>(pixel); });
-    } else if(format == ColorFormat::RGBA) {
-        auto pixels = reinterpret_cast<Math::Vector4<UnsignedByte>*>(data);
-        std::transform(pixels, pixels + size.product(), pixels,
-            [](Math::Vector4<UnsignedByte> pixel) { return Math::swizzle<'b', 'g', 'r', 'a'>(pixel); });
+    const Vector2i imageSize(header.width, header.height);
+    if(!data) return ImageReference2D{format, ColorType::UnsignedByte, imageSize};
+
+    const std::size_t pixelCount = std::size_t(header.width)*header.height;
+    if(size < pixelCount*header.bpp/8) {
+        Error() << prefix << "expected at least" << pixelCount*header.bpp/8 << "bytes of memory but got" << size;
+        return std::nullopt;
+    }
+
+    /* Pixel data follow the header and the image ID field */
+    const std::size_t dataOffset = sizeof(TgaHeader) + header.identsize;
+    const char* const in = _in->data() + dataOffset;
+    const char* const end = _in->data() + _in->size();
+    const bool rle = header.imageType > 8;
+    bool decoded = false;
+    if(dataOffset <= _in->size()) switch(header.bpp) {
+        case 8: decoded = decodePixels<1>(in, end, data, pixelCount, rle); break;
+        case 24: decoded = decodePixels<3>(in, end, data, pixelCount, rle); break;
+        case 32: decoded = decodePixels<4>(in, end, data, pixelCount, rle); break;
+    }
+    if(!decoded) {
+        Error() << prefix << (rle ? "RLE data are truncated or corrupted" : "the file is too short for the image data");
+        return std::nullopt;
     }
-    #endif
 
-    return ImageData2D(format, ColorType::UnsignedByte, size, data);
+    return ImageReference2D{format, ColorType::UnsignedByte, imageSize, data};
 }
 
 }}
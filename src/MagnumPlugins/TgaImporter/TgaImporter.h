@@ -29,8 +29,10 @@
  * @brief Class @ref Magnum::Trade::TgaImporter
  */
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/VisibilityMacros.h>
 
+#include "Magnum/ImageReference.h"
 #include "Magnum/Trade/AbstractImporter.h"
 
 #include "MagnumPlugins/TgaImporter/configure.h"
@@ -53,7 +55,8 @@ namespace Magnum { namespace Trade {
 /**
 @brief TGA importer plugin
 
-Supports uncompressed BGR, BGRA or grayscale images with 8 bits per channel.
+Supports uncompressed and RLE-compressed BGR, BGRA or grayscale images with 8
+bits per channel.
 
 This plugin is built if `WITH_TGAIMPORTER` is enabled when building Magnum. To
 use dynamic plugin, you need to load `TgaImporter` plugin from
@@ -70,6 +73,26 @@ In OpenGL ES BGR and BGRA images are converted to @ref ColorFormat::RGB
 and @ref ColorFormat::RGBA. In OpenGL ES 2.0, if @es_extension{EXT,texture_rg}
 is not supported, grayscale images use @ref ColorFormat::Luminance instead of
 @ref ColorFormat::Red.
+
+@section TgaImporter-decode-into Decoding into existing memory
+
+Besides @ref image2D(), which allocates a new array for the pixels, the image
+can be decoded directly into user-provided memory, for example into a mapped
+buffer. The pixels are either copied or decompressed (and, in OpenGL ES,
+swizzled) in a single pass over the file data:
+@code
+Trade::TgaImporter importer;
+importer.openFile("texture.tga");
+std::optional<ImageReference2D> properties = importer.image2DProperties();
+
+const std::size_t size = properties->dataSize(properties->size());
+BufferImage2D image{properties->format(), properties->type(),
+    properties->size(), nullptr, BufferUsage::StaticDraw};
+char* data = static_cast<char*>(image.buffer().map(0, size,
+    Buffer::MapFlag::Write|Buffer::MapFlag::InvalidateBuffer));
+importer.image2DInto({data, size});
+image.buffer().unmap();
+@endcode
 */
 class MAGNUM_TRADE_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
     public:
@@ -81,6 +104,28 @@ class MAGNUM_TRADE_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
 
         ~TgaImporter();
 
+        /**
+         * @brief Image properties
+         *
+         * Returns format, type and size of the image with data pointer set
+         * to `nullptr`, without decoding the pixels. Use
+         * @ref ImageReference::dataSize() to get size of memory needed for
+         * @ref image2DInto(). Expects that a file is opened, returns
+         * `std::nullopt` if the file is invalid or unsupported.
+         */
+        std::optional<ImageReference2D> image2DProperties();
+
+        /**
+         * @brief Decode the image into existing memory
+         *
+         * Decodes the pixels into @p data, which is expected to be at least
+         * as large as reported by @ref image2DProperties(), and returns
+         * image reference pointing to it. Expects that a file is opened,
+         * returns `std::nullopt` if the file is invalid, unsupported or the
+         * memory is too small.
+         */
+        std::optional<ImageReference2D> image2DInto(Containers::ArrayReference<char> data);
+
     private:
         Features MAGNUM_TRADE_TGAIMPORTER_LOCAL doFeatures() const override;
         bool MAGNUM_TRADE_TGAIMPORTER_LOCAL doIsOpened() const override;
@@ -90,7 +135,9 @@ class MAGNUM_TRADE_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
         UnsignedInt MAGNUM_TRADE_TGAIMPORTER_LOCAL doImage2DCount() const override;
         std::optional<ImageData2D> MAGNUM_TRADE_TGAIMPORTER_LOCAL doImage2D(UnsignedInt id) override;
 
-        std::istream* in;
+        std::optional<ImageReference2D> MAGNUM_TRADE_TGAIMPORTER_LOCAL decode(const char* prefix, char* data, std::size_t size);
+
+        std::optional<Containers::Array<char>> _in;
 };
 
 }}
@@ -44,6 +44,10 @@ class WavImporterTest: public TestSuite::Tester {
         void unsupportedChannelCount();
         void mono16();
         void stereo8();
+        void streamFile();
+        void streamData();
+        void dataViewFile();
+        void dataViewData();
 };
 
 WavImporterTest::WavImporterTest() {
@@ -52,7 +56,11 @@ WavImporterTest::WavImporterTest() {
               &WavImporterTest::unsupportedFormat,
               &WavImporterTest::unsupportedChannelCount,
               &WavImporterTest::mono16,
-              &WavImporterTest::stereo8});
+              &WavImporterTest::stereo8,
+              &WavImporterTest::streamFile,
+              &WavImporterTest::streamData,
+              &WavImporterTest::dataViewFile,
+              &WavImporterTest::dataViewData});
 }
 
 void WavImporterTest::wrongSize() {
@@ -70,7 +78,7 @@ void WavImporterTest::wrongSignature() {
 
     WavImporter importer;
     CORRADE_VERIFY(!importer.openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "wrongSignature.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): the file signature is invalid\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): the file signature is invalid\n");
 }
 
 void WavImporterTest::unsupportedFormat() {
@@ -79,7 +87,7 @@ void WavImporterTest::unsupportedFormat() {
 
     WavImporter importer;
     CORRADE_VERIFY(!importer.openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "unsupportedFormat.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): unsupported audio format 2\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): unsupported audio format 2\n");
 }
 
 void WavImporterTest::unsupportedChannelCount() {
@@ -88,7 +96,7 @@ void WavImporterTest::unsupportedChannelCount() {
 
     WavImporter importer;
     CORRADE_VERIFY(!importer.openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "unsupportedChannelCount.wav")));
-    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openData(): unsupported channel count 6 with 8 bits per sample\n");
+    CORRADE_COMPARE(out.str(), "Audio::WavImporter::openFile(): unsupported channel count 6 with 8 bits per sample\n");
 }
 
 void WavImporterTest::mono16() {
@@ -119,6 +127,87 @@ void WavImporterTest::stereo8() {
     CORRADE_COMPARE(data[3], '\x7e');
 }
 
+void WavImporterTest::streamFile() {
+    WavImporter importer;
+    CORRADE_VERIFY(importer.features() & AbstractImporter::Feature::Streaming);
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "mono16.wav")));
+    CORRADE_COMPARE(importer.frameSize(), 2);
+    CORRADE_COMPARE(importer.frameCount(), 2);
+
+    /* Only whole frames are read */
+    char data[3];
+    CORRADE_COMPARE(importer.read(data), 1);
+    CORRADE_COMPARE(data[0], '\x1d');
+    CORRADE_COMPARE(data[1], '\x10');
+
+    /* Getting all data doesn't affect the streaming position */
+    CORRADE_COMPARE(importer.data().size(), 4);
+
+    CORRADE_COMPARE(importer.read(data), 1);
+    CORRADE_COMPARE(data[0], '\x71');
+    CORRADE_COMPARE(data[1], '\xc5');
+    CORRADE_COMPARE(importer.read(data), 0);
+
+    importer.seek(1);
+    CORRADE_COMPARE(importer.read(data), 1);
+    CORRADE_COMPARE(data[0], '\x71');
+
+    importer.seek(0);
+    CORRADE_COMPARE(importer.read(data), 1);
+    CORRADE_COMPARE(data[0], '\x1d');
+}
+
+void WavImporterTest::streamData() {
+    WavImporter importer;
+    CORRADE_VERIFY(importer.openData(Utility::Directory::read(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo8.wav"))));
+    CORRADE_COMPARE(importer.frameSize(), 2);
+    CORRADE_COMPARE(importer.frameCount(), 2);
+
+    char data[4];
+    importer.seek(1);
+    CORRADE_COMPARE(importer.read(data), 1);
+    CORRADE_COMPARE(data[0], '\xca');
+    CORRADE_COMPARE(data[1], '\x7e');
+    CORRADE_COMPARE(importer.read(data), 0);
+
+    importer.seek(0);
+    CORRADE_COMPARE(importer.read(data), 2);
+    CORRADE_COMPARE(data[0], '\xde');
+    CORRADE_COMPARE(data[3], '\x7e');
+}
+
+void WavImporterTest::dataViewFile() {
+    WavImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "mono16.wav")));
+
+    const Containers::ArrayReference<const char> data = importer.dataView();
+    CORRADE_COMPARE(data.size(), 4);
+    CORRADE_COMPARE(data[0], '\x1d');
+    CORRADE_COMPARE(data[1], '\x10');
+    CORRADE_COMPARE(data[2], '\x71');
+    CORRADE_COMPARE(data[3], '\xc5');
+
+    /* The view stays the same */
+    CORRADE_VERIFY(importer.dataView().data() == data.data());
+
+    /* Streaming still works */
+    char frame[2];
+    importer.seek(1);
+    CORRADE_COMPARE(importer.read(frame), 1);
+    CORRADE_COMPARE(frame[0], '\x71');
+}
+
+void WavImporterTest::dataViewData() {
+    WavImporter importer;
+    CORRADE_VERIFY(importer.openData(Utility::Directory::read(Utility::Directory::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo8.wav"))));
+
+    /* The temporary data were copied */
+    const Containers::ArrayReference<const char> data = importer.dataView();
+    CORRADE_COMPARE(data.size(), 4);
+    CORRADE_COMPARE(data[0], '\xde');
+    CORRADE_COMPARE(data[3], '\x7e');
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Audio::Test::WavImporterTest)
@@ -25,12 +25,20 @@
 
 #include "WavImporter.h"
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/Endianness.h>
 
 #include "MagnumPlugins/WavAudioImporter/WavHeader.h"
 
+#if defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_EMSCRIPTEN)
+/* AbstractImporter::doOpenFile() memory-maps the file */
+#define MAGNUM_WAVIMPORTER_USE_MMAP
+#endif
+
 namespace Magnum { namespace Audio {
 
 WavImporter::WavImporter() = default;
@@ -39,19 +47,15 @@ WavImporter::WavImporter(PluginManager::AbstractManager& manager, std::string pl
 
 WavImporter::~WavImporter() { close(); }
 
-auto WavImporter::doFeatures() const -> Features { return Feature::OpenData; }
+auto WavImporter::doFeatures() const -> Features { return Feature::OpenData|Feature::Streaming; }
 
-bool WavImporter::doIsOpened() const { return _data; }
+bool WavImporter::doIsOpened() const { return _view.data() || _file; }
 
-void WavImporter::doOpenData(Containers::ArrayReference<const char> data) {
-    /* Check file size */
-    if(data.size() < sizeof(WavHeader)) {
-        Error() << "Audio::WavImporter::openData(): the file is too short:" << data.size() << "bytes";
-        return;
-    }
+namespace {
 
-    /* Get header contents and fix endianness */
-    WavHeader header(*reinterpret_cast<const WavHeader*>(data.begin()));
+/* Validates the header and extracts format and frequency from it */
+bool parseHeader(const char* const prefix, WavHeader& header, const std::size_t size, Buffer::Format& format, UnsignedInt& frequency) {
+    /* Fix endianness */
     Utility::Endianness::littleEndianInPlace(header.chunkSize,
         header.subChunk1Size, header.audioFormat, header.numChannels,
         header.sampleRate, header.byteRate, header.blockAlign,
@@ -62,70 +66,170 @@ void WavImporter::doOpenData(Containers::ArrayReference<const char> data) {
        std::strncmp(header.format, "WAVE", 4) != 0 ||
        std::strncmp(header.subChunk1Id, "fmt ", 4) != 0 ||
        std::strncmp(header.subChunk2Id, "data", 4) != 0) {
-        Error() << "Audio::WavImporter::openData(): the file signature is invalid";
-        return;
+        Error() << prefix << "the file signature is invalid";
+        return false;
     }
 
     /* Check file size */
-    if(header.chunkSize + 8 != data.size()) {
-        Error() << "Audio::WavImporter::openData(): the file has improper size, expected"
-                << header.chunkSize + 8 << "but got" << data.size();
-        return;
+    if(header.chunkSize + 8 != size) {
+        Error() << prefix << "the file has improper size, expected"
+                << header.chunkSize + 8 << "but got" << size;
+        return false;
     }
 
     /* Check PCM format */
     if(header.audioFormat != 1) {
-        Error() << "Audio::WavImporter::openData(): unsupported audio format" << header.audioFormat;
-        return;
+        Error() << prefix << "unsupported audio format" << header.audioFormat;
+        return false;
     }
 
     /* Verify more things */
     if(header.subChunk1Size != 16 ||
-       header.subChunk2Size + 44 != data.size() ||
+       header.subChunk2Size + 44 != size ||
        header.blockAlign != header.numChannels*header.bitsPerSample/8 ||
        header.byteRate != header.sampleRate*header.blockAlign) {
-        Error() << "Audio::WavImporter::openData(): the file is corrupted";
-        return;
+        Error() << prefix << "the file is corrupted";
+        return false;
     }
 
     /* Decide about format */
     if(header.numChannels == 1 && header.bitsPerSample == 8)
-        _format = Buffer::Format::Mono8;
+        format = Buffer::Format::Mono8;
     else if(header.numChannels == 1 && header.bitsPerSample == 16)
-        _format = Buffer::Format::Mono16;
+        format = Buffer::Format::Mono16;
     else if(header.numChannels == 2 && header.bitsPerSample == 8)
-        _format = Buffer::Format::Stereo8;
+        format = Buffer::Format::Stereo8;
     else if(header.numChannels == 2 && header.bitsPerSample == 16)
-        _format = Buffer::Format::Stereo16;
+        format = Buffer::Format::Stereo16;
     else {
-        Error() << "Audio::WavImporter::openData(): unsupported channel count"
+        Error() << prefix << "unsupported channel count"
                 << header.numChannels << "with" << header.bitsPerSample
                 << "bits per sample";
-        return;
+        return false;
     }
 
     /* Save frequency */
-    _frequency = header.sampleRate;
+    frequency = header.sampleRate;
 
     /** @todo Convert the data from little endian too */
     CORRADE_INTERNAL_ASSERT(!Utility::Endianness::isBigEndian());
 
-    /* Copy the data */
-    _data = Containers::Array<char>(header.subChunk2Size);
-    std::copy(data.begin()+sizeof(WavHeader), data.end(), _data.begin());
-    return;
+    return true;
+}
+
+}
+
+void WavImporter::doOpenData(Containers::ArrayReference<const char> data, const DataFlags flags) {
+    /* Persistent data come only from the file mapped in doOpenFile() */
+    const char* const prefix = flags & DataFlag::Persistent ?
+        "Audio::WavImporter::openFile():" : "Audio::WavImporter::openData():";
+
+    /* Check file size */
+    if(data.size() < sizeof(WavHeader)) {
+        Error() << prefix << "the file is too short:" << data.size() << "bytes";
+        return;
+    }
+
+    /* Get header contents */
+    WavHeader header(*reinterpret_cast<const WavHeader*>(data.begin()));
+    if(!parseHeader(prefix, header, data.size(), _format, _frequency))
+        return;
+
+    /* Reference the data directly if possible, copy them otherwise */
+    if(flags & DataFlag::Persistent)
+        _view = {data.begin() + sizeof(WavHeader), header.subChunk2Size};
+    else {
+        _data = Containers::Array<char>(header.subChunk2Size);
+        std::copy(data.begin()+sizeof(WavHeader), data.end(), _data.begin());
+        _view = _data;
+    }
+    _dataSize = header.subChunk2Size;
+    _frameSize = header.blockAlign;
+    _position = 0;
+}
+
+void WavImporter::doOpenFile(const std::string& filename) {
+    #ifdef MAGNUM_WAVIMPORTER_USE_MMAP
+    /* The mapping is loaded on demand, so streaming doesn't need to load the
+       whole file either */
+    AbstractImporter::doOpenFile(filename);
+    #else
+    /* Open the file and get its size */
+    std::unique_ptr<std::ifstream> file{new std::ifstream{filename, std::ios::binary}};
+    if(!*file) {
+        Error() << "Audio::WavImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+    file->seekg(0, std::ios::end);
+    const std::size_t size = file->tellg();
+    if(size < sizeof(WavHeader)) {
+        Error() << "Audio::WavImporter::openFile(): the file is too short:" << size << "bytes";
+        return;
+    }
+
+    /* Get header contents, keep the file opened for streaming the data */
+    WavHeader header;
+    file->seekg(0);
+    file->read(reinterpret_cast<char*>(&header), sizeof(WavHeader));
+    if(!parseHeader("Audio::WavImporter::openFile():", header, size, _format, _frequency))
+        return;
+
+    _file = std::move(file);
+    _dataSize = header.subChunk2Size;
+    _frameSize = header.blockAlign;
+    _position = 0;
+    #endif
 }
 
-void WavImporter::doClose() { _data = nullptr; }
+void WavImporter::doClose() {
+    _data = nullptr;
+    _view = {};
+    _file = nullptr;
+}
 
 Buffer::Format WavImporter::doFormat() const { return _format; }
 
 UnsignedInt WavImporter::doFrequency() const { return _frequency; }
 
 Containers::Array<char> WavImporter::doData() {
-    Containers::Array<char> copy(_data.size());
-    std::copy(_data.begin(), _data.end(), copy.begin());
+    Containers::Array<char> copy(_dataSize);
+
+    /* Read the whole data from the file, then restore the streaming
+       position */
+    if(_file) {
+        _file->seekg(sizeof(WavHeader));
+        _file->read(copy.begin(), _dataSize);
+        _file->seekg(sizeof(WavHeader) + _position);
+    } else std::copy(_view.begin(), _view.end(), copy.begin());
+
     return copy;
 }
 
+Containers::ArrayReference<const char> WavImporter::doDataView() {
+    /* Load the whole data when streaming from a file */
+    if(_file && !_view.data()) {
+        _data = doData();
+        _view = _data;
+    }
+
+    return _view;
+}
+
+std::size_t WavImporter::doFrameCount() const { return _dataSize/_frameSize; }
+
+std::size_t WavImporter::doRead(Containers::ArrayReference<char> data) {
+    /* Read directly from the file offset, if streaming from file */
+    const std::size_t size = std::min(data.size(), _dataSize - _position);
+    if(_file) _file->read(data.begin(), size);
+    else std::copy(_view.begin() + _position, _view.begin() + _position + size, data.begin());
+
+    _position += size;
+    return size/_frameSize;
+}
+
+void WavImporter::doSeek(const std::size_t frame) {
+    _position = frame*_frameSize;
+    if(_file) _file->seekg(sizeof(WavHeader) + _position);
+}
+
 }}
@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Audio::WavImporter
  */
 
+#include <iosfwd>
+#include <memory>
 #include <Corrade/Containers/Array.h>
 
 #include "Magnum/Audio/AbstractImporter.h"
@@ -42,6 +44,14 @@ Supports mono and stereo PCM files with 8 or 16 bits per channel. The files are
 imported with @ref Buffer::Format::Mono8, @ref Buffer::Format::Mono16,
 @ref Buffer::Format::Stereo8 or @ref Buffer::Format::Stereo16, respectively.
 
+The importer supports @ref Feature::Streaming. On platforms with
+memory-mapping support, files opened with @ref openFile() are mapped and
+@ref dataView() references the sample data in the mapping directly, so they
+can be passed to @ref Buffer::setData() without any intermediate copy. On
+other platforms the files are kept open and @ref read() and @ref seek() work
+directly with file offsets. In both cases long tracks played through
+@ref StreamingSource don't need to be loaded into memory as a whole.
+
 This plugin is built if `WITH_WAVAUDIOIMPORTER` is enabled when building
 Magnum. To use dynamic plugin, you need to load `WavAudioImporter` plugin
 from `MAGNUM_PLUGINS_AUDIOIMPORTER_DIR`. To use static plugin or use this as a
@@ -62,14 +72,25 @@ class WavImporter: public AbstractImporter {
     private:
         Features doFeatures() const override;
         bool doIsOpened() const override;
-        void doOpenData(Containers::ArrayReference<const char> data) override;
+        void doOpenData(Containers::ArrayReference<const char> data, DataFlags flags) override;
+        void doOpenFile(const std::string& filename) override;
         void doClose() override;
 
         Buffer::Format doFormat() const override;
         UnsignedInt doFrequency() const override;
         Containers::Array<char> doData() override;
-
+        Containers::ArrayReference<const char> doDataView() override;
+        std::size_t doFrameCount() const override;
+        std::size_t doRead(Containers::ArrayReference<char> data) override;
+        void doSeek(std::size_t frame) override;
+
+        /* The view references either the persistent data passed to
+           doOpenData() or a copy of the data in _data. Empty if streaming
+           from a file. */
         Containers::Array<char> _data;
+        Containers::ArrayReference<const char> _view;
+        std::unique_ptr<std::ifstream> _file;
+        std::size_t _dataSize, _frameSize, _position;
         Buffer::Format _format;
         UnsignedInt _frequency;
 };